@@ -0,0 +1,50 @@
+function(ConfigureCUDA TARGET)
+
+
+# Find cuda runtime and cublas headers:
+FIND_PATH(CUDA_INCLUDE_PATH
+    NAMES cuda_runtime.h cublas_v2.h
+    PATHS
+    "${CUDA_PATH}/include"
+    "/usr/local/cuda/include"
+    )
+
+if(CUDA_INCLUDE_PATH)
+    message(STATUS "Cuda headers found at " ${CUDA_INCLUDE_PATH})
+else()
+    message(STATUS "CUDA HEADERS NOT FOUND (OPTIONAL)")
+endif()
+
+
+# Find cuda runtime and cublas libraries:
+FIND_LIBRARY(CUDART_LIBRARY
+    NAMES cudart
+    PATHS
+    "${CUDA_PATH}/lib64"
+    "${CUDA_PATH}/lib"
+    "/usr/local/cuda/lib64"
+    )
+FIND_LIBRARY(CUBLAS_LIBRARY
+    NAMES cublas
+    PATHS
+    "${CUDA_PATH}/lib64"
+    "${CUDA_PATH}/lib"
+    "/usr/local/cuda/lib64"
+    )
+
+if(CUDART_LIBRARY AND CUBLAS_LIBRARY)
+    message(STATUS "Cuda libraries found at " ${CUDART_LIBRARY} " " ${CUBLAS_LIBRARY})
+else()
+    message(STATUS "CUDA LIBRARIES NOT FOUND (OPTIONAL)")
+endif()
+
+
+if(CUDA_INCLUDE_PATH AND CUDART_LIBRARY AND CUBLAS_LIBRARY)
+    SET(CUDA_FOUND YES PARENT_SCOPE)
+
+    TARGET_INCLUDE_DIRECTORIES(${TARGET} PUBLIC ${CUDA_INCLUDE_PATH})
+    TARGET_LINK_LIBRARIES(${TARGET} PUBLIC ${CUBLAS_LIBRARY} ${CUDART_LIBRARY})
+endif()
+
+
+endfunction(ConfigureCUDA)
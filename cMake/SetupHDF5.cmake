@@ -0,0 +1,42 @@
+function(ConfigureHDF5 TARGET)
+
+
+# Find hdf5 headers:
+FIND_PATH(HDF5_INCLUDE_PATH
+    NAMES hdf5.h
+    PATHS
+    "${HDF5_PATH}/include"
+    PATH_SUFFIXES hdf5/serial
+    )
+
+if(HDF5_INCLUDE_PATH)
+    message(STATUS "Hdf5 headers found at " ${HDF5_INCLUDE_PATH})
+else()
+    message(STATUS "HDF5 HEADERS NOT FOUND (OPTIONAL)")
+endif()
+
+
+# Find hdf5 library:
+FIND_LIBRARY(HDF5_LIBRARIES
+    NAMES hdf5 hdf5_serial
+    PATHS
+    "${HDF5_PATH}/lib"
+    PATH_SUFFIXES hdf5/serial
+    )
+
+if(HDF5_LIBRARIES)
+    message(STATUS "Hdf5 library found at " ${HDF5_LIBRARIES})
+else()
+    message(STATUS "HDF5 LIBRARY NOT FOUND (OPTIONAL)")
+endif()
+
+
+if(HDF5_INCLUDE_PATH AND HDF5_LIBRARIES)
+    SET(HDF5_FOUND YES PARENT_SCOPE)
+
+    TARGET_INCLUDE_DIRECTORIES(${TARGET} PUBLIC ${HDF5_INCLUDE_PATH})
+    TARGET_LINK_LIBRARIES(${TARGET} PUBLIC ${HDF5_LIBRARIES})
+endif()
+
+
+endfunction(ConfigureHDF5)
@@ -0,0 +1,40 @@
+function(ConfigureZLIB TARGET)
+
+
+# Find zlib headers:
+FIND_PATH(ZLIB_INCLUDE_PATH
+    NAMES zlib.h
+    PATHS
+    "${ZLIB_PATH}/include"
+    )
+
+if(ZLIB_INCLUDE_PATH)
+    message(STATUS "Zlib headers found at " ${ZLIB_INCLUDE_PATH})
+else()
+    message(STATUS "ZLIB HEADERS NOT FOUND (OPTIONAL)")
+endif()
+
+
+# Find zlib library:
+FIND_LIBRARY(ZLIB_LIBRARIES
+    NAMES z
+    PATHS
+    "${ZLIB_PATH}/lib"
+    )
+
+if(ZLIB_LIBRARIES)
+    message(STATUS "Zlib library found at " ${ZLIB_LIBRARIES})
+else()
+    message(STATUS "ZLIB LIBRARY NOT FOUND (OPTIONAL)")
+endif()
+
+
+if(ZLIB_INCLUDE_PATH AND ZLIB_LIBRARIES)
+    SET(ZLIB_FOUND YES PARENT_SCOPE)
+
+    TARGET_INCLUDE_DIRECTORIES(${TARGET} PUBLIC ${ZLIB_INCLUDE_PATH})
+    TARGET_LINK_LIBRARIES(${TARGET} PUBLIC ${ZLIB_LIBRARIES})
+endif()
+
+
+endfunction(ConfigureZLIB)
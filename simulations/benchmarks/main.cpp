@@ -0,0 +1,314 @@
+// This benchmark suite runs scaled versions of representative examples with fixed problem sizes
+// and a fixed number of threads per rank to detect performance regressions between releases:
+//
+// mpirun -np 4 ./benchmarks [scenario]
+//
+// The scenarios are 'startup', 'elasticity-3d', 'magnetostatics-3d', 'multiharmonic-nonlinear-2d',
+// 'ddm-waveguide-2d' and 'hp-adaptivity-2d' (all by default). The DDM scenario uses all ranks
+// while the others run on every rank independently. The time of each phase (load, assembly,
+// solve, output, adapt and backend if any) is the time of the slowest rank. The 'backend' phase of
+// the 'startup' scenario is the solver back-end initialization on the first vector creation.
+// The results are written to 'benchmarks.json' by rank 0.
+
+#include "sparselizard.h"
+#include "universe.h"
+#include <fstream>
+#include <sstream>
+#include <functional>
+
+using namespace sl;
+
+// Fixed number of threads per rank for reproducible timings:
+int numthreads = 4;
+
+struct benchmarkresult
+{
+    std::string scenario;
+    long long int numdofs;
+    std::vector<std::pair<std::string, double>> phases;
+};
+
+// Time a phase on all ranks and return the time of the slowest rank in seconds:
+double timephase(std::function<void(void)> phase)
+{
+    slmpi::barrier();
+    wallclock clk;
+    phase();
+    std::vector<double> duration = {clk.toc()*1e-9};
+    slmpi::max(duration);
+    
+    return duration[0];
+}
+
+// Post-processing run without solve followed by the first PETSc object creation (which initializes the solver back-ends):
+benchmarkresult startup(void)
+{
+    int sur = 1;
+    int n = 10;
+    
+    mesh mymesh;
+    double loadtime = timephase([&](void)
+    {
+        shape q("quadrangle", sur, {0,0,0, 1,0,0, 1,1,0, 0,1,0}, {n,n,n,n});
+        mymesh.load({q}, 0);
+    });
+    
+    field v("h1"), x("x"), y("y");
+    v.setorder(sur, 1);
+    
+    double outputtime = timephase([&](void){ (x*y).write(sur, "benchmark-startup.vtu", 1); });
+    
+    formulation projection;
+    projection += integral(sur, dof(v)*tf(v) - x*y*tf(v));
+    
+    double backendtime = timephase([&](void){ vec b(projection); });
+    
+    return {"startup", projection.countdofs(), {{"load", loadtime}, {"output", outputtime}, {"backend", backendtime}}};
+}
+
+benchmarkresult elasticity3d(void)
+{
+    int vol = 1, sur = 2, top = 3;
+    
+    mesh mymesh;
+    double loadtime = timephase([&](void){ mymesh.load("disk.msh", 0); });
+    
+    field u("h1xyz");
+    u.setorder(vol, 3);
+    u.setconstraint(sur);
+    
+    parameter E, nu;
+    E|vol = 150e9; nu|vol = 0.3;
+    
+    formulation elasticity;
+    elasticity += integral(vol, predefinedelasticity(dof(u), tf(u), E, nu));
+    elasticity += integral(vol, array1x3(0,0,-10)*tf(u));
+    
+    mat A; vec b, sol;
+    double assemblytime = timephase([&](void){ elasticity.generate(); A = elasticity.A(); b = elasticity.b(); });
+    double solvetime = timephase([&](void){ sol = solve(A, b); });
+    u.setdata(vol, sol);
+    double outputtime = timephase([&](void){ u.write(top, "benchmark-u.vtu", 3); });
+    
+    return {"elasticity-3d", elasticity.countdofs(), {{"load", loadtime}, {"assembly", assemblytime}, {"solve", solvetime}, {"output", outputtime}}};
+}
+
+benchmarkresult magnetostatics3d(void)
+{
+    int conductor = 1, shield = 2, air = 3, contour = 4;
+    
+    mesh mymesh;
+    double loadtime = timephase([&](void){ mymesh.load("magmesh.msh", 0); });
+    
+    int wholedomain = selectunion({conductor,shield,air});
+    
+    double mu0 = 4*getpi()*1e-7;
+    parameter mu;
+    mu|air = mu0; mu|conductor = mu0; mu|shield = 1000*mu0;
+    
+    spanningtree spantree({contour});
+    field a("hcurl", spantree);
+    a.setgauge(wholedomain);
+    a.setorder(wholedomain, 2);
+    a.setconstraint(contour);
+    
+    formulation magnetostatics;
+    magnetostatics += integral(wholedomain, 1/mu* curl(dof(a)) * curl(tf(a)) );
+    magnetostatics += integral(conductor, -array3x1(0,0,1)*tf(a));
+    
+    mat A; vec b, sol;
+    double assemblytime = timephase([&](void){ magnetostatics.generate(); A = magnetostatics.A(); b = magnetostatics.b(); });
+    double solvetime = timephase([&](void){ sol = solve(A, b); });
+    a.setdata(wholedomain, sol);
+    double outputtime = timephase([&](void){ curl(a).write(wholedomain, "benchmark-b.vtu", 1); });
+    
+    return {"magnetostatics-3d", magnetostatics.countdofs(), {{"load", loadtime}, {"assembly", assemblytime}, {"solve", solvetime}, {"output", outputtime}}};
+}
+
+benchmarkresult multiharmonicnonlinear2d(void)
+{
+    int sur = 1, left = 2, right = 3;
+    int n = 60;
+    
+    mesh mymesh;
+    double loadtime = timephase([&](void)
+    {
+        shape q("quadrangle", sur, {0,0,0, 1,0,0, 1,1,0, 0,1,0}, {n,n,n,n});
+        shape l = q.getsons()[3], r = q.getsons()[1];
+        l.setphysicalregion(left); r.setphysicalregion(right);
+        mymesh.load({q, l, r}, 0);
+    });
+    
+    setfundamentalfrequency(50);
+    
+    // Nonlinear heat equation with a sine excitation (the nonlinearity creates higher harmonics):
+    field T("h1", {1,2,3,4,5});
+    T.setorder(sur, 2);
+    T.setconstraint(left);
+    T.harmonic(2).setconstraint(left, 1);
+    T.setconstraint(right);
+    
+    formulation heat;
+    heat += integral(sur, 20, -(1+0.5*T*T)*grad(dof(T))*grad(tf(T)) );
+    heat += integral(sur, -1e-3*dt(dof(T))*tf(T));
+    
+    // Fixed number of fixed-point iterations:
+    double assemblytime = 0, solvetime = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        mat A; vec b, sol;
+        assemblytime += timephase([&](void){ heat.generate(); A = heat.A(); b = heat.b(); });
+        solvetime += timephase([&](void){ sol = solve(A, b); });
+        T.setdata(sur, sol);
+    }
+    double outputtime = timephase([&](void){ T.harmonic(2).write(sur, "benchmark-T.vtu", 2); });
+    
+    return {"multiharmonic-nonlinear-2d", heat.countdofs(), {{"load", loadtime}, {"assembly", assemblytime}, {"solve", solvetime}, {"output", outputtime}}};
+}
+
+benchmarkresult ddmwaveguide2d(void)
+{
+    int left = 1, skin = 2, wholedomain = 3;
+    int rank = slmpi::getrank();
+    
+    // The connectivity is provided by the partitioner so no global geometry skin is needed:
+    mesh mymesh;
+    double loadtime = timephase([&](void){ mymesh.allload("waveguide2D.msh", -1, 1, 0); });
+    
+    field E("hcurl"), y("y");
+    E.setorder(wholedomain, 3);
+    
+    double freq = 0.9e9, c = 3e8, k = 2*getpi()*freq/c;
+    
+    E.setconstraint(skin);
+    E.setconstraint(left, sin(y/0.1*getpi())* array3x1(0,1,0));
+    
+    formulation maxwell;
+    maxwell += integral(wholedomain, -curl(dof(E))*curl(tf(E)) + k*k*dof(E)*tf(E));
+    
+    double assemblytime = 0, solvetime = 0;
+    if (slmpi::count() > 1)
+    {
+        // The DDM solve includes the assembly:
+        solvetime = timephase([&](void){ maxwell.allsolve(1e-8, 500, "lu", 0); });
+    }
+    else
+    {
+        mat A; vec b, sol;
+        assemblytime = timephase([&](void){ maxwell.generate(); A = maxwell.A(); b = maxwell.b(); });
+        solvetime = timephase([&](void){ sol = solve(A, b); });
+        E.setdata(wholedomain, sol);
+    }
+    double outputtime = timephase([&](void){ E.write(wholedomain, "benchmark-E"+std::to_string(1000+rank)+".vtu", 2); });
+    
+    std::vector<double> numdofs = {(double)maxwell.countdofs()};
+    slmpi::sum(numdofs);
+    
+    return {"ddm-waveguide-2d", (long long int)numdofs[0], {{"load", loadtime}, {"assembly", assemblytime}, {"solve", solvetime}, {"output", outputtime}}};
+}
+
+benchmarkresult hpadaptivity2d(void)
+{
+    int sur = 1;
+    int n = 20;
+    
+    mesh mymesh;
+    double loadtime = timephase([&](void)
+    {
+        shape q("quadrangle", sur, {0,0,0, 1,0,0, 1,1,0, 0,1,0}, {n,n,n,n});
+        mymesh.load({q}, 0);
+    });
+    
+    field v("h1"), x("x"), y("y");
+    v.setorder(sur, 2);
+    
+    expression toproject = sin(10*x)*sin(10*y);
+    
+    v.setorder(sin(10*x)*sin(10*y)+1e-3*v, 2, 5);
+    mymesh.setadaptivity(norm(grad(v)), 0, 2);
+    
+    formulation projection;
+    projection += integral(sur, dof(v)*tf(v) - toproject*tf(v));
+    
+    // Fixed number of hp-adaptation loops:
+    double assemblytime = 0, solvetime = 0, adapttime = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        mat A; vec b, sol;
+        assemblytime += timephase([&](void){ projection.generate(); A = projection.A(); b = projection.b(); });
+        solvetime += timephase([&](void){ sol = solve(A, b); });
+        v.setdata(sur, sol);
+        adapttime += timephase([&](void){ adapt(0); });
+    }
+    double outputtime = timephase([&](void){ v.write(sur, "benchmark-v.vtu", 2); });
+    
+    return {"hp-adaptivity-2d", projection.countdofs(), {{"load", loadtime}, {"assembly", assemblytime}, {"solve", solvetime}, {"adapt", adapttime}, {"output", outputtime}}};
+}
+
+int main(int argc, char** argv)
+{
+    slmpi::initialize();
+    
+    int rank = slmpi::getrank(), numranks = slmpi::count();
+    
+    universe::setmaxnumthreads(numthreads);
+    
+    std::vector<std::string> scenarios = {"startup", "elasticity-3d", "magnetostatics-3d", "multiharmonic-nonlinear-2d", "ddm-waveguide-2d", "hp-adaptivity-2d"};
+    if (argc > 1)
+        scenarios = {argv[1]};
+    
+    std::vector<benchmarkresult> results = {};
+    for (int i = 0; i < scenarios.size(); i++)
+    {
+        if (rank == 0)
+            std::cout << "Running benchmark '" << scenarios[i] << "'" << std::endl;
+        
+        if (scenarios[i] == "startup")
+            results.push_back(startup());
+        else if (scenarios[i] == "elasticity-3d")
+            results.push_back(elasticity3d());
+        else if (scenarios[i] == "magnetostatics-3d")
+            results.push_back(magnetostatics3d());
+        else if (scenarios[i] == "multiharmonic-nonlinear-2d")
+            results.push_back(multiharmonicnonlinear2d());
+        else if (scenarios[i] == "ddm-waveguide-2d")
+            results.push_back(ddmwaveguide2d());
+        else if (scenarios[i] == "hp-adaptivity-2d")
+            results.push_back(hpadaptivity2d());
+        else
+        {
+            if (rank == 0)
+                std::cout << "Unknown benchmark scenario '" << scenarios[i] << "'" << std::endl;
+            slmpi::finalize();
+            return 1;
+        }
+    }
+    
+    ///// Write the JSON report:
+    if (rank == 0)
+    {
+        std::stringstream json;
+        json << "{" << std::endl;
+        json << "    \"numranks\": " << numranks << "," << std::endl;
+        json << "    \"numthreads\": " << numthreads << "," << std::endl;
+        json << "    \"units\": {\"time\": \"s\"}," << std::endl;
+        json << "    \"results\": [" << std::endl;
+        for (int i = 0; i < results.size(); i++)
+        {
+            json << "        {\"scenario\": \"" << results[i].scenario << "\", \"numdofs\": " << results[i].numdofs;
+            for (int p = 0; p < results[i].phases.size(); p++)
+                json << ", \"" << results[i].phases[p].first << "\": " << results[i].phases[p].second;
+            json << "}" << ((i < results.size()-1) ? "," : "") << std::endl;
+        }
+        json << "    ]" << std::endl;
+        json << "}" << std::endl;
+        
+        std::cout << json.str();
+        
+        std::ofstream outfile("benchmarks.json");
+        outfile << json.str();
+        outfile.close();
+    }
+    
+    slmpi::finalize();
+}
@@ -0,0 +1,199 @@
+// This benchmark times the communication patterns used by the DDM solver on the neighbour graph of
+// a real mesh partition. Run it with mpirun on the cluster to diagnose interconnect regressions:
+//
+// mpirun -np 8 ./commbenchmark [meshfile] [numoverlaplayers]
+//
+// The latency is the time per operation of the slowest rank. The bandwidth is the number of bytes
+// sent (or received for the gathers) by the busiest rank divided by the latency. All results are
+// written to 'commbenchmark.json' by rank 0.
+
+#include "sparselizard.h"
+#include "universe.h"
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+
+using namespace sl;
+
+struct benchmarkresult
+{
+    std::string pattern;
+    long long int messagesize;
+    int numrepeats;
+    double latency;
+    double bandwidth;
+};
+
+// Repeat a communication pattern and return the time of the slowest rank in seconds per repetition:
+double timepattern(int numrepeats, std::function<void(void)> pattern)
+{
+    // Warm up the communicator:
+    pattern();
+    slmpi::barrier();
+
+    wallclock clk;
+    for (int i = 0; i < numrepeats; i++)
+        pattern();
+    std::vector<double> duration = {clk.toc()*1e-9/numrepeats};
+
+    slmpi::max(duration);
+
+    return duration[0];
+}
+
+int getnumrepeats(long long int messagesize)
+{
+    return std::max(5, (int)std::min(1000LL, 10000000LL/(messagesize+1)));
+}
+
+int main(int argc, char** argv)
+{
+    slmpi::initialize();
+
+    int rank = slmpi::getrank(), numranks = slmpi::count();
+
+    std::string meshfile = "disk.msh";
+    int numoverlaplayers = 1;
+    if (argc > 1)
+        meshfile = argv[1];
+    if (argc > 2)
+        numoverlaplayers = std::stoi(argv[2]);
+
+    if (numranks < 2)
+    {
+        if (rank == 0)
+            std::cout << "The communication benchmark must be run on at least 2 ranks (e.g. 'mpirun -np 4 ./commbenchmark')" << std::endl;
+        slmpi::finalize();
+        return 0;
+    }
+
+    std::vector<benchmarkresult> results = {};
+
+    ///// Read, partition and scatter the mesh (the partition defines the neighbour graph used below):
+    slmpi::barrier();
+    wallclock loadclk;
+    // The connectivity is provided by the partitioner so no global geometry skin is needed:
+    mesh mymesh;
+    mymesh.allload(meshfile, -1, numoverlaplayers, 0);
+    std::vector<double> loadtime = {loadclk.toc()*1e-9};
+    slmpi::max(loadtime);
+
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    std::shared_ptr<dtracker> dt = rm->getdtracker();
+    elements* els = rm->getelements();
+
+    std::vector<int> neighbours = dt->getneighbours();
+    int numneighbours = neighbours.size();
+
+    ///// Scatter of the mesh partitions with the sizes of the actual parts:
+    std::vector<int> localsizes = {3*rm->getnodes()->count(), 0};
+    for (int i = 0; i < 8; i++)
+        localsizes[1] += els->count(i) * element(i, els->getcurvatureorder()).countcurvednodes();
+
+    std::vector<int> allsizes;
+    slmpi::allgather(localsizes, allsizes);
+    std::vector<int> doublesizes(numranks), intsizes(numranks);
+    long long int totaldoubles = 0, totalints = 0;
+    for (int r = 0; r < numranks; r++)
+    {
+        doublesizes[r] = allsizes[2*r+0];
+        intsizes[r] = allsizes[2*r+1];
+        totaldoubles += doublesizes[r];
+        totalints += intsizes[r];
+    }
+
+    std::vector<double> doublestoscatter, doublefragment(doublesizes[rank]);
+    std::vector<int> intstoscatter, intfragment(intsizes[rank]);
+    if (rank == 0)
+    {
+        doublestoscatter = std::vector<double>(totaldoubles, 1.0);
+        intstoscatter = std::vector<int>(totalints, 1);
+    }
+    int scatterrepeats = getnumrepeats(totaldoubles+totalints);
+    double scattertime = timepattern(scatterrepeats, [&](void)
+    {
+        slmpi::scatter(0, doublestoscatter, doublefragment, doublesizes);
+        slmpi::scatter(0, intstoscatter, intfragment, intsizes);
+    });
+    long long int scatterbytes = totaldoubles*sizeof(double) + totalints*sizeof(int);
+    results.push_back({"scatter-mesh-partitions", totaldoubles+totalints, scatterrepeats, scattertime, scatterbytes/scattertime});
+
+    ///// Allgatherv of the barycenters of all no-overlap interface elements:
+    std::vector<double> barys = {};
+    for (int n = 0; n < numneighbours; n++)
+    {
+        for (int d = 0; d < 3; d++)
+        {
+            int pr = dt->getnooverlapinterface(neighbours[n], d);
+            if (pr < 0)
+                continue;
+            std::vector<double> curbarys;
+            els->getbarycenters(rm->getphysicalregions()->get(pr)->getelementlist(), curbarys);
+            barys.insert(barys.end(), curbarys.begin(), curbarys.end());
+        }
+    }
+    std::vector<int> barysize = {(int)barys.size()}, barysizes;
+    slmpi::allgather(barysize, barysizes);
+    long long int totalbarys = 0;
+    for (int r = 0; r < numranks; r++)
+        totalbarys += barysizes[r];
+
+    std::vector<double> allbarys;
+    int allgatherrepeats = getnumrepeats(totalbarys);
+    double allgathertime = timepattern(allgatherrepeats, [&](void){ slmpi::allgather(barys, allbarys, barysizes); });
+    results.push_back({"allgatherv-interface-barycenters", totalbarys, allgatherrepeats, allgathertime, totalbarys*sizeof(double)/allgathertime});
+
+    ///// Sum and max reductions (vec norms and residuals reduce a single value, block solvers a few):
+    for (int len : {1, 16, 1024})
+    {
+        std::vector<double> vals(len, 1.0);
+        int reductionrepeats = getnumrepeats(len);
+        double sumtime = timepattern(reductionrepeats, [&](void){ slmpi::sum(vals); });
+        double maxtime = timepattern(reductionrepeats, [&](void){ slmpi::max(vals); });
+        results.push_back({"sum", len, reductionrepeats, sumtime, len*sizeof(double)/sumtime});
+        results.push_back({"max", len, reductionrepeats, maxtime, len*sizeof(double)/maxtime});
+    }
+
+    ///// Neighbour exchange on the DDM graph for a range of message sizes per neighbour:
+    std::vector<int> maxneighbours = {numneighbours};
+    slmpi::max(maxneighbours);
+    for (long long int len : {1, 10, 100, 1000, 10000, 100000, 1000000})
+    {
+        std::vector<std::vector<double>> sends(numneighbours, std::vector<double>(len, 1.0)), receives(numneighbours, std::vector<double>(len));
+        int exchangerepeats = getnumrepeats(len*std::max(1, maxneighbours[0]));
+        double exchangetime = timepattern(exchangerepeats, [&](void){ slmpi::exchange(neighbours, sends, receives); });
+        results.push_back({"exchange-ddm-neighbours", len, exchangerepeats, exchangetime, maxneighbours[0]*len*sizeof(double)/exchangetime});
+    }
+
+    ///// Write the JSON report:
+    if (rank == 0)
+    {
+        std::stringstream json;
+        json << "{" << std::endl;
+        json << "    \"numranks\": " << numranks << "," << std::endl;
+        json << "    \"ranksonnode\": " << slmpi::countonnode() << "," << std::endl;
+        json << "    \"meshfile\": \"" << meshfile << "\"," << std::endl;
+        json << "    \"numoverlaplayers\": " << numoverlaplayers << "," << std::endl;
+        json << "    \"maxneighbours\": " << maxneighbours[0] << "," << std::endl;
+        json << "    \"meshloadtime\": " << loadtime[0] << "," << std::endl;
+        json << "    \"units\": {\"messagesize\": \"values (per neighbour for exchange)\", \"latency\": \"s\", \"bandwidth\": \"B/s\"}," << std::endl;
+        json << "    \"results\": [" << std::endl;
+        for (int i = 0; i < results.size(); i++)
+        {
+            json << "        {\"pattern\": \"" << results[i].pattern << "\", \"messagesize\": " << results[i].messagesize << ", \"repeats\": " << results[i].numrepeats;
+            json << ", \"latency\": " << results[i].latency << ", \"bandwidth\": " << results[i].bandwidth << "}";
+            json << ((i < results.size()-1) ? "," : "") << std::endl;
+        }
+        json << "    ]" << std::endl;
+        json << "}" << std::endl;
+
+        std::cout << json.str();
+
+        std::ofstream outfile("commbenchmark.json");
+        outfile << json.str();
+        outfile.close();
+    }
+
+    slmpi::finalize();
+}
@@ -0,0 +1,191 @@
+// This benchmark times the hot kernels of the assembly in isolation on sizes matching real element
+// blocks (number of elements x number of Gauss points x number of form functions):
+//
+// ./microbenchmarks [filter]
+//
+// Only the kernels whose name contains 'filter' are run. Every kernel is repeated until it ran for
+// at least 0.2 s. The floating point operations and bytes moved per call are counted analytically
+// (minimum traffic, every value read or written once) to give GFLOP/s and GB/s that can be
+// compared to the hardware roofline. All results are written to 'microbenchmarks.json'.
+
+#include "sparselizard.h"
+#include "universe.h"
+#include "fourier.h"
+#include "coordinategroup.h"
+#include "gausspoints.h"
+#include <fstream>
+#include <sstream>
+#include <functional>
+
+using namespace sl;
+
+struct benchmarkresult
+{
+    std::string kernel;
+    std::string size;
+    int numrepeats;
+    double time;
+    double gflops;
+    double gbytes;
+};
+
+std::vector<benchmarkresult> results = {};
+std::string filter = "";
+
+// Block shapes {number of elements, number of Gauss points, number of form functions}:
+std::vector<std::vector<int>> blockshapes = {{2000, 4, 4}, {2000, 15, 10}, {1000, 45, 35}, {500, 125, 64}};
+
+densemat getrandom(long long int numrows, long long int numcols)
+{
+    densemat output(numrows, numcols);
+    double* vals = output.getvalues();
+    for (long long int i = 0; i < numrows*numcols; i++)
+        vals[i] = 0.5 + 0.5*std::sin(1.0+i);
+    return output;
+}
+
+// Time a kernel and store its rates for the given number of operations and bytes per call:
+void run(std::string kernel, std::string size, double flops, double bytes, std::function<void(void)> tobench)
+{
+    if (kernel.find(filter) == std::string::npos)
+        return;
+
+    // Warm up the caches and the memory pool:
+    tobench();
+    
+    int numrepeats = 0;
+    wallclock clk;
+    while (numrepeats == 0 || clk.toc() < 0.2e9)
+    {
+        tobench();
+        numrepeats++;
+    }
+    double time = clk.toc()*1e-9/numrepeats;
+    
+    results.push_back({kernel, size, numrepeats, time, flops/time*1e-9, bytes/time*1e-9});
+    
+    std::cout << std::left << std::setw(22) << kernel << std::setw(20) << size << std::setw(14) << time << std::setw(14) << flops/time*1e-9 << std::setw(14) << bytes/time*1e-9 << std::endl;
+}
+
+std::string tostring(std::vector<int> vals)
+{
+    std::string output = "";
+    for (int i = 0; i < vals.size(); i++)
+        output += (i > 0 ? "x" : "") + std::to_string(vals[i]);
+    return output;
+}
+
+int main(int argc, char** argv)
+{
+    slmpi::initialize();
+    
+    if (argc > 1)
+        filter = argv[1];
+    
+    std::cout << std::left << std::setw(22) << "kernel" << std::setw(20) << "size" << std::setw(14) << "time [s]" << std::setw(14) << "GFLOP/s" << std::setw(14) << "GB/s" << std::endl;
+    
+    for (int s = 0; s < blockshapes.size(); s++)
+    {
+        long long int el = blockshapes[s][0], gp = blockshapes[s][1], ff = blockshapes[s][2];
+        std::string size = tostring(blockshapes[s]);
+        
+        ///// Product of the dof*tf form function products (ff^2 x gp) with the coefficients (gp x el):
+        densemat doftimestf = getrandom(ff*ff, gp), coef = getrandom(gp, el);
+        run("multiply", size, 2.0*ff*ff*gp*el, 8.0*(ff*ff*gp + gp*el + ff*ff*el), [&](void){ doftimestf.multiply(coef); });
+        
+        ///// All row products of the tf and dof form function values (ff x gp each):
+        densemat tfval = getrandom(ff, gp), dofval = getrandom(ff, gp);
+        run("multiplyallrows", size, 1.0*ff*ff*gp, 8.0*(2*ff*gp + ff*ff*gp), [&](void){ tfval.multiplyallrows(dofval); });
+        
+        ///// Dof interpolation times tf (el x (gp x ffd) times ff x gp):
+        long long int ffd = 3;
+        densemat dofinterp = getrandom(el, gp*ffd);
+        run("dofinterpoltimestf", size, 1.0*el*gp*ffd*ff, 8.0*(el*gp*ffd + ff*gp + el*gp*ffd*ff), [&](void){ dofinterp.dofinterpoltimestf(tfval); });
+        
+        ///// Weights and Jacobian determinant (el x gp):
+        densemat coefvals = getrandom(el, gp);
+        std::vector<double> weights(gp, 1.0);
+        run("multiplycolumns", size, 1.0*el*gp, 16.0*el*gp, [&](void){ coefvals.multiplycolumns(weights); });
+        
+        // Unit values avoid denormals when the product is repeated in place:
+        densemat detjac(el, gp, 1.0);
+        run("multiplyelementwise", size, 1.0*el*gp, 24.0*el*gp, [&](void){ coefvals.multiplyelementwise(detjac); });
+        
+        ///// Transcendental functions (one operation counted per value):
+        densemat trig = getrandom(el, gp);
+        run("sin", size, 1.0*el*gp, 16.0*el*gp, [&](void){ trig.sin(); });
+        run("cos", size, 1.0*el*gp, 16.0*el*gp, [&](void){ trig.cos(); });
+        densemat posvals = getrandom(el, gp);
+        run("log10", size, 1.0*el*gp, 16.0*el*gp, [&](void){ densemat cp = posvals.copy(); cp.log10(); });
+        
+        ///// Assembly of synthetic fragments (element e holds the 'ff' dofs starting at e*ff/2):
+        long long int numdofs = el*ff/2 + ff;
+        indexmat ads(ff, el);
+        int* adsptr = ads.getvalues();
+        for (int i = 0; i < ff; i++)
+        {
+            for (int e = 0; e < el; e++)
+                adsptr[i*el+e] = e*ff/2 + i;
+        }
+        densemat fragvals = getrandom(ff*ff, el);
+        run("rawmat::process", size, 0.0, 8.0*ff*ff*el + 8.0*ff*el, [&](void){ mat A(numdofs, ads, ads, fragvals); });
+        
+        ///// Fft of 20 time evaluations at every Gauss point of every element:
+        int numtimeevals = 20;
+        densemat timevals = getrandom(numtimeevals, el*gp);
+        run("fourier::fft", size, 5.0*numtimeevals*std::log2(numtimeevals)*el*gp, 8.0*3*numtimeevals*el*gp, [&](void){ fourier::fft(timevals, el, gp); });
+    }
+    
+    ///// Form function evaluation (value and the 3 derivatives of all form functions at the Gauss points):
+    std::vector<std::vector<int>> ffcases = {{4, 1}, {4, 3}, {5, 2}, {5, 4}};
+    for (int c = 0; c < ffcases.size(); c++)
+    {
+        int elemtype = ffcases[c][0], order = ffcases[c][1];
+        std::vector<double> gpcoords = gausspoints(elemtype, 2*order+2).getcoordinates();
+        long long int gp = gpcoords.size()/3;
+        long long int ff = universe::gethff("h1", elemtype, order, gpcoords)->tomatrix(0, order, 0, 0).countrows();
+        run("gethff", "type" + std::to_string(elemtype) + "-order" + std::to_string(order), 0.0, 8.0*4*ff*gp, [&](void){ universe::gethff("h1", elemtype, order, gpcoords); });
+    }
+    
+    ///// Coordinate group creation and neighbour selection:
+    for (int n : {10000, 100000, 1000000})
+    {
+        std::vector<double> coords(3*n);
+        for (int i = 0; i < 3*n; i++)
+            coords[i] = 0.5 + 0.5*std::sin(1.0+i*1.7);
+        
+        run("coordinategroup", std::to_string(n), 0.0, 24.0*n, [&](void){ coordinategroup cg(coords); });
+        
+        coordinategroup cg(coords);
+        run("coordinategroup::select", std::to_string(n), 0.0, 24.0*n, [&](void)
+        {
+            for (int i = 0; i < 100; i++)
+            {
+                cg.select(coords[3*i*(n/100)+0], coords[3*i*(n/100)+1], coords[3*i*(n/100)+2], 1e-3);
+                while (cg.next())
+                    cg.countgroupcoordinates();
+            }
+        });
+    }
+    
+    ///// Write the JSON report:
+    std::stringstream json;
+    json << "{" << std::endl;
+    json << "    \"numthreads\": " << universe::getmaxnumthreads() << "," << std::endl;
+    json << "    \"units\": {\"size\": \"elements x gauss points x form functions\", \"time\": \"s\", \"gflops\": \"GFLOP/s\", \"gbytes\": \"GB/s\"}," << std::endl;
+    json << "    \"results\": [" << std::endl;
+    for (int i = 0; i < results.size(); i++)
+    {
+        json << "        {\"kernel\": \"" << results[i].kernel << "\", \"size\": \"" << results[i].size << "\", \"repeats\": " << results[i].numrepeats;
+        json << ", \"time\": " << results[i].time << ", \"gflops\": " << results[i].gflops << ", \"gbytes\": " << results[i].gbytes << "}";
+        json << ((i < results.size()-1) ? "," : "") << std::endl;
+    }
+    json << "    ]" << std::endl;
+    json << "}" << std::endl;
+    
+    std::ofstream outfile("microbenchmarks.json");
+    outfile << json.str();
+    outfile.close();
+    
+    slmpi::finalize();
+}
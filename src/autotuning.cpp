@@ -0,0 +1,233 @@
+#include "autotuning.h"
+#include "universe.h"
+#include "taskscheduler.h"
+#include "densemat.h"
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+
+long long int autotuning::minitemsperthread = 10000;
+long long int autotuning::minvaluesperthread = 100000;
+long long int autotuning::blasthreshold = 100*100;
+
+// Load the profile at startup:
+static bool isprofileloaded = autotuning::load();
+
+std::string autotuning::getcpumodel(void)
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0 || line.compare(0, 9, "Processor") == 0 || line.compare(0, 8, "CPU part") == 0)
+        {
+            size_t colonpos = line.find(':');
+            if (colonpos != std::string::npos && colonpos+2 < line.size())
+                return line.substr(colonpos+2);
+        }
+    }
+    return "unknown";
+}
+
+template <typename F>
+double autotuning::time(F func, int numruns)
+{
+    double mintime = -1;
+    for (int r = 0; r < numruns; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        double curtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (mintime < 0 || curtime < mintime)
+            mintime = curtime;
+    }
+    return mintime;
+}
+
+long long int autotuning::getminperthread(double overhead, double unittime)
+{
+    long long int minperthread = (long long int)(10.0*overhead/std::max(unittime, 1e-12));
+    return std::min(std::max(minperthread, 100LL), 10000000LL);
+}
+
+int autotuning::getnumthreadsforitems(long long int numitems)
+{
+    return std::min(numitems/minitemsperthread+1, (long long int)universe::getmaxnumthreads());
+}
+
+int autotuning::getnumthreadsforvalues(long long int numvalues)
+{
+    return std::min(numvalues/minvaluesperthread+1, (long long int)universe::getmaxnumthreads());
+}
+
+std::string autotuning::getdefaultfilename(void)
+{
+    const char* profilename = std::getenv("SPARSELIZARD_PROFILE");
+    if (profilename != NULL)
+        return std::string(profilename);
+
+    const char* homedir = std::getenv("HOME");
+    if (homedir != NULL)
+        return std::string(homedir) + "/.sparselizard_profile";
+    return ".sparselizard_profile";
+}
+
+void autotuning::run(std::string filename, bool isverbose)
+{
+    reset();
+
+    int numthreads = universe::getmaxnumthreads();
+
+    // Dispatch overhead of a loop with one trivial task per thread:
+    double overhead = 0;
+    if (numthreads > 1)
+    {
+        std::vector<double> sink(numthreads, 0);
+        overhead = time([&](){ for (int i = 0; i < 100; i++) taskscheduler::runperthread(numthreads, [&](int t){ sink[t] += t; }); }, 5)/100;
+    }
+
+    // Time per item of a typical element loop (gather the node values of the element and combine them):
+    int numitems = 200000, numnodesperitem = 8;
+    std::vector<int> nodes(numitems*numnodesperitem);
+    for (int i = 0; i < nodes.size(); i++)
+        nodes[i] = (i*7919) % nodes.size();
+    std::vector<double> nodevals(nodes.size(), 1.0), itemvals(numitems);
+    double itemtime = time([&]()
+    {
+        for (int i = 0; i < numitems; i++)
+        {
+            double val = 0;
+            for (int n = 0; n < numnodesperitem; n++)
+                val += nodevals[nodes[i*numnodesperitem+n]] * (n+1);
+            itemvals[i] = val;
+        }
+    }, 5)/numitems;
+
+    // Time per value of a typical raw value loop (sort):
+    int numvalues = 1000000;
+    std::vector<int> tosort(numvalues), sorted;
+    for (int i = 0; i < numvalues; i++)
+        tosort[i] = (int)(((long long int)i*2654435761LL) % numvalues);
+    double valuetime = time([&](){ sorted = tosort; std::sort(sorted.begin(), sorted.end()); }, 3)/numvalues;
+
+    if (numthreads > 1)
+    {
+        minitemsperthread = getminperthread(overhead, itemtime);
+        minvaluesperthread = getminperthread(overhead, valuetime);
+    }
+
+    // Smallest square size for which BLAS beats the inline product for all larger sizes tested:
+    std::vector<int> sizes = {4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256};
+    int firstblassize = -1;
+    for (int i = 0; i < sizes.size(); i++)
+    {
+        int n = sizes[i];
+        densemat A(n, n, 1.0), B(n, n, 2.0);
+        int numrepeats = std::max(1, 2000000/(n*n*n));
+
+        blasthreshold = (long long int)n*n;
+        double inlinetime = time([&](){ for (int r = 0; r < numrepeats; r++) A.multiply(B); }, 3);
+        blasthreshold = 0;
+        double blastime = time([&](){ for (int r = 0; r < numrepeats; r++) A.multiply(B); }, 3);
+
+        if (blastime < inlinetime)
+        {
+            if (firstblassize < 0)
+                firstblassize = i;
+        }
+        else
+            firstblassize = -1;
+    }
+    if (firstblassize < 0)
+        blasthreshold = (long long int)sizes.back()*sizes.back();
+    else if (firstblassize == 0)
+        blasthreshold = 0;
+    else
+        blasthreshold = (long long int)sizes[firstblassize-1]*sizes[firstblassize-1];
+
+    if (isverbose)
+    {
+        std::cout << "Autotuning on '" << getcpumodel() << "' with " << numthreads << " threads:" << std::endl;
+        std::cout << "Thread dispatch overhead: " << overhead*1e6 << " us" << std::endl;
+        std::cout << "Min items per thread: " << minitemsperthread << std::endl;
+        std::cout << "Min values per thread: " << minvaluesperthread << std::endl;
+        std::cout << "BLAS size threshold: " << blasthreshold << std::endl;
+    }
+
+    write(filename);
+}
+
+bool autotuning::load(std::string filename)
+{
+    if (filename.size() == 0)
+        filename = getdefaultfilename();
+
+    std::ifstream infile(filename);
+    if (infile.is_open() == false)
+        return false;
+
+    long long int minitems = minitemsperthread, minvalues = minvaluesperthread, blasthres = blasthreshold, tilememory = universe::maxassemblytilememory;
+    std::string cpumodel;
+
+    std::string line;
+    while (std::getline(infile, line))
+    {
+        size_t equalpos = line.find('=');
+        if (line.size() == 0 || line[0] == '#' || equalpos == std::string::npos)
+            continue;
+        std::string key = line.substr(0, equalpos), value = line.substr(equalpos+1);
+
+        if (key == "cpu")
+            cpumodel = value;
+        if (key == "minitemsperthread")
+            minitems = std::stoll(value);
+        if (key == "minvaluesperthread")
+            minvalues = std::stoll(value);
+        if (key == "blasthreshold")
+            blasthres = std::stoll(value);
+        if (key == "assemblytilememory")
+            tilememory = std::stoll(value);
+    }
+
+    if (cpumodel != getcpumodel())
+    {
+        std::cout << "Warning in 'autotuning' object: profile '" << filename << "' was created on another CPU model and is ignored" << std::endl;
+        return false;
+    }
+
+    minitemsperthread = std::max(minitems, 1LL);
+    minvaluesperthread = std::max(minvalues, 1LL);
+    blasthreshold = std::max(blasthres, 0LL);
+    universe::setassemblytilememory(tilememory);
+
+    return true;
+}
+
+void autotuning::write(std::string filename)
+{
+    if (filename.size() == 0)
+        filename = getdefaultfilename();
+
+    std::ofstream outfile(filename);
+    if (outfile.is_open() == false)
+    {
+        std::cout << "Error in 'autotuning' object: unable to write to file '" << filename << "'" << std::endl;
+        abort();
+    }
+
+    outfile << "# sparselizard tuning profile" << std::endl;
+    outfile << "cpu=" << getcpumodel() << std::endl;
+    outfile << "minitemsperthread=" << minitemsperthread << std::endl;
+    outfile << "minvaluesperthread=" << minvaluesperthread << std::endl;
+    outfile << "blasthreshold=" << blasthreshold << std::endl;
+    outfile << "assemblytilememory=" << universe::maxassemblytilememory << std::endl;
+}
+
+void autotuning::reset(void)
+{
+    minitemsperthread = 10000;
+    minvaluesperthread = 100000;
+    blasthreshold = 100*100;
+}
@@ -0,0 +1,64 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object holds the machine dependent tuning constants of the library:
+//
+// - the min number of items (elements, nodes, dofs, ...) and of raw values (sorts, copies, ...)
+//   per thread below which the multithreaded loops use fewer threads
+// - the matrix size above which 'densemat::multiply' calls BLAS instead of the inline product
+// - the memory budget of an assembly tile
+//
+// The defaults are the historical constants. Calling 'run' once on a machine benchmarks these
+// decisions and writes a profile file. The profile is loaded at startup from the file given in
+// the SPARSELIZARD_PROFILE environment variable or else from '$HOME/.sparselizard_profile' if
+// it exists. A profile created on another CPU model is ignored.
+
+#ifndef AUTOTUNING_H
+#define AUTOTUNING_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+class autotuning
+{
+    private:
+
+        static std::string getcpumodel(void);
+
+        // Time in seconds of the fastest of 'numruns' calls to 'func':
+        template <typename F>
+        static double time(F func, int numruns);
+
+        // Min number of units per thread for the dispatch overhead to be below 10% of the work:
+        static long long int getminperthread(double overhead, double unittime);
+
+    public:
+
+        static long long int minitemsperthread;
+        static long long int minvaluesperthread;
+        static long long int blasthreshold;
+
+        // Number of threads to use for a loop on 'numitems' items or 'numvalues' raw values:
+        static int getnumthreadsforitems(long long int numitems);
+        static int getnumthreadsforvalues(long long int numvalues);
+
+        // Profile file used when no name is given:
+        static std::string getdefaultfilename(void);
+
+        // Benchmark the current machine (takes a few seconds) and write the profile:
+        static void run(std::string filename = "", bool isverbose = true);
+
+        // Return false if the file does not exist or was made on another CPU model:
+        static bool load(std::string filename = "");
+        static void write(std::string filename = "");
+
+        // Restore the defaults:
+        static void reset(void);
+
+};
+
+#endif
@@ -1,5 +1,11 @@
 #include "densemat.h"
+#include "memorypool.h"
 #include "cblas.h"
+#include "gpu.h"
+#include "vectormath.h"
+#include "universe.h"
+#include "autotuning.h"
+#include "gentools.h"
 
 
 void densemat::errorifempty(void)
@@ -15,19 +21,18 @@ densemat::densemat(long long int numberofrows, long long int numberofcolumns)
 {
     numrows = numberofrows;
     numcols = numberofcolumns;
-    myvalues = std::shared_ptr<double>(new double[numcols*numrows]);
+    myvalues = memorypool::getdoubles(numcols*numrows);
 }
 
 densemat::densemat(long long int numberofrows, long long int numberofcolumns, double initvalue)
 {
     numrows = numberofrows;
     numcols = numberofcolumns;
-    double* myvaluesptr = new double[numcols*numrows];
+    myvalues = memorypool::getdoubles(numcols*numrows);
+    double* myvaluesptr = myvalues.get();
     
     for (long long int i = 0; i < numcols*numrows; i++)
         myvaluesptr[i] = initvalue;
-    
-    myvalues = std::shared_ptr<double>(myvaluesptr);
 }
 
 densemat::densemat(long long int numberofrows, long long int numberofcolumns, std::vector<double> valvec)
@@ -40,24 +45,29 @@ densemat::densemat(long long int numberofrows, long long int numberofcolumns, st
     
     numrows = numberofrows;
     numcols = numberofcolumns;
-    double* myvaluesptr = new double[numcols*numrows];
+    myvalues = memorypool::getdoubles(numcols*numrows);
+    double* myvaluesptr = myvalues.get();
     
     for (long long int i = 0; i < numcols*numrows; i++)
         myvaluesptr[i] = valvec[i];
-    
-    myvalues = std::shared_ptr<double>(myvaluesptr);
 }
 
 densemat::densemat(long long int numberofrows, long long int numberofcolumns, double init, double step)
 {
     numrows = numberofrows;
     numcols = numberofcolumns;
-    double* myvaluesptr = new double[numcols*numrows];
+    myvalues = memorypool::getdoubles(numcols*numrows);
+    double* myvaluesptr = myvalues.get();
     
     for (long long int i = 0; i < numcols*numrows; i++)
         myvaluesptr[i] = init+i*step;
-    
-    myvalues = std::shared_ptr<double>(myvaluesptr);
+}
+
+densemat::densemat(long long int numberofrows, long long int numberofcolumns, std::shared_ptr<double> vals)
+{
+    numrows = numberofrows;
+    numcols = numberofcolumns;
+    myvalues = vals;
 }
 
 densemat::densemat(std::vector<densemat> input)
@@ -77,7 +87,8 @@ densemat::densemat(std::vector<densemat> input)
             abort();
         }
     }
-    double* myvaluesptr = new double[numrows*numcols];
+    myvalues = memorypool::getdoubles(numrows*numcols);
+    double* myvaluesptr = myvalues.get();
     
     long long int index = 0;
     for (long long int i = 0; i < input.size(); i++)
@@ -89,8 +100,6 @@ densemat::densemat(std::vector<densemat> input)
             index++;
         }
     }
-    
-    myvalues = std::shared_ptr<double>(myvaluesptr);
 }
 
 void densemat::setrow(long long int rownumber, std::vector<double> rowvals)
@@ -177,7 +186,7 @@ densemat densemat::copy(void)
     // The pointed value has to be copied as well.
     if (densematcopy.myvalues != NULL)
     {
-        densematcopy.myvalues = std::shared_ptr<double>(new double[numcols*numrows]);
+        densematcopy.myvalues = memorypool::getdoubles(numcols*numrows);
         double* copiedmyvaluesptr = densematcopy.myvalues.get();
         double* myvaluesptr = myvalues.get();
         for (long long int i = 0; i < numcols*numrows; i++)
@@ -257,12 +266,16 @@ densemat densemat::multiply(densemat B)
     
     
     // For too small matrices the overhead of BLAS is too visible and we use a homemade product.
-    long long int sizethreshold = 100*100;
-    if (numrowsA*numcolsA > sizethreshold || numrowsB*numcolsB > sizethreshold)
+    // The size threshold is machine dependent (see 'autotuning').
+    if (numrowsA*numcolsA > autotuning::blasthreshold || numrowsB*numcolsB > autotuning::blasthreshold)
     {
         // 'cblas_dgemm' computes alpha*A*B+beta*C and puts the result in C. Here we only compute A*B thus:
         double alpha = 1, beta = 0;
 
+        // Large products are computed on a GPU if available:
+        if (gpu::multiply(istransposed, B.istransposed, numrowsA, numcolsB, numcolsA, myvalues.get(), numcols, B.myvalues.get(), B.numcols, C.myvalues.get()))
+            return C;
+
         if (    istransposed  &&     B.istransposed)
             cblas_dgemm(CblasRowMajor, CblasTrans,   CblasTrans,   numrowsA, numcolsB, numcolsA, alpha, myvalues.get(), numcols, B.myvalues.get(), B.numcols, beta, C.myvalues.get(), numcolsB);
         if (    istransposed  && not(B.istransposed))
@@ -306,6 +319,71 @@ densemat densemat::multiply(densemat B)
     return C;
 }
 
+std::vector<densemat> densemat::multiply(std::vector<densemat> Bs)
+{
+    int numprods = Bs.size();
+    
+    std::vector<densemat> output(numprods);
+    
+    bool isbatchable = (numprods > 1);
+    for (int i = 1; i < numprods; i++)
+    {
+        if (Bs[i].numrows != Bs[0].numrows || Bs[i].numcols != Bs[0].numcols || Bs[i].istransposed != Bs[0].istransposed)
+        {
+            isbatchable = false;
+            break;
+        }
+    }
+    if (not(isbatchable))
+    {
+        for (int i = 0; i < numprods; i++)
+            output[i] = multiply(Bs[i]);
+        return output;
+    }
+    
+    // Concatenate all B horizontally (after transposition) to compute A*[B1 B2 ...] = [A*B1 A*B2 ...] at once.
+    // For transposed B this is a vertical concatenation of the stored values.
+    long long int numrowsBstored = Bs[0].numrows, numcolsBstored = Bs[0].numcols;
+    densemat Ball;
+    if (Bs[0].istransposed)
+    {
+        Ball = densemat(Bs);
+        Ball.transpose();
+    }
+    else
+    {
+        Ball = densemat(numrowsBstored, numprods*numcolsBstored);
+        double* Ballvals = Ball.myvalues.get();
+        for (int i = 0; i < numprods; i++)
+        {
+            double* curvals = Bs[i].myvalues.get();
+            for (long long int r = 0; r < numrowsBstored; r++)
+            {
+                for (long long int c = 0; c < numcolsBstored; c++)
+                    Ballvals[r*numprods*numcolsBstored + i*numcolsBstored + c] = curvals[r*numcolsBstored+c];
+            }
+        }
+    }
+    
+    densemat Call = multiply(Ball);
+    
+    // Split the columns of the product:
+    long long int numrowsC = Call.numrows, numcolsC = Call.numcols/numprods;
+    double* Callvals = Call.myvalues.get();
+    for (int i = 0; i < numprods; i++)
+    {
+        output[i] = densemat(numrowsC, numcolsC);
+        double* curvals = output[i].myvalues.get();
+        for (long long int r = 0; r < numrowsC; r++)
+        {
+            for (long long int c = 0; c < numcolsC; c++)
+                curvals[r*numcolsC+c] = Callvals[r*Call.numcols + i*numcolsC + c];
+        }
+    }
+    
+    return output;
+}
+
 double* densemat::getvalues(void) { return myvalues.get(); }
 
 void densemat::addproduct(double coef, densemat B)
@@ -391,6 +469,7 @@ densemat densemat::getinverse(void)
             captr[r*n+c] = c;
     }
         
+    universe::initializepetsc();
     Mat bdmat;
     MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, n, n, csrrows.getvalues(), csrcols.getvalues(), myvalues.get(), &bdmat);
 
@@ -411,16 +490,20 @@ void densemat::multiplyelementwise(densemat B)
 {
     double* myvaluesptr = myvalues.get();
     double* Bmyvaluesptr = B.myvalues.get();
+    long long int numentries = numrows*numcols;
     
-    for (long long int i = 0; i < numrows*numcols; i++)
+    #pragma omp simd
+    for (long long int i = 0; i < numentries; i++)
         myvaluesptr[i] *= Bmyvaluesptr[i];
 }
 
 void densemat::multiplyelementwise(double val)
 {
     double* myvaluesptr = myvalues.get();
+    long long int numentries = numrows*numcols;
     
-    for (long long int i = 0; i < numrows*numcols; i++)
+    #pragma omp simd
+    for (long long int i = 0; i < numentries; i++)
         myvaluesptr[i] *= val;
 }
 
@@ -452,11 +535,7 @@ void densemat::minus(void)
 
 void densemat::power(densemat exponent)
 {
-    double* myvaluesptr = myvalues.get();
-    double* expmyvaluesptr = exponent.myvalues.get();
-    
-    for (long long int i = 0; i < numrows*numcols; i++)
-            myvaluesptr[i] = std::pow(myvaluesptr[i], expmyvaluesptr[i]);
+    vectormath::power(myvalues.get(), exponent.myvalues.get(), numrows*numcols);
 }
 
 void densemat::invert(void)
@@ -477,58 +556,37 @@ void densemat::abs(void)
 
 void densemat::sin(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::sin(myvaluesptr[i]);
+    vectormath::sin(myvalues.get(), numrows*numcols);
 }
 
 void densemat::cos(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::cos(myvaluesptr[i]);
+    vectormath::cos(myvalues.get(), numrows*numcols);
 }
 
 void densemat::tan(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::tan(myvaluesptr[i]);
+    vectormath::tan(myvalues.get(), numrows*numcols);
 }
 
 void densemat::asin(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::asin(myvaluesptr[i]);
+    vectormath::asin(myvalues.get(), numrows*numcols);
 }
 
 void densemat::acos(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::acos(myvaluesptr[i]);
+    vectormath::acos(myvalues.get(), numrows*numcols);
 }
 
 void densemat::atan(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::atan(myvaluesptr[i]);
+    vectormath::atan(myvalues.get(), numrows*numcols);
 }
 
 void densemat::log10(void)
 {
-    double* myvaluesptr = myvalues.get();
-
-    for (long long int i = 0; i < numrows*numcols; i++)
-        myvaluesptr[i] = std::log10(myvaluesptr[i]);
+    vectormath::log10(myvalues.get(), numrows*numcols);
 }
 
 void densemat::mod(double modval)
@@ -593,6 +651,10 @@ double densemat::maxabs(void)
 double densemat::sum(void)
 {
     double* myvaluesptr = myvalues.get();
+    
+    if (universe::isreductionreproducible)
+        return gentools::compensatedsum(myvaluesptr, numrows*numcols);
+    
     double val = 0;
 
     for (long long int i = 0; i < numrows*numcols; i++)
@@ -603,17 +665,23 @@ double densemat::sum(void)
 void densemat::multiplycolumns(std::vector<double> input)
 {
     double* myvaluesptr = myvalues.get();
+    double* inputptr = input.data();
     
     for (long long int i = 0; i < numrows; i++)
     {
+        double* currowptr = myvaluesptr + i*numcols;
+        
+        #pragma omp simd
         for (long long int j = 0; j < numcols; j++)
-            myvaluesptr[i*numcols + j] *= input[j];
+            currowptr[j] *= inputptr[j];
     }
 }
 
 densemat densemat::multiplyallrows(densemat input)
 {
-    densemat output(numrows*input.numrows, numcols);
+    long long int inrows = input.numrows, incols = input.numcols;
+
+    densemat output(numrows*inrows, numcols);
     
     double* myvaluesptr = myvalues.get();
     double* inmyvaluesptr = input.myvalues.get();
@@ -621,10 +689,15 @@ densemat densemat::multiplyallrows(densemat input)
     
     for (long long int i = 0; i < numrows; i++)
     {
-        for (long long int j = 0; j < input.numrows; j++)
+        double* arowptr = myvaluesptr + i*numcols;
+        for (long long int j = 0; j < inrows; j++)
         {
+            double* browptr = inmyvaluesptr + j*incols;
+            double* outrowptr = outmyvaluesptr + (i*inrows + j)*numcols;
+            
+            #pragma omp simd
             for (long long int k = 0; k < numcols; k++)
-                outmyvaluesptr[(i*input.numrows + j)*numcols + k] = myvaluesptr[i*numcols+k] * inmyvaluesptr[j*input.numcols+k];
+                outrowptr[k] = arowptr[k] * browptr[k];
         }
     }
     return output;
@@ -643,18 +716,67 @@ densemat densemat::dofinterpoltimestf(densemat tfval)
     double* tfvaluesptr = tfval.myvalues.get();
     double* outmyvaluesptr = output.myvalues.get();
 
-    long long int ind = 0;
     for (long long int ielem = 0; ielem < elem; ielem++)
     {
         for (long long int ifft = 0; ifft < fft; ifft++)
         {
+            double* tfrowptr = tfvaluesptr + ifft*gp;
             for (long long int iffd = 0; iffd < ffd; iffd++)
             {
+                double* dofptr = myvaluesptr + ielem*numcols + iffd*gp;
+                double* outptr = outmyvaluesptr + ((ielem*fft + ifft)*ffd + iffd)*gp;
+                
+                #pragma omp simd
                 for (long long int igp = 0; igp < gp; igp++)
-                {
-                    outmyvaluesptr[ind] = myvaluesptr[ ielem*numcols+iffd*gp+igp ] * tfvaluesptr[ifft*gp+igp];
-                    ind++;
-                }
+                    outptr[igp] = dofptr[igp] * tfrowptr[igp];
+            }
+        }
+    }
+
+    return output;
+}
+
+densemat densemat::dofinterpoltimestf(densemat tfval, densemat coef)
+{
+    long long int fft = tfval.countrows();
+    long long int gp = tfval.countcolumns();
+    long long int elem = numrows;
+    long long int ffd = numcols/gp;
+    
+    densemat output(elem, gp*ffd*fft);
+    
+    double* myvaluesptr = myvalues.get();
+    double* tfvaluesptr = tfval.myvalues.get();
+    double* coefvaluesptr = coef.myvalues.get();
+    double* outmyvaluesptr = output.myvalues.get();
+    
+    // Dof values times coef for the current element:
+    std::vector<double> dofcoef(ffd*gp);
+    double* dofcoefptr = dofcoef.data();
+
+    for (long long int ielem = 0; ielem < elem; ielem++)
+    {
+        double* coefrowptr = coefvaluesptr + ielem*gp;
+        for (long long int iffd = 0; iffd < ffd; iffd++)
+        {
+            double* dofptr = myvaluesptr + ielem*numcols + iffd*gp;
+            
+            #pragma omp simd
+            for (long long int igp = 0; igp < gp; igp++)
+                dofcoefptr[iffd*gp+igp] = dofptr[igp] * coefrowptr[igp];
+        }
+    
+        for (long long int ifft = 0; ifft < fft; ifft++)
+        {
+            double* tfrowptr = tfvaluesptr + ifft*gp;
+            for (long long int iffd = 0; iffd < ffd; iffd++)
+            {
+                double* dcptr = dofcoefptr + iffd*gp;
+                double* outptr = outmyvaluesptr + ((ielem*fft + ifft)*ffd + iffd)*gp;
+                
+                #pragma omp simd
+                for (long long int igp = 0; igp < gp; igp++)
+                    outptr[igp] = dcptr[igp] * tfrowptr[igp];
             }
         }
     }
@@ -670,16 +792,16 @@ void densemat::multiplycolumns(densemat input)
     double* myvaluesptr = myvalues.get();
     double* invaluesptr = input.myvalues.get();
     
-    long long int ind = 0;
     for (long long int i = 0; i < numrows; i++)
     {
+        double* inrowptr = invaluesptr + i*collen;
         for (long long int b = 0; b < numblocks; b++)
         {
+            double* curptr = myvaluesptr + (i*numblocks + b)*collen;
+            
+            #pragma omp simd
             for (long long int c = 0; c < collen; c++)
-            {
-                myvaluesptr[ind] *= invaluesptr[i*collen+c];
-                ind++;
-            }
+                curptr[c] *= inrowptr[c];
         }
     }
 }
@@ -48,6 +48,8 @@ class densemat
         densemat(long long int numberofrows, long long int numberofcolumns, double init, double step);
         // Vertical concatenation of dense matrices:
         densemat(std::vector<densemat> input);
+        // Wrap existing values without copying (e.g. the storage of a petsc vector). The deleter of 'vals' releases them:
+        densemat(long long int numberofrows, long long int numberofcolumns, std::shared_ptr<double> vals);
 
         long long int countrows(void) { return numrows; };
         long long int countcolumns(void) { return numcols; };
@@ -92,6 +94,9 @@ class densemat
 
         // Multiply current object matrix by B with BLAS:
         densemat multiply(densemat B);
+        // Multiply current object matrix by every matrix in 'Bs'. When all matrices in 'Bs' have the same size and
+        // transposition the products are computed in a single BLAS call (many small products are slow in BLAS):
+        std::vector<densemat> multiply(std::vector<densemat> Bs);
 
         // The matrix cannot get out of scope
         double* getvalues(void);
@@ -149,6 +154,9 @@ class densemat
         // This special product is called by an el x (gp x ffd) matrix A where the columns are grouped by ffd blocks of gp columns.
         // The 'tfval' matrix has size fft x gp. The returned matrix has size el x (gp x ffd x fft) and corresponds to [A*tfvalrow1 A*tfvalrow2 ...].
         densemat dofinterpoltimestf(densemat tfval);
+        // Same as above with every column of the output additionally multiplied by the el x gp matrix 'coef'
+        // (same gp column in each gp block). This avoids creating the intermediate matrix.
+        densemat dofinterpoltimestf(densemat tfval, densemat coef);
         
         // [A1 A2 ...].multiplycolumns(B) replaces the calling matrix by [A1*B A2*B ...] where Ai*B is the elementwise product of Ai and B.
         void multiplycolumns(densemat input);
@@ -0,0 +1,233 @@
+#include "evaluationcontext.h"
+#include "operation.h"
+#include "jacobian.h"
+#include "universe.h"
+
+
+std::atomic<long long int> evaluationcontext::numhits(0);
+std::atomic<long long int> evaluationcontext::nummisses(0);
+
+void evaluationcontext::allowreuse(void)
+{
+    isreuseallowed = true;
+}
+
+void evaluationcontext::forbidreuse(void)
+{
+    isreuseallowed = false;
+    
+    computedjacobian = NULL;
+    
+    oppointers = {};
+    oppointersfft = {};
+    opcomputed = {};
+    opcomputedfft = {};
+
+    opindexes.clear();
+    opindexesfft.clear();
+    parameterindexes.clear();
+    parameterindexesfft.clear();
+    fieldindexes.clear();
+    fieldindexesfft.clear();
+    
+    nodecoordstype = -1;
+    nodecoordselements = {};
+    nodecoords = {};
+}
+
+evaluationcontext evaluationcontext::extractsubset(int numevalpts, std::vector<int>& selectedelementindexes)
+{
+    int numselected = selectedelementindexes.size();
+
+    evaluationcontext output = *this;
+    
+    // The node coordinates are gathered again for the subset:
+    output.nodecoordstype = -1;
+    output.nodecoordselements = {};
+    output.nodecoords = {};
+    
+    // Replace the jacobian with a subset of it:
+    if (computedjacobian != NULL)
+    {
+        std::shared_ptr<jacobian> newjac(new jacobian);
+        *newjac = computedjacobian->extractsubset(selectedelementindexes);
+        output.computedjacobian = newjac;
+    }
+        
+    // Replace the computed ops by their subset:
+    for (int i = 0; i < output.opcomputed.size(); i++)
+    {
+        for (int h = 0; h < output.opcomputed[i].size(); h++)
+        {
+            if (output.opcomputed[i][h].size() > 0)
+                output.opcomputed[i][h][0] = output.opcomputed[i][h][0].extractrows(selectedelementindexes);
+        }
+    }
+    
+    // In the multiharmonic case columns must be selected:
+    std::vector<int> mhcols;
+    if (opcomputedfft.size() > 0)
+    {
+        mhcols = std::vector<int>(numselected*numevalpts);
+        for (int i = 0; i < numselected; i++)
+        {
+            for (int j = 0; j < numevalpts; j++)
+                mhcols[i*numevalpts+j] = selectedelementindexes[i]*numevalpts+j;
+        }
+    }
+    for (int i = 0; i < output.opcomputedfft.size(); i++)
+        output.opcomputedfft[i] = output.opcomputedfft[i].extractcols(mhcols);
+    
+    return output;
+}
+
+std::vector<double>* evaluationcontext::getnodecoordinates(int elementtypenumber, std::vector<int>& elementnumbers)
+{
+    if (isreuseallowed && nodecoordstype == elementtypenumber && nodecoordselements == elementnumbers)
+        return &nodecoords;
+    
+    universe::getrawmesh()->getelements()->getnodecoordinates(elementtypenumber, elementnumbers, nodecoords);
+    
+    if (isreuseallowed)
+    {
+        nodecoordstype = elementtypenumber;
+        nodecoordselements = elementnumbers;
+    }
+    else
+    {
+        nodecoordstype = -1;
+        nodecoordselements = {};
+    }
+    
+    return &nodecoords;
+}
+
+int evaluationcontext::find(std::unordered_map<precomputedkey, int, precomputedkeyhash>& indexes, precomputedkey key)
+{
+    std::unordered_map<precomputedkey, int, precomputedkeyhash>::iterator it = indexes.find(key);
+    if (it != indexes.end())
+    {
+        numhits++;
+        return it->second;
+    }
+    nummisses++;
+    return -1;
+}
+
+void evaluationcontext::index(std::shared_ptr<operation> op, int ind, bool isfft)
+{
+    // The first stored operation is kept for a given key:
+    (isfft ? opindexesfft : opindexes).insert(std::make_pair(op.get(), ind));
+    if (op->isparameter())
+    {
+        precomputedkey key = {op->getparameterpointer().get(), op->getselectedrow(), op->getselectedcol(), 0, 0};
+        (isfft ? parameterindexesfft : parameterindexes).insert(std::make_pair(key, ind));
+    }
+    if (op->isfield())
+    {
+        precomputedkey key = {op->getfieldpointer().get(), op->gettimederivative(), op->getspacederivative(), op->getkietaphiderivative(), op->getformfunctioncomponent()};
+        (isfft ? fieldindexesfft : fieldindexes).insert(std::make_pair(key, ind));
+    }
+}
+
+int evaluationcontext::getindexofprecomputedvalue(std::shared_ptr<operation> op)
+{
+    std::unordered_map<operation*, int>::iterator it = opindexes.find(op.get());
+    if (it != opindexes.end())
+    {
+        numhits++;
+        return it->second;
+    }
+    nummisses++;
+    return -1;
+}
+
+int evaluationcontext::getindexofprecomputedvaluefft(std::shared_ptr<operation> op)
+{
+    std::unordered_map<operation*, int>::iterator it = opindexesfft.find(op.get());
+    if (it != opindexesfft.end())
+    {
+        numhits++;
+        return it->second;
+    }
+    nummisses++;
+    return -1;
+}
+
+int evaluationcontext::getindexofprecomputedvalue(std::shared_ptr<rawparameter> param, int row, int col)
+{
+    return find(parameterindexes, {param.get(), row, col, 0, 0});
+}
+
+int evaluationcontext::getindexofprecomputedvaluefft(std::shared_ptr<rawparameter> param, int row, int col)
+{
+    return find(parameterindexesfft, {param.get(), row, col, 0, 0});
+}
+
+int evaluationcontext::getindexofprecomputedvalue(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc)
+{
+    return find(fieldindexes, {rf.get(), td, sd, kepd, ffc});
+}
+
+int evaluationcontext::getindexofprecomputedvaluefft(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc)
+{
+    return find(fieldindexesfft, {rf.get(), td, sd, kepd, ffc});
+}
+
+std::vector<std::vector<densemat>> evaluationcontext::getprecomputed(int index)
+{
+    std::vector<std::vector<densemat>> output = opcomputed[index];
+    for (int h = 0; h < output.size(); h++)
+    {
+        if (output[h].size() == 1)
+            output[h][0] = output[h][0].copy();
+    }
+    return output;
+}
+
+densemat evaluationcontext::getprecomputedfft(int index)
+{
+    return (opcomputedfft[index]).copy();
+}
+
+void evaluationcontext::setprecomputed(std::shared_ptr<operation> op, std::vector<std::vector<densemat>> val)
+{
+    index(op, oppointers.size(), false);
+    oppointers.push_back(op);
+    opcomputed.push_back(val);
+    for (int h = 0; h < val.size(); h++)
+    {
+        if (val[h].size() == 1)
+            opcomputed[opcomputed.size()-1][h][0] = val[h][0].copy();
+    }
+}
+
+void evaluationcontext::setprecomputedfft(std::shared_ptr<operation> op, densemat val)
+{
+    index(op, oppointersfft.size(), true);
+    oppointersfft.push_back(op);
+    opcomputedfft.push_back(val.copy());
+}
+
+std::shared_ptr<hierarchicalformfunctioncontainer> evaluationcontext::gethff(std::string& fftypename, int elementtypenumber, int interpolorder, std::vector<double>& evaluationcoordinates)
+{
+    for (int i = 0; i < hffkeys.size(); i++)
+    {
+        hffkey& cur = hffkeys[i];
+        if (cur.elementtypenumber == elementtypenumber && cur.interpolorder == interpolorder && cur.fftypename == fftypename && cur.evaluationcoordinates == evaluationcoordinates)
+            return hffvalues[i];
+    }
+    return NULL;
+}
+
+void evaluationcontext::sethff(std::string& fftypename, int elementtypenumber, int interpolorder, std::vector<double>& evaluationcoordinates, std::shared_ptr<hierarchicalformfunctioncontainer> values)
+{
+    hffkeys.push_back({fftypename, elementtypenumber, interpolorder, evaluationcoordinates});
+    hffvalues.push_back(values);
+}
+
+void evaluationcontext::clearhff(void)
+{
+    hffkeys = {};
+    hffvalues = {};
+}
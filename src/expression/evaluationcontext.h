@@ -0,0 +1,144 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// The 'evaluationcontext' object holds the storage used to reuse the values
+// computed while interpolating an expression (Jacobian, operations, ...).
+// Each thread has its own current context (see 'universe::getcontext') so
+// that independent evaluations can run concurrently. A context can also be
+// set for a single call to isolate it from the storage of its caller.
+
+#ifndef EVALUATIONCONTEXT_H
+#define EVALUATIONCONTEXT_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <unordered_map>
+#include "densemat.h"
+#include "hierarchicalformfunctioncontainer.h"
+
+class jacobian;
+class operation;
+class rawparameter;
+class rawfield;
+
+// Key of a precomputed parameter entry (pointer, row, column) or field (pointer and
+// time derivative, space derivative, ki/eta/phi derivative, form function component):
+struct precomputedkey
+{
+    void* pointer;
+    int a, b, c, d;
+
+    bool operator==(const precomputedkey& other) const { return (pointer == other.pointer && a == other.a && b == other.b && c == other.c && d == other.d); };
+};
+
+struct precomputedkeyhash
+{
+    size_t operator()(const precomputedkey& key) const
+    {
+        size_t h = std::hash<void*>()(key.pointer);
+        int vals[4] = {key.a, key.b, key.c, key.d};
+        for (int i = 0; i < 4; i++)
+            h ^= std::hash<int>()(vals[i]) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+// Key of evaluated hierarchical form functions:
+struct hffkey
+{
+    std::string fftypename;
+    int elementtypenumber;
+    int interpolorder;
+    std::vector<double> evaluationcoordinates;
+};
+
+class evaluationcontext
+{
+
+    private:
+
+        // Index in 'oppointers' (or 'oppointersfft') of the stored operations, parameter entries and fields:
+        std::unordered_map<operation*, int> opindexes = {};
+        std::unordered_map<operation*, int> opindexesfft = {};
+        std::unordered_map<precomputedkey, int, precomputedkeyhash> parameterindexes = {};
+        std::unordered_map<precomputedkey, int, precomputedkeyhash> parameterindexesfft = {};
+        std::unordered_map<precomputedkey, int, precomputedkeyhash> fieldindexes = {};
+        std::unordered_map<precomputedkey, int, precomputedkeyhash> fieldindexesfft = {};
+
+        // Add the stored operation to the indexes:
+        void index(std::shared_ptr<operation> op, int ind, bool isfft);
+        int find(std::unordered_map<precomputedkey, int, precomputedkeyhash>& indexes, precomputedkey key);
+
+        // Evaluated hierarchical form functions (shared with the copies of this context since never modified):
+        std::vector<hffkey> hffkeys = {};
+        std::vector<std::shared_ptr<hierarchicalformfunctioncontainer>> hffvalues = {};
+
+        // Curved node coordinates of the elements last gathered while the reuse was allowed (type -1 if none):
+        int nodecoordstype = -1;
+        std::vector<int> nodecoordselements = {};
+        std::vector<double> nodecoords = {};
+
+        // Lookup counters of all contexts:
+        static std::atomic<long long int> numhits;
+        static std::atomic<long long int> nummisses;
+
+    public:
+    
+        // To allow reusing computed things:
+        bool isreuseallowed = false;
+        
+        std::shared_ptr<jacobian> computedjacobian = NULL;
+        
+        // Store all operations that must be reused:
+        std::vector<std::shared_ptr<operation>> oppointers = {};
+        std::vector<std::shared_ptr<operation>> oppointersfft = {};
+        // Store all computed values:
+        std::vector< std::vector<std::vector<densemat>> > opcomputed = {};
+        std::vector< densemat > opcomputedfft = {};
+        
+        
+        evaluationcontext(void) {};
+        
+        void allowreuse(void);
+        // Forbid reuse and clear all stored values:
+        void forbidreuse(void);
+        
+        // Get a new context holding an element subset of this context storage:
+        evaluationcontext extractsubset(int numevalpts, std::vector<int>& selectedelementindexes);
+        
+        // Returns -1 if not yet precomputed.
+        int getindexofprecomputedvalue(std::shared_ptr<operation> op);
+        int getindexofprecomputedvaluefft(std::shared_ptr<operation> op);
+        int getindexofprecomputedvalue(std::shared_ptr<rawparameter> param, int row, int col);
+        int getindexofprecomputedvaluefft(std::shared_ptr<rawparameter> param, int row, int col);
+        int getindexofprecomputedvalue(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc);
+        int getindexofprecomputedvaluefft(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc);
+        // Returns a copy to avoid any modification of the data stored here:
+        std::vector<std::vector<densemat>> getprecomputed(int index);
+        densemat getprecomputedfft(int index);
+        // Sets a copy to avoid any modification of the data stored here:
+        void setprecomputed(std::shared_ptr<operation> op, std::vector<std::vector<densemat>> val);
+        void setprecomputedfft(std::shared_ptr<operation> op, densemat val);
+
+        // Get the evaluated hierarchical form functions (NULL if not available):
+        std::shared_ptr<hierarchicalformfunctioncontainer> gethff(std::string& fftypename, int elementtypenumber, int interpolorder, std::vector<double>& evaluationcoordinates);
+        void sethff(std::string& fftypename, int elementtypenumber, int interpolorder, std::vector<double>& evaluationcoordinates, std::shared_ptr<hierarchicalformfunctioncontainer> values);
+        void clearhff(void);
+
+        // Get the curved node coordinates of the elements (element x node x xyz, see 'elements::getnodecoordinates').
+        // While the reuse is allowed they are gathered only once for the elements of the current block. The
+        // returned vector is only valid until the next call:
+        std::vector<double>* getnodecoordinates(int elementtypenumber, std::vector<int>& elementnumbers);
+
+        // Number of successful and failed precomputed value lookups since the start:
+        static long long int counthits(void) { return numhits; };
+        static long long int countmisses(void) { return nummisses; };
+        
+};
+
+#endif
@@ -1,5 +1,8 @@
 #include "expression.h"
 #include "oncontext.h"
+#include "exprprofiler.h"
+#include "subexpressions.h"
+#include "taskscheduler.h"
 
 
 expression::expression(field input)
@@ -214,6 +217,19 @@ expression::expression(expression condexpr, expression exprtrue, expression expr
     }
 }
 
+expression::expression(gausspointdata gpdata)
+{
+    mynumrows = gpdata.countrows();
+    mynumcols = gpdata.countcolumns();
+    
+    myoperations.resize(mynumrows*mynumcols);
+    for (int i = 0; i < mynumrows; i++)
+    {
+        for (int j = 0; j < mynumcols; j++)
+            myoperations[i*mynumcols+j] = std::shared_ptr<opgausspointdata>(new opgausspointdata(gpdata.getpointer(), i, j));
+    }
+}
+
 expression::expression(spline spl, expression arg)
 {
     if (arg.isscalar() == false)
@@ -336,6 +352,43 @@ expression::expression(int m, int n, std::vector<densemat> advancedcustomfct(std
         (weakops[i].lock())->setfamily(weakops);
 }
 
+expression::expression(int m, int n, void batchedcustomfct(double**, double**, long long int, int, int, int, int), std::vector<expression> exprs)
+{
+    mynumrows = m; mynumcols = n;
+
+    if (m <= 0 || n <= 0)
+    {
+        std::cout << "Error in 'expression' object: custom expression size cannot be zero or negative" << std::endl;
+        abort();
+    }
+    
+    // Get all argument operations:
+    std::vector<std::shared_ptr<operation>> argops = {};
+    for (int i = 0; i < exprs.size(); i++)
+    {
+        for (int j = 0; j < exprs[i].myoperations.size(); j++)
+        {
+            if (exprs[i].myoperations[j]->isdofincluded() || exprs[i].myoperations[j]->istfincluded())
+            {
+                std::cout << "Error in 'expression' object: custom expression argument cannot include a dof or tf" << std::endl;
+                abort();
+            }
+            argops.push_back(exprs[i].myoperations[j]);
+        }
+    }
+    
+    myoperations.resize(m*n);
+    std::vector<std::weak_ptr<opcustom>> weakops(m*n);
+    for (int i = 0; i < m*n; i++)
+    {
+        std::shared_ptr<opcustom> op(new opcustom(i, batchedcustomfct, argops));
+        myoperations[i] = op;
+        weakops[i] = op;
+    }
+    for (int i = 0; i < m*n; i++)
+        (weakops[i].lock())->setfamily(weakops);
+}
+
 expression::expression(std::shared_ptr<operation> input)
 {
     mynumrows = 1; mynumcols = 1;
@@ -618,13 +671,53 @@ std::vector<double> expression::interpolate(int physreg, expression meshdeform,
 
 void expression::interpolate(int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<double>& interpolated, std::vector<bool>& isfound)
 {
+    std::vector<expression> exprs = {*this};
+    std::vector<std::vector<double>> interpolatedexprs;
+    interpolate(exprs, physreg, meshdeform, xyzcoord, interpolatedexprs, isfound);
+    
+    interpolated = interpolatedexprs[0];
+}
+
+void expression::interpolate(std::vector<expression> exprs, int physreg, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    interpolate(exprs, physreg, NULL, xyzcoord, interpolated, isfound);
+}
+
+void expression::interpolate(std::vector<expression> exprs, int physreg, expression meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    interpolate(exprs, physreg, &meshdeform, xyzcoord, interpolated, isfound);
+}
+
+// Minimum number of element blocks per thread when interpolating at arbitrary coordinates:
+static const int minnumblocksperthreadforinterpolate = 20;
+
+void expression::interpolate(std::vector<expression>& exprs, int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound)
+{
+    // Make sure the mesh deformation expression has the right size.
+    int problemdimension = universe::getrawmesh()->getmeshdimension();
+    if (meshdeform != NULL && (meshdeform->countcolumns() != 1 || meshdeform->countrows() < problemdimension))
+    {
+        std::cout << "Error in 'expression' object: mesh deformation expression has size " << meshdeform->countrows() << "x" << meshdeform->countcolumns() << " (expected " << problemdimension << "x1)" << std::endl;
+        abort();
+    }
+
     // Get only the disjoint regions with highest dimension elements:
     std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(physreg))->getdisjointregions();
 
     // Multiharmonic expressions are not allowed.
-    if (not(isharmonicone(disjregs)))
+    for (int i = 0; i < exprs.size(); i++)
     {
-        std::cout << "Error in 'expression' object: cannot interpolate a multiharmonic expression (only constant harmonic 1)" << std::endl;
+        if (not(exprs[i].isharmonicone(disjregs)))
+        {
+            std::cout << "Error in 'expression' object: cannot interpolate a multiharmonic expression (only constant harmonic 1)" << std::endl;
+            abort();
+        }
+    }
+    if (meshdeform != NULL && not(meshdeform->isharmonicone(disjregs)))
+    {
+        std::cout << "Error in 'expression' object: the mesh deformation expression cannot be multiharmonic (only constant harmonic 1)" << std::endl;
         abort();
     }
     if (xyzcoord.size()%3 != 0)
@@ -634,22 +727,129 @@ void expression::interpolate(int physreg, expression* meshdeform, std::vector<do
     }
 
     int numcoords = xyzcoord.size()/3;
-    int exprlen = countrows()*countcolumns();
-    interpolated.resize(numcoords*exprlen);
-
-    // Interpolate every expression entry:
-    for (int i = 0; i < exprlen; i++)
+    
+    // All entries of all expressions are interpolated together:
+    std::vector<std::shared_ptr<operation>> ops = {};
+    std::vector<int> exprnums = {}, entrynums = {}, exprlens(exprs.size());
+    interpolated = std::vector<std::vector<double>>(exprs.size());
+    for (int i = 0; i < exprs.size(); i++)
     {
-        std::vector<std::vector<double>> interpolatedscalar;
-        expression(myoperations[i]).interpolate(physreg, meshdeform, xyzcoord, interpolatedscalar, isfound, -1);
-
-        for (int j = 0; j < numcoords; j++)
-            interpolated[j*exprlen+i] = interpolatedscalar[1][j];
+        exprlens[i] = exprs[i].countrows()*exprs[i].countcolumns();
+        interpolated[i] = std::vector<double>(numcoords*exprlens[i], 0.0);
+        for (int j = 0; j < exprlens[i]; j++)
+        {
+            ops.push_back(exprs[i].myoperations[j]);
+            exprnums.push_back(i);
+            entrynums.push_back(j);
+        }
     }
+    isfound = std::vector<bool>(numcoords, false);
+    
+    universe::allowestimatorupdate(true);
+    
+    referencecoordinategroup rcg(xyzcoord);
+    
+    // Send all disjoint regions with same element type number together:
+    disjointregionselector mydisjregselector(disjregs, {});
+    for (int g = 0; g < mydisjregselector.countgroups(); g++)
+    {
+        std::vector<int> curdisjregs = mydisjregselector.getgroup(g);
+        
+        rcg.evalat(curdisjregs);
+        
+        // Simplify the operations, share the subexpressions common to all entries and fuse the elementwise operations.
+        // Also check if orientation matters.
+        std::vector<std::shared_ptr<operation>> curops(ops.size());
+        for (int k = 0; k < ops.size(); k++)
+            curops[k] = ops[k]->simplify(curdisjregs);
+        subexpressions::share(curops);
+        bool isorientationdependent = (meshdeform != NULL && meshdeform->isvalueorientationdependent(curdisjregs));
+        bool ismultithreaded = (universe::getmaxnumthreads() > 1 && (meshdeform == NULL || meshdeform->isthreadsafe(curdisjregs)));
+        for (int k = 0; k < curops.size(); k++)
+        {
+            curops[k] = opfused::fuse(curops[k], curdisjregs);
+            isorientationdependent = (isorientationdependent || curops[k]->isvalueorientationdependent(curdisjregs));
+            ismultithreaded = (ismultithreaded && curops[k]->isthreadsafe(curdisjregs));
+        }
+        
+        // Get all blocks of elements with the same reference coordinates:
+        std::vector<std::vector<double>> kietaphis = {};
+        std::vector<std::vector<int>> coordnums = {}, elems = {};
+        while (rcg.next())
+        {
+            kietaphis.push_back(rcg.getreferencecoordinates());
+            coordnums.push_back(rcg.getcoordinatenumber());
+            elems.push_back(rcg.getelements());
+            
+            for (int c = 0; c < coordnums.back().size(); c++)
+                isfound[coordnums.back()[c]] = true;
+        }
+        int numblocks = elems.size();
+        
+        // Interpolate all operations on every block in a range. Every coordinate is in a single block:
+        auto computeblocks = [&](int blockbegin, int blockend)
+        {
+            for (int b = blockbegin; b < blockend; b++)
+            {
+                int numrefcoords = kietaphis[b].size()/3;
+                
+                // Loop on all total orientations (if required):
+                elementselector myselector(curdisjregs, elems[b], isorientationdependent);
+                do 
+                {
+                    std::vector<int> origindexes = myselector.getoriginalindexes();
+                    
+                    // Clean storage before allowing reuse:
+                    universe::forbidreuse();
+                    universe::allowreuse();
+                    for (int k = 0; k < curops.size(); k++)
+                    {
+                        std::vector<std::vector<densemat>> interp = curops[k]->interpolate(myselector, kietaphis[b], meshdeform);
+                        if (interp.size() < 2 || interp[1].size() == 0)
+                            continue;
+                        
+                        double* interpvals = interp[1][0].getvalues();
+                        std::vector<double>& curinterpolated = interpolated[exprnums[k]];
+                        int exprlen = exprlens[exprnums[k]];
+                        for (int e = 0; e < origindexes.size(); e++)
+                        {
+                            for (int c = 0; c < numrefcoords; c++)
+                                curinterpolated[coordnums[b][origindexes[e]*numrefcoords+c]*exprlen + entrynums[k]] = interpvals[e*numrefcoords+c];
+                        }
+                    }
+                    universe::forbidreuse();
+                }
+                while (myselector.next());
+            }
+        };
+        
+        int numthreadstouse = 1;
+        if (ismultithreaded)
+            numthreadstouse = std::min(numblocks/minnumblocksperthreadforinterpolate+1, universe::getmaxnumthreads()); // require a min num blocks per thread
+        
+        if (numthreadstouse == 1)
+        {
+            computeblocks(0, numblocks);
+            continue;
+        }
+        
+        // Having more chunks than threads balances the load:
+        int numchunks = std::min(4*numthreadstouse, numblocks);
+        auto computechunk = [&](int c)
+        {
+            computeblocks((long long int)c*numblocks/numchunks, (long long int)(c+1)*numblocks/numchunks);
+        };
+        
+        // The first chunk is computed on this thread so that all lazy 
+        // synchronizations happen before the other threads start:
+        taskscheduler::run(numchunks, computechunk, true, numthreadstouse);
+    }
+    
+    universe::allowestimatorupdate(false);
 }
 
 
-void expression::interpolate(int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound, int numtimeevals)
+void expression::interpolate(int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound, int numtimeevals, std::vector<std::vector<int>>* foundelems, std::vector<std::vector<double>>* foundkietaphis)
 {
     // Make sure the mesh deformation expression has the right size.
     int problemdimension = universe::getrawmesh()->getmeshdimension();
@@ -682,15 +882,30 @@ void expression::interpolate(int physreg, expression* meshdeform, std::vector<do
     
     // Send all disjoint regions with same element type number together:
     disjointregionselector mydisjregselector(disjregs, {});
+    
+    bool isprovided = (foundelems != NULL && foundkietaphis != NULL && foundelems->size() == mydisjregselector.countgroups());
+    if (foundelems != NULL && foundkietaphis != NULL && not(isprovided))
+    {
+        *foundelems = std::vector<std::vector<int>>(mydisjregselector.countgroups());
+        *foundkietaphis = std::vector<std::vector<double>>(mydisjregselector.countgroups());
+    }
+    
     for (int i = 0; i < mydisjregselector.countgroups(); i++)
     {
         std::vector<int> curdisjregs = mydisjregselector.getgroup(i);
         
-        rcg.evalat(curdisjregs);
+        if (foundelems == NULL || foundkietaphis == NULL)
+            rcg.evalat(curdisjregs);
+        else
+        {
+            if (not(isprovided))
+                rcg.search(curdisjregs, foundelems->at(i), foundkietaphis->at(i));
+            rcg.evalatfound(foundelems->at(i), foundkietaphis->at(i));
+        }
     
         // Simplify all coeffs for faster computation later on.
         // Also check if orientation matters.
-        myoperations[0] = myoperations[0]->simplify(curdisjregs);
+        myoperations[0] = opfused::fuse(myoperations[0]->simplify(curdisjregs), curdisjregs);
         bool isorientationdependent = (myoperations[0]->isvalueorientationdependent(curdisjregs) || (meshdeform != NULL && meshdeform->isvalueorientationdependent(curdisjregs)));
         
         while (rcg.next())
@@ -809,7 +1024,8 @@ double expression::integrate(int physreg, expression* meshdeform, int integratio
     
     universe::allowestimatorupdate(true);
 
-    double integralvalue = 0;
+    // Integral on every element block (summed at the end):
+    std::vector<double> blockvalues = {};
     // Send the disjoint regions with same element type numbers together:
     disjointregionselector mydisjregselector(selecteddisjregs, {});
     for (int i = 0; i < mydisjregselector.countgroups(); i++)
@@ -819,8 +1035,13 @@ double expression::integrate(int physreg, expression* meshdeform, int integratio
         // Get the Gauss points:
         int elementtypenumber = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(mydisjregs[0]);
         gausspoints mygausspoints(elementtypenumber, integrationorder);
-        std::vector<double> evaluationpoints = mygausspoints.getcoordinates();
-        std::vector<double> weights = mygausspoints.getweights();
+        std::vector<double>& evaluationpoints = mygausspoints.getcoordinates();
+        std::vector<double>& weights = mygausspoints.getweights();
+
+        // Evaluate a profiled copy of the integrand if requested:
+        std::vector<std::shared_ptr<operation>> integrand = {myoperations[0]};
+        if (exprprofiler::isenabled())
+            exprprofiler::instrument(integrand, {"integrate on region " + std::to_string(physreg) + ": " + exprprofiler::tostring(myoperations[0])});
 
         // Loop on all total orientations (if required):
         bool isorientationdependent = isvalueorientationdependent(mydisjregs) || (meshdeform != NULL && meshdeform->isvalueorientationdependent(mydisjregs));
@@ -834,10 +1055,10 @@ double expression::integrate(int physreg, expression* meshdeform, int integratio
             detjac.abs();
 
             // Store it in the universe for reuse.
-            universe::computedjacobian = myjacobian;
+            universe::getcontext()->computedjacobian = myjacobian;
             universe::allowreuse();
 
-            densemat compxinterpolated = myoperations[0]->interpolate(myselector, evaluationpoints, meshdeform)[1][0];
+            densemat compxinterpolated = integrand[0]->interpolate(myselector, evaluationpoints, meshdeform)[1][0];
             compxinterpolated.multiplyelementwise(detjac);
 
             universe::forbidreuse();
@@ -845,13 +1066,19 @@ double expression::integrate(int physreg, expression* meshdeform, int integratio
             densemat weightsmat(mygausspoints.count(), 1, weights);
             compxinterpolated = compxinterpolated.multiply(weightsmat);
 
-            integralvalue += compxinterpolated.sum();
+            blockvalues.push_back(compxinterpolated.sum());
         }
         while (myselector.next());
     }
     
     universe::allowestimatorupdate(false);
     
+    if (universe::isreductionreproducible)
+        return gentools::compensatedsum(blockvalues.data(), blockvalues.size());
+    
+    double integralvalue = 0;
+    for (int b = 0; b < blockvalues.size(); b++)
+        integralvalue += blockvalues[b];
     return integralvalue;
 }
 
@@ -880,6 +1107,33 @@ void expression::write(int physreg, expression meshdeform, std::string filename,
 }
 
 
+// Minimum number of elements per thread when interpolating the output data:
+static const int minnumelemsperthreadforwrite = 500;
+
+// Interpolate to the output nodes the values in every row block of 'numblocks' blocks (one per timestep):
+static densemat elevatelagrangeorder(densemat values, densemat& elevationmatrix, int numblocks)
+{
+    if (numblocks == 1)
+        return values.multiply(elevationmatrix);
+    
+    int numrows = values.countrows();
+    int numin = elevationmatrix.countrows(), numout = elevationmatrix.countcolumns();
+    
+    densemat output(numrows, numblocks*numout);
+    double* outvals = output.getvalues();
+    for (int b = 0; b < numblocks; b++)
+    {
+        densemat curblock = values.extractcols(b*numin, (b+1)*numin-1).multiply(elevationmatrix);
+        double* curvals = curblock.getvalues();
+        for (int r = 0; r < numrows; r++)
+        {
+            for (int c = 0; c < numout; c++)
+                outvals[r*numblocks*numout + b*numout + c] = curvals[r*numout + c];
+        }
+    }
+    return output;
+}
+
 void expression::write(int physreg, int numfftharms, expression* meshdeform, std::string filename, int lagrangeorder, int numtimesteps)
 {
     // Make sure this expression is a column vector and the
@@ -932,43 +1186,70 @@ void expression::write(int physreg, int numfftharms, expression* meshdeform, std
     if (numtimesteps > 0)
         datatowrite = {{iodata(lagrangeorder, geolagrangeorder, isscalar(), timetags)}};
 
+    // Get the Lagrange order at which to compute the data in every disjoint region (see 'universe::setoutputlagrangeorder'):
+    std::vector<int> computeorders(selecteddisjregs.size(), lagrangeorder);
+    for (int i = 0; i < universe::outputlagrangeorders.size(); i++)
+    {
+        int curphysreg = universe::outputlagrangeorders[i].first;
+        universe::getrawmesh()->getphysicalregions()->errorundefined({curphysreg});
+        std::vector<int> reddisjregs = ((universe::getrawmesh()->getphysicalregions())->get(curphysreg))->getdisjointregions(-1);
+        std::vector<bool> isinreduced(universe::getrawmesh()->getdisjointregions()->count(), false);
+        for (int d = 0; d < reddisjregs.size(); d++)
+            isinreduced[reddisjregs[d]] = true;
+
+        for (int d = 0; d < selecteddisjregs.size(); d++)
+        {
+            if (isinreduced[selecteddisjregs[d]])
+                computeorders[d] = std::min(computeorders[d], universe::outputlagrangeorders[i].second);
+        }
+    }
+
     universe::allowestimatorupdate(true);
 
-    // Send the disjoint regions with same element type numbers together:
-    disjointregionselector mydisjregselector(selecteddisjregs, {});
+    // Send the disjoint regions with same element type numbers and same computation order together:
+    disjointregionselector mydisjregselector(selecteddisjregs, {computeorders});
     for (int g = 0; g < mydisjregselector.countgroups(); g++)
     {
         std::vector<int> mydisjregs = mydisjregselector.getgroup(g);
 
         int elementtype = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(mydisjregs[0]);
         element myelement(elementtype);
+        
+        int computeorder = computeorders[std::find(selecteddisjregs.begin(), selecteddisjregs.end(), mydisjregs[0]) - selecteddisjregs.begin()];
 
         // The expression will be interpolated at the following Lagrange nodes:
-        lagrangeformfunction mylagrange(elementtype, lagrangeorder, {});
-        std::vector<double> lagrangecoords = mylagrange.getnodecoordinates();
+        std::vector<double> lagrangecoords = lagrangeformfunction::getcachednodecoordinates(elementtype, computeorder);
+        // The values at the computation order nodes are interpolated to the output order nodes with this matrix:
+        densemat elevationmatrix;
+        if (computeorder < lagrangeorder)
+            elevationmatrix = lagrangeformfunction::getcachedderivative(elementtype, computeorder, lagrangeformfunction::getcachednodecoordinates(elementtype, lagrangeorder), 0);
         // The x, y and z coordinates will be interpolated at the following Lagrange nodes:
-        lagrangeformfunction mygeolagrange(elementtype, geolagrangeorder, {});
-        std::vector<double> geolagrangecoords = mygeolagrange.getnodecoordinates();
+        std::vector<double> geolagrangecoords = lagrangeformfunction::getcachednodecoordinates(elementtype, geolagrangeorder);
 
-        // Loop on all total orientations (if required):
-        bool isorientationdependent = isvalueorientationdependent(mydisjregs) || (meshdeform != NULL && meshdeform->isvalueorientationdependent(mydisjregs));
-        elementselector myselector(mydisjregs, isorientationdependent);
-        do
+        // Evaluate profiled copies of the components if requested:
+        std::vector<std::shared_ptr<operation>> writtenops = myoperations;
+        if (exprprofiler::isenabled())
         {
-            // The harmonic content might have changed:
-            std::vector<int> harms = {};
+            std::vector<std::string> compnames(countrows());
+            for (int i = 0; i < countrows(); i++)
+                compnames[i] = "write on region " + std::to_string(physreg) + ": " + exprprofiler::tostring(myoperations[i]);
+            exprprofiler::instrument(writtenops, compnames);
+        }
 
+        // Interpolate the coordinates and the expression on the elements in a selector:
+        auto interpolateblock = [&](elementselector& cursel, std::vector<densemat>& coords, std::vector<std::vector<std::vector<densemat>>>& expr, std::vector<densemat>& fftexpr)
+        {
             // Compute the mesh coordinates. Initialise all coordinates to zero.
-            std::vector<densemat> coords(3,densemat(myselector.countinselection(), geolagrangecoords.size()/3,0));
+            coords = std::vector<densemat>(3,densemat(cursel.countinselection(), geolagrangecoords.size()/3,0));
             for (int i = 0; i < problemdimension; i++)
             {
-                coords[i] = (xyz.myoperations[i]->interpolate(myselector, geolagrangecoords, NULL))[1][0];
+                coords[i] = (xyz.myoperations[i]->interpolate(cursel, geolagrangecoords, NULL))[1][0];
                 if (meshdeform != NULL)
-                    coords[i].add((meshdeform->myoperations[i]->interpolate(myselector, geolagrangecoords, NULL))[1][0]);
+                    coords[i].add((meshdeform->myoperations[i]->interpolate(cursel, geolagrangecoords, NULL))[1][0]);
             }
             // Interpolate the current expression:
-            std::vector<  std::vector<std::vector<densemat>>  > expr(countrows());
-            std::vector<densemat> fftexpr(countrows());
+            expr = std::vector<  std::vector<std::vector<densemat>>  >(countrows());
+            fftexpr = std::vector<densemat>(countrows());
             // Reuse what's possible to reuse during the interpolation:
             universe::allowreuse();
             for (int i = 0; i < countrows(); i++)
@@ -976,51 +1257,109 @@ void expression::write(int physreg, int numfftharms, expression* meshdeform, std
                 if (numtimesteps <= 0)
                 {
                     if (numfftharms <= 0)
-                        expr[i] = myoperations[i]->interpolate(myselector, lagrangecoords, meshdeform);
+                        expr[i] = writtenops[i]->interpolate(cursel, lagrangecoords, meshdeform);
                     else
-                        expr[i] = fourier::fft(myoperations[i]->multiharmonicinterpolate(numfftharms, myselector, lagrangecoords, meshdeform), myselector.countinselection(), lagrangecoords.size()/3);
+                        expr[i] = fourier::fft(writtenops[i]->multiharmonicinterpolate(numfftharms, cursel, lagrangecoords, meshdeform), cursel.countinselection(), lagrangecoords.size()/3);
                 }
                 else
-                    fftexpr[i] = fourier::toelementrowformat(myoperations[i]->multiharmonicinterpolate(numtimesteps, myselector, lagrangecoords, meshdeform), myselector.countinselection());
+                    fftexpr[i] = fourier::toelementrowformat(writtenops[i]->multiharmonicinterpolate(numtimesteps, cursel, lagrangecoords, meshdeform), cursel.countinselection());
             }
             universe::forbidreuse();
-
-            // Make sure the harmonic content is the same for every component:
-            if (numtimesteps <= 0)
-                fourier::sameharmonics(expr);
-
-            // Get a vector containing all harmonic numbers in 'expr' on the current disjoint regions:
-            if (numtimesteps <= 0)
+            
+            // Bring the values to the output order:
+            if (computeorder < lagrangeorder)
             {
-                for (int h = 0; h < expr[0].size(); h++)
+                for (int i = 0; i < countrows(); i++)
                 {
-                    if (expr[0][h].size() == 1)
+                    if (numtimesteps > 0)
+                        fftexpr[i] = elevatelagrangeorder(fftexpr[i], elevationmatrix, numtimesteps);
+                    else
                     {
-                        harms.push_back(h);
-                        if (datatowrite.size() < h+1)
-                            datatowrite.resize(h+1);
-                        if (datatowrite[h].size() == 0)
-                            datatowrite[h] = {iodata(lagrangeorder, geolagrangeorder, isscalar(), timetags)};
+                        for (int h = 0; h < expr[i].size(); h++)
+                        {
+                            if (expr[i][h].size() == 1)
+                                expr[i][h][0] = elevatelagrangeorder(expr[i][h][0], elevationmatrix, 1);
+                        }
                     }
                 }
             }
 
+            // Make sure the harmonic content is the same for every component:
             if (numtimesteps <= 0)
+                fourier::sameharmonics(expr);
+        };
+        
+        // Add the interpolated block to the data to write:
+        auto addblock = [&](std::vector<densemat>& coords, std::vector<std::vector<std::vector<densemat>>>& expr, std::vector<densemat>& fftexpr)
+        {
+            if (numtimesteps > 0)
             {
-                for (int h = 0; h < harms.size(); h++)
+                datatowrite[0][0].addcoordinates(elementtype, coords[0], coords[1], coords[2]);
+                datatowrite[0][0].adddata(elementtype, fftexpr);
+                return;
+            }
+            
+            // The harmonic content might have changed:
+            for (int h = 0; h < expr[0].size(); h++)
+            {
+                if (expr[0][h].size() == 1)
                 {
-                    datatowrite[harms[h]][0].addcoordinates(elementtype, coords[0], coords[1], coords[2]);
+                    if (datatowrite.size() < h+1)
+                        datatowrite.resize(h+1);
+                    if (datatowrite[h].size() == 0)
+                        datatowrite[h] = {iodata(lagrangeorder, geolagrangeorder, isscalar(), timetags)};
+                        
+                    datatowrite[h][0].addcoordinates(elementtype, coords[0], coords[1], coords[2]);
                     std::vector<densemat> curdata(countrows());
                     for (int comp = 0; comp < countrows(); comp++)
-                        curdata[comp] = expr[comp][harms[h]][0];
-                    datatowrite[harms[h]][0].adddata(elementtype, curdata);
+                        curdata[comp] = expr[comp][h][0];
+                    datatowrite[h][0].adddata(elementtype, curdata);
                 }
             }
-            else
+        };
+
+        // Loop on all total orientations (if required):
+        bool isorientationdependent = isvalueorientationdependent(mydisjregs) || (meshdeform != NULL && meshdeform->isvalueorientationdependent(mydisjregs));
+        bool ismultithreaded = (universe::getmaxnumthreads() > 1 && isthreadsafe(mydisjregs) && (meshdeform == NULL || meshdeform->isthreadsafe(mydisjregs)));
+        elementselector myselector(mydisjregs, isorientationdependent);
+        do
+        {
+            std::vector<int> elementnumbers = myselector.getelementnumbers();
+            int numelems = elementnumbers.size();
+            
+            int numthreadstouse = 1;
+            if (ismultithreaded)
+                numthreadstouse = std::min(numelems/minnumelemsperthreadforwrite+1, universe::getmaxnumthreads()); // require a min num elements per thread
+        
+            if (numthreadstouse == 1)
             {
-                datatowrite[0][0].addcoordinates(elementtype, coords[0], coords[1], coords[2]);
-                datatowrite[0][0].adddata(elementtype, fftexpr);
+                std::vector<densemat> coords, fftexpr;
+                std::vector<std::vector<std::vector<densemat>>> expr;
+                interpolateblock(myselector, coords, expr, fftexpr);
+                addblock(coords, expr, fftexpr);
+                continue;
             }
+            
+            // Split the elements in chunks. Having more chunks than threads balances the load:
+            int numchunks = std::min(4*numthreadstouse, numelems);
+            std::vector<std::shared_ptr<elementselector>> chunkselectors(numchunks, NULL);
+            std::vector<std::vector<densemat>> chunkcoords(numchunks), chunkfftexprs(numchunks);
+            std::vector<std::vector<std::vector<std::vector<densemat>>>> chunkexprs(numchunks);
+            
+            auto computechunk = [&](int c)
+            {
+                std::vector<int> chunkelems(elementnumbers.begin() + (long long int)c*numelems/numchunks, elementnumbers.begin() + (long long int)(c+1)*numelems/numchunks);
+                chunkselectors[c] = std::shared_ptr<elementselector>(new elementselector(mydisjregs, chunkelems, isorientationdependent));
+                interpolateblock(*chunkselectors[c], chunkcoords[c], chunkexprs[c], chunkfftexprs[c]);
+            };
+            
+            // The first chunk is computed on this thread so that all lazy 
+            // synchronizations happen before the other threads start:
+            taskscheduler::run(numchunks, computechunk, true, numthreadstouse);
+                
+            // Add in the chunk order so that the elements are in the same order as without threads:
+            for (int c = 0; c < numchunks; c++)
+                addblock(chunkcoords[c], chunkexprs[c], chunkfftexprs[c]);
         }
         while (myselector.next());
     }
@@ -1034,6 +1373,8 @@ void expression::write(int physreg, int numfftharms, expression* meshdeform, std
         {
             if (datatowrite[h].size() == 1)
             {
+                datatowrite[h][0].decimate(universe::outputelementstride);
+                
                 if (h <= 1)
                     iointerface::writetofile(filename, datatowrite[h][0]);
                 else
@@ -1042,7 +1383,10 @@ void expression::write(int physreg, int numfftharms, expression* meshdeform, std
         }
     }
     else
+    {
+        datatowrite[0][0].decimate(universe::outputelementstride);
         iointerface::writetofile(filename, datatowrite[0][0], "timesteps"+std::to_string(numtimesteps));
+    }
 }
 
 void expression::streamline(int physreg, std::string filename, const std::vector<double>& startcoords, double stepsize, bool downstreamonly)
@@ -1232,6 +1576,16 @@ bool expression::isvalueorientationdependent(std::vector<int> disjregs)
     return false;
 }
 
+bool expression::isthreadsafe(std::vector<int> disjregs)
+{
+    for (int i = 0; i < mynumrows*mynumcols; i++)
+    {
+        if (myoperations[i]->isthreadsafe(disjregs) == false)
+            return false;
+    }
+    return true;
+}
+
 bool expression::iszero(void)
 {
     for (int i = 0; i < mynumrows*mynumcols; i++)
@@ -1842,7 +2196,7 @@ expression expression::mod(double modval)
     return modexpr;
 }
 
-expression expression::on(int physreg, expression* coordshift, bool errorifnotfound)
+expression expression::on(int physreg, expression* coordshift, bool errorifnotfound, std::shared_ptr<rawslidinginterface> sliding)
 {
     int problemdimension = universe::getrawmesh()->getmeshdimension();
     if (coordshift != NULL && (coordshift->countcolumns() != 1 || coordshift->countrows() < problemdimension))
@@ -1861,7 +2215,7 @@ expression expression::on(int physreg, expression* coordshift, bool errorifnotfo
             abort();
         }
         if (myoperations[i]->isdofincluded() == false)
-            onexpr.myoperations[i] = std::shared_ptr<opon>(new opon(physreg, coordshift, onexpr.myoperations[i], errorifnotfound));
+            onexpr.myoperations[i] = std::shared_ptr<opon>(new opon(physreg, coordshift, onexpr.myoperations[i], errorifnotfound, sliding));
         else
         {
             // Isolate the dofs (multiply by a dummy scalar test function for the call to 'extractdoftf').
@@ -1881,13 +2235,13 @@ expression expression::on(int physreg, expression* coordshift, bool errorifnotfo
                 for (int n = 0; n < dofs[m].size(); n++)
                 {
                     // The coefficient is a new opon object:
-                    std::shared_ptr<operation> curcoef(new opon(physreg, coordshift, coeffs[m][n]->copy(), errorifnotfound));
+                    std::shared_ptr<operation> curcoef(new opon(physreg, coordshift, coeffs[m][n]->copy(), errorifnotfound, sliding));
                     // The dof gets the on tag:
                     std::shared_ptr<operation> curdof, curterm;
                     if (dofs[m][n]->getfieldpointer() != NULL)
                     {
                         curdof = dofs[m][n]->copy();
-                        oncontext ctxt(physreg, coordshift, errorifnotfound);
+                        oncontext ctxt(physreg, coordshift, errorifnotfound, sliding);
                         curdof->setoncontext(ctxt);
                         curterm = std::shared_ptr<opproduct>(new opproduct({curcoef,curdof}));
                     }
@@ -1957,7 +2311,7 @@ expression expression::invjac(void)
             return expression(3,3,{invjac(0,0),0,0,   0,1,0,   0,0,1});
         case 2:
         {
-            if (universe::isaxisymmetric)
+            if (universe::getsession()->isaxisymmetric)
                 return expression(3,3,{invjac(0,0),invjac(0,1),0,   invjac(1,0),invjac(1,1),0,   0,0,invjac(2,2)});
             else
                 return expression(3,3,{invjac(0,0),invjac(0,1),0,   invjac(1,0),invjac(1,1),0,   0,0,1});
@@ -1978,7 +2332,7 @@ expression expression::jac(void)
             return expression(3,3,{jac(0,0),0,0,   0,1,0,   0,0,1});
         case 2:
         {
-            if (universe::isaxisymmetric)
+            if (universe::getsession()->isaxisymmetric)
                 return expression(3,3,{jac(0,0),jac(0,1),0,   jac(1,0),jac(1,1),0,   0,0,jac(2,2)});
             else
                 return expression(3,3,{jac(0,0),jac(0,1),0,   jac(1,0),jac(1,1),0,   0,0,1});
@@ -23,6 +23,7 @@
 #include "jacobian.h" 
 #include <memory>
 #include "parameter.h"
+#include "gausspointdata.h"
 #include "polynomial.h"
 #include "fourier.h"
 #include <cmath>
@@ -35,11 +36,13 @@
 #include "spline.h"
 #include "referencecoordinategroup.h"
 #include "port.h"
+#include "rawslidinginterface.h"
 
 
 class vec;
 class operation;
 class parameter;
+class gausspointdata;
 class field;
 class port;
 class shape;
@@ -64,7 +67,10 @@ class expression
         
         std::vector<double> max(int physreg, expression* meshdeform, int refinement, std::vector<double> xyzrange);
         void interpolate(int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<double>& interpolated, std::vector<bool>& isfound);
-        void interpolate(int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound, int numtimeevals);
+        static void interpolate(std::vector<expression>& exprs, int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound);
+        // The point search output of every disjoint region group is provided in 'foundelems' and 'foundkietaphis' if not
+        // NULL. They are filled by the call if empty and used instead of searching the coordinates again otherwise:
+        void interpolate(int physreg, expression* meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound, int numtimeevals, std::vector<std::vector<int>>* foundelems = NULL, std::vector<std::vector<double>>* foundkietaphis = NULL);
         double integrate(int physreg, expression* meshdeform, int integrationorder);
         void write(int physreg, int numfftharms, expression* meshdeform, std::string filename, int lagrangeorder, int numtimesteps);
         
@@ -83,6 +89,8 @@ class expression
         // If true the expression value is the expression as second argument, if false it is the 
         // expression provided as third argument.
         expression(expression condexpr, expression exprtrue, expression exprfalse);
+        // Values stored at the Gauss points:
+        expression(gausspointdata gpdata);
         // Expression based on a spline interpolation of a discrete function of argument 'arg':
         expression(spline spl, expression arg);
         // Piecewise expression definition:
@@ -91,6 +99,12 @@ class expression
         expression(int m, int n, std::vector<densemat> customfct(std::vector<densemat>), std::vector<expression> exprs);
         // Advanced custom function:
         expression(int m, int n, std::vector<densemat> advancedcustomfct(std::vector<densemat>, std::vector<field>, elementselector&, std::vector<double>&, expression*), std::vector<expression> exprs, std::vector<field> infields);
+        // Batched custom function. It must be thread-safe: it can be called concurrently on disjoint
+        // ranges. The value of input i at evaluation point g of element e is inputs[i][e*stride+g] and
+        // the m*n outputs (row-major) must be written at the same position for all elements in
+        // [elemstart,elemend) and all evaluation points in [gpstart,gpend). For multiharmonic
+        // expressions the 'elements' are the time evaluations (the function must then be pointwise).
+        expression(int m, int n, void batchedcustomfct(double** inputs, double** outputs, long long int stride, int elemstart, int elemend, int gpstart, int gpend), std::vector<expression> exprs);
         
         // Define a 1x1 expression from an operation:
         expression(std::shared_ptr<operation>);
@@ -128,6 +142,11 @@ class expression
         // In case the coordinate is not in the physical region or there was any other issue the returned vector is empty.
         std::vector<double> interpolate(int physreg, const std::vector<double> xyzcoord);
         std::vector<double> interpolate(int physreg, expression meshdeform, const std::vector<double> xyzcoord);
+        // Interpolate multiple expressions at the same coordinates (to use multiple sets of coordinates concatenate them).
+        // The coordinates are only searched once and all expressions are evaluated together on every element block with
+        // multiple threads. After the call 'interpolated[i]' holds the values of 'exprs[i]' in the format above.
+        static void interpolate(std::vector<expression> exprs, int physreg, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound);
+        static void interpolate(std::vector<expression> exprs, int physreg, expression meshdeform, std::vector<double>& xyzcoord, std::vector<std::vector<double>>& interpolated, std::vector<bool>& isfound);
         
         double integrate(int physreg, int integrationorder);
         double integrate(int physreg, expression meshdeform, int integrationorder);
@@ -153,6 +172,7 @@ class expression
         bool isscalar(void) { return (mynumrows == 1 && mynumcols == 1); };
         bool isharmonicone(std::vector<int> disjregs);
         bool isvalueorientationdependent(std::vector<int> disjregs);
+        bool isthreadsafe(std::vector<int> disjregs);
         bool iszero(void);
         
         // Output a vector based on field 'onefield' that stores the barycenter values of the expression.
@@ -208,7 +228,8 @@ class expression
         expression log10(void);
         expression mod(double modval);
         
-        expression on(int physreg, expression* coordshift, bool errorifnotfound);
+        // The point search is replaced by the sliding interface lookup if not NULL:
+        expression on(int physreg, expression* coordshift, bool errorifnotfound, std::shared_ptr<rawslidinginterface> sliding = NULL);
         
         // The time variable:
         expression time(void);
@@ -0,0 +1,185 @@
+#include "exprprofiler.h"
+#include "subexpressions.h"
+#include "memoryusage.h"
+
+
+bool exprprofiler::isitenabled = false;
+std::mutex exprprofiler::mymutex;
+std::vector<exprprofilenode> exprprofiler::mynodes = {exprprofilenode()};
+
+// Human readable time (e.g. '12.3 ms') for a time in nanoseconds:
+std::string timetostring(double time)
+{
+    std::vector<std::string> units = {"ns", "us", "ms", "s"};
+    int unit = 0;
+    while (unit < 3 && time >= 1000)
+    {
+        time = time/1000;
+        unit++;
+    }
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.3g %s", time, units[unit].c_str());
+    return buf;
+}
+
+int exprprofiler::getnode(int parent, std::string name, std::string type)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    for (int i = 0; i < mynodes[parent].children.size(); i++)
+    {
+        int child = mynodes[parent].children[i];
+        if (mynodes[child].name == name)
+            return child;
+    }
+
+    exprprofilenode newnode;
+    newnode.name = name;
+    newnode.type = type;
+    newnode.parent = parent;
+    mynodes.push_back(newnode);
+    mynodes[parent].children.push_back(mynodes.size()-1);
+
+    return mynodes.size()-1;
+}
+
+std::shared_ptr<operation> exprprofiler::instrument(std::shared_ptr<operation> op, int parent, std::unordered_map<operation*, std::shared_ptr<operation>>& instrumented)
+{
+    std::unordered_map<operation*, std::shared_ptr<operation>>::iterator it = instrumented.find(op.get());
+    if (it != instrumented.end())
+        return it->second;
+
+    // Remove the length prefix of the type name:
+    std::string type = typeid(*op).name();
+    while (type.size() > 1 && type[0] >= '0' && type[0] <= '9')
+        type = type.substr(1);
+    
+    int node = getnode(parent, tostring(op), type);
+
+    // The copy points to the profiled arguments (the original tree is not modified).
+    // The arguments of a fused operation are its leaves:
+    std::shared_ptr<operation> profiledop = op;
+    if (subexpressions::isstructural(op) || std::dynamic_pointer_cast<opfused>(op) != NULL)
+    {
+        std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+        profiledop = op->copy();
+        profiledop->reuseit(op->isreused());
+        for (int i = 0; i < arguments.size(); i++)
+            profiledop->replaceargument(i, instrument(arguments[i], node, instrumented));
+    }
+
+    std::shared_ptr<operation> output(new opprofile(profiledop, node));
+    instrumented[op.get()] = output;
+
+    return output;
+}
+
+void exprprofiler::print(int node, int depth)
+{
+    exprprofilenode& cur = mynodes[node];
+
+    // The trees are measured through their operation:
+    double time = cur.time;
+    long long int numbytes = cur.numbytes;
+    if (depth == 0)
+    {
+        for (int i = 0; i < cur.children.size(); i++)
+        {
+            time += mynodes[cur.children[i]].time;
+            numbytes += mynodes[cur.children[i]].numbytes;
+        }
+        std::cout << std::endl << cur.name << " (" << timetostring(time) << ", " << memoryusage::tostring(numbytes) << ")" << std::endl;
+    }
+    else
+    {
+        double selftime = time;
+        for (int i = 0; i < cur.children.size(); i++)
+            selftime -= mynodes[cur.children[i]].time;
+
+        // Long operations are truncated:
+        std::string name = cur.name;
+        if (name.size() > 100)
+            name = name.substr(0, 97) + "...";
+
+        std::cout << std::string(4*depth, ' ') << timetostring(time) << " (self " << timetostring(std::max(0.0, selftime)) << "), " << cur.numcalls << " calls, " << memoryusage::tostring(numbytes) << ": " << name << std::endl;
+    }
+
+    for (int i = 0; i < cur.children.size(); i++)
+    {
+        // Arguments of operations measured as a whole were never called:
+        if (mynodes[cur.children[i]].numcalls > 0 || depth == 0)
+            print(cur.children[i], depth+1);
+    }
+}
+
+void exprprofiler::enable(bool isenabled)
+{
+    isitenabled = isenabled;
+}
+
+void exprprofiler::clear(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    mynodes = {exprprofilenode()};
+}
+
+void exprprofiler::instrument(std::vector<std::shared_ptr<operation>>& ops, std::vector<std::string> names)
+{
+    std::unordered_map<operation*, std::shared_ptr<operation>> instrumented = {};
+
+    for (int i = 0; i < ops.size(); i++)
+        ops[i] = instrument(ops[i], getnode(0, names[i]), instrumented);
+}
+
+void exprprofiler::add(int node, double time, long long int numbytes)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    // The node might have been removed by a 'clear' call:
+    if (node >= mynodes.size())
+        return;
+
+    mynodes[node].numcalls++;
+    mynodes[node].time += time;
+    mynodes[node].numbytes += numbytes;
+}
+
+void exprprofiler::print(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    std::cout << "Expression profile (time, time excluding the arguments, number of calls, bytes requested):" << std::endl;
+    for (int i = 0; i < mynodes[0].children.size(); i++)
+        print(mynodes[0].children[i], 0);
+    
+    // Time, bytes and number of calls excluding the arguments for every operation type:
+    std::map<std::string, exprprofilenode> pertype;
+    for (int i = 1; i < mynodes.size(); i++)
+    {
+        exprprofilenode& cur = mynodes[i];
+        if (cur.numcalls == 0)
+            continue;
+        exprprofilenode& typenode = pertype[cur.type];
+        typenode.numcalls += cur.numcalls;
+        typenode.time += cur.time;
+        typenode.numbytes += cur.numbytes;
+        for (int c = 0; c < cur.children.size(); c++)
+        {
+            typenode.time -= mynodes[cur.children[c]].time;
+            typenode.numbytes -= mynodes[cur.children[c]].numbytes;
+        }
+    }
+    
+    std::cout << std::endl << "Per operation type (excluding the arguments):" << std::endl;
+    for (std::map<std::string, exprprofilenode>::iterator it = pertype.begin(); it != pertype.end(); ++it)
+        std::cout << "    " << it->first << ": " << timetostring(std::max(0.0, it->second.time)) << ", " << it->second.numcalls << " calls, " << memoryusage::tostring(std::max(0LL, it->second.numbytes)) << std::endl;
+}
+
+std::string exprprofiler::tostring(std::shared_ptr<operation> op)
+{
+    std::ostringstream printed;
+    op->print(printed);
+
+    return printed.str();
+}
@@ -0,0 +1,93 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object measures the time spent and the bytes requested from the memory pool in the
+// 'interpolate' and 'multiharmonicinterpolate' calls of every operation of the expression trees
+// evaluated by 'formulation::generate' (one tree per integral term), 'expression::integrate'
+// and 'expression::write'. It is disabled by default.
+//
+// When enabled the evaluated trees are replaced by copies in which every operation is wrapped
+// in an 'opprofile' operation. The values are accumulated over all calls and threads until the
+// profiler is cleared. The times and bytes of an operation include those of its arguments.
+// Operations that cannot replace their arguments are measured as a whole.
+
+#ifndef EXPRPROFILER_H
+#define EXPRPROFILER_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdio>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <typeinfo>
+#include <map>
+#include "operation.h"
+
+class operation;
+
+// The measurements of an operation (or of a whole tree for the top level nodes):
+class exprprofilenode
+{
+    public:
+
+        std::string name = "";
+        // Operation type (e.g. 'opsum'):
+        std::string type = "";
+        int parent = -1;
+        std::vector<int> children = {};
+
+        long long int numcalls = 0;
+        double time = 0;
+        long long int numbytes = 0;
+};
+
+class exprprofiler
+{
+    private:
+
+        static bool isitenabled;
+
+        static std::mutex mymutex;
+
+        // Node 0 is the root. The evaluated trees are its children:
+        static std::vector<exprprofilenode> mynodes;
+
+        // Get the child of 'parent' with the given name (it is created if needed):
+        static int getnode(int parent, std::string name, std::string type = "");
+
+        // The already instrumented operations are reused so that shared subtrees stay shared:
+        static std::shared_ptr<operation> instrument(std::shared_ptr<operation> op, int parent, std::unordered_map<operation*, std::shared_ptr<operation>>& instrumented);
+
+        static void print(int node, int depth);
+
+    public:
+
+        // Disabling the profiler does not clear the measurements:
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+
+        static void clear(void);
+
+        // Replace the operations by profiled copies. Operation 'i' is reported under name 'names[i]':
+        static void instrument(std::vector<std::shared_ptr<operation>>& ops, std::vector<std::string> names);
+
+        // Add a call of 'time' nanoseconds that requested 'numbytes' bytes to a node.
+        // This can be called by multiple threads at the same time.
+        static void add(int node, double time, long long int numbytes);
+
+        // Print the measurements as a tree (the time spent in the operation itself is also given)
+        // followed by the time spent in each operation type (excluding the arguments):
+        static void print(void);
+
+        // Get the text printed by 'operation::print':
+        static std::string tostring(std::shared_ptr<operation> op);
+
+};
+
+#endif
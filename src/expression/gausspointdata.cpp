@@ -0,0 +1,33 @@
+#include "gausspointdata.h"
+
+
+gausspointdata::gausspointdata(int numrows, int numcols, double initvalue)
+{
+    if (universe::getsession()->myrawmesh == NULL)
+    {
+        std::cout << "Error in 'gausspointdata' object: cannot define a Gauss point data before the mesh is loaded" << std::endl;
+        abort();
+    }
+    
+    rawgpdataptr = std::shared_ptr<rawgausspointdata>(new rawgausspointdata(numrows, numcols, initvalue));
+}
+
+int gausspointdata::countrows(void)
+{
+    return rawgpdataptr->countrows();
+}
+
+int gausspointdata::countcolumns(void)
+{
+    return rawgpdataptr->countcolumns();
+}
+
+void gausspointdata::setvalue(int physreg, expression input, int integrationorder, std::string rulefamily)
+{
+    rawgpdataptr->setvalue(physreg, input, integrationorder, rulefamily);
+}
+
+void gausspointdata::print(void)
+{
+    rawgpdataptr->print();
+}
@@ -0,0 +1,51 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+//
+// This object stores values at the Gauss points of the elements, e.g. the state variables of plasticity or
+// hysteresis models. The values are computed directly at the Gauss points by 'setvalue', without any projection
+// on a field. The object converts to an expression that can be used in the integrals of a formulation, which
+// must then be integrated at the same Gauss points (i.e. at the integration order given to 'setvalue').
+// Before any value is set the expression is equal to the initial value everywhere. Copies share the values.
+
+
+#ifndef GAUSSPOINTDATA_H
+#define GAUSSPOINTDATA_H
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include "universe.h"
+#include "rawgausspointdata.h"
+#include "expression.h"
+
+class expression;
+
+class gausspointdata
+{
+
+    private:
+
+        std::shared_ptr<rawgausspointdata> rawgpdataptr = NULL;
+    
+    public:
+
+        gausspointdata(int numrows = 1, int numcols = 1, double initvalue = 0.0);
+
+        int countrows(void);
+        int countcolumns(void);
+        
+        // Evaluate 'input' (of the same size) at the Gauss points of the elements in the physical region for the
+        // given integration order. The values on the other elements are unchanged. Setting values at another
+        // integration order or rule family (or after a mesh change) drops all values previously set. With the "auto" rule
+        // family the Gauss points are those of the formulation integrals with the default "auto" quadrature rule:
+        void setvalue(int physreg, expression input, int integrationorder, std::string rulefamily = "auto");
+        
+        std::shared_ptr<rawgausspointdata> getpointer(void) { return rawgpdataptr; };
+        
+        void print(void);
+
+};
+
+#endif
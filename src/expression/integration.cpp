@@ -55,6 +55,16 @@ integration::integration(int physreg, int numcoefharms, expression meshdeform, e
     mynumcoefharms = numcoefharms;
 }
 
+void integration::setquadraturerule(std::string rule)
+{
+    if (rule != "default" && rule != "collapsed" && rule != "auto")
+    {
+        std::cout << "Error in 'integration' object: unknown quadrature rule '" << rule << "' (use 'default', 'collapsed' or 'auto')" << std::endl;
+        abort();
+    }
+    myquadraturerule = rule;
+}
+
 expression integration::getexpression(void) 
 { 
     return myexpression[0]; 
@@ -79,7 +89,11 @@ void integration::print(void)
         std::cout << std::endl;
     }
     std::cout << "Contribution is added to block " << myblocknumber << std::endl;
-    if (mynumcoefharms >= 0)
+    if (myquadraturerule != "default")
+        std::cout << "Integration rule is '" << myquadraturerule << "'" << std::endl;
+    if (mynumcoefharms == 0)
+        std::cout << "An FFT is performed on the coef using an automatic number of time computations" << std::endl;
+    if (mynumcoefharms > 0)
         std::cout << "An FFT is performed on the coef using " << mynumcoefharms << " time computations" << std::endl;
 }
 
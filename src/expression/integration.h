@@ -27,6 +27,8 @@ class integration
         int myintegrationorderdelta;
         
         int mynumcoefharms = -1;
+        
+        std::string myquadraturerule = "default";
 
     public:
         
@@ -57,7 +59,14 @@ class integration
         int getintegrationorderdelta(void) { return myintegrationorderdelta; };
         int getblocknumber(void) { return myblocknumber; };
         
-        bool isfftrequested(void) { return (mynumcoefharms > 0); };
+        // Select the integration rule family: "default" (tabulated Gauss rules at the dof + tf + 2 + delta order),
+        // "collapsed" (Gauss-Jacobi rules on the collapsed element, defined at any order) or "auto". The latter
+        // takes the degree of polynomial coefficients into account on straight simplices and uses the family
+        // with the fewest points for the resulting order (it falls back to the default order otherwise):
+        void setquadraturerule(std::string rule);
+        std::string getquadraturerule(void) { return myquadraturerule; };
+        
+        bool isfftrequested(void) { return (mynumcoefharms >= 0); };
         int getnumberofcoefharms(void) { return mynumcoefharms; };
         
         void print(void);
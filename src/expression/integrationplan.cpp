@@ -0,0 +1,233 @@
+#include "integrationplan.h"
+#include "gausspoints.h"
+#include "taskscheduler.h"
+#include "slmpi.h"
+
+
+// Maximum number of elements in a block (smaller blocks balance the threads):
+static const int maxnumelemsperblock = 2000;
+
+integrationplan::integrationplan(int physreg, int integrationorder)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    myphysreg = physreg;
+    myintegrationorder = integrationorder;
+    
+    update();
+}
+
+integrationplan::integrationplan(int physreg, expression meshdeform, int integrationorder)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    int problemdimension = universe::getrawmesh()->getmeshdimension();
+    if (meshdeform.countcolumns() != 1 || meshdeform.countrows() < problemdimension)
+    {
+        std::cout << "Error in 'integrationplan' object: mesh deformation expression has size " << meshdeform.countrows() << "x" << meshdeform.countcolumns() << " (expected " << problemdimension << "x1)" << std::endl;
+        abort();
+    }
+    
+    myphysreg = physreg;
+    myintegrationorder = integrationorder;
+    mymeshdeform = {meshdeform};
+    
+    update();
+}
+
+long long int integrationplan::getmeshdeformstate(void)
+{
+    long long int output = -1;
+    if (mymeshdeform.size() == 1)
+    {
+        for (int i = 0; i < mymeshdeform[0].countrows(); i++)
+            output = std::max(output, mymeshdeform[0].getoperationinarray(i, 0)->getstate());
+    }
+    return output;
+}
+
+void integrationplan::update(void)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    long long int meshdeformstate = getmeshdeformstate();
+
+    if (myrawmesh.lock() == rm && rm->getmeshnumber() == mymeshnumber && rm->getstate() == mymeshstate && meshdeformstate <= mymeshdeformstate)
+        return;
+
+    myrawmesh = rm;
+    mymeshnumber = rm->getmeshnumber();
+    mymeshstate = rm->getstate();
+    mymeshdeformstate = meshdeformstate;
+    
+    expression* meshdeformptr = (mymeshdeform.size() == 1 ? &(mymeshdeform[0]) : NULL);
+    
+    mydisjregs = {}; myevaluationpoints = {}; myweights = {};
+    myblockgroups = {}; myselectors = {}; myjacobians = {}; mydetjacs = {};
+
+    std::vector<int> selecteddisjregs = rm->getphysicalregions()->get(myphysreg)->getdisjointregions();
+    
+    if (meshdeformptr != NULL && not(meshdeformptr->isharmonicone(selecteddisjregs)))
+    {
+        std::cout << "Error in 'integrationplan' object: the mesh deformation expression cannot be multiharmonic (only constant harmonic 1)" << std::endl;
+        abort();
+    }
+    
+    // Send the disjoint regions with same element type numbers together:
+    disjointregionselector mydisjregselector(selecteddisjregs, {});
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+    {
+        std::vector<int> curdisjregs = mydisjregselector.getgroup(i);
+        int elementtypenumber = rm->getdisjointregions()->getelementtypenumber(curdisjregs[0]);
+        
+        gausspoints mygausspoints(elementtypenumber, myintegrationorder);
+        
+        mydisjregs.push_back(curdisjregs);
+        myevaluationpoints.push_back(mygausspoints.getcoordinates());
+        myweights.push_back(mygausspoints.getweights());
+        
+        // The blocks have a single total orientation so that any integrand can be evaluated on them:
+        elementselector myselector(curdisjregs, true);
+        do
+        {
+            std::vector<int> elementnumbers = myselector.getelementnumbers();
+            int numelems = elementnumbers.size();
+            int numblocks = (numelems+maxnumelemsperblock-1)/maxnumelemsperblock;
+            
+            for (int b = 0; b < numblocks; b++)
+            {
+                int blockbegin = (long long int)b*numelems/numblocks;
+                int blockend = (long long int)(b+1)*numelems/numblocks;
+                std::vector<int> blockelems(elementnumbers.begin()+blockbegin, elementnumbers.begin()+blockend);
+                
+                std::shared_ptr<elementselector> blockselector(new elementselector(curdisjregs, blockelems, true));
+                std::shared_ptr<jacobian> blockjacobian(new jacobian(*blockselector, myevaluationpoints.back(), meshdeformptr));
+                
+                densemat detjac = blockjacobian->getdetjac().copy();
+                // The Jacobian determinant should be positive irrespective of the node numbering:
+                detjac.abs();
+                
+                myblockgroups.push_back(i);
+                myselectors.push_back(blockselector);
+                myjacobians.push_back(blockjacobian);
+                mydetjacs.push_back(detjac);
+            }
+        }
+        while (myselector.next());
+    }
+}
+
+std::vector<double> integrationplan::integrate(std::vector<expression> integrands)
+{
+    if (myphysreg < 0)
+    {
+        std::cout << "Error in 'integrationplan' object: the integration plan is not defined" << std::endl;
+        abort();
+    }
+    
+    update();
+    
+    int numintegrands = integrands.size();
+    expression* meshdeformptr = (mymeshdeform.size() == 1 ? &(mymeshdeform[0]) : NULL);
+    
+    std::vector<int> selecteddisjregs = universe::getrawmesh()->getphysicalregions()->get(myphysreg)->getdisjointregions();
+    
+    std::vector<std::shared_ptr<operation>> ops(numintegrands);
+    bool isthreadsafe = (meshdeformptr == NULL);
+    for (int j = 0; j < numintegrands; j++)
+    {
+        if (not(integrands[j].isscalar()))
+        {
+            std::cout << "Error in 'integrationplan' object: cannot integrate a nonscalar expression" << std::endl;
+            abort();
+        }
+        if (not(integrands[j].isharmonicone(selecteddisjregs)))
+        {
+            std::cout << "Error in 'integrationplan' object: cannot integrate a multiharmonic expression (only constant harmonic 1)" << std::endl;
+            abort();
+        }
+        ops[j] = integrands[j].getoperationinarray(0, 0);
+        
+        for (int i = 0; i < mydisjregs.size(); i++)
+            isthreadsafe = (isthreadsafe && ops[j]->isthreadsafe(mydisjregs[i]));
+    }
+    
+    universe::allowestimatorupdate(true);
+    
+    int numblocks = myselectors.size();
+    // blockvalues[b*numintegrands+j] is the integral of integrand j on block b:
+    std::vector<double> blockvalues(numblocks*numintegrands, 0.0);
+    
+    auto integrateblock = [&](int b)
+    {
+        int g = myblockgroups[b];
+        
+        // Evaluate in a dedicated context so that the reuse storage of the other threads is untouched:
+        evaluationcontext mycontext;
+        evaluationcontext* previouscontext = universe::setcontext(&mycontext);
+        mycontext.computedjacobian = myjacobians[b];
+        mycontext.allowreuse();
+        
+        densemat weightsmat(myweights[g].size(), 1, myweights[g]);
+        for (int j = 0; j < numintegrands; j++)
+        {
+            densemat vals = ops[j]->interpolate(*myselectors[b], myevaluationpoints[g], meshdeformptr)[1][0];
+            vals.multiplyelementwise(mydetjacs[b]);
+            blockvalues[b*numintegrands+j] = vals.multiply(weightsmat).sum();
+        }
+        
+        universe::forbidreuse();
+        universe::setcontext(previouscontext);
+    };
+    
+    int numthreadstouse = 1;
+    if (isthreadsafe && universe::ismultithreadedassemblyallowed)
+        numthreadstouse = universe::getmaxnumthreads();
+    
+    if (numthreadstouse > 1 && numblocks > 1)
+        taskscheduler::run(numblocks, integrateblock, true, numthreadstouse);
+    else
+    {
+        for (int b = 0; b < numblocks; b++)
+            integrateblock(b);
+    }
+    
+    universe::allowestimatorupdate(false);
+    
+    // Sum in the block order for a result independent of the thread scheduling:
+    std::vector<double> output(numintegrands, 0.0);
+    if (universe::isreductionreproducible)
+    {
+        for (int j = 0; j < numintegrands; j++)
+            output[j] = gentools::compensatedsum(blockvalues.data()+j, numblocks, numintegrands);
+    }
+    else
+    {
+        for (int b = 0; b < numblocks; b++)
+        {
+            for (int j = 0; j < numintegrands; j++)
+                output[j] += blockvalues[b*numintegrands+j];
+        }
+    }
+    
+    return output;
+}
+
+double integrationplan::integrate(expression integrand)
+{
+    return integrate(std::vector<expression>{integrand})[0];
+}
+
+std::vector<double> integrationplan::allintegrate(std::vector<expression> integrands)
+{
+    std::vector<double> output = integrate(integrands);
+    
+    if (slmpi::count() > 1)
+        slmpi::sum(output);
+    
+    return output;
+}
+
+double integrationplan::allintegrate(expression integrand)
+{
+    return allintegrate(std::vector<expression>{integrand})[0];
+}
@@ -0,0 +1,77 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object integrates expressions many times on the same physical region (e.g. forces, fluxes
+// and energies at every time step). The Gauss points, element blocks and Jacobians are computed once
+// and kept. Each call then evaluates all integrands in a single multithreaded pass over the blocks. The
+// geometry is recomputed automatically when the mesh or the mesh deformation has changed.
+
+
+#ifndef INTEGRATIONPLAN_H
+#define INTEGRATIONPLAN_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "expression.h"
+#include "rawmesh.h"
+#include "jacobian.h"
+#include "elementselector.h"
+#include "disjointregionselector.h"
+
+class expression;
+class rawmesh;
+class jacobian;
+class elementselector;
+
+class integrationplan
+{
+
+    private:
+
+        int myphysreg = -1;
+        int myintegrationorder = -1;
+        std::vector<expression> mymeshdeform = {};
+
+        // Mesh (and mesh deformation state) on which the geometry was computed:
+        std::weak_ptr<rawmesh> myrawmesh;
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+        long long int mymeshdeformstate = -1;
+
+        // Gauss points and weights of every disjoint region group:
+        std::vector<std::vector<int>> mydisjregs = {};
+        std::vector<std::vector<double>> myevaluationpoints = {};
+        std::vector<std::vector<double>> myweights = {};
+
+        // Element blocks of a single total orientation with their group index, Jacobian and |detjac| (elements x Gauss points):
+        std::vector<int> myblockgroups = {};
+        std::vector<std::shared_ptr<elementselector>> myselectors = {};
+        std::vector<std::shared_ptr<jacobian>> myjacobians = {};
+        std::vector<densemat> mydetjacs = {};
+
+        // Get the state of the last modification of the mesh deformation (-1 if none):
+        long long int getmeshdeformstate(void);
+        // Compute the geometry if not yet done on the current mesh:
+        void update(void);
+
+    public:
+
+        integrationplan(void) {};
+        // The integration is done on the highest dimension elements of the physical region:
+        integrationplan(int physreg, int integrationorder);
+        integrationplan(int physreg, expression meshdeform, int integrationorder);
+
+        // Integrate all scalar expressions in a single pass:
+        std::vector<double> integrate(std::vector<expression> integrands);
+        double integrate(expression integrand);
+
+        // Same but summed over all ranks (the DDM must be without overlap):
+        std::vector<double> allintegrate(std::vector<expression> integrands);
+        double allintegrate(expression integrand);
+
+};
+
+#endif
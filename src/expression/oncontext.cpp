@@ -1,12 +1,13 @@
 #include "oncontext.h"
 
 
-oncontext::oncontext(int physreg, expression* coordshift, bool errorifnotfound)    
+oncontext::oncontext(int physreg, expression* coordshift, bool errorifnotfound, std::shared_ptr<rawslidinginterface> sliding)    
 {
     myisdefined = true;
 
     myphysreg = physreg;
     myerrorifnotfound = errorifnotfound;
+    mysliding = sliding;
     if (coordshift == NULL)
         mycoordshift = {};
     else
@@ -50,6 +51,9 @@ bool oncontext::isequal(oncontext* tocompare)
         
     if (myerrorifnotfound != tocompare->myerrorifnotfound)
         isitequal = false;
+        
+    if (mysliding != tocompare->mysliding)
+        isitequal = false;
     
     // Compare the coordinate shift expressions:
     if (mycoordshift.size() != tocompare->mycoordshift.size())
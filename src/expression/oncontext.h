@@ -11,6 +11,7 @@
 #include <vector>
 #include <string>
 #include "expression.h"
+#include "rawslidinginterface.h"
 
 class oncontext
 {
@@ -23,11 +24,13 @@ class oncontext
         bool myerrorifnotfound = true;
         // Empty if not shifted:
         std::vector<expression> mycoordshift = {};
+        // NULL if the point search is used:
+        std::shared_ptr<rawslidinginterface> mysliding = NULL;
     
     public:
 
         oncontext(void) {};
-        oncontext(int physreg, expression* coordshift, bool errorifnotfound);            
+        oncontext(int physreg, expression* coordshift, bool errorifnotfound, std::shared_ptr<rawslidinginterface> sliding = NULL);            
 
         bool isdefined(void);
 
@@ -36,6 +39,7 @@ class oncontext
         bool isshifted(void);
         expression* getshift(void);
         bool iserrorifnotfound(void);
+        std::shared_ptr<rawslidinginterface> getslidinginterface(void) { return mysliding; };
         
         // Compare two oncontexes:
         bool isequal(oncontext* tocompare);
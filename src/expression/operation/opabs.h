@@ -25,16 +25,18 @@ class opabs: public operation
         densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
 
         std::vector<std::shared_ptr<operation>> getarguments(void) { return {myarg}; };
+        void replaceargument(int argnum, std::shared_ptr<operation> newarg) { myarg = newarg; };
         std::shared_ptr<operation> simplify(std::vector<int> disjregs);
         
         std::shared_ptr<operation> copy(void);
         
         void reuseit(bool istobereused) { reuse = istobereused; };
+        bool isreused(void) { return reuse; };
         
         double evaluate(void);
         std::vector<double> evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords);
 
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
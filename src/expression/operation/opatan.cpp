@@ -4,7 +4,7 @@
 std::vector<std::vector<densemat>> opatan::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -16,7 +16,7 @@ std::vector<std::vector<densemat>> opatan::interpolate(elementselector& elemsele
     {
         argmat[1][0].atan();
         
-        if (reuse && universe::isreuseallowed)
+        if (reuse && universe::getcontext()->isreuseallowed)
             universe::setprecomputed(shared_from_this(), argmat);
         
         return argmat;
@@ -29,7 +29,7 @@ std::vector<std::vector<densemat>> opatan::interpolate(elementselector& elemsele
 densemat opatan::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -38,7 +38,7 @@ densemat opatan::multiharmonicinterpolate(int numtimeevals, elementselector& ele
     densemat output = myarg->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform);
     output.atan();
             
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
@@ -75,9 +75,9 @@ std::vector<double> opatan::evaluate(std::vector<double>& xcoords, std::vector<d
     return evaluated;
 }
 
-void opatan::print(void)
+void opatan::print(std::ostream& out)
 {
-    std::cout << "atan(";
-    myarg->print();
-    std::cout << ")";
+    out << "atan(";
+    myarg->print(out);
+    out << ")";
 }
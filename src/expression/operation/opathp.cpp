@@ -12,13 +12,13 @@ opathp::opathp(std::shared_ptr<operation> arg, std::shared_ptr<rawmesh> rm, std:
 std::vector<std::vector<densemat>> opathp::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {   
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
     }
 
-    bool wasreuseallowed = universe::isreuseallowed;
+    bool wasreuseallowed = universe::getcontext()->isreuseallowed;
     // Because of the 'gethff' call in interpolate:
     universe::forbidreuse();
                 
@@ -73,7 +73,7 @@ std::vector<std::vector<densemat>> opathp::interpolate(elementselector& elemsele
 
     ///// Bring the evaluation points to the ptracker here.
     //
-    // universe::myrawmesh ---- h ----> MYRAWMESH ---- p ----> MYPTRACKER
+    // universe::getsession()->myrawmesh ---- h ----> MYRAWMESH ---- p ----> MYPTRACKER
     
     if (myrawmesh->getptracker() != myptracker)
     {
@@ -96,7 +96,7 @@ std::vector<std::vector<densemat>> opathp::interpolate(elementselector& elemsele
     double* argmatptr = argmat.getvalues();
     
     std::shared_ptr<rawmesh> bkp = universe::getrawmesh();
-    universe::myrawmesh = myrawmesh->getattarget(myptracker);
+    universe::getsession()->myrawmesh = myrawmesh->getattarget(myptracker);
     
     for (int i = 0; i < 8; i++)
     {
@@ -140,21 +140,21 @@ std::vector<std::vector<densemat>> opathp::interpolate(elementselector& elemsele
             while (myselector.next());  
         }
     }
-    universe::myrawmesh = bkp;
+    universe::getsession()->myrawmesh = bkp;
     
     if (wasreuseallowed)
         universe::allowreuse();
     
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), {{}, {argmat}});
     
     return {{}, {argmat}};
 }
 
-void opathp::print(void)
+void opathp::print(std::ostream& out)
 {
-    std::cout << "athp(";
-    myarg->print();
-    std::cout << ")";
+    out << "athp(";
+    myarg->print(out);
+    out << ")";
 }
 
@@ -29,8 +29,10 @@ class opathp: public operation
         std::vector<std::shared_ptr<operation>> getarguments(void) { return {myarg}; };
         
         bool isvalueorientationdependent(std::vector<int> disjregs) { return false; };
+        // The mesh in the universe is temporarily replaced during the interpolation:
+        bool isthreadsafe(std::vector<int> disjregs) { return false; };
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
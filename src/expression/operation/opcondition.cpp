@@ -11,7 +11,7 @@ opcondition::opcondition(std::shared_ptr<operation> condarg, std::shared_ptr<ope
 std::vector<std::vector<densemat>> opcondition::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -33,7 +33,7 @@ std::vector<std::vector<densemat>> opcondition::interpolate(elementselector& ele
                 trueval[i] = falseval[i]; 
         }
         
-        if (reuse && universe::isreuseallowed)
+        if (reuse && universe::getcontext()->isreuseallowed)
             universe::setprecomputed(shared_from_this(), trueargmat);
         
         return trueargmat;
@@ -46,7 +46,7 @@ std::vector<std::vector<densemat>> opcondition::interpolate(elementselector& ele
 densemat opcondition::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -66,7 +66,7 @@ densemat opcondition::multiharmonicinterpolate(int numtimeevals, elementselector
             trueval[i] = falseval[i]; 
     }
             
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), trueargmat);
     
     return trueargmat;
@@ -115,13 +115,13 @@ std::vector<double> opcondition::evaluate(std::vector<double>& xcoords, std::vec
     return evaldtrue;
 }
 
-void opcondition::print(void)
+void opcondition::print(std::ostream& out)
 {
-    std::cout << "(";
-    mycond->print();
-    std::cout << " ? ";
-    mytrue->print();
-    std::cout << ", ";
-    myfalse->print();
-    std::cout << ")";
+    out << "(";
+    mycond->print(out);
+    out << " ? ";
+    mytrue->print(out);
+    out << ", ";
+    myfalse->print(out);
+    out << ")";
 }
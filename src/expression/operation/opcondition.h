@@ -36,7 +36,7 @@ class opcondition: public operation
         double evaluate(void);
         std::vector<double> evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords);
 
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
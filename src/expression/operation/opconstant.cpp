@@ -35,4 +35,4 @@ std::vector<double> opconstant::evaluate(std::vector<double>& xcoords, std::vect
     return evaluated;
 }
 
-void opconstant::print(void) { std::cout << constantvalue; }
+void opconstant::print(std::ostream& out) { out << constantvalue; }
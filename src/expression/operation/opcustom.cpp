@@ -15,11 +15,79 @@ opcustom::opcustom(int outindex, std::vector<densemat> fct(std::vector<densemat>
     myadvancedfunction = fct;
     myfields = infields;
 }
+
+opcustom::opcustom(int outindex, void fct(double**, double**, long long int, int, int, int, int), std::vector<std::shared_ptr<operation>> args)
+{
+    myoutindex = outindex;
+    myargs = args;
+    mybatchedfunction = fct;
+}
+
+std::vector<densemat> opcustom::callfunction(std::vector<densemat>& fctargs, int numrows, int numcols, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    std::vector<densemat> output;
+    
+    if (myfunction != NULL)
+    {
+        // Safe call to custom function in its own evaluation context:
+        evaluationcontext customcontext;
+        evaluationcontext* previouscontext = universe::setcontext(&customcontext);
+        universe::forbidreuse();
+        output = myfunction(fctargs);
+        universe::forbidreuse();
+        
+        universe::setcontext(previouscontext);
+    }
+    if (myadvancedfunction != NULL)
+        output = myadvancedfunction(fctargs, myfields, elemselect, evaluationcoordinates, meshdeform);
+    if (mybatchedfunction != NULL)
+    {
+        output = std::vector<densemat>(myfamily.size());
+        std::vector<double*> inptrs(fctargs.size()), outptrs(myfamily.size());
+        for (int i = 0; i < fctargs.size(); i++)
+        {
+            if (fctargs[i].countrows() != numrows || fctargs[i].countcolumns() != numcols)
+            {
+                std::cout << "Error in 'opcustom' object: argument " << i << " of the batched custom function is a " << fctargs[i].countrows() << "x" << fctargs[i].countcolumns() << " densemat (expected " << numrows << "x" << numcols << ")" << std::endl;
+                abort();
+            }
+            inptrs[i] = fctargs[i].getvalues();
+        }
+        for (int i = 0; i < myfamily.size(); i++)
+        {
+            output[i] = densemat(numrows, numcols);
+            outptrs[i] = output[i].getvalues();
+        }
+        
+        int numthreadstouse = 1;
+        if (universe::isinthreadedloop == false)
+            numthreadstouse = std::min((int)((long long int)numrows*numcols/minnumvaluesperthread)+1, std::min(numrows, universe::getmaxnumthreads())); // require a min num values per thread
+        
+        if (numthreadstouse <= 1)
+            mybatchedfunction(inptrs.data(), outptrs.data(), numcols, 0, numrows, 0, numcols);
+        else
+        {
+            // Each thread computes a range of rows:
+            auto computerange = [&](int t)
+            {
+                mybatchedfunction(inptrs.data(), outptrs.data(), numcols, (long long int)t*numrows/numthreadstouse, (long long int)(t+1)*numrows/numthreadstouse, 0, numcols);
+            };
+            std::vector<std::thread> threadobjs(numthreadstouse-1);
+            for (int t = 1; t < numthreadstouse; t++)
+                threadobjs[t-1] = universe::newthread(computerange, t);
+            computerange(0);
+            for (int t = 1; t < numthreadstouse; t++)
+                threadobjs[t-1].join();
+        }
+    }
+    
+    return output;
+}
         
 std::vector<std::vector<densemat>> opcustom::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -40,22 +108,7 @@ std::vector<std::vector<densemat>> opcustom::interpolate(elementselector& elemse
         fctargs[i] = argmat[1][0];
     }
     
-    std::vector<densemat> output;
-    if (myfunction != NULL)
-    {
-        bool wasreuseallowed = universe::isreuseallowed;
-        auto storage = universe::backup();
-        // Safe call to custom function:
-        universe::forbidreuse();
-        output = myfunction(fctargs);
-        universe::forbidreuse();
-        
-        universe::restore(storage);
-        if (wasreuseallowed)
-            universe::allowreuse();
-    }
-    else
-        output = myadvancedfunction(fctargs, myfields, elemselect, evaluationcoordinates, meshdeform);
+    std::vector<densemat> output = callfunction(fctargs, numels, numevalpts, elemselect, evaluationcoordinates, meshdeform);
     
     // Make sure the user provided function returns something valid:
     if (output.size() != myfamily.size())
@@ -77,7 +130,7 @@ std::vector<std::vector<densemat>> opcustom::interpolate(elementselector& elemse
         }
     }
     
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         for (int i = 0; i < myfamily.size(); i++)
         {
@@ -92,7 +145,7 @@ std::vector<std::vector<densemat>> opcustom::interpolate(elementselector& elemse
 densemat opcustom::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -105,22 +158,7 @@ densemat opcustom::multiharmonicinterpolate(int numtimeevals, elementselector& e
     for (int i = 0; i < myargs.size(); i++)
         fctargs[i] = myargs[i]->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform);
     
-    std::vector<densemat> output;
-    if (myfunction != NULL)
-    {
-        bool wasreuseallowed = universe::isreuseallowed;
-        auto storage = universe::backup();
-        // Safe call to custom function:
-        universe::forbidreuse();
-        output = myfunction(fctargs);
-        universe::forbidreuse();
-        
-        universe::restore(storage);
-        if (wasreuseallowed)
-            universe::allowreuse();
-    }
-    else
-        output = myadvancedfunction(fctargs, myfields, elemselect, evaluationcoordinates, meshdeform);
+    std::vector<densemat> output = callfunction(fctargs, numtimeevals, numels*numevalpts, elemselect, evaluationcoordinates, meshdeform);
     
     // Make sure the user provided function returns something valid:
     if (output.size() != myfamily.size())
@@ -142,7 +180,7 @@ densemat opcustom::multiharmonicinterpolate(int numtimeevals, elementselector& e
         }
     }
     
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         for (int i = 0; i < myfamily.size(); i++)
         {
@@ -162,18 +200,25 @@ std::shared_ptr<operation> opcustom::simplify(std::vector<int> disjregs)
     return shared_from_this();
 }
 
+long long int opcustom::getstate(void)
+{
+    return universe::getnewstate();
+}
+
 std::shared_ptr<operation> opcustom::copy(void)
 {
     std::shared_ptr<opcustom> op;
     if (myfunction != NULL)
         op = std::shared_ptr<opcustom>(new opcustom(myoutindex, myfunction, myargs));
-    else
+    if (myadvancedfunction != NULL)
         op = std::shared_ptr<opcustom>(new opcustom(myoutindex, myadvancedfunction, myargs, myfields));
+    if (mybatchedfunction != NULL)
+        op = std::shared_ptr<opcustom>(new opcustom(myoutindex, mybatchedfunction, myargs));
     *op = *this;
     return op;
 }
 
-void opcustom::print(void)
+void opcustom::print(std::ostream& out)
 {
-    std::cout << "custom";
+    out << "custom";
 }
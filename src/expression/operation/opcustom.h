@@ -8,6 +8,7 @@
 #define OPCUSTOM_H
 
 #include "operation.h"
+#include <thread>
 
 class opcustom: public operation
 {
@@ -25,11 +26,20 @@ class opcustom: public operation
         
         std::vector<densemat> (*myfunction)(std::vector<densemat>) = NULL;
         std::vector<densemat> (*myadvancedfunction)(std::vector<densemat>, std::vector<field>, elementselector&, std::vector<double>&, expression*) = NULL;
+        // Thread-safe function working on raw value ranges:
+        void (*mybatchedfunction)(double**, double**, long long int, int, int, int, int) = NULL;
+        
+        // Minimum number of values computed by each thread calling the batched function:
+        static const long long int minnumvaluesperthread = 20000;
+        
+        // Call the function chosen at construction on the arguments (all outputs of the family are returned):
+        std::vector<densemat> callfunction(std::vector<densemat>& fctargs, int numrows, int numcols, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
         
     public:
         
         opcustom(int outindex, std::vector<densemat> fct(std::vector<densemat>), std::vector<std::shared_ptr<operation>> args);
         opcustom(int outindex, std::vector<densemat> fct(std::vector<densemat>, std::vector<field>, elementselector&, std::vector<double>&, expression*), std::vector<std::shared_ptr<operation>> args, std::vector<field> infields);
+        opcustom(int outindex, void fct(double**, double**, long long int, int, int, int, int), std::vector<std::shared_ptr<operation>> args);
         
         // Provide all related operations:
         void setfamily(std::vector<std::weak_ptr<opcustom>> ops) { myfamily = ops; };
@@ -40,9 +50,15 @@ class opcustom: public operation
         std::vector<std::shared_ptr<operation>> getarguments(void) { return myargs; };
         std::shared_ptr<operation> simplify(std::vector<int> disjregs);
         
+        // Nothing is known about the user function except for the batched one:
+        bool isthreadsafe(std::vector<int> disjregs) { return (mybatchedfunction != NULL && operation::isthreadsafe(disjregs)); };
+        
+        // The custom function is not tracked:
+        long long int getstate(void);
+        
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
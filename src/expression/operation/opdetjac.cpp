@@ -5,13 +5,13 @@ std::vector<std::vector<densemat>> opdetjac::interpolate(elementselector& elemse
 {
     // Compute the Jacobian terms or reuse if available in the universe.
     std::shared_ptr<jacobian> myjac;
-    if (universe::isreuseallowed && universe::computedjacobian != NULL)
-        myjac = universe::computedjacobian;
+    if (universe::getcontext()->isreuseallowed && universe::getcontext()->computedjacobian != NULL)
+        myjac = universe::getcontext()->computedjacobian;
     else
         myjac = std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
     
-    if (universe::isreuseallowed)
-        universe::computedjacobian = myjac;
+    if (universe::getcontext()->isreuseallowed)
+        universe::getcontext()->computedjacobian = myjac;
     
     // The detjac is on the cos0 harmonic:
     return {{},{myjac->getdetjac().copy()}};
@@ -21,13 +21,13 @@ densemat opdetjac::multiharmonicinterpolate(int numtimeevals, elementselector& e
 {
     // Compute the Jacobian terms or reuse if available in the universe.
     std::shared_ptr<jacobian> myjac;
-    if (universe::isreuseallowed && universe::computedjacobian != NULL)
-        myjac = universe::computedjacobian;
+    if (universe::getcontext()->isreuseallowed && universe::getcontext()->computedjacobian != NULL)
+        myjac = universe::getcontext()->computedjacobian;
     else
         myjac = std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
     
-    if (universe::isreuseallowed)
-        universe::computedjacobian = myjac;
+    if (universe::getcontext()->isreuseallowed)
+        universe::getcontext()->computedjacobian = myjac;
     
     densemat computeddetjac = (myjac->getdetjac().copy());
     
@@ -42,7 +42,7 @@ std::shared_ptr<operation> opdetjac::copy(void)
     return op;
 }
 
-void opdetjac::print(void) { std::cout << "detjac"; }
+void opdetjac::print(std::ostream& out) { out << "detjac"; }
 
 
 
@@ -21,7 +21,7 @@ class opdetjac: public operation
 
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
         
 };
 
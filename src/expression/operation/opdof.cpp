@@ -51,32 +51,32 @@ std::shared_ptr<operation> opdof::copy(void)
     return op;
 }
 
-void opdof::print(void)
+void opdof::print(std::ostream& out)
 {
     for (int i = 0; i < timederivativeorder; i++)
-        std::cout << "dt";
+        out << "dt";
 
     std::vector<std::string> nonedxdydz = {"","dx","dy","dz"};
     std::vector<std::string> nonedkidetadphi = {"","dki","deta","dphi"};
     std::vector<std::string> nonecompxcompycompz = {"compx","compy","compz"};
 
-    std::cout << nonedxdydz[spacederivative];
-    std::cout << nonedkidetadphi[kietaphiderivative];
+    out << nonedxdydz[spacederivative];
+    out << nonedkidetadphi[kietaphiderivative];
     // For fields without subfields:
     if (fieldcomponent == -1)
     {
         if (myfield->countformfunctioncomponents() > 1)
-            std::cout << nonecompxcompycompz[formfunctioncomponent];
+            out << nonecompxcompycompz[formfunctioncomponent];
     }
     else
-        std::cout << nonecompxcompycompz[fieldcomponent];
+        out << nonecompxcompycompz[fieldcomponent];
 
     if (ison())
-        std::cout << "ondof(" << myoncontext[0].getphysicalregion() << ", ";
+        out << "ondof(" << myoncontext[0].getphysicalregion() << ", ";
     else
-        std::cout << "dof(";
-    myfield->print();
-    std::cout << ")";
+        out << "dof(";
+    myfield->print(out);
+    out << ")";
 }
 
 
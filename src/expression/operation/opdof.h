@@ -64,7 +64,7 @@ class opdof: public operation
 
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
         
         
         // In case of dof interpolation:
@@ -5,7 +5,7 @@ std::vector<std::vector<densemat>> operation::interpolate(elementselector& elems
 {
     std::cout << "Error in 'operation' object: cannot interpolate the operation" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -14,7 +14,7 @@ densemat operation::multiharmonicinterpolate(int numtimeevals, elementselector&
 {
     std::cout << "Error in 'operation' object: cannot interpolate the multiharmonic operation" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -23,7 +23,7 @@ std::vector<std::vector<densemat>> operation::interpolate(int kietaphiderivative
 {
     std::cout << "Error in 'operation' object: expression provided for mesh deformation is invalid" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -82,7 +82,7 @@ std::shared_ptr<rawparameter> operation::getparameterpointer(void)
 {
     std::cout << "Error in 'operation' object: cannot get the rawparameter pointer" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -91,7 +91,7 @@ std::shared_ptr<rawport> operation::getportpointer(void)
 {
     std::cout << "Error in 'operation' object: cannot get the rawport pointer" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -100,7 +100,7 @@ std::shared_ptr<rawfield> operation::getfieldpointer(void)
 {
     std::cout << "Error in 'operation' object: cannot get the field pointer" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -109,7 +109,7 @@ bool operation::isreused(void)
 {
     std::cout << "Error in 'operation' object: cannot call 'isreused' on the operation" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -118,7 +118,7 @@ void operation::setspacederivative(int whichderivative)
 {
     std::cout << "Error in 'operation' object: either you are trying to apply a space derivative to something else than fields, dof() and tf() or the field does not allow this kind of space derivative" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }   
@@ -127,7 +127,7 @@ void operation::setkietaphiderivative(int whichderivative)
 {
     std::cout << "Error in 'operation' object: can only apply reference-element space derivatives to fields, dof() and tf()" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }   
@@ -136,7 +136,7 @@ void operation::increasetimederivativeorder(int derivativeorder)
 {
     std::cout << "Error in 'operation' object: can only apply time derivatives to ports, fields, dof() and tf()" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }   
@@ -156,11 +156,34 @@ bool operation::isvalueorientationdependent(std::vector<int> disjregs)
     return false;
 }
 
+bool operation::isthreadsafe(std::vector<int> disjregs)
+{
+    std::vector<std::shared_ptr<operation>> arguments = getarguments();
+    
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        if (arguments[i]->isthreadsafe(disjregs) == false)
+            return false;
+    }
+    return true;
+}
+
+long long int operation::getstate(void)
+{
+    std::vector<std::shared_ptr<operation>> arguments = getarguments();
+    
+    long long int output = 0;
+    for (int i = 0; i < arguments.size(); i++)
+        output = std::max(output, arguments[i]->getstate());
+        
+    return output;
+}
+
 std::shared_ptr<operation> operation::copy(void)
 {
     std::cout << "Error in 'operation' object: cannot copy the operation" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -169,7 +192,7 @@ double operation::evaluate(void)
 {
     std::cout << "Error in 'operation' object: cannot evaluate the operation" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
@@ -178,7 +201,7 @@ std::vector<double> operation::evaluate(std::vector<double>& xcoords, std::vecto
 {
     std::cout << "Error in 'operation' object: cannot evaluate the operation" << std::endl;
     std::cout << "Operation was:" << std::endl;
-    this->print();
+    this->print(std::cout);
     std::cout << std::endl;
     abort();
 }
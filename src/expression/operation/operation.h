@@ -37,8 +37,9 @@ class operation : public std::enable_shared_from_this<operation>
         
     public:
         
-        // Print the operation:
-        virtual void print(void) {};
+        // Print the operation to the standard output or to 'out':
+        void print(void) { print(std::cout); };
+        virtual void print(std::ostream& out) {};
         
         // Interpolate the operation on the evaluation coordinates. 
         // The returned value taken at [harm][0] gives the value of the 
@@ -132,6 +133,14 @@ class operation : public std::enable_shared_from_this<operation>
         // the disjoint regions, no matter their total orientation number:
         virtual bool isvalueorientationdependent(std::vector<int> disjregs);
         
+        // True if the operation can be interpolated on the disjoint 
+        // regions by multiple threads at the same time:
+        virtual bool isthreadsafe(std::vector<int> disjregs);
+        
+        // Get the state of the last modification of the data (field values, parameters, ...) this operation depends on.
+        // Operations that cannot be tracked return a new state so that they are always considered as modified:
+        virtual long long int getstate(void);
+        
         // Duplicate the operation (argument operations are not duplicated!):
         virtual std::shared_ptr<operation> copy(void);
 
@@ -170,6 +179,8 @@ class operation : public std::enable_shared_from_this<operation>
 #include "opestimator.h"
 #include "opfield.h"
 #include "opfieldorder.h"
+#include "opfused.h"
+#include "opgausspointdata.h"
 #include "opharmonic.h"
 #include "opinversion.h"
 #include "opinvjac.h"
@@ -183,6 +194,7 @@ class operation : public std::enable_shared_from_this<operation>
 #include "opport.h"
 #include "oppower.h"
 #include "opproduct.h"
+#include "opprofile.h"
 #include "opsin.h"
 #include "opspline.h"
 #include "opsum.h"
@@ -1,10 +1,15 @@
 #include "opestimator.h"
+#include "taskscheduler.h"
+#include "autotuning.h"
 
 
-opestimator::opestimator(std::string estimatortype, std::shared_ptr<operation> arg)
+static const int minnumelemsperthreadforestimator = 500;
+
+opestimator::opestimator(std::string estimatortype, std::shared_ptr<operation> arg, double incrementaltolerance)
 {
     mytype = estimatortype;
     myarg = arg;
+    myincrementaltolerance = incrementaltolerance;
     
     if (mytype == "zienkiewiczzhu")
     {
@@ -24,13 +29,13 @@ std::vector<std::vector<densemat>> opestimator::interpolate(elementselector& ele
     }
 
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
     }
     
-    bool wasreuseallowed = universe::isreuseallowed;
+    bool wasreuseallowed = universe::getcontext()->isreuseallowed;
     universe::forbidreuse();
     
     // Update the estimator if allowed:
@@ -38,10 +43,10 @@ std::vector<std::vector<densemat>> opestimator::interpolate(elementselector& ele
     {   
         if (mytype == "zienkiewiczzhu")
             estimatezienkiewiczzhu();
-        mystatenumber = universe::estimatorcalcstate;
+        mystatenumber = universe::getsession()->estimatorcalcstate;
     }
     // If any update is forbidden reset value to 0:
-    if (universe::numallowedtimes <= 0)
+    if (universe::getsession()->numallowedtimes <= 0)
         myvalue->getfieldpointer()->resetcoefmanager();
     
     // Provide the requested output:
@@ -50,7 +55,7 @@ std::vector<std::vector<densemat>> opestimator::interpolate(elementselector& ele
    if (wasreuseallowed)
         universe::allowreuse();
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), argmat);
     
     return argmat;
@@ -69,118 +74,475 @@ std::shared_ptr<operation> opestimator::simplify(std::vector<int> disjregs)
     return shared_from_this();
 }
 
+long long int opestimator::getstate(void)
+{
+    return universe::getnewstate();
+}
+
 std::shared_ptr<operation> opestimator::copy(void)
 {
-    std::shared_ptr<opestimator> op(new opestimator(mytype, myarg));
+    std::shared_ptr<opestimator> op(new opestimator(mytype, myarg, myincrementaltolerance));
     // 'myvalue' should not be the same one as in this object thus do not do '*op = *this'.
     op->mystatenumber = 0; // to make sure 'myvalue' is recalculated when allowed (it is all zero here)
     return op;
 }
 
-void opestimator::print(void)
+void opestimator::print(std::ostream& out)
 {
-    std::cout << mytype << "(";
-    myarg->print();
-    std::cout << ")";
+    out << mytype << "(";
+    myarg->print(out);
+    out << ")";
 }
 
-void opestimator::estimatezienkiewiczzhu(void)
+void opestimator::interpolatecorners(std::vector<int> disjregs, std::vector<int>* elemnums)
 {
-    int problemdimension = universe::getrawmesh()->getmeshdimension();
+    int elementtypenumber = universe::getrawmesh()->getdisjointregions()->getelementtypenumber(disjregs[0]);
     
-    elements* myelements = universe::getrawmesh()->getelements();
-    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    // Evaluate at the corner nodes:
+    lagrangeformfunction mylagrange(elementtypenumber, 1, {});
+    std::vector<double> evaluationpoints = mylagrange.getnodecoordinates();
+    int nn = evaluationpoints.size()/3;
     
-    // Compute 'myarg' at all mesh nodes: 
-    std::vector<int> alldisjregsinmaxdim = mydisjointregions->getindim(problemdimension);
+    std::vector<double>& cornervalues = mycornervalues[elementtypenumber];
+    if (cornervalues.size() == 0)
+        cornervalues.resize((long long int)universe::getrawmesh()->getelements()->count(elementtypenumber)*nn);
+    
+    auto interpolateblock = [&](elementselector& cursel)
+    {
+        std::vector<int> elemnumsinblock = cursel.getelementnumbers();
+    
+        universe::allowreuse();
+        densemat interpolated = myarg->interpolate(cursel, evaluationpoints, NULL)[1][0];
+        universe::forbidreuse();
+        
+        double* interpvals = interpolated.getvalues();
+        for (int e = 0; e < elemnumsinblock.size(); e++)
+        {
+            for (int n = 0; n < nn; n++)
+                cornervalues[(long long int)elemnumsinblock[e]*nn+n] = interpvals[e*nn+n];
+        }
+    };
+    
+    // Loop on all total orientations (if required):
+    bool isorientationdependent = myarg->isvalueorientationdependent(disjregs);
+    bool ismultithreaded = (universe::getmaxnumthreads() > 1 && myarg->isthreadsafe(disjregs));
+    std::shared_ptr<elementselector> myselector;
+    if (elemnums == NULL)
+        myselector = std::shared_ptr<elementselector>(new elementselector(disjregs, isorientationdependent));
+    else
+        myselector = std::shared_ptr<elementselector>(new elementselector(disjregs, *elemnums, isorientationdependent));
+    do
+    {
+        std::vector<int> elementnumbers = myselector->getelementnumbers();
+        int numelems = elementnumbers.size();
+        
+        int numthreadstouse = 1;
+        if (ismultithreaded)
+            numthreadstouse = std::min(numelems/minnumelemsperthreadforestimator+1, universe::getmaxnumthreads()); // require a min num elements per thread
+    
+        if (numthreadstouse == 1)
+        {
+            interpolateblock(*myselector);
+            continue;
+        }
+        
+        // Every task interpolates a chunk of elements (the values of different elements are stored at different places).
+        // Having more chunks than threads balances the load:
+        int numchunks = std::min(4*numthreadstouse, numelems);
+        auto computechunk = [&](int c)
+        {
+            std::vector<int> chunkelems(elementnumbers.begin() + (long long int)c*numelems/numchunks, elementnumbers.begin() + (long long int)(c+1)*numelems/numchunks);
+            elementselector chunkselector(disjregs, chunkelems, isorientationdependent);
+            interpolateblock(chunkselector);
+        };
+        
+        // The first chunk is computed on this thread so that all lazy 
+        // synchronizations happen before the other threads start:
+        taskscheduler::run(numchunks, computechunk, true, numthreadstouse);
+    }
+    while (myselector->next());
+}
 
-    int numnodes = universe::getrawmesh()->getnodes()->count();
+void opestimator::computeerror(int elementtypenumber, int numcornernodes, int elementnumber)
+{
+    elements* myelements = universe::getrawmesh()->getelements();
 
-    densemat nodalvaluesmin(numnodes, 1);
-    densemat nodalvaluesmax(numnodes, 1);
-    double* nvmin = nodalvaluesmin.getvalues();
-    double* nvmax = nodalvaluesmax.getvalues();
+    double curmaxerror = -1;
+    for (int n = 0; n < numcornernodes; n++)
+    {
+        int curnode = myelements->getsubelement(0, elementtypenumber, elementnumber, n);
+        double curerror = std::abs(mynodalmax[curnode]-mynodalmin[curnode]);
+        if (curerror > curmaxerror)
+            curmaxerror = curerror;
+    }
     
-    std::vector<int> numcontribs(numnodes, 0);
+    myerrors[elementtypenumber][elementnumber] = curmaxerror;
+}
 
-    // Send the disjoint regions with same element type numbers together:
-    disjointregionselector mydisjregselector(alldisjregsinmaxdim, {});
-    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+bool opestimator::getfields(std::shared_ptr<operation> op, std::vector<std::shared_ptr<rawfield>>& fields)
+{
+    if (op->isconstant())
+        return true;
+        
+    if (op->isfield())
+    {
+        std::shared_ptr<rawfield> rf = op->getfieldpointer();
+        // The time derivatives of a non-multiharmonic field are not in its coefficients:
+        if (rf->ismultiharmonic() == false && op->gettimederivative() > 0)
+            return false;
+        // Only the coordinate fields do not have coefficients (they do not change on a given mesh state):
+        std::string tn = rf->gettypename();
+        if (rf->getcoefmanager() == NULL && tn != "x" && tn != "y" && tn != "z")
+            return false;
+            
+        if (std::find(fields.begin(), fields.end(), rf) == fields.end())
+            fields.push_back(rf);
+        return true;
+    }
+    
+    // These depend on values outside of the element:
+    if (std::dynamic_pointer_cast<opon>(op) != NULL || std::dynamic_pointer_cast<opestimator>(op) != NULL || std::dynamic_pointer_cast<opathp>(op) != NULL)
+        return false;
+    
+    // Parameters, time, ports, ...
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    if (arguments.size() == 0)
+        return false;
+    
+    for (int i = 0; i < arguments.size(); i++)
     {
-        std::vector<int> mydisjregs = mydisjregselector.getgroup(i);
+        if (getfields(arguments[i], fields) == false)
+            return false;
+    }
+    return true;
+}
 
-        // Evaluate at the corner nodes:
-        int elementtypenumber = mydisjointregions->getelementtypenumber(mydisjregs[0]);
+std::vector<std::vector<double>> opestimator::getcoefs(std::shared_ptr<rawfield> rf)
+{
+    std::shared_ptr<coefmanager> cm = rf->getcoefmanager();
+    if (cm == NULL)
+        return {};
+        
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
     
-        lagrangeformfunction mylagrange(elementtypenumber, 1, {});
-        std::vector<double> evaluationpoints = mylagrange.getnodecoordinates();
+    std::vector<std::vector<double>> output(mydisjointregions->count());
+    for (int d = 0; d < output.size(); d++)
+    {
+        int ne = mydisjointregions->countelements(d);
+        int nff = cm->countformfunctions(d);
         
-        int nn = evaluationpoints.size()/3;
+        output[d] = std::vector<double>((long long int)nff*ne, 0.0);
+        for (int ff = 0; ff < nff; ff++)
+        {
+            const double* vals = cm->readcoefs(d, ff);
+            if (vals != NULL)
+                std::copy(vals, vals+ne, output[d].begin() + (long long int)ff*ne);
+        }
+    }
+    
+    return output;
+}
 
-        // Loop on all total orientations (if required):
-        bool isorientationdependent = myarg->isvalueorientationdependent(mydisjregs);
-        elementselector myselector(mydisjregs, isorientationdependent);
-        do
+void opestimator::estimatezienkiewiczzhu(void)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    int problemdimension = rm->getmeshdimension();
+    
+    elements* myelements = rm->getelements();
+    disjointregions* mydisjointregions = rm->getdisjointregions();
+    
+    std::vector<int> alldisjregsinmaxdim = mydisjointregions->getindim(problemdimension);
+
+    int numnodes = rm->getnodes()->count();
+    
+    // The estimate is unchanged if the mesh and the argument are unchanged:
+    bool issamemesh = (rm->getmeshnumber() == mymeshnumber && rm->getstate() == mymeshstate && mycornervalues.size() == 8);
+    long long int argstate = myarg->getstate();
+    bool isunchanged = (issamemesh && argstate == myargstate);
+    
+    // An incremental update requires the argument to only depend on the field values on the element:
+    std::vector<std::shared_ptr<rawfield>> fields = {};
+    bool isincrementalallowed = (myincrementaltolerance >= 0 && getfields(myarg, fields));
+    std::vector<long long int> fieldstructurestates(fields.size());
+    for (int f = 0; f < fields.size(); f++)
+        fieldstructurestates[f] = fields[f]->getstate(true);
+    bool isincremental = (isincrementalallowed && issamemesh && fields == myfields && fieldstructurestates == myfieldstructurestates);
+    
+    std::vector<std::vector<std::vector<double>>> fieldcoefs(fields.size());
+    for (int f = 0; f < fields.size() && isincremental && not(isunchanged); f++)
+    {
+        fieldcoefs[f] = getcoefs(fields[f]);
+        if (fieldcoefs[f].size() != myfieldcoefs[f].size())
+            isincremental = false;
+        for (int d = 0; d < fieldcoefs[f].size() && isincremental; d++)
+            isincremental = (fieldcoefs[f][d].size() == myfieldcoefs[f][d].size());
+    }
+    
+    mymeshnumber = rm->getmeshnumber();
+    mymeshstate = rm->getstate();
+    myargstate = argstate;
+    
+    // Send the disjoint regions with same element type numbers together:
+    disjointregionselector mydisjregselector(alldisjregsinmaxdim, {});
+    
+    if (not(isunchanged) && not(isincremental))
+    {
+        mycornervalues = std::vector<std::vector<double>>(8);
+        myerrors = std::vector<std::vector<double>>(8);
+        
+        // Compute 'myarg' at the corner nodes of all elements: 
+        for (int i = 0; i < mydisjregselector.countgroups(); i++)
+            interpolatecorners(mydisjregselector.getgroup(i), NULL);
+        
+        // Every thread gets the nodal extrema on a block of the elements of each type. They are then merged:
+        int numthreadstouse = autotuning::getnumthreadsforitems(numnodes); // require a min num nodes per thread
+        
+        std::vector<std::vector<double>> threadmin(numthreadstouse), threadmax(numthreadstouse);
+        std::vector<std::vector<bool>> isthreadset(numthreadstouse);
+        
+        auto computeextrema = [&](int t)
+        {
+            threadmin[t] = std::vector<double>(numnodes, 0.0);
+            threadmax[t] = std::vector<double>(numnodes, 0.0);
+            isthreadset[t] = std::vector<bool>(numnodes, false);
+            
+            for (int i = 0; i <= 7; i++)
+            {
+                if (mycornervalues[i].size() == 0)
+                    continue;
+                
+                element elem(i);
+                int nn = elem.countnodes();
+                int numelems = myelements->count(i);
+                
+                int firstel = (long long int)t*numelems/numthreadstouse;
+                int lastel = (long long int)(t+1)*numelems/numthreadstouse;
+                for (int e = firstel; e < lastel; e++)
+                {
+                    for (int n = 0; n < nn; n++)
+                    {
+                        int curnode = myelements->getsubelement(0, i, e, n);
+                        double curval = mycornervalues[i][(long long int)e*nn+n];
+                        
+                        if (isthreadset[t][curnode] == false || curval < threadmin[t][curnode])
+                            threadmin[t][curnode] = curval;
+                        if (isthreadset[t][curnode] == false || curval > threadmax[t][curnode])
+                            threadmax[t][curnode] = curval;
+                        isthreadset[t][curnode] = true;
+                    }
+                }
+            }
+        };
+        
+        mynodalmin = std::vector<double>(numnodes, 0.0);
+        mynodalmax = std::vector<double>(numnodes, 0.0);
+        
+        auto mergeextrema = [&](int t)
+        {
+            int firstnode = (long long int)t*numnodes/numthreadstouse;
+            int lastnode = (long long int)(t+1)*numnodes/numthreadstouse;
+            for (int n = firstnode; n < lastnode; n++)
+            {
+                bool isset = false;
+                for (int i = 0; i < numthreadstouse; i++)
+                {
+                    if (isthreadset[i][n] == false)
+                        continue;
+                    if (isset == false || threadmin[i][n] < mynodalmin[n])
+                        mynodalmin[n] = threadmin[i][n];
+                    if (isset == false || threadmax[i][n] > mynodalmax[n])
+                        mynodalmax[n] = threadmax[i][n];
+                    isset = true;
+                }
+            }
+        };
+        
+        auto computeerrors = [&](int t)
         {
-            std::vector<int> elemnums = myselector.getelementnumbers();
+            for (int i = 0; i <= 7; i++)
+            {
+                if (mycornervalues[i].size() == 0)
+                    continue;
+                
+                int nn = element(i).countnodes();
+                int numelems = myelements->count(i);
+                int firstel = (long long int)t*numelems/numthreadstouse;
+                int lastel = (long long int)(t+1)*numelems/numthreadstouse;
+                for (int e = firstel; e < lastel; e++)
+                    computeerror(i, nn, e);
+            }
+        };
         
-            universe::allowreuse();
-            densemat interpolated = myarg->interpolate(myselector, evaluationpoints, NULL)[1][0];
-            universe::forbidreuse();
-
-            double* interpvals = interpolated.getvalues();
+        for (int i = 0; i <= 7; i++)
+        {
+            if (mycornervalues[i].size() > 0)
+                myerrors[i] = std::vector<double>(myelements->count(i), 0.0);
+        }
+        
+        std::vector<std::function<void(int)>> steps = {computeextrema, mergeextrema, computeerrors};
+        for (int s = 0; s < steps.size(); s++)
+        {
+            if (numthreadstouse == 1)
+                steps[s](0);
+            else
+            {
+                std::vector<std::thread> threadobjs(numthreadstouse);
+                for (int t = 0; t < numthreadstouse; t++)
+                    threadobjs[t] = universe::newthread(steps[s], t);
+                for (int t = 0; t < numthreadstouse; t++)
+                    threadobjs[t].join();
+            }
+        }
+        
+        // Keep the field coefficients for the next incremental update:
+        myfields = {}; myfieldstructurestates = {}; myfieldcoefs = {};
+        if (isincrementalallowed)
+        {
+            myfields = fields;
+            myfieldstructurestates = fieldstructurestates;
+            myfieldcoefs = std::vector<std::vector<std::vector<double>>>(fields.size());
+            for (int f = 0; f < fields.size(); f++)
+                myfieldcoefs[f] = getcoefs(fields[f]);
+        }
+    }
+    if (not(isunchanged) && isincremental)
+    {
+        // Flag the (sub)elements on which a field coefficient changed significantly since last considered:
+        std::vector<std::vector<bool>> ischangedsub(8);
+        for (int f = 0; f < fields.size(); f++)
+        {
+            std::vector<std::vector<double>>& curcoefs = fieldcoefs[f];
+            std::vector<std::vector<double>>& prevcoefs = myfieldcoefs[f];
             
-            for (int e = 0; e < elemnums.size(); e++)
+            double maxabs = 0.0;
+            for (int d = 0; d < curcoefs.size(); d++)
             {
-                int curelem = elemnums[e];
-                for (int n = 0; n < nn; n++)
+                for (int k = 0; k < curcoefs[d].size(); k++)
+                    maxabs = std::max(maxabs, std::max(std::abs(curcoefs[d][k]), std::abs(prevcoefs[d][k])));
+            }
+            double threshold = myincrementaltolerance*maxabs;
+            
+            for (int d = 0; d < curcoefs.size(); d++)
+            {
+                int typenum = mydisjointregions->getelementtypenumber(d);
+                int rb = mydisjointregions->getrangebegin(d);
+                int ne = mydisjointregions->countelements(d);
+                
+                for (int k = 0; k < curcoefs[d].size(); k++)
                 {
-                    int curnode = myelements->getsubelement(0, elementtypenumber, curelem, n);
-                    double curval = interpvals[e*nn+n];
-                    
-                    int numcont = numcontribs[curnode];
+                    if (std::abs(curcoefs[d][k]-prevcoefs[d][k]) > threshold)
+                    {
+                        if (ischangedsub[typenum].size() == 0)
+                            ischangedsub[typenum] = std::vector<bool>(myelements->count(typenum), false);
+                        ischangedsub[typenum][rb+k%ne] = true;
+                        // The reference is only updated where the change is significant:
+                        prevcoefs[d][k] = curcoefs[d][k];
+                    }
+                }
+            }
+        }
+        
+        // Flag the elements touching a changed (sub)element:
+        std::vector<std::vector<bool>> ischangedelem(8);
+        for (int i = 0; i <= 7; i++)
+        {
+            if (mycornervalues[i].size() > 0)
+                ischangedelem[i] = std::vector<bool>(myelements->count(i), false);
+        }
+        for (int i = 0; i <= 7; i++)
+        {
+            element elem(i);
+            for (int s = 0; s < ischangedsub[i].size(); s++)
+            {
+                if (ischangedsub[i][s] == false)
+                    continue;
                 
-                    if (numcont == 0 || curval < nvmin[curnode])
-                        nvmin[curnode] = curval;
-                    if (numcont == 0 || curval > nvmax[curnode])
-                        nvmax[curnode] = curval;
+                if (elem.getelementdimension() == problemdimension)
+                    ischangedelem[i][s] = true;
+                else
+                {
+                    std::vector<int> cells = myelements->getcellsontype(i, s);
+                    for (int c = 0; c < cells.size()/2; c++)
+                        ischangedelem[cells[2*c+0]][cells[2*c+1]] = true;
+                }
+            }
+        }
+        
+        // Update the corner values of the changed elements and flag their nodes:
+        std::vector<bool> ischangednode(numnodes, false);
+        for (int g = 0; g < mydisjregselector.countgroups(); g++)
+        {
+            std::vector<int> mydisjregs = mydisjregselector.getgroup(g);
+            int elementtypenumber = mydisjointregions->getelementtypenumber(mydisjregs[0]);
+            int nn = element(elementtypenumber).countnodes();
+            
+            std::vector<int> changedelems = {};
+            for (int d = 0; d < mydisjregs.size(); d++)
+            {
+                for (int e = mydisjointregions->getrangebegin(mydisjregs[d]); e <= mydisjointregions->getrangeend(mydisjregs[d]); e++)
+                {
+                    if (ischangedelem[elementtypenumber][e] == false)
+                        continue;
+                    changedelems.push_back(e);
+                    for (int n = 0; n < nn; n++)
+                        ischangednode[myelements->getsubelement(0, elementtypenumber, e, n)] = true;
+                }
+            }
+            if (changedelems.size() > 0)
+                interpolatecorners(mydisjregs, &changedelems);
+        }
+        
+        // Update the extrema at the changed nodes and the errors of the elements touching them:
+        std::vector<int> changednodes = {};
+        for (int n = 0; n < numnodes; n++)
+        {
+            if (ischangednode[n])
+                changednodes.push_back(n);
+        }
+        std::vector<std::vector<int>> cellsonnodes(changednodes.size());
+        for (int i = 0; i < changednodes.size(); i++)
+        {
+            int curnode = changednodes[i];
+            cellsonnodes[i] = myelements->getcellsontype(0, curnode);
+            
+            for (int c = 0; c < cellsonnodes[i].size()/2; c++)
+            {
+                int celltype = cellsonnodes[i][2*c+0], cellnum = cellsonnodes[i][2*c+1];
+                int nn = element(celltype).countnodes();
+                
+                for (int n = 0; n < nn; n++)
+                {
+                    if (myelements->getsubelement(0, celltype, cellnum, n) != curnode)
+                        continue;
                     
-                    numcontribs[curnode]++;
+                    double curval = mycornervalues[celltype][(long long int)cellnum*nn+n];
+                    if (c == 0 || curval < mynodalmin[curnode])
+                        mynodalmin[curnode] = curval;
+                    if (c == 0 || curval > mynodalmax[curnode])
+                        mynodalmax[curnode] = curval;
                 }
             }
         }
-        while (myselector.next());
+        for (int i = 0; i < changednodes.size(); i++)
+        {
+            for (int c = 0; c < cellsonnodes[i].size()/2; c++)
+                computeerror(cellsonnodes[i][2*c+0], element(cellsonnodes[i][2*c+0]).countnodes(), cellsonnodes[i][2*c+1]);
+        }
     }
     
     // Populate 'myvalue':
     std::shared_ptr<rawfield> rf = myvalue->getfieldpointer();
     std::shared_ptr<coefmanager> cm = rf->getcoefmanager();
     
-    for (int i = 0; i <= 7; i++)
+    for (int d = 0; d < alldisjregsinmaxdim.size(); d++)
     {
-        int numelems = myelements->count(i);
+        int curdisjreg = alldisjregsinmaxdim[d];
+        int elementtypenumber = mydisjointregions->getelementtypenumber(curdisjreg);
+        int rb = mydisjointregions->getrangebegin(curdisjreg);
+        int ne = mydisjointregions->countelements(curdisjreg);
         
-        element elem(i);
-        if (numelems == 0 || elem.getelementdimension() != problemdimension)
-            continue;
-    
-        int nn = elem.countnodes();
-    
-        for (int e = 0; e < numelems; e++)
-        {
-            int curdisjreg = myelements->getdisjointregion(i, e);
-            int rb = mydisjointregions->getrangebegin(curdisjreg);
-        
-            double curmaxerror = -1;
-            for (int n = 0; n < nn; n++)
-            {
-                int curnode = myelements->getsubelement(0, i, e, n);
-                double curerror = std::abs(nvmax[curnode]-nvmin[curnode]);
-                if (curerror > curmaxerror)
-                    curmaxerror = curerror;
-            }
-            
-            cm->setcoef(curdisjreg, 0, e-rb, curmaxerror);
-        }
+        double* vals = cm->getcoefsforwriting(curdisjreg, 0);
+        for (int e = 0; e < ne; e++)
+            vals[e] = myerrors[elementtypenumber][rb+e];
     }
 }
@@ -7,6 +7,8 @@
 #ifndef OPESTIMATOR_H
 #define OPESTIMATOR_H
 
+#include <thread>
+#include <functional>
 #include "operation.h"
 #include "opfield.h"
 
@@ -27,9 +29,35 @@ class opestimator: public operation
         
         long long int mystatenumber = 0;
         
+        // The Zienkiewicz-Zhu estimate is only updated around the elements on which a field coefficient of the argument changed
+        // by more than this fraction of the largest coefficient of the field since it was last considered (update everywhere if negative):
+        double myincrementaltolerance = -1;
+        
+        // Mesh and argument states at the last estimate (it is not updated if unchanged):
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1, myargstate = -1;
+        // Argument value at the corner nodes of every element ([elementtype][element*numcornernodes+node]), 
+        // nodal extrema of these values and error of every element ([elementtype][element]):
+        std::vector<std::vector<double>> mycornervalues = {};
+        std::vector<double> mynodalmin = {}, mynodalmax = {};
+        std::vector<std::vector<double>> myerrors = {};
+        // Fields in the argument with their structure state and coefficients ([field][disjreg]) last considered:
+        std::vector<std::shared_ptr<rawfield>> myfields = {};
+        std::vector<long long int> myfieldstructurestates = {};
+        std::vector<std::vector<std::vector<double>>> myfieldcoefs = {};
+        
+        // Interpolate the argument at the corner nodes of the elements in the disjoint regions (all elements if 'elemnums' is NULL):
+        void interpolatecorners(std::vector<int> disjregs, std::vector<int>* elemnums);
+        // Compute the error of an element from the nodal extrema:
+        void computeerror(int elementtypenumber, int numcornernodes, int elementnumber);
+        // Get the fields in the operation. Return false if the operation depends on anything else than the values of these fields on the element:
+        static bool getfields(std::shared_ptr<operation> op, std::vector<std::shared_ptr<rawfield>>& fields);
+        // Get the coefficients of a field in every disjoint region:
+        static std::vector<std::vector<double>> getcoefs(std::shared_ptr<rawfield> rf);
+        
     public:
         
-        opestimator(std::string estimatortype, std::shared_ptr<operation> arg);
+        opestimator(std::string estimatortype, std::shared_ptr<operation> arg, double incrementaltolerance = -1);
         
         std::vector<std::vector<densemat>> interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
         densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
@@ -38,12 +66,17 @@ class opestimator: public operation
         std::shared_ptr<operation> simplify(std::vector<int> disjregs);
         
         bool isvalueorientationdependent(std::vector<int> disjregs) { return false; };
+        // The estimate is updated during the interpolation:
+        bool isthreadsafe(std::vector<int> disjregs) { return false; };
+        
+        // The estimator update is not tracked:
+        long long int getstate(void);
         
         std::shared_ptr<operation> copy(void);
         
         void reuseit(bool istobereused) { reuse = istobereused; };
 
-        void print(void);
+        void print(std::ostream& out);
         
         // Update 'myvalue' with the estimate:
         void estimatezienkiewiczzhu(void);
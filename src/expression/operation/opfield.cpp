@@ -48,7 +48,7 @@ std::vector<std::vector<densemat>> opfield::interpolate(int kietaphiderivative,
     {
         std::cout << "Error in 'opfield' object: expression provided for mesh deformation is invalid" << std::endl;
         std::cout << "Operation was:" << std::endl;
-        this->print();
+        this->print(std::cout);
         abort();
     }
 }
@@ -56,7 +56,7 @@ std::vector<std::vector<densemat>> opfield::interpolate(int kietaphiderivative,
 std::vector<std::vector<densemat>> opfield::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(myfield, timederivativeorder, spacederivative, kietaphiderivative, formfunctioncomponent);
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -68,7 +68,7 @@ std::vector<std::vector<densemat>> opfield::interpolate(elementselector& elemsel
     {
         // Get the vector in the universe corresponding to the field time derivative.
         // This was created and set to the universe by a time resolution object.
-        if ((universe::xdtxdtdtx)[timederivativeorder].size() == 0)
+        if ((universe::getsession()->xdtxdtdtx)[timederivativeorder].size() == 0)
         {
             std::vector<std::string> messtr = {"","dt","dtdt"};
             std::cout << "Error in 'opfield' object: the " << messtr[timederivativeorder] << "(";
@@ -78,7 +78,7 @@ std::vector<std::vector<densemat>> opfield::interpolate(elementselector& elemsel
         }
         cmbkp = myfield->harmonic(1)->resetcoefmanager();
         // Set the field value to the field time derivative value on all regions:
-        myfield->setdata(-1, (universe::xdtxdtdtx)[timederivativeorder][0]|field(myfield));
+        myfield->setdata(-1, (universe::getsession()->xdtxdtdtx)[timederivativeorder][0]|field(myfield));
     }
 
     std::vector<std::vector<densemat>> output;
@@ -97,13 +97,13 @@ std::vector<std::vector<densemat>> opfield::interpolate(elementselector& elemsel
 
             // Compute the Jacobian terms or reuse if available in the universe.
             std::shared_ptr<jacobian> myjac;
-            if (universe::isreuseallowed && universe::computedjacobian != NULL)
-                myjac = universe::computedjacobian;
+            if (universe::getcontext()->isreuseallowed && universe::getcontext()->computedjacobian != NULL)
+                myjac = universe::getcontext()->computedjacobian;
             else
                 myjac = std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
 
-            if (universe::isreuseallowed)
-                universe::computedjacobian = myjac;
+            if (universe::getcontext()->isreuseallowed)
+                universe::getcontext()->computedjacobian = myjac;
 
             // Compute the required ki, eta and phi derivatives:
             std::vector<std::vector<densemat>> dkiargmat, detaargmat, dphiargmat;
@@ -148,7 +148,7 @@ std::vector<std::vector<densemat>> opfield::interpolate(elementselector& elemsel
     if (myfield->ismultiharmonic() && timederivativeorder > 0)
         output = harmonic::timederivative(timederivativeorder, output);
 
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), output);
 
     return output;
@@ -157,7 +157,7 @@ std::vector<std::vector<densemat>> opfield::interpolate(elementselector& elemsel
 densemat opfield::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(myfield, timederivativeorder, spacederivative, kietaphiderivative, formfunctioncomponent);
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -167,7 +167,7 @@ densemat opfield::multiharmonicinterpolate(int numtimeevals, elementselector& el
     // Compute at 'numtimevals' instants in time the multiharmonic field:
     densemat output = fourier::inversefft(interpolatedfield, numtimeevals, elemselect.countinselection(), evaluationcoordinates.size()/3);
 
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     return output;
 }
@@ -187,6 +187,20 @@ bool opfield::isvalueorientationdependent(std::vector<int> disjregs)
     return false;
 }
 
+bool opfield::isthreadsafe(std::vector<int> disjregs)
+{
+    return (myfield->ismultiharmonic() || timederivativeorder == 0);
+}
+
+long long int opfield::getstate(void)
+{
+    // The time derivatives of a non-multiharmonic field are not tracked:
+    if (myfield->ismultiharmonic() == false && timederivativeorder > 0)
+        return universe::getnewstate();
+        
+    return myfield->getstate();
+}
+
 std::shared_ptr<operation> opfield::copy(void)
 {
     std::shared_ptr<opfield> op(new opfield(myfield));
@@ -213,23 +227,23 @@ std::vector<double> opfield::evaluate(std::vector<double>& xcoords, std::vector<
     abort();
 }
 
-void opfield::print(void)
+void opfield::print(std::ostream& out)
 {
     for (int i = 0; i < timederivativeorder; i++)
-        std::cout << "dt";
+        out << "dt";
 
     std::vector<std::string> nonedxdydz = {"","dx","dy","dz"};
     std::vector<std::string> nonecompxcompycompz = {"compx","compy","compz"};
 
-    std::cout << nonedxdydz[spacederivative];
+    out << nonedxdydz[spacederivative];
     // For fields without subfields:
     if (fieldcomponent == -1)
     {
         if (myfield->countformfunctioncomponents() > 1)
-            std::cout << nonecompxcompycompz[formfunctioncomponent];
+            out << nonecompxcompycompz[formfunctioncomponent];
     }
     else
-        std::cout << nonecompxcompycompz[fieldcomponent];
+        out << nonecompxcompycompz[fieldcomponent];
 
-    myfield->print();
+    myfield->print(out);
 }
@@ -58,12 +58,15 @@ class opfield: public operation
         int gettimederivative(void) { return timederivativeorder; };
 
         bool isvalueorientationdependent(std::vector<int> disjregs);
+        // The time derivative of a non-multiharmonic field temporarily replaces the field values:
+        bool isthreadsafe(std::vector<int> disjregs);
+        long long int getstate(void);
 
         std::shared_ptr<operation> copy(void);
 
         std::vector<double> evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords);
 
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
@@ -11,7 +11,7 @@ opfieldorder::opfieldorder(std::vector<std::shared_ptr<rawfield>> fieldsin, doub
 std::vector<std::vector<densemat>> opfieldorder::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -74,7 +74,7 @@ std::vector<std::vector<densemat>> opfieldorder::interpolate(elementselector& el
     
     output = output.duplicatehorizontally(evaluationcoordinates.size()/3);
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), {{},{output}});
 
     // The field order is on the cos0 harmonic:
@@ -84,7 +84,7 @@ std::vector<std::vector<densemat>> opfieldorder::interpolate(elementselector& el
 densemat opfieldorder::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -95,7 +95,7 @@ densemat opfieldorder::multiharmonicinterpolate(int numtimeevals, elementselecto
     output = output.getflattened();
     output = output.duplicatevertically(numtimeevals);
 
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
         
     return output;
@@ -109,8 +109,8 @@ std::shared_ptr<operation> opfieldorder::copy(void)
     return op;
 }
 
-void opfieldorder::print(void)
+void opfieldorder::print(std::ostream& out)
 {
-    std::cout << "fieldorder";
+    out << "fieldorder";
 }
 
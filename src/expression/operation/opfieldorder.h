@@ -32,7 +32,7 @@ class opfieldorder: public operation
         
         void reuseit(bool istobereused) { reuse = istobereused; };
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
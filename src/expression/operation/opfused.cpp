@@ -0,0 +1,275 @@
+#include "opfused.h"
+
+
+// Opcodes of the postfix program:
+enum { pushleaf, pushconstant, sumop, productop, powerop, inversionop, absop, sinop, cosop, tanop, asinop, acosop, atanop, log10op };
+
+// Number of values processed at once by every instruction of the program:
+static const int fusedblocksize = 256;
+
+int opfused::getopcode(std::shared_ptr<operation> op)
+{
+    if (op->issum() || op->isproduct())
+    {
+        if (op->isreused() || op->count() == 0)
+            return -1;
+        return (op->issum() ? sumop : productop);
+    }
+
+    int opcode = -1;
+    if (std::dynamic_pointer_cast<oppower>(op) != NULL)
+        opcode = powerop;
+    if (std::dynamic_pointer_cast<opinversion>(op) != NULL)
+        opcode = inversionop;
+    if (std::dynamic_pointer_cast<opabs>(op) != NULL)
+        opcode = absop;
+    if (std::dynamic_pointer_cast<opsin>(op) != NULL)
+        opcode = sinop;
+    if (std::dynamic_pointer_cast<opcos>(op) != NULL)
+        opcode = cosop;
+    if (std::dynamic_pointer_cast<optan>(op) != NULL)
+        opcode = tanop;
+    if (std::dynamic_pointer_cast<opasin>(op) != NULL)
+        opcode = asinop;
+    if (std::dynamic_pointer_cast<opacos>(op) != NULL)
+        opcode = acosop;
+    if (std::dynamic_pointer_cast<opatan>(op) != NULL)
+        opcode = atanop;
+    if (std::dynamic_pointer_cast<oplog10>(op) != NULL)
+        opcode = log10op;
+
+    // Reused operations are kept as leaves so that they are still computed only once:
+    if (opcode != -1 && op->isreused())
+        return -1;
+
+    return opcode;
+}
+
+int opfused::compile(std::shared_ptr<operation> op, int& curdepth)
+{
+    int opcode = getopcode(op);
+
+    if (opcode == -1)
+    {
+        myopcodes.push_back(op->isconstant() ? pushconstant : pushleaf);
+        if (op->isconstant())
+        {
+            myoperands.push_back(myconstants.size());
+            myconstants.push_back(op->getvalue());
+        }
+        else
+        {
+            // A leaf appearing several times in the tree is interpolated only once:
+            int leafindex = std::find(myleaves.begin(), myleaves.end(), op) - myleaves.begin();
+            if (leafindex == myleaves.size())
+                myleaves.push_back(op);
+            myoperands.push_back(leafindex);
+        }
+        curdepth++;
+        mymaxstackdepth = std::max(mymaxstackdepth, curdepth);
+
+        return 0;
+    }
+
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+
+    int numfused = 1;
+    for (int i = 0; i < arguments.size(); i++)
+        numfused += compile(arguments[i], curdepth);
+
+    myopcodes.push_back(opcode);
+    myoperands.push_back(arguments.size());
+    curdepth -= arguments.size()-1;
+
+    return numfused;
+}
+
+std::shared_ptr<operation> opfused::fuse(std::shared_ptr<operation> op, std::vector<int> disjregs)
+{
+    std::shared_ptr<opfused> alreadyfused = std::dynamic_pointer_cast<opfused>(op);
+    if (alreadyfused != NULL)
+        op = alreadyfused->myoriginal;
+
+    if (getopcode(op) == -1 || op->isdofincluded() || op->istfincluded() || op->isportincluded() || op->isharmonicone(disjregs) == false)
+        return op;
+
+    std::shared_ptr<opfused> fused(new opfused);
+    fused->myoriginal = op;
+
+    int curdepth = 0;
+    int numfused = fused->compile(op, curdepth);
+
+    // A single fused operation does not create any intermediate matrix anyway:
+    if (numfused < 2 || fused->myleaves.size() == 0)
+        return op;
+
+    return fused;
+}
+
+std::vector<std::vector<densemat>> opfused::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    // Get the value from the universe if available and reuse is enabled:
+    if (reuse && universe::getcontext()->isreuseallowed)
+    {
+        int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
+        if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
+    }
+
+    std::vector<densemat> leafvalues(myleaves.size());
+    for (int i = 0; i < myleaves.size(); i++)
+    {
+        std::vector<std::vector<densemat>> interpolatedleaf = myleaves[i]->interpolate(elemselect, evaluationcoordinates, meshdeform);
+        // A leaf that is zero on these elements is rare enough to use the unfused tree:
+        if (interpolatedleaf.size() < 2 || interpolatedleaf[1].size() == 0)
+            return myoriginal->interpolate(elemselect, evaluationcoordinates, meshdeform);
+        leafvalues[i] = interpolatedleaf[1][0];
+    }
+
+    long long int numrows = leafvalues[0].countrows();
+    long long int numcols = leafvalues[0].countcolumns();
+    long long int numvalues = numrows*numcols;
+
+    std::vector<double*> leafptrs(myleaves.size());
+    for (int i = 0; i < myleaves.size(); i++)
+        leafptrs[i] = leafvalues[i].getvalues();
+
+    densemat output(numrows, numcols);
+    double* outputptr = output.getvalues();
+
+    std::vector<double> stack(mymaxstackdepth*fusedblocksize);
+    double* stackptr = stack.data();
+
+    for (long long int start = 0; start < numvalues; start += fusedblocksize)
+    {
+        int len = std::min((long long int)fusedblocksize, numvalues-start);
+
+        // 'top' points to the stack entry on top:
+        double* top = stackptr - fusedblocksize;
+        for (int p = 0; p < myopcodes.size(); p++)
+        {
+            int operand = myoperands[p];
+            switch (myopcodes[p])
+            {
+                case pushleaf:
+                {
+                    top += fusedblocksize;
+                    double* leafptr = leafptrs[operand]+start;
+                    for (int i = 0; i < len; i++)
+                        top[i] = leafptr[i];
+                    break;
+                }
+                case pushconstant:
+                {
+                    top += fusedblocksize;
+                    double constval = myconstants[operand];
+                    for (int i = 0; i < len; i++)
+                        top[i] = constval;
+                    break;
+                }
+                case sumop:
+                {
+                    double* first = top - (operand-1)*fusedblocksize;
+                    for (int t = 1; t < operand; t++)
+                    {
+                        double* cur = first + t*fusedblocksize;
+                        for (int i = 0; i < len; i++)
+                            first[i] += cur[i];
+                    }
+                    top = first;
+                    break;
+                }
+                case productop:
+                {
+                    double* first = top - (operand-1)*fusedblocksize;
+                    for (int t = 1; t < operand; t++)
+                    {
+                        double* cur = first + t*fusedblocksize;
+                        for (int i = 0; i < len; i++)
+                            first[i] *= cur[i];
+                    }
+                    top = first;
+                    break;
+                }
+                case powerop:
+                {
+                    double* base = top - fusedblocksize;
+                    vectormath::power(base, top, len);
+                    top = base;
+                    break;
+                }
+                case inversionop:
+                    for (int i = 0; i < len; i++)
+                        top[i] = 1.0/top[i];
+                    break;
+                case absop:
+                    for (int i = 0; i < len; i++)
+                        top[i] = std::abs(top[i]);
+                    break;
+                case sinop:
+                    vectormath::sin(top, len);
+                    break;
+                case cosop:
+                    vectormath::cos(top, len);
+                    break;
+                case tanop:
+                    vectormath::tan(top, len);
+                    break;
+                case asinop:
+                    vectormath::asin(top, len);
+                    break;
+                case acosop:
+                    vectormath::acos(top, len);
+                    break;
+                case atanop:
+                    vectormath::atan(top, len);
+                    break;
+                case log10op:
+                    vectormath::log10(top, len);
+                    break;
+            }
+        }
+
+        for (int i = 0; i < len; i++)
+            outputptr[start+i] = stackptr[i];
+    }
+
+    std::vector<std::vector<densemat>> outvec = {{}, {output}};
+
+    if (reuse && universe::getcontext()->isreuseallowed)
+        universe::setprecomputed(shared_from_this(), outvec);
+
+    return outvec;
+}
+
+densemat opfused::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    return myoriginal->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform);
+}
+
+std::shared_ptr<operation> opfused::simplify(std::vector<int> disjregs)
+{
+    return fuse(myoriginal->simplify(disjregs), disjregs);
+}
+
+std::shared_ptr<operation> opfused::copy(void)
+{
+    std::shared_ptr<opfused> op(new opfused);
+    *op = *this;
+    op->reuse = false;
+    return op;
+}
+
+double opfused::evaluate(void)
+{
+    return myoriginal->evaluate();
+}
+
+std::vector<double> opfused::evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords)
+{
+    return myoriginal->evaluate(xcoords, ycoords, zcoords);
+}
+
+void opfused::print(std::ostream& out)
+{
+    myoriginal->print(out);
+}
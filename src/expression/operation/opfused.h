@@ -0,0 +1,71 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This operation evaluates a tree of elementwise operations (sums, products, powers, inversions,
+// abs, log10 and trigonometric functions) in a single pass over the interpolated values.
+// The tree is compiled to a postfix program whose leaves are the operations that cannot be fused
+// (fields, parameters, conditions, ...). The leaves are interpolated as usual and the program is
+// then run block by block on a small stack so that no intermediate densemat is created for the
+// inner nodes of the tree. Only trees that are constant in time (harmonic 1) are fused.
+
+
+#ifndef OPFUSED_H
+#define OPFUSED_H
+
+#include "operation.h"
+#include "vectormath.h"
+
+class opfused: public operation
+{
+
+    private:
+
+        bool reuse = false;
+
+        // The operation tree this program was compiled from:
+        std::shared_ptr<operation> myoriginal;
+        // Operations interpolated to feed the program:
+        std::vector<std::shared_ptr<operation>> myleaves = {};
+
+        // Postfix program. The operand is the leaf number for a leaf push,
+        // the constant number for a constant push and the number of popped
+        // values for the sums and products:
+        std::vector<int> myopcodes = {};
+        std::vector<int> myoperands = {};
+        std::vector<double> myconstants = {};
+
+        int mymaxstackdepth = 0;
+
+        // Append the program for 'op' and return the number of fused (non leaf) operations in it:
+        int compile(std::shared_ptr<operation> op, int& curdepth);
+        // Get the opcode of a fusable operation (-1 if the operation cannot be fused):
+        static int getopcode(std::shared_ptr<operation> op);
+
+    public:
+
+        // Return a fused operation for 'op' if it is worth (and possible) to fuse it on the
+        // disjoint regions, otherwise return 'op' unchanged. An already fused operation is refused.
+        static std::shared_ptr<operation> fuse(std::shared_ptr<operation> op, std::vector<int> disjregs);
+
+        std::vector<std::vector<densemat>> interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+        densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+
+        std::vector<std::shared_ptr<operation>> getarguments(void) { return myleaves; };
+        void replaceargument(int argnum, std::shared_ptr<operation> newarg) { myleaves[argnum] = newarg; };
+        std::shared_ptr<operation> simplify(std::vector<int> disjregs);
+
+        std::shared_ptr<operation> copy(void);
+
+        void reuseit(bool istobereused) { reuse = istobereused; };
+        bool isreused(void) { return reuse; };
+
+        double evaluate(void);
+        std::vector<double> evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords);
+
+        void print(std::ostream& out);
+
+};
+
+#endif
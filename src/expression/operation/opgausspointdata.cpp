@@ -0,0 +1,59 @@
+#include "opgausspointdata.h"
+
+
+std::vector<std::vector<densemat>> opgausspointdata::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    // Get the value from the universe if available and reuse is enabled:
+    if (reuse && universe::getcontext()->isreuseallowed)
+    {
+        int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
+        if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
+    }
+    
+    densemat output = mydata->getvalues(myrow, mycolumn, elemselect, evaluationcoordinates);
+
+    if (reuse && universe::getcontext()->isreuseallowed)
+        universe::setprecomputed(shared_from_this(), {{},{output}});
+
+    // The values are on the cos0 harmonic:
+    return {{},{output}};
+}
+
+densemat opgausspointdata::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    // Get the value from the universe if available and reuse is enabled:
+    if (reuse && universe::getcontext()->isreuseallowed)
+    {
+        int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
+        if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
+    }
+    
+    densemat output = mydata->getvalues(myrow, mycolumn, elemselect, evaluationcoordinates);
+    output = output.getflattened();
+    output = output.duplicatevertically(numtimeevals);
+
+    if (reuse && universe::getcontext()->isreuseallowed)
+        universe::setprecomputedfft(shared_from_this(), output);
+        
+    return output;
+}
+
+long long int opgausspointdata::getstate(void)
+{
+    return mydata->getstate();
+}
+
+std::shared_ptr<operation> opgausspointdata::copy(void)
+{
+    std::shared_ptr<opgausspointdata> op(new opgausspointdata(mydata, myrow, mycolumn));
+    *op = *this;
+    op->reuse = false;
+    return op;
+}
+
+void opgausspointdata::print(std::ostream& out)
+{
+    out << "gpdata";
+    if (mydata->countrows() > 1 || mydata->countcolumns() > 1)
+        out << "(" << myrow << "," << mycolumn << ")";
+}
@@ -0,0 +1,46 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+#ifndef OPGAUSSPOINTDATA_H
+#define OPGAUSSPOINTDATA_H
+
+#include "operation.h"
+#include "rawgausspointdata.h"
+
+class rawgausspointdata;
+
+class opgausspointdata: public operation
+{
+
+    private:
+        
+        bool reuse = false;
+        
+        int myrow;
+        int mycolumn;
+        
+        std::shared_ptr<rawgausspointdata> mydata;
+    
+    public:
+        
+        opgausspointdata(std::shared_ptr<rawgausspointdata> input, int row, int col) { mydata = input; myrow = row; mycolumn = col; };
+        
+        std::vector<std::vector<densemat>> interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+        densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+        
+        bool isvalueorientationdependent(std::vector<int> disjregs) { return false; };
+        bool isthreadsafe(std::vector<int> disjregs) { return true; };
+        long long int getstate(void);
+        
+        std::shared_ptr<operation> copy(void);
+        
+        void reuseit(bool istobereused) { reuse = istobereused; };
+        
+        void print(std::ostream& out);
+
+};
+
+#endif
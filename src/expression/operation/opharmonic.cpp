@@ -12,7 +12,7 @@ opharmonic::opharmonic(std::vector<int> origharms, std::vector<int> destharms, s
 std::vector<std::vector<densemat>> opharmonic::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -25,7 +25,17 @@ std::vector<std::vector<densemat>> opharmonic::interpolate(elementselector& elem
         argmat = myarg->interpolate(elemselect, evaluationcoordinates, meshdeform);
     else
     {
-        densemat timevals = myarg->multiharmonicinterpolate(mynumfftharms, elemselect, evaluationcoordinates, meshdeform);
+        // With 0 the number of time evaluations is derived from the harmonic content of the argument:
+        int numtimeevals = mynumfftharms;
+        if (mynumfftharms == 0)
+        {
+            std::vector<int> disjregs = elemselect.getdisjointregions();
+            int maxorigfrequency = 0;
+            for (int i = 0; i < myorigharms.size(); i++)
+                maxorigfrequency = std::max(maxorigfrequency, harmonic::getfrequency(myorigharms[i]));
+            numtimeevals = harmonic::getnumtimeevals(harmonic::getmaxfrequency(myarg, disjregs), maxorigfrequency);
+        }
+        densemat timevals = myarg->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform);
         argmat = fourier::fft(timevals, numelems, evaluationcoordinates.size()/3);
     }
     
@@ -51,7 +61,7 @@ std::vector<std::vector<densemat>> opharmonic::interpolate(elementselector& elem
         }
     }
 
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), output);
     
     return output;
@@ -60,7 +70,7 @@ std::vector<std::vector<densemat>> opharmonic::interpolate(elementselector& elem
 densemat opharmonic::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -70,7 +80,7 @@ densemat opharmonic::multiharmonicinterpolate(int numtimeevals, elementselector&
     // Compute at 'numtimevals' instants in time the multiharmonic data:
     densemat output = fourier::inversefft(interpolated, numtimeevals, elemselect.countinselection(), evaluationcoordinates.size()/3);
 
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
@@ -101,9 +111,9 @@ std::shared_ptr<operation> opharmonic::copy(void)
     return op;
 }
 
-void opharmonic::print(void)
+void opharmonic::print(std::ostream& out)
 {
-    std::cout << "moveharmonic(";
-    myarg->print();
-    std::cout << ")";
+    out << "moveharmonic(";
+    myarg->print(out);
+    out << ")";
 }
@@ -30,6 +30,8 @@ class opharmonic: public operation
         densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
 
         bool isharmonicone(std::vector<int> disjregs);
+        
+        std::vector<int> getdestinationharmonics(void) { return mydestharms; };
 
         std::vector<std::shared_ptr<operation>> getarguments(void) { return {myarg}; };
         std::shared_ptr<operation> simplify(std::vector<int> disjregs);
@@ -38,7 +40,7 @@ class opharmonic: public operation
         
         void reuseit(bool istobereused) { reuse = istobereused; };
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
@@ -21,12 +21,15 @@ class opinvjac: public operation
         // Define as invjac(m,n):
         opinvjac(int m, int n) { myrow = m; mycol = n; };
         
+        int getrow(void) { return myrow; };
+        int getcolumn(void) { return mycol; };
+        
         std::vector<std::vector<densemat>> interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
         densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
 
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
         
 };
 
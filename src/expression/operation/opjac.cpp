@@ -5,13 +5,13 @@ std::vector<std::vector<densemat>> opjac::interpolate(elementselector& elemselec
 {
     // Compute the Jacobian terms or reuse if available in the universe.
     std::shared_ptr<jacobian> myjac;
-    if (universe::isreuseallowed && universe::computedjacobian != NULL)
-        myjac = universe::computedjacobian;
+    if (universe::getcontext()->isreuseallowed && universe::getcontext()->computedjacobian != NULL)
+        myjac = universe::getcontext()->computedjacobian;
     else
         myjac = std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
     
-    if (universe::isreuseallowed)
-        universe::computedjacobian = myjac;
+    if (universe::getcontext()->isreuseallowed)
+        universe::getcontext()->computedjacobian = myjac;
     
     // The jac is on the cos0 harmonic:
     return {{},{(myjac->getjac(myrow,mycol)).copy()}};
@@ -21,13 +21,13 @@ densemat opjac::multiharmonicinterpolate(int numtimeevals, elementselector& elem
 {
     // Compute the Jacobian terms or reuse if available in the universe.
     std::shared_ptr<jacobian> myjac;
-    if (universe::isreuseallowed && universe::computedjacobian != NULL)
-        myjac = universe::computedjacobian;
+    if (universe::getcontext()->isreuseallowed && universe::getcontext()->computedjacobian != NULL)
+        myjac = universe::getcontext()->computedjacobian;
     else
         myjac = std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
     
-    if (universe::isreuseallowed)
-        universe::computedjacobian = myjac;
+    if (universe::getcontext()->isreuseallowed)
+        universe::getcontext()->computedjacobian = myjac;
     
     densemat computedjac = (myjac->getjac(myrow,mycol)).copy();
     
@@ -42,7 +42,7 @@ std::shared_ptr<operation> opjac::copy(void)
     return op;
 }
 
-void opjac::print(void) { std::cout << "jac" << myrow << mycol; }
+void opjac::print(std::ostream& out) { out << "jac" << myrow << mycol; }
 
 
 
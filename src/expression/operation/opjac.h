@@ -26,7 +26,7 @@ class opjac: public operation
 
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
         
 };
 
@@ -1,16 +1,17 @@
 #include "opmeshsize.h"
+#include "meshcache.h"
 
 
-std::vector<std::vector<densemat>> opmeshsize::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+densemat opmeshsize::getsizes(elementselector& elemselect, expression* meshdeform)
 {
-    // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
-    {
-        int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
-        if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
-    }
-    
     int typenum = elemselect.getelementtypenumber();
+    std::vector<int> elemnums = elemselect.getelementnumbers();
+    
+    // Without mesh deformation the sizes only depend on the mesh:
+    std::vector<double> sizes;
+    if (meshdeform == NULL && meshcache::getsizes(typenum, myintegrationorder, elemnums, sizes))
+        return densemat(sizes.size(),1, sizes);
+    
     gausspoints mygp(typenum, myintegrationorder);
 
     int numgp = mygp.count();
@@ -20,16 +21,36 @@ std::vector<std::vector<densemat>> opmeshsize::interpolate(elementselector& elem
 
     std::shared_ptr<opdetjac> op(new opdetjac);
 
-    bool wasreuseallowed = universe::isreuseallowed;
-    universe::isreuseallowed = false;
+    bool wasreuseallowed = universe::getcontext()->isreuseallowed;
+    universe::getcontext()->isreuseallowed = false;
     densemat output = op->interpolate(elemselect, evalcoords, meshdeform)[1][0];
-    universe::isreuseallowed = wasreuseallowed;
+    universe::getcontext()->isreuseallowed = wasreuseallowed;
     
     output.abs();
     output = output.multiply(weightsmat);
+    
+    if (meshdeform == NULL)
+    {
+        output.getvalues(sizes);
+        meshcache::setsizes(typenum, myintegrationorder, elemnums, sizes);
+    }
+    
+    return output;
+}
+
+std::vector<std::vector<densemat>> opmeshsize::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    // Get the value from the universe if available and reuse is enabled:
+    if (reuse && universe::getcontext()->isreuseallowed)
+    {
+        int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
+        if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
+    }
+    
+    densemat output = getsizes(elemselect, meshdeform);
     output = output.duplicatehorizontally(evaluationcoordinates.size()/3);
 
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), {{},{output}});
 
     // The mesh size is on the cos0 harmonic:
@@ -39,34 +60,18 @@ std::vector<std::vector<densemat>> opmeshsize::interpolate(elementselector& elem
 densemat opmeshsize::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
     }
     
-    int typenum = elemselect.getelementtypenumber();
-    gausspoints mygp(typenum, myintegrationorder);
-
-    int numgp = mygp.count();
-    std::vector<double> evalcoords = mygp.getcoordinates();
-    std::vector<double> weights = mygp.getweights();
-    densemat weightsmat(numgp,1, weights);
-
-    std::shared_ptr<opdetjac> op(new opdetjac);
-
-    bool wasreuseallowed = universe::isreuseallowed;
-    universe::isreuseallowed = false;
-    densemat output = op->interpolate(elemselect, evalcoords, meshdeform)[1][0];
-    universe::isreuseallowed = wasreuseallowed;
-    
-    output.abs();
-    output = output.multiply(weightsmat);
+    densemat output = getsizes(elemselect, meshdeform);
     output = output.duplicatehorizontally(evaluationcoordinates.size()/3);
     output = output.getflattened();
     output = output.duplicatevertically(numtimeevals);
 
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
         
     return output;
@@ -80,5 +85,5 @@ std::shared_ptr<operation> opmeshsize::copy(void)
     return op;
 }
 
-void opmeshsize::print(void) { std::cout << "meshsize"; }
+void opmeshsize::print(std::ostream& out) { out << "meshsize"; }
 
@@ -18,6 +18,9 @@ class opmeshsize: public operation
         
         int myintegrationorder;
         
+        // Size of every selected element (one column):
+        densemat getsizes(elementselector& elemselect, expression* meshdeform);
+        
     public:
         
         opmeshsize(int integrationorder) { myintegrationorder = integrationorder; };
@@ -29,7 +32,7 @@ class opmeshsize: public operation
         
         void reuseit(bool istobereused) { reuse = istobereused; };
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
@@ -1,11 +1,104 @@
 #include "opon.h"
 
 
-opon::opon(int physreg, expression* coordshift, std::shared_ptr<operation> arg, bool errorifnotfound)
+std::mutex opon::searchmutex;
+int opon::maxnumsearches = 256;
+
+// A point search output and the conditions under which it was computed:
+class oponsearchentry
+{
+    public:
+        
+        int meshnumber = -1;
+        long long int meshstate = -1;
+        int physreg = -1;
+        std::vector<double> xyzcoords = {};
+        
+        std::vector<std::vector<int>> foundelems = {};
+        std::vector<std::vector<double>> foundkietaphis = {};
+};
+
+// Entries are indexed by a hash of the physical region and coordinates:
+std::unordered_multimap<size_t, oponsearchentry> oponsearchentries = {};
+
+size_t hashsearch(int physreg, std::vector<double>& xyzcoords)
+{
+    size_t hashval = std::hash<int>()(physreg);
+    for (int i = 0; i < xyzcoords.size(); i++)
+        hashval ^= std::hash<double>()(xyzcoords[i]) + 0x9e3779b9 + (hashval << 6) + (hashval >> 2);
+    return hashval;
+}
+
+void opon::clearsearches(void)
+{
+    std::lock_guard<std::mutex> lock(searchmutex);
+    
+    oponsearchentries = {};
+}
+
+bool opon::getsearch(std::vector<double>& xyzcoords, std::vector<std::vector<int>>& foundelems, std::vector<std::vector<double>>& foundkietaphis)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    size_t hashval = hashsearch(myphysreg, xyzcoords);
+
+    std::lock_guard<std::mutex> lock(searchmutex);
+    
+    auto range = oponsearchentries.equal_range(hashval);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        oponsearchentry& cur = it->second;
+        
+        if (cur.meshnumber == rm->getmeshnumber() && cur.meshstate == rm->getstate() && cur.physreg == myphysreg && cur.xyzcoords == xyzcoords)
+        {
+            foundelems = cur.foundelems;
+            foundkietaphis = cur.foundkietaphis;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void opon::setsearch(std::vector<double>& xyzcoords, std::vector<std::vector<int>>& foundelems, std::vector<std::vector<double>>& foundkietaphis)
+{
+    if (maxnumsearches <= 0)
+        return;
+
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+
+    oponsearchentry entry;
+    entry.meshnumber = rm->getmeshnumber();
+    entry.meshstate = rm->getstate();
+    entry.physreg = myphysreg;
+    entry.xyzcoords = xyzcoords;
+    entry.foundelems = foundelems;
+    entry.foundkietaphis = foundkietaphis;
+    
+    size_t hashval = hashsearch(myphysreg, xyzcoords);
+    
+    std::lock_guard<std::mutex> lock(searchmutex);
+    
+    // Remove the entries from other mesh states:
+    for (auto it = oponsearchentries.begin(); it != oponsearchentries.end(); )
+    {
+        if (it->second.meshnumber != entry.meshnumber || it->second.meshstate != entry.meshstate)
+            it = oponsearchentries.erase(it);
+        else
+            ++it;
+    }
+    if (oponsearchentries.size() >= maxnumsearches)
+        oponsearchentries = {};
+    
+    oponsearchentries.insert(std::make_pair(hashval, entry));
+}
+
+
+opon::opon(int physreg, expression* coordshift, std::shared_ptr<operation> arg, bool errorifnotfound, std::shared_ptr<rawslidinginterface> sliding)
 {
     myphysreg = physreg; 
     myerrorifnotfound = errorifnotfound;
     myarg = arg;
+    mysliding = sliding;
     if (coordshift != NULL)
         mycoordshift = {*coordshift};
 }
@@ -13,15 +106,15 @@ opon::opon(int physreg, expression* coordshift, std::shared_ptr<operation> arg,
 std::vector<std::vector<densemat>> opon::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
     }
 
     // Otherwise the stored data will be used during the interpolation step (on wrong ki, eta, phi coordinates):
-    bool wasreuseallowed = universe::isreuseallowed;
-    universe::isreuseallowed = false;
+    bool wasreuseallowed = universe::getcontext()->isreuseallowed;
+    universe::getcontext()->isreuseallowed = false;
     
 
     // Calculate the x, y and z coordinates at which to interpolate:
@@ -78,7 +171,19 @@ std::vector<std::vector<densemat>> opon::interpolate(elementselector& elemselect
     std::vector<std::vector<double>> interpolated;
     std::vector<bool> isfound;
     
-    expression(myarg).interpolate(myphysreg, meshdeform, xyzcoords, interpolated, isfound, -1); 
+    // Reuse the point search output if available (the sliding interface lookup is cheaper than the cache):
+    std::vector<std::vector<int>> foundelems;
+    std::vector<std::vector<double>> foundkietaphis;
+    bool issearched = (mysliding != NULL);
+    if (issearched)
+        mysliding->search(xyzcoords, foundelems, foundkietaphis);
+    else
+        issearched = getsearch(xyzcoords, foundelems, foundkietaphis);
+    
+    expression(myarg).interpolate(myphysreg, meshdeform, xyzcoords, interpolated, isfound, -1, &foundelems, &foundkietaphis);
+    
+    if (not(issearched))
+        setsearch(xyzcoords, foundelems, foundkietaphis);
     
     if (myerrorifnotfound)
     {
@@ -110,9 +215,9 @@ std::vector<std::vector<densemat>> opon::interpolate(elementselector& elemselect
     }
     
     
-    universe::isreuseallowed = wasreuseallowed;   
+    universe::getcontext()->isreuseallowed = wasreuseallowed;   
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), outvec);
         
     return outvec;
@@ -121,15 +226,15 @@ std::vector<std::vector<densemat>> opon::interpolate(elementselector& elemselect
 densemat opon::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
     }
 
     // Otherwise the stored data will be used during the interpolation step (on wrong ki, eta, phi coordinates):
-    bool wasreuseallowed = universe::isreuseallowed;
-    universe::isreuseallowed = false;
+    bool wasreuseallowed = universe::getcontext()->isreuseallowed;
+    universe::getcontext()->isreuseallowed = false;
     
 
     // Calculate the x, y and z coordinates at which to interpolate:
@@ -186,7 +291,19 @@ densemat opon::multiharmonicinterpolate(int numtimeevals, elementselector& elems
     std::vector<std::vector<double>> interpolated;
     std::vector<bool> isfound;
     
-    expression(myarg).interpolate(myphysreg, meshdeform, xyzcoords, interpolated, isfound, numtimeevals);
+    // Reuse the point search output if available (the sliding interface lookup is cheaper than the cache):
+    std::vector<std::vector<int>> foundelems;
+    std::vector<std::vector<double>> foundkietaphis;
+    bool issearched = (mysliding != NULL);
+    if (issearched)
+        mysliding->search(xyzcoords, foundelems, foundkietaphis);
+    else
+        issearched = getsearch(xyzcoords, foundelems, foundkietaphis);
+    
+    expression(myarg).interpolate(myphysreg, meshdeform, xyzcoords, interpolated, isfound, numtimeevals, &foundelems, &foundkietaphis);
+    
+    if (not(issearched))
+        setsearch(xyzcoords, foundelems, foundkietaphis);
 
     if (myerrorifnotfound)
     {
@@ -209,9 +326,9 @@ densemat opon::multiharmonicinterpolate(int numtimeevals, elementselector& elems
         outmatvals[i] = interpolated[0][i];
     
     
-    universe::isreuseallowed = wasreuseallowed;
+    universe::getcontext()->isreuseallowed = wasreuseallowed;
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), outmat);
         
     return outmat;
@@ -255,9 +372,9 @@ std::shared_ptr<operation> opon::copy(void)
     return op;
 }
 
-void opon::print(void)
+void opon::print(std::ostream& out)
 {
-    std::cout << "on(" << myphysreg << ", ";
-    myarg->print();
-    std::cout << ")";
+    out << "on(" << myphysreg << ", ";
+    myarg->print(out);
+    out << ")";
 }
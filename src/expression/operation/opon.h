@@ -7,8 +7,11 @@
 #ifndef OPON_H
 #define OPON_H
 
+#include <mutex>
+#include <unordered_map>
 #include "operation.h"
 #include "expression.h"
+#include "rawslidinginterface.h"
 
 class opon: public operation
 {
@@ -22,10 +25,25 @@ class opon: public operation
         // No shift if empty:
         std::vector<expression> mycoordshift = {};
         std::shared_ptr<operation> myarg;
+        // The point search is replaced by the sliding interface lookup if not NULL:
+        std::shared_ptr<rawslidinginterface> mysliding = NULL;
+        
+        // The elements and reference coordinates found by the point search are kept for every set of (x,y,z)
+        // coordinates at which the argument is interpolated. They are reused on the same mesh state for the
+        // same coordinates (i.e. until the mesh geometry or the coordinate shift value changes):
+        static std::mutex searchmutex;
+        // Return true and the point search output if available:
+        bool getsearch(std::vector<double>& xyzcoords, std::vector<std::vector<int>>& foundelems, std::vector<std::vector<double>>& foundkietaphis);
+        void setsearch(std::vector<double>& xyzcoords, std::vector<std::vector<int>>& foundelems, std::vector<std::vector<double>>& foundkietaphis);
         
     public:
         
-        opon(int physreg, expression* coordshift, std::shared_ptr<operation> arg, bool errorifnotfound);
+        // Maximum number of point searches kept (all are removed when full):
+        static int maxnumsearches;
+        
+        static void clearsearches(void);
+        
+        opon(int physreg, expression* coordshift, std::shared_ptr<operation> arg, bool errorifnotfound, std::shared_ptr<rawslidinginterface> sliding = NULL);
         
         std::vector<std::vector<densemat>> interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
         densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
@@ -33,11 +51,14 @@ class opon: public operation
         std::vector<std::shared_ptr<operation>> getarguments(void);
         std::shared_ptr<operation> simplify(std::vector<int> disjregs);
         
+        // The interpolation on the other region relies on a point search:
+        bool isthreadsafe(std::vector<int> disjregs) { return false; };
+        
         std::shared_ptr<operation> copy(void);
         
         void reuseit(bool istobereused) { reuse = istobereused; };
 
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
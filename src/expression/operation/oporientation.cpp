@@ -4,7 +4,7 @@
 std::vector<std::vector<densemat>> oporientation::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -34,7 +34,7 @@ std::vector<std::vector<densemat>> oporientation::interpolate(elementselector& e
     
 
     // Calculate the orientations:
-    std::vector<double>* nodecoords = universe::getrawmesh()->getnodes()->getcoordinates();
+    const std::vector<double>* nodecoords = universe::getrawmesh()->getnodes()->readcoordinates();
     elements* els = universe::getrawmesh()->getelements();
     
     std::vector<int> celltypes(numelems), cellnums(numelems);
@@ -142,7 +142,7 @@ std::vector<std::vector<densemat>> oporientation::interpolate(elementselector& e
     
     output = output.duplicatehorizontally(numevalpts);
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), {{},{output}});
     
     return {{},{output}};
@@ -151,7 +151,7 @@ std::vector<std::vector<densemat>> oporientation::interpolate(elementselector& e
 densemat oporientation::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -162,7 +162,7 @@ densemat oporientation::multiharmonicinterpolate(int numtimeevals, elementselect
     output = output.getflattened();
     output = output.duplicatevertically(numtimeevals);
 
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
@@ -176,5 +176,5 @@ std::shared_ptr<operation> oporientation::copy(void)
     return op;
 }
 
-void oporientation::print(void) {}
+void oporientation::print(std::ostream& out) {}
 
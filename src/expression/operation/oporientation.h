@@ -29,7 +29,7 @@ class oporientation: public operation
         
         void reuseit(bool istobereused) { reuse = istobereused; };
 
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
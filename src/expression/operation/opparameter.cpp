@@ -4,7 +4,7 @@
 std::vector<std::vector<densemat>> opparameter::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(myparameter, myrow, mycolumn);
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -12,7 +12,7 @@ std::vector<std::vector<densemat>> opparameter::interpolate(elementselector& ele
     
     std::vector<std::vector<densemat>> output = myparameter->interpolate(myrow, mycolumn, elemselect, evaluationcoordinates, meshdeform);
     
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), output);
     return output;
 }
@@ -20,7 +20,7 @@ std::vector<std::vector<densemat>> opparameter::interpolate(elementselector& ele
 densemat opparameter::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available:
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(myparameter, myrow, mycolumn);
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -28,7 +28,7 @@ densemat opparameter::multiharmonicinterpolate(int numtimeevals, elementselector
     
     densemat output = myparameter->multiharmonicinterpolate(myrow, mycolumn, numtimeevals, elemselect, evaluationcoordinates, meshdeform);
             
-    if (universe::isreuseallowed)
+    if (universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     return output;
 }
@@ -60,6 +60,21 @@ bool opparameter::isvalueorientationdependent(std::vector<int> disjregs)
     return false;
 }
 
+bool opparameter::isthreadsafe(std::vector<int> disjregs)
+{
+    for (int i = 0; i < disjregs.size(); i++)
+    {
+        if ( (myparameter->get(disjregs[i], myrow, mycolumn))->isthreadsafe({disjregs[i]}) == false )
+            return false;
+    }
+    return true;
+}
+
+long long int opparameter::getstate(void)
+{
+    return myparameter->getstate();
+}
+
 std::shared_ptr<operation> opparameter::copy(void)
 {
     std::shared_ptr<opparameter> op(new opparameter(myparameter, myrow, mycolumn));
@@ -67,4 +82,4 @@ std::shared_ptr<operation> opparameter::copy(void)
     return op;
 }
 
-void opparameter::print(void) { std::cout << "param" << myparameter->countrows() << "x" << myparameter->countcolumns() << "(" << myrow << "," << mycolumn << ")"; }
+void opparameter::print(std::ostream& out) { out << "param" << myparameter->countrows() << "x" << myparameter->countcolumns() << "(" << myrow << "," << mycolumn << ")"; }
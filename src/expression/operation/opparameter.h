@@ -42,10 +42,12 @@ class opparameter: public operation
         
         std::shared_ptr<operation> simplify(std::vector<int> disjregs);
         bool isvalueorientationdependent(std::vector<int> disjregs);
+        bool isthreadsafe(std::vector<int> disjregs);
+        long long int getstate(void);
         
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
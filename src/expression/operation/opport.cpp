@@ -40,6 +40,11 @@ bool opport::isharmonicone(std::vector<int> disjregs)
     return (myharms.size() == 1 && myharms[0] == 1);
 }
 
+long long int opport::getstate(void)
+{
+    return universe::getnewstate();
+}
+
 std::shared_ptr<operation> opport::copy(void)
 {
     std::shared_ptr<opport> op(new opport(myport));
@@ -47,16 +52,16 @@ std::shared_ptr<operation> opport::copy(void)
     return op;
 }
 
-void opport::print(void)
+void opport::print(std::ostream& out)
 {
     for (int i = 0; i < timederivativeorder; i++)
-        std::cout << "dt";
+        out << "dt";
         
     std::string portname = myport->getname();
 
     if (portname.size() == 0)
-        std::cout << "port";
+        out << "port";
     else
-        std::cout << portname;
+        out << portname;
 }
 
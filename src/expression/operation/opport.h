@@ -36,9 +36,12 @@ class opport: public operation
 
         bool isharmonicone(std::vector<int> disjregs);
         
+        // The port values are not tracked:
+        long long int getstate(void);
+        
         std::shared_ptr<operation> copy(void);
 
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
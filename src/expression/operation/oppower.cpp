@@ -4,7 +4,7 @@
 std::vector<std::vector<densemat>> oppower::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -17,7 +17,7 @@ std::vector<std::vector<densemat>> oppower::interpolate(elementselector& elemsel
     {
         computedbase[1][0].power(computedexponent[1][0]);
         
-        if (reuse && universe::isreuseallowed)
+        if (reuse && universe::getcontext()->isreuseallowed)
             universe::setprecomputed(shared_from_this(), computedbase);
         
         return computedbase;
@@ -30,7 +30,7 @@ std::vector<std::vector<densemat>> oppower::interpolate(elementselector& elemsel
 densemat oppower::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -41,7 +41,7 @@ densemat oppower::multiharmonicinterpolate(int numtimeevals, elementselector& el
 
     computedbase.power(computedexponent);
             
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), computedbase);
     
     return computedbase;
@@ -81,11 +81,11 @@ std::vector<double> oppower::evaluate(std::vector<double>& xcoords, std::vector<
     return evaluatedbase;
 }
 
-void oppower::print(void)
+void oppower::print(std::ostream& out)
 {
-    std::cout << "(";
-    mybase->print();
-    std::cout << ")^(";
-    myexponent->print();
-    std::cout << ")";
+    out << "(";
+    mybase->print(out);
+    out << ")^(";
+    myexponent->print(out);
+    out << ")";
 }
@@ -4,7 +4,7 @@
 std::vector<std::vector<densemat>> opproduct::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -52,6 +52,7 @@ std::vector<std::vector<densemat>> opproduct::interpolate(elementselector& elems
             std::vector<std::vector<densemat>> tempproduct = {};
         
             // Loop on all product harmonics:
+            std::vector<std::pair<int, double>> harmsofproduct;
             for (int pharm = 0; pharm < product.size(); pharm++)
             {
                 if (product[pharm].size() == 0)
@@ -67,7 +68,7 @@ std::vector<std::vector<densemat>> opproduct::interpolate(elementselector& elems
                     densemat curprod = product[pharm][0].copy();
                     curprod.multiplyelementwise(currentterm[charm][0]);
                 
-                    std::vector<std::pair<int, double>> harmsofproduct = harmonic::getproduct(pharm, charm);
+                    harmonic::getproduct(pharm, charm, 0, harmsofproduct);
 
                     for (int p = 0; p < harmsofproduct.size(); p++)
                     {
@@ -92,7 +93,7 @@ std::vector<std::vector<densemat>> opproduct::interpolate(elementselector& elems
         }
     }
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), product);
     
     return product;
@@ -101,7 +102,7 @@ std::vector<std::vector<densemat>> opproduct::interpolate(elementselector& elems
 densemat opproduct::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -112,7 +113,7 @@ densemat opproduct::multiharmonicinterpolate(int numtimeevals, elementselector&
     for (int i = 1; i < productterms.size(); i++)
         output.multiplyelementwise(productterms[i]->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform));
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
@@ -267,12 +268,12 @@ std::vector<double> opproduct::evaluate(std::vector<double>& xcoords, std::vecto
     return evaluated;
 }
 
-void opproduct::print(void)
+void opproduct::print(std::ostream& out)
 {
     for (int i = 0; i < productterms.size(); i++)
     {
         if (i > 0) 
-            std::cout << " * ";
-        productterms[i]->print();
+            out << " * ";
+        productterms[i]->print(out);
     }
 }
@@ -0,0 +1,31 @@
+#include "opprofile.h"
+#include "exprprofiler.h"
+#include "memorypool.h"
+#include <chrono>
+
+
+std::vector<std::vector<densemat>> opprofile::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    long long int numbytesbefore = memorypool::countthreadbytes();
+    std::chrono::steady_clock::time_point starttime = std::chrono::steady_clock::now();
+    
+    std::vector<std::vector<densemat>> output = myarg->interpolate(elemselect, evaluationcoordinates, meshdeform);
+    
+    double time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - starttime).count();
+    exprprofiler::add(mynode, time, memorypool::countthreadbytes() - numbytesbefore);
+    
+    return output;
+}
+
+densemat opprofile::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    long long int numbytesbefore = memorypool::countthreadbytes();
+    std::chrono::steady_clock::time_point starttime = std::chrono::steady_clock::now();
+    
+    densemat output = myarg->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform);
+    
+    double time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - starttime).count();
+    exprprofiler::add(mynode, time, memorypool::countthreadbytes() - numbytesbefore);
+    
+    return output;
+}
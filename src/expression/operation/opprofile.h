@@ -0,0 +1,80 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This operation evaluates its argument and adds the time spent and the memory pool bytes 
+// requested to a node of the 'exprprofiler' object. All other calls are forwarded as is.
+
+#ifndef OPPROFILE_H
+#define OPPROFILE_H
+
+#include "operation.h"
+
+class opprofile: public operation
+{
+
+    private:
+        
+        std::shared_ptr<operation> myarg;
+        int mynode;
+        
+    public:
+        
+        opprofile(std::shared_ptr<operation> arg, int node) { myarg = arg; mynode = node; };
+        
+        std::vector<std::vector<densemat>> interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+        densemat multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+        std::vector<std::vector<densemat>> interpolate(int kietaphiderivative, elementselector& elemselect, std::vector<double>& evaluationcoordinates) { return myarg->interpolate(kietaphiderivative, elemselect, evaluationcoordinates); };
+        
+        bool isdof(void) { return myarg->isdof(); };
+        bool istf(void) { return myarg->istf(); };
+        bool issum(void) { return myarg->issum(); };
+        bool isproduct(void) { return myarg->isproduct(); };
+        bool isfield(void) { return myarg->isfield(); };
+        bool isconstant(void) { return myarg->isconstant(); };
+        bool isparameter(void) { return myarg->isparameter(); };
+        bool isport(void) { return myarg->isport(); };
+        
+        bool isdofincluded(void) { return myarg->isdofincluded(); };
+        bool istfincluded(void) { return myarg->istfincluded(); };
+        bool isportincluded(void) { return myarg->isportincluded(); };
+        bool isharmonicone(std::vector<int> disjregs) { return myarg->isharmonicone(disjregs); };
+        
+        double getvalue(void) { return myarg->getvalue(); };
+        std::shared_ptr<rawparameter> getparameterpointer(void) { return myarg->getparameterpointer(); };
+        int getselectedrow(void) { return myarg->getselectedrow(); };
+        int getselectedcol(void) { return myarg->getselectedcol(); };
+        std::shared_ptr<rawport> getportpointer(void) { return myarg->getportpointer(); };
+        std::shared_ptr<rawfield> getfieldpointer(void) { return myarg->getfieldpointer(); };
+        int count(void) { return myarg->count(); };
+        
+        void reuseit(bool istobereused) { myarg->reuseit(istobereused); };
+        bool isreused(void) { return myarg->isreused(); };
+        
+        int getphysicalregion(void) { return myarg->getphysicalregion(); };
+        int getspacederivative(void) { return myarg->getspacederivative(); };
+        int gettimederivative(void) { return myarg->gettimederivative(); };
+        int getkietaphiderivative(void) { return myarg->getkietaphiderivative(); };
+        int getformfunctioncomponent(void) { return myarg->getformfunctioncomponent(); };
+        int getfieldcomponent(void) { return myarg->getfieldcomponent(); };
+        
+        bool isvalueorientationdependent(std::vector<int> disjregs) { return myarg->isvalueorientationdependent(disjregs); };
+        bool isthreadsafe(std::vector<int> disjregs) { return myarg->isthreadsafe(disjregs); };
+        long long int getstate(void) { return myarg->getstate(); };
+        
+        std::shared_ptr<operation> copy(void) { return std::shared_ptr<operation>(new opprofile(myarg, mynode)); };
+        
+        std::vector<std::shared_ptr<operation>> getarguments(void) { return myarg->getarguments(); };
+        
+        double evaluate(void) { return myarg->evaluate(); };
+        std::vector<double> evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords) { return myarg->evaluate(xcoords, ycoords, zcoords); };
+        
+        bool ison(void) { return myarg->ison(); };
+        oncontext* getoncontext(void) { return myarg->getoncontext(); };
+        
+        void print(std::ostream& out) { myarg->print(out); };
+
+};
+
+#endif
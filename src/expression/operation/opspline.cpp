@@ -9,7 +9,7 @@ opspline::opspline(spline spl, std::shared_ptr<operation> arg)
 std::vector<std::vector<densemat>> opspline::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -21,7 +21,7 @@ std::vector<std::vector<densemat>> opspline::interpolate(elementselector& elemse
     {
         argmat[1][0] = myspline.evalat(argmat[1][0]);
         
-        if (reuse && universe::isreuseallowed)
+        if (reuse && universe::getcontext()->isreuseallowed)
             universe::setprecomputed(shared_from_this(), argmat);
         
         return argmat;
@@ -34,7 +34,7 @@ std::vector<std::vector<densemat>> opspline::interpolate(elementselector& elemse
 densemat opspline::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -43,7 +43,7 @@ densemat opspline::multiharmonicinterpolate(int numtimeevals, elementselector& e
     densemat output = myarg->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform);
     output = myspline.evalat(output);
             
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
@@ -64,9 +64,9 @@ std::shared_ptr<operation> opspline::copy(void)
     return op;
 }
 
-void opspline::print(void)
+void opspline::print(std::ostream& out)
 {
-    std::cout << "spline(";
-    myarg->print();
-    std::cout << ")";
+    out << "spline(";
+    myarg->print(out);
+    out << ")";
 }
@@ -15,7 +15,7 @@ void opsum::subtractterm(std::shared_ptr<operation> term)
 std::vector<std::vector<densemat>> opsum::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvalue(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputed(precomputedindex); }
@@ -51,7 +51,7 @@ std::vector<std::vector<densemat>> opsum::interpolate(elementselector& elemselec
         }
     }
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputed(shared_from_this(), output);
     
     return output;
@@ -60,7 +60,7 @@ std::vector<std::vector<densemat>> opsum::interpolate(elementselector& elemselec
 densemat opsum::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -71,7 +71,7 @@ densemat opsum::multiharmonicinterpolate(int numtimeevals, elementselector& elem
     for (int i = 1; i < sumterms.size(); i++)
         output.add(sumterms[i]->multiharmonicinterpolate(numtimeevals, elemselect, evaluationcoordinates, meshdeform));
     
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
@@ -172,14 +172,14 @@ std::vector<double> opsum::evaluate(std::vector<double>& xcoords, std::vector<do
     return evaluated;
 }
 
-void opsum::print(void)
+void opsum::print(std::ostream& out)
 {
-    std::cout << "(";
+    out << "(";
     for (int i = 0; i < sumterms.size(); i++)
     {
         if (i > 0)
-            std::cout << " + ";
-        sumterms[i]->print();
+            out << " + ";
+        sumterms[i]->print(out);
     }
-    std::cout << ")";
+    out << ")";
 }
@@ -60,7 +60,7 @@ class optf: public operation
         
         std::shared_ptr<operation> copy(void);
         
-        void print(void);
+        void print(std::ostream& out);
 
 };
 
@@ -3,20 +3,20 @@
 
 std::vector<std::vector<densemat>> optime::interpolate(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
-    if (universe::fundamentalfrequency > 0)
+    if (universe::getsession()->fundamentalfrequency > 0)
     {
         std::cout << "Error in 'optime' object: the time variable 't' cannot be computed without FFT in harmonic domain" << std::endl;
         abort();
     }
 
-    densemat output(elemselect.countinselection(), evaluationcoordinates.size()/3, universe::currenttimestep);
+    densemat output(elemselect.countinselection(), evaluationcoordinates.size()/3, universe::getsession()->currenttimestep);
     return {{},{output}};
 }
 
 densemat optime::multiharmonicinterpolate(int numtimeevals, elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
 {
     // Get the value from the universe if available and reuse is enabled:
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
     {
         int precomputedindex = universe::getindexofprecomputedvaluefft(shared_from_this());
         if (precomputedindex >= 0) { return universe::getprecomputedfft(precomputedindex); }
@@ -36,12 +36,17 @@ densemat optime::multiharmonicinterpolate(int numtimeevals, elementselector& ele
             outptr[i*ncols+j] = tval;
     }
             
-    if (reuse && universe::isreuseallowed)
+    if (reuse && universe::getcontext()->isreuseallowed)
         universe::setprecomputedfft(shared_from_this(), output);
     
     return output;
 }
 
+long long int optime::getstate(void)
+{
+    return universe::getnewstate();
+}
+
 std::shared_ptr<operation> optime::copy(void)
 {
     std::shared_ptr<optime> op(new optime);
@@ -52,8 +57,8 @@ std::shared_ptr<operation> optime::copy(void)
 
 double optime::evaluate(void)
 {
-    if (universe::fundamentalfrequency <= 0)
-        return universe::currenttimestep;
+    if (universe::getsession()->fundamentalfrequency <= 0)
+        return universe::getsession()->currenttimestep;
     else
     {
         std::cout << "Error in 'optime' object: the time variable 't' cannot be evaluated in harmonic domain" << std::endl;
@@ -63,8 +68,8 @@ double optime::evaluate(void)
 
 std::vector<double> optime::evaluate(std::vector<double>& xcoords, std::vector<double>& ycoords, std::vector<double>& zcoords)
 {
-    if (universe::fundamentalfrequency <= 0)
-        return std::vector<double>(xcoords.size(), universe::currenttimestep);
+    if (universe::getsession()->fundamentalfrequency <= 0)
+        return std::vector<double>(xcoords.size(), universe::getsession()->currenttimestep);
     else
     {
         std::cout << "Error in 'optime' object: the time variable 't' cannot be evaluated in harmonic domain" << std::endl;
@@ -72,7 +77,7 @@ std::vector<double> optime::evaluate(std::vector<double>& xcoords, std::vector<d
     }
 }
 
-void optime::print(void)
+void optime::print(std::ostream& out)
 {
-    std::cout << "t";
+    out << "t";
 }
@@ -1,10 +1,13 @@
 #include "sl.h"
 #include <random>
+#include <fstream>
+#include <sstream>
 #include "rawpoint.h"
 #include "rawline.h"
 #include "rawsurface.h"
 #include "rawvolume.h"
 #include "slmpi.h"
+#include "symbolicderivative.h"
 
 
 int sl::getversion(void)
@@ -74,49 +77,98 @@ bool sl::isempty(int physreg)
 {
     universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
 
-    std::vector<bool> defin = universe::getrawmesh()->getphysicalregions()->get(physreg)->getdefinition();
-    
-    for (int i = 0; i < defin.size(); i++)
-    {
-        if (defin[i] == true)
-            return false;
-    }
-    
-    return true;
+    return universe::getrawmesh()->getphysicalregions()->get(physreg)->getdefinitionbits()->isempty();
 }
 
 bool sl::isinside(int physregtocheck, int physreg)
 {
     universe::getrawmesh()->getphysicalregions()->errorundefined({physregtocheck,physreg});
     
-    std::vector<bool> tocheckdefin = universe::getrawmesh()->getphysicalregions()->get(physregtocheck)->getdefinition();
-    std::vector<bool> defin = universe::getrawmesh()->getphysicalregions()->get(physreg)->getdefinition();
+    regionbits* tocheckdefin = universe::getrawmesh()->getphysicalregions()->get(physregtocheck)->getdefinitionbits();
+    regionbits* defin = universe::getrawmesh()->getphysicalregions()->get(physreg)->getdefinitionbits();
     
     // All disjoint regions must be included:
-    for (int i = 0; i < tocheckdefin.size(); i++)
-    {
-        if (tocheckdefin[i] == true && defin[i] == false)
-            return false;
-    }
-
-    return true;
+    return tocheckdefin->isinside(*defin);
 }
 
 bool sl::istouching(int physregtocheck, int physreg)
 {
     universe::getrawmesh()->getphysicalregions()->errorundefined({physregtocheck,physreg});
     
-    std::vector<bool> tocheckdefin = universe::getrawmesh()->getphysicalregions()->get(physregtocheck)->getdefinition();
-    std::vector<bool> defin = universe::getrawmesh()->getphysicalregions()->get(physreg)->getdefinition();
+    regionbits* tocheckdefin = universe::getrawmesh()->getphysicalregions()->get(physregtocheck)->getdefinitionbits();
+    regionbits* defin = universe::getrawmesh()->getphysicalregions()->get(physreg)->getdefinitionbits();
     
     // At least one disjoint region must be included:
-    for (int i = 0; i < tocheckdefin.size(); i++)
+    return tocheckdefin->istouching(*defin);
+}
+
+void sl::locate(int physreg, std::vector<double>& xyzcoord, std::vector<int>& elems, std::vector<double>& kietaphis)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    if (xyzcoord.size()%3 != 0)
+    {
+        std::cout << "Error in 'sl' namespace: the coordinate vector should have a size multiple of 3 (x,y,z)" << std::endl;
+        abort();
+    }
+    int numcoords = xyzcoord.size()/3;
+    
+    elems = std::vector<int>(2*numcoords, -1);
+    kietaphis = std::vector<double>(3*numcoords, 0.0);
+    
+    std::vector<int> disjregs = universe::getrawmesh()->getphysicalregions()->get(physreg)->getdisjointregions();
+    disjointregionselector mydisjregselector(disjregs, {});
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
     {
-        if (tocheckdefin[i] == true && defin[i] == true)
-            return true;
+        std::vector<int> curdisjregs = mydisjregselector.getgroup(i);
+        int elemtypenum = universe::getrawmesh()->getdisjointregions()->getelementtypenumber(curdisjregs[0]);
+        
+        // The coordinates already found in another element type are skipped:
+        std::vector<int> curelems(numcoords, -1);
+        for (int c = 0; c < numcoords; c++)
+        {
+            if (elems[2*c+0] != -1)
+                curelems[c] = -2;
+        }
+        
+        for (int d = 0; d < curdisjregs.size(); d++)
+            gentools::getreferencecoordinates(xyzcoord, curdisjregs[d], curelems, kietaphis);
+            
+        for (int c = 0; c < numcoords; c++)
+        {
+            if (curelems[c] >= 0)
+            {
+                elems[2*c+0] = elemtypenum;
+                elems[2*c+1] = curelems[c];
+            }
+        }
     }
+}
 
-    return false;
+void sl::printmemory(void)
+{
+    std::shared_ptr<rawmesh> rm = universe::getsession()->myrawmesh;
+    if (rm != NULL)
+    {
+        // The original mesh also reports the h-adapted mesh in use:
+        if (rm->gethtracker() != NULL)
+            rm = rm->getoriginalmeshpointer();
+        rm->getmemoryusage().print("Mesh memory");
+    }
+    
+    // Current and peak resident memory of the process:
+    std::ifstream statusfile("/proc/self/status");
+    std::string line;
+    while (std::getline(statusfile, line))
+    {
+        if (line.compare(0, 6, "VmRSS:") == 0 || line.compare(0, 6, "VmHWM:") == 0)
+        {
+            std::stringstream ss(line.substr(6));
+            long long int kb = 0;
+            ss >> kb;
+            std::cout << (line[2] == 'R' ? "Resident memory: " : "Peak resident memory: ") << memoryusage::tostring(1024*kb) << std::endl;
+        }
+    }
 }
 
 void sl::printvector(std::vector<double> input)
@@ -145,70 +197,12 @@ void sl::printvector(std::vector<bool> input)
 
 void sl::writevector(std::string filename, std::vector<double> towrite, char delimiter, bool writesize)
 {
-    if (towrite.size() == 0)
-        return;
-
-    // 'file' cannot take a std::string argument --> filename.c_str():
-    std::ofstream name (filename.c_str());
-    if (name.is_open())
-    {
-        if (writesize)
-            name << towrite.size() << delimiter;
-
-        // To write all doubles with enough digits to the file:
-        name << std::setprecision(17);
-
-        for (int i = 0; i < towrite.size()-1; i++)
-            name << towrite[i] << delimiter;
-        name << towrite[towrite.size()-1];
-
-        name.close();
-    }
-    else
-    {
-        std::cout << "Unable to write vector to file " << filename << " or file not found" << std::endl;
-        abort();
-    }
+    vectorstream::writevector(filename, towrite, delimiter, writesize);
 }
 
 std::vector<double> sl::loadvector(std::string filename, char delimiter, bool sizeincluded)
 {
-    std::vector<double> output = {};
-
-    std::string currentline;
-
-    // 'file' cannot take a std::string argument --> filename.c_str():
-    std::ifstream name (filename.c_str());
-    if (name.is_open())
-    {
-        if (sizeincluded)
-        {
-            std::getline(name, currentline, delimiter);
-            gentools::osclean(currentline);
-            output.resize(std::stoi(currentline));
-        }
-
-        int index = 0;
-        while (std::getline(name, currentline, delimiter))
-        {
-            gentools::osclean(currentline);
-            if (sizeincluded)
-                output[index] = std::stod(currentline);
-            else
-                output.push_back(std::stod(currentline));
-
-            index++;
-        }
-
-        name.close();
-    }
-    else
-    {
-        std::cout << "Unable to load vector from file " << filename << " or file not found" << std::endl;
-        abort();
-    }
-
-    return output;
+    return vectorstream::loadvector(filename, delimiter, sizeincluded);
 }
 
 #ifndef HAVE_GMSH
@@ -305,7 +299,7 @@ expression sl::getnormal(int physreg)
     {
         expression mynorm = sqrt(expr.invjac(0,1)*expr.invjac(0,1)+expr.invjac(1,1)*expr.invjac(1,1));
         mynorm.reuseit();
-        if (universe::isaxisymmetric)
+        if (universe::getsession()->isaxisymmetric)
             output = array3x1(expr.invjac(0,1), expr.invjac(1,1), 0)/mynorm;
         else
             output = array2x1(expr.invjac(0,1), expr.invjac(1,1))/mynorm;
@@ -341,7 +335,7 @@ expression sl::tangent(void)
     {
         expression mynorm = sqrt(expr.jac(0,0)*expr.jac(0,0)+expr.jac(0,1)*expr.jac(0,1));
         mynorm.reuseit();
-        if (universe::isaxisymmetric)
+        if (universe::getsession()->isaxisymmetric)
             return array3x1(expr.jac(0,0), expr.jac(0,1), 0)/mynorm;
         else
             return array2x1(expr.jac(0,0), expr.jac(0,1))/mynorm;
@@ -379,6 +373,17 @@ void sl::scatterwrite(std::string filename, std::vector<double> xcoords, std::ve
         abort();
     }
 
+    // Tables with one row per point and the coordinates then the values in the columns:
+    if (filename.size() >= 5 && (filename.substr(filename.size()-4,4) == ".csv" || filename.substr(filename.size()-4,4) == ".npy"))
+    {
+        vectorstream table(filename);
+        if (isscalar)
+            table.write({xcoords, ycoords, zcoords, compxevals});
+        else
+            table.write({xcoords, ycoords, zcoords, compxevals, compyevals, compzevals});
+        return;
+    }
+
     iodata datatowrite(1, 1, isscalar, {});
     datatowrite.addcoordinates(0, densemat(n,1,xcoords), densemat(n,1,ycoords), densemat(n,1,zcoords));
     if (isscalar)
@@ -393,17 +398,19 @@ void sl::scatterwrite(std::string filename, std::vector<double> xcoords, std::ve
 void sl::setaxisymmetry(void)
 {
     // Make sure the call is done before loading the mesh:
-    if (universe::myrawmesh != NULL)
+    if (universe::getsession()->myrawmesh != NULL)
     {
         std::cout << "Error in 'sl' namespace: 'setaxisymmetry' must be called before loading the mesh" << std::endl;
         abort();
     }
-    universe::isaxisymmetric = true;
+    universe::getsession()->isaxisymmetric = true;
 }
 
-void sl::setfundamentalfrequency(double f) { universe::fundamentalfrequency = f; }
-void sl::settime(double t) { universe::currenttimestep = t; }
-double sl::gettime(void) { return universe::currenttimestep; }
+void sl::allowmeshrenumbering(bool isallowed) { universe::allowmeshrenumbering(isallowed); }
+
+void sl::setfundamentalfrequency(double f) { universe::getsession()->fundamentalfrequency = f; }
+void sl::settime(double t) { universe::getsession()->currenttimestep = t; }
+double sl::gettime(void) { return universe::getsession()->currenttimestep; }
 
 expression sl::meshsize(int integrationorder)
 {
@@ -555,7 +562,7 @@ std::vector<double> sl::gettotalforce(int physreg, expression* meshdeform, expre
     int wholedomain = universe::getrawmesh()->getphysicalregions()->createunionofall();
 
     int numcomps = universe::getrawmesh()->getmeshdimension();
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
         numcomps++;
     if (numcomps == 1)
     {
@@ -588,7 +595,7 @@ std::vector<double> sl::gettotalforce(int physreg, expression* meshdeform, expre
         output[c] = vecvals.sum();
     }
     
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
         output = {0, 2.0*getpi()*output[1], 0};
     
     universe::getrawmesh()->getphysicalregions()->remove({wholedomain}, false);
@@ -722,6 +729,11 @@ void sl::writeshapefunctions(std::string filename, std::string sftypename, int e
 
 expression sl::t(void) { expression exp; return exp.time(); }
 
+void sl::flushoutput(void)
+{
+    asyncwriter::flush();
+}
+
 void sl::grouptimesteps(std::string filename, std::vector<std::string> filestogroup, std::vector<double> timevals)
 {
     iointerface::grouptimesteps(filename, filestogroup, timevals);
@@ -750,7 +762,7 @@ std::vector<std::vector<shape>> sl::loadshape(std::string meshfile)
     loadedmesh->readfromfile(tool, source);
     
     nodes* loadednodes = loadedmesh->getnodes();
-    std::vector<double>* nodecoords = loadednodes->getcoordinates();
+    const std::vector<double>* nodecoords = loadednodes->readcoordinates();
     int totalnumnodes = nodecoords->size()/3;
     elements* loadedelems = loadedmesh->getelements();
     physicalregions* loadedphysregs = loadedmesh->getphysicalregions();
@@ -836,12 +848,12 @@ std::vector<std::vector<shape>> sl::loadshape(std::string meshfile)
 
 void sl::settimederivative(vec dtx)
 {
-    universe::xdtxdtdtx = {{},{dtx},{}};
+    universe::getsession()->xdtxdtdtx = {{},{dtx},{}};
 }
 
 void sl::settimederivative(vec dtx, vec dtdtx)
 {
-    universe::xdtxdtdtx = {{},{dtx},{dtdtx}};
+    universe::getsession()->xdtxdtdtx = {{},{dtx},{dtdtx}};
 }
 
 expression sl::dx(expression input) { return input.spacederivative(1); }
@@ -959,6 +971,11 @@ expression sl::on(int physreg, expression coordshift, expression expr, bool erro
     return expr.on(physreg, &coordshift, errorifnotfound);
 }
 
+expression sl::on(slidinginterface si, expression expr, bool errorifnotfound)
+{
+    return expr.on(si.getphysicalregion(), NULL, errorifnotfound, si.getpointer());
+}
+
 expression sl::comp(int selectedcomp, expression input)
 {
     std::vector<expression> mycomp(input.countcolumns());
@@ -1003,7 +1020,7 @@ expression sl::grad(expression input)
     }
 
     // Cylindrical transformation of the gradient of a vector (different than of a scalar):
-    if (universe::isaxisymmetric && input.countrows() > 1)
+    if (universe::getsession()->isaxisymmetric && input.countrows() > 1)
     {
         // Coordinate x on the deformed mesh:
         expression x = input.jac(2,2);
@@ -1016,7 +1033,7 @@ expression sl::grad(expression input)
 
     int problemdimension = universe::getrawmesh()->getmeshdimension();
     // In case of axisymmetry we need a 3 component output vector:
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
         problemdimension++;
 
     std::vector<expression> myexprs = {};
@@ -1043,7 +1060,7 @@ expression sl::div(expression input)
         abort();
     }
 
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
     {
         // Coordinate x on the deformed mesh:
         expression x = input.jac(2,2);
@@ -1090,7 +1107,7 @@ expression sl::curl(expression input)
     // The curl of a hcurl type field is computed in a special way:
     if (ishcurlfield == false)
     {
-        if (universe::isaxisymmetric)
+        if (universe::getsession()->isaxisymmetric)
         {
             // Coordinate x on the deformed mesh:
             expression x = input.jac(2,2);
@@ -1307,6 +1324,22 @@ integration sl::integral(int physreg, int numcoefharms, expression meshdeform, e
     return integration(physreg, numcoefharms, meshdeform, tointegrate, integrationorderdelta, blocknumber);
 }
 
+expression sl::derivative(expression input, std::vector<field> fields)
+{
+    return symbolicderivative::differentiate(input, fields);
+}
+
+integration sl::newtonintegral(int physreg, expression residual, std::vector<field> unknowns, int integrationorderdelta, int blocknumber)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    // The Newton step 'r(u) + J(u)*(unew-u) = 0' is solved directly for 'unew':
+    expression tangent = symbolicderivative::differentiate(residual, unknowns, true);
+    expression tangentatfield = symbolicderivative::differentiate(residual, unknowns, false);
+    
+    return integration(physreg, tangent - tangentatfield + residual, integrationorderdelta, blocknumber);
+}
+
 expression sl::dof(expression input)
 {
     return input.dof(-1);
@@ -1363,7 +1396,7 @@ bool sl::alladapt(int verbosity)
     return universe::getrawmesh()->adapthp(verbosity);
 }
 
-expression sl::zienkiewiczzhu(expression input)
+expression sl::zienkiewiczzhu(expression input, double incrementaltolerance)
 {
     std::vector<int> alldisjregs(universe::getrawmesh()->getdisjointregions()->count());
     std::iota(alldisjregs.begin(), alldisjregs.end(), 0);
@@ -1385,7 +1418,7 @@ expression sl::zienkiewiczzhu(expression input)
                 zzexprs[i*n+j] = 0;
             else
             {
-                std::shared_ptr<opestimator> op(new opestimator("zienkiewiczzhu", input.getoperationinarray(i,j)));
+                std::shared_ptr<opestimator> op(new opestimator("zienkiewiczzhu", input.getoperationinarray(i,j), incrementaltolerance));
                 zzexprs[i*n+j] = expression(op);
             }
         }
@@ -1458,6 +1491,11 @@ vec sl::solve(mat A, vec b, std::string soltype, bool diagscaling)
         std::cout << "Error in 'sl' namespace: direct solve of Ax = b failed (A or b is undefined)" << std::endl;
         abort();
     }
+    if (A.getpointer()->ismatrixfree())
+    {
+        std::cout << "Error in 'sl' namespace: direct solve of Ax = b failed (cannot factorize a matrix-free operator)" << std::endl;
+        abort();
+    }
     
     vec breduced = A.eliminate(b);
     
@@ -1467,6 +1505,20 @@ vec sl::solve(mat A, vec b, std::string soltype, bool diagscaling)
     vec sol(std::shared_ptr<rawvec>(new rawvec(breduced.getpointer()->getdofmanager())));
     Vec solpetsc = sol.getpetsc();
 
+    solverstats stats;
+    stats.numsolves = 1;
+
+    bool ismixedprecision = (universe::factorizationprecision > 0);
+
+    // Reuse the ordering and symbolic factorization kept in the sparsity pattern:
+    std::shared_ptr<sparsitypattern> pattern = A.getpointer()->getpattern();
+    if (pattern != NULL && pattern->isfactorizationkept() && A.getpointer()->isfactored() == false && diagscaling == false && ismixedprecision == false)
+    {
+        pattern->solve(A.getpointer(), bpetsc, solpetsc, soltype, stats);
+        solverstats::record(stats);
+        return A.xbmerge(sol, b);
+    }
+
     KSP* ksp = A.getpointer()->getksp();
 
     if (A.getpointer()->isfactored() == false)
@@ -1481,14 +1533,61 @@ vec sl::solve(mat A, vec b, std::string soltype, bool diagscaling)
         KSPSetFromOptions(*ksp);
 
         KSPGetPC(*ksp,&pc);
-        if (soltype == "lu")
+        // Only a Cholesky factorization is possible for matrices in symmetric storage:
+        if (soltype == "lu" && A.getpointer()->issymmetric() == false)
             PCSetType(pc,PCLU);
-        if (soltype == "cholesky")
+        if (soltype == "cholesky" || A.getpointer()->issymmetric())
             PCSetType(pc,PCCHOLESKY);
         PCFactorSetMatSolverType(pc,MATSOLVERMUMPS);
+        universe::configuremumps(pc);
+        
+        // Low precision factorization refined by GMRES on the double precision matrix:
+        if (ismixedprecision)
+        {
+            Mat F;
+            PCFactorSetUpMatSolverType(pc);
+            PCFactorGetMatrix(pc, &F);
+            // Block low-rank factorization with the factors stored compressed:
+            MatMumpsSetIcntl(F, 35, 2);
+            MatMumpsSetCntl(F, 7, universe::factorizationprecision);
+            
+            KSPSetType(*ksp, KSPGMRES);
+            KSPSetTolerances(*ksp, universe::refinementtolerance, PETSC_DEFAULT, PETSC_DEFAULT, 100);
+        }
     }
 
-    KSPSolve(*ksp, bpetsc, solpetsc);
+    {
+        profilephase phase("factorize and solve");
+        
+        // Factorize separately to time the factorization and the solve:
+        if (A.getpointer()->isfactored() == false)
+        {
+            wallclock clk;
+            KSPSetUp(*ksp);
+            stats.factorizationtime = clk.toc()*1e-9;
+            stats.numfactorizations = 1;
+            stats.setfactorizationinfo(*ksp);
+        }
+        else
+            stats.numreuses = 1;
+        
+        wallclock clk;
+        KSPSolve(*ksp, bpetsc, solpetsc);
+        stats.solvetime = clk.toc()*1e-9;
+        
+        if (ismixedprecision)
+        {
+            PetscInt numits;
+            KSPGetIterationNumber(*ksp, &numits);
+            stats.numiterations = numits;
+            
+            KSPConvergedReason reason;
+            KSPGetConvergedReason(*ksp, &reason);
+            if (reason < 0)
+                std::cout << "Warning in 'sl' namespace: the refinement of the mixed precision direct solve did not converge (use a smaller factorization precision)" << std::endl;
+        }
+    }
+    solverstats::record(stats);
 
     A.getpointer()->isfactored(true);
 
@@ -1501,7 +1600,113 @@ vec sl::solve(mat A, vec b, std::string soltype, bool diagscaling)
     return A.xbmerge(sol, b);
 }
 
-std::vector<vec> sl::solve(mat A, std::vector<vec> b, std::string soltype)
+vec sl::solvetranspose(mat A, vec b, std::string soltype)
+{
+    if (soltype != "lu" && soltype != "cholesky")
+    {
+        std::cout << "Error in 'sl' namespace: unknown direct solver type '" << soltype << "' (use 'lu' or 'cholesky')" << std::endl;
+        abort();
+    }
+    if (A.getpointer() == NULL || b.getpointer() == NULL)
+    {
+        std::cout << "Error in 'sl' namespace: transposed direct solve failed (A or b is undefined)" << std::endl;
+        abort();
+    }
+    if (A.countrows() != b.size())
+    {
+        std::cout << "Error in 'sl' namespace: transposed direct solve failed (size of A and b do not match)" << std::endl;
+        abort();
+    }
+    if (A.getpointer()->ismatrixfree())
+    {
+        std::cout << "Error in 'sl' namespace: transposed direct solve failed (cannot factorize a matrix-free operator)" << std::endl;
+        abort();
+    }
+    if (universe::factorizationprecision > 0)
+    {
+        std::cout << "Error in 'sl' namespace: transposed direct solves are not supported with a mixed precision factorization" << std::endl;
+        abort();
+    }
+    
+    // The transposed problem is homogeneous on the constrained dofs:
+    vec breduced = b.extract(A.getainds());
+    
+    Vec bpetsc = breduced.getpetsc();
+    Mat Apetsc = A.getapetsc();
+
+    vec sol(std::shared_ptr<rawvec>(new rawvec(breduced.getpointer()->getdofmanager())));
+    Vec solpetsc = sol.getpetsc();
+
+    solverstats stats;
+    stats.numsolves = 1;
+    
+    // A Cholesky factorized matrix is symmetric:
+    bool istransposedsolve = (soltype == "lu" && A.getpointer()->issymmetric() == false);
+
+    // Reuse the factorization kept in the sparsity pattern:
+    std::shared_ptr<sparsitypattern> pattern = A.getpointer()->getpattern();
+    if (pattern != NULL && pattern->isfactorizationkept() && A.getpointer()->isfactored() == false)
+    {
+        pattern->solve(A.getpointer(), bpetsc, solpetsc, soltype, stats, istransposedsolve);
+        solverstats::record(stats);
+        return A.x0merge(sol);
+    }
+
+    KSP* ksp = A.getpointer()->getksp();
+
+    if (A.getpointer()->isfactored() == false)
+    {
+        PC pc;
+        KSPCreate(PETSC_COMM_SELF, ksp);
+        KSPSetOperators(*ksp, Apetsc, Apetsc);
+        KSPSetFromOptions(*ksp);
+
+        KSPGetPC(*ksp,&pc);
+        // Only a Cholesky factorization is possible for matrices in symmetric storage:
+        if (soltype == "lu" && A.getpointer()->issymmetric() == false)
+            PCSetType(pc,PCLU);
+        if (soltype == "cholesky" || A.getpointer()->issymmetric())
+            PCSetType(pc,PCCHOLESKY);
+        PCFactorSetMatSolverType(pc,MATSOLVERMUMPS);
+        universe::configuremumps(pc);
+    }
+
+    {
+        profilephase phase("factorize and solve");
+        
+        if (A.getpointer()->isfactored() == false)
+        {
+            wallclock clk;
+            KSPSetUp(*ksp);
+            stats.factorizationtime = clk.toc()*1e-9;
+            stats.numfactorizations = 1;
+            stats.setfactorizationinfo(*ksp);
+        }
+        else
+            stats.numreuses = 1;
+        
+        wallclock clk;
+        if (istransposedsolve)
+            KSPSolveTranspose(*ksp, bpetsc, solpetsc);
+        else
+            KSPSolve(*ksp, bpetsc, solpetsc);
+        stats.solvetime = clk.toc()*1e-9;
+    }
+    solverstats::record(stats);
+
+    A.getpointer()->isfactored(true);
+
+    if (A.getpointer()->isfactorizationreuseallowed() == false)
+    {
+        KSPDestroy(ksp);
+        A.getpointer()->isfactored(false);
+    }
+
+    return A.x0merge(sol);
+}
+
+// Multi-rhs direct solve of A*x = b or of transpose(A)*x = b. The transposed solution is zero on the constrained dofs:
+static std::vector<vec> solvemultirhs(mat A, std::vector<vec> b, std::string soltype, bool istransposed)
 {
     if (soltype != "lu" && soltype != "cholesky")
     {
@@ -1529,7 +1734,7 @@ std::vector<vec> sl::solve(mat A, std::vector<vec> b, std::string soltype)
     
     std::vector<vec> breduced(numrhs);
     for (int i = 0; i < numrhs; i++)
-        breduced[i] = A.eliminate(b[i]);
+        breduced[i] = (istransposed ? b[i].extract(A.getainds()) : A.eliminate(b[i]));
 
     int len = breduced[0].size();
     
@@ -1545,7 +1750,7 @@ std::vector<vec> sl::solve(mat A, std::vector<vec> b, std::string soltype)
     }
     
     // Solve multi-rhs:
-    densemat sols = solve(A, rhs, soltype);
+    densemat sols = (istransposed ? sl::solvetranspose(A, rhs, soltype) : sl::solve(A, rhs, soltype));
     double* solsptr = sols.getvalues();
 
     // Extract 'sols' rows to sol vecs:
@@ -1559,19 +1764,40 @@ std::vector<vec> sl::solve(mat A, std::vector<vec> b, std::string soltype)
     
         outvecs[i] = vec(std::shared_ptr<rawvec>(new rawvec(b[i].getpointer()->getdofmanager())));
         outvecs[i].setvalues(A.getainds(), vals);
-        outvecs[i].setvalues(A.getdinds(), b[i].getvalues(A.getdinds()));
+        if (istransposed == false)
+            outvecs[i].setvalues(A.getdinds(), b[i].getvalues(A.getdinds()));
     }
     
     return outvecs;
 }
 
-densemat sl::solve(mat A, densemat b, std::string soltype)
+std::vector<vec> sl::solve(mat A, std::vector<vec> b, std::string soltype)
+{
+    return solvemultirhs(A, b, soltype, false);
+}
+
+std::vector<vec> sl::solvetranspose(mat A, std::vector<vec> b, std::string soltype)
+{
+    return solvemultirhs(A, b, soltype, true);
+}
+
+// Multi-rhs direct solve on the reduced system of A. Mumps solves with the transposed factors if 'istransposed':
+static densemat solvemultirhs(mat A, densemat b, std::string soltype, bool istransposed)
 {
+    if (A.getpointer() != NULL && A.getpointer()->ismatrixfree())
+    {
+        std::cout << "Error in 'sl' namespace: multi-rhs direct solve failed (cannot factorize a matrix-free operator)" << std::endl;
+        abort();
+    }
+
     int numrhs = b.countrows();
     int len = b.countcolumns();
  
     Mat Apetsc = A.getapetsc();
     
+    solverstats stats;
+    stats.numsolves = numrhs;
+    
     KSP* ksp = A.getpointer()->getksp();
     PC pc;
     if (A.getpointer()->isfactored() == false)
@@ -1581,15 +1807,25 @@ densemat sl::solve(mat A, densemat b, std::string soltype)
         KSPSetFromOptions(*ksp);
 
         KSPGetPC(*ksp,&pc);
-        if (soltype == "lu")
+        // Only a Cholesky factorization is possible for matrices in symmetric storage:
+        if (soltype == "lu" && A.getpointer()->issymmetric() == false)
             PCSetType(pc,PCLU);
-        if (soltype == "cholesky")
+        if (soltype == "cholesky" || A.getpointer()->issymmetric())
             PCSetType(pc,PCCHOLESKY);
         PCFactorSetMatSolverType(pc,MATSOLVERMUMPS);
+        universe::configuremumps(pc);
+        
+        wallclock clk;
         PCSetUp(pc);
+        stats.factorizationtime = clk.toc()*1e-9;
+        stats.numfactorizations = 1;
+        stats.setfactorizationinfo(*ksp);
     }
     else
+    {
         KSPGetPC(*ksp,&pc);
+        stats.numreuses = 1;
+    }
         
     PCFactorGetMatrix(pc, &Apetsc);
 
@@ -1600,7 +1836,20 @@ densemat sl::solve(mat A, densemat b, std::string soltype)
     MatCreateSeqDense(PETSC_COMM_SELF, len, numrhs, b.getvalues(), &rhses);
     
     // 'rhs' and 'sols' are considered column major in petsc.
-    MatMatSolve(Apetsc, rhses, sols);
+    {
+        profilephase phase("multiple rhs solve");
+        // A Cholesky factorized matrix is symmetric:
+        bool istransposedsolve = (istransposed && soltype == "lu" && A.getpointer()->issymmetric() == false);
+        
+        wallclock clk;
+        if (istransposedsolve)
+            MatMumpsSetIcntl(Apetsc, 9, 0);
+        MatMatSolve(Apetsc, rhses, sols);
+        if (istransposedsolve)
+            MatMumpsSetIcntl(Apetsc, 9, 1);
+        stats.solvetime = clk.toc()*1e-9;
+    }
+    solverstats::record(stats);
     
     MatDestroy(&sols);
     MatDestroy(&rhses);
@@ -1616,98 +1865,850 @@ densemat sl::solve(mat A, densemat b, std::string soltype)
     return densesols;
 }
 
-int mykspmonitor(KSP ksp, PetscInt iter, PetscReal resnorm, void* unused)
+densemat sl::solve(mat A, densemat b, std::string soltype)
 {
-    std::cout << iter << " KSP residual norm " << resnorm << std::endl;
-    return 0;
+    return solvemultirhs(A, b, soltype, false);
 }
 
-void sl::solve(mat A, vec b, vec sol, double& relrestol, int& maxnumit, std::string soltype, std::string precondtype, int verbosity, bool diagscaling)
+densemat sl::solvetranspose(mat A, densemat b, std::string soltype)
 {
-    if (soltype != "gmres" && soltype != "bicgstab")
-    {
-        std::cout << "Error in 'sl' namespace: unknown iterative solver type '" << soltype << "' (use 'gmres' or 'bicgstab')" << std::endl;
-        abort();
-    }
-    if (precondtype != "ilu" && precondtype != "sor" && precondtype != "gamg")
+    return solvemultirhs(A, b, soltype, true);
+}
+
+void sl::predictfactorization(mat A, double& incorememory, double& outofcorememory, long long int& numfactorentries, std::string soltype)
+{
+    if (soltype != "lu" && soltype != "cholesky")
     {
-        std::cout << "Error in 'sl' namespace: unknown preconditioner type '" << precondtype << "' (use 'ilu', 'sor' or 'gamg')" << std::endl;
+        std::cout << "Error in 'sl' namespace: unknown direct solver type '" << soltype << "' (use 'lu' or 'cholesky')" << std::endl;
         abort();
     }
-    if (A.countrows() != b.size())
+    if (A.getpointer() == NULL || A.getpointer()->ismatrixfree())
     {
-        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (size of A and b do not match)" << std::endl;
+        std::cout << "Error in 'sl' namespace: cannot predict the factorization of an undefined or matrix-free operator" << std::endl;
         abort();
     }
-    if (A.countrows() != sol.size())
+    
+    Mat Apetsc = A.getapetsc();
+    
+    // Only a Cholesky factorization is possible for matrices in symmetric storage:
+    bool ischolesky = (soltype == "cholesky" || A.getpointer()->issymmetric());
+    
+    Mat F;
+    MatFactorInfo info;
+    MatFactorInfoInitialize(&info);
+    IS rowperm, colperm;
+    MatGetOrdering(Apetsc, MATORDERINGNATURAL, &rowperm, &colperm);
+    if (ischolesky)
     {
-        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (size of A and x do not match)" << std::endl;
-        abort();
+        MatGetFactor(Apetsc, MATSOLVERMUMPS, MAT_FACTOR_CHOLESKY, &F);
+        MatCholeskyFactorSymbolic(F, Apetsc, rowperm, &info);
     }
-
-    if (A.getpointer() == NULL || b.getpointer() == NULL || sol.getpointer() == NULL)
+    else
     {
-        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (A, x or b is undefined)" << std::endl;
-        abort();
+        MatGetFactor(Apetsc, MATSOLVERMUMPS, MAT_FACTOR_LU, &F);
+        MatLUFactorSymbolic(F, Apetsc, rowperm, colperm, &info);
     }
     
-    vec breduced = A.eliminate(b);
-    vec sola = sol.extract(A.getainds());
+    // INFOG(17) and INFOG(27) give the total memory estimated for an in-core and an out-of-core
+    // factorization. INFOG(20) is the estimated number of entries in the factors:
+    PetscInt infog17, infog27, infog20;
+    MatMumpsGetInfog(F, 17, &infog17);
+    MatMumpsGetInfog(F, 27, &infog27);
+    MatMumpsGetInfog(F, 20, &infog20);
+    
+    incorememory = infog17;
+    outofcorememory = infog27;
+    numfactorentries = infog20;
+    // A negative INFOG(20) is the number of entries in millions:
+    if (infog20 < 0)
+        numfactorentries = -1000000LL*infog20;
+    
+    ISDestroy(&rowperm);
+    ISDestroy(&colperm);
+    MatDestroy(&F);
+}
 
-    Vec bpetsc = breduced.getpetsc();
-    Mat Apetsc = A.getapetsc();
+int mykspmonitor(KSP ksp, PetscInt iter, PetscReal resnorm, void* unused)
+{
+    std::cout << iter << " KSP residual norm " << resnorm << std::endl;
+    return 0;
+}
 
-    Vec solpetsc = sola.getpetsc();
+// Copy the values of a petsc vector to another one of same size (the types can differ):
+void copypetscvalues(Vec from, Vec to)
+{
+    PetscInt len;
+    VecGetLocalSize(from, &len);
+    
+    const PetscScalar* fromvals;
+    PetscScalar* tovals;
+    VecGetArrayRead(from, &fromvals);
+    VecGetArray(to, &tovals);
+    for (PetscInt i = 0; i < len; i++)
+        tovals[i] = fromvals[i];
+    VecRestoreArray(to, &tovals);
+    VecRestoreArrayRead(from, &fromvals);
+}
 
-    KSP* ksp = A.getpointer()->getksp();
+// Attach to the petsc matrix the orthonormalized near-nullspace of the algebraic multigrid preconditioners:
+void setnearnullspace(mat A)
+{
+    std::vector<std::vector<double>> modes = A.getpointer()->getdofmanager()->getrigidbodymodes();
 
-    KSPCreate(PETSC_COMM_SELF, ksp);
-    KSPSetOperators(*ksp, Apetsc, Apetsc);
-    // Perform a diagonal scaling for improved matrix conditionning.
-    // This modifies the matrix A and right handside b!
-    if (diagscaling == true)
-        KSPSetDiagonalScale(*ksp, PETSC_TRUE);
+    indexmat ainds = A.getainds();
+    int* aindsptr = ainds.getvalues();
+    int numreduced = ainds.count();
 
-    if (soltype == "gmres")
-        KSPSetType(*ksp, KSPGMRES);
-    if (soltype == "bicgstab")
-        KSPSetType(*ksp, KSPBCGS);
+    // Modified Gram-Schmidt on the unconstrained dofs (degenerate modes are dropped):
+    std::vector<std::vector<double>> basis = {};
+    for (int m = 0; m < modes.size(); m++)
+    {
+        std::vector<double> cur(numreduced);
+        for (int i = 0; i < numreduced; i++)
+            cur[i] = modes[m][aindsptr[i]];
 
-    // The initial guess is provided in vector sol:
-    KSPSetInitialGuessNonzero(*ksp, PETSC_TRUE);
+        double initnorm = 0.0;
+        for (int i = 0; i < numreduced; i++)
+            initnorm += cur[i]*cur[i];
+        initnorm = std::sqrt(initnorm);
 
-    KSPSetTolerances(*ksp, relrestol, PETSC_DEFAULT, PETSC_DEFAULT, maxnumit);
+        for (int b = 0; b < basis.size(); b++)
+        {
+            double dot = 0.0;
+            for (int i = 0; i < numreduced; i++)
+                dot += cur[i]*basis[b][i];
+            for (int i = 0; i < numreduced; i++)
+                cur[i] -= dot*basis[b][i];
+        }
 
-    // Request to print the iteration information to the console:
-    if (verbosity > 0)
-        KSPMonitorSet(*ksp, mykspmonitor, PETSC_NULL, PETSC_NULL);
+        double norm = 0.0;
+        for (int i = 0; i < numreduced; i++)
+            norm += cur[i]*cur[i];
+        norm = std::sqrt(norm);
 
-    KSPSetFromOptions(*ksp);
+        if (norm <= 1e-10*initnorm || norm == 0)
+            continue;
+        for (int i = 0; i < numreduced; i++)
+            cur[i] /= norm;
+        basis.push_back(cur);
+    }
 
-    // Use a preconditioner:
-    PC pc;
-    KSPGetPC(*ksp,&pc);
+    if (basis.size() == 0)
+        return;
+
+    std::vector<Vec> vecs(basis.size());
+    for (int b = 0; b < basis.size(); b++)
+    {
+        VecCreateSeq(PETSC_COMM_SELF, numreduced, &vecs[b]);
+        PetscScalar* vecptr;
+        VecGetArray(vecs[b], &vecptr);
+        for (int i = 0; i < numreduced; i++)
+            vecptr[i] = basis[b][i];
+        VecRestoreArray(vecs[b], &vecptr);
+    }
+
+    MatNullSpace nearnullspace;
+    MatNullSpaceCreate(PETSC_COMM_SELF, PETSC_FALSE, vecs.size(), vecs.data(), &nearnullspace);
+    MatSetNearNullSpace(A.getapetsc(), nearnullspace);
+    MatNullSpaceDestroy(&nearnullspace);
+
+    for (int b = 0; b < vecs.size(); b++)
+        VecDestroy(&vecs[b]);
+}
+
+// Define the splits of a fieldsplit preconditioner from the dof indexes of every split (e.g. the field layout in the dof manager).
+// Every split can be further configured from the petsc options (e.g. '-fieldsplit_1_pc_type gamg').
+void setfieldsplits(PC pc, mat A, std::vector<std::vector<int>> splits, std::string strategy)
+{
+    // Index of every dof in the reduced (unconstrained) system:
+    indexmat ainds = A.getainds();
+    int* aindsptr = ainds.getvalues();
+    std::vector<int> reducedindex(A.countrows(), -1);
+    for (int i = 0; i < ainds.count(); i++)
+        reducedindex[aindsptr[i]] = i;
+
+    std::vector<std::vector<PetscInt>> reducedsplits = {};
+    for (int s = 0; s < splits.size(); s++)
+    {
+        std::vector<PetscInt> cursplit = {};
+        for (int i = 0; i < splits[s].size(); i++)
+        {
+            if (reducedindex[splits[s][i]] != -1)
+                cursplit.push_back(reducedindex[splits[s][i]]);
+        }
+        if (cursplit.size() > 0)
+            reducedsplits.push_back(cursplit);
+    }
+
+    if (strategy == "schur" && reducedsplits.size() != 2)
+    {
+        std::cout << "Error in 'sl' namespace: Schur complement field split requires exactly two fields with unconstrained dofs (found " << reducedsplits.size() << ")" << std::endl;
+        std::cout << "Interleave the components of a vector field to have them in a single split" << std::endl;
+        abort();
+    }
+
+    PCSetType(pc, PCFIELDSPLIT);
+    for (int s = 0; s < reducedsplits.size(); s++)
+    {
+        IS splitis;
+        ISCreateGeneral(PETSC_COMM_SELF, reducedsplits[s].size(), reducedsplits[s].data(), PETSC_COPY_VALUES, &splitis);
+        PCFieldSplitSetIS(pc, std::to_string(s).c_str(), splitis);
+        ISDestroy(&splitis);
+    }
+
+    if (strategy == "jacobi")
+        PCFieldSplitSetType(pc, PC_COMPOSITE_ADDITIVE);
+    if (strategy == "gaussseidel")
+        PCFieldSplitSetType(pc, PC_COMPOSITE_MULTIPLICATIVE);
+    if (strategy == "schur")
+    {
+        PCFieldSplitSetType(pc, PC_COMPOSITE_SCHUR);
+        // The second diagonal block is often zero (saddle point problems). Precondition
+        // the Schur complement with A11 - A10 inv(diag(A00)) A01 instead:
+        PCFieldSplitSetSchurPre(pc, PC_FIELDSPLIT_SCHUR_PRE_SELFP, PETSC_NULL);
+    }
+
+    PCSetFromOptions(pc);
+}
+
+// Set a two level multigrid with prolongation P (from the coarse space to the reduced system of A) and coarse operator Acoarse.
+// The fine level is smoothed with SOR sweeps and the coarse system is factorized with MUMPS. Both levels can be further
+// configured from the petsc options (e.g. '-mg_coarse_pc_type gamg'). P and Acoarse are destroyed.
+void settwolevelmultigrid(PC pc, mat A, Mat P, Mat Acoarse)
+{
+    PCSetType(pc, PCMG);
+    PCMGSetLevels(pc, 2, NULL);
+    PCMGSetType(pc, PC_MG_MULTIPLICATIVE);
+    PCMGSetGalerkin(pc, PC_MG_GALERKIN_NONE);
+    PCMGSetInterpolation(pc, 1, P);
+    MatDestroy(&P);
+    
+    KSP smoother, coarsesolver;
+    PC smootherpc, coarsepc;
+    
+    PCMGGetSmoother(pc, 1, &smoother);
+    KSPSetType(smoother, KSPRICHARDSON);
+    KSPSetTolerances(smoother, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT, 2);
+    KSPGetPC(smoother, &smootherpc);
+    PCSetType(smootherpc, PCSOR);
+    
+    PCMGGetCoarseSolve(pc, &coarsesolver);
+    KSPSetOperators(coarsesolver, Acoarse, Acoarse);
+    KSPSetType(coarsesolver, KSPPREONLY);
+    KSPGetPC(coarsesolver, &coarsepc);
+    PCSetType(coarsepc, A.getpointer()->issymmetric() ? PCCHOLESKY : PCLU);
+    PCFactorSetMatSolverType(coarsepc, MATSOLVERMUMPS);
+    universe::configuremumps(coarsepc);
+    MatDestroy(&Acoarse);
+    
+    PCSetFromOptions(pc);
+}
+
+// Index of every dof in the reduced (unconstrained) system of A (-1 for the constrained dofs):
+std::vector<int> getreducedindexes(mat A)
+{
+    indexmat ainds = A.getainds();
+    int* aindsptr = ainds.getvalues();
+    std::vector<int> reducedindex(A.countrows(), -1);
+    for (int i = 0; i < ainds.count(); i++)
+        reducedindex[aindsptr[i]] = i;
+    return reducedindex;
+}
+
+// Two level p-multigrid on the hierarchical form functions. The coarse space is the span of the lowest order form functions
+// (see 'dofmanager::getlowestorderdofs'). Its prolongation is thus an injection and its Galerkin operator is the submatrix of
+// A on the lowest order dofs (this also works for the symmetric storage).
+void setpmultigrid(PC pc, mat A)
+{
+    std::vector<int> reducedindex = getreducedindexes(A);
+    int numreduced = A.getainds().count();
+        
+    std::vector<int> lowestorderdofs = A.getpointer()->getdofmanager()->getlowestorderdofs();
+    std::vector<PetscInt> coarseinds = {};
+    for (int i = 0; i < lowestorderdofs.size(); i++)
+    {
+        if (reducedindex[lowestorderdofs[i]] != -1)
+            coarseinds.push_back(reducedindex[lowestorderdofs[i]]);
+    }
+    std::sort(coarseinds.begin(), coarseinds.end());
+    
+    if (coarseinds.size() == 0)
+    {
+        std::cout << "Error in 'sl' namespace: p-multigrid requires unconstrained lowest order dofs" << std::endl;
+        abort();
+    }
+    
+    // Injection of the coarse dofs in the fine space:
+    Mat P;
+    MatCreateSeqAIJ(PETSC_COMM_SELF, numreduced, coarseinds.size(), 1, NULL, &P);
+    for (int i = 0; i < coarseinds.size(); i++)
+        MatSetValue(P, coarseinds[i], i, 1.0, INSERT_VALUES);
+    MatAssemblyBegin(P, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(P, MAT_FINAL_ASSEMBLY);
+    
+    IS coarseis;
+    Mat Acoarse;
+    ISCreateGeneral(PETSC_COMM_SELF, coarseinds.size(), coarseinds.data(), PETSC_COPY_VALUES, &coarseis);
+    MatCreateSubMatrix(A.getapetsc(), coarseis, coarseis, MAT_INITIAL_MATRIX, &Acoarse);
+    ISDestroy(&coarseis);
+    
+    settwolevelmultigrid(pc, A, P, Acoarse);
+}
+
+// Two level h-multigrid between the h-adapted mesh and its original mesh. The coarse space is spanned by the order 1 'h1'
+// functions on the original mesh. They are interpolated at the fine nodes located in the original elements with the
+// refinement tree of the 'htracker'. The other dofs (higher orders, other field types) are only smoothed. The coarse
+// operator is the Galerkin product P^T*A*P.
+void sethmultigrid(PC pc, mat A)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    std::shared_ptr<htracker> ht = rm->gethtracker();
+    if (ht == NULL || ht->getmaxdepth() == 0)
+    {
+        std::cout << "Error in 'sl' namespace: h-multigrid requires a mesh refined by h-adaptivity" << std::endl;
+        abort();
+    }
+    std::shared_ptr<rawmesh> origrm = rm->getoriginalmeshpointer();
+    elements* els = rm->getelements();
+    elements* origels = origrm->getelements();
+    int meshdim = rm->getmeshdimension();
+    
+    std::vector<int> reducedindex = getreducedindexes(A);
+    int numreduced = A.getainds().count();
+    
+    std::vector<int> vertexdofs, vertexnodes, vertexfields;
+    A.getpointer()->getdofmanager()->getvertexdofs(vertexdofs, vertexnodes, vertexfields);
+    
+    // Locate every point element of the fine mesh as a corner of a highest dimension element:
+    int numnodes = els->count(0);
+    std::vector<int> nodeelems(2*numnodes, -1);
+    std::vector<double> noderefcoords(3*numnodes, 0.0);
+    for (int i = 0; i < 8; i++)
+    {
+        element myelem(i);
+        if (myelem.getelementdimension() != meshdim)
+            continue;
+        std::vector<double> cornerrefcoords = lagrangeformfunction(i, 1, {}).getnodecoordinates();
+        for (int e = 0; e < els->count(i); e++)
+        {
+            for (int k = 0; k < myelem.countnodes(); k++)
+            {
+                int node = els->getsubelement(0, i, e, k);
+                if (nodeelems[2*node+0] >= 0)
+                    continue;
+                nodeelems[2*node+0] = i;
+                nodeelems[2*node+1] = e;
+                for (int c = 0; c < 3; c++)
+                    noderefcoords[3*node+c] = cornerrefcoords[3*k+c];
+            }
+        }
+    }
+    
+    // Only the unconstrained vertex dofs are treated:
+    std::vector<int> locatedelems = {};
+    std::vector<double> locatedrefcoords = {};
+    std::vector<int> locateddofs = {};
+    for (int i = 0; i < vertexdofs.size(); i++)
+    {
+        int node = vertexnodes[i];
+        if (reducedindex[vertexdofs[i]] == -1 || nodeelems[2*node+0] < 0)
+            continue;
+        locatedelems.push_back(nodeelems[2*node+0]);
+        locatedelems.push_back(nodeelems[2*node+1]);
+        for (int c = 0; c < 3; c++)
+            locatedrefcoords.push_back(noderefcoords[3*node+c]);
+        locateddofs.push_back(i);
+    }
+    
+    // Find the original element and reference coordinates of every located node:
+    std::vector<std::vector<int>> ads;
+    std::vector<std::vector<double>> rcs;
+    std::vector<int> indexinrcsoforigin;
+    gentools::toaddressdata(locatedelems, locatedrefcoords, els->count(), ads, rcs, indexinrcsoforigin);
+    std::vector<std::vector<int>> tel;
+    std::vector<std::vector<double>> trc;
+    ht->getattarget(ads, rcs, origrm->gethtracker().get(), tel, trc);
+    
+    // Coarse index of every (field, original point element) pair:
+    std::map<std::pair<int,int>, int> coarseindexes;
+    std::vector<PetscInt> prows = {}, pcols = {};
+    std::vector<double> pvals = {};
+    for (int i = 0; i < locateddofs.size(); i++)
+    {
+        int typ = locatedelems[2*i+0];
+        int ind = indexinrcsoforigin[i];
+        int origtype = tel[typ][2*ind+0];
+        int origelem = tel[typ][2*ind+1];
+        std::vector<double> origrefcoords = {trc[typ][3*ind+0], trc[typ][3*ind+1], trc[typ][3*ind+2]};
+        
+        densemat weights = lagrangeformfunction(origtype, 1, origrefcoords).getderivative(0);
+        double* weightsptr = weights.getvalues();
+        
+        int dof = vertexdofs[locateddofs[i]];
+        int field = vertexfields[locateddofs[i]];
+        for (int k = 0; k < weights.countrows(); k++)
+        {
+            if (std::abs(weightsptr[k]) < 1e-12)
+                continue;
+            int orignode = origels->getsubelement(0, origtype, origelem, k);
+            std::pair<int,int> key = std::make_pair(field, orignode);
+            if (coarseindexes.count(key) == 0)
+            {
+                int newindex = coarseindexes.size();
+                coarseindexes[key] = newindex;
+            }
+            prows.push_back(reducedindex[dof]);
+            pcols.push_back(coarseindexes[key]);
+            pvals.push_back(weightsptr[k]);
+        }
+    }
+    
+    if (coarseindexes.size() == 0)
+    {
+        std::cout << "Error in 'sl' namespace: h-multigrid requires unconstrained 'h1' vertex dofs" << std::endl;
+        abort();
+    }
+    
+    // Prolongation with at most one entry per original element corner in each row:
+    Mat P;
+    MatCreateSeqAIJ(PETSC_COMM_SELF, numreduced, coarseindexes.size(), 8, NULL, &P);
+    for (int i = 0; i < prows.size(); i++)
+        MatSetValue(P, prows[i], pcols[i], pvals[i], INSERT_VALUES);
+    MatAssemblyBegin(P, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(P, MAT_FINAL_ASSEMBLY);
+    
+    // The triple product requires the aij format:
+    Mat Aaij, Acoarse;
+    MatConvert(A.getapetsc(), MATSEQAIJ, MAT_INITIAL_MATRIX, &Aaij);
+    MatPtAP(Aaij, P, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &Acoarse);
+    MatDestroy(&Aaij);
+    
+    settwolevelmultigrid(pc, A, P, Acoarse);
+}
+
+// Auxiliary space Maxwell solver (hypre AMS) for the lowest order 'hcurl' fields. The discrete gradient G maps the nodal values
+// to the edge circulations: the order 0 edge function has a unit circulation from its first to its second node after the
+// reordering by increasing node number, thus G has +1 at the higher and -1 at the lower node number of every edge. The node
+// numbers are read from the total orientation of the line (0 if its first node has the higher number). Without any mass term
+// (e.g. a magnetostatic curl-curl problem without gauge) G^T*A*G is zero and AMS is told to skip its nodal subspace solve.
+void setams(PC pc, mat A)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    elements* els = rm->getelements();
+    int meshdim = rm->getmeshdimension();
+    
+    std::vector<int> reducedindex = getreducedindexes(A);
+    int numreduced = A.getainds().count();
+    
+    std::vector<int> edgedofs, edgenumbers, edgefields;
+    A.getpointer()->getdofmanager()->getedgedofs(edgedofs, edgenumbers, edgefields);
+    
+    // Column of every point element used by an unconstrained edge (-1 if none):
+    std::vector<int> nodecolumns(els->count(0), -1);
+    std::vector<double>* nodecoords = els->getbarycenters(0);
+    std::vector<double> coords = {};
+    
+    std::vector<PetscInt> grows = {}, gcols = {};
+    std::vector<double> gvals = {};
+    for (int i = 0; i < edgedofs.size(); i++)
+    {
+        int row = reducedindex[edgedofs[i]];
+        if (row == -1)
+            continue;
+        if (edgefields[i] != edgefields[0])
+        {
+            std::cout << "Error in 'sl' namespace: AMS requires a single 'hcurl' field" << std::endl;
+            abort();
+        }
+        
+        double sign = 1.0 - 2.0*els->gettotalorientation(1, edgenumbers[i]);
+        for (int k = 0; k < 2; k++)
+        {
+            int node = els->getsubelement(0, 1, edgenumbers[i], k);
+            if (nodecolumns[node] == -1)
+            {
+                nodecolumns[node] = coords.size()/meshdim;
+                for (int c = 0; c < meshdim; c++)
+                    coords.push_back(nodecoords->at(3*node+c));
+            }
+            grows.push_back(row);
+            gcols.push_back(nodecolumns[node]);
+            gvals.push_back(k == 0 ? sign : -sign);
+        }
+    }
+    
+    if (grows.size() != 2*numreduced)
+    {
+        std::cout << "Error in 'sl' namespace: AMS requires all unconstrained dofs to be order 0 'hcurl' edge dofs of a single field" << std::endl;
+        abort();
+    }
+    int numnodes = coords.size()/meshdim;
+    
+    Mat G;
+    MatCreateSeqAIJ(PETSC_COMM_SELF, numreduced, numnodes, 2, NULL, &G);
+    for (int i = 0; i < grows.size(); i++)
+        MatSetValue(G, grows[i], gcols[i], gvals[i], INSERT_VALUES);
+    MatAssemblyBegin(G, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(G, MAT_FINAL_ASSEMBLY);
+    
+    // Detect a pure curl-curl operator (the gradients are in its kernel):
+    Mat Aaij, GtAG;
+    PetscReal anorm, gtagnorm;
+    MatConvert(A.getapetsc(), MATSEQAIJ, MAT_INITIAL_MATRIX, &Aaij);
+    MatPtAP(Aaij, G, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &GtAG);
+    MatNorm(Aaij, NORM_INFINITY, &anorm);
+    MatNorm(GtAG, NORM_INFINITY, &gtagnorm);
+    MatDestroy(&GtAG);
+    MatDestroy(&Aaij);
+    
+    PCSetType(pc, PCHYPRE);
+    PCHYPRESetType(pc, "ams");
+    PCHYPRESetDiscreteGradient(pc, G);
+    PCSetCoordinates(pc, meshdim, numnodes, coords.data());
+    if (gtagnorm <= 1e-10*anorm)
+        PCHYPRESetBetaPoissonMatrix(pc, NULL);
+    MatDestroy(&G);
+    
+    PCSetFromOptions(pc);
+}
+
+void setpreconditioner(PC pc, mat A, std::string precondtype)
+{
     if (precondtype == "ilu")
-        PCSetType(pc,PCILU);
+        PCSetType(pc, A.getpointer()->issymmetric() ? PCICC : PCILU);
     if (precondtype == "sor")
         PCSetType(pc,PCSOR);
+    if (precondtype == "gamg" || precondtype == "hypre")
+        setnearnullspace(A);
     if (precondtype == "gamg")
         PCSetType(pc,PCGAMG);
+    if (precondtype == "hypre")
+    {
+        PCSetType(pc,PCHYPRE);
+        PCHYPRESetType(pc,"boomeramg");
+    }
+    if (precondtype == "none")
+        PCSetType(pc,PCNONE);
+    if (precondtype == "pmultigrid")
+        setpmultigrid(pc, A);
+    if (precondtype == "hmultigrid")
+        sethmultigrid(pc, A);
+    if (precondtype == "ams")
+        setams(pc, A);
+    if (precondtype.compare(0, 11, "fieldsplit-") == 0)
+        setfieldsplits(pc, A, A.getpointer()->getdofmanager()->getfieldsplits(), precondtype.substr(11));
+    if (precondtype == "harmonicblock")
+    {
+        // Only the diagonal block of every harmonic is factorized (the harmonic couplings are left to the Krylov solver):
+        setfieldsplits(pc, A, A.getpointer()->getdofmanager()->getharmonicsplits(), "jacobi");
+        PCSetUp(pc);
+        
+        PetscInt numsplits;
+        KSP* subksps;
+        PCFieldSplitGetSubKSP(pc, &numsplits, &subksps);
+        for (int s = 0; s < numsplits; s++)
+        {
+            PC subpc;
+            KSPSetType(subksps[s], KSPPREONLY);
+            KSPGetPC(subksps[s], &subpc);
+            PCSetType(subpc, PCLU);
+            PCFactorSetMatSolverType(subpc, MATSOLVERMUMPS);
+        }
+        PetscFree(subksps);
+    }
+}
 
-    KSPSolve(*ksp, bpetsc, solpetsc);
+void sl::solve(mat A, vec b, vec sol, double& relrestol, int& maxnumit, std::string soltype, std::string precondtype, int verbosity, bool diagscaling)
+{
+    if (soltype != "gmres" && soltype != "bicgstab")
+    {
+        std::cout << "Error in 'sl' namespace: unknown iterative solver type '" << soltype << "' (use 'gmres' or 'bicgstab')" << std::endl;
+        abort();
+    }
+    if (precondtype != "ilu" && precondtype != "sor" && precondtype != "gamg" && precondtype != "hypre" && precondtype != "fieldsplit-jacobi" && precondtype != "fieldsplit-gaussseidel" && precondtype != "fieldsplit-schur" && precondtype != "harmonicblock" && precondtype != "pmultigrid" && precondtype != "hmultigrid" && precondtype != "ams" && precondtype != "none")
+    {
+        std::cout << "Error in 'sl' namespace: unknown preconditioner type '" << precondtype << "' (use 'ilu', 'sor', 'gamg', 'hypre', 'fieldsplit-jacobi', 'fieldsplit-gaussseidel', 'fieldsplit-schur', 'harmonicblock', 'pmultigrid', 'hmultigrid', 'ams' or 'none')" << std::endl;
+        abort();
+    }
+    if (A.countrows() != b.size())
+    {
+        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (size of A and b do not match)" << std::endl;
+        abort();
+    }
+    if (A.countrows() != sol.size())
+    {
+        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (size of A and x do not match)" << std::endl;
+        abort();
+    }
+
+    if (A.getpointer() == NULL || b.getpointer() == NULL || sol.getpointer() == NULL)
+    {
+        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (A, x or b is undefined)" << std::endl;
+        abort();
+    }
+    if (A.getpointer()->ismatrixfree() && precondtype != "none")
+    {
+        std::cout << "Error in 'sl' namespace: iterative solve of Ax = b failed (a matrix-free operator can only be used with preconditioner type 'none')" << std::endl;
+        abort();
+    }
+    
+    vec breduced = A.eliminate(b);
+    vec sola = sol.extract(A.getainds());
+
+    Vec bpetsc = breduced.getpetsc();
+    Mat Apetsc = A.getapetsc();
+
+    Vec solpetsc = sola.getpetsc();
+    
+    // Solve on copies of the matrix and vectors in the requested matrix type (e.g. on a GPU):
+    bool isondevice = (universe::solvermatrixtype != "" && A.getpointer()->ismatrixfree() == false);
+    Mat Adevice;
+    Vec bdevice, soldevice;
+    if (isondevice)
+    {
+        // The symmetric and block storages are first converted to the plain csr storage:
+        MatConvert(Apetsc, MATSEQAIJ, MAT_INITIAL_MATRIX, &Adevice);
+        MatConvert(Adevice, universe::solvermatrixtype.c_str(), MAT_INPLACE_MATRIX, &Adevice);
+        MatCreateVecs(Adevice, &soldevice, &bdevice);
+        copypetscvalues(bpetsc, bdevice);
+        copypetscvalues(solpetsc, soldevice);
+    }
+
+    KSP* ksp = A.getpointer()->getksp();
+    
+    // The solver and preconditioner kept from a previous solve with A (see 'mat::reusefactorization') are reused:
+    bool isreused = A.getpointer()->isfactored();
+    if (isreused && isondevice)
+    {
+        std::cout << "Error in 'sl' namespace: cannot reuse the preconditioner with the solver matrix type '" << universe::solvermatrixtype << "'" << std::endl;
+        abort();
+    }
+    // The products use the sell copy of A (if any) while the preconditioner is built from A:
+    if (isreused)
+    {
+        KSPSetOperators(*ksp, A.getpointer()->getsellpetsc(), Apetsc);
+        KSPSetReusePreconditioner(*ksp, PETSC_TRUE);
+        KSPSetTolerances(*ksp, relrestol, PETSC_DEFAULT, PETSC_DEFAULT, maxnumit);
+    }
+    else
+    {
+        KSPCreate(PETSC_COMM_SELF, ksp);
+        if (isondevice)
+            KSPSetOperators(*ksp, Adevice, Adevice);
+        else
+            KSPSetOperators(*ksp, A.getpointer()->getsellpetsc(), Apetsc);
+        // Perform a diagonal scaling for improved matrix conditionning.
+        // This modifies the matrix A and right handside b!
+        if (diagscaling == true)
+            KSPSetDiagonalScale(*ksp, PETSC_TRUE);
+
+        if (soltype == "gmres")
+            KSPSetType(*ksp, KSPGMRES);
+        if (soltype == "bicgstab")
+            KSPSetType(*ksp, KSPBCGS);
+
+        // The initial guess is provided in vector sol:
+        KSPSetInitialGuessNonzero(*ksp, PETSC_TRUE);
+
+        KSPSetTolerances(*ksp, relrestol, PETSC_DEFAULT, PETSC_DEFAULT, maxnumit);
+
+        // Request to print the iteration information to the console:
+        if (verbosity > 0)
+            KSPMonitorSet(*ksp, mykspmonitor, PETSC_NULL, PETSC_NULL);
+
+        KSPSetFromOptions(*ksp);
+
+        // Use a preconditioner:
+        PC pc;
+        KSPGetPC(*ksp,&pc);
+        setpreconditioner(pc, A, precondtype);
+
+        // The near-nullspace was attached to the host matrix:
+        if (isondevice)
+        {
+            MatNullSpace nearnullspace;
+            MatGetNearNullSpace(Apetsc, &nearnullspace);
+            if (nearnullspace != NULL)
+                MatSetNearNullSpace(Adevice, nearnullspace);
+        }
+    }
+
+    // Keep the residual norm at every iteration:
+    KSPSetResidualHistory(*ksp, NULL, PETSC_DECIDE, PETSC_TRUE);
+
+    solverstats stats;
+    stats.numsolves = 1;
+    {
+        profilephase phase("iterative solve");
+        wallclock clk;
+        if (isondevice)
+            KSPSolve(*ksp, bdevice, soldevice);
+        else
+            KSPSolve(*ksp, bpetsc, solpetsc);
+        stats.solvetime = clk.toc()*1e-9;
+    }
 
     // Get the number of required iterations and the residual norm:
-    KSPGetIterationNumber(*ksp, &maxnumit);
+    PetscInt numit;
+    KSPGetIterationNumber(*ksp, &numit);
+    maxnumit = numit;
     KSPGetResidualNorm(*ksp, &relrestol);
+    
+    const PetscReal* history;
+    PetscInt historylength;
+    KSPGetResidualHistory(*ksp, &history, &historylength);
+    stats.numiterations = numit;
+    stats.residualhistory = std::vector<double>(history, history+historylength);
+    solverstats::record(stats);
 
-    KSPDestroy(ksp);
+    if (A.getpointer()->isfactorizationreuseallowed() && isondevice == false && diagscaling == false)
+        A.getpointer()->isfactored(true);
+    else
+        KSPDestroy(ksp);
+    
+    if (isondevice)
+    {
+        copypetscvalues(soldevice, solpetsc);
+        VecDestroy(&bdevice);
+        VecDestroy(&soldevice);
+        MatDestroy(&Adevice);
+    }
     
     sol.setvalues(A.getainds(), sola.getallvalues());
     sol.setvalues(A.getdinds(), b.getvalues(A.getdinds()));
 }
 
+void sl::solve(mat A, std::vector<vec> b, std::vector<vec> sol, double& relrestol, int& maxnumit, std::string soltype, std::string precondtype, int verbosity)
+{
+    if (soltype != "gmres" && soltype != "bicgstab" && soltype != "bgmres" && soltype != "bcg")
+    {
+        std::cout << "Error in 'sl' namespace: unknown multi-rhs iterative solver type '" << soltype << "' (use 'gmres', 'bicgstab', 'bgmres' or 'bcg')" << std::endl;
+        abort();
+    }
+    if (precondtype != "ilu" && precondtype != "sor" && precondtype != "gamg" && precondtype != "hypre" && precondtype != "fieldsplit-jacobi" && precondtype != "fieldsplit-gaussseidel" && precondtype != "fieldsplit-schur" && precondtype != "harmonicblock" && precondtype != "pmultigrid" && precondtype != "hmultigrid" && precondtype != "ams" && precondtype != "none")
+    {
+        std::cout << "Error in 'sl' namespace: unknown preconditioner type '" << precondtype << "' (use 'ilu', 'sor', 'gamg', 'hypre', 'fieldsplit-jacobi', 'fieldsplit-gaussseidel', 'fieldsplit-schur', 'harmonicblock', 'pmultigrid', 'hmultigrid', 'ams' or 'none')" << std::endl;
+        abort();
+    }
+    if (A.getpointer() == NULL || b.size() != sol.size())
+    {
+        std::cout << "Error in 'sl' namespace: multi-rhs iterative solve of Ax = b failed (A is undefined or the number of rhs and solutions differ)" << std::endl;
+        abort();
+    }
+    for (int i = 0; i < b.size(); i++)
+    {
+        if (b[i].getpointer() == NULL || sol[i].getpointer() == NULL || A.countrows() != b[i].size() || A.countrows() != sol[i].size())
+        {
+            std::cout << "Error in 'sl' namespace: multi-rhs iterative solve of Ax = b failed (size of A and at least one rhs or solution do not match)" << std::endl;
+            abort();
+        }
+    }
+    if (A.getpointer()->ismatrixfree() && precondtype != "none")
+    {
+        std::cout << "Error in 'sl' namespace: multi-rhs iterative solve of Ax = b failed (a matrix-free operator can only be used with preconditioner type 'none')" << std::endl;
+        abort();
+    }
+    
+    int numrhs = b.size();
+    if (numrhs == 0)
+        return;
+    
+    indexmat ainds = A.getainds();
+    int len = ainds.count();
+    
+    // The rhs and initial guesses are the columns of dense matrices (column major):
+    Mat Bpetsc, Xpetsc;
+    MatCreateSeqDense(PETSC_COMM_SELF, len, numrhs, NULL, &Bpetsc);
+    MatCreateSeqDense(PETSC_COMM_SELF, len, numrhs, NULL, &Xpetsc);
+    PetscScalar* Bvals;
+    PetscScalar* Xvals;
+    MatDenseGetArray(Bpetsc, &Bvals);
+    MatDenseGetArray(Xpetsc, &Xvals);
+    for (int i = 0; i < numrhs; i++)
+    {
+        densemat bvals = A.eliminate(b[i]).getallvalues();
+        densemat xvals = sol[i].getvalues(ainds);
+        double* bvalsptr = bvals.getvalues();
+        double* xvalsptr = xvals.getvalues();
+        for (int j = 0; j < len; j++)
+        {
+            Bvals[i*len+j] = bvalsptr[j];
+            Xvals[i*len+j] = xvalsptr[j];
+        }
+    }
+    MatDenseRestoreArray(Bpetsc, &Bvals);
+    MatDenseRestoreArray(Xpetsc, &Xvals);
+
+    KSP* ksp = A.getpointer()->getksp();
+
+    KSPCreate(PETSC_COMM_SELF, ksp);
+    KSPSetOperators(*ksp, A.getpointer()->getsellpetsc(), A.getapetsc());
+
+    if (soltype == "gmres")
+        KSPSetType(*ksp, KSPGMRES);
+    if (soltype == "bicgstab")
+        KSPSetType(*ksp, KSPBCGS);
+    // The block methods iterate on all rhs at once (requires petsc configured with hpddm):
+    if (soltype == "bgmres" || soltype == "bcg")
+    {
+        KSPSetType(*ksp, KSPHPDDM);
+        KSPSetOptionsPrefix(*ksp, "slblock_");
+        PetscOptionsSetValue(NULL, "-slblock_ksp_hpddm_type", soltype.c_str());
+    }
+
+    KSPSetInitialGuessNonzero(*ksp, PETSC_TRUE);
+    KSPSetTolerances(*ksp, relrestol, PETSC_DEFAULT, PETSC_DEFAULT, maxnumit);
+
+    if (verbosity > 0)
+        KSPMonitorSet(*ksp, mykspmonitor, PETSC_NULL, PETSC_NULL);
+
+    KSPSetFromOptions(*ksp);
+
+    // The preconditioner is set up once for all rhs:
+    PC pc;
+    KSPGetPC(*ksp,&pc);
+    setpreconditioner(pc, A, precondtype);
+
+    solverstats stats;
+    stats.numsolves = numrhs;
+    {
+        profilephase phase("iterative solve");
+        wallclock clk;
+        KSPMatSolve(*ksp, Bpetsc, Xpetsc);
+        stats.solvetime = clk.toc()*1e-9;
+    }
+
+    // Get the number of iterations and the residual norm of the last solve:
+    PetscInt numit;
+    KSPGetIterationNumber(*ksp, &numit);
+    maxnumit = numit;
+    KSPGetResidualNorm(*ksp, &relrestol);
+    stats.numiterations = numit;
+    solverstats::record(stats);
+
+    KSPDestroy(ksp);
+    
+    const PetscScalar* solvals;
+    MatDenseGetArrayRead(Xpetsc, &solvals);
+    densemat vals(len, 1);
+    double* valsptr = vals.getvalues();
+    for (int i = 0; i < numrhs; i++)
+    {
+        for (int j = 0; j < len; j++)
+            valsptr[j] = solvals[i*len+j];
+        sol[i].setvalues(ainds, vals);
+        sol[i].setvalues(A.getdinds(), b[i].getvalues(A.getdinds()));
+    }
+    MatDenseRestoreArrayRead(Xpetsc, &solvals);
+    
+    MatDestroy(&Bpetsc);
+    MatDestroy(&Xpetsc);
+}
+
 void sl::exchange(std::vector<int> targetranks, std::vector<densemat> sends, std::vector<densemat> receives)
 {
+    profilescope scope("ddm exchange");
+    
     int numtargets = targetranks.size();
 
     if (numtargets == 0)
@@ -1838,6 +2839,220 @@ std::vector<double> sl::gmres(densemat (*mymatmult)(densemat), densemat b, dense
     return relresvec;
 }
 
+std::vector<double> sl::gmres(densemat (*mymatmult)(densemat), densemat b, densemat x, double relrestol, int maxnumit, int restart, densemat& recycled, int numrecycled, int verbosity)
+{
+    if (b.countrows() != x.countrows() || b.countcolumns() != 1 || x.countcolumns() != 1)
+    {
+        std::cout << "Error in 'sl' namespace: in function gmres expected a column vector of same size for b and x" << std::endl;
+        abort();
+    }
+    if (restart <= 0)
+        restart = maxnumit;
+
+    // Fragment size:
+    int n = b.count();
+    
+    double* xptr = x.getvalues();
+    double* bptr = b.getvalues();
+    
+    // Reduced dot products of fragmented vectors:
+    auto dot = [&](double* u, double* v) -> double
+    {
+        double out = 0.0;
+        for (int i = 0; i < n; i++)
+            out += u[i]*v[i];
+        slmpi::sum(1, &out);
+        return out;
+    };
+    auto product = [&](std::vector<double>& in) -> std::vector<double>
+    {
+        densemat prod = mymatmult(densemat(n, 1, in));
+        if (prod.countrows() != n || prod.countcolumns() != 1)
+        {
+            std::cout << "Error in 'sl' namespace: in function gmres the matrix product function call returned a densemat of wrong size on rank " << slmpi::getrank() << std::endl;
+            abort();
+        }
+        double* prodptr = prod.getvalues();
+        return std::vector<double>(prodptr, prodptr+n);
+    };
+    
+    double normb = std::sqrt(dot(bptr, bptr));
+    
+    // All zero solution in case b is all zero:
+    if (normb == 0)
+    {
+        for (int i = 0; i < n; i++)
+            xptr[i] = 0.0;
+        return {0.0};
+    }
+    
+    ///// Get the recycled directions U and orthonormalize C = A*U (U is updated accordingly):
+    std::vector<std::vector<double>> U = {}, C = {};
+    // A recycled space of another size (e.g. after a mesh change) is ignored:
+    if (recycled.countcolumns() == n)
+    {
+        double* recptr = recycled.getvalues();
+        for (int k = 0; k < recycled.countrows(); k++)
+        {
+            std::vector<double> u(recptr+k*n, recptr+(k+1)*n);
+            std::vector<double> c = product(u);
+            for (int j = 0; j < C.size(); j++)
+            {
+                double cj = dot(c.data(), C[j].data());
+                for (int i = 0; i < n; i++)
+                {
+                    c[i] -= cj*C[j][i];
+                    u[i] -= cj*U[j][i];
+                }
+            }
+            double normc = std::sqrt(dot(c.data(), c.data()));
+            if (normc == 0)
+                continue;
+            for (int i = 0; i < n; i++)
+            {
+                c[i] /= normc;
+                u[i] /= normc;
+            }
+            U.push_back(u); C.push_back(c);
+        }
+    }
+    int numdeflated = C.size();
+    
+    // Compute r = b - A * x:
+    std::vector<double> xvec(xptr, xptr+n);
+    std::vector<double> r = product(xvec);
+    for (int i = 0; i < n; i++)
+        r[i] = bptr[i] - r[i];
+    
+    // Remove the residual in the range of C:
+    for (int j = 0; j < numdeflated; j++)
+    {
+        double cj = dot(C[j].data(), r.data());
+        for (int i = 0; i < n; i++)
+        {
+            xptr[i] += cj*U[j][i];
+            r[i] -= cj*C[j][i];
+        }
+    }
+    
+    std::vector<double> relresvec = {std::sqrt(dot(r.data(), r.data()))/normb};
+    // Correction direction of every restart cycle:
+    std::vector<std::vector<double>> corrections = {};
+    
+    int totalits = 0;
+    while (relresvec[totalits] > relrestol && totalits < maxnumit)
+    {
+        int m = std::min(restart, maxnumit-totalits);
+        
+        double beta0 = relresvec[totalits]*normb;
+        
+        // Krylov vectors V, Hessenberg matrix (columnwise upper triangular) and projection B = C^T*A*V:
+        std::vector<std::vector<double>> V(1, r);
+        for (int i = 0; i < n; i++)
+            V[0][i] /= beta0;
+        std::vector<double> H(((1+m)*m)/2 + 1, 0.0);
+        std::vector<std::vector<double>> B(numdeflated, std::vector<double>(m, 0.0));
+        std::vector<double> sn(m, 0.0), cs(m, 0.0), beta(m+1, 0.0);
+        beta[0] = beta0;
+        
+        int k = 0;
+        for (k = 0; k < m; k++)
+        {
+            if (verbosity > 0)
+                std::cout << "gmres @" << totalits << " -> " << relresvec[totalits] << std::endl;
+                
+            if (relresvec[totalits] <= relrestol)
+                break;
+            
+            std::vector<double> w = product(V[k]);
+            
+            // Deflate then orthogonalize (modified Gram-Schmidt):
+            for (int j = 0; j < numdeflated; j++)
+            {
+                B[j][k] = dot(C[j].data(), w.data());
+                for (int i = 0; i < n; i++)
+                    w[i] -= B[j][k]*C[j][i];
+            }
+            double* h = &H[((1+k)*k)/2];
+            for (int j = 0; j <= k; j++)
+            {
+                h[j] = dot(V[j].data(), w.data());
+                for (int i = 0; i < n; i++)
+                    w[i] -= h[j]*V[j][i];
+            }
+            h[k+1] = std::sqrt(dot(w.data(), w.data()));
+            if (h[k+1] != 0)
+            {
+                for (int i = 0; i < n; i++)
+                    w[i] /= h[k+1];
+            }
+            V.push_back(w);
+            
+            // Eliminate the last element in the kth column of H and update the rotation matrix:
+            gentools::applygivensrotation(h, cs, sn, k);
+            
+            // Update the residual vector:
+            beta[k+1] = -sn[k] * beta[k];
+            beta[k] = cs[k] * beta[k];
+            
+            totalits++;
+            relresvec.push_back(std::abs(beta[k+1]) / normb);
+        }
+        
+        if (k == 0)
+            break;
+        
+        // Correction z = V*y - U*B*y:
+        std::vector<double> y(k);
+        gentools::solveuppertriangular(k, H.data(), beta.data(), y.data());
+        
+        std::vector<double> z(n, 0.0);
+        for (int j = 0; j < k; j++)
+        {
+            for (int i = 0; i < n; i++)
+                z[i] += y[j]*V[j][i];
+        }
+        for (int d = 0; d < numdeflated; d++)
+        {
+            double by = 0.0;
+            for (int j = 0; j < k; j++)
+                by += B[d][j]*y[j];
+            for (int i = 0; i < n; i++)
+                z[i] -= by*U[d][i];
+        }
+        for (int i = 0; i < n; i++)
+            xptr[i] += z[i];
+        corrections.push_back(z);
+        
+        // Restart from the true residual:
+        if (relresvec[totalits] > relrestol && totalits < maxnumit)
+        {
+            xvec = std::vector<double>(xptr, xptr+n);
+            r = product(xvec);
+            for (int i = 0; i < n; i++)
+                r[i] = bptr[i] - r[i];
+            relresvec[totalits] = std::sqrt(dot(r.data(), r.data()))/normb;
+        }
+    }
+    
+    ///// Keep the latest correction directions (then the previous recycled ones) for the next call:
+    std::vector<std::vector<double>> kept = {};
+    for (int c = corrections.size()-1; c >= 0 && kept.size() < numrecycled; c--)
+        kept.push_back(corrections[c]);
+    for (int j = 0; j < numdeflated && kept.size() < numrecycled; j++)
+        kept.push_back(U[j]);
+    
+    recycled = densemat(kept.size(), n);
+    double* recptr = recycled.getvalues();
+    for (int k = 0; k < kept.size(); k++)
+    {
+        for (int i = 0; i < n; i++)
+            recptr[k*n+i] = kept[k][i];
+    }
+    
+    return relresvec;
+}
+
 void sl::mapdofs(std::shared_ptr<dofmanager> dm, std::vector<std::shared_ptr<rawfield>> rfs, std::vector<bool> isdimactive, std::vector<indexmat>& sendinds, std::vector<indexmat>& recvinds)
 {
     std::shared_ptr<dtracker> dt = universe::getrawmesh()->getdtracker();
@@ -1976,9 +3191,10 @@ void sl::mapdofs(std::shared_ptr<dofmanager> dm, std::vector<std::shared_ptr<raw
                         for (int f = 0; f < nff; f++)
                         {
                             int rb = dm->getrangebegin(d, f);
+                            int rs = dm->getrangestep(d);
                             
                             for (int e = 0; e < ne; e++)
-                                sivals[index+e] = rb+e;
+                                sivals[index+e] = rb+rs*e;
                             index += ne;
                         }
                         ind += 4;
@@ -2064,8 +3280,9 @@ void sl::mapdofs(std::shared_ptr<dofmanager> dm, std::vector<std::shared_ptr<raw
                         int cdr = els->getdisjointregion(elemtype, ce);
                         int crbe = drs->getrangebegin(cdr);
                         int crb = dm->getrangebegin(cdr, f);
+                        int crs = dm->getrangestep(cdr);
                         
-                        rivals[index+e] = crb + ce-crbe;
+                        rivals[index+e] = crb + crs*(ce-crbe);
                     }
                     index += ne;
                 }
@@ -2140,6 +3357,117 @@ void sl::setdata(vec invec)
     invec.getpointer()->setvaluestoports();
 }
 
+void sl::setvalue(int physreg, std::vector<field> fields, std::vector<expression> inputs, int extraintegrationdegree)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    if (fields.size() != inputs.size())
+    {
+        std::cout << "Error in 'sl' namespace: in 'setvalue' expected as many expressions as fields" << std::endl;
+        abort();
+    }
+    
+    int numdisjregs = universe::getrawmesh()->getdisjointregions()->count();
+    
+    // Component fields and their value:
+    std::vector<std::shared_ptr<rawfield>> compfields = {};
+    std::vector<expression> compinputs = {};
+    for (int i = 0; i < fields.size(); i++)
+    {
+        std::shared_ptr<rawfield> rf = fields[i].getpointer();
+        std::string tn = rf->gettypename(false);
+        if (tn == "x" || tn == "y" || tn == "z")
+        {
+            std::cout << "Error in 'sl' namespace: cannot set the value for the x, y or z coordinate" << std::endl;
+            abort();
+        }
+        if (inputs[i].countcolumns() != 1 || inputs[i].countrows() != rf->countcomponents())
+        {
+            std::cout << "Error in 'sl' namespace: in 'setvalue' the value of field " << i << " must be set with a " << rf->countcomponents() << "x1 expression" << std::endl;
+            abort();
+        }
+        
+        // Fields without subfields (e.g. hcurl) are a single component:
+        bool hassubfields = (rf->countcomponents() > 1 && rf->countformfunctioncomponents() == 1);
+        for (int c = 0; c < rf->countcomponents(); c++)
+        {
+            if (hassubfields)
+            {
+                compfields.push_back(rf->comp(c));
+                compinputs.push_back(inputs[i].at(c,0));
+            }
+            else
+            {
+                compfields.push_back(rf);
+                compinputs.push_back(inputs[i]);
+                break;
+            }
+        }
+    }
+    
+    // Group the fields that have the same projection matrix:
+    std::map<std::tuple<std::string, std::vector<int>, std::vector<int>>, int> groupindexes;
+    std::vector<std::vector<int>> groups = {};
+    for (int i = 0; i < compfields.size(); i++)
+    {
+        std::shared_ptr<rawfield> rf = compfields[i];
+        
+        bool isalone = compinputs[i].iszero();
+        std::vector<std::shared_ptr<rawfield>> sons = rf->getsons();
+        for (int s = 0; s < sons.size(); s++)
+        {
+            for (int d = 0; d < numdisjregs; d++)
+                isalone = isalone || sons[s]->isdisjregconstrained(d) || sons[s]->isconditionallyconstrained(d) || sons[s]->isgauged(d) || sons[s]->isported(d);
+        }
+        if (isalone)
+        {
+            rf->setvalue(physreg, -1, NULL, compinputs[i], extraintegrationdegree);
+            continue;
+        }
+        
+        std::tuple<std::string, std::vector<int>, std::vector<int>> key = std::make_tuple(rf->gettypename(false), sons[0]->getinterpolationorders(), rf->getharmonics());
+        std::map<std::tuple<std::string, std::vector<int>, std::vector<int>>, int>::iterator it = groupindexes.find(key);
+        if (it == groupindexes.end())
+        {
+            groupindexes[key] = groups.size();
+            groups.push_back({i});
+        }
+        else
+            groups[it->second].push_back(i);
+    }
+    
+    for (int g = 0; g < groups.size(); g++)
+    {
+        // The first field of the group gives the structure:
+        field structfield(compfields[groups[g][0]]);
+        int numrhs = groups[g].size();
+    
+        // Block 0 is the projection matrix and block i+1 the rhs of the ith field:
+        formulation projection;
+        projection += integration(physreg, -1, dof(structfield)*tf(structfield), extraintegrationdegree, 0);
+        for (int i = 0; i < numrhs; i++)
+            projection += integration(physreg, -1, -tf(structfield)*compinputs[groups[g][i]], extraintegrationdegree, i+1);
+        
+        projection.generatein(1, {0});
+        mat A = projection.A();
+        
+        std::vector<vec> b(numrhs);
+        for (int i = 0; i < numrhs; i++)
+        {
+            projection.generatein(0, {i+1});
+            b[i] = projection.b();
+        }
+        
+        std::vector<vec> sols;
+        if (numrhs == 1)
+            sols = {solve(A, b[0])};
+        else
+            sols = solve(A, b);
+        
+        for (int i = 0; i < numrhs; i++)
+            compfields[groups[g][i]]->setdata(physreg, sols[i]|structfield, "set");
+    }
+}
 
 ////////// PREDEFINED OPERATORS
 
@@ -2297,6 +3625,36 @@ std::vector<integration> sl::continuitycondition(int gamma1, int gamma2, field u
     return output;
 }
 
+std::vector<integration> sl::continuitycondition(slidinginterface gamma1, slidinginterface gamma2, field u1, field u2, int lagmultorder)
+{
+    int g1 = gamma1.getphysicalregion(), g2 = gamma2.getphysicalregion();
+
+    std::shared_ptr<rawfield> ptr1 = u1.getpointer();
+    std::shared_ptr<rawfield> ptr2 = u2.getpointer();
+    
+    // Make sure the fields are similar:
+    if (ptr1->gettypename(false) != ptr2->gettypename(false) || ptr1->getharmonics() != ptr2->getharmonics())
+    {
+        std::cout << "Error in 'sl' namespace: in 'continuitycondition' expected two fields of same type and harmonic content" << std::endl;
+        abort();
+    }
+    
+    // Create the Lagrange multiplier field:
+    field lambda(ptr1->gettypename(false), ptr1->getharmonics());
+    lambda.noautomaticupdate();
+    lambda.getpointer()->setorder(g1, lagmultorder, false);
+    lambda.getpointer()->setorder(g2, lagmultorder, false);
+
+    // Create the integration object to output:
+    std::vector<integration> output(3);
+    
+    output[0] = integral(g1, dof(lambda)*tf(u1));
+    output[1] = integral(g2, -on(gamma1, dof(lambda)) * tf(u2));
+    output[2] = integral(g1, (dof(u1) - on(gamma2, dof(u2))) * tf(lambda));
+
+    return output;
+}
+
 std::vector<integration> sl::continuitycondition(int gamma1, int gamma2, field u1, field u2, std::vector<double> rotcent, double rotangz, double angzmod, double factor, int lagmultorder)
 {       
     universe::getrawmesh()->getphysicalregions()->errorundefined({gamma1, gamma2});
@@ -2749,7 +4107,7 @@ expression sl::predefinedelasticity(expression dofu, expression tfu, field u, ex
 expression sl::predefinedelectrostaticforce(expression input, expression E, expression epsilon)
 {
     int md = universe::getrawmesh()->getmeshdimension();
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
         md++;
        
     if (md <= 1)
@@ -2813,7 +4171,7 @@ expression sl::predefinedacoustics(expression dofp, expression tfp, expression c
         return ( -grad(dofp)*grad(tfp) -1.0/pow(c,2.0)*dtdt(dofp)*tfp );
     
     // Only valid for harmonic problems in case of nonzero attenuation:
-    if (universe::fundamentalfrequency <= 0)
+    if (universe::getsession()->fundamentalfrequency <= 0)
     {
         std::cout << "Error in 'sl' namespace: acoustics with nonzero attenuation is only valid for harmonic problems" << std::endl;
         abort();
@@ -2836,7 +4194,7 @@ expression sl::predefinedacousticradiation(expression dofp, expression tfp, expr
         return ( -1.0/c*dt(dofp)*tfp );
     
     // Only valid for harmonic problems in case of nonzero attenuation:
-    if (universe::fundamentalfrequency <= 0)
+    if (universe::getsession()->fundamentalfrequency <= 0)
     {
         std::cout << "Error in 'sl' namespace: acoustic radiation condition with nonzero attenuation is only valid for harmonic problems" << std::endl;
         abort();
@@ -2863,7 +4221,7 @@ expression sl::predefinedacousticstructureinteraction(expression dofp, expressio
         return ( -dofp*tfu*n * scaling + rho*dtdt(dofu)*n*tfp * invscal );
     
     // Only valid for harmonic problems in case of nonzero attenuation:
-    if (universe::fundamentalfrequency <= 0)
+    if (universe::getsession()->fundamentalfrequency <= 0)
     {
         std::cout << "Error in 'sl' namespace: acoustic structure interaction with nonzero attenuation is only valid for harmonic problems" << std::endl;
         abort();
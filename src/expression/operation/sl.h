@@ -14,11 +14,15 @@
 #include "integration.h"
 #include "universe.h"
 #include "iointerface.h"
+#include "vectorstream.h"
 #include "vec.h"
 #include "mat.h"
 #include "formulation.h"
 #include "rawmesh.h"
 #include "dofmanager.h"
+#include "profiler.h"
+#include "solverstats.h"
+#include "slidinginterface.h"
 
 class rawmesh;
 class expression;
@@ -54,13 +58,22 @@ namespace sl
     bool isempty(int physreg);
     bool isinside(int physregtocheck, int physreg);
     bool istouching(int physregtocheck, int physreg);
+    
+    // Locate the (x,y,z) coordinates {x1,y1,z1,x2,...} in the highest dimension elements of a physical region. 
+    // After the call 'elems' holds {type1,number1,type2,...} and 'kietaphis' the reference coordinates of every
+    // (x,y,z) coordinate (-1 element type and number if not found). These can be reused for repeated evaluations.
+    void locate(int physreg, std::vector<double>& xyzcoord, std::vector<int>& elems, std::vector<double>& kietaphis);
 
+    // Print the memory used by the mesh in use and the resident memory of this process:
+    void printmemory(void);
+    
     void printvector(std::vector<double> input);
     void printvector(std::vector<int> input);
     void printvector(std::vector<bool> input);
 
+    // Write a vector of doubles separated by a character (or as a NumPy array if the file name ends with .npy):
     void writevector(std::string filename, std::vector<double> towrite, char delimiter = ',', bool writesize = false);
-    // Load a vector of doubles separated by a character:
+    // Load a vector of doubles separated by a character (or from a .npy file). Use a 'vectorstream' to write rows across time steps:
     std::vector<double> loadvector(std::string filename, char delimiter = ',', bool sizeincluded = false);
 
     // Partition the mesh into numranks parts and return the mesh file name for each rank:
@@ -76,10 +89,14 @@ namespace sl
     // Tangent vector with unit norm:
     expression tangent(void);
 
-    // Write scalar or vector values at given coordinates to file:
+    // Write scalar or vector values at given coordinates to file. For .csv and .npy files a table is written with a 
+    // row per point holding the coordinates then the values:
     void scatterwrite(std::string filename, std::vector<double> xcoords, std::vector<double> ycoords, std::vector<double> zcoords, std::vector<double> compxevals, std::vector<double> compyevals = {}, std::vector<double> compzevals = {});
 
     void setaxisymmetry(void);
+    
+    // Number the nodes and elements of the meshes loaded afterwards along a space-filling curve (better locality and matrix bandwidth):
+    void allowmeshrenumbering(bool isallowed = true);
 
     void setfundamentalfrequency(double f);
     void settime(double t);
@@ -89,7 +106,7 @@ namespace sl
     // Return the field order to hold alpha % of the total coefficient weight. Return the actual field order with alpha set to -1.0.
     expression fieldorder(field input, double alpha = -1.0, double absthres = 0.0);
     
-    // Get a single harmonic:
+    // Get a single harmonic ('numfftharms' as in 'integral' below):
     expression getharmonic(int harmnum, expression input, int numfftharms = -1);
     // Make a harmonic expression:
     expression makeharmonic(std::vector<int> harms, std::vector<expression> exprs);
@@ -112,7 +129,10 @@ namespace sl
     // The time variable:
     expression t(void);
 
-    // Group .vtu timestep files in a .pvd file:
+    // Wait until all output files queued by the asynchronous output are written (see 'universe::setasynchronousoutput'):
+    void flushoutput(void);
+
+    // Group .vtu or .pvtu timestep files in a .pvd file:
     void grouptimesteps(std::string filename, std::vector<std::string> filestogroup, std::vector<double> timevals);
     void grouptimesteps(std::string filename, std::string fileprefix, int firstint, std::vector<double> timevals);
     
@@ -162,6 +182,8 @@ namespace sl
     expression on(int physreg, expression expr, bool errorifnotfound = true);
     // Interpolate at coordinates shifted by 'coordshift':
     expression on(int physreg, expression coordshift, expression expr, bool errorifnotfound = true);
+    // Interpolate on a sliding interface with its precomputed angular lookup (no point search):
+    expression on(slidinginterface si, expression expr, bool errorifnotfound = true);
 
     expression comp(int selectedcomp, expression input);
     expression compx(expression input);
@@ -200,10 +222,21 @@ namespace sl
     // to know with how many harmonics the coef multiplying the tf
     // and/or dof should be approximated. Set 'numcoefharms' negative
     // and it will be as if you were calling the above non
-    // multiharmonic functions.
+    // multiharmonic functions. Set it to 0 to use the smallest
+    // aliasing free number for the harmonics of the fields in the
+    // coef (see 'universe::setmaxautofftevals' for coefs that are
+    // not polynomial in the multiharmonic fields).
     integration integral(int physreg, int numcoefharms, expression tointegrate, int integrationorderdelta = 0, int blocknumber = 0);
     integration integral(int physreg, int numcoefharms, expression meshdeform, expression tointegrate, int integrationorderdelta = 0, int blocknumber = 0);
 
+    // Directional derivative of 'input' with respect to the fields in 'fields': every occurence of these fields is
+    // differentiated and replaced by its dof. The expression to differentiate cannot include a dof but can include a tf.
+    expression derivative(expression input, std::vector<field> fields);
+    // Newton linearization of the weak form residual 'residual' (including the tf but no dof) around the current values
+    // of the 'unknowns' fields. With this term the nonlinear iterations of 'solve', 'impliciteuler' and 'genalpha'
+    // are Newton iterations: the exact tangent is assembled and each solve directly gives the next iterate of the fields.
+    integration newtonintegral(int physreg, expression residual, std::vector<field> unknowns, int integrationorderdelta = 0, int blocknumber = 0);
+
     expression dof(expression input);
     expression dof(expression input, int physreg);
     expression tf(expression input);
@@ -216,8 +249,10 @@ namespace sl
     bool adapt(int verbosity = 0);
     bool alladapt(int verbosity = 0);
     
-    // Define a Zienkiewicz-Zhu type error indicator:
-    expression zienkiewiczzhu(expression input);
+    // Define a Zienkiewicz-Zhu type error indicator. The indicator is not recomputed while the mesh and the input are unchanged.
+    // With a non-negative 'incrementaltolerance' it is only recomputed around the elements on which a field coefficient of the
+    // input changed by more than 'incrementaltolerance' times the largest coefficient of the field (0 for any change):
+    expression zienkiewiczzhu(expression input, double incrementaltolerance = -1);
 
     // Define typically used arrays for convenience:
     expression array1x1(expression term11);
@@ -237,9 +272,38 @@ namespace sl
     std::vector<vec> solve(mat A, std::vector<vec> b, std::string soltype = "lu");
     // Densematrix 'b' has size #rhs x #dofs:
     densemat solve(mat A, densemat b, std::string soltype);
+    // Direct resolution of transpose(A)*x = b (e.g. an adjoint problem) with the same arguments as above. If the factorization
+    // of A is kept (see 'mat::reusefactorization' and 'formulation::reusesymbolicfactorization') the factorization done by
+    // a previous solve with A is reused and only the triangular solves are done. The solution is zero on the constrained dofs:
+    vec solvetranspose(mat A, vec b, std::string soltype = "lu");
+    std::vector<vec> solvetranspose(mat A, std::vector<vec> b, std::string soltype = "lu");
+    densemat solvetranspose(mat A, densemat b, std::string soltype);
+    // Predict the cost of a direct solve with only the analysis phase of MUMPS (no numeric factorization is done).
+    // The estimated memory in MB of an in-core and of an out-of-core factorization and the estimated number of
+    // entries in the factors are returned (see 'universe::setoutofcore' to factorize out-of-core):
+    void predictfactorization(mat A, double& incorememory, double& outofcorememory, long long int& numfactorentries, std::string soltype = "lu");
     
-    // Iterative resolution (with or without diagonal scaling):
+    // Iterative resolution (with or without diagonal scaling). Matrix-free operators require preconditioner type 'none'.
+    // The 'fieldsplit-jacobi', 'fieldsplit-gaussseidel' and 'fieldsplit-schur' preconditioners have one block per field
+    // (see 'dofmanager::getfieldsplits'). The Schur complement strategy requires exactly two splits.
+    // For multiharmonic problems the 'harmonicblock' preconditioner only factorizes (with a direct solver) the diagonal block
+    // of every harmonic. The factorization memory then grows linearly with the number of harmonics.
+    // The algebraic multigrid preconditioners 'gamg' and 'hypre' (BoomerAMG, requires petsc with hypre) get the rigid body
+    // modes of the interleaved 'h1' vector fields and the constant of the other 'h1' fields as near-nullspace.
+    // The 'pmultigrid' preconditioner is a two level p-multigrid for high order fields: the higher order modes are smoothed
+    // with SOR sweeps and the system on the lowest order form functions (e.g. the order 1 'h1' dofs) is factorized with MUMPS.
+    // The 'hmultigrid' preconditioner is a two level h-multigrid for meshes refined by h-adaptivity: the coarse space is made of
+    // the order 1 'h1' functions on the original mesh and is connected to the refined mesh by the refinement tree (the other dofs
+    // are only smoothed). In both cases the coarse solver can be changed with the petsc options (e.g. '-mg_coarse_pc_type gamg').
+    // The 'ams' preconditioner (hypre auxiliary space Maxwell solver, requires petsc with hypre) is for order 0 'hcurl' fields. The
+    // discrete gradient is built from the mesh edges. Pure curl-curl problems (no mass term) can be solved without any gauge.
+    // If 'reusefactorization' was called on A the Krylov solver and its preconditioner are kept in A and reused by its next solves.
     void solve(mat A, vec b, vec sol, double& relrestol, int& maxnumit, std::string soltype = "bicgstab", std::string precondtype = "sor", int verbosity = 1, bool diagscaling = false);
+    // Multi-rhs iterative resolution. The preconditioner is set up once for all rhs. Solver types 'gmres' and 'bicgstab'
+    // solve one rhs after the other while the block Krylov solvers 'bgmres' and 'bcg' (block conjugate gradient, for
+    // symmetric positive definite matrices) iterate on all rhs at once (requires petsc with hpddm). The initial guesses
+    // are provided in 'sol'. The iteration number and residual norm of the last solve are returned.
+    void solve(mat A, std::vector<vec> b, std::vector<vec> sol, double& relrestol, int& maxnumit, std::string soltype = "bgmres", std::string precondtype = "sor", int verbosity = 1);
     
     
     // Exchange densemat data with MPI:
@@ -248,6 +312,10 @@ namespace sl
     // MPI based gmres with custom matrix free product (no restart). Initial guess and solution are in x.
     // Relative residual at each iteration is returned. Length is number of iterations + 1 (first is initial residual).
     std::vector<double> gmres(densemat (*mymatmult)(densemat), densemat b, densemat x, double relrestol, int maxnumit, int verbosity = 1);
+    // Restarted (every 'restart' iterations) MPI based gmres with Krylov subspace recycling. The recycled directions (one per row
+    // of 'recycled', empty if none) are deflated from the Krylov space (GCRO). On output 'recycled' holds at most 'numrecycled'
+    // of the latest correction directions, to be passed to the next call with a similar operator (e.g. the next time step).
+    std::vector<double> gmres(densemat (*mymatmult)(densemat), densemat b, densemat x, double relrestol, int maxnumit, int restart, densemat& recycled, int numrecycled, int verbosity = 1);
     
     // Know which dofs to send and at which dofs to receive for the DDM. Choose the rawfields and the domain interface dimensions (length 3) to consider.
     void mapdofs(std::shared_ptr<dofmanager> dm, std::vector<std::shared_ptr<rawfield>> rfs, std::vector<bool> isdimactive, std::vector<indexmat>& sendinds, std::vector<indexmat>& recvinds);
@@ -261,6 +329,11 @@ namespace sl
     
     // Set all fields and ports to the values available in the vec object:
     void setdata(vec invec);
+    
+    // Same as 'fields[i].setvalue(physreg, inputs[i], extraintegrationdegree)' for every field. The component fields with the same
+    // type, interpolation orders and harmonics share the projection matrix and its factorization and are solved as a multiple rhs
+    // system. Fields with constraints, ports or gauges on any region are projected on their own:
+    void setvalue(int physreg, std::vector<field> fields, std::vector<expression> inputs, int extraintegrationdegree = 0);
 
 
     ////////// PREDEFINED OPERATORS
@@ -284,6 +357,9 @@ namespace sl
     
     std::vector<integration> continuitycondition(int gamma1, int gamma2, field u1, field u2, int lagmultorder, bool errorifnotfound = true);
     std::vector<integration> continuitycondition(int gamma1, int gamma2, field u1, field u2, std::vector<double> rotcent, double rotangz, double angzmod, double factor, int lagmultorder);
+    // Same as the first one but the interfaces are coupled with their precomputed angular lookup (full circle airgaps).
+    // The interface objects are shared: updating their rotation angle updates the coupling without any point search.
+    std::vector<integration> continuitycondition(slidinginterface gamma1, slidinginterface gamma2, field u1, field u2, int lagmultorder);
     std::vector<integration> periodicitycondition(int gamma1, int gamma2, field u, std::vector<double> dat1, std::vector<double> dat2, double factor, int lagmultorder);
 
     // Isotropic linear elasticity:
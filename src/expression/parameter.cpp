@@ -3,7 +3,7 @@
 
 parameter::parameter(void)
 { 
-    if (universe::myrawmesh == NULL)
+    if (universe::getsession()->myrawmesh == NULL)
     {
         std::cout << "Error in 'parameter' object: cannot define a parameter before the mesh is loaded" << std::endl;
         abort();
@@ -14,7 +14,7 @@ parameter::parameter(void)
 
 parameter::parameter(int numrows, int numcols)
 { 
-    if (universe::myrawmesh == NULL)
+    if (universe::getsession()->myrawmesh == NULL)
     {
         std::cout << "Error in 'parameter' object: cannot define a parameter before the mesh is loaded" << std::endl;
         abort();
@@ -0,0 +1,127 @@
+#include "probe.h"
+#include "sl.h"
+
+
+probe::probe(int physreg, std::vector<double> xyzcoord)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+
+    if (xyzcoord.size()%3 != 0)
+    {
+        std::cout << "Error in 'probe' object: the coordinate vector should have a length that is a multiple of 3" << std::endl;
+        abort();
+    }
+
+    myphysreg = physreg;
+    mycoords = xyzcoord;
+
+    update();
+}
+
+void probe::update(void)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+
+    if (myrawmesh.lock() == rm && rm->getmeshnumber() == mymeshnumber && rm->getstate() == mymeshstate)
+        return;
+
+    myrawmesh = rm;
+    mymeshnumber = rm->getmeshnumber();
+    mymeshstate = rm->getstate();
+
+    int numcoords = count();
+
+    std::vector<int> elems;
+    std::vector<double> kietaphis;
+    sl::locate(myphysreg, mycoords, elems, kietaphis);
+
+    myisfound = std::vector<bool>(numcoords);
+    for (int c = 0; c < numcoords; c++)
+        myisfound[c] = (elems[2*c+0] != -1);
+
+    mydisjregs = {}; mykietaphis = {}; mycoordnums = {}; myelems = {};
+
+    // Group the points by element type then by reference coordinates:
+    referencecoordinategroup rcg(elems, kietaphis);
+
+    std::vector<int> disjregs = rm->getphysicalregions()->get(myphysreg)->getdisjointregions();
+    disjointregionselector mydisjregselector(disjregs, {});
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+    {
+        std::vector<int> curdisjregs = mydisjregselector.getgroup(i);
+        int elemtypenum = rm->getdisjointregions()->getelementtypenumber(curdisjregs[0]);
+
+        rcg.evalat(elemtypenum);
+
+        while (rcg.next())
+        {
+            mydisjregs.push_back(curdisjregs);
+            mykietaphis.push_back(rcg.getreferencecoordinates());
+            mycoordnums.push_back(rcg.getcoordinatenumber());
+            myelems.push_back(rcg.getelements());
+        }
+    }
+}
+
+std::vector<double> probe::evaluate(expression expr)
+{
+    update();
+
+    std::vector<int> disjregs = universe::getrawmesh()->getphysicalregions()->get(myphysreg)->getdisjointregions();
+    if (not(expr.isharmonicone(disjregs)))
+    {
+        std::cout << "Error in 'probe' object: cannot evaluate a multiharmonic expression (only constant harmonic 1)" << std::endl;
+        abort();
+    }
+
+    int numcoords = count();
+    int numrows = expr.countrows(), numcols = expr.countcolumns();
+    int exprlen = numrows*numcols;
+
+    std::vector<double> output(numcoords*exprlen, 0.0);
+
+    universe::allowestimatorupdate(true);
+
+    for (int g = 0; g < myelems.size(); g++)
+    {
+        int numrefcoords = mykietaphis[g].size()/3;
+
+        for (int i = 0; i < exprlen; i++)
+        {
+            std::shared_ptr<operation> curop = expr.getoperationinarray(i/numcols, i%numcols)->simplify(mydisjregs[g]);
+            bool isorientationdependent = curop->isvalueorientationdependent(mydisjregs[g]);
+
+            // Loop on all total orientations (if required):
+            elementselector myselector(mydisjregs[g], myelems[g], isorientationdependent);
+            do
+            {
+                std::vector<int> origindexes = myselector.getoriginalindexes();
+
+                // Clean storage before allowing reuse:
+                universe::forbidreuse();
+                universe::allowreuse();
+                densemat interp = curop->interpolate(myselector, mykietaphis[g], NULL)[1][0];
+                universe::forbidreuse();
+
+                double* interpvals = interp.getvalues();
+                for (int e = 0; e < origindexes.size(); e++)
+                {
+                    for (int c = 0; c < numrefcoords; c++)
+                        output[mycoordnums[g][origindexes[e]*numrefcoords+c]*exprlen+i] = interpvals[e*numrefcoords+c];
+                }
+            }
+            while (myselector.next());
+        }
+    }
+
+    universe::allowestimatorupdate(false);
+
+    return output;
+}
+
+std::vector<bool> probe::isfound(void)
+{
+    update();
+
+    return myisfound;
+}
@@ -0,0 +1,67 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object evaluates expressions at a fixed set of (x,y,z) points (e.g. sensors in a time loop).
+// The points are located and grouped by element and reference coordinate once. Each evaluation then
+// only interpolates the expression at the stored reference coordinates. The location is redone
+// automatically when the mesh has changed (mesh move, hp-adaptivity, ...).
+
+
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "expression.h"
+#include "rawmesh.h"
+#include "referencecoordinategroup.h"
+#include "disjointregionselector.h"
+
+class expression;
+class rawmesh;
+
+class probe
+{
+
+    private:
+
+        int myphysreg = -1;
+        std::vector<double> mycoords = {};
+
+        // Mesh on which the points were located:
+        std::weak_ptr<rawmesh> myrawmesh;
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+
+        std::vector<bool> myisfound = {};
+
+        // One entry per group of elements with the same reference coordinates:
+        std::vector<std::vector<int>> mydisjregs = {};
+        std::vector<std::vector<double>> mykietaphis = {};
+        std::vector<std::vector<int>> mycoordnums = {};
+        std::vector<std::vector<int>> myelems = {};
+
+        // Locate the points if not yet done on the current mesh:
+        void update(void);
+
+    public:
+
+        probe(void) {};
+        // The points are searched in the highest dimension elements of the physical region:
+        probe(int physreg, std::vector<double> xyzcoord);
+
+        int count(void) { return mycoords.size()/3; };
+
+        // Evaluate the expression at all points. Non-scalar expressions are flattened and their values
+        // concatenated one point after the other (as in 'expression::interpolate'). The value is 0 at the points not found.
+        std::vector<double> evaluate(expression expr);
+
+        // Tell which points are in the physical region:
+        std::vector<bool> isfound(void);
+
+};
+
+#endif
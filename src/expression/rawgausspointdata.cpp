@@ -0,0 +1,172 @@
+#include "rawgausspointdata.h"
+#include "rawmesh.h"
+
+
+rawgausspointdata::rawgausspointdata(int numrows, int numcols, double initvalue)
+{
+    if (numrows <= 0 || numcols <= 0)
+    {
+        std::cout << "Error in 'gausspointdata' object: cannot have a number of rows or columns smaller than one" << std::endl;
+        abort();
+    }
+    
+    mynumrows = numrows;
+    mynumcols = numcols;
+    myinitvalue = initvalue;
+    mystate = universe::getnewstate();
+}
+
+void rawgausspointdata::setvalue(int physreg, expression input, int integrationorder, std::string rulefamily)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    if (input.countrows() != mynumrows || input.countcolumns() != mynumcols)
+    {
+        std::cout << "Error in 'gausspointdata' object: expected a " << mynumrows << "x" << mynumcols << " expression in 'setvalue'" << std::endl;
+        abort();
+    }
+    if (integrationorder < 0)
+    {
+        std::cout << "Error in 'gausspointdata' object: the integration order cannot be negative" << std::endl;
+        abort();
+    }
+    if (rulefamily != "auto" && rulefamily != "default" && rulefamily != "collapsed")
+    {
+        std::cout << "Error in 'gausspointdata' object: unknown rule family '" << rulefamily << "' (use 'auto', 'default' or 'collapsed')" << std::endl;
+        abort();
+    }
+    
+    rawmesh* rm = universe::getrawmesh().get();
+    // The values set on another mesh or at other Gauss points are dropped:
+    if (rm != mymeshptr || rm->getmeshnumber() != mymeshnumber || integrationorder != myintegrationorder || rulefamily != myrulefamily)
+    {
+        myvalues = std::vector<std::vector<double>>(8);
+        mygpcoords = std::vector<std::vector<double>>(8);
+        myrulefamily = rulefamily;
+        mymeshptr = rm;
+        mymeshnumber = rm->getmeshnumber();
+        myintegrationorder = integrationorder;
+    }
+    
+    int numcomps = mynumrows*mynumcols;
+    std::vector<std::shared_ptr<operation>> ops(numcomps);
+    for (int c = 0; c < numcomps; c++)
+    {
+        ops[c] = input.getoperationinarray(c/mynumcols, c%mynumcols);
+        if (ops[c]->isdofincluded() || ops[c]->istfincluded())
+        {
+            std::cout << "Error in 'gausspointdata' object: the expression in 'setvalue' cannot include a dof() or tf()" << std::endl;
+            abort();
+        }
+    }
+    
+    std::vector<int> selecteddisjregs = ((rm->getphysicalregions())->get(physreg))->getdisjointregions();
+    
+    if (not(input.isharmonicone(selecteddisjregs)))
+    {
+        std::cout << "Error in 'gausspointdata' object: cannot set a multiharmonic expression (only constant harmonic 1)" << std::endl;
+        abort();
+    }
+    
+    elements* els = rm->getelements();
+    
+    disjointregionselector mydisjregselector(selecteddisjregs, {});
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+    {
+        std::vector<int> mydisjregs = mydisjregselector.getgroup(i);
+        
+        int elementtypenumber = (rm->getdisjointregions())->getelementtypenumber(mydisjregs[0]);
+        std::string family = rulefamily;
+        if (rulefamily == "auto")
+        {
+            int numdefault = gausspoints::count(elementtypenumber, integrationorder, "default");
+            int numcollapsed = gausspoints::count(elementtypenumber, integrationorder, "collapsed");
+            family = ((numdefault < 0 || numcollapsed < numdefault) ? "collapsed" : "default");
+        }
+        gausspoints mygausspoints(elementtypenumber, integrationorder, family);
+        std::vector<double> evaluationpoints = mygausspoints.getcoordinates();
+        int numgp = mygausspoints.count();
+        mygpcoords[elementtypenumber] = evaluationpoints;
+        
+        std::vector<double>& vals = myvalues[elementtypenumber];
+        if (vals.size() == 0)
+            vals = std::vector<double>(els->count(elementtypenumber)*numgp*numcomps, myinitvalue);
+        
+        elementselector myselector(mydisjregs, input.isvalueorientationdependent(mydisjregs));
+        do
+        {
+            std::shared_ptr<jacobian> myjacobian(new jacobian(myselector, evaluationpoints, NULL));
+            universe::getcontext()->computedjacobian = myjacobian;
+            universe::allowreuse();
+            
+            std::vector<int> elemnums = myselector.getelementnumbers();
+            for (int c = 0; c < numcomps; c++)
+            {
+                densemat compinterpolated = ops[c]->interpolate(myselector, evaluationpoints, NULL)[1][0];
+                double* compvals = compinterpolated.getvalues();
+                
+                for (int e = 0; e < elemnums.size(); e++)
+                {
+                    for (int g = 0; g < numgp; g++)
+                        vals[(elemnums[e]*numgp+g)*numcomps+c] = compvals[e*numgp+g];
+                }
+            }
+            
+            universe::forbidreuse();
+        }
+        while (myselector.next());
+    }
+    
+    mystate = universe::getnewstate();
+}
+
+densemat rawgausspointdata::getvalues(int row, int col, elementselector& elemselect, std::vector<double>& evaluationcoordinates)
+{
+    int elementtypenumber = elemselect.getelementtypenumber();
+    int numelems = elemselect.countinselection();
+    int numevalpts = evaluationcoordinates.size()/3;
+    
+    // The initial value is constant:
+    if (myintegrationorder == -1 || myvalues[elementtypenumber].size() == 0)
+        return densemat(numelems, numevalpts, myinitvalue);
+    
+    rawmesh* rm = universe::getrawmesh().get();
+    if (rm != mymeshptr || rm->getmeshnumber() != mymeshnumber)
+    {
+        std::cout << "Error in 'gausspointdata' object: the mesh has changed since the values were set" << std::endl;
+        abort();
+    }
+    
+    std::vector<double>& gpcoords = mygpcoords[elementtypenumber];
+    bool isatgausspoints = (gpcoords.size() == evaluationcoordinates.size());
+    for (int i = 0; isatgausspoints && i < gpcoords.size(); i++)
+        isatgausspoints = (std::abs(gpcoords[i]-evaluationcoordinates[i]) < 1e-10);
+    if (isatgausspoints == false)
+    {
+        std::cout << "Error in 'gausspointdata' object: the values can only be evaluated at the Gauss points of integration order " << myintegrationorder << " (set the same integration order in the integral)" << std::endl;
+        abort();
+    }
+    
+    int numcomps = mynumrows*mynumcols;
+    int comp = row*mynumcols+col;
+    std::vector<int> elemnums = elemselect.getelementnumbers();
+    std::vector<double>& vals = myvalues[elementtypenumber];
+    
+    densemat output(numelems, numevalpts);
+    double* outvals = output.getvalues();
+    for (int e = 0; e < numelems; e++)
+    {
+        for (int g = 0; g < numevalpts; g++)
+            outvals[e*numevalpts+g] = vals[(elemnums[e]*numevalpts+g)*numcomps+comp];
+    }
+    
+    return output;
+}
+
+void rawgausspointdata::print(void)
+{
+    std::cout << "Gauss point data of size " << mynumrows << "x" << mynumcols;
+    if (myintegrationorder >= 0)
+        std::cout << " at the Gauss points of integration order " << myintegrationorder;
+    std::cout << std::endl;
+}
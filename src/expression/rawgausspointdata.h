@@ -0,0 +1,71 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+#ifndef RAWGAUSSPOINTDATA_H
+#define RAWGAUSSPOINTDATA_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include "universe.h"
+#include "densemat.h"
+#include "elementselector.h"
+#include "expression.h"
+
+class expression;
+class rawmesh;
+
+class rawgausspointdata
+{
+
+    private:
+        
+        int mynumrows = 1;
+        int mynumcols = 1;
+        
+        // Value everywhere no value was set:
+        double myinitvalue = 0.0;
+        
+        // Integration order and rule family of the Gauss points holding the values (-1 if no value was set):
+        int myintegrationorder = -1;
+        std::string myrulefamily = "auto";
+        // Reference coordinates of the Gauss points on every element type:
+        std::vector<std::vector<double>> mygpcoords = std::vector<std::vector<double>>(8);
+        
+        // Mesh on which the values were set:
+        rawmesh* mymeshptr = NULL;
+        int mymeshnumber = -1;
+        
+        long long int mystate = -1;
+        
+        // Value of component c at Gauss point g of element e of type t at myvalues[t][(e*numgp+g)*numcomps+c]
+        // (empty if no value was set on elements of type t):
+        std::vector<std::vector<double>> myvalues = std::vector<std::vector<double>>(8);
+        
+    public:
+        
+        rawgausspointdata(int numrows, int numcols, double initvalue);
+        
+        int countrows(void) { return mynumrows; };
+        int countcolumns(void) { return mynumcols; };
+        
+        int getintegrationorder(void) { return myintegrationorder; };
+        
+        // Evaluate the expression at the Gauss points of the given integration order on every element in the physical region.
+        // Rule family "auto" takes the rule with the fewest points, as in the formulation integrals with the "auto" rule:
+        void setvalue(int physreg, expression input, int integrationorder, std::string rulefamily = "auto");
+        
+        // Values of a component at the Gauss points of the selected elements (one row per element). The evaluation
+        // coordinates must be the Gauss points of the integration order used in 'setvalue':
+        densemat getvalues(int row, int col, elementselector& elemselect, std::vector<double>& evaluationcoordinates);
+        
+        long long int getstate(void) { return mystate; };
+        
+        void print(void);
+
+};
+
+#endif
@@ -71,6 +71,7 @@ void rawparameter::set(int physreg, expression input)
     }
     
     maxopnum++;
+    mystate = universe::getnewstate();
     
     // Consider ALL disjoint regions in the physical region with (-1):
     std::vector<int> selecteddisjregs = ((universe::getrawmesh()->getphysicalregions())->get(physreg))->getdisjointregions(-1);
@@ -95,6 +96,22 @@ void rawparameter::set(int physreg, expression input)
     }
 }
 
+long long int rawparameter::getstate(void)
+{
+    long long int output = mystate;
+    
+    for (int d = 0; d < myoperations.size(); d++)
+    {
+        for (int i = 0; i < myoperations[d].size(); i++)
+        {
+            if (myoperations[d][i] != NULL)
+                output = std::max(output, myoperations[d][i]->getstate());
+        }
+    }
+    
+    return output;
+}
+
 std::shared_ptr<operation> rawparameter::get(int disjreg, int row, int col)
 {
     synchronize();
@@ -103,6 +120,23 @@ std::shared_ptr<operation> rawparameter::get(int disjreg, int row, int col)
     return myoperations[disjreg][row*mynumcols+col];
 }
 
+std::vector<std::shared_ptr<operation>> rawparameter::getoperations(void)
+{
+    synchronize();
+    
+    std::vector<std::shared_ptr<operation>> output = {};
+    for (int d = 0; d < myoperations.size(); d++)
+    {
+        for (int i = 0; i < myoperations[d].size(); i++)
+        {
+            if (myoperations[d][i] != NULL)
+                output.push_back(myoperations[d][i]);
+        }
+    }
+    
+    return output;
+}
+
 int rawparameter::countrows(void)
 {
     return mynumrows;
@@ -141,10 +175,12 @@ std::vector<std::vector<densemat>> rawparameter::interpolate(int row, int col, e
         std::vector<int> selectedelementindexes = elemselect.getelementindexes();
         elementselector myselection = elemselect.extractselection();
         
-        auto allstorage = universe::selectsubset(numevalpts, selectedelementindexes);
+        // Evaluate in a context holding the element subset of the current storage:
+        evaluationcontext subsetcontext = universe::getcontext()->extractsubset(numevalpts, selectedelementindexes);
+        evaluationcontext* previouscontext = universe::setcontext(&subsetcontext);
         // IMPORTANT: Harmonic numbers can be different from one disj. reg. to the other:
         std::vector<std::vector<densemat>> currentinterp = myoperations[mydisjregs[0]][row*mynumcols+col]->interpolate(myselection, evaluationcoordinates, meshdeform);
-        universe::restore(allstorage);
+        universe::setcontext(previouscontext);
         
         // Preallocate the harmonics not yet in 'out':
         if (out.size() < currentinterp.size())
@@ -204,9 +240,11 @@ densemat rawparameter::multiharmonicinterpolate(int row, int col, int numtimeeva
                 selectedcolumns[j*numevalpts+k] = selectedelementindexes[j]*numevalpts+k;
         }
         
-        auto allstorage = universe::selectsubset(numevalpts, selectedelementindexes);
+        // Evaluate in a context holding the element subset of the current storage:
+        evaluationcontext subsetcontext = universe::getcontext()->extractsubset(numevalpts, selectedelementindexes);
+        evaluationcontext* previouscontext = universe::setcontext(&subsetcontext);
         densemat currentinterp = myoperations[mydisjregs[0]][row*mynumcols+col]->multiharmonicinterpolate(numtimeevals, myselection, evaluationcoordinates, meshdeform);
-        universe::restore(allstorage);
+        universe::setcontext(previouscontext);
         
         out.insertatcolumns(selectedcolumns, currentinterp);
     }
@@ -39,6 +39,9 @@ class rawparameter
         
         int mymeshnumber = 0;
         
+        // State of the last call to 'set':
+        long long int mystate = 0;
+        
         // Track the calls to 'set'.
         std::vector<std::pair<int, expression>> mystructuretracker = {};
         
@@ -63,6 +66,11 @@ class rawparameter
         void set(int physreg, expression input);
 
         std::shared_ptr<operation> get(int disjreg, int row, int col);
+        // Get the operations on all disjoint regions on which the parameter is defined:
+        std::vector<std::shared_ptr<operation>> getoperations(void);
+        
+        // Get the state of the last modification of the parameter or of any of its operations:
+        long long int getstate(void);
 
         int countrows(void);
         int countcolumns(void);
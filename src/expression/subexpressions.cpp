@@ -0,0 +1,118 @@
+#include "subexpressions.h"
+
+
+bool subexpressions::isstructural(std::shared_ptr<operation> op)
+{
+    if (op->issum() || op->isproduct())
+        return true;
+
+    return (std::dynamic_pointer_cast<oppower>(op) != NULL || std::dynamic_pointer_cast<opinversion>(op) != NULL || std::dynamic_pointer_cast<opabs>(op) != NULL || std::dynamic_pointer_cast<oplog10>(op) != NULL || std::dynamic_pointer_cast<opsin>(op) != NULL || std::dynamic_pointer_cast<opcos>(op) != NULL || std::dynamic_pointer_cast<optan>(op) != NULL || std::dynamic_pointer_cast<opasin>(op) != NULL || std::dynamic_pointer_cast<opacos>(op) != NULL || std::dynamic_pointer_cast<opatan>(op) != NULL);
+}
+
+int subexpressions::getid(std::shared_ptr<operation> op)
+{
+    std::unordered_map<operation*, int>::iterator it = myids.find(op.get());
+    if (it != myids.end())
+        return it->second;
+
+    char buf[128];
+    std::string key;
+    if (isstructural(op))
+    {
+        key = typeid(*op).name();
+        std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+        for (int i = 0; i < arguments.size(); i++)
+            key += " " + std::to_string(getid(arguments[i]));
+    }
+    else if (op->isconstant())
+    {
+        // The exact value is used:
+        snprintf(buf, sizeof(buf), "constant %a", op->getvalue());
+        key = buf;
+    }
+    else if (op->isfield())
+    {
+        snprintf(buf, sizeof(buf), "field %p %d %d %d %d %d", (void*)op->getfieldpointer().get(), op->gettimederivative(), op->getspacederivative(), op->getkietaphiderivative(), op->getformfunctioncomponent(), op->getfieldcomponent());
+        key = buf;
+    }
+    else if (op->isparameter())
+    {
+        snprintf(buf, sizeof(buf), "parameter %p %d %d", (void*)op->getparameterpointer().get(), op->getselectedrow(), op->getselectedcol());
+        key = buf;
+    }
+    else
+    {
+        snprintf(buf, sizeof(buf), "operation %p", (void*)op.get());
+        key = buf;
+    }
+
+    int id;
+    std::unordered_map<std::string, int>::iterator keyit = mykeyids.find(key);
+    if (keyit != mykeyids.end())
+        id = keyit->second;
+    else
+    {
+        id = myrepresentatives.size();
+        mykeyids[key] = id;
+        myrepresentatives.push_back(op);
+        myoccurences.push_back(0);
+    }
+    myids[op.get()] = id;
+
+    return id;
+}
+
+void subexpressions::replace(std::shared_ptr<operation> op, std::vector<bool>& isreplaced)
+{
+    int id = getid(op);
+    if (isreplaced[id] || not(isstructural(op)))
+        return;
+    isreplaced[id] = true;
+
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        std::shared_ptr<operation> rep = myrepresentatives[getid(arguments[i])];
+        if (rep != arguments[i])
+            op->replaceargument(i, rep);
+        replace(rep, isreplaced);
+    }
+}
+
+int subexpressions::share(std::vector<std::shared_ptr<operation>>& ops)
+{
+    subexpressions sub;
+
+    for (int i = 0; i < ops.size(); i++)
+        sub.myoccurences[sub.getid(ops[i])]++;
+
+    // Count the occurences as argument of the representatives (every representative is counted once):
+    for (int id = 0; id < sub.myrepresentatives.size(); id++)
+    {
+        if (not(isstructural(sub.myrepresentatives[id])))
+            continue;
+        std::vector<std::shared_ptr<operation>> arguments = sub.myrepresentatives[id]->getarguments();
+        for (int i = 0; i < arguments.size(); i++)
+            sub.myoccurences[sub.getid(arguments[i])]++;
+    }
+
+    std::vector<bool> isreplaced(sub.myrepresentatives.size(), false);
+    for (int i = 0; i < ops.size(); i++)
+    {
+        ops[i] = sub.myrepresentatives[sub.getid(ops[i])];
+        sub.replace(ops[i], isreplaced);
+    }
+
+    // Fields and parameters are already reused by the universe:
+    int numreused = 0;
+    for (int id = 0; id < sub.myrepresentatives.size(); id++)
+    {
+        if (sub.myoccurences[id] > 1 && isstructural(sub.myrepresentatives[id]))
+        {
+            sub.myrepresentatives[id]->reuseit(true);
+            numreused++;
+        }
+    }
+
+    return numreused;
+}
@@ -0,0 +1,59 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object finds the structurally identical subtrees in a set of operations (for example
+// the coefficients of all terms in a formulation contribution) and makes them point to a
+// single operation flagged for reuse. That operation is then only interpolated once per
+// element block instead of once per occurence.
+//
+// Two subtrees are identical if they are sums, products, powers, inversions, abs, log10 or
+// trigonometric operations of identical arguments in the same order. Fields are identical if
+// they are the same field with the same derivatives and components, parameters if they are
+// the same parameter entry and constants if they have the same value. Any other operation
+// is only identical to itself.
+
+
+#ifndef SUBEXPRESSIONS_H
+#define SUBEXPRESSIONS_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include <typeinfo>
+#include <cstdio>
+#include "operation.h"
+
+class operation;
+
+class subexpressions
+{
+
+    private:
+
+        // Structure id of every visited operation:
+        std::unordered_map<operation*, int> myids = {};
+        // Structure id of every structure key:
+        std::unordered_map<std::string, int> mykeyids = {};
+        // Representative operation and number of occurences of every structure id:
+        std::vector<std::shared_ptr<operation>> myrepresentatives = {};
+        std::vector<int> myoccurences = {};
+
+        int getid(std::shared_ptr<operation> op);
+        // Replace the arguments of 'op' by their representative:
+        void replace(std::shared_ptr<operation> op, std::vector<bool>& isreplaced);
+
+    public:
+
+        // True for the operations that are fully defined by the type and arguments:
+        static bool isstructural(std::shared_ptr<operation> op);
+
+        // Share the identical subtrees in place. The returned value is the number of operations that will be reused:
+        static int share(std::vector<std::shared_ptr<operation>>& ops);
+
+};
+
+#endif
@@ -0,0 +1,204 @@
+#include "symbolicderivative.h"
+
+
+bool symbolicderivative::isdependent(std::shared_ptr<operation> op)
+{
+    std::unordered_map<operation*, bool>::iterator it = mydependencies.find(op.get());
+    if (it != mydependencies.end())
+        return it->second;
+
+    bool output = false;
+    if (op->isfield())
+    {
+        std::shared_ptr<rawfield> rf = op->getfieldpointer();
+        for (int i = 0; i < myfields.size(); i++)
+            output = output || (rf == myfields[i]);
+    }
+    else if (op->isparameter())
+    {
+        std::vector<std::shared_ptr<operation>> paramops = op->getparameterpointer()->getoperations();
+        for (int i = 0; i < paramops.size(); i++)
+        {
+            if (isdependent(paramops[i]))
+            {
+                std::cout << "Error in 'symbolicderivative' object: cannot differentiate a parameter that depends on the fields (use its expression directly)" << std::endl;
+                abort();
+            }
+        }
+    }
+    else
+    {
+        std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+        for (int i = 0; i < arguments.size(); i++)
+            output = output || isdependent(arguments[i]);
+    }
+
+    mydependencies[op.get()] = output;
+
+    return output;
+}
+
+std::shared_ptr<operation> symbolicderivative::getderivative(std::shared_ptr<operation> op)
+{
+    std::unordered_map<operation*, std::shared_ptr<operation>>::iterator it = myderivatives.find(op.get());
+    if (it != myderivatives.end())
+        return it->second;
+
+    if (isdependent(op) == false)
+    {
+        myderivatives[op.get()] = NULL;
+        return NULL;
+    }
+
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+
+    // Derivative of the arguments:
+    std::vector<std::shared_ptr<operation>> argderivs(arguments.size());
+    for (int i = 0; i < arguments.size(); i++)
+        argderivs[i] = getderivative(arguments[i]);
+
+    expression output;
+
+    if (op->isfield())
+    {
+        if (isdofdirection)
+        {
+            std::shared_ptr<opdof> dofop(new opdof(op->getfieldpointer()));
+            dofop->selectformfunctioncomponent(op->getformfunctioncomponent());
+            dofop->setfieldcomponent(op->getfieldcomponent());
+            if (op->getspacederivative() != 0)
+                dofop->setspacederivative(op->getspacederivative());
+            if (op->getkietaphiderivative() != 0)
+                dofop->setkietaphiderivative(op->getkietaphiderivative());
+            if (op->gettimederivative() != 0)
+                dofop->increasetimederivativeorder(op->gettimederivative());
+            output = expression(dofop);
+        }
+        else
+            output = expression(op);
+    }
+    else if (op->issum())
+    {
+        output = 0;
+        for (int i = 0; i < arguments.size(); i++)
+        {
+            if (argderivs[i] != NULL)
+                output = output + expression(argderivs[i]);
+        }
+    }
+    else if (op->isproduct())
+    {
+        output = 0;
+        for (int i = 0; i < arguments.size(); i++)
+        {
+            if (argderivs[i] == NULL)
+                continue;
+            expression term = expression(argderivs[i]);
+            for (int j = 0; j < arguments.size(); j++)
+            {
+                if (j != i)
+                    term = term * expression(arguments[j]);
+            }
+            output = output + term;
+        }
+    }
+    else if (std::dynamic_pointer_cast<oppower>(op) != NULL)
+    {
+        expression base(arguments[0]), exponent(arguments[1]);
+
+        output = 0;
+        // d(b^e) = e*b^(e-1)*db + log(b)*b^e*de:
+        if (argderivs[0] != NULL)
+            output = output + exponent * base.pow(exponent-1) * expression(argderivs[0]);
+        if (argderivs[1] != NULL)
+            output = output + std::log(10.0) * base.log10() * expression(op) * expression(argderivs[1]);
+    }
+    else if (std::dynamic_pointer_cast<opinversion>(op) != NULL)
+        output = -1.0 * expression(op) * expression(op) * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opabs>(op) != NULL)
+        output = expression(expression(arguments[0]), 1, -1) * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<oplog10>(op) != NULL)
+        output = 1.0/std::log(10.0) / expression(arguments[0]) * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opmod>(op) != NULL)
+        output = expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opsin>(op) != NULL)
+        output = expression(arguments[0]).cos() * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opcos>(op) != NULL)
+        output = -1.0 * expression(arguments[0]).sin() * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<optan>(op) != NULL)
+        output = (1.0 + expression(op) * expression(op)) * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opasin>(op) != NULL)
+        output = (1.0 - expression(arguments[0]) * expression(arguments[0])).pow(-0.5) * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opacos>(op) != NULL)
+        output = -1.0 * (1.0 - expression(arguments[0]) * expression(arguments[0])).pow(-0.5) * expression(argderivs[0]);
+    else if (std::dynamic_pointer_cast<opatan>(op) != NULL)
+        output = expression(argderivs[0]) / (1.0 + expression(arguments[0]) * expression(arguments[0]));
+    else if (std::dynamic_pointer_cast<opcondition>(op) != NULL)
+    {
+        // The condition is piecewise constant:
+        expression dtrue = 0, dfalse = 0;
+        if (argderivs[1] != NULL)
+            dtrue = expression(argderivs[1]);
+        if (argderivs[2] != NULL)
+            dfalse = expression(argderivs[2]);
+        output = expression(expression(arguments[0]), dtrue, dfalse);
+    }
+    else if (std::dynamic_pointer_cast<opspline>(op) != NULL)
+        output = expression(std::dynamic_pointer_cast<opspline>(op)->getspline().getderivative(), expression(arguments[0])) * expression(argderivs[0]);
+    else
+    {
+        std::cout << "Error in 'symbolicderivative' object: cannot differentiate the following operation with respect to the fields:" << std::endl;
+        op->print();
+        std::cout << std::endl;
+        abort();
+    }
+
+    std::shared_ptr<operation> deriv = output.getoperationinarray(0,0);
+    if (deriv->iszero())
+        deriv = NULL;
+
+    myderivatives[op.get()] = deriv;
+
+    return deriv;
+}
+
+expression symbolicderivative::differentiate(expression input, std::vector<field> fields, bool isdofdirection)
+{
+    symbolicderivative sd;
+    sd.isdofdirection = isdofdirection;
+
+    for (int i = 0; i < fields.size(); i++)
+    {
+        sd.myfields.push_back(fields[i].getpointer());
+        if (fields[i].countcomponents() > 1)
+        {
+            for (int c = 0; c < fields[i].countcomponents(); c++)
+                sd.myfields.push_back(fields[i].comp(c).getpointer());
+        }
+    }
+
+    int m = input.countrows();
+    int n = input.countcolumns();
+
+    std::vector<expression> derivs(m*n);
+    for (int i = 0; i < m; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            std::shared_ptr<operation> op = input.getoperationinarray(i,j);
+            if (op->isdofincluded())
+            {
+                std::cout << "Error in 'symbolicderivative' object: cannot differentiate an expression that includes a dof" << std::endl;
+                abort();
+            }
+
+            std::shared_ptr<operation> deriv = sd.getderivative(op);
+            if (deriv == NULL)
+                derivs[i*n+j] = 0;
+            else
+                derivs[i*n+j] = expression(deriv);
+        }
+    }
+
+    return expression(m, n, derivs);
+}
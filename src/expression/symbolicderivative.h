@@ -0,0 +1,61 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object computes the directional (Gateaux) derivative of an expression with respect to
+// a set of fields. Every occurence of a field (with its space and time derivatives) in the
+// differentiated operations is replaced by its dof, so that the output is linear in the dofs.
+// For a residual 'r(u, tf(u))' this gives the consistent tangent terms of the Newton method.
+//
+// Sums, products, powers, inversions, abs, log10, mod, trigonometric functions, conditional
+// expressions and splines are differentiated. Any other operation that depends on the fields
+// (custom functions, 'on', harmonic selections, ...) gives an error. Parameters can only be
+// used if they do not depend on the fields.
+
+
+#ifndef SYMBOLICDERIVATIVE_H
+#define SYMBOLICDERIVATIVE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <unordered_map>
+#include "operation.h"
+#include "expression.h"
+#include "field.h"
+#include "spline.h"
+
+class operation;
+class expression;
+class field;
+
+class symbolicderivative
+{
+
+    private:
+
+        // All fields and field components the derivative is taken with respect to:
+        std::vector<std::shared_ptr<rawfield>> myfields = {};
+        // The fields are replaced by their dof if true and kept as they are otherwise.
+        // The latter gives the tangent in the direction of the current field values.
+        bool isdofdirection = true;
+
+        // Derivative of every visited operation (NULL if zero):
+        std::unordered_map<operation*, std::shared_ptr<operation>> myderivatives = {};
+        // Know if a visited operation depends on the fields:
+        std::unordered_map<operation*, bool> mydependencies = {};
+
+        bool isdependent(std::shared_ptr<operation> op);
+        // Return NULL for a zero derivative:
+        std::shared_ptr<operation> getderivative(std::shared_ptr<operation> op);
+
+    public:
+
+        // Derivative of every entry of 'input' with respect to the fields in 'fields' (or any of their components):
+        static expression differentiate(expression input, std::vector<field> fields, bool isdofdirection = true);
+
+};
+
+#endif
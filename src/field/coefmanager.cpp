@@ -1,4 +1,8 @@
 #include "coefmanager.h"
+#include "memoryusage.h"
+#include "universe.h"
+#include "taskscheduler.h"
+#include "autotuning.h"
 
 coefmanager::coefmanager(std::string fieldtypename, disjointregions* drs)
 {
@@ -13,19 +17,57 @@ coefmanager::coefmanager(std::string fieldtypename, disjointregions* drs)
         
     // Preallocate 'coefs' for the number of disjoint regions:
     coefs.resize(mydisjointregions.count());
+    numformfunctions = std::vector<int>(coefs.size(), 0);
+    numelems = std::vector<int>(coefs.size());
+    for (int i = 0; i < coefs.size(); i++)
+        numelems[i] = mydisjointregions.countelements(i);
     // Resize coefs to accomodate an inital order 1 interpolated field:
     for (int i = 0; i < coefs.size(); i++)
         fitinterpolationorder(i, 1);
+        
+    mystate = universe::getnewstate();
+    mystructurestate = mystate;
+}
+
+void coefmanager::allocate(int disjreg, int formfunctionindex)
+{
+    // This is rarely called and can thus be slower:
+    long long int allocsize = (long long int)(formfunctionindex+1)*numelems[disjreg];
+    if (coefs[disjreg].size() >= allocsize)
+        return;
+        
+    int ne = numelems[disjreg];
+    long long int oldsize = coefs[disjreg].size();
+    std::vector<double, uninitializedallocator<double>> newcoefs(allocsize);
+    double* oldptr = coefs[disjreg].data();
+    double* newptr = newcoefs.data();
+    
+    // Every thread copies (or zeroes) the same element range in all form functions. The pages of
+    // an element range are thus placed on the numa node of the thread that interpolates it:
+    int numthreadstouse = autotuning::getnumthreadsforitems(ne); // require a min num elems per thread
+    taskscheduler::runperthread(numthreadstouse, [&](int t)
+    {
+        int elembegin = (long long int)t*ne/numthreadstouse;
+        int elemend = (long long int)(t+1)*ne/numthreadstouse;
+        for (int ff = 0; ff <= formfunctionindex; ff++)
+        {
+            long long int offset = (long long int)ff*ne;
+            for (int e = elembegin; e < elemend; e++)
+                newptr[offset+e] = (offset+e < oldsize) ? oldptr[offset+e] : 0.0; // Filled with zeros.
+        }
+    });
+    
+    coefs[disjreg] = std::move(newcoefs);
 }
 
 bool coefmanager::isdefined(int disjreg, int formfunctionindex)
 {
-    return (formfunctionindex < coefs[disjreg].size());
+    return (formfunctionindex < numformfunctions[disjreg]);
 }
 
 int coefmanager::countformfunctions(int disjreg)
 {
-    return coefs[disjreg].size();
+    return numformfunctions[disjreg];
 }
 
 void coefmanager::fitinterpolationorder(int disjreg, int interpolationorder)
@@ -38,30 +80,99 @@ void coefmanager::fitinterpolationorder(int disjreg, int interpolationorder)
     std::shared_ptr<hierarchicalformfunction> myformfunction = selector::select(elementtypenumber, myfieldtypename);
     int numberofformfunctions = myformfunction->count(interpolationorder, elementdimension, 0);
     
-    if (coefs[disjreg].size() != numberofformfunctions)
-        coefs[disjreg].resize(numberofformfunctions);
+    if (numformfunctions[disjreg] != numberofformfunctions)
+    {
+        numformfunctions[disjreg] = numberofformfunctions;
+        // Forget the coefficients of the removed form functions:
+        long long int maxsize = (long long int)numberofformfunctions*numelems[disjreg];
+        if (coefs[disjreg].size() > maxsize)
+        {
+            coefs[disjreg].resize(maxsize);
+            coefs[disjreg].shrink_to_fit();
+        }
+        
+        mystate = universe::getnewstate();
+        mystructurestate = mystate;
+    }
 }
 
 double coefmanager::getcoef(int disjreg, int formfunctionindex, int elementindexindisjointregion)
 {
-    if (formfunctionindex < coefs[disjreg].size() && coefs[disjreg][formfunctionindex].size() != 0)
-        return coefs[disjreg][formfunctionindex][elementindexindisjointregion];
+    long long int index = (long long int)formfunctionindex*numelems[disjreg] + elementindexindisjointregion;
+    if (index < coefs[disjreg].size())
+        return coefs[disjreg][index];
     else
         return 0;
 }
 
 void coefmanager::setcoef(int disjreg, int formfunctionindex, int elementindexindisjointregion, double val)
 {
-    if (coefs[disjreg][formfunctionindex].size() != 0)
-        coefs[disjreg][formfunctionindex][elementindexindisjointregion] = val;
+    mystate = universe::getnewstate();
+    
+    long long int index = (long long int)formfunctionindex*numelems[disjreg] + elementindexindisjointregion;
+    if (index >= coefs[disjreg].size())
+        allocate(disjreg, formfunctionindex);
+
+    coefs[disjreg][index] = val;
+}
+
+const double* coefmanager::readcoefs(int disjreg, int formfunctionindex)
+{
+    long long int index = (long long int)formfunctionindex*numelems[disjreg];
+    if (index < coefs[disjreg].size())
+        return coefs[disjreg].data() + index;
     else
-    {
-        // This is rarely called and can thus be slower:
-        int numberofelements = mydisjointregions.countelements(disjreg);
-        coefs[disjreg][formfunctionindex].resize(numberofelements); // Filled with zeros.
+        return NULL;
+}
 
-        coefs[disjreg][formfunctionindex][elementindexindisjointregion] = val;
+void coefmanager::getcoefs(int disjreg, int formfunctionindex, double* vals)
+{
+    const double* cur = readcoefs(disjreg, formfunctionindex);
+    int ne = numelems[disjreg];
+    
+    if (cur == NULL)
+    {
+        for (int e = 0; e < ne; e++)
+            vals[e] = 0;
     }
+    else
+    {
+        for (int e = 0; e < ne; e++)
+            vals[e] = cur[e];
+    }
+}
+
+void coefmanager::setcoefs(int disjreg, int formfunctionindex, double* vals)
+{
+    mystate = universe::getnewstate();
+    
+    allocate(disjreg, formfunctionindex);
+    
+    int ne = numelems[disjreg];
+    double* cur = coefs[disjreg].data() + (long long int)formfunctionindex*ne;
+    for (int e = 0; e < ne; e++)
+        cur[e] = vals[e];
+}
+
+void coefmanager::addcoefs(int disjreg, int formfunctionindex, double* vals)
+{
+    mystate = universe::getnewstate();
+    
+    allocate(disjreg, formfunctionindex);
+    
+    int ne = numelems[disjreg];
+    double* cur = coefs[disjreg].data() + (long long int)formfunctionindex*ne;
+    for (int e = 0; e < ne; e++)
+        cur[e] += vals[e];
+}
+
+double* coefmanager::getcoefsforwriting(int disjreg, int formfunctionindex)
+{
+    mystate = universe::getnewstate();
+    
+    allocate(disjreg, formfunctionindex);
+    
+    return coefs[disjreg].data() + (long long int)formfunctionindex*numelems[disjreg];
 }
 
 void coefmanager::print(bool databoundsonly)
@@ -70,19 +181,20 @@ void coefmanager::print(bool databoundsonly)
     
     for (int d = 0; d < coefs.size(); d++)
     {
-        for (int ff = 0; ff < coefs[d].size(); ff++)
+        for (int ff = 0; ff < numformfunctions[d]; ff++)
         {
-            if (coefs[d][ff].size() == 0)
+            const double* curcoefs = readcoefs(d, ff);
+            if (curcoefs == NULL || numelems[d] == 0)
                 continue;
                 
             std::cout << std::endl << "--> Disjoint region " << d << ", shape function " << ff << ":" << std::endl;
             
-            double datamin = coefs[d][ff][0];
-            double datamax = coefs[d][ff][0];
+            double datamin = curcoefs[0];
+            double datamax = curcoefs[0];
             
-            for (int e = 0; e < coefs[d][ff].size(); e++)
+            for (int e = 0; e < numelems[d]; e++)
             {
-                double val = coefs[d][ff][e];
+                double val = curcoefs[e];
                 
                 if (databoundsonly == false)
                     std::cout << val << " ";
@@ -99,3 +211,19 @@ void coefmanager::print(bool databoundsonly)
     }
     std::cout << std::endl;
 }
+
+long long int coefmanager::countbytes(void)
+{
+    return memoryusage::countbytes(coefs);
+}
+
+double coefmanager::getsquarednorm(void)
+{
+    double output = 0;
+    for (int d = 0; d < coefs.size(); d++)
+    {
+        for (long long int i = 0; i < coefs[d].size(); i++)
+            output += coefs[d][i]*coefs[d][i];
+    }
+    return output;
+}
@@ -18,6 +18,7 @@
 #include "hierarchicalformfunction.h"
 #include <memory>
 #include "selector.h"
+#include "memorypool.h"
 
 class coefmanager
 {
@@ -28,13 +29,25 @@ class coefmanager
 
         std::string myfieldtypename;
 
-        // 'coefs[disjreg][formfunc][elem]' gives the coefficient for  
+        // 'coefs[disjreg][formfunc*numelems[disjreg]+elem]' gives the coefficient for  
         //
         // - vertex, edge, face or volume type-disjoint region 'disjreg'
         // - the 'formfunc'th vertex, edge, face or volume form function
         // - element index 'elem' in the disjoint region
         //
-        std::vector<std::vector<std::vector<double>>> coefs;
+        // The coefficients of a disjoint region are contiguous. Only the form functions up to 
+        // the highest one that was set are allocated, the others are zero. The values are first written
+        // by the threads of the element ranges (first-touch) and not at the vector allocation.
+        std::vector<std::vector<double, uninitializedallocator<double>>> coefs;
+        // Number of form functions and of elements in every disjoint region:
+        std::vector<int> numformfunctions;
+        std::vector<int> numelems;
+        
+        // Allocate the coefficients up to form function 'formfunctionindex':
+        void allocate(int disjreg, int formfunctionindex);
+        
+        // State of the last modification of the values and of the number of form functions:
+        long long int mystate = 0, mystructurestate = 0;
 
     public:
 
@@ -51,8 +64,26 @@ class coefmanager
         double getcoef(int disjreg, int formfunctionindex, int elementindexindisjointregion);
         void setcoef(int disjreg, int formfunctionindex, int elementindexindisjointregion, double val);
         
+        // Bulk access to the coefficients of a form function for all elements in the disjoint region.
+        // 'readcoefs' returns NULL if all of them are zero.
+        const double* readcoefs(int disjreg, int formfunctionindex);
+        void getcoefs(int disjreg, int formfunctionindex, double* vals);
+        void setcoefs(int disjreg, int formfunctionindex, double* vals);
+        void addcoefs(int disjreg, int formfunctionindex, double* vals);
+        // Get the coefficients of a form function for all elements for writing (they are allocated if needed):
+        double* getcoefsforwriting(int disjreg, int formfunctionindex);
+        
+        long long int getstate(void) { return mystate; };
+        long long int getstructurestate(void) { return mystructurestate; };
+        
         void print(bool databoundsonly);
         
+        // Bytes used by the coefficients:
+        long long int countbytes(void);
+        
+        // Sum of the squared coefficients:
+        double getsquarednorm(void);
+        
 };
 
 #endif
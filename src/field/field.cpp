@@ -1,4 +1,11 @@
 #include "field.h"
+#include "element.h"
+#include "hierarchicalformfunctioniterator.h"
+#include "formfunctioncache.h"
+#include "evaluationcontext.h"
+#include "taskscheduler.h"
+#include "gentools.h"
+#include <limits>
 
 
 void field::errorifpointerisnull(void)
@@ -62,9 +69,17 @@ int field::countcomponents(void) { errorifpointerisnull(); return rawfieldptr->c
 std::vector<int> field::getharmonics(void) { errorifpointerisnull(); return rawfieldptr->getharmonics(); }
 void field::printharmonics(void) { errorifpointerisnull(); rawfieldptr->printharmonics(); }
 
+void field::activateharmonics(std::vector<int> harmonicnumbers) { errorifpointerisnull(); rawfieldptr->activateharmonics(harmonicnumbers); }
+std::vector<int> field::getactiveharmonics(void) { errorifpointerisnull(); return rawfieldptr->getactiveharmonics(); }
+std::vector<double> field::getharmonicenergies(void) { errorifpointerisnull(); return rawfieldptr->getharmonicenergies(); }
+std::vector<int> field::adaptharmonics(double shrinktol, double growtol, int verbosity) { errorifpointerisnull(); return rawfieldptr->adaptharmonics(shrinktol, growtol, verbosity); }
+
 void field::setname(std::string name) { errorifpointerisnull(); rawfieldptr->setname(name); }
 void field::print(void) { errorifpointerisnull(); rawfieldptr->print(); }
 
+memoryusage field::getmemoryusage(void) { errorifpointerisnull(); return rawfieldptr->getmemoryusage(); }
+void field::printmemory(void) { errorifpointerisnull(); rawfieldptr->getmemoryusage().print("Field memory"); }
+
 void field::setorder(int physreg, int interpolorder) 
 { 
     errorifpointerisnull();
@@ -425,6 +440,186 @@ std::vector<double> field::min(int physreg, int refinement, std::vector<double>
 std::vector<double> field::min(int physreg, expression meshdeform, int refinement, std::vector<double> xyzrange)
 { return ((expression)*this).min(physreg, meshdeform, refinement, xyzrange); }
 
+// Number of elements sampled in a task of the bounded max/min search:
+static const int numelemsperboundedtask = 256;
+
+// Branch-and-bound max of 'sign' times the field (the sign is removed from the output value):
+static std::vector<double> boundedextremum(field f, int physreg, int refinement, double sign)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    if (refinement < 1)
+        refinement = 1;
+        
+    std::shared_ptr<rawfield> rf = f.getpointer();
+    std::vector<int> selecteddisjregs = ((universe::getrawmesh()->getphysicalregions())->get(physreg))->getdisjointregions();
+    
+    std::vector<int> interpolorders(selecteddisjregs.size());
+    bool isbounded = (rf->gettypename() == "h1" && rf->countcomponents() == 1 && rf->ismultiharmonic() == false);
+    for (int i = 0; i < selecteddisjregs.size() && isbounded; i++)
+    {
+        interpolorders[i] = rf->getinterpolationorder(selecteddisjregs[i]);
+        // The vertex form functions of pyramids are not multilinear:
+        isbounded = ((universe::getrawmesh()->getdisjointregions())->getelementtypenumber(selecteddisjregs[i]) != 7);
+    }
+    if (not(isbounded))
+        return (sign > 0 ? f.max(physreg, refinement) : f.min(physreg, refinement));
+    
+    // Group disj. regs. with same element types and same interpolation order:
+    disjointregionselector mydisjregselector(selecteddisjregs, {interpolorders});
+    int numgroups = mydisjregselector.countgroups();
+    std::vector<std::vector<int>> groupdisjregs(numgroups);
+    std::vector<std::vector<double>> groupevaluationpoints(numgroups);
+    
+    // Bound, group and element number of every element:
+    std::vector<double> bounds = {};
+    std::vector<int> elemgroups = {}, elemnumbers = {};
+    for (int g = 0; g < numgroups; g++)
+    {
+        groupdisjregs[g] = mydisjregselector.getgroup(g);
+        
+        int elementtypenumber = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(groupdisjregs[g][0]);
+        int interpolorder = rf->getinterpolationorder(groupdisjregs[g][0]);
+        
+        groupevaluationpoints[g] = element(elementtypenumber, refinement).listnodecoordinates();
+        
+        hierarchicalformfunctioniterator myiterator("h1", elementtypenumber, interpolorder);
+        std::vector<bool> isvertexff(myiterator.count());
+        for (int ff = 0; ff < myiterator.count(); ff++)
+        {
+            isvertexff[ff] = (myiterator.getdimension() == 0);
+            myiterator.next();
+        }
+        
+        // The form function values depend on the orientation:
+        elementselector myselector(groupdisjregs[g], true);
+        do
+        {
+            std::vector<int> elementnumbers = myselector.getelementnumbers();
+            int numelems = elementnumbers.size();
+            
+            // Largest magnitude of every form function at the sampling points:
+            densemat ffvals = formfunctioncache::get("h1", elementtypenumber, interpolorder, groupevaluationpoints[g], myselector.gettotalorientation(), 0, 0);
+            ffvals.abs();
+            int numff = ffvals.countrows(), numpts = ffvals.countcolumns();
+            double* ffptr = ffvals.getvalues();
+            std::vector<double> ffmax(numff, 0.0);
+            for (int ff = 0; ff < numff; ff++)
+            {
+                for (int p = 0; p < numpts; p++)
+                    ffmax[ff] = std::max(ffmax[ff], ffptr[ff*numpts+p]);
+            }
+            
+            densemat coefs = rf->getcoefficients(elementtypenumber, interpolorder, elementnumbers);
+            double* coefptr = coefs.getvalues();
+            
+            for (int e = 0; e < numelems; e++)
+            {
+                // The vertex part is multilinear and reaches its max at a vertex:
+                double vertexmax = -std::numeric_limits<double>::max();
+                double highorderbound = 0.0;
+                for (int ff = 0; ff < numff; ff++)
+                {
+                    double c = coefptr[ff*numelems+e];
+                    if (isvertexff[ff])
+                        vertexmax = std::max(vertexmax, sign*c);
+                    else
+                        highorderbound += std::abs(c)*ffmax[ff];
+                }
+                bounds.push_back(vertexmax+highorderbound);
+                elemgroups.push_back(g);
+                elemnumbers.push_back(elementnumbers[e]);
+            }
+        }
+        while (myselector.next());
+    }
+    
+    // Sample the elements by decreasing bound:
+    std::vector<int> ordering;
+    std::vector<double> negbounds(bounds.size());
+    for (int i = 0; i < bounds.size(); i++)
+        negbounds[i] = -bounds[i];
+    gentools::stablesort(0, negbounds, ordering);
+    
+    universe::allowestimatorupdate(true);
+    
+    field x("x"), y("y"), z("z");
+    std::vector<std::shared_ptr<operation>> ops = {((expression)f).getoperationinarray(0,0), expression(x).getoperationinarray(0,0), expression(y).getoperationinarray(0,0), expression(z).getoperationinarray(0,0)};
+    
+    int numcandidates = ordering.size();
+    int numtasks = (numcandidates+numelemsperboundedtask-1)/numelemsperboundedtask;
+    int wavesize = universe::getmaxnumthreads();
+    
+    // Best {value, x, y, z} found by every task:
+    std::vector<std::vector<double>> taskbest(numtasks);
+    
+    auto sampletask = [&](int t)
+    {
+        int taskbegin = t*numelemsperboundedtask;
+        int taskend = std::min(taskbegin+numelemsperboundedtask, numcandidates);
+        
+        evaluationcontext mycontext;
+        evaluationcontext* previouscontext = universe::setcontext(&mycontext);
+        
+        for (int g = 0; g < numgroups; g++)
+        {
+            std::vector<int> elems = {};
+            for (int i = taskbegin; i < taskend; i++)
+            {
+                if (elemgroups[ordering[i]] == g)
+                    elems.push_back(elemnumbers[ordering[i]]);
+            }
+            if (elems.size() == 0)
+                continue;
+                
+            elementselector myselector(groupdisjregs[g], elems, true);
+            do
+            {
+                universe::allowreuse();
+                std::vector<densemat> vals(4);
+                for (int j = 0; j < 4; j++)
+                    vals[j] = ops[j]->interpolate(myselector, groupevaluationpoints[g], NULL)[1][0];
+                universe::forbidreuse();
+                
+                double* valptr = vals[0].getvalues();
+                for (int d = 0; d < vals[0].count(); d++)
+                {
+                    if (taskbest[t].size() == 0 || sign*valptr[d] > sign*taskbest[t][0])
+                        taskbest[t] = {valptr[d], vals[1].getvalues()[d], vals[2].getvalues()[d], vals[3].getvalues()[d]};
+                }
+            }
+            while (myselector.next());
+        }
+        
+        universe::setcontext(previouscontext);
+    };
+    
+    std::vector<double> output = {};
+    for (int wavebegin = 0; wavebegin < numtasks; wavebegin += wavesize)
+    {
+        // No remaining element can beat the best value:
+        if (output.size() > 0 && bounds[ordering[wavebegin*numelemsperboundedtask]] <= sign*output[0])
+            break;
+        
+        int waveend = std::min(wavebegin+wavesize, numtasks);
+        taskscheduler::run(waveend-wavebegin, [&](int i){ sampletask(wavebegin+i); }, wavebegin == 0);
+        
+        // Merge in the task order for a result independent of the thread scheduling:
+        for (int t = wavebegin; t < waveend; t++)
+        {
+            if (taskbest[t].size() > 0 && (output.size() == 0 || sign*taskbest[t][0] > sign*output[0]))
+                output = taskbest[t];
+        }
+    }
+    
+    universe::allowestimatorupdate(false);
+    
+    return output;
+}
+
+std::vector<double> field::boundedmax(int physreg, int refinement) { return boundedextremum(*this, physreg, refinement, 1.0); }
+std::vector<double> field::boundedmin(int physreg, int refinement) { return boundedextremum(*this, physreg, refinement, -1.0); }
+
 void field::interpolate(int physreg, std::vector<double>& xyzcoord, std::vector<double>& interpolated, std::vector<bool>& isfound)
 { ((expression)*this).interpolate(physreg, xyzcoord, interpolated, isfound); }
 void field::interpolate(int physreg, expression meshdeform, std::vector<double>& xyzcoord, std::vector<double>& interpolated, std::vector<bool>& isfound)
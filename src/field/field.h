@@ -26,6 +26,7 @@
 #include "vectorfieldselect.h"
 #include "spanningtree.h"
 #include "port.h"
+#include "memoryusage.h"
 
 class spanningtree;
 class vectorfieldselect;
@@ -63,11 +64,27 @@ class field
         std::vector<int> getharmonics(void);
         // Print a string showing the harmonics in the field.
         void printharmonics(void);
+        
+        // Only keep the listed harmonics active in a multiharmonic field. The other harmonics are set and held at zero
+        // and their dofs are eliminated from the systems assembled afterwards (like constrained dofs):
+        void activateharmonics(std::vector<int> harmonicnumbers);
+        std::vector<int> getactiveharmonics(void);
+        // Sum of the squared dof values of every harmonic (indexed by the harmonic number):
+        std::vector<double> getharmonicenergies(void);
+        // Adaptive harmonic truncation, to call after each nonlinear iteration (on all ranks for DDM). Among the harmonics the field
+        // was created with, an active harmonic holding less than 'shrinktol' times the total energy is deactivated while the harmonics
+        // of frequency f are activated when an active harmonic of frequency f-1 holds more than 'growtol' times the total energy.
+        // The most energetic harmonic always stays active. The active harmonics are returned.
+        std::vector<int> adaptharmonics(double shrinktol = 1e-8, double growtol = 1e-4, int verbosity = 0);
 
         // Set the field name.
         void setname(std::string name);
         // Print the field name.
         void print(void);
+        
+        // Get/print the number of bytes used by the field coefficients:
+        memoryusage getmemoryusage(void);
+        void printmemory(void);
 
         // Set the interpolation order on a physical region.
         void setorder(int physreg, int interpolorder);
@@ -83,7 +100,7 @@ class field
         void setvalue(int physreg, expression input, int extraintegrationdegree = 0);
         // The 'input' expression is evaluated on the mesh deformed by 'meshdeform':
         void setvalue(int physreg, expression meshdeform, expression input, int extraintegrationdegree = 0);
-        // An FFT is used to project the 'input' expression:
+        // An FFT is used to project the 'input' expression ('numfftharms' 0 for automatic):
         void setvalue(int physreg, int numfftharms, expression input, int extraintegrationdegree = 0);
         void setvalue(int physreg, int numfftharms, expression meshdeform, expression input, int extraintegrationdegree = 0);
         // Set a zero value:
@@ -99,7 +116,7 @@ class field
         void setconstraint(int physreg, expression input, int extraintegrationdegree = 0);
         // The 'input' expression is evaluated on the mesh deformed by 'meshdeform':
         void setconstraint(int physreg, expression meshdeform, expression input, int extraintegrationdegree = 0);
-        // An FFT is used to project the 'input' expression:
+        // An FFT is used to project the 'input' expression ('numfftharms' 0 for automatic):
         void setconstraint(int physreg, int numfftharms, expression input, int extraintegrationdegree = 0);
         void setconstraint(int physreg, int numfftharms, expression meshdeform, expression input, int extraintegrationdegree = 0);
         // Set an homogeneous Dirichlet constraint.
@@ -156,6 +173,12 @@ class field
         std::vector<double> max(int physreg, expression meshdeform, int refinement, std::vector<double> xyzrange = {});
         std::vector<double> min(int physreg, int refinement, std::vector<double> xyzrange = {});
         std::vector<double> min(int physreg, expression meshdeform, int refinement, std::vector<double> xyzrange = {});
+        // Same as 'max' and 'min' for a scalar 'h1' field but with a branch-and-bound search. The bound of each element is
+        // its best vertex coefficient plus the magnitude of its higher order coefficients times the largest form function
+        // values. The elements are sampled by decreasing bound (on multiple threads) until no remaining element can beat the
+        // best value found. The output is the same as for 'max' and 'min'. Other fields use the uniform sampling.
+        std::vector<double> boundedmax(int physreg, int refinement);
+        std::vector<double> boundedmin(int physreg, int refinement);
         
         void interpolate(int physreg, std::vector<double>& xyzcoord, std::vector<double>& interpolated, std::vector<bool>& isfound);
         void interpolate(int physreg, expression meshdeform, std::vector<double>& xyzcoord, std::vector<double>& interpolated, std::vector<bool>& isfound);
@@ -172,7 +195,8 @@ class field
         void write(int physreg, std::string filename, int lagrangeorder, int numtimesteps = -1);
         void write(int physreg, expression meshdeform, std::string filename, int lagrangeorder, int numtimesteps = -1);
         
-        // Write/load the raw field data to/from compact sparselizard format:
+        // Write/load the raw field data to/from compact sparselizard format.
+        // Binary .slz files are memory mapped when loading and read directly to the field coefficients:
         void writeraw(int physreg, std::string filename, bool isbinary = false, std::vector<double> extradata = {});
         std::vector<double> loadraw(std::string filename, bool isbinary = false);
         
@@ -3,6 +3,14 @@
 
 jacobian::jacobian(elementselector& elemselect, std::vector<double> evaluationcoordinates, expression* meshdeform)
 {
+    int elementtypenumber = elemselect.getelementtypenumber();
+    numgausspoints = evaluationcoordinates.size()/3;
+
+    // The Jacobian of straight lines, triangles and tetrahedra is constant over the element:
+    isaffine = (numgausspoints > 1 && meshdeform == NULL && universe::getsession()->isaxisymmetric == false && (elementtypenumber == 1 || elementtypenumber == 2 || elementtypenumber == 4) && universe::getrawmesh()->getelements()->getcurvatureorder() == 1);
+    if (isaffine)
+        evaluationcoordinates = {evaluationcoordinates[0], evaluationcoordinates[1], evaluationcoordinates[2]};
+
     rawfield rf;
     std::vector<densemat> calced = rf.getjacterms(elemselect, evaluationcoordinates);
     
@@ -348,7 +356,7 @@ jacobian::jacobian(elementselector& elemselect, std::vector<double> evaluationco
             
     }
 
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
     {
         xcoord = (x.getpointer()->interpolate(0, 0, elemselect, evaluationcoordinates))[1][0];
         if (meshdeform != NULL)
@@ -361,6 +369,9 @@ jacobian jacobian::extractsubset(std::vector<int>& selectedelementindexes)
 {
     jacobian subjac;
 
+    subjac.isaffine = isaffine;
+    subjac.numgausspoints = numgausspoints;
+
     subjac.detjac = detjac.extractrows(selectedelementindexes);
     if (xcoord.isdefined())
         subjac.xcoord = xcoord.extractrows(selectedelementindexes);
@@ -381,17 +392,28 @@ jacobian jacobian::extractsubset(std::vector<int>& selectedelementindexes)
     return subjac;
 }
 
+densemat jacobian::broadcast(densemat term)
+{
+    if (isaffine == false || term.isdefined() == false)
+        return term;
+
+    return term.duplicatehorizontally(numgausspoints);
+}
+
 densemat jacobian::getdetjac(void)
 { 
+    if (isaffine)
+        return broadcast(detjac);
+
     densemat detj = detjac.copy();
 
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
         detj.multiplyelementwise(xcoord);
 
     return detj;
 }    
 
-densemat jacobian::getjac(int row, int column) { return jac[3*row+column]; }
+densemat jacobian::getjac(int row, int column) { return broadcast(jac[3*row+column]); }
 
 densemat jacobian::getinvjac(int row, int column)
 {
@@ -493,12 +515,12 @@ densemat jacobian::getinvjac(int row, int column)
                 break;
         }
         
-        if (universe::isaxisymmetric)
+        if (universe::getsession()->isaxisymmetric)
         {
             invjac[3*2+2] = jac[3*2+2].copy();
             invjac[3*2+2].invert();
         }
     }
 
-    return invjac[3*row+column];
+    return broadcast(invjac[3*row+column]);
 }
@@ -22,6 +22,10 @@
 //           dki/dy   deta/dy  dphi/dy
 //           dki/dz   deta/dz  dphi/dz
 //
+// On straight simplices (curvature order 1, no mesh deformation, not axisymmetric)
+// the Jacobian is constant over each element. It is then computed at a single point
+// and only broadcast to all Gauss points when a term is requested.
+//
 
 #ifndef JACOBIAN_H
 #define JACOBIAN_H
@@ -51,6 +55,13 @@ class jacobian
         std::vector<densemat> jac = std::vector<densemat>(3*3);
         std::vector<densemat> invjac = {};
 
+        // True if the terms above have a single column valid at all 'numgausspoints':
+        bool isaffine = false;
+        int numgausspoints = 0;
+
+        // Give the values at all Gauss points for a term with a single column per element:
+        densemat broadcast(densemat term);
+
     public:
         
         jacobian(void) {};
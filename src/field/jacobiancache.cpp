@@ -0,0 +1,143 @@
+#include "jacobiancache.h"
+#include "elements.h"
+
+
+bool jacobiancache::isitenabled = false;
+std::mutex jacobiancache::mymutex;
+long long int jacobiancache::numhits = 0;
+long long int jacobiancache::nummisses = 0;
+int jacobiancache::maxnumentries = 32;
+
+// A cached Jacobian and the conditions under which it was computed:
+class jacobiancacheentry
+{
+    public:
+        
+        int meshnumber = -1;
+        long long int meshstate = -1;
+        bool isaxisymmetric = false;
+        int elementtypenumber = -1;
+        std::vector<int> elementnumbers = {};
+        std::vector<double> evaluationcoordinates = {};
+        // Mesh deformation operations (empty if none) and the state when the Jacobian was computed:
+        std::vector<std::shared_ptr<operation>> deformationops = {};
+        long long int state = -1;
+        
+        std::shared_ptr<jacobian> jac = NULL;
+};
+
+std::vector<jacobiancacheentry> jacobiancacheentries = {};
+
+void jacobiancache::enable(bool isenabled)
+{
+    isitenabled = isenabled;
+    if (isenabled == false)
+        clear();
+}
+
+void jacobiancache::clear(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    jacobiancacheentries = {};
+}
+
+void jacobiancache::keepunmoved(int meshnumber, long long int oldmeshstate, long long int newmeshstate, elements* els, std::vector<bool>& ismovednode)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    for (int i = jacobiancacheentries.size()-1; i >= 0; i--)
+    {
+        jacobiancacheentry& cur = jacobiancacheentries[i];
+        
+        if (cur.meshnumber != meshnumber || cur.meshstate != oldmeshstate)
+            continue;
+        
+        element myelement(cur.elementtypenumber, els->getcurvatureorder());
+        int ncn = myelement.countcurvednodes();
+        
+        bool ismoved = false;
+        for (int e = 0; e < cur.elementnumbers.size() && not(ismoved); e++)
+        {
+            for (int n = 0; n < ncn; n++)
+            {
+                if (ismovednode[els->getsubelement(0, cur.elementtypenumber, cur.elementnumbers[e], n)])
+                {
+                    ismoved = true;
+                    break;
+                }
+            }
+        }
+        
+        if (ismoved)
+            jacobiancacheentries.erase(jacobiancacheentries.begin()+i);
+        else
+            cur.meshstate = newmeshstate;
+    }
+}
+
+std::shared_ptr<jacobian> jacobiancache::get(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform)
+{
+    if (isitenabled == false)
+        return std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
+        
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+
+    jacobiancacheentry key;
+    key.meshnumber = rm->getmeshnumber();
+    key.meshstate = rm->getstate();
+    key.isaxisymmetric = universe::getsession()->isaxisymmetric;
+    key.elementtypenumber = elemselect.getelementtypenumber();
+    key.elementnumbers = elemselect.getelementnumbers();
+    key.evaluationcoordinates = evaluationcoordinates;
+    
+    long long int deformationstate = 0;
+    if (meshdeform != NULL)
+    {
+        for (int i = 0; i < meshdeform->countrows(); i++)
+        {
+            key.deformationops.push_back(meshdeform->getoperationinarray(i, 0));
+            deformationstate = std::max(deformationstate, key.deformationops[i]->getstate());
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mymutex);
+        
+        for (int i = 0; i < jacobiancacheentries.size(); i++)
+        {
+            jacobiancacheentry& cur = jacobiancacheentries[i];
+            
+            if (cur.meshnumber == key.meshnumber && cur.meshstate == key.meshstate && cur.isaxisymmetric == key.isaxisymmetric && cur.elementtypenumber == key.elementtypenumber && cur.deformationops == key.deformationops && deformationstate <= cur.state && cur.evaluationcoordinates == key.evaluationcoordinates && cur.elementnumbers == key.elementnumbers)
+            {
+                numhits++;
+                // The copy shares the (never modified) values:
+                return std::shared_ptr<jacobian>(new jacobian(*(cur.jac)));
+            }
+        }
+    }
+    
+    // Computed outside of the lock:
+    key.jac = std::shared_ptr<jacobian>(new jacobian(elemselect, evaluationcoordinates, meshdeform));
+    // The inverse is computed now since the cached object is shared by multiple threads:
+    key.jac->getinvjac(0,0);
+    key.state = universe::laststate;
+    
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    nummisses++;
+    
+    // Remove the entries from other mesh states:
+    for (int i = jacobiancacheentries.size()-1; i >= 0; i--)
+    {
+        if (jacobiancacheentries[i].meshnumber != key.meshnumber || jacobiancacheentries[i].meshstate != key.meshstate)
+            jacobiancacheentries.erase(jacobiancacheentries.begin()+i);
+    }
+    if (jacobiancacheentries.size() >= maxnumentries && jacobiancacheentries.size() > 0)
+        jacobiancacheentries.erase(jacobiancacheentries.begin());
+    
+    if (maxnumentries > 0)
+        jacobiancacheentries.push_back(key);
+    
+    return std::shared_ptr<jacobian>(new jacobian(*(key.jac)));
+}
@@ -0,0 +1,64 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object keeps the Jacobians computed during the matrix generation so
+// that contributions integrated on the same elements with the same Gauss points
+// reuse them instead of computing identical geometry again. A cached Jacobian is
+// only reused on the same mesh state (no hp-adaptivity or mesh move in between)
+// and if the mesh deformation expression (if any) is unchanged.
+
+#ifndef JACOBIANCACHE_H
+#define JACOBIANCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include "jacobian.h"
+#include "elementselector.h"
+#include "expression.h"
+
+class jacobian;
+class elementselector;
+class expression;
+class elements;
+
+class jacobiancache
+{
+    private:
+        
+        static bool isitenabled;
+        
+        static std::mutex mymutex;
+        
+        static long long int numhits;
+        static long long int nummisses;
+        
+    public:
+        
+        // Maximum number of Jacobians kept (the oldest ones are removed first):
+        static int maxnumentries;
+        
+        // The cache is disabled by default. Disabling it also clears it:
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+        
+        static void clear(void);
+        
+        // After the nodes flagged in 'ismovednode' were moved (which brought the mesh from state 'oldmeshstate'
+        // to 'newmeshstate') keep the Jacobians of the elements that have no moved node and remove the others:
+        static void keepunmoved(int meshnumber, long long int oldmeshstate, long long int newmeshstate, elements* els, std::vector<bool>& ismovednode);
+        
+        // Get the Jacobian from the cache or compute it (and store it if enabled).
+        // This can be called by multiple threads at the same time.
+        static std::shared_ptr<jacobian> get(elementselector& elemselect, std::vector<double>& evaluationcoordinates, expression* meshdeform);
+        
+        static long long int counthits(void) { return numhits; };
+        static long long int countmisses(void) { return nummisses; };
+        
+};
+
+#endif
@@ -0,0 +1,86 @@
+#include "jacobiankernels.h"
+
+
+// Number of nodes 'NN', element dimension 'ED' and problem dimension 'PD' are known at compile time:
+template <int NN, int ED, int PD>
+static void jactermskernel(int numelems, int numevalpoints, const double* nodecoords, const double* const* dffvals, double* const* output)
+{
+    for (int e = 0; e < numelems; e++)
+    {
+        double coords[NN*PD];
+        for (int n = 0; n < NN; n++)
+        {
+            for (int d = 0; d < PD; d++)
+                coords[n*PD+d] = nodecoords[3*(e*NN+n)+d];
+        }
+
+        for (int ed = 0; ed < ED; ed++)
+        {
+            const double* dff = dffvals[ed];
+            for (int d = 0; d < PD; d++)
+            {
+                double* out = output[ed*PD+d] + (long long int)e*numevalpoints;
+
+                #pragma omp simd
+                for (int g = 0; g < numevalpoints; g++)
+                {
+                    double val = 0;
+                    for (int n = 0; n < NN; n++)
+                        val += coords[n*PD+d] * dff[n*numevalpoints+g];
+                    out[g] = val;
+                }
+            }
+        }
+    }
+}
+
+#define JACTERMSKERNELS(NN, ED) {&jactermskernel<NN,ED,1>, &jactermskernel<NN,ED,2>, &jactermskernel<NN,ED,3>}
+
+jacobiankernels::kernel jacobiankernels::kerneltable[8][2][3] =
+{
+    // Point:
+    {{NULL, NULL, NULL}, {NULL, NULL, NULL}},
+    // Line:
+    {JACTERMSKERNELS(2, 1), JACTERMSKERNELS(3, 1)},
+    // Triangle:
+    {JACTERMSKERNELS(3, 2), JACTERMSKERNELS(6, 2)},
+    // Quadrangle:
+    {JACTERMSKERNELS(4, 2), JACTERMSKERNELS(9, 2)},
+    // Tetrahedron:
+    {JACTERMSKERNELS(4, 3), JACTERMSKERNELS(10, 3)},
+    // Hexahedron:
+    {JACTERMSKERNELS(8, 3), JACTERMSKERNELS(27, 3)},
+    // Prism:
+    {JACTERMSKERNELS(6, 3), JACTERMSKERNELS(18, 3)},
+    // Pyramid:
+    {JACTERMSKERNELS(5, 3), JACTERMSKERNELS(14, 3)}
+};
+
+#undef JACTERMSKERNELS
+
+bool jacobiankernels::compute(int elementtypenumber, int curvatureorder, int problemdimension, int numelems, int numevalpoints, std::vector<double>& nodecoords, std::vector<densemat>& dffvals, std::vector<densemat>& output)
+{
+    if (elementtypenumber < 0 || elementtypenumber > 7 || curvatureorder < 1 || curvatureorder > 2 || problemdimension < 1 || problemdimension > 3)
+        return false;
+
+    kernel k = kerneltable[elementtypenumber][curvatureorder-1][problemdimension-1];
+    int elementdimension = dffvals.size();
+    if (k == NULL || problemdimension < elementdimension || numelems == 0)
+        return false;
+
+    std::vector<const double*> dffptrs(elementdimension);
+    for (int ed = 0; ed < elementdimension; ed++)
+        dffptrs[ed] = dffvals[ed].getvalues();
+
+    output = std::vector<densemat>(elementdimension*problemdimension);
+    std::vector<double*> outptrs(output.size());
+    for (int i = 0; i < output.size(); i++)
+    {
+        output[i] = densemat(numelems, numevalpoints);
+        outptrs[i] = output[i].getvalues();
+    }
+
+    k(numelems, numevalpoints, nodecoords.data(), dffptrs.data(), outptrs.data());
+
+    return true;
+}
@@ -0,0 +1,39 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object holds the Jacobian term kernels specialized at compile time for every element type
+// and curvature order 1 and 2. With the number of nodes, the element dimension and the problem
+// dimension known to the compiler, the contraction of the node coordinates with the Lagrange
+// shape function derivatives is fully unrolled and vectorized over the evaluation points.
+// The kernels are picked at runtime in a dispatch table.
+
+
+#ifndef JACOBIANKERNELS_H
+#define JACOBIANKERNELS_H
+
+#include <iostream>
+#include <vector>
+#include "densemat.h"
+
+class jacobiankernels
+{
+    private:
+
+        // Kernel taking the node coordinates (element x node x xyz), the shape function derivatives
+        // (one node x evaluation point array per element dimension) and the output term arrays:
+        typedef void (*kernel)(int numelems, int numevalpoints, const double* nodecoords, const double* const* dffvals, double* const* output);
+
+        // Indexed by element type number, curvature order - 1 and problem dimension - 1:
+        static kernel kerneltable[8][2][3];
+
+    public:
+
+        // Compute the terms dx/dki, dy/dki, ... as in 'rawfield::getjacterms'. False is returned
+        // (and nothing is computed) if there is no specialized kernel for the case.
+        static bool compute(int elementtypenumber, int curvatureorder, int problemdimension, int numelems, int numevalpoints, std::vector<double>& nodecoords, std::vector<densemat>& dffvals, std::vector<densemat>& output);
+
+};
+
+#endif
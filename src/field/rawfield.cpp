@@ -1,4 +1,6 @@
 #include "rawfield.h"
+#include "taskscheduler.h"
+#include "autotuning.h"
 
 
 void rawfield::synchronize(std::vector<int> physregsfororder, std::vector<int> disjregsfororder)
@@ -257,8 +259,9 @@ void rawfield::updateothershapefunctions(std::shared_ptr<rawfield> originalthis,
         
         // Permute A:
         Mat permutedmat;
+        petscindexes permutinds(renumtodiagblocks.getvalues(), renumtodiagblocks.count());
         IS permutis;
-        ISCreateGeneral(PETSC_COMM_SELF, renumtodiagblocks.count(), renumtodiagblocks.getvalues(), PETSC_USE_POINTER, &permutis);
+        ISCreateGeneral(PETSC_COMM_SELF, renumtodiagblocks.count(), permutinds.getvalues(), PETSC_USE_POINTER, &permutis);
         ISSetPermutation(permutis);
         MatPermute(A.getapetsc(), permutis, permutis, &permutedmat);
         
@@ -339,7 +342,7 @@ rawfield::rawfield(std::string fieldtypename, const std::vector<int> harmonicnum
     }
 
     // Make sure the mesh has been loaded before defining non-coordinate fields:
-    if (universe::myrawmesh == NULL)
+    if (universe::getsession()->myrawmesh == NULL)
     {
         std::cout << "Error in 'rawfield' object: first load mesh before defining a field that is not the x, y or z coordinate" << std::endl;
         abort();
@@ -441,7 +444,7 @@ rawfield::rawfield(dofmanager* dm, std::shared_ptr<rawmesh> rm, std::shared_ptr<
 
 rawfield::~rawfield(void)
 {
-    if (universe::myrawmesh != NULL && mysubfields.size() == 0 && myharmonics.size() == 0)
+    if (universe::getsession()->myrawmesh != NULL && mysubfields.size() == 0 && myharmonics.size() == 0)
         universe::getrawmesh()->remove(this);
 }
 
@@ -578,16 +581,60 @@ void rawfield::setcoefmanager(std::shared_ptr<coefmanager> cm)
     synchronize();
     
     mycoefmanager = cm;
+    mystate = universe::getnewstate();
 }
 
-void rawfield::print(void)
+long long int rawfield::getstate(bool structureonly)
+{
+    long long int output = mystate;
+    
+    if (mycoefmanager != NULL)
+    {
+        if (structureonly)
+            output = std::max(output, mycoefmanager->getstructurestate());
+        else
+            output = std::max(output, mycoefmanager->getstate());
+    }
+    
+    for (int i = 0; i < mysubfields.size(); i++)
+        output = std::max(output, mysubfields[i][0]->getstate(structureonly));
+    for (int h = 0; h < myharmonics.size(); h++)
+    {
+        if (myharmonics[h].size() > 0)
+            output = std::max(output, myharmonics[h][0]->getstate(structureonly));
+    }
+    
+    return output;
+}
+
+void rawfield::print(std::ostream& out)
 {
     // Do not sync this.
     
     if (myname.size() == 0)
-        std::cout << "field";
+        out << "field";
     else
-        std::cout << myname;
+        out << myname;
+}
+
+memoryusage rawfield::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    if (mycoefmanager != NULL)
+        output.add("coefficients", mycoefmanager->countbytes());
+    for (int i = 0; i < mysubfields.size(); i++)
+    {
+        for (int j = 0; j < mysubfields[i].size(); j++)
+            output.add("", mysubfields[i][j]->getmemoryusage());
+    }
+    for (int h = 0; h < myharmonics.size(); h++)
+    {
+        for (int j = 0; j < myharmonics[h].size(); j++)
+            output.add("", myharmonics[h][j]->getmemoryusage());
+    }
+    
+    return output;
 }
 
 void rawfield::printvalues(bool databoundsonly)
@@ -890,8 +937,8 @@ void rawfield::setvalue(elementselector& elemselect, std::vector<double>& gpcoor
     gausspoints gp(elementtypenumber, gpcoordsin);
 
     int numgp = gp.count();
-    std::vector<double> gpcoords = gp.getcoordinates();
-    std::vector<double> gpweights = gp.getweights();
+    std::vector<double>& gpcoords = gp.getcoordinates();
+    std::vector<double>& gpweights = gp.getweights();
     
     // Manages reuse automatically:
     std::shared_ptr<opdetjac> dj(new opdetjac);
@@ -975,6 +1022,7 @@ void rawfield::setvalue(elementselector& elemselect, std::vector<double>& gpcoor
             }
         }
         
+        universe::initializepetsc();
         Mat bdmat;
         MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, matsize, matsize, csrrows.getvalues(), csrcols.getvalues(), Avals.getvalues(), &bdmat);
 
@@ -1410,6 +1458,7 @@ void rawfield::setdata(int physreg, vectorfieldselect myvec, std::string op)
                 selecteddisjregs = dofmngr->getdisjointregionsofselectedfield();
             }
 
+            std::vector<int> numformfunctionsperelement(selecteddisjregs.size());
             for (int i = 0; i < selecteddisjregs.size(); i++)
             {
                 int disjreg = selecteddisjregs[i];
@@ -1426,33 +1475,23 @@ void rawfield::setdata(int physreg, vectorfieldselect myvec, std::string op)
 
                 int elementtypenumber = dr->getelementtypenumber(disjreg);
                 int elementdimension = dr->getelementdimension(disjreg);
-                int numelem = dr->countelements(disjreg);
 
                 std::shared_ptr<hierarchicalformfunction> myformfunction = selector::select(elementtypenumber, mytypename);
                 // The interpolation order for this field and the selected fields might be different.
-                int numformfunctionsperelement = std::min(myformfunction->count(getinterpolationorder(disjreg), elementdimension, 0), myformfunction->count(selectedrawfield->getinterpolationorder(disjreg), elementdimension, 0));
-
-                for (int ff = 0; ff < numformfunctionsperelement; ff++)
-                {
-                    densemat values = selectedvec->getvalues(selectedrawfield, disjreg, ff);
-                    double* vals = values.getvalues();
-                    
-                    // Transfer nothing if 'values' is empty:
-                    if (vals != NULL)
-                    {
-                        if (op == "set")
-                        {
-                            for (int elem = 0; elem < numelem; elem++)
-                                mycoefmanager->setcoef(disjreg, ff, elem, vals[elem]);
-                        }
-                        if (op == "add")
-                        {
-                            for (int elem = 0; elem < numelem; elem++)
-                                mycoefmanager->setcoef(disjreg, ff, elem, mycoefmanager->getcoef(disjreg, ff, elem) + vals[elem]);
-                        }
-                    }
-                }
+                numformfunctionsperelement[i] = std::min(myformfunction->count(getinterpolationorder(disjreg), elementdimension, 0), myformfunction->count(selectedrawfield->getinterpolationorder(disjreg), elementdimension, 0));
             }
+            
+            // Copy all form functions of all disjoint regions at once from the vector to the coefficients:
+            std::shared_ptr<dofmanager> dofmngr = selectedvec->getdofmanager();
+            dofmngr->selectfield(selectedrawfield);
+            std::vector<int> rangebegins, steps, lengths, blockdisjregindexes, blockformfunctions;
+            dofmngr->gettransferblocks(selecteddisjregs, numformfunctionsperelement, true, rangebegins, steps, lengths, blockdisjregindexes, blockformfunctions);
+            
+            std::vector<double*> targets(lengths.size());
+            for (int b = 0; b < lengths.size(); b++)
+                targets[b] = mycoefmanager->getcoefsforwriting(selecteddisjregs[blockdisjregindexes[b]], blockformfunctions[b]);
+            
+            selectedvec->getblocks(rangebegins, steps, lengths, targets, op);
         }
     }
 }
@@ -1520,33 +1559,35 @@ void rawfield::transferdata(int physreg, vectorfieldselect myvec, std::string op
         selecteddisjregs = dofmngr->getdisjointregionsofselectedfield();
     }
 
+    std::vector<int> numformfunctionsperelement(selecteddisjregs.size());
     for (int i = 0; i < selecteddisjregs.size(); i++)
     {
         int disjreg = selecteddisjregs[i];
 
         int elementtypenumber = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(disjreg);
         int elementdimension = (universe::getrawmesh()->getdisjointregions())->getelementdimension(disjreg);
-        int numelem = (universe::getrawmesh()->getdisjointregions())->countelements(disjreg);
 
         std::shared_ptr<hierarchicalformfunction> myformfunction = selector::select(elementtypenumber, mytypename);
-        // The interpolation order for this field and the selected fields might be different.
-        int numformfunctionsinoriginfield = myformfunction->count(getinterpolationorder(disjreg), elementdimension, 0);
-        int numformfunctionsperelement = myformfunction->count(selectedrawfield->getinterpolationorder(disjreg), elementdimension, 0);
-
-        for (int ff = 0; ff < numformfunctionsperelement; ff++)
-        {
-            densemat values(1,numelem,0.0);
-            double* vals = values.getvalues();
-            
-            if (ff < numformfunctionsinoriginfield)
-            {
-                for (int elem = 0; elem < numelem; elem++)
-                    vals[elem] = mycoefmanager->getcoef(disjreg, ff, elem);
-            }
-
-            selectedvec->setvalues(selectedrawfield, disjreg, ff, values, op);
-        }
+        numformfunctionsperelement[i] = myformfunction->count(selectedrawfield->getinterpolationorder(disjreg), elementdimension, 0);
+    }
+    
+    // Copy all form functions of all disjoint regions at once from the coefficients to the vector (ports are not set):
+    std::shared_ptr<dofmanager> dofmngr = selectedvec->getdofmanager();
+    dofmngr->selectfield(selectedrawfield);
+    std::vector<int> rangebegins, steps, lengths, blockdisjregindexes, blockformfunctions;
+    dofmngr->gettransferblocks(selecteddisjregs, numformfunctionsperelement, false, rangebegins, steps, lengths, blockdisjregindexes, blockformfunctions);
+    
+    // The form functions above the order of this field are transferred as zeros (NULL source):
+    std::vector<const double*> sources(lengths.size());
+    for (int b = 0; b < lengths.size(); b++)
+    {
+        int disjreg = selecteddisjregs[blockdisjregindexes[b]];
+        sources[b] = NULL;
+        if (blockformfunctions[b] < mycoefmanager->countformfunctions(disjreg))
+            sources[b] = mycoefmanager->readcoefs(disjreg, blockformfunctions[b]);
     }
+    
+    selectedvec->setblocks(rangebegins, steps, lengths, sources, op);
 }
 
 void rawfield::setcohomologysources(std::vector<int> cutphysregs, std::vector<double> cutvalues)
@@ -1774,6 +1815,187 @@ bool rawfield::isgauged(int disjreg)
     return isitgauged[disjreg];
 }
 
+void rawfield::activateharmonics(std::vector<int> harmonicnumbers)
+{
+    synchronize();
+    
+    if (amimultiharmonic == false)
+    {
+        std::cout << "Error in 'rawfield' object: cannot activate harmonics of a field that is not multiharmonic" << std::endl;
+        abort();
+    }
+    for (int i = 0; i < harmonicnumbers.size(); i++)
+    {
+        if (isharmonicincluded(harmonicnumbers[i]) == false)
+        {
+            std::cout << "Error in 'rawfield' object: cannot activate harmonic " << harmonicnumbers[i] << " (it is not in the field)" << std::endl;
+            abort();
+        }
+    }
+    
+    if (mysubfields.size() > 0)
+    {
+        for (int i = 0; i < mysubfields.size(); i++)
+            mysubfields[i][0]->activateharmonics(harmonicnumbers);
+        return;
+    }
+    
+    std::vector<bool> isinlist(myharmonics.size(), false);
+    for (int i = 0; i < harmonicnumbers.size(); i++)
+        isinlist[harmonicnumbers[i]] = true;
+    
+    for (int h = 0; h < myharmonics.size(); h++)
+    {
+        if (myharmonics[h].size() == 0 || myharmonics[h][0]->isitactive == isinlist[h])
+            continue;
+            
+        std::shared_ptr<rawfield> curharm = myharmonics[h][0];
+        curharm->isitactive = isinlist[h];
+        // A deactivated harmonic is set to zero:
+        if (isinlist[h] == false)
+            curharm->resetcoefmanager();
+        curharm->mystate = universe::getnewstate();
+    }
+}
+
+std::vector<int> rawfield::getactiveharmonics(void)
+{
+    synchronize();
+    
+    if (mysubfields.size() > 0)
+        return mysubfields[0][0]->getactiveharmonics();
+    
+    if (myharmonics.size() == 0)
+        return {1};
+    
+    std::vector<int> output = {};
+    for (int h = 0; h < myharmonics.size(); h++)
+    {
+        if (myharmonics[h].size() > 0 && myharmonics[h][0]->isitactive)
+            output.push_back(h);
+    }
+    return output;
+}
+
+std::vector<double> rawfield::getharmonicenergies(void)
+{
+    synchronize();
+    
+    if (mysubfields.size() > 0)
+    {
+        std::vector<double> output = {};
+        for (int i = 0; i < mysubfields.size(); i++)
+        {
+            std::vector<double> cur = mysubfields[i][0]->getharmonicenergies();
+            output.resize(std::max(output.size(), cur.size()), 0.0);
+            for (int h = 0; h < cur.size(); h++)
+                output[h] += cur[h];
+        }
+        return output;
+    }
+    
+    if (myharmonics.size() == 0)
+        return {0.0, mycoefmanager->getsquarednorm()};
+    
+    std::vector<double> output(myharmonics.size(), 0.0);
+    for (int h = 0; h < myharmonics.size(); h++)
+    {
+        if (myharmonics[h].size() > 0)
+            output[h] = myharmonics[h][0]->getcoefmanager()->getsquarednorm();
+    }
+    return output;
+}
+
+std::vector<int> rawfield::adaptharmonics(double shrinktol, double growtol, int verbosity)
+{
+    synchronize();
+    
+    if (amimultiharmonic == false)
+    {
+        std::cout << "Error in 'rawfield' object: cannot adapt the harmonics of a field that is not multiharmonic" << std::endl;
+        abort();
+    }
+    if (shrinktol < 0 || growtol <= shrinktol)
+    {
+        std::cout << "Error in 'rawfield' object: expected 0 <= shrink tolerance < grow tolerance to adapt the harmonics" << std::endl;
+        abort();
+    }
+    
+    std::vector<int> allharms = getharmonics();
+    std::vector<int> activeharms = getactiveharmonics();
+    if (activeharms.size() == 0)
+        return activeharms;
+    std::vector<double> energies = getharmonicenergies();
+    // The energies are summed over all ranks:
+    slmpi::sum(energies);
+    
+    double totalenergy = 0.0;
+    for (int h = 0; h < energies.size(); h++)
+        totalenergy += energies[h];
+    // Nothing to adapt on an all zero field:
+    if (totalenergy == 0)
+        return activeharms;
+    
+    std::vector<bool> isactiveharm(energies.size(), false), isnewactive(energies.size(), false);
+    for (int i = 0; i < activeharms.size(); i++)
+        isactiveharm[activeharms[i]] = true;
+    
+    // The most energetic active harmonic is never removed:
+    int maxharm = activeharms[0];
+    for (int i = 0; i < activeharms.size(); i++)
+    {
+        if (energies[activeharms[i]] > energies[maxharm])
+            maxharm = activeharms[i];
+    }
+    
+    for (int i = 0; i < allharms.size(); i++)
+    {
+        int h = allharms[i];
+        int freqindex = harmonic::getfrequency(h);
+        
+        if (isactiveharm[h])
+            isnewactive[h] = (h == maxharm || energies[h] >= shrinktol*totalenergy);
+        else
+        {
+            // Energy spills to the next frequency: activate the harmonics of frequency f if a harmonic of frequency f-1 is significant:
+            for (int j = 0; j < activeharms.size(); j++)
+            {
+                if (harmonic::getfrequency(activeharms[j]) == freqindex-1 && energies[activeharms[j]] >= growtol*totalenergy)
+                    isnewactive[h] = true;
+            }
+        }
+    }
+    
+    std::vector<int> newactiveharms = {};
+    for (int i = 0; i < allharms.size(); i++)
+    {
+        if (isnewactive[allharms[i]])
+            newactiveharms.push_back(allharms[i]);
+    }
+    
+    if (newactiveharms != activeharms)
+    {
+        activateharmonics(newactiveharms);
+        
+        if (verbosity > 0 && slmpi::getrank() == 0)
+        {
+            std::cout << "Active harmonics:";
+            for (int i = 0; i < newactiveharms.size(); i++)
+                std::cout << " " << newactiveharms[i];
+            std::cout << " (" << newactiveharms.size() << " of " << allharms.size() << ")" << std::endl;
+        }
+    }
+    
+    return newactiveharms;
+}
+
+bool rawfield::isported(int disjreg)
+{
+    synchronize();
+    
+    return isitported[disjreg];
+}
+
 int rawfield::getinterpolationorder(int disjreg) 
 { 
     synchronize();
@@ -1856,32 +2078,40 @@ void rawfield::getinterpolationorders(int fieldorder, double alpha, double absth
     // Deduce the output:
     lowestorders = std::vector<int>(numelems);
     
-    for (int i = 0; i < numelems; i++)
+    // Every thread processes a block of elements:
+    int numthreadstouse = autotuning::getnumthreadsforitems(numelems);
+    
+    taskscheduler::runperthread(numthreadstouse, [&](int t)
     {
-        double totalweight = 0.0;
-        for (int o = 0; o < numorders; o++)
-            totalweight += weightsforeachorder[i*numorders+o];
-            
-        // Lowest order if total weight is too small:
-        if (totalweight <= std::abs(absthres))
+        int first = (long long int)t*numelems/numthreadstouse;
+        int last = (long long int)(t+1)*numelems/numthreadstouse;
+        for (int i = first; i < last; i++)
         {
-            lowestorders[i] = 0; // min order is artificially brought down to 0 for h1 type as well (see weight calc)
-            continue;
-        }
+            double totalweight = 0.0;
+            for (int o = 0; o < numorders; o++)
+                totalweight += weightsforeachorder[i*numorders+o];
+            
+            // Lowest order if total weight is too small:
+            if (totalweight <= std::abs(absthres))
+            {
+                lowestorders[i] = 0; // min order is artificially brought down to 0 for h1 type as well (see weight calc)
+                continue;
+            }
             
-        double weightthreshold = std::abs(alpha)*totalweight;
+            double weightthreshold = std::abs(alpha)*totalweight;
     
-        double accumulatedweight = 0.0;
-        for (int o = 0; o < numorders; o++)
-        {
-            lowestorders[i] = o;
+            double accumulatedweight = 0.0;
+            for (int o = 0; o < numorders; o++)
+            {
+                lowestorders[i] = o;
         
-            accumulatedweight += weightsforeachorder[i*numorders+o];
+                accumulatedweight += weightsforeachorder[i*numorders+o];
 
-            if (accumulatedweight >= weightthreshold)
-                break;
+                if (accumulatedweight >= weightthreshold)
+                    break;
+            }
         }
-    }
+    });
 }
 
 void rawfield::getweightsforeachorder(int elementtypenumber, int fieldorder, std::vector<int>& elementnumbers, std::vector<double>& weightsforeachorder)
@@ -1893,48 +2123,105 @@ void rawfield::getweightsforeachorder(int elementtypenumber, int fieldorder, std
     
     weightsforeachorder = std::vector<double>(numelems*numorders, 0.0);
 
+    // Reuse the weights of the elements computed since the last change of the coefficients:
+    long long int coefstate = mycoefmanager->getstate();
+    std::vector<int> tocompute = {};
+    {
+        std::lock_guard<std::mutex> lock(*myweightsmutex);
+        
+        if (myweightsstate != coefstate)
+        {
+            myweightscache.clear();
+            myweightsstate = coefstate;
+        }
+        std::pair<std::vector<double>, std::vector<char>>& cached = myweightscache[std::make_pair(elementtypenumber, fieldorder)];
+        if (cached.second.size() == 0)
+        {
+            int numintype = universe::getrawmesh()->getelements()->count(elementtypenumber);
+            cached.first.resize((long long int)numintype*numorders);
+            cached.second = std::vector<char>(numintype, false);
+        }
+        
+        for (int i = 0; i < numelems; i++)
+        {
+            int elem = elementnumbers[i];
+            if (cached.second[elem])
+            {
+                for (int o = 0; o < numorders; o++)
+                    weightsforeachorder[i*numorders+o] = cached.first[(long long int)elem*numorders+o];
+            }
+            else
+                tocompute.push_back(i);
+        }
+    }
+    int numtocompute = tocompute.size();
+    if (numtocompute == 0)
+        return;
+    
+    std::vector<int> elemstocompute(numtocompute);
+    for (int i = 0; i < numtocompute; i++)
+        elemstocompute[i] = elementnumbers[tocompute[i]];
+
     std::vector<double> averagevals = {};
     if (mytypename == "h1" || mytypename == "h1d0" || mytypename == "h1d1" || mytypename == "h1d2" || mytypename == "h1d3")
     {
-        getaverage(elementtypenumber, elementnumbers, 1, averagevals); // nodal shape functions are at order 1
-        for (int i = 0; i < numelems; i++)
-            weightsforeachorder[i*numorders+0] = std::abs(averagevals[i]);
+        getaverage(elementtypenumber, elemstocompute, 1, averagevals); // nodal shape functions are at order 1
+        for (int i = 0; i < numtocompute; i++)
+            weightsforeachorder[tocompute[i]*numorders+0] = std::abs(averagevals[i]);
     }
 
-    disjointregions* drs = universe::getrawmesh()->getdisjointregions();
-    elements* els = universe::getrawmesh()->getelements();
+    // Order of every form function of the element type:
+    hierarchicalformfunctioniterator myiterator(mytypename, elementtypenumber, fieldorder);
+    int numff = myiterator.count();
+    std::vector<int> fforders(numff);
+    for (int ff = 0; ff < numff; ff++)
+    {
+        fforders[ff] = myiterator.getformfunctionorder();
+        myiterator.next();
+    }
     
-    element myelement(elementtypenumber);
+    // Every thread gathers and weights the coefficients of a block of elements:
+    int numthreadstouse = autotuning::getnumthreadsforitems(numtocompute);
     
-    // Create a form function iterator to iterate through all form functions of the element type.
-    hierarchicalformfunctioniterator myiterator(mytypename, elementtypenumber, fieldorder);
-
-    for (int ff = 0; ff < myiterator.count(); ff++)
+    taskscheduler::runperthread(numthreadstouse, [&](int t)
     {
-        int associatedelementtype = myiterator.getassociatedelementtype();
-        int formfunctionindex = myiterator.getformfunctionindexinnodeedgefacevolume();
-        int formfunctionorder = myiterator.getformfunctionorder();
+        int first = (long long int)t*numtocompute/numthreadstouse;
+        int last = (long long int)(t+1)*numtocompute/numthreadstouse;
+        if (first == last)
+            return;
         
-        int num = myiterator.getnodeedgefacevolumeindex();
-        // For quad subelements in prisms and pyramids:
-        if ((elementtypenumber == 6 || elementtypenumber == 7) && associatedelementtype == 3)
-            num -= myelement.counttriangularfaces(); 
-
-        for (int i = 0; i < numelems; i++)
+        std::vector<int> curelems(elemstocompute.begin()+first, elemstocompute.begin()+last);
+        int numcurelems = curelems.size();
+        
+        densemat coefmat = getcoefficients(elementtypenumber, fieldorder, curelems, {mycoefmanager.get()});
+        double* coefs = coefmat.getvalues();
+        
+        for (int ff = 0; ff < numff; ff++)
         {
-            int elem = elementnumbers[i];
-            int currentsubelem = els->getsubelement(associatedelementtype, elementtypenumber, elem, num);
-            int currentdisjointregion = els->getdisjointregion(associatedelementtype, currentsubelem);
-            int rb = drs->getrangebegin(currentdisjointregion);
-            
-            double curcoef = mycoefmanager->getcoef(currentdisjointregion, formfunctionindex, currentsubelem-rb);
-            if (formfunctionorder == 1 && averagevals.size() > 0)
-                curcoef -= averagevals[i];
-            
-            weightsforeachorder[i*numorders+formfunctionorder] += std::abs(curcoef);
+            int formfunctionorder = fforders[ff];
+            for (int i = 0; i < numcurelems; i++)
+            {
+                double curcoef = coefs[ff*numcurelems+i];
+                if (formfunctionorder == 1 && averagevals.size() > 0)
+                    curcoef -= averagevals[first+i];
+                
+                weightsforeachorder[tocompute[first+i]*numorders+formfunctionorder] += std::abs(curcoef);
+            }
         }
-        myiterator.next();
-    }    
+    });
+    
+    std::lock_guard<std::mutex> lock(*myweightsmutex);
+    if (myweightsstate == coefstate)
+    {
+        std::pair<std::vector<double>, std::vector<char>>& cached = myweightscache[std::make_pair(elementtypenumber, fieldorder)];
+        for (int i = 0; i < numtocompute; i++)
+        {
+            int elem = elemstocompute[i];
+            for (int o = 0; o < numorders; o++)
+                cached.first[(long long int)elem*numorders+o] = weightsforeachorder[tocompute[i]*numorders+o];
+            cached.second[elem] = true;
+        }
+    }
 }
 
 void rawfield::errornotsameinterpolationorder(int disjreg)
@@ -2053,6 +2340,36 @@ std::vector<std::pair<std::vector<int>, std::shared_ptr<rawfield>>> rawfield::ge
 }
 
 void rawfield::writeraw(int physreg, std::string filename, bool isbinary, std::vector<double> extradata)
+{
+    std::vector<int> intdata;
+    std::vector<double> doubledata;
+    getraw(physreg, intdata, doubledata, extradata);
+    
+    // This will write the int data length and double data length at the file begin:
+    iointerface::write(filename, intdata, doubledata, isbinary);
+}
+
+std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
+{
+    ///// Load the data from disk:
+    std::vector<int> intdata;
+    std::vector<double> doubledata;
+
+    // Uncompressed binary files are read in place and streamed directly to the coefficients:
+    if (isbinary && (filename.size() < 7 || filename.substr(filename.size()-7,7) != ".slz.gz"))
+    {
+        mappedrawfile rawfile(filename);
+        rawfile.getintdata(intdata);
+        
+        return setraw(intdata, rawfile.countdoubles(), [&](long long int first, long long int numdoubles, double* target){ rawfile.getdoubledata(first, numdoubles, target); }, "file '" + filename + "'");
+    }
+
+    iointerface::load(filename, intdata, doubledata, isbinary);
+    
+    return setraw(intdata, doubledata, "file '" + filename + "'");
+}
+
+void rawfield::getraw(int physreg, std::vector<int>& intdata, std::vector<double>& flatdoubledata, std::vector<double> extradata)
 {
     synchronize();
     
@@ -2090,7 +2407,7 @@ void rawfield::writeraw(int physreg, std::string filename, bool isbinary, std::v
     // 7. All disjoint region numbers interlaced with the number of elements in each disjoint region
     // 8. For every son loop on every disjoint region and store {interpolorder, doublevecrangebegin}
     //
-    std::vector<int> intdata(5 + numharms + 2*numdisjregs + numsons * 2*numdisjregs);
+    intdata = std::vector<int>(5 + numharms + 2*numdisjregs + numsons * 2*numdisjregs);
 
     intdata[0] = 1; // Format number
     intdata[1] = fieldtypenum;
@@ -2150,21 +2467,14 @@ void rawfield::writeraw(int physreg, std::string filename, bool isbinary, std::v
             // Populate the 'doubledata' vector:
             doubledata[i][d].resize(numberofelements * numberofformfunctions);
                         
-            int curindex = 0;
             for (int ff = 0; ff < numberofformfunctions; ff++)
-            {
-                for (int e = 0; e < numberofelements; e++)
-                {
-                    doubledata[i][d][curindex] = curcoefmanager->getcoef(disjreg, ff, e);
-                    curindex++;
-                }
-            }
+                curcoefmanager->getcoefs(disjreg, ff, doubledata[i][d].data() + ff*numberofelements);
         }
     }
     
     
     // Flatten the double data vector:
-    std::vector<double> flatdoubledata(doubledatasize);
+    flatdoubledata = std::vector<double>(doubledatasize);
     
     int curindex = 0;
     for (int i = 0; i < extradata.size(); i++)
@@ -2184,28 +2494,28 @@ void rawfield::writeraw(int physreg, std::string filename, bool isbinary, std::v
             }
         } 
     }
-    
-    
-    // This will write the int data length and double data length at the file begin:
-    iointerface::write(filename, intdata, flatdoubledata, isbinary);
+
 }
 
-std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
+std::vector<double> rawfield::setraw(std::vector<int>& intdata, std::vector<double>& doubledata, std::string source)
+{
+    return setraw(intdata, doubledata.size(), [&](long long int first, long long int numdoubles, double* target){ std::copy(doubledata.begin()+first, doubledata.begin()+first+numdoubles, target); }, source);
+}
+
+std::vector<double> rawfield::setraw(std::vector<int>& intdata, long long int totalnumdoubles, std::function<void(long long int first, long long int numdoubles, double* target)> getdoubledata, std::string source)
 {
     synchronize();
     
     disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
     
     
-    ///// Load the data from disk:
-    std::vector<int> intdata;
-    std::vector<double> doubledata;
-
-    iointerface::load(filename, intdata, doubledata, isbinary);
-    
-    
-    ///// Extract the file format number:
-    // int fileformatnum = intdata[0];
+    ///// Extract the file format number and make sure it is supported:
+    int fileformatnum = (intdata.size() > 0) ? intdata[0] : -1;
+    if (fileformatnum != 1 || intdata.size() < 5)
+    {
+        std::cout << "Error in 'rawfield' object: unsupported raw format number " << fileformatnum << " in " << source << std::endl;
+        abort();
+    }
     
     
     ///// Extract the field type number and make sure the field type names match:
@@ -2215,7 +2525,7 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
 
     if (mytypename != fieldtypename)
     {
-        std::cout << "Error in 'rawfield' object: trying to load a '" << fieldtypename << "' type field from file '" << filename << "' to a '" << mytypename << "' type" << std::endl;
+        std::cout << "Error in 'rawfield' object: trying to load a '" << fieldtypename << "' type field from " << source << " to a '" << mytypename << "' type" << std::endl;
         abort();
     }
     
@@ -2224,7 +2534,7 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
     int numsubfields = intdata[2];
     if (numsubfields != countsubfields())
     {
-        std::cout << "Error in 'rawfield' object: trying to load a field with " << numsubfields << " subfields from file '" << filename << "' to one with " << countsubfields() << " subfields" << std::endl;
+        std::cout << "Error in 'rawfield' object: trying to load a field with " << numsubfields << " subfields from " << source << " to one with " << countsubfields() << " subfields" << std::endl;
         abort();
     }
     
@@ -2242,7 +2552,7 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
 
     if (harmoniclist != harmsinthisfield)
     {
-        std::cout << "Error in 'rawfield' object: harmonic list in field loaded from file '" << filename << "' does not match current field." << std::endl << std::endl;
+        std::cout << "Error in 'rawfield' object: harmonic list in field loaded from " << source << " does not match current field." << std::endl << std::endl;
 
         std::cout << "Harmonics in loaded field (" << harmoniclist.size() << "): ";
         for (int i = 0; i < harmoniclist.size(); i++)
@@ -2263,7 +2573,12 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
     std::vector<int> disjregs(numdisjregs); std::vector<int> numelems(numdisjregs);
     
     if (numdisjregs == 0)
-        return doubledata;
+    {
+        // All double data is extra data:
+        std::vector<double> extradata(totalnumdoubles);
+        getdoubledata(0, totalnumdoubles, extradata.data());
+        return extradata;
+    }
         
     for (int i = 0; i < numdisjregs; i++)
     {
@@ -2289,7 +2604,7 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
     }
     if (issamemesh == false)
     {
-        std::cout << "Error in 'rawfield' object: the mesh used to write file '" << filename << "' is not the same as the current one" << std::endl;
+        std::cout << "Error in 'rawfield' object: the mesh used to write " << source << " is not the same as the current one" << std::endl;
         abort();
     }
     
@@ -2298,8 +2613,12 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
     
     // Load the extra data at the double data vector begin:
     std::vector<double> extradata(intdata[indexinintvec+1]);
-    for (int i = 0; i < extradata.size(); i++)
-        extradata[i] = doubledata[i];
+    if (extradata.size() > totalnumdoubles)
+    {
+        std::cout << "Error in 'rawfield' object: raw data from " << source << " is truncated or corrupted" << std::endl;
+        abort();
+    }
+    getdoubledata(0, extradata.size(), extradata.data());
     
     // Calculate the number of sons:
     int numsons = (intdata.size() - indexinintvec) / (2*numdisjregs);
@@ -2334,16 +2653,15 @@ std::vector<double> rawfield::loadraw(std::string filename, bool isbinary)
             int numberofformfunctions = myformfunction->count(interpolorder, elementdimension, 0);
 
             
-            // Extract the double data:
-            int curindex = 0;
-            for (int ff = 0; ff < numberofformfunctions; ff++)
+            if (rangebeginindoubledata < 0 || rangebeginindoubledata + (long long int)numberofformfunctions*numberofelements > totalnumdoubles)
             {
-                for (int e = 0; e < numberofelements; e++)
-                {
-                    curcoefmanager->setcoef(disjreg, ff, e, doubledata[rangebeginindoubledata + curindex]);
-                    curindex++;
-                }
+                std::cout << "Error in 'rawfield' object: raw data from " << source << " is truncated or corrupted" << std::endl;
+                abort();
             }
+            
+            // Extract the double data directly to the coefficients:
+            for (int ff = 0; ff < numberofformfunctions; ff++)
+                getdoubledata(rangebeginindoubledata + (long long int)ff*numberofelements, numberofelements, curcoefmanager->getcoefsforwriting(disjreg, ff));
         }
     }
     
@@ -2365,38 +2683,13 @@ std::vector<densemat> rawfield::getjacterms(elementselector& elemselect, std::ve
 
     std::vector<int> elementlist = elemselect.getelementnumbers();
 
-    // Get all node coordinates:
-    std::vector<double>* mynodecoordinates = universe::getrawmesh()->getnodes()->getcoordinates();
+    // Get the node coordinates of all elements in the block (element x node x xyz):
+    std::vector<double>* nodecoords = universe::getcontext()->getnodecoordinates(elementtypenumber, elementlist);
 
     element myelement(elementtypenumber, myelements->getcurvatureorder());        
     int numcurvednodes = myelement.countcurvednodes();
 
-    int numrows = numcurvednodes;
-    int numcols = elementlist.size();
-
-    std::vector<densemat> coefmatrix(problemdimension);
-    for (int d = 0; d < problemdimension; d++)
-        coefmatrix[d] = densemat(numrows, numcols);
-        
-    std::vector<double*> coefs(problemdimension);
-    for (int d = 0; d < problemdimension; d++)
-        coefs[d] = coefmatrix[d].getvalues();
-
-    for (int num = 0; num < numcurvednodes; num++)
-    {
-        for (int i = 0; i < elementlist.size(); i++)
-        {
-            int elem = elementlist[i];
-            // Get the node to which the current form function is associated:
-            int currentnode = myelements->getsubelement(0, elementtypenumber, elem, num);
-
-            for (int d = 0; d < problemdimension; d++)
-                coefs[d][num*numcols+i] = mynodecoordinates->at(3*currentnode+d);
-        }
-    }
-    for (int d = 0; d < problemdimension; d++)
-        coefmatrix[d].transpose();
-
+    int numelems = elementlist.size();
 
     // Compute the form functions evaluated at the evaluation points:
     lagrangeformfunction mylagrange(elementtypenumber, myelements->getcurvatureorder(), evaluationcoordinates);
@@ -2404,6 +2697,20 @@ std::vector<densemat> rawfield::getjacterms(elementselector& elemselect, std::ve
     for (int ed = 0; ed < elementdimension; ed++)
         myformfunctionvalue[ed] = mylagrange.getderivative(1+ed);
 
+    // Use the kernel specialized for the element type and curvature order if any:
+    if (jacobiankernels::compute(elementtypenumber, myelements->getcurvatureorder(), problemdimension, numelems, evaluationcoordinates.size()/3, *nodecoords, myformfunctionvalue, output))
+        return output;
+
+    // The coordinates are directly written in the elements x nodes layout:
+    std::vector<densemat> coefmatrix(problemdimension);
+    for (int d = 0; d < problemdimension; d++)
+    {
+        coefmatrix[d] = densemat(numelems, numcurvednodes);
+        double* coefs = coefmatrix[d].getvalues();
+        for (long long int i = 0; i < (long long int)numelems*numcurvednodes; i++)
+            coefs[i] = (*nodecoords)[3*i+d];
+    }
+
     for (int ed = 0; ed < elementdimension; ed++)
     {
         for (int d = 0; d < problemdimension; d++)
@@ -2465,7 +2772,6 @@ densemat rawfield::getcoefficients(int elementtypenumber, int interpolorder, std
 {   
     synchronize();
     
-    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();  
     elements* myelements = universe::getrawmesh()->getelements();
     
     // In case the field is the x, y or z coordinate field:
@@ -2477,7 +2783,7 @@ densemat rawfield::getcoefficients(int elementtypenumber, int interpolorder, std
         if (mytypename == "z")
             mycoordinate = 2;
         
-        std::vector<double>* mynodecoordinates = universe::getrawmesh()->getnodes()->getcoordinates();
+        std::vector<double>* nodecoords = universe::getcontext()->getnodecoordinates(elementtypenumber, elementlist);
      
         element myelement(elementtypenumber, myelements->getcurvatureorder());        
         int numcurvednodes = myelement.countcurvednodes();
@@ -2490,55 +2796,69 @@ densemat rawfield::getcoefficients(int elementtypenumber, int interpolorder, std
 
         for (int num = 0; num < numcurvednodes; num++)
         {
-            for (int i = 0; i < elementlist.size(); i++)
-            {
-                int elem = elementlist[i];
-                // Get the node to which the current form function is associated:
-                int currentnode = myelements->getsubelement(0, elementtypenumber, elem, num);
-                
-                coefs[num*numcols+i] = mynodecoordinates->at(3*currentnode+mycoordinate);
-            }
+            for (int i = 0; i < numcols; i++)
+                coefs[num*numcols+i] = (*nodecoords)[3*((long long int)i*numcurvednodes+num)+mycoordinate];
         }
         return coefmatrix;
     }
     else
-    {
-        element myelement(elementtypenumber);
-        
-        // Create a form function iterator to iterate through all form functions.
-        hierarchicalformfunctioniterator myiterator(mytypename, elementtypenumber, interpolorder);
+        return getcoefficients(elementtypenumber, interpolorder, elementlist, {mycoefmanager.get()});
+}
 
-        int numrows = myiterator.count();
-        int numcols = elementlist.size();
+densemat rawfield::getcoefficients(int elementtypenumber, int interpolorder, std::vector<int>& elementlist, std::vector<coefmanager*> coefmanagers)
+{
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();  
+    elements* myelements = universe::getrawmesh()->getelements();
 
-        densemat coefmatrix(numrows, numcols);
-        double* coefs = coefmatrix.getvalues();
+    element myelement(elementtypenumber);
+    
+    // Create a form function iterator to iterate through all form functions.
+    hierarchicalformfunctioniterator myiterator(mytypename, elementtypenumber, interpolorder);
+
+    int numcms = coefmanagers.size();
+    int numelems = elementlist.size();
+    int numrows = myiterator.count();
+    long long int numcols = (long long int)numcms*numelems;
+
+    densemat coefmatrix(numrows, numcols);
+    double* coefs = coefmatrix.getvalues();
 
-        for (int ff = 0; ff < myiterator.count(); ff++)
+    std::vector<const double*> disjregcoefs(numcms, NULL);
+
+    for (int ff = 0; ff < myiterator.count(); ff++)
+    {
+        int associatedelementtype = myiterator.getassociatedelementtype();
+        int formfunctionindex = myiterator.getformfunctionindexinnodeedgefacevolume();
+        int num = myiterator.getnodeedgefacevolumeindex();
+        // For quad subelements in prisms and pyramids:
+        if ((elementtypenumber == 6 || elementtypenumber == 7) && associatedelementtype == 3)
+            num -= myelement.counttriangularfaces();
+
+        // The coefficient pointers are only fetched again when the disjoint region changes:
+        int lastdisjointregion = -1, lastrangebegin = 0;
+        for (int i = 0; i < numelems; i++)
         {
-            int associatedelementtype = myiterator.getassociatedelementtype();
-            int formfunctionindex = myiterator.getformfunctionindexinnodeedgefacevolume();
-            int num = myiterator.getnodeedgefacevolumeindex();
-            // For quad subelements in prisms and pyramids:
-            if ((elementtypenumber == 6 || elementtypenumber == 7) && associatedelementtype == 3)
-                num -= myelement.counttriangularfaces();
-
-            for (int i = 0; i < elementlist.size(); i++)
+            int elem = elementlist[i];
+            // Get the subelement to which the current form function is associated:
+            int currentsubelem = myelements->getsubelement(associatedelementtype, elementtypenumber, elem, num);
+            // Also get its disjoint region number:
+            int currentdisjointregion = myelements->getdisjointregion(associatedelementtype, currentsubelem);
+            if (currentdisjointregion != lastdisjointregion)
             {
-                int elem = elementlist[i];
-                // Get the subelement to which the current form function is associated:
-                int currentsubelem = myelements->getsubelement(associatedelementtype, elementtypenumber, elem, num);
-                // Also get its disjoint region number:
-                int currentdisjointregion = myelements->getdisjointregion(associatedelementtype, currentsubelem);
-                // Use it to get the subelem index in the disjoint region:
-                currentsubelem -= mydisjointregions->getrangebegin(currentdisjointregion);
-
-                coefs[ff*numcols+i] = mycoefmanager->getcoef(currentdisjointregion, formfunctionindex, currentsubelem);
+                lastdisjointregion = currentdisjointregion;
+                lastrangebegin = mydisjointregions->getrangebegin(currentdisjointregion);
+                for (int c = 0; c < numcms; c++)
+                    disjregcoefs[c] = coefmanagers[c]->readcoefs(currentdisjointregion, formfunctionindex);
             }
-            myiterator.next();
+            // Use it to get the subelem index in the disjoint region:
+            currentsubelem -= lastrangebegin;
+
+            for (int c = 0; c < numcms; c++)
+                coefs[ff*numcols+(long long int)c*numelems+i] = (disjregcoefs[c] == NULL) ? 0.0 : disjregcoefs[c][currentsubelem];
         }
-        return coefmatrix;
+        myiterator.next();
     }
+    return coefmatrix;
 }
 
 std::vector<std::vector<densemat>> rawfield::interpolate(int whichderivative, int formfunctioncomponent, int elementtypenumber, int totalorientation, int interpolorder, std::vector<int> elementnumbers, std::vector<double>& evaluationcoordinates)
@@ -2566,33 +2886,75 @@ std::vector<std::vector<densemat>> rawfield::interpolate(int whichderivative, in
         {
             // Get the coefficients:
             densemat mycoefs = getcoefficients(elementtypenumber, interpolorder, elementnumbers);
-            // Compute the form functions evaluated at the evaluation points.
-            // This reuses as much as possible what's already been computed:
-            hierarchicalformfunctioncontainer* val = universe::gethff(mytypename, elementtypenumber, interpolorder, evaluationcoordinates);
-            
-            // We can get the total orientation from elementnumbers[0] since
-            // we require that all elements have the same total orientation.
-            densemat myformfunctionvalue = val->tomatrix(totalorientation, interpolorder, whichderivative, formfunctioncomponent);
-            
-            mycoefs.transpose();
-            densemat coefstimesformfunctions = mycoefs.multiply(myformfunctionvalue);
 
-            return {{},{coefstimesformfunctions}};
+            return {{},{interpolatecoefficients(mycoefs, whichderivative, formfunctioncomponent, elementtypenumber, totalorientation, interpolorder, evaluationcoordinates)}};
         }
         else
         {
             std::vector<std::vector<densemat>> coefstimesformfunctions(myharmonics.size());
 
+            std::vector<int> harms;
+            std::vector<coefmanager*> coefmanagers;
             for (int harm = 1; harm < myharmonics.size(); harm++)
             {
-                if (myharmonics[harm].size() == 0)
-                    continue;
-                else
-                    coefstimesformfunctions[harm] = {(myharmonics[harm][0]->interpolate(whichderivative, formfunctioncomponent, elementtypenumber, totalorientation, interpolorder, elementnumbers, evaluationcoordinates))[1][0]};
+                if (myharmonics[harm].size() > 0)
+                {
+                    harms.push_back(harm);
+                    coefmanagers.push_back(myharmonics[harm][0]->mycoefmanager.get());
+                }
+            }
+            int numelems = elementnumbers.size();
+            if (numelems == 0 || harms.size() == 0)
+            {
+                for (int i = 0; i < harms.size(); i++)
+                    coefstimesformfunctions[harms[i]] = {densemat(0, evaluationcoordinates.size()/3)};
+                return coefstimesformfunctions;
+            }
+
+            // The coefficients of all harmonics are gathered harmonic-major (the columns of harmonic i are
+            // i*numelems to (i+1)*numelems-1) so that all harmonics are interpolated in a single product:
+            densemat mycoefs = getcoefficients(elementtypenumber, interpolorder, elementnumbers, coefmanagers);
+            densemat allharms = interpolatecoefficients(mycoefs, whichderivative, formfunctioncomponent, elementtypenumber, totalorientation, interpolorder, evaluationcoordinates);
+
+            if (harms.size() == 1)
+                coefstimesformfunctions[harms[0]] = {allharms};
+            else
+            {
+                for (int i = 0; i < harms.size(); i++)
+                    coefstimesformfunctions[harms[i]] = {allharms.extractrows((long long int)i*numelems, (long long int)(i+1)*numelems-1)};
             }
             return coefstimesformfunctions;
         }
     }
 }
 
+densemat rawfield::interpolatecoefficients(densemat mycoefs, int whichderivative, int formfunctioncomponent, int elementtypenumber, int totalorientation, int interpolorder, std::vector<double>& evaluationcoordinates)
+{
+    // Compute the form functions evaluated at the evaluation points.
+    // This reuses as much as possible what's already been computed.
+    // All elements have the same total orientation.
+    densemat myformfunctionvalue = formfunctioncache::get(mytypename, elementtypenumber, interpolorder, evaluationcoordinates, totalorientation, whichderivative, formfunctioncomponent);
+    
+    // The interior form functions of high order quadrangles and hexahedra are interpolated with a sum factorization:
+    if (sumfactorization::isapplicable(mytypename, elementtypenumber, interpolorder, formfunctioncomponent))
+    {
+        sumfactorization mysumfact(elementtypenumber, totalorientation, interpolorder, evaluationcoordinates);
+        if (mysumfact.isvalid())
+        {
+            int numother = mycoefs.countrows()-mysumfact.countinterior();
+            densemat coefstimesformfunctions = mysumfact.interpolate(mycoefs.extractrows(numother, mycoefs.countrows()-1), whichderivative);
+            if (numother > 0)
+            {
+                densemat othercoefs = mycoefs.extractrows(0, numother-1);
+                othercoefs.transpose();
+                coefstimesformfunctions.add(othercoefs.multiply(myformfunctionvalue.extractrows(0, numother-1)));
+            }
+            return coefstimesformfunctions;
+        }
+    }
+    
+    mycoefs.transpose();
+    return mycoefs.multiply(myformfunctionvalue);
+}
+
 
@@ -27,6 +27,9 @@
 #include <string>
 #include <cmath>
 #include <algorithm>
+#include <functional>
+#include <map>
+#include <mutex>
 #include "coefmanager.h"
 #include "universe.h"
 #include "expression.h"
@@ -41,6 +44,7 @@
 #include "hierarchicalformfunction.h"
 #include "hierarchicalformfunctioncontainer.h"
 #include "hierarchicalformfunctioniterator.h"
+#include "sumfactorization.h"
 #include "lagrangeformfunction.h"
 #include "elementselector.h"
 #include "memory.h"
@@ -50,6 +54,11 @@
 #include "rawspanningtree.h"
 #include "rawmesh.h"
 #include "rawport.h"
+#include "petscindexes.h"
+#include "memoryusage.h"
+#include "mappedrawfile.h"
+#include "formfunctioncache.h"
+#include "jacobiankernels.h"
 
 class rawmesh;
 class vectorfieldselect;
@@ -99,6 +108,9 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         // isitported[disjreg] is true if a port is associated to the disjoint region.
         std::vector<bool> isitported = {};
         
+        // An inactive field (harmonic) is held at zero and all its dofs are eliminated from the system like constrained dofs:
+        bool isitactive = true;
+        
         
         
         bool ispadaptive = false;
@@ -121,9 +133,22 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         
         int myupdateaccuracy = 0;
         
+        // State of the last coef manager replacement:
+        long long int mystate = 0;
+        
+        // Weights of the p-adaptivity already computed for the coefficients at state 'myweightsstate'. Entry {elementtypenumber, fieldorder}
+        // holds the weights of every element of the type (see 'getweightsforeachorder') and a flag per element telling if they are computed.
+        long long int myweightsstate = -1;
+        std::map<std::pair<int,int>, std::pair<std::vector<double>, std::vector<char>>> myweightscache = {};
+        std::shared_ptr<std::mutex> myweightsmutex = std::shared_ptr<std::mutex>(new std::mutex);
+        
         
         // Mesh on which this object is based:
         std::shared_ptr<rawmesh> myrawmesh = NULL;
+        
+        // Set the raw data from the int data and a function copying 'numdoubles' values starting at 'first' in the double data to 'target'
+        // ('totalnumdoubles' is the double data length):
+        std::vector<double> setraw(std::vector<int>& intdata, long long int totalnumdoubles, std::function<void(long long int first, long long int numdoubles, double* target)> getdoubledata, std::string source);
 
     public:
   
@@ -164,8 +189,14 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         std::shared_ptr<coefmanager> resetcoefmanager(void);
         void setcoefmanager(std::shared_ptr<coefmanager> cm);
         
+        // Get the state of the last modification of the field values (or only of the field structure) including all subfields and harmonics:
+        long long int getstate(bool structureonly = false);
+        
         // Print the raw field name:
-        void print(void);
+        void print(std::ostream& out = std::cout);
+        
+        // Bytes used by the coefficients of the field and of all its subfields and harmonics:
+        memoryusage getmemoryusage(void);
         void printvalues(bool databoundsonly = true);
         // Set the raw field name:
         void setname(std::string name);
@@ -238,6 +269,18 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         std::vector<std::vector<expression>> getconditionalconstraints(void);
 
         bool isgauged(int disjreg);
+        
+        bool isported(int disjreg);
+        
+        // Only valid for fields without subfields and harmonics:
+        bool isactive(void) { return isitactive; };
+        // Keep the listed harmonics and hold all other harmonics of a multiharmonic field at zero (they are then eliminated from the system):
+        void activateharmonics(std::vector<int> harmonicnumbers);
+        std::vector<int> getactiveharmonics(void);
+        // Sum of the squared coefficients of every harmonic over all subfields (indexed by the harmonic number):
+        std::vector<double> getharmonicenergies(void);
+        // Adapt the active harmonics of a multiharmonic field to its spectrum (see 'field::adaptharmonics'):
+        std::vector<int> adaptharmonics(double shrinktol, double growtol, int verbosity);
 
         // Get the interpolation order on a disjoint region.
         // Only valid for fields without subfields.
@@ -248,7 +291,8 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         // This function returns the lowest order containing alpha % of the shape function coefficient weight.
         void getinterpolationorders(int fieldorder, double alpha, double absthres, std::vector<double>& weightsforeachorder, std::vector<int>& lowestorders);
         
-        // 'weightsforeachorder' has size numelems x fieldorder+1:
+        // 'weightsforeachorder' has size numelems x fieldorder+1. The weights are computed in parallel and
+        // only for the elements not already computed since the last change of the field coefficients:
         void getweightsforeachorder(int elementtypenumber, int fieldorder, std::vector<int>& elementnumbers, std::vector<double>& weightsforeachorder);
         
         // Give an error if all harmonics have not the same interpolation order.
@@ -266,6 +310,9 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         // Write/load the raw data to/from compact sparselizard format:
         void writeraw(int physreg, std::string filename, bool isbinary, std::vector<double> extradata);
         std::vector<double> loadraw(std::string filename, bool isbinary);
+        // Same as above but to and from the int and double data vectors ('source' describes the data origin in the error messages):
+        void getraw(int physreg, std::vector<int>& intdata, std::vector<double>& doubledata, std::vector<double> extradata);
+        std::vector<double> setraw(std::vector<int>& intdata, std::vector<double>& doubledata, std::string source);
         
 
         // Return {dkix,dkiy,...,detax,detay,...}:
@@ -277,6 +324,13 @@ class rawfield : public std::enable_shared_from_this<rawfield>
         
         // The function works only on fields that are not containers.
         densemat getcoefficients(int elementtypenumber, int interpolorder, std::vector<int> elementnumbers);
+        // Coefficients of the fields of all coefficient managers (this or the harmonics) gathered in one pass.
+        // The output has size numformfunctions x (numcoefmanagers*numelements) with the columns of each
+        // coefficient manager contiguous.
+        densemat getcoefficients(int elementtypenumber, int interpolorder, std::vector<int>& elementnumbers, std::vector<coefmanager*> coefmanagers);
+        // Interpolate the 'numformfunctions x numcolumns' coefficients at the evaluation points. The output has
+        // size numcolumns x numevaluationpoints.
+        densemat interpolatecoefficients(densemat coefs, int whichderivative, int formfunctioncomponent, int elementtypenumber, int totalorientation, int interpolorder, std::vector<double>& evaluationcoordinates);
         // 'interpolate' outputs the field value at the evaluation coordinates
         // provided as second argument for all elements in 'elementlist'.
         // Set 'whichderivative' to 0, 1, 2 or 3 to get respectively the 
@@ -1,8 +1,9 @@
 #include "contribution.h"
 #include "dofinterpolate.h"
+#include <sstream>
 
 
-contribution::contribution(std::shared_ptr<dofmanager> dofmngr) { mydofmanager = dofmngr; }
+contribution::contribution(std::shared_ptr<dofmanager> dofmngr) { mydofmanager = dofmngr; mycache = std::shared_ptr<contributioncache>(new contributioncache); myrhstables = std::shared_ptr<rhsassemblycache>(new rhsassemblycache); myelemcache = std::shared_ptr<elementmatrixcache>(new elementmatrixcache); }
 
 void contribution::setdofs(std::vector<std::shared_ptr<operation>> dofs) { mydofs = dofs; }
 void contribution::settfs(std::vector<std::shared_ptr<operation>> tfs) { mytfs = tfs; }
@@ -14,14 +15,300 @@ void contribution::setintegrationphysicalregion(int physreg) { integrationphysre
 void contribution::setdofphysicalregion(int physreg) { dofphysreg = physreg; }
 void contribution::settfphysicalregion(int physreg) { tfphysreg = physreg; }
 void contribution::setintegrationorderdelta(int integrorderdelta) { integrationorderdelta = integrorderdelta; }
+void contribution::setquadraturerule(std::string rule) { myquadraturerule = rule; }
 void contribution::setnumfftcoeffs(int numcoeffs) { numfftcoeffs = numcoeffs; }
 void contribution::setbarycenterevalflag(void) { isbarycentereval = true; }
 
-void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat)
-{   
-    bool isdofinterpolate = (doffield != NULL && mydofs[0]->ison());
+bool contribution::isregionconstant(std::shared_ptr<operation> op, std::vector<int>& disjregs, double& value)
+{
+    if (op->isconstant())
+    {
+        value = op->getvalue();
+        return true;
+    }
+
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        for (int i = 0; i < disjregs.size(); i++)
+        {
+            std::shared_ptr<operation> regionop = param->get(disjregs[i], op->getselectedrow(), op->getselectedcol());
+            if (regionop->isconstant() == false || (i > 0 && regionop->getvalue() != value))
+                return false;
+            value = regionop->getvalue();
+        }
+        return (disjregs.size() > 0);
+    }
+
+    bool issum = op->issum(), isproduct = op->isproduct();
+    bool ispower = (std::dynamic_pointer_cast<oppower>(op) != NULL), isinversion = (std::dynamic_pointer_cast<opinversion>(op) != NULL);
+    if (not(issum || isproduct || ispower || isinversion))
+        return false;
+
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    std::vector<double> argvalues(arguments.size());
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        if (isregionconstant(arguments[i], disjregs, argvalues[i]) == false)
+            return false;
+    }
+
+    if (ispower)
+        value = std::pow(argvalues[0], argvalues[1]);
+    if (isinversion)
+        value = 1.0/argvalues[0];
+    if (issum || isproduct)
+    {
+        value = (issum ? 0.0 : 1.0);
+        for (int i = 0; i < argvalues.size(); i++)
+            value = (issum ? value + argvalues[i] : value * argvalues[i]);
+    }
+    return true;
+}
+
+int contribution::getpolynomialdegree(std::shared_ptr<operation> op, std::vector<int>& disjregs)
+{
+    double value;
+    if (isregionconstant(op, disjregs, value))
+        return 0;
+    
+    if (op->isfield())
+    {
+        // Hcurl shape functions of order k have polynomial degree k+1:
+        int degree = 0;
+        for (int i = 0; i < disjregs.size(); i++)
+            degree = std::max(degree, op->getfieldpointer()->getinterpolationorder(disjregs[i]));
+        return degree + (op->getfieldpointer()->gettypename() == "hcurl" ? 1 : 0);
+    }
+    
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    
+    if (std::dynamic_pointer_cast<oppower>(op) != NULL)
+    {
+        double exponent;
+        if (isregionconstant(arguments[1], disjregs, exponent) == false || exponent < 0 || exponent != std::floor(exponent))
+            return -1;
+        int basedegree = getpolynomialdegree(arguments[0], disjregs);
+        return (basedegree < 0 ? -1 : basedegree * ((int) exponent));
+    }
+    
+    if (op->issum() == false && op->isproduct() == false)
+        return -1;
+    
+    int degree = 0;
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        int argdegree = getpolynomialdegree(arguments[i], disjregs);
+        if (argdegree < 0)
+            return -1;
+        degree = (op->issum() ? std::max(degree, argdegree) : degree + argdegree);
+    }
+    return degree;
+}
+
+bool contribution::iselementconstant(std::shared_ptr<operation> op, std::vector<int>& disjregs)
+{
+    double value;
+    if (isregionconstant(op, disjregs, value))
+        return true;
+
+    if (std::dynamic_pointer_cast<opinvjac>(op) != NULL || std::dynamic_pointer_cast<opjac>(op) != NULL || std::dynamic_pointer_cast<opdetjac>(op) != NULL)
+        return true;
 
-    // Get the harmonics in the dof and tf fields. Get the max harmonic numbers as well:
+    if (not(op->issum() || op->isproduct() || std::dynamic_pointer_cast<oppower>(op) != NULL || std::dynamic_pointer_cast<opinversion>(op) != NULL))
+        return false;
+
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        if (iselementconstant(arguments[i], disjregs) == false)
+            return false;
+    }
+    return true;
+}
+
+bool contribution::isrigidinvariant(std::shared_ptr<operation> op, std::vector<int>& disjregs, int motion)
+{
+    if (op->isconstant() || op->isport())
+        return true;
+    
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        for (int i = 0; i < disjregs.size(); i++)
+        {
+            std::shared_ptr<operation> regionop = param->get(disjregs[i], op->getselectedrow(), op->getselectedcol());
+            if (regionop == NULL || isrigidinvariant(regionop, disjregs, motion) == false)
+                return false;
+        }
+        return true;
+    }
+    
+    if (op->isfield())
+    {
+        std::string fieldtypename = op->getfieldpointer()->gettypename();
+        if (motion > 0 && (fieldtypename == "x" || fieldtypename == "y" || fieldtypename == "z"))
+            return false;
+        // The hcurl values and the space derivatives are rotated with the element:
+        return (motion < 2 || (fieldtypename != "hcurl" && op->getspacederivative() == 0));
+    }
+    
+    if (std::dynamic_pointer_cast<opjac>(op) != NULL || std::dynamic_pointer_cast<opinvjac>(op) != NULL)
+        return (motion < 2);
+    if (std::dynamic_pointer_cast<opdetjac>(op) != NULL || std::dynamic_pointer_cast<opmeshsize>(op) != NULL || std::dynamic_pointer_cast<oporientation>(op) != NULL || std::dynamic_pointer_cast<optime>(op) != NULL)
+        return true;
+    if (op->isdof() || op->istf() || std::dynamic_pointer_cast<opon>(op) != NULL || std::dynamic_pointer_cast<opcustom>(op) != NULL)
+        return false;
+    
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    if (arguments.size() == 0)
+        return false;
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        if (isrigidinvariant(arguments[i], disjregs, motion) == false)
+            return false;
+    }
+    return true;
+}
+
+std::vector<std::shared_ptr<operation>> contribution::flatten(std::shared_ptr<operation> op, bool issum)
+{
+    if ((issum && op->issum() == false) || (not(issum) && op->isproduct() == false))
+        return {op};
+    
+    std::vector<std::shared_ptr<operation>> output = {};
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        std::vector<std::shared_ptr<operation>> flattened = flatten(arguments[i], issum);
+        output.insert(output.end(), flattened.begin(), flattened.end());
+    }
+    return output;
+}
+
+int contribution::getrigidinvariance(std::shared_ptr<operation> coeff, std::vector<int>& disjregs)
+{
+    if (isrigidinvariant(coeff, disjregs, 1) == false)
+        return (isrigidinvariant(coeff, disjregs, 0) ? 0 : -1);
+    
+    // Split every summand in a constant, the invjac rows and the other factors:
+    std::vector<std::shared_ptr<operation>> summands = flatten(coeff, true);
+    std::vector<double> values = {};
+    std::vector<int> rows = {};
+    std::vector<std::vector<operation*>> others = {};
+    for (int i = 0; i < summands.size(); i++)
+    {
+        std::vector<std::shared_ptr<operation>> factors = flatten(summands[i], false);
+        
+        double value = 1.0;
+        std::vector<int> invjacrows = {};
+        std::vector<operation*> otherfactors = {};
+        for (int j = 0; j < factors.size(); j++)
+        {
+            double factorvalue;
+            std::shared_ptr<opinvjac> invjacop = std::dynamic_pointer_cast<opinvjac>(factors[j]);
+            if (isregionconstant(factors[j], disjregs, factorvalue))
+                value *= factorvalue;
+            else if (invjacop != NULL)
+                invjacrows.push_back(invjacop->getrow());
+            else if (isrigidinvariant(factors[j], disjregs, 2))
+                otherfactors.push_back(factors[j].get());
+            else
+                return 1;
+        }
+        if (invjacrows.size() == 0)
+            continue;
+        if (invjacrows.size() != 2 || invjacrows[0] != invjacrows[1])
+            return 1;
+        
+        std::sort(otherfactors.begin(), otherfactors.end());
+        values.push_back(value);
+        rows.push_back(invjacrows[0]);
+        others.push_back(otherfactors);
+    }
+    
+    // All summands with the same other factors must have the same constant and cover every row once:
+    int meshdim = universe::getrawmesh()->getmeshdimension();
+    std::vector<bool> isgrouped(rows.size(), false);
+    for (int i = 0; i < rows.size(); i++)
+    {
+        if (isgrouped[i])
+            continue;
+        
+        std::vector<int> rowcount(3, 0);
+        for (int j = i; j < rows.size(); j++)
+        {
+            if (isgrouped[j] || others[j] != others[i])
+                continue;
+            if (values[j] != values[i])
+                return 1;
+            isgrouped[j] = true;
+            rowcount[rows[j]]++;
+        }
+        for (int r = 0; r < 3; r++)
+        {
+            if (rowcount[r] != (r < meshdim ? 1 : 0))
+                return 1;
+        }
+    }
+    return 2;
+}
+
+double contribution::hoistconstantfactors(std::shared_ptr<operation>& coeff, std::vector<int>& disjregs)
+{
+    double scale = 1.0;
+    if (isregionconstant(coeff, disjregs, scale))
+    {
+        if (scale != 1.0)
+            coeff = std::shared_ptr<operation>(new opconstant(1.0));
+        return scale;
+    }
+    if (coeff->isproduct() == false)
+        return 1.0;
+
+    // The shared coefficient is not modified, a new product is created with the remaining factors:
+    std::vector<std::shared_ptr<operation>> factors = coeff->getarguments();
+    std::vector<std::shared_ptr<operation>> remaining = {};
+    for (int i = 0; i < factors.size(); i++)
+    {
+        double factorvalue;
+        if (isregionconstant(factors[i], disjregs, factorvalue))
+            scale *= factorvalue;
+        else
+            remaining.push_back(factors[i]);
+    }
+    if (remaining.size() == factors.size())
+        return 1.0;
+
+    if (remaining.size() == 1)
+        coeff = remaining[0];
+    else
+        coeff = std::shared_ptr<operation>(new opproduct(remaining));
+
+    return scale;
+}
+
+bool contribution::isthreadsafe(std::vector<int>& disjregs, expression* meshdeformationptr, bool isdofinterpolate)
+{
+    // The dof interpolation relies on the state of the element selector:
+    if (isdofinterpolate)
+        return false;
+        
+    if (meshdeformationptr != NULL && meshdeformationptr->isthreadsafe(disjregs) == false)
+        return false;
+        
+    for (int term = 0; term < mytermcoeffs.size(); term++)
+    {
+        if (mytermcoeffs[term]->isthreadsafe(disjregs) == false)
+            return false;
+    }
+    return true;
+}
+
+std::vector<std::vector<std::vector<densemat>>> contribution::computestiffnesses(elementselector& myselector, std::vector<double>& evaluationpoints, std::vector<double>& weights, hierarchicalformfunctioncontainer& tfval, hierarchicalformfunctioncontainer& dofval, int tfinterpolationorder, int dofinterpolationorder, dofinterpolate& mydofinterp, expression* meshdeformationptr, int& numtfformfunctions)
+{
+    bool isdofinterpolate = (doffield != NULL && mydofs[0]->ison());
+    
     std::vector<int> tfharms = tffield->getharmonics();
     int maxtfharm = *std::max_element(tfharms.begin(), tfharms.end());
     std::vector<int> dofharms = {1};
@@ -31,13 +318,801 @@ void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawma
         dofharms = doffield->getharmonics();
         maxdofharm = *std::max_element(dofharms.begin(), dofharms.end());   
     }
+
+    // stiffnesses[tf][dof][0] provides the stiffness matrix 
+    // for test function harmonic 'tf' and dof harmonic 'dof'. 
+    // If stiffnesses[tf][dof].size() is zero then it is empty.
+    // stiffnesses[tf][1][0] must be used in case there is no dof.
+    std::vector<std::vector<std::vector<densemat>>> stiffnesses(maxtfharm + 1, std::vector<std::vector<densemat>>(maxdofharm + 1, std::vector<densemat>(0)));
+
+    // Compute the Jacobian for the variable change to the reference element:
+    std::shared_ptr<jacobian> myjacobian;
+    {
+        profilescope scope("jacobian");
+        myjacobian = jacobiancache::get(myselector, evaluationpoints, meshdeformationptr);
+    }
+    densemat detjac = myjacobian->getdetjac();
+    // The Jacobian determinant should be positive irrespective of the node numbering:
+    detjac.abs();
+
+    // Evaluate in a dedicated context so that the reuse storage of the caller and of the other threads is untouched:
+    evaluationcontext mycontext;
+    evaluationcontext* previouscontext = universe::setcontext(&mycontext);
+
+    // Store it in the context for reuse:
+    mycontext.computedjacobian = myjacobian;
+    mycontext.allowreuse();
+    
+    // On straight simplices the element constant coefficients are evaluated at a single point and the dof*tf products
+    // are integrated once on the reference element. Every element matrix is then the reference matrix scaled by the
+    // coefficient and the Jacobian determinant of the element:
+    int elementtypenumber = myselector.getelementtypenumber();
+    bool isaffine = ((elementtypenumber == 1 || elementtypenumber == 2 || elementtypenumber == 4) && universe::getrawmesh()->getelements()->getcurvatureorder() == 1 && meshdeformationptr == NULL && universe::getsession()->isaxisymmetric == false && not(isbarycentereval) && not(isdofinterpolate) && evaluationpoints.size() > 3);
+    for (int term = 0; term < mytfs.size(); term++)
+        isaffine = (isaffine && mytermnumfftevals[term] < 0);
+    std::vector<double> affinepoint = {};
+    std::shared_ptr<jacobian> affinejacobian = NULL;
+    densemat affinedetjac;
+    for (int term = 0; term < mytfs.size() && isaffine; term++)
+    {
+        if (mytermelementconstants[term] && affinejacobian == NULL)
+        {
+            affinepoint = {evaluationpoints[0], evaluationpoints[1], evaluationpoints[2]};
+            affinejacobian = jacobiancache::get(myselector, affinepoint, meshdeformationptr);
+            affinedetjac = affinejacobian->getdetjac();
+            affinedetjac.abs();
+        }
+    }
+    
+    // The interior test function integrals of high order quadrangles and hexahedra are sum factorized when there is no dof (the stiffness blocks stay dense):
+    std::shared_ptr<sumfactorization> mysumfact = NULL;
+    if (doffield == NULL && not(isbarycentereval) && sumfactorization::isapplicable(tffield->gettypename(), myselector.getelementtypenumber(), tfinterpolationorder, 0))
+    {
+        mysumfact = std::shared_ptr<sumfactorization>(new sumfactorization(myselector.getelementtypenumber(), myselector.gettotalorientation(), tfinterpolationorder, evaluationpoints));
+        if (not(mysumfact->isvalid()))
+            mysumfact = NULL;
+    }
+    
+    // Compute all terms in the contribution sum:
+    densemat tfformfunctionvalue, dofformfunctionvalue;
+    for (int term = 0; term < mytfs.size(); term++)
+    {
+        ///// Compute the coefficients:
+        // currentcoeff[i][0] holds the ith harmonic of the coefficient. 
+        // It is empty if currentcoeff[i].size() is zero.
+        std::vector<std::vector<densemat>> currentcoeff;
+        bool isreferencescaled = (affinejacobian != NULL && mytermelementconstants[term] && mysumfact == NULL);
+        {
+            profilescope scope("coefficients");
+            // Compute without or with FFT:
+            if (isreferencescaled)
+            {
+                // The single point values cannot be mixed with the reuse storage of the Gauss point values:
+                evaluationcontext affinecontext;
+                universe::setcontext(&affinecontext);
+                affinecontext.computedjacobian = affinejacobian;
+                affinecontext.allowreuse();
+                currentcoeff = mytermcoeffs[term]->interpolate(myselector, affinepoint, meshdeformationptr);
+                universe::forbidreuse();
+                universe::setcontext(&mycontext);
+            }
+            else if (mytermnumfftevals[term] < 0)
+                currentcoeff = mytermcoeffs[term]->interpolate(myselector, evaluationpoints, meshdeformationptr);
+            else
+            {
+                densemat timeevalinterpolated = mytermcoeffs[term]->multiharmonicinterpolate(mytermnumfftevals[term], myselector, evaluationpoints, meshdeformationptr);
+                currentcoeff = fourier::fft(timeevalinterpolated, myselector.countinselection(), evaluationpoints.size()/3);
+                // The higher harmonics cannot reach a tf harmonic and are not aliasing free:
+                if (numfftcoeffs == 0 && currentcoeff.size() > 2*mymaxrelevantfrequency+2)
+                    currentcoeff.resize(2*mymaxrelevantfrequency+2);
+            }
+        }
+        
+        // The product phase lasts until the end of the term:
+        profilescope productscope("product");
+        
+        bool issumfactorized = (mysumfact != NULL && mytfs[term]->getformfunctioncomponent() == 0);
+        
+        ///// Compute the dof*tf product (if any dof):
+        densemat doftimestestfun;
+        tfformfunctionvalue = formfunctioncache::get(tfval, myselector.gettotalorientation(), tfinterpolationorder, mytfs[term]->getkietaphiderivative(), mytfs[term]->getformfunctioncomponent());
+        
+        // Multiply by the weights:
+        if (not(isbarycentereval))
+            tfformfunctionvalue.multiplycolumns(weights);
+        if (doffield != NULL)
+        {
+            if (isdofinterpolate)
+            {
+                // The dof*tf product is fused with the coefficient product below:
+                dofformfunctionvalue = mydofinterp.getvalues(myselector, term);
+            }
+            else
+            {
+                dofformfunctionvalue = formfunctioncache::get(dofval, myselector.gettotalorientation(), dofinterpolationorder, mydofs[term]->getkietaphiderivative(), mydofs[term]->getformfunctioncomponent());
+                doftimestestfun = tfformfunctionvalue.multiplyallrows(dofformfunctionvalue);
+            }
+        }
+        else
+            doftimestestfun = tfformfunctionvalue;
+        // Integrate the weighted products on the reference element:
+        if (isreferencescaled)
+            doftimestestfun = doftimestestfun.multiply(densemat(doftimestestfun.countcolumns(), 1, 1));
+
+        ///// Since the interpolation orders are identical for all harmonics
+        // we can premultiply all coefficients by the same dof*tf product.
+        // These products are queued and computed together in a single call.
+        std::vector<int> queuedharms = {};
+        std::vector<densemat> queuedcoeffs = {};
+        for (int h = 0; h < currentcoeff.size(); h++)
+        {
+            if (currentcoeff[h].size() > 0)
+            {
+                if (isreferencescaled)
+                    currentcoeff[h][0].multiplyelementwise(affinedetjac);
+                else if (not(isbarycentereval))
+                    currentcoeff[h][0].multiplyelementwise(detjac);
+                
+                if (issumfactorized)
+                {
+                    densemat interiorproduct = mysumfact->integrate(currentcoeff[h][0], weights, mytfs[term]->getkietaphiderivative());
+                    int numother = doftimestestfun.countrows()-mysumfact->countinterior();
+                    currentcoeff[h][0].transpose();
+                    if (numother > 0)
+                        currentcoeff[h][0] = densemat({doftimestestfun.extractrows(0, numother-1).multiply(currentcoeff[h][0]), interiorproduct});
+                    else
+                        currentcoeff[h][0] = interiorproduct;
+                    continue;
+                }
+                
+                currentcoeff[h][0].transpose();
+                
+                if (isdofinterpolate)
+                    currentcoeff[h][0] = dofformfunctionvalue.dofinterpoltimestf(tfformfunctionvalue, currentcoeff[h][0]);
+                else
+                {
+                    queuedharms.push_back(h);
+                    queuedcoeffs.push_back(currentcoeff[h][0]);
+                }
+            }
+        }
+        if (queuedcoeffs.size() > 0)
+        {
+            std::vector<densemat> products = doftimestestfun.multiply(queuedcoeffs);
+            for (int i = 0; i < queuedharms.size(); i++)
+                currentcoeff[queuedharms[i]][0] = products[i];
+        }
+        
+        ///// Check if there is a time derivative on a multiharmonic dof:
+        int multiharmonicdoftimederivativeorder = 0;
+        if (doffield != NULL && doffield->ismultiharmonic())
+            multiharmonicdoftimederivativeorder = mydofs[term]->gettimederivative();
+
+        ///// Add the term to the corresponding stiffness block:
+        std::vector<std::pair<int, double>> harmsofproduct;
+        for (int currentcoefharm = 0; currentcoefharm < currentcoeff.size(); currentcoefharm++)
+        {
+            if (currentcoeff[currentcoefharm].size() == 0)
+                continue;
+            
+            for (int dofharmindex = 0; dofharmindex < dofharms.size(); dofharmindex++)
+            {
+                int currentdofharm = dofharms[dofharmindex];
+                // Perform the product of the coefficient and the dof harmonic:
+                harmonic::getproduct(currentcoefharm, currentdofharm, multiharmonicdoftimederivativeorder, harmsofproduct);
+                // Loop on all product harmonics:
+                for (int p = 0; p < harmsofproduct.size(); p++)
+                {
+                    int currentharm = harmsofproduct[p].first;
+                    // currentharmcoef can be + or - 0.5 or 1 (+ the time derivation factor).
+                    // The hoisted constant factors of the coefficient are applied here as well.
+                    double currentharmcoef = harmsofproduct[p].second * mytermscales[term];
+                    
+                    // Skip if the product harmonic is not a tf harmonic:
+                    if (tffield->isharmonicincluded(currentharm) == false)
+                        continue;
+                    
+                    // Add the term to the stiffnesses:
+                    if (stiffnesses[currentharm][currentdofharm].size() == 0)
+                        stiffnesses[currentharm][currentdofharm] = {currentcoeff[currentcoefharm][0].getproduct(currentharmcoef)};
+                    else
+                        stiffnesses[currentharm][currentdofharm][0].addproduct(currentharmcoef, currentcoeff[currentcoefharm][0]);
+                }
+            }
+        }
+    }
+    // Clear all reused data:
+    universe::forbidreuse();
+    universe::setcontext(previouscontext);
+    
+    numtfformfunctions = tfformfunctionvalue.countrows();
+    
+    return stiffnesses;
+}
+
+void contribution::assemblestiffnesses(std::vector<std::vector<std::vector<densemat>>>& stiffnesses, elementselector& myselector, std::vector<int>& elementnumbers, int elementtypenumber, int tfinterpolationorder, int dofinterpolationorder, dofinterpolate& mydofinterp, int numtfformfunctions, std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat)
+{
+    profilescope scope("addresses");
+    
+    bool isdofinterpolate = (doffield != NULL && mydofs[0]->ison());
+    
+    std::vector<int> tfharms = tffield->getharmonics();
+    std::vector<int> dofharms = {1};
+    if (doffield != NULL)
+        dofharms = doffield->getharmonics();
+
+    // Get the addresses of all stiffnesses in the assembled matrix:
+    for (int htf = 0; htf < tfharms.size(); htf++)
+    {
+        int currenttfharm = tfharms[htf];
+
+        for (int hdof = 0; hdof < dofharms.size(); hdof++)
+        {
+            int currentdofharm = dofharms[hdof];
+            
+            if (stiffnesses[currenttfharm][currentdofharm].size() == 0)
+                continue;
+                
+            ///// Get the addresses corresponding to every form function of 
+            // the test function/dof field in the elements of 'elementlist':
+            indexmat testfunaddresses = mydofmanager->getaddresses(tffield->harmonic(currenttfharm), tfinterpolationorder, elementtypenumber, elementnumbers, tfphysreg);
+            indexmat dofaddresses;
+            if (doffield != NULL)
+            {
+                if (isdofinterpolate)
+                    dofaddresses = mydofinterp.getaddresses(myselector, currentdofharm);
+                else
+                    dofaddresses = mydofmanager->getaddresses(doffield->harmonic(currentdofharm), dofinterpolationorder, elementtypenumber, elementnumbers, dofphysreg);
+            }
+            
+            ///// Duplicate the tf and dof addresses as needed by the rawmat object:
+            if (doffield != NULL)
+            {
+                indexmat duplicateddofaddresses = dofaddresses;
+                if (isdofinterpolate)
+                    duplicateddofaddresses = dofaddresses.duplicateallcolstogether(numtfformfunctions);
+                    
+                indexmat duplicatedtestfunaddresses = testfunaddresses;
+                if (isdofinterpolate)
+                {
+                    duplicatedtestfunaddresses = testfunaddresses.gettranspose();
+                    duplicatedtestfunaddresses = duplicatedtestfunaddresses.duplicatecolsonebyone(dofaddresses.countcolumns());
+                }
+                
+                mymat->accumulate(duplicatedtestfunaddresses, duplicateddofaddresses, stiffnesses[currenttfharm][currentdofharm][0]);
+                
+                if (mycache->isrecording())
+                    mycache->add(duplicatedtestfunaddresses, duplicateddofaddresses, stiffnesses[currenttfharm][currentdofharm][0]);
+            }
+            else
+            {
+                // Bring back to the right hand side with a minus:
+                stiffnesses[currenttfharm][1][0].minus();
+                myvec->setvalues(testfunaddresses, stiffnesses[currenttfharm][1][0], "add");
+                
+                // Keep track of how the rhs was assembled if requested:
+                if (universe::getsession()->keeptrackofrhsassembly)
+                    universe::getsession()->rhsterms.push_back(std::make_pair(testfunaddresses, stiffnesses[currenttfharm][1][0]));
+                    
+                if (mycache->isrecording())
+                    mycache->add(testfunaddresses, stiffnesses[currenttfharm][1][0]);
+            }
+        }
+    }
+}
+
+void contribution::getintegrationrule(std::vector<int>& disjregs, int tfinterpolationorder, int dofinterpolationorder, int& integrationorder, std::string& rulefamily)
+{
+    int elementtypenumber = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(disjregs[0]);
+    
+    // Compute the integration order.
+    // Adding an extra +2 generally gives a good integration.
+    integrationorder = dofinterpolationorder + tfinterpolationorder + 2 + integrationorderdelta;
+    
+    rulefamily = myquadraturerule;
+    if (myquadraturerule == "auto")
+    {
+        // On straight simplices the Jacobian is constant and polynomial coefficients can be integrated exactly:
+        bool isstraightsimplex = (elementtypenumber == 1 || elementtypenumber == 2 || elementtypenumber == 4) && universe::getrawmesh()->getelements()->getcurvatureorder() == 1 && mymeshdeformation.size() == 0;
+        int coeffdegree = 0;
+        for (int term = 0; term < mycoeffs.size() && isstraightsimplex && coeffdegree >= 0; term++)
+        {
+            int termdegree = getpolynomialdegree(mycoeffs[term], disjregs);
+            coeffdegree = (termdegree < 0 ? -1 : std::max(coeffdegree, termdegree));
+        }
+        // Hcurl shape functions of order k have polynomial degree k+1:
+        std::shared_ptr<rawfield> dofpolyfield = (doffield != NULL ? doffield : tffield);
+        int hcurldegree = (tffield->gettypename() == "hcurl" ? 1 : 0) + (dofpolyfield->gettypename() == "hcurl" ? 1 : 0);
+        if (isstraightsimplex && coeffdegree >= 0 && numfftcoeffs < 0)
+            integrationorder = dofinterpolationorder + tfinterpolationorder + hcurldegree + coeffdegree + (universe::getsession()->isaxisymmetric ? 1 : 0) + integrationorderdelta;
+            
+        // Use the rule family with the fewest points:
+        int numdefault = gausspoints::count(elementtypenumber, std::max(integrationorder, 0), "default");
+        int numcollapsed = gausspoints::count(elementtypenumber, std::max(integrationorder, 0), "collapsed");
+        rulefamily = ((numdefault < 0 || numcollapsed < numdefault) ? "collapsed" : "default");
+    }
+    
+    if (isbarycentereval)
+    {
+        integrationorder = 0;
+        rulefamily = "default";
+    }
+    if (integrationorder < 0)
+    {
+        std::cout << "Error in 'contribution' object: trying to integrate at negative order " << integrationorder << std::endl;
+        abort();
+    }
+}
+
+void contribution::computerhstables(void)
+{
+    myrhstables->clear();
+    
+    std::vector<int> tfharms = tffield->getharmonics();
+    
+    std::vector<int> selectedelemdisjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+    
+    // Same grouping as in 'generate':
+    std::vector<int> tfinterpolorders(selectedelemdisjregs.size());
+    std::vector<int> dofinterpolorders(selectedelemdisjregs.size(),0);
+    for (int i = 0; i < selectedelemdisjregs.size(); i++)
+        tfinterpolorders[i] = tffield->getinterpolationorder(selectedelemdisjregs[i]);
+    
+    disjointregionselector mydisjregselector(selectedelemdisjregs, {tfinterpolorders, dofinterpolorders});
+    myrhstables->groups.resize(mydisjregselector.countgroups());
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+    {
+        rhsassemblygroup& group = myrhstables->groups[i];
+        group.disjregs = mydisjregselector.getgroup(i);
+        
+        int elementtypenumber = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(group.disjregs[0]);
+        int tfinterpolationorder = tffield->getinterpolationorder(group.disjregs[0]);
+        
+        int integrationorder;
+        std::string rulefamily;
+        getintegrationrule(group.disjregs, tfinterpolationorder, tfinterpolationorder, integrationorder, rulefamily);
+        
+        gausspoints mygausspoints(elementtypenumber, integrationorder, rulefamily);
+        group.evaluationpoints = mygausspoints.getcoordinates();
+        std::vector<double>& weights = mygausspoints.getweights();
+        
+        hierarchicalformfunctioncontainer tfval = *(universe::gethff(tffield->gettypename(), elementtypenumber, tfinterpolationorder, group.evaluationpoints));
+        
+        std::shared_ptr<hierarchicalformfunction> tfformfunction = selector::select(elementtypenumber, tffield->gettypename());
+        bool isorientationdependent = tfformfunction->isorientationdependent(tfinterpolationorder);
+        for (int term = 0; term < mytfs.size(); term++)
+            isorientationdependent = (isorientationdependent || mycoeffs[term]->simplify(group.disjregs)->isvalueorientationdependent(group.disjregs));
+        
+        elementselector myselector(group.disjregs, isorientationdependent);
+        do 
+        {
+            std::vector<int> elementnumbers = myselector.getelementnumbers();
+            
+            rhsassemblyblock block;
+            block.selector = std::shared_ptr<elementselector>(new elementselector(group.disjregs, elementnumbers, isorientationdependent));
+            block.jac = jacobiancache::get(*block.selector, group.evaluationpoints, NULL);
+            block.detjac = block.jac->getdetjac().copy();
+            // The Jacobian determinant should be positive irrespective of the node numbering:
+            block.detjac.abs();
+            
+            block.tfweighted.resize(mytfs.size());
+            for (int term = 0; term < mytfs.size(); term++)
+            {
+                block.tfweighted[term] = formfunctioncache::get(tfval, myselector.gettotalorientation(), tfinterpolationorder, mytfs[term]->getkietaphiderivative(), mytfs[term]->getformfunctioncomponent());
+                block.tfweighted[term].multiplycolumns(weights);
+            }
+            
+            block.tfaddresses.resize(tfharms.size());
+            for (int htf = 0; htf < tfharms.size(); htf++)
+                block.tfaddresses[htf] = mydofmanager->getaddresses(tffield->harmonic(tfharms[htf]), tfinterpolationorder, elementtypenumber, elementnumbers, tfphysreg);
+                
+            group.blocks.push_back(block);
+        }
+        while (myselector.next());
+    }
+    
+    myrhstables->setvalid(tffield->getstate(true), mydofmanager->countdofs());
+}
+
+void contribution::generatefromrhstables(std::shared_ptr<rawvec> myvec)
+{
+    if (myrhstables->isvalid(tffield->getstate(true), mydofmanager->countdofs()) == false)
+    {
+        profilescope scope("rhs tables");
+        computerhstables();
+    }
+    
+    std::vector<int> tfharms = tffield->getharmonics();
+    int maxtfharm = *std::max_element(tfharms.begin(), tfharms.end());
+    
+    for (int i = 0; i < myrhstables->groups.size(); i++)
+    {
+        rhsassemblygroup& group = myrhstables->groups[i];
+        
+        // The hoisted region constant factors change with the parameter values and are thus recomputed:
+        for (int term = 0; term < mytfs.size(); term++)
+            mycoeffs[term] = mycoeffs[term]->simplify(group.disjregs);
+        mytermcoeffs = mycoeffs;
+        mytermscales = std::vector<double>(mytfs.size(), 1.0);
+        for (int term = 0; term < mytfs.size(); term++)
+            mytermscales[term] = hoistconstantfactors(mytermcoeffs[term], group.disjregs);
+        subexpressions::share(mytermcoeffs);
+        for (int term = 0; term < mytfs.size(); term++)
+            mytermcoeffs[term] = opfused::fuse(mytermcoeffs[term], group.disjregs);
+        
+        for (int b = 0; b < group.blocks.size(); b++)
+        {
+            rhsassemblyblock& block = group.blocks[b];
+            
+            // stiffnesses[h] is the block of tf harmonic h (undefined if empty):
+            std::vector<densemat> stiffnesses(maxtfharm + 1);
+            {
+                profilescope scope("coefficients");
+                
+                evaluationcontext mycontext;
+                evaluationcontext* previouscontext = universe::setcontext(&mycontext);
+                mycontext.computedjacobian = block.jac;
+                mycontext.allowreuse();
+                
+                for (int term = 0; term < mytfs.size(); term++)
+                {
+                    std::vector<std::vector<densemat>> currentcoeff = mytermcoeffs[term]->interpolate(*block.selector, group.evaluationpoints, NULL);
+                    
+                    // The product of a coefficient harmonic with the constant dof harmonic is the coefficient harmonic itself:
+                    for (int h = 0; h < currentcoeff.size() && h <= maxtfharm; h++)
+                    {
+                        if (currentcoeff[h].size() == 0 || tffield->isharmonicincluded(h) == false)
+                            continue;
+                        
+                        currentcoeff[h][0].multiplyelementwise(block.detjac);
+                        currentcoeff[h][0].transpose();
+                        densemat product = block.tfweighted[term].multiply(currentcoeff[h][0]);
+                        
+                        // Bring back to the right hand side with a minus:
+                        if (stiffnesses[h].isdefined() == false)
+                            stiffnesses[h] = product.getproduct(-mytermscales[term]);
+                        else
+                            stiffnesses[h].addproduct(-mytermscales[term], product);
+                    }
+                }
+                
+                universe::forbidreuse();
+                universe::setcontext(previouscontext);
+            }
+            
+            profilescope scope("addresses");
+            for (int htf = 0; htf < tfharms.size(); htf++)
+            {
+                densemat& vals = stiffnesses[tfharms[htf]];
+                if (vals.isdefined() == false)
+                    continue;
+                
+                myvec->setvalues(block.tfaddresses[htf], vals, "add");
+                
+                // Keep track of how the rhs was assembled if requested:
+                if (universe::getsession()->keeptrackofrhsassembly)
+                    universe::getsession()->rhsterms.push_back(std::make_pair(block.tfaddresses[htf], vals));
+                    
+                if (mycache->isrecording())
+                    mycache->add(block.tfaddresses[htf], vals);
+            }
+        }
+    }
+}
+
+long long int contribution::getdependencystate(void)
+{
+    // Only the structure of the dof and tf fields matters:
+    long long int output = tffield->getstate(true);
+    if (doffield != NULL)
+        output = std::max(output, doffield->getstate(true));
+        
+    for (int term = 0; term < mycoeffs.size(); term++)
+        output = std::max(output, std::max(mycoeffs[term]->getstate(), std::max(mytfs[term]->getstate(), mydofs.size() > 0 ? mydofs[term]->getstate() : 0LL)));
+        
+    if (mymeshdeformation.size() == 1)
+    {
+        for (int i = 0; i < mymeshdeformation[0].countrows(); i++)
+            output = std::max(output, mymeshdeformation[0].getoperationinarray(i, 0)->getstate());
+    }
+    
+    return output;
+}
+
+// Append the printed operation followed by the value of every parameter it includes on each disjoint region:
+static void describe(std::shared_ptr<operation> op, std::vector<int>& disjregs, std::ostringstream& description, bool isprinted = true)
+{
+    if (isprinted)
+        op->print(description);
+    
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        for (int d = 0; d < disjregs.size(); d++)
+        {
+            description << "[";
+            describe(param->get(disjregs[d], op->getselectedrow(), op->getselectedcol()), disjregs, description);
+            description << "]";
+        }
+        return;
+    }
+    
+    std::vector<std::shared_ptr<operation>> args = op->getarguments();
+    for (int i = 0; i < args.size(); i++)
+        describe(args[i], disjregs, description, false);
+}
+
+std::string contribution::getdescription(void)
+{
+    std::ostringstream description;
+    description << integrationphysreg << " " << dofphysreg << " " << tfphysreg << " " << integrationorderdelta << " " << myquadraturerule << " " << numfftcoeffs << " " << isbarycentereval << " " << mymeshdeformation.size() << ";";
+    
+    // Print all values with all digits:
+    description.precision(17);
+    
+    std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+    for (int term = 0; term < mycoeffs.size(); term++)
+    {
+        if (mydofs.size() > 0)
+        {
+            mydofs[term]->print(description);
+            description << "*";
+        }
+        mytfs[term]->print(description);
+        description << "*";
+        describe(mycoeffs[term], disjregs, description);
+        description << ";";
+    }
+    
+    return description.str();
+}
+
+// True if the operation includes a field or a port (also through the parameter values on the disjoint regions):
+static bool isfieldvaluedependent(std::shared_ptr<operation> op, std::vector<int>& disjregs)
+{
+    if (op->isfield() || op->isport())
+        return true;
+    
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        for (int d = 0; d < disjregs.size(); d++)
+        {
+            if (isfieldvaluedependent(param->get(disjregs[d], op->getselectedrow(), op->getselectedcol()), disjregs))
+                return true;
+        }
+        return false;
+    }
+    
+    std::vector<std::shared_ptr<operation>> args = op->getarguments();
+    for (int i = 0; i < args.size(); i++)
+    {
+        if (isfieldvaluedependent(args[i], disjregs))
+            return true;
+    }
+    return false;
+}
+
+bool contribution::isfieldvaluedependent(void)
+{
+    // The dof field values only enter when the dof is interpolated on another mesh:
+    if ((doffield != NULL && mydofs[0]->ison()) || mymeshdeformation.size() > 0)
+        return true;
+    
+    std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+    for (int term = 0; term < mycoeffs.size(); term++)
+    {
+        if (::isfieldvaluedependent(mycoeffs[term], disjregs))
+            return true;
+    }
+    return false;
+}
+
+// True if the printed operation and the parameter values on the disjoint regions fully define its values:
+static bool isfullyprinted(std::shared_ptr<operation> op, std::vector<int>& disjregs)
+{
+    if (std::dynamic_pointer_cast<opcustom>(op) != NULL || std::dynamic_pointer_cast<opspline>(op) != NULL || std::dynamic_pointer_cast<opgausspointdata>(op) != NULL || std::dynamic_pointer_cast<opestimator>(op) != NULL || std::dynamic_pointer_cast<opfieldorder>(op) != NULL || std::dynamic_pointer_cast<opathp>(op) != NULL || std::dynamic_pointer_cast<optime>(op) != NULL)
+        return false;
+    
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        for (int d = 0; d < disjregs.size(); d++)
+        {
+            if (not(isfullyprinted(param->get(disjregs[d], op->getselectedrow(), op->getselectedcol()), disjregs)))
+                return false;
+        }
+        return true;
+    }
+    
+    std::vector<std::shared_ptr<operation>> args = op->getarguments();
+    for (int i = 0; i < args.size(); i++)
+    {
+        if (not(isfullyprinted(args[i], disjregs)))
+            return false;
+    }
+    return true;
+}
+
+bool contribution::isfullydescribed(void)
+{
+    if (isfieldvaluedependent())
+        return false;
+    
+    std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+    for (int term = 0; term < mycoeffs.size(); term++)
+    {
+        if (not(isfullyprinted(mycoeffs[term], disjregs)))
+            return false;
+    }
+    return true;
+}
+
+std::string contribution::getfingerprint(void)
+{
+    if (not(isfullydescribed()))
+        return "";
+    
+    std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+    
+    std::ostringstream fingerprint;
+    fingerprint << integrationphysreg << " " << dofphysreg << " " << tfphysreg << " " << integrationorderdelta << " " << myquadraturerule << " " << numfftcoeffs << " " << isbarycentereval << ";";
+    
+    // Unnamed fields all print the same. The fields are thus identified by the index of their harmonics in the dof structure:
+    std::vector<std::shared_ptr<rawfield>> fields = mydofmanager->getfields();
+    std::vector<std::shared_ptr<rawfield>> dofandtf = {doffield, tffield};
+    for (int i = 0; i < dofandtf.size(); i++)
+    {
+        if (dofandtf[i] == NULL)
+            continue;
+        std::vector<int> harms = dofandtf[i]->getharmonics();
+        for (int h = 0; h < harms.size(); h++)
+            fingerprint << harms[h] << ":" << (std::find(fields.begin(), fields.end(), dofandtf[i]->harmonic(harms[h])) - fields.begin()) << " ";
+        fingerprint << ";";
+    }
+    
+    // All values with all digits in a fixed format:
+    fingerprint << std::scientific;
+    fingerprint.precision(17);
+    
+    for (int term = 0; term < mycoeffs.size(); term++)
+    {
+        if (mydofs.size() > 0)
+        {
+            mydofs[term]->print(fingerprint);
+            fingerprint << "*";
+        }
+        mytfs[term]->print(fingerprint);
+        fingerprint << "*";
+        describe(mycoeffs[term], disjregs, fingerprint);
+        fingerprint << ";";
+    }
+    
+    return fingerprint.str();
+}
+
+// Get the fields (one per harmonic) in the operation, also through the parameter values on the disjoint regions, and their
+// interpolation order. Return false if the values of the operation cannot be followed through the field coefficients:
+static bool getcoefficientfields(std::shared_ptr<operation> op, std::vector<int>& disjregs, std::vector<std::shared_ptr<rawfield>>& fields, std::vector<int>& interpolorders)
+{
+    if (op->isport())
+        return false;
+    
+    if (op->isfield())
+    {
+        std::shared_ptr<rawfield> rf = op->getfieldpointer();
+        if (rf->countsubfields() > 0)
+            return false;
+        
+        std::vector<int> harms = rf->getharmonics();
+        for (int h = 0; h < harms.size(); h++)
+        {
+            std::shared_ptr<rawfield> harmfield = rf->harmonic(harms[h]);
+            if (std::find(fields.begin(), fields.end(), harmfield) != fields.end())
+                continue;
+            
+            // The coordinate fields have no interpolation order:
+            std::string tn = harmfield->gettypename();
+            int interpolorder = -1;
+            if (tn != "x" && tn != "y" && tn != "z")
+            {
+                interpolorder = harmfield->getinterpolationorder(disjregs[0]);
+                for (int d = 1; d < disjregs.size(); d++)
+                {
+                    if (harmfield->getinterpolationorder(disjregs[d]) != interpolorder)
+                        return false;
+                }
+            }
+            fields.push_back(harmfield);
+            interpolorders.push_back(interpolorder);
+        }
+        return true;
+    }
+    
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        for (int d = 0; d < disjregs.size(); d++)
+        {
+            if (not(getcoefficientfields(param->get(disjregs[d], op->getselectedrow(), op->getselectedcol()), disjregs, fields, interpolorders)))
+                return false;
+        }
+        return true;
+    }
+    
+    std::vector<std::shared_ptr<operation>> args = op->getarguments();
+    for (int i = 0; i < args.size(); i++)
+    {
+        if (not(getcoefficientfields(args[i], disjregs, fields, interpolorders)))
+            return false;
+    }
+    return true;
+}
+
+void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat, bool usecache, bool keeprigid, bool userhstables, double elementcachereltol)
+{   
+    profilescope scope("contribution");
+    
+    if (usecache == false)
+        mycache->clear();
+    else
+    {
+        if (mycache->isvalid(getdependencystate(), mydofmanager->countdofs(), keeprigid))
+        {
+            mycache->replay(myvec, mymat);
+            return;
+        }
+        mycache->record();
+    }
+    
+    if (userhstables == false)
+        myrhstables->clear();
+    else if (doffield == NULL && mymeshdeformation.size() == 0 && not(isbarycentereval) && numfftcoeffs < 0)
+    {
+        generatefromrhstables(myvec);
+        if (usecache)
+            mycache->endrecord(mydofmanager->countdofs(), -1, integrationphysreg);
+        return;
+    }
+
+    bool isdofinterpolate = (doffield != NULL && mydofs[0]->ison());
+
     // Get a pointer for the mesh deformation expression:
     expression* meshdeformationptr = NULL;
     if (mymeshdeformation.size() == 1)
         meshdeformationptr = &(mymeshdeformation[0]);
+    
+    // The untracked dependencies (e.g. the time) always give a state newer than the last one:
+    bool iselemcacheused = (elementcachereltol >= 0 && meshdeformationptr == NULL && not(isdofinterpolate) && getdependencystate() <= universe::laststate);
+    std::string elemcachedescription;
+    if (iselemcacheused)
+    {
+        elemcachedescription = getdescription();
+        if (not(myelemcache->isvalid(elemcachedescription, mydofmanager->countdofs())))
+            myelemcache->clear();
+    }
+    else
+        myelemcache->clear();
+        
+    // Highest rigid motion of the integration region under which the fragments stay valid:
+    int rigidinvariance = ((meshdeformationptr == NULL && not(isdofinterpolate)) ? 2 : -1);
         
     // The integration will be performed on the following disjoint regions:
     std::vector<int> selectedelemdisjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+    
+    // A coefficient harmonic of frequency f times a dof harmonic of frequency g gives frequencies f-g and f+g:
+    mymaxrelevantfrequency = 0;
+    std::vector<int> tfharmsforfft = tffield->getharmonics();
+    for (int h = 0; h < tfharmsforfft.size(); h++)
+        mymaxrelevantfrequency = std::max(mymaxrelevantfrequency, harmonic::getfrequency(tfharmsforfft[h]));
+    if (doffield != NULL)
+    {
+        std::vector<int> dofharmsforfft = doffield->getharmonics();
+        int maxdoffrequency = 0;
+        for (int h = 0; h < dofharmsforfft.size(); h++)
+            maxdoffrequency = std::max(maxdoffrequency, harmonic::getfrequency(dofharmsforfft[h]));
+        mymaxrelevantfrequency += maxdoffrequency;
+    }
   
     // Prepare to send the disjoint regions with same element type 
     // numbers and same dof and tf interpolation order together:
@@ -54,6 +1129,8 @@ void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawma
     
     // Group disj. regs. with same element types and same tf and dof interpolation order:
     disjointregionselector mydisjregselector(selectedelemdisjregs, {tfinterpolorders, dofinterpolorders});
+    if (iselemcacheused)
+        myelemcache->groups.resize(mydisjregselector.countgroups());
     for (int i = 0; i < mydisjregselector.countgroups(); i++)
     {
         std::vector<int> mydisjregs = mydisjregselector.getgroup(i);
@@ -66,26 +1143,18 @@ void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawma
         if (doffield != NULL)
             dofinterpolationorder = doffield->getinterpolationorder(mydisjregs[0]);
         
-        // Compute the integration order.
-        // Adding an extra +2 generally gives a good integration.
-        int integrationorder = dofinterpolationorder + tfinterpolationorder + 2 + integrationorderdelta;
-        if (isbarycentereval)
-            integrationorder = 0;
-        if (integrationorder < 0)
-        {
-            std::cout << "Error in 'contribution' object: trying to integrate at negative order " << integrationorder << std::endl;
-            abort();
-        }
+        int integrationorder;
+        std::string rulefamily;
+        getintegrationrule(mydisjregs, tfinterpolationorder, dofinterpolationorder, integrationorder, rulefamily);
             
         // Get the Gauss points and their weight:
-        gausspoints mygausspoints(elementtypenumber, integrationorder);
-        std::vector<double> evaluationpoints = mygausspoints.getcoordinates();
-        std::vector<double> weights = mygausspoints.getweights();        
+        gausspoints mygausspoints(elementtypenumber, integrationorder, rulefamily);
+        std::vector<double>& evaluationpoints = mygausspoints.getcoordinates();
+        std::vector<double>& weights = mygausspoints.getweights();        
             
         // Compute the dof and tf form functions evaluated at the evaluation points:
         std::shared_ptr<hierarchicalformfunction> tfformfunction = selector::select(elementtypenumber, tffield->gettypename());
         
-        // Copy needed here otherwise the pointed values will be overwritten by the dof:
         hierarchicalformfunctioncontainer tfval = *(universe::gethff(tffield->gettypename(), elementtypenumber, tfinterpolationorder, evaluationpoints));
         
         std::shared_ptr<hierarchicalformfunction> dofformfunction;
@@ -98,16 +1167,71 @@ void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawma
         }
         
         // Simplify all coeffs for faster computation later on.
+        // The region constant factors are then hoisted out of the coefficients (this does not modify 'mycoeffs'
+        // since the constants are only valid on these disjoint regions), the subexpressions shared by several
+        // terms are computed only once per element block and the remaining elementwise operations are fused.
         // Also check if orientation matters.
         bool isorientationdependent = tfformfunction->isorientationdependent(tfinterpolationorder);
         if (doffield != NULL)
             isorientationdependent = isorientationdependent || dofformfunction->isorientationdependent(dofinterpolationorder);
         for (int term = 0; term < mytfs.size(); term++)
-        {
             mycoeffs[term] = mycoeffs[term]->simplify(mydisjregs);
-            isorientationdependent = (isorientationdependent || mycoeffs[term]->isvalueorientationdependent(mydisjregs) || (meshdeformationptr != NULL && meshdeformationptr->isvalueorientationdependent(mydisjregs)));
+        // The form functions of hcurl fields are rotated with the element:
+        if (usecache && keeprigid && (tffield->gettypename() == "hcurl" || (doffield != NULL && doffield->gettypename() == "hcurl")))
+            rigidinvariance = std::min(rigidinvariance, 1);
+        for (int term = 0; term < mytfs.size() && usecache && keeprigid && rigidinvariance >= 0; term++)
+            rigidinvariance = std::min(rigidinvariance, getrigidinvariance(mycoeffs[term], mydisjregs));
+        mytermcoeffs = mycoeffs;
+        mytermscales = std::vector<double>(mytfs.size(), 1.0);
+        mytermelementconstants = std::vector<bool>(mytfs.size(), false);
+        mytermnumfftevals = std::vector<int>(mytfs.size(), numfftcoeffs);
+        for (int term = 0; term < mytfs.size(); term++)
+        {
+            mytermscales[term] = hoistconstantfactors(mytermcoeffs[term], mydisjregs);
+            mytermelementconstants[term] = iselementconstant(mytermcoeffs[term], mydisjregs);
+            // Coefficients without harmonic content are interpolated without FFT:
+            if (numfftcoeffs == 0)
+            {
+                int maxfrequency = harmonic::getmaxfrequency(mytermcoeffs[term], mydisjregs);
+                mytermnumfftevals[term] = (maxfrequency == 0 ? -1 : harmonic::getnumtimeevals(maxfrequency, mymaxrelevantfrequency));
+            }
+        }
+        subexpressions::share(mytermcoeffs);
+        for (int term = 0; term < mytfs.size(); term++)
+        {
+            mytermcoeffs[term] = opfused::fuse(mytermcoeffs[term], mydisjregs);
+            isorientationdependent = (isorientationdependent || mytermcoeffs[term]->isvalueorientationdependent(mydisjregs) || (meshdeformationptr != NULL && meshdeformationptr->isvalueorientationdependent(mydisjregs)));
+        }
+        
+        // Evaluate profiled copies of the coefficients if requested:
+        if (exprprofiler::isenabled())
+        {
+            std::vector<std::string> termnames(mytfs.size());
+            for (int term = 0; term < mytfs.size(); term++)
+            {
+                termnames[term] = "integral on region " + std::to_string(integrationphysreg) + ": " + exprprofiler::tostring(mycoeffs[term]);
+                if (doffield != NULL)
+                    termnames[term] += " * " + exprprofiler::tostring(mydofs[term]);
+                termnames[term] += " * " + exprprofiler::tostring(mytfs[term]);
+            }
+            exprprofiler::instrument(mytermcoeffs, termnames);
         }
         
+        bool ismultithreaded = (universe::ismultithreadedassemblyallowed && universe::getmaxnumthreads() > 1 && isthreadsafe(mydisjregs, meshdeformationptr, isdofinterpolate));
+        
+        // Number of form functions per element and of stiffness blocks (to bound the memory of the element blocks):
+        int numtfff = tfformfunction->count(tfinterpolationorder);
+        int numdofff = (doffield != NULL ? dofformfunction->count(dofinterpolationorder) : 1);
+        int numstiffnessblocks = tffield->getharmonics().size() * (doffield != NULL ? doffield->getharmonics().size() : 1);
+        
+        // Get the fields whose coefficient changes are followed by the element matrix cache:
+        std::vector<std::shared_ptr<rawfield>> coeffields = {};
+        std::vector<int> coeffieldorders = {};
+        bool iselemcachedgroup = iselemcacheused;
+        for (int term = 0; term < mytfs.size() && iselemcachedgroup; term++)
+            iselemcachedgroup = getcoefficientfields(mycoeffs[term], mydisjregs, coeffields, coeffieldorders);
+        int blockindex = 0;
+        
         // Loop on all total orientations (if required):
         elementselector myselector(mydisjregs, isorientationdependent);
         dofinterpolate mydofinterp;
@@ -116,177 +1240,182 @@ void contribution::generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawma
         do 
         {
             std::vector<int> elementnumbers = myselector.getelementnumbers();
-
-            // stiffnesses[tf][dof][0] provides the stiffness matrix 
-            // for test function harmonic 'tf' and dof harmonic 'dof'. 
-            // If stiffnesses[tf][dof].size() is zero then it is empty.
-            // stiffnesses[tf][1][0] must be used in case there is no dof.
-            std::vector<std::vector<std::vector<densemat>>> stiffnesses(maxtfharm + 1, std::vector<std::vector<densemat>>(maxdofharm + 1, std::vector<densemat>(0)));
-
-            // Compute the Jacobian for the variable change to the reference element:
-            std::shared_ptr<jacobian> myjacobian(new jacobian(myselector, evaluationpoints, meshdeformationptr));
-            densemat detjac = myjacobian->getdetjac();
-            // The Jacobian determinant should be positive irrespective of the node numbering:
-            detjac.abs();
-
-            // Store it in the universe for reuse:
-            universe::computedjacobian = myjacobian;
-            universe::allowreuse();
+            int numelems = elementnumbers.size();
             
-            // Compute all terms in the contribution sum:
-            densemat tfformfunctionvalue, dofformfunctionvalue;
-            for (int term = 0; term < mytfs.size(); term++)
+            int numthreadstouse = 1;
+            if (ismultithreaded)
+                numthreadstouse = std::min(numelems/minnumelemsperthread+1, universe::getmaxnumthreads()); // require a min num elements per thread
+            
+            if (iselemcachedgroup)
             {
-                ///// Compute the coefficients:
-                // currentcoeff[i][0] holds the ith harmonic of the coefficient. 
-                // It is empty if currentcoeff[i].size() is zero.
-                std::vector<std::vector<densemat>> currentcoeff;
-                // Compute without or with FFT:
-                if (numfftcoeffs <= 0)
-                    currentcoeff = mycoeffs[term]->interpolate(myselector, evaluationpoints, meshdeformationptr);
-                else
-                {
-                    densemat timeevalinterpolated = mycoeffs[term]->multiharmonicinterpolate(numfftcoeffs, myselector, evaluationpoints, meshdeformationptr);
-                    currentcoeff = fourier::fft(timeevalinterpolated, myselector.countinselection(), evaluationpoints.size()/3);
-                }
+                if (myelemcache->groups[i].size() <= blockindex)
+                    myelemcache->groups[i].resize(blockindex+1);
+                elementmatrixblock& block = myelemcache->groups[i][blockindex];
+                blockindex++;
                 
-                ///// Compute the dof*tf product (if any dof):
-                densemat doftimestestfun;
-                tfformfunctionvalue = tfval.tomatrix(myselector.gettotalorientation(), tfinterpolationorder, mytfs[term]->getkietaphiderivative(), mytfs[term]->getformfunctioncomponent());
+                std::vector<densemat> fieldcoefs(coeffields.size());
+                for (int f = 0; f < coeffields.size(); f++)
+                    fieldcoefs[f] = coeffields[f]->getcoefficients(elementtypenumber, coeffieldorders[f], elementnumbers);
+                std::vector<int> changed = elementmatrixcache::getchanged(block, elementnumbers, fieldcoefs, elementcachereltol);
                 
-                // Multiply by the weights:
-                if (not(isbarycentereval))
-                    tfformfunctionvalue.multiplycolumns(weights);
-                if (doffield != NULL)
+                // Only the changed elements are computed again (in chunks for the multithreading):
+                int numchanged = changed.size();
+                int numchunks = 1;
+                if (ismultithreaded)
+                    numchunks = std::min(numchanged/minnumelemsperthread+1, universe::getmaxnumthreads());
+                std::vector<std::vector<int>> chunkindexes(numchunks);
+                std::vector<std::vector<std::vector<std::vector<densemat>>>> chunkstiffnesses(numchunks);
+                std::vector<int> chunknumtfformfunctions(numchunks, 0);
+                
+                auto computechangedchunk = [&](int c)
                 {
-                    if (isdofinterpolate)
-                    {
-                        dofformfunctionvalue = mydofinterp.getvalues(myselector, term);
-                        doftimestestfun = dofformfunctionvalue.dofinterpoltimestf(tfformfunctionvalue);
-                    }
-                    else
-                    {
-                        dofformfunctionvalue = dofval.tomatrix(myselector.gettotalorientation(), dofinterpolationorder, mydofs[term]->getkietaphiderivative(), mydofs[term]->getformfunctioncomponent());
-                        doftimestestfun = tfformfunctionvalue.multiplyallrows(dofformfunctionvalue);
-                    }
-                }
-                else
-                    doftimestestfun = tfformfunctionvalue;
-
-                ///// Since the interpolation orders are identical for all harmonics
-                // we can premultiply all coefficients by the same dof*tf product.
-                for (int h = 0; h < currentcoeff.size(); h++)
+                    int chunkbegin = (long long int)c*numchanged/numchunks;
+                    int chunkend = (long long int)(c+1)*numchanged/numchunks;
+                    chunkindexes[c] = std::vector<int>(changed.begin()+chunkbegin, changed.begin()+chunkend);
+                    std::vector<int> changedelems(chunkindexes[c].size());
+                    for (int j = 0; j < changedelems.size(); j++)
+                        changedelems[j] = elementnumbers[chunkindexes[c][j]];
+                    
+                    elementselector changedselector(mydisjregs, changedelems, isorientationdependent);
+                    hierarchicalformfunctioncontainer tfvalcopy = tfval;
+                    hierarchicalformfunctioncontainer dofvalcopy = dofval;
+                    chunkstiffnesses[c] = computestiffnesses(changedselector, evaluationpoints, weights, tfvalcopy, dofvalcopy, tfinterpolationorder, dofinterpolationorder, mydofinterp, meshdeformationptr, chunknumtfformfunctions[c]);
+                };
+                if (numchanged > 0)
+                    taskscheduler::run(numchunks, computechangedchunk, true, numchunks);
+                
+                for (int c = 0; c < numchunks && numchanged > 0; c++)
                 {
-                    if (currentcoeff[h].size() > 0)
-                    {
-                        if (not(isbarycentereval))
-                            currentcoeff[h][0].multiplyelementwise(detjac);
-                        currentcoeff[h][0].transpose();
-                        
-                        if (isdofinterpolate)
-                        {
-                            densemat dttf = doftimestestfun.copy();
-                            dttf.multiplycolumns(currentcoeff[h][0]);
-                            currentcoeff[h][0] = dttf;  
-                        }
-                        else
-                            currentcoeff[h][0] = doftimestestfun.multiply(currentcoeff[h][0]);
-                    }
+                    elementmatrixcache::update(block, chunkindexes[c], chunkstiffnesses[c], chunknumtfformfunctions[c]);
+                    chunkstiffnesses[c] = {};
                 }
                 
-                ///// Check if there is a time derivative on a multiharmonic dof:
-                int multiharmonicdoftimederivativeorder = 0;
-                if (doffield != NULL && doffield->ismultiharmonic())
-                    multiharmonicdoftimederivativeorder = mydofs[term]->gettimederivative();
+                std::vector<std::vector<std::vector<densemat>>> stiffnesses = elementmatrixcache::getstiffnesses(block);
+                assemblestiffnesses(stiffnesses, myselector, elementnumbers, elementtypenumber, tfinterpolationorder, dofinterpolationorder, mydofinterp, block.numtfformfunctions, myvec, mymat);
+                continue;
+            }
 
-                ///// Add the term to the corresponding stiffness block:
-                for (int currentcoefharm = 0; currentcoefharm < currentcoeff.size(); currentcoefharm++)
+            // Number of elements per tile for the element blocks computed at the same time to fit in the tile memory.
+            // The dof interpolation relies on the state of 'myselector' and cannot be tiled:
+            int tilesize = numelems;
+            if (not(isdofinterpolate) && universe::maxassemblytilememory > 0)
+            {
+                long long int numelementbytes = 8 * ((long long int)numtfff * numdofff * (numstiffnessblocks + 1) + evaluationpoints.size()/3);
+                tilesize = std::max(1LL, std::min((long long int)numelems, universe::maxassemblytilememory/numthreadstouse/numelementbytes));
+            }
+
+            if (numthreadstouse == 1 && tilesize == numelems)
+            {
+                int numtfformfunctions;
+                std::vector<std::vector<std::vector<densemat>>> stiffnesses = computestiffnesses(myselector, evaluationpoints, weights, tfval, dofval, tfinterpolationorder, dofinterpolationorder, mydofinterp, meshdeformationptr, numtfformfunctions);
+                
+                assemblestiffnesses(stiffnesses, myselector, elementnumbers, elementtypenumber, tfinterpolationorder, dofinterpolationorder, mydofinterp, numtfformfunctions, myvec, mymat);
+                continue;
+            }
+            
+            // Split the elements in chunks. Having more chunks than threads balances the load:
+            int numchunks = std::max(std::min(4*numthreadstouse, numelems), (numelems+tilesize-1)/tilesize);
+            // Without tiling all chunks are computed before the assembly. Otherwise each thread holds a single tile at a time:
+            int wavesize = (tilesize == numelems ? numchunks : numthreadstouse);
+            std::vector<std::vector<int>> chunkelems(numchunks);
+            std::vector<std::shared_ptr<elementselector>> chunkselectors(numchunks, NULL);
+            std::vector<std::vector<std::vector<std::vector<densemat>>>> chunkstiffnesses(numchunks);
+            std::vector<int> chunknumtfformfunctions(numchunks, 0);
+            
+            for (int c = 0; c < numchunks; c++)
+            {
+                int chunkbegin = (long long int)c*numelems/numchunks;
+                int chunkend = (long long int)(c+1)*numelems/numchunks;
+                chunkelems[c] = std::vector<int>(elementnumbers.begin()+chunkbegin, elementnumbers.begin()+chunkend);
+            }
+            
+            auto computechunk = [&](int c)
+            {
+                chunkselectors[c] = std::shared_ptr<elementselector>(new elementselector(mydisjregs, chunkelems[c], isorientationdependent));
+                // Each thread works on its own copy of the form function values:
+                hierarchicalformfunctioncontainer tfvalcopy = tfval;
+                hierarchicalformfunctioncontainer dofvalcopy = dofval;
+                chunkstiffnesses[c] = computestiffnesses(*chunkselectors[c], evaluationpoints, weights, tfvalcopy, dofvalcopy, tfinterpolationorder, dofinterpolationorder, mydofinterp, meshdeformationptr, chunknumtfformfunctions[c]);
+            };
+            
+            for (int wavebegin = 0; wavebegin < numchunks; wavebegin += wavesize)
+            {
+                int waveend = std::min(wavebegin+wavesize, numchunks);
+                
+                // The first chunk is computed on this thread so that all lazy 
+                // synchronizations (e.g. after hp-adaptivity) happen before the
+                // other threads start:
+                taskscheduler::run(waveend-wavebegin, [&](int i){ computechunk(wavebegin+i); }, wavebegin == 0, numthreadstouse);
+                
+                // Assemble in the chunk order for a result independent of the thread scheduling:
+                for (int c = wavebegin; c < waveend; c++)
                 {
-                    if (currentcoeff[currentcoefharm].size() == 0)
-                        continue;
-                    
-                    for (int dofharmindex = 0; dofharmindex < dofharms.size(); dofharmindex++)
-                    {
-                        int currentdofharm = dofharms[dofharmindex];
-                        // Perform the product of the coefficient and the dof harmonic:
-                        std::vector<std::pair<int, double>> harmsofproduct = harmonic::getproduct(currentcoefharm, currentdofharm, multiharmonicdoftimederivativeorder);
-                        // Loop on all product harmonics:
-                        for (int p = 0; p < harmsofproduct.size(); p++)
-                        {
-                            int currentharm = harmsofproduct[p].first;
-                            // currentharmcoef can be + or - 0.5 or 1 (+ the time derivation factor).
-                            double currentharmcoef = harmsofproduct[p].second;
-                            
-                            // Skip if the product harmonic is not a tf harmonic:
-                            if (tffield->isharmonicincluded(currentharm) == false)
-                                continue;
-                            
-                            // Add the term to the stiffnesses:
-                            if (stiffnesses[currentharm][currentdofharm].size() == 0)
-                                stiffnesses[currentharm][currentdofharm] = {currentcoeff[currentcoefharm][0].getproduct(currentharmcoef)};
-                            else
-                                stiffnesses[currentharm][currentdofharm][0].addproduct(currentharmcoef, currentcoeff[currentcoefharm][0]);
-                        }
-                    }
+                    assemblestiffnesses(chunkstiffnesses[c], *chunkselectors[c], chunkelems[c], elementtypenumber, tfinterpolationorder, dofinterpolationorder, mydofinterp, chunknumtfformfunctions[c], myvec, mymat);
+                    // Free the memory as soon as possible:
+                    chunkstiffnesses[c] = {};
+                    chunkselectors[c] = NULL;
                 }
             }
-            // Clear all reused data from the universe:
-            universe::forbidreuse();
+        }
+        while (myselector.next());        
+    }
+    
+    if (usecache)
+        mycache->endrecord(mydofmanager->countdofs(), rigidinvariance, integrationphysreg);
+    if (iselemcacheused)
+        myelemcache->setvalid(elemcachedescription, mydofmanager->countdofs());
+}
+
+bool contribution::generatepattern(std::shared_ptr<rawmat> mymat)
+{
+    if (doffield == NULL)
+        return true;
+    if (mydofs[0]->ison())
+        return false;
+        
+    std::vector<int> tfharms = tffield->getharmonics();
+    std::vector<int> dofharms = doffield->getharmonics();
+        
+    std::vector<int> selectedelemdisjregs = ((universe::getrawmesh()->getphysicalregions())->get(integrationphysreg))->getdisjointregions();
+  
+    // Same grouping as in 'generate':
+    std::vector<int> tfinterpolorders(selectedelemdisjregs.size());
+    std::vector<int> dofinterpolorders(selectedelemdisjregs.size());
+    for (int i = 0; i < selectedelemdisjregs.size(); i++)
+    {
+        tfinterpolorders[i] = tffield->getinterpolationorder(selectedelemdisjregs[i]);
+        dofinterpolorders[i] = doffield->getinterpolationorder(selectedelemdisjregs[i]);
+    }
+    
+    disjointregionselector mydisjregselector(selectedelemdisjregs, {tfinterpolorders, dofinterpolorders});
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+    {
+        std::vector<int> mydisjregs = mydisjregselector.getgroup(i);
+        
+        int elementtypenumber = (universe::getrawmesh()->getdisjointregions())->getelementtypenumber(mydisjregs[0]);        
+        int tfinterpolationorder = tffield->getinterpolationorder(mydisjregs[0]);
+        int dofinterpolationorder = doffield->getinterpolationorder(mydisjregs[0]);
+        
+        // The addresses do not depend on the orientation:
+        elementselector myselector(mydisjregs, false);
+        do 
+        {
+            std::vector<int> elementnumbers = myselector.getelementnumbers();
             
-            // Get the addresses of all stiffnesses in the assembled matrix:
             for (int htf = 0; htf < tfharms.size(); htf++)
             {
-                int currenttfharm = tfharms[htf];
-
+                indexmat testfunaddresses = mydofmanager->getaddresses(tffield->harmonic(tfharms[htf]), tfinterpolationorder, elementtypenumber, elementnumbers, tfphysreg);
+                
                 for (int hdof = 0; hdof < dofharms.size(); hdof++)
                 {
-                    int currentdofharm = dofharms[hdof];
+                    indexmat dofaddresses = mydofmanager->getaddresses(doffield->harmonic(dofharms[hdof]), dofinterpolationorder, elementtypenumber, elementnumbers, dofphysreg);
                     
-                    if (stiffnesses[currenttfharm][currentdofharm].size() == 0)
-                        continue;
-                        
-                    ///// Get the addresses corresponding to every form function of 
-                    // the test function/dof field in the elements of 'elementlist':
-                    indexmat testfunaddresses = mydofmanager->getaddresses(tffield->harmonic(currenttfharm), tfinterpolationorder, elementtypenumber, elementnumbers, tfphysreg);
-                    indexmat dofaddresses;
-                    if (doffield != NULL)
-                    {
-                        if (isdofinterpolate)
-                            dofaddresses = mydofinterp.getaddresses(myselector, currentdofharm);
-                        else
-                            dofaddresses = mydofmanager->getaddresses(doffield->harmonic(currentdofharm), dofinterpolationorder, elementtypenumber, elementnumbers, dofphysreg);
-                    }
-                    
-                    ///// Duplicate the tf and dof addresses as needed by the rawmat object:
-                    if (doffield != NULL)
-                    {
-                        indexmat duplicateddofaddresses = dofaddresses;
-                        if (isdofinterpolate)
-                            duplicateddofaddresses = dofaddresses.duplicateallcolstogether(tfformfunctionvalue.countrows());
-                            
-                        indexmat duplicatedtestfunaddresses = testfunaddresses;
-                        if (isdofinterpolate)
-                        {
-                            duplicatedtestfunaddresses = testfunaddresses.gettranspose();
-                            duplicatedtestfunaddresses = duplicatedtestfunaddresses.duplicatecolsonebyone(dofaddresses.countcolumns());
-                        }
-                        
-                        mymat->accumulate(duplicatedtestfunaddresses, duplicateddofaddresses, stiffnesses[currenttfharm][currentdofharm][0]);
-                    }
-                    else
-                    {
-                        // Bring back to the right hand side with a minus:
-                        stiffnesses[currenttfharm][1][0].minus();
-                        myvec->setvalues(testfunaddresses, stiffnesses[currenttfharm][1][0], "add");
-                        
-                        // Keep track of how the rhs was assembled if requested:
-                        if (universe::keeptrackofrhsassembly)
-                            universe::rhsterms.push_back(std::make_pair(testfunaddresses, stiffnesses[currenttfharm][1][0]));
-                    }
+                    mymat->accumulate(testfunaddresses, dofaddresses, densemat(testfunaddresses.countrows()*dofaddresses.countrows(), elementnumbers.size(), 0.0));
                 }
             }
         }
-        while (myselector.next());        
+        while (myselector.next());
     }
-}
     
+    return true;
+}
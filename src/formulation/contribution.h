@@ -18,11 +18,16 @@
 #include "rawfield.h"
 #include "universe.h"
 #include "jacobian.h"
+#include "jacobiancache.h"
+#include "formfunctioncache.h"
+#include "exprprofiler.h"
+#include "sumfactorization.h"
 #include "gausspoints.h"
 #include "elementselector.h"
 #include "disjointregions.h"
 #include "disjointregionselector.h"
 #include "expression.h"
+#include "subexpressions.h"
 #include "harmonic.h"
 #include "fourier.h"
 #include "selector.h"
@@ -30,12 +35,23 @@
 #include "rawvec.h"
 #include "rawmat.h"
 #include "wallclock.h"
+#include "contributioncache.h"
+#include "rhsassemblycache.h"
+#include "elementmatrixcache.h"
 #include "operation.h"
+#include <thread>
+#include <atomic>
+#include "profiler.h"
+#include "taskscheduler.h"
 
 class rawvec;
 class rawmat;
 class operation;
 class rawfield;
+class dofinterpolate;
+class contributioncache;
+class rhsassemblycache;
+class elementmatrixcache;
 
 class contribution
 {
@@ -49,6 +65,15 @@ class contribution
         std::vector<std::shared_ptr<operation>> mytfs = {};
         std::vector<std::shared_ptr<operation>> mycoeffs = {};
         
+        // Coefficients actually interpolated on the current disjoint regions and the factor by which every term
+        // is scaled (the region constant factors of the coefficients are hoisted out of the Gauss point products):
+        std::vector<std::shared_ptr<operation>> mytermcoeffs = {};
+        std::vector<double> mytermscales = {};
+        // True for the terms whose coefficient is constant over each straight simplex:
+        std::vector<bool> mytermelementconstants = {};
+        // Number of time evaluations for the FFT of every term coefficient (negative for no FFT):
+        std::vector<int> mytermnumfftevals = {};
+        
         // The dof and tf field for all terms above. A NULL dof means rhs contribution:
         std::shared_ptr<rawfield> doffield = NULL;
         std::shared_ptr<rawfield> tffield = NULL;
@@ -58,8 +83,13 @@ class contribution
         int tfphysreg = -1;
         
         int integrationorderdelta = 0;
-        // Number of time evaluations for the FFT of the coef. Negative means no FFT.
+        // Integration rule family ("default", "collapsed" or "auto"):
+        std::string myquadraturerule = "default";
+        // Number of time evaluations for the FFT of the coef. Negative means no FFT and 0 means
+        // that it is derived from the harmonic content of every coefficient.
         int numfftcoeffs = -1;
+        // Highest coefficient frequency that can contribute to a tf harmonic:
+        int mymaxrelevantfrequency = 0;
         
         // Barycenter evaluation mode during rhs term assembly:
         bool isbarycentereval = false;
@@ -71,11 +101,76 @@ class contribution
         std::vector<indexmat> fragmentrowadresses = {};
         std::vector<indexmat> fragmentcoladresses = {};
         std::vector<densemat> fragmentvalues = {};
+        
+        // The last generated fragments (shared by all copies of this contribution):
+        std::shared_ptr<contributioncache> mycache = NULL;
+        // The geometric tables of the rhs assembly (shared by all copies of this contribution):
+        std::shared_ptr<rhsassemblycache> myrhstables = NULL;
+        // The element matrices and the field coefficients they were computed with (shared by all copies of this contribution):
+        std::shared_ptr<elementmatrixcache> myelemcache = NULL;
+        
+        // Minimum number of elements per thread for a multithreaded element block computation:
+        int minnumelemsperthread = 500;
+        
+        // True if the simplified operation has the same constant value on all disjoint regions (a parameter can be
+        // constant on every region it is defined on). Only constants, parameters, sums, products, powers and inversions
+        // are considered.
+        static bool isregionconstant(std::shared_ptr<operation> op, std::vector<int>& disjregs, double& value);
+        // Remove the region constant factors of the coefficient and return their product:
+        static double hoistconstantfactors(std::shared_ptr<operation>& coeff, std::vector<int>& disjregs);
+        
+        // Polynomial degree of the coefficient on straight elements of the disjoint regions (-1 if not polynomial).
+        // Only constants, parameters constant on every region, fields, sums, products and integer powers are considered.
+        static int getpolynomialdegree(std::shared_ptr<operation> op, std::vector<int>& disjregs);
+        
+        // True if the simplified operation is constant over each straight simplex without mesh deformation.
+        // Only region constants, Jacobian terms, sums, products, powers and inversions are considered.
+        static bool iselementconstant(std::shared_ptr<operation> op, std::vector<int>& disjregs);
+        
+        // True if the values of the operation on an element are unchanged when the element is moved by 'motion'
+        // (0 for none, 1 for a translation and 2 for a rotation). Operations evaluated elsewhere are never invariant.
+        static bool isrigidinvariant(std::shared_ptr<operation> op, std::vector<int>& disjregs, int motion);
+        // Highest motion under which the term matrices of the simplified coefficient are unchanged (-1 if none). Under a
+        // rotation the invjac terms must only appear as sum_a invjac(a,i)*invjac(a,j) times the same factor (isotropic terms):
+        static int getrigidinvariance(std::shared_ptr<operation> coeff, std::vector<int>& disjregs);
+        // Get the terms of nested sums (or the factors of nested products):
+        static std::vector<std::shared_ptr<operation>> flatten(std::shared_ptr<operation> op, bool issum);
+        
+        // Get the integration order and rule family on the disjoint regions:
+        void getintegrationrule(std::vector<int>& disjregs, int tfinterpolationorder, int dofinterpolationorder, int& integrationorder, std::string& rulefamily);
+        
+        // Compute the geometric tables of this rhs contribution and assemble it by only evaluating the coefficients on them:
+        void computerhstables(void);
+        void generatefromrhstables(std::shared_ptr<rawvec> myvec);
+        
+        // True if the element blocks on the disjoint regions can be computed by multiple threads at the same time:
+        bool isthreadsafe(std::vector<int>& disjregs, expression* meshdeformationptr, bool isdofinterpolate);
+        
+        // Compute the stiffnesses of all terms on the elements currently selected in 'myselector'.
+        // The number of test function form functions is also returned (needed to duplicate the interpolated dof addresses).
+        std::vector<std::vector<std::vector<densemat>>> computestiffnesses(elementselector& myselector, std::vector<double>& evaluationpoints, std::vector<double>& weights, hierarchicalformfunctioncontainer& tfval, hierarchicalformfunctioncontainer& dofval, int tfinterpolationorder, int dofinterpolationorder, dofinterpolate& mydofinterp, expression* meshdeformationptr, int& numtfformfunctions);
+        // Add the stiffnesses to the matrix (or to the vector for rhs contributions). This is not thread safe.
+        void assemblestiffnesses(std::vector<std::vector<std::vector<densemat>>>& stiffnesses, elementselector& myselector, std::vector<int>& elementnumbers, int elementtypenumber, int tfinterpolationorder, int dofinterpolationorder, dofinterpolate& mydofinterp, int numtfformfunctions, std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat);
 
     public:
     
         contribution(std::shared_ptr<dofmanager> dofmngr);
         
+        // Get the state of the last modification of the data on which the generated fragments depend:
+        long long int getdependencystate(void);
+        // Description of the terms, regions and integration settings. The coefficients are printed after their
+        // simplification on every disjoint region (the parameter values appear) but the field values are not included:
+        std::string getdescription(void);
+        // True if the values generated depend on the value of a field or port (false for example for a time-dependent source):
+        bool isfieldvaluedependent(void);
+        // True if the description fully defines the values generated (false if they also depend on field or port
+        // values, on the time, on custom functions, on splines, on data stored at the Gauss points, ...):
+        bool isfullydescribed(void);
+        // Description of the terms for the on-disk matrix cache (see 'formulation::getfingerprint'). The dof and tf fields are
+        // identified by their index in the dof structure and the values are written with all digits. Empty if the values
+        // generated depend on what the description cannot include (field or port values, time, custom functions, splines, ...):
+        std::string getfingerprint(void);
+        
         void setdofs(std::vector<std::shared_ptr<operation>> dofs);
         void settfs(std::vector<std::shared_ptr<operation>> tfs);
         void setcoeffs(std::vector<std::shared_ptr<operation>> coeffs);
@@ -86,12 +181,27 @@ class contribution
         void setdofphysicalregion(int physreg);
         void settfphysicalregion(int physreg);
         void setintegrationorderdelta(int integrorderdelta);
+        void setquadraturerule(std::string rule);
         void setnumfftcoeffs(int numcoeffs);
         void setbarycenterevalflag(void);
         
         // Generate the contribution and store it in the 
-        // vec (for rhs contributions) or in the mat.
-        void generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat);
+        // vec (for rhs contributions) or in the mat. With 'usecache' 
+        // the fragments of the previous call are reused if none of
+        // the fields, parameters or mesh involved has changed since. With 'keeprigid'
+        // they are also reused after the shifts and rotations of the integration region
+        // as a whole under which all terms are invariant. With 'userhstables' a rhs contribution keeps its Gauss points,
+        // Jacobians, weighted test functions and addresses while the mesh is unchanged (no mesh deformation, barycenter
+        // evaluation or FFT). Only the coefficients are then evaluated and scattered at every call. With a nonnegative
+        // 'elementcachereltol' the element matrices are kept and only the elements for which the coefficients of a field in the
+        // contribution coefficients have changed by more than that relative tolerance are computed again. This requires all other
+        // dependencies to be tracked and unchanged (no time dependency, no port, same parameter values) and no mesh deformation.
+        void generate(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat, bool usecache = false, bool keeprigid = false, bool userhstables = false, double elementcachereltol = -1);
+        
+        // Accumulate in the mat zero fragments at all matrix entries the contribution can generate (for all tf and dof harmonic
+        // pairs) without computing any value. This gives the sparsity pattern before the actual generation. Return false
+        // if the pattern cannot be known in advance (dof field interpolated on another mesh):
+        bool generatepattern(std::shared_ptr<rawmat> mymat);
                                             
 };
 
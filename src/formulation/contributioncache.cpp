@@ -0,0 +1,89 @@
+#include "contributioncache.h"
+
+
+void contributioncache::clear(void)
+{
+    isitvalid = false;
+    isitrecording = false;
+    
+    myrowadresses = {};
+    mycoladresses = {};
+    myvals = {};
+}
+
+bool contributioncache::isvalid(long long int dependencystate, long long int numdofs, bool keeprigid)
+{
+    if (isitvalid == false || dependencystate > mystate || numdofs != mynumdofs)
+        return false;
+        
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    
+    if (rm->getmeshnumber() != mymeshnumber || universe::getsession()->fundamentalfrequency != myfundamentalfrequency)
+        return false;
+    if (rm->getstate() == mymeshstate)
+        return true;
+    if (keeprigid == false || myrigidinvariance < 0)
+        return false;
+    
+    int motion = rm->getrigidmotion(mymeshstate, myrigidphysreg);
+    if (motion < 0 || motion > myrigidinvariance)
+        return false;
+    
+    // The fragments are valid on the moved mesh as well:
+    mymeshstate = rm->getstate();
+    return true;
+}
+
+void contributioncache::record(void)
+{
+    clear();
+    isitrecording = true;
+}
+
+void contributioncache::add(indexmat rowadresses, indexmat coladresses, densemat vals)
+{
+    myrowadresses.push_back(rowadresses);
+    mycoladresses.push_back(coladresses);
+    myvals.push_back(vals);
+}
+
+void contributioncache::add(indexmat adresses, densemat vals)
+{
+    myrowadresses.push_back(adresses);
+    mycoladresses.push_back(indexmat());
+    myvals.push_back(vals);
+}
+
+void contributioncache::endrecord(long long int numdofs, int rigidinvariance, int rigidphysreg)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+
+    // All modifications made during the generation are included:
+    mystate = universe::laststate;
+    mynumdofs = numdofs;
+    mymeshnumber = rm->getmeshnumber();
+    mymeshstate = rm->getstate();
+    myfundamentalfrequency = universe::getsession()->fundamentalfrequency;
+    myrigidinvariance = rigidinvariance;
+    myrigidphysreg = rigidphysreg;
+    
+    isitrecording = false;
+    isitvalid = true;
+}
+
+void contributioncache::replay(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat)
+{
+    for (int i = 0; i < myvals.size(); i++)
+    {
+        if (mymat != NULL)
+            mymat->accumulate(myrowadresses[i], mycoladresses[i], myvals[i]);
+        else
+        {
+            myvec->setvalues(myrowadresses[i], myvals[i], "add");
+            
+            // Keep track of how the rhs was assembled if requested:
+            if (universe::getsession()->keeptrackofrhsassembly)
+                universe::getsession()->rhsterms.push_back(std::make_pair(myrowadresses[i], myvals[i]));
+        }
+    }
+}
@@ -0,0 +1,71 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object stores the fragments generated by a contribution. They can be
+// added again to the matrix or vector as long as none of the dependencies of 
+// the contribution has been modified since the fragments were generated.
+
+
+#ifndef CONTRIBUTIONCACHE_H
+#define CONTRIBUTIONCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "indexmat.h"
+#include "densemat.h"
+#include "universe.h"
+#include "rawvec.h"
+#include "rawmat.h"
+
+class rawvec;
+class rawmat;
+
+class contributioncache
+{
+    private:
+        
+        bool isitvalid = false;
+        bool isitrecording = false;
+        
+        // Conditions under which the fragments were generated:
+        long long int mystate = -1;
+        long long int mynumdofs = -1;
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+        double myfundamentalfrequency = -1;
+        // Highest rigid motion of the region under which the fragments stay valid (see 'rawmesh::getrigidmotion'):
+        int myrigidinvariance = -1;
+        int myrigidphysreg = -1;
+        
+        // Column addresses are empty for vector fragments:
+        std::vector<indexmat> myrowadresses = {};
+        std::vector<indexmat> mycoladresses = {};
+        std::vector<densemat> myvals = {};
+        
+    public:
+        
+        // Forget all fragments:
+        void clear(void);
+        
+        // True if the fragments are still valid provided the last modification state of the dependencies.
+        // With 'keeprigid' they are also valid after the rigid motions of the region given at the end of the recording:
+        bool isvalid(long long int dependencystate, long long int numdofs, bool keeprigid = false);
+        
+        // Clear and record the next fragments:
+        void record(void);
+        bool isrecording(void) { return isitrecording; };
+        // Add a fragment during the recording:
+        void add(indexmat rowadresses, indexmat coladresses, densemat vals);
+        void add(indexmat adresses, densemat vals);
+        // End the recording. The fragments are valid from now on:
+        void endrecord(long long int numdofs, int rigidinvariance = -1, int rigidphysreg = -1);
+        
+        // Add all fragments again to the vector or matrix:
+        void replay(std::shared_ptr<rawvec> myvec, std::shared_ptr<rawmat> mymat);
+        
+};
+
+#endif
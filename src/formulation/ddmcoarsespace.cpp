@@ -0,0 +1,155 @@
+#include "ddmcoarsespace.h"
+
+
+densemat (*ddmcoarsespace::myoperator)(densemat) = NULL;
+std::vector<int> ddmcoarsespace::myneighbours = {};
+std::vector<int> ddmcoarsespace::myblockbegin = {};
+std::vector<int> ddmcoarsespace::myblocklength = {};
+int ddmcoarsespace::mynumunknowns = 0;
+densemat ddmcoarsespace::myaz;
+mat ddmcoarsespace::mycoarsemat;
+
+void ddmcoarsespace::define(densemat (*op)(densemat), std::vector<int> neighbours, std::vector<int> blocklengths)
+{
+    int rank = slmpi::getrank();
+    int numranks = slmpi::count();
+    int numneighbours = neighbours.size();
+
+    myoperator = op;
+    myneighbours = neighbours;
+    myblocklength = blocklengths;
+    myblockbegin = std::vector<int>(numneighbours, 0);
+    mynumunknowns = 0;
+    for (int n = 0; n < numneighbours; n++)
+    {
+        myblockbegin[n] = mynumunknowns;
+        mynumunknowns += blocklengths[n];
+    }
+
+    // All coarse vectors are applied at once since A z_r is only nonzero on the neighbours of rank r:
+    densemat ones(mynumunknowns, 1, 1.0);
+    densemat fones = myoperator(ones.copy());
+    myaz = ones;
+    myaz.subtract(fones);
+
+    ///// Row of the coarse matrix for this rank:
+    std::vector<int> rows = {rank}, cols = {rank};
+    // The coarse vector of a rank without interface unknowns is zero:
+    std::vector<double> vals = {(mynumunknowns > 0) ? (double)mynumunknowns : 1.0};
+
+    double* azptr = myaz.getvalues();
+    for (int n = 0; n < numneighbours; n++)
+    {
+        double blocksum = 0.0;
+        for (int i = myblockbegin[n]; i < myblockbegin[n]+myblocklength[n]; i++)
+            blocksum += azptr[i];
+
+        rows.push_back(rank);
+        cols.push_back(myneighbours[n]);
+        vals.push_back(-blocksum);
+    }
+
+    ///// Gather the coarse matrix on all ranks:
+    std::vector<int> fragsize = {(int)vals.size()}, fragsizes;
+    slmpi::allgather(fragsize, fragsizes);
+
+    std::vector<int> allrows, allcols;
+    std::vector<double> allvals;
+    slmpi::allgather(rows, allrows, fragsizes);
+    slmpi::allgather(cols, allcols, fragsizes);
+    slmpi::allgather(vals, allvals, fragsizes);
+
+    int nnz = allvals.size();
+    mycoarsemat = mat(numranks, indexmat(nnz, 1, allrows), indexmat(nnz, 1, allcols), densemat(nnz, 1, allvals));
+    mycoarsemat.reusefactorization();
+}
+
+void ddmcoarsespace::clear(void)
+{
+    myoperator = NULL;
+    myneighbours = {};
+    myblockbegin = {};
+    myblocklength = {};
+    mynumunknowns = 0;
+    myaz = densemat();
+    mycoarsemat = mat();
+}
+
+std::vector<double> ddmcoarsespace::coarsesolve(densemat v)
+{
+    int numranks = slmpi::count();
+
+    // Z^T v:
+    double* vptr = v.getvalues();
+    std::vector<double> ztv = {0.0};
+    for (int i = 0; i < mynumunknowns; i++)
+        ztv[0] += vptr[i];
+
+    std::vector<double> allztv;
+    slmpi::allgather(ztv, allztv);
+
+    // The coarse problem is solved redundantly on every rank:
+    vec rhs(numranks, indexmat(numranks, 1, 0, 1), densemat(numranks, 1, allztv));
+    vec sol = sl::solve(mycoarsemat, rhs);
+
+    std::vector<double> output;
+    sol.getallvalues().getvalues(output);
+
+    return output;
+}
+
+void ddmcoarsespace::subtractfz(densemat v, std::vector<double>& c)
+{
+    int rank = slmpi::getrank();
+
+    double* vptr = v.getvalues();
+    double* azptr = myaz.getvalues();
+
+    // F z_r = z_r - A z_r:
+    for (int i = 0; i < mynumunknowns; i++)
+        vptr[i] -= c[rank];
+    for (int n = 0; n < myneighbours.size(); n++)
+    {
+        double cn = c[myneighbours[n]];
+        for (int i = myblockbegin[n]; i < myblockbegin[n]+myblocklength[n]; i++)
+            vptr[i] += cn*azptr[i];
+    }
+}
+
+densemat ddmcoarsespace::projectedproduct(densemat v)
+{
+    densemat fv = myoperator(v);
+
+    std::vector<double> c = coarsesolve(fv);
+    subtractfz(fv, c);
+
+    return fv;
+}
+
+densemat ddmcoarsespace::project(densemat b)
+{
+    densemat pb = b.copy();
+
+    std::vector<double> c = coarsesolve(pb);
+    subtractfz(pb, c);
+
+    return pb;
+}
+
+void ddmcoarsespace::correct(densemat b, densemat x)
+{
+    int rank = slmpi::getrank();
+
+    // Residual b - F x:
+    densemat r = myoperator(x.copy());
+    double* rptr = r.getvalues();
+    double* bptr = b.getvalues();
+    for (int i = 0; i < mynumunknowns; i++)
+        rptr[i] = bptr[i] - rptr[i];
+
+    std::vector<double> c = coarsesolve(r);
+
+    double* xptr = x.getvalues();
+    for (int i = 0; i < mynumunknowns; i++)
+        xptr[i] += c[rank];
+}
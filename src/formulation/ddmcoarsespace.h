@@ -0,0 +1,66 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object adds a second level to the DDM gmres iteration on the interface unknowns.
+// The coarse space has one vector per subdomain (all ones on the interface unknowns of that
+// rank). The coarse operator E = Z^T F Z only couples neighbour subdomains. It is obtained with
+// a single application of F, gathered on all ranks and factorized once. The gmres then solves
+// the deflated system P F x = P b with P = I - F Z inv(E) Z^T and the coarse component of the
+// solution is added afterwards. This keeps the iteration count from growing with the rank count.
+
+
+#ifndef DDMCOARSESPACE_H
+#define DDMCOARSESPACE_H
+
+#include <iostream>
+#include <vector>
+#include "mat.h"
+#include "vec.h"
+#include "sl.h"
+#include "slmpi.h"
+#include "indexmat.h"
+#include "densemat.h"
+
+class mat;
+
+class ddmcoarsespace
+{
+    private:
+
+        // The one level operator F:
+        static densemat (*myoperator)(densemat);
+
+        static std::vector<int> myneighbours;
+        // Position of the interface unknowns received from every neighbour:
+        static std::vector<int> myblockbegin;
+        static std::vector<int> myblocklength;
+        static int mynumunknowns;
+
+        // A*Z on this rank (F*Z is obtained from it):
+        static densemat myaz;
+
+        static mat mycoarsemat;
+
+        // Get inv(E) Z^T v for all ranks:
+        static std::vector<double> coarsesolve(densemat v);
+        // Subtract F Z c from v:
+        static void subtractfz(densemat v, std::vector<double>& c);
+
+    public:
+
+        // Define and factorize the coarse operator for F. The block lengths are the number of interface unknowns received from each neighbour:
+        static void define(densemat (*op)(densemat), std::vector<int> neighbours, std::vector<int> blocklengths);
+        static void clear(void);
+
+        // Return P F v:
+        static densemat projectedproduct(densemat v);
+        // Return P b:
+        static densemat project(densemat b);
+        // Replace the solution x of the deflated system by x + Z inv(E) Z^T (b - F x):
+        static void correct(densemat b, densemat x);
+
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "ddmoperatorcache.h"
+#include "slmpi.h"
+#include "universe.h"
+#include "rawmat.h"
+
+
+void ddmoperatorcache::clear(void)
+{
+    isitvalid = false;
+    
+    sendinds = {}; recvinds = {}; interfaceinds = {}; dcdata = {};
+    A = NULL;
+    myisconstrained = {};
+}
+
+bool ddmoperatorcache::isvalid(dofmanager* dm, long long int matrixstate, std::vector<int> terms, std::vector<bool>& isconstrained)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    
+    bool isvalidhere = (isitvalid && dm == mydofmanager && matrixstate <= mystate && terms == myterms && isconstrained == myisconstrained);
+    isvalidhere = isvalidhere && rm->getmeshnumber() == mymeshnumber && rm->getstate() == mymeshstate;
+    
+    // The interface operators are built collectively, all ranks must agree:
+    std::vector<int> isinvalid = {not(isvalidhere)};
+    slmpi::max(isinvalid);
+    
+    return (isinvalid[0] == 0);
+}
+
+void ddmoperatorcache::setvalid(dofmanager* dm, long long int matrixstate, std::vector<int> terms, std::vector<bool>& isconstrained)
+{
+    isitvalid = true;
+    
+    mydofmanager = dm;
+    mystate = matrixstate;
+    myterms = terms;
+    myisconstrained = isconstrained;
+    mymeshnumber = universe::getrawmesh()->getmeshnumber();
+    mymeshstate = universe::getrawmesh()->getstate();
+}
@@ -0,0 +1,60 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object keeps the DDM interface operators of a formulation from one 'allsolve' call to the
+// next: the send/receive dof indexes, the neighbour constraint data and the factorized subdomain
+// matrix. They stay valid as long as the mesh, the dof structure, the constrained dofs and the
+// dependencies of the matrix contributions are unchanged (e.g. over linear time steps).
+
+
+#ifndef DDMOPERATORCACHE_H
+#define DDMOPERATORCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "indexmat.h"
+
+class dofmanager;
+class rawmat;
+
+class ddmoperatorcache
+{
+    private:
+        
+        bool isitvalid = false;
+        
+        // Conditions under which the operators were computed:
+        dofmanager* mydofmanager = NULL;
+        long long int mystate = -1;
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+        // Contribution numbers used for the subdomain matrix (Dirichlet or Robin variant included):
+        std::vector<int> myterms = {};
+        std::vector<bool> myisconstrained = {};
+        
+    public:
+        
+        // Send and receive indexes of the unconstrained interface dofs:
+        std::vector<indexmat> sendinds = {};
+        std::vector<indexmat> recvinds = {};
+        // Indexes of all interface dofs (additional constraints of the Dirichlet variant):
+        std::vector<indexmat> interfaceinds = {};
+        // Output of 'dofmanager::discovernewconstraints':
+        std::vector<std::vector<indexmat>> dcdata = {};
+        // Factorized subdomain matrix:
+        std::shared_ptr<rawmat> A = NULL;
+        
+        // Forget all operators:
+        void clear(void);
+        
+        // True on all ranks if the operators are still valid on every rank (collective call):
+        bool isvalid(dofmanager* dm, long long int matrixstate, std::vector<int> terms, std::vector<bool>& isconstrained);
+        // The operators are valid from now on:
+        void setvalid(dofmanager* dm, long long int matrixstate, std::vector<int> terms, std::vector<bool>& isconstrained);
+        
+};
+
+#endif
@@ -0,0 +1,232 @@
+#include "distributedsystem.h"
+
+
+distributedsystem::distributedsystem(mat A, std::vector<bool> isdofowned, std::vector<int> neighbours, std::vector<indexmat> sendinds, std::vector<indexmat> recvinds)
+{
+    myoriginalmat = A;
+
+    int rank = slmpi::getrank();
+    int numneighbours = neighbours.size();
+    int numdofs = A.countrows();
+
+    indexmat ainds = A.getainds();
+    int* aindsptr = ainds.getvalues();
+    numreduced = ainds.count();
+
+    ///// Number globally the unconstrained dofs owned by this rank:
+    for (int i = 0; i < numreduced; i++)
+    {
+        if (isdofowned[aindsptr[i]])
+            numowned++;
+    }
+
+    std::vector<int> ownedcount = {numowned}, allownedcounts;
+    slmpi::allgather(ownedcount, allownedcounts);
+
+    PetscInt offset = 0;
+    for (int r = 0; r < allownedcounts.size(); r++)
+    {
+        if (r < rank)
+            offset += allownedcounts[r];
+        myglobalsize += allownedcounts[r];
+    }
+
+    // Global index of every local dof (-1 for constrained dofs):
+    std::vector<PetscInt> globalindex(numdofs, -1);
+    PetscInt index = offset;
+    for (int i = 0; i < numreduced; i++)
+    {
+        if (isdofowned[aindsptr[i]])
+        {
+            globalindex[aindsptr[i]] = index;
+            index++;
+        }
+    }
+
+    // Send the global index of the owned interface dofs to the neighbours (exact in double precision below 2^53):
+    std::vector<std::vector<double>> indexesforneighbours(numneighbours), indexesfromneighbours(numneighbours);
+    for (int n = 0; n < numneighbours; n++)
+    {
+        int* sendptr = sendinds[n].getvalues();
+        indexesforneighbours[n] = std::vector<double>(sendinds[n].count(), -1);
+        for (int i = 0; i < sendinds[n].count(); i++)
+        {
+            if (isdofowned[sendptr[i]])
+                indexesforneighbours[n][i] = globalindex[sendptr[i]];
+        }
+        indexesfromneighbours[n] = std::vector<double>(recvinds[n].count());
+    }
+    slmpi::exchange(neighbours, indexesforneighbours, indexesfromneighbours);
+
+    for (int n = 0; n < numneighbours; n++)
+    {
+        int* recvptr = recvinds[n].getvalues();
+        for (int i = 0; i < recvinds[n].count(); i++)
+        {
+            if (indexesfromneighbours[n][i] >= 0)
+                globalindex[recvptr[i]] = (PetscInt)indexesfromneighbours[n][i];
+        }
+    }
+
+    myglobalindexes = std::vector<PetscInt>(numreduced);
+    for (int i = 0; i < numreduced; i++)
+    {
+        myglobalindexes[i] = globalindex[aindsptr[i]];
+        if (myglobalindexes[i] == -1)
+        {
+            std::cout << "Error in 'distributedsystem' object: an unconstrained interface dof is not numbered by its owner (constraints or dof correspondences are not consistent across ranks)" << std::endl;
+            abort();
+        }
+    }
+
+    ///// Assemble the distributed matrix:
+    // Only the upper triangle is stored for matrices in symmetric storage:
+    bool issymmetric = A.getpointer()->issymmetric();
+
+    Mat Apetsc = A.getapetsc();
+    if (issymmetric)
+        MatSetOption(Apetsc, MAT_GETROW_UPPERTRIANGULAR, PETSC_TRUE);
+
+    // Preallocate with the local row lengths (the contributions of the other ranks are added on the fly):
+    std::vector<PetscInt> rowlengths(numreduced, 0);
+    for (int r = 0; r < numreduced; r++)
+    {
+        PetscInt ncols;
+        const PetscInt* cols;
+        MatGetRow(Apetsc, r, &ncols, &cols, NULL);
+        rowlengths[r] += ncols;
+        if (issymmetric)
+        {
+            for (int k = 0; k < ncols; k++)
+            {
+                if (cols[k] != r)
+                    rowlengths[cols[k]]++;
+            }
+        }
+        MatRestoreRow(Apetsc, r, &ncols, &cols, NULL);
+    }
+    std::vector<PetscInt> ownedrowlengths(numowned);
+    index = 0;
+    for (int r = 0; r < numreduced; r++)
+    {
+        if (isdofowned[aindsptr[r]])
+        {
+            ownedrowlengths[index] = rowlengths[r];
+            index++;
+        }
+    }
+
+    MatCreate(PETSC_COMM_WORLD, &myglobalmat);
+    MatSetSizes(myglobalmat, numowned, numowned, myglobalsize, myglobalsize);
+    MatSetType(myglobalmat, MATMPIAIJ);
+    MatMPIAIJSetPreallocation(myglobalmat, 0, ownedrowlengths.data(), 0, ownedrowlengths.data());
+    MatSetOption(myglobalmat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+
+    std::vector<PetscInt> globalcols;
+    for (int r = 0; r < numreduced; r++)
+    {
+        PetscInt ncols;
+        const PetscInt* cols;
+        const PetscScalar* vals;
+        MatGetRow(Apetsc, r, &ncols, &cols, &vals);
+
+        globalcols.resize(ncols);
+        for (int k = 0; k < ncols; k++)
+            globalcols[k] = myglobalindexes[cols[k]];
+        MatSetValues(myglobalmat, 1, &myglobalindexes[r], ncols, globalcols.data(), vals, ADD_VALUES);
+
+        if (issymmetric)
+        {
+            for (int k = 0; k < ncols; k++)
+            {
+                if (cols[k] != r)
+                    MatSetValue(myglobalmat, globalcols[k], myglobalindexes[r], vals[k], ADD_VALUES);
+            }
+        }
+        MatRestoreRow(Apetsc, r, &ncols, &cols, &vals);
+    }
+
+    MatAssemblyBegin(myglobalmat, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(myglobalmat, MAT_FINAL_ASSEMBLY);
+
+    ///// Prepare the scatter from the global solution to the reduced local dofs:
+    Vec globalsol;
+    MatCreateVecs(myglobalmat, &globalsol, NULL);
+    VecCreateSeq(PETSC_COMM_SELF, numreduced, &mylocalsol);
+
+    IS globalis;
+    ISCreateGeneral(PETSC_COMM_SELF, numreduced, myglobalindexes.data(), PETSC_COPY_VALUES, &globalis);
+    VecScatterCreate(globalsol, globalis, mylocalsol, NULL, &myscatter);
+    ISDestroy(&globalis);
+    VecDestroy(&globalsol);
+}
+
+distributedsystem::~distributedsystem(void)
+{
+    if (myksp != NULL)
+        KSPDestroy(&myksp);
+    if (myscatter != NULL)
+        VecScatterDestroy(&myscatter);
+    if (mylocalsol != NULL)
+        VecDestroy(&mylocalsol);
+    if (myglobalmat != NULL)
+        MatDestroy(&myglobalmat);
+}
+
+vec distributedsystem::solve(vec b, std::string soltype)
+{
+    if (soltype != "lu" && soltype != "cholesky")
+    {
+        std::cout << "Error in 'distributedsystem' object: unknown direct solver type '" << soltype << "' (use 'lu' or 'cholesky')" << std::endl;
+        abort();
+    }
+
+    vec breduced = myoriginalmat.eliminate(b);
+    densemat bvals = breduced.getallvalues();
+
+    ///// Sum the local right handsides into the distributed one:
+    Vec globalrhs, globalsol;
+    MatCreateVecs(myglobalmat, &globalsol, &globalrhs);
+    VecSet(globalrhs, 0.0);
+    VecSetValues(globalrhs, numreduced, myglobalindexes.data(), bvals.getvalues(), ADD_VALUES);
+    VecAssemblyBegin(globalrhs);
+    VecAssemblyEnd(globalrhs);
+
+    ///// Factorize once with MUMPS on all ranks:
+    if (myksp == NULL)
+    {
+        PC pc;
+        KSPCreate(PETSC_COMM_WORLD, &myksp);
+        KSPSetOperators(myksp, myglobalmat, myglobalmat);
+        KSPSetType(myksp, KSPPREONLY);
+        KSPSetFromOptions(myksp);
+
+        KSPGetPC(myksp,&pc);
+        if (soltype == "lu")
+            PCSetType(pc,PCLU);
+        if (soltype == "cholesky")
+            PCSetType(pc,PCCHOLESKY);
+        PCFactorSetMatSolverType(pc,MATSOLVERMUMPS);
+    }
+
+    KSPSolve(myksp, globalrhs, globalsol);
+
+    ///// Bring back the solution at the local dofs:
+    VecScatterBegin(myscatter, globalsol, mylocalsol, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(myscatter, globalsol, mylocalsol, INSERT_VALUES, SCATTER_FORWARD);
+
+    densemat xvals(numreduced, 1);
+    double* xptr = xvals.getvalues();
+    PetscScalar* localptr;
+    VecGetArray(mylocalsol, &localptr);
+    for (int i = 0; i < numreduced; i++)
+        xptr[i] = localptr[i];
+    VecRestoreArray(mylocalsol, &localptr);
+
+    VecDestroy(&globalrhs);
+    VecDestroy(&globalsol);
+
+    vec xvec(numreduced, indexmat(numreduced, 1, 0, 1), xvals);
+
+    return myoriginalmat.xbmerge(xvec, b);
+}
@@ -0,0 +1,70 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This code calls the PETSc library. See https://www.mcs.anl.gov/petsc/ for more information.
+
+// This object assembles the local matrices of all ranks of a no-overlap domain decomposition
+// into a single distributed (MPIAIJ) matrix. Every unconstrained dof is numbered globally by the
+// rank owning its disjoint region. The global system is factorized by MUMPS across all ranks
+// and every rank gets back the solution values at its own dofs.
+
+
+#ifndef DISTRIBUTEDSYSTEM_H
+#define DISTRIBUTEDSYSTEM_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include "mat.h"
+#include "vec.h"
+#include "indexmat.h"
+#include "densemat.h"
+#include "slmpi.h"
+#include "petsc.h"
+#include "petscmat.h"
+#include "petscvec.h"
+#include "petscksp.h"
+
+class mat;
+class vec;
+
+class distributedsystem
+{
+    private:
+
+        mat myoriginalmat;
+
+        int numreduced = 0;
+        int numowned = 0;
+        PetscInt myglobalsize = 0;
+
+        // Global index of every reduced (unconstrained) local dof:
+        std::vector<PetscInt> myglobalindexes = {};
+
+        Mat myglobalmat = NULL;
+        KSP myksp = NULL;
+        // To bring the global solution back to the reduced local dofs:
+        VecScatter myscatter = NULL;
+        Vec mylocalsol = NULL;
+
+    public:
+
+        // Matrix 'A' must have all constraints of the neighbours at the interface dofs.
+        // The send and receive indexes are the interface dof correspondences of 'sl::mapdofs'.
+        distributedsystem(mat A, std::vector<bool> isdofowned, std::vector<int> neighbours, std::vector<indexmat> sendinds, std::vector<indexmat> recvinds);
+        ~distributedsystem(void);
+
+        distributedsystem(const distributedsystem&) = delete;
+        distributedsystem& operator=(const distributedsystem&) = delete;
+
+        PetscInt countglobaldofs(void) { return myglobalsize; };
+
+        // Solve Ax = b for the local right handside 'b' (the contributions of all ranks are summed).
+        // The factorization is kept for the next calls.
+        vec solve(vec b, std::string soltype = "lu");
+
+};
+
+#endif
@@ -121,7 +121,16 @@ void dofinterpolate::eval(void)
         std::vector<int> disjregs = mydisjregselector.getgroup(i);
         
         // Calculate the reference coordinate positions:
-        rcg.evalat(disjregs);
+        std::shared_ptr<rawslidinginterface> sliding = mydofops[0]->getoncontext()->getslidinginterface();
+        if (sliding == NULL)
+            rcg.evalat(disjregs);
+        else
+        {
+            std::vector<int> elems;
+            std::vector<double> kietaphis;
+            sliding->search(myxyzcoords, disjregs, elems, kietaphis);
+            rcg.evalatfound(elems, kietaphis);
+        }
         
         int elementtypenumber = mydisjointregions->getelementtypenumber(disjregs[0]);        
         int doforder = mydoffield->getinterpolationorder(disjregs[0]);
@@ -222,7 +231,7 @@ void dofinterpolate::eval(void)
                                     
                                     int rb = mydofmanager->getrangebegin(curdisjreg, formfunctionindex[ff]);
                                 
-                                    dofnumsptr[rowstart+mynumrefcoords*ff+callingevalpt] = rb + currentsubelem;
+                                    dofnumsptr[rowstart+mynumrefcoords*ff+callingevalpt] = rb + mydofmanager->getrangestep(curdisjreg)*currentsubelem;
                                 }
                             }
                         }
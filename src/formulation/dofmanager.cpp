@@ -1,14 +1,30 @@
 #include "dofmanager.h"
+#include "geotools.h"
 
 
+long long int dofmanager::maxaddresstablebytes = 500000000;
+
 void dofmanager::synchronize(void)
 {
     if (isitmanaged == false || issynchronizing || universe::getrawmesh()->getmeshnumber() == mymeshnumber)
         return;
     issynchronizing = true;    
+    
+    profilescope scope("dof structure sync");
 
+    // Keep the previous structure to map the unchanged dofs:
+    std::vector<std::shared_ptr<rawfield>> prevfields = myfields;
+    std::vector<std::vector<int>> prevorders = myfieldorders;
+    std::vector<std::vector<std::vector< int >>> prevrangebegin = rangebegin, prevrangeend = rangeend;
+    std::vector<std::vector< int >> prevrangestep = rangestep;
+    std::unordered_map<rawport*, int> prevportmap = myrawportmap;
+    std::vector<double> prevsignatures = mydisjregsignatures;
+    int prevnumberofdofs = numberofdofs;
+    int prevmeshnumber = mymeshnumber;
 
     // Flush the structure:
+    clearaddresstables();
+    myslaverelations = NULL;
     numberofdofs = 0;
     myfields = {};
     int selectedfieldnumberbkp = selectedfieldnumber;
@@ -18,6 +34,7 @@ void dofmanager::synchronize(void)
     primalondisjreg = {};
     rangebegin = {};
     rangeend = {};
+    rangestep = {};
 
     // Rebuild the structure:
     for (int i = 0; i < myportstructuretracker.size(); i++)
@@ -29,13 +46,101 @@ void dofmanager::synchronize(void)
     selectedfieldnumber = selectedfieldnumberbkp;
     
     mymeshnumber = universe::getrawmesh()->getmeshnumber();
+    
+    mydisjregsignatures = getdisjregsignatures();
+    remap(prevfields, prevorders, prevrangebegin, prevrangeend, prevrangestep, prevportmap, prevsignatures, prevnumberofdofs);
+    myrenumberingsource = prevmeshnumber;
+    
     issynchronizing = false;
 }
 
-void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, std::vector<int> selecteddisjointregions)
-{  
-    synchronize();
+std::vector<double> dofmanager::getdisjregsignatures(void)
+{
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    elements* els = universe::getrawmesh()->getelements();
+    
+    int numdisjregs = mydisjointregions->count();
+    
+    std::vector<double> output(2*numdisjregs, 0.0);
+    for (int d = 0; d < numdisjregs; d++)
+    {
+        int rb = mydisjointregions->getrangebegin(d);
+        int numelems = mydisjointregions->countelements(d);
+        std::vector<double>* barys = els->getbarycenters(mydisjointregions->getelementtypenumber(d));
+        
+        // The weights make the checksum depend on the element ordering:
+        double checksum = 0;
+        for (int i = 0; i < numelems; i++)
+            checksum += (i+1) * (barys->at(3*(rb+i)+0) + 1.7*barys->at(3*(rb+i)+1) + 2.9*barys->at(3*(rb+i)+2));
+            
+        output[2*d+0] = numelems;
+        output[2*d+1] = checksum;
+    }
+    
+    return output;
+}
+
+void dofmanager::remap(std::vector<std::shared_ptr<rawfield>>& prevfields, std::vector<std::vector<int>>& prevorders, std::vector<std::vector<std::vector<int>>>& prevrangebegin, std::vector<std::vector<std::vector<int>>>& prevrangeend, std::vector<std::vector<int>>& prevrangestep, std::unordered_map<rawport*, int>& prevportmap, std::vector<double>& prevsignatures, int prevnumberofdofs)
+{
+    myrenumbering = std::vector<int>(prevnumberofdofs, -1);
+    myisfieldremapped.clear();
+    
+    // Know which disjoint regions have unchanged elements:
+    int numdisjregs = mydisjregsignatures.size()/2;
+    std::vector<bool> isdisjregunchanged(numdisjregs, false);
+    if (prevsignatures.size() == mydisjregsignatures.size())
+    {
+        for (int d = 0; d < numdisjregs; d++)
+        {
+            double prevchecksum = prevsignatures[2*d+1], checksum = mydisjregsignatures[2*d+1];
+            isdisjregunchanged[d] = (prevsignatures[2*d+0] == mydisjregsignatures[2*d+0] && std::abs(checksum-prevchecksum) <= 1e-10*std::abs(prevchecksum));
+        }
+    }
+    
+    for (int pf = 0; pf < prevfields.size(); pf++)
+    {
+        int f = -1;
+        for (int i = 0; i < myfields.size(); i++)
+        {
+            if (myfields[i] == prevfields[pf])
+                f = i;
+        }
+        
+        bool isremapped = (f != -1 && prevorders[pf].size() == myfieldorders[f].size());
+        for (int d = 0; d < prevrangebegin[pf].size(); d++)
+        {
+            int numff = prevrangebegin[pf][d].size();
+            if (numff == 0)
+                continue;
+            
+            if (isremapped == false || d >= numdisjregs || isdisjregunchanged[d] == false || prevorders[pf][d] != myfieldorders[f][d] || rangebegin[f][d].size() != numff)
+            {
+                isremapped = false;
+                continue;
+            }
+            
+            for (int ff = 0; ff < numff; ff++)
+            {
+                int prevstep = prevrangestep[pf][d], step = rangestep[f][d];
+                int numinrange = (prevrangeend[pf][d][ff] - prevrangebegin[pf][d][ff])/prevstep + 1;
+                for (int i = 0; i < numinrange; i++)
+                    myrenumbering[prevrangebegin[pf][d][ff] + i*prevstep] = rangebegin[f][d][ff] + i*step;
+            }
+        }
+        
+        myisfieldremapped[prevfields[pf].get()] = isremapped;
+    }
     
+    for (std::unordered_map<rawport*, int>::iterator it = prevportmap.begin(); it != prevportmap.end(); ++it)
+    {
+        std::unordered_map<rawport*, int>::iterator newit = myrawportmap.find(it->first);
+        if (newit != myrawportmap.end())
+            myrenumbering[it->second] = newit->second;
+    }
+}
+
+int dofmanager::addfield(std::shared_ptr<rawfield> fieldtoadd)
+{
     disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
 
     // Find the field index of 'fieldtoadd' (if present):
@@ -60,6 +165,7 @@ void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, std::vecto
         std::vector<std::vector< int >> temp(numberofdisjointregions, std::vector< int >(0));
         rangebegin.push_back(temp);
         rangeend.push_back(temp);
+        rangestep.push_back(std::vector<int>(numberofdisjointregions, 1));
     }
     else
     {
@@ -73,6 +179,34 @@ void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, std::vecto
         }
     }
     
+    return fieldindex;
+}
+
+void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, std::vector<int> selecteddisjointregions)
+{  
+    synchronize();
+    
+    clearaddresstables();
+    myslaverelations = NULL;
+    
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+
+    int fieldindex = addfield(fieldtoadd);
+    
+    // The dofs of interleaved components are all added together:
+    std::vector<int> groupindexes = {fieldindex};
+    for (int g = 0; g < myinterleavedfields.size(); g++)
+    {
+        if (std::find(myinterleavedfields[g].begin(), myinterleavedfields[g].end(), fieldtoadd) == myinterleavedfields[g].end())
+            continue;
+        
+        groupindexes = std::vector<int>(myinterleavedfields[g].size());
+        for (int c = 0; c < myinterleavedfields[g].size(); c++)
+            groupindexes[c] = addfield(myinterleavedfields[g][c]);
+        break;
+    }
+    int numcomps = groupindexes.size();
+    
     // Add an entry for every form function - if not already existing:
     for (int i = 0; i < selecteddisjointregions.size(); i++)
     {
@@ -91,6 +225,35 @@ void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, std::vecto
         {
             int numffdefinedbeforeresize = rangebegin[fieldindex][disjreg].size();
             int currentnumberofdofs = mydisjointregions->countelements(disjreg);
+            
+            // Components are not interleaved on ported disjoint regions or if their form functions differ:
+            bool isinterleaved = (numcomps > 1);
+            for (int c = 0; c < numcomps; c++)
+            {
+                if (primalondisjreg[groupindexes[c]][disjreg] != NULL || rangebegin[groupindexes[c]][disjreg].size() != numffdefinedbeforeresize)
+                    isinterleaved = false;
+            }
+            
+            if (isinterleaved)
+            {
+                for (int c = 0; c < numcomps; c++)
+                {
+                    rangebegin[groupindexes[c]][disjreg].resize(numberofformfunctions);
+                    rangeend[groupindexes[c]][disjreg].resize(numberofformfunctions);
+                    rangestep[groupindexes[c]][disjreg] = numcomps;
+                }
+                
+                for (int ff = numffdefinedbeforeresize; ff < numberofformfunctions; ff++)
+                {
+                    for (int c = 0; c < numcomps; c++)
+                    {
+                        rangebegin[groupindexes[c]][disjreg][ff] = numberofdofs + c;
+                        rangeend[groupindexes[c]][disjreg][ff] = numberofdofs + c + numcomps*(currentnumberofdofs - 1);
+                    }
+                    numberofdofs += numcomps*currentnumberofdofs;
+                }
+                continue;
+            }
 
             rangebegin[fieldindex][disjreg].resize(numberofformfunctions);
             rangeend[fieldindex][disjreg].resize(numberofformfunctions);
@@ -144,6 +307,9 @@ void dofmanager::addtostructure(std::shared_ptr<rawport> porttoadd)
 {
     synchronize();
     
+    clearaddresstables();
+    myslaverelations = NULL;
+    
     // Keep track of the calls to 'addtostructure':
     if (issynchronizing == false)
         myportstructuretracker.push_back(porttoadd);
@@ -152,43 +318,9 @@ void dofmanager::addtostructure(std::shared_ptr<rawport> porttoadd)
     {
         std::shared_ptr<rawfield> associatedfield = porttoadd->getrawfield();
 
-        disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
         physicalregions* myphysicalregions = universe::getrawmesh()->getphysicalregions();
 
-        // Find the field index of 'associatedfield' (if present):
-        int fieldindex = -1;
-        for (int i = 0; i < myfields.size(); i++)
-        {
-            if (myfields[i].get() == associatedfield.get())
-            {
-                fieldindex = i;
-                break;
-            }
-        }
-        // Add the field to the structure if not existing.
-        // Add an entry for every disjoint region at the same time.
-        if (fieldindex == -1)
-        {
-            fieldindex = myfields.size();
-            myfields.push_back(associatedfield);
-            myfieldorders.push_back(associatedfield->getinterpolationorders());
-            int numberofdisjointregions = mydisjointregions->count();
-            primalondisjreg.push_back(std::vector<std::shared_ptr<rawport>>(numberofdisjointregions, NULL));
-            std::vector<std::vector< int >> temp(numberofdisjointregions, std::vector< int >(0));
-            rangebegin.push_back(temp);
-            rangeend.push_back(temp);
-        }
-        else
-        {
-            // Make sure the field order has not changed between two calls:
-            if (associatedfield->getinterpolationorders() != myfieldorders[fieldindex])
-            {
-                std::cout << "Error in 'dofmanager' object: ";
-                associatedfield->print();
-                std::cout << " order was changed and does not match dof structure anymore" << std::endl;
-                abort();
-            }
-        }
+        int fieldindex = addfield(associatedfield);
 
         std::vector<int> disjregs = myphysicalregions->get(porttoadd->getphysicalregion())->getdisjointregions(-1);
 
@@ -208,13 +340,20 @@ void dofmanager::addtostructure(std::shared_ptr<rawport> porttoadd)
     }
 }
 
-void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, int physicalregionnumber)
+void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, int physicalregionnumber, int harmonicnumber)
 {
     synchronize();
     
+    // Signature of the mesh the structure is first built on:
+    if (mydisjregsignatures.size() == 0)
+        mydisjregsignatures = getdisjregsignatures();
+    
     // Keep track of the calls to 'addtostructure':
     if (issynchronizing == false)
+    {
         mystructuretracker.push_back(std::make_pair(fieldtoadd, physicalregionnumber));
+        myharmonicnumbers[fieldtoadd.get()] = harmonicnumber;
+    }
 
     // Get all disjoint regions in the physical region with (-1):
     std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(physicalregionnumber))->getdisjointregions(-1);
@@ -222,6 +361,70 @@ void dofmanager::addtostructure(std::shared_ptr<rawfield> fieldtoadd, int physic
     addtostructure(fieldtoadd, disjregs);
 }
 
+void dofmanager::interleave(std::vector<std::shared_ptr<rawfield>> components)
+{
+    synchronize();
+    
+    clearaddresstables();
+    myslaverelations = NULL;
+    
+    if (components.size() < 2)
+        return;
+    
+    for (int c = 0; c < components.size(); c++)
+    {
+        if (components[c]->gettypename() != components[0]->gettypename() || components[c]->getinterpolationorders() != components[0]->getinterpolationorders())
+        {
+            std::cout << "Error in 'dofmanager' object: cannot interleave components of different type or interpolation order" << std::endl;
+            abort();
+        }
+        for (int i = 0; i < myfields.size(); i++)
+        {
+            if (myfields[i].get() == components[c].get())
+            {
+                std::cout << "Error in 'dofmanager' object: cannot interleave components that are already in the dof structure" << std::endl;
+                abort();
+            }
+        }
+        for (int g = 0; g < myinterleavedfields.size(); g++)
+        {
+            if (std::find(myinterleavedfields[g].begin(), myinterleavedfields[g].end(), components[c]) != myinterleavedfields[g].end())
+            {
+                std::cout << "Error in 'dofmanager' object: a component can only be interleaved once" << std::endl;
+                abort();
+            }
+        }
+    }
+    
+    myinterleavedfields.push_back(components);
+}
+
+int dofmanager::getblocksize(void)
+{
+    synchronize();
+    
+    if (myinterleavedfields.size() == 0 || myrawportmap.size() > 0)
+        return 1;
+    
+    int blocksize = myinterleavedfields[0].size();
+    for (int g = 1; g < myinterleavedfields.size(); g++)
+    {
+        if (myinterleavedfields[g].size() != blocksize)
+            return 1;
+    }
+    // All dofs must be interleaved:
+    for (int i = 0; i < rangestep.size(); i++)
+    {
+        for (int disjreg = 0; disjreg < rangestep[i].size(); disjreg++)
+        {
+            if (rangebegin[i][disjreg].size() > 0 && rangestep[i][disjreg] != blocksize)
+                return 1;
+        }
+    }
+    
+    return blocksize;
+}
+
 void dofmanager::selectfield(std::shared_ptr<rawfield> selectedfield)
 {
     synchronize();
@@ -282,6 +485,44 @@ int dofmanager::getrangeend(int disjreg, int formfunc)
     return rangeend[selectedfieldnumber][disjreg][formfunc];
 }
 
+int dofmanager::getrangestep(int disjreg)
+{
+    synchronize();
+    
+    return rangestep[selectedfieldnumber][disjreg];
+}
+
+void dofmanager::gettransferblocks(std::vector<int>& disjregs, std::vector<int>& numformfunctions, bool withports, std::vector<int>& rangebegins, std::vector<int>& steps, std::vector<int>& lengths, std::vector<int>& blockdisjregindexes, std::vector<int>& blockformfunctions)
+{
+    synchronize();
+    
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    
+    rangebegins = {}; steps = {}; lengths = {}; blockdisjregindexes = {}; blockformfunctions = {};
+    
+    for (int i = 0; i < disjregs.size(); i++)
+    {
+        int disjreg = disjregs[i];
+        
+        bool isitported = (primalondisjreg[selectedfieldnumber][disjreg] != NULL);
+        if (isitported && withports == false)
+            continue;
+        
+        int numffs = std::min(numformfunctions[i], (int)rangebegin[selectedfieldnumber][disjreg].size());
+        int numelems = mydisjointregions->countelements(disjreg);
+        int step = isitported ? 0 : rangestep[selectedfieldnumber][disjreg];
+        
+        for (int ff = 0; ff < numffs; ff++)
+        {
+            rangebegins.push_back(rangebegin[selectedfieldnumber][disjreg][ff]);
+            steps.push_back(step);
+            lengths.push_back(numelems);
+            blockdisjregindexes.push_back(i);
+            blockformfunctions.push_back(ff);
+        }
+    }
+}
+
 int dofmanager::getaddress(rawport* prt)
 {
     synchronize();
@@ -368,7 +609,7 @@ std::vector<bool> dofmanager::isconstrained(void)
     
     std::vector<bool> output(numberofdofs, false);
     
-    std::vector<indexmat> allconstrinds = {getdisjregconstrainedindexes(), getgaugedindexes(), getconditionalconstraintdata().first};
+    std::vector<indexmat> allconstrinds = {getdisjregconstrainedindexes(), getgaugedindexes(), getconditionalconstraintdata().first, getinactiveindexes()};
     
     for (int i = 0; i < allconstrinds.size(); i++)
     {
@@ -376,6 +617,14 @@ std::vector<bool> dofmanager::isconstrained(void)
         for (int j = 0; j < allconstrinds[i].count(); j++)
             output[cptr[j]] = true;
     }
+    
+    // The slaves are eliminated like the constrained dofs:
+    std::shared_ptr<slaverelations> rels = getslaverelations();
+    if (rels != NULL)
+    {
+        for (int i = 0; i < rels->count(); i++)
+            output[rels->slaves[i]] = true;
+    }
 
     return output;
 }
@@ -413,7 +662,7 @@ int dofmanager::countdisjregconstraineddofs(void)
         {
             // If the field is constrained on the disjoint region and there is at least one form function:
             if (rangebegin[fieldindex][disjreg].size() > 0 && myfields[fieldindex]->isdisjregconstrained(disjreg))
-                numdisjregconstraineddofs += rangebegin[fieldindex][disjreg].size() * (rangeend[fieldindex][disjreg][0] - rangebegin[fieldindex][disjreg][0] + 1);
+                numdisjregconstraineddofs += rangebegin[fieldindex][disjreg].size() * countrange(fieldindex, disjreg);
         }
     }
     return numdisjregconstraineddofs;
@@ -436,10 +685,10 @@ indexmat dofmanager::getdisjregconstrainedindexes(void)
             {
                 for (int ff = 0; ff < rangebegin[fieldindex][disjreg].size(); ff++)
                 {
-                    int numdofshere = rangeend[fieldindex][disjreg][0] - rangebegin[fieldindex][disjreg][0] + 1;
+                    int numdofshere = countrange(fieldindex, disjreg);
                     for (int i = 0; i < numdofshere; i++)
                     {
-                        myval[currentindex] = rangebegin[fieldindex][disjreg][ff] + i;
+                        myval[currentindex] = rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i;
                         currentindex++;
                     }
                 }
@@ -449,6 +698,35 @@ indexmat dofmanager::getdisjregconstrainedindexes(void)
     return output;
 }
 
+indexmat dofmanager::getinactiveindexes(void)
+{
+    synchronize();
+    
+    std::vector<int> inactiveindexes = {};
+    for (int fieldindex = 0; fieldindex < rangebegin.size(); fieldindex++)
+    {
+        if (myfields[fieldindex]->isactive())
+            continue;
+            
+        for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+        {
+            for (int ff = 0; ff < rangebegin[fieldindex][disjreg].size(); ff++)
+            {
+                int numdofshere = countrange(fieldindex, disjreg);
+                for (int i = 0; i < numdofshere; i++)
+                    inactiveindexes.push_back(rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i);
+            }
+        }
+    }
+    
+    indexmat output(1, inactiveindexes.size());
+    int* myval = output.getvalues();
+    for (int i = 0; i < inactiveindexes.size(); i++)
+        myval[i] = inactiveindexes[i];
+    
+    return output;
+}
+
 int dofmanager::countgaugeddofs(void)
 {
     synchronize();
@@ -477,7 +755,7 @@ int dofmanager::countgaugeddofs(void)
                     {
                         // All other form functions are gauged on all dofs in the disjoint region:
                         if (isitgradienttype[ff])
-                            numgaugeddofs += rangeend[fieldindex][disjreg][0] - rangebegin[fieldindex][disjreg][0] + 1;
+                            numgaugeddofs += countrange(fieldindex, disjreg);
                     }
                 }
             }
@@ -511,12 +789,12 @@ indexmat dofmanager::getgaugedindexes(void)
                 {
                     // The lowest order hcurl form function is gauged only on the spanning tree.
                     // All other form functions are gauged on all dofs in the disjoint region.
-                    int numdofshere = rangeend[fieldindex][disjreg][0] - rangebegin[fieldindex][disjreg][0] + 1;
+                    int numdofshere = countrange(fieldindex, disjreg);
                     for (int i = 0; i < numdofshere; i++)
                     {
                         if ((elementtype != 1 || ff != 0) && isitgradienttype[ff] || elementtype == 1 && ff == 0 && myspantree->isintree(i, disjreg))
                         {
-                            myval[currentindex] = rangebegin[fieldindex][disjreg][ff] + i;
+                            myval[currentindex] = rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i;
                             currentindex++;
                         }
                     }
@@ -591,7 +869,7 @@ std::pair<indexmat, densemat> dofmanager::getconditionalconstraintdata(void)
             for (int i = 0; i < curdisjregs.size(); i++)
             {
                 // There is only a single shape function per node!
-                for (int ind = rangebegin[fieldindex][curdisjregs[i]][0]; ind <= rangeend[fieldindex][curdisjregs[i]][0]; ind++)
+                for (int ind = rangebegin[fieldindex][curdisjregs[i]][0]; ind <= rangeend[fieldindex][curdisjregs[i]][0]; ind += rangestep[fieldindex][curdisjregs[i]])
                 {
                     curindmatptr[index] = ind;
                     index++;
@@ -645,6 +923,266 @@ std::pair<indexmat, densemat> dofmanager::getconditionalconstraintdata(void)
     return std::make_pair(condconstrindices, condconstrval);
 }
 
+void dofmanager::tie(std::shared_ptr<rawfield> rf, int gamma1, int gamma2, std::vector<double> dat1, std::vector<double> dat2, double factor)
+{
+    universe::getrawmesh()->getphysicalregions()->errorundefined({gamma1, gamma2});
+    
+    if (rf->gettypename() != "h1" || rf->countformfunctioncomponents() > 1)
+    {
+        std::cout << "Error in 'dofmanager' object: only 'h1' type fields can be tied" << std::endl;
+        abort();
+    }
+    if (dat1.size() != 3 || (dat2.size() != 1 && dat2.size() != 3))
+    {
+        std::cout << "Error in 'dofmanager' object: in 'tie' expected a vector of length 3 for the first mapping data and of length 1 or 3 for the second" << std::endl;
+        abort();
+    }
+    
+    myties.push_back(std::make_tuple(rf, gamma1, gamma2, dat1, dat2, factor));
+    myslaverelations = NULL;
+}
+
+void dofmanager::addtie(std::tuple<std::shared_ptr<rawfield>, int, int, std::vector<double>, std::vector<double>, double>& tie, std::vector<std::vector<std::pair<int, double>>>& rels)
+{
+    std::shared_ptr<rawfield> rf = std::get<0>(tie);
+    int gamma1 = std::get<1>(tie), gamma2 = std::get<2>(tie);
+    std::vector<double> dat1 = std::get<3>(tie), dat2 = std::get<4>(tie);
+    double factor = std::get<5>(tie);
+    
+    nodes* mynodes = universe::getrawmesh()->getnodes();
+    elements* myelements = universe::getrawmesh()->getelements();
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    physicalregions* myphysicalregions = universe::getrawmesh()->getphysicalregions();
+    const std::vector<double>* coords = mynodes->readcoordinates();
+    
+    // Nodes of both regions:
+    std::vector<std::vector<int>> regionnodes(2);
+    std::vector<int> regions = {gamma1, gamma2};
+    for (int r = 0; r < 2; r++)
+    {
+        std::vector<int> nodedisjregs = myphysicalregions->get(regions[r])->getdisjointregions(0);
+        for (int i = 0; i < nodedisjregs.size(); i++)
+        {
+            for (int n = mydisjointregions->getrangebegin(nodedisjregs[i]); n <= mydisjointregions->getrangeend(nodedisjregs[i]); n++)
+                regionnodes[r].push_back(n);
+        }
+    }
+    
+    // Map the slave nodes onto the master region:
+    int numslavenodes = regionnodes[0].size();
+    std::vector<double> mapped(3*numslavenodes);
+    for (int i = 0; i < numslavenodes; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            mapped[3*i+j] = coords->at(3*regionnodes[0][i]+j);
+    }
+    // Rotation matrix (identity for a translation):
+    std::vector<double> R = {1,0,0, 0,1,0, 0,0,1};
+    if (dat2.size() == 1)
+    {
+        double normval = std::sqrt(dat1[0]*dat1[0] + dat1[1]*dat1[1] + dat1[2]*dat1[2]);
+        for (int i = 0; i < numslavenodes; i++)
+        {
+            for (int j = 0; j < 3; j++)
+                mapped[3*i+j] += dat2[0]*dat1[j]/normval;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < numslavenodes; i++)
+        {
+            for (int j = 0; j < 3; j++)
+                mapped[3*i+j] -= dat1[j];
+        }
+        geotools::rotate(dat2[0], dat2[1], dat2[2], &mapped);
+        geotools::rotate(dat2[0], dat2[1], dat2[2], &R);
+        for (int i = 0; i < numslavenodes; i++)
+        {
+            for (int j = 0; j < 3; j++)
+                mapped[3*i+j] += dat1[j];
+        }
+    }
+    
+    // Sort the master nodes by x coordinate to find the matching nodes:
+    std::vector<std::pair<double, int>> sortedmasters(regionnodes[1].size());
+    for (int i = 0; i < regionnodes[1].size(); i++)
+        sortedmasters[i] = std::make_pair(coords->at(3*regionnodes[1][i]+0), regionnodes[1][i]);
+    std::sort(sortedmasters.begin(), sortedmasters.end());
+    
+    std::vector<double> noisethres = mynodes->getnoisethreshold();
+    double tol = 10.0 * std::max(noisethres[0], std::max(noisethres[1], noisethres[2]));
+    
+    std::vector<int> masternodes(numslavenodes);
+    for (int i = 0; i < numslavenodes; i++)
+    {
+        masternodes[i] = -1;
+        std::vector<std::pair<double, int>>::iterator it = std::lower_bound(sortedmasters.begin(), sortedmasters.end(), std::make_pair(mapped[3*i+0]-tol, -1));
+        for (; it != sortedmasters.end() && it->first <= mapped[3*i+0]+tol; ++it)
+        {
+            int n = it->second;
+            if (std::abs(coords->at(3*n+1)-mapped[3*i+1]) <= tol && std::abs(coords->at(3*n+2)-mapped[3*i+2]) <= tol)
+            {
+                masternodes[i] = n;
+                break;
+            }
+        }
+        if (masternodes[i] == -1)
+        {
+            std::cout << "Error in 'dofmanager' object: in 'tie' could not find the node matching node " << regionnodes[0][i] << " (the meshes on both regions must match)" << std::endl;
+            abort();
+        }
+    }
+    
+    // Component fields of every harmonic:
+    int numcomps = rf->countcomponents();
+    std::vector<int> harms = {-1};
+    if (rf->ismultiharmonic())
+        harms = rf->getharmonics();
+    
+    for (int h = 0; h < harms.size(); h++)
+    {
+        std::vector<int> fieldindexes(numcomps, -1);
+        for (int c = 0; c < numcomps; c++)
+        {
+            std::shared_ptr<rawfield> cf = rf->comp(c);
+            if (harms[h] >= 0)
+                cf = cf->harmonic(harms[h]);
+            for (int i = 0; i < myfields.size(); i++)
+            {
+                if (myfields[i].get() == cf.get())
+                    fieldindexes[c] = i;
+            }
+        }
+        
+        // Dof of field 'f' at node 'n' (-1 if none):
+        auto getnodedof = [&](int f, int n)
+        {
+            int d = myelements->getdisjointregion(0, n);
+            if (f == -1 || rangebegin[f][d].size() == 0 || primalondisjreg[f][d] != NULL)
+                return -1;
+            if (myfields[f]->getinterpolationorder(d) > 1)
+            {
+                std::cout << "Error in 'dofmanager' object: in 'tie' the field must be of order 1 on the tied regions" << std::endl;
+                abort();
+            }
+            return rangebegin[f][d][0] + rangestep[f][d]*(n - mydisjointregions->getrangebegin(d));
+        };
+        
+        for (int i = 0; i < numslavenodes; i++)
+        {
+            // A node on both regions is not tied to itself:
+            if (masternodes[i] == regionnodes[0][i])
+                continue;
+            
+            for (int c = 0; c < numcomps; c++)
+            {
+                int slavedof = getnodedof(fieldindexes[c], regionnodes[0][i]);
+                if (slavedof == -1)
+                    continue;
+                
+                // The slave vector is the master vector rotated back (component c of R^T * master):
+                rels[slavedof] = {};
+                for (int m = 0; m < numcomps; m++)
+                {
+                    int masterdof = getnodedof(fieldindexes[m], masternodes[i]);
+                    double coef = factor * R[3*c+m];
+                    if (masterdof != -1 && std::abs(coef) > 1e-12*std::abs(factor))
+                        rels[slavedof].push_back(std::make_pair(masterdof, coef));
+                }
+            }
+        }
+    }
+}
+
+std::shared_ptr<slaverelations> dofmanager::getslaverelations(void)
+{
+    synchronize();
+    
+    if (myties.size() == 0)
+        return NULL;
+    if (myslaverelations != NULL)
+        return myslaverelations;
+        
+    // Relations of every dof (a dof is a slave if it has a relation):
+    std::vector<std::vector<std::pair<int, double>>> rels(numberofdofs);
+    std::vector<bool> isslave(numberofdofs, false);
+    for (int t = 0; t < myties.size(); t++)
+    {
+        std::vector<std::vector<std::pair<int, double>>> tierels(numberofdofs);
+        addtie(myties[t], tierels);
+        // The last tie has priority:
+        for (int i = 0; i < numberofdofs; i++)
+        {
+            if (tierels[i].size() > 0)
+            {
+                rels[i] = tierels[i];
+                isslave[i] = true;
+            }
+        }
+    }
+    
+    // Replace the masters that are slaves (e.g. at corners tied in two directions) by their own masters:
+    for (int i = 0; i < numberofdofs; i++)
+    {
+        if (isslave[i] == false)
+            continue;
+        
+        for (int depth = 0; ; depth++)
+        {
+            if (depth > 10)
+            {
+                std::cout << "Error in 'dofmanager' object: the tied dofs have circular master/slave relations" << std::endl;
+                abort();
+            }
+            
+            std::vector<std::pair<int, double>> resolved = {};
+            bool wasresolved = false;
+            for (int k = 0; k < rels[i].size(); k++)
+            {
+                int master = rels[i][k].first;
+                if (isslave[master] && master != i)
+                {
+                    wasresolved = true;
+                    for (int l = 0; l < rels[master].size(); l++)
+                        resolved.push_back(std::make_pair(rels[master][l].first, rels[i][k].second*rels[master][l].second));
+                }
+                else
+                    resolved.push_back(rels[i][k]);
+            }
+            rels[i] = resolved;
+            if (wasresolved == false)
+                break;
+        }
+    }
+    
+    myslaverelations = std::shared_ptr<slaverelations>(new slaverelations);
+    myslaverelations->meshnumber = mymeshnumber;
+    myslaverelations->numdofs = numberofdofs;
+    myslaverelations->slavenumber = std::vector<int>(numberofdofs, -1);
+    for (int i = 0; i < numberofdofs; i++)
+    {
+        if (isslave[i] == false)
+            continue;
+        // A dof tied to itself (e.g. on the rotation axis) is not eliminated:
+        bool isself = false;
+        for (int k = 0; k < rels[i].size(); k++)
+            isself = isself || (rels[i][k].first == i);
+        if (isself)
+            continue;
+        
+        myslaverelations->slavenumber[i] = myslaverelations->slaves.size();
+        myslaverelations->slaves.push_back(i);
+        for (int k = 0; k < rels[i].size(); k++)
+        {
+            myslaverelations->masters.push_back(rels[i][k].first);
+            myslaverelations->coefs.push_back(rels[i][k].second);
+        }
+        myslaverelations->masterbegin.push_back(myslaverelations->masters.size());
+    }
+    
+    return myslaverelations;
+}
+
 std::shared_ptr<rawfield> dofmanager::getselectedfield(void)
 {
     synchronize();
@@ -667,6 +1205,9 @@ void dofmanager::replaceselectedfield(std::shared_ptr<rawfield> rf)
     synchronize();
     
     myfields[selectedfieldnumber] = rf;
+    
+    clearaddresstables();
+    myslaverelations = NULL;
 }
 
 std::vector<int> dofmanager::getselectedfieldorders(void)
@@ -705,6 +1246,40 @@ int dofmanager::countdofs(void)
     return numberofdofs;
 }
 
+void dofmanager::getconstraintsplit(std::vector<bool>& isconstrained, indexmat& Ainds, indexmat& Dinds, std::vector<int>& renumtolocalindex)
+{
+    if (isconstrained.size() == 0 || isconstrained != mysplitconstraints)
+    {
+        mysplitconstraints = isconstrained;
+        gentools::findtruefalse(isconstrained, mysplitdinds, mysplitainds, mysplitrenumtolocalindex);
+    }
+    
+    Ainds = mysplitainds;
+    Dinds = mysplitdinds;
+    renumtolocalindex = mysplitrenumtolocalindex;
+}
+
+bool dofmanager::getrenumbering(int meshnumber, std::vector<int>& renumbering)
+{
+    synchronize();
+    
+    if (isitmanaged == false || meshnumber != myrenumberingsource)
+        return false;
+    
+    renumbering = myrenumbering;
+    
+    return true;
+}
+
+bool dofmanager::isfieldremapped(std::shared_ptr<rawfield> rf)
+{
+    synchronize();
+    
+    std::unordered_map<rawfield*, bool>::iterator it = myisfieldremapped.find(rf.get());
+    
+    return (it != myisfieldremapped.end() && it->second);
+}
+
 long long int dofmanager::allcountdofs(void)
 {
     synchronize();
@@ -738,6 +1313,40 @@ long long int dofmanager::allcountdofs(void)
     return out;
 }
 
+std::vector<bool> dofmanager::isdofowned(void)
+{
+    synchronize();
+    
+    std::vector<bool> output(numberofdofs, true);
+    
+    if (slmpi::count() == 1)
+        return output;
+    
+    std::shared_ptr<dtracker> mydtracker = universe::getrawmesh()->getdtracker();
+    
+    mydtracker->errorundefined();
+    
+    std::vector<bool> isowndr = mydtracker->isdisjointregionowned();
+    
+    for (int fieldindex = 0; fieldindex < rangebegin.size(); fieldindex++)
+    {
+        for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+        {
+            if (isowndr[disjreg] || primalondisjreg[fieldindex][disjreg] != NULL)
+                continue;
+            
+            for (int ff = 0; ff < rangebegin[fieldindex][disjreg].size(); ff++)
+            {
+                int numdofshere = countrange(fieldindex, disjreg);
+                for (int i = 0; i < numdofshere; i++)
+                    output[rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i] = false;
+            }
+        }
+    }
+    
+    return output;
+}
+
 int dofmanager::countformfunctions(int disjointregion)
 {
     synchronize();
@@ -745,6 +1354,309 @@ int dofmanager::countformfunctions(int disjointregion)
     return rangebegin[selectedfieldnumber][disjointregion].size();
 }
 
+std::vector<std::vector<int>> dofmanager::getsplits(std::vector<int> splitnumber, int numsplits)
+{
+    std::vector<std::vector<int>> output(numsplits);
+    
+    for (int fieldindex = 0; fieldindex < rangebegin.size(); fieldindex++)
+    {
+        std::vector<int>& cursplit = output[splitnumber[fieldindex]];
+        
+        for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+        {
+            // The port dofs are in a separate split:
+            if (primalondisjreg[fieldindex][disjreg] != NULL)
+                continue;
+            
+            for (int ff = 0; ff < rangebegin[fieldindex][disjreg].size(); ff++)
+            {
+                int numdofshere = countrange(fieldindex, disjreg);
+                for (int i = 0; i < numdofshere; i++)
+                    cursplit.push_back(rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i);
+            }
+        }
+    }
+    
+    if (myrawportmap.size() > 0)
+    {
+        std::vector<int> portdofs = {};
+        for (auto it = myrawportmap.begin(); it != myrawportmap.end(); it++)
+            portdofs.push_back(it->second);
+        output.push_back(portdofs);
+    }
+    
+    for (int s = 0; s < output.size(); s++)
+        std::sort(output[s].begin(), output[s].end());
+    
+    return output;
+}
+
+std::vector<std::vector<int>> dofmanager::getfieldsplits(void)
+{
+    synchronize();
+    
+    // Split number of every field (the components of an interleaved group share a split):
+    std::vector<int> splitnumber(myfields.size(), -1);
+    int numsplits = 0;
+    for (int i = 0; i < myfields.size(); i++)
+    {
+        if (splitnumber[i] != -1)
+            continue;
+        splitnumber[i] = numsplits;
+        
+        for (int g = 0; g < myinterleavedfields.size(); g++)
+        {
+            if (std::find(myinterleavedfields[g].begin(), myinterleavedfields[g].end(), myfields[i]) == myinterleavedfields[g].end())
+                continue;
+            for (int c = 0; c < myinterleavedfields[g].size(); c++)
+            {
+                int fieldindex = std::find(myfields.begin(), myfields.end(), myinterleavedfields[g][c]) - myfields.begin();
+                if (fieldindex < myfields.size())
+                    splitnumber[fieldindex] = numsplits;
+            }
+        }
+        numsplits++;
+    }
+    
+    return getsplits(splitnumber, numsplits);
+}
+
+std::vector<std::vector<int>> dofmanager::getharmonicsplits(void)
+{
+    synchronize();
+    
+    // Harmonic number of every field:
+    std::vector<int> harmonicnumbers(myfields.size(), 1);
+    for (int i = 0; i < myfields.size(); i++)
+    {
+        std::unordered_map<rawfield*, int>::iterator it = myharmonicnumbers.find(myfields[i].get());
+        if (it != myharmonicnumbers.end())
+            harmonicnumbers[i] = it->second;
+    }
+    
+    // One split per harmonic in increasing harmonic order:
+    std::vector<int> harms = harmonicnumbers;
+    std::sort(harms.begin(), harms.end());
+    harms.erase(std::unique(harms.begin(), harms.end()), harms.end());
+    
+    std::vector<int> splitnumber(myfields.size());
+    for (int i = 0; i < myfields.size(); i++)
+        splitnumber[i] = std::lower_bound(harms.begin(), harms.end(), harmonicnumbers[i]) - harms.begin();
+    
+    return getsplits(splitnumber, harms.size());
+}
+
+std::vector<std::vector<double>> dofmanager::getrigidbodymodes(void)
+{
+    synchronize();
+    
+    std::vector<double>* nodecoords = universe::getrawmesh()->getelements()->getbarycenters(0);
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    
+    // The components of an interleaved group share the rotation modes:
+    std::vector<std::vector<int>> groups = {};
+    std::vector<bool> isgrouped(myfields.size(), false);
+    for (int g = 0; g < myinterleavedfields.size(); g++)
+    {
+        std::vector<int> curgroup = {};
+        for (int c = 0; c < myinterleavedfields[g].size(); c++)
+        {
+            int fieldindex = std::find(myfields.begin(), myfields.end(), myinterleavedfields[g][c]) - myfields.begin();
+            if (fieldindex < myfields.size())
+                curgroup.push_back(fieldindex);
+        }
+        if (curgroup.size() != myinterleavedfields[g].size())
+            continue;
+        for (int c = 0; c < curgroup.size(); c++)
+            isgrouped[curgroup[c]] = true;
+        groups.push_back(curgroup);
+    }
+    for (int i = 0; i < myfields.size(); i++)
+    {
+        if (isgrouped[i] == false)
+            groups.push_back({i});
+    }
+    
+    std::vector<std::vector<double>> output = {};
+    
+    for (int g = 0; g < groups.size(); g++)
+    {
+        int numcomps = groups[g].size();
+        
+        bool ish1 = (numcomps <= 3);
+        for (int c = 0; c < numcomps; c++)
+            ish1 = (ish1 && myfields[groups[g][c]]->gettypename() == "h1");
+        if (ish1 == false)
+            continue;
+        
+        // One translation per component and the rotations in the plane/space:
+        int numrotations = 0;
+        if (numcomps == 2)
+            numrotations = 1;
+        if (numcomps == 3)
+            numrotations = 3;
+        
+        std::vector<std::vector<double>> modes(numcomps+numrotations, std::vector<double>(numberofdofs, 0.0));
+        
+        for (int c = 0; c < numcomps; c++)
+        {
+            int fieldindex = groups[g][c];
+            
+            // Linear functions only have nonzero coefficients on the vertex form functions:
+            for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+            {
+                if (mydisjointregions->getelementtypenumber(disjreg) != 0 || rangebegin[fieldindex][disjreg].size() == 0 || primalondisjreg[fieldindex][disjreg] != NULL)
+                    continue;
+                
+                int firstnode = mydisjointregions->getrangebegin(disjreg);
+                int numdofshere = countrange(fieldindex, disjreg);
+                for (int i = 0; i < numdofshere; i++)
+                {
+                    int dof = rangebegin[fieldindex][disjreg][0] + rangestep[fieldindex][disjreg]*i;
+                    double x = nodecoords->at(3*(firstnode+i)+0), y = nodecoords->at(3*(firstnode+i)+1), z = nodecoords->at(3*(firstnode+i)+2);
+                    
+                    modes[c][dof] = 1.0;
+                    
+                    if (numcomps == 2)
+                        modes[2][dof] = (c == 0) ? -y : x;
+                    if (numcomps == 3)
+                    {
+                        // Rotations (0,-z,y), (z,0,-x) and (-y,x,0):
+                        double rot[3][3] = {{0.0,-z,y},{z,0.0,-x},{-y,x,0.0}};
+                        for (int r = 0; r < 3; r++)
+                            modes[3+r][dof] = rot[r][c];
+                    }
+                }
+            }
+        }
+        
+        output.insert(output.end(), modes.begin(), modes.end());
+    }
+    
+    return output;
+}
+
+std::vector<int> dofmanager::getlowestorderdofs(void)
+{
+    synchronize();
+    
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    hierarchicalformfunction myhff;
+    
+    std::vector<int> output = {};
+    
+    for (int fieldindex = 0; fieldindex < rangebegin.size(); fieldindex++)
+    {
+        std::string fieldtypename = myfields[fieldindex]->gettypename();
+        int lowestorder = myhff.getminorder(fieldtypename);
+        
+        for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+        {
+            // The port dofs are added below:
+            if (rangebegin[fieldindex][disjreg].size() == 0 || primalondisjreg[fieldindex][disjreg] != NULL)
+                continue;
+            
+            std::shared_ptr<hierarchicalformfunction> myformfunction = selector::select(mydisjointregions->getelementtypenumber(disjreg), fieldtypename);
+            int numlowest = myformfunction->count(lowestorder, mydisjointregions->getelementdimension(disjreg), 0);
+            
+            for (int ff = 0; ff < std::min(numlowest, (int)rangebegin[fieldindex][disjreg].size()); ff++)
+            {
+                int numdofshere = countrange(fieldindex, disjreg);
+                for (int i = 0; i < numdofshere; i++)
+                    output.push_back(rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i);
+            }
+        }
+    }
+    
+    for (auto it = myrawportmap.begin(); it != myrawportmap.end(); it++)
+        output.push_back(it->second);
+    
+    std::sort(output.begin(), output.end());
+    
+    return output;
+}
+
+void dofmanager::getvertexdofs(std::vector<int>& dofs, std::vector<int>& nodes, std::vector<int>& fields)
+{
+    getfirstdofs("h1", 0, dofs, nodes, fields);
+}
+
+void dofmanager::getedgedofs(std::vector<int>& dofs, std::vector<int>& edges, std::vector<int>& fields)
+{
+    getfirstdofs("hcurl", 1, dofs, edges, fields);
+}
+
+void dofmanager::getfirstdofs(std::string fieldtypename, int elementtypenumber, std::vector<int>& dofs, std::vector<int>& elems, std::vector<int>& fields)
+{
+    synchronize();
+    
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    
+    dofs = {}; elems = {}; fields = {};
+    
+    for (int fieldindex = 0; fieldindex < rangebegin.size(); fieldindex++)
+    {
+        if (myfields[fieldindex]->gettypename() != fieldtypename)
+            continue;
+            
+        for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+        {
+            if (mydisjointregions->getelementtypenumber(disjreg) != elementtypenumber || rangebegin[fieldindex][disjreg].size() == 0 || primalondisjreg[fieldindex][disjreg] != NULL)
+                continue;
+            
+            int firstelem = mydisjointregions->getrangebegin(disjreg);
+            int numdofshere = countrange(fieldindex, disjreg);
+            for (int i = 0; i < numdofshere; i++)
+            {
+                dofs.push_back(rangebegin[fieldindex][disjreg][0] + rangestep[fieldindex][disjreg]*i);
+                elems.push_back(firstelem+i);
+                fields.push_back(fieldindex);
+            }
+        }
+    }
+}
+
+std::vector<std::vector<int>> dofmanager::getelementinteriordofs(void)
+{
+    synchronize();
+    
+    disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
+    int meshdim = universe::getrawmesh()->getmeshdimension();
+    
+    // Index of the first element of every disjoint region of highest dimension in the output (-1 for the others):
+    std::vector<int> firstelement(mydisjointregions->count(), -1);
+    int numelems = 0;
+    for (int disjreg = 0; disjreg < mydisjointregions->count(); disjreg++)
+    {
+        if (mydisjointregions->getelementdimension(disjreg) == meshdim)
+        {
+            firstelement[disjreg] = numelems;
+            numelems += mydisjointregions->countelements(disjreg);
+        }
+    }
+    
+    std::vector<std::vector<int>> output(numelems);
+    
+    for (int fieldindex = 0; fieldindex < rangebegin.size(); fieldindex++)
+    {
+        for (int disjreg = 0; disjreg < rangebegin[fieldindex].size(); disjreg++)
+        {
+            // Ported disjoint regions share a single dof for all elements:
+            if (firstelement[disjreg] == -1 || primalondisjreg[fieldindex][disjreg] != NULL)
+                continue;
+            
+            for (int ff = 0; ff < rangebegin[fieldindex][disjreg].size(); ff++)
+            {
+                int numdofshere = countrange(fieldindex, disjreg);
+                for (int i = 0; i < numdofshere; i++)
+                    output[firstelement[disjreg]+i].push_back(rangebegin[fieldindex][disjreg][ff] + rangestep[fieldindex][disjreg]*i);
+            }
+        }
+    }
+    
+    return output;
+}
+
 std::vector<std::vector<indexmat>> dofmanager::discovernewconstraints(std::vector<int> neighbours, std::vector<indexmat> senddofinds, std::vector<indexmat> recvdofinds)
 {
     // New constraints can only appear at the outer overlap/no-overlap interfaces.
@@ -846,6 +1758,32 @@ indexmat dofmanager::getaddresses(std::shared_ptr<rawfield> inputfield, int fiel
 {
     synchronize();
     
+    if (elementlist.size() == 0)
+        return computeaddresses(inputfield, fieldinterpolationorder, elementtypenumber, elementlist, fieldphysreg);
+    
+    std::vector<long long int> key = {(long long int)inputfield.get(), fieldinterpolationorder, elementtypenumber, fieldphysreg, (long long int)elementlist.size(), elementlist[0]};
+    
+    std::vector<std::pair<std::vector<int>, indexmat>>& candidates = myaddresstables->tables[key];
+    for (int i = 0; i < candidates.size(); i++)
+    {
+        if (candidates[i].first == elementlist)
+            return candidates[i].second;
+    }
+    
+    indexmat output = computeaddresses(inputfield, fieldinterpolationorder, elementtypenumber, elementlist, fieldphysreg);
+    
+    long long int numbytes = memoryusage::countbytes(elementlist) + output.count()*sizeof(int);
+    if (myaddresstables->numbytes + numbytes <= maxaddresstablebytes)
+    {
+        candidates.push_back(std::make_pair(elementlist, output));
+        myaddresstables->numbytes += numbytes;
+    }
+    
+    return output;
+}
+
+indexmat dofmanager::computeaddresses(std::shared_ptr<rawfield> inputfield, int fieldinterpolationorder, int elementtypenumber, std::vector<int> &elementlist, int fieldphysreg)
+{    
     elements* myelements = universe::getrawmesh()->getelements();
     disjointregions* mydisjointregions = universe::getrawmesh()->getdisjointregions();
 
@@ -903,7 +1841,7 @@ indexmat dofmanager::getaddresses(std::shared_ptr<rawfield> inputfield, int fiel
                 currentsubelem -= mydisjointregions->getrangebegin(currentdisjointregion);
                 
                 if (primalondisjreg[selectedfieldnumber][currentdisjointregion] == NULL)
-                    adresses[ff*numcols+i] = rangebegin[selectedfieldnumber][currentdisjointregion][formfunctionindex] + currentsubelem;
+                    adresses[ff*numcols+i] = rangebegin[selectedfieldnumber][currentdisjointregion][formfunctionindex] + rangestep[selectedfieldnumber][currentdisjointregion]*currentsubelem;
                 else
                     adresses[ff*numcols+i] = rangebegin[selectedfieldnumber][currentdisjointregion][formfunctionindex] + 0;
             }
@@ -916,3 +1854,16 @@ indexmat dofmanager::getaddresses(std::shared_ptr<rawfield> inputfield, int fiel
     return output;
 }
 
+
+memoryusage dofmanager::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    output.add("dof ranges", memoryusage::countbytes(rangebegin) + memoryusage::countbytes(rangeend) + memoryusage::countbytes(rangestep));
+    output.add("field orders", memoryusage::countbytes(myfieldorders));
+    output.add("dof renumbering", memoryusage::countbytes(myrenumbering) + memoryusage::countbytes(mydisjregsignatures));
+    output.add("address tables", myaddresstables->numbytes);
+    output.add("constraint split", memoryusage::countbytes(mysplitconstraints) + memoryusage::countbytes(mysplitrenumtolocalindex) + 4*(mysplitainds.count() + mysplitdinds.count()));
+    
+    return output;
+}
@@ -18,12 +18,48 @@
 #include "indexmat.h"
 #include <memory>
 #include <unordered_map>
+#include <map>
+#include <tuple>
+#include <algorithm>
 #include "selector.h"
 #include "rawport.h"
+#include "memoryusage.h"
+#include "profiler.h"
 
 class rawfield;
 class rawport;
 
+// Address tables of 'dofmanager::getaddresses'. The key is {field, order, element type, physical region, number
+// of elements, first element} and the element list of every table is kept to compare it entry by entry:
+class addresstables
+{
+    public:
+        
+        std::map<std::vector<long long int>, std::vector<std::pair<std::vector<int>, indexmat>>> tables = {};
+        
+        long long int numbytes = 0;
+};
+
+// Master/slave relations of 'dofmanager::getslaverelations'. The value of slave dof 'slaves[i]' is the sum of
+// coefs[k] times the value of dof masters[k] for all k in [masterbegin[i], masterbegin[i+1]). No master is a slave:
+class slaverelations
+{
+    public:
+        
+        // Structure the relations were computed for:
+        int meshnumber = -1, numdofs = -1;
+        
+        // Index in 'slaves' of every dof (-1 if not a slave):
+        std::vector<int> slavenumber = {};
+        
+        std::vector<int> slaves = {};
+        std::vector<int> masterbegin = {0};
+        std::vector<int> masters = {};
+        std::vector<double> coefs = {};
+        
+        int count(void) { return slaves.size(); };
+};
+
 class dofmanager
 {
     private:
@@ -60,6 +96,18 @@ class dofmanager
         std::vector<std::vector<std::vector< int >>> rangebegin = {};
         std::vector<std::vector<std::vector< int >>> rangeend = {};
         
+        // 'rangestep[selectedfieldnumber][12]' gives the index difference between
+        // the dofs of two consecutive elements in the range. It is 1 except for 
+        // interleaved components where it equals the number of components.
+        std::vector<std::vector< int >> rangestep = {};
+        
+        // Groups of component fields whose dofs are numbered node by node 
+        // ({u1x,u1y,u1z,u2x,...}) instead of component by component:
+        std::vector<std::vector<std::shared_ptr<rawfield>>> myinterleavedfields = {};
+        
+        // Harmonic number of every field added to the structure (fields not in it are harmonic 1):
+        std::unordered_map<rawfield*, int> myharmonicnumbers = {};
+        
         bool isitmanaged = true;
         
         
@@ -74,18 +122,70 @@ class dofmanager
         // To avoid infinite recursive calls:
         bool issynchronizing = false;
         
+        // Number of elements and checksum of the element barycenters of every disjoint region of the current mesh
+        // in format {count0,checksum0,count1,...}. It is used to know the disjoint regions whose elements changed:
+        std::vector<double> mydisjregsignatures = {};
+        std::vector<double> getdisjregsignatures(void);
+        
+        // New index of every dof of the structure before the last synchronization (-1 if renumbered, see 'getrenumbering'):
+        std::vector<int> myrenumbering = {};
+        // Mesh number before the last synchronization:
+        int myrenumberingsource = -1;
+        // Know for every field if all its dofs are in 'myrenumbering':
+        std::unordered_map<rawfield*, bool> myisfieldremapped = {};
+        
+        // Map the dof blocks of every field on the disjoint regions with unchanged elements and interpolation order:
+        void remap(std::vector<std::shared_ptr<rawfield>>& prevfields, std::vector<std::vector<int>>& prevorders, std::vector<std::vector<std::vector<int>>>& prevrangebegin, std::vector<std::vector<std::vector<int>>>& prevrangeend, std::vector<std::vector<int>>& prevrangestep, std::unordered_map<rawport*, int>& prevportmap, std::vector<double>& prevsignatures, int prevnumberofdofs);
+        
     
+        // Get the index of a field in the structure. The field is added if not yet in it.
+        int addfield(std::shared_ptr<rawfield> fieldtoadd);
+        
         // Actual function to add to the structure.
         void addtostructure(std::shared_ptr<rawfield> fieldtoadd, std::vector<int> selecteddisjointregions);
         
+        // Get the sorted dof indexes of every split given the split number of every field. The port dofs are in an additional last split:
+        std::vector<std::vector<int>> getsplits(std::vector<int> splitnumber, int numsplits);
+        
+        // The address tables only depend on the dof structure. They are shared with the copies of this object
+        // and replaced by new empty tables whenever the structure changes:
+        std::shared_ptr<addresstables> myaddresstables = std::shared_ptr<addresstables>(new addresstables);
+        void clearaddresstables(void) { myaddresstables = std::shared_ptr<addresstables>(new addresstables); };
+        
+        // Calls to 'tie' in format {field, slave region, master region, first and second mapping data, factor}:
+        std::vector<std::tuple<std::shared_ptr<rawfield>, int, int, std::vector<double>, std::vector<double>, double>> myties = {};
+        // Relations for the current structure (NULL if not yet computed):
+        std::shared_ptr<slaverelations> myslaverelations = NULL;
+        // Add the relations of a tie to 'rels' (without resolving the masters that are slaves):
+        void addtie(std::tuple<std::shared_ptr<rawfield>, int, int, std::vector<double>, std::vector<double>, double>& tie, std::vector<std::vector<std::pair<int, double>>>& rels);
+        
+        // Split of the dofs for the last constraint set given to 'getconstraintsplit':
+        std::vector<bool> mysplitconstraints = {};
+        indexmat mysplitainds, mysplitdinds;
+        std::vector<int> mysplitrenumtolocalindex = {};
+        
+        // Compute the addresses without the tables:
+        indexmat computeaddresses(std::shared_ptr<rawfield> inputfield, int fieldinterpolationorder, int elementtypenumber, std::vector<int> &elementlist, int fieldphysreg);
+        
+        // Dofs of the first form function of the fields of a type on the unported disjoint regions of an element type (see 'getvertexdofs'):
+        void getfirstdofs(std::string fieldtypename, int elementtypenumber, std::vector<int>& dofs, std::vector<int>& elems, std::vector<int>& fields);
+        
+        // Number of dofs in the range of any form function of a field on a disjoint region:
+        int countrange(int fieldindex, int disjreg) { return (rangeend[fieldindex][disjreg][0] - rangebegin[fieldindex][disjreg][0])/rangestep[fieldindex][disjreg] + 1; };
+        
     public:
         
+        // Maximum size in bytes of the address tables kept by every dof structure:
+        static long long int maxaddresstablebytes;
+        
         dofmanager(void);
         // Unmanaged structure:
         dofmanager(int numdofs);
         
         bool ismanaged(void) { return isitmanaged; };
         
+        int getmeshnumber(void) { return mymeshnumber; };
+        
         void donotsynchronize(void);
         
         // Add a rawport to the structure:
@@ -93,7 +193,15 @@ class dofmanager
         
         // 'addtostructure' defines dofs for a field on the disjoint 
         // regions. Only fields with a single component are accepted.
-        void addtostructure(std::shared_ptr<rawfield> fieldtoadd, int physicalregionnumber);
+        // For a multiharmonic field provide the harmonic number of the field added.
+        void addtostructure(std::shared_ptr<rawfield> fieldtoadd, int physicalregionnumber, int harmonicnumber = 1);
+        
+        // Number the dofs of the component fields node by node. All components must have the same type
+        // and interpolation orders and must be added to the structure on the same regions. This must be
+        // called before any of the components is added to the structure.
+        void interleave(std::vector<std::shared_ptr<rawfield>> components);
+        // Get the number of components interleaved if all dofs are in interleaved groups of that size (1 otherwise):
+        int getblocksize(void);
         
         // Always select the field before accessing the dof structure.
         void selectfield(std::shared_ptr<rawfield> selectedfield);
@@ -103,6 +211,14 @@ class dofmanager
         
         int getrangebegin(int disjreg, int formfunc);
         int getrangeend(int disjreg, int formfunc);
+        // The dof of the ith element in the range is at getrangebegin + i * getrangestep:
+        int getrangestep(int disjreg);
+        
+        // Get the vector transfer blocks (see 'rawvec::getblocks') of the selected field for the first 'numformfunctions[i]'
+        // form functions on disjoint region 'disjregs[i]'. Form functions without dofs are skipped. Ported disjoint regions
+        // give a block of step 0 if 'withports' is true and are skipped otherwise. Block 'b' is for form function number
+        // 'blockformfunctions[b]' of disjoint region 'disjregs[blockdisjregindexes[b]]'.
+        void gettransferblocks(std::vector<int>& disjregs, std::vector<int>& numformfunctions, bool withports, std::vector<int>& rangebegins, std::vector<int>& steps, std::vector<int>& lengths, std::vector<int>& blockdisjregindexes, std::vector<int>& blockformfunctions);
         
         // Get the port dof index:
         int getaddress(rawport* prt);
@@ -117,8 +233,21 @@ class dofmanager
         
         bool isported(int disjreg);
         
-        // For all types of constraints:
+        // Eliminate the nodal dofs of field 'rf' on boundary region 'gamma1' by expressing them through the dofs at the matching
+        // nodes on 'gamma2'. The mapping from 'gamma1' to 'gamma2' is a translation of length dat2[0] along direction 'dat1' or a
+        // rotation of dat2[0], dat2[1] and dat2[2] degrees around the x, y and z axis with center 'dat1' (as in 'periodicitycondition').
+        // The slave value is 'factor' times the master value (rotated back for vector fields). The meshes on 'gamma1' and 'gamma2'
+        // must match and the field must be 'h1' type of order 1 on them. Slaves that are also constrained take the master values.
+        void tie(std::shared_ptr<rawfield> rf, int gamma1, int gamma2, std::vector<double> dat1, std::vector<double> dat2, double factor);
+        bool hasslaves(void) { return (myties.size() > 0); };
+        // The relations are kept as long as the dof structure is unchanged. NULL is returned if there are no slaves:
+        std::shared_ptr<slaverelations> getslaverelations(void);
+        
+        // For all types of constraints (the slaves are included):
         std::vector<bool> isconstrained(void);
+        // Same as 'gentools::findtruefalse(isconstrained, Dinds, Ainds, renumtolocalindex)'. The indexes are kept
+        // and shared by all matrices as long as the constraint set is unchanged. They must not be modified:
+        void getconstraintsplit(std::vector<bool>& isconstrained, indexmat& Ainds, indexmat& Dinds, std::vector<int>& renumtolocalindex);
         indexmat getconstrainedindexes(void);
         
         int countdisjregconstraineddofs(void);
@@ -127,6 +256,9 @@ class dofmanager
         int countgaugeddofs(void);
         indexmat getgaugedindexes(void);
         
+        // Get all dofs of the inactive fields (held at zero):
+        indexmat getinactiveindexes(void);
+        
         // Get the conditionally constrained adresses as well as the constraint values:
         std::pair<indexmat, densemat> getconditionalconstraintdata(void);
         
@@ -143,8 +275,39 @@ class dofmanager
         
         int countdofs(void);
         long long int allcountdofs(void);
+        
+        // When the mesh changes only the dofs of the fields on the disjoint regions whose elements or interpolation
+        // order changed get a new meaning. Return true if the structure was last synchronized from mesh number
+        // 'meshnumber' and give the new index of every dof of the previous structure in 'renumbering' (-1 for the
+        // dofs that cannot be mapped). The port dofs are always mapped:
+        bool getrenumbering(int meshnumber, std::vector<int>& renumbering);
+        // Know if all dofs of a field are mapped by the renumbering:
+        bool isfieldremapped(std::shared_ptr<rawfield> rf);
+        // True for the dofs on the disjoint regions owned by this rank (see 'dtracker::isdisjointregionowned'):
+        std::vector<bool> isdofowned(void);
         int countformfunctions(int disjointregion);
         
+        // Get for every element of highest dimension the indexes of all dofs (all fields) associated
+        // to the element interior. These bubble dofs are only coupled to dofs in their own element.
+        std::vector<std::vector<int>> getelementinteriordofs(void);
+        
+        // Get the sorted dof indexes of every field split. There is one split per field, all components of an
+        // interleaved group are in the same split and the port dofs (if any) are in an additional last split.
+        std::vector<std::vector<int>> getfieldsplits(void);
+        // Same with one split per harmonic number (all fields together). The port dofs (if any) are in an additional last split.
+        std::vector<std::vector<int>> getharmonicsplits(void);
+        // Get the sorted indexes of the dofs of the lowest order form functions of every field (e.g. the vertex dofs of the 'h1' fields).
+        // The hierarchical form functions of the lower orders are the first ones on every disjoint region. The port dofs are included:
+        std::vector<int> getlowestorderdofs(void);
+        // Get for every vertex form function of the 'h1' fields its dof index 'dofs[i]', its point element number 'nodes[i]' and
+        // the index 'fields[i]' of its field in this dof manager. The vertex dofs of ported disjoint regions are not included:
+        void getvertexdofs(std::vector<int>& dofs, std::vector<int>& nodes, std::vector<int>& fields);
+        // Same for the lowest order (order 0) edge form functions of the 'hcurl' fields with their line element number in 'edges':
+        void getedgedofs(std::vector<int>& dofs, std::vector<int>& edges, std::vector<int>& fields);
+        // Get the near-nullspace vectors (values at all dofs) of the 'h1' fields built from the node coordinates. Each interleaved
+        // group of 2 or 3 components has its rigid body modes (translations and rotations), any other 'h1' field has the constant.
+        std::vector<std::vector<double>> getrigidbodymodes(void);
+        
         // Return {sendnewconstrainedinds, recvnewconstrainedinds, sendunconstrainedinds, recvunconstrainedinds} where
         //
         // - sendnewconstrainedinds[n] are the indexes of all interface dofs constrained on this rank but not constrained on the neighbour
@@ -156,6 +319,9 @@ class dofmanager
         
         void print(void);
         
+        // Bytes used by the dof ranges:
+        memoryusage getmemoryusage(void);
+        
         // 'getaddresses' is required in the matrix generation step.
         // It returns an indexmat representing a numberofformfunctions
         // by elementlist.size() matrix (row-major). The matrix gives 
@@ -163,6 +329,9 @@ class dofmanager
         // 'inputfield' defined on the elements in elementlist can be found. 
         // Address -1 is used for field dofs not in 'fieldphysreg'.
         //
+        // The output is kept and shared by all calls for the same arguments until
+        // the dof structure changes. It must therefore not be modified.
+        //
         indexmat getaddresses(std::shared_ptr<rawfield> inputfield, int fieldinterpolationorder, int elementtypenumber, std::vector<int> &elementlist, int fieldphysreg);
                                                         
 };
@@ -0,0 +1,136 @@
+#include "elementmatrixcache.h"
+
+
+void elementmatrixcache::clear(void)
+{
+    isitvalid = false;
+    groups = {};
+}
+
+bool elementmatrixcache::isvalid(std::string description, long long int numdofs)
+{
+    if (isitvalid == false || description != mydescription || numdofs != mynumdofs)
+        return false;
+
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+
+    return (rm->getmeshnumber() == mymeshnumber && rm->getstate() == mymeshstate && universe::getsession()->fundamentalfrequency == myfundamentalfrequency);
+}
+
+void elementmatrixcache::setvalid(std::string description, long long int numdofs)
+{
+    isitvalid = true;
+
+    mydescription = description;
+    mynumdofs = numdofs;
+    mymeshnumber = universe::getrawmesh()->getmeshnumber();
+    mymeshstate = universe::getrawmesh()->getstate();
+    myfundamentalfrequency = universe::getsession()->fundamentalfrequency;
+}
+
+std::vector<int> elementmatrixcache::getchanged(elementmatrixblock& block, std::vector<int>& elementnumbers, std::vector<densemat>& fieldcoefs, double reltol)
+{
+    int numelems = elementnumbers.size();
+
+    bool ismatching = (block.stiffnesses.size() > 0 && block.elementnumbers == elementnumbers && block.fieldcoefs.size() == fieldcoefs.size());
+    for (int f = 0; f < fieldcoefs.size() && ismatching; f++)
+        ismatching = (block.fieldcoefs[f].countrows() == fieldcoefs[f].countrows() && block.fieldcoefs[f].countcolumns() == fieldcoefs[f].countcolumns());
+
+    if (not(ismatching))
+    {
+        block = elementmatrixblock();
+        block.elementnumbers = elementnumbers;
+        block.fieldcoefs = fieldcoefs;
+
+        std::vector<int> all(numelems);
+        for (int i = 0; i < numelems; i++)
+            all[i] = i;
+        return all;
+    }
+
+    std::vector<bool> ischanged(numelems, false);
+    for (int f = 0; f < fieldcoefs.size(); f++)
+    {
+        double threshold = reltol * std::max(block.fieldcoefs[f].maxabs(), fieldcoefs[f].maxabs());
+
+        long long int numrows = fieldcoefs[f].countrows();
+        double* oldvals = block.fieldcoefs[f].getvalues();
+        double* newvals = fieldcoefs[f].getvalues();
+
+        for (long long int r = 0; r < numrows; r++)
+        {
+            for (int i = 0; i < numelems; i++)
+            {
+                if (std::abs(newvals[r*numelems+i] - oldvals[r*numelems+i]) > threshold)
+                    ischanged[i] = true;
+            }
+        }
+    }
+
+    std::vector<int> changed = {};
+    for (int i = 0; i < numelems; i++)
+    {
+        if (ischanged[i])
+            changed.push_back(i);
+    }
+
+    // The reference coefficients are the ones of the last element matrix computation:
+    for (int f = 0; f < fieldcoefs.size(); f++)
+    {
+        long long int numrows = fieldcoefs[f].countrows();
+        double* oldvals = block.fieldcoefs[f].getvalues();
+        double* newvals = fieldcoefs[f].getvalues();
+
+        for (long long int r = 0; r < numrows; r++)
+        {
+            for (int j = 0; j < changed.size(); j++)
+                oldvals[r*numelems+changed[j]] = newvals[r*numelems+changed[j]];
+        }
+    }
+
+    return changed;
+}
+
+void elementmatrixcache::update(elementmatrixblock& block, std::vector<int>& indexes, std::vector<std::vector<std::vector<densemat>>>& stiffnesses, int numtfformfunctions)
+{
+    int numelems = block.elementnumbers.size();
+
+    // Allocate the element matrices of all elements at the first update:
+    if (block.stiffnesses.size() == 0)
+    {
+        block.stiffnesses = stiffnesses;
+        for (int htf = 0; htf < stiffnesses.size(); htf++)
+        {
+            for (int hdof = 0; hdof < stiffnesses[htf].size(); hdof++)
+            {
+                if (stiffnesses[htf][hdof].size() > 0)
+                    block.stiffnesses[htf][hdof] = {densemat(stiffnesses[htf][hdof][0].countrows(), numelems, 0.0)};
+            }
+        }
+    }
+
+    for (int htf = 0; htf < stiffnesses.size(); htf++)
+    {
+        for (int hdof = 0; hdof < stiffnesses[htf].size(); hdof++)
+        {
+            if (stiffnesses[htf][hdof].size() > 0)
+                block.stiffnesses[htf][hdof][0].insertatcolumns(indexes, stiffnesses[htf][hdof][0]);
+        }
+    }
+    block.numtfformfunctions = numtfformfunctions;
+}
+
+std::vector<std::vector<std::vector<densemat>>> elementmatrixcache::getstiffnesses(elementmatrixblock& block)
+{
+    std::vector<std::vector<std::vector<densemat>>> output = block.stiffnesses;
+
+    for (int htf = 0; htf < output.size(); htf++)
+    {
+        for (int hdof = 0; hdof < output[htf].size(); hdof++)
+        {
+            if (output[htf][hdof].size() > 0)
+                output[htf][hdof][0] = output[htf][hdof][0].copy();
+        }
+    }
+    return output;
+}
@@ -0,0 +1,72 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object stores the element matrices of a contribution together with the coefficients of the
+// fields in its coefficients at the time they were computed. At the next generation only the elements
+// whose field coefficients have changed by more than a relative tolerance are computed again (e.g. the
+// active front of a nonlinear problem). The other element matrices are assembled as they are.
+
+
+#ifndef ELEMENTMATRIXCACHE_H
+#define ELEMENTMATRIXCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cmath>
+#include <algorithm>
+#include "densemat.h"
+#include "universe.h"
+
+// Block of elements with a same total orientation:
+struct elementmatrixblock
+{
+    std::vector<int> elementnumbers = {};
+    // Coefficients of every field when the element matrices were computed (form functions x elements):
+    std::vector<densemat> fieldcoefs = {};
+    // Element matrices of every tf/dof harmonic pair as returned by 'contribution::computestiffnesses' (one column per element):
+    std::vector<std::vector<std::vector<densemat>>> stiffnesses = {};
+    int numtfformfunctions = 0;
+};
+
+class elementmatrixcache
+{
+    private:
+
+        bool isitvalid = false;
+
+        // Conditions under which the element matrices were computed:
+        std::string mydescription = "";
+        long long int mynumdofs = -1;
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+        double myfundamentalfrequency = -1;
+
+    public:
+
+        // Blocks of every group of disjoint regions in the 'contribution::generate' order:
+        std::vector<std::vector<elementmatrixblock>> groups = {};
+
+        // Forget all element matrices:
+        void clear(void);
+
+        // True if the element matrices are still valid (up to the field coefficient changes) provided the contribution description:
+        bool isvalid(std::string description, long long int numdofs);
+        // The element matrices are valid from now on:
+        void setvalid(std::string description, long long int numdofs);
+
+        // Get the indexes in 'elementnumbers' of the elements for which a field coefficient has changed by more than 'reltol'
+        // times the largest coefficient of that field in the block. The stored coefficients of these elements are updated.
+        // All elements are returned (and the block is reset) if the block was computed for other elements or fields.
+        static std::vector<int> getchanged(elementmatrixblock& block, std::vector<int>& elementnumbers, std::vector<densemat>& fieldcoefs, double reltol);
+        // Replace the element matrices at the indexes in the block by the ones provided:
+        static void update(elementmatrixblock& block, std::vector<int>& indexes, std::vector<std::vector<std::vector<densemat>>>& stiffnesses, int numtfformfunctions);
+        // Get a copy of all element matrices of the block (the assembly can modify them):
+        static std::vector<std::vector<std::vector<densemat>>> getstiffnesses(elementmatrixblock& block);
+
+};
+
+#endif
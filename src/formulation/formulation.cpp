@@ -1,9 +1,15 @@
 #include "formulation.h"
+#include "matrixfree.h"
+#include "staticcondensation.h"
+#include "distributedsystem.h"
+#include "metrics.h"
+#include "ddmcoarsespace.h"
+#include "memorypool.h"
 
 
 formulation::formulation(void)
 {
-    if (universe::myrawmesh == NULL)
+    if (universe::getsession()->myrawmesh == NULL)
     {
         std::cout << "Error in 'formulation' object: cannot define a formulation before the mesh is loaded" << std::endl;
         abort();
@@ -108,11 +114,11 @@ formulation& formulation::operator+=(integration integrationobject)
         {
             std::vector<int> dofharms = doffield->getharmonics();
             for (int h = 0; h < dofharms.size(); h++)
-                mydofmanager->addtostructure(doffield->harmonic(dofharms[h]), dofphysreg);
+                mydofmanager->addtostructure(doffield->harmonic(dofharms[h]), dofphysreg, dofharms[h]);
         }
         std::vector<int> tfharms = tffield->getharmonics();
         for (int h = 0; h < tfharms.size(); h++)
-            mydofmanager->addtostructure(tffield->harmonic(tfharms[h]), tfphysreg);
+            mydofmanager->addtostructure(tffield->harmonic(tfharms[h]), tfphysreg, tfharms[h]);
 
         // Create the contribution:
         contribution mycontribution(mydofmanager);
@@ -125,6 +131,7 @@ formulation& formulation::operator+=(integration integrationobject)
         mycontribution.setcoeffs(coeffs[slice]);
         
         mycontribution.setintegrationorderdelta(integrationorderdelta);
+        mycontribution.setquadraturerule(integrationobject.getquadraturerule());
         mycontribution.setnumfftcoeffs(integrationobject.getnumberofcoefharms());
         
         if (integrationobject.isbarycentereval)
@@ -148,6 +155,29 @@ formulation& formulation::operator+=(integration integrationobject)
     return *this;
 }
 
+memoryusage formulation::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    output.add("dof manager: ", mydofmanager->getmemoryusage());
+    if (myvec != NULL)
+        output.add("rhs vector", myvec->countbytes());
+    
+    std::vector<std::string> matnames = {"K matrix: ", "C matrix: ", "M matrix: "};
+    for (int i = 0; i < 3; i++)
+    {
+        if (mymat[i] != NULL)
+            output.add(matnames[i], mymat[i]->getmemoryusage());
+    }
+    
+    return output;
+}
+
+void formulation::printmemory(void)
+{
+    getmemoryusage().print("Formulation memory");
+}
+
 int formulation::countdofs(void)
 {
     return mydofmanager->countdofs(); 
@@ -158,6 +188,11 @@ long long int formulation::allcountdofs(void)
     return mydofmanager->allcountdofs();
 }
 
+void formulation::tie(int gamma1, int gamma2, field u, std::vector<double> dat1, std::vector<double> dat2, double factor)
+{
+    mydofmanager->tie(u.getpointer(), gamma1, gamma2, dat1, dat2, factor);
+}
+
 bool formulation::isstiffnessmatrixdefined(void)
 {
     return (mycontributions[1].size() != 0);
@@ -187,28 +222,179 @@ void formulation::generate(int m, int contributionnumber)
     if (contributionnumber >= mycontributions[m].size() || mycontributions[m][contributionnumber].size() == 0)
         return;
  
+    if (m == 0 && myprefetchedrhs != NULL && not(isprefetchedrhsused))
+        checkprefetchedrhs();
+    
+    profilephase phase("generate");
+    
+    if (metrics::isenabled())
+        metrics::set("dofs", mydofmanager->countdofs());
+    
     universe::allowestimatorupdate(true);
+    // Recycle the temporary value buffers during the generation:
+    memorypool::startpass();
         
     if (m == 0 && myvec == NULL)
         myvec = std::shared_ptr<rawvec>(new rawvec(mydofmanager));
     if (m > 0 && mymat[m-1] == NULL)
+    {
         mymat[m-1] = std::shared_ptr<rawmat>(new rawmat(mydofmanager));
+        mymat[m-1]->setsymmetric(issymmetricstorage);
+        mymat[m-1]->setsell(issellstorage);
+        // Add the contributions directly to the csr values if the sparsity pattern is known:
+        remappattern(m-1);
+        if (mypatterns[m-1] != NULL && mypatterns[m-1]->isdefined())
+        {
+            std::vector<bool> isconstr;
+            if (isconstraintcomputation)
+                isconstr = std::vector<bool>(mydofmanager->countdofs(), false);
+            else
+                isconstr = mydofmanager->isconstrained();
+            mymat[m-1]->streaminto(mypatterns[m-1], isconstr);
+        }
+    }
 
     std::vector<contribution> contributionstogenerate = mycontributions[m][contributionnumber];
     for (int i = 0; i < contributionstogenerate.size(); i++)
     {
+        // Already generated by 'prefetchrhs':
+        if (m == 0 && isprefetchedrhsused && myprefetchdescriptions[contributionnumber][i].size() > 0)
+            continue;
+        
         if (m == 0)
-            contributionstogenerate[i].generate(myvec, NULL);
+            contributionstogenerate[i].generate(myvec, NULL, iscontributioncacheused, isrigidcacheused, isrhsassemblycached, myelementcachereltol);
         else
-            contributionstogenerate[i].generate(NULL, mymat[m-1]);
+            contributionstogenerate[i].generate(NULL, mymat[m-1], iscontributioncacheused, isrigidcacheused, false, myelementcachereltol);
     }
     
+    memorypool::endpass();
     universe::allowestimatorupdate(false);
     
 }
 
+void formulation::prefetchrhs(void)
+{
+    profilescope scope("prefetch rhs");
+    
+    isstructurelocked = true;
+    
+    // Only the element values are computed here. The petsc vector is created by 'rhs' on the thread making the petsc calls:
+    std::shared_ptr<rawvec> prefetched(new rawvec(mydofmanager, true));
+    std::vector<std::vector<std::string>> descriptions(mycontributions[0].size());
+    
+    memorypool::startpass();
+    for (int j = 0; j < mycontributions[0].size(); j++)
+    {
+        descriptions[j] = std::vector<std::string>(mycontributions[0][j].size(), "");
+        for (int i = 0; i < mycontributions[0][j].size(); i++)
+        {
+            // Only the contributions whose description captures all dependencies can be checked before their reuse:
+            if (not(mycontributions[0][j][i].isfullydescribed()))
+                continue;
+            descriptions[j][i] = mycontributions[0][j][i].getdescription();
+            mycontributions[0][j][i].generate(prefetched, NULL, iscontributioncacheused, isrigidcacheused, isrhsassemblycached);
+        }
+    }
+    memorypool::endpass();
+    
+    myprefetchedrhs = prefetched;
+    myprefetchtime = universe::getsession()->currenttimestep;
+    myprefetchdescriptions = descriptions;
+    isprefetchedrhsused = false;
+}
+
+bool formulation::isrhsprefetchable(void)
+{
+    for (int j = 0; j < mycontributions[0].size(); j++)
+    {
+        for (int i = 0; i < mycontributions[0][j].size(); i++)
+        {
+            if (mycontributions[0][j][i].isfullydescribed())
+                return true;
+        }
+    }
+    return false;
+}
+
+void formulation::checkprefetchedrhs(void)
+{
+    bool isvalid = (myprefetchtime == universe::getsession()->currenttimestep && myprefetchedrhs->getdofmanager() == mydofmanager && myprefetchedrhs->size() == mydofmanager->countdofs());
+    
+    for (int j = 0; j < myprefetchdescriptions.size() && isvalid; j++)
+    {
+        for (int i = 0; i < myprefetchdescriptions[j].size() && isvalid; i++)
+        {
+            if (myprefetchdescriptions[j][i].size() > 0 && myprefetchdescriptions[j][i] != mycontributions[0][j][i].getdescription())
+                isvalid = false;
+        }
+    }
+    
+    if (isvalid)
+        isprefetchedrhsused = true;
+    else
+    {
+        myprefetchedrhs = NULL;
+        myprefetchdescriptions = {};
+    }
+}
+
+void formulation::remappattern(int KCM)
+{
+    if (mypatterns[KCM] == NULL || mypatterns[KCM]->isdefined() == false)
+        return;
+    
+    std::vector<int> renumbering;
+    if (mydofmanager->getrenumbering(mypatterns[KCM]->getmeshnumber(), renumbering))
+        mypatterns[KCM]->remap(mydofmanager->getmeshnumber(), renumbering, mydofmanager->countdofs());
+}
+
+void formulation::startanalysis(std::vector<int> contributionnumbers)
+{
+    std::shared_ptr<sparsitypattern> pattern = mypatterns[0];
+    if (isanalysispipelined == false || pattern == NULL || pattern->isfactorizationkept() == false || mymat[0] != NULL || isconstraintcomputation || isinteriorcondensed)
+        return;
+        
+    remappattern(0);
+    if (pattern->isdefined())
+        return;
+        
+    profilephase phase("symbolic pass");
+    
+    std::shared_ptr<rawmat> symbolic(new rawmat(mydofmanager));
+    symbolic->setsymmetric(issymmetricstorage);
+    
+    for (int i = 0; i < contributionnumbers.size(); i++)
+    {
+        int contributionnumber = contributionnumbers[i];
+        if (contributionnumber < 0 || contributionnumber >= mycontributions[1].size())
+            continue;
+        for (int j = 0; j < mycontributions[1][contributionnumber].size(); j++)
+        {
+            if (mycontributions[1][contributionnumber][j].generatepattern(symbolic) == false)
+                return;
+        }
+    }
+    
+    // Same port entries as in 'getmatrix':
+    std::pair<indexmat, indexmat> assocports = mydofmanager->findassociatedports();
+    symbolic->accumulate(assocports.first, assocports.second, densemat(assocports.first.count(), 1, 0.0));
+    std::tuple<indexmat, indexmat, densemat> portterms = getportrelations(0);
+    symbolic->accumulate(std::get<0>(portterms), std::get<1>(portterms), densemat(std::get<2>(portterms).countrows(), std::get<2>(portterms).countcolumns(), 0.0));
+    
+    std::vector<bool> isconstr = mydofmanager->isconstrained();
+    symbolic->process(isconstr);
+    symbolic->clearfragments();
+    
+    pattern->startanalysis(symbolic, "lu", isconstr);
+}
+
 void formulation::generate(void)
 {
+    std::vector<int> contributionnumbers(mycontributions[1].size());
+    for (int j = 0; j < mycontributions[1].size(); j++)
+        contributionnumbers[j] = j;
+    startanalysis(contributionnumbers);
+    
     for (int i = 0; i < mycontributions.size(); i++)
     {
         for (int j = 0; j < mycontributions[i].size(); j++)
@@ -253,6 +439,8 @@ void formulation::generatein(int rhskcm, std::vector<int> contributionnumbers)
 
 void formulation::generate(std::vector<int> contributionnumbers)
 {
+    startanalysis(contributionnumbers);
+    
     for (int i = 0; i < mycontributions.size(); i++)
     {
         for (int j = 0; j < contributionnumbers.size(); j++)
@@ -360,6 +548,16 @@ vec formulation::rhs(bool keepvector, bool dirichletandportupdate)
     if (myvec == NULL)
         myvec = std::shared_ptr<rawvec>(new rawvec(mydofmanager));
     
+    // Add the prefetched contributions skipped by the rhs generation:
+    if (isprefetchedrhsused)
+    {
+        myprefetchedrhs->createpetsc();
+        VecAXPY(myvec->getpetsc(), 1, myprefetchedrhs->getpetsc());
+        myprefetchedrhs = NULL;
+        myprefetchdescriptions = {};
+        isprefetchedrhsused = false;
+    }
+    
     vec output;   
     if (keepvector == false)
     {
@@ -368,6 +566,9 @@ vec formulation::rhs(bool keepvector, bool dirichletandportupdate)
     }
     else
         output = vec(myvec).copy();
+        
+    // Move the slave rows to their masters:
+    output.getpointer()->foldslaves();
     
     if (dirichletandportupdate == true && isconstraintcomputation == false)
         output.updateconstraints(); 
@@ -388,7 +589,11 @@ mat formulation::M(bool keepfragments) { return getmatrix(2, keepfragments); }
 mat formulation::getmatrix(int KCM, bool keepfragments, std::vector<indexmat> additionalconstraints)
 {
     if (mymat[KCM] == NULL)
+    {
         mymat[KCM] = std::shared_ptr<rawmat>(new rawmat(mydofmanager));
+        mymat[KCM]->setsymmetric(issymmetricstorage);
+        mymat[KCM]->setsell(issellstorage);
+    }
         
     std::shared_ptr<rawmat> rawout = mymat[KCM]->extractaccumulated();
     
@@ -416,12 +621,365 @@ mat formulation::getmatrix(int KCM, bool keepfragments, std::vector<indexmat> ad
     std::tuple<indexmat, indexmat, densemat> portterms = getportrelations(KCM);
     rawout->accumulate(std::get<0>(portterms), std::get<1>(portterms), std::get<2>(portterms));
     
-    rawout->process(isconstr); 
+    remappattern(KCM);
+    rawout->process(isconstr, mypatterns[KCM]); 
     rawout->clearfragments();
     
     return mat(rawout);
 }
 
+// 64 bit FNV-1a hash of the bytes in hexadecimal format:
+static std::string fingerprinthash(const void* data, long long int numbytes)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    unsigned long long int hashval = 14695981039346656037ULL;
+    for (long long int i = 0; i < numbytes; i++)
+    {
+        hashval ^= bytes[i];
+        hashval *= 1099511628211ULL;
+    }
+    
+    char hexhash[17];
+    std::snprintf(hexhash, sizeof(hexhash), "%016llx", hashval);
+    return std::string(hexhash);
+}
+
+std::string formulation::getfingerprint(int KCM)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    elements* myelements = rm->getelements();
+    
+    ///// Mesh (node coordinates, element nodes and disjoint regions):
+    const std::vector<double>* nodecoords = rm->getnodes()->readcoordinates();
+    std::vector<int> meshdata = {};
+    for (int typenum = 0; typenum < 8; typenum++)
+    {
+        int numnodes = element(typenum, myelements->getcurvatureorder()).countcurvednodes();
+        meshdata.push_back(myelements->count(typenum));
+        for (int e = 0; e < myelements->count(typenum); e++)
+        {
+            for (int n = 0; n < numnodes; n++)
+                meshdata.push_back(myelements->getsubelement(0, typenum, e, n));
+        }
+    }
+    disjointregions* mydisjregs = rm->getdisjointregions();
+    for (int d = 0; d < mydisjregs->count(); d++)
+        meshdata.insert(meshdata.end(), {mydisjregs->getelementtypenumber(d), mydisjregs->getrangebegin(d), mydisjregs->getrangeend(d)});
+    
+    ///// Dof structure (type and orders of every field, dofs of every field and harmonic):
+    std::vector<bool> isconstr = mydofmanager->isconstrained();
+    std::vector<int> dofdata(isconstr.begin(), isconstr.end());
+    dofdata.insert(dofdata.end(), {mydofmanager->countdofs(), mydofmanager->getblocksize(), issymmetricstorage, mydofmanager->countports(), (int)myportrelations.size()});
+    std::string fieldtypes = "";
+    std::vector<std::shared_ptr<rawfield>> fields = mydofmanager->getfields();
+    for (int i = 0; i < fields.size(); i++)
+    {
+        fieldtypes += fields[i]->gettypename() + ";";
+        mydofmanager->selectfield(fields[i]);
+        std::vector<int> fieldorders = mydofmanager->getselectedfieldorders();
+        dofdata.insert(dofdata.end(), fieldorders.begin(), fieldorders.end());
+    }
+    std::vector<std::vector<std::vector<int>>> splits = {mydofmanager->getfieldsplits(), mydofmanager->getharmonicsplits()};
+    for (int s = 0; s < splits.size(); s++)
+    {
+        for (int i = 0; i < splits[s].size(); i++)
+        {
+            dofdata.push_back(splits[s][i].size());
+            dofdata.insert(dofdata.end(), splits[s][i].begin(), splits[s][i].end());
+        }
+    }
+    
+    ///// Matrix terms:
+    std::string terms = "";
+    for (int i = 0; i < mycontributions[KCM+1].size(); i++)
+    {
+        for (int j = 0; j < mycontributions[KCM+1][i].size(); j++)
+        {
+            std::string termfingerprint = mycontributions[KCM+1][i][j].getfingerprint();
+            if (termfingerprint.size() == 0)
+            {
+                std::cout << "Error in 'formulation' object: cannot fingerprint the matrix since a term depends on field or port values, on the time or on data that cannot be described (custom functions, splines, ...)" << std::endl;
+                abort();
+            }
+            terms += termfingerprint + "\n";
+        }
+    }
+    
+    return "mesh " + fingerprinthash(nodecoords->data(), nodecoords->size()*sizeof(double)) + fingerprinthash(meshdata.data(), meshdata.size()*sizeof(int)) + " dofs " + fingerprinthash(dofdata.data(), dofdata.size()*sizeof(int)) + fingerprinthash(fieldtypes.data(), fieldtypes.size()) + " terms " + fingerprinthash(terms.data(), terms.size());
+}
+
+mat formulation::getcachedmatrix(int KCM, std::string filename)
+{
+    std::string fingerprint = getfingerprint(KCM);
+    
+    std::shared_ptr<rawmat> loaded(new rawmat(mydofmanager));
+    loaded->setsymmetric(issymmetricstorage);
+    loaded->setsell(issellstorage);
+    if (loaded->load(filename, fingerprint))
+        return mat(loaded);
+    
+    for (int j = 0; j < mycontributions[KCM+1].size(); j++)
+        generate(KCM+1, j);
+    mat output = getmatrix(KCM);
+    output.getpointer()->write(filename, fingerprint);
+    
+    return output;
+}
+
+densemat formulation::multiply(int KCM, densemat x)
+{
+    if (x.countrows() != mydofmanager->countdofs() || x.countcolumns() != 1)
+    {
+        std::cout << "Error in 'formulation' object: in matrix-free product expected a " << mydofmanager->countdofs() << "x1 densemat as input" << std::endl;
+        abort();
+    }
+
+    densemat y(mydofmanager->countdofs(), 1, 0.0);
+    
+    // Generate in a product only rawmat object:
+    std::shared_ptr<rawmat> storedmat = mymat[KCM];
+    
+    mymat[KCM] = std::shared_ptr<rawmat>(new rawmat(mydofmanager));
+    mymat[KCM]->multiplyinto(x, y);
+    
+    for (int j = 0; j < mycontributions[KCM+1].size(); j++)
+        generate(KCM+1, j);
+        
+    if (KCM == 0)
+    {
+        std::pair<indexmat, indexmat> assocports = mydofmanager->findassociatedports();
+        mymat[KCM]->accumulate(assocports.first, assocports.second, densemat(assocports.first.count(), 1, 1.0));
+    }
+    std::tuple<indexmat, indexmat, densemat> portterms = getportrelations(KCM);
+    mymat[KCM]->accumulate(std::get<0>(portterms), std::get<1>(portterms), std::get<2>(portterms));
+    
+    mymat[KCM] = storedmat;
+    
+    return y;
+}
+
+vec formulation::residual(void)
+{
+    int numdofs = mydofmanager->countdofs();
+    
+    // Current values of all dofs:
+    vec x(*this);
+    x.setdata();
+    
+    // Generate the rhs in a separate vector (a rhs being generated is kept):
+    std::shared_ptr<rawvec> storedvec = myvec;
+    myvec = NULL;
+    generaterhs();
+    vec b = rhs(false, false);
+    myvec = storedvec;
+    
+    densemat portrhsvals = getportrelationrhs();
+    b.setvalues(indexmat(portrhsvals.count(), 1, 0, 1), portrhsvals);
+    
+    // Element by element product with K (nothing is assembled):
+    densemat Kx = multiply(0, x.getallvalues());
+    
+    densemat resvals = b.getallvalues();
+    resvals.subtract(Kx);
+    double* resptr = resvals.getvalues();
+    
+    indexmat constraintindexes = mydofmanager->getconstrainedindexes();
+    int* constrptr = constraintindexes.getvalues();
+    for (int i = 0; i < constraintindexes.count(); i++)
+        resptr[constrptr[i]] = 0;
+    
+    std::shared_ptr<slaverelations> rels = mydofmanager->getslaverelations();
+    if (rels != NULL)
+    {
+        for (int i = 0; i < rels->count(); i++)
+            resptr[rels->slaves[i]] = 0;
+    }
+    
+    vec output(std::shared_ptr<rawvec>(new rawvec(mydofmanager)));
+    output.setvalues(indexmat(numdofs, 1, 0, 1), resvals);
+    
+    return output;
+}
+
+mat formulation::getmatrixfree(int KCM)
+{
+    std::vector<bool> isconstr;
+    if (isconstraintcomputation)
+        isconstr = std::vector<bool>(mydofmanager->countdofs(), false);
+    else
+        isconstr = mydofmanager->isconstrained();
+        
+    indexmat ainds, dinds;
+    std::vector<int> renumtolocalindex;
+    mydofmanager->getconstraintsplit(isconstr, ainds, dinds, renumtolocalindex);
+    
+    // The product provider keeps a copy of this formulation without the generated data:
+    std::shared_ptr<formulation> formulcopy(new formulation(*this));
+    formulcopy->myvec = NULL;
+    formulcopy->mymat = {NULL, NULL, NULL};
+    formulcopy->mypatterns = {NULL, NULL, NULL};
+    
+    std::shared_ptr<matrixfree> mf(new matrixfree(formulcopy, KCM, ainds, dinds));
+    
+    Mat Amat, Dmat;
+    mf->createpetsc(&Amat, &Dmat);
+    
+    std::shared_ptr<rawmat> rawout(new rawmat(mydofmanager, Amat, Dmat, ainds, dinds));
+    rawout->setmatrixfree(mf);
+    
+    return mat(rawout);
+}
+
+void formulation::reusesparsitypattern(bool isreused)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        if (isreused && mypatterns[i] == NULL)
+            mypatterns[i] = std::shared_ptr<sparsitypattern>(new sparsitypattern);
+        if (isreused == false)
+            mypatterns[i] = NULL;
+    }
+}
+
+void formulation::setddmgmres(int restartlength, int numrecycled)
+{
+    if (restartlength == 0 || restartlength < -1 || numrecycled < 0)
+    {
+        std::cout << "Error in 'formulation' object: expected a positive gmres restart length (or -1) and a nonnegative number of recycled directions" << std::endl;
+        abort();
+    }
+    
+    myddmrestart = restartlength;
+    myddmnumrecycled = numrecycled;
+    myddmrecycled = densemat();
+}
+
+void formulation::setddmsubdomainsolver(std::string precondtype, double relrestol, int maxnumit, bool isreused)
+{
+    if (relrestol <= 0 || maxnumit <= 0)
+    {
+        std::cout << "Error in 'formulation' object: expected a positive subdomain relative tolerance and maximum number of iterations" << std::endl;
+        abort();
+    }
+    
+    myddmsubprecond = precondtype;
+    myddmsubrelrestol = relrestol;
+    myddmsubmaxnumit = maxnumit;
+    isddmsubprecondreused = isreused;
+    myddmsubmat = NULL;
+    myddmcache->clear();
+}
+
+void formulation::cacheelementmatrices(bool iscached, double reltol)
+{
+    if (reltol < 0)
+    {
+        std::cout << "Error in 'formulation' object: the relative tolerance of the element matrix cache cannot be negative" << std::endl;
+        abort();
+    }
+    myelementcachereltol = (iscached ? reltol : -1);
+}
+
+void formulation::cacheddmoperators(bool iscached)
+{
+    isddmoperatorcached = iscached;
+    if (iscached == false)
+        myddmcache->clear();
+}
+
+long long int formulation::getmatrixdependencystate(std::vector<int> terms)
+{
+    if (terms.size() == 0)
+    {
+        terms.resize(mycontributions[1].size());
+        for (int j = 0; j < terms.size(); j++)
+            terms[j] = j;
+    }
+    
+    long long int output = 0;
+    for (int j = 0; j < terms.size(); j++)
+    {
+        if (terms[j] < mycontributions[1].size())
+        {
+            for (int i = 0; i < mycontributions[1][terms[j]].size(); i++)
+                output = std::max(output, mycontributions[1][terms[j]][i].getdependencystate());
+        }
+    }
+    return output;
+}
+
+bool formulation::ismatrixstatetracked(int KCM)
+{
+    // The untracked dependencies always give a new state:
+    long long int curstate = universe::getnewstate();
+    
+    for (int j = 0; j < mycontributions[KCM+1].size(); j++)
+    {
+        for (int i = 0; i < mycontributions[KCM+1][j].size(); i++)
+        {
+            if (mycontributions[KCM+1][j][i].getdependencystate() > curstate)
+                return false;
+        }
+    }
+    return true;
+}
+
+void formulation::setupddmsubdomainsolver(mat A)
+{
+    universe::getsession()->ddmsubdomainprecond = myddmsubprecond;
+    universe::getsession()->ddmsubdomainrelrestol = myddmsubrelrestol;
+    universe::getsession()->ddmsubdomainmaxnumit = myddmsubmaxnumit;
+    
+    if (myddmsubprecond == "" || isddmsubprecondreused == false)
+        return;
+    
+    // Start from the preconditioner of the previous call if the subdomain matrix has the same unknowns:
+    if (myddmsubmat != NULL && myddmsubmat != A.getpointer() && myddmsubmat->countrows() == A.countrows() && myddmsubmat->getainds().count() == A.getainds().count())
+        A.getpointer()->takeksp(myddmsubmat);
+    myddmsubmat = A.getpointer();
+}
+
+void formulation::reusesymbolicfactorization(bool isreused)
+{
+    if (isreused)
+        reusesparsitypattern(true);
+    
+    for (int i = 0; i < 3; i++)
+    {
+        if (mypatterns[i] != NULL)
+            mypatterns[i]->keepfactorization(isreused);
+    }
+}
+
+void formulation::pipelineanalysis(bool ispipelined)
+{
+    isanalysispipelined = ispipelined;
+    if (ispipelined)
+        reusesymbolicfactorization(true);
+}
+
+void formulation::interleave(field input)
+{
+    std::shared_ptr<rawfield> rf = input.getpointer();
+    
+    int numcomps = rf->countsubfields();
+    if (numcomps < 2)
+    {
+        std::cout << "Error in 'formulation' object: only fields with several components can be interleaved" << std::endl;
+        abort();
+    }
+    
+    // Interleave the components of every harmonic:
+    std::vector<int> harms = rf->getharmonics();
+    for (int h = 0; h < harms.size(); h++)
+    {
+        std::vector<std::shared_ptr<rawfield>> components(numcomps);
+        for (int c = 0; c < numcomps; c++)
+            components[c] = rf->comp(c)->harmonic(harms[h]);
+        mydofmanager->interleave(components);
+    }
+}
+
 void formulation::solve(std::string soltype, bool diagscaling, std::vector<int> blockstoconsider)
 {
     // Make sure the problem is of the form Ax = b:
@@ -439,17 +997,123 @@ void formulation::solve(std::string soltype, bool diagscaling, std::vector<int>
         generate();
     else
         generate(blockstoconsider);
+    mat Amat = this->A();
+    vec bvec = this->b();
+    
+    // Solve on the skeleton dofs only:
+    if (isinteriorcondensed)
+    {
+        staticcondensation condensed(Amat, mydofmanager->getelementinteriordofs());
+        if (condensed.isvalid())
+        {
+            sl::setdata(condensed.solve(bvec, soltype, diagscaling));
+            return;
+        }
+    }
+    
     // Solve:
-    vec sol = sl::solve(this->A(), this->b(), soltype, diagscaling);
+    vec sol = sl::solve(Amat, bvec, soltype, diagscaling);
 
     // Save to fields:
     sl::setdata(sol);
 }
 
+std::vector<vec> formulation::solveensemble(parameter param, int physreg, std::vector<expression> variants, std::string soltype)
+{
+    if (isdampingmatrixdefined() || ismassmatrixdefined())
+    {
+        std::cout << "Error in 'formulation' object: cannot solve an ensemble with a damping/mass matrix" << std::endl;
+        abort();  
+    }
+    
+    int numvariants = variants.size();
+    if (numvariants == 0)
+        return {};
+    
+    // Keep the fragments of the contributions that do not depend on the parameter and share the pattern and symbolic factorization:
+    bool wascached = iscontributioncacheused, waspatternreused = (mypatterns[0] != NULL);
+    bool wasfactorizationkept = (waspatternreused && mypatterns[0]->isfactorizationkept());
+    iscontributioncacheused = true;
+    reusesymbolicfactorization(true);
+    
+    myvec = NULL; mymat = {NULL, NULL, NULL};
+    
+    param.setvalue(physreg, variants[0]);
+    long long int paramstate = param.getpointer()->getstate();
+    
+    // The matrix must be generated again for every variant if any of its contributions depends on the parameter:
+    bool ismatrixvarying = false;
+    for (int i = 0; i < mycontributions[1].size(); i++)
+    {
+        for (int j = 0; j < mycontributions[1][i].size(); j++)
+        {
+            if (mycontributions[1][i][j].getdependencystate() >= paramstate)
+                ismatrixvarying = true;
+        }
+    }
+    
+    std::vector<vec> sols(numvariants);
+    if (ismatrixvarying == false)
+    {
+        generatestiffnessmatrix();
+        mat Amat = this->A();
+        
+        std::vector<vec> bvecs(numvariants);
+        for (int v = 0; v < numvariants; v++)
+        {
+            if (v > 0)
+                param.setvalue(physreg, variants[v]);
+            generaterhs();
+            bvecs[v] = this->b();
+        }
+        
+        sols = sl::solve(Amat, bvecs, soltype);
+    }
+    else
+    {
+        for (int v = 0; v < numvariants; v++)
+        {
+            if (v > 0)
+                param.setvalue(physreg, variants[v]);
+            generate();
+            mat Amat = this->A();
+            vec bvec = this->b();
+            
+            sols[v] = sl::solve(Amat, bvec, soltype);
+        }
+    }
+    
+    iscontributioncacheused = wascached;
+    if (waspatternreused == false)
+        reusesparsitypattern(false);
+    else
+        reusesymbolicfactorization(wasfactorizationkept);
+    
+    sl::setdata(sols[numvariants-1]);
+    
+    return sols;
+}
+
+// Solve a DDM subdomain problem with a direct solver or iteratively if requested with 'setddmsubdomainsolver'. The factorization or preconditioner is kept in A:
+vec ddmsubdomainsolve(mat A, vec b, std::string soltype = "lu")
+{
+    if (universe::getsession()->ddmsubdomainprecond == "")
+        return sl::solve(A, b, soltype);
+    
+    vec sol(std::shared_ptr<rawvec>(new rawvec(b.getpointer()->getdofmanager())));
+    double relrestol = universe::getsession()->ddmsubdomainrelrestol;
+    int maxnumit = universe::getsession()->ddmsubdomainmaxnumit;
+    sl::solve(A, b, sol, relrestol, maxnumit, "gmres", universe::getsession()->ddmsubdomainprecond, 0);
+    
+    return sol;
+}
+
 densemat Fgmultdirichlet(densemat gprev)
 {
-    mat A = universe::ddmmats[0];
-    formulation formul = universe::ddmformuls[0];
+    profilephase phase("ddm iteration");
+    
+    mat A = universe::getsession()->ddmmats[0];
+    formulation formul = universe::getsession()->ddmformuls[0];
     
     vec rhs(formul);
 
@@ -458,26 +1122,36 @@ densemat Fgmultdirichlet(densemat gprev)
     std::shared_ptr<dtracker> dt = universe::getrawmesh()->getdtracker();
     int numneighbours = dt->countneighbours();
 
+    std::vector<int> neighbours = dt->getneighbours();
+
+    // Post the receives first so that the neighbour data arrives during the local solve:
+    std::vector<densemat> Agmatssend(numneighbours), Agmatsrecv(numneighbours);
+    std::vector<int> handles(2*numneighbours);
+    for (int n = 0; n < numneighbours; n++)
+    {
+        Agmatsrecv[n] = densemat(universe::getsession()->ddmrecvinds[n].count(), 1);
+        handles[n] = slmpi::ireceive(neighbours[n], 0, Agmatsrecv[n].count(), Agmatsrecv[n].getvalues());
+    }
+
     // Compute Ag:
     int pos = 0;
     for (int n = 0; n < numneighbours; n++)
     {
-        int len = universe::ddmrecvinds[n].count();
+        int len = universe::getsession()->ddmrecvinds[n].count();
         densemat Bm = gprev.extractrows(pos, pos+len-1);
-        rhs.setvalues(universe::ddmrecvinds[n], Bm);
+        rhs.setvalues(universe::getsession()->ddmrecvinds[n], Bm);
         pos += len;
     }
         
-    vec sol = sl::solve(A, rhs);
+    vec sol = ddmsubdomainsolve(A, rhs);
 
-    // Create the artificial sources solution on the inner interface:
-    std::vector<densemat> Agmatssend(numneighbours), Agmatsrecv(numneighbours);
+    // Send the artificial sources solution on the inner interface:
     for (int n = 0; n < numneighbours; n++)
     {
-        Agmatssend[n] = sol.getvalues(universe::ddmsendinds[n]);
-        Agmatsrecv[n] = densemat(universe::ddmrecvinds[n].count(), 1);
+        Agmatssend[n] = sol.getvalues(universe::getsession()->ddmsendinds[n]);
+        handles[numneighbours+n] = slmpi::isend(neighbours[n], 0, Agmatssend[n].count(), Agmatssend[n].getvalues());
     }
-    sl::exchange(dt->getneighbours(), Agmatssend, Agmatsrecv);
+    slmpi::wait(handles);
     
     densemat Ag(Agmatsrecv);
     
@@ -518,29 +1192,59 @@ std::vector<double> formulation::allsolve(double relrestol, int maxnumit, std::s
         abort();  
     }
     
-    universe::ddmformuls = {*this};
+    universe::getsession()->ddmformuls = {*this};
 
     std::shared_ptr<dtracker> dt = universe::getrawmesh()->getdtracker();
     int numneighbours = dt->countneighbours();
 
-    // Get the rows from which to take the dofs to send as well as the rows at which to place the received dofs:
-    std::vector<std::shared_ptr<rawfield>> rfs = mydofmanager->getfields();
-    sl::mapdofs(mydofmanager, mydofmanager->getfields(), {true, true, true}, universe::ddmsendinds, universe::ddmrecvinds);
-    
-    std::vector<indexmat> interfaceinds = universe::ddmrecvinds;
+    // Reuse the interface operators and the factorized subdomain matrix of the previous call if the structure is unchanged:
+    std::vector<bool> isconstr = mydofmanager->isconstrained();
+    bool iscachevalid = (isddmoperatorcached && mydofmanager->countports() == 0 && myddmcache->isvalid(mydofmanager.get(), getmatrixdependencystate(), {-1}, isconstr));
     
-    // Get all Dirichlet constraints set on the neighbours but not on this rank:
-    std::vector<std::vector<indexmat>> dcdata = mydofmanager->discovernewconstraints(dt->getneighbours(), universe::ddmsendinds, universe::ddmrecvinds);
+    std::vector<std::vector<indexmat>> dcdata;
+    mat A;
+    if (iscachevalid)
+    {
+        dcdata = myddmcache->dcdata;
+        universe::getsession()->ddmsendinds = myddmcache->sendinds;
+        universe::getsession()->ddmrecvinds = myddmcache->recvinds;
+        
+        generaterhs();
+        A = mat(myddmcache->A);
+    }
+    else
+    {
+        // Get the rows from which to take the dofs to send as well as the rows at which to place the received dofs:
+        std::vector<std::shared_ptr<rawfield>> rfs = mydofmanager->getfields();
+        sl::mapdofs(mydofmanager, mydofmanager->getfields(), {true, true, true}, universe::getsession()->ddmsendinds, universe::getsession()->ddmrecvinds);
+        
+        std::vector<indexmat> interfaceinds = universe::getsession()->ddmrecvinds;
+        
+        // Get all Dirichlet constraints set on the neighbours but not on this rank:
+        dcdata = mydofmanager->discovernewconstraints(dt->getneighbours(), universe::getsession()->ddmsendinds, universe::getsession()->ddmrecvinds);
 
-    // Unconstrained send and receive indexes:
-    universe::ddmsendinds = dcdata[2];
-    universe::ddmrecvinds = dcdata[3];
-    
-    // Get A and allow to reuse its factorization:
-    generate();
-    mat A = getmatrix(0, false, interfaceinds);
-    A.reusefactorization();
-    universe::ddmmats = {A};
+        // Unconstrained send and receive indexes:
+        universe::getsession()->ddmsendinds = dcdata[2];
+        universe::getsession()->ddmrecvinds = dcdata[3];
+        
+        // Get A and allow to reuse its factorization:
+        generate();
+        A = getmatrix(0, false, interfaceinds);
+        A.reusefactorization();
+        
+        myddmcache->clear();
+        if (isddmoperatorcached)
+        {
+            myddmcache->sendinds = dcdata[2];
+            myddmcache->recvinds = dcdata[3];
+            myddmcache->interfaceinds = interfaceinds;
+            myddmcache->dcdata = dcdata;
+            myddmcache->A = A.getpointer();
+            myddmcache->setvalid(mydofmanager.get(), getmatrixdependencystate(), {-1}, isconstr);
+        }
+    }
+    universe::getsession()->ddmmats = {A};
+    setupddmsubdomainsolver(A);
     
     // Get the rhs of the physical sources contribution:
     vec bphysical = b();
@@ -559,14 +1263,14 @@ std::vector<double> formulation::allsolve(double relrestol, int maxnumit, std::s
         bphysical.setvalues(dcdata[1][n], dirichletvalsfromneighbours[n]);
 
     // Get the physical sources solution:
-    vec w = sl::solve(A, bphysical, soltype);
+    vec w = ddmsubdomainsolve(A, bphysical, soltype);
     
     // Create the gmres rhs 'B' from the physical sources solution on the inner interface:
     std::vector<densemat> Bmatssend(numneighbours), Bmatsrecv(numneighbours);
     for (int n = 0; n < numneighbours; n++)
     {
-        Bmatssend[n] = w.getvalues(universe::ddmsendinds[n]);
-        Bmatsrecv[n] = densemat(universe::ddmrecvinds[n].count(), 1);
+        Bmatssend[n] = w.getvalues(universe::getsession()->ddmsendinds[n]);
+        Bmatsrecv[n] = densemat(universe::getsession()->ddmrecvinds[n].count(), 1);
     }
     sl::exchange(dt->getneighbours(), Bmatssend, Bmatsrecv);
     
@@ -576,7 +1280,31 @@ std::vector<double> formulation::allsolve(double relrestol, int maxnumit, std::s
     densemat vi(B.countrows(), B.countcolumns(), 0.0);
     
     // Gmres iteration:
-    std::vector<double> resvec = sl::gmres(Fgmultdirichlet, B, vi, relrestol, maxnumit, verbosity*(rank == 0));
+    densemat (*gmresoperator)(densemat) = Fgmultdirichlet;
+    densemat gmresrhs = B;
+    // Deflate the coarse space from the gmres system:
+    if (isddmcoarsespaceused)
+    {
+        std::vector<int> blocklengths(numneighbours);
+        for (int n = 0; n < numneighbours; n++)
+            blocklengths[n] = universe::getsession()->ddmrecvinds[n].count();
+        ddmcoarsespace::define(Fgmultdirichlet, dt->getneighbours(), blocklengths);
+        gmresoperator = ddmcoarsespace::projectedproduct;
+        gmresrhs = ddmcoarsespace::project(B);
+    }
+    
+    std::vector<double> resvec;
+    if (myddmrestart == -1 && myddmnumrecycled == 0)
+        resvec = sl::gmres(gmresoperator, gmresrhs, vi, relrestol, maxnumit, verbosity*(rank == 0));
+    else
+        resvec = sl::gmres(gmresoperator, gmresrhs, vi, relrestol, maxnumit, myddmrestart, myddmrecycled, myddmnumrecycled, verbosity*(rank == 0));
+    
+    // Add the coarse component of the solution:
+    if (isddmcoarsespaceused)
+    {
+        ddmcoarsespace::correct(B, vi);
+        ddmcoarsespace::clear();
+    }
     int numits = resvec.size()-1;
     if (verbosity > 0 && rank == 0)
     {
@@ -592,11 +1320,11 @@ std::vector<double> formulation::allsolve(double relrestol, int maxnumit, std::s
     {
         int len = Bmatsrecv[n].count();
         densemat Bm = vi.extractrows(pos, pos+len-1);
-        bphysical.setvalues(universe::ddmrecvinds[n], Bm);
+        bphysical.setvalues(universe::getsession()->ddmrecvinds[n], Bm);
         pos += len;
     }
 
-    vec totalsol = sl::solve(A, bphysical);
+    vec totalsol = ddmsubdomainsolve(A, bphysical);
     sl::setdata(totalsol);
     
     if (verbosity > 0)
@@ -611,11 +1339,79 @@ std::vector<double> formulation::allsolve(double relrestol, int maxnumit, std::s
     return resvec;
 }
 
+void formulation::allsolvemonolithic(std::string soltype, int verbosity)
+{
+    // Make sure the problem is of the form Ax = b:
+    if (isdampingmatrixdefined() || ismassmatrixdefined())
+    {
+        std::cout << "Error in 'formulation' object: cannot solve with a damping/mass matrix (use a time resolution algorithm)" << std::endl;
+        abort();  
+    }
+    
+    wallclock clktot;
+
+    int rank = slmpi::getrank();
+    int numranks = slmpi::count();
+    
+    if (numranks == 1)
+    {
+        solve(soltype, false);
+        return;
+    }
+    
+    // Every element must be integrated on a single rank:
+    if (universe::getrawmesh()->getdtracker()->isoverlap())
+    {
+        std::cout << "Error in 'formulation' object: cannot solve the global problem with an overlap DDM (use a no-overlap DDM)" << std::endl;
+        abort();  
+    }
+    if (mydofmanager->countports() > 0)
+    {
+        std::cout << "Error in 'formulation' object: cannot solve the global problem of a formulation with ports" << std::endl;
+        abort();  
+    }
+
+    std::shared_ptr<dtracker> dt = universe::getrawmesh()->getdtracker();
+    std::vector<int> neighbours = dt->getneighbours();
+    int numneighbours = neighbours.size();
+
+    // Get the dof correspondences at the no-overlap interfaces:
+    std::vector<indexmat> sendinds, recvinds;
+    sl::mapdofs(mydofmanager, mydofmanager->getfields(), {true, true, true}, sendinds, recvinds);
+    
+    // Get all Dirichlet constraints set on the neighbours but not on this rank:
+    std::vector<std::vector<indexmat>> dcdata = mydofmanager->discovernewconstraints(neighbours, sendinds, recvinds);
+    
+    generate();
+    mat A = getmatrix(0, false, dcdata[1]);
+    vec bvec = b();
+    
+    // Set the value from the neighbour Dirichlet conditions:
+    std::vector<densemat> dirichletvalsforneighbours(numneighbours), dirichletvalsfromneighbours(numneighbours);
+    for (int n = 0; n < numneighbours; n++)
+    {
+        dirichletvalsforneighbours[n] = bvec.getvalues(dcdata[0][n]);
+        dirichletvalsfromneighbours[n] = densemat(dcdata[1][n].count(), 1);
+    }
+    sl::exchange(neighbours, dirichletvalsforneighbours, dirichletvalsfromneighbours);
+    for (int n = 0; n < numneighbours; n++)
+        bvec.setvalues(dcdata[1][n], dirichletvalsfromneighbours[n]);
+
+    distributedsystem globalsystem(A, mydofmanager->isdofowned(), neighbours, sendinds, recvinds);
+    
+    sl::setdata(globalsystem.solve(bvec, soltype));
+    
+    if (verbosity > 0 && rank == 0)
+        clktot.print("Distributed direct solve for "+std::to_string(globalsystem.countglobaldofs())+" unconstrained dofs took");
+}
+
 densemat Fgmultrobin(densemat gprev)
 {
-    mat A = universe::ddmmats[0];
-    formulation formul = universe::ddmformuls[0];
-    std::vector<std::vector<int>> artificialterms = universe::ddmints;
+    profilephase phase("ddm iteration");
+    
+    mat A = universe::getsession()->ddmmats[0];
+    formulation formul = universe::getsession()->ddmformuls[0];
+    std::vector<std::vector<int>> artificialterms = universe::getsession()->ddmints;
 
     vec rhs(formul);
 
@@ -624,30 +1420,41 @@ densemat Fgmultrobin(densemat gprev)
     std::shared_ptr<dtracker> dt = universe::getrawmesh()->getdtracker();
     int numneighbours = dt->countneighbours();
 
+    std::vector<int> neighbours = dt->getneighbours();
+
+    // Post the receives first so that the neighbour data arrives during the local work:
+    std::vector<densemat> Agmatssend(numneighbours), Agmatsrecv(numneighbours);
+    std::vector<int> handles(2*numneighbours);
+    for (int n = 0; n < numneighbours; n++)
+    {
+        Agmatsrecv[n] = densemat(universe::getsession()->ddmrecvinds[n].count(), 1);
+        handles[n] = slmpi::ireceive(neighbours[n], 0, Agmatsrecv[n].count(), Agmatsrecv[n].getvalues());
+    }
+
     // Compute Ag:
     int pos = 0;
     for (int n = 0; n < numneighbours; n++)
     {
-        int len = universe::ddmrecvinds[n].count();
+        int len = universe::getsession()->ddmrecvinds[n].count();
         densemat Bm = gprev.extractrows(pos, pos+len-1);
-        rhs.setvalues(universe::ddmrecvinds[n], Bm, "add");
+        rhs.setvalues(universe::getsession()->ddmrecvinds[n], Bm, "add");
         pos += len;
     }
         
-    vec sol = sl::solve(A, rhs);
+    vec sol = ddmsubdomainsolve(A, rhs);
     sl::setdata(sol);
 
-    // Create the artificial sources solution on the inner interface:
-    std::vector<densemat> Agmatssend(numneighbours), Agmatsrecv(numneighbours);
+    // Create the artificial sources solution on the inner interface. It is sent to each neighbour
+    // as soon as available, while the artificial sources of the next neighbours are generated:
     for (int n = 0; n < numneighbours; n++)
     {
         formul.generatein(0, artificialterms[n]);
         vec gartificial = formul.b(false, false);
     
-        Agmatssend[n] = gartificial.getvalues(universe::ddmsendinds[n]);
-        Agmatsrecv[n] = densemat(universe::ddmrecvinds[n].count(), 1);
+        Agmatssend[n] = gartificial.getvalues(universe::getsession()->ddmsendinds[n]);
+        handles[numneighbours+n] = slmpi::isend(neighbours[n], 0, Agmatssend[n].count(), Agmatssend[n].getvalues());
     }
-    sl::exchange(dt->getneighbours(), Agmatssend, Agmatsrecv);
+    slmpi::wait(handles);
     
     densemat Ag(Agmatsrecv);
     
@@ -682,30 +1489,67 @@ std::vector<double> formulation::allsolve(std::vector<int> formulterms, std::vec
         return {};
     }
     
-    universe::ddmints = artificialterms;
-    universe::ddmformuls = {*this};
+    universe::getsession()->ddmints = artificialterms;
+    universe::getsession()->ddmformuls = {*this};
 
     std::shared_ptr<dtracker> dt = universe::getrawmesh()->getdtracker();
     int numneighbours = dt->countneighbours();
 
-    // Get the rows from which to take the dofs to send as well as the rows at which to place the received dofs:
-    std::vector<std::shared_ptr<rawfield>> rfs = mydofmanager->getfields();
-    sl::mapdofs(mydofmanager, mydofmanager->getfields(), {true, true, true}, universe::ddmsendinds, universe::ddmrecvinds);
+    // All terms in the subdomain matrix (a -1 separates the formulation and the physical terms):
+    std::vector<int> matrixterms = formulterms;
+    matrixterms.push_back(-1);
+    for (int n = 0; n < numneighbours; n++)
+        matrixterms.insert(matrixterms.end(), physicalterms[n].begin(), physicalterms[n].end());
+    std::vector<int> alltermsinmatrix(matrixterms.begin(), matrixterms.end());
+    alltermsinmatrix.erase(std::remove(alltermsinmatrix.begin(), alltermsinmatrix.end(), -1), alltermsinmatrix.end());
     
-    // Get all Dirichlet constraints set on the neighbours but not on this rank:
-    std::vector<std::vector<indexmat>> dcdata = mydofmanager->discovernewconstraints(dt->getneighbours(), universe::ddmsendinds, universe::ddmrecvinds);
-
-    // Unconstrained send and receive indexes:
-    universe::ddmsendinds = dcdata[2];
-    universe::ddmrecvinds = dcdata[3];
+    // Reuse the interface operators and the factorized subdomain matrix of the previous call if the structure is unchanged:
+    std::vector<bool> isconstr = mydofmanager->isconstrained();
+    bool iscachevalid = (isddmoperatorcached && mydofmanager->countports() == 0 && alltermsinmatrix.size() > 0 && myddmcache->isvalid(mydofmanager.get(), getmatrixdependencystate(alltermsinmatrix), matrixterms, isconstr));
     
-    // Get A and allow to reuse its factorization:
-    generate(formulterms);
-    for (int n = 0; n < numneighbours; n++)
-        generatein(1, physicalterms[n]); // S term in A
-    mat A = getmatrix(0, false, {indexmat(dcdata[1])});
-    A.reusefactorization();
-    universe::ddmmats = {A};
+    std::vector<std::vector<indexmat>> dcdata;
+    mat A;
+    if (iscachevalid)
+    {
+        dcdata = myddmcache->dcdata;
+        universe::getsession()->ddmsendinds = myddmcache->sendinds;
+        universe::getsession()->ddmrecvinds = myddmcache->recvinds;
+        
+        generatein(0, formulterms);
+        A = mat(myddmcache->A);
+    }
+    else
+    {
+        // Get the rows from which to take the dofs to send as well as the rows at which to place the received dofs:
+        std::vector<std::shared_ptr<rawfield>> rfs = mydofmanager->getfields();
+        sl::mapdofs(mydofmanager, mydofmanager->getfields(), {true, true, true}, universe::getsession()->ddmsendinds, universe::getsession()->ddmrecvinds);
+        
+        // Get all Dirichlet constraints set on the neighbours but not on this rank:
+        dcdata = mydofmanager->discovernewconstraints(dt->getneighbours(), universe::getsession()->ddmsendinds, universe::getsession()->ddmrecvinds);
+
+        // Unconstrained send and receive indexes:
+        universe::getsession()->ddmsendinds = dcdata[2];
+        universe::getsession()->ddmrecvinds = dcdata[3];
+        
+        // Get A and allow to reuse its factorization:
+        generate(formulterms);
+        for (int n = 0; n < numneighbours; n++)
+            generatein(1, physicalterms[n]); // S term in A
+        A = getmatrix(0, false, {indexmat(dcdata[1])});
+        A.reusefactorization();
+        
+        myddmcache->clear();
+        if (isddmoperatorcached)
+        {
+            myddmcache->sendinds = dcdata[2];
+            myddmcache->recvinds = dcdata[3];
+            myddmcache->dcdata = dcdata;
+            myddmcache->A = A.getpointer();
+            myddmcache->setvalid(mydofmanager.get(), getmatrixdependencystate(alltermsinmatrix), matrixterms, isconstr);
+        }
+    }
+    universe::getsession()->ddmmats = {A};
+    setupddmsubdomainsolver(A);
     
     // Get the rhs of the physical sources contribution:
     vec bphysical = b();
@@ -722,7 +1566,7 @@ std::vector<double> formulation::allsolve(std::vector<int> formulterms, std::vec
         bphysical.setvalues(dcdata[1][n], dirichletvalsfromneighbours[n]);
 
     // Get the physical sources solution:
-    vec w = sl::solve(A, bphysical, soltype);
+    vec w = ddmsubdomainsolve(A, bphysical, soltype);
     sl::setdata(w);
     
     // Create the gmres rhs 'B' from the physical sources solution on the inner interface:
@@ -732,8 +1576,8 @@ std::vector<double> formulation::allsolve(std::vector<int> formulterms, std::vec
         generatein(0, physicalterms[n]);
         vec gphysical = b(false, false);
     
-        Bmatssend[n] = gphysical.getvalues(universe::ddmsendinds[n]);
-        Bmatsrecv[n] = densemat(universe::ddmrecvinds[n].count(), 1);
+        Bmatssend[n] = gphysical.getvalues(universe::getsession()->ddmsendinds[n]);
+        Bmatsrecv[n] = densemat(universe::getsession()->ddmrecvinds[n].count(), 1);
     }
     sl::exchange(dt->getneighbours(), Bmatssend, Bmatsrecv);
     
@@ -743,7 +1587,31 @@ std::vector<double> formulation::allsolve(std::vector<int> formulterms, std::vec
     densemat vi(B.countrows(), B.countcolumns(), 0.0);
     
     // Gmres iteration:
-    std::vector<double> resvec = sl::gmres(Fgmultrobin, B, vi, relrestol, maxnumit, verbosity*(rank == 0));
+    densemat (*gmresoperator)(densemat) = Fgmultrobin;
+    densemat gmresrhs = B;
+    // Deflate the coarse space from the gmres system:
+    if (isddmcoarsespaceused)
+    {
+        std::vector<int> blocklengths(numneighbours);
+        for (int n = 0; n < numneighbours; n++)
+            blocklengths[n] = universe::getsession()->ddmrecvinds[n].count();
+        ddmcoarsespace::define(Fgmultrobin, dt->getneighbours(), blocklengths);
+        gmresoperator = ddmcoarsespace::projectedproduct;
+        gmresrhs = ddmcoarsespace::project(B);
+    }
+    
+    std::vector<double> resvec;
+    if (myddmrestart == -1 && myddmnumrecycled == 0)
+        resvec = sl::gmres(gmresoperator, gmresrhs, vi, relrestol, maxnumit, verbosity*(rank == 0));
+    else
+        resvec = sl::gmres(gmresoperator, gmresrhs, vi, relrestol, maxnumit, myddmrestart, myddmrecycled, myddmnumrecycled, verbosity*(rank == 0));
+    
+    // Add the coarse component of the solution:
+    if (isddmcoarsespaceused)
+    {
+        ddmcoarsespace::correct(B, vi);
+        ddmcoarsespace::clear();
+    }
     int numits = resvec.size()-1;
     if (verbosity > 0 && rank == 0)
     {
@@ -759,11 +1627,11 @@ std::vector<double> formulation::allsolve(std::vector<int> formulterms, std::vec
     {
         int len = Bmatsrecv[n].count();
         densemat Bm = vi.extractrows(pos, pos+len-1);
-        bphysical.setvalues(universe::ddmrecvinds[n], Bm, "add");
+        bphysical.setvalues(universe::getsession()->ddmrecvinds[n], Bm, "add");
         pos += len;
     }
 
-    vec totalsol = sl::solve(A, bphysical);
+    vec totalsol = ddmsubdomainsolve(A, bphysical);
     sl::setdata(totalsol);
     
     if (verbosity > 0)
@@ -778,3 +1646,33 @@ std::vector<double> formulation::allsolve(std::vector<int> formulterms, std::vec
     return resvec;
 }
 
+std::vector<double> formulation::allmeasureload(int verbosity)
+{
+    int numranks = slmpi::count();
+
+    wallclock assemblytime;
+    generate();
+    mat A = getmatrix(0, true);
+    double elapsed = assemblytime.toc()*1e-9;
+
+    std::vector<double> mycost = {(double)countdofs(), (double)A.countnnz(), elapsed}, allcosts;
+    slmpi::allgather(mycost, allcosts);
+
+    if (verbosity > 0 && slmpi::getrank() == 0)
+    {
+        std::vector<std::string> names = {"dofs", "nonzeros", "assembly time"};
+        for (int m = 0; m < 3; m++)
+        {
+            double maxcost = 0.0, sumcost = 0.0;
+            for (int r = 0; r < numranks; r++)
+            {
+                maxcost = std::max(maxcost, allcosts[3*r+m]);
+                sumcost += allcosts[3*r+m];
+            }
+            double imbalance = (sumcost > 0) ? maxcost*numranks/sumcost : 1.0;
+            std::cout << "Load imbalance (max/mean) for the " << names[m] << ": " << imbalance << std::endl;
+        }
+    }
+
+    return allcosts;
+}
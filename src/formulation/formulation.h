@@ -22,14 +22,19 @@
 #include "indexmat.h"
 #include "rawvec.h"
 #include "rawmat.h"
+#include "sparsitypattern.h"
 #include "integration.h"
 #include "port.h"
 #include "portrelation.h"
+#include "memoryusage.h"
+#include "parameter.h"
+#include "ddmoperatorcache.h"
 
 class integration;
 class contribution;
 class port;
 class portrelation;
+class parameter;
 
 class formulation
 {
@@ -37,6 +42,57 @@ class formulation
         
         bool isstructurelocked = false;
         
+        // Reuse the fragments of the contributions whose dependencies have not changed:
+        bool iscontributioncacheused = false;
+        // Also reuse them after rigid motions of their integration region:
+        bool isrigidcacheused = false;
+        // Keep the geometric tables of the rhs contributions:
+        bool isrhsassemblycached = false;
+        // Relative field coefficient change above which the element matrices are computed again (negative for no element matrix cache):
+        double myelementcachereltol = -1;
+        // Start the direct solver analysis of K on a symbolic pass before generating the values:
+        bool isanalysispipelined = false;
+        
+        // Fully described rhs contributions generated in advance at time 'myprefetchtime' (NULL if none). The description
+        // of every prefetched contribution is kept (empty for the others) to check that it has not changed when it is used:
+        std::shared_ptr<rawvec> myprefetchedrhs = NULL;
+        double myprefetchtime = 0;
+        std::vector<std::vector<std::string>> myprefetchdescriptions = {};
+        // True once the rhs generation skips the prefetched contributions (they are then added by 'rhs'):
+        bool isprefetchedrhsused = false;
+        // Use the prefetched contributions if they are valid at the current time and drop them otherwise:
+        void checkprefetchedrhs(void);
+        
+        // Eliminate the element interior dofs before the direct solve:
+        bool isinteriorcondensed = false;
+        
+        // Only store the upper triangle of the matrices:
+        bool issymmetricstorage = false;
+        // Also keep the matrices in sell format:
+        bool issellstorage = false;
+        
+        // Gmres restart length (-1 for no restart) and number of recycled directions in the DDM 'allsolve':
+        int myddmrestart = -1;
+        int myddmnumrecycled = 0;
+        // Directions recycled from the previous 'allsolve' gmres (one per row):
+        densemat myddmrecycled;
+        // Add a coarse correction (one constant per subdomain) to the DDM gmres:
+        bool isddmcoarsespaceused = false;
+        // Preconditioner type of the iterative DDM subdomain solves ("" for direct solves), their tolerance and maximum iteration count:
+        std::string myddmsubprecond = "";
+        double myddmsubrelrestol = 1e-8;
+        int myddmsubmaxnumit = 1000;
+        // Reuse the subdomain preconditioner of the previous 'allsolve' call (kept in the previous subdomain matrix):
+        bool isddmsubprecondreused = true;
+        std::shared_ptr<rawmat> myddmsubmat = NULL;
+        // Keep the interface operators and the factorized subdomain matrix from one 'allsolve' call to the next:
+        bool isddmoperatorcached = false;
+        std::shared_ptr<ddmoperatorcache> myddmcache = std::shared_ptr<ddmoperatorcache>(new ddmoperatorcache);
+        // Maximum dependency state of the matrix contributions in 'terms' (all if empty):
+        long long int getmatrixdependencystate(std::vector<int> terms = {});
+        // Set the subdomain solver of the DDM containers and pass the preconditioner of the previous call to A:
+        void setupddmsubdomainsolver(mat A);
+        
         // myvec is the right handside vector rhs.
         std::shared_ptr<rawvec> myvec = NULL;
         // - mymat[0] is the stiffness matrix K
@@ -44,6 +100,9 @@ class formulation
         // - mymat[2] is the mass matrix M
         std::vector<std::shared_ptr<rawmat>> mymat = {NULL, NULL, NULL};
         
+        // Sparsity patterns of K, C and M kept to speed up later matrix assemblies (NULL if not reused):
+        std::vector<std::shared_ptr<sparsitypattern>> mypatterns = {NULL, NULL, NULL};
+        
         // The link between the dof number and its row and column in the matrix:
         std::shared_ptr<dofmanager> mydofmanager = NULL;
         
@@ -60,6 +119,13 @@ class formulation
         // Always call this generate from the public generate functions:
         void generate(int m, int contributionnumber);
         
+        // Keep the sparsity pattern of K, C or M through a mesh change that did not move any dof:
+        void remappattern(int KCM);
+        
+        // Build the structure of K with a symbolic pass on the contributions of the blocks to generate and
+        // start the ordering and symbolic factorization of the kept factorization on another thread:
+        void startanalysis(std::vector<int> contributionnumbers);
+        
     public:
         
         // Has this formulation been called to compute a constraint?
@@ -78,6 +144,11 @@ class formulation
         int countdofs(void);
         long long int allcountdofs(void);
         
+        // Impose a periodicity (or antiperiodicity with 'factor' -1) of field 'u' between regions 'gamma1' and 'gamma2' by eliminating
+        // the dofs on 'gamma1'. The arguments are the same as for 'periodicitycondition' but no Lagrange multiplier is added so the
+        // system does not grow. The meshes on both regions must match and 'u' must be 'h1' type of order 1 on them:
+        void tie(int gamma1, int gamma2, field u, std::vector<double> dat1, std::vector<double> dat2, double factor = 1);
+        
         bool isstiffnessmatrixdefined(void);
         bool isdampingmatrixdefined(void);
         bool ismassmatrixdefined(void);
@@ -100,6 +171,10 @@ class formulation
         
         std::shared_ptr<dofmanager> getdofmanager(void) { return mydofmanager; };
         
+        // Get/print the number of bytes used by the dof manager, the rhs vector and the matrices:
+        memoryusage getmemoryusage(void);
+        void printmemory(void);
+        
         // Get the assembled matrices or get the right hanside vector.
         // Choose to discard or not all values after getting the vector/matrix.
         
@@ -114,14 +189,132 @@ class formulation
         // KCM set to 0 gives K, 1 gives C and 2 gives M.
         mat getmatrix(int KCM, bool keepfragments = false, std::vector<indexmat> additionalconstraints = {});
         
+        // False if K, C or M (KCM = 0, 1 or 2) has a contribution whose dependencies are not tracked by their state (the time,
+        // custom functions, ports and time derivatives of fields). Otherwise the matrix only changes when a field, parameter or
+        // mesh it depends on is modified and a matrix generated earlier for the same values can be reused.
+        bool ismatrixstatetracked(int KCM);
+        
+        // Fingerprint of K, C or M (KCM = 0, 1 or 2) made of hashes of the mesh, of the dof structure (fields with their type, orders and
+        // dofs, constrained dofs, storage) and of the matrix terms (fields, regions, integration settings and coefficients with their
+        // parameter values). An error is raised if a term depends on field or port values, on the time or on custom functions or splines.
+        std::string getfingerprint(int KCM);
+        // Load K, C or M (KCM = 0, 1 or 2) from file 'filename' if it was written for the same fingerprint. Otherwise the matrix is
+        // generated and written to the file for the next runs (e.g. other jobs with different loads). Matrices that depend on field
+        // values cannot be fingerprinted and thus not cached (see 'getfingerprint'). Use one file per rank with DDM.
+        mat getcachedmatrix(int KCM, std::string filename);
+        
+        // Product of K, C or M (KCM = 0, 1 or 2) with the values 'x' of all dofs. The elementary
+        // matrices are computed block by block and directly multiplied without any assembly:
+        densemat multiply(int KCM, densemat x);
+        // Get K, C or M as a matrix-free operator (petsc shell matrix). It can only be used
+        // by the iterative solvers without preconditioner. Each product regenerates the formulation.
+        mat getmatrixfree(int KCM = 0);
+        // Nonlinear residual r = b - K(x)*x at the current field values x (e.g. for a line search or a convergence check). The
+        // rhs vector and the product with K are computed element by element without generating any matrix. The residual is zero
+        // on the constrained and slave dofs. The damping and mass matrices are not included.
+        vec residual(void);
+        
+        
+        // Keep the fragments generated by every contribution. A contribution is then only generated 
+        // again when a field, parameter or mesh it depends on has been modified. Time and custom 
+        // function dependent contributions are always regenerated. This requires extra memory.
+        // With 'keeprigid' the fragments are also kept when the integration region was only shifted or
+        // rotated as a whole (e.g. a rotor) and all terms are invariant under that motion. The contributions
+        // on regions split by the motion (e.g. the sliding interface coupling) are regenerated.
+        void cachecontributions(bool iscached = true, bool keeprigid = false) { iscontributioncacheused = iscached; isrigidcacheused = keeprigid; };
+        // Keep for every rhs contribution the Gauss points, Jacobians, test functions times the weights and the test function
+        // addresses of all element blocks. While the mesh is unchanged the rhs generation then only evaluates the coefficients and
+        // adds them to the vector (e.g. time-varying loads with constant matrices). Contributions on a deformed mesh, evaluated
+        // at the barycenters or with a FFT are generated as usual. This requires extra memory and the blocks are not multithreaded.
+        void cacherhsassembly(bool iscached = true) { isrhsassemblycached = iscached; };
+        // Keep the element matrices of every contribution. At the next generation only the elements on which a field in the coefficients
+        // has changed by more than 'reltol' (relative to its largest coefficient in the element block) are computed again. This targets
+        // nonlinear problems where only a front evolves. Contributions with a time, port or custom function dependency, a mesh deformation
+        // or a dof field interpolated on another mesh are always fully generated. The reused element matrices are exact only for 'reltol' 0.
+        void cacheelementmatrices(bool iscached = true, double reltol = 1e-8);
+        
+        // Generate now, at the current time, the rhs contributions whose description fully defines their values (no field, port, time,
+        // custom function, spline, Gauss point data, ... dependency). The next rhs generation at that same time skips them and 'rhs' adds
+        // them, unless a contribution has changed in between (e.g. a parameter value). This can run on another thread while the fields are not modified (e.g. during a solve):
+        // it only computes the element values and makes no petsc call. The petsc vector is created and filled later by 'rhs'.
+        void prefetchrhs(void);
+        // True if some rhs contributions can be prefetched:
+        bool isrhsprefetchable(void);
+        
+        // Keep the sparsity pattern of the assembled matrices. Once known the next contributions are directly
+        // added to the csr values without storing the fragments. The pattern is automatically recomputed
+        // when the matrix structure has changed.
+        void reusesparsitypattern(bool isreused = true);
+        // Keep the ordering and symbolic factorization of the direct solver for all matrices with the same sparsity
+        // pattern (e.g. in Newton iterations). Only the numeric factorization is then redone at every solve.
+        // This also reuses the sparsity pattern. The diagonal scaling option of the direct solvers is not used with it.
+        void reusesymbolicfactorization(bool isreused = true);
+        // When K is generated with its sparsity pattern not yet known, first get its structure with a symbolic pass (addresses only)
+        // and prepare the ordering and symbolic factorization of the direct solver on it. With a thread-safe petsc build and MPI
+        // providing MPI_THREAD_MULTIPLE the analysis runs on another thread while the values are computed, which hides its time
+        // for large 3D problems. Otherwise it runs on the main thread at the next solve. This also reuses the symbolic factorization.
+        // Contributions with a dof field interpolated on another mesh prevent the pipelining.
+        void pipelineanalysis(bool ispipelined = true);
+        
+        
+        // Tell that the formulation is symmetric. Only the upper triangle of K, C and M is then assembled and stored
+        // (petsc sbaij matrices) and the direct solvers always use a Cholesky factorization. Matrices in symmetric
+        // storage cannot be multiplied by other matrices. Preconditioner 'ilu' is replaced by an incomplete Cholesky.
+        void setsymmetric(bool issymmetric = true) { issymmetricstorage = issymmetric; };
+        
+        // Also keep K, C and M in the SELL-C-sigma format (petsc sell) used by the iterative solvers for their
+        // SIMD friendly matrix-vector products. The preconditioners and direct solvers use the usual csr storage.
+        // This is only worth it for iterative solves with many iterations and not allowed in symmetric storage.
+        void setsell(bool issell = true) { issellstorage = issell; };
+        
+        // Number the dofs of all components of a vector field (e.g. "h1xyz") node by node instead of component
+        // by component. If all dofs are interleaved in the formulation the matrices are stored in petsc baij format
+        // (block size equal to the number of components). This must be called before adding terms to the formulation.
+        void interleave(field input);
+        
+        // Eliminate element by element the interior (bubble) dofs in 'solve'. Only the system on the remaining
+        // skeleton dofs is factorized, the interior values are then recovered element by element. This
+        // shrinks the factorization for high order fields. It is not applied if the interior dofs are coupled
+        // to other elements.
+        void condenseinteriordofs(bool iscondensed = true) { isinteriorcondensed = iscondensed; };
         
         // Generate, solve and save to fields:
         void solve(std::string soltype = "lu", bool diagscaling = false, std::vector<int> blockstoconsider = {-1});
+        // Solve the formulation for every value in 'variants' of parameter 'param' on region 'physreg' (e.g. material samples of
+        // a Monte-Carlo study) and return the solutions. The fields and 'param' are left at the last variant. The contributions that
+        // do not depend on 'param' are only generated once and all matrices share one sparsity pattern and symbolic factorization.
+        // If only the rhs depends on 'param' the matrix is factorized once and all variants are solved in a single multi-rhs solve.
+        std::vector<vec> solveensemble(parameter param, int physreg, std::vector<expression> variants, std::string soltype = "lu");
 
+        // Restart the DDM gmres every 'restartlength' iterations (-1 for no restart) and carry 'numrecycled' correction directions
+        // from one 'allsolve' call to the next. They are deflated from the Krylov space, which cuts the iteration count of
+        // consecutive similar problems (e.g. time steps or nonlinear iterations).
+        void setddmgmres(int restartlength, int numrecycled = 0);
+        // Add a second level to the DDM 'allsolve' with a coarse space of one constant per subdomain on the interface unknowns.
+        // The coarse problem is factorized once per 'allsolve' call. It keeps the iteration count independent of the rank count.
+        void useddmcoarsespace(bool isused = true) { isddmcoarsespaceused = isused; };
+        // Solve the DDM subdomain problems in 'allsolve' inexactly with a preconditioned gmres ('precondtype' as in the iterative
+        // 'sl::solve', e.g. "gamg" or "ilu") instead of a direct solver. This removes the factorization memory of large subdomains.
+        // The subdomain tolerance should be well below the 'allsolve' one. If 'isreused' is true the preconditioner is kept from
+        // one 'allsolve' call to the next (e.g. over time steps) as long as the subdomain unknowns are unchanged. Use "" for direct solves.
+        void setddmsubdomainsolver(std::string precondtype, double relrestol = 1e-8, int maxnumit = 1000, bool isreused = true);
+        // Keep the DDM interface dof indexes, the neighbour constraint data and the factorized subdomain matrix of 'allsolve' from
+        // one call to the next (e.g. over time steps). They are rebuilt when the mesh, the dof structure, the constrained dofs or
+        // a dependency of a matrix contribution changes. Only the rhs is generated again when they are reused.
+        void cacheddmoperators(bool iscached = true);
+        
         // DDM resolution with Dirichlet / mixed interface conditions. The initial solution is taken from the fields state. The relative residual history is returned.
         std::vector<double> allsolve(double relrestol, int maxnumit, std::string soltype = "lu", int verbosity = 1);
         std::vector<double> allsolve(std::vector<int> formulterms, std::vector<std::vector<int>> physicalterms, std::vector<std::vector<int>> artificialterms, double relrestol, int maxnumit, std::string soltype = "lu", int verbosity = 1);
 
+        // Generate, solve the global problem of all ranks with a distributed direct solver and save to fields.
+        // The unconstrained dofs are numbered globally by the rank owning them (a no-overlap DDM is required).
+        void allsolvemonolithic(std::string soltype = "lu", int verbosity = 1);
+
+        // Measure the per-rank cost of this formulation (the formulation is generated and its matrix A is built without removing the fragments).
+        // The output has format {dofs rank 0, nnz rank 0, assembly time [s] rank 0, dofs rank 1, ...}. Use it to choose the weights in 'mesh::allload'.
+        std::vector<double> allmeasureload(int verbosity = 1);
+
 };
 
 
@@ -61,6 +61,7 @@ vec mat::xbmerge(vec x, vec b)
     densemat bdvals = b.getvalues(dinds);
     output.setvalues(ainds, xvals);
     output.setvalues(dinds, bdvals);
+    output.getpointer()->updateslaves();
     return output;
 }
 
@@ -70,6 +71,7 @@ vec mat::x0merge(vec x)
     
     vec output(std::shared_ptr<rawvec>(new rawvec(rawmatptr->getdofmanager())));
     output.setvalues(getainds(), x.getallvalues());
+    output.getpointer()->updateslaves();
     return output;
 }
 
@@ -77,6 +79,8 @@ vec mat::eliminate(vec b)
 {
     errorifpointerisnull(); errorifinvalidated();
     
+    profilephase phase("eliminate", false);
+    
     indexmat ainds = getainds();
     indexmat dinds = getdinds();
 
@@ -89,11 +93,23 @@ vec mat::eliminate(vec b)
     Vec bapetsc = ba.getpetsc();
     Vec bdpetsc = bd.getpetsc();
 
+    // With unchanged Dirichlet values (e.g. fixed boundary conditions in a transient) the product is reused:
+    densemat bdvals = bd.getallvalues();
+    densemat prodvals;
+    if (rawmatptr->geteliminationproduct(bdvals, prodvals) == false)
+    {
+        prodvals = densemat(ainds.count(), 1);
+        
+        Vec prodvec;
+        VecCreateSeqWithArray(PETSC_COMM_SELF, 1, ainds.count(), prodvals.getvalues(), &prodvec);
+        MatMult(getdpetsc(), bdpetsc, prodvec);
+        VecDestroy(&prodvec);
+        
+        rawmatptr->seteliminationproduct(bdvals, prodvals);
+    }
+    
     Vec prodvec;
-    VecCreate(PETSC_COMM_SELF, &prodvec);
-    VecSetSizes(prodvec, PETSC_DECIDE, ainds.count());
-    VecSetFromOptions(prodvec);   
-    MatMult(getdpetsc(), bdpetsc, prodvec);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, ainds.count(), prodvals.getvalues(), &prodvec);
     VecAXPY(bapetsc, -1, prodvec);
     VecDestroy(&prodvec);
 
@@ -140,6 +156,17 @@ mat mat::operator*(mat input)
 {
     errorifpointerisnull(); errorifinvalidated();
 
+    if (rawmatptr->issymmetric() || input.getpointer()->issymmetric())
+    {
+        std::cout << "Error in 'mat' object: cannot multiply matrices in symmetric storage" << std::endl;
+        abort();
+    }
+    if (rawmatptr->getblocksize() > 1 || input.getpointer()->getblocksize() > 1)
+    {
+        std::cout << "Error in 'mat' object: cannot multiply matrices in block storage" << std::endl;
+        abort();
+    }
+
     // | A   D |  | B   E |   | AB  AE+D |
     // |       |  |       | = |          |
     // | 0   1 |  | 0   1 |   | 0      1 |
@@ -161,6 +188,12 @@ mat mat::operator+(mat input)
 {
     errorifpointerisnull(); errorifinvalidated();
     
+    if (rawmatptr->issymmetric() != input.getpointer()->issymmetric())
+    {
+        std::cout << "Error in 'mat' object: cannot add a matrix in symmetric storage to a matrix in regular storage" << std::endl;
+        abort();
+    }
+    
     mat copied = copy();
     MatAXPY(copied.getapetsc(), 1, input.getapetsc(), DIFFERENT_NONZERO_PATTERN);
     MatAXPY(copied.getdpetsc(), 1, input.getdpetsc(), DIFFERENT_NONZERO_PATTERN);
@@ -171,6 +204,12 @@ mat mat::operator-(mat input)
 {
     errorifpointerisnull(); errorifinvalidated();
     
+    if (rawmatptr->issymmetric() != input.getpointer()->issymmetric())
+    {
+        std::cout << "Error in 'mat' object: cannot add a matrix in symmetric storage to a matrix in regular storage" << std::endl;
+        abort();
+    }
+    
     mat copied = copy();
     MatAXPY(copied.getapetsc(), -1, input.getapetsc(), DIFFERENT_NONZERO_PATTERN);
     MatAXPY(copied.getdpetsc(), -1, input.getdpetsc(), DIFFERENT_NONZERO_PATTERN);
@@ -58,9 +58,9 @@ class mat
         
         std::shared_ptr<rawmat> getpointer(void);
         
-        // Return [x; bd]:
+        // Return [x; bd]. The slave dofs are then set from their masters:
         vec xbmerge(vec x, vec b);
-        // Return [x; 0]:
+        // Return [x; 0]. The slave dofs are then set from their masters:
         vec x0merge(vec x);
 
         // Return ba - D*bd:
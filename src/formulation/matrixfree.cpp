@@ -0,0 +1,79 @@
+#include "matrixfree.h"
+
+
+PetscErrorCode matrixfreeamult(Mat A, Vec x, Vec y)
+{
+    matrixfree* ctx;
+    MatShellGetContext(A, &ctx);
+    ctx->multiply(x, y, false);
+    
+    return 0;
+}
+
+PetscErrorCode matrixfreedmult(Mat D, Vec x, Vec y)
+{
+    matrixfree* ctx;
+    MatShellGetContext(D, &ctx);
+    ctx->multiply(x, y, true);
+    
+    return 0;
+}
+
+matrixfree::matrixfree(std::shared_ptr<formulation> formul, int KCM, indexmat ainds, indexmat dinds)
+{
+    universe::initializepetsc();
+    
+    myformulation = formul;
+    mykcm = KCM;
+    myainds = ainds;
+    mydinds = dinds;
+}
+
+void matrixfree::multiply(Vec x, Vec y, bool isdblock)
+{
+    indexmat colinds = myainds;
+    if (isdblock)
+        colinds = mydinds;
+        
+    int numrows = myainds.count(), numcols = colinds.count();
+        
+    // Get the input values and place them at the corresponding dofs:
+    densemat xvals(numcols, 1);
+    indexmat xads(numcols, 1, 0, 1);
+    if (numcols > 0)
+        VecGetValues(x, numcols, petscindexes(xads.getvalues(), numcols).getvalues(), xvals.getvalues());
+    
+    densemat xfull(myformulation->getdofmanager()->countdofs(), 1, 0.0);
+    double* xvalsptr = xvals.getvalues();
+    double* xfullptr = xfull.getvalues();
+    int* colindsptr = colinds.getvalues();
+    for (int i = 0; i < numcols; i++)
+        xfullptr[colindsptr[i]] = xvalsptr[i];
+        
+    densemat yfull = myformulation->multiply(mykcm, xfull);
+    
+    // Keep the unconstrained rows:
+    densemat yvals(numrows, 1);
+    indexmat yads(numrows, 1, 0, 1);
+    double* yvalsptr = yvals.getvalues();
+    double* yfullptr = yfull.getvalues();
+    int* aindsptr = myainds.getvalues();
+    for (int i = 0; i < numrows; i++)
+        yvalsptr[i] = yfullptr[aindsptr[i]];
+        
+    if (numrows > 0)
+        VecSetValues(y, numrows, petscindexes(yads.getvalues(), numrows).getvalues(), yvals.getvalues(), INSERT_VALUES);
+    VecAssemblyBegin(y);
+    VecAssemblyEnd(y);
+}
+
+void matrixfree::createpetsc(Mat* Amat, Mat* Dmat)
+{
+    int numainds = myainds.count(), numdinds = mydinds.count();
+
+    MatCreateShell(PETSC_COMM_SELF, numainds, numainds, numainds, numainds, (void*)this, Amat);
+    MatShellSetOperation(*Amat, MATOP_MULT, (void(*)(void))matrixfreeamult);
+    
+    MatCreateShell(PETSC_COMM_SELF, numainds, numdinds, numainds, numdinds, (void*)this, Dmat);
+    MatShellSetOperation(*Dmat, MATOP_MULT, (void(*)(void))matrixfreedmult);
+}
@@ -0,0 +1,50 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This code calls the PETSc library. See https://www.mcs.anl.gov/petsc/ for more information.
+
+// This object provides the product of the A and D blocks of a formulation matrix
+// with a vector without assembling the matrix. It is wrapped in petsc shell matrices.
+
+
+#ifndef MATRIXFREE_H
+#define MATRIXFREE_H
+
+#include <iostream>
+#include <vector>
+#include "formulation.h"
+#include "indexmat.h"
+#include "densemat.h"
+#include "petsc.h"
+#include "petscvec.h"
+#include "petscmat.h"
+#include "petscindexes.h"
+
+class formulation;
+
+class matrixfree
+{
+    private:
+        
+        std::shared_ptr<formulation> myformulation = NULL;
+        
+        // 0 for K, 1 for C and 2 for M:
+        int mykcm = 0;
+        
+        indexmat myainds, mydinds;
+        
+    public:
+        
+        matrixfree(std::shared_ptr<formulation> formul, int KCM, indexmat ainds, indexmat dinds);
+        
+        // Compute y = A*x (or D*x) where x and y are in the local numbering of the A (or D) block:
+        void multiply(Vec x, Vec y, bool isdblock);
+        
+        // Create the petsc shell matrices for the A and D blocks:
+        void createpetsc(Mat* Amat, Mat* Dmat);
+        
+};
+
+#endif
@@ -0,0 +1,42 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This code calls the PETSc library. See https://www.mcs.anl.gov/petsc/ for more information.
+
+// This object gives int indexes to petsc. The petsc index type 'PetscInt' is 64 bits wide
+// when petsc is configured with 64-bit indexes. The indexes are only copied in that case.
+
+
+#ifndef PETSCINDEXES_H
+#define PETSCINDEXES_H
+
+#include <vector>
+#include "petsc.h"
+
+class petscindexes
+{
+    private:
+
+        std::vector<PetscInt> mycopy = {};
+        PetscInt* myindexes = NULL;
+
+    public:
+
+        petscindexes(int* indexes, long long int numindexes)
+        {
+            if (sizeof(PetscInt) == sizeof(int))
+                myindexes = (PetscInt*)indexes;
+            else
+            {
+                mycopy = std::vector<PetscInt>(indexes, indexes+numindexes);
+                myindexes = mycopy.data();
+            }
+        };
+
+        PetscInt* getvalues(void) { return myindexes; };
+
+};
+
+#endif
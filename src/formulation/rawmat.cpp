@@ -1,9 +1,16 @@
 #include "rawmat.h"
+#include "taskscheduler.h"
+#include "autotuning.h"
+#include "metrics.h"
 #include <thread>
+#include <functional>
+#include <limits>
 
 
 rawmat::rawmat(std::shared_ptr<dofmanager> dofmngr)
 {
+    universe::initializepetsc();
+    
     mydofmanager = dofmngr;
     
     mymeshnumber = universe::getrawmesh()->getmeshnumber();
@@ -18,6 +25,19 @@ rawmat::rawmat(std::shared_ptr<dofmanager> dofmngr, Mat inA, Mat inD, indexmat i
     Ainds = inAinds;
     Dinds = inDinds;
     
+    PetscBool issbaij;
+    PetscObjectTypeCompare((PetscObject)inA, MATSEQSBAIJ, &issbaij);
+    myissymmetric = (issbaij == PETSC_TRUE);
+    
+    PetscBool isbaij;
+    PetscObjectTypeCompare((PetscObject)inA, MATSEQBAIJ, &isbaij);
+    if (isbaij == PETSC_TRUE)
+    {
+        PetscInt blocksize;
+        MatGetBlockSize(inA, &blocksize);
+        myblocksize = blocksize;
+    }
+    
     mymeshnumber = universe::getrawmesh()->getmeshnumber();
 }
         
@@ -31,6 +51,8 @@ rawmat::~rawmat(void)
     {
         if (Amat != PETSC_NULL)
             MatDestroy(&Amat);
+        if (Asellmat != PETSC_NULL)
+            MatDestroy(&Asellmat);
         if (Dmat != PETSC_NULL)
             MatDestroy(&Dmat);
         if (isitfactored) 
@@ -54,20 +76,305 @@ long long int rawmat::countcolumns(void)
         return mydofmanager->countdofs();
 }
 
+void rawmat::streaminto(std::shared_ptr<sparsitypattern> pattern, std::vector<bool>& isconstrained)
+{
+    if (pattern == NULL || pattern->isdefined() == false || pattern->mymeshnumber != mymeshnumber || pattern->myisconstrained != isconstrained || pattern->myissymmetric != myissymmetric || accumulatedvals.size() > 0 || mystreampattern != NULL)
+        return;
+        
+    mystreampattern = pattern;
+    
+    streamedAvals = densemat(pattern->nnzA, 1, 0.0);
+    streamedDvals = densemat(pattern->nnzD, 1, 0.0);
+}
+
+bool rawmat::accumulateinpattern(indexmat rowadresses, indexmat coladresses, densemat vals)
+{
+    std::vector<bool>& isconstrained = mystreampattern->myisconstrained;
+    std::vector<int>& renumtolocalindex = mystreampattern->myrenumtolocalindex;
+
+    PetscInt* Arowsptr = mystreampattern->Arows->data();
+    PetscInt* Acolsptr = mystreampattern->Acols->data();
+    PetscInt* Drowsptr = mystreampattern->Drows->data();
+    PetscInt* Dcolsptr = mystreampattern->Dcols->data();
+
+    int* rowadressesptr = rowadresses.getvalues();
+    int* coladressesptr = coladresses.getvalues();
+    double* valsptr = vals.getvalues();
+    
+    int nr = vals.countrows();
+    int nc = vals.countcolumns();
+    int ntr = rowadresses.countrows();
+    int ndr = coladresses.countrows();
+    
+    // Find all positions first to leave the values untouched in case of a missing entry:
+    std::vector<PetscInt> slots(vals.count(), -1);
+    
+    for (int r = 0; r < nr; r++)
+    {
+        int ctr = r, cdr = r;
+        if (ntr != nr || ndr != nr)
+        {
+            ctr = r/ndr;
+            cdr = r%ndr;
+        }
+    
+        for (long long int c = 0; c < nc; c++)
+        {
+            int cr = rowadressesptr[ctr*nc+c];
+            int cc = coladressesptr[cdr*nc+c];
+            
+            if (cr >= 0 && cc >= 0 && isconstrained[cr] == false && isdropped(cr, cc, isconstrained) == false)
+            {
+                int lr = renumtolocalindex[cr];
+                int lc = renumtolocalindex[cc];
+                
+                PetscInt* colsptr = Acolsptr; PetscInt* rowsptr = Arowsptr;
+                if (isconstrained[cc])
+                {
+                    colsptr = Dcolsptr; rowsptr = Drowsptr;
+                }
+                PetscInt* found = std::lower_bound(colsptr + rowsptr[lr], colsptr + rowsptr[lr+1], (PetscInt)lc);
+                if (found == colsptr + rowsptr[lr+1] || *found != lc)
+                    return false;
+                
+                PetscInt pos = found - colsptr;
+                slots[r*nc+c] = isconstrained[cc] ? -2 - pos : pos;
+            }
+        }
+    }
+    
+    double* Avalsptr = streamedAvals.getvalues();
+    double* Dvalsptr = streamedDvals.getvalues();
+    
+    for (long long int j = 0; j < slots.size(); j++)
+    {
+        if (slots[j] >= 0)
+            Avalsptr[slots[j]] += valsptr[j];
+        if (slots[j] < -1)
+            Dvalsptr[-2-slots[j]] += valsptr[j];
+    }
+    
+    return true;
+}
+
+void rawmat::stopstreaming(void)
+{
+    if (mystreampattern == NULL)
+        return;
+        
+    long long int pnnzA = mystreampattern->nnzA, pnnzD = mystreampattern->nnzD;
+        
+    PetscInt* Arowsptr = mystreampattern->Arows->data();
+    PetscInt* Acolsptr = mystreampattern->Acols->data();
+    PetscInt* Drowsptr = mystreampattern->Drows->data();
+    PetscInt* Dcolsptr = mystreampattern->Dcols->data();
+    int* Aindsptr = mystreampattern->Ainds.getvalues();
+    int* Dindsptr = mystreampattern->Dinds.getvalues();
+    
+    double* Avalsptr = streamedAvals.getvalues();
+    double* Dvalsptr = streamedDvals.getvalues();
+    
+    indexmat rowadresses(pnnzA+pnnzD, 1), coladresses(pnnzA+pnnzD, 1);
+    densemat vals(pnnzA+pnnzD, 1);
+    int* rowadressesptr = rowadresses.getvalues();
+    int* coladressesptr = coladresses.getvalues();
+    double* valsptr = vals.getvalues();
+    
+    // Back to the global dof numbering:
+    long long int index = 0;
+    for (int i = 0; i < mystreampattern->Ainds.count(); i++)
+    {
+        for (PetscInt j = Arowsptr[i]; j < Arowsptr[i+1]; j++)
+        {
+            rowadressesptr[index] = Aindsptr[i];
+            coladressesptr[index] = Aindsptr[Acolsptr[j]];
+            valsptr[index] = Avalsptr[j];
+            index++;
+        }
+        for (PetscInt j = Drowsptr[i]; j < Drowsptr[i+1]; j++)
+        {
+            rowadressesptr[index] = Aindsptr[i];
+            coladressesptr[index] = Dindsptr[Dcolsptr[j]];
+            valsptr[index] = Dvalsptr[j];
+            index++;
+        }
+    }
+    
+    mystreampattern = NULL;
+    streamedAvals = densemat(); streamedDvals = densemat();
+
+    accumulate(rowadresses, coladresses, vals);
+}
+
+void rawmat::multiplyinto(densemat x, densemat y)
+{
+    isproductonly = true;
+    
+    myproductinput = x;
+    myproductoutput = y;
+}
+
 void rawmat::accumulate(indexmat rowadresses, indexmat coladresses, densemat vals)
 {
+    indexmat masterrows, mastercols;
+    densemat mastervals;
+    if (vals.count() > 0 && mydofmanager->hasslaves() && moveslaveentries(rowadresses, coladresses, vals, masterrows, mastercols, mastervals))
+    {
+        accumulatefragment(rowadresses, coladresses, vals);
+        accumulatefragment(masterrows, mastercols, mastervals);
+    }
+    else
+        accumulatefragment(rowadresses, coladresses, vals);
+}
+
+bool rawmat::moveslaveentries(indexmat rowadresses, indexmat coladresses, densemat& vals, indexmat& masterrows, indexmat& mastercols, densemat& mastervals)
+{
+    std::shared_ptr<slaverelations> rels = mydofmanager->getslaverelations();
+    if (rels == NULL || rels->count() == 0)
+        return false;
+        
+    int* slavenumber = rels->slavenumber.data();
+    int* masterbegin = rels->masterbegin.data();
+    int* masters = rels->masters.data();
+    double* coefs = rels->coefs.data();
+    
+    int* rowadressesptr = rowadresses.getvalues();
+    int* coladressesptr = coladresses.getvalues();
+    
+    int nr = vals.countrows();
+    int nc = vals.countcolumns();
+    int ntr = rowadresses.countrows();
+    int ndr = coladresses.countrows();
+    
+    // Quick check on the addresses:
+    bool hasslave = false;
+    for (int i = 0; i < rowadresses.count(); i++)
+        hasslave = hasslave || (rowadressesptr[i] >= 0 && slavenumber[rowadressesptr[i]] >= 0);
+    for (int i = 0; i < coladresses.count(); i++)
+        hasslave = hasslave || (coladressesptr[i] >= 0 && slavenumber[coladressesptr[i]] >= 0);
+    if (hasslave == false)
+        return false;
+    
+    vals = vals.copy();
+    double* valsptr = vals.getvalues();
+    
+    std::vector<int> mrows = {}, mcols = {};
+    std::vector<double> mvals = {};
+    
+    for (int r = 0; r < nr; r++)
+    {
+        int ctr = r, cdr = r;
+        if (ntr != nr || ndr != nr)
+        {
+            ctr = r/ndr;
+            cdr = r%ndr;
+        }
+    
+        for (long long int c = 0; c < nc; c++)
+        {
+            int cr = rowadressesptr[ctr*nc+c];
+            int cc = coladressesptr[cdr*nc+c];
+            
+            if (cr < 0 || cc < 0 || (slavenumber[cr] < 0 && slavenumber[cc] < 0))
+                continue;
+            
+            double val = valsptr[r*nc+c];
+            valsptr[r*nc+c] = 0;
+            
+            // A non-slave dof is its own single master:
+            int rs = slavenumber[cr], cs = slavenumber[cc];
+            int rb = 0, re = 1, cb = 0, ce = 1;
+            if (rs >= 0)
+            {
+                rb = masterbegin[rs]; re = masterbegin[rs+1];
+            }
+            if (cs >= 0)
+            {
+                cb = masterbegin[cs]; ce = masterbegin[cs+1];
+            }
+            
+            for (int i = rb; i < re; i++)
+            {
+                int mr = cr; double rc = 1.0;
+                if (rs >= 0)
+                {
+                    mr = masters[i]; rc = coefs[i];
+                }
+                for (int j = cb; j < ce; j++)
+                {
+                    int mc = cc; double cf = 1.0;
+                    if (cs >= 0)
+                    {
+                        mc = masters[j]; cf = coefs[j];
+                    }
+                    mrows.push_back(mr);
+                    mcols.push_back(mc);
+                    mvals.push_back(rc*cf*val);
+                }
+            }
+        }
+    }
+    
+    masterrows = indexmat(mrows.size(), 1, mrows);
+    mastercols = indexmat(mcols.size(), 1, mcols);
+    mastervals = densemat(mvals.size(), 1, mvals);
+    
+    return true;
+}
+
+void rawmat::accumulatefragment(indexmat rowadresses, indexmat coladresses, densemat vals)
+{
+    if (vals.count() > 0 && isproductonly)
+    {
+        int* rowadressesptr = rowadresses.getvalues();
+        int* coladressesptr = coladresses.getvalues();
+        double* valsptr = vals.getvalues();
+        double* xptr = myproductinput.getvalues();
+        double* yptr = myproductoutput.getvalues();
+        
+        int nr = vals.countrows();
+        int nc = vals.countcolumns();
+        int ntr = rowadresses.countrows();
+        int ndr = coladresses.countrows();
+        
+        for (int r = 0; r < nr; r++)
+        {
+            int ctr = r, cdr = r;
+            if (ntr != nr || ndr != nr)
+            {
+                ctr = r/ndr;
+                cdr = r%ndr;
+            }
+        
+            for (long long int c = 0; c < nc; c++)
+            {
+                int cr = rowadressesptr[ctr*nc+c];
+                int cc = coladressesptr[cdr*nc+c];
+                
+                if (cr >= 0 && cc >= 0)
+                    yptr[cr] += valsptr[r*nc+c] * xptr[cc];
+            }
+        }
+        return;
+    }
+
     if (vals.count() > 0)
     {
+        if (mystreampattern != NULL && accumulateinpattern(rowadresses, coladresses, vals))
+            return;
+        // Entries outside of the pattern:
+        stopstreaming();
+    
         accumulatedrowindices.push_back(rowadresses);
         accumulatedcolindices.push_back(coladresses);
         accumulatedvals.push_back(vals);
     }
 }
 
-void processrows(int firstrow, int lastrow, int* maxnnzinrows, long long int* adsofrows, std::pair<int, double>* valsptr, std::vector<bool>* isconstrained, int* nnzApart, int* nnzDpart)
+void processrows(int firstrow, int lastrow, int* maxnnzinrows, long long int* adsofrows, std::pair<int, double>* valsptr, std::vector<bool>* isconstrained, long long int* nnzApart, long long int* nnzDpart)
 {
     // Avoid cache line invalidation:
-    int curnnzA = 0, curnnzD = 0;
+    long long int curnnzA = 0, curnnzD = 0;
     
     for (int i = firstrow; i <= lastrow; i++)
     {
@@ -124,21 +431,15 @@ void processrows(int firstrow, int lastrow, int* maxnnzinrows, long long int* ad
     *nnzDpart = curnnzD;
 }
 
-void rawmat::process(std::vector<bool>& isconstrained)
+long long int rawmat::collectinrows(int firstrow, int lastrow, std::vector<bool>& isconstrained, int* nnzinrows, long long int* adsofrows, std::pair<int, double>* valsptr)
 {
-    int ndofs = countrows();
+    long long int numcollected = 0;
     
-    // Create Ainds and Dinds:
-    std::vector<int> renumtolocalindex;
-    gentools::findtruefalse(isconstrained, Dinds, Ainds, renumtolocalindex);
-    
-    // Get an upper bound on the number of nonzeros in each row:
-    long long int maxnnz = 0;
-    std::vector<int> maxnnzinrows(ndofs, 0);
     for (int i = 0; i < accumulatedvals.size(); i++)
     {
         int* accumulatedrowindicesptr = accumulatedrowindices[i].getvalues();
         int* accumulatedcolindicesptr = accumulatedcolindices[i].getvalues();
+        double* accumulatedvalsptr = accumulatedvals[i].getvalues();
         
         int nr = accumulatedvals[i].countrows();
         int nc = accumulatedvals[i].countcolumns();
@@ -157,32 +458,261 @@ void rawmat::process(std::vector<bool>& isconstrained)
             for (long long int c = 0; c < nc; c++)
             {
                 int cr = accumulatedrowindicesptr[ctr*nc+c];
-                int cc = accumulatedcolindicesptr[cdr*nc+c];
                 
-                if (cr >= 0 && cc >= 0 && isconstrained[cr] == false)
+                if (cr < firstrow || cr > lastrow || isconstrained[cr])
+                    continue;
+                
+                int cc = accumulatedcolindicesptr[cdr*nc+c];
+                    
+                if (cc >= 0 && isdropped(cr, cc, isconstrained) == false)
                 {
-                    maxnnzinrows[cr]++;
-                    maxnnz++;
+                    if (valsptr != NULL)
+                    {
+                        long long int curind = adsofrows[cr] + nnzinrows[cr-firstrow];
+                        valsptr[curind].first = cc;
+                        valsptr[curind].second = accumulatedvalsptr[r*nc+c];
+                    }
+                    nnzinrows[cr-firstrow]++;
+                    numcollected++;
                 }
             }
         } 
     }
+    
+    return numcollected;
+}
 
-    // Create a vector for direct addressing:
+void rawmat::process(std::vector<bool>& isconstrained, std::shared_ptr<sparsitypattern> pattern)
+{
+    profilephase phase("rawmat process", false);
+    
+    if (mystreampattern != NULL)
+    {
+        if (isconstrained == mystreampattern->myisconstrained)
+        {
+            nnzA = mystreampattern->nnzA; nnzD = mystreampattern->nnzD;
+            
+            Arows = mystreampattern->Arows; Acols = mystreampattern->Acols; Drows = mystreampattern->Drows; Dcols = mystreampattern->Dcols;
+            Ainds = mystreampattern->Ainds; Dinds = mystreampattern->Dinds;
+            
+            Avals = streamedAvals; Dvals = streamedDvals;
+            
+            mypattern = mystreampattern;
+            
+            createpetscmatrices();
+            return;
+        }
+        
+        // The streamed values do not include the rows constrained in the pattern:
+        for (int i = 0; i < isconstrained.size(); i++)
+        {
+            if (mystreampattern->myisconstrained[i] && isconstrained[i] == false)
+            {
+                std::cout << "Error in 'rawmat' object: cannot remove constraints from a matrix assembled in a sparsity pattern" << std::endl;
+                abort();
+            }
+        }
+        stopstreaming();
+    }
+
+    if (pattern != NULL && pattern->myissymmetric == myissymmetric && pattern->ismatching(mymeshnumber, isconstrained, accumulatedrowindices, accumulatedcolindices, accumulatedvals))
+    {
+        processwithpattern(pattern);
+        mypattern = pattern;
+        return;
+    }
+
+    int ndofs = countrows();
+    
+    // Create Ainds and Dinds:
+    std::vector<int> renumtolocalindex;
+    mydofmanager->getconstraintsplit(isconstrained, Ainds, Dinds, renumtolocalindex);
+    
+    // Every thread owns a range of rows. All fragments are scanned by every thread but only the entries
+    // in the owned rows are treated. The entries thus appear in each row in the same order as with a
+    // single thread and the values are summed in an order independent of the number of threads.
+    int numthreadstouse = autotuning::getnumthreadsforitems(ndofs); // require a min num dofs per thread
+    int rowchunksize = ndofs/numthreadstouse+1;
+    
+    std::vector<int> firstrows(numthreadstouse), lastrows(numthreadstouse);
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        firstrows[t] = std::min(t*rowchunksize, ndofs);
+        lastrows[t] = std::min((t+1)*rowchunksize-1, ndofs-1);
+    }
+    
+    // Run a function for every row range with one thread per range. A range is always treated by the same
+    // pool thread so that the csr arrays and values are first written by the threads that later use them:
+    auto runonrowranges = [&](std::function<void(int)> func)
+    {
+        taskscheduler::runperthread(numthreadstouse, func);
+    };
+    
+    // Get an upper bound on the number of nonzeros in each row:
+    std::vector<int> maxnnzinrows(ndofs, 0);
+    std::vector<long long int> maxnnzinranges(numthreadstouse, 0);
+    runonrowranges([&](int t)
+    {
+        maxnnzinranges[t] = collectinrows(firstrows[t], lastrows[t], isconstrained, maxnnzinrows.data()+firstrows[t], NULL, NULL);
+    });
+    long long int maxnnz = 0;
+    std::vector<long long int> rangeoffsets(numthreadstouse, 0);
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        rangeoffsets[t] = maxnnz;
+        maxnnz += maxnnzinranges[t];
+    }
+    
+    // Collect the values for each row then sort and remove the duplicates:
     std::vector<long long int> adsofrows(ndofs, 0);
-    for (int i = 1; i < ndofs; i++)
-        adsofrows[i] = adsofrows[i-1] + maxnnzinrows[i-1];
+    // The pairs are constructed by the thread of each row range (first-touch) and not here:
+    std::unique_ptr<char[]> valspairs(new char[maxnnz*sizeof(std::pair<int, double>)]);
+    std::pair<int, double>* valsptr = (std::pair<int, double>*)valspairs.get();
+
+    std::vector<long long int> nnzAparts(numthreadstouse, 0), nnzDparts(numthreadstouse, 0);    
+    runonrowranges([&](int t)
+    {
+        // Create a vector for direct addressing:
+        long long int curad = rangeoffsets[t];
+        for (int i = firstrows[t]; i <= lastrows[t]; i++)
+        {
+            adsofrows[i] = curad;
+            curad += maxnnzinrows[i];
+        }
+        
+        std::uninitialized_fill(valsptr+rangeoffsets[t], valsptr+rangeoffsets[t]+maxnnzinranges[t], std::pair<int, double>(0, 0.0));
+        
+        std::vector<int> indexinrow(lastrows[t]-firstrows[t]+1, 0);
+        collectinrows(firstrows[t], lastrows[t], isconstrained, indexinrow.data(), adsofrows.data(), valsptr);
+        
+        processrows(firstrows[t], lastrows[t], maxnnzinrows.data(), adsofrows.data(), valsptr, &isconstrained, &nnzAparts[t], &nnzDparts[t]);
+    });
+
+    nnzA = 0; nnzD = 0;
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        nnzA += nnzAparts[t];
+        nnzD += nnzDparts[t];
+    }
+    
+    if (nnzA > std::numeric_limits<PetscInt>::max() || nnzD > std::numeric_limits<PetscInt>::max())
+    {
+        std::cout << "Error in 'rawmat' object: the " << std::max(nnzA, nnzD) << " nonzeros exceed the petsc index range (configure petsc with 64-bit indexes)" << std::endl;
+        abort();
+    }
+
+    // Create A and D:
+    Arows = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(Ainds.count()+1));
+    Acols = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(nnzA));
+    Avals = densemat(nnzA, 1);
+    PetscInt* Arowsptr = Arows->data();
+    PetscInt* Acolsptr = Acols->data();
+    double* Avalsptr = Avals.getvalues();
+    
+    Drows = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(Ainds.count()+1));
+    Dcols = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(nnzD));
+    Dvals = densemat(nnzD, 1);
+    PetscInt* Drowsptr = Drows->data();
+    PetscInt* Dcolsptr = Dcols->data();
+    double* Dvalsptr = Dvals.getvalues();
+    
+    // Position of the first A and D value of each row range:
+    std::vector<PetscInt> firstA(numthreadstouse, 0), firstD(numthreadstouse, 0);
+    for (int t = 1; t < numthreadstouse; t++)
+    {
+        firstA[t] = firstA[t-1] + nnzAparts[t-1];
+        firstD[t] = firstD[t-1] + nnzDparts[t-1];
+    }
+    
+    runonrowranges([&](int t)
+    {
+        PetscInt curA = firstA[t], curD = firstD[t];
         
-    // Collect the values for each row:
-    std::vector<std::pair<int, double>> valspairs(maxnnz);
-    std::pair<int, double>* valsptr = valspairs.data();
+        for (int i = firstrows[t]; i <= lastrows[t]; i++)
+        {
+            if (isconstrained[i])
+                continue;
+        
+            int index = renumtolocalindex[i];
+            Arowsptr[index] = curA;
+            Drowsptr[index] = curD;
+            
+            std::pair<int, double>* curvalsptr = valsptr + adsofrows[i];        
+
+            for (int j = 0; j < maxnnzinrows[i]; j++)
+            {
+                int cc = curvalsptr[j].first;
+                double cv = curvalsptr[j].second;
+                
+                if (isconstrained[cc])
+                {
+                    Dcolsptr[curD] = renumtolocalindex[cc];
+                    Dvalsptr[curD] = cv;
+                    curD++;
+                }
+                else
+                {
+                    Acolsptr[curA] = renumtolocalindex[cc];
+                    Avalsptr[curA] = cv;
+                    curA++;
+                }
+            }
+        }
+    });
+    Arowsptr[Ainds.count()] = nnzA;
+    Drowsptr[Ainds.count()] = nnzD;
+
+    if (pattern != NULL)
+    {
+        definepattern(pattern, isconstrained, renumtolocalindex);
+        mypattern = pattern;
+    }
+
+    createpetscmatrices();
+}
+
+void rawmat::definepattern(std::shared_ptr<sparsitypattern> pattern, std::vector<bool>& isconstrained, std::vector<int>& renumtolocalindex)
+{
+    pattern->clear();
+    
+    pattern->mymeshnumber = mymeshnumber;
+    pattern->myisconstrained = isconstrained;
+    pattern->myissymmetric = myissymmetric;
+    
+    pattern->nnzA = nnzA; pattern->nnzD = nnzD;
+    pattern->Arows = Arows; pattern->Acols = Acols; pattern->Drows = Drows; pattern->Dcols = Dcols;
+    pattern->Ainds = Ainds; pattern->Dinds = Dinds;
+    pattern->myrenumtolocalindex = renumtolocalindex;
+    
+    PetscInt* Arowsptr = Arows->data();
+    PetscInt* Acolsptr = Acols->data();
+    PetscInt* Drowsptr = Drows->data();
+    PetscInt* Dcolsptr = Dcols->data();
+    
+    long long int numentries = 0;
+    pattern->myfragmentsizes = std::vector<int>(4*accumulatedvals.size());
+    pattern->myadresshashes = std::vector<unsigned long long int>(2*accumulatedvals.size());
+    for (int i = 0; i < accumulatedvals.size(); i++)
+    {
+        pattern->myfragmentsizes[4*i+0] = accumulatedvals[i].countrows();
+        pattern->myfragmentsizes[4*i+1] = accumulatedvals[i].countcolumns();
+        pattern->myfragmentsizes[4*i+2] = accumulatedrowindices[i].countrows();
+        pattern->myfragmentsizes[4*i+3] = accumulatedcolindices[i].countrows();
+        pattern->myadresshashes[2*i+0] = sparsitypattern::hashadresses(accumulatedrowindices[i]);
+        pattern->myadresshashes[2*i+1] = sparsitypattern::hashadresses(accumulatedcolindices[i]);
+        
+        numentries += accumulatedvals[i].count();
+    }
+    
+    // The columns in each csr row are sorted and can thus be found with a binary search:
+    pattern->myslots = std::vector<PetscInt>(numentries, -1);
+    PetscInt* slotsptr = pattern->myslots.data();
     
-    std::vector<int> indexinrow(ndofs, 0);
+    long long int index = 0;
     for (int i = 0; i < accumulatedvals.size(); i++)
     {
         int* accumulatedrowindicesptr = accumulatedrowindices[i].getvalues();
         int* accumulatedcolindicesptr = accumulatedcolindices[i].getvalues();
-        double* accumulatedvalsptr = accumulatedvals[i].getvalues();
         
         int nr = accumulatedvals[i].countrows();
         int nc = accumulatedvals[i].countcolumns();
@@ -203,97 +733,140 @@ void rawmat::process(std::vector<bool>& isconstrained)
                 int cr = accumulatedrowindicesptr[ctr*nc+c];
                 int cc = accumulatedcolindicesptr[cdr*nc+c];
                 
-                double cv = accumulatedvalsptr[r*nc+c];
-                    
-                if (cr >= 0 && cc >= 0 && isconstrained[cr] == false)
+                if (cr >= 0 && cc >= 0 && isconstrained[cr] == false && isdropped(cr, cc, isconstrained) == false)
                 {
-                    long long int curind = adsofrows[cr] + indexinrow[cr];
-                    valsptr[curind].first = cc;
-                    valsptr[curind].second = cv;
+                    int lr = renumtolocalindex[cr];
+                    int lc = renumtolocalindex[cc];
                     
-                    indexinrow[cr]++;
+                    if (isconstrained[cc])
+                        slotsptr[index] = -2 - (std::lower_bound(Dcolsptr + Drowsptr[lr], Dcolsptr + Drowsptr[lr+1], lc) - Dcolsptr);
+                    else
+                        slotsptr[index] = std::lower_bound(Acolsptr + Arowsptr[lr], Acolsptr + Arowsptr[lr+1], lc) - Acolsptr;
                 }
+                index++;
             }
         } 
     }
+    
+    pattern->isitdefined = true;
+}
 
-    // Multithreaded sort and duplicate removal:
-    int numthreadstouse = std::min(ndofs/10000+1, universe::getmaxnumthreads()); // require a min num dofs per thread
-
-    std::vector<int> nnzAparts(numthreadstouse, 0), nnzDparts(numthreadstouse, 0);    
-    if (numthreadstouse > 1)
+void rawmat::processwithpattern(std::shared_ptr<sparsitypattern> pattern)
+{
+    nnzA = pattern->nnzA; nnzD = pattern->nnzD;
+    
+    // The structure arrays are shared with the pattern (they are never modified):
+    Arows = pattern->Arows; Acols = pattern->Acols; Drows = pattern->Drows; Dcols = pattern->Dcols;
+    Ainds = pattern->Ainds; Dinds = pattern->Dinds;
+    
+    Avals = densemat(nnzA, 1, 0.0);
+    Dvals = densemat(nnzD, 1, 0.0);
+    double* Avalsptr = Avals.getvalues();
+    double* Dvalsptr = Dvals.getvalues();
+    
+    PetscInt* slotsptr = pattern->myslots.data();
+    
+    long long int index = 0;
+    for (int i = 0; i < accumulatedvals.size(); i++)
     {
-        std::vector<std::thread> threadobjs(numthreadstouse);
-        int rowchunksize = ndofs/numthreadstouse+1;
-
-        for (int t = 0; t < numthreadstouse; t++)
-            threadobjs[t] = std::thread(processrows, t*rowchunksize, std::min((t+1)*rowchunksize-1, ndofs-1), maxnnzinrows.data(), adsofrows.data(), valsptr, &isconstrained, &nnzAparts[t], &nnzDparts[t]);
+        double* accumulatedvalsptr = accumulatedvals[i].getvalues();
+        long long int numentries = accumulatedvals[i].count();
         
-        for (int t = 0; t < numthreadstouse; t++)
-            threadobjs[t].join();
+        for (long long int j = 0; j < numentries; j++)
+        {
+            PetscInt slot = slotsptr[index+j];
+            
+            if (slot >= 0)
+                Avalsptr[slot] += accumulatedvalsptr[j];
+            if (slot < -1)
+                Dvalsptr[-2-slot] += accumulatedvalsptr[j];
+        }
+        index += numentries;
     }
-    else
-        processrows(0, ndofs-1, maxnnzinrows.data(), adsofrows.data(), valsptr, &isconstrained, &nnzAparts[0], &nnzDparts[0]);
-
-    nnzA = gentools::sum(nnzAparts);
-    nnzD = gentools::sum(nnzDparts);
+    
+    createpetscmatrices();
+}
 
-    // Create A and D:
-    Arows = indexmat(Ainds.count()+1,1);
-    Acols = indexmat(nnzA, 1);
-    Avals = densemat(nnzA, 1);
-    int* Arowsptr = Arows.getvalues();
-    int* Acolsptr = Acols.getvalues();
-    double* Avalsptr = Avals.getvalues();
+bool rawmat::isblockaligned(int blocksize)
+{
+    int numrows = Ainds.count();
+    if (numrows%blocksize != 0)
+        return false;
     
-    Drows = indexmat(Ainds.count()+1,1);
-    Dcols = indexmat(nnzD, 1);
-    Dvals = densemat(nnzD, 1);
-    int* Drowsptr = Drows.getvalues();
-    int* Dcolsptr = Dcols.getvalues();
-    double* Dvalsptr = Dvals.getvalues();
+    // Each block of unconstrained dofs must be a whole block of interleaved components:
+    int* aindsptr = Ainds.getvalues();
+    for (int i = 0; i < numrows; i += blocksize)
+    {
+        if (aindsptr[i]%blocksize != 0 || aindsptr[i+blocksize-1] != aindsptr[i]+blocksize-1)
+            return false;
+    }
     
-    Arowsptr[0] = 0;
-    Drowsptr[0] = 0;
+    return true;
+}
 
-    int index = 0;
-    for (int i = 0; i < ndofs; i++)
+void rawmat::createpetscmatrices(void)
+{
+    if (metrics::isenabled())
+        metrics::set("matrix_nonzeros", nnzA);
+    
+    int numrows = Ainds.count();
+    int blocksize = mydofmanager->getblocksize();
+    
+    if (myissell && myissymmetric)
     {
-        if (isconstrained[i])
-            continue;
+        std::cout << "Error in 'rawmat' object: the sell format cannot be used with symmetric storage" << std::endl;
+        abort();
+    }
     
-        Arowsptr[index+1] = Arowsptr[index];
-        Drowsptr[index+1] = Drowsptr[index];
+    myblocksize = 1;
+    if (myissymmetric == false && myissell == false && blocksize > 1 && isblockaligned(blocksize))
+        myblocksize = blocksize;
+    
+    // The csr arrays of A only hold the upper triangle for symmetric matrices:
+    if (myissymmetric)
+        MatCreateSeqSBAIJWithArrays(PETSC_COMM_SELF, 1, numrows, numrows, Arows->data(), Acols->data(), Avals.getvalues(), &Amat);
+    if (myissymmetric == false && myblocksize == 1)
+        MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, numrows, numrows, Arows->data(), Acols->data(), Avals.getvalues(), &Amat);
+    if (myblocksize > 1)
+    {
+        PetscInt* Arowsptr = Arows->data();
+        PetscInt* Acolsptr = Acols->data();
+        double* Avalsptr = Avals.getvalues();
         
-        std::pair<int, double>* curvalsptr = valsptr + adsofrows[i];        
-
-        for (int j = 0; j < maxnnzinrows[i]; j++)
+        // Count the nonzero blocks in every block row:
+        int numblockrows = numrows/myblocksize;
+        std::vector<int> nnzinblockrows(numblockrows, 0);
+        std::vector<int> lastblockrow(numblockrows, -1);
+        for (int br = 0; br < numblockrows; br++)
         {
-            int cc = curvalsptr[j].first;
-            double cv = curvalsptr[j].second;
-            
-            if (isconstrained[cc])
-            {
-                Dcolsptr[Drowsptr[index+1]] = renumtolocalindex[cc];
-                Dvalsptr[Drowsptr[index+1]] = cv;
-                Drowsptr[index+1]++;
-            }
-            else
+            for (int r = br*myblocksize; r < (br+1)*myblocksize; r++)
             {
-                Acolsptr[Arowsptr[index+1]] = renumtolocalindex[cc];
-                Avalsptr[Arowsptr[index+1]] = cv;
-                Arowsptr[index+1]++;
+                for (PetscInt j = Arowsptr[r]; j < Arowsptr[r+1]; j++)
+                {
+                    int bc = Acolsptr[j]/myblocksize;
+                    if (lastblockrow[bc] != br)
+                    {
+                        lastblockrow[bc] = br;
+                        nnzinblockrows[br]++;
+                    }
+                }
             }
         }
-        index++;
+        
+        MatCreateSeqBAIJ(PETSC_COMM_SELF, myblocksize, numrows, numrows, 0, nnzinblockrows.data(), &Amat);
+        for (PetscInt r = 0; r < numrows; r++)
+            MatSetValues(Amat, 1, &r, Arowsptr[r+1]-Arowsptr[r], &Acolsptr[Arowsptr[r]], &Avalsptr[Arowsptr[r]], INSERT_VALUES);
+        
+        // The values are copied in the baij matrix (the pattern, if any, keeps its own csr structure):
+        Arows = NULL; Acols = NULL; Avals = densemat();
     }
-
-    // Create the petsc objects:
-    MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, Ainds.count(), Ainds.count(), Arowsptr, Acolsptr, Avalsptr, &Amat);
     MatAssemblyBegin(Amat, MAT_FINAL_ASSEMBLY);
     MatAssemblyEnd(Amat, MAT_FINAL_ASSEMBLY);
+    
+    if (myissell)
+        createsellmatrix();
 
-    MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, Ainds.count(), Dinds.count(), Drowsptr, Dcolsptr, Dvalsptr, &Dmat);
+    MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, numrows, Dinds.count(), Drows->data(), Dcols->data(), Dvals.getvalues(), &Dmat);
     MatAssemblyBegin(Dmat, MAT_FINAL_ASSEMBLY);
     MatAssemblyEnd(Dmat, MAT_FINAL_ASSEMBLY);
 }
@@ -303,6 +876,9 @@ void rawmat::clearfragments(void)
     accumulatedrowindices = {};
     accumulatedcolindices = {};
     accumulatedvals = {};
+    
+    mystreampattern = NULL;
+    streamedAvals = densemat(); streamedDvals = densemat();
 }
 
 void rawmat::print(void)
@@ -325,14 +901,77 @@ void rawmat::print(void)
     std::cout << std::endl;
 }
 
+memoryusage rawmat::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    long long int fragmentbytes = 0;
+    for (int i = 0; i < accumulatedvals.size(); i++)
+        fragmentbytes += accumulatedrowindices[i].count()*sizeof(int) + accumulatedcolindices[i].count()*sizeof(int) + accumulatedvals[i].count()*sizeof(double);
+    output.add("accumulated fragments", fragmentbytes);
+    
+    long long int csrbytes = (Avals.count() + Dvals.count() + streamedAvals.count() + streamedDvals.count())*sizeof(double) + (Ainds.count() + Dinds.count())*sizeof(int);
+    std::vector<csrindexes> csrinds = {Arows, Acols, Drows, Dcols};
+    for (int i = 0; i < csrinds.size(); i++)
+    {
+        if (csrinds[i] != NULL)
+            csrbytes += memoryusage::countbytes(*csrinds[i]);
+    }
+    output.add("csr storage", csrbytes);
+    
+    // Memory allocated by petsc itself (the csr storage above is only wrapped):
+    MatInfo info;
+    long long int petscbytes = 0;
+    if (Amat != PETSC_NULL)
+    {
+        MatGetInfo(Amat, MAT_LOCAL, &info);
+        petscbytes += info.memory;
+    }
+    if (Dmat != PETSC_NULL)
+    {
+        MatGetInfo(Dmat, MAT_LOCAL, &info);
+        petscbytes += info.memory;
+    }
+    output.add("petsc matrices", petscbytes);
+    
+    // Factorization kept for reuse:
+    if (myksp != PETSC_NULL)
+    {
+        PC pc;
+        KSPGetPC(myksp, &pc);
+        PetscBool islu = PETSC_FALSE, ischolesky = PETSC_FALSE;
+        PetscObjectTypeCompare((PetscObject)pc, PCLU, &islu);
+        PetscObjectTypeCompare((PetscObject)pc, PCCHOLESKY, &ischolesky);
+        Mat factored = PETSC_NULL;
+        if (islu || ischolesky)
+            PCFactorGetMatrix(pc, &factored);
+        if (factored != PETSC_NULL)
+        {
+            MatGetInfo(factored, MAT_LOCAL, &info);
+            output.add("petsc factorization", info.memory);
+        }
+    }
+    
+    return output;
+}
+
 std::shared_ptr<rawmat> rawmat::extractaccumulated(void)
 {
     std::shared_ptr<rawmat> output(new rawmat(mydofmanager));
     
+    output->myissymmetric = myissymmetric;
+    output->myissell = myissell;
     output->accumulatedrowindices = accumulatedrowindices;
     output->accumulatedcolindices = accumulatedcolindices;
     output->accumulatedvals = accumulatedvals;
     
+    if (mystreampattern != NULL)
+    {
+        output->mystreampattern = mystreampattern;
+        output->streamedAvals = streamedAvals.copy();
+        output->streamedDvals = streamedDvals.copy();
+    }
+    
     return output;
 }
 
@@ -356,13 +995,260 @@ Mat rawmat::getdpetsc(void)
     return Dmat;
 }
 
+void rawmat::createsellmatrix(void)
+{
+    if (Asellmat != PETSC_NULL)
+        MatDestroy(&Asellmat);
+    
+    PetscInt numrows = Ainds.count();
+    
+    PetscInt* Arowsptr = Arows->data();
+    PetscInt* Acolsptr = Acols->data();
+    double* Avalsptr = Avals.getvalues();
+    
+    // The rows are sorted so that the slices are filled directly without any reordering:
+    std::vector<PetscInt> rowlengths(numrows);
+    PetscInt maxrowlength = 0;
+    for (PetscInt r = 0; r < numrows; r++)
+    {
+        rowlengths[r] = Arowsptr[r+1]-Arowsptr[r];
+        maxrowlength = std::max(maxrowlength, rowlengths[r]);
+    }
+    
+    MatCreateSeqSELL(PETSC_COMM_SELF, numrows, numrows, maxrowlength, rowlengths.data(), &Asellmat);
+    for (PetscInt r = 0; r < numrows; r++)
+        MatSetValues(Asellmat, 1, &r, rowlengths[r], &Acolsptr[Arowsptr[r]], &Avalsptr[Arowsptr[r]], INSERT_VALUES);
+    MatAssemblyBegin(Asellmat, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(Asellmat, MAT_FINAL_ASSEMBLY);
+    
+    PetscObjectStateGet((PetscObject)Amat, &mysellstate);
+}
+
+Mat rawmat::getsellpetsc(void)
+{
+    if (myissell == false || Amat == PETSC_NULL)
+        return Amat;
+    
+    // A was modified (or has no csr arrays) since the sell copy was created:
+    PetscObjectState state;
+    PetscObjectStateGet((PetscObject)Amat, &state);
+    if (Asellmat == PETSC_NULL || state != mysellstate)
+    {
+        if (Asellmat != PETSC_NULL)
+            MatDestroy(&Asellmat);
+        MatConvert(Amat, MATSEQSELL, MAT_INITIAL_MATRIX, &Asellmat);
+        mysellstate = state;
+    }
+    
+    return Asellmat;
+}
+
 std::shared_ptr<dofmanager> rawmat::getdofmanager(void)
 {
     return mydofmanager;
 }
 
+bool rawmat::geteliminationproduct(densemat bd, densemat& product)
+{
+    if (mymatrixfree != NULL || myeliminatedbd.count() != bd.count() || Dmat == PETSC_NULL)
+        return false;
+    
+    PetscObjectState state;
+    PetscObjectStateGet((PetscObject)Dmat, &state);
+    if (state != myeliminationstate)
+        return false;
+    
+    double* bdptr = bd.getvalues();
+    double* keptptr = myeliminatedbd.getvalues();
+    for (long long int i = 0; i < bd.count(); i++)
+    {
+        if (bdptr[i] != keptptr[i])
+            return false;
+    }
+    
+    product = myeliminationproduct;
+    
+    return true;
+}
+
+void rawmat::seteliminationproduct(densemat bd, densemat product)
+{
+    if (mymatrixfree != NULL || Dmat == PETSC_NULL)
+        return;
+        
+    PetscObjectStateGet((PetscObject)Dmat, &myeliminationstate);
+    myeliminatedbd = bd.copy();
+    myeliminationproduct = product;
+}
+
 KSP* rawmat::getksp(void)
 {
     return &myksp;
 }
 
+void rawmat::takeksp(std::shared_ptr<rawmat> source)
+{
+    if (source == NULL || source.get() == this || source->isitfactored == false)
+        return;
+    if (countrows() != source->countrows())
+    {
+        std::cout << "Error in 'rawmat' object: cannot take the ksp of a matrix of different size" << std::endl;
+        abort();
+    }
+    
+    if (isitfactored)
+        KSPDestroy(&myksp);
+    myksp = source->myksp;
+    isitfactored = true;
+    
+    source->myksp = PETSC_NULL;
+    source->isitfactored = false;
+}
+
+
+// Increase the version number when the layout changes:
+static const char matrixfilemagic[8] = {'S','L','M','A','T','R','X','\0'};
+static const int matrixfileversion = 1;
+
+// Append the length (as a 64 bit integer) then the values to the file:
+template <typename T>
+static void writematrixvector(std::ofstream& outfile, const T* values, long long int len)
+{
+    outfile.write((char*)&len, sizeof(long long int));
+    if (len > 0)
+        outfile.write((char*)values, len*sizeof(T));
+}
+
+// Read a vector written by 'writematrixvector'. Return false if the file is truncated or the length is not the expected one:
+template <typename T>
+static bool readmatrixvector(std::ifstream& infile, std::vector<T>& values, long long int expectedlength = -1)
+{
+    long long int len = -1;
+    infile.read((char*)&len, sizeof(long long int));
+    if (infile.fail() || len < 0 || (expectedlength >= 0 && len != expectedlength))
+        return false;
+    values.resize(len);
+    if (len > 0)
+        infile.read((char*)values.data(), len*sizeof(T));
+    return not(infile.fail());
+}
+
+// Get the csr arrays of a petsc matrix (only the upper triangle for sbaij matrices):
+static void getcsr(Mat petscmat, bool isupper, std::vector<PetscInt>& rows, std::vector<PetscInt>& cols, std::vector<double>& vals)
+{
+    PetscInt numrows, numcols;
+    MatGetSize(petscmat, &numrows, &numcols);
+    if (isupper)
+        MatSetOption(petscmat, MAT_GETROW_UPPERTRIANGULAR, PETSC_TRUE);
+    
+    rows = std::vector<PetscInt>(numrows+1, 0);
+    cols = {}; vals = {};
+    for (PetscInt r = 0; r < numrows; r++)
+    {
+        PetscInt ncols;
+        const PetscInt* rowcols;
+        const PetscScalar* rowvals;
+        MatGetRow(petscmat, r, &ncols, &rowcols, &rowvals);
+        cols.insert(cols.end(), rowcols, rowcols+ncols);
+        vals.insert(vals.end(), rowvals, rowvals+ncols);
+        rows[r+1] = rows[r]+ncols;
+        MatRestoreRow(petscmat, r, &ncols, &rowcols, &rowvals);
+    }
+}
+
+void rawmat::write(std::string filename, std::string fingerprint)
+{
+    if (Amat == PETSC_NULL || mymatrixfree != NULL)
+    {
+        std::cout << "Error in 'rawmat' object: only processed and assembled matrices can be written to a file" << std::endl;
+        abort();
+    }
+    
+    std::ofstream outfile(filename.c_str(), std::ios::out | std::ios::binary);
+    if (not(outfile.is_open()))
+    {
+        std::cout << "Unable to write matrix to file '" << filename << "' or file not found" << std::endl;
+        abort();
+    }
+    
+    outfile.write(matrixfilemagic, 8);
+    // The sizes of the types are written to reject a file written on an incompatible platform:
+    std::vector<int> header = {matrixfileversion, (int)sizeof(int), (int)sizeof(PetscInt), (int)sizeof(double), myissymmetric};
+    writematrixvector(outfile, header.data(), header.size());
+    writematrixvector(outfile, fingerprint.data(), fingerprint.size());
+    
+    writematrixvector(outfile, Ainds.getvalues(), Ainds.count());
+    writematrixvector(outfile, Dinds.getvalues(), Dinds.count());
+    
+    std::vector<PetscInt> rows, cols;
+    std::vector<double> vals;
+    
+    getcsr(Amat, myissymmetric, rows, cols, vals);
+    writematrixvector(outfile, rows.data(), rows.size()); writematrixvector(outfile, cols.data(), cols.size()); writematrixvector(outfile, vals.data(), vals.size());
+    getcsr(Dmat, false, rows, cols, vals);
+    writematrixvector(outfile, rows.data(), rows.size()); writematrixvector(outfile, cols.data(), cols.size()); writematrixvector(outfile, vals.data(), vals.size());
+    
+    outfile.close();
+    if (outfile.fail())
+    {
+        std::cout << "Unable to write matrix to file '" << filename << "' or file not found" << std::endl;
+        abort();
+    }
+}
+
+bool rawmat::load(std::string filename, std::string fingerprint)
+{
+    std::ifstream infile(filename.c_str(), std::ios::in | std::ios::binary);
+    if (not(infile.is_open()))
+        return false;
+        
+    char magic[8];
+    infile.read(magic, 8);
+    if (infile.fail() || std::string(magic, 8) != std::string(matrixfilemagic, 8))
+        return false;
+    
+    std::vector<int> header;
+    if (not(readmatrixvector(infile, header, 5)) || header[0] != matrixfileversion || header[1] != sizeof(int) || header[2] != sizeof(PetscInt) || header[3] != sizeof(double) || header[4] != myissymmetric)
+        return false;
+    std::vector<char> filefingerprint;
+    if (not(readmatrixvector(infile, filefingerprint)) || std::string(filefingerprint.begin(), filefingerprint.end()) != fingerprint)
+        return false;
+    
+    std::vector<int> ainds, dinds;
+    std::vector<PetscInt> arows, acols, drows, dcols;
+    std::vector<double> avals, dvals;
+    if (not(readmatrixvector(infile, ainds) && readmatrixvector(infile, dinds)))
+        return false;
+    if (not(readmatrixvector(infile, arows, ainds.size()+1) && readmatrixvector(infile, acols, arows.back()) && readmatrixvector(infile, avals, arows.back())))
+        return false;
+    if (not(readmatrixvector(infile, drows, ainds.size()+1) && readmatrixvector(infile, dcols, drows.back()) && readmatrixvector(infile, dvals, drows.back())))
+        return false;
+        
+    if (Amat != PETSC_NULL)
+        MatDestroy(&Amat);
+    if (Asellmat != PETSC_NULL)
+        MatDestroy(&Asellmat);
+    if (Dmat != PETSC_NULL)
+        MatDestroy(&Dmat);
+    if (isitfactored)
+        KSPDestroy(&myksp);
+    isitfactored = false;
+    clearfragments();
+    
+    nnzA = avals.size(); nnzD = dvals.size();
+    Ainds = indexmat(ainds.size(), 1, ainds);
+    Dinds = indexmat(dinds.size(), 1, dinds);
+    
+    Arows = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(arows.begin(), arows.end()));
+    Acols = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(acols.begin(), acols.end()));
+    Drows = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(drows.begin(), drows.end()));
+    Dcols = csrindexes(new std::vector<PetscInt, uninitializedallocator<PetscInt>>(dcols.begin(), dcols.end()));
+    Avals = densemat(nnzA, 1, avals);
+    Dvals = densemat(nnzD, 1, dvals);
+    
+    mymeshnumber = universe::getrawmesh()->getmeshnumber();
+    
+    createpetscmatrices();
+    
+    return true;
+}
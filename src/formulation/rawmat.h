@@ -9,17 +9,24 @@
 #define RAWMAT_H
 
 #include <iostream>
+#include <fstream>
 #include <vector>
+#include <string>
 #include "dofmanager.h"
 #include <cmath>
 #include "gentools.h"
 #include "indexmat.h"
 #include "densemat.h"
 #include "memory.h"
+#include "sparsitypattern.h"
 #include "petsc.h"
 #include "petscmat.h"
+#include "memoryusage.h"
+#include "profiler.h"
 
 class dofmanager;
+class sparsitypattern;
+class matrixfree;
 
 class rawmat
 {
@@ -30,12 +37,22 @@ class rawmat
         std::vector<indexmat> accumulatedcolindices = {};
         std::vector<densemat> accumulatedvals = {};
         
+        // When streaming the fragments are not accumulated but directly added to the csr values of this pattern:
+        std::shared_ptr<sparsitypattern> mystreampattern = NULL;
+        // Pattern with which this matrix was processed (NULL if none):
+        std::shared_ptr<sparsitypattern> mypattern = NULL;
+        densemat streamedAvals, streamedDvals;
+        
+        // When only computing a product the fragments are multiplied by 'myproductinput' and added to 'myproductoutput':
+        bool isproductonly = false;
+        densemat myproductinput, myproductoutput;
+        
 
         long long int nnzA = -1, nnzD = -1;
         
         // The sparse matrix is stored in csr format. Dirichlet constraints are eliminated using A and D in Atotal = [A D; 0 1].
         // The rows and columns in A and D are renumbered consecutively from zero.
-        indexmat Arows, Acols, Drows, Dcols;
+        csrindexes Arows = NULL, Acols = NULL, Drows = NULL, Dcols = NULL;
         densemat Avals, Dvals;
         // Ainds[i] is the index in Atotal of the ith index in A:
         indexmat Ainds, Dinds;
@@ -49,7 +66,52 @@ class rawmat
         
         std::shared_ptr<dofmanager> mydofmanager = NULL;
         
+        // Product provider of the petsc shell matrices (NULL if the matrix is assembled):
+        std::shared_ptr<matrixfree> mymatrixfree = NULL;
+        
         int mymeshnumber = 0;
+        
+        // Product D*bd of the last Dirichlet elimination with the bd values and the D state it was computed for:
+        densemat myeliminatedbd, myeliminationproduct;
+        PetscObjectState myeliminationstate = -1;
+        
+        // For symmetric matrices only the upper triangle of A is stored (petsc sbaij format):
+        bool myissymmetric = false;
+        // True for the entries of the lower triangle of A, which are dropped in symmetric storage:
+        bool isdropped(int row, int col, std::vector<bool>& isconstrained) { return (myissymmetric && col < row && isconstrained[col] == false); };
+        
+        // Block size of the petsc baij matrix A (1 for aij and sbaij matrices):
+        int myblocksize = 1;
+        
+        // Sliced ELLPACK (petsc sell) copy of A for the products of the iterative solvers and the state of A it was created for:
+        bool myissell = false;
+        Mat Asellmat = PETSC_NULL;
+        PetscObjectState mysellstate = -1;
+        // Create the sell copy of A from its sorted csr rows:
+        void createsellmatrix(void);
+        // True if the unconstrained dofs keep the blocks of interleaved components whole:
+        bool isblockaligned(int blocksize);
+        
+        // Count (if 'valsptr' is NULL) or collect at 'adsofrows' the accumulated entries of A and D in rows
+        // 'firstrow' to 'lastrow'. 'nnzinrows[i]' is incremented for row firstrow+i. Return the number of entries:
+        long long int collectinrows(int firstrow, int lastrow, std::vector<bool>& isconstrained, int* nnzinrows, long long int* adsofrows, std::pair<int, double>* valsptr);
+        
+        // Store in the pattern the csr structure and the csr position of every accumulated entry:
+        void definepattern(std::shared_ptr<sparsitypattern> pattern, std::vector<bool>& isconstrained, std::vector<int>& renumtolocalindex);
+        // Fill the csr values directly from a matching pattern (no sorting required):
+        void processwithpattern(std::shared_ptr<sparsitypattern> pattern);
+        // Add a fragment to the streamed values. Return false and leave the values untouched if the pattern does not include all entries:
+        bool accumulateinpattern(indexmat rowadresses, indexmat coladresses, densemat vals);
+        // Add a fragment without eliminating the slave dofs:
+        void accumulatefragment(indexmat rowadresses, indexmat coladresses, densemat vals);
+        // Move the entries in the rows and columns of slave dofs to their masters (see 'dofmanager::getslaverelations'). The moved
+        // entries are set to zero in a copy of 'vals' and the entries added to the masters are returned in a 'n x 1' fragment.
+        // Return false if no entry involves a slave:
+        bool moveslaveentries(indexmat rowadresses, indexmat coladresses, densemat& vals, indexmat& masterrows, indexmat& mastercols, densemat& mastervals);
+        // Turn the streamed values into a regular fragment and accumulate all next fragments:
+        void stopstreaming(void);
+        // Wrap the csr arrays in petsc matrices:
+        void createpetscmatrices(void);
             
     public:
                     
@@ -69,15 +131,44 @@ class rawmat
         bool isfactorizationreuseallowed(void) { return factorizationreuse; };
         bool isfactored(void) { return isitfactored; };
         void isfactored(bool isfact) { isitfactored = isfact; };
+        // Take the factorization or preconditioner kept in another matrix of the same size (e.g. of the previous time step):
+        void takeksp(std::shared_ptr<rawmat> source);
+        
+        int getblocksize(void) { return myblocksize; };
+        
+        // Store only the upper triangle of A. This must be set before accumulating and only for symmetric matrices:
+        void setsymmetric(bool issym = true) { myissymmetric = issym; };
+        bool issymmetric(void) { return myissymmetric; };
+        
+        // Also keep A in the SELL-C-sigma format (petsc sell) for faster products in the iterative solvers.
+        // The aij matrix is kept for the preconditioners and direct solvers. Not for symmetric storage:
+        void setsell(bool issell = true) { myissell = issell; };
+        bool issell(void) { return myissell; };
+        
+        void setmatrixfree(std::shared_ptr<matrixfree> mf) { mymatrixfree = mf; };
+        bool ismatrixfree(void) { return (mymatrixfree != NULL); };
+        
+        // Do not accumulate the next fragments but add their product with 'x' (values of all dofs) to 'y':
+        void multiplyinto(densemat x, densemat y);
+    
+        // Directly add all next fragments to the csr values of the pattern instead of accumulating them.
+        // Streaming only starts if the pattern is defined and matches the mesh and the constrained dofs.
+        void streaminto(std::shared_ptr<sparsitypattern> pattern, std::vector<bool>& isconstrained);
+        bool isstreaming(void) { return (mystreampattern != NULL); };
     
-        // Add a fragment to the matrix (empty fragments are ignored):
+        // Add a fragment to the matrix (empty fragments are ignored). The slave dofs are eliminated
+        // by adding the entries in their rows and columns to the rows and columns of their masters:
         void accumulate(indexmat rowadresses, indexmat coladresses, densemat vals);   
-        // Create the petsc matrices:
-        void process(std::vector<bool>& isconstrained);
+        // Create the petsc matrices. If a sparsity pattern object is provided it is reused when
+        // it matches the accumulated fragments and it is (re)defined from this matrix otherwise:
+        void process(std::vector<bool>& isconstrained, std::shared_ptr<sparsitypattern> pattern = NULL);
         // Clear all the fragments:
         void clearfragments(void);
         
         void print(void);
+        
+        // Bytes used by the accumulated fragments and by the petsc matrices:
+        memoryusage getmemoryusage(void);
 
         // Extract a new initialized rawmat that has all accumulated data:
         std::shared_ptr<rawmat> extractaccumulated(void);
@@ -87,10 +178,24 @@ class rawmat
 
         Mat getapetsc(void);
         Mat getdpetsc(void);
+        // Sell copy of A (updated if A has changed) or A itself if the sell format is not used:
+        Mat getsellpetsc(void);
         
         std::shared_ptr<dofmanager> getdofmanager(void);
         
         KSP* getksp(void);
+        
+        // Get the kept product D*bd (true if available for these bd values) or keep a new one:
+        bool geteliminationproduct(densemat bd, densemat& product);
+        void seteliminationproduct(densemat bd, densemat product);
+        
+        std::shared_ptr<sparsitypattern> getpattern(void) { return mypattern; };
+        
+        // Write the processed matrix (A and D in csr format and the Ainds and Dinds indexes) to a binary file with the fingerprint
+        // of the problem it was assembled for. 'load' replaces the matrix by the one in the file and returns true if the file exists
+        // and has the same fingerprint. Otherwise the matrix is untouched and false is returned.
+        void write(std::string filename, std::string fingerprint);
+        bool load(std::string filename, std::string fingerprint);
 
 };
 
@@ -1,6 +1,59 @@
 #include "rawvec.h"
+#include "taskscheduler.h"
+#include "autotuning.h"
+#include <thread>
 
 
+std::unordered_map<integration*, constraintprojection> rawvec::myconstraintprojections = {};
+
+std::shared_ptr<rawvec> rawvec::getconstraintprojection(std::shared_ptr<integration> constraint)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    
+    // Remove the projections of the constraints that do not exist anymore:
+    for (auto it = myconstraintprojections.begin(); it != myconstraintprojections.end(); )
+    {
+        if (it->second.constraint.expired())
+            it = myconstraintprojections.erase(it);
+        else
+            ++it;
+    }
+    
+    // Largest state of all operations the constraint depends on:
+    long long int dependencystate = constraint->getexpression().getoperationinarray(0,0)->getstate();
+    if (constraint->ismeshdeformdefined())
+    {
+        expression meshdeform = constraint->getmeshdeform();
+        for (int i = 0; i < meshdeform.countrows(); i++)
+            dependencystate = std::max(dependencystate, meshdeform.getoperationinarray(i,0)->getstate());
+    }
+    
+    std::unordered_map<integration*, constraintprojection>::iterator it = myconstraintprojections.find(constraint.get());
+    if (it != myconstraintprojections.end() && it->second.constraint.lock() == constraint)
+    {
+        constraintprojection& cp = it->second;
+        if (dependencystate <= cp.state && rm->getmeshnumber() == cp.meshnumber && rm->getstate() == cp.meshstate && universe::getsession()->fundamentalfrequency == cp.fundamentalfrequency)
+            return cp.values;
+    }
+    
+    constraintprojection cp;
+    cp.constraint = constraint;
+    cp.state = universe::getnewstate();
+    cp.meshnumber = rm->getmeshnumber();
+    cp.meshstate = rm->getstate();
+    cp.fundamentalfrequency = universe::getsession()->fundamentalfrequency;
+    
+    formulation projectconstraint;
+    projectconstraint += *constraint;
+    projectconstraint.isconstraintcomputation = true;
+    projectconstraint.generate();
+    cp.values = sl::solve(projectconstraint.A(), projectconstraint.b()).getpointer();
+    
+    myconstraintprojections[constraint.get()] = cp;
+    
+    return cp.values;
+}
+
 void rawvec::synchronize(void)
 {
     if (mydofmanager == NULL || mydofmanager->ismanaged() == false || issynchronizing || myptracker == universe::getrawmesh()->getptracker())
@@ -14,6 +67,17 @@ void rawvec::synchronize(void)
     std::vector<rawport*> rps;
     densemat rpsvals;
     
+    // The values of the fields whose dofs are all mapped by the dof renumbering are copied instead of transferred:
+    std::vector<int> renumbering;
+    std::vector<bool> isremapped(dmfields.size(), false);
+    densemat prevvals;
+    if (isvaluesynchronizingallowed && mydofmanager->getrenumbering(mycurrentstructure[0].getmeshnumber(), renumbering))
+    {
+        for (int i = 0; i < dmfields.size(); i++)
+            isremapped[i] = mydofmanager->isfieldremapped(dmfields[i]);
+        prevvals = getvalues(indexmat(mycurrentstructure[0].countdofs(), 1, 0, 1));
+    }
+    
     if (isvaluesynchronizingallowed)
     {
         // For a correct 'setdata' call below (now 'mydofmanager' will not be synced either):
@@ -28,6 +92,8 @@ void rawvec::synchronize(void)
         
         for (int i = 0; i < dmfields.size(); i++)
         {
+            if (isremapped[i])
+                continue;
             mydofmanager->selectfield(dmfields[i]);
             mycurrentstructure[0].selectfield(dmfields[i]);
             datafields[i] = std::shared_ptr<rawfield>(new rawfield(&(mycurrentstructure[0]), myrawmesh, myptracker));
@@ -42,6 +108,8 @@ void rawvec::synchronize(void)
         
         for (int i = 0; i < dmfields.size(); i++)
         {
+            if (isremapped[i])
+                continue;
             mydofmanager->selectfield(dmfields[i]);
             datafields[i]->synchronize({}, mydofmanager->getselectedfieldorders());
         }
@@ -52,7 +120,7 @@ void rawvec::synchronize(void)
     VecCreate(PETSC_COMM_SELF, &myvec);
     VecSetSizes(myvec, PETSC_DECIDE, mydofmanager->countdofs());
     VecSetFromOptions(myvec);
-    VecSet(myvec, 0.0);
+    firsttouch();
     
     // Update the dof manager to the current one:
     mycurrentstructure = {*mydofmanager};
@@ -64,9 +132,27 @@ void rawvec::synchronize(void)
     
     if (isvaluesynchronizingallowed)
     {
+        // Copy the values of the mapped dofs:
+        if (renumbering.size() > 0)
+        {
+            std::vector<int> frominds, toinds;
+            for (int i = 0; i < renumbering.size(); i++)
+            {
+                if (renumbering[i] >= 0)
+                {
+                    frominds.push_back(i);
+                    toinds.push_back(renumbering[i]);
+                }
+            }
+            setvalues(indexmat(toinds.size(), 1, toinds), prevvals.extractrows(frominds), "set");
+        }
+        
         // Transfer the data back to the vector:
         for (int i = 0; i < datafields.size(); i++)
-            datafields[i]->transferdata(-1, vec(shared_from_this())|field(dmfields[i]), "set");
+        {
+            if (isremapped[i] == false)
+                datafields[i]->transferdata(-1, vec(shared_from_this())|field(dmfields[i]), "set");
+        }
             
         // Restore the port values:
         indexmat newrpsinds(rps.size(), 1);
@@ -79,14 +165,36 @@ void rawvec::synchronize(void)
     issynchronizing = false;
 }
 
-rawvec::rawvec(std::shared_ptr<dofmanager> dofmngr)
+void rawvec::firsttouch(void)
+{
+    PetscInt numvalues;
+    VecGetLocalSize(myvec, &numvalues);
+    
+    double* vecptr;
+    VecGetArray(myvec, &vecptr);
+    
+    // The values of each thread range are zeroed by the thread that later treats the same rows:
+    int numthreadstouse = autotuning::getnumthreadsforitems(numvalues); // require a min num dofs per thread
+    taskscheduler::runperthread(numthreadstouse, [&](int t)
+    {
+        PetscInt rangebegin = (long long int)t*numvalues/numthreadstouse;
+        PetscInt rangeend = (long long int)(t+1)*numvalues/numthreadstouse;
+        for (PetscInt i = rangebegin; i < rangeend; i++)
+            vecptr[i] = 0.0;
+    });
+    
+    VecRestoreArray(myvec, &vecptr);
+}
+
+rawvec::rawvec(std::shared_ptr<dofmanager> dofmngr) : rawvec(dofmngr, false) {}
+
+rawvec::rawvec(std::shared_ptr<dofmanager> dofmngr, bool isdeferred)
 {
     mydofmanager = dofmngr;
 
-    VecCreate(PETSC_COMM_SELF, &myvec);
-    VecSetSizes(myvec, PETSC_DECIDE, mydofmanager->countdofs());
-    VecSetFromOptions(myvec);   
-    VecSet(myvec, 0.0);
+    ispetscdeferred = isdeferred;
+    if (isdeferred == false)
+        createpetsc();
     
     if (mydofmanager->ismanaged())
     {
@@ -114,6 +222,24 @@ rawvec::rawvec(std::shared_ptr<dofmanager> dofmngr, Vec input)
     }
 }
 
+void rawvec::createpetsc(void)
+{
+    if (myvec != PETSC_NULL)
+        return;
+        
+    universe::initializepetsc();
+
+    VecCreate(PETSC_COMM_SELF, &myvec);
+    VecSetSizes(myvec, PETSC_DECIDE, mydofmanager->countdofs());
+    VecSetFromOptions(myvec);   
+    firsttouch();
+    
+    ispetscdeferred = false;
+    for (int i = 0; i < mydeferredfragments.size(); i++)
+        setvalues(mydeferredfragments[i].first, mydeferredfragments[i].second, "add");
+    mydeferredfragments = {};
+}
+
 rawvec::~rawvec(void)
 {
     // Avoid crashes when destroy is called after PetscFinalize (not allowed).
@@ -154,18 +280,18 @@ void rawvec::updatedisjregconstraints(std::shared_ptr<rawfield> constrainedfield
         // Make sure the disjoint region is in the dof structure and is constrained:
         if (mydofmanager->isdefined(disjreg, 0) && fieldconstraints[disjreg] != NULL)
         {
-            // Compute the constraint projection:
-            formulation projectconstraint;
-            projectconstraint += *fieldconstraints[disjreg];
-            projectconstraint.isconstraintcomputation = true;                
-
-            // Get an all zero vector:
-            vec constraintvalvec(projectconstraint);
+            // Get the constraint projection:
+            vec constraintvalvec;
             // Zero valued constraints need not be computed:
             if (fieldconstraints[disjreg]->isprojectionofzero == false)
+                constraintvalvec = vec(getconstraintprojection(fieldconstraints[disjreg]));
+            else
             {
-                projectconstraint.generate();
-                constraintvalvec = sl::solve(projectconstraint.A(), projectconstraint.b());
+                formulation projectconstraint;
+                projectconstraint += *fieldconstraints[disjreg];
+                projectconstraint.isconstraintcomputation = true;
+                // Get an all zero vector:
+                constraintvalvec = vec(projectconstraint);
             }
 
             // Loop on all disjoint regions who share the same constraint-computation-formulation:
@@ -186,6 +312,17 @@ void rawvec::updatedisjregconstraints(std::shared_ptr<rawfield> constrainedfield
 
 void rawvec::setvalues(indexmat addresses, densemat valsmat, std::string op)
 {           
+    if (ispetscdeferred)
+    {
+        if (op != "add")
+        {
+            std::cout << "Error in 'rawvec' object: only values can be added before the deferred petsc vector is created" << std::endl;
+            abort();
+        }
+        mydeferredfragments.push_back(std::make_pair(addresses, valsmat));
+        return;
+    }
+    
     synchronize();
      
     double* myval = valsmat.getvalues();
@@ -215,10 +352,11 @@ void rawvec::setvalues(indexmat addresses, densemat valsmat, std::string op)
         }
     }
 
+    petscindexes petscads(filteredads, numpositiveentries);
     if (op == "add")
-        VecSetValues(myvec, numpositiveentries, filteredads, filteredvals, ADD_VALUES);
+        VecSetValues(myvec, numpositiveentries, petscads.getvalues(), filteredvals, ADD_VALUES);
     if (op == "set")
-        VecSetValues(myvec, numpositiveentries, filteredads, filteredvals, INSERT_VALUES);
+        VecSetValues(myvec, numpositiveentries, petscads.getvalues(), filteredvals, INSERT_VALUES);
         
     VecAssemblyBegin(myvec);
     VecAssemblyEnd(myvec);
@@ -246,7 +384,7 @@ densemat rawvec::getvalues(indexmat addresses)
     
     int numentries = addresses.count();
     densemat valmat(numentries,1);
-    VecGetValues(myvec, numentries, addresses.getvalues(), valmat.getvalues());
+    VecGetValues(myvec, numentries, petscindexes(addresses.getvalues(), numentries).getvalues(), valmat.getvalues());
     
     return valmat;
 }
@@ -255,7 +393,7 @@ double rawvec::getvalue(int address)
 {
     synchronize();
     
-    int ads[1] = {address};
+    PetscInt ads[1] = {address};
     double outval[1];
     VecGetValues(myvec, 1, ads, outval);
     
@@ -275,7 +413,7 @@ void rawvec::setvalues(std::shared_ptr<rawfield> selectedfield, int disjointregi
     int rangebegin = mydofmanager->getrangebegin(disjointregionnumber, formfunctionindex);
     int numentries = myptracker->getdisjointregions()->countelements(disjointregionnumber);
 
-    indexmat addressestoset(numentries, 1, rangebegin, 1);
+    indexmat addressestoset(numentries, 1, rangebegin, mydofmanager->getrangestep(disjointregionnumber));
     setvalues(addressestoset, vals, op);
 }
 
@@ -295,17 +433,178 @@ densemat rawvec::getvalues(std::shared_ptr<rawfield> selectedfield, int disjoint
     int rangebegin = mydofmanager->getrangebegin(disjointregionnumber, formfunctionindex);
     int numentries = myptracker->getdisjointregions()->countelements(disjointregionnumber);
     
-    int step = 1;
+    int step = mydofmanager->getrangestep(disjointregionnumber);
     if (mydofmanager->isported(disjointregionnumber))
         step = 0;
     
     densemat vals(numentries, 1);
     indexmat addressestoget(numentries, 1, rangebegin, step);
-    VecGetValues(myvec, numentries, addressestoget.getvalues(), vals.getvalues());
+    VecGetValues(myvec, numentries, petscindexes(addressestoget.getvalues(), numentries).getvalues(), vals.getvalues());
     
     return vals;
 }
 
+// Call 'transfer(b, first, last)' for the entry ranges of the blocks processed by every thread (at least 100000 entries per thread):
+template <typename T>
+void processblocks(std::vector<int>& lengths, T transfer)
+{
+    std::vector<long long int> blockbegins(lengths.size()+1, 0);
+    for (int b = 0; b < lengths.size(); b++)
+        blockbegins[b+1] = blockbegins[b] + lengths[b];
+    long long int numentries = blockbegins[lengths.size()];
+    
+    int numthreadstouse = autotuning::getnumthreadsforvalues(numentries); // require a min num entries per thread
+    
+    auto processrange = [&](int t)
+    {
+        long long int first = t*numentries/numthreadstouse;
+        long long int last = (t+1)*numentries/numthreadstouse;
+        
+        int b = std::upper_bound(blockbegins.begin(), blockbegins.end(), first) - blockbegins.begin() - 1;
+        for (; b < lengths.size() && blockbegins[b] < last; b++)
+        {
+            int firstinblock = std::max(first, blockbegins[b]) - blockbegins[b];
+            int lastinblock = std::min(last, blockbegins[b+1]) - blockbegins[b];
+            if (firstinblock < lastinblock)
+                transfer(b, firstinblock, lastinblock);
+        }
+    };
+    
+    if (numthreadstouse == 1)
+        processrange(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(processrange, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+}
+
+void rawvec::getblocks(std::vector<int>& rangebegins, std::vector<int>& steps, std::vector<int>& lengths, std::vector<double*>& targets, std::string op)
+{
+    synchronize();
+    
+    if (lengths.size() == 0)
+        return;
+    
+    const double* vecptr;
+    VecGetArrayRead(myvec, &vecptr);
+    
+    bool isadded = (op == "add");
+    auto transfer = [&](int b, int first, int last)
+    {
+        const double* source = vecptr + rangebegins[b];
+        double* target = targets[b];
+        int step = steps[b];
+        if (isadded)
+        {
+            for (int i = first; i < last; i++)
+                target[i] += source[i*step];
+        }
+        else
+        {
+            for (int i = first; i < last; i++)
+                target[i] = source[i*step];
+        }
+    };
+    processblocks(lengths, transfer);
+    
+    VecRestoreArrayRead(myvec, &vecptr);
+}
+
+void rawvec::setblocks(std::vector<int>& rangebegins, std::vector<int>& steps, std::vector<int>& lengths, std::vector<const double*>& sources, std::string op)
+{
+    synchronize();
+    
+    if (lengths.size() == 0)
+        return;
+    
+    double* vecptr;
+    VecGetArray(myvec, &vecptr);
+    
+    bool isadded = (op == "add");
+    auto transfer = [&](int b, int first, int last)
+    {
+        const double* source = sources[b];
+        double* target = vecptr + rangebegins[b];
+        int step = steps[b];
+        if (source == NULL)
+        {
+            if (isadded == false)
+            {
+                for (int i = first; i < last; i++)
+                    target[i*step] = 0.0;
+            }
+        }
+        else if (isadded)
+        {
+            for (int i = first; i < last; i++)
+                target[i*step] += source[i];
+        }
+        else
+        {
+            for (int i = first; i < last; i++)
+                target[i*step] = source[i];
+        }
+    };
+    processblocks(lengths, transfer);
+    
+    VecRestoreArray(myvec, &vecptr);
+}
+
+void rawvec::foldslaves(void)
+{
+    synchronize();
+    
+    std::shared_ptr<slaverelations> rels = mydofmanager->getslaverelations();
+    if (rels == NULL || rels->count() == 0)
+        return;
+        
+    std::vector<bool> isconstr = mydofmanager->isconstrained();
+    
+    double* vecptr;
+    VecGetArray(myvec, &vecptr);
+    
+    for (int i = 0; i < rels->count(); i++)
+    {
+        int slave = rels->slaves[i];
+        // Constrained masters keep their constraint value:
+        for (int k = rels->masterbegin[i]; k < rels->masterbegin[i+1]; k++)
+        {
+            if (isconstr[rels->masters[k]] == false)
+                vecptr[rels->masters[k]] += rels->coefs[k] * vecptr[slave];
+        }
+        vecptr[slave] = 0.0;
+    }
+    
+    VecRestoreArray(myvec, &vecptr);
+}
+
+void rawvec::updateslaves(void)
+{
+    synchronize();
+    
+    std::shared_ptr<slaverelations> rels = mydofmanager->getslaverelations();
+    if (rels == NULL || rels->count() == 0)
+        return;
+    
+    double* vecptr;
+    VecGetArray(myvec, &vecptr);
+    
+    // No master is a slave:
+    for (int i = 0; i < rels->count(); i++)
+    {
+        double val = 0.0;
+        for (int k = rels->masterbegin[i]; k < rels->masterbegin[i+1]; k++)
+            val += rels->coefs[k] * vecptr[rels->masters[k]];
+        vecptr[rels->slaves[i]] = val;
+    }
+    
+    VecRestoreArray(myvec, &vecptr);
+}
+
 void rawvec::setvaluestoports(void)
 {
     synchronize();
@@ -422,6 +721,15 @@ void rawvec::load(std::string filename)
     abort();
 }
      
+long long int rawvec::countbytes(void)
+{
+    if (myvec == PETSC_NULL)
+        return 0;
+    PetscInt localsize;
+    VecGetLocalSize(myvec, &localsize);
+    return localsize*sizeof(PetscScalar);
+}
+
 void rawvec::print(void)
 {         
     synchronize();
@@ -448,6 +756,12 @@ std::shared_ptr<dofmanager> rawvec::getdofmanager(void)
 
 Vec rawvec::getpetsc(void)
 {
+    if (ispetscdeferred)
+    {
+        std::cout << "Error in 'rawvec' object: the deferred petsc vector was not created (call 'createpetsc')" << std::endl;
+        abort();
+    }
+    
     synchronize();
     
     return myvec;
@@ -489,8 +803,8 @@ void rawvec::setdata(std::shared_ptr<rawvec> inputvec, int disjreg, std::shared_
         
         int inputrangebegin = inputvec->mydofmanager->getrangebegin(disjreg,ff);
         
-        indexmat myaddresses(numentries, 1, myrangebegin, 1);
-        indexmat inputaddresses(numentries, 1, inputrangebegin, 1);
+        indexmat myaddresses(numentries, 1, myrangebegin, mydofmanager->getrangestep(disjreg));
+        indexmat inputaddresses(numentries, 1, inputrangebegin, inputvec->mydofmanager->getrangestep(disjreg));
         
         densemat inputval = inputvec->getvalues(inputaddresses);
         setvalues(myaddresses, inputval, "set");
@@ -504,7 +818,7 @@ void rawvec::setdata(std::shared_ptr<rawvec> inputvec, int disjreg, std::shared_
         int myrangebegin = mydofmanager->getrangebegin(disjreg,ff);
         int numentries = myptracker->getdisjointregions()->countelements(disjreg);
                 
-        indexmat myaddresses(numentries, 1, myrangebegin, 1);
+        indexmat myaddresses(numentries, 1, myrangebegin, mydofmanager->getrangestep(disjreg));
         
         densemat zerovals(numentries,1, 0);
         setvalues(myaddresses, zerovals, "set");
@@ -18,6 +18,7 @@
 #include "memory.h"
 #include "petsc.h"
 #include "petscvec.h"
+#include "petscindexes.h"
 #include "sl.h"
 #include "ptracker.h"
 #include "rawmesh.h"
@@ -26,18 +27,44 @@ class vectorfieldselect;
 class dofmanager;
 class rawfield;
 class rawmesh;
+class integration;
+class rawvec;
+
+// Projection of a disjoint region constraint. It is reused as long as the constraint
+// is not replaced and none of the fields, parameters or mesh it depends on changed:
+class constraintprojection
+{
+    public:
+        
+        std::weak_ptr<integration> constraint;
+        
+        // Conditions under which the projection was computed:
+        long long int state = -1;
+        int meshnumber = -1;
+        long long int meshstate = -1;
+        double fundamentalfrequency = -1;
+        
+        std::shared_ptr<rawvec> values = NULL;
+};
 
 class rawvec : public std::enable_shared_from_this<rawvec>
 {
     private:
 
         Vec myvec = PETSC_NULL;
+        
+        // Fragments added while the creation of the petsc vector is deferred (see 'createpetsc'):
+        bool ispetscdeferred = false;
+        std::vector<std::pair<indexmat, densemat>> mydeferredfragments = {};
         std::shared_ptr<dofmanager> mydofmanager = NULL;
         
 
         std::shared_ptr<ptracker> myptracker = NULL;
         std::vector<dofmanager> mycurrentstructure = {};
         
+        // Zero the values with the threads that later use them (first-touch numa placement):
+        void firsttouch(void);
+        
         // Synchronize with the hp-adapted mesh:
         void synchronize(void);
         // To avoid infinite recursive calls:
@@ -48,11 +75,21 @@ class rawvec : public std::enable_shared_from_this<rawvec>
         
         // Mesh on which this object is based:
         std::shared_ptr<rawmesh> myrawmesh = NULL;
+        
+        // Projections of the constraints (shared by all vectors):
+        static std::unordered_map<integration*, constraintprojection> myconstraintprojections;
+        // Get the projection of a constraint (computed if the kept one is not valid anymore):
+        static std::shared_ptr<rawvec> getconstraintprojection(std::shared_ptr<integration> constraint);
     
     public:
             
         rawvec(std::shared_ptr<dofmanager> dofmngr);
         rawvec(std::shared_ptr<dofmanager> dofmngr, Vec input);
+        // If 'isdeferred' the petsc vector is only created by 'createpetsc'. Until then no petsc call is made and 'setvalues'
+        // with 'add' only keeps the fragments. Values can thus be generated on a thread while another one makes petsc calls:
+        rawvec(std::shared_ptr<dofmanager> dofmngr, bool isdeferred);
+        // Create the deferred petsc vector and add the kept fragments to it:
+        void createpetsc(void);
         
         ~rawvec(void);
         
@@ -61,7 +98,8 @@ class rawvec : public std::enable_shared_from_this<rawvec>
         int size(void);
         
         // Update the indexes that correspond to constrained 
-        // values of a rawfield on given disjoint regions. 
+        // values of a rawfield on given disjoint regions. The constraint
+        // projections are reused while their value cannot have changed.
         void updatedisjregconstraints(std::shared_ptr<rawfield> constrainedfield, std::vector<int> disjregs);
         
         // Negative addresses are ignored. 'op' can be 'add' or 'set'. 
@@ -76,6 +114,18 @@ class rawvec : public std::enable_shared_from_this<rawvec>
         void setvalues(std::shared_ptr<rawfield> selectedfield, int disjointregionnumber, int formfunctionindex, densemat vals, std::string op);
         densemat getvalues(std::shared_ptr<rawfield> selectedfield, int disjointregionnumber, int formfunctionindex);
         
+        // Bulk transfer between the vector and contiguous buffers with multiple threads. Block 'b' holds the 'lengths[b]' 
+        // entries at addresses 'rangebegins[b] + i*steps[b]'. 'op' can be 'add' or 'set' (applied to the target). Use a NULL
+        // source for a zero block. The transfer blocks of a field are obtained with 'dofmanager::gettransferblocks'.
+        void getblocks(std::vector<int>& rangebegins, std::vector<int>& steps, std::vector<int>& lengths, std::vector<double*>& targets, std::string op = "set");
+        void setblocks(std::vector<int>& rangebegins, std::vector<int>& steps, std::vector<int>& lengths, std::vector<const double*>& sources, std::string op = "set");
+        
+        // Add the values at the slave dofs times their coefficient to the values at the masters and set the slave values to zero.
+        // This eliminates the slaves from an assembled right handside (see 'dofmanager::getslaverelations'):
+        void foldslaves(void);
+        // Set the values at the slave dofs from the values at their masters:
+        void updateslaves(void);
+        
         void setvaluestoports(void);
         void setvaluesfromports(void);
         
@@ -85,6 +135,9 @@ class rawvec : public std::enable_shared_from_this<rawvec>
         
         void print(void);
         
+        // Bytes used by the petsc vector:
+        long long int countbytes(void);
+        
         std::shared_ptr<dofmanager> getdofmanager(void);
         Vec getpetsc(void);
         
@@ -0,0 +1,28 @@
+#include "rhsassemblycache.h"
+
+
+void rhsassemblycache::clear(void)
+{
+    isitvalid = false;
+    groups = {};
+}
+
+bool rhsassemblycache::isvalid(long long int structurestate, long long int numdofs)
+{
+    if (isitvalid == false || structurestate > mystate || numdofs != mynumdofs)
+        return false;
+        
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    
+    return (rm->getmeshnumber() == mymeshnumber && rm->getstate() == mymeshstate);
+}
+
+void rhsassemblycache::setvalid(long long int structurestate, long long int numdofs)
+{
+    isitvalid = true;
+    
+    mystate = structurestate;
+    mynumdofs = numdofs;
+    mymeshnumber = universe::getrawmesh()->getmeshnumber();
+    mymeshstate = universe::getrawmesh()->getstate();
+}
@@ -0,0 +1,74 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object stores the geometric tables of a rhs contribution: the Gauss points, the
+// Jacobians, the test function values times the weights and the test function addresses 
+// of every element block. As long as the mesh and the test function field structure are
+// unchanged the rhs can be assembled by only evaluating the coefficients.
+
+
+#ifndef RHSASSEMBLYCACHE_H
+#define RHSASSEMBLYCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "indexmat.h"
+#include "densemat.h"
+#include "universe.h"
+#include "jacobian.h"
+#include "elementselector.h"
+
+class jacobian;
+class elementselector;
+
+// Block of elements with a same total orientation:
+struct rhsassemblyblock
+{
+    std::shared_ptr<elementselector> selector = NULL;
+    std::shared_ptr<jacobian> jac = NULL;
+    // Absolute value of the Jacobian determinant (elements x Gauss points):
+    densemat detjac;
+    // Test function values times the weights for every term (form functions x Gauss points):
+    std::vector<densemat> tfweighted = {};
+    // Test function addresses for every test function harmonic:
+    std::vector<indexmat> tfaddresses = {};
+};
+
+// Disjoint regions integrated with the same Gauss points:
+struct rhsassemblygroup
+{
+    std::vector<int> disjregs = {};
+    std::vector<double> evaluationpoints = {};
+    std::vector<rhsassemblyblock> blocks = {};
+};
+
+class rhsassemblycache
+{
+    private:
+        
+        bool isitvalid = false;
+        
+        // Conditions under which the tables were computed:
+        long long int mystate = -1;
+        long long int mynumdofs = -1;
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+        
+    public:
+        
+        std::vector<rhsassemblygroup> groups = {};
+        
+        // Forget all tables:
+        void clear(void);
+        
+        // True if the tables are still valid provided the state of the test function field structure:
+        bool isvalid(long long int structurestate, long long int numdofs);
+        // The tables are valid from now on:
+        void setvalid(long long int structurestate, long long int numdofs);
+        
+};
+
+#endif
@@ -0,0 +1,311 @@
+#include "sparsitypattern.h"
+#include "rawmat.h"
+#include "universe.h"
+#include "slmpi.h"
+
+
+void sparsitypattern::destroyfactorization(void)
+{
+    // Avoid crashes when destroy is called after PetscFinalize (not allowed).
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+
+    if (ispetscinitialized == PETSC_TRUE)
+    {
+        if (myksp != PETSC_NULL)
+            KSPDestroy(&myksp);
+        if (myfactoredmat != PETSC_NULL)
+            MatDestroy(&myfactoredmat);
+    }
+    myksp = PETSC_NULL;
+    myfactoredmat = PETSC_NULL;
+    myfactoredrawmat.reset();
+    myfactorizationtype = "";
+}
+
+void sparsitypattern::destroyanalysis(void)
+{
+    if (myanalysisthread.joinable())
+        myanalysisthread.join();
+        
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+
+    if (ispetscinitialized == PETSC_TRUE)
+    {
+        if (myanalysisfactor != PETSC_NULL)
+            MatDestroy(&myanalysisfactor);
+        if (myanalysismat != PETSC_NULL)
+            MatDestroy(&myanalysismat);
+    }
+    myanalysisfactor = PETSC_NULL;
+    myanalysismat = PETSC_NULL;
+    isanalysispending = false;
+    myanalysistype = "";
+    myanalysismeshnumber = -1;
+    myanalysisisconstrained = {};
+}
+
+sparsitypattern::~sparsitypattern(void)
+{
+    destroyanalysis();
+    destroyfactorization();
+}
+
+void sparsitypattern::keepfactorization(bool iskept)
+{
+    iskeepingfactorization = iskept;
+    
+    if (iskept == false)
+    {
+        destroyanalysis();
+        destroyfactorization();
+    }
+}
+
+bool sparsitypattern::isanalysisoverlapallowed(void)
+{
+    #if defined(PETSC_HAVE_THREADSAFETY)
+    return slmpi::isthreadmultiple();
+    #else
+    return false;
+    #endif
+}
+
+void sparsitypattern::analyse(Mat analysismat, Mat analysisfactor, std::string soltype)
+{
+    // Mumps orders the matrix itself, no permutation is given:
+    MatFactorInfo info;
+    MatFactorInfoInitialize(&info);
+    if (soltype == "cholesky")
+        MatCholeskyFactorSymbolic(analysisfactor, analysismat, NULL, &info);
+    else
+        MatLUFactorSymbolic(analysisfactor, analysismat, NULL, NULL, &info);
+}
+
+void sparsitypattern::startanalysis(std::shared_ptr<rawmat> symbolic, std::string soltype, std::vector<bool>& isconstrained)
+{
+    if (iskeepingfactorization == false)
+        return;
+        
+    destroyanalysis();
+    // The kept factorization is replaced by the one on the new structure:
+    destroyfactorization();
+    
+    // Only a Cholesky factorization is possible for matrices in symmetric storage:
+    if (symbolic->issymmetric())
+        soltype = "cholesky";
+    
+    MatDuplicate(symbolic->getapetsc(), MAT_DO_NOT_COPY_VALUES, &myanalysismat);
+    
+    MatFactorType factortype = (soltype == "cholesky" ? MAT_FACTOR_CHOLESKY : MAT_FACTOR_LU);
+    MatGetFactor(myanalysismat, MATSOLVERMUMPS, factortype, &myanalysisfactor);
+    if (universe::isoutofcore)
+        MatMumpsSetIcntl(myanalysisfactor, 22, 1);
+    
+    myanalysistype = soltype;
+    myanalysismeshnumber = universe::getrawmesh()->getmeshnumber();
+    myanalysisisconstrained = isconstrained;
+    
+    // Petsc and mumps (which makes MPI calls) are only used from another thread if that is safe:
+    if (isanalysisoverlapallowed())
+    {
+        Mat analysismat = myanalysismat, analysisfactor = myanalysisfactor;
+        myanalysisthread = universe::newthread([=]{ analyse(analysismat, analysisfactor, soltype); });
+    }
+    else
+        isanalysispending = true;
+}
+
+void sparsitypattern::clear(void)
+{
+    // The kept factorization is only valid for this pattern:
+    destroyfactorization();
+
+    isitdefined = false;
+    
+    mymeshnumber = -1;
+    myisconstrained = {};
+    myissymmetric = false;
+    myfragmentsizes = {};
+    myadresshashes = {};
+    
+    nnzA = -1; nnzD = -1;
+    
+    Arows = NULL; Acols = NULL; Drows = NULL; Dcols = NULL;
+    Ainds = indexmat(); Dinds = indexmat();
+    myrenumtolocalindex = {};
+    
+    myslots = {};
+}
+
+unsigned long long int sparsitypattern::hashadresses(indexmat& adresses)
+{
+    int* adressesptr = adresses.getvalues();
+    
+    unsigned long long int hashval = 14695981039346656037ULL;
+    for (long long int i = 0; i < adresses.count(); i++)
+    {
+        hashval ^= (unsigned int)adressesptr[i];
+        hashval *= 1099511628211ULL;
+    }
+    return hashval;
+}
+
+void sparsitypattern::remap(int meshnumber, std::vector<int>& renumbering, int numdofs)
+{
+    if (isitdefined == false || renumbering.size() != numdofs)
+        return;
+        
+    for (int i = 0; i < renumbering.size(); i++)
+    {
+        if (renumbering[i] != i)
+            return;
+    }
+    
+    mymeshnumber = meshnumber;
+}
+
+bool sparsitypattern::ismatching(int meshnumber, std::vector<bool>& isconstrained, std::vector<indexmat>& rowadresses, std::vector<indexmat>& coladresses, std::vector<densemat>& vals)
+{
+    if (isitdefined == false || meshnumber != mymeshnumber || 4*vals.size() != myfragmentsizes.size() || isconstrained != myisconstrained)
+        return false;
+        
+    for (int i = 0; i < vals.size(); i++)
+    {
+        if (vals[i].countrows() != myfragmentsizes[4*i+0] || vals[i].countcolumns() != myfragmentsizes[4*i+1] || rowadresses[i].countrows() != myfragmentsizes[4*i+2] || coladresses[i].countrows() != myfragmentsizes[4*i+3])
+            return false;
+    }
+    
+    // Fragments with the same sizes can have different addresses (e.g. after a port or region change):
+    for (int i = 0; i < vals.size(); i++)
+    {
+        if (hashadresses(rowadresses[i]) != myadresshashes[2*i+0] || hashadresses(coladresses[i]) != myadresshashes[2*i+1])
+            return false;
+    }
+    
+    return true;
+}
+
+void sparsitypattern::solve(std::shared_ptr<rawmat> A, Vec b, Vec sol, std::string soltype, solverstats& stats, bool istransposed)
+{
+    Mat Apetsc = A->getapetsc();
+    
+    // Only a Cholesky factorization is possible for matrices in symmetric storage:
+    if (A->issymmetric())
+        soltype = "cholesky";
+    // A Cholesky factorized matrix is symmetric:
+    if (soltype == "cholesky")
+        istransposed = false;
+    
+    // Use the analysis started before the generation if it was done for this matrix structure:
+    if (myanalysisfactor != PETSC_NULL)
+    {
+        if (myanalysisthread.joinable())
+            myanalysisthread.join();
+        
+        if (soltype == myanalysistype && mymeshnumber == myanalysismeshnumber && myisconstrained == myanalysisisconstrained)
+        {
+            profilephase phase("factorize and solve");
+            
+            if (myfactoredrawmat.lock() != A)
+            {
+                wallclock clk;
+                
+                // Run the analysis now that the assembly is done if it was not overlapped with it:
+                bool isanalysedhere = isanalysispending;
+                if (isanalysispending)
+                {
+                    analyse(myanalysismat, myanalysisfactor, soltype);
+                    isanalysispending = false;
+                }
+                
+                // The structure of A is included in the analysed one:
+                MatZeroEntries(myanalysismat);
+                MatAXPY(myanalysismat, 1.0, Apetsc, SUBSET_NONZERO_PATTERN);
+                
+                MatFactorInfo info;
+                MatFactorInfoInitialize(&info);
+                if (soltype == "cholesky")
+                    MatCholeskyFactorNumeric(myanalysisfactor, myanalysismat, &info);
+                else
+                    MatLUFactorNumeric(myanalysisfactor, myanalysismat, &info);
+                myfactoredrawmat = A;
+                
+                stats.factorizationtime = clk.toc()*1e-9;
+                stats.numfactorizations = 1;
+                stats.numsymbolicreuses = not(isanalysedhere);
+                stats.setfactorizationinfo(myanalysisfactor);
+            }
+            else
+                stats.numreuses = 1;
+                
+            wallclock clk;
+            if (istransposed)
+                MatSolveTranspose(myanalysisfactor, b, sol);
+            else
+                MatSolve(myanalysisfactor, b, sol);
+            stats.solvetime = clk.toc()*1e-9;
+            return;
+        }
+        
+        destroyanalysis();
+        myfactoredrawmat.reset();
+    }
+    
+    if (myksp != PETSC_NULL && soltype != myfactorizationtype)
+        destroyfactorization();
+    
+    // Know if a numeric factorization is needed and if it reuses the symbolic factorization:
+    bool isfactorized = true, issymbolicreused = (myksp != PETSC_NULL);
+    
+    if (myksp == PETSC_NULL)
+    {
+        MatDuplicate(Apetsc, MAT_COPY_VALUES, &myfactoredmat);
+        
+        PC pc;
+        KSPCreate(PETSC_COMM_SELF, &myksp);
+        KSPSetOperators(myksp, myfactoredmat, myfactoredmat);
+        KSPSetFromOptions(myksp);
+
+        KSPGetPC(myksp,&pc);
+        if (soltype == "lu")
+            PCSetType(pc,PCLU);
+        if (soltype == "cholesky")
+            PCSetType(pc,PCCHOLESKY);
+        PCFactorSetMatSolverType(pc,MATSOLVERMUMPS);
+        universe::configuremumps(pc);
+        
+        myfactorizationtype = soltype;
+        myfactoredrawmat = A;
+    }
+    else if (myfactoredrawmat.lock() != A)
+    {
+        // The structure is unchanged. The state change of the operator triggers a numeric factorization only:
+        MatCopy(Apetsc, myfactoredmat, SAME_NONZERO_PATTERN);
+        myfactoredrawmat = A;
+    }
+    else
+        isfactorized = false;
+    
+    profilephase phase("factorize and solve");
+    
+    if (isfactorized)
+    {
+        wallclock clk;
+        KSPSetUp(myksp);
+        stats.factorizationtime = clk.toc()*1e-9;
+        stats.numfactorizations = 1;
+        stats.numsymbolicreuses = issymbolicreused;
+        stats.setfactorizationinfo(myksp);
+    }
+    else
+        stats.numreuses = 1;
+    
+    wallclock clk;
+    if (istransposed)
+        KSPSolveTranspose(myksp, b, sol);
+    else
+        KSPSolve(myksp, b, sol);
+    stats.solvetime = clk.toc()*1e-9;
+}
@@ -0,0 +1,133 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object stores the csr structure of a processed 'rawmat' object as well as the
+// position in the csr value arrays of every accumulated fragment entry. Matrices made
+// of fragments with the same structure can then be filled without sorting the entries.
+
+
+#ifndef SPARSITYPATTERN_H
+#define SPARSITYPATTERN_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <string>
+#include <thread>
+#include "indexmat.h"
+#include "densemat.h"
+#include "petsc.h"
+#include "petscmat.h"
+#include "petscksp.h"
+#include "profiler.h"
+#include "memorypool.h"
+#include "solverstats.h"
+#include "wallclock.h"
+
+// Csr row pointers and column indexes. The petsc index type is used so that
+// more than 2^31 nonzeros are possible when petsc has 64-bit indexes:
+typedef std::shared_ptr<std::vector<PetscInt, uninitializedallocator<PetscInt>>> csrindexes;
+
+class rawmat;
+
+class sparsitypattern
+{
+    friend class rawmat;
+
+    private:
+        
+        bool isitdefined = false;
+        
+        // Information used to check that the pattern can be reused:
+        int mymeshnumber = -1;
+        std::vector<bool> myisconstrained = {};
+        bool myissymmetric = false;
+        // Number of rows and columns in each fragment of values, row addresses and column addresses:
+        std::vector<int> myfragmentsizes = {};
+        // Hash of the row and column addresses in each fragment:
+        std::vector<unsigned long long int> myadresshashes = {};
+        
+        // 64 bit FNV-1a hash of the addresses:
+        static unsigned long long int hashadresses(indexmat& adresses);
+        
+        long long int nnzA = -1, nnzD = -1;
+        
+        csrindexes Arows = NULL, Acols = NULL, Drows = NULL, Dcols = NULL;
+        indexmat Ainds, Dinds;
+        // Row or column index in A or D of every dof:
+        std::vector<int> myrenumtolocalindex = {};
+        
+        // Position in Avals of each accumulated entry (-1 if the entry is dropped, -2-k for position k in Dvals):
+        std::vector<PetscInt> myslots = {};
+        
+        // Factorization kept for all matrices with this pattern. Its operator has the structure of
+        // the pattern and gets the values of every new matrix to factorize. The ordering and symbolic
+        // factorization are then only computed once and only the numeric factorization is redone.
+        bool iskeepingfactorization = false;
+        std::string myfactorizationtype = "";
+        KSP myksp = PETSC_NULL;
+        Mat myfactoredmat = PETSC_NULL;
+        // Matrix whose values are currently factorized:
+        std::weak_ptr<rawmat> myfactoredrawmat;
+        
+        void destroyfactorization(void);
+        
+        // Ordering and symbolic factorization on the structure of a symbolic assembly pass (see 'startanalysis').
+        // The factor is then kept instead of the ksp above. The analysis is pending until the next solve if it
+        // does not run on another thread:
+        std::thread myanalysisthread;
+        bool isanalysispending = false;
+        Mat myanalysismat = PETSC_NULL, myanalysisfactor = PETSC_NULL;
+        std::string myanalysistype = "";
+        // The analysis is only valid for matrices at this mesh number and with these constrained dofs:
+        int myanalysismeshnumber = -1;
+        std::vector<bool> myanalysisisconstrained = {};
+        
+        void destroyanalysis(void);
+        
+        // True if the analysis can run on another thread while the main thread makes petsc and MPI calls.
+        // This requires a thread-safe petsc build and MPI with MPI_THREAD_MULTIPLE support:
+        static bool isanalysisoverlapallowed(void);
+        
+        // Ordering and symbolic factorization of 'analysismat' in 'analysisfactor':
+        static void analyse(Mat analysismat, Mat analysisfactor, std::string soltype);
+        
+    public:
+        
+        ~sparsitypattern(void);
+        
+        bool isdefined(void) { return isitdefined; };
+        
+        // Keep the symbolic factorization across the direct solves of all matrices with this pattern:
+        void keepfactorization(bool iskept = true);
+        bool isfactorizationkept(void) { return iskeepingfactorization; };
+        
+        // Forget the pattern:
+        void clear(void);
+        
+        // Mesh number at which the pattern was built:
+        int getmeshnumber(void) { return mymeshnumber; };
+        // Follow a mesh change to mesh number 'meshnumber' given the new index of every dof (see 'dofmanager::getrenumbering')
+        // and the new number of dofs. The pattern (and the kept factorization) only stays valid if no dof moved:
+        void remap(int meshnumber, std::vector<int>& renumbering, int numdofs);
+        
+        // Check if the pattern can be used for the fragments provided as argument (same sizes and addresses):
+        bool ismatching(int meshnumber, std::vector<bool>& isconstrained, std::vector<indexmat>& rowadresses, std::vector<indexmat>& coladresses, std::vector<densemat>& vals);
+        
+        // Prepare the ordering and symbolic factorization (mumps analysis) of type 'soltype' ("lu" or "cholesky") for a
+        // processed matrix 'symbolic' whose structure includes all entries of the next matrices to solve (e.g. from
+        // 'contribution::generatepattern'). If 'isanalysisoverlapallowed' the analysis runs on another thread while the
+        // values are generated. Otherwise it runs on the main thread in the next 'solve', after the assembly.
+        // The next 'solve' then only adds the numeric factorization. Nothing is done if the factorization is not kept:
+        void startanalysis(std::shared_ptr<rawmat> symbolic, std::string soltype, std::vector<bool>& isconstrained);
+        
+        // Solve A*sol = b (transpose(A)*sol = b if 'istransposed') with the kept factorization for a matrix processed with this
+        // pattern. Only the numeric factorization is redone if 'A' is not the matrix last factorized.
+        // The cost of the factorization and of the solve is set in 'stats':
+        void solve(std::shared_ptr<rawmat> A, Vec b, Vec sol, std::string soltype, solverstats& stats, bool istransposed = false);
+        
+};
+
+#endif
@@ -0,0 +1,272 @@
+#include "staticcondensation.h"
+
+
+staticcondensation::staticcondensation(mat A, std::vector<std::vector<int>> interiordofs)
+{
+    myoriginalmat = A;
+
+    indexmat ainds = A.getainds();
+    int* aindsptr = ainds.getvalues();
+    numreduced = ainds.count();
+
+    std::vector<int> reducedindex(A.countrows(), -1);
+    for (int i = 0; i < numreduced; i++)
+        reducedindex[aindsptr[i]] = i;
+
+    ///// Number the elements with unconstrained interior dofs and the skeleton dofs:
+    std::vector<int> elementof(numreduced, -1), positionin(numreduced, -1);
+    for (int e = 0; e < interiordofs.size(); e++)
+    {
+        std::vector<int> curinds = {};
+        for (int i = 0; i < interiordofs[e].size(); i++)
+        {
+            int r = reducedindex[interiordofs[e][i]];
+            if (r == -1)
+                continue;
+            elementof[r] = myinteriorindexes.size();
+            positionin[r] = curinds.size();
+            curinds.push_back(r);
+        }
+        if (curinds.size() > 0)
+            myinteriorindexes.push_back(curinds);
+    }
+    int numelems = myinteriorindexes.size();
+    if (numelems == 0)
+        return;
+
+    std::vector<int> skeletonnumber(numreduced, -1);
+    for (int r = 0; r < numreduced; r++)
+    {
+        if (elementof[r] == -1)
+        {
+            skeletonnumber[r] = myskeletonindexes.size();
+            myskeletonindexes.push_back(r);
+        }
+    }
+
+    ///// Split the matrix entries into the skeleton block and the element blocks:
+    std::vector<densemat> aii(numelems);
+    for (int e = 0; e < numelems; e++)
+        aii[e] = densemat(myinteriorindexes[e].size(), myinteriorindexes[e].size(), 0.0);
+    // (row, column, value) triplets:
+    std::vector<std::vector<int>> abirows(numelems), abicols(numelems), aibrows(numelems), aibcols(numelems);
+    std::vector<std::vector<double>> abivals(numelems), aibvals(numelems);
+    std::vector<int> schurrows, schurcols;
+    std::vector<double> schurvals;
+
+    // Add an entry to its block. False is returned if interior dofs of different elements are coupled:
+    auto addentry = [&](int r, int c, double v) -> bool
+    {
+        int er = elementof[r];
+        int ec = elementof[c];
+
+        if (er == -1 && ec == -1)
+        {
+            schurrows.push_back(skeletonnumber[r]);
+            schurcols.push_back(skeletonnumber[c]);
+            schurvals.push_back(v);
+        }
+        if (er == -1 && ec != -1)
+        {
+            abirows[ec].push_back(skeletonnumber[r]);
+            abicols[ec].push_back(positionin[c]);
+            abivals[ec].push_back(v);
+        }
+        if (er != -1 && ec == er)
+        {
+            double* aiivals = aii[er].getvalues();
+            aiivals[positionin[r]*aii[er].countcolumns()+positionin[c]] += v;
+        }
+        if (er != -1 && ec == -1)
+        {
+            aibrows[er].push_back(positionin[r]);
+            aibcols[er].push_back(skeletonnumber[c]);
+            aibvals[er].push_back(v);
+        }
+        
+        return (er == -1 || ec == -1 || ec == er);
+    };
+
+    // Only the upper triangle is stored for matrices in symmetric storage:
+    bool issymmetric = A.getpointer()->issymmetric();
+
+    Mat Apetsc = A.getapetsc();
+    if (issymmetric)
+        MatSetOption(Apetsc, MAT_GETROW_UPPERTRIANGULAR, PETSC_TRUE);
+    
+    bool iscoupled = false;
+    for (int r = 0; r < numreduced && iscoupled == false; r++)
+    {
+        PetscInt ncols;
+        const PetscInt* cols;
+        const PetscScalar* vals;
+        MatGetRow(Apetsc, r, &ncols, &cols, &vals);
+
+        for (int k = 0; k < ncols; k++)
+        {
+            bool isok = addentry(r, cols[k], vals[k]);
+            if (issymmetric && cols[k] != r)
+                isok = (addentry(cols[k], r, vals[k]) && isok);
+            if (isok == false)
+            {
+                iscoupled = true;
+                break;
+            }
+        }
+        MatRestoreRow(Apetsc, r, &ncols, &cols, &vals);
+    }
+    
+    // Interior dofs of different elements are coupled. Nothing can be condensed:
+    if (iscoupled)
+    {
+        myinteriorindexes = {};
+        myskeletonindexes = {};
+        return;
+    }
+
+    ///// Eliminate the interior dofs element by element:
+    myinverses = std::vector<densemat>(numelems);
+    myskeletonrows = std::vector<std::vector<int>>(numelems);
+    myabitimesinverse = std::vector<densemat>(numelems);
+    myskeletoncols = std::vector<std::vector<int>>(numelems);
+    myaib = std::vector<densemat>(numelems);
+
+    std::vector<int> localnumber(myskeletonindexes.size(), -1);
+    for (int e = 0; e < numelems; e++)
+    {
+        int m = myinteriorindexes[e].size();
+
+        // Skeleton rows and columns coupled to the element interior:
+        myskeletonrows[e] = abirows[e];
+        std::sort(myskeletonrows[e].begin(), myskeletonrows[e].end());
+        myskeletonrows[e].erase(std::unique(myskeletonrows[e].begin(), myskeletonrows[e].end()), myskeletonrows[e].end());
+        myskeletoncols[e] = aibcols[e];
+        std::sort(myskeletoncols[e].begin(), myskeletoncols[e].end());
+        myskeletoncols[e].erase(std::unique(myskeletoncols[e].begin(), myskeletoncols[e].end()), myskeletoncols[e].end());
+
+        int nr = myskeletonrows[e].size(), nc = myskeletoncols[e].size();
+
+        densemat abi(nr, m, 0.0);
+        double* abiptr = abi.getvalues();
+        for (int i = 0; i < nr; i++)
+            localnumber[myskeletonrows[e][i]] = i;
+        for (int k = 0; k < abivals[e].size(); k++)
+            abiptr[localnumber[abirows[e][k]]*m+abicols[e][k]] += abivals[e][k];
+
+        myaib[e] = densemat(m, nc, 0.0);
+        double* aibptr = myaib[e].getvalues();
+        for (int i = 0; i < nc; i++)
+            localnumber[myskeletoncols[e][i]] = i;
+        for (int k = 0; k < aibvals[e].size(); k++)
+            aibptr[aibrows[e][k]*nc+localnumber[aibcols[e][k]]] += aibvals[e][k];
+
+        myinverses[e] = aii[e].getinverse();
+
+        if (nr == 0)
+            continue;
+
+        myabitimesinverse[e] = abi.multiply(myinverses[e]);
+
+        if (nc == 0)
+            continue;
+
+        // Add -Abi*inv(Aii)*Aib to the Schur complement:
+        densemat product = myabitimesinverse[e].multiply(myaib[e]);
+        double* prodptr = product.getvalues();
+        for (int i = 0; i < nr; i++)
+        {
+            for (int j = 0; j < nc; j++)
+            {
+                schurrows.push_back(myskeletonrows[e][i]);
+                schurcols.push_back(myskeletoncols[e][j]);
+                schurvals.push_back(-prodptr[i*nc+j]);
+            }
+        }
+    }
+
+    int numskeleton = myskeletonindexes.size();
+    if (numskeleton > 0)
+    {
+        int numentries = schurvals.size();
+        myschur = mat(numskeleton, indexmat(numentries, 1, schurrows), indexmat(numentries, 1, schurcols), densemat(numentries, 1, schurvals));
+    }
+
+    myisvalid = true;
+}
+
+vec staticcondensation::solve(vec b, std::string soltype, bool diagscaling)
+{
+    if (myisvalid == false)
+    {
+        std::cout << "Error in 'staticcondensation' object: cannot solve (the interior dofs could not be condensed)" << std::endl;
+        abort();
+    }
+
+    int numelems = myinteriorindexes.size();
+    int numskeleton = myskeletonindexes.size();
+
+    vec breduced = myoriginalmat.eliminate(b);
+    densemat bvals = breduced.getallvalues();
+    double* bptr = bvals.getvalues();
+
+    ///// Condense the right handside:
+    densemat gvals(numskeleton, 1);
+    double* gptr = gvals.getvalues();
+    for (int s = 0; s < numskeleton; s++)
+        gptr[s] = bptr[myskeletonindexes[s]];
+
+    std::vector<densemat> bi(numelems);
+    for (int e = 0; e < numelems; e++)
+    {
+        int m = myinteriorindexes[e].size();
+        bi[e] = densemat(m, 1);
+        double* biptr = bi[e].getvalues();
+        for (int i = 0; i < m; i++)
+            biptr[i] = bptr[myinteriorindexes[e][i]];
+
+        if (myskeletonrows[e].size() == 0)
+            continue;
+
+        densemat abiinvbi = myabitimesinverse[e].multiply(bi[e]);
+        double* prodptr = abiinvbi.getvalues();
+        for (int i = 0; i < myskeletonrows[e].size(); i++)
+            gptr[myskeletonrows[e][i]] -= prodptr[i];
+    }
+
+    ///// Solve on the skeleton:
+    densemat xvals(numreduced, 1);
+    double* xptr = xvals.getvalues();
+
+    densemat xbvals(numskeleton, 1);
+    if (numskeleton > 0)
+    {
+        vec gvec(numskeleton, indexmat(numskeleton, 1, 0, 1), gvals);
+        xbvals = sl::solve(myschur, gvec, soltype, diagscaling).getallvalues();
+    }
+    double* xbptr = xbvals.getvalues();
+    for (int s = 0; s < numskeleton; s++)
+        xptr[myskeletonindexes[s]] = xbptr[s];
+
+    ///// Recover the interior values element by element:
+    for (int e = 0; e < numelems; e++)
+    {
+        int nc = myskeletoncols[e].size();
+        if (nc > 0)
+        {
+            densemat xblocal(nc, 1);
+            double* xblocalptr = xblocal.getvalues();
+            for (int i = 0; i < nc; i++)
+                xblocalptr[i] = xbptr[myskeletoncols[e][i]];
+            bi[e].subtract(myaib[e].multiply(xblocal));
+        }
+
+        densemat xi = myinverses[e].multiply(bi[e]);
+        double* xiptr = xi.getvalues();
+        for (int i = 0; i < myinteriorindexes[e].size(); i++)
+            xptr[myinteriorindexes[e][i]] = xiptr[i];
+    }
+
+    vec xvec(numreduced, indexmat(numreduced, 1, 0, 1), xvals);
+
+    return myoriginalmat.xbmerge(xvec, b);
+}
@@ -0,0 +1,77 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This code calls the PETSc library. See https://www.mcs.anl.gov/petsc/ for more information.
+
+// This object eliminates element by element the interior (bubble) dofs of an assembled
+// matrix. Only the Schur complement on the remaining skeleton dofs is factorized, the
+// interior values are then recovered element by element from the skeleton solution.
+
+
+#ifndef STATICCONDENSATION_H
+#define STATICCONDENSATION_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "mat.h"
+#include "vec.h"
+#include "sl.h"
+#include "indexmat.h"
+#include "densemat.h"
+#include "petsc.h"
+#include "petscmat.h"
+
+class mat;
+class vec;
+
+class staticcondensation
+{
+    private:
+
+        // False if the interior dofs could not be condensed (e.g. they are coupled to other elements):
+        bool myisvalid = false;
+
+        mat myoriginalmat;
+
+        int numreduced = 0;
+
+        // Index in the reduced (unconstrained) dof numbering of every skeleton dof:
+        std::vector<int> myskeletonindexes = {};
+        // Schur complement on the skeleton dofs:
+        mat myschur;
+
+        // For every element with interior dofs:
+        //
+        // - the reduced index of the interior dofs
+        // - the inverse of the interior-interior block
+        // - the skeleton rows and the interior-interior inverse times the skeleton-interior block
+        // - the skeleton columns and the interior-skeleton block
+        //
+        std::vector<std::vector<int>> myinteriorindexes = {};
+        std::vector<densemat> myinverses = {};
+        std::vector<std::vector<int>> myskeletonrows = {};
+        std::vector<densemat> myabitimesinverse = {};
+        std::vector<std::vector<int>> myskeletoncols = {};
+        std::vector<densemat> myaib = {};
+
+    public:
+
+        // 'interiordofs[e]' are the dof indexes of element e that are only coupled inside element e:
+        staticcondensation(mat A, std::vector<std::vector<int>> interiordofs);
+
+        bool isvalid(void) { return myisvalid; };
+
+        int countskeletondofs(void) { return myskeletonindexes.size(); };
+
+        mat getcondensedmatrix(void) { return myschur; };
+
+        // Solve Ax = b with a direct solver applied to the condensed matrix:
+        vec solve(vec b, std::string soltype = "lu", bool diagscaling = false);
+
+};
+
+#endif
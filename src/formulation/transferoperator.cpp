@@ -0,0 +1,80 @@
+#include "transferoperator.h"
+#include "sl.h"
+
+
+transferoperator::transferoperator(field source, int sourcephysreg, field target, int targetphysreg, bool errorifnotfound)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+    physicalregions* prs = rm->getphysicalregions();
+
+    prs->errorundefined({sourcephysreg, targetphysreg});
+
+    std::shared_ptr<rawfield> sourceptr = source.getpointer(), targetptr = target.getpointer();
+
+    if (targetptr->gettypename() != "h1")
+    {
+        std::cout << "Error in 'transferoperator' object: expected an 'h1' type target field" << std::endl;
+        abort();
+    }
+    if (source.countcomponents() != target.countcomponents())
+    {
+        std::cout << "Error in 'transferoperator' object: the source and target fields must have the same number of components" << std::endl;
+        abort();
+    }
+    if (source.getharmonics() != target.getharmonics())
+    {
+        std::cout << "Error in 'transferoperator' object: the source and target fields must have the same harmonics" << std::endl;
+        abort();
+    }
+    std::vector<int> targetdisjregs = prs->get(targetphysreg)->getdisjointregions();
+    for (int i = 0; i < targetdisjregs.size(); i++)
+    {
+        if (targetptr->getinterpolationorder(targetdisjregs[i]) != 1)
+        {
+            std::cout << "Error in 'transferoperator' object: expected an order 1 target field on the target region" << std::endl;
+            abort();
+        }
+    }
+
+    mysource = source; mytarget = target;
+    mysourcephysreg = sourcephysreg; mytargetphysreg = targetphysreg;
+
+    // Temporary physical region with the target nodes:
+    int nodesphysreg = prs->createfromdisjointregionlist(prs->get(targetphysreg)->getdisjointregions(0));
+
+    // The source dofs only appear in an 'on' term:
+    std::vector<int> harms = source.getharmonics();
+    for (int h = 0; h < harms.size(); h++)
+        mytransfer.getdofmanager()->addtostructure(sourceptr->harmonic(harms[h]), sourcephysreg, harms[h]);
+
+    // Every row of the matrix holds the source shape functions at a target node:
+    for (int c = 0; c < source.countcomponents(); c++)
+    {
+        integration myterm(nodesphysreg, sl::on(sourcephysreg, sl::dof(source.comp(c)), errorifnotfound) * sl::tf(target.comp(c)));
+        myterm.isbarycentereval = true;
+
+        mytransfer += myterm;
+    }
+
+    mytransfer.generatestiffnessmatrix();
+    mymatrix = mytransfer.A();
+
+    prs->remove({nodesphysreg}, false);
+
+    mymeshnumber = rm->getmeshnumber();
+    mymeshstate = rm->getstate();
+}
+
+void transferoperator::apply(void)
+{
+    if (universe::getrawmesh()->getmeshnumber() != mymeshnumber || universe::getrawmesh()->getstate() != mymeshstate)
+    {
+        std::cout << "Error in 'transferoperator' object: the mesh has changed since the transfer operator was created" << std::endl;
+        abort();
+    }
+
+    vec x(mytransfer);
+    x.setdata();
+
+    mytarget.setdata(mytargetphysreg, mymatrix*x);
+}
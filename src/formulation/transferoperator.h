@@ -0,0 +1,54 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object transfers the values of a field on a source physical region to a field on a target
+// physical region (e.g. between two non-matching parts of the mesh or from a coarse to a fine part).
+// The target nodes are located once in the source elements and the source shape functions evaluated
+// there are stored in a sparse matrix T. Every transfer is then a single matrix-vector product y = T*x
+// instead of a point search per call. The target field must be an order 1 'h1' type field so that its
+// dofs are the node values. Constrained target dofs keep their value.
+//
+// The operator must be created again if the mesh changes.
+
+
+#ifndef TRANSFEROPERATOR_H
+#define TRANSFEROPERATOR_H
+
+#include <iostream>
+#include <vector>
+#include "field.h"
+#include "formulation.h"
+#include "mat.h"
+#include "vec.h"
+#include "universe.h"
+
+class transferoperator
+{
+    private:
+
+        field mysource, mytarget;
+        int mysourcephysreg = -1, mytargetphysreg = -1;
+
+        formulation mytransfer;
+        mat mymatrix;
+
+        // Mesh on which the operator was created:
+        int mymeshnumber = -1;
+        long long int mymeshstate = -1;
+
+    public:
+
+        // The target nodes not found in the source region are set to zero if 'errorifnotfound' is false:
+        transferoperator(field source, int sourcephysreg, field target, int targetphysreg, bool errorifnotfound = true);
+
+        // Set the target field on the target region from the current source field values:
+        void apply(void);
+
+        // Get the transfer matrix (acting on the dofs of the source and target fields):
+        mat getmatrix(void) { return mymatrix; };
+
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "vec.h"
+#include "gentools.h"
 
 
 vec::vec(formulation formul) { rawvecptr = std::shared_ptr<rawvec>(new rawvec(formul.getdofmanager())); }
@@ -28,8 +29,10 @@ void vec::permute(indexmat rowpermute, bool invertit)
         abort();
     }
 
+    petscindexes rowpermuteinds(rowpermute.getvalues(), rowpermute.count());
+    
     IS rowpermutis;
-    ISCreateGeneral(PETSC_COMM_SELF, rowpermute.count(), rowpermute.getvalues(), PETSC_USE_POINTER, &rowpermutis);
+    ISCreateGeneral(PETSC_COMM_SELF, rowpermute.count(), rowpermuteinds.getvalues(), PETSC_USE_POINTER, &rowpermutis);
     ISSetPermutation(rowpermutis);
     
     if (invertit == false)
@@ -59,6 +62,10 @@ void vec::updateconstraints(void)
     // Set the gauged indexes to zero:
     indexmat gaugedindexes = mydofmanager->getgaugedindexes();
     rawvecptr->setvalues(gaugedindexes, densemat(gaugedindexes.countrows(), gaugedindexes.countcolumns(), 0.0));
+    
+    // Hold the inactive fields (harmonics) at zero:
+    indexmat inactiveindexes = mydofmanager->getinactiveindexes();
+    rawvecptr->setvalues(inactiveindexes, densemat(inactiveindexes.countrows(), inactiveindexes.countcolumns(), 0.0));
 }
 
 void vec::setvalues(indexmat addresses, densemat valsmat, std::string op) 
@@ -78,8 +85,35 @@ densemat vec::getvalues(indexmat addresses) { errorifpointerisnull(); return raw
 densemat vec::getallvalues(void)
 {
     errorifpointerisnull();
-    indexmat ads(size(),1,0,1);
-    return rawvecptr->getvalues(ads);
+    Vec x = getpetsc();
+    
+    PetscInt numvalues;
+    VecGetLocalSize(x, &numvalues);
+    densemat output(numvalues, 1);
+    
+    const double* vecptr;
+    VecGetArrayRead(x, &vecptr);
+    std::copy(vecptr, vecptr+numvalues, output.getvalues());
+    VecRestoreArrayRead(x, &vecptr);
+    
+    return output;
+}
+
+densemat vec::getallvaluesview(void)
+{
+    errorifpointerisnull();
+    Vec x = getpetsc();
+    
+    PetscInt numvalues;
+    VecGetLocalSize(x, &numvalues);
+    
+    double* vecptr;
+    VecGetArray(x, &vecptr);
+    // The array is given back to petsc when the last copy of the view is destroyed:
+    std::shared_ptr<rawvec> owner = rawvecptr;
+    std::shared_ptr<double> vals(vecptr, [owner, x](double* ptr){ VecRestoreArray(x, &ptr); });
+    
+    return densemat(numvalues, 1, vals);
 }
 
 void vec::setvalue(int address, double value, std::string op)
@@ -192,6 +226,22 @@ double vec::norm(std::string type)
 {
     double normval;
     
+    // Sum in the index order rather than with the (possibly multithreaded) BLAS:
+    if (universe::isreductionreproducible && (type == "1" || type == "2"))
+    {
+        PetscInt numvalues;
+        VecGetLocalSize(getpetsc(), &numvalues);
+        const double* vals;
+        VecGetArrayRead(getpetsc(), &vals);
+        std::vector<double> terms(numvalues);
+        for (PetscInt i = 0; i < numvalues; i++)
+            terms[i] = (type == "1") ? std::abs(vals[i]) : vals[i]*vals[i];
+        VecRestoreArrayRead(getpetsc(), &vals);
+        
+        normval = gentools::compensatedsum(terms.data(), numvalues);
+        return (type == "1") ? normval : std::sqrt(normval);
+    }
+    
     if (type == "1") { VecNorm(getpetsc(), NORM_1, &normval); return normval; }
     if (type == "2") { VecNorm(getpetsc(), NORM_2, &normval); return normval; }
     if (type == "infinity") { VecNorm(getpetsc(), NORM_INFINITY, &normval); return normval; }
@@ -203,6 +253,18 @@ double vec::norm(std::string type)
 double vec::sum(void)
 {
     double sumval;
+    
+    if (universe::isreductionreproducible)
+    {
+        PetscInt numvalues;
+        VecGetLocalSize(getpetsc(), &numvalues);
+        const double* vals;
+        VecGetArrayRead(getpetsc(), &vals);
+        sumval = gentools::compensatedsum(vals, numvalues);
+        VecRestoreArrayRead(getpetsc(), &vals);
+        return sumval;
+    }
+    
     VecSum(getpetsc(), &sumval);
     return sumval;
 }
@@ -241,5 +303,22 @@ vec vec::operator-(vec input)
 }
 
 
+void vec::axpy(double a, vec x)
+{
+    errorifpointerisnull();
+    VecAXPY(getpetsc(), a, x.getpetsc());
+}
+
+void vec::scale(double a)
+{
+    errorifpointerisnull();
+    VecScale(getpetsc(), a);
+}
+
+vec& vec::operator+=(vec input) { axpy(1, input); return *this; }
+vec& vec::operator-=(vec input) { axpy(-1, input); return *this; }
+vec& vec::operator*=(double input) { scale(input); return *this; }
+vec& vec::operator/=(double input) { scale(1.0/input); return *this; }
+
 vec operator*(double inputdouble, vec inputvec) { return inputvec*inputdouble; }
 
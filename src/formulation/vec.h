@@ -56,6 +56,9 @@ class vec
         void setallvalues(densemat valsmat, std::string op = "set");
         densemat getvalues(indexmat addresses);
         densemat getallvalues(void);
+        // Get a column densemat that directly aliases the values of this vector (no copy). Modifying it modifies the vector.
+        // The vector must not be otherwise accessed or modified while the view exists. The view keeps the vector alive.
+        densemat getallvaluesview(void);
         // Set and get value at a single index:
         void setvalue(int address, double value, std::string op = "set");
         double getvalue(int address);
@@ -100,6 +103,15 @@ class vec
         vec operator+(vec input);
         vec operator-(vec input);
         
+        // In-place operations (no temporary vector is created):
+        // this = this + a*x
+        void axpy(double a, vec x);
+        void scale(double a);
+        vec& operator+=(vec input);
+        vec& operator-=(vec input);
+        vec& operator*=(double input);
+        vec& operator/=(double input);
+        
 };
 
 vec operator*(double, vec);
@@ -1,6 +1,140 @@
 #include "fourier.h"
+#include "universe.h"
+#include <thread>
+#include <algorithm>
 
 
+// Minimum number of transformed columns per thread:
+static const int minnumcolsperthreadforfft = 1000;
+
+// Smallest prime factor of n:
+static int smallestfactor(int n)
+{
+    for (int f = 2; f*f <= n; f++)
+    {
+        if (n%f == 0)
+            return f;
+    }
+    return n;
+}
+
+// Forward complex transform of columns 'colbegin' to 'colend'-1 of the N x M row-major matrix (re, im) with a mixed radix Stockham
+// algorithm. Every butterfly operates on contiguous row segments. 'twcos' and 'twsin' hold the real and imaginary parts of exp(-2*pi*i*t/N):
+static void complexfft(int N, int M, int colbegin, int colend, double* re, double* im, double* workre, double* workim, std::vector<double>& twcos, std::vector<double>& twsin)
+{
+    double* xr = re; double* xi = im; double* yr = workre; double* yi = workim;
+    
+    int n = N, s = 1;
+    while (n > 1)
+    {
+        int r = smallestfactor(n);
+        int m = n/r;
+        // exp(-2*pi*i*t/n) is at index t*tstep in the twiddles:
+        int tstep = N/n;
+        
+        for (int p = 0; p < m; p++)
+        {
+            for (int q = 0; q < s; q++)
+            {
+                int inbase = q + s*p;
+                int outbase = q + s*r*p;
+                
+                if (r == 2)
+                {
+                    double wr = twcos[p*tstep], wi = twsin[p*tstep];
+                    double* ar = xr + (long long int)inbase*M; double* ai = xi + (long long int)inbase*M;
+                    double* br = xr + (long long int)(inbase+s*m)*M; double* bi = xi + (long long int)(inbase+s*m)*M;
+                    double* y0r = yr + (long long int)outbase*M; double* y0i = yi + (long long int)outbase*M;
+                    double* y1r = yr + (long long int)(outbase+s)*M; double* y1i = yi + (long long int)(outbase+s)*M;
+                    for (int c = colbegin; c < colend; c++)
+                    {
+                        double dr = ar[c]-br[c], di = ai[c]-bi[c];
+                        y0r[c] = ar[c]+br[c]; y0i[c] = ai[c]+bi[c];
+                        y1r[c] = dr*wr-di*wi; y1i[c] = dr*wi+di*wr;
+                    }
+                    continue;
+                }
+                
+                for (int k = 0; k < r; k++)
+                {
+                    double* ykr = yr + (long long int)(outbase+k*s)*M; double* yki = yi + (long long int)(outbase+k*s)*M;
+                    for (int c = colbegin; c < colend; c++)
+                    {
+                        ykr[c] = 0; yki[c] = 0;
+                    }
+                    // Radix r transform:
+                    for (int j = 0; j < r; j++)
+                    {
+                        int omegaindex = ((j*k)%r)*(N/r);
+                        double omr = twcos[omegaindex], omi = twsin[omegaindex];
+                        double* xjr = xr + (long long int)(inbase+j*s*m)*M; double* xji = xi + (long long int)(inbase+j*s*m)*M;
+                        for (int c = colbegin; c < colend; c++)
+                        {
+                            ykr[c] += xjr[c]*omr-xji[c]*omi;
+                            yki[c] += xjr[c]*omi+xji[c]*omr;
+                        }
+                    }
+                    // Twiddle:
+                    double wr = twcos[p*k*tstep], wi = twsin[p*k*tstep];
+                    for (int c = colbegin; c < colend; c++)
+                    {
+                        double tr = ykr[c]*wr-yki[c]*wi;
+                        yki[c] = ykr[c]*wi+yki[c]*wr;
+                        ykr[c] = tr;
+                    }
+                }
+            }
+        }
+        
+        std::swap(xr, yr); std::swap(xi, yi);
+        n = m; s *= r;
+    }
+    
+    // Bring the result to (re, im):
+    if (xr != re)
+    {
+        for (int i = 0; i < N; i++)
+        {
+            for (int c = colbegin; c < colend; c++)
+            {
+                re[(long long int)i*M+c] = xr[(long long int)i*M+c];
+                im[(long long int)i*M+c] = xi[(long long int)i*M+c];
+            }
+        }
+    }
+}
+
+// Forward complex transform of all columns of the N x M row-major matrix (re, im). The columns are split over the threads:
+static void complexfft(int N, int M, std::vector<double>& re, std::vector<double>& im)
+{
+    double pi = 3.141592653589793238;
+    
+    std::vector<double> twcos(N), twsin(N);
+    for (int t = 0; t < N; t++)
+    {
+        twcos[t] = std::cos(2.0*pi*t/N);
+        twsin[t] = -std::sin(2.0*pi*t/N);
+    }
+    
+    std::vector<double> workre((long long int)N*M), workim((long long int)N*M);
+    
+    int numthreadstouse = 1;
+    if (universe::getmaxnumthreads() > 1 && not(universe::isinthreadedloop))
+        numthreadstouse = std::min(M/minnumcolsperthreadforfft+1, universe::getmaxnumthreads()); // require a min num columns per thread
+    
+    auto computechunk = [&](int t)
+    {
+        complexfft(N, M, (long long int)t*M/numthreadstouse, (long long int)(t+1)*M/numthreadstouse, re.data(), im.data(), workre.data(), workim.data(), twcos, twsin);
+    };
+    
+    std::vector<std::thread> threadobjs(numthreadstouse-1);
+    for (int t = 1; t < numthreadstouse; t++)
+        threadobjs[t-1] = universe::newthread(computechunk, t);
+    computechunk(0);
+    for (int t = 1; t < numthreadstouse; t++)
+        threadobjs[t-1].join();
+}
+
 std::vector<std::vector<densemat>> fourier::fft(densemat input, int mym, int myn)
 {
     // Number of time evaluations.
@@ -8,11 +142,13 @@ std::vector<std::vector<densemat>> fourier::fft(densemat input, int mym, int myn
     // Number of 1D transforms to perform:
     int numtransforms = input.countcolumns();
 
-
-    double pi = 3.141592653589793238;
-
     double* inputvals = input.getvalues();
     
+    // Transform all columns at once:
+    std::vector<double> re(inputvals, inputvals + (long long int)numtimeevals*numtransforms);
+    std::vector<double> im((long long int)numtimeevals*numtransforms, 0.0);
+    complexfft(numtimeevals, numtransforms, re, im);
+    
     // Create the output. There are numtimeevals harmonics + the sin0 entry at the begining.
     std::vector<std::vector<densemat>> output(numtimeevals + 1, std::vector<densemat> {});
 
@@ -25,26 +161,23 @@ std::vector<std::vector<densemat>> fourier::fft(densemat input, int mym, int myn
         // The current harmonic has a frequency currentfreq*f0.
         int currentfreq = harmonic::getfrequency(harm);
         
-        // Initialise to all zero:
-        densemat currentmat(mym, myn, 0);
+        // Real part then imaginary part (with a minus sign for the sine).
+        // Correct the missing factor 2 for everything but the constant:
+        double scaling = 1.0/numtimeevals;
+        if (currentfreq > 0)
+            scaling *= 2;
+        
+        densemat currentmat(mym, myn);
         double* currentvals = currentmat.getvalues();
         
-        // Loop on every time step in the input matrix:
-        for (int i = 0; i < numtimeevals; i++)
+        double* transformed = re.data() + (long long int)currentfreq*numtransforms;
+        if (harm%2 == 0)
         {
-            // Real part then imaginary part.
-            double coef;
-            if (harm%2 == 1)
-                coef = std::cos(2.0*pi*currentfreq*i/numtimeevals) / numtimeevals;
-            else
-                coef = std::sin(2.0*pi*currentfreq*i/numtimeevals) / numtimeevals;
-            // Correct the missing factor 2 for everything but the constant:
-            if (currentfreq > 0)
-                coef *= 2;
-        
-            for (int j = 0; j < numtransforms; j++)
-                currentvals[j] += inputvals[i*numtransforms+j] * coef;
+            transformed = im.data() + (long long int)currentfreq*numtransforms;
+            scaling *= -1;
         }
+        for (int j = 0; j < numtransforms; j++)
+            currentvals[j] = scaling * transformed[j];
 
         output[harm] = {currentmat};
     }
@@ -83,37 +216,41 @@ void fourier::removeroundoffnoise(std::vector<std::vector<densemat>>& input, dou
 
 densemat fourier::inversefft(std::vector<std::vector<densemat>>& input, int numtimevals, int mym, int myn)
 {
-    double pi = 3.141592653589793238;
-    double phasestep = 2.0*pi / ((double)(numtimevals));
-
-    // The end result goes here. Initial value is 0.
-    densemat output(numtimevals, mym*myn, 0);
-    
-    // Loop on all non zero harmonics:
-    densemat sincoseval(numtimevals,1);
-    double* valvec = sincoseval.getvalues();
+    int numvals = mym*myn;
     
+    // Gather the conjugate of the spectrum 'cos - i*sin' of every frequency (aliased if above the number of time values):
+    std::vector<double> re((long long int)numtimevals*numvals, 0.0), im((long long int)numtimevals*numvals, 0.0);
     for (int harm = 1; harm < input.size(); harm++)
     {
         if (input[harm].size() != 0)
         {
             // The current harmonic has a frequency currentfreq*f0.
-            int currentfreq = harmonic::getfrequency(harm);
-        
-            // Evaluate the current sin or cos term for every time step:
+            int currentfreq = harmonic::getfrequency(harm) % numtimevals;
+            
+            double* harmvals = input[harm][0].getvalues();
             if (harmonic::iscosine(harm))
             {
-                for (int i = 0; i < numtimevals; i++)
-                    valvec[i] = std::cos(currentfreq*phasestep*i);
+                double* spectrum = re.data() + (long long int)currentfreq*numvals;
+                for (int j = 0; j < numvals; j++)
+                    spectrum[j] += harmvals[j];
             }
             else
             {
-                for (int i = 0; i < numtimevals; i++)
-                    valvec[i] = std::sin(currentfreq*phasestep*i);
-            }            
-            output.add( sincoseval.multiply( input[harm][0].getflattened() ) );
+                double* spectrum = im.data() + (long long int)currentfreq*numvals;
+                for (int j = 0; j < numvals; j++)
+                    spectrum[j] += harmvals[j];
+            }
         }
     }
+    
+    // The time values are the real part of the forward transform of the conjugate spectrum:
+    complexfft(numtimevals, numvals, re, im);
+    
+    densemat output(numtimevals, numvals);
+    double* outvals = output.getvalues();
+    for (long long int i = 0; i < re.size(); i++)
+        outvals[i] = re[i];
+    
     return output;
 }
 
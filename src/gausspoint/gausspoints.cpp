@@ -1,49 +1,50 @@
 #include "gausspoints.h"
 
 
-gausspoints::gausspoints(int elementtypenumber, int integrationorder)
+std::mutex gausspoints::mymutex;
+std::map<std::tuple<int, int, std::string>, std::pair<std::shared_ptr<std::vector<double>>, std::shared_ptr<std::vector<double>>>> gausspoints::myrules = {};
+
+void gausspoints::set(int elementtypenumber, int integrationorder, std::string rulefamily, std::vector<double>& coordinates, std::vector<double>& weights)
 {
-    myelementtypenumber = elementtypenumber;
-    
-    if (integrationorder < 0)
+    if (rulefamily == "collapsed")
     {
-        std::cout << "Error in 'gausspoints' object: cannot get the Gauss points for negative integration order " << integrationorder << std::endl;
-        abort();
+        gpcollapsed::set(elementtypenumber, integrationorder, coordinates, weights);
+        return;
     }
     
     switch (elementtypenumber)
     {
         // Point element:
         case 0:
-            gppoint::set(integrationorder, mycoordinates, myweights);
+            gppoint::set(integrationorder, coordinates, weights);
             break;
         // Line element:
         case 1:
-            gpline::set(integrationorder, mycoordinates, myweights);
+            gpline::set(integrationorder, coordinates, weights);
             break; 
         // Triangle element:
         case 2:
-            gptriangle::set(integrationorder, mycoordinates, myweights);
+            gptriangle::set(integrationorder, coordinates, weights);
             break; 
         // Quadrangle element:
         case 3:
-            gpquadrangle::set(integrationorder, mycoordinates, myweights);
+            gpquadrangle::set(integrationorder, coordinates, weights);
             break; 
         // Tetrahedron element:
         case 4:
-            gptetrahedron::set(integrationorder, mycoordinates, myweights);
+            gptetrahedron::set(integrationorder, coordinates, weights);
             break; 
         // Hexahedron element:
         case 5:
-            gphexahedron::set(integrationorder, mycoordinates, myweights);
+            gphexahedron::set(integrationorder, coordinates, weights);
             break; 
         // Prism element:
         case 6:
-            gpprism::set(integrationorder, mycoordinates, myweights);
+            gpprism::set(integrationorder, coordinates, weights);
             break; 
         // Pyramid element:
         case 7:
-            gppyramid::set(integrationorder, mycoordinates, myweights);
+            gppyramid::set(integrationorder, coordinates, weights);
             break; 
         default:
             std::cout << "Error in 'gausspoints' object: unknown element type number " << elementtypenumber << std::endl;
@@ -51,6 +52,77 @@ gausspoints::gausspoints(int elementtypenumber, int integrationorder)
     }
 }
 
+gausspoints::gausspoints(int elementtypenumber, int integrationorder) : gausspoints(elementtypenumber, integrationorder, "default") {}
+
+gausspoints::gausspoints(int elementtypenumber, int integrationorder, std::string rulefamily)
+{
+    myelementtypenumber = elementtypenumber;
+    
+    if (integrationorder < 0)
+    {
+        std::cout << "Error in 'gausspoints' object: cannot get the Gauss points for negative integration order " << integrationorder << std::endl;
+        abort();
+    }
+    if (rulefamily != "default" && rulefamily != "collapsed")
+    {
+        std::cout << "Error in 'gausspoints' object: unknown rule family '" << rulefamily << "' (use 'default' or 'collapsed')" << std::endl;
+        abort();
+    }
+    
+    std::tuple<int, int, std::string> key = std::make_tuple(elementtypenumber, integrationorder, rulefamily);
+    
+    mymutex.lock();
+    auto it = myrules.find(key);
+    bool isfound = (it != myrules.end());
+    if (isfound)
+    {
+        mycoordinates = it->second.first;
+        myweights = it->second.second;
+    }
+    mymutex.unlock();
+    
+    if (isfound)
+        return;
+    
+    // Built unlocked since some rules are built from other rules:
+    std::shared_ptr<std::vector<double>> coords(new std::vector<double>), weights(new std::vector<double>);
+    set(elementtypenumber, integrationorder, rulefamily, *coords, *weights);
+    
+    mymutex.lock();
+    // Keep the rule of another thread (if any):
+    it = myrules.insert(std::make_pair(key, std::make_pair(coords, weights))).first;
+    mycoordinates = it->second.first;
+    myweights = it->second.second;
+    mymutex.unlock();
+}
+
+int gausspoints::count(int elementtypenumber, int integrationorder, std::string rulefamily)
+{
+    if (rulefamily == "collapsed")
+        return gpcollapsed::count(elementtypenumber, integrationorder);
+    
+    switch (elementtypenumber)
+    {
+        case 0:
+            return gppoint::count(integrationorder);
+        case 1:
+            return gpline::count(integrationorder);
+        case 2:
+            return gptriangle::count(integrationorder);
+        case 3:
+            return gpquadrangle::count(integrationorder);
+        case 4:
+            return gptetrahedron::count(integrationorder);
+        case 5:
+            return gphexahedron::count(integrationorder);
+        case 6:
+            return gpprism::count(integrationorder);
+        case 7:
+            return gppyramid::count(integrationorder);
+    }
+    return -1;
+}
+
 gausspoints::gausspoints(int elementtypenumber, std::vector<double>& gpcoords)
 {
     double roundoffnoise = 1e-12;
@@ -68,7 +140,7 @@ gausspoints::gausspoints(int elementtypenumber, std::vector<double>& gpcoords)
             abort();
         }
     
-        gppoint::set(0, mycoordinates, myweights);
+        *this = gausspoints(0, 0);
         return;
     }
     
@@ -77,6 +149,7 @@ gausspoints::gausspoints(int elementtypenumber, std::vector<double>& gpcoords)
     while (true)
     {
         int numgps;
+        std::vector<double> coordinates, weights;
         
         switch (elementtypenumber)
         {
@@ -84,43 +157,43 @@ gausspoints::gausspoints(int elementtypenumber, std::vector<double>& gpcoords)
             case 1:
                 numgps = gpline::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gpline::set(integrationorder, mycoordinates, myweights);
+                    gpline::set(integrationorder, coordinates, weights);
                 break; 
             // Triangle element:
             case 2:
                 numgps = gptriangle::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gptriangle::set(integrationorder, mycoordinates, myweights);
+                    gptriangle::set(integrationorder, coordinates, weights);
                 break; 
             // Quadrangle element:
             case 3:
                 numgps = gpquadrangle::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gpquadrangle::set(integrationorder, mycoordinates, myweights);
+                    gpquadrangle::set(integrationorder, coordinates, weights);
                 break; 
             // Tetrahedron element:
             case 4:
                 numgps = gptetrahedron::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gptetrahedron::set(integrationorder, mycoordinates, myweights);
+                    gptetrahedron::set(integrationorder, coordinates, weights);
                 break; 
             // Hexahedron element:
             case 5:
                 numgps = gphexahedron::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gphexahedron::set(integrationorder, mycoordinates, myweights);
+                    gphexahedron::set(integrationorder, coordinates, weights);
                 break; 
             // Prism element:
             case 6:
                 numgps = gpprism::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gpprism::set(integrationorder, mycoordinates, myweights);
+                    gpprism::set(integrationorder, coordinates, weights);
                 break; 
             // Pyramid element:
             case 7:
                 numgps = gppyramid::count(integrationorder);
                 if (3*numgps == gpcoords.size())
-                    gppyramid::set(integrationorder, mycoordinates, myweights);
+                    gppyramid::set(integrationorder, coordinates, weights);
                 break; 
             default:
                 std::cout << "Error in 'gausspoints' object: unknown element type number " << elementtypenumber << std::endl;
@@ -142,7 +215,7 @@ gausspoints::gausspoints(int elementtypenumber, std::vector<double>& gpcoords)
             bool iscloseenough = true;
             for (int i = 0; i < gpcoords.size(); i++)
             {
-                if (std::abs(gpcoords[i] - mycoordinates[i]) > roundoffnoise)
+                if (std::abs(gpcoords[i] - coordinates[i]) > roundoffnoise)
                 {
                     iscloseenough = false;
                     break;
@@ -155,6 +228,8 @@ gausspoints::gausspoints(int elementtypenumber, std::vector<double>& gpcoords)
         
         integrationorder++;
     }
+    
+    *this = gausspoints(elementtypenumber, integrationorder);
 }
 
 void gausspoints::print(void)
@@ -163,7 +238,7 @@ void gausspoints::print(void)
     int oldprecision = std::cout.precision();
     std::cout.precision(17);
     for (int i = 0; i < count(); i++)
-        std::cout << std::setw(26) << std::left << mycoordinates[3*i+0] << std::setw(26) << std::left << mycoordinates[3*i+1] << std::setw(26) << std::left << mycoordinates[3*i+2] << std::setw(26) << std::left << myweights[i] << std::endl;
+        std::cout << std::setw(26) << std::left << (*mycoordinates)[3*i+0] << std::setw(26) << std::left << (*mycoordinates)[3*i+1] << std::setw(26) << std::left << (*mycoordinates)[3*i+2] << std::setw(26) << std::left << (*myweights)[i] << std::endl;
     std::cout << std::endl;
     
     std::cout.precision(oldprecision);
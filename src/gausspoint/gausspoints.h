@@ -10,6 +10,11 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <string>
+#include <map>
+#include <tuple>
+#include <memory>
+#include <mutex>
 
 #include "gppoint.h"
 #include "gpline.h"
@@ -19,6 +24,7 @@
 #include "gphexahedron.h"
 #include "gpprism.h"
 #include "gppyramid.h"
+#include "gpcollapsed.h"
 
 
 class gausspoints
@@ -27,22 +33,38 @@ class gausspoints
         
         int myelementtypenumber;
         
-        std::vector<double> mycoordinates;
-        std::vector<double> myweights;
+        // Shared with the rule cache below:
+        std::shared_ptr<std::vector<double>> mycoordinates = NULL;
+        std::shared_ptr<std::vector<double>> myweights = NULL;
+        
+        // The rules are built once per element type, integration order and rule family:
+        static std::mutex mymutex;
+        static std::map<std::tuple<int, int, std::string>, std::pair<std::shared_ptr<std::vector<double>>, std::shared_ptr<std::vector<double>>>> myrules;
+        
+        // Build the rule (without the cache):
+        static void set(int elementtypenumber, int integrationorder, std::string rulefamily, std::vector<double>& coordinates, std::vector<double>& weights);
         
     public:
         
         gausspoints(int elementtypenumber, int integrationorder);
+        // Select the rule family: "default" (tabulated rules) or "collapsed" (Gauss-Jacobi
+        // tensor rules of arbitrary order on the collapsed element, see 'gpcollapsed'):
+        gausspoints(int elementtypenumber, int integrationorder, std::string rulefamily);
         // Find based on the element type and the gauss points coordinates:
         gausspoints(int elementtypenumber, std::vector<double>& gpcoords);
         
         // 'getcoordinates' returns a vector containing the reference 
         // element coordinates of the Gauss points in the format 
-        // [kigp1 etagp1 phigp1 kigp2 ...].
-        std::vector<double> getcoordinates(void) { return mycoordinates; };
-        std::vector<double> getweights(void) { return myweights; };
+        // [kigp1 etagp1 phigp1 kigp2 ...]. The vectors are not copied
+        // and cannot get out of scope. They are shared by all objects
+        // with the same rule and must not be modified.
+        std::vector<double>& getcoordinates(void) { return *mycoordinates; };
+        std::vector<double>& getweights(void) { return *myweights; };
+        
+        int count(void) { return myweights->size(); };
         
-        int count(void) { return myweights.size(); };
+        // Number of points of a rule family for the requested order (-1 if not defined):
+        static int count(int elementtypenumber, int integrationorder, std::string rulefamily);
         
         void print(void);
 };
@@ -0,0 +1,178 @@
+#include "gpcollapsed.h"
+
+
+void gpcollapsed::getjacobirule(int numpoints, int alpha, std::vector<double>& points, std::vector<double>& weights)
+{
+    double a = alpha, pi = 3.141592653589793;
+    int n = numpoints;
+    
+    points.resize(n);
+    weights.resize(n);
+    
+    // Value and derivative of the Jacobi polynomial P_n^(a,0) at x:
+    auto jacobi = [&](double x, double& val, double& der)
+    {
+        double pm1 = 1, p = 0.5*((a+2)*x + a), dpm1 = 0, dp = 0.5*(a+2);
+        if (n == 0)
+        {
+            val = 1; der = 0;
+            return;
+        }
+        for (int k = 1; k < n; k++)
+        {
+            double a1 = 2*(k+1)*(k+a+1)*(2*k+a);
+            double a2 = (2*k+a+1)*a*a;
+            double a3 = (2*k+a)*(2*k+a+1)*(2*k+a+2);
+            double a4 = 2*(k+a)*k*(2*k+a+2);
+            double pp1 = ((a2 + a3*x)*p - a4*pm1)/a1;
+            double dpp1 = ((a2 + a3*x)*dp + a3*p - a4*dpm1)/a1;
+            pm1 = p; p = pp1;
+            dpm1 = dp; dp = dpp1;
+        }
+        val = p; der = dp;
+    };
+    
+    // Newton iterations with deflation of the roots already found (Chebyshev initial guesses):
+    std::vector<double> x(n);
+    for (int k = 0; k < n; k++)
+    {
+        double r = -std::cos((2.0*k+1)*pi/(2.0*n));
+        if (k > 0)
+            r = 0.5*(r + x[k-1]);
+        for (int it = 0; it < 100; it++)
+        {
+            double val, der;
+            jacobi(r, val, der);
+            double deflation = 0;
+            for (int i = 0; i < k; i++)
+                deflation += 1.0/(r - x[i]);
+            double delta = -val/(der - deflation*val);
+            r += delta;
+            if (std::abs(delta) < 1e-15)
+                break;
+        }
+        x[k] = r;
+    }
+    
+    // The Gauss-Jacobi weights for (1-x)^a on [-1,1] are 2^(a+1)/((1-x^2)*P_n'(x)^2).
+    // They are divided by 2^(a+1) when mapped to (1-u)^a on [0,1]:
+    for (int k = 0; k < n; k++)
+    {
+        double val, der;
+        jacobi(x[k], val, der);
+        
+        points[k] = 0.5*(x[k]+1);
+        weights[k] = 1.0 / ((1-x[k]*x[k])*der*der);
+    }
+}
+
+int gpcollapsed::count(int elementtypenumber, int integrationorder)
+{
+    if (integrationorder < 0)
+        return -1;
+    
+    // Exact up to order 2*n-1 in every direction:
+    int n = integrationorder/2 + 1;
+    
+    switch (elementtypenumber)
+    {
+        case 0:
+            return 1;
+        case 1:
+            return n;
+        case 2:
+        case 3:
+            return n*n;
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+            return n*n*n;
+    }
+    return -1;
+}
+
+void gpcollapsed::set(int elementtypenumber, int integrationorder, std::vector<double>& coordinates, std::vector<double>& weights)
+{
+    if (integrationorder < 0)
+    {
+        std::cout << "Error in 'gpcollapsed' namespace: cannot get the integration points for negative integration order " << integrationorder << std::endl;
+        abort();
+    }
+    
+    int n = integrationorder/2 + 1;
+    
+    if (elementtypenumber == 0)
+    {
+        coordinates = {0,0,0};
+        weights = {1.0};
+        return;
+    }
+    
+    // Rules on [0,1] for the weights 1, (1-u) and (1-u)^2:
+    std::vector<std::vector<double>> pts(3), wghts(3);
+    for (int a = 0; a < 3; a++)
+        getjacobirule(n, a, pts[a], wghts[a]);
+    
+    int numgps = count(elementtypenumber, integrationorder);
+    coordinates = std::vector<double>(3*numgps, 0);
+    weights = std::vector<double>(numgps, 0);
+    
+    int gp = 0;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            for (int k = 0; k < n; k++)
+            {
+                double ki = 0, eta = 0, phi = 0, w = 0;
+                switch (elementtypenumber)
+                {
+                    // Line:
+                    case 1:
+                        ki = 2*pts[0][i]-1; w = 2*wghts[0][i];
+                        break;
+                    // Triangle:
+                    case 2:
+                        ki = pts[1][i]; eta = pts[0][j]*(1-pts[1][i]); w = wghts[1][i]*wghts[0][j];
+                        break;
+                    // Quadrangle:
+                    case 3:
+                        ki = 2*pts[0][i]-1; eta = 2*pts[0][j]-1; w = 4*wghts[0][i]*wghts[0][j];
+                        break;
+                    // Tetrahedron:
+                    case 4:
+                        ki = pts[2][i]; eta = pts[1][j]*(1-ki); phi = pts[0][k]*(1-ki)*(1-pts[1][j]); w = wghts[2][i]*wghts[1][j]*wghts[0][k];
+                        break;
+                    // Hexahedron:
+                    case 5:
+                        ki = 2*pts[0][i]-1; eta = 2*pts[0][j]-1; phi = 2*pts[0][k]-1; w = 8*wghts[0][i]*wghts[0][j]*wghts[0][k];
+                        break;
+                    // Prism:
+                    case 6:
+                        ki = pts[1][i]; eta = pts[0][j]*(1-pts[1][i]); phi = 2*pts[0][k]-1; w = 2*wghts[1][i]*wghts[0][j]*wghts[0][k];
+                        break;
+                    // Pyramid:
+                    case 7:
+                        phi = pts[2][k]; ki = (2*pts[0][i]-1)*(1-phi); eta = (2*pts[0][j]-1)*(1-phi); w = 4*wghts[0][i]*wghts[0][j]*wghts[2][k];
+                        break;
+                    default:
+                        std::cout << "Error in 'gpcollapsed' namespace: unknown element type number " << elementtypenumber << std::endl;
+                        abort();
+                }
+                
+                coordinates[3*gp+0] = ki;
+                coordinates[3*gp+1] = eta;
+                coordinates[3*gp+2] = phi;
+                weights[gp] = w;
+                gp++;
+                
+                // Fewer loops for lower dimensions:
+                if (elementtypenumber == 1 || elementtypenumber == 2 || elementtypenumber == 3)
+                    break;
+            }
+            if (elementtypenumber == 1)
+                break;
+        }
+    }
+}
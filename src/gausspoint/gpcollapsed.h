@@ -0,0 +1,28 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// Integration rules of arbitrary order obtained as tensor products of Gauss-Jacobi rules.
+// Triangles, tetrahedra, prisms and pyramids are integrated on the collapsed (Duffy mapped)
+// hypercube where the Jacobian of the collapse is absorbed in the Jacobi weight. Lines,
+// quadrangles and hexahedra use Gauss-Legendre tensor rules.
+
+#ifndef GPCOLLAPSED_H
+#define GPCOLLAPSED_H
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+namespace gpcollapsed
+{
+    // Gauss-Jacobi rule with 'numpoints' points on [0,1] for the weight (1-u)^alpha:
+    void getjacobirule(int numpoints, int alpha, std::vector<double>& points, std::vector<double>& weights);
+
+    int count(int elementtypenumber, int integrationorder); // -1 if not defined
+    void set(int elementtypenumber, int integrationorder, std::vector<double>& coordinates, std::vector<double>& weights);
+};
+
+#endif
@@ -1,5 +1,812 @@
 #include "gpline.h"
 
+
+// Tabulated rules with one line per point (ki eta phi coordinates):
+
+static constexpr double gpcoordinates0[] =
+{
+    0,0,0
+};
+static constexpr double gpweights0[] =
+{
+    2.0
+};
+
+static constexpr double gpcoordinates2[] =
+{
+    -0.57735026918962576450914878050196,0,0,
+    0.57735026918962576450914878050196,0,0
+};
+static constexpr double gpweights2[] =
+{
+    1.0,1.0
+};
+
+static constexpr double gpcoordinates3[] =
+{
+    -0.77459666924148337703585307995648,0,0,
+    0,0,0,
+    0.77459666924148337703585307995648,0,0
+};
+static constexpr double gpweights3[] =
+{
+    0.55555555555555555555555555555556,0.88888888888888888888888888888889,0.55555555555555555555555555555556
+};
+
+static constexpr double gpcoordinates4[] =
+{
+    -0.86113631159405257522394648889281,0,0,
+    -0.33998104358485626480266575910324,0,0,
+    0.33998104358485626480266575910324,0,0,
+    0.86113631159405257522394648889281,0,0
+};
+static constexpr double gpweights4[] =
+{
+    0.347854845137453857373063949222,0.652145154862546142626936050778,0.652145154862546142626936050778,0.347854845137453857373063949222
+};
+
+static constexpr double gpcoordinates5[] =
+{
+    -0.90617984593866399279762687829939,0,0,
+    -0.53846931010568309103631442070021,0,0,
+    0,0,0,
+    0.53846931010568309103631442070021,0,0,
+    0.90617984593866399279762687829939,0,0
+};
+static constexpr double gpweights5[] =
+{
+    0.23692688505618908751426404071992,0.47862867049936646804129151483564,0.56888888888888888888888888888889,0.47862867049936646804129151483564,
+    0.23692688505618908751426404071992
+};
+
+static constexpr double gpcoordinates6[] =
+{
+    -0.93246951420315202781230155449399,0,0,
+    -0.66120938646626451366139959501991,0,0,
+    -0.23861918608319690863050172168071,0,0,
+    0.23861918608319690863050172168071,0,0,
+    0.66120938646626451366139959501991,0,0,
+    0.93246951420315202781230155449399,0,0
+};
+static constexpr double gpweights6[] =
+{
+    0.17132449237917034504029614217273,0.36076157304813860756983351383772,0.46791393457269104738987034398955,0.46791393457269104738987034398955,
+    0.36076157304813860756983351383772,0.17132449237917034504029614217273
+};
+
+static constexpr double gpcoordinates7[] =
+{
+    -0.94910791234275852452618968404785,0,0,
+    -0.74153118559939443986386477328079,0,0,
+    -0.40584515137739716690660641207696,0,0,
+    0,0,0,
+    0.40584515137739716690660641207696,0,0,
+    0.74153118559939443986386477328079,0,0,
+    0.94910791234275852452618968404785,0,0
+};
+static constexpr double gpweights7[] =
+{
+    0.12948496616886969327061143267908,0.27970539148927666790146777142378,0.38183005050511894495036977548898,0.41795918367346938775510204081633,
+    0.38183005050511894495036977548898,0.27970539148927666790146777142378,0.12948496616886969327061143267908
+};
+
+static constexpr double gpcoordinates8[] =
+{
+    -0.96028985649753623168356086856947,0,0,
+    -0.79666647741362673959155393647583,0,0,
+    -0.52553240991632898581773904918925,0,0,
+    -0.18343464249564980493947614236018,0,0,
+    0.18343464249564980493947614236018,0,0,
+    0.52553240991632898581773904918925,0,0,
+    0.79666647741362673959155393647583,0,0,
+    0.96028985649753623168356086856947,0,0
+};
+static constexpr double gpweights8[] =
+{
+    0.10122853629037625915253135430996,0.22238103445337447054435599442624,0.3137066458778872873379622019866,0.3626837833783619829651504492772,
+    0.3626837833783619829651504492772,0.3137066458778872873379622019866,0.22238103445337447054435599442624,0.10122853629037625915253135430996
+};
+
+static constexpr double gpcoordinates9[] =
+{
+    -0.96816023950762608983557620290367,0,0,
+    -0.83603110732663579429942978806973,0,0,
+    -0.61337143270059039730870203934147,0,0,
+    -0.32425342340380892903853801464334,0,0,
+    0,0,0,
+    0.32425342340380892903853801464334,0,0,
+    0.61337143270059039730870203934147,0,0,
+    0.83603110732663579429942978806973,0,0,
+    0.96816023950762608983557620290367,0,0
+};
+static constexpr double gpweights9[] =
+{
+    0.081274388361574411971892158110524,0.18064816069485740405847203124291,0.26061069640293546231874286941863,0.31234707704000284006863040658444,
+    0.33023935500125976316452506928697,0.31234707704000284006863040658444,0.26061069640293546231874286941863,0.18064816069485740405847203124291,
+    0.081274388361574411971892158110524
+};
+
+static constexpr double gpcoordinates10[] =
+{
+    -0.97390652851717172007796401208445,0,0,
+    -0.86506336668898451073209668842349,0,0,
+    -0.67940956829902440623432736511487,0,0,
+    -0.43339539412924719079926594316578,0,0,
+    -0.14887433898163121088482600112972,0,0,
+    0.14887433898163121088482600112972,0,0,
+    0.43339539412924719079926594316578,0,0,
+    0.67940956829902440623432736511487,0,0,
+    0.86506336668898451073209668842349,0,0,
+    0.97390652851717172007796401208445,0,0
+};
+static constexpr double gpweights10[] =
+{
+    0.066671344308688137593568809893332,0.1494513491505805931457763396577,0.21908636251598204399553493422816,0.26926671930999635509122692156947,
+    0.29552422471475287017389299465134,0.29552422471475287017389299465134,0.26926671930999635509122692156947,0.21908636251598204399553493422816,
+    0.1494513491505805931457763396577,0.066671344308688137593568809893332
+};
+
+static constexpr double gpcoordinates11[] =
+{
+    -0.97822865814605699280393800112286,0,0,
+    -0.88706259976809529907515776930393,0,0,
+    -0.73015200557404932409341625203115,0,0,
+    -0.51909612920681181592572566945861,0,0,
+    -0.26954315595234497233153198540086,0,0,
+    0,0,0,
+    0.26954315595234497233153198540086,0,0,
+    0.51909612920681181592572566945861,0,0,
+    0.73015200557404932409341625203115,0,0,
+    0.88706259976809529907515776930393,0,0,
+    0.97822865814605699280393800112286,0,0
+};
+static constexpr double gpweights11[] =
+{
+    0.055668567116173666482753720442549,0.12558036946490462463469429922394,0.18629021092773425142609764143166,0.23319376459199047991852370484318,
+    0.26280454451024666218068886989051,0.27292508677790063071448352833634,0.26280454451024666218068886989051,0.23319376459199047991852370484318,
+    0.18629021092773425142609764143166,0.12558036946490462463469429922394,0.055668567116173666482753720442549
+};
+
+static constexpr double gpcoordinates12[] =
+{
+    -0.98156063424671925069054909014928,0,0,
+    -0.9041172563704748566784658661191,0,0,
+    -0.76990267419430468703689383321282,0,0,
+    -0.58731795428661744729670241894053,0,0,
+    -0.36783149899818019375269153664372,0,0,
+    -0.12523340851146891547244136946385,0,0,
+    0.12523340851146891547244136946385,0,0,
+    0.36783149899818019375269153664372,0,0,
+    0.58731795428661744729670241894053,0,0,
+    0.76990267419430468703689383321282,0,0,
+    0.9041172563704748566784658661191,0,0,
+    0.98156063424671925069054909014928,0,0
+};
+static constexpr double gpweights12[] =
+{
+    0.047175336386511827194615961485017,0.106939325995318430960254718194,0.16007832854334622633465252954336,0.2031674267230659217490644558098,
+    0.23349253653835480876084989892488,0.24914704581340278500056243604295,0.24914704581340278500056243604295,0.23349253653835480876084989892488,
+    0.2031674267230659217490644558098,0.16007832854334622633465252954336,0.106939325995318430960254718194,0.047175336386511827194615961485017
+};
+
+static constexpr double gpcoordinates13[] =
+{
+    -0.98418305471858814947282944880711,0,0,
+    -0.91759839922297796520654783650072,0,0,
+    -0.80157809073330991279420648958286,0,0,
+    -0.64234933944034022064398460699552,0,0,
+    -0.44849275103644685287791285212764,0,0,
+    -0.23045831595513479406552812109799,0,0,
+    0,0,0,
+    0.23045831595513479406552812109799,0,0,
+    0.44849275103644685287791285212764,0,0,
+    0.64234933944034022064398460699552,0,0,
+    0.80157809073330991279420648958286,0,0,
+    0.91759839922297796520654783650072,0,0,
+    0.98418305471858814947282944880711,0,0
+};
+static constexpr double gpweights13[] =
+{
+    0.040484004765315879520021592200986,0.092121499837728447914421775953797,0.13887351021978723846360177686887,0.1781459807619457382800466919961,
+    0.20781604753688850231252321930605,0.22628318026289723841209018603978,0.23255155323087391019458951526884,0.22628318026289723841209018603978,
+    0.20781604753688850231252321930605,0.1781459807619457382800466919961,0.13887351021978723846360177686887,0.092121499837728447914421775953797,
+    0.040484004765315879520021592200986
+};
+
+static constexpr double gpcoordinates14[] =
+{
+    -0.98628380869681233884159726670405,0,0,
+    -0.92843488366357351733639113937787,0,0,
+    -0.82720131506976499318979474265039,0,0,
+    -0.68729290481168547014801980301933,0,0,
+    -0.51524863635815409196529071855119,0,0,
+    -0.31911236892788976043567182416848,0,0,
+    -0.10805494870734366206624465021983,0,0,
+    0.10805494870734366206624465021983,0,0,
+    0.31911236892788976043567182416848,0,0,
+    0.51524863635815409196529071855119,0,0,
+    0.68729290481168547014801980301933,0,0,
+    0.82720131506976499318979474265039,0,0,
+    0.92843488366357351733639113937787,0,0,
+    0.98628380869681233884159726670405,0,0
+};
+static constexpr double gpweights14[] =
+{
+    0.035119460331751863031832876138192,0.080158087159760209805633277062854,0.12151857068790318468941480907248,0.15720316715819353456960193862384,
+    0.18553839747793781374171659012516,0.20519846372129560396592406566122,0.21526385346315779019587644331626,0.21526385346315779019587644331626,
+    0.20519846372129560396592406566122,0.18553839747793781374171659012516,0.15720316715819353456960193862384,0.12151857068790318468941480907248,
+    0.080158087159760209805633277062854,0.035119460331751863031832876138192
+};
+
+static constexpr double gpcoordinates15[] =
+{
+    -0.98799251802048542848956571858661,0,0,
+    -0.93727339240070590430775894771021,0,0,
+    -0.84820658341042721620064832077422,0,0,
+    -0.72441773136017004741618605461394,0,0,
+    -0.57097217260853884753722673725391,0,0,
+    -0.39415134707756336989720737098105,0,0,
+    -0.2011940939974345223006283033946,0,0,
+    0,0,0,
+    0.2011940939974345223006283033946,0,0,
+    0.39415134707756336989720737098105,0,0,
+    0.57097217260853884753722673725391,0,0,
+    0.72441773136017004741618605461394,0,0,
+    0.84820658341042721620064832077422,0,0,
+    0.93727339240070590430775894771021,0,0,
+    0.98799251802048542848956571858661,0,0
+};
+static constexpr double gpweights15[] =
+{
+    0.030753241996117268354628393577204,0.070366047488108124709267416450667,0.10715922046717193501186954668587,0.13957067792615431444780479451103,
+    0.16626920581699393355320086048121,0.18616100001556221102680056186642,0.19843148532711157645611832644384,0.20257824192556127288062019996752,
+    0.19843148532711157645611832644384,0.18616100001556221102680056186642,0.16626920581699393355320086048121,0.13957067792615431444780479451103,
+    0.10715922046717193501186954668587,0.070366047488108124709267416450667,0.030753241996117268354628393577204
+};
+
+static constexpr double gpcoordinates16[] =
+{
+    -0.98940093499164993259615417345033,0,0,
+    -0.94457502307323257607798841553461,0,0,
+    -0.86563120238783174388046789771239,0,0,
+    -0.75540440835500303389510119484744,0,0,
+    -0.61787624440264374844667176404879,0,0,
+    -0.45801677765722738634241944298358,0,0,
+    -0.2816035507792589132304605014605,0,0,
+    -0.095012509837637440185319335424958,0,0,
+    0.095012509837637440185319335424958,0,0,
+    0.2816035507792589132304605014605,0,0,
+    0.45801677765722738634241944298358,0,0,
+    0.61787624440264374844667176404879,0,0,
+    0.75540440835500303389510119484744,0,0,
+    0.86563120238783174388046789771239,0,0,
+    0.94457502307323257607798841553461,0,0,
+    0.98940093499164993259615417345033,0,0
+};
+static constexpr double gpweights16[] =
+{
+    0.027152459411754094851780572456018,0.062253523938647892862843836994378,0.095158511682492784809925107602246,0.12462897125553387205247628219202,
+    0.14959598881657673208150173054748,0.16915651939500253818931207903036,0.18260341504492358886676366796922,0.18945061045506849628539672320828,
+    0.18945061045506849628539672320828,0.18260341504492358886676366796922,0.16915651939500253818931207903036,0.14959598881657673208150173054748,
+    0.12462897125553387205247628219202,0.095158511682492784809925107602246,0.062253523938647892862843836994378,0.027152459411754094851780572456018
+};
+
+static constexpr double gpcoordinates17[] =
+{
+    -0.99057547531441733567543401994067,0,0,
+    -0.9506755217687677612227169578958,0,0,
+    -0.88023915372698590212295569448816,0,0,
+    -0.78151400389680140692523005552048,0,0,
+    -0.657671159216690765850302216643,0,0,
+    -0.51269053708647696788624656862955,0,0,
+    -0.35123176345387631529718551709535,0,0,
+    -0.17848418149584785585067749365407,0,0,
+    0,0,0,
+    0.17848418149584785585067749365407,0,0,
+    0.35123176345387631529718551709535,0,0,
+    0.51269053708647696788624656862955,0,0,
+    0.657671159216690765850302216643,0,0,
+    0.78151400389680140692523005552048,0,0,
+    0.88023915372698590212295569448816,0,0,
+    0.9506755217687677612227169578958,0,0,
+    0.99057547531441733567543401994067,0,0
+};
+static constexpr double gpweights17[] =
+{
+    0.024148302868547931960110026287565,0.055459529373987201129440165358245,0.085036148317179180883535370191062,0.11188384719340397109478838562636,
+    0.13513636846852547328631998170235,0.15404576107681028808143159480196,0.16800410215645004450997066378832,0.1765627053669926463252709901132,
+    0.17944647035620652545826564426189,0.1765627053669926463252709901132,0.16800410215645004450997066378832,0.15404576107681028808143159480196,
+    0.13513636846852547328631998170235,0.11188384719340397109478838562636,0.085036148317179180883535370191062,0.055459529373987201129440165358245,
+    0.024148302868547931960110026287565
+};
+
+static constexpr double gpcoordinates18[] =
+{
+    -0.99156516842093094673001600470615,0,0,
+    -0.95582394957139775518119589292978,0,0,
+    -0.89260246649755573920606059112715,0,0,
+    -0.80370495897252311568241745501459,0,0,
+    -0.69168704306035320787489108128885,0,0,
+    -0.55977083107394753460787154852533,0,0,
+    -0.41175116146284264603593179383305,0,0,
+    -0.25188622569150550958897285487791,0,0,
+    -0.084775013041735301242261852935784,0,0,
+    0.084775013041735301242261852935784,0,0,
+    0.25188622569150550958897285487791,0,0,
+    0.41175116146284264603593179383305,0,0,
+    0.55977083107394753460787154852533,0,0,
+    0.69168704306035320787489108128885,0,0,
+    0.80370495897252311568241745501459,0,0,
+    0.89260246649755573920606059112715,0,0,
+    0.95582394957139775518119589292978,0,0,
+    0.99156516842093094673001600470615,0,0
+};
+static constexpr double gpweights18[] =
+{
+    0.021616013526483310313342710266452,0.049714548894969796453334946202639,0.076425730254889056529129677616637,0.10094204410628716556281398492483,
+    0.1225552067114784601845191268002,0.14064291467065065120473130375195,0.15468467512626524492541800383637,0.16427648374583272298605377646593,
+    0.16914238296314359184065647013499,0.16914238296314359184065647013499,0.16427648374583272298605377646593,0.15468467512626524492541800383637,
+    0.14064291467065065120473130375195,0.1225552067114784601845191268002,0.10094204410628716556281398492483,0.076425730254889056529129677616637,
+    0.049714548894969796453334946202639,0.021616013526483310313342710266452
+};
+
+static constexpr double gpcoordinates19[] =
+{
+    -0.99240684384358440318901767025326,0,0,
+    -0.96020815213483003085277884068765,0,0,
+    -0.90315590361481790164266092853231,0,0,
+    -0.82271465653714282497892248671271,0,0,
+    -0.72096617733522937861709586082378,0,0,
+    -0.60054530466168102346963816494624,0,0,
+    -0.4645707413759609457172671481041,0,0,
+    -0.31656409996362983199011732884984,0,0,
+    -0.16035864564022537586809611574074,0,0,
+    0,0,0,
+    0.16035864564022537586809611574074,0,0,
+    0.31656409996362983199011732884984,0,0,
+    0.4645707413759609457172671481041,0,0,
+    0.60054530466168102346963816494624,0,0,
+    0.72096617733522937861709586082378,0,0,
+    0.82271465653714282497892248671271,0,0,
+    0.90315590361481790164266092853231,0,0,
+    0.96020815213483003085277884068765,0,0,
+    0.99240684384358440318901767025326,0,0
+};
+static constexpr double gpweights19[] =
+{
+    0.019461788229726477036312041464438,0.044814226765699600332838157401994,0.069044542737641226580708258006013,0.09149002162244999946446209412384,
+    0.11156664554733399471602390168177,0.12875396253933622767551578485688,0.1426067021736066117757461094419,0.15276604206585966677885540089766,
+    0.15896884339395434764995643946505,0.16105444984878369597916362532092,0.15896884339395434764995643946505,0.15276604206585966677885540089766,
+    0.1426067021736066117757461094419,0.12875396253933622767551578485688,0.11156664554733399471602390168177,0.09149002162244999946446209412384,
+    0.069044542737641226580708258006013,0.044814226765699600332838157401994,0.019461788229726477036312041464438
+};
+
+static constexpr double gpcoordinates20[] =
+{
+    -0.99312859918509492478612238847132,0,0,
+    -0.96397192727791379126766613119728,0,0,
+    -0.9122344282513259058677524412033,0,0,
+    -0.83911697182221882339452906170152,0,0,
+    -0.74633190646015079261430507035564,0,0,
+    -0.63605368072651502545283669622629,0,0,
+    -0.51086700195082709800436405095525,0,0,
+    -0.37370608871541956067254817702493,0,0,
+    -0.22778585114164507808049619536857,0,0,
+    -0.076526521133497333754640409398838,0,0,
+    0.076526521133497333754640409398838,0,0,
+    0.22778585114164507808049619536857,0,0,
+    0.37370608871541956067254817702493,0,0,
+    0.51086700195082709800436405095525,0,0,
+    0.63605368072651502545283669622629,0,0,
+    0.74633190646015079261430507035564,0,0,
+    0.83911697182221882339452906170152,0,0,
+    0.9122344282513259058677524412033,0,0,
+    0.96397192727791379126766613119728,0,0,
+    0.99312859918509492478612238847132,0,0
+};
+static constexpr double gpweights20[] =
+{
+    0.017614007139152118311861962351853,0.040601429800386941331039952274932,0.062672048334109063569506535187042,0.083276741576704748724758143222046,
+    0.10193011981724043503675013548035,0.11819453196151841731237737771138,0.13168863844917662689849449974816,0.14209610931838205132929832506716,
+    0.14917298647260374678782873700197,0.1527533871307258506980843319551,0.1527533871307258506980843319551,0.14917298647260374678782873700197,
+    0.14209610931838205132929832506716,0.13168863844917662689849449974816,0.11819453196151841731237737771138,0.10193011981724043503675013548035,
+    0.083276741576704748724758143222046,0.062672048334109063569506535187042,0.040601429800386941331039952274932,0.017614007139152118311861962351853
+};
+
+static constexpr double gpcoordinates21[] =
+{
+    -0.99375217062038950026024203593794,0,0,
+    -0.9672268385663062943166222149077,0,0,
+    -0.92009933415040082879018713371496,0,0,
+    -0.85336336458331728364725063858757,0,0,
+    -0.76843996347567790861587785130622,0,0,
+    -0.66713880419741231930596666999034,0,0,
+    -0.55161883588721980705901879672431,0,0,
+    -0.42434212020743878357366888854379,0,0,
+    -0.2880213168024010966007925160646,0,0,
+    -0.14556185416089509093703098233869,0,0,
+    0,0,0,
+    0.14556185416089509093703098233869,0,0,
+    0.2880213168024010966007925160646,0,0,
+    0.42434212020743878357366888854379,0,0,
+    0.55161883588721980705901879672431,0,0,
+    0.66713880419741231930596666999034,0,0,
+    0.76843996347567790861587785130623,0,0,
+    0.85336336458331728364725063858756,0,0,
+    0.92009933415040082879018713371497,0,0,
+    0.96722683856630629431662221490769,0,0,
+    0.99375217062038950026024203593794,0,0
+};
+static constexpr double gpweights21[] =
+{
+    0.016017228257774333324224616858403,0.036953789770852493799950668299422,0.057134425426857208283635826472357,0.076100113628379302017051653300256,
+    0.093444423456033861553289741113883,0.10879729916714837766347457807013,0.12183141605372853419536717712572,0.13226893863333746178105257449678,
+    0.13988739479107315472213342386758,0.14452440398997005906382716655375,0.14608113364969042719198514768337,0.14452440398997005906382716655375,
+    0.13988739479107315472213342386758,0.13226893863333746178105257449678,0.12183141605372853419536717712574,0.1087972991671483776634745780701,
+    0.09344442345603386155328974111395,0.076100113628379302017051653300153,0.057134425426857208283635826472488,0.036953789770852493799950668299287,
+    0.016017228257774333324224616858503
+};
+
+static constexpr double gpcoordinates22[] =
+{
+    -0.9942945854823992920730314211613,0,0,
+    -0.97006049783542872712395098676527,0,0,
+    -0.92695677218717400052069293925905,0,0,
+    -0.86581257772030013653642563701938,0,0,
+    -0.78781680597920816200427795540835,0,0,
+    -0.69448726318668278005068983576226,0,0,
+    -0.58764040350691159295887692763865,0,0,
+    -0.46935583798675702640633071096641,0,0,
+    -0.34193582089208422515814742042738,0,0,
+    -0.20786042668822128547884653391955,0,0,
+    -0.069739273319722221213841796118628,0,0,
+    0.069739273319722221213841796118628,0,0,
+    0.20786042668822128547884653391955,0,0,
+    0.34193582089208422515814742042738,0,0,
+    0.46935583798675702640633071096641,0,0,
+    0.58764040350691159295887692763865,0,0,
+    0.69448726318668278005068983576226,0,0,
+    0.78781680597920816200427795540835,0,0,
+    0.86581257772030013653642563701938,0,0,
+    0.92695677218717400052069293925905,0,0,
+    0.97006049783542872712395098676527,0,0,
+    0.9942945854823992920730314211613,0,0
+};
+static constexpr double gpweights22[] =
+{
+    0.014627995298272200684991098047185,0.033774901584814154793302246865913,0.052293335152683285940312051273211,0.069796468424520488094961418930218,
+    0.085941606217067727414443681372703,0.10041414444288096493207883783054,0.11293229608053921839340060742178,0.12325237681051242428556098615481,
+    0.13117350478706237073296499253031,0.13654149834601517135257383123152,0.13925187285563199337541024834181,0.13925187285563199337541024834181,
+    0.13654149834601517135257383123152,0.13117350478706237073296499253031,0.12325237681051242428556098615481,0.11293229608053921839340060742178,
+    0.10041414444288096493207883783054,0.085941606217067727414443681372703,0.069796468424520488094961418930218,0.052293335152683285940312051273211,
+    0.033774901584814154793302246865913,0.014627995298272200684991098047185
+};
+
+static constexpr double gpcoordinates23[] =
+{
+    -0.99476933499755212352392571544557,0,0,
+    -0.97254247121811523195602407682078,0,0,
+    -0.93297108682601610234919698903842,0,0,
+    -0.87675235827044166737815688593415,0,0,
+    -0.80488840161883989215111840699678,0,0,
+    -0.71866136313195019446162448374862,0,0,
+    -0.6196098757636461563850973116496,0,0,
+    -0.50950147784600754968979304786685,0,0,
+    -0.39030103803029083142148887288061,0,0,
+    -0.26413568097034493053386953828331,0,0,
+    -0.13325682429846611093174268224177,0,0,
+    0,0,0,
+    0.13325682429846611093174268224177,0,0,
+    0.26413568097034493053386953828331,0,0,
+    0.39030103803029083142148887288061,0,0,
+    0.50950147784600754968979304786685,0,0,
+    0.6196098757636461563850973116496,0,0,
+    0.71866136313195019446162448374862,0,0,
+    0.80488840161883989215111840699678,0,0,
+    0.87675235827044166737815688593415,0,0,
+    0.93297108682601610234919698903842,0,0,
+    0.97254247121811523195602407682078,0,0,
+    0.99476933499755212352392571544557,0,0
+};
+static constexpr double gpweights23[] =
+{
+    0.013411859487141772081309493458615,0.030988005856979444310694219641885,0.048037671731084668571641071632034,0.064232421408525852127169615158911,
+    0.079281411776718954922892524742043,0.092915766060035147477018617369765,0.10489209146454141007408618501474,0.11499664022241136494164351293396,
+    0.12304908430672953046757840067201,0.12890572218808214997859533939979,0.13246203940469661737164246470332,0.13365457218610617535145711054584,
+    0.13246203940469661737164246470332,0.12890572218808214997859533939979,0.12304908430672953046757840067201,0.11499664022241136494164351293396,
+    0.10489209146454141007408618501474,0.092915766060035147477018617369765,0.079281411776718954922892524742043,0.064232421408525852127169615158911,
+    0.048037671731084668571641071632034,0.030988005856979444310694219641885,0.013411859487141772081309493458615
+};
+
+static constexpr double gpcoordinates24[] =
+{
+    -0.99518721999702136017999740970074,0,0,
+    -0.97472855597130949819839199300817,0,0,
+    -0.93827455200273275852364900170872,0,0,
+    -0.8864155270044010342131543419822,0,0,
+    -0.82000198597390292195394987266975,0,0,
+    -0.74012419157855436424382810309998,0,0,
+    -0.64809365193697556925249578691075,0,0,
+    -0.54542147138883953565837561721837,0,0,
+    -0.43379350762604513848708423191335,0,0,
+    -0.31504267969616337438679329131981,0,0,
+    -0.19111886747361630915863982075707,0,0,
+    -0.064056892862605626085043082624745,0,0,
+    0.064056892862605626085043082624745,0,0,
+    0.19111886747361630915863982075707,0,0,
+    0.31504267969616337438679329131981,0,0,
+    0.43379350762604513848708423191335,0,0,
+    0.54542147138883953565837561721837,0,0,
+    0.64809365193697556925249578691075,0,0,
+    0.74012419157855436424382810309998,0,0,
+    0.82000198597390292195394987266975,0,0,
+    0.8864155270044010342131543419822,0,0,
+    0.93827455200273275852364900170872,0,0,
+    0.97472855597130949819839199300817,0,0,
+    0.99518721999702136017999740970074,0,0
+};
+static constexpr double gpweights24[] =
+{
+    0.012341229799987199546805667070037,0.028531388628933663181307815951878,0.044277438817419806168602748211338,0.059298584915436780746367758500109,
+    0.073346481411080305734033615253117,0.086190161531953275917185202983743,0.097618652104113888269880664464247,0.10744427011596563478257734244661,
+    0.11550566805372560135334448390678,0.12167047292780339120446315347626,0.12583745634682829612137538251118,0.1279381953467521569740561652247,
+    0.1279381953467521569740561652247,0.12583745634682829612137538251118,0.12167047292780339120446315347626,0.11550566805372560135334448390678,
+    0.10744427011596563478257734244661,0.097618652104113888269880664464247,0.086190161531953275917185202983743,0.073346481411080305734033615253117,
+    0.059298584915436780746367758500109,0.044277438817419806168602748211338,0.028531388628933663181307815951878,0.012341229799987199546805667070037
+};
+
+static constexpr double gpcoordinates25[] =
+{
+    -0.9955569697904980979087849468939,0,0,
+    -0.97666392145951751149831538647959,0,0,
+    -0.94297457122897433941401116965847,0,0,
+    -0.8949919978782753688510420067828,0,0,
+    -0.83344262876083400142102110869357,0,0,
+    -0.75925926303735763057728286520436,0,0,
+    -0.67356636847346836448512063324762,0,0,
+    -0.57766293024122296772368984161265,0,0,
+    -0.47300273144571496052218211500919,0,0,
+    -0.36117230580938783773582173012764,0,0,
+    -0.24386688372098843204519036279745,0,0,
+    -0.12286469261071039638735981880804,0,0,
+    0,0,0,
+    0.12286469261071039638735981880804,0,0,
+    0.24386688372098843204519036279745,0,0,
+    0.36117230580938783773582173012764,0,0,
+    0.47300273144571496052218211500919,0,0,
+    0.57766293024122296772368984161265,0,0,
+    0.67356636847346836448512063324762,0,0,
+    0.75925926303735763057728286520436,0,0,
+    0.83344262876083400142102110869357,0,0,
+    0.8949919978782753688510420067828,0,0,
+    0.94297457122897433941401116965847,0,0,
+    0.97666392145951751149831538647959,0,0,
+    0.9955569697904980979087849468939,0,0
+};
+static constexpr double gpweights25[] =
+{
+    0.011393798501026287947902964113235,0.026354986615032137261901815295299,0.040939156701306312655623487711646,0.054904695975835191925936891540473,
+    0.068038333812356917207187185656708,0.080140700335001018013234959669111,0.091028261982963649811497220702892,0.10053594906705064420220689039269,
+    0.10851962447426365311609395705012,0.11485825914571164833932554586956,0.1194557635357847722281781265129,0.12224244299031004168895951894585,
+    0.12317605372671545120390287307905,0.12224244299031004168895951894585,0.1194557635357847722281781265129,0.11485825914571164833932554586956,
+    0.10851962447426365311609395705012,0.10053594906705064420220689039269,0.091028261982963649811497220702892,0.080140700335001018013234959669111,
+    0.068038333812356917207187185656708,0.054904695975835191925936891540473,0.040939156701306312655623487711646,0.026354986615032137261901815295299,
+    0.011393798501026287947902964113235
+};
+
+static constexpr double gpcoordinates26[] =
+{
+    -0.99588570114561692900321695932291,0,0,
+    -0.97838544595647099110058035431193,0,0,
+    -0.94715906666171425013591528351804,0,0,
+    -0.90263786198430707421766559923121,0,0,
+    -0.84544594278849801879750706146784,0,0,
+    -0.77638594882067885619296724724228,0,0,
+    -0.69642726041995726486381391372942,0,0,
+    -0.60669229301761806323197874691689,0,0,
+    -0.50844071482450571769570306472557,0,0,
+    -0.40305175512348630648107737709888,0,0,
+    -0.29200483948595689514283538207783,0,0,
+    -0.17685882035689018396905774841834,0,0,
+    -0.059230093429313207093718575198403,0,0,
+    0.059230093429313207093718575198403,0,0,
+    0.17685882035689018396905774841834,0,0,
+    0.29200483948595689514283538207783,0,0,
+    0.40305175512348630648107737709888,0,0,
+    0.50844071482450571769570306472557,0,0,
+    0.60669229301761806323197874691689,0,0,
+    0.69642726041995726486381391372942,0,0,
+    0.77638594882067885619296724724228,0,0,
+    0.84544594278849801879750706146784,0,0,
+    0.90263786198430707421766559923121,0,0,
+    0.94715906666171425013591528351804,0,0,
+    0.97838544595647099110058035431193,0,0,
+    0.99588570114561692900321695932291,0,0
+};
+static constexpr double gpweights26[] =
+{
+    0.010551372617343007155651187685252,0.024417851092631908789615827519788,0.03796238329436276395030314124885,0.050975825297147811998319900724073,
+    0.063274046329574835539453689907045,0.074684149765659745887075796102848,0.085045894313485239210447765079982,0.094213800355914148463664883067303,
+    0.10205916109442542323841407025343,0.108471840528576590656579426728,0.1133618165463196665494407184426,0.11666044348529658204466250754036,
+    0.11832141527926227651637108570047,0.11832141527926227651637108570047,0.11666044348529658204466250754036,0.1133618165463196665494407184426,
+    0.108471840528576590656579426728,0.10205916109442542323841407025343,0.094213800355914148463664883067303,0.085045894313485239210447765079982,
+    0.074684149765659745887075796102848,0.063274046329574835539453689907045,0.050975825297147811998319900724073,0.03796238329436276395030314124885,
+    0.024417851092631908789615827519788,0.010551372617343007155651187685252
+};
+
+static constexpr double gpcoordinates27[] =
+{
+    -0.99617926288898856693888720838123,0,0,
+    -0.97992347596150122285587335566105,0,0,
+    -0.95090055781470500685190803064388,0,0,
+    -0.90948232067749110430064501820969,0,0,
+    -0.85620790801829449030273722270684,0,0,
+    -0.79177163907050822714439734410727,0,0,
+    -0.71701347373942369929481621164234,0,0,
+    -0.63290797194649514092773463763449,0,0,
+    -0.54055156457945689490030094155998,0,0,
+    -0.44114825175002688058597415568928,0,0,
+    -0.33599390363850889973031903420728,0,0,
+    -0.22645936543953685885723910736023,0,0,
+    -0.11397258560952996693289498386998,0,0,
+    0,0,0,
+    0.11397258560952996693289498386998,0,0,
+    0.22645936543953685885723910736023,0,0,
+    0.33599390363850889973031903420728,0,0,
+    0.44114825175002688058597415568928,0,0,
+    0.54055156457945689490030094155998,0,0,
+    0.63290797194649514092773463763449,0,0,
+    0.71701347373942369929481621164234,0,0,
+    0.79177163907050822714439734410727,0,0,
+    0.85620790801829449030273722270684,0,0,
+    0.90948232067749110430064501820969,0,0,
+    0.95090055781470500685190803064388,0,0,
+    0.97992347596150122285587335566105,0,0,
+    0.99617926288898856693888720838123,0,0
+};
+static constexpr double gpweights27[] =
+{
+    0.0097989960512943602611500550912591,0.022686231596180623196034206446761,0.035297053757419711022578289304712,0.047449412520615062704096710114185,
+    0.058983536859833599110300833719532,0.069748823766245592984322888356667,0.079604867773057771263074959009842,0.088423158543756950194322802853749,
+    0.096088727370028507565652646558106,0.10250163781774579867124771153266,0.10757828578853318721216298442666,0.11125248835684519267216309604285,
+    0.1134763461089651486203699480921,0.11422086737895698904504573690184,0.1134763461089651486203699480921,0.11125248835684519267216309604285,
+    0.10757828578853318721216298442666,0.10250163781774579867124771153266,0.096088727370028507565652646558106,0.088423158543756950194322802853749,
+    0.079604867773057771263074959009842,0.069748823766245592984322888356667,0.058983536859833599110300833719532,0.047449412520615062704096710114185,
+    0.035297053757419711022578289304712,0.022686231596180623196034206446761,0.0097989960512943602611500550912591
+};
+
+static constexpr double gpcoordinates28[] =
+{
+    -0.99644249757395444995043639048331,0,0,
+    -0.98130316537087275369455994580783,0,0,
+    -0.95425928062893819725410183970522,0,0,
+    -0.91563302639213207386968942332993,0,0,
+    -0.86589252257439504894225456737969,0,0,
+    -0.80564137091717917144788595542528,0,0,
+    -0.73561087801363177202814451029253,0,0,
+    -0.65665109403886496121989817650674,0,0,
+    -0.56972047181140171930800328335643,0,0,
+    -0.47587422495511826103441184766743,0,0,
+    -0.37625151608907871022135720955609,0,0,
+    -0.27206162763517807767682635612577,0,0,
+    -0.16456928213338077128147177789117,0,0,
+    -0.05507928988403427042651652734188,0,0,
+    0.05507928988403427042651652734188,0,0,
+    0.16456928213338077128147177789117,0,0,
+    0.27206162763517807767682635612577,0,0,
+    0.37625151608907871022135720955609,0,0,
+    0.47587422495511826103441184766743,0,0,
+    0.56972047181140171930800328335643,0,0,
+    0.65665109403886496121989817650674,0,0,
+    0.73561087801363177202814451029253,0,0,
+    0.80564137091717917144788595542528,0,0,
+    0.86589252257439504894225456737969,0,0,
+    0.91563302639213207386968942332993,0,0,
+    0.95425928062893819725410183970522,0,0,
+    0.98130316537087275369455994580783,0,0,
+    0.99644249757395444995043639048331,0,0
+};
+static constexpr double gpweights28[] =
+{
+    0.0091242825930945177388161539229517,0.021132112592771259751500380993265,0.032901427782304379977630819170532,0.044272934759004227839587877653207,
+    0.055107345675716745431482918226946,0.065272923966999595793397566775505,0.074646214234568779023931887173022,0.083113417228901218390396498244332,
+    0.090571744393032840942186031336784,0.096930657997929915850489006095441,0.10211296757806076981421663850571,0.10605576592284641791041643699681,
+    0.10871119225829413525357151930367,0.11004701301647519628237626560182,0.11004701301647519628237626560182,0.10871119225829413525357151930367,
+    0.10605576592284641791041643699681,0.10211296757806076981421663850571,0.096930657997929915850489006095441,0.090571744393032840942186031336784,
+    0.083113417228901218390396498244332,0.074646214234568779023931887173022,0.065272923966999595793397566775505,0.055107345675716745431482918226946,
+    0.044272934759004227839587877653207,0.032901427782304379977630819170532,0.021132112592771259751500380993265,0.0091242825930945177388161539229517
+};
+
+static constexpr double gpcoordinates29[] =
+{
+    -0.99667944226059658616319153254935,0,0,
+    -0.98254550526141317487092601578638,0,0,
+    -0.95728559577808772579820803698082,0,0,
+    -0.92118023295305878509375343608311,0,0,
+    -0.87463780492010279041779342125658,0,0,
+    -0.81818548761525244498957221457878,0,0,
+    -0.75246285173447713391261007721214,0,0,
+    -0.67821453760268651515618500539199,0,0,
+    -0.59628179713822782037958621118899,0,0,
+    -0.50759295512422764210262791962752,0,0,
+    -0.41315288817400866389070658603162,0,0,
+    -0.31403163786763993494819592319105,0,0,
+    -0.21135228616600107450637572890294,0,0,
+    -0.10627823013267923017098239243038,0,0,
+    0,0,0,
+    0.10627823013267923017098239243038,0,0,
+    0.21135228616600107450637572890294,0,0,
+    0.31403163786763993494819592319105,0,0,
+    0.41315288817400866389070658603162,0,0,
+    0.50759295512422764210262791962752,0,0,
+    0.59628179713822782037958621118899,0,0,
+    0.67821453760268651515618500539199,0,0,
+    0.75246285173447713391261007721214,0,0,
+    0.81818548761525244498957221457878,0,0,
+    0.87463780492010279041779342125658,0,0,
+    0.92118023295305878509375343608311,0,0,
+    0.95728559577808772579820803698082,0,0,
+    0.98254550526141317487092601578638,0,0,
+    0.99667944226059658616319153254935,0,0
+};
+static constexpr double gpweights29[] =
+{
+    0.0085169038787464096542638133022498,0.019732085056122705983859801640396,0.030740492202093622644408525374617,0.041402062518682836104830010114077,
+    0.051594826902497923912594381179543,0.061203090657079138542109848023907,0.070117933255051278569581486948879,0.07823832713576378382814488865968,
+    0.085472257366172527545344849297208,0.091737757139258763347966411077111,0.096963834094408606301900074882689,0.1010912737599149661218205469075,
+    0.10407331007772937391332847128512,0.10587615509732094140659132785219,0.10647938171831424424651112690968,0.10587615509732094140659132785219,
+    0.10407331007772937391332847128512,0.1010912737599149661218205469075,0.096963834094408606301900074882689,0.091737757139258763347966411077111,
+    0.085472257366172527545344849297208,0.07823832713576378382814488865968,0.070117933255051278569581486948879,0.061203090657079138542109848023907,
+    0.051594826902497923912594381179543,0.041402062518682836104830010114077,0.030740492202093622644408525374617,0.019732085056122705983859801640396,
+    0.0085169038787464096542638133022498
+};
+
+static constexpr double gpcoordinates30[] =
+{
+    -0.9968934840746495402716300509187,0,0,
+    -0.98366812327974720997003258160566,0,0,
+    -0.9600218649683075122168710255818,0,0,
+    -0.92620004742927432587932427708047,0,0,
+    -0.88256053579205268154311646253023,0,0,
+    -0.8295657623827683974428981197325,0,0,
+    -0.7677774321048261949179773409745,0,0,
+    -0.69785049479331579693229238802664,0,0,
+    -0.62052618298924286114047755643119,0,0,
+    -0.53662414814201989926416979331107,0,0,
+    -0.44703376953808917678060990032285,0,0,
+    -0.35270472553087811347103720708937,0,0,
+    -0.25463692616788984643980512981781,0,0,
+    -0.15386991360858354696379467274326,0,0,
+    -0.051471842555317695833025213166723,0,0,
+    0.051471842555317695833025213166723,0,0,
+    0.15386991360858354696379467274326,0,0,
+    0.25463692616788984643980512981781,0,0,
+    0.35270472553087811347103720708937,0,0,
+    0.44703376953808917678060990032285,0,0,
+    0.53662414814201989926416979331107,0,0,
+    0.62052618298924286114047755643119,0,0,
+    0.69785049479331579693229238802664,0,0,
+    0.7677774321048261949179773409745,0,0,
+    0.8295657623827683974428981197325,0,0,
+    0.88256053579205268154311646253023,0,0,
+    0.92620004742927432587932427708047,0,0,
+    0.9600218649683075122168710255818,0,0,
+    0.98366812327974720997003258160566,0,0,
+    0.9968934840746495402716300509187,0,0
+};
+static constexpr double gpweights30[] =
+{
+    0.0079681924961666056154658834746736,0.018466468311090959142302131912047,0.028784707883323369349719179611292,0.038799192569627049596801936446348,
+    0.048402672830594052902938140422808,0.057493156217619066481721689402056,0.065974229882180495128128515115962,0.073755974737705206268243850022191,
+    0.08075589522942021535469493846053,0.086899787201082979802387530715126,0.092122522237786128717632707087619,0.09636873717464425963946862635181,
+    0.099593420586795267062780282103569,0.10176238974840550459642895216855,0.10285265289355884034128563670542,0.10285265289355884034128563670542,
+    0.10176238974840550459642895216855,0.099593420586795267062780282103569,0.09636873717464425963946862635181,0.092122522237786128717632707087619,
+    0.086899787201082979802387530715126,0.08075589522942021535469493846053,0.073755974737705206268243850022191,0.065974229882180495128128515115962,
+    0.057493156217619066481721689402056,0.048402672830594052902938140422808,0.038799192569627049596801936446348,0.028784707883323369349719179611292,
+    0.018466468311090959142302131912047,0.0079681924961666056154658834746736
+};
+
+
 int gpline::count(int integrationorder)
 {
     if (integrationorder >= 0 && integrationorder < 60)
@@ -18,1184 +825,125 @@ void gpline::set(int integrationorder, std::vector<double>& coordinates, std::ve
         
     switch (numberofgausspoints)
     {
-        case 0:
-
-            // Coordinates:
-            coordinates[0] = 0;
-
-            // Weights:
-            weights[0] = 2.0;
-
+        case 0: case 1:
+            coordinates.assign(gpcoordinates0, gpcoordinates0+3*1);
+            weights.assign(gpweights0, gpweights0+1);
             break;
-            
-        case 1:
-
-            // Coordinates:
-            coordinates[0] = 0;
-
-            // Weights:
-            weights[0] = 2.0;
-
-            break;
-
         case 2:
-
-            // Coordinates:
-            coordinates[0] = -0.57735026918962576450914878050196;
-            coordinates[3] = 0.57735026918962576450914878050196;
-
-            // Weights:
-            weights[0] = 1.0;
-            weights[1] = 1.0;
-
+            coordinates.assign(gpcoordinates2, gpcoordinates2+3*2);
+            weights.assign(gpweights2, gpweights2+2);
             break;
-
         case 3:
-
-            // Coordinates:
-            coordinates[0] = -0.77459666924148337703585307995648;
-            coordinates[3] = 0;
-            coordinates[6] = 0.77459666924148337703585307995648;
-
-            // Weights:
-            weights[0] = 0.55555555555555555555555555555556;
-            weights[1] = 0.88888888888888888888888888888889;
-            weights[2] = 0.55555555555555555555555555555556;
-
+            coordinates.assign(gpcoordinates3, gpcoordinates3+3*3);
+            weights.assign(gpweights3, gpweights3+3);
             break;
-
         case 4:
-
-            // Coordinates:
-            coordinates[0] = -0.86113631159405257522394648889281;
-            coordinates[3] = -0.33998104358485626480266575910324;
-            coordinates[6] = 0.33998104358485626480266575910324;
-            coordinates[9] = 0.86113631159405257522394648889281;
-
-            // Weights:
-            weights[0] = 0.347854845137453857373063949222;
-            weights[1] = 0.652145154862546142626936050778;
-            weights[2] = 0.652145154862546142626936050778;
-            weights[3] = 0.347854845137453857373063949222;
-
+            coordinates.assign(gpcoordinates4, gpcoordinates4+3*4);
+            weights.assign(gpweights4, gpweights4+4);
             break;
-
         case 5:
-
-            // Coordinates:
-            coordinates[0] = -0.90617984593866399279762687829939;
-            coordinates[3] = -0.53846931010568309103631442070021;
-            coordinates[6] = 0;
-            coordinates[9] = 0.53846931010568309103631442070021;
-            coordinates[12] = 0.90617984593866399279762687829939;
-
-            // Weights:
-            weights[0] = 0.23692688505618908751426404071992;
-            weights[1] = 0.47862867049936646804129151483564;
-            weights[2] = 0.56888888888888888888888888888889;
-            weights[3] = 0.47862867049936646804129151483564;
-            weights[4] = 0.23692688505618908751426404071992;
-
+            coordinates.assign(gpcoordinates5, gpcoordinates5+3*5);
+            weights.assign(gpweights5, gpweights5+5);
             break;
-
         case 6:
-
-            // Coordinates:
-            coordinates[0] = -0.93246951420315202781230155449399;
-            coordinates[3] = -0.66120938646626451366139959501991;
-            coordinates[6] = -0.23861918608319690863050172168071;
-            coordinates[9] = 0.23861918608319690863050172168071;
-            coordinates[12] = 0.66120938646626451366139959501991;
-            coordinates[15] = 0.93246951420315202781230155449399;
-
-            // Weights:
-            weights[0] = 0.17132449237917034504029614217273;
-            weights[1] = 0.36076157304813860756983351383772;
-            weights[2] = 0.46791393457269104738987034398955;
-            weights[3] = 0.46791393457269104738987034398955;
-            weights[4] = 0.36076157304813860756983351383772;
-            weights[5] = 0.17132449237917034504029614217273;
-
+            coordinates.assign(gpcoordinates6, gpcoordinates6+3*6);
+            weights.assign(gpweights6, gpweights6+6);
             break;
-
         case 7:
-
-            // Coordinates:
-            coordinates[0] = -0.94910791234275852452618968404785;
-            coordinates[3] = -0.74153118559939443986386477328079;
-            coordinates[6] = -0.40584515137739716690660641207696;
-            coordinates[9] = 0;
-            coordinates[12] = 0.40584515137739716690660641207696;
-            coordinates[15] = 0.74153118559939443986386477328079;
-            coordinates[18] = 0.94910791234275852452618968404785;
-
-            // Weights:
-            weights[0] = 0.12948496616886969327061143267908;
-            weights[1] = 0.27970539148927666790146777142378;
-            weights[2] = 0.38183005050511894495036977548898;
-            weights[3] = 0.41795918367346938775510204081633;
-            weights[4] = 0.38183005050511894495036977548898;
-            weights[5] = 0.27970539148927666790146777142378;
-            weights[6] = 0.12948496616886969327061143267908;
-
+            coordinates.assign(gpcoordinates7, gpcoordinates7+3*7);
+            weights.assign(gpweights7, gpweights7+7);
             break;
-
         case 8:
-
-            // Coordinates:
-            coordinates[0] = -0.96028985649753623168356086856947;
-            coordinates[3] = -0.79666647741362673959155393647583;
-            coordinates[6] = -0.52553240991632898581773904918925;
-            coordinates[9] = -0.18343464249564980493947614236018;
-            coordinates[12] = 0.18343464249564980493947614236018;
-            coordinates[15] = 0.52553240991632898581773904918925;
-            coordinates[18] = 0.79666647741362673959155393647583;
-            coordinates[21] = 0.96028985649753623168356086856947;
-
-            // Weights:
-            weights[0] = 0.10122853629037625915253135430996;
-            weights[1] = 0.22238103445337447054435599442624;
-            weights[2] = 0.3137066458778872873379622019866;
-            weights[3] = 0.3626837833783619829651504492772;
-            weights[4] = 0.3626837833783619829651504492772;
-            weights[5] = 0.3137066458778872873379622019866;
-            weights[6] = 0.22238103445337447054435599442624;
-            weights[7] = 0.10122853629037625915253135430996;
-
+            coordinates.assign(gpcoordinates8, gpcoordinates8+3*8);
+            weights.assign(gpweights8, gpweights8+8);
             break;
-
         case 9:
-
-            // Coordinates:
-            coordinates[0] = -0.96816023950762608983557620290367;
-            coordinates[3] = -0.83603110732663579429942978806973;
-            coordinates[6] = -0.61337143270059039730870203934147;
-            coordinates[9] = -0.32425342340380892903853801464334;
-            coordinates[12] = 0;
-            coordinates[15] = 0.32425342340380892903853801464334;
-            coordinates[18] = 0.61337143270059039730870203934147;
-            coordinates[21] = 0.83603110732663579429942978806973;
-            coordinates[24] = 0.96816023950762608983557620290367;
-
-            // Weights:
-            weights[0] = 0.081274388361574411971892158110524;
-            weights[1] = 0.18064816069485740405847203124291;
-            weights[2] = 0.26061069640293546231874286941863;
-            weights[3] = 0.31234707704000284006863040658444;
-            weights[4] = 0.33023935500125976316452506928697;
-            weights[5] = 0.31234707704000284006863040658444;
-            weights[6] = 0.26061069640293546231874286941863;
-            weights[7] = 0.18064816069485740405847203124291;
-            weights[8] = 0.081274388361574411971892158110524;
-
+            coordinates.assign(gpcoordinates9, gpcoordinates9+3*9);
+            weights.assign(gpweights9, gpweights9+9);
             break;
-
         case 10:
-
-            // Coordinates:
-            coordinates[0] = -0.97390652851717172007796401208445;
-            coordinates[3] = -0.86506336668898451073209668842349;
-            coordinates[6] = -0.67940956829902440623432736511487;
-            coordinates[9] = -0.43339539412924719079926594316578;
-            coordinates[12] = -0.14887433898163121088482600112972;
-            coordinates[15] = 0.14887433898163121088482600112972;
-            coordinates[18] = 0.43339539412924719079926594316578;
-            coordinates[21] = 0.67940956829902440623432736511487;
-            coordinates[24] = 0.86506336668898451073209668842349;
-            coordinates[27] = 0.97390652851717172007796401208445;
-
-            // Weights:
-            weights[0] = 0.066671344308688137593568809893332;
-            weights[1] = 0.1494513491505805931457763396577;
-            weights[2] = 0.21908636251598204399553493422816;
-            weights[3] = 0.26926671930999635509122692156947;
-            weights[4] = 0.29552422471475287017389299465134;
-            weights[5] = 0.29552422471475287017389299465134;
-            weights[6] = 0.26926671930999635509122692156947;
-            weights[7] = 0.21908636251598204399553493422816;
-            weights[8] = 0.1494513491505805931457763396577;
-            weights[9] = 0.066671344308688137593568809893332;
-
+            coordinates.assign(gpcoordinates10, gpcoordinates10+3*10);
+            weights.assign(gpweights10, gpweights10+10);
             break;
-
         case 11:
-
-            // Coordinates:
-            coordinates[0] = -0.97822865814605699280393800112286;
-            coordinates[3] = -0.88706259976809529907515776930393;
-            coordinates[6] = -0.73015200557404932409341625203115;
-            coordinates[9] = -0.51909612920681181592572566945861;
-            coordinates[12] = -0.26954315595234497233153198540086;
-            coordinates[15] = 0;
-            coordinates[18] = 0.26954315595234497233153198540086;
-            coordinates[21] = 0.51909612920681181592572566945861;
-            coordinates[24] = 0.73015200557404932409341625203115;
-            coordinates[27] = 0.88706259976809529907515776930393;
-            coordinates[30] = 0.97822865814605699280393800112286;
-
-            // Weights:
-            weights[0] = 0.055668567116173666482753720442549;
-            weights[1] = 0.12558036946490462463469429922394;
-            weights[2] = 0.18629021092773425142609764143166;
-            weights[3] = 0.23319376459199047991852370484318;
-            weights[4] = 0.26280454451024666218068886989051;
-            weights[5] = 0.27292508677790063071448352833634;
-            weights[6] = 0.26280454451024666218068886989051;
-            weights[7] = 0.23319376459199047991852370484318;
-            weights[8] = 0.18629021092773425142609764143166;
-            weights[9] = 0.12558036946490462463469429922394;
-            weights[10] = 0.055668567116173666482753720442549;
-
+            coordinates.assign(gpcoordinates11, gpcoordinates11+3*11);
+            weights.assign(gpweights11, gpweights11+11);
             break;
-
         case 12:
-
-            // Coordinates:
-            coordinates[0] = -0.98156063424671925069054909014928;
-            coordinates[3] = -0.9041172563704748566784658661191;
-            coordinates[6] = -0.76990267419430468703689383321282;
-            coordinates[9] = -0.58731795428661744729670241894053;
-            coordinates[12] = -0.36783149899818019375269153664372;
-            coordinates[15] = -0.12523340851146891547244136946385;
-            coordinates[18] = 0.12523340851146891547244136946385;
-            coordinates[21] = 0.36783149899818019375269153664372;
-            coordinates[24] = 0.58731795428661744729670241894053;
-            coordinates[27] = 0.76990267419430468703689383321282;
-            coordinates[30] = 0.9041172563704748566784658661191;
-            coordinates[33] = 0.98156063424671925069054909014928;
-
-            // Weights:
-            weights[0] = 0.047175336386511827194615961485017;
-            weights[1] = 0.106939325995318430960254718194;
-            weights[2] = 0.16007832854334622633465252954336;
-            weights[3] = 0.2031674267230659217490644558098;
-            weights[4] = 0.23349253653835480876084989892488;
-            weights[5] = 0.24914704581340278500056243604295;
-            weights[6] = 0.24914704581340278500056243604295;
-            weights[7] = 0.23349253653835480876084989892488;
-            weights[8] = 0.2031674267230659217490644558098;
-            weights[9] = 0.16007832854334622633465252954336;
-            weights[10] = 0.106939325995318430960254718194;
-            weights[11] = 0.047175336386511827194615961485017;
-
+            coordinates.assign(gpcoordinates12, gpcoordinates12+3*12);
+            weights.assign(gpweights12, gpweights12+12);
             break;
-
         case 13:
-
-            // Coordinates:
-            coordinates[0] = -0.98418305471858814947282944880711;
-            coordinates[3] = -0.91759839922297796520654783650072;
-            coordinates[6] = -0.80157809073330991279420648958286;
-            coordinates[9] = -0.64234933944034022064398460699552;
-            coordinates[12] = -0.44849275103644685287791285212764;
-            coordinates[15] = -0.23045831595513479406552812109799;
-            coordinates[18] = 0;
-            coordinates[21] = 0.23045831595513479406552812109799;
-            coordinates[24] = 0.44849275103644685287791285212764;
-            coordinates[27] = 0.64234933944034022064398460699552;
-            coordinates[30] = 0.80157809073330991279420648958286;
-            coordinates[33] = 0.91759839922297796520654783650072;
-            coordinates[36] = 0.98418305471858814947282944880711;
-
-            // Weights:
-            weights[0] = 0.040484004765315879520021592200986;
-            weights[1] = 0.092121499837728447914421775953797;
-            weights[2] = 0.13887351021978723846360177686887;
-            weights[3] = 0.1781459807619457382800466919961;
-            weights[4] = 0.20781604753688850231252321930605;
-            weights[5] = 0.22628318026289723841209018603978;
-            weights[6] = 0.23255155323087391019458951526884;
-            weights[7] = 0.22628318026289723841209018603978;
-            weights[8] = 0.20781604753688850231252321930605;
-            weights[9] = 0.1781459807619457382800466919961;
-            weights[10] = 0.13887351021978723846360177686887;
-            weights[11] = 0.092121499837728447914421775953797;
-            weights[12] = 0.040484004765315879520021592200986;
-
+            coordinates.assign(gpcoordinates13, gpcoordinates13+3*13);
+            weights.assign(gpweights13, gpweights13+13);
             break;
-
         case 14:
-
-            // Coordinates:
-            coordinates[0] = -0.98628380869681233884159726670405;
-            coordinates[3] = -0.92843488366357351733639113937787;
-            coordinates[6] = -0.82720131506976499318979474265039;
-            coordinates[9] = -0.68729290481168547014801980301933;
-            coordinates[12] = -0.51524863635815409196529071855119;
-            coordinates[15] = -0.31911236892788976043567182416848;
-            coordinates[18] = -0.10805494870734366206624465021983;
-            coordinates[21] = 0.10805494870734366206624465021983;
-            coordinates[24] = 0.31911236892788976043567182416848;
-            coordinates[27] = 0.51524863635815409196529071855119;
-            coordinates[30] = 0.68729290481168547014801980301933;
-            coordinates[33] = 0.82720131506976499318979474265039;
-            coordinates[36] = 0.92843488366357351733639113937787;
-            coordinates[39] = 0.98628380869681233884159726670405;
-
-            // Weights:
-            weights[0] = 0.035119460331751863031832876138192;
-            weights[1] = 0.080158087159760209805633277062854;
-            weights[2] = 0.12151857068790318468941480907248;
-            weights[3] = 0.15720316715819353456960193862384;
-            weights[4] = 0.18553839747793781374171659012516;
-            weights[5] = 0.20519846372129560396592406566122;
-            weights[6] = 0.21526385346315779019587644331626;
-            weights[7] = 0.21526385346315779019587644331626;
-            weights[8] = 0.20519846372129560396592406566122;
-            weights[9] = 0.18553839747793781374171659012516;
-            weights[10] = 0.15720316715819353456960193862384;
-            weights[11] = 0.12151857068790318468941480907248;
-            weights[12] = 0.080158087159760209805633277062854;
-            weights[13] = 0.035119460331751863031832876138192;
-
+            coordinates.assign(gpcoordinates14, gpcoordinates14+3*14);
+            weights.assign(gpweights14, gpweights14+14);
             break;
-
         case 15:
-
-            // Coordinates:
-            coordinates[0] = -0.98799251802048542848956571858661;
-            coordinates[3] = -0.93727339240070590430775894771021;
-            coordinates[6] = -0.84820658341042721620064832077422;
-            coordinates[9] = -0.72441773136017004741618605461394;
-            coordinates[12] = -0.57097217260853884753722673725391;
-            coordinates[15] = -0.39415134707756336989720737098105;
-            coordinates[18] = -0.2011940939974345223006283033946;
-            coordinates[21] = 0;
-            coordinates[24] = 0.2011940939974345223006283033946;
-            coordinates[27] = 0.39415134707756336989720737098105;
-            coordinates[30] = 0.57097217260853884753722673725391;
-            coordinates[33] = 0.72441773136017004741618605461394;
-            coordinates[36] = 0.84820658341042721620064832077422;
-            coordinates[39] = 0.93727339240070590430775894771021;
-            coordinates[42] = 0.98799251802048542848956571858661;
-
-            // Weights:
-            weights[0] = 0.030753241996117268354628393577204;
-            weights[1] = 0.070366047488108124709267416450667;
-            weights[2] = 0.10715922046717193501186954668587;
-            weights[3] = 0.13957067792615431444780479451103;
-            weights[4] = 0.16626920581699393355320086048121;
-            weights[5] = 0.18616100001556221102680056186642;
-            weights[6] = 0.19843148532711157645611832644384;
-            weights[7] = 0.20257824192556127288062019996752;
-            weights[8] = 0.19843148532711157645611832644384;
-            weights[9] = 0.18616100001556221102680056186642;
-            weights[10] = 0.16626920581699393355320086048121;
-            weights[11] = 0.13957067792615431444780479451103;
-            weights[12] = 0.10715922046717193501186954668587;
-            weights[13] = 0.070366047488108124709267416450667;
-            weights[14] = 0.030753241996117268354628393577204;
-
+            coordinates.assign(gpcoordinates15, gpcoordinates15+3*15);
+            weights.assign(gpweights15, gpweights15+15);
             break;
-
         case 16:
-
-            // Coordinates:
-            coordinates[0] = -0.98940093499164993259615417345033;
-            coordinates[3] = -0.94457502307323257607798841553461;
-            coordinates[6] = -0.86563120238783174388046789771239;
-            coordinates[9] = -0.75540440835500303389510119484744;
-            coordinates[12] = -0.61787624440264374844667176404879;
-            coordinates[15] = -0.45801677765722738634241944298358;
-            coordinates[18] = -0.2816035507792589132304605014605;
-            coordinates[21] = -0.095012509837637440185319335424958;
-            coordinates[24] = 0.095012509837637440185319335424958;
-            coordinates[27] = 0.2816035507792589132304605014605;
-            coordinates[30] = 0.45801677765722738634241944298358;
-            coordinates[33] = 0.61787624440264374844667176404879;
-            coordinates[36] = 0.75540440835500303389510119484744;
-            coordinates[39] = 0.86563120238783174388046789771239;
-            coordinates[42] = 0.94457502307323257607798841553461;
-            coordinates[45] = 0.98940093499164993259615417345033;
-
-            // Weights:
-            weights[0] = 0.027152459411754094851780572456018;
-            weights[1] = 0.062253523938647892862843836994378;
-            weights[2] = 0.095158511682492784809925107602246;
-            weights[3] = 0.12462897125553387205247628219202;
-            weights[4] = 0.14959598881657673208150173054748;
-            weights[5] = 0.16915651939500253818931207903036;
-            weights[6] = 0.18260341504492358886676366796922;
-            weights[7] = 0.18945061045506849628539672320828;
-            weights[8] = 0.18945061045506849628539672320828;
-            weights[9] = 0.18260341504492358886676366796922;
-            weights[10] = 0.16915651939500253818931207903036;
-            weights[11] = 0.14959598881657673208150173054748;
-            weights[12] = 0.12462897125553387205247628219202;
-            weights[13] = 0.095158511682492784809925107602246;
-            weights[14] = 0.062253523938647892862843836994378;
-            weights[15] = 0.027152459411754094851780572456018;
-
+            coordinates.assign(gpcoordinates16, gpcoordinates16+3*16);
+            weights.assign(gpweights16, gpweights16+16);
             break;
-
         case 17:
-
-            // Coordinates:
-            coordinates[0] = -0.99057547531441733567543401994067;
-            coordinates[3] = -0.9506755217687677612227169578958;
-            coordinates[6] = -0.88023915372698590212295569448816;
-            coordinates[9] = -0.78151400389680140692523005552048;
-            coordinates[12] = -0.657671159216690765850302216643;
-            coordinates[15] = -0.51269053708647696788624656862955;
-            coordinates[18] = -0.35123176345387631529718551709535;
-            coordinates[21] = -0.17848418149584785585067749365407;
-            coordinates[24] = 0;
-            coordinates[27] = 0.17848418149584785585067749365407;
-            coordinates[30] = 0.35123176345387631529718551709535;
-            coordinates[33] = 0.51269053708647696788624656862955;
-            coordinates[36] = 0.657671159216690765850302216643;
-            coordinates[39] = 0.78151400389680140692523005552048;
-            coordinates[42] = 0.88023915372698590212295569448816;
-            coordinates[45] = 0.9506755217687677612227169578958;
-            coordinates[48] = 0.99057547531441733567543401994067;
-
-            // Weights:
-            weights[0] = 0.024148302868547931960110026287565;
-            weights[1] = 0.055459529373987201129440165358245;
-            weights[2] = 0.085036148317179180883535370191062;
-            weights[3] = 0.11188384719340397109478838562636;
-            weights[4] = 0.13513636846852547328631998170235;
-            weights[5] = 0.15404576107681028808143159480196;
-            weights[6] = 0.16800410215645004450997066378832;
-            weights[7] = 0.1765627053669926463252709901132;
-            weights[8] = 0.17944647035620652545826564426189;
-            weights[9] = 0.1765627053669926463252709901132;
-            weights[10] = 0.16800410215645004450997066378832;
-            weights[11] = 0.15404576107681028808143159480196;
-            weights[12] = 0.13513636846852547328631998170235;
-            weights[13] = 0.11188384719340397109478838562636;
-            weights[14] = 0.085036148317179180883535370191062;
-            weights[15] = 0.055459529373987201129440165358245;
-            weights[16] = 0.024148302868547931960110026287565;
-
+            coordinates.assign(gpcoordinates17, gpcoordinates17+3*17);
+            weights.assign(gpweights17, gpweights17+17);
             break;
-
         case 18:
-
-            // Coordinates:
-            coordinates[0] = -0.99156516842093094673001600470615;
-            coordinates[3] = -0.95582394957139775518119589292978;
-            coordinates[6] = -0.89260246649755573920606059112715;
-            coordinates[9] = -0.80370495897252311568241745501459;
-            coordinates[12] = -0.69168704306035320787489108128885;
-            coordinates[15] = -0.55977083107394753460787154852533;
-            coordinates[18] = -0.41175116146284264603593179383305;
-            coordinates[21] = -0.25188622569150550958897285487791;
-            coordinates[24] = -0.084775013041735301242261852935784;
-            coordinates[27] = 0.084775013041735301242261852935784;
-            coordinates[30] = 0.25188622569150550958897285487791;
-            coordinates[33] = 0.41175116146284264603593179383305;
-            coordinates[36] = 0.55977083107394753460787154852533;
-            coordinates[39] = 0.69168704306035320787489108128885;
-            coordinates[42] = 0.80370495897252311568241745501459;
-            coordinates[45] = 0.89260246649755573920606059112715;
-            coordinates[48] = 0.95582394957139775518119589292978;
-            coordinates[51] = 0.99156516842093094673001600470615;
-
-            // Weights:
-            weights[0] = 0.021616013526483310313342710266452;
-            weights[1] = 0.049714548894969796453334946202639;
-            weights[2] = 0.076425730254889056529129677616637;
-            weights[3] = 0.10094204410628716556281398492483;
-            weights[4] = 0.1225552067114784601845191268002;
-            weights[5] = 0.14064291467065065120473130375195;
-            weights[6] = 0.15468467512626524492541800383637;
-            weights[7] = 0.16427648374583272298605377646593;
-            weights[8] = 0.16914238296314359184065647013499;
-            weights[9] = 0.16914238296314359184065647013499;
-            weights[10] = 0.16427648374583272298605377646593;
-            weights[11] = 0.15468467512626524492541800383637;
-            weights[12] = 0.14064291467065065120473130375195;
-            weights[13] = 0.1225552067114784601845191268002;
-            weights[14] = 0.10094204410628716556281398492483;
-            weights[15] = 0.076425730254889056529129677616637;
-            weights[16] = 0.049714548894969796453334946202639;
-            weights[17] = 0.021616013526483310313342710266452;
-
+            coordinates.assign(gpcoordinates18, gpcoordinates18+3*18);
+            weights.assign(gpweights18, gpweights18+18);
             break;
-
         case 19:
-
-            // Coordinates:
-            coordinates[0] = -0.99240684384358440318901767025326;
-            coordinates[3] = -0.96020815213483003085277884068765;
-            coordinates[6] = -0.90315590361481790164266092853231;
-            coordinates[9] = -0.82271465653714282497892248671271;
-            coordinates[12] = -0.72096617733522937861709586082378;
-            coordinates[15] = -0.60054530466168102346963816494624;
-            coordinates[18] = -0.4645707413759609457172671481041;
-            coordinates[21] = -0.31656409996362983199011732884984;
-            coordinates[24] = -0.16035864564022537586809611574074;
-            coordinates[27] = 0;
-            coordinates[30] = 0.16035864564022537586809611574074;
-            coordinates[33] = 0.31656409996362983199011732884984;
-            coordinates[36] = 0.4645707413759609457172671481041;
-            coordinates[39] = 0.60054530466168102346963816494624;
-            coordinates[42] = 0.72096617733522937861709586082378;
-            coordinates[45] = 0.82271465653714282497892248671271;
-            coordinates[48] = 0.90315590361481790164266092853231;
-            coordinates[51] = 0.96020815213483003085277884068765;
-            coordinates[54] = 0.99240684384358440318901767025326;
-
-            // Weights:
-            weights[0] = 0.019461788229726477036312041464438;
-            weights[1] = 0.044814226765699600332838157401994;
-            weights[2] = 0.069044542737641226580708258006013;
-            weights[3] = 0.09149002162244999946446209412384;
-            weights[4] = 0.11156664554733399471602390168177;
-            weights[5] = 0.12875396253933622767551578485688;
-            weights[6] = 0.1426067021736066117757461094419;
-            weights[7] = 0.15276604206585966677885540089766;
-            weights[8] = 0.15896884339395434764995643946505;
-            weights[9] = 0.16105444984878369597916362532092;
-            weights[10] = 0.15896884339395434764995643946505;
-            weights[11] = 0.15276604206585966677885540089766;
-            weights[12] = 0.1426067021736066117757461094419;
-            weights[13] = 0.12875396253933622767551578485688;
-            weights[14] = 0.11156664554733399471602390168177;
-            weights[15] = 0.09149002162244999946446209412384;
-            weights[16] = 0.069044542737641226580708258006013;
-            weights[17] = 0.044814226765699600332838157401994;
-            weights[18] = 0.019461788229726477036312041464438;
-
+            coordinates.assign(gpcoordinates19, gpcoordinates19+3*19);
+            weights.assign(gpweights19, gpweights19+19);
             break;
-
         case 20:
-
-            // Coordinates:
-            coordinates[0] = -0.99312859918509492478612238847132;
-            coordinates[3] = -0.96397192727791379126766613119728;
-            coordinates[6] = -0.9122344282513259058677524412033;
-            coordinates[9] = -0.83911697182221882339452906170152;
-            coordinates[12] = -0.74633190646015079261430507035564;
-            coordinates[15] = -0.63605368072651502545283669622629;
-            coordinates[18] = -0.51086700195082709800436405095525;
-            coordinates[21] = -0.37370608871541956067254817702493;
-            coordinates[24] = -0.22778585114164507808049619536857;
-            coordinates[27] = -0.076526521133497333754640409398838;
-            coordinates[30] = 0.076526521133497333754640409398838;
-            coordinates[33] = 0.22778585114164507808049619536857;
-            coordinates[36] = 0.37370608871541956067254817702493;
-            coordinates[39] = 0.51086700195082709800436405095525;
-            coordinates[42] = 0.63605368072651502545283669622629;
-            coordinates[45] = 0.74633190646015079261430507035564;
-            coordinates[48] = 0.83911697182221882339452906170152;
-            coordinates[51] = 0.9122344282513259058677524412033;
-            coordinates[54] = 0.96397192727791379126766613119728;
-            coordinates[57] = 0.99312859918509492478612238847132;
-
-            // Weights:
-            weights[0] = 0.017614007139152118311861962351853;
-            weights[1] = 0.040601429800386941331039952274932;
-            weights[2] = 0.062672048334109063569506535187042;
-            weights[3] = 0.083276741576704748724758143222046;
-            weights[4] = 0.10193011981724043503675013548035;
-            weights[5] = 0.11819453196151841731237737771138;
-            weights[6] = 0.13168863844917662689849449974816;
-            weights[7] = 0.14209610931838205132929832506716;
-            weights[8] = 0.14917298647260374678782873700197;
-            weights[9] = 0.1527533871307258506980843319551;
-            weights[10] = 0.1527533871307258506980843319551;
-            weights[11] = 0.14917298647260374678782873700197;
-            weights[12] = 0.14209610931838205132929832506716;
-            weights[13] = 0.13168863844917662689849449974816;
-            weights[14] = 0.11819453196151841731237737771138;
-            weights[15] = 0.10193011981724043503675013548035;
-            weights[16] = 0.083276741576704748724758143222046;
-            weights[17] = 0.062672048334109063569506535187042;
-            weights[18] = 0.040601429800386941331039952274932;
-            weights[19] = 0.017614007139152118311861962351853;
-
+            coordinates.assign(gpcoordinates20, gpcoordinates20+3*20);
+            weights.assign(gpweights20, gpweights20+20);
             break;
-
         case 21:
-
-            // Coordinates:
-            coordinates[0] = -0.99375217062038950026024203593794;
-            coordinates[3] = -0.9672268385663062943166222149077;
-            coordinates[6] = -0.92009933415040082879018713371496;
-            coordinates[9] = -0.85336336458331728364725063858757;
-            coordinates[12] = -0.76843996347567790861587785130622;
-            coordinates[15] = -0.66713880419741231930596666999034;
-            coordinates[18] = -0.55161883588721980705901879672431;
-            coordinates[21] = -0.42434212020743878357366888854379;
-            coordinates[24] = -0.2880213168024010966007925160646;
-            coordinates[27] = -0.14556185416089509093703098233869;
-            coordinates[30] = 0;
-            coordinates[33] = 0.14556185416089509093703098233869;
-            coordinates[36] = 0.2880213168024010966007925160646;
-            coordinates[39] = 0.42434212020743878357366888854379;
-            coordinates[42] = 0.55161883588721980705901879672431;
-            coordinates[45] = 0.66713880419741231930596666999034;
-            coordinates[48] = 0.76843996347567790861587785130623;
-            coordinates[51] = 0.85336336458331728364725063858756;
-            coordinates[54] = 0.92009933415040082879018713371497;
-            coordinates[57] = 0.96722683856630629431662221490769;
-            coordinates[60] = 0.99375217062038950026024203593794;
-
-            // Weights:
-            weights[0] = 0.016017228257774333324224616858403;
-            weights[1] = 0.036953789770852493799950668299422;
-            weights[2] = 0.057134425426857208283635826472357;
-            weights[3] = 0.076100113628379302017051653300256;
-            weights[4] = 0.093444423456033861553289741113883;
-            weights[5] = 0.10879729916714837766347457807013;
-            weights[6] = 0.12183141605372853419536717712572;
-            weights[7] = 0.13226893863333746178105257449678;
-            weights[8] = 0.13988739479107315472213342386758;
-            weights[9] = 0.14452440398997005906382716655375;
-            weights[10] = 0.14608113364969042719198514768337;
-            weights[11] = 0.14452440398997005906382716655375;
-            weights[12] = 0.13988739479107315472213342386758;
-            weights[13] = 0.13226893863333746178105257449678;
-            weights[14] = 0.12183141605372853419536717712574;
-            weights[15] = 0.1087972991671483776634745780701;
-            weights[16] = 0.09344442345603386155328974111395;
-            weights[17] = 0.076100113628379302017051653300153;
-            weights[18] = 0.057134425426857208283635826472488;
-            weights[19] = 0.036953789770852493799950668299287;
-            weights[20] = 0.016017228257774333324224616858503;
-
+            coordinates.assign(gpcoordinates21, gpcoordinates21+3*21);
+            weights.assign(gpweights21, gpweights21+21);
             break;
-
         case 22:
-
-            // Coordinates:
-            coordinates[0] = -0.9942945854823992920730314211613;
-            coordinates[3] = -0.97006049783542872712395098676527;
-            coordinates[6] = -0.92695677218717400052069293925905;
-            coordinates[9] = -0.86581257772030013653642563701938;
-            coordinates[12] = -0.78781680597920816200427795540835;
-            coordinates[15] = -0.69448726318668278005068983576226;
-            coordinates[18] = -0.58764040350691159295887692763865;
-            coordinates[21] = -0.46935583798675702640633071096641;
-            coordinates[24] = -0.34193582089208422515814742042738;
-            coordinates[27] = -0.20786042668822128547884653391955;
-            coordinates[30] = -0.069739273319722221213841796118628;
-            coordinates[33] = 0.069739273319722221213841796118628;
-            coordinates[36] = 0.20786042668822128547884653391955;
-            coordinates[39] = 0.34193582089208422515814742042738;
-            coordinates[42] = 0.46935583798675702640633071096641;
-            coordinates[45] = 0.58764040350691159295887692763865;
-            coordinates[48] = 0.69448726318668278005068983576226;
-            coordinates[51] = 0.78781680597920816200427795540835;
-            coordinates[54] = 0.86581257772030013653642563701938;
-            coordinates[57] = 0.92695677218717400052069293925905;
-            coordinates[60] = 0.97006049783542872712395098676527;
-            coordinates[63] = 0.9942945854823992920730314211613;
-
-            // Weights:
-            weights[0] = 0.014627995298272200684991098047185;
-            weights[1] = 0.033774901584814154793302246865913;
-            weights[2] = 0.052293335152683285940312051273211;
-            weights[3] = 0.069796468424520488094961418930218;
-            weights[4] = 0.085941606217067727414443681372703;
-            weights[5] = 0.10041414444288096493207883783054;
-            weights[6] = 0.11293229608053921839340060742178;
-            weights[7] = 0.12325237681051242428556098615481;
-            weights[8] = 0.13117350478706237073296499253031;
-            weights[9] = 0.13654149834601517135257383123152;
-            weights[10] = 0.13925187285563199337541024834181;
-            weights[11] = 0.13925187285563199337541024834181;
-            weights[12] = 0.13654149834601517135257383123152;
-            weights[13] = 0.13117350478706237073296499253031;
-            weights[14] = 0.12325237681051242428556098615481;
-            weights[15] = 0.11293229608053921839340060742178;
-            weights[16] = 0.10041414444288096493207883783054;
-            weights[17] = 0.085941606217067727414443681372703;
-            weights[18] = 0.069796468424520488094961418930218;
-            weights[19] = 0.052293335152683285940312051273211;
-            weights[20] = 0.033774901584814154793302246865913;
-            weights[21] = 0.014627995298272200684991098047185;
-
+            coordinates.assign(gpcoordinates22, gpcoordinates22+3*22);
+            weights.assign(gpweights22, gpweights22+22);
             break;
-
         case 23:
-
-            // Coordinates:
-            coordinates[0] = -0.99476933499755212352392571544557;
-            coordinates[3] = -0.97254247121811523195602407682078;
-            coordinates[6] = -0.93297108682601610234919698903842;
-            coordinates[9] = -0.87675235827044166737815688593415;
-            coordinates[12] = -0.80488840161883989215111840699678;
-            coordinates[15] = -0.71866136313195019446162448374862;
-            coordinates[18] = -0.6196098757636461563850973116496;
-            coordinates[21] = -0.50950147784600754968979304786685;
-            coordinates[24] = -0.39030103803029083142148887288061;
-            coordinates[27] = -0.26413568097034493053386953828331;
-            coordinates[30] = -0.13325682429846611093174268224177;
-            coordinates[33] = 0;
-            coordinates[36] = 0.13325682429846611093174268224177;
-            coordinates[39] = 0.26413568097034493053386953828331;
-            coordinates[42] = 0.39030103803029083142148887288061;
-            coordinates[45] = 0.50950147784600754968979304786685;
-            coordinates[48] = 0.6196098757636461563850973116496;
-            coordinates[51] = 0.71866136313195019446162448374862;
-            coordinates[54] = 0.80488840161883989215111840699678;
-            coordinates[57] = 0.87675235827044166737815688593415;
-            coordinates[60] = 0.93297108682601610234919698903842;
-            coordinates[63] = 0.97254247121811523195602407682078;
-            coordinates[66] = 0.99476933499755212352392571544557;
-
-            // Weights:
-            weights[0] = 0.013411859487141772081309493458615;
-            weights[1] = 0.030988005856979444310694219641885;
-            weights[2] = 0.048037671731084668571641071632034;
-            weights[3] = 0.064232421408525852127169615158911;
-            weights[4] = 0.079281411776718954922892524742043;
-            weights[5] = 0.092915766060035147477018617369765;
-            weights[6] = 0.10489209146454141007408618501474;
-            weights[7] = 0.11499664022241136494164351293396;
-            weights[8] = 0.12304908430672953046757840067201;
-            weights[9] = 0.12890572218808214997859533939979;
-            weights[10] = 0.13246203940469661737164246470332;
-            weights[11] = 0.13365457218610617535145711054584;
-            weights[12] = 0.13246203940469661737164246470332;
-            weights[13] = 0.12890572218808214997859533939979;
-            weights[14] = 0.12304908430672953046757840067201;
-            weights[15] = 0.11499664022241136494164351293396;
-            weights[16] = 0.10489209146454141007408618501474;
-            weights[17] = 0.092915766060035147477018617369765;
-            weights[18] = 0.079281411776718954922892524742043;
-            weights[19] = 0.064232421408525852127169615158911;
-            weights[20] = 0.048037671731084668571641071632034;
-            weights[21] = 0.030988005856979444310694219641885;
-            weights[22] = 0.013411859487141772081309493458615;
-
+            coordinates.assign(gpcoordinates23, gpcoordinates23+3*23);
+            weights.assign(gpweights23, gpweights23+23);
             break;
-
         case 24:
-
-            // Coordinates:
-            coordinates[0] = -0.99518721999702136017999740970074;
-            coordinates[3] = -0.97472855597130949819839199300817;
-            coordinates[6] = -0.93827455200273275852364900170872;
-            coordinates[9] = -0.8864155270044010342131543419822;
-            coordinates[12] = -0.82000198597390292195394987266975;
-            coordinates[15] = -0.74012419157855436424382810309998;
-            coordinates[18] = -0.64809365193697556925249578691075;
-            coordinates[21] = -0.54542147138883953565837561721837;
-            coordinates[24] = -0.43379350762604513848708423191335;
-            coordinates[27] = -0.31504267969616337438679329131981;
-            coordinates[30] = -0.19111886747361630915863982075707;
-            coordinates[33] = -0.064056892862605626085043082624745;
-            coordinates[36] = 0.064056892862605626085043082624745;
-            coordinates[39] = 0.19111886747361630915863982075707;
-            coordinates[42] = 0.31504267969616337438679329131981;
-            coordinates[45] = 0.43379350762604513848708423191335;
-            coordinates[48] = 0.54542147138883953565837561721837;
-            coordinates[51] = 0.64809365193697556925249578691075;
-            coordinates[54] = 0.74012419157855436424382810309998;
-            coordinates[57] = 0.82000198597390292195394987266975;
-            coordinates[60] = 0.8864155270044010342131543419822;
-            coordinates[63] = 0.93827455200273275852364900170872;
-            coordinates[66] = 0.97472855597130949819839199300817;
-            coordinates[69] = 0.99518721999702136017999740970074;
-
-            // Weights:
-            weights[0] = 0.012341229799987199546805667070037;
-            weights[1] = 0.028531388628933663181307815951878;
-            weights[2] = 0.044277438817419806168602748211338;
-            weights[3] = 0.059298584915436780746367758500109;
-            weights[4] = 0.073346481411080305734033615253117;
-            weights[5] = 0.086190161531953275917185202983743;
-            weights[6] = 0.097618652104113888269880664464247;
-            weights[7] = 0.10744427011596563478257734244661;
-            weights[8] = 0.11550566805372560135334448390678;
-            weights[9] = 0.12167047292780339120446315347626;
-            weights[10] = 0.12583745634682829612137538251118;
-            weights[11] = 0.1279381953467521569740561652247;
-            weights[12] = 0.1279381953467521569740561652247;
-            weights[13] = 0.12583745634682829612137538251118;
-            weights[14] = 0.12167047292780339120446315347626;
-            weights[15] = 0.11550566805372560135334448390678;
-            weights[16] = 0.10744427011596563478257734244661;
-            weights[17] = 0.097618652104113888269880664464247;
-            weights[18] = 0.086190161531953275917185202983743;
-            weights[19] = 0.073346481411080305734033615253117;
-            weights[20] = 0.059298584915436780746367758500109;
-            weights[21] = 0.044277438817419806168602748211338;
-            weights[22] = 0.028531388628933663181307815951878;
-            weights[23] = 0.012341229799987199546805667070037;
-
+            coordinates.assign(gpcoordinates24, gpcoordinates24+3*24);
+            weights.assign(gpweights24, gpweights24+24);
             break;
-
         case 25:
-
-            // Coordinates:
-            coordinates[0] = -0.9955569697904980979087849468939;
-            coordinates[3] = -0.97666392145951751149831538647959;
-            coordinates[6] = -0.94297457122897433941401116965847;
-            coordinates[9] = -0.8949919978782753688510420067828;
-            coordinates[12] = -0.83344262876083400142102110869357;
-            coordinates[15] = -0.75925926303735763057728286520436;
-            coordinates[18] = -0.67356636847346836448512063324762;
-            coordinates[21] = -0.57766293024122296772368984161265;
-            coordinates[24] = -0.47300273144571496052218211500919;
-            coordinates[27] = -0.36117230580938783773582173012764;
-            coordinates[30] = -0.24386688372098843204519036279745;
-            coordinates[33] = -0.12286469261071039638735981880804;
-            coordinates[36] = 0;
-            coordinates[39] = 0.12286469261071039638735981880804;
-            coordinates[42] = 0.24386688372098843204519036279745;
-            coordinates[45] = 0.36117230580938783773582173012764;
-            coordinates[48] = 0.47300273144571496052218211500919;
-            coordinates[51] = 0.57766293024122296772368984161265;
-            coordinates[54] = 0.67356636847346836448512063324762;
-            coordinates[57] = 0.75925926303735763057728286520436;
-            coordinates[60] = 0.83344262876083400142102110869357;
-            coordinates[63] = 0.8949919978782753688510420067828;
-            coordinates[66] = 0.94297457122897433941401116965847;
-            coordinates[69] = 0.97666392145951751149831538647959;
-            coordinates[72] = 0.9955569697904980979087849468939;
-
-            // Weights:
-            weights[0] = 0.011393798501026287947902964113235;
-            weights[1] = 0.026354986615032137261901815295299;
-            weights[2] = 0.040939156701306312655623487711646;
-            weights[3] = 0.054904695975835191925936891540473;
-            weights[4] = 0.068038333812356917207187185656708;
-            weights[5] = 0.080140700335001018013234959669111;
-            weights[6] = 0.091028261982963649811497220702892;
-            weights[7] = 0.10053594906705064420220689039269;
-            weights[8] = 0.10851962447426365311609395705012;
-            weights[9] = 0.11485825914571164833932554586956;
-            weights[10] = 0.1194557635357847722281781265129;
-            weights[11] = 0.12224244299031004168895951894585;
-            weights[12] = 0.12317605372671545120390287307905;
-            weights[13] = 0.12224244299031004168895951894585;
-            weights[14] = 0.1194557635357847722281781265129;
-            weights[15] = 0.11485825914571164833932554586956;
-            weights[16] = 0.10851962447426365311609395705012;
-            weights[17] = 0.10053594906705064420220689039269;
-            weights[18] = 0.091028261982963649811497220702892;
-            weights[19] = 0.080140700335001018013234959669111;
-            weights[20] = 0.068038333812356917207187185656708;
-            weights[21] = 0.054904695975835191925936891540473;
-            weights[22] = 0.040939156701306312655623487711646;
-            weights[23] = 0.026354986615032137261901815295299;
-            weights[24] = 0.011393798501026287947902964113235;
-
+            coordinates.assign(gpcoordinates25, gpcoordinates25+3*25);
+            weights.assign(gpweights25, gpweights25+25);
             break;
-
         case 26:
-
-            // Coordinates:
-            coordinates[0] = -0.99588570114561692900321695932291;
-            coordinates[3] = -0.97838544595647099110058035431193;
-            coordinates[6] = -0.94715906666171425013591528351804;
-            coordinates[9] = -0.90263786198430707421766559923121;
-            coordinates[12] = -0.84544594278849801879750706146784;
-            coordinates[15] = -0.77638594882067885619296724724228;
-            coordinates[18] = -0.69642726041995726486381391372942;
-            coordinates[21] = -0.60669229301761806323197874691689;
-            coordinates[24] = -0.50844071482450571769570306472557;
-            coordinates[27] = -0.40305175512348630648107737709888;
-            coordinates[30] = -0.29200483948595689514283538207783;
-            coordinates[33] = -0.17685882035689018396905774841834;
-            coordinates[36] = -0.059230093429313207093718575198403;
-            coordinates[39] = 0.059230093429313207093718575198403;
-            coordinates[42] = 0.17685882035689018396905774841834;
-            coordinates[45] = 0.29200483948595689514283538207783;
-            coordinates[48] = 0.40305175512348630648107737709888;
-            coordinates[51] = 0.50844071482450571769570306472557;
-            coordinates[54] = 0.60669229301761806323197874691689;
-            coordinates[57] = 0.69642726041995726486381391372942;
-            coordinates[60] = 0.77638594882067885619296724724228;
-            coordinates[63] = 0.84544594278849801879750706146784;
-            coordinates[66] = 0.90263786198430707421766559923121;
-            coordinates[69] = 0.94715906666171425013591528351804;
-            coordinates[72] = 0.97838544595647099110058035431193;
-            coordinates[75] = 0.99588570114561692900321695932291;
-
-            // Weights:
-            weights[0] = 0.010551372617343007155651187685252;
-            weights[1] = 0.024417851092631908789615827519788;
-            weights[2] = 0.03796238329436276395030314124885;
-            weights[3] = 0.050975825297147811998319900724073;
-            weights[4] = 0.063274046329574835539453689907045;
-            weights[5] = 0.074684149765659745887075796102848;
-            weights[6] = 0.085045894313485239210447765079982;
-            weights[7] = 0.094213800355914148463664883067303;
-            weights[8] = 0.10205916109442542323841407025343;
-            weights[9] = 0.108471840528576590656579426728;
-            weights[10] = 0.1133618165463196665494407184426;
-            weights[11] = 0.11666044348529658204466250754036;
-            weights[12] = 0.11832141527926227651637108570047;
-            weights[13] = 0.11832141527926227651637108570047;
-            weights[14] = 0.11666044348529658204466250754036;
-            weights[15] = 0.1133618165463196665494407184426;
-            weights[16] = 0.108471840528576590656579426728;
-            weights[17] = 0.10205916109442542323841407025343;
-            weights[18] = 0.094213800355914148463664883067303;
-            weights[19] = 0.085045894313485239210447765079982;
-            weights[20] = 0.074684149765659745887075796102848;
-            weights[21] = 0.063274046329574835539453689907045;
-            weights[22] = 0.050975825297147811998319900724073;
-            weights[23] = 0.03796238329436276395030314124885;
-            weights[24] = 0.024417851092631908789615827519788;
-            weights[25] = 0.010551372617343007155651187685252;
-
+            coordinates.assign(gpcoordinates26, gpcoordinates26+3*26);
+            weights.assign(gpweights26, gpweights26+26);
             break;
-
         case 27:
-
-            // Coordinates:
-            coordinates[0] = -0.99617926288898856693888720838123;
-            coordinates[3] = -0.97992347596150122285587335566105;
-            coordinates[6] = -0.95090055781470500685190803064388;
-            coordinates[9] = -0.90948232067749110430064501820969;
-            coordinates[12] = -0.85620790801829449030273722270684;
-            coordinates[15] = -0.79177163907050822714439734410727;
-            coordinates[18] = -0.71701347373942369929481621164234;
-            coordinates[21] = -0.63290797194649514092773463763449;
-            coordinates[24] = -0.54055156457945689490030094155998;
-            coordinates[27] = -0.44114825175002688058597415568928;
-            coordinates[30] = -0.33599390363850889973031903420728;
-            coordinates[33] = -0.22645936543953685885723910736023;
-            coordinates[36] = -0.11397258560952996693289498386998;
-            coordinates[39] = 0;
-            coordinates[42] = 0.11397258560952996693289498386998;
-            coordinates[45] = 0.22645936543953685885723910736023;
-            coordinates[48] = 0.33599390363850889973031903420728;
-            coordinates[51] = 0.44114825175002688058597415568928;
-            coordinates[54] = 0.54055156457945689490030094155998;
-            coordinates[57] = 0.63290797194649514092773463763449;
-            coordinates[60] = 0.71701347373942369929481621164234;
-            coordinates[63] = 0.79177163907050822714439734410727;
-            coordinates[66] = 0.85620790801829449030273722270684;
-            coordinates[69] = 0.90948232067749110430064501820969;
-            coordinates[72] = 0.95090055781470500685190803064388;
-            coordinates[75] = 0.97992347596150122285587335566105;
-            coordinates[78] = 0.99617926288898856693888720838123;
-
-            // Weights:
-            weights[0] = 0.0097989960512943602611500550912591;
-            weights[1] = 0.022686231596180623196034206446761;
-            weights[2] = 0.035297053757419711022578289304712;
-            weights[3] = 0.047449412520615062704096710114185;
-            weights[4] = 0.058983536859833599110300833719532;
-            weights[5] = 0.069748823766245592984322888356667;
-            weights[6] = 0.079604867773057771263074959009842;
-            weights[7] = 0.088423158543756950194322802853749;
-            weights[8] = 0.096088727370028507565652646558106;
-            weights[9] = 0.10250163781774579867124771153266;
-            weights[10] = 0.10757828578853318721216298442666;
-            weights[11] = 0.11125248835684519267216309604285;
-            weights[12] = 0.1134763461089651486203699480921;
-            weights[13] = 0.11422086737895698904504573690184;
-            weights[14] = 0.1134763461089651486203699480921;
-            weights[15] = 0.11125248835684519267216309604285;
-            weights[16] = 0.10757828578853318721216298442666;
-            weights[17] = 0.10250163781774579867124771153266;
-            weights[18] = 0.096088727370028507565652646558106;
-            weights[19] = 0.088423158543756950194322802853749;
-            weights[20] = 0.079604867773057771263074959009842;
-            weights[21] = 0.069748823766245592984322888356667;
-            weights[22] = 0.058983536859833599110300833719532;
-            weights[23] = 0.047449412520615062704096710114185;
-            weights[24] = 0.035297053757419711022578289304712;
-            weights[25] = 0.022686231596180623196034206446761;
-            weights[26] = 0.0097989960512943602611500550912591;
-
+            coordinates.assign(gpcoordinates27, gpcoordinates27+3*27);
+            weights.assign(gpweights27, gpweights27+27);
             break;
-
         case 28:
-
-            // Coordinates:
-            coordinates[0] = -0.99644249757395444995043639048331;
-            coordinates[3] = -0.98130316537087275369455994580783;
-            coordinates[6] = -0.95425928062893819725410183970522;
-            coordinates[9] = -0.91563302639213207386968942332993;
-            coordinates[12] = -0.86589252257439504894225456737969;
-            coordinates[15] = -0.80564137091717917144788595542528;
-            coordinates[18] = -0.73561087801363177202814451029253;
-            coordinates[21] = -0.65665109403886496121989817650674;
-            coordinates[24] = -0.56972047181140171930800328335643;
-            coordinates[27] = -0.47587422495511826103441184766743;
-            coordinates[30] = -0.37625151608907871022135720955609;
-            coordinates[33] = -0.27206162763517807767682635612577;
-            coordinates[36] = -0.16456928213338077128147177789117;
-            coordinates[39] = -0.05507928988403427042651652734188;
-            coordinates[42] = 0.05507928988403427042651652734188;
-            coordinates[45] = 0.16456928213338077128147177789117;
-            coordinates[48] = 0.27206162763517807767682635612577;
-            coordinates[51] = 0.37625151608907871022135720955609;
-            coordinates[54] = 0.47587422495511826103441184766743;
-            coordinates[57] = 0.56972047181140171930800328335643;
-            coordinates[60] = 0.65665109403886496121989817650674;
-            coordinates[63] = 0.73561087801363177202814451029253;
-            coordinates[66] = 0.80564137091717917144788595542528;
-            coordinates[69] = 0.86589252257439504894225456737969;
-            coordinates[72] = 0.91563302639213207386968942332993;
-            coordinates[75] = 0.95425928062893819725410183970522;
-            coordinates[78] = 0.98130316537087275369455994580783;
-            coordinates[81] = 0.99644249757395444995043639048331;
-
-            // Weights:
-            weights[0] = 0.0091242825930945177388161539229517;
-            weights[1] = 0.021132112592771259751500380993265;
-            weights[2] = 0.032901427782304379977630819170532;
-            weights[3] = 0.044272934759004227839587877653207;
-            weights[4] = 0.055107345675716745431482918226946;
-            weights[5] = 0.065272923966999595793397566775505;
-            weights[6] = 0.074646214234568779023931887173022;
-            weights[7] = 0.083113417228901218390396498244332;
-            weights[8] = 0.090571744393032840942186031336784;
-            weights[9] = 0.096930657997929915850489006095441;
-            weights[10] = 0.10211296757806076981421663850571;
-            weights[11] = 0.10605576592284641791041643699681;
-            weights[12] = 0.10871119225829413525357151930367;
-            weights[13] = 0.11004701301647519628237626560182;
-            weights[14] = 0.11004701301647519628237626560182;
-            weights[15] = 0.10871119225829413525357151930367;
-            weights[16] = 0.10605576592284641791041643699681;
-            weights[17] = 0.10211296757806076981421663850571;
-            weights[18] = 0.096930657997929915850489006095441;
-            weights[19] = 0.090571744393032840942186031336784;
-            weights[20] = 0.083113417228901218390396498244332;
-            weights[21] = 0.074646214234568779023931887173022;
-            weights[22] = 0.065272923966999595793397566775505;
-            weights[23] = 0.055107345675716745431482918226946;
-            weights[24] = 0.044272934759004227839587877653207;
-            weights[25] = 0.032901427782304379977630819170532;
-            weights[26] = 0.021132112592771259751500380993265;
-            weights[27] = 0.0091242825930945177388161539229517;
-
+            coordinates.assign(gpcoordinates28, gpcoordinates28+3*28);
+            weights.assign(gpweights28, gpweights28+28);
             break;
-
         case 29:
-
-            // Coordinates:
-            coordinates[0] = -0.99667944226059658616319153254935;
-            coordinates[3] = -0.98254550526141317487092601578638;
-            coordinates[6] = -0.95728559577808772579820803698082;
-            coordinates[9] = -0.92118023295305878509375343608311;
-            coordinates[12] = -0.87463780492010279041779342125658;
-            coordinates[15] = -0.81818548761525244498957221457878;
-            coordinates[18] = -0.75246285173447713391261007721214;
-            coordinates[21] = -0.67821453760268651515618500539199;
-            coordinates[24] = -0.59628179713822782037958621118899;
-            coordinates[27] = -0.50759295512422764210262791962752;
-            coordinates[30] = -0.41315288817400866389070658603162;
-            coordinates[33] = -0.31403163786763993494819592319105;
-            coordinates[36] = -0.21135228616600107450637572890294;
-            coordinates[39] = -0.10627823013267923017098239243038;
-            coordinates[42] = 0;
-            coordinates[45] = 0.10627823013267923017098239243038;
-            coordinates[48] = 0.21135228616600107450637572890294;
-            coordinates[51] = 0.31403163786763993494819592319105;
-            coordinates[54] = 0.41315288817400866389070658603162;
-            coordinates[57] = 0.50759295512422764210262791962752;
-            coordinates[60] = 0.59628179713822782037958621118899;
-            coordinates[63] = 0.67821453760268651515618500539199;
-            coordinates[66] = 0.75246285173447713391261007721214;
-            coordinates[69] = 0.81818548761525244498957221457878;
-            coordinates[72] = 0.87463780492010279041779342125658;
-            coordinates[75] = 0.92118023295305878509375343608311;
-            coordinates[78] = 0.95728559577808772579820803698082;
-            coordinates[81] = 0.98254550526141317487092601578638;
-            coordinates[84] = 0.99667944226059658616319153254935;
-
-            // Weights:
-            weights[0] = 0.0085169038787464096542638133022498;
-            weights[1] = 0.019732085056122705983859801640396;
-            weights[2] = 0.030740492202093622644408525374617;
-            weights[3] = 0.041402062518682836104830010114077;
-            weights[4] = 0.051594826902497923912594381179543;
-            weights[5] = 0.061203090657079138542109848023907;
-            weights[6] = 0.070117933255051278569581486948879;
-            weights[7] = 0.07823832713576378382814488865968;
-            weights[8] = 0.085472257366172527545344849297208;
-            weights[9] = 0.091737757139258763347966411077111;
-            weights[10] = 0.096963834094408606301900074882689;
-            weights[11] = 0.1010912737599149661218205469075;
-            weights[12] = 0.10407331007772937391332847128512;
-            weights[13] = 0.10587615509732094140659132785219;
-            weights[14] = 0.10647938171831424424651112690968;
-            weights[15] = 0.10587615509732094140659132785219;
-            weights[16] = 0.10407331007772937391332847128512;
-            weights[17] = 0.1010912737599149661218205469075;
-            weights[18] = 0.096963834094408606301900074882689;
-            weights[19] = 0.091737757139258763347966411077111;
-            weights[20] = 0.085472257366172527545344849297208;
-            weights[21] = 0.07823832713576378382814488865968;
-            weights[22] = 0.070117933255051278569581486948879;
-            weights[23] = 0.061203090657079138542109848023907;
-            weights[24] = 0.051594826902497923912594381179543;
-            weights[25] = 0.041402062518682836104830010114077;
-            weights[26] = 0.030740492202093622644408525374617;
-            weights[27] = 0.019732085056122705983859801640396;
-            weights[28] = 0.0085169038787464096542638133022498;
-
+            coordinates.assign(gpcoordinates29, gpcoordinates29+3*29);
+            weights.assign(gpweights29, gpweights29+29);
             break;
-
         case 30:
-
-            // Coordinates:
-            coordinates[0] = -0.9968934840746495402716300509187;
-            coordinates[3] = -0.98366812327974720997003258160566;
-            coordinates[6] = -0.9600218649683075122168710255818;
-            coordinates[9] = -0.92620004742927432587932427708047;
-            coordinates[12] = -0.88256053579205268154311646253023;
-            coordinates[15] = -0.8295657623827683974428981197325;
-            coordinates[18] = -0.7677774321048261949179773409745;
-            coordinates[21] = -0.69785049479331579693229238802664;
-            coordinates[24] = -0.62052618298924286114047755643119;
-            coordinates[27] = -0.53662414814201989926416979331107;
-            coordinates[30] = -0.44703376953808917678060990032285;
-            coordinates[33] = -0.35270472553087811347103720708937;
-            coordinates[36] = -0.25463692616788984643980512981781;
-            coordinates[39] = -0.15386991360858354696379467274326;
-            coordinates[42] = -0.051471842555317695833025213166723;
-            coordinates[45] = 0.051471842555317695833025213166723;
-            coordinates[48] = 0.15386991360858354696379467274326;
-            coordinates[51] = 0.25463692616788984643980512981781;
-            coordinates[54] = 0.35270472553087811347103720708937;
-            coordinates[57] = 0.44703376953808917678060990032285;
-            coordinates[60] = 0.53662414814201989926416979331107;
-            coordinates[63] = 0.62052618298924286114047755643119;
-            coordinates[66] = 0.69785049479331579693229238802664;
-            coordinates[69] = 0.7677774321048261949179773409745;
-            coordinates[72] = 0.8295657623827683974428981197325;
-            coordinates[75] = 0.88256053579205268154311646253023;
-            coordinates[78] = 0.92620004742927432587932427708047;
-            coordinates[81] = 0.9600218649683075122168710255818;
-            coordinates[84] = 0.98366812327974720997003258160566;
-            coordinates[87] = 0.9968934840746495402716300509187;
-
-            // Weights:
-            weights[0] = 0.0079681924961666056154658834746736;
-            weights[1] = 0.018466468311090959142302131912047;
-            weights[2] = 0.028784707883323369349719179611292;
-            weights[3] = 0.038799192569627049596801936446348;
-            weights[4] = 0.048402672830594052902938140422808;
-            weights[5] = 0.057493156217619066481721689402056;
-            weights[6] = 0.065974229882180495128128515115962;
-            weights[7] = 0.073755974737705206268243850022191;
-            weights[8] = 0.08075589522942021535469493846053;
-            weights[9] = 0.086899787201082979802387530715126;
-            weights[10] = 0.092122522237786128717632707087619;
-            weights[11] = 0.09636873717464425963946862635181;
-            weights[12] = 0.099593420586795267062780282103569;
-            weights[13] = 0.10176238974840550459642895216855;
-            weights[14] = 0.10285265289355884034128563670542;
-            weights[15] = 0.10285265289355884034128563670542;
-            weights[16] = 0.10176238974840550459642895216855;
-            weights[17] = 0.099593420586795267062780282103569;
-            weights[18] = 0.09636873717464425963946862635181;
-            weights[19] = 0.092122522237786128717632707087619;
-            weights[20] = 0.086899787201082979802387530715126;
-            weights[21] = 0.08075589522942021535469493846053;
-            weights[22] = 0.073755974737705206268243850022191;
-            weights[23] = 0.065974229882180495128128515115962;
-            weights[24] = 0.057493156217619066481721689402056;
-            weights[25] = 0.048402672830594052902938140422808;
-            weights[26] = 0.038799192569627049596801936446348;
-            weights[27] = 0.028784707883323369349719179611292;
-            weights[28] = 0.018466468311090959142302131912047;
-            weights[29] = 0.0079681924961666056154658834746736;
-
+            coordinates.assign(gpcoordinates30, gpcoordinates30+3*30);
+            weights.assign(gpweights30, gpweights30+30);
             break;
             
         default:
@@ -2,14 +2,13 @@
 
 int gppyramid::count(int integrationorder)
 {
-    std::cout << "Error in 'gppyramid' namespace: Gauss points have not been defined yet for pyramids" << std::endl;
-    abort();
+    // There are no tabulated rules for pyramids, the collapsed rule is used:
+    return gpcollapsed::count(7, integrationorder);
 }
 
 void gppyramid::set(int integrationorder, std::vector<double>& coordinates, std::vector<double>& weights)
 {
-    std::cout << "Error in 'gppyramid' namespace: Gauss points have not been defined yet for pyramids" << std::endl;
-    abort();
+    gpcollapsed::set(7, integrationorder, coordinates, weights);
 }
 
 
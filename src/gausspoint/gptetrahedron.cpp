@@ -1,5 +1,3949 @@
 #include "gptetrahedron.h"
 
+
+// Tabulated rules with one line per point (ki eta phi coordinates):
+
+static constexpr double gpcoordinates0[] =
+{
+    0.25,0.25,0.25
+};
+static constexpr double gpweights0[] =
+{
+    1.0/6.0
+};
+
+static constexpr double gpcoordinates2[] =
+{
+    0.13819660112500001,0.13819660112500001,0.13819660112500001,
+    0.58541019662500005,0.13819660112500001,0.13819660112500001,
+    0.13819660112500001,0.58541019662500005,0.13819660112500001,
+    0.13819660112500001,0.13819660112500001,0.58541019662500005
+};
+static constexpr double gpweights2[] =
+{
+    0.041666666666666699,0.041666666666666699,0.041666666666666699,0.041666666666666699
+};
+
+static constexpr double gpcoordinates3[] =
+{
+    0.25,0.25,0.25,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667
+};
+static constexpr double gpweights3[] =
+{
+    -0.133333333333333,0.074999999999999997,0.074999999999999997,0.074999999999999997,
+    0.074999999999999997
+};
+
+static constexpr double gpcoordinates4[] =
+{
+    0.25,0.25,0.25,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.39940357616700001,0.39940357616700001,0.10059642383300001,
+    0.39940357616700001,0.10059642383300001,0.39940357616700001,
+    0.10059642383300001,0.39940357616700001,0.39940357616700001,
+    0.39940357616700001,0.10059642383300001,0.10059642383300001,
+    0.10059642383300001,0.39940357616700001,0.10059642383300001,
+    0.10059642383300001,0.10059642383300001,0.39940357616700001
+};
+static constexpr double gpweights4[] =
+{
+    -0.013155555555499999,0.0076222222222000003,0.0076222222222000003,0.0076222222222000003,
+    0.0076222222222000003,0.0248888888888,0.0248888888888,0.0248888888888,
+    0.0248888888888,0.0248888888888,0.0248888888888
+};
+
+static constexpr double gpcoordinates5[] =
+{
+    0.092735250310900005,0.092735250310900005,0.092735250310900005,
+    0.72179424906699996,0.092735250310900005,0.092735250310900005,
+    0.092735250310900005,0.72179424906699996,0.092735250310900005,
+    0.092735250310900005,0.092735250310900005,0.72179424906699996,
+    0.31088591926300002,0.31088591926300002,0.31088591926300002,
+    0.067342242210100003,0.31088591926300002,0.31088591926300002,
+    0.31088591926300002,0.067342242210100003,0.31088591926300002,
+    0.31088591926300002,0.31088591926300002,0.067342242210100003,
+    0.45449629587399998,0.45449629587399998,0.045503704125600002,
+    0.45449629587399998,0.045503704125600002,0.45449629587399998,
+    0.045503704125600002,0.45449629587399998,0.45449629587399998,
+    0.45449629587399998,0.045503704125600002,0.045503704125600002,
+    0.045503704125600002,0.45449629587399998,0.045503704125600002,
+    0.045503704125600002,0.045503704125600002,0.45449629587399998
+};
+static constexpr double gpweights5[] =
+{
+    0.012248840519400001,0.012248840519400001,0.012248840519400001,0.012248840519400001,
+    0.018781320952999999,0.018781320952999999,0.018781320952999999,0.018781320952999999,
+    0.0070910034628499999,0.0070910034628499999,0.0070910034628499999,0.0070910034628499999,
+    0.0070910034628499999,0.0070910034628499999
+};
+
+static constexpr double gpcoordinates6[] =
+{
+    0.21460287125899999,0.21460287125899999,0.21460287125899999,
+    0.35619138622300001,0.21460287125899999,0.21460287125899999,
+    0.21460287125899999,0.35619138622300001,0.21460287125899999,
+    0.21460287125899999,0.21460287125899999,0.35619138622300001,
+    0.040673958534599999,0.040673958534599999,0.040673958534599999,
+    0.87797812439599998,0.040673958534599999,0.040673958534599999,
+    0.040673958534599999,0.87797812439599998,0.040673958534599999,
+    0.040673958534599999,0.040673958534599999,0.87797812439599998,
+    0.32233789014199998,0.32233789014199998,0.32233789014199998,
+    0.032986329573200003,0.32233789014199998,0.32233789014199998,
+    0.32233789014199998,0.032986329573200003,0.32233789014199998,
+    0.32233789014199998,0.32233789014199998,0.032986329573200003,
+    0.063661001874999998,0.063661001874999998,0.26967233145800001,
+    0.063661001874999998,0.26967233145800001,0.063661001874999998,
+    0.063661001874999998,0.063661001874999998,0.60300566479200002,
+    0.063661001874999998,0.60300566479200002,0.063661001874999998,
+    0.063661001874999998,0.26967233145800001,0.60300566479200002,
+    0.063661001874999998,0.60300566479200002,0.26967233145800001,
+    0.26967233145800001,0.063661001874999998,0.063661001874999998,
+    0.26967233145800001,0.063661001874999998,0.60300566479200002,
+    0.26967233145800001,0.60300566479200002,0.063661001874999998,
+    0.60300566479200002,0.063661001874999998,0.26967233145800001,
+    0.60300566479200002,0.063661001874999998,0.063661001874999998,
+    0.60300566479200002,0.26967233145800001,0.063661001874999998
+};
+static constexpr double gpweights6[] =
+{
+    0.0066537917097000002,0.0066537917097000002,0.0066537917097000002,0.0066537917097000002,
+    0.001679535175883,0.001679535175883,0.001679535175883,0.001679535175883,
+    0.0092261969239500006,0.0092261969239500006,0.0092261969239500006,0.0092261969239500006,
+    0.0080357142857169998,0.0080357142857169998,0.0080357142857169998,0.0080357142857169998,
+    0.0080357142857169998,0.0080357142857169998,0.0080357142857169998,0.0080357142857169998,
+    0.0080357142857169998,0.0080357142857169998,0.0080357142857169998,0.0080357142857169998
+};
+
+static constexpr double gpcoordinates7[] =
+{
+    0.5,0.5,0,
+    0.5,0,0.5,
+    0,0.5,0.5,
+    0,0,0.5,
+    0,0.5,0,
+    0.5,0,0,
+    0.25,0.25,0.25,
+    0.078213192330299997,0.078213192330299997,0.078213192330299997,
+    0.078213192330299997,0.078213192330299997,0.76536042300899998,
+    0.078213192330299997,0.76536042300899998,0.078213192330299997,
+    0.76536042300899998,0.078213192330299997,0.078213192330299997,
+    0.121843216664,0.121843216664,0.121843216664,
+    0.121843216664,0.121843216664,0.63447035000800001,
+    0.121843216664,0.63447035000800001,0.121843216664,
+    0.63447035000800001,0.121843216664,0.121843216664,
+    0.33253916444600001,0.33253916444600001,0.33253916444600001,
+    0.33253916444600001,0.33253916444600001,0.00238250666074,
+    0.33253916444600001,0.00238250666074,0.33253916444600001,
+    0.00238250666074,0.33253916444600001,0.33253916444600001,
+    0.10000000000000001,0.10000000000000001,0.20000000000000001,
+    0.10000000000000001,0.20000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.59999999999999998,
+    0.10000000000000001,0.59999999999999998,0.10000000000000001,
+    0.10000000000000001,0.20000000000000001,0.59999999999999998,
+    0.10000000000000001,0.59999999999999998,0.20000000000000001,
+    0.20000000000000001,0.10000000000000001,0.10000000000000001,
+    0.20000000000000001,0.10000000000000001,0.59999999999999998,
+    0.20000000000000001,0.59999999999999998,0.10000000000000001,
+    0.59999999999999998,0.10000000000000001,0.20000000000000001,
+    0.59999999999999998,0.10000000000000001,0.10000000000000001,
+    0.59999999999999998,0.20000000000000001,0.10000000000000001
+};
+static constexpr double gpweights7[] =
+{
+    0.00097001763668499996,0.00097001763668499996,0.00097001763668499996,0.00097001763668499996,
+    0.00097001763668499996,0.00097001763668499996,0.018264223466167,0.010599941524416999,
+    0.010599941524416999,0.010599941524416999,0.010599941524416999,-0.062517740114333004,
+    -0.062517740114333004,-0.062517740114333004,-0.062517740114333004,0.0048914252630670001,
+    0.0048914252630670001,0.0048914252630670001,0.0048914252630670001,0.027557319223999999,
+    0.027557319223999999,0.027557319223999999,0.027557319223999999,0.027557319223999999,
+    0.027557319223999999,0.027557319223999999,0.027557319223999999,0.027557319223999999,
+    0.027557319223999999,0.027557319223999999,0.027557319223999999
+};
+
+static constexpr double gpcoordinates8[] =
+{
+    0.25,0.25,0.25,
+    0.206829931611,0.206829931611,0.206829931611,
+    0.206829931611,0.206829931611,0.37951020516799999,
+    0.206829931611,0.37951020516799999,0.206829931611,
+    0.37951020516799999,0.206829931611,0.206829931611,
+    0.082103588310500006,0.082103588310500006,0.082103588310500006,
+    0.082103588310500006,0.082103588310500006,0.75368923506800001,
+    0.082103588310500006,0.75368923506800001,0.082103588310500006,
+    0.75368923506800001,0.082103588310500006,0.082103588310500006,
+    0.0057819505052,0.0057819505052,0.0057819505052,
+    0.0057819505052,0.0057819505052,0.98265414848400001,
+    0.0057819505052,0.98265414848400001,0.0057819505052,
+    0.98265414848400001,0.0057819505052,0.0057819505052,
+    0.050532740018899999,0.050532740018899999,0.44946725998100001,
+    0.050532740018899999,0.44946725998100001,0.050532740018899999,
+    0.44946725998100001,0.050532740018899999,0.050532740018899999,
+    0.050532740018899999,0.44946725998100001,0.44946725998100001,
+    0.44946725998100001,0.050532740018899999,0.44946725998100001,
+    0.44946725998100001,0.44946725998100001,0.050532740018899999,
+    0.22906653611700001,0.22906653611700001,0.035639582788499997,
+    0.22906653611700001,0.035639582788499997,0.22906653611700001,
+    0.22906653611700001,0.22906653611700001,0.50622734497800004,
+    0.22906653611700001,0.50622734497800004,0.22906653611700001,
+    0.22906653611700001,0.035639582788499997,0.50622734497800004,
+    0.22906653611700001,0.50622734497800004,0.035639582788499997,
+    0.035639582788499997,0.22906653611700001,0.22906653611700001,
+    0.035639582788499997,0.22906653611700001,0.50622734497800004,
+    0.035639582788499997,0.50622734497800004,0.22906653611700001,
+    0.50622734497800004,0.22906653611700001,0.035639582788499997,
+    0.50622734497800004,0.22906653611700001,0.22906653611700001,
+    0.50622734497800004,0.035639582788499997,0.22906653611700001,
+    0.036607749553200002,0.036607749553200002,0.19048604193499999,
+    0.036607749553200002,0.19048604193499999,0.036607749553200002,
+    0.036607749553200002,0.036607749553200002,0.73629845895900004,
+    0.036607749553200002,0.73629845895900004,0.036607749553200002,
+    0.036607749553200002,0.19048604193499999,0.73629845895900004,
+    0.036607749553200002,0.73629845895900004,0.19048604193499999,
+    0.19048604193499999,0.036607749553200002,0.036607749553200002,
+    0.19048604193499999,0.036607749553200002,0.73629845895900004,
+    0.19048604193499999,0.73629845895900004,0.036607749553200002,
+    0.73629845895900004,0.036607749553200002,0.19048604193499999,
+    0.73629845895900004,0.036607749553200002,0.036607749553200002,
+    0.73629845895900004,0.19048604193499999,0.036607749553200002
+};
+static constexpr double gpweights8[] =
+{
+    -0.020500188658666998,0.014250305822867,0.014250305822867,0.014250305822867,
+    0.014250305822867,0.001967033313133,0.001967033313133,0.001967033313133,
+    0.001967033313133,0.00016983410909299999,0.00016983410909299999,0.00016983410909299999,
+    0.00016983410909299999,0.0045796838244670001,0.0045796838244670001,0.0045796838244670001,
+    0.0045796838244670001,0.0045796838244670001,0.0045796838244670001,0.0057044858086830004,
+    0.0057044858086830004,0.0057044858086830004,0.0057044858086830004,0.0057044858086830004,
+    0.0057044858086830004,0.0057044858086830004,0.0057044858086830004,0.0057044858086830004,
+    0.0057044858086830004,0.0057044858086830004,0.0057044858086830004,0.002140519141167,
+    0.002140519141167,0.002140519141167,0.002140519141167,0.002140519141167,
+    0.002140519141167,0.002140519141167,0.002140519141167,0.002140519141167,
+    0.002140519141167,0.002140519141167,0.002140519141167
+};
+
+static constexpr double gpcoordinates9[] =
+{
+    0.25,0.25,0.25,
+    0.0483510385497,0.0483510385497,0.0483510385497,
+    0.0483510385497,0.0483510385497,0.85494688435099997,
+    0.0483510385497,0.85494688435099997,0.0483510385497,
+    0.85494688435099997,0.0483510385497,0.0483510385497,
+    0.32457928011800002,0.32457928011800002,0.32457928011800002,
+    0.32457928011800002,0.32457928011800002,0.0262621596464,
+    0.32457928011800002,0.0262621596464,0.32457928011800002,
+    0.0262621596464,0.32457928011800002,0.32457928011800002,
+    0.114616540224,0.114616540224,0.114616540224,
+    0.114616540224,0.114616540224,0.65615037932800002,
+    0.114616540224,0.65615037932800002,0.114616540224,
+    0.65615037932800002,0.114616540224,0.114616540224,
+    0.225489951912,0.225489951912,0.225489951912,
+    0.225489951912,0.225489951912,0.32353014426499999,
+    0.225489951912,0.32353014426499999,0.225489951912,
+    0.32353014426499999,0.225489951912,0.225489951912,
+    0.13162780924699999,0.13162780924699999,0.083664701617199994,
+    0.13162780924699999,0.083664701617199994,0.13162780924699999,
+    0.13162780924699999,0.13162780924699999,0.65307967988899995,
+    0.13162780924699999,0.65307967988899995,0.13162780924699999,
+    0.13162780924699999,0.083664701617199994,0.65307967988899995,
+    0.13162780924699999,0.65307967988899995,0.083664701617199994,
+    0.083664701617199994,0.13162780924699999,0.13162780924699999,
+    0.083664701617199994,0.13162780924699999,0.65307967988899995,
+    0.083664701617199994,0.65307967988899995,0.13162780924699999,
+    0.65307967988899995,0.13162780924699999,0.083664701617199994,
+    0.65307967988899995,0.13162780924699999,0.13162780924699999,
+    0.65307967988899995,0.083664701617199994,0.13162780924699999,
+    0.43395146141099999,0.43395146141099999,0.10776985954899999,
+    0.43395146141099999,0.10776985954899999,0.43395146141099999,
+    0.43395146141099999,0.43395146141099999,0.024327217627800001,
+    0.43395146141099999,0.024327217627800001,0.43395146141099999,
+    0.43395146141099999,0.10776985954899999,0.024327217627800001,
+    0.43395146141099999,0.024327217627800001,0.10776985954899999,
+    0.10776985954899999,0.43395146141099999,0.43395146141099999,
+    0.10776985954899999,0.43395146141099999,0.024327217627800001,
+    0.10776985954899999,0.024327217627800001,0.43395146141099999,
+    0.024327217627800001,0.43395146141099999,0.10776985954899999,
+    0.024327217627800001,0.43395146141099999,0.43395146141099999,
+    0.024327217627800001,0.10776985954899999,0.43395146141099999,
+    -0.00137627731814,-0.00137627731814,0.27655347263699998,
+    -0.00137627731814,0.27655347263699998,-0.00137627731814,
+    -0.00137627731814,-0.00137627731814,0.72619908199899996,
+    -0.00137627731814,0.72619908199899996,-0.00137627731814,
+    -0.00137627731814,0.27655347263699998,0.72619908199899996,
+    -0.00137627731814,0.72619908199899996,0.27655347263699998,
+    0.27655347263699998,-0.00137627731814,-0.00137627731814,
+    0.27655347263699998,-0.00137627731814,0.72619908199899996,
+    0.27655347263699998,0.72619908199899996,-0.00137627731814,
+    0.72619908199899996,-0.00137627731814,0.27655347263699998,
+    0.72619908199899996,-0.00137627731814,-0.00137627731814,
+    0.72619908199899996,0.27655347263699998,-0.00137627731814
+};
+static constexpr double gpweights9[] =
+{
+    -0.13779903832616699,0.0018653365690829999,0.0018653365690829999,0.0018653365690829999,
+    0.0018653365690829999,0.0043094239695,0.0043094239695,0.0043094239695,
+    0.0043094239695,-0.090184766481166995,-0.090184766481166995,-0.090184766481166995,
+    -0.090184766481166995,0.044672576202500001,0.044672576202500001,0.044672576202500001,
+    0.044672576202500001,0.034700405884499998,0.034700405884499998,0.034700405884499998,
+    0.034700405884499998,0.034700405884499998,0.034700405884499998,0.034700405884499998,
+    0.034700405884499998,0.034700405884499998,0.034700405884499998,0.034700405884499998,
+    0.034700405884499998,0.0033525839026669999,0.0033525839026669999,0.0033525839026669999,
+    0.0033525839026669999,0.0033525839026669999,0.0033525839026669999,0.0033525839026669999,
+    0.0033525839026669999,0.0033525839026669999,0.0033525839026669999,0.0033525839026669999,
+    0.0033525839026669999,0.00043162887555699998,0.00043162887555699998,0.00043162887555699998,
+    0.00043162887555699998,0.00043162887555699998,0.00043162887555699998,0.00043162887555699998,
+    0.00043162887555699998,0.00043162887555699998,0.00043162887555699998,0.00043162887555699998,
+    0.00043162887555699998
+};
+
+static constexpr double gpcoordinates10[] =
+{
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.21428571428599999,0.64285714285700002,
+    0.071428571428599999,0.35714285714299998,0.5,
+    0.071428571428599999,0.5,0.35714285714299998,
+    0.071428571428599999,0.64285714285700002,0.21428571428599999,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.64285714285700002,
+    0.21428571428599999,0.21428571428599999,0.5,
+    0.21428571428599999,0.35714285714299998,0.35714285714299998,
+    0.21428571428599999,0.5,0.21428571428599999,
+    0.21428571428599999,0.64285714285700002,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.5,
+    0.35714285714299998,0.21428571428599999,0.35714285714299998,
+    0.35714285714299998,0.35714285714299998,0.21428571428599999,
+    0.35714285714299998,0.5,0.071428571428599999,
+    0.5,0.071428571428599999,0.35714285714299998,
+    0.5,0.21428571428599999,0.21428571428599999,
+    0.5,0.35714285714299998,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.21428571428599999,
+    0.64285714285700002,0.21428571428599999,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.64285714285700002,
+    0.071428571428599999,0.21428571428599999,0.5,
+    0.071428571428599999,0.35714285714299998,0.35714285714299998,
+    0.071428571428599999,0.5,0.21428571428599999,
+    0.071428571428599999,0.64285714285700002,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.5,
+    0.21428571428599999,0.21428571428599999,0.35714285714299998,
+    0.21428571428599999,0.35714285714299998,0.21428571428599999,
+    0.21428571428599999,0.5,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.35714285714299998,
+    0.35714285714299998,0.21428571428599999,0.21428571428599999,
+    0.35714285714299998,0.35714285714299998,0.071428571428599999,
+    0.5,0.071428571428599999,0.21428571428599999,
+    0.5,0.21428571428599999,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.5,
+    0.071428571428599999,0.21428571428599999,0.35714285714299998,
+    0.071428571428599999,0.35714285714299998,0.21428571428599999,
+    0.071428571428599999,0.5,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.35714285714299998,
+    0.21428571428599999,0.21428571428599999,0.21428571428599999,
+    0.21428571428599999,0.35714285714299998,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.21428571428599999,
+    0.35714285714299998,0.21428571428599999,0.071428571428599999,
+    0.5,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.35714285714299998,
+    0.071428571428599999,0.21428571428599999,0.21428571428599999,
+    0.071428571428599999,0.35714285714299998,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.21428571428599999,
+    0.21428571428599999,0.21428571428599999,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.21428571428599999,
+    0.071428571428599999,0.21428571428599999,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.083333333333299994,0.083333333333299994,0.75,
+    0.083333333333299994,0.25,0.58333333333299997,
+    0.083333333333299994,0.41666666666699997,0.41666666666699997,
+    0.083333333333299994,0.58333333333299997,0.25,
+    0.083333333333299994,0.75,0.083333333333299994,
+    0.25,0.083333333333299994,0.58333333333299997,
+    0.25,0.25,0.41666666666699997,
+    0.25,0.41666666666699997,0.25,
+    0.25,0.58333333333299997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.41666666666699997,
+    0.41666666666699997,0.25,0.25,
+    0.41666666666699997,0.41666666666699997,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.25,
+    0.58333333333299997,0.25,0.083333333333299994,
+    0.75,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.58333333333299997,
+    0.083333333333299994,0.25,0.41666666666699997,
+    0.083333333333299994,0.41666666666699997,0.25,
+    0.083333333333299994,0.58333333333299997,0.083333333333299994,
+    0.25,0.083333333333299994,0.41666666666699997,
+    0.25,0.25,0.25,
+    0.25,0.41666666666699997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.25,
+    0.41666666666699997,0.25,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.41666666666699997,
+    0.083333333333299994,0.25,0.25,
+    0.083333333333299994,0.41666666666699997,0.083333333333299994,
+    0.25,0.083333333333299994,0.25,
+    0.25,0.25,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.25,
+    0.083333333333299994,0.25,0.083333333333299994,
+    0.25,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.083333333333299994,
+    0.10000000000000001,0.10000000000000001,0.69999999999999996,
+    0.10000000000000001,0.29999999999999999,0.5,
+    0.10000000000000001,0.5,0.29999999999999999,
+    0.10000000000000001,0.69999999999999996,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.5,
+    0.29999999999999999,0.29999999999999999,0.29999999999999999,
+    0.29999999999999999,0.5,0.10000000000000001,
+    0.5,0.10000000000000001,0.29999999999999999,
+    0.5,0.29999999999999999,0.10000000000000001,
+    0.69999999999999996,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.5,
+    0.10000000000000001,0.29999999999999999,0.29999999999999999,
+    0.10000000000000001,0.5,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.29999999999999999,
+    0.29999999999999999,0.29999999999999999,0.10000000000000001,
+    0.5,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.29999999999999999,
+    0.10000000000000001,0.29999999999999999,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.10000000000000001,
+    0.125,0.125,0.625,
+    0.125,0.375,0.375,
+    0.125,0.625,0.125,
+    0.375,0.125,0.375,
+    0.375,0.375,0.125,
+    0.625,0.125,0.125,
+    0.125,0.125,0.375,
+    0.125,0.375,0.125,
+    0.375,0.125,0.125,
+    0.125,0.125,0.125,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.25,0.25,0.25
+};
+static constexpr double gpweights10[] =
+{
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    0.045362824065000001,0.045362824065000001,0.045362824065000001,0.045362824065000001,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,-0.11652347652349999,
+    -0.11652347652349999,-0.11652347652349999,-0.11652347652349999,0.10193728997983301,
+    0.10193728997983301,0.10193728997983301,0.10193728997983301,0.10193728997983301,
+    0.10193728997983301,0.10193728997983301,0.10193728997983301,0.10193728997983301,
+    0.10193728997983301,0.10193728997983301,0.10193728997983301,0.10193728997983301,
+    0.10193728997983301,0.10193728997983301,0.10193728997983301,0.10193728997983301,
+    0.10193728997983301,0.10193728997983301,0.10193728997983301,-0.035025386136499997,
+    -0.035025386136499997,-0.035025386136499997,-0.035025386136499997,-0.035025386136499997,
+    -0.035025386136499997,-0.035025386136499997,-0.035025386136499997,-0.035025386136499997,
+    -0.035025386136499997,0.0040680803571499996,0.0040680803571499996,0.0040680803571499996,
+    0.0040680803571499996,-9.4062316284000003e-05
+};
+
+static constexpr double gpcoordinates12[] =
+{
+    0.0625,0.0625,0.8125,
+    0.0625,0.1875,0.6875,
+    0.0625,0.3125,0.5625,
+    0.0625,0.4375,0.4375,
+    0.0625,0.5625,0.3125,
+    0.0625,0.6875,0.1875,
+    0.0625,0.8125,0.0625,
+    0.1875,0.0625,0.6875,
+    0.1875,0.1875,0.5625,
+    0.1875,0.3125,0.4375,
+    0.1875,0.4375,0.3125,
+    0.1875,0.5625,0.1875,
+    0.1875,0.6875,0.0625,
+    0.3125,0.0625,0.5625,
+    0.3125,0.1875,0.4375,
+    0.3125,0.3125,0.3125,
+    0.3125,0.4375,0.1875,
+    0.3125,0.5625,0.0625,
+    0.4375,0.0625,0.4375,
+    0.4375,0.1875,0.3125,
+    0.4375,0.3125,0.1875,
+    0.4375,0.4375,0.0625,
+    0.5625,0.0625,0.3125,
+    0.5625,0.1875,0.1875,
+    0.5625,0.3125,0.0625,
+    0.6875,0.0625,0.1875,
+    0.6875,0.1875,0.0625,
+    0.8125,0.0625,0.0625,
+    0.0625,0.0625,0.6875,
+    0.0625,0.1875,0.5625,
+    0.0625,0.3125,0.4375,
+    0.0625,0.4375,0.3125,
+    0.0625,0.5625,0.1875,
+    0.0625,0.6875,0.0625,
+    0.1875,0.0625,0.5625,
+    0.1875,0.1875,0.4375,
+    0.1875,0.3125,0.3125,
+    0.1875,0.4375,0.1875,
+    0.1875,0.5625,0.0625,
+    0.3125,0.0625,0.4375,
+    0.3125,0.1875,0.3125,
+    0.3125,0.3125,0.1875,
+    0.3125,0.4375,0.0625,
+    0.4375,0.0625,0.3125,
+    0.4375,0.1875,0.1875,
+    0.4375,0.3125,0.0625,
+    0.5625,0.0625,0.1875,
+    0.5625,0.1875,0.0625,
+    0.6875,0.0625,0.0625,
+    0.0625,0.0625,0.5625,
+    0.0625,0.1875,0.4375,
+    0.0625,0.3125,0.3125,
+    0.0625,0.4375,0.1875,
+    0.0625,0.5625,0.0625,
+    0.1875,0.0625,0.4375,
+    0.1875,0.1875,0.3125,
+    0.1875,0.3125,0.1875,
+    0.1875,0.4375,0.0625,
+    0.3125,0.0625,0.3125,
+    0.3125,0.1875,0.1875,
+    0.3125,0.3125,0.0625,
+    0.4375,0.0625,0.1875,
+    0.4375,0.1875,0.0625,
+    0.5625,0.0625,0.0625,
+    0.0625,0.0625,0.4375,
+    0.0625,0.1875,0.3125,
+    0.0625,0.3125,0.1875,
+    0.0625,0.4375,0.0625,
+    0.1875,0.0625,0.3125,
+    0.1875,0.1875,0.1875,
+    0.1875,0.3125,0.0625,
+    0.3125,0.0625,0.1875,
+    0.3125,0.1875,0.0625,
+    0.4375,0.0625,0.0625,
+    0.0625,0.0625,0.3125,
+    0.0625,0.1875,0.1875,
+    0.0625,0.3125,0.0625,
+    0.1875,0.0625,0.1875,
+    0.1875,0.1875,0.0625,
+    0.3125,0.0625,0.0625,
+    0.0625,0.0625,0.1875,
+    0.0625,0.1875,0.0625,
+    0.1875,0.0625,0.0625,
+    0.0625,0.0625,0.0625,
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.21428571428599999,0.64285714285700002,
+    0.071428571428599999,0.35714285714299998,0.5,
+    0.071428571428599999,0.5,0.35714285714299998,
+    0.071428571428599999,0.64285714285700002,0.21428571428599999,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.64285714285700002,
+    0.21428571428599999,0.21428571428599999,0.5,
+    0.21428571428599999,0.35714285714299998,0.35714285714299998,
+    0.21428571428599999,0.5,0.21428571428599999,
+    0.21428571428599999,0.64285714285700002,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.5,
+    0.35714285714299998,0.21428571428599999,0.35714285714299998,
+    0.35714285714299998,0.35714285714299998,0.21428571428599999,
+    0.35714285714299998,0.5,0.071428571428599999,
+    0.5,0.071428571428599999,0.35714285714299998,
+    0.5,0.21428571428599999,0.21428571428599999,
+    0.5,0.35714285714299998,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.21428571428599999,
+    0.64285714285700002,0.21428571428599999,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.64285714285700002,
+    0.071428571428599999,0.21428571428599999,0.5,
+    0.071428571428599999,0.35714285714299998,0.35714285714299998,
+    0.071428571428599999,0.5,0.21428571428599999,
+    0.071428571428599999,0.64285714285700002,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.5,
+    0.21428571428599999,0.21428571428599999,0.35714285714299998,
+    0.21428571428599999,0.35714285714299998,0.21428571428599999,
+    0.21428571428599999,0.5,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.35714285714299998,
+    0.35714285714299998,0.21428571428599999,0.21428571428599999,
+    0.35714285714299998,0.35714285714299998,0.071428571428599999,
+    0.5,0.071428571428599999,0.21428571428599999,
+    0.5,0.21428571428599999,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.5,
+    0.071428571428599999,0.21428571428599999,0.35714285714299998,
+    0.071428571428599999,0.35714285714299998,0.21428571428599999,
+    0.071428571428599999,0.5,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.35714285714299998,
+    0.21428571428599999,0.21428571428599999,0.21428571428599999,
+    0.21428571428599999,0.35714285714299998,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.21428571428599999,
+    0.35714285714299998,0.21428571428599999,0.071428571428599999,
+    0.5,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.35714285714299998,
+    0.071428571428599999,0.21428571428599999,0.21428571428599999,
+    0.071428571428599999,0.35714285714299998,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.21428571428599999,
+    0.21428571428599999,0.21428571428599999,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.21428571428599999,
+    0.071428571428599999,0.21428571428599999,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.083333333333299994,0.083333333333299994,0.75,
+    0.083333333333299994,0.25,0.58333333333299997,
+    0.083333333333299994,0.41666666666699997,0.41666666666699997,
+    0.083333333333299994,0.58333333333299997,0.25,
+    0.083333333333299994,0.75,0.083333333333299994,
+    0.25,0.083333333333299994,0.58333333333299997,
+    0.25,0.25,0.41666666666699997,
+    0.25,0.41666666666699997,0.25,
+    0.25,0.58333333333299997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.41666666666699997,
+    0.41666666666699997,0.25,0.25,
+    0.41666666666699997,0.41666666666699997,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.25,
+    0.58333333333299997,0.25,0.083333333333299994,
+    0.75,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.58333333333299997,
+    0.083333333333299994,0.25,0.41666666666699997,
+    0.083333333333299994,0.41666666666699997,0.25,
+    0.083333333333299994,0.58333333333299997,0.083333333333299994,
+    0.25,0.083333333333299994,0.41666666666699997,
+    0.25,0.25,0.25,
+    0.25,0.41666666666699997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.25,
+    0.41666666666699997,0.25,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.41666666666699997,
+    0.083333333333299994,0.25,0.25,
+    0.083333333333299994,0.41666666666699997,0.083333333333299994,
+    0.25,0.083333333333299994,0.25,
+    0.25,0.25,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.25,
+    0.083333333333299994,0.25,0.083333333333299994,
+    0.25,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.083333333333299994,
+    0.10000000000000001,0.10000000000000001,0.69999999999999996,
+    0.10000000000000001,0.29999999999999999,0.5,
+    0.10000000000000001,0.5,0.29999999999999999,
+    0.10000000000000001,0.69999999999999996,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.5,
+    0.29999999999999999,0.29999999999999999,0.29999999999999999,
+    0.29999999999999999,0.5,0.10000000000000001,
+    0.5,0.10000000000000001,0.29999999999999999,
+    0.5,0.29999999999999999,0.10000000000000001,
+    0.69999999999999996,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.5,
+    0.10000000000000001,0.29999999999999999,0.29999999999999999,
+    0.10000000000000001,0.5,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.29999999999999999,
+    0.29999999999999999,0.29999999999999999,0.10000000000000001,
+    0.5,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.29999999999999999,
+    0.10000000000000001,0.29999999999999999,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.10000000000000001,
+    0.125,0.125,0.625,
+    0.125,0.375,0.375,
+    0.125,0.625,0.125,
+    0.375,0.125,0.375,
+    0.375,0.375,0.125,
+    0.625,0.125,0.125,
+    0.125,0.125,0.375,
+    0.125,0.375,0.125,
+    0.375,0.125,0.125,
+    0.125,0.125,0.125,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.25,0.25,0.25
+};
+static constexpr double gpweights12[] =
+{
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    0.052550909016500003,0.052550909016500003,0.052550909016500003,0.052550909016500003,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    -0.148185225279333,-0.148185225279333,-0.148185225279333,-0.148185225279333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,0.149815898387333,
+    0.149815898387333,0.149815898387333,0.149815898387333,-0.065344416653666998,
+    -0.065344416653666998,-0.065344416653666998,-0.065344416653666998,-0.065344416653666998,
+    -0.065344416653666998,-0.065344416653666998,-0.065344416653666998,-0.065344416653666998,
+    -0.065344416653666998,-0.065344416653666998,-0.065344416653666998,-0.065344416653666998,
+    -0.065344416653666998,-0.065344416653666998,-0.065344416653666998,-0.065344416653666998,
+    -0.065344416653666998,-0.065344416653666998,-0.065344416653666998,0.011675128712167001,
+    0.011675128712167001,0.011675128712167001,0.011675128712167001,0.011675128712167001,
+    0.011675128712167001,0.011675128712167001,0.011675128712167001,0.011675128712167001,
+    0.011675128712167001,-0.00066568587662299995,-0.00066568587662299995,-0.00066568587662299995,
+    -0.00066568587662299995,6.2708210859999998e-06
+};
+
+static constexpr double gpcoordinates14[] =
+{
+    0.055555555555600003,0.055555555555600003,0.83333333333299997,
+    0.055555555555600003,0.166666666667,0.72222222222200005,
+    0.055555555555600003,0.277777777778,0.61111111111100003,
+    0.055555555555600003,0.38888888888899997,0.5,
+    0.055555555555600003,0.5,0.38888888888899997,
+    0.055555555555600003,0.61111111111100003,0.277777777778,
+    0.055555555555600003,0.72222222222200005,0.166666666667,
+    0.055555555555600003,0.83333333333299997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.72222222222200005,
+    0.166666666667,0.166666666667,0.61111111111100003,
+    0.166666666667,0.277777777778,0.5,
+    0.166666666667,0.38888888888899997,0.38888888888899997,
+    0.166666666667,0.5,0.277777777778,
+    0.166666666667,0.61111111111100003,0.166666666667,
+    0.166666666667,0.72222222222200005,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.61111111111100003,
+    0.277777777778,0.166666666667,0.5,
+    0.277777777778,0.277777777778,0.38888888888899997,
+    0.277777777778,0.38888888888899997,0.277777777778,
+    0.277777777778,0.5,0.166666666667,
+    0.277777777778,0.61111111111100003,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.5,
+    0.38888888888899997,0.166666666667,0.38888888888899997,
+    0.38888888888899997,0.277777777778,0.277777777778,
+    0.38888888888899997,0.38888888888899997,0.166666666667,
+    0.38888888888899997,0.5,0.055555555555600003,
+    0.5,0.055555555555600003,0.38888888888899997,
+    0.5,0.166666666667,0.277777777778,
+    0.5,0.277777777778,0.166666666667,
+    0.5,0.38888888888899997,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.277777777778,
+    0.61111111111100003,0.166666666667,0.166666666667,
+    0.61111111111100003,0.277777777778,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.166666666667,
+    0.72222222222200005,0.166666666667,0.055555555555600003,
+    0.83333333333299997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.72222222222200005,
+    0.055555555555600003,0.166666666667,0.61111111111100003,
+    0.055555555555600003,0.277777777778,0.5,
+    0.055555555555600003,0.38888888888899997,0.38888888888899997,
+    0.055555555555600003,0.5,0.277777777778,
+    0.055555555555600003,0.61111111111100003,0.166666666667,
+    0.055555555555600003,0.72222222222200005,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.61111111111100003,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.277777777778,0.38888888888899997,
+    0.166666666667,0.38888888888899997,0.277777777778,
+    0.166666666667,0.5,0.166666666667,
+    0.166666666667,0.61111111111100003,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.5,
+    0.277777777778,0.166666666667,0.38888888888899997,
+    0.277777777778,0.277777777778,0.277777777778,
+    0.277777777778,0.38888888888899997,0.166666666667,
+    0.277777777778,0.5,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.38888888888899997,
+    0.38888888888899997,0.166666666667,0.277777777778,
+    0.38888888888899997,0.277777777778,0.166666666667,
+    0.38888888888899997,0.38888888888899997,0.055555555555600003,
+    0.5,0.055555555555600003,0.277777777778,
+    0.5,0.166666666667,0.166666666667,
+    0.5,0.277777777778,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.166666666667,
+    0.61111111111100003,0.166666666667,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.61111111111100003,
+    0.055555555555600003,0.166666666667,0.5,
+    0.055555555555600003,0.277777777778,0.38888888888899997,
+    0.055555555555600003,0.38888888888899997,0.277777777778,
+    0.055555555555600003,0.5,0.166666666667,
+    0.055555555555600003,0.61111111111100003,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.5,
+    0.166666666667,0.166666666667,0.38888888888899997,
+    0.166666666667,0.277777777778,0.277777777778,
+    0.166666666667,0.38888888888899997,0.166666666667,
+    0.166666666667,0.5,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.38888888888899997,
+    0.277777777778,0.166666666667,0.277777777778,
+    0.277777777778,0.277777777778,0.166666666667,
+    0.277777777778,0.38888888888899997,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.277777777778,
+    0.38888888888899997,0.166666666667,0.166666666667,
+    0.38888888888899997,0.277777777778,0.055555555555600003,
+    0.5,0.055555555555600003,0.166666666667,
+    0.5,0.166666666667,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.5,
+    0.055555555555600003,0.166666666667,0.38888888888899997,
+    0.055555555555600003,0.277777777778,0.277777777778,
+    0.055555555555600003,0.38888888888899997,0.166666666667,
+    0.055555555555600003,0.5,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.38888888888899997,
+    0.166666666667,0.166666666667,0.277777777778,
+    0.166666666667,0.277777777778,0.166666666667,
+    0.166666666667,0.38888888888899997,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.277777777778,
+    0.277777777778,0.166666666667,0.166666666667,
+    0.277777777778,0.277777777778,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.166666666667,
+    0.38888888888899997,0.166666666667,0.055555555555600003,
+    0.5,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.38888888888899997,
+    0.055555555555600003,0.166666666667,0.277777777778,
+    0.055555555555600003,0.277777777778,0.166666666667,
+    0.055555555555600003,0.38888888888899997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.277777777778,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.166666666667,0.277777777778,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.166666666667,
+    0.277777777778,0.166666666667,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.277777777778,
+    0.055555555555600003,0.166666666667,0.166666666667,
+    0.055555555555600003,0.277777777778,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.166666666667,
+    0.166666666667,0.166666666667,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.166666666667,
+    0.055555555555600003,0.166666666667,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.055555555555600003,
+    0.0625,0.0625,0.8125,
+    0.0625,0.1875,0.6875,
+    0.0625,0.3125,0.5625,
+    0.0625,0.4375,0.4375,
+    0.0625,0.5625,0.3125,
+    0.0625,0.6875,0.1875,
+    0.0625,0.8125,0.0625,
+    0.1875,0.0625,0.6875,
+    0.1875,0.1875,0.5625,
+    0.1875,0.3125,0.4375,
+    0.1875,0.4375,0.3125,
+    0.1875,0.5625,0.1875,
+    0.1875,0.6875,0.0625,
+    0.3125,0.0625,0.5625,
+    0.3125,0.1875,0.4375,
+    0.3125,0.3125,0.3125,
+    0.3125,0.4375,0.1875,
+    0.3125,0.5625,0.0625,
+    0.4375,0.0625,0.4375,
+    0.4375,0.1875,0.3125,
+    0.4375,0.3125,0.1875,
+    0.4375,0.4375,0.0625,
+    0.5625,0.0625,0.3125,
+    0.5625,0.1875,0.1875,
+    0.5625,0.3125,0.0625,
+    0.6875,0.0625,0.1875,
+    0.6875,0.1875,0.0625,
+    0.8125,0.0625,0.0625,
+    0.0625,0.0625,0.6875,
+    0.0625,0.1875,0.5625,
+    0.0625,0.3125,0.4375,
+    0.0625,0.4375,0.3125,
+    0.0625,0.5625,0.1875,
+    0.0625,0.6875,0.0625,
+    0.1875,0.0625,0.5625,
+    0.1875,0.1875,0.4375,
+    0.1875,0.3125,0.3125,
+    0.1875,0.4375,0.1875,
+    0.1875,0.5625,0.0625,
+    0.3125,0.0625,0.4375,
+    0.3125,0.1875,0.3125,
+    0.3125,0.3125,0.1875,
+    0.3125,0.4375,0.0625,
+    0.4375,0.0625,0.3125,
+    0.4375,0.1875,0.1875,
+    0.4375,0.3125,0.0625,
+    0.5625,0.0625,0.1875,
+    0.5625,0.1875,0.0625,
+    0.6875,0.0625,0.0625,
+    0.0625,0.0625,0.5625,
+    0.0625,0.1875,0.4375,
+    0.0625,0.3125,0.3125,
+    0.0625,0.4375,0.1875,
+    0.0625,0.5625,0.0625,
+    0.1875,0.0625,0.4375,
+    0.1875,0.1875,0.3125,
+    0.1875,0.3125,0.1875,
+    0.1875,0.4375,0.0625,
+    0.3125,0.0625,0.3125,
+    0.3125,0.1875,0.1875,
+    0.3125,0.3125,0.0625,
+    0.4375,0.0625,0.1875,
+    0.4375,0.1875,0.0625,
+    0.5625,0.0625,0.0625,
+    0.0625,0.0625,0.4375,
+    0.0625,0.1875,0.3125,
+    0.0625,0.3125,0.1875,
+    0.0625,0.4375,0.0625,
+    0.1875,0.0625,0.3125,
+    0.1875,0.1875,0.1875,
+    0.1875,0.3125,0.0625,
+    0.3125,0.0625,0.1875,
+    0.3125,0.1875,0.0625,
+    0.4375,0.0625,0.0625,
+    0.0625,0.0625,0.3125,
+    0.0625,0.1875,0.1875,
+    0.0625,0.3125,0.0625,
+    0.1875,0.0625,0.1875,
+    0.1875,0.1875,0.0625,
+    0.3125,0.0625,0.0625,
+    0.0625,0.0625,0.1875,
+    0.0625,0.1875,0.0625,
+    0.1875,0.0625,0.0625,
+    0.0625,0.0625,0.0625,
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.21428571428599999,0.64285714285700002,
+    0.071428571428599999,0.35714285714299998,0.5,
+    0.071428571428599999,0.5,0.35714285714299998,
+    0.071428571428599999,0.64285714285700002,0.21428571428599999,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.64285714285700002,
+    0.21428571428599999,0.21428571428599999,0.5,
+    0.21428571428599999,0.35714285714299998,0.35714285714299998,
+    0.21428571428599999,0.5,0.21428571428599999,
+    0.21428571428599999,0.64285714285700002,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.5,
+    0.35714285714299998,0.21428571428599999,0.35714285714299998,
+    0.35714285714299998,0.35714285714299998,0.21428571428599999,
+    0.35714285714299998,0.5,0.071428571428599999,
+    0.5,0.071428571428599999,0.35714285714299998,
+    0.5,0.21428571428599999,0.21428571428599999,
+    0.5,0.35714285714299998,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.21428571428599999,
+    0.64285714285700002,0.21428571428599999,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.64285714285700002,
+    0.071428571428599999,0.21428571428599999,0.5,
+    0.071428571428599999,0.35714285714299998,0.35714285714299998,
+    0.071428571428599999,0.5,0.21428571428599999,
+    0.071428571428599999,0.64285714285700002,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.5,
+    0.21428571428599999,0.21428571428599999,0.35714285714299998,
+    0.21428571428599999,0.35714285714299998,0.21428571428599999,
+    0.21428571428599999,0.5,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.35714285714299998,
+    0.35714285714299998,0.21428571428599999,0.21428571428599999,
+    0.35714285714299998,0.35714285714299998,0.071428571428599999,
+    0.5,0.071428571428599999,0.21428571428599999,
+    0.5,0.21428571428599999,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.5,
+    0.071428571428599999,0.21428571428599999,0.35714285714299998,
+    0.071428571428599999,0.35714285714299998,0.21428571428599999,
+    0.071428571428599999,0.5,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.35714285714299998,
+    0.21428571428599999,0.21428571428599999,0.21428571428599999,
+    0.21428571428599999,0.35714285714299998,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.21428571428599999,
+    0.35714285714299998,0.21428571428599999,0.071428571428599999,
+    0.5,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.35714285714299998,
+    0.071428571428599999,0.21428571428599999,0.21428571428599999,
+    0.071428571428599999,0.35714285714299998,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.21428571428599999,
+    0.21428571428599999,0.21428571428599999,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.21428571428599999,
+    0.071428571428599999,0.21428571428599999,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.083333333333299994,0.083333333333299994,0.75,
+    0.083333333333299994,0.25,0.58333333333299997,
+    0.083333333333299994,0.41666666666699997,0.41666666666699997,
+    0.083333333333299994,0.58333333333299997,0.25,
+    0.083333333333299994,0.75,0.083333333333299994,
+    0.25,0.083333333333299994,0.58333333333299997,
+    0.25,0.25,0.41666666666699997,
+    0.25,0.41666666666699997,0.25,
+    0.25,0.58333333333299997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.41666666666699997,
+    0.41666666666699997,0.25,0.25,
+    0.41666666666699997,0.41666666666699997,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.25,
+    0.58333333333299997,0.25,0.083333333333299994,
+    0.75,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.58333333333299997,
+    0.083333333333299994,0.25,0.41666666666699997,
+    0.083333333333299994,0.41666666666699997,0.25,
+    0.083333333333299994,0.58333333333299997,0.083333333333299994,
+    0.25,0.083333333333299994,0.41666666666699997,
+    0.25,0.25,0.25,
+    0.25,0.41666666666699997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.25,
+    0.41666666666699997,0.25,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.41666666666699997,
+    0.083333333333299994,0.25,0.25,
+    0.083333333333299994,0.41666666666699997,0.083333333333299994,
+    0.25,0.083333333333299994,0.25,
+    0.25,0.25,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.25,
+    0.083333333333299994,0.25,0.083333333333299994,
+    0.25,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.083333333333299994,
+    0.10000000000000001,0.10000000000000001,0.69999999999999996,
+    0.10000000000000001,0.29999999999999999,0.5,
+    0.10000000000000001,0.5,0.29999999999999999,
+    0.10000000000000001,0.69999999999999996,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.5,
+    0.29999999999999999,0.29999999999999999,0.29999999999999999,
+    0.29999999999999999,0.5,0.10000000000000001,
+    0.5,0.10000000000000001,0.29999999999999999,
+    0.5,0.29999999999999999,0.10000000000000001,
+    0.69999999999999996,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.5,
+    0.10000000000000001,0.29999999999999999,0.29999999999999999,
+    0.10000000000000001,0.5,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.29999999999999999,
+    0.29999999999999999,0.29999999999999999,0.10000000000000001,
+    0.5,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.29999999999999999,
+    0.10000000000000001,0.29999999999999999,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.10000000000000001,
+    0.125,0.125,0.625,
+    0.125,0.375,0.375,
+    0.125,0.625,0.125,
+    0.375,0.125,0.375,
+    0.375,0.375,0.125,
+    0.625,0.125,0.125,
+    0.125,0.125,0.375,
+    0.125,0.375,0.125,
+    0.375,0.125,0.125,
+    0.125,0.125,0.125,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.25,0.25,0.25
+};
+static constexpr double gpweights14[] =
+{
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    0.064317124103666995,0.064317124103666995,0.064317124103666995,0.064317124103666995,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    -0.19783871629666699,-0.19783871629666699,-0.19783871629666699,-0.19783871629666699,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    0.22690862620833299,0.22690862620833299,0.22690862620833299,0.22690862620833299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,-0.11985271870983299,
+    -0.11985271870983299,-0.11985271870983299,-0.11985271870983299,0.029171614577500001,
+    0.029171614577500001,0.029171614577500001,0.029171614577500001,0.029171614577500001,
+    0.029171614577500001,0.029171614577500001,0.029171614577500001,0.029171614577500001,
+    0.029171614577500001,0.029171614577500001,0.029171614577500001,0.029171614577500001,
+    0.029171614577500001,0.029171614577500001,0.029171614577500001,0.029171614577500001,
+    0.029171614577500001,0.029171614577500001,0.029171614577500001,-0.002873877836833,
+    -0.002873877836833,-0.002873877836833,-0.002873877836833,-0.002873877836833,
+    -0.002873877836833,-0.002873877836833,-0.002873877836833,-0.002873877836833,
+    -0.002873877836833,8.3210734578000002e-05,8.3210734578000002e-05,8.3210734578000002e-05,
+    8.3210734578000002e-05,-3.2575693899999999e-07
+};
+
+static constexpr double gpcoordinates16[] =
+{
+    0.050000000000000003,0.050000000000000003,0.84999999999999998,
+    0.050000000000000003,0.14999999999999999,0.75,
+    0.050000000000000003,0.25,0.65000000000000002,
+    0.050000000000000003,0.34999999999999998,0.55000000000000004,
+    0.050000000000000003,0.45000000000000001,0.45000000000000001,
+    0.050000000000000003,0.55000000000000004,0.34999999999999998,
+    0.050000000000000003,0.65000000000000002,0.25,
+    0.050000000000000003,0.75,0.14999999999999999,
+    0.050000000000000003,0.84999999999999998,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.75,
+    0.14999999999999999,0.14999999999999999,0.65000000000000002,
+    0.14999999999999999,0.25,0.55000000000000004,
+    0.14999999999999999,0.34999999999999998,0.45000000000000001,
+    0.14999999999999999,0.45000000000000001,0.34999999999999998,
+    0.14999999999999999,0.55000000000000004,0.25,
+    0.14999999999999999,0.65000000000000002,0.14999999999999999,
+    0.14999999999999999,0.75,0.050000000000000003,
+    0.25,0.050000000000000003,0.65000000000000002,
+    0.25,0.14999999999999999,0.55000000000000004,
+    0.25,0.25,0.45000000000000001,
+    0.25,0.34999999999999998,0.34999999999999998,
+    0.25,0.45000000000000001,0.25,
+    0.25,0.55000000000000004,0.14999999999999999,
+    0.25,0.65000000000000002,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.55000000000000004,
+    0.34999999999999998,0.14999999999999999,0.45000000000000001,
+    0.34999999999999998,0.25,0.34999999999999998,
+    0.34999999999999998,0.34999999999999998,0.25,
+    0.34999999999999998,0.45000000000000001,0.14999999999999999,
+    0.34999999999999998,0.55000000000000004,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.45000000000000001,
+    0.45000000000000001,0.14999999999999999,0.34999999999999998,
+    0.45000000000000001,0.25,0.25,
+    0.45000000000000001,0.34999999999999998,0.14999999999999999,
+    0.45000000000000001,0.45000000000000001,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.34999999999999998,
+    0.55000000000000004,0.14999999999999999,0.25,
+    0.55000000000000004,0.25,0.14999999999999999,
+    0.55000000000000004,0.34999999999999998,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.25,
+    0.65000000000000002,0.14999999999999999,0.14999999999999999,
+    0.65000000000000002,0.25,0.050000000000000003,
+    0.75,0.050000000000000003,0.14999999999999999,
+    0.75,0.14999999999999999,0.050000000000000003,
+    0.84999999999999998,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.75,
+    0.050000000000000003,0.14999999999999999,0.65000000000000002,
+    0.050000000000000003,0.25,0.55000000000000004,
+    0.050000000000000003,0.34999999999999998,0.45000000000000001,
+    0.050000000000000003,0.45000000000000001,0.34999999999999998,
+    0.050000000000000003,0.55000000000000004,0.25,
+    0.050000000000000003,0.65000000000000002,0.14999999999999999,
+    0.050000000000000003,0.75,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.65000000000000002,
+    0.14999999999999999,0.14999999999999999,0.55000000000000004,
+    0.14999999999999999,0.25,0.45000000000000001,
+    0.14999999999999999,0.34999999999999998,0.34999999999999998,
+    0.14999999999999999,0.45000000000000001,0.25,
+    0.14999999999999999,0.55000000000000004,0.14999999999999999,
+    0.14999999999999999,0.65000000000000002,0.050000000000000003,
+    0.25,0.050000000000000003,0.55000000000000004,
+    0.25,0.14999999999999999,0.45000000000000001,
+    0.25,0.25,0.34999999999999998,
+    0.25,0.34999999999999998,0.25,
+    0.25,0.45000000000000001,0.14999999999999999,
+    0.25,0.55000000000000004,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.45000000000000001,
+    0.34999999999999998,0.14999999999999999,0.34999999999999998,
+    0.34999999999999998,0.25,0.25,
+    0.34999999999999998,0.34999999999999998,0.14999999999999999,
+    0.34999999999999998,0.45000000000000001,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.34999999999999998,
+    0.45000000000000001,0.14999999999999999,0.25,
+    0.45000000000000001,0.25,0.14999999999999999,
+    0.45000000000000001,0.34999999999999998,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.25,
+    0.55000000000000004,0.14999999999999999,0.14999999999999999,
+    0.55000000000000004,0.25,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.14999999999999999,
+    0.65000000000000002,0.14999999999999999,0.050000000000000003,
+    0.75,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.65000000000000002,
+    0.050000000000000003,0.14999999999999999,0.55000000000000004,
+    0.050000000000000003,0.25,0.45000000000000001,
+    0.050000000000000003,0.34999999999999998,0.34999999999999998,
+    0.050000000000000003,0.45000000000000001,0.25,
+    0.050000000000000003,0.55000000000000004,0.14999999999999999,
+    0.050000000000000003,0.65000000000000002,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.55000000000000004,
+    0.14999999999999999,0.14999999999999999,0.45000000000000001,
+    0.14999999999999999,0.25,0.34999999999999998,
+    0.14999999999999999,0.34999999999999998,0.25,
+    0.14999999999999999,0.45000000000000001,0.14999999999999999,
+    0.14999999999999999,0.55000000000000004,0.050000000000000003,
+    0.25,0.050000000000000003,0.45000000000000001,
+    0.25,0.14999999999999999,0.34999999999999998,
+    0.25,0.25,0.25,
+    0.25,0.34999999999999998,0.14999999999999999,
+    0.25,0.45000000000000001,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.34999999999999998,
+    0.34999999999999998,0.14999999999999999,0.25,
+    0.34999999999999998,0.25,0.14999999999999999,
+    0.34999999999999998,0.34999999999999998,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.25,
+    0.45000000000000001,0.14999999999999999,0.14999999999999999,
+    0.45000000000000001,0.25,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.14999999999999999,
+    0.55000000000000004,0.14999999999999999,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.55000000000000004,
+    0.050000000000000003,0.14999999999999999,0.45000000000000001,
+    0.050000000000000003,0.25,0.34999999999999998,
+    0.050000000000000003,0.34999999999999998,0.25,
+    0.050000000000000003,0.45000000000000001,0.14999999999999999,
+    0.050000000000000003,0.55000000000000004,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.45000000000000001,
+    0.14999999999999999,0.14999999999999999,0.34999999999999998,
+    0.14999999999999999,0.25,0.25,
+    0.14999999999999999,0.34999999999999998,0.14999999999999999,
+    0.14999999999999999,0.45000000000000001,0.050000000000000003,
+    0.25,0.050000000000000003,0.34999999999999998,
+    0.25,0.14999999999999999,0.25,
+    0.25,0.25,0.14999999999999999,
+    0.25,0.34999999999999998,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.25,
+    0.34999999999999998,0.14999999999999999,0.14999999999999999,
+    0.34999999999999998,0.25,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.14999999999999999,
+    0.45000000000000001,0.14999999999999999,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.45000000000000001,
+    0.050000000000000003,0.14999999999999999,0.34999999999999998,
+    0.050000000000000003,0.25,0.25,
+    0.050000000000000003,0.34999999999999998,0.14999999999999999,
+    0.050000000000000003,0.45000000000000001,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.34999999999999998,
+    0.14999999999999999,0.14999999999999999,0.25,
+    0.14999999999999999,0.25,0.14999999999999999,
+    0.14999999999999999,0.34999999999999998,0.050000000000000003,
+    0.25,0.050000000000000003,0.25,
+    0.25,0.14999999999999999,0.14999999999999999,
+    0.25,0.25,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.14999999999999999,
+    0.34999999999999998,0.14999999999999999,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.34999999999999998,
+    0.050000000000000003,0.14999999999999999,0.25,
+    0.050000000000000003,0.25,0.14999999999999999,
+    0.050000000000000003,0.34999999999999998,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.25,
+    0.14999999999999999,0.14999999999999999,0.14999999999999999,
+    0.14999999999999999,0.25,0.050000000000000003,
+    0.25,0.050000000000000003,0.14999999999999999,
+    0.25,0.14999999999999999,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.25,
+    0.050000000000000003,0.14999999999999999,0.14999999999999999,
+    0.050000000000000003,0.25,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.14999999999999999,
+    0.14999999999999999,0.14999999999999999,0.050000000000000003,
+    0.25,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.14999999999999999,
+    0.050000000000000003,0.14999999999999999,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.050000000000000003,
+    0.055555555555600003,0.055555555555600003,0.83333333333299997,
+    0.055555555555600003,0.166666666667,0.72222222222200005,
+    0.055555555555600003,0.277777777778,0.61111111111100003,
+    0.055555555555600003,0.38888888888899997,0.5,
+    0.055555555555600003,0.5,0.38888888888899997,
+    0.055555555555600003,0.61111111111100003,0.277777777778,
+    0.055555555555600003,0.72222222222200005,0.166666666667,
+    0.055555555555600003,0.83333333333299997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.72222222222200005,
+    0.166666666667,0.166666666667,0.61111111111100003,
+    0.166666666667,0.277777777778,0.5,
+    0.166666666667,0.38888888888899997,0.38888888888899997,
+    0.166666666667,0.5,0.277777777778,
+    0.166666666667,0.61111111111100003,0.166666666667,
+    0.166666666667,0.72222222222200005,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.61111111111100003,
+    0.277777777778,0.166666666667,0.5,
+    0.277777777778,0.277777777778,0.38888888888899997,
+    0.277777777778,0.38888888888899997,0.277777777778,
+    0.277777777778,0.5,0.166666666667,
+    0.277777777778,0.61111111111100003,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.5,
+    0.38888888888899997,0.166666666667,0.38888888888899997,
+    0.38888888888899997,0.277777777778,0.277777777778,
+    0.38888888888899997,0.38888888888899997,0.166666666667,
+    0.38888888888899997,0.5,0.055555555555600003,
+    0.5,0.055555555555600003,0.38888888888899997,
+    0.5,0.166666666667,0.277777777778,
+    0.5,0.277777777778,0.166666666667,
+    0.5,0.38888888888899997,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.277777777778,
+    0.61111111111100003,0.166666666667,0.166666666667,
+    0.61111111111100003,0.277777777778,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.166666666667,
+    0.72222222222200005,0.166666666667,0.055555555555600003,
+    0.83333333333299997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.72222222222200005,
+    0.055555555555600003,0.166666666667,0.61111111111100003,
+    0.055555555555600003,0.277777777778,0.5,
+    0.055555555555600003,0.38888888888899997,0.38888888888899997,
+    0.055555555555600003,0.5,0.277777777778,
+    0.055555555555600003,0.61111111111100003,0.166666666667,
+    0.055555555555600003,0.72222222222200005,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.61111111111100003,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.277777777778,0.38888888888899997,
+    0.166666666667,0.38888888888899997,0.277777777778,
+    0.166666666667,0.5,0.166666666667,
+    0.166666666667,0.61111111111100003,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.5,
+    0.277777777778,0.166666666667,0.38888888888899997,
+    0.277777777778,0.277777777778,0.277777777778,
+    0.277777777778,0.38888888888899997,0.166666666667,
+    0.277777777778,0.5,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.38888888888899997,
+    0.38888888888899997,0.166666666667,0.277777777778,
+    0.38888888888899997,0.277777777778,0.166666666667,
+    0.38888888888899997,0.38888888888899997,0.055555555555600003,
+    0.5,0.055555555555600003,0.277777777778,
+    0.5,0.166666666667,0.166666666667,
+    0.5,0.277777777778,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.166666666667,
+    0.61111111111100003,0.166666666667,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.61111111111100003,
+    0.055555555555600003,0.166666666667,0.5,
+    0.055555555555600003,0.277777777778,0.38888888888899997,
+    0.055555555555600003,0.38888888888899997,0.277777777778,
+    0.055555555555600003,0.5,0.166666666667,
+    0.055555555555600003,0.61111111111100003,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.5,
+    0.166666666667,0.166666666667,0.38888888888899997,
+    0.166666666667,0.277777777778,0.277777777778,
+    0.166666666667,0.38888888888899997,0.166666666667,
+    0.166666666667,0.5,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.38888888888899997,
+    0.277777777778,0.166666666667,0.277777777778,
+    0.277777777778,0.277777777778,0.166666666667,
+    0.277777777778,0.38888888888899997,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.277777777778,
+    0.38888888888899997,0.166666666667,0.166666666667,
+    0.38888888888899997,0.277777777778,0.055555555555600003,
+    0.5,0.055555555555600003,0.166666666667,
+    0.5,0.166666666667,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.5,
+    0.055555555555600003,0.166666666667,0.38888888888899997,
+    0.055555555555600003,0.277777777778,0.277777777778,
+    0.055555555555600003,0.38888888888899997,0.166666666667,
+    0.055555555555600003,0.5,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.38888888888899997,
+    0.166666666667,0.166666666667,0.277777777778,
+    0.166666666667,0.277777777778,0.166666666667,
+    0.166666666667,0.38888888888899997,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.277777777778,
+    0.277777777778,0.166666666667,0.166666666667,
+    0.277777777778,0.277777777778,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.166666666667,
+    0.38888888888899997,0.166666666667,0.055555555555600003,
+    0.5,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.38888888888899997,
+    0.055555555555600003,0.166666666667,0.277777777778,
+    0.055555555555600003,0.277777777778,0.166666666667,
+    0.055555555555600003,0.38888888888899997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.277777777778,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.166666666667,0.277777777778,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.166666666667,
+    0.277777777778,0.166666666667,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.277777777778,
+    0.055555555555600003,0.166666666667,0.166666666667,
+    0.055555555555600003,0.277777777778,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.166666666667,
+    0.166666666667,0.166666666667,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.166666666667,
+    0.055555555555600003,0.166666666667,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.055555555555600003,
+    0.0625,0.0625,0.8125,
+    0.0625,0.1875,0.6875,
+    0.0625,0.3125,0.5625,
+    0.0625,0.4375,0.4375,
+    0.0625,0.5625,0.3125,
+    0.0625,0.6875,0.1875,
+    0.0625,0.8125,0.0625,
+    0.1875,0.0625,0.6875,
+    0.1875,0.1875,0.5625,
+    0.1875,0.3125,0.4375,
+    0.1875,0.4375,0.3125,
+    0.1875,0.5625,0.1875,
+    0.1875,0.6875,0.0625,
+    0.3125,0.0625,0.5625,
+    0.3125,0.1875,0.4375,
+    0.3125,0.3125,0.3125,
+    0.3125,0.4375,0.1875,
+    0.3125,0.5625,0.0625,
+    0.4375,0.0625,0.4375,
+    0.4375,0.1875,0.3125,
+    0.4375,0.3125,0.1875,
+    0.4375,0.4375,0.0625,
+    0.5625,0.0625,0.3125,
+    0.5625,0.1875,0.1875,
+    0.5625,0.3125,0.0625,
+    0.6875,0.0625,0.1875,
+    0.6875,0.1875,0.0625,
+    0.8125,0.0625,0.0625,
+    0.0625,0.0625,0.6875,
+    0.0625,0.1875,0.5625,
+    0.0625,0.3125,0.4375,
+    0.0625,0.4375,0.3125,
+    0.0625,0.5625,0.1875,
+    0.0625,0.6875,0.0625,
+    0.1875,0.0625,0.5625,
+    0.1875,0.1875,0.4375,
+    0.1875,0.3125,0.3125,
+    0.1875,0.4375,0.1875,
+    0.1875,0.5625,0.0625,
+    0.3125,0.0625,0.4375,
+    0.3125,0.1875,0.3125,
+    0.3125,0.3125,0.1875,
+    0.3125,0.4375,0.0625,
+    0.4375,0.0625,0.3125,
+    0.4375,0.1875,0.1875,
+    0.4375,0.3125,0.0625,
+    0.5625,0.0625,0.1875,
+    0.5625,0.1875,0.0625,
+    0.6875,0.0625,0.0625,
+    0.0625,0.0625,0.5625,
+    0.0625,0.1875,0.4375,
+    0.0625,0.3125,0.3125,
+    0.0625,0.4375,0.1875,
+    0.0625,0.5625,0.0625,
+    0.1875,0.0625,0.4375,
+    0.1875,0.1875,0.3125,
+    0.1875,0.3125,0.1875,
+    0.1875,0.4375,0.0625,
+    0.3125,0.0625,0.3125,
+    0.3125,0.1875,0.1875,
+    0.3125,0.3125,0.0625,
+    0.4375,0.0625,0.1875,
+    0.4375,0.1875,0.0625,
+    0.5625,0.0625,0.0625,
+    0.0625,0.0625,0.4375,
+    0.0625,0.1875,0.3125,
+    0.0625,0.3125,0.1875,
+    0.0625,0.4375,0.0625,
+    0.1875,0.0625,0.3125,
+    0.1875,0.1875,0.1875,
+    0.1875,0.3125,0.0625,
+    0.3125,0.0625,0.1875,
+    0.3125,0.1875,0.0625,
+    0.4375,0.0625,0.0625,
+    0.0625,0.0625,0.3125,
+    0.0625,0.1875,0.1875,
+    0.0625,0.3125,0.0625,
+    0.1875,0.0625,0.1875,
+    0.1875,0.1875,0.0625,
+    0.3125,0.0625,0.0625,
+    0.0625,0.0625,0.1875,
+    0.0625,0.1875,0.0625,
+    0.1875,0.0625,0.0625,
+    0.0625,0.0625,0.0625,
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.21428571428599999,0.64285714285700002,
+    0.071428571428599999,0.35714285714299998,0.5,
+    0.071428571428599999,0.5,0.35714285714299998,
+    0.071428571428599999,0.64285714285700002,0.21428571428599999,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.64285714285700002,
+    0.21428571428599999,0.21428571428599999,0.5,
+    0.21428571428599999,0.35714285714299998,0.35714285714299998,
+    0.21428571428599999,0.5,0.21428571428599999,
+    0.21428571428599999,0.64285714285700002,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.5,
+    0.35714285714299998,0.21428571428599999,0.35714285714299998,
+    0.35714285714299998,0.35714285714299998,0.21428571428599999,
+    0.35714285714299998,0.5,0.071428571428599999,
+    0.5,0.071428571428599999,0.35714285714299998,
+    0.5,0.21428571428599999,0.21428571428599999,
+    0.5,0.35714285714299998,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.21428571428599999,
+    0.64285714285700002,0.21428571428599999,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.64285714285700002,
+    0.071428571428599999,0.21428571428599999,0.5,
+    0.071428571428599999,0.35714285714299998,0.35714285714299998,
+    0.071428571428599999,0.5,0.21428571428599999,
+    0.071428571428599999,0.64285714285700002,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.5,
+    0.21428571428599999,0.21428571428599999,0.35714285714299998,
+    0.21428571428599999,0.35714285714299998,0.21428571428599999,
+    0.21428571428599999,0.5,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.35714285714299998,
+    0.35714285714299998,0.21428571428599999,0.21428571428599999,
+    0.35714285714299998,0.35714285714299998,0.071428571428599999,
+    0.5,0.071428571428599999,0.21428571428599999,
+    0.5,0.21428571428599999,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.5,
+    0.071428571428599999,0.21428571428599999,0.35714285714299998,
+    0.071428571428599999,0.35714285714299998,0.21428571428599999,
+    0.071428571428599999,0.5,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.35714285714299998,
+    0.21428571428599999,0.21428571428599999,0.21428571428599999,
+    0.21428571428599999,0.35714285714299998,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.21428571428599999,
+    0.35714285714299998,0.21428571428599999,0.071428571428599999,
+    0.5,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.35714285714299998,
+    0.071428571428599999,0.21428571428599999,0.21428571428599999,
+    0.071428571428599999,0.35714285714299998,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.21428571428599999,
+    0.21428571428599999,0.21428571428599999,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.21428571428599999,
+    0.071428571428599999,0.21428571428599999,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.083333333333299994,0.083333333333299994,0.75,
+    0.083333333333299994,0.25,0.58333333333299997,
+    0.083333333333299994,0.41666666666699997,0.41666666666699997,
+    0.083333333333299994,0.58333333333299997,0.25,
+    0.083333333333299994,0.75,0.083333333333299994,
+    0.25,0.083333333333299994,0.58333333333299997,
+    0.25,0.25,0.41666666666699997,
+    0.25,0.41666666666699997,0.25,
+    0.25,0.58333333333299997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.41666666666699997,
+    0.41666666666699997,0.25,0.25,
+    0.41666666666699997,0.41666666666699997,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.25,
+    0.58333333333299997,0.25,0.083333333333299994,
+    0.75,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.58333333333299997,
+    0.083333333333299994,0.25,0.41666666666699997,
+    0.083333333333299994,0.41666666666699997,0.25,
+    0.083333333333299994,0.58333333333299997,0.083333333333299994,
+    0.25,0.083333333333299994,0.41666666666699997,
+    0.25,0.25,0.25,
+    0.25,0.41666666666699997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.25,
+    0.41666666666699997,0.25,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.41666666666699997,
+    0.083333333333299994,0.25,0.25,
+    0.083333333333299994,0.41666666666699997,0.083333333333299994,
+    0.25,0.083333333333299994,0.25,
+    0.25,0.25,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.25,
+    0.083333333333299994,0.25,0.083333333333299994,
+    0.25,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.083333333333299994,
+    0.10000000000000001,0.10000000000000001,0.69999999999999996,
+    0.10000000000000001,0.29999999999999999,0.5,
+    0.10000000000000001,0.5,0.29999999999999999,
+    0.10000000000000001,0.69999999999999996,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.5,
+    0.29999999999999999,0.29999999999999999,0.29999999999999999,
+    0.29999999999999999,0.5,0.10000000000000001,
+    0.5,0.10000000000000001,0.29999999999999999,
+    0.5,0.29999999999999999,0.10000000000000001,
+    0.69999999999999996,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.5,
+    0.10000000000000001,0.29999999999999999,0.29999999999999999,
+    0.10000000000000001,0.5,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.29999999999999999,
+    0.29999999999999999,0.29999999999999999,0.10000000000000001,
+    0.5,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.29999999999999999,
+    0.10000000000000001,0.29999999999999999,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.10000000000000001,
+    0.125,0.125,0.625,
+    0.125,0.375,0.375,
+    0.125,0.625,0.125,
+    0.375,0.125,0.375,
+    0.375,0.375,0.125,
+    0.625,0.125,0.125,
+    0.125,0.125,0.375,
+    0.125,0.375,0.125,
+    0.375,0.125,0.125,
+    0.125,0.125,0.125,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.25,0.25,0.25
+};
+static constexpr double gpweights16[] =
+{
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,0.082206352466167004,0.082206352466167004,0.082206352466167004,
+    0.082206352466167004,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,-0.27419405539000002,-0.27419405539000002,-0.27419405539000002,
+    -0.27419405539000002,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,0.35171327341833297,0.35171327341833297,0.35171327341833297,
+    0.35171327341833297,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,-0.21801024870999999,-0.21801024870999999,-0.21801024870999999,
+    -0.21801024870999999,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    0.067417154274332994,0.067417154274332994,0.067417154274332994,0.067417154274332994,
+    -0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,
+    -0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,
+    -0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,
+    -0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,
+    -0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,-0.0097238715258499992,
+    0.00054740530225500005,0.00054740530225500005,0.00054740530225500005,0.00054740530225500005,
+    0.00054740530225500005,0.00054740530225500005,0.00054740530225500005,0.00054740530225500005,
+    0.00054740530225500005,0.00054740530225500005,-8.2296330901299996e-06,-8.2296330901299996e-06,
+    -8.2296330901299996e-06,-8.2296330901299996e-06,1.3573205874999999e-08
+};
+
+static constexpr double gpcoordinates18[] =
+{
+    0.045454545454499999,0.045454545454499999,0.86363636363600005,
+    0.045454545454499999,0.13636363636400001,0.77272727272700004,
+    0.045454545454499999,0.22727272727299999,0.68181818181800002,
+    0.045454545454499999,0.31818181818199998,0.59090909090900001,
+    0.045454545454499999,0.40909090909099999,0.5,
+    0.045454545454499999,0.5,0.40909090909099999,
+    0.045454545454499999,0.59090909090900001,0.31818181818199998,
+    0.045454545454499999,0.68181818181800002,0.22727272727299999,
+    0.045454545454499999,0.77272727272700004,0.13636363636400001,
+    0.045454545454499999,0.86363636363600005,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.77272727272700004,
+    0.13636363636400001,0.13636363636400001,0.68181818181800002,
+    0.13636363636400001,0.22727272727299999,0.59090909090900001,
+    0.13636363636400001,0.31818181818199998,0.5,
+    0.13636363636400001,0.40909090909099999,0.40909090909099999,
+    0.13636363636400001,0.5,0.31818181818199998,
+    0.13636363636400001,0.59090909090900001,0.22727272727299999,
+    0.13636363636400001,0.68181818181800002,0.13636363636400001,
+    0.13636363636400001,0.77272727272700004,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.68181818181800002,
+    0.22727272727299999,0.13636363636400001,0.59090909090900001,
+    0.22727272727299999,0.22727272727299999,0.5,
+    0.22727272727299999,0.31818181818199998,0.40909090909099999,
+    0.22727272727299999,0.40909090909099999,0.31818181818199998,
+    0.22727272727299999,0.5,0.22727272727299999,
+    0.22727272727299999,0.59090909090900001,0.13636363636400001,
+    0.22727272727299999,0.68181818181800002,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.59090909090900001,
+    0.31818181818199998,0.13636363636400001,0.5,
+    0.31818181818199998,0.22727272727299999,0.40909090909099999,
+    0.31818181818199998,0.31818181818199998,0.31818181818199998,
+    0.31818181818199998,0.40909090909099999,0.22727272727299999,
+    0.31818181818199998,0.5,0.13636363636400001,
+    0.31818181818199998,0.59090909090900001,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.5,
+    0.40909090909099999,0.13636363636400001,0.40909090909099999,
+    0.40909090909099999,0.22727272727299999,0.31818181818199998,
+    0.40909090909099999,0.31818181818199998,0.22727272727299999,
+    0.40909090909099999,0.40909090909099999,0.13636363636400001,
+    0.40909090909099999,0.5,0.045454545454499999,
+    0.5,0.045454545454499999,0.40909090909099999,
+    0.5,0.13636363636400001,0.31818181818199998,
+    0.5,0.22727272727299999,0.22727272727299999,
+    0.5,0.31818181818199998,0.13636363636400001,
+    0.5,0.40909090909099999,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.31818181818199998,
+    0.59090909090900001,0.13636363636400001,0.22727272727299999,
+    0.59090909090900001,0.22727272727299999,0.13636363636400001,
+    0.59090909090900001,0.31818181818199998,0.045454545454499999,
+    0.68181818181800002,0.045454545454499999,0.22727272727299999,
+    0.68181818181800002,0.13636363636400001,0.13636363636400001,
+    0.68181818181800002,0.22727272727299999,0.045454545454499999,
+    0.77272727272700004,0.045454545454499999,0.13636363636400001,
+    0.77272727272700004,0.13636363636400001,0.045454545454499999,
+    0.86363636363600005,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.77272727272700004,
+    0.045454545454499999,0.13636363636400001,0.68181818181800002,
+    0.045454545454499999,0.22727272727299999,0.59090909090900001,
+    0.045454545454499999,0.31818181818199998,0.5,
+    0.045454545454499999,0.40909090909099999,0.40909090909099999,
+    0.045454545454499999,0.5,0.31818181818199998,
+    0.045454545454499999,0.59090909090900001,0.22727272727299999,
+    0.045454545454499999,0.68181818181800002,0.13636363636400001,
+    0.045454545454499999,0.77272727272700004,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.68181818181800002,
+    0.13636363636400001,0.13636363636400001,0.59090909090900001,
+    0.13636363636400001,0.22727272727299999,0.5,
+    0.13636363636400001,0.31818181818199998,0.40909090909099999,
+    0.13636363636400001,0.40909090909099999,0.31818181818199998,
+    0.13636363636400001,0.5,0.22727272727299999,
+    0.13636363636400001,0.59090909090900001,0.13636363636400001,
+    0.13636363636400001,0.68181818181800002,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.59090909090900001,
+    0.22727272727299999,0.13636363636400001,0.5,
+    0.22727272727299999,0.22727272727299999,0.40909090909099999,
+    0.22727272727299999,0.31818181818199998,0.31818181818199998,
+    0.22727272727299999,0.40909090909099999,0.22727272727299999,
+    0.22727272727299999,0.5,0.13636363636400001,
+    0.22727272727299999,0.59090909090900001,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.5,
+    0.31818181818199998,0.13636363636400001,0.40909090909099999,
+    0.31818181818199998,0.22727272727299999,0.31818181818199998,
+    0.31818181818199998,0.31818181818199998,0.22727272727299999,
+    0.31818181818199998,0.40909090909099999,0.13636363636400001,
+    0.31818181818199998,0.5,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.40909090909099999,
+    0.40909090909099999,0.13636363636400001,0.31818181818199998,
+    0.40909090909099999,0.22727272727299999,0.22727272727299999,
+    0.40909090909099999,0.31818181818199998,0.13636363636400001,
+    0.40909090909099999,0.40909090909099999,0.045454545454499999,
+    0.5,0.045454545454499999,0.31818181818199998,
+    0.5,0.13636363636400001,0.22727272727299999,
+    0.5,0.22727272727299999,0.13636363636400001,
+    0.5,0.31818181818199998,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.22727272727299999,
+    0.59090909090900001,0.13636363636400001,0.13636363636400001,
+    0.59090909090900001,0.22727272727299999,0.045454545454499999,
+    0.68181818181800002,0.045454545454499999,0.13636363636400001,
+    0.68181818181800002,0.13636363636400001,0.045454545454499999,
+    0.77272727272700004,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.68181818181800002,
+    0.045454545454499999,0.13636363636400001,0.59090909090900001,
+    0.045454545454499999,0.22727272727299999,0.5,
+    0.045454545454499999,0.31818181818199998,0.40909090909099999,
+    0.045454545454499999,0.40909090909099999,0.31818181818199998,
+    0.045454545454499999,0.5,0.22727272727299999,
+    0.045454545454499999,0.59090909090900001,0.13636363636400001,
+    0.045454545454499999,0.68181818181800002,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.59090909090900001,
+    0.13636363636400001,0.13636363636400001,0.5,
+    0.13636363636400001,0.22727272727299999,0.40909090909099999,
+    0.13636363636400001,0.31818181818199998,0.31818181818199998,
+    0.13636363636400001,0.40909090909099999,0.22727272727299999,
+    0.13636363636400001,0.5,0.13636363636400001,
+    0.13636363636400001,0.59090909090900001,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.5,
+    0.22727272727299999,0.13636363636400001,0.40909090909099999,
+    0.22727272727299999,0.22727272727299999,0.31818181818199998,
+    0.22727272727299999,0.31818181818199998,0.22727272727299999,
+    0.22727272727299999,0.40909090909099999,0.13636363636400001,
+    0.22727272727299999,0.5,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.40909090909099999,
+    0.31818181818199998,0.13636363636400001,0.31818181818199998,
+    0.31818181818199998,0.22727272727299999,0.22727272727299999,
+    0.31818181818199998,0.31818181818199998,0.13636363636400001,
+    0.31818181818199998,0.40909090909099999,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.31818181818199998,
+    0.40909090909099999,0.13636363636400001,0.22727272727299999,
+    0.40909090909099999,0.22727272727299999,0.13636363636400001,
+    0.40909090909099999,0.31818181818199998,0.045454545454499999,
+    0.5,0.045454545454499999,0.22727272727299999,
+    0.5,0.13636363636400001,0.13636363636400001,
+    0.5,0.22727272727299999,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.13636363636400001,
+    0.59090909090900001,0.13636363636400001,0.045454545454499999,
+    0.68181818181800002,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.59090909090900001,
+    0.045454545454499999,0.13636363636400001,0.5,
+    0.045454545454499999,0.22727272727299999,0.40909090909099999,
+    0.045454545454499999,0.31818181818199998,0.31818181818199998,
+    0.045454545454499999,0.40909090909099999,0.22727272727299999,
+    0.045454545454499999,0.5,0.13636363636400001,
+    0.045454545454499999,0.59090909090900001,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.5,
+    0.13636363636400001,0.13636363636400001,0.40909090909099999,
+    0.13636363636400001,0.22727272727299999,0.31818181818199998,
+    0.13636363636400001,0.31818181818199998,0.22727272727299999,
+    0.13636363636400001,0.40909090909099999,0.13636363636400001,
+    0.13636363636400001,0.5,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.40909090909099999,
+    0.22727272727299999,0.13636363636400001,0.31818181818199998,
+    0.22727272727299999,0.22727272727299999,0.22727272727299999,
+    0.22727272727299999,0.31818181818199998,0.13636363636400001,
+    0.22727272727299999,0.40909090909099999,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.31818181818199998,
+    0.31818181818199998,0.13636363636400001,0.22727272727299999,
+    0.31818181818199998,0.22727272727299999,0.13636363636400001,
+    0.31818181818199998,0.31818181818199998,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.22727272727299999,
+    0.40909090909099999,0.13636363636400001,0.13636363636400001,
+    0.40909090909099999,0.22727272727299999,0.045454545454499999,
+    0.5,0.045454545454499999,0.13636363636400001,
+    0.5,0.13636363636400001,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.5,
+    0.045454545454499999,0.13636363636400001,0.40909090909099999,
+    0.045454545454499999,0.22727272727299999,0.31818181818199998,
+    0.045454545454499999,0.31818181818199998,0.22727272727299999,
+    0.045454545454499999,0.40909090909099999,0.13636363636400001,
+    0.045454545454499999,0.5,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.40909090909099999,
+    0.13636363636400001,0.13636363636400001,0.31818181818199998,
+    0.13636363636400001,0.22727272727299999,0.22727272727299999,
+    0.13636363636400001,0.31818181818199998,0.13636363636400001,
+    0.13636363636400001,0.40909090909099999,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.31818181818199998,
+    0.22727272727299999,0.13636363636400001,0.22727272727299999,
+    0.22727272727299999,0.22727272727299999,0.13636363636400001,
+    0.22727272727299999,0.31818181818199998,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.22727272727299999,
+    0.31818181818199998,0.13636363636400001,0.13636363636400001,
+    0.31818181818199998,0.22727272727299999,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.13636363636400001,
+    0.40909090909099999,0.13636363636400001,0.045454545454499999,
+    0.5,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.40909090909099999,
+    0.045454545454499999,0.13636363636400001,0.31818181818199998,
+    0.045454545454499999,0.22727272727299999,0.22727272727299999,
+    0.045454545454499999,0.31818181818199998,0.13636363636400001,
+    0.045454545454499999,0.40909090909099999,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.31818181818199998,
+    0.13636363636400001,0.13636363636400001,0.22727272727299999,
+    0.13636363636400001,0.22727272727299999,0.13636363636400001,
+    0.13636363636400001,0.31818181818199998,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.22727272727299999,
+    0.22727272727299999,0.13636363636400001,0.13636363636400001,
+    0.22727272727299999,0.22727272727299999,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.13636363636400001,
+    0.31818181818199998,0.13636363636400001,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.31818181818199998,
+    0.045454545454499999,0.13636363636400001,0.22727272727299999,
+    0.045454545454499999,0.22727272727299999,0.13636363636400001,
+    0.045454545454499999,0.31818181818199998,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.22727272727299999,
+    0.13636363636400001,0.13636363636400001,0.13636363636400001,
+    0.13636363636400001,0.22727272727299999,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.13636363636400001,
+    0.22727272727299999,0.13636363636400001,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.22727272727299999,
+    0.045454545454499999,0.13636363636400001,0.13636363636400001,
+    0.045454545454499999,0.22727272727299999,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.13636363636400001,
+    0.13636363636400001,0.13636363636400001,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.13636363636400001,
+    0.045454545454499999,0.13636363636400001,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.045454545454499999,
+    0.050000000000000003,0.050000000000000003,0.84999999999999998,
+    0.050000000000000003,0.14999999999999999,0.75,
+    0.050000000000000003,0.25,0.65000000000000002,
+    0.050000000000000003,0.34999999999999998,0.55000000000000004,
+    0.050000000000000003,0.45000000000000001,0.45000000000000001,
+    0.050000000000000003,0.55000000000000004,0.34999999999999998,
+    0.050000000000000003,0.65000000000000002,0.25,
+    0.050000000000000003,0.75,0.14999999999999999,
+    0.050000000000000003,0.84999999999999998,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.75,
+    0.14999999999999999,0.14999999999999999,0.65000000000000002,
+    0.14999999999999999,0.25,0.55000000000000004,
+    0.14999999999999999,0.34999999999999998,0.45000000000000001,
+    0.14999999999999999,0.45000000000000001,0.34999999999999998,
+    0.14999999999999999,0.55000000000000004,0.25,
+    0.14999999999999999,0.65000000000000002,0.14999999999999999,
+    0.14999999999999999,0.75,0.050000000000000003,
+    0.25,0.050000000000000003,0.65000000000000002,
+    0.25,0.14999999999999999,0.55000000000000004,
+    0.25,0.25,0.45000000000000001,
+    0.25,0.34999999999999998,0.34999999999999998,
+    0.25,0.45000000000000001,0.25,
+    0.25,0.55000000000000004,0.14999999999999999,
+    0.25,0.65000000000000002,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.55000000000000004,
+    0.34999999999999998,0.14999999999999999,0.45000000000000001,
+    0.34999999999999998,0.25,0.34999999999999998,
+    0.34999999999999998,0.34999999999999998,0.25,
+    0.34999999999999998,0.45000000000000001,0.14999999999999999,
+    0.34999999999999998,0.55000000000000004,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.45000000000000001,
+    0.45000000000000001,0.14999999999999999,0.34999999999999998,
+    0.45000000000000001,0.25,0.25,
+    0.45000000000000001,0.34999999999999998,0.14999999999999999,
+    0.45000000000000001,0.45000000000000001,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.34999999999999998,
+    0.55000000000000004,0.14999999999999999,0.25,
+    0.55000000000000004,0.25,0.14999999999999999,
+    0.55000000000000004,0.34999999999999998,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.25,
+    0.65000000000000002,0.14999999999999999,0.14999999999999999,
+    0.65000000000000002,0.25,0.050000000000000003,
+    0.75,0.050000000000000003,0.14999999999999999,
+    0.75,0.14999999999999999,0.050000000000000003,
+    0.84999999999999998,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.75,
+    0.050000000000000003,0.14999999999999999,0.65000000000000002,
+    0.050000000000000003,0.25,0.55000000000000004,
+    0.050000000000000003,0.34999999999999998,0.45000000000000001,
+    0.050000000000000003,0.45000000000000001,0.34999999999999998,
+    0.050000000000000003,0.55000000000000004,0.25,
+    0.050000000000000003,0.65000000000000002,0.14999999999999999,
+    0.050000000000000003,0.75,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.65000000000000002,
+    0.14999999999999999,0.14999999999999999,0.55000000000000004,
+    0.14999999999999999,0.25,0.45000000000000001,
+    0.14999999999999999,0.34999999999999998,0.34999999999999998,
+    0.14999999999999999,0.45000000000000001,0.25,
+    0.14999999999999999,0.55000000000000004,0.14999999999999999,
+    0.14999999999999999,0.65000000000000002,0.050000000000000003,
+    0.25,0.050000000000000003,0.55000000000000004,
+    0.25,0.14999999999999999,0.45000000000000001,
+    0.25,0.25,0.34999999999999998,
+    0.25,0.34999999999999998,0.25,
+    0.25,0.45000000000000001,0.14999999999999999,
+    0.25,0.55000000000000004,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.45000000000000001,
+    0.34999999999999998,0.14999999999999999,0.34999999999999998,
+    0.34999999999999998,0.25,0.25,
+    0.34999999999999998,0.34999999999999998,0.14999999999999999,
+    0.34999999999999998,0.45000000000000001,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.34999999999999998,
+    0.45000000000000001,0.14999999999999999,0.25,
+    0.45000000000000001,0.25,0.14999999999999999,
+    0.45000000000000001,0.34999999999999998,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.25,
+    0.55000000000000004,0.14999999999999999,0.14999999999999999,
+    0.55000000000000004,0.25,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.14999999999999999,
+    0.65000000000000002,0.14999999999999999,0.050000000000000003,
+    0.75,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.65000000000000002,
+    0.050000000000000003,0.14999999999999999,0.55000000000000004,
+    0.050000000000000003,0.25,0.45000000000000001,
+    0.050000000000000003,0.34999999999999998,0.34999999999999998,
+    0.050000000000000003,0.45000000000000001,0.25,
+    0.050000000000000003,0.55000000000000004,0.14999999999999999,
+    0.050000000000000003,0.65000000000000002,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.55000000000000004,
+    0.14999999999999999,0.14999999999999999,0.45000000000000001,
+    0.14999999999999999,0.25,0.34999999999999998,
+    0.14999999999999999,0.34999999999999998,0.25,
+    0.14999999999999999,0.45000000000000001,0.14999999999999999,
+    0.14999999999999999,0.55000000000000004,0.050000000000000003,
+    0.25,0.050000000000000003,0.45000000000000001,
+    0.25,0.14999999999999999,0.34999999999999998,
+    0.25,0.25,0.25,
+    0.25,0.34999999999999998,0.14999999999999999,
+    0.25,0.45000000000000001,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.34999999999999998,
+    0.34999999999999998,0.14999999999999999,0.25,
+    0.34999999999999998,0.25,0.14999999999999999,
+    0.34999999999999998,0.34999999999999998,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.25,
+    0.45000000000000001,0.14999999999999999,0.14999999999999999,
+    0.45000000000000001,0.25,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.14999999999999999,
+    0.55000000000000004,0.14999999999999999,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.55000000000000004,
+    0.050000000000000003,0.14999999999999999,0.45000000000000001,
+    0.050000000000000003,0.25,0.34999999999999998,
+    0.050000000000000003,0.34999999999999998,0.25,
+    0.050000000000000003,0.45000000000000001,0.14999999999999999,
+    0.050000000000000003,0.55000000000000004,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.45000000000000001,
+    0.14999999999999999,0.14999999999999999,0.34999999999999998,
+    0.14999999999999999,0.25,0.25,
+    0.14999999999999999,0.34999999999999998,0.14999999999999999,
+    0.14999999999999999,0.45000000000000001,0.050000000000000003,
+    0.25,0.050000000000000003,0.34999999999999998,
+    0.25,0.14999999999999999,0.25,
+    0.25,0.25,0.14999999999999999,
+    0.25,0.34999999999999998,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.25,
+    0.34999999999999998,0.14999999999999999,0.14999999999999999,
+    0.34999999999999998,0.25,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.14999999999999999,
+    0.45000000000000001,0.14999999999999999,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.45000000000000001,
+    0.050000000000000003,0.14999999999999999,0.34999999999999998,
+    0.050000000000000003,0.25,0.25,
+    0.050000000000000003,0.34999999999999998,0.14999999999999999,
+    0.050000000000000003,0.45000000000000001,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.34999999999999998,
+    0.14999999999999999,0.14999999999999999,0.25,
+    0.14999999999999999,0.25,0.14999999999999999,
+    0.14999999999999999,0.34999999999999998,0.050000000000000003,
+    0.25,0.050000000000000003,0.25,
+    0.25,0.14999999999999999,0.14999999999999999,
+    0.25,0.25,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.14999999999999999,
+    0.34999999999999998,0.14999999999999999,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.34999999999999998,
+    0.050000000000000003,0.14999999999999999,0.25,
+    0.050000000000000003,0.25,0.14999999999999999,
+    0.050000000000000003,0.34999999999999998,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.25,
+    0.14999999999999999,0.14999999999999999,0.14999999999999999,
+    0.14999999999999999,0.25,0.050000000000000003,
+    0.25,0.050000000000000003,0.14999999999999999,
+    0.25,0.14999999999999999,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.25,
+    0.050000000000000003,0.14999999999999999,0.14999999999999999,
+    0.050000000000000003,0.25,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.14999999999999999,
+    0.14999999999999999,0.14999999999999999,0.050000000000000003,
+    0.25,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.14999999999999999,
+    0.050000000000000003,0.14999999999999999,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.050000000000000003,
+    0.055555555555600003,0.055555555555600003,0.83333333333299997,
+    0.055555555555600003,0.166666666667,0.72222222222200005,
+    0.055555555555600003,0.277777777778,0.61111111111100003,
+    0.055555555555600003,0.38888888888899997,0.5,
+    0.055555555555600003,0.5,0.38888888888899997,
+    0.055555555555600003,0.61111111111100003,0.277777777778,
+    0.055555555555600003,0.72222222222200005,0.166666666667,
+    0.055555555555600003,0.83333333333299997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.72222222222200005,
+    0.166666666667,0.166666666667,0.61111111111100003,
+    0.166666666667,0.277777777778,0.5,
+    0.166666666667,0.38888888888899997,0.38888888888899997,
+    0.166666666667,0.5,0.277777777778,
+    0.166666666667,0.61111111111100003,0.166666666667,
+    0.166666666667,0.72222222222200005,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.61111111111100003,
+    0.277777777778,0.166666666667,0.5,
+    0.277777777778,0.277777777778,0.38888888888899997,
+    0.277777777778,0.38888888888899997,0.277777777778,
+    0.277777777778,0.5,0.166666666667,
+    0.277777777778,0.61111111111100003,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.5,
+    0.38888888888899997,0.166666666667,0.38888888888899997,
+    0.38888888888899997,0.277777777778,0.277777777778,
+    0.38888888888899997,0.38888888888899997,0.166666666667,
+    0.38888888888899997,0.5,0.055555555555600003,
+    0.5,0.055555555555600003,0.38888888888899997,
+    0.5,0.166666666667,0.277777777778,
+    0.5,0.277777777778,0.166666666667,
+    0.5,0.38888888888899997,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.277777777778,
+    0.61111111111100003,0.166666666667,0.166666666667,
+    0.61111111111100003,0.277777777778,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.166666666667,
+    0.72222222222200005,0.166666666667,0.055555555555600003,
+    0.83333333333299997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.72222222222200005,
+    0.055555555555600003,0.166666666667,0.61111111111100003,
+    0.055555555555600003,0.277777777778,0.5,
+    0.055555555555600003,0.38888888888899997,0.38888888888899997,
+    0.055555555555600003,0.5,0.277777777778,
+    0.055555555555600003,0.61111111111100003,0.166666666667,
+    0.055555555555600003,0.72222222222200005,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.61111111111100003,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.277777777778,0.38888888888899997,
+    0.166666666667,0.38888888888899997,0.277777777778,
+    0.166666666667,0.5,0.166666666667,
+    0.166666666667,0.61111111111100003,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.5,
+    0.277777777778,0.166666666667,0.38888888888899997,
+    0.277777777778,0.277777777778,0.277777777778,
+    0.277777777778,0.38888888888899997,0.166666666667,
+    0.277777777778,0.5,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.38888888888899997,
+    0.38888888888899997,0.166666666667,0.277777777778,
+    0.38888888888899997,0.277777777778,0.166666666667,
+    0.38888888888899997,0.38888888888899997,0.055555555555600003,
+    0.5,0.055555555555600003,0.277777777778,
+    0.5,0.166666666667,0.166666666667,
+    0.5,0.277777777778,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.166666666667,
+    0.61111111111100003,0.166666666667,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.61111111111100003,
+    0.055555555555600003,0.166666666667,0.5,
+    0.055555555555600003,0.277777777778,0.38888888888899997,
+    0.055555555555600003,0.38888888888899997,0.277777777778,
+    0.055555555555600003,0.5,0.166666666667,
+    0.055555555555600003,0.61111111111100003,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.5,
+    0.166666666667,0.166666666667,0.38888888888899997,
+    0.166666666667,0.277777777778,0.277777777778,
+    0.166666666667,0.38888888888899997,0.166666666667,
+    0.166666666667,0.5,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.38888888888899997,
+    0.277777777778,0.166666666667,0.277777777778,
+    0.277777777778,0.277777777778,0.166666666667,
+    0.277777777778,0.38888888888899997,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.277777777778,
+    0.38888888888899997,0.166666666667,0.166666666667,
+    0.38888888888899997,0.277777777778,0.055555555555600003,
+    0.5,0.055555555555600003,0.166666666667,
+    0.5,0.166666666667,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.5,
+    0.055555555555600003,0.166666666667,0.38888888888899997,
+    0.055555555555600003,0.277777777778,0.277777777778,
+    0.055555555555600003,0.38888888888899997,0.166666666667,
+    0.055555555555600003,0.5,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.38888888888899997,
+    0.166666666667,0.166666666667,0.277777777778,
+    0.166666666667,0.277777777778,0.166666666667,
+    0.166666666667,0.38888888888899997,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.277777777778,
+    0.277777777778,0.166666666667,0.166666666667,
+    0.277777777778,0.277777777778,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.166666666667,
+    0.38888888888899997,0.166666666667,0.055555555555600003,
+    0.5,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.38888888888899997,
+    0.055555555555600003,0.166666666667,0.277777777778,
+    0.055555555555600003,0.277777777778,0.166666666667,
+    0.055555555555600003,0.38888888888899997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.277777777778,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.166666666667,0.277777777778,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.166666666667,
+    0.277777777778,0.166666666667,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.277777777778,
+    0.055555555555600003,0.166666666667,0.166666666667,
+    0.055555555555600003,0.277777777778,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.166666666667,
+    0.166666666667,0.166666666667,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.166666666667,
+    0.055555555555600003,0.166666666667,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.055555555555600003,
+    0.0625,0.0625,0.8125,
+    0.0625,0.1875,0.6875,
+    0.0625,0.3125,0.5625,
+    0.0625,0.4375,0.4375,
+    0.0625,0.5625,0.3125,
+    0.0625,0.6875,0.1875,
+    0.0625,0.8125,0.0625,
+    0.1875,0.0625,0.6875,
+    0.1875,0.1875,0.5625,
+    0.1875,0.3125,0.4375,
+    0.1875,0.4375,0.3125,
+    0.1875,0.5625,0.1875,
+    0.1875,0.6875,0.0625,
+    0.3125,0.0625,0.5625,
+    0.3125,0.1875,0.4375,
+    0.3125,0.3125,0.3125,
+    0.3125,0.4375,0.1875,
+    0.3125,0.5625,0.0625,
+    0.4375,0.0625,0.4375,
+    0.4375,0.1875,0.3125,
+    0.4375,0.3125,0.1875,
+    0.4375,0.4375,0.0625,
+    0.5625,0.0625,0.3125,
+    0.5625,0.1875,0.1875,
+    0.5625,0.3125,0.0625,
+    0.6875,0.0625,0.1875,
+    0.6875,0.1875,0.0625,
+    0.8125,0.0625,0.0625,
+    0.0625,0.0625,0.6875,
+    0.0625,0.1875,0.5625,
+    0.0625,0.3125,0.4375,
+    0.0625,0.4375,0.3125,
+    0.0625,0.5625,0.1875,
+    0.0625,0.6875,0.0625,
+    0.1875,0.0625,0.5625,
+    0.1875,0.1875,0.4375,
+    0.1875,0.3125,0.3125,
+    0.1875,0.4375,0.1875,
+    0.1875,0.5625,0.0625,
+    0.3125,0.0625,0.4375,
+    0.3125,0.1875,0.3125,
+    0.3125,0.3125,0.1875,
+    0.3125,0.4375,0.0625,
+    0.4375,0.0625,0.3125,
+    0.4375,0.1875,0.1875,
+    0.4375,0.3125,0.0625,
+    0.5625,0.0625,0.1875,
+    0.5625,0.1875,0.0625,
+    0.6875,0.0625,0.0625,
+    0.0625,0.0625,0.5625,
+    0.0625,0.1875,0.4375,
+    0.0625,0.3125,0.3125,
+    0.0625,0.4375,0.1875,
+    0.0625,0.5625,0.0625,
+    0.1875,0.0625,0.4375,
+    0.1875,0.1875,0.3125,
+    0.1875,0.3125,0.1875,
+    0.1875,0.4375,0.0625,
+    0.3125,0.0625,0.3125,
+    0.3125,0.1875,0.1875,
+    0.3125,0.3125,0.0625,
+    0.4375,0.0625,0.1875,
+    0.4375,0.1875,0.0625,
+    0.5625,0.0625,0.0625,
+    0.0625,0.0625,0.4375,
+    0.0625,0.1875,0.3125,
+    0.0625,0.3125,0.1875,
+    0.0625,0.4375,0.0625,
+    0.1875,0.0625,0.3125,
+    0.1875,0.1875,0.1875,
+    0.1875,0.3125,0.0625,
+    0.3125,0.0625,0.1875,
+    0.3125,0.1875,0.0625,
+    0.4375,0.0625,0.0625,
+    0.0625,0.0625,0.3125,
+    0.0625,0.1875,0.1875,
+    0.0625,0.3125,0.0625,
+    0.1875,0.0625,0.1875,
+    0.1875,0.1875,0.0625,
+    0.3125,0.0625,0.0625,
+    0.0625,0.0625,0.1875,
+    0.0625,0.1875,0.0625,
+    0.1875,0.0625,0.0625,
+    0.0625,0.0625,0.0625,
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.21428571428599999,0.64285714285700002,
+    0.071428571428599999,0.35714285714299998,0.5,
+    0.071428571428599999,0.5,0.35714285714299998,
+    0.071428571428599999,0.64285714285700002,0.21428571428599999,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.64285714285700002,
+    0.21428571428599999,0.21428571428599999,0.5,
+    0.21428571428599999,0.35714285714299998,0.35714285714299998,
+    0.21428571428599999,0.5,0.21428571428599999,
+    0.21428571428599999,0.64285714285700002,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.5,
+    0.35714285714299998,0.21428571428599999,0.35714285714299998,
+    0.35714285714299998,0.35714285714299998,0.21428571428599999,
+    0.35714285714299998,0.5,0.071428571428599999,
+    0.5,0.071428571428599999,0.35714285714299998,
+    0.5,0.21428571428599999,0.21428571428599999,
+    0.5,0.35714285714299998,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.21428571428599999,
+    0.64285714285700002,0.21428571428599999,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.64285714285700002,
+    0.071428571428599999,0.21428571428599999,0.5,
+    0.071428571428599999,0.35714285714299998,0.35714285714299998,
+    0.071428571428599999,0.5,0.21428571428599999,
+    0.071428571428599999,0.64285714285700002,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.5,
+    0.21428571428599999,0.21428571428599999,0.35714285714299998,
+    0.21428571428599999,0.35714285714299998,0.21428571428599999,
+    0.21428571428599999,0.5,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.35714285714299998,
+    0.35714285714299998,0.21428571428599999,0.21428571428599999,
+    0.35714285714299998,0.35714285714299998,0.071428571428599999,
+    0.5,0.071428571428599999,0.21428571428599999,
+    0.5,0.21428571428599999,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.5,
+    0.071428571428599999,0.21428571428599999,0.35714285714299998,
+    0.071428571428599999,0.35714285714299998,0.21428571428599999,
+    0.071428571428599999,0.5,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.35714285714299998,
+    0.21428571428599999,0.21428571428599999,0.21428571428599999,
+    0.21428571428599999,0.35714285714299998,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.21428571428599999,
+    0.35714285714299998,0.21428571428599999,0.071428571428599999,
+    0.5,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.35714285714299998,
+    0.071428571428599999,0.21428571428599999,0.21428571428599999,
+    0.071428571428599999,0.35714285714299998,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.21428571428599999,
+    0.21428571428599999,0.21428571428599999,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.21428571428599999,
+    0.071428571428599999,0.21428571428599999,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.083333333333299994,0.083333333333299994,0.75,
+    0.083333333333299994,0.25,0.58333333333299997,
+    0.083333333333299994,0.41666666666699997,0.41666666666699997,
+    0.083333333333299994,0.58333333333299997,0.25,
+    0.083333333333299994,0.75,0.083333333333299994,
+    0.25,0.083333333333299994,0.58333333333299997,
+    0.25,0.25,0.41666666666699997,
+    0.25,0.41666666666699997,0.25,
+    0.25,0.58333333333299997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.41666666666699997,
+    0.41666666666699997,0.25,0.25,
+    0.41666666666699997,0.41666666666699997,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.25,
+    0.58333333333299997,0.25,0.083333333333299994,
+    0.75,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.58333333333299997,
+    0.083333333333299994,0.25,0.41666666666699997,
+    0.083333333333299994,0.41666666666699997,0.25,
+    0.083333333333299994,0.58333333333299997,0.083333333333299994,
+    0.25,0.083333333333299994,0.41666666666699997,
+    0.25,0.25,0.25,
+    0.25,0.41666666666699997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.25,
+    0.41666666666699997,0.25,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.41666666666699997,
+    0.083333333333299994,0.25,0.25,
+    0.083333333333299994,0.41666666666699997,0.083333333333299994,
+    0.25,0.083333333333299994,0.25,
+    0.25,0.25,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.25,
+    0.083333333333299994,0.25,0.083333333333299994,
+    0.25,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.083333333333299994,
+    0.10000000000000001,0.10000000000000001,0.69999999999999996,
+    0.10000000000000001,0.29999999999999999,0.5,
+    0.10000000000000001,0.5,0.29999999999999999,
+    0.10000000000000001,0.69999999999999996,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.5,
+    0.29999999999999999,0.29999999999999999,0.29999999999999999,
+    0.29999999999999999,0.5,0.10000000000000001,
+    0.5,0.10000000000000001,0.29999999999999999,
+    0.5,0.29999999999999999,0.10000000000000001,
+    0.69999999999999996,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.5,
+    0.10000000000000001,0.29999999999999999,0.29999999999999999,
+    0.10000000000000001,0.5,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.29999999999999999,
+    0.29999999999999999,0.29999999999999999,0.10000000000000001,
+    0.5,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.29999999999999999,
+    0.10000000000000001,0.29999999999999999,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.10000000000000001,
+    0.125,0.125,0.625,
+    0.125,0.375,0.375,
+    0.125,0.625,0.125,
+    0.375,0.125,0.375,
+    0.375,0.375,0.125,
+    0.625,0.125,0.125,
+    0.125,0.125,0.375,
+    0.125,0.375,0.125,
+    0.375,0.125,0.125,
+    0.125,0.125,0.125,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.25,0.25,0.25
+};
+static constexpr double gpweights18[] =
+{
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    0.10882393389433299,0.10882393389433299,0.10882393389433299,0.10882393389433299,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,-0.39145882126833298,-0.39145882126833298,-0.39145882126833298,
+    -0.39145882126833298,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,0.55524296216333302,0.55524296216333302,0.55524296216333302,
+    0.55524296216333302,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,-0.39490613155666698,-0.39490613155666698,-0.39490613155666698,
+    -0.39490613155666698,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,0.14836808592799999,0.14836808592799999,0.14836808592799999,
+    0.14836808592799999,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    -0.028553147692667001,-0.028553147692667001,-0.028553147692667001,-0.028553147692667001,
+    0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,
+    0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,
+    0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,
+    0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,
+    0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,0.0025322582098500001,
+    -8.3414141296000004e-05,-8.3414141296000004e-05,-8.3414141296000004e-05,-8.3414141296000004e-05,
+    -8.3414141296000004e-05,-8.3414141296000004e-05,-8.3414141296000004e-05,-8.3414141296000004e-05,
+    -8.3414141296000004e-05,-8.3414141296000004e-05,6.6130980188e-07,6.6130980188e-07,
+    6.6130980188e-07,6.6130980188e-07,-4.6404125000000002e-10
+};
+
+static constexpr double gpcoordinates20[] =
+{
+    0.041666666666699999,0.041666666666699999,0.875,
+    0.041666666666699999,0.125,0.79166666666700003,
+    0.041666666666699999,0.208333333333,0.70833333333299997,
+    0.041666666666699999,0.29166666666699997,0.625,
+    0.041666666666699999,0.375,0.54166666666700003,
+    0.041666666666699999,0.45833333333300003,0.45833333333300003,
+    0.041666666666699999,0.54166666666700003,0.375,
+    0.041666666666699999,0.625,0.29166666666699997,
+    0.041666666666699999,0.70833333333299997,0.208333333333,
+    0.041666666666699999,0.79166666666700003,0.125,
+    0.041666666666699999,0.875,0.041666666666699999,
+    0.125,0.041666666666699999,0.79166666666700003,
+    0.125,0.125,0.70833333333299997,
+    0.125,0.208333333333,0.625,
+    0.125,0.29166666666699997,0.54166666666700003,
+    0.125,0.375,0.45833333333300003,
+    0.125,0.45833333333300003,0.375,
+    0.125,0.54166666666700003,0.29166666666699997,
+    0.125,0.625,0.208333333333,
+    0.125,0.70833333333299997,0.125,
+    0.125,0.79166666666700003,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.70833333333299997,
+    0.208333333333,0.125,0.625,
+    0.208333333333,0.208333333333,0.54166666666700003,
+    0.208333333333,0.29166666666699997,0.45833333333300003,
+    0.208333333333,0.375,0.375,
+    0.208333333333,0.45833333333300003,0.29166666666699997,
+    0.208333333333,0.54166666666700003,0.208333333333,
+    0.208333333333,0.625,0.125,
+    0.208333333333,0.70833333333299997,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.625,
+    0.29166666666699997,0.125,0.54166666666700003,
+    0.29166666666699997,0.208333333333,0.45833333333300003,
+    0.29166666666699997,0.29166666666699997,0.375,
+    0.29166666666699997,0.375,0.29166666666699997,
+    0.29166666666699997,0.45833333333300003,0.208333333333,
+    0.29166666666699997,0.54166666666700003,0.125,
+    0.29166666666699997,0.625,0.041666666666699999,
+    0.375,0.041666666666699999,0.54166666666700003,
+    0.375,0.125,0.45833333333300003,
+    0.375,0.208333333333,0.375,
+    0.375,0.29166666666699997,0.29166666666699997,
+    0.375,0.375,0.208333333333,
+    0.375,0.45833333333300003,0.125,
+    0.375,0.54166666666700003,0.041666666666699999,
+    0.45833333333300003,0.041666666666699999,0.45833333333300003,
+    0.45833333333300003,0.125,0.375,
+    0.45833333333300003,0.208333333333,0.29166666666699997,
+    0.45833333333300003,0.29166666666699997,0.208333333333,
+    0.45833333333300003,0.375,0.125,
+    0.45833333333300003,0.45833333333300003,0.041666666666699999,
+    0.54166666666700003,0.041666666666699999,0.375,
+    0.54166666666700003,0.125,0.29166666666699997,
+    0.54166666666700003,0.208333333333,0.208333333333,
+    0.54166666666700003,0.29166666666699997,0.125,
+    0.54166666666700003,0.375,0.041666666666699999,
+    0.625,0.041666666666699999,0.29166666666699997,
+    0.625,0.125,0.208333333333,
+    0.625,0.208333333333,0.125,
+    0.625,0.29166666666699997,0.041666666666699999,
+    0.70833333333299997,0.041666666666699999,0.208333333333,
+    0.70833333333299997,0.125,0.125,
+    0.70833333333299997,0.208333333333,0.041666666666699999,
+    0.79166666666700003,0.041666666666699999,0.125,
+    0.79166666666700003,0.125,0.041666666666699999,
+    0.875,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.79166666666700003,
+    0.041666666666699999,0.125,0.70833333333299997,
+    0.041666666666699999,0.208333333333,0.625,
+    0.041666666666699999,0.29166666666699997,0.54166666666700003,
+    0.041666666666699999,0.375,0.45833333333300003,
+    0.041666666666699999,0.45833333333300003,0.375,
+    0.041666666666699999,0.54166666666700003,0.29166666666699997,
+    0.041666666666699999,0.625,0.208333333333,
+    0.041666666666699999,0.70833333333299997,0.125,
+    0.041666666666699999,0.79166666666700003,0.041666666666699999,
+    0.125,0.041666666666699999,0.70833333333299997,
+    0.125,0.125,0.625,
+    0.125,0.208333333333,0.54166666666700003,
+    0.125,0.29166666666699997,0.45833333333300003,
+    0.125,0.375,0.375,
+    0.125,0.45833333333300003,0.29166666666699997,
+    0.125,0.54166666666700003,0.208333333333,
+    0.125,0.625,0.125,
+    0.125,0.70833333333299997,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.625,
+    0.208333333333,0.125,0.54166666666700003,
+    0.208333333333,0.208333333333,0.45833333333300003,
+    0.208333333333,0.29166666666699997,0.375,
+    0.208333333333,0.375,0.29166666666699997,
+    0.208333333333,0.45833333333300003,0.208333333333,
+    0.208333333333,0.54166666666700003,0.125,
+    0.208333333333,0.625,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.54166666666700003,
+    0.29166666666699997,0.125,0.45833333333300003,
+    0.29166666666699997,0.208333333333,0.375,
+    0.29166666666699997,0.29166666666699997,0.29166666666699997,
+    0.29166666666699997,0.375,0.208333333333,
+    0.29166666666699997,0.45833333333300003,0.125,
+    0.29166666666699997,0.54166666666700003,0.041666666666699999,
+    0.375,0.041666666666699999,0.45833333333300003,
+    0.375,0.125,0.375,
+    0.375,0.208333333333,0.29166666666699997,
+    0.375,0.29166666666699997,0.208333333333,
+    0.375,0.375,0.125,
+    0.375,0.45833333333300003,0.041666666666699999,
+    0.45833333333300003,0.041666666666699999,0.375,
+    0.45833333333300003,0.125,0.29166666666699997,
+    0.45833333333300003,0.208333333333,0.208333333333,
+    0.45833333333300003,0.29166666666699997,0.125,
+    0.45833333333300003,0.375,0.041666666666699999,
+    0.54166666666700003,0.041666666666699999,0.29166666666699997,
+    0.54166666666700003,0.125,0.208333333333,
+    0.54166666666700003,0.208333333333,0.125,
+    0.54166666666700003,0.29166666666699997,0.041666666666699999,
+    0.625,0.041666666666699999,0.208333333333,
+    0.625,0.125,0.125,
+    0.625,0.208333333333,0.041666666666699999,
+    0.70833333333299997,0.041666666666699999,0.125,
+    0.70833333333299997,0.125,0.041666666666699999,
+    0.79166666666700003,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.70833333333299997,
+    0.041666666666699999,0.125,0.625,
+    0.041666666666699999,0.208333333333,0.54166666666700003,
+    0.041666666666699999,0.29166666666699997,0.45833333333300003,
+    0.041666666666699999,0.375,0.375,
+    0.041666666666699999,0.45833333333300003,0.29166666666699997,
+    0.041666666666699999,0.54166666666700003,0.208333333333,
+    0.041666666666699999,0.625,0.125,
+    0.041666666666699999,0.70833333333299997,0.041666666666699999,
+    0.125,0.041666666666699999,0.625,
+    0.125,0.125,0.54166666666700003,
+    0.125,0.208333333333,0.45833333333300003,
+    0.125,0.29166666666699997,0.375,
+    0.125,0.375,0.29166666666699997,
+    0.125,0.45833333333300003,0.208333333333,
+    0.125,0.54166666666700003,0.125,
+    0.125,0.625,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.54166666666700003,
+    0.208333333333,0.125,0.45833333333300003,
+    0.208333333333,0.208333333333,0.375,
+    0.208333333333,0.29166666666699997,0.29166666666699997,
+    0.208333333333,0.375,0.208333333333,
+    0.208333333333,0.45833333333300003,0.125,
+    0.208333333333,0.54166666666700003,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.45833333333300003,
+    0.29166666666699997,0.125,0.375,
+    0.29166666666699997,0.208333333333,0.29166666666699997,
+    0.29166666666699997,0.29166666666699997,0.208333333333,
+    0.29166666666699997,0.375,0.125,
+    0.29166666666699997,0.45833333333300003,0.041666666666699999,
+    0.375,0.041666666666699999,0.375,
+    0.375,0.125,0.29166666666699997,
+    0.375,0.208333333333,0.208333333333,
+    0.375,0.29166666666699997,0.125,
+    0.375,0.375,0.041666666666699999,
+    0.45833333333300003,0.041666666666699999,0.29166666666699997,
+    0.45833333333300003,0.125,0.208333333333,
+    0.45833333333300003,0.208333333333,0.125,
+    0.45833333333300003,0.29166666666699997,0.041666666666699999,
+    0.54166666666700003,0.041666666666699999,0.208333333333,
+    0.54166666666700003,0.125,0.125,
+    0.54166666666700003,0.208333333333,0.041666666666699999,
+    0.625,0.041666666666699999,0.125,
+    0.625,0.125,0.041666666666699999,
+    0.70833333333299997,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.625,
+    0.041666666666699999,0.125,0.54166666666700003,
+    0.041666666666699999,0.208333333333,0.45833333333300003,
+    0.041666666666699999,0.29166666666699997,0.375,
+    0.041666666666699999,0.375,0.29166666666699997,
+    0.041666666666699999,0.45833333333300003,0.208333333333,
+    0.041666666666699999,0.54166666666700003,0.125,
+    0.041666666666699999,0.625,0.041666666666699999,
+    0.125,0.041666666666699999,0.54166666666700003,
+    0.125,0.125,0.45833333333300003,
+    0.125,0.208333333333,0.375,
+    0.125,0.29166666666699997,0.29166666666699997,
+    0.125,0.375,0.208333333333,
+    0.125,0.45833333333300003,0.125,
+    0.125,0.54166666666700003,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.45833333333300003,
+    0.208333333333,0.125,0.375,
+    0.208333333333,0.208333333333,0.29166666666699997,
+    0.208333333333,0.29166666666699997,0.208333333333,
+    0.208333333333,0.375,0.125,
+    0.208333333333,0.45833333333300003,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.375,
+    0.29166666666699997,0.125,0.29166666666699997,
+    0.29166666666699997,0.208333333333,0.208333333333,
+    0.29166666666699997,0.29166666666699997,0.125,
+    0.29166666666699997,0.375,0.041666666666699999,
+    0.375,0.041666666666699999,0.29166666666699997,
+    0.375,0.125,0.208333333333,
+    0.375,0.208333333333,0.125,
+    0.375,0.29166666666699997,0.041666666666699999,
+    0.45833333333300003,0.041666666666699999,0.208333333333,
+    0.45833333333300003,0.125,0.125,
+    0.45833333333300003,0.208333333333,0.041666666666699999,
+    0.54166666666700003,0.041666666666699999,0.125,
+    0.54166666666700003,0.125,0.041666666666699999,
+    0.625,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.54166666666700003,
+    0.041666666666699999,0.125,0.45833333333300003,
+    0.041666666666699999,0.208333333333,0.375,
+    0.041666666666699999,0.29166666666699997,0.29166666666699997,
+    0.041666666666699999,0.375,0.208333333333,
+    0.041666666666699999,0.45833333333300003,0.125,
+    0.041666666666699999,0.54166666666700003,0.041666666666699999,
+    0.125,0.041666666666699999,0.45833333333300003,
+    0.125,0.125,0.375,
+    0.125,0.208333333333,0.29166666666699997,
+    0.125,0.29166666666699997,0.208333333333,
+    0.125,0.375,0.125,
+    0.125,0.45833333333300003,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.375,
+    0.208333333333,0.125,0.29166666666699997,
+    0.208333333333,0.208333333333,0.208333333333,
+    0.208333333333,0.29166666666699997,0.125,
+    0.208333333333,0.375,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.29166666666699997,
+    0.29166666666699997,0.125,0.208333333333,
+    0.29166666666699997,0.208333333333,0.125,
+    0.29166666666699997,0.29166666666699997,0.041666666666699999,
+    0.375,0.041666666666699999,0.208333333333,
+    0.375,0.125,0.125,
+    0.375,0.208333333333,0.041666666666699999,
+    0.45833333333300003,0.041666666666699999,0.125,
+    0.45833333333300003,0.125,0.041666666666699999,
+    0.54166666666700003,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.45833333333300003,
+    0.041666666666699999,0.125,0.375,
+    0.041666666666699999,0.208333333333,0.29166666666699997,
+    0.041666666666699999,0.29166666666699997,0.208333333333,
+    0.041666666666699999,0.375,0.125,
+    0.041666666666699999,0.45833333333300003,0.041666666666699999,
+    0.125,0.041666666666699999,0.375,
+    0.125,0.125,0.29166666666699997,
+    0.125,0.208333333333,0.208333333333,
+    0.125,0.29166666666699997,0.125,
+    0.125,0.375,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.29166666666699997,
+    0.208333333333,0.125,0.208333333333,
+    0.208333333333,0.208333333333,0.125,
+    0.208333333333,0.29166666666699997,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.208333333333,
+    0.29166666666699997,0.125,0.125,
+    0.29166666666699997,0.208333333333,0.041666666666699999,
+    0.375,0.041666666666699999,0.125,
+    0.375,0.125,0.041666666666699999,
+    0.45833333333300003,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.375,
+    0.041666666666699999,0.125,0.29166666666699997,
+    0.041666666666699999,0.208333333333,0.208333333333,
+    0.041666666666699999,0.29166666666699997,0.125,
+    0.041666666666699999,0.375,0.041666666666699999,
+    0.125,0.041666666666699999,0.29166666666699997,
+    0.125,0.125,0.208333333333,
+    0.125,0.208333333333,0.125,
+    0.125,0.29166666666699997,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.208333333333,
+    0.208333333333,0.125,0.125,
+    0.208333333333,0.208333333333,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.125,
+    0.29166666666699997,0.125,0.041666666666699999,
+    0.375,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.29166666666699997,
+    0.041666666666699999,0.125,0.208333333333,
+    0.041666666666699999,0.208333333333,0.125,
+    0.041666666666699999,0.29166666666699997,0.041666666666699999,
+    0.125,0.041666666666699999,0.208333333333,
+    0.125,0.125,0.125,
+    0.125,0.208333333333,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.125,
+    0.208333333333,0.125,0.041666666666699999,
+    0.29166666666699997,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.208333333333,
+    0.041666666666699999,0.125,0.125,
+    0.041666666666699999,0.208333333333,0.041666666666699999,
+    0.125,0.041666666666699999,0.125,
+    0.125,0.125,0.041666666666699999,
+    0.208333333333,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.125,
+    0.041666666666699999,0.125,0.041666666666699999,
+    0.125,0.041666666666699999,0.041666666666699999,
+    0.041666666666699999,0.041666666666699999,0.041666666666699999,
+    0.045454545454499999,0.045454545454499999,0.86363636363600005,
+    0.045454545454499999,0.13636363636400001,0.77272727272700004,
+    0.045454545454499999,0.22727272727299999,0.68181818181800002,
+    0.045454545454499999,0.31818181818199998,0.59090909090900001,
+    0.045454545454499999,0.40909090909099999,0.5,
+    0.045454545454499999,0.5,0.40909090909099999,
+    0.045454545454499999,0.59090909090900001,0.31818181818199998,
+    0.045454545454499999,0.68181818181800002,0.22727272727299999,
+    0.045454545454499999,0.77272727272700004,0.13636363636400001,
+    0.045454545454499999,0.86363636363600005,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.77272727272700004,
+    0.13636363636400001,0.13636363636400001,0.68181818181800002,
+    0.13636363636400001,0.22727272727299999,0.59090909090900001,
+    0.13636363636400001,0.31818181818199998,0.5,
+    0.13636363636400001,0.40909090909099999,0.40909090909099999,
+    0.13636363636400001,0.5,0.31818181818199998,
+    0.13636363636400001,0.59090909090900001,0.22727272727299999,
+    0.13636363636400001,0.68181818181800002,0.13636363636400001,
+    0.13636363636400001,0.77272727272700004,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.68181818181800002,
+    0.22727272727299999,0.13636363636400001,0.59090909090900001,
+    0.22727272727299999,0.22727272727299999,0.5,
+    0.22727272727299999,0.31818181818199998,0.40909090909099999,
+    0.22727272727299999,0.40909090909099999,0.31818181818199998,
+    0.22727272727299999,0.5,0.22727272727299999,
+    0.22727272727299999,0.59090909090900001,0.13636363636400001,
+    0.22727272727299999,0.68181818181800002,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.59090909090900001,
+    0.31818181818199998,0.13636363636400001,0.5,
+    0.31818181818199998,0.22727272727299999,0.40909090909099999,
+    0.31818181818199998,0.31818181818199998,0.31818181818199998,
+    0.31818181818199998,0.40909090909099999,0.22727272727299999,
+    0.31818181818199998,0.5,0.13636363636400001,
+    0.31818181818199998,0.59090909090900001,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.5,
+    0.40909090909099999,0.13636363636400001,0.40909090909099999,
+    0.40909090909099999,0.22727272727299999,0.31818181818199998,
+    0.40909090909099999,0.31818181818199998,0.22727272727299999,
+    0.40909090909099999,0.40909090909099999,0.13636363636400001,
+    0.40909090909099999,0.5,0.045454545454499999,
+    0.5,0.045454545454499999,0.40909090909099999,
+    0.5,0.13636363636400001,0.31818181818199998,
+    0.5,0.22727272727299999,0.22727272727299999,
+    0.5,0.31818181818199998,0.13636363636400001,
+    0.5,0.40909090909099999,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.31818181818199998,
+    0.59090909090900001,0.13636363636400001,0.22727272727299999,
+    0.59090909090900001,0.22727272727299999,0.13636363636400001,
+    0.59090909090900001,0.31818181818199998,0.045454545454499999,
+    0.68181818181800002,0.045454545454499999,0.22727272727299999,
+    0.68181818181800002,0.13636363636400001,0.13636363636400001,
+    0.68181818181800002,0.22727272727299999,0.045454545454499999,
+    0.77272727272700004,0.045454545454499999,0.13636363636400001,
+    0.77272727272700004,0.13636363636400001,0.045454545454499999,
+    0.86363636363600005,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.77272727272700004,
+    0.045454545454499999,0.13636363636400001,0.68181818181800002,
+    0.045454545454499999,0.22727272727299999,0.59090909090900001,
+    0.045454545454499999,0.31818181818199998,0.5,
+    0.045454545454499999,0.40909090909099999,0.40909090909099999,
+    0.045454545454499999,0.5,0.31818181818199998,
+    0.045454545454499999,0.59090909090900001,0.22727272727299999,
+    0.045454545454499999,0.68181818181800002,0.13636363636400001,
+    0.045454545454499999,0.77272727272700004,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.68181818181800002,
+    0.13636363636400001,0.13636363636400001,0.59090909090900001,
+    0.13636363636400001,0.22727272727299999,0.5,
+    0.13636363636400001,0.31818181818199998,0.40909090909099999,
+    0.13636363636400001,0.40909090909099999,0.31818181818199998,
+    0.13636363636400001,0.5,0.22727272727299999,
+    0.13636363636400001,0.59090909090900001,0.13636363636400001,
+    0.13636363636400001,0.68181818181800002,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.59090909090900001,
+    0.22727272727299999,0.13636363636400001,0.5,
+    0.22727272727299999,0.22727272727299999,0.40909090909099999,
+    0.22727272727299999,0.31818181818199998,0.31818181818199998,
+    0.22727272727299999,0.40909090909099999,0.22727272727299999,
+    0.22727272727299999,0.5,0.13636363636400001,
+    0.22727272727299999,0.59090909090900001,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.5,
+    0.31818181818199998,0.13636363636400001,0.40909090909099999,
+    0.31818181818199998,0.22727272727299999,0.31818181818199998,
+    0.31818181818199998,0.31818181818199998,0.22727272727299999,
+    0.31818181818199998,0.40909090909099999,0.13636363636400001,
+    0.31818181818199998,0.5,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.40909090909099999,
+    0.40909090909099999,0.13636363636400001,0.31818181818199998,
+    0.40909090909099999,0.22727272727299999,0.22727272727299999,
+    0.40909090909099999,0.31818181818199998,0.13636363636400001,
+    0.40909090909099999,0.40909090909099999,0.045454545454499999,
+    0.5,0.045454545454499999,0.31818181818199998,
+    0.5,0.13636363636400001,0.22727272727299999,
+    0.5,0.22727272727299999,0.13636363636400001,
+    0.5,0.31818181818199998,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.22727272727299999,
+    0.59090909090900001,0.13636363636400001,0.13636363636400001,
+    0.59090909090900001,0.22727272727299999,0.045454545454499999,
+    0.68181818181800002,0.045454545454499999,0.13636363636400001,
+    0.68181818181800002,0.13636363636400001,0.045454545454499999,
+    0.77272727272700004,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.68181818181800002,
+    0.045454545454499999,0.13636363636400001,0.59090909090900001,
+    0.045454545454499999,0.22727272727299999,0.5,
+    0.045454545454499999,0.31818181818199998,0.40909090909099999,
+    0.045454545454499999,0.40909090909099999,0.31818181818199998,
+    0.045454545454499999,0.5,0.22727272727299999,
+    0.045454545454499999,0.59090909090900001,0.13636363636400001,
+    0.045454545454499999,0.68181818181800002,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.59090909090900001,
+    0.13636363636400001,0.13636363636400001,0.5,
+    0.13636363636400001,0.22727272727299999,0.40909090909099999,
+    0.13636363636400001,0.31818181818199998,0.31818181818199998,
+    0.13636363636400001,0.40909090909099999,0.22727272727299999,
+    0.13636363636400001,0.5,0.13636363636400001,
+    0.13636363636400001,0.59090909090900001,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.5,
+    0.22727272727299999,0.13636363636400001,0.40909090909099999,
+    0.22727272727299999,0.22727272727299999,0.31818181818199998,
+    0.22727272727299999,0.31818181818199998,0.22727272727299999,
+    0.22727272727299999,0.40909090909099999,0.13636363636400001,
+    0.22727272727299999,0.5,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.40909090909099999,
+    0.31818181818199998,0.13636363636400001,0.31818181818199998,
+    0.31818181818199998,0.22727272727299999,0.22727272727299999,
+    0.31818181818199998,0.31818181818199998,0.13636363636400001,
+    0.31818181818199998,0.40909090909099999,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.31818181818199998,
+    0.40909090909099999,0.13636363636400001,0.22727272727299999,
+    0.40909090909099999,0.22727272727299999,0.13636363636400001,
+    0.40909090909099999,0.31818181818199998,0.045454545454499999,
+    0.5,0.045454545454499999,0.22727272727299999,
+    0.5,0.13636363636400001,0.13636363636400001,
+    0.5,0.22727272727299999,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.13636363636400001,
+    0.59090909090900001,0.13636363636400001,0.045454545454499999,
+    0.68181818181800002,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.59090909090900001,
+    0.045454545454499999,0.13636363636400001,0.5,
+    0.045454545454499999,0.22727272727299999,0.40909090909099999,
+    0.045454545454499999,0.31818181818199998,0.31818181818199998,
+    0.045454545454499999,0.40909090909099999,0.22727272727299999,
+    0.045454545454499999,0.5,0.13636363636400001,
+    0.045454545454499999,0.59090909090900001,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.5,
+    0.13636363636400001,0.13636363636400001,0.40909090909099999,
+    0.13636363636400001,0.22727272727299999,0.31818181818199998,
+    0.13636363636400001,0.31818181818199998,0.22727272727299999,
+    0.13636363636400001,0.40909090909099999,0.13636363636400001,
+    0.13636363636400001,0.5,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.40909090909099999,
+    0.22727272727299999,0.13636363636400001,0.31818181818199998,
+    0.22727272727299999,0.22727272727299999,0.22727272727299999,
+    0.22727272727299999,0.31818181818199998,0.13636363636400001,
+    0.22727272727299999,0.40909090909099999,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.31818181818199998,
+    0.31818181818199998,0.13636363636400001,0.22727272727299999,
+    0.31818181818199998,0.22727272727299999,0.13636363636400001,
+    0.31818181818199998,0.31818181818199998,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.22727272727299999,
+    0.40909090909099999,0.13636363636400001,0.13636363636400001,
+    0.40909090909099999,0.22727272727299999,0.045454545454499999,
+    0.5,0.045454545454499999,0.13636363636400001,
+    0.5,0.13636363636400001,0.045454545454499999,
+    0.59090909090900001,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.5,
+    0.045454545454499999,0.13636363636400001,0.40909090909099999,
+    0.045454545454499999,0.22727272727299999,0.31818181818199998,
+    0.045454545454499999,0.31818181818199998,0.22727272727299999,
+    0.045454545454499999,0.40909090909099999,0.13636363636400001,
+    0.045454545454499999,0.5,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.40909090909099999,
+    0.13636363636400001,0.13636363636400001,0.31818181818199998,
+    0.13636363636400001,0.22727272727299999,0.22727272727299999,
+    0.13636363636400001,0.31818181818199998,0.13636363636400001,
+    0.13636363636400001,0.40909090909099999,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.31818181818199998,
+    0.22727272727299999,0.13636363636400001,0.22727272727299999,
+    0.22727272727299999,0.22727272727299999,0.13636363636400001,
+    0.22727272727299999,0.31818181818199998,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.22727272727299999,
+    0.31818181818199998,0.13636363636400001,0.13636363636400001,
+    0.31818181818199998,0.22727272727299999,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.13636363636400001,
+    0.40909090909099999,0.13636363636400001,0.045454545454499999,
+    0.5,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.40909090909099999,
+    0.045454545454499999,0.13636363636400001,0.31818181818199998,
+    0.045454545454499999,0.22727272727299999,0.22727272727299999,
+    0.045454545454499999,0.31818181818199998,0.13636363636400001,
+    0.045454545454499999,0.40909090909099999,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.31818181818199998,
+    0.13636363636400001,0.13636363636400001,0.22727272727299999,
+    0.13636363636400001,0.22727272727299999,0.13636363636400001,
+    0.13636363636400001,0.31818181818199998,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.22727272727299999,
+    0.22727272727299999,0.13636363636400001,0.13636363636400001,
+    0.22727272727299999,0.22727272727299999,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.13636363636400001,
+    0.31818181818199998,0.13636363636400001,0.045454545454499999,
+    0.40909090909099999,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.31818181818199998,
+    0.045454545454499999,0.13636363636400001,0.22727272727299999,
+    0.045454545454499999,0.22727272727299999,0.13636363636400001,
+    0.045454545454499999,0.31818181818199998,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.22727272727299999,
+    0.13636363636400001,0.13636363636400001,0.13636363636400001,
+    0.13636363636400001,0.22727272727299999,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.13636363636400001,
+    0.22727272727299999,0.13636363636400001,0.045454545454499999,
+    0.31818181818199998,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.22727272727299999,
+    0.045454545454499999,0.13636363636400001,0.13636363636400001,
+    0.045454545454499999,0.22727272727299999,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.13636363636400001,
+    0.13636363636400001,0.13636363636400001,0.045454545454499999,
+    0.22727272727299999,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.13636363636400001,
+    0.045454545454499999,0.13636363636400001,0.045454545454499999,
+    0.13636363636400001,0.045454545454499999,0.045454545454499999,
+    0.045454545454499999,0.045454545454499999,0.045454545454499999,
+    0.050000000000000003,0.050000000000000003,0.84999999999999998,
+    0.050000000000000003,0.14999999999999999,0.75,
+    0.050000000000000003,0.25,0.65000000000000002,
+    0.050000000000000003,0.34999999999999998,0.55000000000000004,
+    0.050000000000000003,0.45000000000000001,0.45000000000000001,
+    0.050000000000000003,0.55000000000000004,0.34999999999999998,
+    0.050000000000000003,0.65000000000000002,0.25,
+    0.050000000000000003,0.75,0.14999999999999999,
+    0.050000000000000003,0.84999999999999998,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.75,
+    0.14999999999999999,0.14999999999999999,0.65000000000000002,
+    0.14999999999999999,0.25,0.55000000000000004,
+    0.14999999999999999,0.34999999999999998,0.45000000000000001,
+    0.14999999999999999,0.45000000000000001,0.34999999999999998,
+    0.14999999999999999,0.55000000000000004,0.25,
+    0.14999999999999999,0.65000000000000002,0.14999999999999999,
+    0.14999999999999999,0.75,0.050000000000000003,
+    0.25,0.050000000000000003,0.65000000000000002,
+    0.25,0.14999999999999999,0.55000000000000004,
+    0.25,0.25,0.45000000000000001,
+    0.25,0.34999999999999998,0.34999999999999998,
+    0.25,0.45000000000000001,0.25,
+    0.25,0.55000000000000004,0.14999999999999999,
+    0.25,0.65000000000000002,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.55000000000000004,
+    0.34999999999999998,0.14999999999999999,0.45000000000000001,
+    0.34999999999999998,0.25,0.34999999999999998,
+    0.34999999999999998,0.34999999999999998,0.25,
+    0.34999999999999998,0.45000000000000001,0.14999999999999999,
+    0.34999999999999998,0.55000000000000004,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.45000000000000001,
+    0.45000000000000001,0.14999999999999999,0.34999999999999998,
+    0.45000000000000001,0.25,0.25,
+    0.45000000000000001,0.34999999999999998,0.14999999999999999,
+    0.45000000000000001,0.45000000000000001,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.34999999999999998,
+    0.55000000000000004,0.14999999999999999,0.25,
+    0.55000000000000004,0.25,0.14999999999999999,
+    0.55000000000000004,0.34999999999999998,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.25,
+    0.65000000000000002,0.14999999999999999,0.14999999999999999,
+    0.65000000000000002,0.25,0.050000000000000003,
+    0.75,0.050000000000000003,0.14999999999999999,
+    0.75,0.14999999999999999,0.050000000000000003,
+    0.84999999999999998,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.75,
+    0.050000000000000003,0.14999999999999999,0.65000000000000002,
+    0.050000000000000003,0.25,0.55000000000000004,
+    0.050000000000000003,0.34999999999999998,0.45000000000000001,
+    0.050000000000000003,0.45000000000000001,0.34999999999999998,
+    0.050000000000000003,0.55000000000000004,0.25,
+    0.050000000000000003,0.65000000000000002,0.14999999999999999,
+    0.050000000000000003,0.75,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.65000000000000002,
+    0.14999999999999999,0.14999999999999999,0.55000000000000004,
+    0.14999999999999999,0.25,0.45000000000000001,
+    0.14999999999999999,0.34999999999999998,0.34999999999999998,
+    0.14999999999999999,0.45000000000000001,0.25,
+    0.14999999999999999,0.55000000000000004,0.14999999999999999,
+    0.14999999999999999,0.65000000000000002,0.050000000000000003,
+    0.25,0.050000000000000003,0.55000000000000004,
+    0.25,0.14999999999999999,0.45000000000000001,
+    0.25,0.25,0.34999999999999998,
+    0.25,0.34999999999999998,0.25,
+    0.25,0.45000000000000001,0.14999999999999999,
+    0.25,0.55000000000000004,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.45000000000000001,
+    0.34999999999999998,0.14999999999999999,0.34999999999999998,
+    0.34999999999999998,0.25,0.25,
+    0.34999999999999998,0.34999999999999998,0.14999999999999999,
+    0.34999999999999998,0.45000000000000001,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.34999999999999998,
+    0.45000000000000001,0.14999999999999999,0.25,
+    0.45000000000000001,0.25,0.14999999999999999,
+    0.45000000000000001,0.34999999999999998,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.25,
+    0.55000000000000004,0.14999999999999999,0.14999999999999999,
+    0.55000000000000004,0.25,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.14999999999999999,
+    0.65000000000000002,0.14999999999999999,0.050000000000000003,
+    0.75,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.65000000000000002,
+    0.050000000000000003,0.14999999999999999,0.55000000000000004,
+    0.050000000000000003,0.25,0.45000000000000001,
+    0.050000000000000003,0.34999999999999998,0.34999999999999998,
+    0.050000000000000003,0.45000000000000001,0.25,
+    0.050000000000000003,0.55000000000000004,0.14999999999999999,
+    0.050000000000000003,0.65000000000000002,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.55000000000000004,
+    0.14999999999999999,0.14999999999999999,0.45000000000000001,
+    0.14999999999999999,0.25,0.34999999999999998,
+    0.14999999999999999,0.34999999999999998,0.25,
+    0.14999999999999999,0.45000000000000001,0.14999999999999999,
+    0.14999999999999999,0.55000000000000004,0.050000000000000003,
+    0.25,0.050000000000000003,0.45000000000000001,
+    0.25,0.14999999999999999,0.34999999999999998,
+    0.25,0.25,0.25,
+    0.25,0.34999999999999998,0.14999999999999999,
+    0.25,0.45000000000000001,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.34999999999999998,
+    0.34999999999999998,0.14999999999999999,0.25,
+    0.34999999999999998,0.25,0.14999999999999999,
+    0.34999999999999998,0.34999999999999998,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.25,
+    0.45000000000000001,0.14999999999999999,0.14999999999999999,
+    0.45000000000000001,0.25,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.14999999999999999,
+    0.55000000000000004,0.14999999999999999,0.050000000000000003,
+    0.65000000000000002,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.55000000000000004,
+    0.050000000000000003,0.14999999999999999,0.45000000000000001,
+    0.050000000000000003,0.25,0.34999999999999998,
+    0.050000000000000003,0.34999999999999998,0.25,
+    0.050000000000000003,0.45000000000000001,0.14999999999999999,
+    0.050000000000000003,0.55000000000000004,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.45000000000000001,
+    0.14999999999999999,0.14999999999999999,0.34999999999999998,
+    0.14999999999999999,0.25,0.25,
+    0.14999999999999999,0.34999999999999998,0.14999999999999999,
+    0.14999999999999999,0.45000000000000001,0.050000000000000003,
+    0.25,0.050000000000000003,0.34999999999999998,
+    0.25,0.14999999999999999,0.25,
+    0.25,0.25,0.14999999999999999,
+    0.25,0.34999999999999998,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.25,
+    0.34999999999999998,0.14999999999999999,0.14999999999999999,
+    0.34999999999999998,0.25,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.14999999999999999,
+    0.45000000000000001,0.14999999999999999,0.050000000000000003,
+    0.55000000000000004,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.45000000000000001,
+    0.050000000000000003,0.14999999999999999,0.34999999999999998,
+    0.050000000000000003,0.25,0.25,
+    0.050000000000000003,0.34999999999999998,0.14999999999999999,
+    0.050000000000000003,0.45000000000000001,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.34999999999999998,
+    0.14999999999999999,0.14999999999999999,0.25,
+    0.14999999999999999,0.25,0.14999999999999999,
+    0.14999999999999999,0.34999999999999998,0.050000000000000003,
+    0.25,0.050000000000000003,0.25,
+    0.25,0.14999999999999999,0.14999999999999999,
+    0.25,0.25,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.14999999999999999,
+    0.34999999999999998,0.14999999999999999,0.050000000000000003,
+    0.45000000000000001,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.34999999999999998,
+    0.050000000000000003,0.14999999999999999,0.25,
+    0.050000000000000003,0.25,0.14999999999999999,
+    0.050000000000000003,0.34999999999999998,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.25,
+    0.14999999999999999,0.14999999999999999,0.14999999999999999,
+    0.14999999999999999,0.25,0.050000000000000003,
+    0.25,0.050000000000000003,0.14999999999999999,
+    0.25,0.14999999999999999,0.050000000000000003,
+    0.34999999999999998,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.25,
+    0.050000000000000003,0.14999999999999999,0.14999999999999999,
+    0.050000000000000003,0.25,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.14999999999999999,
+    0.14999999999999999,0.14999999999999999,0.050000000000000003,
+    0.25,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.14999999999999999,
+    0.050000000000000003,0.14999999999999999,0.050000000000000003,
+    0.14999999999999999,0.050000000000000003,0.050000000000000003,
+    0.050000000000000003,0.050000000000000003,0.050000000000000003,
+    0.055555555555600003,0.055555555555600003,0.83333333333299997,
+    0.055555555555600003,0.166666666667,0.72222222222200005,
+    0.055555555555600003,0.277777777778,0.61111111111100003,
+    0.055555555555600003,0.38888888888899997,0.5,
+    0.055555555555600003,0.5,0.38888888888899997,
+    0.055555555555600003,0.61111111111100003,0.277777777778,
+    0.055555555555600003,0.72222222222200005,0.166666666667,
+    0.055555555555600003,0.83333333333299997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.72222222222200005,
+    0.166666666667,0.166666666667,0.61111111111100003,
+    0.166666666667,0.277777777778,0.5,
+    0.166666666667,0.38888888888899997,0.38888888888899997,
+    0.166666666667,0.5,0.277777777778,
+    0.166666666667,0.61111111111100003,0.166666666667,
+    0.166666666667,0.72222222222200005,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.61111111111100003,
+    0.277777777778,0.166666666667,0.5,
+    0.277777777778,0.277777777778,0.38888888888899997,
+    0.277777777778,0.38888888888899997,0.277777777778,
+    0.277777777778,0.5,0.166666666667,
+    0.277777777778,0.61111111111100003,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.5,
+    0.38888888888899997,0.166666666667,0.38888888888899997,
+    0.38888888888899997,0.277777777778,0.277777777778,
+    0.38888888888899997,0.38888888888899997,0.166666666667,
+    0.38888888888899997,0.5,0.055555555555600003,
+    0.5,0.055555555555600003,0.38888888888899997,
+    0.5,0.166666666667,0.277777777778,
+    0.5,0.277777777778,0.166666666667,
+    0.5,0.38888888888899997,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.277777777778,
+    0.61111111111100003,0.166666666667,0.166666666667,
+    0.61111111111100003,0.277777777778,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.166666666667,
+    0.72222222222200005,0.166666666667,0.055555555555600003,
+    0.83333333333299997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.72222222222200005,
+    0.055555555555600003,0.166666666667,0.61111111111100003,
+    0.055555555555600003,0.277777777778,0.5,
+    0.055555555555600003,0.38888888888899997,0.38888888888899997,
+    0.055555555555600003,0.5,0.277777777778,
+    0.055555555555600003,0.61111111111100003,0.166666666667,
+    0.055555555555600003,0.72222222222200005,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.61111111111100003,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.277777777778,0.38888888888899997,
+    0.166666666667,0.38888888888899997,0.277777777778,
+    0.166666666667,0.5,0.166666666667,
+    0.166666666667,0.61111111111100003,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.5,
+    0.277777777778,0.166666666667,0.38888888888899997,
+    0.277777777778,0.277777777778,0.277777777778,
+    0.277777777778,0.38888888888899997,0.166666666667,
+    0.277777777778,0.5,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.38888888888899997,
+    0.38888888888899997,0.166666666667,0.277777777778,
+    0.38888888888899997,0.277777777778,0.166666666667,
+    0.38888888888899997,0.38888888888899997,0.055555555555600003,
+    0.5,0.055555555555600003,0.277777777778,
+    0.5,0.166666666667,0.166666666667,
+    0.5,0.277777777778,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.166666666667,
+    0.61111111111100003,0.166666666667,0.055555555555600003,
+    0.72222222222200005,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.61111111111100003,
+    0.055555555555600003,0.166666666667,0.5,
+    0.055555555555600003,0.277777777778,0.38888888888899997,
+    0.055555555555600003,0.38888888888899997,0.277777777778,
+    0.055555555555600003,0.5,0.166666666667,
+    0.055555555555600003,0.61111111111100003,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.5,
+    0.166666666667,0.166666666667,0.38888888888899997,
+    0.166666666667,0.277777777778,0.277777777778,
+    0.166666666667,0.38888888888899997,0.166666666667,
+    0.166666666667,0.5,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.38888888888899997,
+    0.277777777778,0.166666666667,0.277777777778,
+    0.277777777778,0.277777777778,0.166666666667,
+    0.277777777778,0.38888888888899997,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.277777777778,
+    0.38888888888899997,0.166666666667,0.166666666667,
+    0.38888888888899997,0.277777777778,0.055555555555600003,
+    0.5,0.055555555555600003,0.166666666667,
+    0.5,0.166666666667,0.055555555555600003,
+    0.61111111111100003,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.5,
+    0.055555555555600003,0.166666666667,0.38888888888899997,
+    0.055555555555600003,0.277777777778,0.277777777778,
+    0.055555555555600003,0.38888888888899997,0.166666666667,
+    0.055555555555600003,0.5,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.38888888888899997,
+    0.166666666667,0.166666666667,0.277777777778,
+    0.166666666667,0.277777777778,0.166666666667,
+    0.166666666667,0.38888888888899997,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.277777777778,
+    0.277777777778,0.166666666667,0.166666666667,
+    0.277777777778,0.277777777778,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.166666666667,
+    0.38888888888899997,0.166666666667,0.055555555555600003,
+    0.5,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.38888888888899997,
+    0.055555555555600003,0.166666666667,0.277777777778,
+    0.055555555555600003,0.277777777778,0.166666666667,
+    0.055555555555600003,0.38888888888899997,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.277777777778,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.166666666667,0.277777777778,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.166666666667,
+    0.277777777778,0.166666666667,0.055555555555600003,
+    0.38888888888899997,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.277777777778,
+    0.055555555555600003,0.166666666667,0.166666666667,
+    0.055555555555600003,0.277777777778,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.166666666667,
+    0.166666666667,0.166666666667,0.055555555555600003,
+    0.277777777778,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.166666666667,
+    0.055555555555600003,0.166666666667,0.055555555555600003,
+    0.166666666667,0.055555555555600003,0.055555555555600003,
+    0.055555555555600003,0.055555555555600003,0.055555555555600003,
+    0.0625,0.0625,0.8125,
+    0.0625,0.1875,0.6875,
+    0.0625,0.3125,0.5625,
+    0.0625,0.4375,0.4375,
+    0.0625,0.5625,0.3125,
+    0.0625,0.6875,0.1875,
+    0.0625,0.8125,0.0625,
+    0.1875,0.0625,0.6875,
+    0.1875,0.1875,0.5625,
+    0.1875,0.3125,0.4375,
+    0.1875,0.4375,0.3125,
+    0.1875,0.5625,0.1875,
+    0.1875,0.6875,0.0625,
+    0.3125,0.0625,0.5625,
+    0.3125,0.1875,0.4375,
+    0.3125,0.3125,0.3125,
+    0.3125,0.4375,0.1875,
+    0.3125,0.5625,0.0625,
+    0.4375,0.0625,0.4375,
+    0.4375,0.1875,0.3125,
+    0.4375,0.3125,0.1875,
+    0.4375,0.4375,0.0625,
+    0.5625,0.0625,0.3125,
+    0.5625,0.1875,0.1875,
+    0.5625,0.3125,0.0625,
+    0.6875,0.0625,0.1875,
+    0.6875,0.1875,0.0625,
+    0.8125,0.0625,0.0625,
+    0.0625,0.0625,0.6875,
+    0.0625,0.1875,0.5625,
+    0.0625,0.3125,0.4375,
+    0.0625,0.4375,0.3125,
+    0.0625,0.5625,0.1875,
+    0.0625,0.6875,0.0625,
+    0.1875,0.0625,0.5625,
+    0.1875,0.1875,0.4375,
+    0.1875,0.3125,0.3125,
+    0.1875,0.4375,0.1875,
+    0.1875,0.5625,0.0625,
+    0.3125,0.0625,0.4375,
+    0.3125,0.1875,0.3125,
+    0.3125,0.3125,0.1875,
+    0.3125,0.4375,0.0625,
+    0.4375,0.0625,0.3125,
+    0.4375,0.1875,0.1875,
+    0.4375,0.3125,0.0625,
+    0.5625,0.0625,0.1875,
+    0.5625,0.1875,0.0625,
+    0.6875,0.0625,0.0625,
+    0.0625,0.0625,0.5625,
+    0.0625,0.1875,0.4375,
+    0.0625,0.3125,0.3125,
+    0.0625,0.4375,0.1875,
+    0.0625,0.5625,0.0625,
+    0.1875,0.0625,0.4375,
+    0.1875,0.1875,0.3125,
+    0.1875,0.3125,0.1875,
+    0.1875,0.4375,0.0625,
+    0.3125,0.0625,0.3125,
+    0.3125,0.1875,0.1875,
+    0.3125,0.3125,0.0625,
+    0.4375,0.0625,0.1875,
+    0.4375,0.1875,0.0625,
+    0.5625,0.0625,0.0625,
+    0.0625,0.0625,0.4375,
+    0.0625,0.1875,0.3125,
+    0.0625,0.3125,0.1875,
+    0.0625,0.4375,0.0625,
+    0.1875,0.0625,0.3125,
+    0.1875,0.1875,0.1875,
+    0.1875,0.3125,0.0625,
+    0.3125,0.0625,0.1875,
+    0.3125,0.1875,0.0625,
+    0.4375,0.0625,0.0625,
+    0.0625,0.0625,0.3125,
+    0.0625,0.1875,0.1875,
+    0.0625,0.3125,0.0625,
+    0.1875,0.0625,0.1875,
+    0.1875,0.1875,0.0625,
+    0.3125,0.0625,0.0625,
+    0.0625,0.0625,0.1875,
+    0.0625,0.1875,0.0625,
+    0.1875,0.0625,0.0625,
+    0.0625,0.0625,0.0625,
+    0.071428571428599999,0.071428571428599999,0.78571428571400004,
+    0.071428571428599999,0.21428571428599999,0.64285714285700002,
+    0.071428571428599999,0.35714285714299998,0.5,
+    0.071428571428599999,0.5,0.35714285714299998,
+    0.071428571428599999,0.64285714285700002,0.21428571428599999,
+    0.071428571428599999,0.78571428571400004,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.64285714285700002,
+    0.21428571428599999,0.21428571428599999,0.5,
+    0.21428571428599999,0.35714285714299998,0.35714285714299998,
+    0.21428571428599999,0.5,0.21428571428599999,
+    0.21428571428599999,0.64285714285700002,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.5,
+    0.35714285714299998,0.21428571428599999,0.35714285714299998,
+    0.35714285714299998,0.35714285714299998,0.21428571428599999,
+    0.35714285714299998,0.5,0.071428571428599999,
+    0.5,0.071428571428599999,0.35714285714299998,
+    0.5,0.21428571428599999,0.21428571428599999,
+    0.5,0.35714285714299998,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.21428571428599999,
+    0.64285714285700002,0.21428571428599999,0.071428571428599999,
+    0.78571428571400004,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.64285714285700002,
+    0.071428571428599999,0.21428571428599999,0.5,
+    0.071428571428599999,0.35714285714299998,0.35714285714299998,
+    0.071428571428599999,0.5,0.21428571428599999,
+    0.071428571428599999,0.64285714285700002,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.5,
+    0.21428571428599999,0.21428571428599999,0.35714285714299998,
+    0.21428571428599999,0.35714285714299998,0.21428571428599999,
+    0.21428571428599999,0.5,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.35714285714299998,
+    0.35714285714299998,0.21428571428599999,0.21428571428599999,
+    0.35714285714299998,0.35714285714299998,0.071428571428599999,
+    0.5,0.071428571428599999,0.21428571428599999,
+    0.5,0.21428571428599999,0.071428571428599999,
+    0.64285714285700002,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.5,
+    0.071428571428599999,0.21428571428599999,0.35714285714299998,
+    0.071428571428599999,0.35714285714299998,0.21428571428599999,
+    0.071428571428599999,0.5,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.35714285714299998,
+    0.21428571428599999,0.21428571428599999,0.21428571428599999,
+    0.21428571428599999,0.35714285714299998,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.21428571428599999,
+    0.35714285714299998,0.21428571428599999,0.071428571428599999,
+    0.5,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.35714285714299998,
+    0.071428571428599999,0.21428571428599999,0.21428571428599999,
+    0.071428571428599999,0.35714285714299998,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.21428571428599999,
+    0.21428571428599999,0.21428571428599999,0.071428571428599999,
+    0.35714285714299998,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.21428571428599999,
+    0.071428571428599999,0.21428571428599999,0.071428571428599999,
+    0.21428571428599999,0.071428571428599999,0.071428571428599999,
+    0.071428571428599999,0.071428571428599999,0.071428571428599999,
+    0.083333333333299994,0.083333333333299994,0.75,
+    0.083333333333299994,0.25,0.58333333333299997,
+    0.083333333333299994,0.41666666666699997,0.41666666666699997,
+    0.083333333333299994,0.58333333333299997,0.25,
+    0.083333333333299994,0.75,0.083333333333299994,
+    0.25,0.083333333333299994,0.58333333333299997,
+    0.25,0.25,0.41666666666699997,
+    0.25,0.41666666666699997,0.25,
+    0.25,0.58333333333299997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.41666666666699997,
+    0.41666666666699997,0.25,0.25,
+    0.41666666666699997,0.41666666666699997,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.25,
+    0.58333333333299997,0.25,0.083333333333299994,
+    0.75,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.58333333333299997,
+    0.083333333333299994,0.25,0.41666666666699997,
+    0.083333333333299994,0.41666666666699997,0.25,
+    0.083333333333299994,0.58333333333299997,0.083333333333299994,
+    0.25,0.083333333333299994,0.41666666666699997,
+    0.25,0.25,0.25,
+    0.25,0.41666666666699997,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.25,
+    0.41666666666699997,0.25,0.083333333333299994,
+    0.58333333333299997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.41666666666699997,
+    0.083333333333299994,0.25,0.25,
+    0.083333333333299994,0.41666666666699997,0.083333333333299994,
+    0.25,0.083333333333299994,0.25,
+    0.25,0.25,0.083333333333299994,
+    0.41666666666699997,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.25,
+    0.083333333333299994,0.25,0.083333333333299994,
+    0.25,0.083333333333299994,0.083333333333299994,
+    0.083333333333299994,0.083333333333299994,0.083333333333299994,
+    0.10000000000000001,0.10000000000000001,0.69999999999999996,
+    0.10000000000000001,0.29999999999999999,0.5,
+    0.10000000000000001,0.5,0.29999999999999999,
+    0.10000000000000001,0.69999999999999996,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.5,
+    0.29999999999999999,0.29999999999999999,0.29999999999999999,
+    0.29999999999999999,0.5,0.10000000000000001,
+    0.5,0.10000000000000001,0.29999999999999999,
+    0.5,0.29999999999999999,0.10000000000000001,
+    0.69999999999999996,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.5,
+    0.10000000000000001,0.29999999999999999,0.29999999999999999,
+    0.10000000000000001,0.5,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.29999999999999999,
+    0.29999999999999999,0.29999999999999999,0.10000000000000001,
+    0.5,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.29999999999999999,
+    0.10000000000000001,0.29999999999999999,0.10000000000000001,
+    0.29999999999999999,0.10000000000000001,0.10000000000000001,
+    0.10000000000000001,0.10000000000000001,0.10000000000000001,
+    0.125,0.125,0.625,
+    0.125,0.375,0.375,
+    0.125,0.625,0.125,
+    0.375,0.125,0.375,
+    0.375,0.375,0.125,
+    0.625,0.125,0.125,
+    0.125,0.125,0.375,
+    0.125,0.375,0.125,
+    0.375,0.125,0.125,
+    0.125,0.125,0.125,
+    0.166666666667,0.166666666667,0.5,
+    0.166666666667,0.5,0.166666666667,
+    0.5,0.166666666667,0.166666666667,
+    0.166666666667,0.166666666667,0.166666666667,
+    0.25,0.25,0.25
+};
+static constexpr double gpweights20[] =
+{
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,0.14829636044149999,0.14829636044149999,
+    0.14829636044149999,0.14829636044149999,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,-0.572508521791667,-0.572508521791667,
+    -0.572508521791667,-0.572508521791667,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,0.88967913924499997,
+    0.88967913924499997,0.88967913924499997,0.88967913924499997,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,-0.71388380849499999,
+    -0.71388380849499999,-0.71388380849499999,-0.71388380849499999,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,0.315924905245,
+    0.315924905245,0.315924905245,0.315924905245,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,-0.076526696952332995,
+    -0.076526696952332995,-0.076526696952332995,-0.076526696952332995,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,0.0095177158975500008,
+    0.0095177158975500008,0.0095177158975500008,-0.00053198701887800001,-0.00053198701887800001,
+    -0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,
+    -0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,
+    -0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,
+    -0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,-0.00053198701887800001,
+    -0.00053198701887800001,-0.00053198701887800001,1.0426767662e-05,1.0426767662e-05,
+    1.0426767662e-05,1.0426767662e-05,1.0426767662e-05,1.0426767662e-05,
+    1.0426767662e-05,1.0426767662e-05,1.0426767662e-05,1.0426767662e-05,
+    -4.4087320125e-08,-4.4087320125e-08,-4.4087320125e-08,-4.4087320125e-08,
+    1.3258375e-11
+};
+
+
 int gptetrahedron::count(int integrationorder)
 {
     std::vector<int> nums = {1,1,4,5,11,14,24,31,43,53,126,126,210,210,330,330,495,495,715,715,1001,1001};
@@ -14,12394 +3958,67 @@ void gptetrahedron::set(int integrationorder, std::vector<double>& coordinates,
     
     switch (integrationorder)
     {
-        case 0:
-            
-            coordinates = {0.25,0.25,0.25};
-            weights = {1.0/6.0};
-
-            break;
-            
-        case 1:
-            
-            coordinates = {0.25,0.25,0.25};
-            weights = {1.0/6.0};
-
+        case 0: case 1:
+            coordinates.assign(gpcoordinates0, gpcoordinates0+3*1);
+            weights.assign(gpweights0, gpweights0+1);
             break;
-            
         case 2:
-            
-            coordinates.resize(4*3);
-            weights.resize(4);
-
-            coordinates[0] = 0.13819660112500001;
-            coordinates[1] = 0.13819660112500001;
-            coordinates[2] = 0.13819660112500001;
-            coordinates[3] = 0.58541019662500005;
-            coordinates[4] = 0.13819660112500001;
-            coordinates[5] = 0.13819660112500001;
-            coordinates[6] = 0.13819660112500001;
-            coordinates[7] = 0.58541019662500005;
-            coordinates[8] = 0.13819660112500001;
-            coordinates[9] = 0.13819660112500001;
-            coordinates[10] = 0.13819660112500001;
-            coordinates[11] = 0.58541019662500005;
-
-            weights[0] = 0.041666666666666699;
-            weights[1] = 0.041666666666666699;
-            weights[2] = 0.041666666666666699;
-            weights[3] = 0.041666666666666699;
-
+            coordinates.assign(gpcoordinates2, gpcoordinates2+3*4);
+            weights.assign(gpweights2, gpweights2+4);
             break;
-
         case 3:
-            
-            coordinates.resize(5*3);
-            weights.resize(5);
-
-            coordinates[0] = 0.25;
-            coordinates[1] = 0.25;
-            coordinates[2] = 0.25;
-            coordinates[3] = 0.166666666667;
-            coordinates[4] = 0.166666666667;
-            coordinates[5] = 0.166666666667;
-            coordinates[6] = 0.166666666667;
-            coordinates[7] = 0.166666666667;
-            coordinates[8] = 0.5;
-            coordinates[9] = 0.166666666667;
-            coordinates[10] = 0.5;
-            coordinates[11] = 0.166666666667;
-            coordinates[12] = 0.5;
-            coordinates[13] = 0.166666666667;
-            coordinates[14] = 0.166666666667;
-
-            weights[0] = -0.133333333333333;
-            weights[1] = 0.074999999999999997;
-            weights[2] = 0.074999999999999997;
-            weights[3] = 0.074999999999999997;
-            weights[4] = 0.074999999999999997;
-
+            coordinates.assign(gpcoordinates3, gpcoordinates3+3*5);
+            weights.assign(gpweights3, gpweights3+5);
             break;
-
         case 4:
-            
-            coordinates.resize(11*3);
-            weights.resize(11);
-
-            coordinates[0] = 0.25;
-            coordinates[1] = 0.25;
-            coordinates[2] = 0.25;
-            coordinates[3] = 0.071428571428599999;
-            coordinates[4] = 0.071428571428599999;
-            coordinates[5] = 0.071428571428599999;
-            coordinates[6] = 0.071428571428599999;
-            coordinates[7] = 0.071428571428599999;
-            coordinates[8] = 0.78571428571400004;
-            coordinates[9] = 0.071428571428599999;
-            coordinates[10] = 0.78571428571400004;
-            coordinates[11] = 0.071428571428599999;
-            coordinates[12] = 0.78571428571400004;
-            coordinates[13] = 0.071428571428599999;
-            coordinates[14] = 0.071428571428599999;
-            coordinates[15] = 0.39940357616700001;
-            coordinates[16] = 0.39940357616700001;
-            coordinates[17] = 0.10059642383300001;
-            coordinates[18] = 0.39940357616700001;
-            coordinates[19] = 0.10059642383300001;
-            coordinates[20] = 0.39940357616700001;
-            coordinates[21] = 0.10059642383300001;
-            coordinates[22] = 0.39940357616700001;
-            coordinates[23] = 0.39940357616700001;
-            coordinates[24] = 0.39940357616700001;
-            coordinates[25] = 0.10059642383300001;
-            coordinates[26] = 0.10059642383300001;
-            coordinates[27] = 0.10059642383300001;
-            coordinates[28] = 0.39940357616700001;
-            coordinates[29] = 0.10059642383300001;
-            coordinates[30] = 0.10059642383300001;
-            coordinates[31] = 0.10059642383300001;
-            coordinates[32] = 0.39940357616700001;
-
-            weights[0] = -0.013155555555499999;
-            weights[1] = 0.0076222222222000003;
-            weights[2] = 0.0076222222222000003;
-            weights[3] = 0.0076222222222000003;
-            weights[4] = 0.0076222222222000003;
-            weights[5] = 0.0248888888888;
-            weights[6] = 0.0248888888888;
-            weights[7] = 0.0248888888888;
-            weights[8] = 0.0248888888888;
-            weights[9] = 0.0248888888888;
-            weights[10] = 0.0248888888888;
-
+            coordinates.assign(gpcoordinates4, gpcoordinates4+3*11);
+            weights.assign(gpweights4, gpweights4+11);
             break;
-
         case 5:
-            
-            coordinates.resize(14*3);
-            weights.resize(14);
-
-            coordinates[0] = 0.092735250310900005;
-            coordinates[1] = 0.092735250310900005;
-            coordinates[2] = 0.092735250310900005;
-            coordinates[3] = 0.72179424906699996;
-            coordinates[4] = 0.092735250310900005;
-            coordinates[5] = 0.092735250310900005;
-            coordinates[6] = 0.092735250310900005;
-            coordinates[7] = 0.72179424906699996;
-            coordinates[8] = 0.092735250310900005;
-            coordinates[9] = 0.092735250310900005;
-            coordinates[10] = 0.092735250310900005;
-            coordinates[11] = 0.72179424906699996;
-            coordinates[12] = 0.31088591926300002;
-            coordinates[13] = 0.31088591926300002;
-            coordinates[14] = 0.31088591926300002;
-            coordinates[15] = 0.067342242210100003;
-            coordinates[16] = 0.31088591926300002;
-            coordinates[17] = 0.31088591926300002;
-            coordinates[18] = 0.31088591926300002;
-            coordinates[19] = 0.067342242210100003;
-            coordinates[20] = 0.31088591926300002;
-            coordinates[21] = 0.31088591926300002;
-            coordinates[22] = 0.31088591926300002;
-            coordinates[23] = 0.067342242210100003;
-            coordinates[24] = 0.45449629587399998;
-            coordinates[25] = 0.45449629587399998;
-            coordinates[26] = 0.045503704125600002;
-            coordinates[27] = 0.45449629587399998;
-            coordinates[28] = 0.045503704125600002;
-            coordinates[29] = 0.45449629587399998;
-            coordinates[30] = 0.045503704125600002;
-            coordinates[31] = 0.45449629587399998;
-            coordinates[32] = 0.45449629587399998;
-            coordinates[33] = 0.45449629587399998;
-            coordinates[34] = 0.045503704125600002;
-            coordinates[35] = 0.045503704125600002;
-            coordinates[36] = 0.045503704125600002;
-            coordinates[37] = 0.45449629587399998;
-            coordinates[38] = 0.045503704125600002;
-            coordinates[39] = 0.045503704125600002;
-            coordinates[40] = 0.045503704125600002;
-            coordinates[41] = 0.45449629587399998;
-
-            weights[0] = 0.012248840519400001;
-            weights[1] = 0.012248840519400001;
-            weights[2] = 0.012248840519400001;
-            weights[3] = 0.012248840519400001;
-            weights[4] = 0.018781320952999999;
-            weights[5] = 0.018781320952999999;
-            weights[6] = 0.018781320952999999;
-            weights[7] = 0.018781320952999999;
-            weights[8] = 0.0070910034628499999;
-            weights[9] = 0.0070910034628499999;
-            weights[10] = 0.0070910034628499999;
-            weights[11] = 0.0070910034628499999;
-            weights[12] = 0.0070910034628499999;
-            weights[13] = 0.0070910034628499999;
-
+            coordinates.assign(gpcoordinates5, gpcoordinates5+3*14);
+            weights.assign(gpweights5, gpweights5+14);
             break;
-
         case 6:
-            
-            coordinates.resize(24*3);
-            weights.resize(24);
-
-            coordinates[0] = 0.21460287125899999;
-            coordinates[1] = 0.21460287125899999;
-            coordinates[2] = 0.21460287125899999;
-            coordinates[3] = 0.35619138622300001;
-            coordinates[4] = 0.21460287125899999;
-            coordinates[5] = 0.21460287125899999;
-            coordinates[6] = 0.21460287125899999;
-            coordinates[7] = 0.35619138622300001;
-            coordinates[8] = 0.21460287125899999;
-            coordinates[9] = 0.21460287125899999;
-            coordinates[10] = 0.21460287125899999;
-            coordinates[11] = 0.35619138622300001;
-            coordinates[12] = 0.040673958534599999;
-            coordinates[13] = 0.040673958534599999;
-            coordinates[14] = 0.040673958534599999;
-            coordinates[15] = 0.87797812439599998;
-            coordinates[16] = 0.040673958534599999;
-            coordinates[17] = 0.040673958534599999;
-            coordinates[18] = 0.040673958534599999;
-            coordinates[19] = 0.87797812439599998;
-            coordinates[20] = 0.040673958534599999;
-            coordinates[21] = 0.040673958534599999;
-            coordinates[22] = 0.040673958534599999;
-            coordinates[23] = 0.87797812439599998;
-            coordinates[24] = 0.32233789014199998;
-            coordinates[25] = 0.32233789014199998;
-            coordinates[26] = 0.32233789014199998;
-            coordinates[27] = 0.032986329573200003;
-            coordinates[28] = 0.32233789014199998;
-            coordinates[29] = 0.32233789014199998;
-            coordinates[30] = 0.32233789014199998;
-            coordinates[31] = 0.032986329573200003;
-            coordinates[32] = 0.32233789014199998;
-            coordinates[33] = 0.32233789014199998;
-            coordinates[34] = 0.32233789014199998;
-            coordinates[35] = 0.032986329573200003;
-            coordinates[36] = 0.063661001874999998;
-            coordinates[37] = 0.063661001874999998;
-            coordinates[38] = 0.26967233145800001;
-            coordinates[39] = 0.063661001874999998;
-            coordinates[40] = 0.26967233145800001;
-            coordinates[41] = 0.063661001874999998;
-            coordinates[42] = 0.063661001874999998;
-            coordinates[43] = 0.063661001874999998;
-            coordinates[44] = 0.60300566479200002;
-            coordinates[45] = 0.063661001874999998;
-            coordinates[46] = 0.60300566479200002;
-            coordinates[47] = 0.063661001874999998;
-            coordinates[48] = 0.063661001874999998;
-            coordinates[49] = 0.26967233145800001;
-            coordinates[50] = 0.60300566479200002;
-            coordinates[51] = 0.063661001874999998;
-            coordinates[52] = 0.60300566479200002;
-            coordinates[53] = 0.26967233145800001;
-            coordinates[54] = 0.26967233145800001;
-            coordinates[55] = 0.063661001874999998;
-            coordinates[56] = 0.063661001874999998;
-            coordinates[57] = 0.26967233145800001;
-            coordinates[58] = 0.063661001874999998;
-            coordinates[59] = 0.60300566479200002;
-            coordinates[60] = 0.26967233145800001;
-            coordinates[61] = 0.60300566479200002;
-            coordinates[62] = 0.063661001874999998;
-            coordinates[63] = 0.60300566479200002;
-            coordinates[64] = 0.063661001874999998;
-            coordinates[65] = 0.26967233145800001;
-            coordinates[66] = 0.60300566479200002;
-            coordinates[67] = 0.063661001874999998;
-            coordinates[68] = 0.063661001874999998;
-            coordinates[69] = 0.60300566479200002;
-            coordinates[70] = 0.26967233145800001;
-            coordinates[71] = 0.063661001874999998;
-
-            weights[0] = 0.0066537917097000002;
-            weights[1] = 0.0066537917097000002;
-            weights[2] = 0.0066537917097000002;
-            weights[3] = 0.0066537917097000002;
-            weights[4] = 0.001679535175883;
-            weights[5] = 0.001679535175883;
-            weights[6] = 0.001679535175883;
-            weights[7] = 0.001679535175883;
-            weights[8] = 0.0092261969239500006;
-            weights[9] = 0.0092261969239500006;
-            weights[10] = 0.0092261969239500006;
-            weights[11] = 0.0092261969239500006;
-            weights[12] = 0.0080357142857169998;
-            weights[13] = 0.0080357142857169998;
-            weights[14] = 0.0080357142857169998;
-            weights[15] = 0.0080357142857169998;
-            weights[16] = 0.0080357142857169998;
-            weights[17] = 0.0080357142857169998;
-            weights[18] = 0.0080357142857169998;
-            weights[19] = 0.0080357142857169998;
-            weights[20] = 0.0080357142857169998;
-            weights[21] = 0.0080357142857169998;
-            weights[22] = 0.0080357142857169998;
-            weights[23] = 0.0080357142857169998;
-
+            coordinates.assign(gpcoordinates6, gpcoordinates6+3*24);
+            weights.assign(gpweights6, gpweights6+24);
             break;
-
         case 7:
-
-            coordinates.resize(31*3);
-            weights.resize(31);
-
-            coordinates[0] = 0.5;
-            coordinates[1] = 0.5;
-            coordinates[2] = 0;
-            coordinates[3] = 0.5;
-            coordinates[4] = 0;
-            coordinates[5] = 0.5;
-            coordinates[6] = 0;
-            coordinates[7] = 0.5;
-            coordinates[8] = 0.5;
-            coordinates[9] = 0;
-            coordinates[10] = 0;
-            coordinates[11] = 0.5;
-            coordinates[12] = 0;
-            coordinates[13] = 0.5;
-            coordinates[14] = 0;
-            coordinates[15] = 0.5;
-            coordinates[16] = 0;
-            coordinates[17] = 0;
-            coordinates[18] = 0.25;
-            coordinates[19] = 0.25;
-            coordinates[20] = 0.25;
-            coordinates[21] = 0.078213192330299997;
-            coordinates[22] = 0.078213192330299997;
-            coordinates[23] = 0.078213192330299997;
-            coordinates[24] = 0.078213192330299997;
-            coordinates[25] = 0.078213192330299997;
-            coordinates[26] = 0.76536042300899998;
-            coordinates[27] = 0.078213192330299997;
-            coordinates[28] = 0.76536042300899998;
-            coordinates[29] = 0.078213192330299997;
-            coordinates[30] = 0.76536042300899998;
-            coordinates[31] = 0.078213192330299997;
-            coordinates[32] = 0.078213192330299997;
-            coordinates[33] = 0.121843216664;
-            coordinates[34] = 0.121843216664;
-            coordinates[35] = 0.121843216664;
-            coordinates[36] = 0.121843216664;
-            coordinates[37] = 0.121843216664;
-            coordinates[38] = 0.63447035000800001;
-            coordinates[39] = 0.121843216664;
-            coordinates[40] = 0.63447035000800001;
-            coordinates[41] = 0.121843216664;
-            coordinates[42] = 0.63447035000800001;
-            coordinates[43] = 0.121843216664;
-            coordinates[44] = 0.121843216664;
-            coordinates[45] = 0.33253916444600001;
-            coordinates[46] = 0.33253916444600001;
-            coordinates[47] = 0.33253916444600001;
-            coordinates[48] = 0.33253916444600001;
-            coordinates[49] = 0.33253916444600001;
-            coordinates[50] = 0.00238250666074;
-            coordinates[51] = 0.33253916444600001;
-            coordinates[52] = 0.00238250666074;
-            coordinates[53] = 0.33253916444600001;
-            coordinates[54] = 0.00238250666074;
-            coordinates[55] = 0.33253916444600001;
-            coordinates[56] = 0.33253916444600001;
-            coordinates[57] = 0.10000000000000001;
-            coordinates[58] = 0.10000000000000001;
-            coordinates[59] = 0.20000000000000001;
-            coordinates[60] = 0.10000000000000001;
-            coordinates[61] = 0.20000000000000001;
-            coordinates[62] = 0.10000000000000001;
-            coordinates[63] = 0.10000000000000001;
-            coordinates[64] = 0.10000000000000001;
-            coordinates[65] = 0.59999999999999998;
-            coordinates[66] = 0.10000000000000001;
-            coordinates[67] = 0.59999999999999998;
-            coordinates[68] = 0.10000000000000001;
-            coordinates[69] = 0.10000000000000001;
-            coordinates[70] = 0.20000000000000001;
-            coordinates[71] = 0.59999999999999998;
-            coordinates[72] = 0.10000000000000001;
-            coordinates[73] = 0.59999999999999998;
-            coordinates[74] = 0.20000000000000001;
-            coordinates[75] = 0.20000000000000001;
-            coordinates[76] = 0.10000000000000001;
-            coordinates[77] = 0.10000000000000001;
-            coordinates[78] = 0.20000000000000001;
-            coordinates[79] = 0.10000000000000001;
-            coordinates[80] = 0.59999999999999998;
-            coordinates[81] = 0.20000000000000001;
-            coordinates[82] = 0.59999999999999998;
-            coordinates[83] = 0.10000000000000001;
-            coordinates[84] = 0.59999999999999998;
-            coordinates[85] = 0.10000000000000001;
-            coordinates[86] = 0.20000000000000001;
-            coordinates[87] = 0.59999999999999998;
-            coordinates[88] = 0.10000000000000001;
-            coordinates[89] = 0.10000000000000001;
-            coordinates[90] = 0.59999999999999998;
-            coordinates[91] = 0.20000000000000001;
-            coordinates[92] = 0.10000000000000001;
-
-            weights[0] = 0.00097001763668499996;
-            weights[1] = 0.00097001763668499996;
-            weights[2] = 0.00097001763668499996;
-            weights[3] = 0.00097001763668499996;
-            weights[4] = 0.00097001763668499996;
-            weights[5] = 0.00097001763668499996;
-            weights[6] = 0.018264223466167;
-            weights[7] = 0.010599941524416999;
-            weights[8] = 0.010599941524416999;
-            weights[9] = 0.010599941524416999;
-            weights[10] = 0.010599941524416999;
-            weights[11] = -0.062517740114333004;
-            weights[12] = -0.062517740114333004;
-            weights[13] = -0.062517740114333004;
-            weights[14] = -0.062517740114333004;
-            weights[15] = 0.0048914252630670001;
-            weights[16] = 0.0048914252630670001;
-            weights[17] = 0.0048914252630670001;
-            weights[18] = 0.0048914252630670001;
-            weights[19] = 0.027557319223999999;
-            weights[20] = 0.027557319223999999;
-            weights[21] = 0.027557319223999999;
-            weights[22] = 0.027557319223999999;
-            weights[23] = 0.027557319223999999;
-            weights[24] = 0.027557319223999999;
-            weights[25] = 0.027557319223999999;
-            weights[26] = 0.027557319223999999;
-            weights[27] = 0.027557319223999999;
-            weights[28] = 0.027557319223999999;
-            weights[29] = 0.027557319223999999;
-            weights[30] = 0.027557319223999999;
-
+            coordinates.assign(gpcoordinates7, gpcoordinates7+3*31);
+            weights.assign(gpweights7, gpweights7+31);
             break;
-
         case 8:
-
-            coordinates.resize(43*3);
-            weights.resize(43);
-
-            coordinates[0] = 0.25;
-            coordinates[1] = 0.25;
-            coordinates[2] = 0.25;
-            coordinates[3] = 0.206829931611;
-            coordinates[4] = 0.206829931611;
-            coordinates[5] = 0.206829931611;
-            coordinates[6] = 0.206829931611;
-            coordinates[7] = 0.206829931611;
-            coordinates[8] = 0.37951020516799999;
-            coordinates[9] = 0.206829931611;
-            coordinates[10] = 0.37951020516799999;
-            coordinates[11] = 0.206829931611;
-            coordinates[12] = 0.37951020516799999;
-            coordinates[13] = 0.206829931611;
-            coordinates[14] = 0.206829931611;
-            coordinates[15] = 0.082103588310500006;
-            coordinates[16] = 0.082103588310500006;
-            coordinates[17] = 0.082103588310500006;
-            coordinates[18] = 0.082103588310500006;
-            coordinates[19] = 0.082103588310500006;
-            coordinates[20] = 0.75368923506800001;
-            coordinates[21] = 0.082103588310500006;
-            coordinates[22] = 0.75368923506800001;
-            coordinates[23] = 0.082103588310500006;
-            coordinates[24] = 0.75368923506800001;
-            coordinates[25] = 0.082103588310500006;
-            coordinates[26] = 0.082103588310500006;
-            coordinates[27] = 0.0057819505052;
-            coordinates[28] = 0.0057819505052;
-            coordinates[29] = 0.0057819505052;
-            coordinates[30] = 0.0057819505052;
-            coordinates[31] = 0.0057819505052;
-            coordinates[32] = 0.98265414848400001;
-            coordinates[33] = 0.0057819505052;
-            coordinates[34] = 0.98265414848400001;
-            coordinates[35] = 0.0057819505052;
-            coordinates[36] = 0.98265414848400001;
-            coordinates[37] = 0.0057819505052;
-            coordinates[38] = 0.0057819505052;
-            coordinates[39] = 0.050532740018899999;
-            coordinates[40] = 0.050532740018899999;
-            coordinates[41] = 0.44946725998100001;
-            coordinates[42] = 0.050532740018899999;
-            coordinates[43] = 0.44946725998100001;
-            coordinates[44] = 0.050532740018899999;
-            coordinates[45] = 0.44946725998100001;
-            coordinates[46] = 0.050532740018899999;
-            coordinates[47] = 0.050532740018899999;
-            coordinates[48] = 0.050532740018899999;
-            coordinates[49] = 0.44946725998100001;
-            coordinates[50] = 0.44946725998100001;
-            coordinates[51] = 0.44946725998100001;
-            coordinates[52] = 0.050532740018899999;
-            coordinates[53] = 0.44946725998100001;
-            coordinates[54] = 0.44946725998100001;
-            coordinates[55] = 0.44946725998100001;
-            coordinates[56] = 0.050532740018899999;
-            coordinates[57] = 0.22906653611700001;
-            coordinates[58] = 0.22906653611700001;
-            coordinates[59] = 0.035639582788499997;
-            coordinates[60] = 0.22906653611700001;
-            coordinates[61] = 0.035639582788499997;
-            coordinates[62] = 0.22906653611700001;
-            coordinates[63] = 0.22906653611700001;
-            coordinates[64] = 0.22906653611700001;
-            coordinates[65] = 0.50622734497800004;
-            coordinates[66] = 0.22906653611700001;
-            coordinates[67] = 0.50622734497800004;
-            coordinates[68] = 0.22906653611700001;
-            coordinates[69] = 0.22906653611700001;
-            coordinates[70] = 0.035639582788499997;
-            coordinates[71] = 0.50622734497800004;
-            coordinates[72] = 0.22906653611700001;
-            coordinates[73] = 0.50622734497800004;
-            coordinates[74] = 0.035639582788499997;
-            coordinates[75] = 0.035639582788499997;
-            coordinates[76] = 0.22906653611700001;
-            coordinates[77] = 0.22906653611700001;
-            coordinates[78] = 0.035639582788499997;
-            coordinates[79] = 0.22906653611700001;
-            coordinates[80] = 0.50622734497800004;
-            coordinates[81] = 0.035639582788499997;
-            coordinates[82] = 0.50622734497800004;
-            coordinates[83] = 0.22906653611700001;
-            coordinates[84] = 0.50622734497800004;
-            coordinates[85] = 0.22906653611700001;
-            coordinates[86] = 0.035639582788499997;
-            coordinates[87] = 0.50622734497800004;
-            coordinates[88] = 0.22906653611700001;
-            coordinates[89] = 0.22906653611700001;
-            coordinates[90] = 0.50622734497800004;
-            coordinates[91] = 0.035639582788499997;
-            coordinates[92] = 0.22906653611700001;
-            coordinates[93] = 0.036607749553200002;
-            coordinates[94] = 0.036607749553200002;
-            coordinates[95] = 0.19048604193499999;
-            coordinates[96] = 0.036607749553200002;
-            coordinates[97] = 0.19048604193499999;
-            coordinates[98] = 0.036607749553200002;
-            coordinates[99] = 0.036607749553200002;
-            coordinates[100] = 0.036607749553200002;
-            coordinates[101] = 0.73629845895900004;
-            coordinates[102] = 0.036607749553200002;
-            coordinates[103] = 0.73629845895900004;
-            coordinates[104] = 0.036607749553200002;
-            coordinates[105] = 0.036607749553200002;
-            coordinates[106] = 0.19048604193499999;
-            coordinates[107] = 0.73629845895900004;
-            coordinates[108] = 0.036607749553200002;
-            coordinates[109] = 0.73629845895900004;
-            coordinates[110] = 0.19048604193499999;
-            coordinates[111] = 0.19048604193499999;
-            coordinates[112] = 0.036607749553200002;
-            coordinates[113] = 0.036607749553200002;
-            coordinates[114] = 0.19048604193499999;
-            coordinates[115] = 0.036607749553200002;
-            coordinates[116] = 0.73629845895900004;
-            coordinates[117] = 0.19048604193499999;
-            coordinates[118] = 0.73629845895900004;
-            coordinates[119] = 0.036607749553200002;
-            coordinates[120] = 0.73629845895900004;
-            coordinates[121] = 0.036607749553200002;
-            coordinates[122] = 0.19048604193499999;
-            coordinates[123] = 0.73629845895900004;
-            coordinates[124] = 0.036607749553200002;
-            coordinates[125] = 0.036607749553200002;
-            coordinates[126] = 0.73629845895900004;
-            coordinates[127] = 0.19048604193499999;
-            coordinates[128] = 0.036607749553200002;
-
-            weights[0] = -0.020500188658666998;
-            weights[1] = 0.014250305822867;
-            weights[2] = 0.014250305822867;
-            weights[3] = 0.014250305822867;
-            weights[4] = 0.014250305822867;
-            weights[5] = 0.001967033313133;
-            weights[6] = 0.001967033313133;
-            weights[7] = 0.001967033313133;
-            weights[8] = 0.001967033313133;
-            weights[9] = 0.00016983410909299999;
-            weights[10] = 0.00016983410909299999;
-            weights[11] = 0.00016983410909299999;
-            weights[12] = 0.00016983410909299999;
-            weights[13] = 0.0045796838244670001;
-            weights[14] = 0.0045796838244670001;
-            weights[15] = 0.0045796838244670001;
-            weights[16] = 0.0045796838244670001;
-            weights[17] = 0.0045796838244670001;
-            weights[18] = 0.0045796838244670001;
-            weights[19] = 0.0057044858086830004;
-            weights[20] = 0.0057044858086830004;
-            weights[21] = 0.0057044858086830004;
-            weights[22] = 0.0057044858086830004;
-            weights[23] = 0.0057044858086830004;
-            weights[24] = 0.0057044858086830004;
-            weights[25] = 0.0057044858086830004;
-            weights[26] = 0.0057044858086830004;
-            weights[27] = 0.0057044858086830004;
-            weights[28] = 0.0057044858086830004;
-            weights[29] = 0.0057044858086830004;
-            weights[30] = 0.0057044858086830004;
-            weights[31] = 0.002140519141167;
-            weights[32] = 0.002140519141167;
-            weights[33] = 0.002140519141167;
-            weights[34] = 0.002140519141167;
-            weights[35] = 0.002140519141167;
-            weights[36] = 0.002140519141167;
-            weights[37] = 0.002140519141167;
-            weights[38] = 0.002140519141167;
-            weights[39] = 0.002140519141167;
-            weights[40] = 0.002140519141167;
-            weights[41] = 0.002140519141167;
-            weights[42] = 0.002140519141167;
-
+            coordinates.assign(gpcoordinates8, gpcoordinates8+3*43);
+            weights.assign(gpweights8, gpweights8+43);
             break;
-
         case 9:
-
-            coordinates.resize(53*3);
-            weights.resize(53);
-
-            coordinates[0] = 0.25;
-            coordinates[1] = 0.25;
-            coordinates[2] = 0.25;
-            coordinates[3] = 0.0483510385497;
-            coordinates[4] = 0.0483510385497;
-            coordinates[5] = 0.0483510385497;
-            coordinates[6] = 0.0483510385497;
-            coordinates[7] = 0.0483510385497;
-            coordinates[8] = 0.85494688435099997;
-            coordinates[9] = 0.0483510385497;
-            coordinates[10] = 0.85494688435099997;
-            coordinates[11] = 0.0483510385497;
-            coordinates[12] = 0.85494688435099997;
-            coordinates[13] = 0.0483510385497;
-            coordinates[14] = 0.0483510385497;
-            coordinates[15] = 0.32457928011800002;
-            coordinates[16] = 0.32457928011800002;
-            coordinates[17] = 0.32457928011800002;
-            coordinates[18] = 0.32457928011800002;
-            coordinates[19] = 0.32457928011800002;
-            coordinates[20] = 0.0262621596464;
-            coordinates[21] = 0.32457928011800002;
-            coordinates[22] = 0.0262621596464;
-            coordinates[23] = 0.32457928011800002;
-            coordinates[24] = 0.0262621596464;
-            coordinates[25] = 0.32457928011800002;
-            coordinates[26] = 0.32457928011800002;
-            coordinates[27] = 0.114616540224;
-            coordinates[28] = 0.114616540224;
-            coordinates[29] = 0.114616540224;
-            coordinates[30] = 0.114616540224;
-            coordinates[31] = 0.114616540224;
-            coordinates[32] = 0.65615037932800002;
-            coordinates[33] = 0.114616540224;
-            coordinates[34] = 0.65615037932800002;
-            coordinates[35] = 0.114616540224;
-            coordinates[36] = 0.65615037932800002;
-            coordinates[37] = 0.114616540224;
-            coordinates[38] = 0.114616540224;
-            coordinates[39] = 0.225489951912;
-            coordinates[40] = 0.225489951912;
-            coordinates[41] = 0.225489951912;
-            coordinates[42] = 0.225489951912;
-            coordinates[43] = 0.225489951912;
-            coordinates[44] = 0.32353014426499999;
-            coordinates[45] = 0.225489951912;
-            coordinates[46] = 0.32353014426499999;
-            coordinates[47] = 0.225489951912;
-            coordinates[48] = 0.32353014426499999;
-            coordinates[49] = 0.225489951912;
-            coordinates[50] = 0.225489951912;
-            coordinates[51] = 0.13162780924699999;
-            coordinates[52] = 0.13162780924699999;
-            coordinates[53] = 0.083664701617199994;
-            coordinates[54] = 0.13162780924699999;
-            coordinates[55] = 0.083664701617199994;
-            coordinates[56] = 0.13162780924699999;
-            coordinates[57] = 0.13162780924699999;
-            coordinates[58] = 0.13162780924699999;
-            coordinates[59] = 0.65307967988899995;
-            coordinates[60] = 0.13162780924699999;
-            coordinates[61] = 0.65307967988899995;
-            coordinates[62] = 0.13162780924699999;
-            coordinates[63] = 0.13162780924699999;
-            coordinates[64] = 0.083664701617199994;
-            coordinates[65] = 0.65307967988899995;
-            coordinates[66] = 0.13162780924699999;
-            coordinates[67] = 0.65307967988899995;
-            coordinates[68] = 0.083664701617199994;
-            coordinates[69] = 0.083664701617199994;
-            coordinates[70] = 0.13162780924699999;
-            coordinates[71] = 0.13162780924699999;
-            coordinates[72] = 0.083664701617199994;
-            coordinates[73] = 0.13162780924699999;
-            coordinates[74] = 0.65307967988899995;
-            coordinates[75] = 0.083664701617199994;
-            coordinates[76] = 0.65307967988899995;
-            coordinates[77] = 0.13162780924699999;
-            coordinates[78] = 0.65307967988899995;
-            coordinates[79] = 0.13162780924699999;
-            coordinates[80] = 0.083664701617199994;
-            coordinates[81] = 0.65307967988899995;
-            coordinates[82] = 0.13162780924699999;
-            coordinates[83] = 0.13162780924699999;
-            coordinates[84] = 0.65307967988899995;
-            coordinates[85] = 0.083664701617199994;
-            coordinates[86] = 0.13162780924699999;
-            coordinates[87] = 0.43395146141099999;
-            coordinates[88] = 0.43395146141099999;
-            coordinates[89] = 0.10776985954899999;
-            coordinates[90] = 0.43395146141099999;
-            coordinates[91] = 0.10776985954899999;
-            coordinates[92] = 0.43395146141099999;
-            coordinates[93] = 0.43395146141099999;
-            coordinates[94] = 0.43395146141099999;
-            coordinates[95] = 0.024327217627800001;
-            coordinates[96] = 0.43395146141099999;
-            coordinates[97] = 0.024327217627800001;
-            coordinates[98] = 0.43395146141099999;
-            coordinates[99] = 0.43395146141099999;
-            coordinates[100] = 0.10776985954899999;
-            coordinates[101] = 0.024327217627800001;
-            coordinates[102] = 0.43395146141099999;
-            coordinates[103] = 0.024327217627800001;
-            coordinates[104] = 0.10776985954899999;
-            coordinates[105] = 0.10776985954899999;
-            coordinates[106] = 0.43395146141099999;
-            coordinates[107] = 0.43395146141099999;
-            coordinates[108] = 0.10776985954899999;
-            coordinates[109] = 0.43395146141099999;
-            coordinates[110] = 0.024327217627800001;
-            coordinates[111] = 0.10776985954899999;
-            coordinates[112] = 0.024327217627800001;
-            coordinates[113] = 0.43395146141099999;
-            coordinates[114] = 0.024327217627800001;
-            coordinates[115] = 0.43395146141099999;
-            coordinates[116] = 0.10776985954899999;
-            coordinates[117] = 0.024327217627800001;
-            coordinates[118] = 0.43395146141099999;
-            coordinates[119] = 0.43395146141099999;
-            coordinates[120] = 0.024327217627800001;
-            coordinates[121] = 0.10776985954899999;
-            coordinates[122] = 0.43395146141099999;
-            coordinates[123] = -0.00137627731814;
-            coordinates[124] = -0.00137627731814;
-            coordinates[125] = 0.27655347263699998;
-            coordinates[126] = -0.00137627731814;
-            coordinates[127] = 0.27655347263699998;
-            coordinates[128] = -0.00137627731814;
-            coordinates[129] = -0.00137627731814;
-            coordinates[130] = -0.00137627731814;
-            coordinates[131] = 0.72619908199899996;
-            coordinates[132] = -0.00137627731814;
-            coordinates[133] = 0.72619908199899996;
-            coordinates[134] = -0.00137627731814;
-            coordinates[135] = -0.00137627731814;
-            coordinates[136] = 0.27655347263699998;
-            coordinates[137] = 0.72619908199899996;
-            coordinates[138] = -0.00137627731814;
-            coordinates[139] = 0.72619908199899996;
-            coordinates[140] = 0.27655347263699998;
-            coordinates[141] = 0.27655347263699998;
-            coordinates[142] = -0.00137627731814;
-            coordinates[143] = -0.00137627731814;
-            coordinates[144] = 0.27655347263699998;
-            coordinates[145] = -0.00137627731814;
-            coordinates[146] = 0.72619908199899996;
-            coordinates[147] = 0.27655347263699998;
-            coordinates[148] = 0.72619908199899996;
-            coordinates[149] = -0.00137627731814;
-            coordinates[150] = 0.72619908199899996;
-            coordinates[151] = -0.00137627731814;
-            coordinates[152] = 0.27655347263699998;
-            coordinates[153] = 0.72619908199899996;
-            coordinates[154] = -0.00137627731814;
-            coordinates[155] = -0.00137627731814;
-            coordinates[156] = 0.72619908199899996;
-            coordinates[157] = 0.27655347263699998;
-            coordinates[158] = -0.00137627731814;
-
-            weights[0] = -0.13779903832616699;
-            weights[1] = 0.0018653365690829999;
-            weights[2] = 0.0018653365690829999;
-            weights[3] = 0.0018653365690829999;
-            weights[4] = 0.0018653365690829999;
-            weights[5] = 0.0043094239695;
-            weights[6] = 0.0043094239695;
-            weights[7] = 0.0043094239695;
-            weights[8] = 0.0043094239695;
-            weights[9] = -0.090184766481166995;
-            weights[10] = -0.090184766481166995;
-            weights[11] = -0.090184766481166995;
-            weights[12] = -0.090184766481166995;
-            weights[13] = 0.044672576202500001;
-            weights[14] = 0.044672576202500001;
-            weights[15] = 0.044672576202500001;
-            weights[16] = 0.044672576202500001;
-            weights[17] = 0.034700405884499998;
-            weights[18] = 0.034700405884499998;
-            weights[19] = 0.034700405884499998;
-            weights[20] = 0.034700405884499998;
-            weights[21] = 0.034700405884499998;
-            weights[22] = 0.034700405884499998;
-            weights[23] = 0.034700405884499998;
-            weights[24] = 0.034700405884499998;
-            weights[25] = 0.034700405884499998;
-            weights[26] = 0.034700405884499998;
-            weights[27] = 0.034700405884499998;
-            weights[28] = 0.034700405884499998;
-            weights[29] = 0.0033525839026669999;
-            weights[30] = 0.0033525839026669999;
-            weights[31] = 0.0033525839026669999;
-            weights[32] = 0.0033525839026669999;
-            weights[33] = 0.0033525839026669999;
-            weights[34] = 0.0033525839026669999;
-            weights[35] = 0.0033525839026669999;
-            weights[36] = 0.0033525839026669999;
-            weights[37] = 0.0033525839026669999;
-            weights[38] = 0.0033525839026669999;
-            weights[39] = 0.0033525839026669999;
-            weights[40] = 0.0033525839026669999;
-            weights[41] = 0.00043162887555699998;
-            weights[42] = 0.00043162887555699998;
-            weights[43] = 0.00043162887555699998;
-            weights[44] = 0.00043162887555699998;
-            weights[45] = 0.00043162887555699998;
-            weights[46] = 0.00043162887555699998;
-            weights[47] = 0.00043162887555699998;
-            weights[48] = 0.00043162887555699998;
-            weights[49] = 0.00043162887555699998;
-            weights[50] = 0.00043162887555699998;
-            weights[51] = 0.00043162887555699998;
-            weights[52] = 0.00043162887555699998;
-
+            coordinates.assign(gpcoordinates9, gpcoordinates9+3*53);
+            weights.assign(gpweights9, gpweights9+53);
             break;
-
         case 10: case 11:
-            
-            coordinates.resize(126*3);
-            weights.resize(126);
-
-            coordinates[0] = 0.071428571428599999;
-            coordinates[1] = 0.071428571428599999;
-            coordinates[2] = 0.78571428571400004;
-            coordinates[3] = 0.071428571428599999;
-            coordinates[4] = 0.21428571428599999;
-            coordinates[5] = 0.64285714285700002;
-            coordinates[6] = 0.071428571428599999;
-            coordinates[7] = 0.35714285714299998;
-            coordinates[8] = 0.5;
-            coordinates[9] = 0.071428571428599999;
-            coordinates[10] = 0.5;
-            coordinates[11] = 0.35714285714299998;
-            coordinates[12] = 0.071428571428599999;
-            coordinates[13] = 0.64285714285700002;
-            coordinates[14] = 0.21428571428599999;
-            coordinates[15] = 0.071428571428599999;
-            coordinates[16] = 0.78571428571400004;
-            coordinates[17] = 0.071428571428599999;
-            coordinates[18] = 0.21428571428599999;
-            coordinates[19] = 0.071428571428599999;
-            coordinates[20] = 0.64285714285700002;
-            coordinates[21] = 0.21428571428599999;
-            coordinates[22] = 0.21428571428599999;
-            coordinates[23] = 0.5;
-            coordinates[24] = 0.21428571428599999;
-            coordinates[25] = 0.35714285714299998;
-            coordinates[26] = 0.35714285714299998;
-            coordinates[27] = 0.21428571428599999;
-            coordinates[28] = 0.5;
-            coordinates[29] = 0.21428571428599999;
-            coordinates[30] = 0.21428571428599999;
-            coordinates[31] = 0.64285714285700002;
-            coordinates[32] = 0.071428571428599999;
-            coordinates[33] = 0.35714285714299998;
-            coordinates[34] = 0.071428571428599999;
-            coordinates[35] = 0.5;
-            coordinates[36] = 0.35714285714299998;
-            coordinates[37] = 0.21428571428599999;
-            coordinates[38] = 0.35714285714299998;
-            coordinates[39] = 0.35714285714299998;
-            coordinates[40] = 0.35714285714299998;
-            coordinates[41] = 0.21428571428599999;
-            coordinates[42] = 0.35714285714299998;
-            coordinates[43] = 0.5;
-            coordinates[44] = 0.071428571428599999;
-            coordinates[45] = 0.5;
-            coordinates[46] = 0.071428571428599999;
-            coordinates[47] = 0.35714285714299998;
-            coordinates[48] = 0.5;
-            coordinates[49] = 0.21428571428599999;
-            coordinates[50] = 0.21428571428599999;
-            coordinates[51] = 0.5;
-            coordinates[52] = 0.35714285714299998;
-            coordinates[53] = 0.071428571428599999;
-            coordinates[54] = 0.64285714285700002;
-            coordinates[55] = 0.071428571428599999;
-            coordinates[56] = 0.21428571428599999;
-            coordinates[57] = 0.64285714285700002;
-            coordinates[58] = 0.21428571428599999;
-            coordinates[59] = 0.071428571428599999;
-            coordinates[60] = 0.78571428571400004;
-            coordinates[61] = 0.071428571428599999;
-            coordinates[62] = 0.071428571428599999;
-            coordinates[63] = 0.071428571428599999;
-            coordinates[64] = 0.071428571428599999;
-            coordinates[65] = 0.64285714285700002;
-            coordinates[66] = 0.071428571428599999;
-            coordinates[67] = 0.21428571428599999;
-            coordinates[68] = 0.5;
-            coordinates[69] = 0.071428571428599999;
-            coordinates[70] = 0.35714285714299998;
-            coordinates[71] = 0.35714285714299998;
-            coordinates[72] = 0.071428571428599999;
-            coordinates[73] = 0.5;
-            coordinates[74] = 0.21428571428599999;
-            coordinates[75] = 0.071428571428599999;
-            coordinates[76] = 0.64285714285700002;
-            coordinates[77] = 0.071428571428599999;
-            coordinates[78] = 0.21428571428599999;
-            coordinates[79] = 0.071428571428599999;
-            coordinates[80] = 0.5;
-            coordinates[81] = 0.21428571428599999;
-            coordinates[82] = 0.21428571428599999;
-            coordinates[83] = 0.35714285714299998;
-            coordinates[84] = 0.21428571428599999;
-            coordinates[85] = 0.35714285714299998;
-            coordinates[86] = 0.21428571428599999;
-            coordinates[87] = 0.21428571428599999;
-            coordinates[88] = 0.5;
-            coordinates[89] = 0.071428571428599999;
-            coordinates[90] = 0.35714285714299998;
-            coordinates[91] = 0.071428571428599999;
-            coordinates[92] = 0.35714285714299998;
-            coordinates[93] = 0.35714285714299998;
-            coordinates[94] = 0.21428571428599999;
-            coordinates[95] = 0.21428571428599999;
-            coordinates[96] = 0.35714285714299998;
-            coordinates[97] = 0.35714285714299998;
-            coordinates[98] = 0.071428571428599999;
-            coordinates[99] = 0.5;
-            coordinates[100] = 0.071428571428599999;
-            coordinates[101] = 0.21428571428599999;
-            coordinates[102] = 0.5;
-            coordinates[103] = 0.21428571428599999;
-            coordinates[104] = 0.071428571428599999;
-            coordinates[105] = 0.64285714285700002;
-            coordinates[106] = 0.071428571428599999;
-            coordinates[107] = 0.071428571428599999;
-            coordinates[108] = 0.071428571428599999;
-            coordinates[109] = 0.071428571428599999;
-            coordinates[110] = 0.5;
-            coordinates[111] = 0.071428571428599999;
-            coordinates[112] = 0.21428571428599999;
-            coordinates[113] = 0.35714285714299998;
-            coordinates[114] = 0.071428571428599999;
-            coordinates[115] = 0.35714285714299998;
-            coordinates[116] = 0.21428571428599999;
-            coordinates[117] = 0.071428571428599999;
-            coordinates[118] = 0.5;
-            coordinates[119] = 0.071428571428599999;
-            coordinates[120] = 0.21428571428599999;
-            coordinates[121] = 0.071428571428599999;
-            coordinates[122] = 0.35714285714299998;
-            coordinates[123] = 0.21428571428599999;
-            coordinates[124] = 0.21428571428599999;
-            coordinates[125] = 0.21428571428599999;
-            coordinates[126] = 0.21428571428599999;
-            coordinates[127] = 0.35714285714299998;
-            coordinates[128] = 0.071428571428599999;
-            coordinates[129] = 0.35714285714299998;
-            coordinates[130] = 0.071428571428599999;
-            coordinates[131] = 0.21428571428599999;
-            coordinates[132] = 0.35714285714299998;
-            coordinates[133] = 0.21428571428599999;
-            coordinates[134] = 0.071428571428599999;
-            coordinates[135] = 0.5;
-            coordinates[136] = 0.071428571428599999;
-            coordinates[137] = 0.071428571428599999;
-            coordinates[138] = 0.071428571428599999;
-            coordinates[139] = 0.071428571428599999;
-            coordinates[140] = 0.35714285714299998;
-            coordinates[141] = 0.071428571428599999;
-            coordinates[142] = 0.21428571428599999;
-            coordinates[143] = 0.21428571428599999;
-            coordinates[144] = 0.071428571428599999;
-            coordinates[145] = 0.35714285714299998;
-            coordinates[146] = 0.071428571428599999;
-            coordinates[147] = 0.21428571428599999;
-            coordinates[148] = 0.071428571428599999;
-            coordinates[149] = 0.21428571428599999;
-            coordinates[150] = 0.21428571428599999;
-            coordinates[151] = 0.21428571428599999;
-            coordinates[152] = 0.071428571428599999;
-            coordinates[153] = 0.35714285714299998;
-            coordinates[154] = 0.071428571428599999;
-            coordinates[155] = 0.071428571428599999;
-            coordinates[156] = 0.071428571428599999;
-            coordinates[157] = 0.071428571428599999;
-            coordinates[158] = 0.21428571428599999;
-            coordinates[159] = 0.071428571428599999;
-            coordinates[160] = 0.21428571428599999;
-            coordinates[161] = 0.071428571428599999;
-            coordinates[162] = 0.21428571428599999;
-            coordinates[163] = 0.071428571428599999;
-            coordinates[164] = 0.071428571428599999;
-            coordinates[165] = 0.071428571428599999;
-            coordinates[166] = 0.071428571428599999;
-            coordinates[167] = 0.071428571428599999;
-            coordinates[168] = 0.083333333333299994;
-            coordinates[169] = 0.083333333333299994;
-            coordinates[170] = 0.75;
-            coordinates[171] = 0.083333333333299994;
-            coordinates[172] = 0.25;
-            coordinates[173] = 0.58333333333299997;
-            coordinates[174] = 0.083333333333299994;
-            coordinates[175] = 0.41666666666699997;
-            coordinates[176] = 0.41666666666699997;
-            coordinates[177] = 0.083333333333299994;
-            coordinates[178] = 0.58333333333299997;
-            coordinates[179] = 0.25;
-            coordinates[180] = 0.083333333333299994;
-            coordinates[181] = 0.75;
-            coordinates[182] = 0.083333333333299994;
-            coordinates[183] = 0.25;
-            coordinates[184] = 0.083333333333299994;
-            coordinates[185] = 0.58333333333299997;
-            coordinates[186] = 0.25;
-            coordinates[187] = 0.25;
-            coordinates[188] = 0.41666666666699997;
-            coordinates[189] = 0.25;
-            coordinates[190] = 0.41666666666699997;
-            coordinates[191] = 0.25;
-            coordinates[192] = 0.25;
-            coordinates[193] = 0.58333333333299997;
-            coordinates[194] = 0.083333333333299994;
-            coordinates[195] = 0.41666666666699997;
-            coordinates[196] = 0.083333333333299994;
-            coordinates[197] = 0.41666666666699997;
-            coordinates[198] = 0.41666666666699997;
-            coordinates[199] = 0.25;
-            coordinates[200] = 0.25;
-            coordinates[201] = 0.41666666666699997;
-            coordinates[202] = 0.41666666666699997;
-            coordinates[203] = 0.083333333333299994;
-            coordinates[204] = 0.58333333333299997;
-            coordinates[205] = 0.083333333333299994;
-            coordinates[206] = 0.25;
-            coordinates[207] = 0.58333333333299997;
-            coordinates[208] = 0.25;
-            coordinates[209] = 0.083333333333299994;
-            coordinates[210] = 0.75;
-            coordinates[211] = 0.083333333333299994;
-            coordinates[212] = 0.083333333333299994;
-            coordinates[213] = 0.083333333333299994;
-            coordinates[214] = 0.083333333333299994;
-            coordinates[215] = 0.58333333333299997;
-            coordinates[216] = 0.083333333333299994;
-            coordinates[217] = 0.25;
-            coordinates[218] = 0.41666666666699997;
-            coordinates[219] = 0.083333333333299994;
-            coordinates[220] = 0.41666666666699997;
-            coordinates[221] = 0.25;
-            coordinates[222] = 0.083333333333299994;
-            coordinates[223] = 0.58333333333299997;
-            coordinates[224] = 0.083333333333299994;
-            coordinates[225] = 0.25;
-            coordinates[226] = 0.083333333333299994;
-            coordinates[227] = 0.41666666666699997;
-            coordinates[228] = 0.25;
-            coordinates[229] = 0.25;
-            coordinates[230] = 0.25;
-            coordinates[231] = 0.25;
-            coordinates[232] = 0.41666666666699997;
-            coordinates[233] = 0.083333333333299994;
-            coordinates[234] = 0.41666666666699997;
-            coordinates[235] = 0.083333333333299994;
-            coordinates[236] = 0.25;
-            coordinates[237] = 0.41666666666699997;
-            coordinates[238] = 0.25;
-            coordinates[239] = 0.083333333333299994;
-            coordinates[240] = 0.58333333333299997;
-            coordinates[241] = 0.083333333333299994;
-            coordinates[242] = 0.083333333333299994;
-            coordinates[243] = 0.083333333333299994;
-            coordinates[244] = 0.083333333333299994;
-            coordinates[245] = 0.41666666666699997;
-            coordinates[246] = 0.083333333333299994;
-            coordinates[247] = 0.25;
-            coordinates[248] = 0.25;
-            coordinates[249] = 0.083333333333299994;
-            coordinates[250] = 0.41666666666699997;
-            coordinates[251] = 0.083333333333299994;
-            coordinates[252] = 0.25;
-            coordinates[253] = 0.083333333333299994;
-            coordinates[254] = 0.25;
-            coordinates[255] = 0.25;
-            coordinates[256] = 0.25;
-            coordinates[257] = 0.083333333333299994;
-            coordinates[258] = 0.41666666666699997;
-            coordinates[259] = 0.083333333333299994;
-            coordinates[260] = 0.083333333333299994;
-            coordinates[261] = 0.083333333333299994;
-            coordinates[262] = 0.083333333333299994;
-            coordinates[263] = 0.25;
-            coordinates[264] = 0.083333333333299994;
-            coordinates[265] = 0.25;
-            coordinates[266] = 0.083333333333299994;
-            coordinates[267] = 0.25;
-            coordinates[268] = 0.083333333333299994;
-            coordinates[269] = 0.083333333333299994;
-            coordinates[270] = 0.083333333333299994;
-            coordinates[271] = 0.083333333333299994;
-            coordinates[272] = 0.083333333333299994;
-            coordinates[273] = 0.10000000000000001;
-            coordinates[274] = 0.10000000000000001;
-            coordinates[275] = 0.69999999999999996;
-            coordinates[276] = 0.10000000000000001;
-            coordinates[277] = 0.29999999999999999;
-            coordinates[278] = 0.5;
-            coordinates[279] = 0.10000000000000001;
-            coordinates[280] = 0.5;
-            coordinates[281] = 0.29999999999999999;
-            coordinates[282] = 0.10000000000000001;
-            coordinates[283] = 0.69999999999999996;
-            coordinates[284] = 0.10000000000000001;
-            coordinates[285] = 0.29999999999999999;
-            coordinates[286] = 0.10000000000000001;
-            coordinates[287] = 0.5;
-            coordinates[288] = 0.29999999999999999;
-            coordinates[289] = 0.29999999999999999;
-            coordinates[290] = 0.29999999999999999;
-            coordinates[291] = 0.29999999999999999;
-            coordinates[292] = 0.5;
-            coordinates[293] = 0.10000000000000001;
-            coordinates[294] = 0.5;
-            coordinates[295] = 0.10000000000000001;
-            coordinates[296] = 0.29999999999999999;
-            coordinates[297] = 0.5;
-            coordinates[298] = 0.29999999999999999;
-            coordinates[299] = 0.10000000000000001;
-            coordinates[300] = 0.69999999999999996;
-            coordinates[301] = 0.10000000000000001;
-            coordinates[302] = 0.10000000000000001;
-            coordinates[303] = 0.10000000000000001;
-            coordinates[304] = 0.10000000000000001;
-            coordinates[305] = 0.5;
-            coordinates[306] = 0.10000000000000001;
-            coordinates[307] = 0.29999999999999999;
-            coordinates[308] = 0.29999999999999999;
-            coordinates[309] = 0.10000000000000001;
-            coordinates[310] = 0.5;
-            coordinates[311] = 0.10000000000000001;
-            coordinates[312] = 0.29999999999999999;
-            coordinates[313] = 0.10000000000000001;
-            coordinates[314] = 0.29999999999999999;
-            coordinates[315] = 0.29999999999999999;
-            coordinates[316] = 0.29999999999999999;
-            coordinates[317] = 0.10000000000000001;
-            coordinates[318] = 0.5;
-            coordinates[319] = 0.10000000000000001;
-            coordinates[320] = 0.10000000000000001;
-            coordinates[321] = 0.10000000000000001;
-            coordinates[322] = 0.10000000000000001;
-            coordinates[323] = 0.29999999999999999;
-            coordinates[324] = 0.10000000000000001;
-            coordinates[325] = 0.29999999999999999;
-            coordinates[326] = 0.10000000000000001;
-            coordinates[327] = 0.29999999999999999;
-            coordinates[328] = 0.10000000000000001;
-            coordinates[329] = 0.10000000000000001;
-            coordinates[330] = 0.10000000000000001;
-            coordinates[331] = 0.10000000000000001;
-            coordinates[332] = 0.10000000000000001;
-            coordinates[333] = 0.125;
-            coordinates[334] = 0.125;
-            coordinates[335] = 0.625;
-            coordinates[336] = 0.125;
-            coordinates[337] = 0.375;
-            coordinates[338] = 0.375;
-            coordinates[339] = 0.125;
-            coordinates[340] = 0.625;
-            coordinates[341] = 0.125;
-            coordinates[342] = 0.375;
-            coordinates[343] = 0.125;
-            coordinates[344] = 0.375;
-            coordinates[345] = 0.375;
-            coordinates[346] = 0.375;
-            coordinates[347] = 0.125;
-            coordinates[348] = 0.625;
-            coordinates[349] = 0.125;
-            coordinates[350] = 0.125;
-            coordinates[351] = 0.125;
-            coordinates[352] = 0.125;
-            coordinates[353] = 0.375;
-            coordinates[354] = 0.125;
-            coordinates[355] = 0.375;
-            coordinates[356] = 0.125;
-            coordinates[357] = 0.375;
-            coordinates[358] = 0.125;
-            coordinates[359] = 0.125;
-            coordinates[360] = 0.125;
-            coordinates[361] = 0.125;
-            coordinates[362] = 0.125;
-            coordinates[363] = 0.166666666667;
-            coordinates[364] = 0.166666666667;
-            coordinates[365] = 0.5;
-            coordinates[366] = 0.166666666667;
-            coordinates[367] = 0.5;
-            coordinates[368] = 0.166666666667;
-            coordinates[369] = 0.5;
-            coordinates[370] = 0.166666666667;
-            coordinates[371] = 0.166666666667;
-            coordinates[372] = 0.166666666667;
-            coordinates[373] = 0.166666666667;
-            coordinates[374] = 0.166666666667;
-            coordinates[375] = 0.25;
-            coordinates[376] = 0.25;
-            coordinates[377] = 0.25;
-
-            weights[0] = 0.045362824065000001;
-            weights[1] = 0.045362824065000001;
-            weights[2] = 0.045362824065000001;
-            weights[3] = 0.045362824065000001;
-            weights[4] = 0.045362824065000001;
-            weights[5] = 0.045362824065000001;
-            weights[6] = 0.045362824065000001;
-            weights[7] = 0.045362824065000001;
-            weights[8] = 0.045362824065000001;
-            weights[9] = 0.045362824065000001;
-            weights[10] = 0.045362824065000001;
-            weights[11] = 0.045362824065000001;
-            weights[12] = 0.045362824065000001;
-            weights[13] = 0.045362824065000001;
-            weights[14] = 0.045362824065000001;
-            weights[15] = 0.045362824065000001;
-            weights[16] = 0.045362824065000001;
-            weights[17] = 0.045362824065000001;
-            weights[18] = 0.045362824065000001;
-            weights[19] = 0.045362824065000001;
-            weights[20] = 0.045362824065000001;
-            weights[21] = 0.045362824065000001;
-            weights[22] = 0.045362824065000001;
-            weights[23] = 0.045362824065000001;
-            weights[24] = 0.045362824065000001;
-            weights[25] = 0.045362824065000001;
-            weights[26] = 0.045362824065000001;
-            weights[27] = 0.045362824065000001;
-            weights[28] = 0.045362824065000001;
-            weights[29] = 0.045362824065000001;
-            weights[30] = 0.045362824065000001;
-            weights[31] = 0.045362824065000001;
-            weights[32] = 0.045362824065000001;
-            weights[33] = 0.045362824065000001;
-            weights[34] = 0.045362824065000001;
-            weights[35] = 0.045362824065000001;
-            weights[36] = 0.045362824065000001;
-            weights[37] = 0.045362824065000001;
-            weights[38] = 0.045362824065000001;
-            weights[39] = 0.045362824065000001;
-            weights[40] = 0.045362824065000001;
-            weights[41] = 0.045362824065000001;
-            weights[42] = 0.045362824065000001;
-            weights[43] = 0.045362824065000001;
-            weights[44] = 0.045362824065000001;
-            weights[45] = 0.045362824065000001;
-            weights[46] = 0.045362824065000001;
-            weights[47] = 0.045362824065000001;
-            weights[48] = 0.045362824065000001;
-            weights[49] = 0.045362824065000001;
-            weights[50] = 0.045362824065000001;
-            weights[51] = 0.045362824065000001;
-            weights[52] = 0.045362824065000001;
-            weights[53] = 0.045362824065000001;
-            weights[54] = 0.045362824065000001;
-            weights[55] = 0.045362824065000001;
-            weights[56] = -0.11652347652349999;
-            weights[57] = -0.11652347652349999;
-            weights[58] = -0.11652347652349999;
-            weights[59] = -0.11652347652349999;
-            weights[60] = -0.11652347652349999;
-            weights[61] = -0.11652347652349999;
-            weights[62] = -0.11652347652349999;
-            weights[63] = -0.11652347652349999;
-            weights[64] = -0.11652347652349999;
-            weights[65] = -0.11652347652349999;
-            weights[66] = -0.11652347652349999;
-            weights[67] = -0.11652347652349999;
-            weights[68] = -0.11652347652349999;
-            weights[69] = -0.11652347652349999;
-            weights[70] = -0.11652347652349999;
-            weights[71] = -0.11652347652349999;
-            weights[72] = -0.11652347652349999;
-            weights[73] = -0.11652347652349999;
-            weights[74] = -0.11652347652349999;
-            weights[75] = -0.11652347652349999;
-            weights[76] = -0.11652347652349999;
-            weights[77] = -0.11652347652349999;
-            weights[78] = -0.11652347652349999;
-            weights[79] = -0.11652347652349999;
-            weights[80] = -0.11652347652349999;
-            weights[81] = -0.11652347652349999;
-            weights[82] = -0.11652347652349999;
-            weights[83] = -0.11652347652349999;
-            weights[84] = -0.11652347652349999;
-            weights[85] = -0.11652347652349999;
-            weights[86] = -0.11652347652349999;
-            weights[87] = -0.11652347652349999;
-            weights[88] = -0.11652347652349999;
-            weights[89] = -0.11652347652349999;
-            weights[90] = -0.11652347652349999;
-            weights[91] = 0.10193728997983301;
-            weights[92] = 0.10193728997983301;
-            weights[93] = 0.10193728997983301;
-            weights[94] = 0.10193728997983301;
-            weights[95] = 0.10193728997983301;
-            weights[96] = 0.10193728997983301;
-            weights[97] = 0.10193728997983301;
-            weights[98] = 0.10193728997983301;
-            weights[99] = 0.10193728997983301;
-            weights[100] = 0.10193728997983301;
-            weights[101] = 0.10193728997983301;
-            weights[102] = 0.10193728997983301;
-            weights[103] = 0.10193728997983301;
-            weights[104] = 0.10193728997983301;
-            weights[105] = 0.10193728997983301;
-            weights[106] = 0.10193728997983301;
-            weights[107] = 0.10193728997983301;
-            weights[108] = 0.10193728997983301;
-            weights[109] = 0.10193728997983301;
-            weights[110] = 0.10193728997983301;
-            weights[111] = -0.035025386136499997;
-            weights[112] = -0.035025386136499997;
-            weights[113] = -0.035025386136499997;
-            weights[114] = -0.035025386136499997;
-            weights[115] = -0.035025386136499997;
-            weights[116] = -0.035025386136499997;
-            weights[117] = -0.035025386136499997;
-            weights[118] = -0.035025386136499997;
-            weights[119] = -0.035025386136499997;
-            weights[120] = -0.035025386136499997;
-            weights[121] = 0.0040680803571499996;
-            weights[122] = 0.0040680803571499996;
-            weights[123] = 0.0040680803571499996;
-            weights[124] = 0.0040680803571499996;
-            weights[125] = -9.4062316284000003e-05;
-
+            coordinates.assign(gpcoordinates10, gpcoordinates10+3*126);
+            weights.assign(gpweights10, gpweights10+126);
             break;
-
         case 12: case 13:
-            
-            coordinates.resize(210*3);
-            weights.resize(210);
-
-            coordinates[0] = 0.0625;
-            coordinates[1] = 0.0625;
-            coordinates[2] = 0.8125;
-            coordinates[3] = 0.0625;
-            coordinates[4] = 0.1875;
-            coordinates[5] = 0.6875;
-            coordinates[6] = 0.0625;
-            coordinates[7] = 0.3125;
-            coordinates[8] = 0.5625;
-            coordinates[9] = 0.0625;
-            coordinates[10] = 0.4375;
-            coordinates[11] = 0.4375;
-            coordinates[12] = 0.0625;
-            coordinates[13] = 0.5625;
-            coordinates[14] = 0.3125;
-            coordinates[15] = 0.0625;
-            coordinates[16] = 0.6875;
-            coordinates[17] = 0.1875;
-            coordinates[18] = 0.0625;
-            coordinates[19] = 0.8125;
-            coordinates[20] = 0.0625;
-            coordinates[21] = 0.1875;
-            coordinates[22] = 0.0625;
-            coordinates[23] = 0.6875;
-            coordinates[24] = 0.1875;
-            coordinates[25] = 0.1875;
-            coordinates[26] = 0.5625;
-            coordinates[27] = 0.1875;
-            coordinates[28] = 0.3125;
-            coordinates[29] = 0.4375;
-            coordinates[30] = 0.1875;
-            coordinates[31] = 0.4375;
-            coordinates[32] = 0.3125;
-            coordinates[33] = 0.1875;
-            coordinates[34] = 0.5625;
-            coordinates[35] = 0.1875;
-            coordinates[36] = 0.1875;
-            coordinates[37] = 0.6875;
-            coordinates[38] = 0.0625;
-            coordinates[39] = 0.3125;
-            coordinates[40] = 0.0625;
-            coordinates[41] = 0.5625;
-            coordinates[42] = 0.3125;
-            coordinates[43] = 0.1875;
-            coordinates[44] = 0.4375;
-            coordinates[45] = 0.3125;
-            coordinates[46] = 0.3125;
-            coordinates[47] = 0.3125;
-            coordinates[48] = 0.3125;
-            coordinates[49] = 0.4375;
-            coordinates[50] = 0.1875;
-            coordinates[51] = 0.3125;
-            coordinates[52] = 0.5625;
-            coordinates[53] = 0.0625;
-            coordinates[54] = 0.4375;
-            coordinates[55] = 0.0625;
-            coordinates[56] = 0.4375;
-            coordinates[57] = 0.4375;
-            coordinates[58] = 0.1875;
-            coordinates[59] = 0.3125;
-            coordinates[60] = 0.4375;
-            coordinates[61] = 0.3125;
-            coordinates[62] = 0.1875;
-            coordinates[63] = 0.4375;
-            coordinates[64] = 0.4375;
-            coordinates[65] = 0.0625;
-            coordinates[66] = 0.5625;
-            coordinates[67] = 0.0625;
-            coordinates[68] = 0.3125;
-            coordinates[69] = 0.5625;
-            coordinates[70] = 0.1875;
-            coordinates[71] = 0.1875;
-            coordinates[72] = 0.5625;
-            coordinates[73] = 0.3125;
-            coordinates[74] = 0.0625;
-            coordinates[75] = 0.6875;
-            coordinates[76] = 0.0625;
-            coordinates[77] = 0.1875;
-            coordinates[78] = 0.6875;
-            coordinates[79] = 0.1875;
-            coordinates[80] = 0.0625;
-            coordinates[81] = 0.8125;
-            coordinates[82] = 0.0625;
-            coordinates[83] = 0.0625;
-            coordinates[84] = 0.0625;
-            coordinates[85] = 0.0625;
-            coordinates[86] = 0.6875;
-            coordinates[87] = 0.0625;
-            coordinates[88] = 0.1875;
-            coordinates[89] = 0.5625;
-            coordinates[90] = 0.0625;
-            coordinates[91] = 0.3125;
-            coordinates[92] = 0.4375;
-            coordinates[93] = 0.0625;
-            coordinates[94] = 0.4375;
-            coordinates[95] = 0.3125;
-            coordinates[96] = 0.0625;
-            coordinates[97] = 0.5625;
-            coordinates[98] = 0.1875;
-            coordinates[99] = 0.0625;
-            coordinates[100] = 0.6875;
-            coordinates[101] = 0.0625;
-            coordinates[102] = 0.1875;
-            coordinates[103] = 0.0625;
-            coordinates[104] = 0.5625;
-            coordinates[105] = 0.1875;
-            coordinates[106] = 0.1875;
-            coordinates[107] = 0.4375;
-            coordinates[108] = 0.1875;
-            coordinates[109] = 0.3125;
-            coordinates[110] = 0.3125;
-            coordinates[111] = 0.1875;
-            coordinates[112] = 0.4375;
-            coordinates[113] = 0.1875;
-            coordinates[114] = 0.1875;
-            coordinates[115] = 0.5625;
-            coordinates[116] = 0.0625;
-            coordinates[117] = 0.3125;
-            coordinates[118] = 0.0625;
-            coordinates[119] = 0.4375;
-            coordinates[120] = 0.3125;
-            coordinates[121] = 0.1875;
-            coordinates[122] = 0.3125;
-            coordinates[123] = 0.3125;
-            coordinates[124] = 0.3125;
-            coordinates[125] = 0.1875;
-            coordinates[126] = 0.3125;
-            coordinates[127] = 0.4375;
-            coordinates[128] = 0.0625;
-            coordinates[129] = 0.4375;
-            coordinates[130] = 0.0625;
-            coordinates[131] = 0.3125;
-            coordinates[132] = 0.4375;
-            coordinates[133] = 0.1875;
-            coordinates[134] = 0.1875;
-            coordinates[135] = 0.4375;
-            coordinates[136] = 0.3125;
-            coordinates[137] = 0.0625;
-            coordinates[138] = 0.5625;
-            coordinates[139] = 0.0625;
-            coordinates[140] = 0.1875;
-            coordinates[141] = 0.5625;
-            coordinates[142] = 0.1875;
-            coordinates[143] = 0.0625;
-            coordinates[144] = 0.6875;
-            coordinates[145] = 0.0625;
-            coordinates[146] = 0.0625;
-            coordinates[147] = 0.0625;
-            coordinates[148] = 0.0625;
-            coordinates[149] = 0.5625;
-            coordinates[150] = 0.0625;
-            coordinates[151] = 0.1875;
-            coordinates[152] = 0.4375;
-            coordinates[153] = 0.0625;
-            coordinates[154] = 0.3125;
-            coordinates[155] = 0.3125;
-            coordinates[156] = 0.0625;
-            coordinates[157] = 0.4375;
-            coordinates[158] = 0.1875;
-            coordinates[159] = 0.0625;
-            coordinates[160] = 0.5625;
-            coordinates[161] = 0.0625;
-            coordinates[162] = 0.1875;
-            coordinates[163] = 0.0625;
-            coordinates[164] = 0.4375;
-            coordinates[165] = 0.1875;
-            coordinates[166] = 0.1875;
-            coordinates[167] = 0.3125;
-            coordinates[168] = 0.1875;
-            coordinates[169] = 0.3125;
-            coordinates[170] = 0.1875;
-            coordinates[171] = 0.1875;
-            coordinates[172] = 0.4375;
-            coordinates[173] = 0.0625;
-            coordinates[174] = 0.3125;
-            coordinates[175] = 0.0625;
-            coordinates[176] = 0.3125;
-            coordinates[177] = 0.3125;
-            coordinates[178] = 0.1875;
-            coordinates[179] = 0.1875;
-            coordinates[180] = 0.3125;
-            coordinates[181] = 0.3125;
-            coordinates[182] = 0.0625;
-            coordinates[183] = 0.4375;
-            coordinates[184] = 0.0625;
-            coordinates[185] = 0.1875;
-            coordinates[186] = 0.4375;
-            coordinates[187] = 0.1875;
-            coordinates[188] = 0.0625;
-            coordinates[189] = 0.5625;
-            coordinates[190] = 0.0625;
-            coordinates[191] = 0.0625;
-            coordinates[192] = 0.0625;
-            coordinates[193] = 0.0625;
-            coordinates[194] = 0.4375;
-            coordinates[195] = 0.0625;
-            coordinates[196] = 0.1875;
-            coordinates[197] = 0.3125;
-            coordinates[198] = 0.0625;
-            coordinates[199] = 0.3125;
-            coordinates[200] = 0.1875;
-            coordinates[201] = 0.0625;
-            coordinates[202] = 0.4375;
-            coordinates[203] = 0.0625;
-            coordinates[204] = 0.1875;
-            coordinates[205] = 0.0625;
-            coordinates[206] = 0.3125;
-            coordinates[207] = 0.1875;
-            coordinates[208] = 0.1875;
-            coordinates[209] = 0.1875;
-            coordinates[210] = 0.1875;
-            coordinates[211] = 0.3125;
-            coordinates[212] = 0.0625;
-            coordinates[213] = 0.3125;
-            coordinates[214] = 0.0625;
-            coordinates[215] = 0.1875;
-            coordinates[216] = 0.3125;
-            coordinates[217] = 0.1875;
-            coordinates[218] = 0.0625;
-            coordinates[219] = 0.4375;
-            coordinates[220] = 0.0625;
-            coordinates[221] = 0.0625;
-            coordinates[222] = 0.0625;
-            coordinates[223] = 0.0625;
-            coordinates[224] = 0.3125;
-            coordinates[225] = 0.0625;
-            coordinates[226] = 0.1875;
-            coordinates[227] = 0.1875;
-            coordinates[228] = 0.0625;
-            coordinates[229] = 0.3125;
-            coordinates[230] = 0.0625;
-            coordinates[231] = 0.1875;
-            coordinates[232] = 0.0625;
-            coordinates[233] = 0.1875;
-            coordinates[234] = 0.1875;
-            coordinates[235] = 0.1875;
-            coordinates[236] = 0.0625;
-            coordinates[237] = 0.3125;
-            coordinates[238] = 0.0625;
-            coordinates[239] = 0.0625;
-            coordinates[240] = 0.0625;
-            coordinates[241] = 0.0625;
-            coordinates[242] = 0.1875;
-            coordinates[243] = 0.0625;
-            coordinates[244] = 0.1875;
-            coordinates[245] = 0.0625;
-            coordinates[246] = 0.1875;
-            coordinates[247] = 0.0625;
-            coordinates[248] = 0.0625;
-            coordinates[249] = 0.0625;
-            coordinates[250] = 0.0625;
-            coordinates[251] = 0.0625;
-            coordinates[252] = 0.071428571428599999;
-            coordinates[253] = 0.071428571428599999;
-            coordinates[254] = 0.78571428571400004;
-            coordinates[255] = 0.071428571428599999;
-            coordinates[256] = 0.21428571428599999;
-            coordinates[257] = 0.64285714285700002;
-            coordinates[258] = 0.071428571428599999;
-            coordinates[259] = 0.35714285714299998;
-            coordinates[260] = 0.5;
-            coordinates[261] = 0.071428571428599999;
-            coordinates[262] = 0.5;
-            coordinates[263] = 0.35714285714299998;
-            coordinates[264] = 0.071428571428599999;
-            coordinates[265] = 0.64285714285700002;
-            coordinates[266] = 0.21428571428599999;
-            coordinates[267] = 0.071428571428599999;
-            coordinates[268] = 0.78571428571400004;
-            coordinates[269] = 0.071428571428599999;
-            coordinates[270] = 0.21428571428599999;
-            coordinates[271] = 0.071428571428599999;
-            coordinates[272] = 0.64285714285700002;
-            coordinates[273] = 0.21428571428599999;
-            coordinates[274] = 0.21428571428599999;
-            coordinates[275] = 0.5;
-            coordinates[276] = 0.21428571428599999;
-            coordinates[277] = 0.35714285714299998;
-            coordinates[278] = 0.35714285714299998;
-            coordinates[279] = 0.21428571428599999;
-            coordinates[280] = 0.5;
-            coordinates[281] = 0.21428571428599999;
-            coordinates[282] = 0.21428571428599999;
-            coordinates[283] = 0.64285714285700002;
-            coordinates[284] = 0.071428571428599999;
-            coordinates[285] = 0.35714285714299998;
-            coordinates[286] = 0.071428571428599999;
-            coordinates[287] = 0.5;
-            coordinates[288] = 0.35714285714299998;
-            coordinates[289] = 0.21428571428599999;
-            coordinates[290] = 0.35714285714299998;
-            coordinates[291] = 0.35714285714299998;
-            coordinates[292] = 0.35714285714299998;
-            coordinates[293] = 0.21428571428599999;
-            coordinates[294] = 0.35714285714299998;
-            coordinates[295] = 0.5;
-            coordinates[296] = 0.071428571428599999;
-            coordinates[297] = 0.5;
-            coordinates[298] = 0.071428571428599999;
-            coordinates[299] = 0.35714285714299998;
-            coordinates[300] = 0.5;
-            coordinates[301] = 0.21428571428599999;
-            coordinates[302] = 0.21428571428599999;
-            coordinates[303] = 0.5;
-            coordinates[304] = 0.35714285714299998;
-            coordinates[305] = 0.071428571428599999;
-            coordinates[306] = 0.64285714285700002;
-            coordinates[307] = 0.071428571428599999;
-            coordinates[308] = 0.21428571428599999;
-            coordinates[309] = 0.64285714285700002;
-            coordinates[310] = 0.21428571428599999;
-            coordinates[311] = 0.071428571428599999;
-            coordinates[312] = 0.78571428571400004;
-            coordinates[313] = 0.071428571428599999;
-            coordinates[314] = 0.071428571428599999;
-            coordinates[315] = 0.071428571428599999;
-            coordinates[316] = 0.071428571428599999;
-            coordinates[317] = 0.64285714285700002;
-            coordinates[318] = 0.071428571428599999;
-            coordinates[319] = 0.21428571428599999;
-            coordinates[320] = 0.5;
-            coordinates[321] = 0.071428571428599999;
-            coordinates[322] = 0.35714285714299998;
-            coordinates[323] = 0.35714285714299998;
-            coordinates[324] = 0.071428571428599999;
-            coordinates[325] = 0.5;
-            coordinates[326] = 0.21428571428599999;
-            coordinates[327] = 0.071428571428599999;
-            coordinates[328] = 0.64285714285700002;
-            coordinates[329] = 0.071428571428599999;
-            coordinates[330] = 0.21428571428599999;
-            coordinates[331] = 0.071428571428599999;
-            coordinates[332] = 0.5;
-            coordinates[333] = 0.21428571428599999;
-            coordinates[334] = 0.21428571428599999;
-            coordinates[335] = 0.35714285714299998;
-            coordinates[336] = 0.21428571428599999;
-            coordinates[337] = 0.35714285714299998;
-            coordinates[338] = 0.21428571428599999;
-            coordinates[339] = 0.21428571428599999;
-            coordinates[340] = 0.5;
-            coordinates[341] = 0.071428571428599999;
-            coordinates[342] = 0.35714285714299998;
-            coordinates[343] = 0.071428571428599999;
-            coordinates[344] = 0.35714285714299998;
-            coordinates[345] = 0.35714285714299998;
-            coordinates[346] = 0.21428571428599999;
-            coordinates[347] = 0.21428571428599999;
-            coordinates[348] = 0.35714285714299998;
-            coordinates[349] = 0.35714285714299998;
-            coordinates[350] = 0.071428571428599999;
-            coordinates[351] = 0.5;
-            coordinates[352] = 0.071428571428599999;
-            coordinates[353] = 0.21428571428599999;
-            coordinates[354] = 0.5;
-            coordinates[355] = 0.21428571428599999;
-            coordinates[356] = 0.071428571428599999;
-            coordinates[357] = 0.64285714285700002;
-            coordinates[358] = 0.071428571428599999;
-            coordinates[359] = 0.071428571428599999;
-            coordinates[360] = 0.071428571428599999;
-            coordinates[361] = 0.071428571428599999;
-            coordinates[362] = 0.5;
-            coordinates[363] = 0.071428571428599999;
-            coordinates[364] = 0.21428571428599999;
-            coordinates[365] = 0.35714285714299998;
-            coordinates[366] = 0.071428571428599999;
-            coordinates[367] = 0.35714285714299998;
-            coordinates[368] = 0.21428571428599999;
-            coordinates[369] = 0.071428571428599999;
-            coordinates[370] = 0.5;
-            coordinates[371] = 0.071428571428599999;
-            coordinates[372] = 0.21428571428599999;
-            coordinates[373] = 0.071428571428599999;
-            coordinates[374] = 0.35714285714299998;
-            coordinates[375] = 0.21428571428599999;
-            coordinates[376] = 0.21428571428599999;
-            coordinates[377] = 0.21428571428599999;
-            coordinates[378] = 0.21428571428599999;
-            coordinates[379] = 0.35714285714299998;
-            coordinates[380] = 0.071428571428599999;
-            coordinates[381] = 0.35714285714299998;
-            coordinates[382] = 0.071428571428599999;
-            coordinates[383] = 0.21428571428599999;
-            coordinates[384] = 0.35714285714299998;
-            coordinates[385] = 0.21428571428599999;
-            coordinates[386] = 0.071428571428599999;
-            coordinates[387] = 0.5;
-            coordinates[388] = 0.071428571428599999;
-            coordinates[389] = 0.071428571428599999;
-            coordinates[390] = 0.071428571428599999;
-            coordinates[391] = 0.071428571428599999;
-            coordinates[392] = 0.35714285714299998;
-            coordinates[393] = 0.071428571428599999;
-            coordinates[394] = 0.21428571428599999;
-            coordinates[395] = 0.21428571428599999;
-            coordinates[396] = 0.071428571428599999;
-            coordinates[397] = 0.35714285714299998;
-            coordinates[398] = 0.071428571428599999;
-            coordinates[399] = 0.21428571428599999;
-            coordinates[400] = 0.071428571428599999;
-            coordinates[401] = 0.21428571428599999;
-            coordinates[402] = 0.21428571428599999;
-            coordinates[403] = 0.21428571428599999;
-            coordinates[404] = 0.071428571428599999;
-            coordinates[405] = 0.35714285714299998;
-            coordinates[406] = 0.071428571428599999;
-            coordinates[407] = 0.071428571428599999;
-            coordinates[408] = 0.071428571428599999;
-            coordinates[409] = 0.071428571428599999;
-            coordinates[410] = 0.21428571428599999;
-            coordinates[411] = 0.071428571428599999;
-            coordinates[412] = 0.21428571428599999;
-            coordinates[413] = 0.071428571428599999;
-            coordinates[414] = 0.21428571428599999;
-            coordinates[415] = 0.071428571428599999;
-            coordinates[416] = 0.071428571428599999;
-            coordinates[417] = 0.071428571428599999;
-            coordinates[418] = 0.071428571428599999;
-            coordinates[419] = 0.071428571428599999;
-            coordinates[420] = 0.083333333333299994;
-            coordinates[421] = 0.083333333333299994;
-            coordinates[422] = 0.75;
-            coordinates[423] = 0.083333333333299994;
-            coordinates[424] = 0.25;
-            coordinates[425] = 0.58333333333299997;
-            coordinates[426] = 0.083333333333299994;
-            coordinates[427] = 0.41666666666699997;
-            coordinates[428] = 0.41666666666699997;
-            coordinates[429] = 0.083333333333299994;
-            coordinates[430] = 0.58333333333299997;
-            coordinates[431] = 0.25;
-            coordinates[432] = 0.083333333333299994;
-            coordinates[433] = 0.75;
-            coordinates[434] = 0.083333333333299994;
-            coordinates[435] = 0.25;
-            coordinates[436] = 0.083333333333299994;
-            coordinates[437] = 0.58333333333299997;
-            coordinates[438] = 0.25;
-            coordinates[439] = 0.25;
-            coordinates[440] = 0.41666666666699997;
-            coordinates[441] = 0.25;
-            coordinates[442] = 0.41666666666699997;
-            coordinates[443] = 0.25;
-            coordinates[444] = 0.25;
-            coordinates[445] = 0.58333333333299997;
-            coordinates[446] = 0.083333333333299994;
-            coordinates[447] = 0.41666666666699997;
-            coordinates[448] = 0.083333333333299994;
-            coordinates[449] = 0.41666666666699997;
-            coordinates[450] = 0.41666666666699997;
-            coordinates[451] = 0.25;
-            coordinates[452] = 0.25;
-            coordinates[453] = 0.41666666666699997;
-            coordinates[454] = 0.41666666666699997;
-            coordinates[455] = 0.083333333333299994;
-            coordinates[456] = 0.58333333333299997;
-            coordinates[457] = 0.083333333333299994;
-            coordinates[458] = 0.25;
-            coordinates[459] = 0.58333333333299997;
-            coordinates[460] = 0.25;
-            coordinates[461] = 0.083333333333299994;
-            coordinates[462] = 0.75;
-            coordinates[463] = 0.083333333333299994;
-            coordinates[464] = 0.083333333333299994;
-            coordinates[465] = 0.083333333333299994;
-            coordinates[466] = 0.083333333333299994;
-            coordinates[467] = 0.58333333333299997;
-            coordinates[468] = 0.083333333333299994;
-            coordinates[469] = 0.25;
-            coordinates[470] = 0.41666666666699997;
-            coordinates[471] = 0.083333333333299994;
-            coordinates[472] = 0.41666666666699997;
-            coordinates[473] = 0.25;
-            coordinates[474] = 0.083333333333299994;
-            coordinates[475] = 0.58333333333299997;
-            coordinates[476] = 0.083333333333299994;
-            coordinates[477] = 0.25;
-            coordinates[478] = 0.083333333333299994;
-            coordinates[479] = 0.41666666666699997;
-            coordinates[480] = 0.25;
-            coordinates[481] = 0.25;
-            coordinates[482] = 0.25;
-            coordinates[483] = 0.25;
-            coordinates[484] = 0.41666666666699997;
-            coordinates[485] = 0.083333333333299994;
-            coordinates[486] = 0.41666666666699997;
-            coordinates[487] = 0.083333333333299994;
-            coordinates[488] = 0.25;
-            coordinates[489] = 0.41666666666699997;
-            coordinates[490] = 0.25;
-            coordinates[491] = 0.083333333333299994;
-            coordinates[492] = 0.58333333333299997;
-            coordinates[493] = 0.083333333333299994;
-            coordinates[494] = 0.083333333333299994;
-            coordinates[495] = 0.083333333333299994;
-            coordinates[496] = 0.083333333333299994;
-            coordinates[497] = 0.41666666666699997;
-            coordinates[498] = 0.083333333333299994;
-            coordinates[499] = 0.25;
-            coordinates[500] = 0.25;
-            coordinates[501] = 0.083333333333299994;
-            coordinates[502] = 0.41666666666699997;
-            coordinates[503] = 0.083333333333299994;
-            coordinates[504] = 0.25;
-            coordinates[505] = 0.083333333333299994;
-            coordinates[506] = 0.25;
-            coordinates[507] = 0.25;
-            coordinates[508] = 0.25;
-            coordinates[509] = 0.083333333333299994;
-            coordinates[510] = 0.41666666666699997;
-            coordinates[511] = 0.083333333333299994;
-            coordinates[512] = 0.083333333333299994;
-            coordinates[513] = 0.083333333333299994;
-            coordinates[514] = 0.083333333333299994;
-            coordinates[515] = 0.25;
-            coordinates[516] = 0.083333333333299994;
-            coordinates[517] = 0.25;
-            coordinates[518] = 0.083333333333299994;
-            coordinates[519] = 0.25;
-            coordinates[520] = 0.083333333333299994;
-            coordinates[521] = 0.083333333333299994;
-            coordinates[522] = 0.083333333333299994;
-            coordinates[523] = 0.083333333333299994;
-            coordinates[524] = 0.083333333333299994;
-            coordinates[525] = 0.10000000000000001;
-            coordinates[526] = 0.10000000000000001;
-            coordinates[527] = 0.69999999999999996;
-            coordinates[528] = 0.10000000000000001;
-            coordinates[529] = 0.29999999999999999;
-            coordinates[530] = 0.5;
-            coordinates[531] = 0.10000000000000001;
-            coordinates[532] = 0.5;
-            coordinates[533] = 0.29999999999999999;
-            coordinates[534] = 0.10000000000000001;
-            coordinates[535] = 0.69999999999999996;
-            coordinates[536] = 0.10000000000000001;
-            coordinates[537] = 0.29999999999999999;
-            coordinates[538] = 0.10000000000000001;
-            coordinates[539] = 0.5;
-            coordinates[540] = 0.29999999999999999;
-            coordinates[541] = 0.29999999999999999;
-            coordinates[542] = 0.29999999999999999;
-            coordinates[543] = 0.29999999999999999;
-            coordinates[544] = 0.5;
-            coordinates[545] = 0.10000000000000001;
-            coordinates[546] = 0.5;
-            coordinates[547] = 0.10000000000000001;
-            coordinates[548] = 0.29999999999999999;
-            coordinates[549] = 0.5;
-            coordinates[550] = 0.29999999999999999;
-            coordinates[551] = 0.10000000000000001;
-            coordinates[552] = 0.69999999999999996;
-            coordinates[553] = 0.10000000000000001;
-            coordinates[554] = 0.10000000000000001;
-            coordinates[555] = 0.10000000000000001;
-            coordinates[556] = 0.10000000000000001;
-            coordinates[557] = 0.5;
-            coordinates[558] = 0.10000000000000001;
-            coordinates[559] = 0.29999999999999999;
-            coordinates[560] = 0.29999999999999999;
-            coordinates[561] = 0.10000000000000001;
-            coordinates[562] = 0.5;
-            coordinates[563] = 0.10000000000000001;
-            coordinates[564] = 0.29999999999999999;
-            coordinates[565] = 0.10000000000000001;
-            coordinates[566] = 0.29999999999999999;
-            coordinates[567] = 0.29999999999999999;
-            coordinates[568] = 0.29999999999999999;
-            coordinates[569] = 0.10000000000000001;
-            coordinates[570] = 0.5;
-            coordinates[571] = 0.10000000000000001;
-            coordinates[572] = 0.10000000000000001;
-            coordinates[573] = 0.10000000000000001;
-            coordinates[574] = 0.10000000000000001;
-            coordinates[575] = 0.29999999999999999;
-            coordinates[576] = 0.10000000000000001;
-            coordinates[577] = 0.29999999999999999;
-            coordinates[578] = 0.10000000000000001;
-            coordinates[579] = 0.29999999999999999;
-            coordinates[580] = 0.10000000000000001;
-            coordinates[581] = 0.10000000000000001;
-            coordinates[582] = 0.10000000000000001;
-            coordinates[583] = 0.10000000000000001;
-            coordinates[584] = 0.10000000000000001;
-            coordinates[585] = 0.125;
-            coordinates[586] = 0.125;
-            coordinates[587] = 0.625;
-            coordinates[588] = 0.125;
-            coordinates[589] = 0.375;
-            coordinates[590] = 0.375;
-            coordinates[591] = 0.125;
-            coordinates[592] = 0.625;
-            coordinates[593] = 0.125;
-            coordinates[594] = 0.375;
-            coordinates[595] = 0.125;
-            coordinates[596] = 0.375;
-            coordinates[597] = 0.375;
-            coordinates[598] = 0.375;
-            coordinates[599] = 0.125;
-            coordinates[600] = 0.625;
-            coordinates[601] = 0.125;
-            coordinates[602] = 0.125;
-            coordinates[603] = 0.125;
-            coordinates[604] = 0.125;
-            coordinates[605] = 0.375;
-            coordinates[606] = 0.125;
-            coordinates[607] = 0.375;
-            coordinates[608] = 0.125;
-            coordinates[609] = 0.375;
-            coordinates[610] = 0.125;
-            coordinates[611] = 0.125;
-            coordinates[612] = 0.125;
-            coordinates[613] = 0.125;
-            coordinates[614] = 0.125;
-            coordinates[615] = 0.166666666667;
-            coordinates[616] = 0.166666666667;
-            coordinates[617] = 0.5;
-            coordinates[618] = 0.166666666667;
-            coordinates[619] = 0.5;
-            coordinates[620] = 0.166666666667;
-            coordinates[621] = 0.5;
-            coordinates[622] = 0.166666666667;
-            coordinates[623] = 0.166666666667;
-            coordinates[624] = 0.166666666667;
-            coordinates[625] = 0.166666666667;
-            coordinates[626] = 0.166666666667;
-            coordinates[627] = 0.25;
-            coordinates[628] = 0.25;
-            coordinates[629] = 0.25;
-
-            weights[0] = 0.052550909016500003;
-            weights[1] = 0.052550909016500003;
-            weights[2] = 0.052550909016500003;
-            weights[3] = 0.052550909016500003;
-            weights[4] = 0.052550909016500003;
-            weights[5] = 0.052550909016500003;
-            weights[6] = 0.052550909016500003;
-            weights[7] = 0.052550909016500003;
-            weights[8] = 0.052550909016500003;
-            weights[9] = 0.052550909016500003;
-            weights[10] = 0.052550909016500003;
-            weights[11] = 0.052550909016500003;
-            weights[12] = 0.052550909016500003;
-            weights[13] = 0.052550909016500003;
-            weights[14] = 0.052550909016500003;
-            weights[15] = 0.052550909016500003;
-            weights[16] = 0.052550909016500003;
-            weights[17] = 0.052550909016500003;
-            weights[18] = 0.052550909016500003;
-            weights[19] = 0.052550909016500003;
-            weights[20] = 0.052550909016500003;
-            weights[21] = 0.052550909016500003;
-            weights[22] = 0.052550909016500003;
-            weights[23] = 0.052550909016500003;
-            weights[24] = 0.052550909016500003;
-            weights[25] = 0.052550909016500003;
-            weights[26] = 0.052550909016500003;
-            weights[27] = 0.052550909016500003;
-            weights[28] = 0.052550909016500003;
-            weights[29] = 0.052550909016500003;
-            weights[30] = 0.052550909016500003;
-            weights[31] = 0.052550909016500003;
-            weights[32] = 0.052550909016500003;
-            weights[33] = 0.052550909016500003;
-            weights[34] = 0.052550909016500003;
-            weights[35] = 0.052550909016500003;
-            weights[36] = 0.052550909016500003;
-            weights[37] = 0.052550909016500003;
-            weights[38] = 0.052550909016500003;
-            weights[39] = 0.052550909016500003;
-            weights[40] = 0.052550909016500003;
-            weights[41] = 0.052550909016500003;
-            weights[42] = 0.052550909016500003;
-            weights[43] = 0.052550909016500003;
-            weights[44] = 0.052550909016500003;
-            weights[45] = 0.052550909016500003;
-            weights[46] = 0.052550909016500003;
-            weights[47] = 0.052550909016500003;
-            weights[48] = 0.052550909016500003;
-            weights[49] = 0.052550909016500003;
-            weights[50] = 0.052550909016500003;
-            weights[51] = 0.052550909016500003;
-            weights[52] = 0.052550909016500003;
-            weights[53] = 0.052550909016500003;
-            weights[54] = 0.052550909016500003;
-            weights[55] = 0.052550909016500003;
-            weights[56] = 0.052550909016500003;
-            weights[57] = 0.052550909016500003;
-            weights[58] = 0.052550909016500003;
-            weights[59] = 0.052550909016500003;
-            weights[60] = 0.052550909016500003;
-            weights[61] = 0.052550909016500003;
-            weights[62] = 0.052550909016500003;
-            weights[63] = 0.052550909016500003;
-            weights[64] = 0.052550909016500003;
-            weights[65] = 0.052550909016500003;
-            weights[66] = 0.052550909016500003;
-            weights[67] = 0.052550909016500003;
-            weights[68] = 0.052550909016500003;
-            weights[69] = 0.052550909016500003;
-            weights[70] = 0.052550909016500003;
-            weights[71] = 0.052550909016500003;
-            weights[72] = 0.052550909016500003;
-            weights[73] = 0.052550909016500003;
-            weights[74] = 0.052550909016500003;
-            weights[75] = 0.052550909016500003;
-            weights[76] = 0.052550909016500003;
-            weights[77] = 0.052550909016500003;
-            weights[78] = 0.052550909016500003;
-            weights[79] = 0.052550909016500003;
-            weights[80] = 0.052550909016500003;
-            weights[81] = 0.052550909016500003;
-            weights[82] = 0.052550909016500003;
-            weights[83] = 0.052550909016500003;
-            weights[84] = -0.148185225279333;
-            weights[85] = -0.148185225279333;
-            weights[86] = -0.148185225279333;
-            weights[87] = -0.148185225279333;
-            weights[88] = -0.148185225279333;
-            weights[89] = -0.148185225279333;
-            weights[90] = -0.148185225279333;
-            weights[91] = -0.148185225279333;
-            weights[92] = -0.148185225279333;
-            weights[93] = -0.148185225279333;
-            weights[94] = -0.148185225279333;
-            weights[95] = -0.148185225279333;
-            weights[96] = -0.148185225279333;
-            weights[97] = -0.148185225279333;
-            weights[98] = -0.148185225279333;
-            weights[99] = -0.148185225279333;
-            weights[100] = -0.148185225279333;
-            weights[101] = -0.148185225279333;
-            weights[102] = -0.148185225279333;
-            weights[103] = -0.148185225279333;
-            weights[104] = -0.148185225279333;
-            weights[105] = -0.148185225279333;
-            weights[106] = -0.148185225279333;
-            weights[107] = -0.148185225279333;
-            weights[108] = -0.148185225279333;
-            weights[109] = -0.148185225279333;
-            weights[110] = -0.148185225279333;
-            weights[111] = -0.148185225279333;
-            weights[112] = -0.148185225279333;
-            weights[113] = -0.148185225279333;
-            weights[114] = -0.148185225279333;
-            weights[115] = -0.148185225279333;
-            weights[116] = -0.148185225279333;
-            weights[117] = -0.148185225279333;
-            weights[118] = -0.148185225279333;
-            weights[119] = -0.148185225279333;
-            weights[120] = -0.148185225279333;
-            weights[121] = -0.148185225279333;
-            weights[122] = -0.148185225279333;
-            weights[123] = -0.148185225279333;
-            weights[124] = -0.148185225279333;
-            weights[125] = -0.148185225279333;
-            weights[126] = -0.148185225279333;
-            weights[127] = -0.148185225279333;
-            weights[128] = -0.148185225279333;
-            weights[129] = -0.148185225279333;
-            weights[130] = -0.148185225279333;
-            weights[131] = -0.148185225279333;
-            weights[132] = -0.148185225279333;
-            weights[133] = -0.148185225279333;
-            weights[134] = -0.148185225279333;
-            weights[135] = -0.148185225279333;
-            weights[136] = -0.148185225279333;
-            weights[137] = -0.148185225279333;
-            weights[138] = -0.148185225279333;
-            weights[139] = -0.148185225279333;
-            weights[140] = 0.149815898387333;
-            weights[141] = 0.149815898387333;
-            weights[142] = 0.149815898387333;
-            weights[143] = 0.149815898387333;
-            weights[144] = 0.149815898387333;
-            weights[145] = 0.149815898387333;
-            weights[146] = 0.149815898387333;
-            weights[147] = 0.149815898387333;
-            weights[148] = 0.149815898387333;
-            weights[149] = 0.149815898387333;
-            weights[150] = 0.149815898387333;
-            weights[151] = 0.149815898387333;
-            weights[152] = 0.149815898387333;
-            weights[153] = 0.149815898387333;
-            weights[154] = 0.149815898387333;
-            weights[155] = 0.149815898387333;
-            weights[156] = 0.149815898387333;
-            weights[157] = 0.149815898387333;
-            weights[158] = 0.149815898387333;
-            weights[159] = 0.149815898387333;
-            weights[160] = 0.149815898387333;
-            weights[161] = 0.149815898387333;
-            weights[162] = 0.149815898387333;
-            weights[163] = 0.149815898387333;
-            weights[164] = 0.149815898387333;
-            weights[165] = 0.149815898387333;
-            weights[166] = 0.149815898387333;
-            weights[167] = 0.149815898387333;
-            weights[168] = 0.149815898387333;
-            weights[169] = 0.149815898387333;
-            weights[170] = 0.149815898387333;
-            weights[171] = 0.149815898387333;
-            weights[172] = 0.149815898387333;
-            weights[173] = 0.149815898387333;
-            weights[174] = 0.149815898387333;
-            weights[175] = -0.065344416653666998;
-            weights[176] = -0.065344416653666998;
-            weights[177] = -0.065344416653666998;
-            weights[178] = -0.065344416653666998;
-            weights[179] = -0.065344416653666998;
-            weights[180] = -0.065344416653666998;
-            weights[181] = -0.065344416653666998;
-            weights[182] = -0.065344416653666998;
-            weights[183] = -0.065344416653666998;
-            weights[184] = -0.065344416653666998;
-            weights[185] = -0.065344416653666998;
-            weights[186] = -0.065344416653666998;
-            weights[187] = -0.065344416653666998;
-            weights[188] = -0.065344416653666998;
-            weights[189] = -0.065344416653666998;
-            weights[190] = -0.065344416653666998;
-            weights[191] = -0.065344416653666998;
-            weights[192] = -0.065344416653666998;
-            weights[193] = -0.065344416653666998;
-            weights[194] = -0.065344416653666998;
-            weights[195] = 0.011675128712167001;
-            weights[196] = 0.011675128712167001;
-            weights[197] = 0.011675128712167001;
-            weights[198] = 0.011675128712167001;
-            weights[199] = 0.011675128712167001;
-            weights[200] = 0.011675128712167001;
-            weights[201] = 0.011675128712167001;
-            weights[202] = 0.011675128712167001;
-            weights[203] = 0.011675128712167001;
-            weights[204] = 0.011675128712167001;
-            weights[205] = -0.00066568587662299995;
-            weights[206] = -0.00066568587662299995;
-            weights[207] = -0.00066568587662299995;
-            weights[208] = -0.00066568587662299995;
-            weights[209] = 6.2708210859999998e-06;
-
+            coordinates.assign(gpcoordinates12, gpcoordinates12+3*210);
+            weights.assign(gpweights12, gpweights12+210);
             break;
-
         case 14: case 15:
-            
-            coordinates.resize(330*3);
-            weights.resize(330);
-
-            coordinates[0] = 0.055555555555600003;
-            coordinates[1] = 0.055555555555600003;
-            coordinates[2] = 0.83333333333299997;
-            coordinates[3] = 0.055555555555600003;
-            coordinates[4] = 0.166666666667;
-            coordinates[5] = 0.72222222222200005;
-            coordinates[6] = 0.055555555555600003;
-            coordinates[7] = 0.277777777778;
-            coordinates[8] = 0.61111111111100003;
-            coordinates[9] = 0.055555555555600003;
-            coordinates[10] = 0.38888888888899997;
-            coordinates[11] = 0.5;
-            coordinates[12] = 0.055555555555600003;
-            coordinates[13] = 0.5;
-            coordinates[14] = 0.38888888888899997;
-            coordinates[15] = 0.055555555555600003;
-            coordinates[16] = 0.61111111111100003;
-            coordinates[17] = 0.277777777778;
-            coordinates[18] = 0.055555555555600003;
-            coordinates[19] = 0.72222222222200005;
-            coordinates[20] = 0.166666666667;
-            coordinates[21] = 0.055555555555600003;
-            coordinates[22] = 0.83333333333299997;
-            coordinates[23] = 0.055555555555600003;
-            coordinates[24] = 0.166666666667;
-            coordinates[25] = 0.055555555555600003;
-            coordinates[26] = 0.72222222222200005;
-            coordinates[27] = 0.166666666667;
-            coordinates[28] = 0.166666666667;
-            coordinates[29] = 0.61111111111100003;
-            coordinates[30] = 0.166666666667;
-            coordinates[31] = 0.277777777778;
-            coordinates[32] = 0.5;
-            coordinates[33] = 0.166666666667;
-            coordinates[34] = 0.38888888888899997;
-            coordinates[35] = 0.38888888888899997;
-            coordinates[36] = 0.166666666667;
-            coordinates[37] = 0.5;
-            coordinates[38] = 0.277777777778;
-            coordinates[39] = 0.166666666667;
-            coordinates[40] = 0.61111111111100003;
-            coordinates[41] = 0.166666666667;
-            coordinates[42] = 0.166666666667;
-            coordinates[43] = 0.72222222222200005;
-            coordinates[44] = 0.055555555555600003;
-            coordinates[45] = 0.277777777778;
-            coordinates[46] = 0.055555555555600003;
-            coordinates[47] = 0.61111111111100003;
-            coordinates[48] = 0.277777777778;
-            coordinates[49] = 0.166666666667;
-            coordinates[50] = 0.5;
-            coordinates[51] = 0.277777777778;
-            coordinates[52] = 0.277777777778;
-            coordinates[53] = 0.38888888888899997;
-            coordinates[54] = 0.277777777778;
-            coordinates[55] = 0.38888888888899997;
-            coordinates[56] = 0.277777777778;
-            coordinates[57] = 0.277777777778;
-            coordinates[58] = 0.5;
-            coordinates[59] = 0.166666666667;
-            coordinates[60] = 0.277777777778;
-            coordinates[61] = 0.61111111111100003;
-            coordinates[62] = 0.055555555555600003;
-            coordinates[63] = 0.38888888888899997;
-            coordinates[64] = 0.055555555555600003;
-            coordinates[65] = 0.5;
-            coordinates[66] = 0.38888888888899997;
-            coordinates[67] = 0.166666666667;
-            coordinates[68] = 0.38888888888899997;
-            coordinates[69] = 0.38888888888899997;
-            coordinates[70] = 0.277777777778;
-            coordinates[71] = 0.277777777778;
-            coordinates[72] = 0.38888888888899997;
-            coordinates[73] = 0.38888888888899997;
-            coordinates[74] = 0.166666666667;
-            coordinates[75] = 0.38888888888899997;
-            coordinates[76] = 0.5;
-            coordinates[77] = 0.055555555555600003;
-            coordinates[78] = 0.5;
-            coordinates[79] = 0.055555555555600003;
-            coordinates[80] = 0.38888888888899997;
-            coordinates[81] = 0.5;
-            coordinates[82] = 0.166666666667;
-            coordinates[83] = 0.277777777778;
-            coordinates[84] = 0.5;
-            coordinates[85] = 0.277777777778;
-            coordinates[86] = 0.166666666667;
-            coordinates[87] = 0.5;
-            coordinates[88] = 0.38888888888899997;
-            coordinates[89] = 0.055555555555600003;
-            coordinates[90] = 0.61111111111100003;
-            coordinates[91] = 0.055555555555600003;
-            coordinates[92] = 0.277777777778;
-            coordinates[93] = 0.61111111111100003;
-            coordinates[94] = 0.166666666667;
-            coordinates[95] = 0.166666666667;
-            coordinates[96] = 0.61111111111100003;
-            coordinates[97] = 0.277777777778;
-            coordinates[98] = 0.055555555555600003;
-            coordinates[99] = 0.72222222222200005;
-            coordinates[100] = 0.055555555555600003;
-            coordinates[101] = 0.166666666667;
-            coordinates[102] = 0.72222222222200005;
-            coordinates[103] = 0.166666666667;
-            coordinates[104] = 0.055555555555600003;
-            coordinates[105] = 0.83333333333299997;
-            coordinates[106] = 0.055555555555600003;
-            coordinates[107] = 0.055555555555600003;
-            coordinates[108] = 0.055555555555600003;
-            coordinates[109] = 0.055555555555600003;
-            coordinates[110] = 0.72222222222200005;
-            coordinates[111] = 0.055555555555600003;
-            coordinates[112] = 0.166666666667;
-            coordinates[113] = 0.61111111111100003;
-            coordinates[114] = 0.055555555555600003;
-            coordinates[115] = 0.277777777778;
-            coordinates[116] = 0.5;
-            coordinates[117] = 0.055555555555600003;
-            coordinates[118] = 0.38888888888899997;
-            coordinates[119] = 0.38888888888899997;
-            coordinates[120] = 0.055555555555600003;
-            coordinates[121] = 0.5;
-            coordinates[122] = 0.277777777778;
-            coordinates[123] = 0.055555555555600003;
-            coordinates[124] = 0.61111111111100003;
-            coordinates[125] = 0.166666666667;
-            coordinates[126] = 0.055555555555600003;
-            coordinates[127] = 0.72222222222200005;
-            coordinates[128] = 0.055555555555600003;
-            coordinates[129] = 0.166666666667;
-            coordinates[130] = 0.055555555555600003;
-            coordinates[131] = 0.61111111111100003;
-            coordinates[132] = 0.166666666667;
-            coordinates[133] = 0.166666666667;
-            coordinates[134] = 0.5;
-            coordinates[135] = 0.166666666667;
-            coordinates[136] = 0.277777777778;
-            coordinates[137] = 0.38888888888899997;
-            coordinates[138] = 0.166666666667;
-            coordinates[139] = 0.38888888888899997;
-            coordinates[140] = 0.277777777778;
-            coordinates[141] = 0.166666666667;
-            coordinates[142] = 0.5;
-            coordinates[143] = 0.166666666667;
-            coordinates[144] = 0.166666666667;
-            coordinates[145] = 0.61111111111100003;
-            coordinates[146] = 0.055555555555600003;
-            coordinates[147] = 0.277777777778;
-            coordinates[148] = 0.055555555555600003;
-            coordinates[149] = 0.5;
-            coordinates[150] = 0.277777777778;
-            coordinates[151] = 0.166666666667;
-            coordinates[152] = 0.38888888888899997;
-            coordinates[153] = 0.277777777778;
-            coordinates[154] = 0.277777777778;
-            coordinates[155] = 0.277777777778;
-            coordinates[156] = 0.277777777778;
-            coordinates[157] = 0.38888888888899997;
-            coordinates[158] = 0.166666666667;
-            coordinates[159] = 0.277777777778;
-            coordinates[160] = 0.5;
-            coordinates[161] = 0.055555555555600003;
-            coordinates[162] = 0.38888888888899997;
-            coordinates[163] = 0.055555555555600003;
-            coordinates[164] = 0.38888888888899997;
-            coordinates[165] = 0.38888888888899997;
-            coordinates[166] = 0.166666666667;
-            coordinates[167] = 0.277777777778;
-            coordinates[168] = 0.38888888888899997;
-            coordinates[169] = 0.277777777778;
-            coordinates[170] = 0.166666666667;
-            coordinates[171] = 0.38888888888899997;
-            coordinates[172] = 0.38888888888899997;
-            coordinates[173] = 0.055555555555600003;
-            coordinates[174] = 0.5;
-            coordinates[175] = 0.055555555555600003;
-            coordinates[176] = 0.277777777778;
-            coordinates[177] = 0.5;
-            coordinates[178] = 0.166666666667;
-            coordinates[179] = 0.166666666667;
-            coordinates[180] = 0.5;
-            coordinates[181] = 0.277777777778;
-            coordinates[182] = 0.055555555555600003;
-            coordinates[183] = 0.61111111111100003;
-            coordinates[184] = 0.055555555555600003;
-            coordinates[185] = 0.166666666667;
-            coordinates[186] = 0.61111111111100003;
-            coordinates[187] = 0.166666666667;
-            coordinates[188] = 0.055555555555600003;
-            coordinates[189] = 0.72222222222200005;
-            coordinates[190] = 0.055555555555600003;
-            coordinates[191] = 0.055555555555600003;
-            coordinates[192] = 0.055555555555600003;
-            coordinates[193] = 0.055555555555600003;
-            coordinates[194] = 0.61111111111100003;
-            coordinates[195] = 0.055555555555600003;
-            coordinates[196] = 0.166666666667;
-            coordinates[197] = 0.5;
-            coordinates[198] = 0.055555555555600003;
-            coordinates[199] = 0.277777777778;
-            coordinates[200] = 0.38888888888899997;
-            coordinates[201] = 0.055555555555600003;
-            coordinates[202] = 0.38888888888899997;
-            coordinates[203] = 0.277777777778;
-            coordinates[204] = 0.055555555555600003;
-            coordinates[205] = 0.5;
-            coordinates[206] = 0.166666666667;
-            coordinates[207] = 0.055555555555600003;
-            coordinates[208] = 0.61111111111100003;
-            coordinates[209] = 0.055555555555600003;
-            coordinates[210] = 0.166666666667;
-            coordinates[211] = 0.055555555555600003;
-            coordinates[212] = 0.5;
-            coordinates[213] = 0.166666666667;
-            coordinates[214] = 0.166666666667;
-            coordinates[215] = 0.38888888888899997;
-            coordinates[216] = 0.166666666667;
-            coordinates[217] = 0.277777777778;
-            coordinates[218] = 0.277777777778;
-            coordinates[219] = 0.166666666667;
-            coordinates[220] = 0.38888888888899997;
-            coordinates[221] = 0.166666666667;
-            coordinates[222] = 0.166666666667;
-            coordinates[223] = 0.5;
-            coordinates[224] = 0.055555555555600003;
-            coordinates[225] = 0.277777777778;
-            coordinates[226] = 0.055555555555600003;
-            coordinates[227] = 0.38888888888899997;
-            coordinates[228] = 0.277777777778;
-            coordinates[229] = 0.166666666667;
-            coordinates[230] = 0.277777777778;
-            coordinates[231] = 0.277777777778;
-            coordinates[232] = 0.277777777778;
-            coordinates[233] = 0.166666666667;
-            coordinates[234] = 0.277777777778;
-            coordinates[235] = 0.38888888888899997;
-            coordinates[236] = 0.055555555555600003;
-            coordinates[237] = 0.38888888888899997;
-            coordinates[238] = 0.055555555555600003;
-            coordinates[239] = 0.277777777778;
-            coordinates[240] = 0.38888888888899997;
-            coordinates[241] = 0.166666666667;
-            coordinates[242] = 0.166666666667;
-            coordinates[243] = 0.38888888888899997;
-            coordinates[244] = 0.277777777778;
-            coordinates[245] = 0.055555555555600003;
-            coordinates[246] = 0.5;
-            coordinates[247] = 0.055555555555600003;
-            coordinates[248] = 0.166666666667;
-            coordinates[249] = 0.5;
-            coordinates[250] = 0.166666666667;
-            coordinates[251] = 0.055555555555600003;
-            coordinates[252] = 0.61111111111100003;
-            coordinates[253] = 0.055555555555600003;
-            coordinates[254] = 0.055555555555600003;
-            coordinates[255] = 0.055555555555600003;
-            coordinates[256] = 0.055555555555600003;
-            coordinates[257] = 0.5;
-            coordinates[258] = 0.055555555555600003;
-            coordinates[259] = 0.166666666667;
-            coordinates[260] = 0.38888888888899997;
-            coordinates[261] = 0.055555555555600003;
-            coordinates[262] = 0.277777777778;
-            coordinates[263] = 0.277777777778;
-            coordinates[264] = 0.055555555555600003;
-            coordinates[265] = 0.38888888888899997;
-            coordinates[266] = 0.166666666667;
-            coordinates[267] = 0.055555555555600003;
-            coordinates[268] = 0.5;
-            coordinates[269] = 0.055555555555600003;
-            coordinates[270] = 0.166666666667;
-            coordinates[271] = 0.055555555555600003;
-            coordinates[272] = 0.38888888888899997;
-            coordinates[273] = 0.166666666667;
-            coordinates[274] = 0.166666666667;
-            coordinates[275] = 0.277777777778;
-            coordinates[276] = 0.166666666667;
-            coordinates[277] = 0.277777777778;
-            coordinates[278] = 0.166666666667;
-            coordinates[279] = 0.166666666667;
-            coordinates[280] = 0.38888888888899997;
-            coordinates[281] = 0.055555555555600003;
-            coordinates[282] = 0.277777777778;
-            coordinates[283] = 0.055555555555600003;
-            coordinates[284] = 0.277777777778;
-            coordinates[285] = 0.277777777778;
-            coordinates[286] = 0.166666666667;
-            coordinates[287] = 0.166666666667;
-            coordinates[288] = 0.277777777778;
-            coordinates[289] = 0.277777777778;
-            coordinates[290] = 0.055555555555600003;
-            coordinates[291] = 0.38888888888899997;
-            coordinates[292] = 0.055555555555600003;
-            coordinates[293] = 0.166666666667;
-            coordinates[294] = 0.38888888888899997;
-            coordinates[295] = 0.166666666667;
-            coordinates[296] = 0.055555555555600003;
-            coordinates[297] = 0.5;
-            coordinates[298] = 0.055555555555600003;
-            coordinates[299] = 0.055555555555600003;
-            coordinates[300] = 0.055555555555600003;
-            coordinates[301] = 0.055555555555600003;
-            coordinates[302] = 0.38888888888899997;
-            coordinates[303] = 0.055555555555600003;
-            coordinates[304] = 0.166666666667;
-            coordinates[305] = 0.277777777778;
-            coordinates[306] = 0.055555555555600003;
-            coordinates[307] = 0.277777777778;
-            coordinates[308] = 0.166666666667;
-            coordinates[309] = 0.055555555555600003;
-            coordinates[310] = 0.38888888888899997;
-            coordinates[311] = 0.055555555555600003;
-            coordinates[312] = 0.166666666667;
-            coordinates[313] = 0.055555555555600003;
-            coordinates[314] = 0.277777777778;
-            coordinates[315] = 0.166666666667;
-            coordinates[316] = 0.166666666667;
-            coordinates[317] = 0.166666666667;
-            coordinates[318] = 0.166666666667;
-            coordinates[319] = 0.277777777778;
-            coordinates[320] = 0.055555555555600003;
-            coordinates[321] = 0.277777777778;
-            coordinates[322] = 0.055555555555600003;
-            coordinates[323] = 0.166666666667;
-            coordinates[324] = 0.277777777778;
-            coordinates[325] = 0.166666666667;
-            coordinates[326] = 0.055555555555600003;
-            coordinates[327] = 0.38888888888899997;
-            coordinates[328] = 0.055555555555600003;
-            coordinates[329] = 0.055555555555600003;
-            coordinates[330] = 0.055555555555600003;
-            coordinates[331] = 0.055555555555600003;
-            coordinates[332] = 0.277777777778;
-            coordinates[333] = 0.055555555555600003;
-            coordinates[334] = 0.166666666667;
-            coordinates[335] = 0.166666666667;
-            coordinates[336] = 0.055555555555600003;
-            coordinates[337] = 0.277777777778;
-            coordinates[338] = 0.055555555555600003;
-            coordinates[339] = 0.166666666667;
-            coordinates[340] = 0.055555555555600003;
-            coordinates[341] = 0.166666666667;
-            coordinates[342] = 0.166666666667;
-            coordinates[343] = 0.166666666667;
-            coordinates[344] = 0.055555555555600003;
-            coordinates[345] = 0.277777777778;
-            coordinates[346] = 0.055555555555600003;
-            coordinates[347] = 0.055555555555600003;
-            coordinates[348] = 0.055555555555600003;
-            coordinates[349] = 0.055555555555600003;
-            coordinates[350] = 0.166666666667;
-            coordinates[351] = 0.055555555555600003;
-            coordinates[352] = 0.166666666667;
-            coordinates[353] = 0.055555555555600003;
-            coordinates[354] = 0.166666666667;
-            coordinates[355] = 0.055555555555600003;
-            coordinates[356] = 0.055555555555600003;
-            coordinates[357] = 0.055555555555600003;
-            coordinates[358] = 0.055555555555600003;
-            coordinates[359] = 0.055555555555600003;
-            coordinates[360] = 0.0625;
-            coordinates[361] = 0.0625;
-            coordinates[362] = 0.8125;
-            coordinates[363] = 0.0625;
-            coordinates[364] = 0.1875;
-            coordinates[365] = 0.6875;
-            coordinates[366] = 0.0625;
-            coordinates[367] = 0.3125;
-            coordinates[368] = 0.5625;
-            coordinates[369] = 0.0625;
-            coordinates[370] = 0.4375;
-            coordinates[371] = 0.4375;
-            coordinates[372] = 0.0625;
-            coordinates[373] = 0.5625;
-            coordinates[374] = 0.3125;
-            coordinates[375] = 0.0625;
-            coordinates[376] = 0.6875;
-            coordinates[377] = 0.1875;
-            coordinates[378] = 0.0625;
-            coordinates[379] = 0.8125;
-            coordinates[380] = 0.0625;
-            coordinates[381] = 0.1875;
-            coordinates[382] = 0.0625;
-            coordinates[383] = 0.6875;
-            coordinates[384] = 0.1875;
-            coordinates[385] = 0.1875;
-            coordinates[386] = 0.5625;
-            coordinates[387] = 0.1875;
-            coordinates[388] = 0.3125;
-            coordinates[389] = 0.4375;
-            coordinates[390] = 0.1875;
-            coordinates[391] = 0.4375;
-            coordinates[392] = 0.3125;
-            coordinates[393] = 0.1875;
-            coordinates[394] = 0.5625;
-            coordinates[395] = 0.1875;
-            coordinates[396] = 0.1875;
-            coordinates[397] = 0.6875;
-            coordinates[398] = 0.0625;
-            coordinates[399] = 0.3125;
-            coordinates[400] = 0.0625;
-            coordinates[401] = 0.5625;
-            coordinates[402] = 0.3125;
-            coordinates[403] = 0.1875;
-            coordinates[404] = 0.4375;
-            coordinates[405] = 0.3125;
-            coordinates[406] = 0.3125;
-            coordinates[407] = 0.3125;
-            coordinates[408] = 0.3125;
-            coordinates[409] = 0.4375;
-            coordinates[410] = 0.1875;
-            coordinates[411] = 0.3125;
-            coordinates[412] = 0.5625;
-            coordinates[413] = 0.0625;
-            coordinates[414] = 0.4375;
-            coordinates[415] = 0.0625;
-            coordinates[416] = 0.4375;
-            coordinates[417] = 0.4375;
-            coordinates[418] = 0.1875;
-            coordinates[419] = 0.3125;
-            coordinates[420] = 0.4375;
-            coordinates[421] = 0.3125;
-            coordinates[422] = 0.1875;
-            coordinates[423] = 0.4375;
-            coordinates[424] = 0.4375;
-            coordinates[425] = 0.0625;
-            coordinates[426] = 0.5625;
-            coordinates[427] = 0.0625;
-            coordinates[428] = 0.3125;
-            coordinates[429] = 0.5625;
-            coordinates[430] = 0.1875;
-            coordinates[431] = 0.1875;
-            coordinates[432] = 0.5625;
-            coordinates[433] = 0.3125;
-            coordinates[434] = 0.0625;
-            coordinates[435] = 0.6875;
-            coordinates[436] = 0.0625;
-            coordinates[437] = 0.1875;
-            coordinates[438] = 0.6875;
-            coordinates[439] = 0.1875;
-            coordinates[440] = 0.0625;
-            coordinates[441] = 0.8125;
-            coordinates[442] = 0.0625;
-            coordinates[443] = 0.0625;
-            coordinates[444] = 0.0625;
-            coordinates[445] = 0.0625;
-            coordinates[446] = 0.6875;
-            coordinates[447] = 0.0625;
-            coordinates[448] = 0.1875;
-            coordinates[449] = 0.5625;
-            coordinates[450] = 0.0625;
-            coordinates[451] = 0.3125;
-            coordinates[452] = 0.4375;
-            coordinates[453] = 0.0625;
-            coordinates[454] = 0.4375;
-            coordinates[455] = 0.3125;
-            coordinates[456] = 0.0625;
-            coordinates[457] = 0.5625;
-            coordinates[458] = 0.1875;
-            coordinates[459] = 0.0625;
-            coordinates[460] = 0.6875;
-            coordinates[461] = 0.0625;
-            coordinates[462] = 0.1875;
-            coordinates[463] = 0.0625;
-            coordinates[464] = 0.5625;
-            coordinates[465] = 0.1875;
-            coordinates[466] = 0.1875;
-            coordinates[467] = 0.4375;
-            coordinates[468] = 0.1875;
-            coordinates[469] = 0.3125;
-            coordinates[470] = 0.3125;
-            coordinates[471] = 0.1875;
-            coordinates[472] = 0.4375;
-            coordinates[473] = 0.1875;
-            coordinates[474] = 0.1875;
-            coordinates[475] = 0.5625;
-            coordinates[476] = 0.0625;
-            coordinates[477] = 0.3125;
-            coordinates[478] = 0.0625;
-            coordinates[479] = 0.4375;
-            coordinates[480] = 0.3125;
-            coordinates[481] = 0.1875;
-            coordinates[482] = 0.3125;
-            coordinates[483] = 0.3125;
-            coordinates[484] = 0.3125;
-            coordinates[485] = 0.1875;
-            coordinates[486] = 0.3125;
-            coordinates[487] = 0.4375;
-            coordinates[488] = 0.0625;
-            coordinates[489] = 0.4375;
-            coordinates[490] = 0.0625;
-            coordinates[491] = 0.3125;
-            coordinates[492] = 0.4375;
-            coordinates[493] = 0.1875;
-            coordinates[494] = 0.1875;
-            coordinates[495] = 0.4375;
-            coordinates[496] = 0.3125;
-            coordinates[497] = 0.0625;
-            coordinates[498] = 0.5625;
-            coordinates[499] = 0.0625;
-            coordinates[500] = 0.1875;
-            coordinates[501] = 0.5625;
-            coordinates[502] = 0.1875;
-            coordinates[503] = 0.0625;
-            coordinates[504] = 0.6875;
-            coordinates[505] = 0.0625;
-            coordinates[506] = 0.0625;
-            coordinates[507] = 0.0625;
-            coordinates[508] = 0.0625;
-            coordinates[509] = 0.5625;
-            coordinates[510] = 0.0625;
-            coordinates[511] = 0.1875;
-            coordinates[512] = 0.4375;
-            coordinates[513] = 0.0625;
-            coordinates[514] = 0.3125;
-            coordinates[515] = 0.3125;
-            coordinates[516] = 0.0625;
-            coordinates[517] = 0.4375;
-            coordinates[518] = 0.1875;
-            coordinates[519] = 0.0625;
-            coordinates[520] = 0.5625;
-            coordinates[521] = 0.0625;
-            coordinates[522] = 0.1875;
-            coordinates[523] = 0.0625;
-            coordinates[524] = 0.4375;
-            coordinates[525] = 0.1875;
-            coordinates[526] = 0.1875;
-            coordinates[527] = 0.3125;
-            coordinates[528] = 0.1875;
-            coordinates[529] = 0.3125;
-            coordinates[530] = 0.1875;
-            coordinates[531] = 0.1875;
-            coordinates[532] = 0.4375;
-            coordinates[533] = 0.0625;
-            coordinates[534] = 0.3125;
-            coordinates[535] = 0.0625;
-            coordinates[536] = 0.3125;
-            coordinates[537] = 0.3125;
-            coordinates[538] = 0.1875;
-            coordinates[539] = 0.1875;
-            coordinates[540] = 0.3125;
-            coordinates[541] = 0.3125;
-            coordinates[542] = 0.0625;
-            coordinates[543] = 0.4375;
-            coordinates[544] = 0.0625;
-            coordinates[545] = 0.1875;
-            coordinates[546] = 0.4375;
-            coordinates[547] = 0.1875;
-            coordinates[548] = 0.0625;
-            coordinates[549] = 0.5625;
-            coordinates[550] = 0.0625;
-            coordinates[551] = 0.0625;
-            coordinates[552] = 0.0625;
-            coordinates[553] = 0.0625;
-            coordinates[554] = 0.4375;
-            coordinates[555] = 0.0625;
-            coordinates[556] = 0.1875;
-            coordinates[557] = 0.3125;
-            coordinates[558] = 0.0625;
-            coordinates[559] = 0.3125;
-            coordinates[560] = 0.1875;
-            coordinates[561] = 0.0625;
-            coordinates[562] = 0.4375;
-            coordinates[563] = 0.0625;
-            coordinates[564] = 0.1875;
-            coordinates[565] = 0.0625;
-            coordinates[566] = 0.3125;
-            coordinates[567] = 0.1875;
-            coordinates[568] = 0.1875;
-            coordinates[569] = 0.1875;
-            coordinates[570] = 0.1875;
-            coordinates[571] = 0.3125;
-            coordinates[572] = 0.0625;
-            coordinates[573] = 0.3125;
-            coordinates[574] = 0.0625;
-            coordinates[575] = 0.1875;
-            coordinates[576] = 0.3125;
-            coordinates[577] = 0.1875;
-            coordinates[578] = 0.0625;
-            coordinates[579] = 0.4375;
-            coordinates[580] = 0.0625;
-            coordinates[581] = 0.0625;
-            coordinates[582] = 0.0625;
-            coordinates[583] = 0.0625;
-            coordinates[584] = 0.3125;
-            coordinates[585] = 0.0625;
-            coordinates[586] = 0.1875;
-            coordinates[587] = 0.1875;
-            coordinates[588] = 0.0625;
-            coordinates[589] = 0.3125;
-            coordinates[590] = 0.0625;
-            coordinates[591] = 0.1875;
-            coordinates[592] = 0.0625;
-            coordinates[593] = 0.1875;
-            coordinates[594] = 0.1875;
-            coordinates[595] = 0.1875;
-            coordinates[596] = 0.0625;
-            coordinates[597] = 0.3125;
-            coordinates[598] = 0.0625;
-            coordinates[599] = 0.0625;
-            coordinates[600] = 0.0625;
-            coordinates[601] = 0.0625;
-            coordinates[602] = 0.1875;
-            coordinates[603] = 0.0625;
-            coordinates[604] = 0.1875;
-            coordinates[605] = 0.0625;
-            coordinates[606] = 0.1875;
-            coordinates[607] = 0.0625;
-            coordinates[608] = 0.0625;
-            coordinates[609] = 0.0625;
-            coordinates[610] = 0.0625;
-            coordinates[611] = 0.0625;
-            coordinates[612] = 0.071428571428599999;
-            coordinates[613] = 0.071428571428599999;
-            coordinates[614] = 0.78571428571400004;
-            coordinates[615] = 0.071428571428599999;
-            coordinates[616] = 0.21428571428599999;
-            coordinates[617] = 0.64285714285700002;
-            coordinates[618] = 0.071428571428599999;
-            coordinates[619] = 0.35714285714299998;
-            coordinates[620] = 0.5;
-            coordinates[621] = 0.071428571428599999;
-            coordinates[622] = 0.5;
-            coordinates[623] = 0.35714285714299998;
-            coordinates[624] = 0.071428571428599999;
-            coordinates[625] = 0.64285714285700002;
-            coordinates[626] = 0.21428571428599999;
-            coordinates[627] = 0.071428571428599999;
-            coordinates[628] = 0.78571428571400004;
-            coordinates[629] = 0.071428571428599999;
-            coordinates[630] = 0.21428571428599999;
-            coordinates[631] = 0.071428571428599999;
-            coordinates[632] = 0.64285714285700002;
-            coordinates[633] = 0.21428571428599999;
-            coordinates[634] = 0.21428571428599999;
-            coordinates[635] = 0.5;
-            coordinates[636] = 0.21428571428599999;
-            coordinates[637] = 0.35714285714299998;
-            coordinates[638] = 0.35714285714299998;
-            coordinates[639] = 0.21428571428599999;
-            coordinates[640] = 0.5;
-            coordinates[641] = 0.21428571428599999;
-            coordinates[642] = 0.21428571428599999;
-            coordinates[643] = 0.64285714285700002;
-            coordinates[644] = 0.071428571428599999;
-            coordinates[645] = 0.35714285714299998;
-            coordinates[646] = 0.071428571428599999;
-            coordinates[647] = 0.5;
-            coordinates[648] = 0.35714285714299998;
-            coordinates[649] = 0.21428571428599999;
-            coordinates[650] = 0.35714285714299998;
-            coordinates[651] = 0.35714285714299998;
-            coordinates[652] = 0.35714285714299998;
-            coordinates[653] = 0.21428571428599999;
-            coordinates[654] = 0.35714285714299998;
-            coordinates[655] = 0.5;
-            coordinates[656] = 0.071428571428599999;
-            coordinates[657] = 0.5;
-            coordinates[658] = 0.071428571428599999;
-            coordinates[659] = 0.35714285714299998;
-            coordinates[660] = 0.5;
-            coordinates[661] = 0.21428571428599999;
-            coordinates[662] = 0.21428571428599999;
-            coordinates[663] = 0.5;
-            coordinates[664] = 0.35714285714299998;
-            coordinates[665] = 0.071428571428599999;
-            coordinates[666] = 0.64285714285700002;
-            coordinates[667] = 0.071428571428599999;
-            coordinates[668] = 0.21428571428599999;
-            coordinates[669] = 0.64285714285700002;
-            coordinates[670] = 0.21428571428599999;
-            coordinates[671] = 0.071428571428599999;
-            coordinates[672] = 0.78571428571400004;
-            coordinates[673] = 0.071428571428599999;
-            coordinates[674] = 0.071428571428599999;
-            coordinates[675] = 0.071428571428599999;
-            coordinates[676] = 0.071428571428599999;
-            coordinates[677] = 0.64285714285700002;
-            coordinates[678] = 0.071428571428599999;
-            coordinates[679] = 0.21428571428599999;
-            coordinates[680] = 0.5;
-            coordinates[681] = 0.071428571428599999;
-            coordinates[682] = 0.35714285714299998;
-            coordinates[683] = 0.35714285714299998;
-            coordinates[684] = 0.071428571428599999;
-            coordinates[685] = 0.5;
-            coordinates[686] = 0.21428571428599999;
-            coordinates[687] = 0.071428571428599999;
-            coordinates[688] = 0.64285714285700002;
-            coordinates[689] = 0.071428571428599999;
-            coordinates[690] = 0.21428571428599999;
-            coordinates[691] = 0.071428571428599999;
-            coordinates[692] = 0.5;
-            coordinates[693] = 0.21428571428599999;
-            coordinates[694] = 0.21428571428599999;
-            coordinates[695] = 0.35714285714299998;
-            coordinates[696] = 0.21428571428599999;
-            coordinates[697] = 0.35714285714299998;
-            coordinates[698] = 0.21428571428599999;
-            coordinates[699] = 0.21428571428599999;
-            coordinates[700] = 0.5;
-            coordinates[701] = 0.071428571428599999;
-            coordinates[702] = 0.35714285714299998;
-            coordinates[703] = 0.071428571428599999;
-            coordinates[704] = 0.35714285714299998;
-            coordinates[705] = 0.35714285714299998;
-            coordinates[706] = 0.21428571428599999;
-            coordinates[707] = 0.21428571428599999;
-            coordinates[708] = 0.35714285714299998;
-            coordinates[709] = 0.35714285714299998;
-            coordinates[710] = 0.071428571428599999;
-            coordinates[711] = 0.5;
-            coordinates[712] = 0.071428571428599999;
-            coordinates[713] = 0.21428571428599999;
-            coordinates[714] = 0.5;
-            coordinates[715] = 0.21428571428599999;
-            coordinates[716] = 0.071428571428599999;
-            coordinates[717] = 0.64285714285700002;
-            coordinates[718] = 0.071428571428599999;
-            coordinates[719] = 0.071428571428599999;
-            coordinates[720] = 0.071428571428599999;
-            coordinates[721] = 0.071428571428599999;
-            coordinates[722] = 0.5;
-            coordinates[723] = 0.071428571428599999;
-            coordinates[724] = 0.21428571428599999;
-            coordinates[725] = 0.35714285714299998;
-            coordinates[726] = 0.071428571428599999;
-            coordinates[727] = 0.35714285714299998;
-            coordinates[728] = 0.21428571428599999;
-            coordinates[729] = 0.071428571428599999;
-            coordinates[730] = 0.5;
-            coordinates[731] = 0.071428571428599999;
-            coordinates[732] = 0.21428571428599999;
-            coordinates[733] = 0.071428571428599999;
-            coordinates[734] = 0.35714285714299998;
-            coordinates[735] = 0.21428571428599999;
-            coordinates[736] = 0.21428571428599999;
-            coordinates[737] = 0.21428571428599999;
-            coordinates[738] = 0.21428571428599999;
-            coordinates[739] = 0.35714285714299998;
-            coordinates[740] = 0.071428571428599999;
-            coordinates[741] = 0.35714285714299998;
-            coordinates[742] = 0.071428571428599999;
-            coordinates[743] = 0.21428571428599999;
-            coordinates[744] = 0.35714285714299998;
-            coordinates[745] = 0.21428571428599999;
-            coordinates[746] = 0.071428571428599999;
-            coordinates[747] = 0.5;
-            coordinates[748] = 0.071428571428599999;
-            coordinates[749] = 0.071428571428599999;
-            coordinates[750] = 0.071428571428599999;
-            coordinates[751] = 0.071428571428599999;
-            coordinates[752] = 0.35714285714299998;
-            coordinates[753] = 0.071428571428599999;
-            coordinates[754] = 0.21428571428599999;
-            coordinates[755] = 0.21428571428599999;
-            coordinates[756] = 0.071428571428599999;
-            coordinates[757] = 0.35714285714299998;
-            coordinates[758] = 0.071428571428599999;
-            coordinates[759] = 0.21428571428599999;
-            coordinates[760] = 0.071428571428599999;
-            coordinates[761] = 0.21428571428599999;
-            coordinates[762] = 0.21428571428599999;
-            coordinates[763] = 0.21428571428599999;
-            coordinates[764] = 0.071428571428599999;
-            coordinates[765] = 0.35714285714299998;
-            coordinates[766] = 0.071428571428599999;
-            coordinates[767] = 0.071428571428599999;
-            coordinates[768] = 0.071428571428599999;
-            coordinates[769] = 0.071428571428599999;
-            coordinates[770] = 0.21428571428599999;
-            coordinates[771] = 0.071428571428599999;
-            coordinates[772] = 0.21428571428599999;
-            coordinates[773] = 0.071428571428599999;
-            coordinates[774] = 0.21428571428599999;
-            coordinates[775] = 0.071428571428599999;
-            coordinates[776] = 0.071428571428599999;
-            coordinates[777] = 0.071428571428599999;
-            coordinates[778] = 0.071428571428599999;
-            coordinates[779] = 0.071428571428599999;
-            coordinates[780] = 0.083333333333299994;
-            coordinates[781] = 0.083333333333299994;
-            coordinates[782] = 0.75;
-            coordinates[783] = 0.083333333333299994;
-            coordinates[784] = 0.25;
-            coordinates[785] = 0.58333333333299997;
-            coordinates[786] = 0.083333333333299994;
-            coordinates[787] = 0.41666666666699997;
-            coordinates[788] = 0.41666666666699997;
-            coordinates[789] = 0.083333333333299994;
-            coordinates[790] = 0.58333333333299997;
-            coordinates[791] = 0.25;
-            coordinates[792] = 0.083333333333299994;
-            coordinates[793] = 0.75;
-            coordinates[794] = 0.083333333333299994;
-            coordinates[795] = 0.25;
-            coordinates[796] = 0.083333333333299994;
-            coordinates[797] = 0.58333333333299997;
-            coordinates[798] = 0.25;
-            coordinates[799] = 0.25;
-            coordinates[800] = 0.41666666666699997;
-            coordinates[801] = 0.25;
-            coordinates[802] = 0.41666666666699997;
-            coordinates[803] = 0.25;
-            coordinates[804] = 0.25;
-            coordinates[805] = 0.58333333333299997;
-            coordinates[806] = 0.083333333333299994;
-            coordinates[807] = 0.41666666666699997;
-            coordinates[808] = 0.083333333333299994;
-            coordinates[809] = 0.41666666666699997;
-            coordinates[810] = 0.41666666666699997;
-            coordinates[811] = 0.25;
-            coordinates[812] = 0.25;
-            coordinates[813] = 0.41666666666699997;
-            coordinates[814] = 0.41666666666699997;
-            coordinates[815] = 0.083333333333299994;
-            coordinates[816] = 0.58333333333299997;
-            coordinates[817] = 0.083333333333299994;
-            coordinates[818] = 0.25;
-            coordinates[819] = 0.58333333333299997;
-            coordinates[820] = 0.25;
-            coordinates[821] = 0.083333333333299994;
-            coordinates[822] = 0.75;
-            coordinates[823] = 0.083333333333299994;
-            coordinates[824] = 0.083333333333299994;
-            coordinates[825] = 0.083333333333299994;
-            coordinates[826] = 0.083333333333299994;
-            coordinates[827] = 0.58333333333299997;
-            coordinates[828] = 0.083333333333299994;
-            coordinates[829] = 0.25;
-            coordinates[830] = 0.41666666666699997;
-            coordinates[831] = 0.083333333333299994;
-            coordinates[832] = 0.41666666666699997;
-            coordinates[833] = 0.25;
-            coordinates[834] = 0.083333333333299994;
-            coordinates[835] = 0.58333333333299997;
-            coordinates[836] = 0.083333333333299994;
-            coordinates[837] = 0.25;
-            coordinates[838] = 0.083333333333299994;
-            coordinates[839] = 0.41666666666699997;
-            coordinates[840] = 0.25;
-            coordinates[841] = 0.25;
-            coordinates[842] = 0.25;
-            coordinates[843] = 0.25;
-            coordinates[844] = 0.41666666666699997;
-            coordinates[845] = 0.083333333333299994;
-            coordinates[846] = 0.41666666666699997;
-            coordinates[847] = 0.083333333333299994;
-            coordinates[848] = 0.25;
-            coordinates[849] = 0.41666666666699997;
-            coordinates[850] = 0.25;
-            coordinates[851] = 0.083333333333299994;
-            coordinates[852] = 0.58333333333299997;
-            coordinates[853] = 0.083333333333299994;
-            coordinates[854] = 0.083333333333299994;
-            coordinates[855] = 0.083333333333299994;
-            coordinates[856] = 0.083333333333299994;
-            coordinates[857] = 0.41666666666699997;
-            coordinates[858] = 0.083333333333299994;
-            coordinates[859] = 0.25;
-            coordinates[860] = 0.25;
-            coordinates[861] = 0.083333333333299994;
-            coordinates[862] = 0.41666666666699997;
-            coordinates[863] = 0.083333333333299994;
-            coordinates[864] = 0.25;
-            coordinates[865] = 0.083333333333299994;
-            coordinates[866] = 0.25;
-            coordinates[867] = 0.25;
-            coordinates[868] = 0.25;
-            coordinates[869] = 0.083333333333299994;
-            coordinates[870] = 0.41666666666699997;
-            coordinates[871] = 0.083333333333299994;
-            coordinates[872] = 0.083333333333299994;
-            coordinates[873] = 0.083333333333299994;
-            coordinates[874] = 0.083333333333299994;
-            coordinates[875] = 0.25;
-            coordinates[876] = 0.083333333333299994;
-            coordinates[877] = 0.25;
-            coordinates[878] = 0.083333333333299994;
-            coordinates[879] = 0.25;
-            coordinates[880] = 0.083333333333299994;
-            coordinates[881] = 0.083333333333299994;
-            coordinates[882] = 0.083333333333299994;
-            coordinates[883] = 0.083333333333299994;
-            coordinates[884] = 0.083333333333299994;
-            coordinates[885] = 0.10000000000000001;
-            coordinates[886] = 0.10000000000000001;
-            coordinates[887] = 0.69999999999999996;
-            coordinates[888] = 0.10000000000000001;
-            coordinates[889] = 0.29999999999999999;
-            coordinates[890] = 0.5;
-            coordinates[891] = 0.10000000000000001;
-            coordinates[892] = 0.5;
-            coordinates[893] = 0.29999999999999999;
-            coordinates[894] = 0.10000000000000001;
-            coordinates[895] = 0.69999999999999996;
-            coordinates[896] = 0.10000000000000001;
-            coordinates[897] = 0.29999999999999999;
-            coordinates[898] = 0.10000000000000001;
-            coordinates[899] = 0.5;
-            coordinates[900] = 0.29999999999999999;
-            coordinates[901] = 0.29999999999999999;
-            coordinates[902] = 0.29999999999999999;
-            coordinates[903] = 0.29999999999999999;
-            coordinates[904] = 0.5;
-            coordinates[905] = 0.10000000000000001;
-            coordinates[906] = 0.5;
-            coordinates[907] = 0.10000000000000001;
-            coordinates[908] = 0.29999999999999999;
-            coordinates[909] = 0.5;
-            coordinates[910] = 0.29999999999999999;
-            coordinates[911] = 0.10000000000000001;
-            coordinates[912] = 0.69999999999999996;
-            coordinates[913] = 0.10000000000000001;
-            coordinates[914] = 0.10000000000000001;
-            coordinates[915] = 0.10000000000000001;
-            coordinates[916] = 0.10000000000000001;
-            coordinates[917] = 0.5;
-            coordinates[918] = 0.10000000000000001;
-            coordinates[919] = 0.29999999999999999;
-            coordinates[920] = 0.29999999999999999;
-            coordinates[921] = 0.10000000000000001;
-            coordinates[922] = 0.5;
-            coordinates[923] = 0.10000000000000001;
-            coordinates[924] = 0.29999999999999999;
-            coordinates[925] = 0.10000000000000001;
-            coordinates[926] = 0.29999999999999999;
-            coordinates[927] = 0.29999999999999999;
-            coordinates[928] = 0.29999999999999999;
-            coordinates[929] = 0.10000000000000001;
-            coordinates[930] = 0.5;
-            coordinates[931] = 0.10000000000000001;
-            coordinates[932] = 0.10000000000000001;
-            coordinates[933] = 0.10000000000000001;
-            coordinates[934] = 0.10000000000000001;
-            coordinates[935] = 0.29999999999999999;
-            coordinates[936] = 0.10000000000000001;
-            coordinates[937] = 0.29999999999999999;
-            coordinates[938] = 0.10000000000000001;
-            coordinates[939] = 0.29999999999999999;
-            coordinates[940] = 0.10000000000000001;
-            coordinates[941] = 0.10000000000000001;
-            coordinates[942] = 0.10000000000000001;
-            coordinates[943] = 0.10000000000000001;
-            coordinates[944] = 0.10000000000000001;
-            coordinates[945] = 0.125;
-            coordinates[946] = 0.125;
-            coordinates[947] = 0.625;
-            coordinates[948] = 0.125;
-            coordinates[949] = 0.375;
-            coordinates[950] = 0.375;
-            coordinates[951] = 0.125;
-            coordinates[952] = 0.625;
-            coordinates[953] = 0.125;
-            coordinates[954] = 0.375;
-            coordinates[955] = 0.125;
-            coordinates[956] = 0.375;
-            coordinates[957] = 0.375;
-            coordinates[958] = 0.375;
-            coordinates[959] = 0.125;
-            coordinates[960] = 0.625;
-            coordinates[961] = 0.125;
-            coordinates[962] = 0.125;
-            coordinates[963] = 0.125;
-            coordinates[964] = 0.125;
-            coordinates[965] = 0.375;
-            coordinates[966] = 0.125;
-            coordinates[967] = 0.375;
-            coordinates[968] = 0.125;
-            coordinates[969] = 0.375;
-            coordinates[970] = 0.125;
-            coordinates[971] = 0.125;
-            coordinates[972] = 0.125;
-            coordinates[973] = 0.125;
-            coordinates[974] = 0.125;
-            coordinates[975] = 0.166666666667;
-            coordinates[976] = 0.166666666667;
-            coordinates[977] = 0.5;
-            coordinates[978] = 0.166666666667;
-            coordinates[979] = 0.5;
-            coordinates[980] = 0.166666666667;
-            coordinates[981] = 0.5;
-            coordinates[982] = 0.166666666667;
-            coordinates[983] = 0.166666666667;
-            coordinates[984] = 0.166666666667;
-            coordinates[985] = 0.166666666667;
-            coordinates[986] = 0.166666666667;
-            coordinates[987] = 0.25;
-            coordinates[988] = 0.25;
-            coordinates[989] = 0.25;
-
-            weights[0] = 0.064317124103666995;
-            weights[1] = 0.064317124103666995;
-            weights[2] = 0.064317124103666995;
-            weights[3] = 0.064317124103666995;
-            weights[4] = 0.064317124103666995;
-            weights[5] = 0.064317124103666995;
-            weights[6] = 0.064317124103666995;
-            weights[7] = 0.064317124103666995;
-            weights[8] = 0.064317124103666995;
-            weights[9] = 0.064317124103666995;
-            weights[10] = 0.064317124103666995;
-            weights[11] = 0.064317124103666995;
-            weights[12] = 0.064317124103666995;
-            weights[13] = 0.064317124103666995;
-            weights[14] = 0.064317124103666995;
-            weights[15] = 0.064317124103666995;
-            weights[16] = 0.064317124103666995;
-            weights[17] = 0.064317124103666995;
-            weights[18] = 0.064317124103666995;
-            weights[19] = 0.064317124103666995;
-            weights[20] = 0.064317124103666995;
-            weights[21] = 0.064317124103666995;
-            weights[22] = 0.064317124103666995;
-            weights[23] = 0.064317124103666995;
-            weights[24] = 0.064317124103666995;
-            weights[25] = 0.064317124103666995;
-            weights[26] = 0.064317124103666995;
-            weights[27] = 0.064317124103666995;
-            weights[28] = 0.064317124103666995;
-            weights[29] = 0.064317124103666995;
-            weights[30] = 0.064317124103666995;
-            weights[31] = 0.064317124103666995;
-            weights[32] = 0.064317124103666995;
-            weights[33] = 0.064317124103666995;
-            weights[34] = 0.064317124103666995;
-            weights[35] = 0.064317124103666995;
-            weights[36] = 0.064317124103666995;
-            weights[37] = 0.064317124103666995;
-            weights[38] = 0.064317124103666995;
-            weights[39] = 0.064317124103666995;
-            weights[40] = 0.064317124103666995;
-            weights[41] = 0.064317124103666995;
-            weights[42] = 0.064317124103666995;
-            weights[43] = 0.064317124103666995;
-            weights[44] = 0.064317124103666995;
-            weights[45] = 0.064317124103666995;
-            weights[46] = 0.064317124103666995;
-            weights[47] = 0.064317124103666995;
-            weights[48] = 0.064317124103666995;
-            weights[49] = 0.064317124103666995;
-            weights[50] = 0.064317124103666995;
-            weights[51] = 0.064317124103666995;
-            weights[52] = 0.064317124103666995;
-            weights[53] = 0.064317124103666995;
-            weights[54] = 0.064317124103666995;
-            weights[55] = 0.064317124103666995;
-            weights[56] = 0.064317124103666995;
-            weights[57] = 0.064317124103666995;
-            weights[58] = 0.064317124103666995;
-            weights[59] = 0.064317124103666995;
-            weights[60] = 0.064317124103666995;
-            weights[61] = 0.064317124103666995;
-            weights[62] = 0.064317124103666995;
-            weights[63] = 0.064317124103666995;
-            weights[64] = 0.064317124103666995;
-            weights[65] = 0.064317124103666995;
-            weights[66] = 0.064317124103666995;
-            weights[67] = 0.064317124103666995;
-            weights[68] = 0.064317124103666995;
-            weights[69] = 0.064317124103666995;
-            weights[70] = 0.064317124103666995;
-            weights[71] = 0.064317124103666995;
-            weights[72] = 0.064317124103666995;
-            weights[73] = 0.064317124103666995;
-            weights[74] = 0.064317124103666995;
-            weights[75] = 0.064317124103666995;
-            weights[76] = 0.064317124103666995;
-            weights[77] = 0.064317124103666995;
-            weights[78] = 0.064317124103666995;
-            weights[79] = 0.064317124103666995;
-            weights[80] = 0.064317124103666995;
-            weights[81] = 0.064317124103666995;
-            weights[82] = 0.064317124103666995;
-            weights[83] = 0.064317124103666995;
-            weights[84] = 0.064317124103666995;
-            weights[85] = 0.064317124103666995;
-            weights[86] = 0.064317124103666995;
-            weights[87] = 0.064317124103666995;
-            weights[88] = 0.064317124103666995;
-            weights[89] = 0.064317124103666995;
-            weights[90] = 0.064317124103666995;
-            weights[91] = 0.064317124103666995;
-            weights[92] = 0.064317124103666995;
-            weights[93] = 0.064317124103666995;
-            weights[94] = 0.064317124103666995;
-            weights[95] = 0.064317124103666995;
-            weights[96] = 0.064317124103666995;
-            weights[97] = 0.064317124103666995;
-            weights[98] = 0.064317124103666995;
-            weights[99] = 0.064317124103666995;
-            weights[100] = 0.064317124103666995;
-            weights[101] = 0.064317124103666995;
-            weights[102] = 0.064317124103666995;
-            weights[103] = 0.064317124103666995;
-            weights[104] = 0.064317124103666995;
-            weights[105] = 0.064317124103666995;
-            weights[106] = 0.064317124103666995;
-            weights[107] = 0.064317124103666995;
-            weights[108] = 0.064317124103666995;
-            weights[109] = 0.064317124103666995;
-            weights[110] = 0.064317124103666995;
-            weights[111] = 0.064317124103666995;
-            weights[112] = 0.064317124103666995;
-            weights[113] = 0.064317124103666995;
-            weights[114] = 0.064317124103666995;
-            weights[115] = 0.064317124103666995;
-            weights[116] = 0.064317124103666995;
-            weights[117] = 0.064317124103666995;
-            weights[118] = 0.064317124103666995;
-            weights[119] = 0.064317124103666995;
-            weights[120] = -0.19783871629666699;
-            weights[121] = -0.19783871629666699;
-            weights[122] = -0.19783871629666699;
-            weights[123] = -0.19783871629666699;
-            weights[124] = -0.19783871629666699;
-            weights[125] = -0.19783871629666699;
-            weights[126] = -0.19783871629666699;
-            weights[127] = -0.19783871629666699;
-            weights[128] = -0.19783871629666699;
-            weights[129] = -0.19783871629666699;
-            weights[130] = -0.19783871629666699;
-            weights[131] = -0.19783871629666699;
-            weights[132] = -0.19783871629666699;
-            weights[133] = -0.19783871629666699;
-            weights[134] = -0.19783871629666699;
-            weights[135] = -0.19783871629666699;
-            weights[136] = -0.19783871629666699;
-            weights[137] = -0.19783871629666699;
-            weights[138] = -0.19783871629666699;
-            weights[139] = -0.19783871629666699;
-            weights[140] = -0.19783871629666699;
-            weights[141] = -0.19783871629666699;
-            weights[142] = -0.19783871629666699;
-            weights[143] = -0.19783871629666699;
-            weights[144] = -0.19783871629666699;
-            weights[145] = -0.19783871629666699;
-            weights[146] = -0.19783871629666699;
-            weights[147] = -0.19783871629666699;
-            weights[148] = -0.19783871629666699;
-            weights[149] = -0.19783871629666699;
-            weights[150] = -0.19783871629666699;
-            weights[151] = -0.19783871629666699;
-            weights[152] = -0.19783871629666699;
-            weights[153] = -0.19783871629666699;
-            weights[154] = -0.19783871629666699;
-            weights[155] = -0.19783871629666699;
-            weights[156] = -0.19783871629666699;
-            weights[157] = -0.19783871629666699;
-            weights[158] = -0.19783871629666699;
-            weights[159] = -0.19783871629666699;
-            weights[160] = -0.19783871629666699;
-            weights[161] = -0.19783871629666699;
-            weights[162] = -0.19783871629666699;
-            weights[163] = -0.19783871629666699;
-            weights[164] = -0.19783871629666699;
-            weights[165] = -0.19783871629666699;
-            weights[166] = -0.19783871629666699;
-            weights[167] = -0.19783871629666699;
-            weights[168] = -0.19783871629666699;
-            weights[169] = -0.19783871629666699;
-            weights[170] = -0.19783871629666699;
-            weights[171] = -0.19783871629666699;
-            weights[172] = -0.19783871629666699;
-            weights[173] = -0.19783871629666699;
-            weights[174] = -0.19783871629666699;
-            weights[175] = -0.19783871629666699;
-            weights[176] = -0.19783871629666699;
-            weights[177] = -0.19783871629666699;
-            weights[178] = -0.19783871629666699;
-            weights[179] = -0.19783871629666699;
-            weights[180] = -0.19783871629666699;
-            weights[181] = -0.19783871629666699;
-            weights[182] = -0.19783871629666699;
-            weights[183] = -0.19783871629666699;
-            weights[184] = -0.19783871629666699;
-            weights[185] = -0.19783871629666699;
-            weights[186] = -0.19783871629666699;
-            weights[187] = -0.19783871629666699;
-            weights[188] = -0.19783871629666699;
-            weights[189] = -0.19783871629666699;
-            weights[190] = -0.19783871629666699;
-            weights[191] = -0.19783871629666699;
-            weights[192] = -0.19783871629666699;
-            weights[193] = -0.19783871629666699;
-            weights[194] = -0.19783871629666699;
-            weights[195] = -0.19783871629666699;
-            weights[196] = -0.19783871629666699;
-            weights[197] = -0.19783871629666699;
-            weights[198] = -0.19783871629666699;
-            weights[199] = -0.19783871629666699;
-            weights[200] = -0.19783871629666699;
-            weights[201] = -0.19783871629666699;
-            weights[202] = -0.19783871629666699;
-            weights[203] = -0.19783871629666699;
-            weights[204] = 0.22690862620833299;
-            weights[205] = 0.22690862620833299;
-            weights[206] = 0.22690862620833299;
-            weights[207] = 0.22690862620833299;
-            weights[208] = 0.22690862620833299;
-            weights[209] = 0.22690862620833299;
-            weights[210] = 0.22690862620833299;
-            weights[211] = 0.22690862620833299;
-            weights[212] = 0.22690862620833299;
-            weights[213] = 0.22690862620833299;
-            weights[214] = 0.22690862620833299;
-            weights[215] = 0.22690862620833299;
-            weights[216] = 0.22690862620833299;
-            weights[217] = 0.22690862620833299;
-            weights[218] = 0.22690862620833299;
-            weights[219] = 0.22690862620833299;
-            weights[220] = 0.22690862620833299;
-            weights[221] = 0.22690862620833299;
-            weights[222] = 0.22690862620833299;
-            weights[223] = 0.22690862620833299;
-            weights[224] = 0.22690862620833299;
-            weights[225] = 0.22690862620833299;
-            weights[226] = 0.22690862620833299;
-            weights[227] = 0.22690862620833299;
-            weights[228] = 0.22690862620833299;
-            weights[229] = 0.22690862620833299;
-            weights[230] = 0.22690862620833299;
-            weights[231] = 0.22690862620833299;
-            weights[232] = 0.22690862620833299;
-            weights[233] = 0.22690862620833299;
-            weights[234] = 0.22690862620833299;
-            weights[235] = 0.22690862620833299;
-            weights[236] = 0.22690862620833299;
-            weights[237] = 0.22690862620833299;
-            weights[238] = 0.22690862620833299;
-            weights[239] = 0.22690862620833299;
-            weights[240] = 0.22690862620833299;
-            weights[241] = 0.22690862620833299;
-            weights[242] = 0.22690862620833299;
-            weights[243] = 0.22690862620833299;
-            weights[244] = 0.22690862620833299;
-            weights[245] = 0.22690862620833299;
-            weights[246] = 0.22690862620833299;
-            weights[247] = 0.22690862620833299;
-            weights[248] = 0.22690862620833299;
-            weights[249] = 0.22690862620833299;
-            weights[250] = 0.22690862620833299;
-            weights[251] = 0.22690862620833299;
-            weights[252] = 0.22690862620833299;
-            weights[253] = 0.22690862620833299;
-            weights[254] = 0.22690862620833299;
-            weights[255] = 0.22690862620833299;
-            weights[256] = 0.22690862620833299;
-            weights[257] = 0.22690862620833299;
-            weights[258] = 0.22690862620833299;
-            weights[259] = 0.22690862620833299;
-            weights[260] = -0.11985271870983299;
-            weights[261] = -0.11985271870983299;
-            weights[262] = -0.11985271870983299;
-            weights[263] = -0.11985271870983299;
-            weights[264] = -0.11985271870983299;
-            weights[265] = -0.11985271870983299;
-            weights[266] = -0.11985271870983299;
-            weights[267] = -0.11985271870983299;
-            weights[268] = -0.11985271870983299;
-            weights[269] = -0.11985271870983299;
-            weights[270] = -0.11985271870983299;
-            weights[271] = -0.11985271870983299;
-            weights[272] = -0.11985271870983299;
-            weights[273] = -0.11985271870983299;
-            weights[274] = -0.11985271870983299;
-            weights[275] = -0.11985271870983299;
-            weights[276] = -0.11985271870983299;
-            weights[277] = -0.11985271870983299;
-            weights[278] = -0.11985271870983299;
-            weights[279] = -0.11985271870983299;
-            weights[280] = -0.11985271870983299;
-            weights[281] = -0.11985271870983299;
-            weights[282] = -0.11985271870983299;
-            weights[283] = -0.11985271870983299;
-            weights[284] = -0.11985271870983299;
-            weights[285] = -0.11985271870983299;
-            weights[286] = -0.11985271870983299;
-            weights[287] = -0.11985271870983299;
-            weights[288] = -0.11985271870983299;
-            weights[289] = -0.11985271870983299;
-            weights[290] = -0.11985271870983299;
-            weights[291] = -0.11985271870983299;
-            weights[292] = -0.11985271870983299;
-            weights[293] = -0.11985271870983299;
-            weights[294] = -0.11985271870983299;
-            weights[295] = 0.029171614577500001;
-            weights[296] = 0.029171614577500001;
-            weights[297] = 0.029171614577500001;
-            weights[298] = 0.029171614577500001;
-            weights[299] = 0.029171614577500001;
-            weights[300] = 0.029171614577500001;
-            weights[301] = 0.029171614577500001;
-            weights[302] = 0.029171614577500001;
-            weights[303] = 0.029171614577500001;
-            weights[304] = 0.029171614577500001;
-            weights[305] = 0.029171614577500001;
-            weights[306] = 0.029171614577500001;
-            weights[307] = 0.029171614577500001;
-            weights[308] = 0.029171614577500001;
-            weights[309] = 0.029171614577500001;
-            weights[310] = 0.029171614577500001;
-            weights[311] = 0.029171614577500001;
-            weights[312] = 0.029171614577500001;
-            weights[313] = 0.029171614577500001;
-            weights[314] = 0.029171614577500001;
-            weights[315] = -0.002873877836833;
-            weights[316] = -0.002873877836833;
-            weights[317] = -0.002873877836833;
-            weights[318] = -0.002873877836833;
-            weights[319] = -0.002873877836833;
-            weights[320] = -0.002873877836833;
-            weights[321] = -0.002873877836833;
-            weights[322] = -0.002873877836833;
-            weights[323] = -0.002873877836833;
-            weights[324] = -0.002873877836833;
-            weights[325] = 8.3210734578000002e-05;
-            weights[326] = 8.3210734578000002e-05;
-            weights[327] = 8.3210734578000002e-05;
-            weights[328] = 8.3210734578000002e-05;
-            weights[329] = -3.2575693899999999e-07;
-
+            coordinates.assign(gpcoordinates14, gpcoordinates14+3*330);
+            weights.assign(gpweights14, gpweights14+330);
             break;
-
         case 16: case 17:
-            
-            coordinates.resize(495*3);
-            weights.resize(495);
-
-            coordinates[0] = 0.050000000000000003;
-            coordinates[1] = 0.050000000000000003;
-            coordinates[2] = 0.84999999999999998;
-            coordinates[3] = 0.050000000000000003;
-            coordinates[4] = 0.14999999999999999;
-            coordinates[5] = 0.75;
-            coordinates[6] = 0.050000000000000003;
-            coordinates[7] = 0.25;
-            coordinates[8] = 0.65000000000000002;
-            coordinates[9] = 0.050000000000000003;
-            coordinates[10] = 0.34999999999999998;
-            coordinates[11] = 0.55000000000000004;
-            coordinates[12] = 0.050000000000000003;
-            coordinates[13] = 0.45000000000000001;
-            coordinates[14] = 0.45000000000000001;
-            coordinates[15] = 0.050000000000000003;
-            coordinates[16] = 0.55000000000000004;
-            coordinates[17] = 0.34999999999999998;
-            coordinates[18] = 0.050000000000000003;
-            coordinates[19] = 0.65000000000000002;
-            coordinates[20] = 0.25;
-            coordinates[21] = 0.050000000000000003;
-            coordinates[22] = 0.75;
-            coordinates[23] = 0.14999999999999999;
-            coordinates[24] = 0.050000000000000003;
-            coordinates[25] = 0.84999999999999998;
-            coordinates[26] = 0.050000000000000003;
-            coordinates[27] = 0.14999999999999999;
-            coordinates[28] = 0.050000000000000003;
-            coordinates[29] = 0.75;
-            coordinates[30] = 0.14999999999999999;
-            coordinates[31] = 0.14999999999999999;
-            coordinates[32] = 0.65000000000000002;
-            coordinates[33] = 0.14999999999999999;
-            coordinates[34] = 0.25;
-            coordinates[35] = 0.55000000000000004;
-            coordinates[36] = 0.14999999999999999;
-            coordinates[37] = 0.34999999999999998;
-            coordinates[38] = 0.45000000000000001;
-            coordinates[39] = 0.14999999999999999;
-            coordinates[40] = 0.45000000000000001;
-            coordinates[41] = 0.34999999999999998;
-            coordinates[42] = 0.14999999999999999;
-            coordinates[43] = 0.55000000000000004;
-            coordinates[44] = 0.25;
-            coordinates[45] = 0.14999999999999999;
-            coordinates[46] = 0.65000000000000002;
-            coordinates[47] = 0.14999999999999999;
-            coordinates[48] = 0.14999999999999999;
-            coordinates[49] = 0.75;
-            coordinates[50] = 0.050000000000000003;
-            coordinates[51] = 0.25;
-            coordinates[52] = 0.050000000000000003;
-            coordinates[53] = 0.65000000000000002;
-            coordinates[54] = 0.25;
-            coordinates[55] = 0.14999999999999999;
-            coordinates[56] = 0.55000000000000004;
-            coordinates[57] = 0.25;
-            coordinates[58] = 0.25;
-            coordinates[59] = 0.45000000000000001;
-            coordinates[60] = 0.25;
-            coordinates[61] = 0.34999999999999998;
-            coordinates[62] = 0.34999999999999998;
-            coordinates[63] = 0.25;
-            coordinates[64] = 0.45000000000000001;
-            coordinates[65] = 0.25;
-            coordinates[66] = 0.25;
-            coordinates[67] = 0.55000000000000004;
-            coordinates[68] = 0.14999999999999999;
-            coordinates[69] = 0.25;
-            coordinates[70] = 0.65000000000000002;
-            coordinates[71] = 0.050000000000000003;
-            coordinates[72] = 0.34999999999999998;
-            coordinates[73] = 0.050000000000000003;
-            coordinates[74] = 0.55000000000000004;
-            coordinates[75] = 0.34999999999999998;
-            coordinates[76] = 0.14999999999999999;
-            coordinates[77] = 0.45000000000000001;
-            coordinates[78] = 0.34999999999999998;
-            coordinates[79] = 0.25;
-            coordinates[80] = 0.34999999999999998;
-            coordinates[81] = 0.34999999999999998;
-            coordinates[82] = 0.34999999999999998;
-            coordinates[83] = 0.25;
-            coordinates[84] = 0.34999999999999998;
-            coordinates[85] = 0.45000000000000001;
-            coordinates[86] = 0.14999999999999999;
-            coordinates[87] = 0.34999999999999998;
-            coordinates[88] = 0.55000000000000004;
-            coordinates[89] = 0.050000000000000003;
-            coordinates[90] = 0.45000000000000001;
-            coordinates[91] = 0.050000000000000003;
-            coordinates[92] = 0.45000000000000001;
-            coordinates[93] = 0.45000000000000001;
-            coordinates[94] = 0.14999999999999999;
-            coordinates[95] = 0.34999999999999998;
-            coordinates[96] = 0.45000000000000001;
-            coordinates[97] = 0.25;
-            coordinates[98] = 0.25;
-            coordinates[99] = 0.45000000000000001;
-            coordinates[100] = 0.34999999999999998;
-            coordinates[101] = 0.14999999999999999;
-            coordinates[102] = 0.45000000000000001;
-            coordinates[103] = 0.45000000000000001;
-            coordinates[104] = 0.050000000000000003;
-            coordinates[105] = 0.55000000000000004;
-            coordinates[106] = 0.050000000000000003;
-            coordinates[107] = 0.34999999999999998;
-            coordinates[108] = 0.55000000000000004;
-            coordinates[109] = 0.14999999999999999;
-            coordinates[110] = 0.25;
-            coordinates[111] = 0.55000000000000004;
-            coordinates[112] = 0.25;
-            coordinates[113] = 0.14999999999999999;
-            coordinates[114] = 0.55000000000000004;
-            coordinates[115] = 0.34999999999999998;
-            coordinates[116] = 0.050000000000000003;
-            coordinates[117] = 0.65000000000000002;
-            coordinates[118] = 0.050000000000000003;
-            coordinates[119] = 0.25;
-            coordinates[120] = 0.65000000000000002;
-            coordinates[121] = 0.14999999999999999;
-            coordinates[122] = 0.14999999999999999;
-            coordinates[123] = 0.65000000000000002;
-            coordinates[124] = 0.25;
-            coordinates[125] = 0.050000000000000003;
-            coordinates[126] = 0.75;
-            coordinates[127] = 0.050000000000000003;
-            coordinates[128] = 0.14999999999999999;
-            coordinates[129] = 0.75;
-            coordinates[130] = 0.14999999999999999;
-            coordinates[131] = 0.050000000000000003;
-            coordinates[132] = 0.84999999999999998;
-            coordinates[133] = 0.050000000000000003;
-            coordinates[134] = 0.050000000000000003;
-            coordinates[135] = 0.050000000000000003;
-            coordinates[136] = 0.050000000000000003;
-            coordinates[137] = 0.75;
-            coordinates[138] = 0.050000000000000003;
-            coordinates[139] = 0.14999999999999999;
-            coordinates[140] = 0.65000000000000002;
-            coordinates[141] = 0.050000000000000003;
-            coordinates[142] = 0.25;
-            coordinates[143] = 0.55000000000000004;
-            coordinates[144] = 0.050000000000000003;
-            coordinates[145] = 0.34999999999999998;
-            coordinates[146] = 0.45000000000000001;
-            coordinates[147] = 0.050000000000000003;
-            coordinates[148] = 0.45000000000000001;
-            coordinates[149] = 0.34999999999999998;
-            coordinates[150] = 0.050000000000000003;
-            coordinates[151] = 0.55000000000000004;
-            coordinates[152] = 0.25;
-            coordinates[153] = 0.050000000000000003;
-            coordinates[154] = 0.65000000000000002;
-            coordinates[155] = 0.14999999999999999;
-            coordinates[156] = 0.050000000000000003;
-            coordinates[157] = 0.75;
-            coordinates[158] = 0.050000000000000003;
-            coordinates[159] = 0.14999999999999999;
-            coordinates[160] = 0.050000000000000003;
-            coordinates[161] = 0.65000000000000002;
-            coordinates[162] = 0.14999999999999999;
-            coordinates[163] = 0.14999999999999999;
-            coordinates[164] = 0.55000000000000004;
-            coordinates[165] = 0.14999999999999999;
-            coordinates[166] = 0.25;
-            coordinates[167] = 0.45000000000000001;
-            coordinates[168] = 0.14999999999999999;
-            coordinates[169] = 0.34999999999999998;
-            coordinates[170] = 0.34999999999999998;
-            coordinates[171] = 0.14999999999999999;
-            coordinates[172] = 0.45000000000000001;
-            coordinates[173] = 0.25;
-            coordinates[174] = 0.14999999999999999;
-            coordinates[175] = 0.55000000000000004;
-            coordinates[176] = 0.14999999999999999;
-            coordinates[177] = 0.14999999999999999;
-            coordinates[178] = 0.65000000000000002;
-            coordinates[179] = 0.050000000000000003;
-            coordinates[180] = 0.25;
-            coordinates[181] = 0.050000000000000003;
-            coordinates[182] = 0.55000000000000004;
-            coordinates[183] = 0.25;
-            coordinates[184] = 0.14999999999999999;
-            coordinates[185] = 0.45000000000000001;
-            coordinates[186] = 0.25;
-            coordinates[187] = 0.25;
-            coordinates[188] = 0.34999999999999998;
-            coordinates[189] = 0.25;
-            coordinates[190] = 0.34999999999999998;
-            coordinates[191] = 0.25;
-            coordinates[192] = 0.25;
-            coordinates[193] = 0.45000000000000001;
-            coordinates[194] = 0.14999999999999999;
-            coordinates[195] = 0.25;
-            coordinates[196] = 0.55000000000000004;
-            coordinates[197] = 0.050000000000000003;
-            coordinates[198] = 0.34999999999999998;
-            coordinates[199] = 0.050000000000000003;
-            coordinates[200] = 0.45000000000000001;
-            coordinates[201] = 0.34999999999999998;
-            coordinates[202] = 0.14999999999999999;
-            coordinates[203] = 0.34999999999999998;
-            coordinates[204] = 0.34999999999999998;
-            coordinates[205] = 0.25;
-            coordinates[206] = 0.25;
-            coordinates[207] = 0.34999999999999998;
-            coordinates[208] = 0.34999999999999998;
-            coordinates[209] = 0.14999999999999999;
-            coordinates[210] = 0.34999999999999998;
-            coordinates[211] = 0.45000000000000001;
-            coordinates[212] = 0.050000000000000003;
-            coordinates[213] = 0.45000000000000001;
-            coordinates[214] = 0.050000000000000003;
-            coordinates[215] = 0.34999999999999998;
-            coordinates[216] = 0.45000000000000001;
-            coordinates[217] = 0.14999999999999999;
-            coordinates[218] = 0.25;
-            coordinates[219] = 0.45000000000000001;
-            coordinates[220] = 0.25;
-            coordinates[221] = 0.14999999999999999;
-            coordinates[222] = 0.45000000000000001;
-            coordinates[223] = 0.34999999999999998;
-            coordinates[224] = 0.050000000000000003;
-            coordinates[225] = 0.55000000000000004;
-            coordinates[226] = 0.050000000000000003;
-            coordinates[227] = 0.25;
-            coordinates[228] = 0.55000000000000004;
-            coordinates[229] = 0.14999999999999999;
-            coordinates[230] = 0.14999999999999999;
-            coordinates[231] = 0.55000000000000004;
-            coordinates[232] = 0.25;
-            coordinates[233] = 0.050000000000000003;
-            coordinates[234] = 0.65000000000000002;
-            coordinates[235] = 0.050000000000000003;
-            coordinates[236] = 0.14999999999999999;
-            coordinates[237] = 0.65000000000000002;
-            coordinates[238] = 0.14999999999999999;
-            coordinates[239] = 0.050000000000000003;
-            coordinates[240] = 0.75;
-            coordinates[241] = 0.050000000000000003;
-            coordinates[242] = 0.050000000000000003;
-            coordinates[243] = 0.050000000000000003;
-            coordinates[244] = 0.050000000000000003;
-            coordinates[245] = 0.65000000000000002;
-            coordinates[246] = 0.050000000000000003;
-            coordinates[247] = 0.14999999999999999;
-            coordinates[248] = 0.55000000000000004;
-            coordinates[249] = 0.050000000000000003;
-            coordinates[250] = 0.25;
-            coordinates[251] = 0.45000000000000001;
-            coordinates[252] = 0.050000000000000003;
-            coordinates[253] = 0.34999999999999998;
-            coordinates[254] = 0.34999999999999998;
-            coordinates[255] = 0.050000000000000003;
-            coordinates[256] = 0.45000000000000001;
-            coordinates[257] = 0.25;
-            coordinates[258] = 0.050000000000000003;
-            coordinates[259] = 0.55000000000000004;
-            coordinates[260] = 0.14999999999999999;
-            coordinates[261] = 0.050000000000000003;
-            coordinates[262] = 0.65000000000000002;
-            coordinates[263] = 0.050000000000000003;
-            coordinates[264] = 0.14999999999999999;
-            coordinates[265] = 0.050000000000000003;
-            coordinates[266] = 0.55000000000000004;
-            coordinates[267] = 0.14999999999999999;
-            coordinates[268] = 0.14999999999999999;
-            coordinates[269] = 0.45000000000000001;
-            coordinates[270] = 0.14999999999999999;
-            coordinates[271] = 0.25;
-            coordinates[272] = 0.34999999999999998;
-            coordinates[273] = 0.14999999999999999;
-            coordinates[274] = 0.34999999999999998;
-            coordinates[275] = 0.25;
-            coordinates[276] = 0.14999999999999999;
-            coordinates[277] = 0.45000000000000001;
-            coordinates[278] = 0.14999999999999999;
-            coordinates[279] = 0.14999999999999999;
-            coordinates[280] = 0.55000000000000004;
-            coordinates[281] = 0.050000000000000003;
-            coordinates[282] = 0.25;
-            coordinates[283] = 0.050000000000000003;
-            coordinates[284] = 0.45000000000000001;
-            coordinates[285] = 0.25;
-            coordinates[286] = 0.14999999999999999;
-            coordinates[287] = 0.34999999999999998;
-            coordinates[288] = 0.25;
-            coordinates[289] = 0.25;
-            coordinates[290] = 0.25;
-            coordinates[291] = 0.25;
-            coordinates[292] = 0.34999999999999998;
-            coordinates[293] = 0.14999999999999999;
-            coordinates[294] = 0.25;
-            coordinates[295] = 0.45000000000000001;
-            coordinates[296] = 0.050000000000000003;
-            coordinates[297] = 0.34999999999999998;
-            coordinates[298] = 0.050000000000000003;
-            coordinates[299] = 0.34999999999999998;
-            coordinates[300] = 0.34999999999999998;
-            coordinates[301] = 0.14999999999999999;
-            coordinates[302] = 0.25;
-            coordinates[303] = 0.34999999999999998;
-            coordinates[304] = 0.25;
-            coordinates[305] = 0.14999999999999999;
-            coordinates[306] = 0.34999999999999998;
-            coordinates[307] = 0.34999999999999998;
-            coordinates[308] = 0.050000000000000003;
-            coordinates[309] = 0.45000000000000001;
-            coordinates[310] = 0.050000000000000003;
-            coordinates[311] = 0.25;
-            coordinates[312] = 0.45000000000000001;
-            coordinates[313] = 0.14999999999999999;
-            coordinates[314] = 0.14999999999999999;
-            coordinates[315] = 0.45000000000000001;
-            coordinates[316] = 0.25;
-            coordinates[317] = 0.050000000000000003;
-            coordinates[318] = 0.55000000000000004;
-            coordinates[319] = 0.050000000000000003;
-            coordinates[320] = 0.14999999999999999;
-            coordinates[321] = 0.55000000000000004;
-            coordinates[322] = 0.14999999999999999;
-            coordinates[323] = 0.050000000000000003;
-            coordinates[324] = 0.65000000000000002;
-            coordinates[325] = 0.050000000000000003;
-            coordinates[326] = 0.050000000000000003;
-            coordinates[327] = 0.050000000000000003;
-            coordinates[328] = 0.050000000000000003;
-            coordinates[329] = 0.55000000000000004;
-            coordinates[330] = 0.050000000000000003;
-            coordinates[331] = 0.14999999999999999;
-            coordinates[332] = 0.45000000000000001;
-            coordinates[333] = 0.050000000000000003;
-            coordinates[334] = 0.25;
-            coordinates[335] = 0.34999999999999998;
-            coordinates[336] = 0.050000000000000003;
-            coordinates[337] = 0.34999999999999998;
-            coordinates[338] = 0.25;
-            coordinates[339] = 0.050000000000000003;
-            coordinates[340] = 0.45000000000000001;
-            coordinates[341] = 0.14999999999999999;
-            coordinates[342] = 0.050000000000000003;
-            coordinates[343] = 0.55000000000000004;
-            coordinates[344] = 0.050000000000000003;
-            coordinates[345] = 0.14999999999999999;
-            coordinates[346] = 0.050000000000000003;
-            coordinates[347] = 0.45000000000000001;
-            coordinates[348] = 0.14999999999999999;
-            coordinates[349] = 0.14999999999999999;
-            coordinates[350] = 0.34999999999999998;
-            coordinates[351] = 0.14999999999999999;
-            coordinates[352] = 0.25;
-            coordinates[353] = 0.25;
-            coordinates[354] = 0.14999999999999999;
-            coordinates[355] = 0.34999999999999998;
-            coordinates[356] = 0.14999999999999999;
-            coordinates[357] = 0.14999999999999999;
-            coordinates[358] = 0.45000000000000001;
-            coordinates[359] = 0.050000000000000003;
-            coordinates[360] = 0.25;
-            coordinates[361] = 0.050000000000000003;
-            coordinates[362] = 0.34999999999999998;
-            coordinates[363] = 0.25;
-            coordinates[364] = 0.14999999999999999;
-            coordinates[365] = 0.25;
-            coordinates[366] = 0.25;
-            coordinates[367] = 0.25;
-            coordinates[368] = 0.14999999999999999;
-            coordinates[369] = 0.25;
-            coordinates[370] = 0.34999999999999998;
-            coordinates[371] = 0.050000000000000003;
-            coordinates[372] = 0.34999999999999998;
-            coordinates[373] = 0.050000000000000003;
-            coordinates[374] = 0.25;
-            coordinates[375] = 0.34999999999999998;
-            coordinates[376] = 0.14999999999999999;
-            coordinates[377] = 0.14999999999999999;
-            coordinates[378] = 0.34999999999999998;
-            coordinates[379] = 0.25;
-            coordinates[380] = 0.050000000000000003;
-            coordinates[381] = 0.45000000000000001;
-            coordinates[382] = 0.050000000000000003;
-            coordinates[383] = 0.14999999999999999;
-            coordinates[384] = 0.45000000000000001;
-            coordinates[385] = 0.14999999999999999;
-            coordinates[386] = 0.050000000000000003;
-            coordinates[387] = 0.55000000000000004;
-            coordinates[388] = 0.050000000000000003;
-            coordinates[389] = 0.050000000000000003;
-            coordinates[390] = 0.050000000000000003;
-            coordinates[391] = 0.050000000000000003;
-            coordinates[392] = 0.45000000000000001;
-            coordinates[393] = 0.050000000000000003;
-            coordinates[394] = 0.14999999999999999;
-            coordinates[395] = 0.34999999999999998;
-            coordinates[396] = 0.050000000000000003;
-            coordinates[397] = 0.25;
-            coordinates[398] = 0.25;
-            coordinates[399] = 0.050000000000000003;
-            coordinates[400] = 0.34999999999999998;
-            coordinates[401] = 0.14999999999999999;
-            coordinates[402] = 0.050000000000000003;
-            coordinates[403] = 0.45000000000000001;
-            coordinates[404] = 0.050000000000000003;
-            coordinates[405] = 0.14999999999999999;
-            coordinates[406] = 0.050000000000000003;
-            coordinates[407] = 0.34999999999999998;
-            coordinates[408] = 0.14999999999999999;
-            coordinates[409] = 0.14999999999999999;
-            coordinates[410] = 0.25;
-            coordinates[411] = 0.14999999999999999;
-            coordinates[412] = 0.25;
-            coordinates[413] = 0.14999999999999999;
-            coordinates[414] = 0.14999999999999999;
-            coordinates[415] = 0.34999999999999998;
-            coordinates[416] = 0.050000000000000003;
-            coordinates[417] = 0.25;
-            coordinates[418] = 0.050000000000000003;
-            coordinates[419] = 0.25;
-            coordinates[420] = 0.25;
-            coordinates[421] = 0.14999999999999999;
-            coordinates[422] = 0.14999999999999999;
-            coordinates[423] = 0.25;
-            coordinates[424] = 0.25;
-            coordinates[425] = 0.050000000000000003;
-            coordinates[426] = 0.34999999999999998;
-            coordinates[427] = 0.050000000000000003;
-            coordinates[428] = 0.14999999999999999;
-            coordinates[429] = 0.34999999999999998;
-            coordinates[430] = 0.14999999999999999;
-            coordinates[431] = 0.050000000000000003;
-            coordinates[432] = 0.45000000000000001;
-            coordinates[433] = 0.050000000000000003;
-            coordinates[434] = 0.050000000000000003;
-            coordinates[435] = 0.050000000000000003;
-            coordinates[436] = 0.050000000000000003;
-            coordinates[437] = 0.34999999999999998;
-            coordinates[438] = 0.050000000000000003;
-            coordinates[439] = 0.14999999999999999;
-            coordinates[440] = 0.25;
-            coordinates[441] = 0.050000000000000003;
-            coordinates[442] = 0.25;
-            coordinates[443] = 0.14999999999999999;
-            coordinates[444] = 0.050000000000000003;
-            coordinates[445] = 0.34999999999999998;
-            coordinates[446] = 0.050000000000000003;
-            coordinates[447] = 0.14999999999999999;
-            coordinates[448] = 0.050000000000000003;
-            coordinates[449] = 0.25;
-            coordinates[450] = 0.14999999999999999;
-            coordinates[451] = 0.14999999999999999;
-            coordinates[452] = 0.14999999999999999;
-            coordinates[453] = 0.14999999999999999;
-            coordinates[454] = 0.25;
-            coordinates[455] = 0.050000000000000003;
-            coordinates[456] = 0.25;
-            coordinates[457] = 0.050000000000000003;
-            coordinates[458] = 0.14999999999999999;
-            coordinates[459] = 0.25;
-            coordinates[460] = 0.14999999999999999;
-            coordinates[461] = 0.050000000000000003;
-            coordinates[462] = 0.34999999999999998;
-            coordinates[463] = 0.050000000000000003;
-            coordinates[464] = 0.050000000000000003;
-            coordinates[465] = 0.050000000000000003;
-            coordinates[466] = 0.050000000000000003;
-            coordinates[467] = 0.25;
-            coordinates[468] = 0.050000000000000003;
-            coordinates[469] = 0.14999999999999999;
-            coordinates[470] = 0.14999999999999999;
-            coordinates[471] = 0.050000000000000003;
-            coordinates[472] = 0.25;
-            coordinates[473] = 0.050000000000000003;
-            coordinates[474] = 0.14999999999999999;
-            coordinates[475] = 0.050000000000000003;
-            coordinates[476] = 0.14999999999999999;
-            coordinates[477] = 0.14999999999999999;
-            coordinates[478] = 0.14999999999999999;
-            coordinates[479] = 0.050000000000000003;
-            coordinates[480] = 0.25;
-            coordinates[481] = 0.050000000000000003;
-            coordinates[482] = 0.050000000000000003;
-            coordinates[483] = 0.050000000000000003;
-            coordinates[484] = 0.050000000000000003;
-            coordinates[485] = 0.14999999999999999;
-            coordinates[486] = 0.050000000000000003;
-            coordinates[487] = 0.14999999999999999;
-            coordinates[488] = 0.050000000000000003;
-            coordinates[489] = 0.14999999999999999;
-            coordinates[490] = 0.050000000000000003;
-            coordinates[491] = 0.050000000000000003;
-            coordinates[492] = 0.050000000000000003;
-            coordinates[493] = 0.050000000000000003;
-            coordinates[494] = 0.050000000000000003;
-            coordinates[495] = 0.055555555555600003;
-            coordinates[496] = 0.055555555555600003;
-            coordinates[497] = 0.83333333333299997;
-            coordinates[498] = 0.055555555555600003;
-            coordinates[499] = 0.166666666667;
-            coordinates[500] = 0.72222222222200005;
-            coordinates[501] = 0.055555555555600003;
-            coordinates[502] = 0.277777777778;
-            coordinates[503] = 0.61111111111100003;
-            coordinates[504] = 0.055555555555600003;
-            coordinates[505] = 0.38888888888899997;
-            coordinates[506] = 0.5;
-            coordinates[507] = 0.055555555555600003;
-            coordinates[508] = 0.5;
-            coordinates[509] = 0.38888888888899997;
-            coordinates[510] = 0.055555555555600003;
-            coordinates[511] = 0.61111111111100003;
-            coordinates[512] = 0.277777777778;
-            coordinates[513] = 0.055555555555600003;
-            coordinates[514] = 0.72222222222200005;
-            coordinates[515] = 0.166666666667;
-            coordinates[516] = 0.055555555555600003;
-            coordinates[517] = 0.83333333333299997;
-            coordinates[518] = 0.055555555555600003;
-            coordinates[519] = 0.166666666667;
-            coordinates[520] = 0.055555555555600003;
-            coordinates[521] = 0.72222222222200005;
-            coordinates[522] = 0.166666666667;
-            coordinates[523] = 0.166666666667;
-            coordinates[524] = 0.61111111111100003;
-            coordinates[525] = 0.166666666667;
-            coordinates[526] = 0.277777777778;
-            coordinates[527] = 0.5;
-            coordinates[528] = 0.166666666667;
-            coordinates[529] = 0.38888888888899997;
-            coordinates[530] = 0.38888888888899997;
-            coordinates[531] = 0.166666666667;
-            coordinates[532] = 0.5;
-            coordinates[533] = 0.277777777778;
-            coordinates[534] = 0.166666666667;
-            coordinates[535] = 0.61111111111100003;
-            coordinates[536] = 0.166666666667;
-            coordinates[537] = 0.166666666667;
-            coordinates[538] = 0.72222222222200005;
-            coordinates[539] = 0.055555555555600003;
-            coordinates[540] = 0.277777777778;
-            coordinates[541] = 0.055555555555600003;
-            coordinates[542] = 0.61111111111100003;
-            coordinates[543] = 0.277777777778;
-            coordinates[544] = 0.166666666667;
-            coordinates[545] = 0.5;
-            coordinates[546] = 0.277777777778;
-            coordinates[547] = 0.277777777778;
-            coordinates[548] = 0.38888888888899997;
-            coordinates[549] = 0.277777777778;
-            coordinates[550] = 0.38888888888899997;
-            coordinates[551] = 0.277777777778;
-            coordinates[552] = 0.277777777778;
-            coordinates[553] = 0.5;
-            coordinates[554] = 0.166666666667;
-            coordinates[555] = 0.277777777778;
-            coordinates[556] = 0.61111111111100003;
-            coordinates[557] = 0.055555555555600003;
-            coordinates[558] = 0.38888888888899997;
-            coordinates[559] = 0.055555555555600003;
-            coordinates[560] = 0.5;
-            coordinates[561] = 0.38888888888899997;
-            coordinates[562] = 0.166666666667;
-            coordinates[563] = 0.38888888888899997;
-            coordinates[564] = 0.38888888888899997;
-            coordinates[565] = 0.277777777778;
-            coordinates[566] = 0.277777777778;
-            coordinates[567] = 0.38888888888899997;
-            coordinates[568] = 0.38888888888899997;
-            coordinates[569] = 0.166666666667;
-            coordinates[570] = 0.38888888888899997;
-            coordinates[571] = 0.5;
-            coordinates[572] = 0.055555555555600003;
-            coordinates[573] = 0.5;
-            coordinates[574] = 0.055555555555600003;
-            coordinates[575] = 0.38888888888899997;
-            coordinates[576] = 0.5;
-            coordinates[577] = 0.166666666667;
-            coordinates[578] = 0.277777777778;
-            coordinates[579] = 0.5;
-            coordinates[580] = 0.277777777778;
-            coordinates[581] = 0.166666666667;
-            coordinates[582] = 0.5;
-            coordinates[583] = 0.38888888888899997;
-            coordinates[584] = 0.055555555555600003;
-            coordinates[585] = 0.61111111111100003;
-            coordinates[586] = 0.055555555555600003;
-            coordinates[587] = 0.277777777778;
-            coordinates[588] = 0.61111111111100003;
-            coordinates[589] = 0.166666666667;
-            coordinates[590] = 0.166666666667;
-            coordinates[591] = 0.61111111111100003;
-            coordinates[592] = 0.277777777778;
-            coordinates[593] = 0.055555555555600003;
-            coordinates[594] = 0.72222222222200005;
-            coordinates[595] = 0.055555555555600003;
-            coordinates[596] = 0.166666666667;
-            coordinates[597] = 0.72222222222200005;
-            coordinates[598] = 0.166666666667;
-            coordinates[599] = 0.055555555555600003;
-            coordinates[600] = 0.83333333333299997;
-            coordinates[601] = 0.055555555555600003;
-            coordinates[602] = 0.055555555555600003;
-            coordinates[603] = 0.055555555555600003;
-            coordinates[604] = 0.055555555555600003;
-            coordinates[605] = 0.72222222222200005;
-            coordinates[606] = 0.055555555555600003;
-            coordinates[607] = 0.166666666667;
-            coordinates[608] = 0.61111111111100003;
-            coordinates[609] = 0.055555555555600003;
-            coordinates[610] = 0.277777777778;
-            coordinates[611] = 0.5;
-            coordinates[612] = 0.055555555555600003;
-            coordinates[613] = 0.38888888888899997;
-            coordinates[614] = 0.38888888888899997;
-            coordinates[615] = 0.055555555555600003;
-            coordinates[616] = 0.5;
-            coordinates[617] = 0.277777777778;
-            coordinates[618] = 0.055555555555600003;
-            coordinates[619] = 0.61111111111100003;
-            coordinates[620] = 0.166666666667;
-            coordinates[621] = 0.055555555555600003;
-            coordinates[622] = 0.72222222222200005;
-            coordinates[623] = 0.055555555555600003;
-            coordinates[624] = 0.166666666667;
-            coordinates[625] = 0.055555555555600003;
-            coordinates[626] = 0.61111111111100003;
-            coordinates[627] = 0.166666666667;
-            coordinates[628] = 0.166666666667;
-            coordinates[629] = 0.5;
-            coordinates[630] = 0.166666666667;
-            coordinates[631] = 0.277777777778;
-            coordinates[632] = 0.38888888888899997;
-            coordinates[633] = 0.166666666667;
-            coordinates[634] = 0.38888888888899997;
-            coordinates[635] = 0.277777777778;
-            coordinates[636] = 0.166666666667;
-            coordinates[637] = 0.5;
-            coordinates[638] = 0.166666666667;
-            coordinates[639] = 0.166666666667;
-            coordinates[640] = 0.61111111111100003;
-            coordinates[641] = 0.055555555555600003;
-            coordinates[642] = 0.277777777778;
-            coordinates[643] = 0.055555555555600003;
-            coordinates[644] = 0.5;
-            coordinates[645] = 0.277777777778;
-            coordinates[646] = 0.166666666667;
-            coordinates[647] = 0.38888888888899997;
-            coordinates[648] = 0.277777777778;
-            coordinates[649] = 0.277777777778;
-            coordinates[650] = 0.277777777778;
-            coordinates[651] = 0.277777777778;
-            coordinates[652] = 0.38888888888899997;
-            coordinates[653] = 0.166666666667;
-            coordinates[654] = 0.277777777778;
-            coordinates[655] = 0.5;
-            coordinates[656] = 0.055555555555600003;
-            coordinates[657] = 0.38888888888899997;
-            coordinates[658] = 0.055555555555600003;
-            coordinates[659] = 0.38888888888899997;
-            coordinates[660] = 0.38888888888899997;
-            coordinates[661] = 0.166666666667;
-            coordinates[662] = 0.277777777778;
-            coordinates[663] = 0.38888888888899997;
-            coordinates[664] = 0.277777777778;
-            coordinates[665] = 0.166666666667;
-            coordinates[666] = 0.38888888888899997;
-            coordinates[667] = 0.38888888888899997;
-            coordinates[668] = 0.055555555555600003;
-            coordinates[669] = 0.5;
-            coordinates[670] = 0.055555555555600003;
-            coordinates[671] = 0.277777777778;
-            coordinates[672] = 0.5;
-            coordinates[673] = 0.166666666667;
-            coordinates[674] = 0.166666666667;
-            coordinates[675] = 0.5;
-            coordinates[676] = 0.277777777778;
-            coordinates[677] = 0.055555555555600003;
-            coordinates[678] = 0.61111111111100003;
-            coordinates[679] = 0.055555555555600003;
-            coordinates[680] = 0.166666666667;
-            coordinates[681] = 0.61111111111100003;
-            coordinates[682] = 0.166666666667;
-            coordinates[683] = 0.055555555555600003;
-            coordinates[684] = 0.72222222222200005;
-            coordinates[685] = 0.055555555555600003;
-            coordinates[686] = 0.055555555555600003;
-            coordinates[687] = 0.055555555555600003;
-            coordinates[688] = 0.055555555555600003;
-            coordinates[689] = 0.61111111111100003;
-            coordinates[690] = 0.055555555555600003;
-            coordinates[691] = 0.166666666667;
-            coordinates[692] = 0.5;
-            coordinates[693] = 0.055555555555600003;
-            coordinates[694] = 0.277777777778;
-            coordinates[695] = 0.38888888888899997;
-            coordinates[696] = 0.055555555555600003;
-            coordinates[697] = 0.38888888888899997;
-            coordinates[698] = 0.277777777778;
-            coordinates[699] = 0.055555555555600003;
-            coordinates[700] = 0.5;
-            coordinates[701] = 0.166666666667;
-            coordinates[702] = 0.055555555555600003;
-            coordinates[703] = 0.61111111111100003;
-            coordinates[704] = 0.055555555555600003;
-            coordinates[705] = 0.166666666667;
-            coordinates[706] = 0.055555555555600003;
-            coordinates[707] = 0.5;
-            coordinates[708] = 0.166666666667;
-            coordinates[709] = 0.166666666667;
-            coordinates[710] = 0.38888888888899997;
-            coordinates[711] = 0.166666666667;
-            coordinates[712] = 0.277777777778;
-            coordinates[713] = 0.277777777778;
-            coordinates[714] = 0.166666666667;
-            coordinates[715] = 0.38888888888899997;
-            coordinates[716] = 0.166666666667;
-            coordinates[717] = 0.166666666667;
-            coordinates[718] = 0.5;
-            coordinates[719] = 0.055555555555600003;
-            coordinates[720] = 0.277777777778;
-            coordinates[721] = 0.055555555555600003;
-            coordinates[722] = 0.38888888888899997;
-            coordinates[723] = 0.277777777778;
-            coordinates[724] = 0.166666666667;
-            coordinates[725] = 0.277777777778;
-            coordinates[726] = 0.277777777778;
-            coordinates[727] = 0.277777777778;
-            coordinates[728] = 0.166666666667;
-            coordinates[729] = 0.277777777778;
-            coordinates[730] = 0.38888888888899997;
-            coordinates[731] = 0.055555555555600003;
-            coordinates[732] = 0.38888888888899997;
-            coordinates[733] = 0.055555555555600003;
-            coordinates[734] = 0.277777777778;
-            coordinates[735] = 0.38888888888899997;
-            coordinates[736] = 0.166666666667;
-            coordinates[737] = 0.166666666667;
-            coordinates[738] = 0.38888888888899997;
-            coordinates[739] = 0.277777777778;
-            coordinates[740] = 0.055555555555600003;
-            coordinates[741] = 0.5;
-            coordinates[742] = 0.055555555555600003;
-            coordinates[743] = 0.166666666667;
-            coordinates[744] = 0.5;
-            coordinates[745] = 0.166666666667;
-            coordinates[746] = 0.055555555555600003;
-            coordinates[747] = 0.61111111111100003;
-            coordinates[748] = 0.055555555555600003;
-            coordinates[749] = 0.055555555555600003;
-            coordinates[750] = 0.055555555555600003;
-            coordinates[751] = 0.055555555555600003;
-            coordinates[752] = 0.5;
-            coordinates[753] = 0.055555555555600003;
-            coordinates[754] = 0.166666666667;
-            coordinates[755] = 0.38888888888899997;
-            coordinates[756] = 0.055555555555600003;
-            coordinates[757] = 0.277777777778;
-            coordinates[758] = 0.277777777778;
-            coordinates[759] = 0.055555555555600003;
-            coordinates[760] = 0.38888888888899997;
-            coordinates[761] = 0.166666666667;
-            coordinates[762] = 0.055555555555600003;
-            coordinates[763] = 0.5;
-            coordinates[764] = 0.055555555555600003;
-            coordinates[765] = 0.166666666667;
-            coordinates[766] = 0.055555555555600003;
-            coordinates[767] = 0.38888888888899997;
-            coordinates[768] = 0.166666666667;
-            coordinates[769] = 0.166666666667;
-            coordinates[770] = 0.277777777778;
-            coordinates[771] = 0.166666666667;
-            coordinates[772] = 0.277777777778;
-            coordinates[773] = 0.166666666667;
-            coordinates[774] = 0.166666666667;
-            coordinates[775] = 0.38888888888899997;
-            coordinates[776] = 0.055555555555600003;
-            coordinates[777] = 0.277777777778;
-            coordinates[778] = 0.055555555555600003;
-            coordinates[779] = 0.277777777778;
-            coordinates[780] = 0.277777777778;
-            coordinates[781] = 0.166666666667;
-            coordinates[782] = 0.166666666667;
-            coordinates[783] = 0.277777777778;
-            coordinates[784] = 0.277777777778;
-            coordinates[785] = 0.055555555555600003;
-            coordinates[786] = 0.38888888888899997;
-            coordinates[787] = 0.055555555555600003;
-            coordinates[788] = 0.166666666667;
-            coordinates[789] = 0.38888888888899997;
-            coordinates[790] = 0.166666666667;
-            coordinates[791] = 0.055555555555600003;
-            coordinates[792] = 0.5;
-            coordinates[793] = 0.055555555555600003;
-            coordinates[794] = 0.055555555555600003;
-            coordinates[795] = 0.055555555555600003;
-            coordinates[796] = 0.055555555555600003;
-            coordinates[797] = 0.38888888888899997;
-            coordinates[798] = 0.055555555555600003;
-            coordinates[799] = 0.166666666667;
-            coordinates[800] = 0.277777777778;
-            coordinates[801] = 0.055555555555600003;
-            coordinates[802] = 0.277777777778;
-            coordinates[803] = 0.166666666667;
-            coordinates[804] = 0.055555555555600003;
-            coordinates[805] = 0.38888888888899997;
-            coordinates[806] = 0.055555555555600003;
-            coordinates[807] = 0.166666666667;
-            coordinates[808] = 0.055555555555600003;
-            coordinates[809] = 0.277777777778;
-            coordinates[810] = 0.166666666667;
-            coordinates[811] = 0.166666666667;
-            coordinates[812] = 0.166666666667;
-            coordinates[813] = 0.166666666667;
-            coordinates[814] = 0.277777777778;
-            coordinates[815] = 0.055555555555600003;
-            coordinates[816] = 0.277777777778;
-            coordinates[817] = 0.055555555555600003;
-            coordinates[818] = 0.166666666667;
-            coordinates[819] = 0.277777777778;
-            coordinates[820] = 0.166666666667;
-            coordinates[821] = 0.055555555555600003;
-            coordinates[822] = 0.38888888888899997;
-            coordinates[823] = 0.055555555555600003;
-            coordinates[824] = 0.055555555555600003;
-            coordinates[825] = 0.055555555555600003;
-            coordinates[826] = 0.055555555555600003;
-            coordinates[827] = 0.277777777778;
-            coordinates[828] = 0.055555555555600003;
-            coordinates[829] = 0.166666666667;
-            coordinates[830] = 0.166666666667;
-            coordinates[831] = 0.055555555555600003;
-            coordinates[832] = 0.277777777778;
-            coordinates[833] = 0.055555555555600003;
-            coordinates[834] = 0.166666666667;
-            coordinates[835] = 0.055555555555600003;
-            coordinates[836] = 0.166666666667;
-            coordinates[837] = 0.166666666667;
-            coordinates[838] = 0.166666666667;
-            coordinates[839] = 0.055555555555600003;
-            coordinates[840] = 0.277777777778;
-            coordinates[841] = 0.055555555555600003;
-            coordinates[842] = 0.055555555555600003;
-            coordinates[843] = 0.055555555555600003;
-            coordinates[844] = 0.055555555555600003;
-            coordinates[845] = 0.166666666667;
-            coordinates[846] = 0.055555555555600003;
-            coordinates[847] = 0.166666666667;
-            coordinates[848] = 0.055555555555600003;
-            coordinates[849] = 0.166666666667;
-            coordinates[850] = 0.055555555555600003;
-            coordinates[851] = 0.055555555555600003;
-            coordinates[852] = 0.055555555555600003;
-            coordinates[853] = 0.055555555555600003;
-            coordinates[854] = 0.055555555555600003;
-            coordinates[855] = 0.0625;
-            coordinates[856] = 0.0625;
-            coordinates[857] = 0.8125;
-            coordinates[858] = 0.0625;
-            coordinates[859] = 0.1875;
-            coordinates[860] = 0.6875;
-            coordinates[861] = 0.0625;
-            coordinates[862] = 0.3125;
-            coordinates[863] = 0.5625;
-            coordinates[864] = 0.0625;
-            coordinates[865] = 0.4375;
-            coordinates[866] = 0.4375;
-            coordinates[867] = 0.0625;
-            coordinates[868] = 0.5625;
-            coordinates[869] = 0.3125;
-            coordinates[870] = 0.0625;
-            coordinates[871] = 0.6875;
-            coordinates[872] = 0.1875;
-            coordinates[873] = 0.0625;
-            coordinates[874] = 0.8125;
-            coordinates[875] = 0.0625;
-            coordinates[876] = 0.1875;
-            coordinates[877] = 0.0625;
-            coordinates[878] = 0.6875;
-            coordinates[879] = 0.1875;
-            coordinates[880] = 0.1875;
-            coordinates[881] = 0.5625;
-            coordinates[882] = 0.1875;
-            coordinates[883] = 0.3125;
-            coordinates[884] = 0.4375;
-            coordinates[885] = 0.1875;
-            coordinates[886] = 0.4375;
-            coordinates[887] = 0.3125;
-            coordinates[888] = 0.1875;
-            coordinates[889] = 0.5625;
-            coordinates[890] = 0.1875;
-            coordinates[891] = 0.1875;
-            coordinates[892] = 0.6875;
-            coordinates[893] = 0.0625;
-            coordinates[894] = 0.3125;
-            coordinates[895] = 0.0625;
-            coordinates[896] = 0.5625;
-            coordinates[897] = 0.3125;
-            coordinates[898] = 0.1875;
-            coordinates[899] = 0.4375;
-            coordinates[900] = 0.3125;
-            coordinates[901] = 0.3125;
-            coordinates[902] = 0.3125;
-            coordinates[903] = 0.3125;
-            coordinates[904] = 0.4375;
-            coordinates[905] = 0.1875;
-            coordinates[906] = 0.3125;
-            coordinates[907] = 0.5625;
-            coordinates[908] = 0.0625;
-            coordinates[909] = 0.4375;
-            coordinates[910] = 0.0625;
-            coordinates[911] = 0.4375;
-            coordinates[912] = 0.4375;
-            coordinates[913] = 0.1875;
-            coordinates[914] = 0.3125;
-            coordinates[915] = 0.4375;
-            coordinates[916] = 0.3125;
-            coordinates[917] = 0.1875;
-            coordinates[918] = 0.4375;
-            coordinates[919] = 0.4375;
-            coordinates[920] = 0.0625;
-            coordinates[921] = 0.5625;
-            coordinates[922] = 0.0625;
-            coordinates[923] = 0.3125;
-            coordinates[924] = 0.5625;
-            coordinates[925] = 0.1875;
-            coordinates[926] = 0.1875;
-            coordinates[927] = 0.5625;
-            coordinates[928] = 0.3125;
-            coordinates[929] = 0.0625;
-            coordinates[930] = 0.6875;
-            coordinates[931] = 0.0625;
-            coordinates[932] = 0.1875;
-            coordinates[933] = 0.6875;
-            coordinates[934] = 0.1875;
-            coordinates[935] = 0.0625;
-            coordinates[936] = 0.8125;
-            coordinates[937] = 0.0625;
-            coordinates[938] = 0.0625;
-            coordinates[939] = 0.0625;
-            coordinates[940] = 0.0625;
-            coordinates[941] = 0.6875;
-            coordinates[942] = 0.0625;
-            coordinates[943] = 0.1875;
-            coordinates[944] = 0.5625;
-            coordinates[945] = 0.0625;
-            coordinates[946] = 0.3125;
-            coordinates[947] = 0.4375;
-            coordinates[948] = 0.0625;
-            coordinates[949] = 0.4375;
-            coordinates[950] = 0.3125;
-            coordinates[951] = 0.0625;
-            coordinates[952] = 0.5625;
-            coordinates[953] = 0.1875;
-            coordinates[954] = 0.0625;
-            coordinates[955] = 0.6875;
-            coordinates[956] = 0.0625;
-            coordinates[957] = 0.1875;
-            coordinates[958] = 0.0625;
-            coordinates[959] = 0.5625;
-            coordinates[960] = 0.1875;
-            coordinates[961] = 0.1875;
-            coordinates[962] = 0.4375;
-            coordinates[963] = 0.1875;
-            coordinates[964] = 0.3125;
-            coordinates[965] = 0.3125;
-            coordinates[966] = 0.1875;
-            coordinates[967] = 0.4375;
-            coordinates[968] = 0.1875;
-            coordinates[969] = 0.1875;
-            coordinates[970] = 0.5625;
-            coordinates[971] = 0.0625;
-            coordinates[972] = 0.3125;
-            coordinates[973] = 0.0625;
-            coordinates[974] = 0.4375;
-            coordinates[975] = 0.3125;
-            coordinates[976] = 0.1875;
-            coordinates[977] = 0.3125;
-            coordinates[978] = 0.3125;
-            coordinates[979] = 0.3125;
-            coordinates[980] = 0.1875;
-            coordinates[981] = 0.3125;
-            coordinates[982] = 0.4375;
-            coordinates[983] = 0.0625;
-            coordinates[984] = 0.4375;
-            coordinates[985] = 0.0625;
-            coordinates[986] = 0.3125;
-            coordinates[987] = 0.4375;
-            coordinates[988] = 0.1875;
-            coordinates[989] = 0.1875;
-            coordinates[990] = 0.4375;
-            coordinates[991] = 0.3125;
-            coordinates[992] = 0.0625;
-            coordinates[993] = 0.5625;
-            coordinates[994] = 0.0625;
-            coordinates[995] = 0.1875;
-            coordinates[996] = 0.5625;
-            coordinates[997] = 0.1875;
-            coordinates[998] = 0.0625;
-            coordinates[999] = 0.6875;
-            coordinates[1000] = 0.0625;
-            coordinates[1001] = 0.0625;
-            coordinates[1002] = 0.0625;
-            coordinates[1003] = 0.0625;
-            coordinates[1004] = 0.5625;
-            coordinates[1005] = 0.0625;
-            coordinates[1006] = 0.1875;
-            coordinates[1007] = 0.4375;
-            coordinates[1008] = 0.0625;
-            coordinates[1009] = 0.3125;
-            coordinates[1010] = 0.3125;
-            coordinates[1011] = 0.0625;
-            coordinates[1012] = 0.4375;
-            coordinates[1013] = 0.1875;
-            coordinates[1014] = 0.0625;
-            coordinates[1015] = 0.5625;
-            coordinates[1016] = 0.0625;
-            coordinates[1017] = 0.1875;
-            coordinates[1018] = 0.0625;
-            coordinates[1019] = 0.4375;
-            coordinates[1020] = 0.1875;
-            coordinates[1021] = 0.1875;
-            coordinates[1022] = 0.3125;
-            coordinates[1023] = 0.1875;
-            coordinates[1024] = 0.3125;
-            coordinates[1025] = 0.1875;
-            coordinates[1026] = 0.1875;
-            coordinates[1027] = 0.4375;
-            coordinates[1028] = 0.0625;
-            coordinates[1029] = 0.3125;
-            coordinates[1030] = 0.0625;
-            coordinates[1031] = 0.3125;
-            coordinates[1032] = 0.3125;
-            coordinates[1033] = 0.1875;
-            coordinates[1034] = 0.1875;
-            coordinates[1035] = 0.3125;
-            coordinates[1036] = 0.3125;
-            coordinates[1037] = 0.0625;
-            coordinates[1038] = 0.4375;
-            coordinates[1039] = 0.0625;
-            coordinates[1040] = 0.1875;
-            coordinates[1041] = 0.4375;
-            coordinates[1042] = 0.1875;
-            coordinates[1043] = 0.0625;
-            coordinates[1044] = 0.5625;
-            coordinates[1045] = 0.0625;
-            coordinates[1046] = 0.0625;
-            coordinates[1047] = 0.0625;
-            coordinates[1048] = 0.0625;
-            coordinates[1049] = 0.4375;
-            coordinates[1050] = 0.0625;
-            coordinates[1051] = 0.1875;
-            coordinates[1052] = 0.3125;
-            coordinates[1053] = 0.0625;
-            coordinates[1054] = 0.3125;
-            coordinates[1055] = 0.1875;
-            coordinates[1056] = 0.0625;
-            coordinates[1057] = 0.4375;
-            coordinates[1058] = 0.0625;
-            coordinates[1059] = 0.1875;
-            coordinates[1060] = 0.0625;
-            coordinates[1061] = 0.3125;
-            coordinates[1062] = 0.1875;
-            coordinates[1063] = 0.1875;
-            coordinates[1064] = 0.1875;
-            coordinates[1065] = 0.1875;
-            coordinates[1066] = 0.3125;
-            coordinates[1067] = 0.0625;
-            coordinates[1068] = 0.3125;
-            coordinates[1069] = 0.0625;
-            coordinates[1070] = 0.1875;
-            coordinates[1071] = 0.3125;
-            coordinates[1072] = 0.1875;
-            coordinates[1073] = 0.0625;
-            coordinates[1074] = 0.4375;
-            coordinates[1075] = 0.0625;
-            coordinates[1076] = 0.0625;
-            coordinates[1077] = 0.0625;
-            coordinates[1078] = 0.0625;
-            coordinates[1079] = 0.3125;
-            coordinates[1080] = 0.0625;
-            coordinates[1081] = 0.1875;
-            coordinates[1082] = 0.1875;
-            coordinates[1083] = 0.0625;
-            coordinates[1084] = 0.3125;
-            coordinates[1085] = 0.0625;
-            coordinates[1086] = 0.1875;
-            coordinates[1087] = 0.0625;
-            coordinates[1088] = 0.1875;
-            coordinates[1089] = 0.1875;
-            coordinates[1090] = 0.1875;
-            coordinates[1091] = 0.0625;
-            coordinates[1092] = 0.3125;
-            coordinates[1093] = 0.0625;
-            coordinates[1094] = 0.0625;
-            coordinates[1095] = 0.0625;
-            coordinates[1096] = 0.0625;
-            coordinates[1097] = 0.1875;
-            coordinates[1098] = 0.0625;
-            coordinates[1099] = 0.1875;
-            coordinates[1100] = 0.0625;
-            coordinates[1101] = 0.1875;
-            coordinates[1102] = 0.0625;
-            coordinates[1103] = 0.0625;
-            coordinates[1104] = 0.0625;
-            coordinates[1105] = 0.0625;
-            coordinates[1106] = 0.0625;
-            coordinates[1107] = 0.071428571428599999;
-            coordinates[1108] = 0.071428571428599999;
-            coordinates[1109] = 0.78571428571400004;
-            coordinates[1110] = 0.071428571428599999;
-            coordinates[1111] = 0.21428571428599999;
-            coordinates[1112] = 0.64285714285700002;
-            coordinates[1113] = 0.071428571428599999;
-            coordinates[1114] = 0.35714285714299998;
-            coordinates[1115] = 0.5;
-            coordinates[1116] = 0.071428571428599999;
-            coordinates[1117] = 0.5;
-            coordinates[1118] = 0.35714285714299998;
-            coordinates[1119] = 0.071428571428599999;
-            coordinates[1120] = 0.64285714285700002;
-            coordinates[1121] = 0.21428571428599999;
-            coordinates[1122] = 0.071428571428599999;
-            coordinates[1123] = 0.78571428571400004;
-            coordinates[1124] = 0.071428571428599999;
-            coordinates[1125] = 0.21428571428599999;
-            coordinates[1126] = 0.071428571428599999;
-            coordinates[1127] = 0.64285714285700002;
-            coordinates[1128] = 0.21428571428599999;
-            coordinates[1129] = 0.21428571428599999;
-            coordinates[1130] = 0.5;
-            coordinates[1131] = 0.21428571428599999;
-            coordinates[1132] = 0.35714285714299998;
-            coordinates[1133] = 0.35714285714299998;
-            coordinates[1134] = 0.21428571428599999;
-            coordinates[1135] = 0.5;
-            coordinates[1136] = 0.21428571428599999;
-            coordinates[1137] = 0.21428571428599999;
-            coordinates[1138] = 0.64285714285700002;
-            coordinates[1139] = 0.071428571428599999;
-            coordinates[1140] = 0.35714285714299998;
-            coordinates[1141] = 0.071428571428599999;
-            coordinates[1142] = 0.5;
-            coordinates[1143] = 0.35714285714299998;
-            coordinates[1144] = 0.21428571428599999;
-            coordinates[1145] = 0.35714285714299998;
-            coordinates[1146] = 0.35714285714299998;
-            coordinates[1147] = 0.35714285714299998;
-            coordinates[1148] = 0.21428571428599999;
-            coordinates[1149] = 0.35714285714299998;
-            coordinates[1150] = 0.5;
-            coordinates[1151] = 0.071428571428599999;
-            coordinates[1152] = 0.5;
-            coordinates[1153] = 0.071428571428599999;
-            coordinates[1154] = 0.35714285714299998;
-            coordinates[1155] = 0.5;
-            coordinates[1156] = 0.21428571428599999;
-            coordinates[1157] = 0.21428571428599999;
-            coordinates[1158] = 0.5;
-            coordinates[1159] = 0.35714285714299998;
-            coordinates[1160] = 0.071428571428599999;
-            coordinates[1161] = 0.64285714285700002;
-            coordinates[1162] = 0.071428571428599999;
-            coordinates[1163] = 0.21428571428599999;
-            coordinates[1164] = 0.64285714285700002;
-            coordinates[1165] = 0.21428571428599999;
-            coordinates[1166] = 0.071428571428599999;
-            coordinates[1167] = 0.78571428571400004;
-            coordinates[1168] = 0.071428571428599999;
-            coordinates[1169] = 0.071428571428599999;
-            coordinates[1170] = 0.071428571428599999;
-            coordinates[1171] = 0.071428571428599999;
-            coordinates[1172] = 0.64285714285700002;
-            coordinates[1173] = 0.071428571428599999;
-            coordinates[1174] = 0.21428571428599999;
-            coordinates[1175] = 0.5;
-            coordinates[1176] = 0.071428571428599999;
-            coordinates[1177] = 0.35714285714299998;
-            coordinates[1178] = 0.35714285714299998;
-            coordinates[1179] = 0.071428571428599999;
-            coordinates[1180] = 0.5;
-            coordinates[1181] = 0.21428571428599999;
-            coordinates[1182] = 0.071428571428599999;
-            coordinates[1183] = 0.64285714285700002;
-            coordinates[1184] = 0.071428571428599999;
-            coordinates[1185] = 0.21428571428599999;
-            coordinates[1186] = 0.071428571428599999;
-            coordinates[1187] = 0.5;
-            coordinates[1188] = 0.21428571428599999;
-            coordinates[1189] = 0.21428571428599999;
-            coordinates[1190] = 0.35714285714299998;
-            coordinates[1191] = 0.21428571428599999;
-            coordinates[1192] = 0.35714285714299998;
-            coordinates[1193] = 0.21428571428599999;
-            coordinates[1194] = 0.21428571428599999;
-            coordinates[1195] = 0.5;
-            coordinates[1196] = 0.071428571428599999;
-            coordinates[1197] = 0.35714285714299998;
-            coordinates[1198] = 0.071428571428599999;
-            coordinates[1199] = 0.35714285714299998;
-            coordinates[1200] = 0.35714285714299998;
-            coordinates[1201] = 0.21428571428599999;
-            coordinates[1202] = 0.21428571428599999;
-            coordinates[1203] = 0.35714285714299998;
-            coordinates[1204] = 0.35714285714299998;
-            coordinates[1205] = 0.071428571428599999;
-            coordinates[1206] = 0.5;
-            coordinates[1207] = 0.071428571428599999;
-            coordinates[1208] = 0.21428571428599999;
-            coordinates[1209] = 0.5;
-            coordinates[1210] = 0.21428571428599999;
-            coordinates[1211] = 0.071428571428599999;
-            coordinates[1212] = 0.64285714285700002;
-            coordinates[1213] = 0.071428571428599999;
-            coordinates[1214] = 0.071428571428599999;
-            coordinates[1215] = 0.071428571428599999;
-            coordinates[1216] = 0.071428571428599999;
-            coordinates[1217] = 0.5;
-            coordinates[1218] = 0.071428571428599999;
-            coordinates[1219] = 0.21428571428599999;
-            coordinates[1220] = 0.35714285714299998;
-            coordinates[1221] = 0.071428571428599999;
-            coordinates[1222] = 0.35714285714299998;
-            coordinates[1223] = 0.21428571428599999;
-            coordinates[1224] = 0.071428571428599999;
-            coordinates[1225] = 0.5;
-            coordinates[1226] = 0.071428571428599999;
-            coordinates[1227] = 0.21428571428599999;
-            coordinates[1228] = 0.071428571428599999;
-            coordinates[1229] = 0.35714285714299998;
-            coordinates[1230] = 0.21428571428599999;
-            coordinates[1231] = 0.21428571428599999;
-            coordinates[1232] = 0.21428571428599999;
-            coordinates[1233] = 0.21428571428599999;
-            coordinates[1234] = 0.35714285714299998;
-            coordinates[1235] = 0.071428571428599999;
-            coordinates[1236] = 0.35714285714299998;
-            coordinates[1237] = 0.071428571428599999;
-            coordinates[1238] = 0.21428571428599999;
-            coordinates[1239] = 0.35714285714299998;
-            coordinates[1240] = 0.21428571428599999;
-            coordinates[1241] = 0.071428571428599999;
-            coordinates[1242] = 0.5;
-            coordinates[1243] = 0.071428571428599999;
-            coordinates[1244] = 0.071428571428599999;
-            coordinates[1245] = 0.071428571428599999;
-            coordinates[1246] = 0.071428571428599999;
-            coordinates[1247] = 0.35714285714299998;
-            coordinates[1248] = 0.071428571428599999;
-            coordinates[1249] = 0.21428571428599999;
-            coordinates[1250] = 0.21428571428599999;
-            coordinates[1251] = 0.071428571428599999;
-            coordinates[1252] = 0.35714285714299998;
-            coordinates[1253] = 0.071428571428599999;
-            coordinates[1254] = 0.21428571428599999;
-            coordinates[1255] = 0.071428571428599999;
-            coordinates[1256] = 0.21428571428599999;
-            coordinates[1257] = 0.21428571428599999;
-            coordinates[1258] = 0.21428571428599999;
-            coordinates[1259] = 0.071428571428599999;
-            coordinates[1260] = 0.35714285714299998;
-            coordinates[1261] = 0.071428571428599999;
-            coordinates[1262] = 0.071428571428599999;
-            coordinates[1263] = 0.071428571428599999;
-            coordinates[1264] = 0.071428571428599999;
-            coordinates[1265] = 0.21428571428599999;
-            coordinates[1266] = 0.071428571428599999;
-            coordinates[1267] = 0.21428571428599999;
-            coordinates[1268] = 0.071428571428599999;
-            coordinates[1269] = 0.21428571428599999;
-            coordinates[1270] = 0.071428571428599999;
-            coordinates[1271] = 0.071428571428599999;
-            coordinates[1272] = 0.071428571428599999;
-            coordinates[1273] = 0.071428571428599999;
-            coordinates[1274] = 0.071428571428599999;
-            coordinates[1275] = 0.083333333333299994;
-            coordinates[1276] = 0.083333333333299994;
-            coordinates[1277] = 0.75;
-            coordinates[1278] = 0.083333333333299994;
-            coordinates[1279] = 0.25;
-            coordinates[1280] = 0.58333333333299997;
-            coordinates[1281] = 0.083333333333299994;
-            coordinates[1282] = 0.41666666666699997;
-            coordinates[1283] = 0.41666666666699997;
-            coordinates[1284] = 0.083333333333299994;
-            coordinates[1285] = 0.58333333333299997;
-            coordinates[1286] = 0.25;
-            coordinates[1287] = 0.083333333333299994;
-            coordinates[1288] = 0.75;
-            coordinates[1289] = 0.083333333333299994;
-            coordinates[1290] = 0.25;
-            coordinates[1291] = 0.083333333333299994;
-            coordinates[1292] = 0.58333333333299997;
-            coordinates[1293] = 0.25;
-            coordinates[1294] = 0.25;
-            coordinates[1295] = 0.41666666666699997;
-            coordinates[1296] = 0.25;
-            coordinates[1297] = 0.41666666666699997;
-            coordinates[1298] = 0.25;
-            coordinates[1299] = 0.25;
-            coordinates[1300] = 0.58333333333299997;
-            coordinates[1301] = 0.083333333333299994;
-            coordinates[1302] = 0.41666666666699997;
-            coordinates[1303] = 0.083333333333299994;
-            coordinates[1304] = 0.41666666666699997;
-            coordinates[1305] = 0.41666666666699997;
-            coordinates[1306] = 0.25;
-            coordinates[1307] = 0.25;
-            coordinates[1308] = 0.41666666666699997;
-            coordinates[1309] = 0.41666666666699997;
-            coordinates[1310] = 0.083333333333299994;
-            coordinates[1311] = 0.58333333333299997;
-            coordinates[1312] = 0.083333333333299994;
-            coordinates[1313] = 0.25;
-            coordinates[1314] = 0.58333333333299997;
-            coordinates[1315] = 0.25;
-            coordinates[1316] = 0.083333333333299994;
-            coordinates[1317] = 0.75;
-            coordinates[1318] = 0.083333333333299994;
-            coordinates[1319] = 0.083333333333299994;
-            coordinates[1320] = 0.083333333333299994;
-            coordinates[1321] = 0.083333333333299994;
-            coordinates[1322] = 0.58333333333299997;
-            coordinates[1323] = 0.083333333333299994;
-            coordinates[1324] = 0.25;
-            coordinates[1325] = 0.41666666666699997;
-            coordinates[1326] = 0.083333333333299994;
-            coordinates[1327] = 0.41666666666699997;
-            coordinates[1328] = 0.25;
-            coordinates[1329] = 0.083333333333299994;
-            coordinates[1330] = 0.58333333333299997;
-            coordinates[1331] = 0.083333333333299994;
-            coordinates[1332] = 0.25;
-            coordinates[1333] = 0.083333333333299994;
-            coordinates[1334] = 0.41666666666699997;
-            coordinates[1335] = 0.25;
-            coordinates[1336] = 0.25;
-            coordinates[1337] = 0.25;
-            coordinates[1338] = 0.25;
-            coordinates[1339] = 0.41666666666699997;
-            coordinates[1340] = 0.083333333333299994;
-            coordinates[1341] = 0.41666666666699997;
-            coordinates[1342] = 0.083333333333299994;
-            coordinates[1343] = 0.25;
-            coordinates[1344] = 0.41666666666699997;
-            coordinates[1345] = 0.25;
-            coordinates[1346] = 0.083333333333299994;
-            coordinates[1347] = 0.58333333333299997;
-            coordinates[1348] = 0.083333333333299994;
-            coordinates[1349] = 0.083333333333299994;
-            coordinates[1350] = 0.083333333333299994;
-            coordinates[1351] = 0.083333333333299994;
-            coordinates[1352] = 0.41666666666699997;
-            coordinates[1353] = 0.083333333333299994;
-            coordinates[1354] = 0.25;
-            coordinates[1355] = 0.25;
-            coordinates[1356] = 0.083333333333299994;
-            coordinates[1357] = 0.41666666666699997;
-            coordinates[1358] = 0.083333333333299994;
-            coordinates[1359] = 0.25;
-            coordinates[1360] = 0.083333333333299994;
-            coordinates[1361] = 0.25;
-            coordinates[1362] = 0.25;
-            coordinates[1363] = 0.25;
-            coordinates[1364] = 0.083333333333299994;
-            coordinates[1365] = 0.41666666666699997;
-            coordinates[1366] = 0.083333333333299994;
-            coordinates[1367] = 0.083333333333299994;
-            coordinates[1368] = 0.083333333333299994;
-            coordinates[1369] = 0.083333333333299994;
-            coordinates[1370] = 0.25;
-            coordinates[1371] = 0.083333333333299994;
-            coordinates[1372] = 0.25;
-            coordinates[1373] = 0.083333333333299994;
-            coordinates[1374] = 0.25;
-            coordinates[1375] = 0.083333333333299994;
-            coordinates[1376] = 0.083333333333299994;
-            coordinates[1377] = 0.083333333333299994;
-            coordinates[1378] = 0.083333333333299994;
-            coordinates[1379] = 0.083333333333299994;
-            coordinates[1380] = 0.10000000000000001;
-            coordinates[1381] = 0.10000000000000001;
-            coordinates[1382] = 0.69999999999999996;
-            coordinates[1383] = 0.10000000000000001;
-            coordinates[1384] = 0.29999999999999999;
-            coordinates[1385] = 0.5;
-            coordinates[1386] = 0.10000000000000001;
-            coordinates[1387] = 0.5;
-            coordinates[1388] = 0.29999999999999999;
-            coordinates[1389] = 0.10000000000000001;
-            coordinates[1390] = 0.69999999999999996;
-            coordinates[1391] = 0.10000000000000001;
-            coordinates[1392] = 0.29999999999999999;
-            coordinates[1393] = 0.10000000000000001;
-            coordinates[1394] = 0.5;
-            coordinates[1395] = 0.29999999999999999;
-            coordinates[1396] = 0.29999999999999999;
-            coordinates[1397] = 0.29999999999999999;
-            coordinates[1398] = 0.29999999999999999;
-            coordinates[1399] = 0.5;
-            coordinates[1400] = 0.10000000000000001;
-            coordinates[1401] = 0.5;
-            coordinates[1402] = 0.10000000000000001;
-            coordinates[1403] = 0.29999999999999999;
-            coordinates[1404] = 0.5;
-            coordinates[1405] = 0.29999999999999999;
-            coordinates[1406] = 0.10000000000000001;
-            coordinates[1407] = 0.69999999999999996;
-            coordinates[1408] = 0.10000000000000001;
-            coordinates[1409] = 0.10000000000000001;
-            coordinates[1410] = 0.10000000000000001;
-            coordinates[1411] = 0.10000000000000001;
-            coordinates[1412] = 0.5;
-            coordinates[1413] = 0.10000000000000001;
-            coordinates[1414] = 0.29999999999999999;
-            coordinates[1415] = 0.29999999999999999;
-            coordinates[1416] = 0.10000000000000001;
-            coordinates[1417] = 0.5;
-            coordinates[1418] = 0.10000000000000001;
-            coordinates[1419] = 0.29999999999999999;
-            coordinates[1420] = 0.10000000000000001;
-            coordinates[1421] = 0.29999999999999999;
-            coordinates[1422] = 0.29999999999999999;
-            coordinates[1423] = 0.29999999999999999;
-            coordinates[1424] = 0.10000000000000001;
-            coordinates[1425] = 0.5;
-            coordinates[1426] = 0.10000000000000001;
-            coordinates[1427] = 0.10000000000000001;
-            coordinates[1428] = 0.10000000000000001;
-            coordinates[1429] = 0.10000000000000001;
-            coordinates[1430] = 0.29999999999999999;
-            coordinates[1431] = 0.10000000000000001;
-            coordinates[1432] = 0.29999999999999999;
-            coordinates[1433] = 0.10000000000000001;
-            coordinates[1434] = 0.29999999999999999;
-            coordinates[1435] = 0.10000000000000001;
-            coordinates[1436] = 0.10000000000000001;
-            coordinates[1437] = 0.10000000000000001;
-            coordinates[1438] = 0.10000000000000001;
-            coordinates[1439] = 0.10000000000000001;
-            coordinates[1440] = 0.125;
-            coordinates[1441] = 0.125;
-            coordinates[1442] = 0.625;
-            coordinates[1443] = 0.125;
-            coordinates[1444] = 0.375;
-            coordinates[1445] = 0.375;
-            coordinates[1446] = 0.125;
-            coordinates[1447] = 0.625;
-            coordinates[1448] = 0.125;
-            coordinates[1449] = 0.375;
-            coordinates[1450] = 0.125;
-            coordinates[1451] = 0.375;
-            coordinates[1452] = 0.375;
-            coordinates[1453] = 0.375;
-            coordinates[1454] = 0.125;
-            coordinates[1455] = 0.625;
-            coordinates[1456] = 0.125;
-            coordinates[1457] = 0.125;
-            coordinates[1458] = 0.125;
-            coordinates[1459] = 0.125;
-            coordinates[1460] = 0.375;
-            coordinates[1461] = 0.125;
-            coordinates[1462] = 0.375;
-            coordinates[1463] = 0.125;
-            coordinates[1464] = 0.375;
-            coordinates[1465] = 0.125;
-            coordinates[1466] = 0.125;
-            coordinates[1467] = 0.125;
-            coordinates[1468] = 0.125;
-            coordinates[1469] = 0.125;
-            coordinates[1470] = 0.166666666667;
-            coordinates[1471] = 0.166666666667;
-            coordinates[1472] = 0.5;
-            coordinates[1473] = 0.166666666667;
-            coordinates[1474] = 0.5;
-            coordinates[1475] = 0.166666666667;
-            coordinates[1476] = 0.5;
-            coordinates[1477] = 0.166666666667;
-            coordinates[1478] = 0.166666666667;
-            coordinates[1479] = 0.166666666667;
-            coordinates[1480] = 0.166666666667;
-            coordinates[1481] = 0.166666666667;
-            coordinates[1482] = 0.25;
-            coordinates[1483] = 0.25;
-            coordinates[1484] = 0.25;
-
-            weights[0] = 0.082206352466167004;
-            weights[1] = 0.082206352466167004;
-            weights[2] = 0.082206352466167004;
-            weights[3] = 0.082206352466167004;
-            weights[4] = 0.082206352466167004;
-            weights[5] = 0.082206352466167004;
-            weights[6] = 0.082206352466167004;
-            weights[7] = 0.082206352466167004;
-            weights[8] = 0.082206352466167004;
-            weights[9] = 0.082206352466167004;
-            weights[10] = 0.082206352466167004;
-            weights[11] = 0.082206352466167004;
-            weights[12] = 0.082206352466167004;
-            weights[13] = 0.082206352466167004;
-            weights[14] = 0.082206352466167004;
-            weights[15] = 0.082206352466167004;
-            weights[16] = 0.082206352466167004;
-            weights[17] = 0.082206352466167004;
-            weights[18] = 0.082206352466167004;
-            weights[19] = 0.082206352466167004;
-            weights[20] = 0.082206352466167004;
-            weights[21] = 0.082206352466167004;
-            weights[22] = 0.082206352466167004;
-            weights[23] = 0.082206352466167004;
-            weights[24] = 0.082206352466167004;
-            weights[25] = 0.082206352466167004;
-            weights[26] = 0.082206352466167004;
-            weights[27] = 0.082206352466167004;
-            weights[28] = 0.082206352466167004;
-            weights[29] = 0.082206352466167004;
-            weights[30] = 0.082206352466167004;
-            weights[31] = 0.082206352466167004;
-            weights[32] = 0.082206352466167004;
-            weights[33] = 0.082206352466167004;
-            weights[34] = 0.082206352466167004;
-            weights[35] = 0.082206352466167004;
-            weights[36] = 0.082206352466167004;
-            weights[37] = 0.082206352466167004;
-            weights[38] = 0.082206352466167004;
-            weights[39] = 0.082206352466167004;
-            weights[40] = 0.082206352466167004;
-            weights[41] = 0.082206352466167004;
-            weights[42] = 0.082206352466167004;
-            weights[43] = 0.082206352466167004;
-            weights[44] = 0.082206352466167004;
-            weights[45] = 0.082206352466167004;
-            weights[46] = 0.082206352466167004;
-            weights[47] = 0.082206352466167004;
-            weights[48] = 0.082206352466167004;
-            weights[49] = 0.082206352466167004;
-            weights[50] = 0.082206352466167004;
-            weights[51] = 0.082206352466167004;
-            weights[52] = 0.082206352466167004;
-            weights[53] = 0.082206352466167004;
-            weights[54] = 0.082206352466167004;
-            weights[55] = 0.082206352466167004;
-            weights[56] = 0.082206352466167004;
-            weights[57] = 0.082206352466167004;
-            weights[58] = 0.082206352466167004;
-            weights[59] = 0.082206352466167004;
-            weights[60] = 0.082206352466167004;
-            weights[61] = 0.082206352466167004;
-            weights[62] = 0.082206352466167004;
-            weights[63] = 0.082206352466167004;
-            weights[64] = 0.082206352466167004;
-            weights[65] = 0.082206352466167004;
-            weights[66] = 0.082206352466167004;
-            weights[67] = 0.082206352466167004;
-            weights[68] = 0.082206352466167004;
-            weights[69] = 0.082206352466167004;
-            weights[70] = 0.082206352466167004;
-            weights[71] = 0.082206352466167004;
-            weights[72] = 0.082206352466167004;
-            weights[73] = 0.082206352466167004;
-            weights[74] = 0.082206352466167004;
-            weights[75] = 0.082206352466167004;
-            weights[76] = 0.082206352466167004;
-            weights[77] = 0.082206352466167004;
-            weights[78] = 0.082206352466167004;
-            weights[79] = 0.082206352466167004;
-            weights[80] = 0.082206352466167004;
-            weights[81] = 0.082206352466167004;
-            weights[82] = 0.082206352466167004;
-            weights[83] = 0.082206352466167004;
-            weights[84] = 0.082206352466167004;
-            weights[85] = 0.082206352466167004;
-            weights[86] = 0.082206352466167004;
-            weights[87] = 0.082206352466167004;
-            weights[88] = 0.082206352466167004;
-            weights[89] = 0.082206352466167004;
-            weights[90] = 0.082206352466167004;
-            weights[91] = 0.082206352466167004;
-            weights[92] = 0.082206352466167004;
-            weights[93] = 0.082206352466167004;
-            weights[94] = 0.082206352466167004;
-            weights[95] = 0.082206352466167004;
-            weights[96] = 0.082206352466167004;
-            weights[97] = 0.082206352466167004;
-            weights[98] = 0.082206352466167004;
-            weights[99] = 0.082206352466167004;
-            weights[100] = 0.082206352466167004;
-            weights[101] = 0.082206352466167004;
-            weights[102] = 0.082206352466167004;
-            weights[103] = 0.082206352466167004;
-            weights[104] = 0.082206352466167004;
-            weights[105] = 0.082206352466167004;
-            weights[106] = 0.082206352466167004;
-            weights[107] = 0.082206352466167004;
-            weights[108] = 0.082206352466167004;
-            weights[109] = 0.082206352466167004;
-            weights[110] = 0.082206352466167004;
-            weights[111] = 0.082206352466167004;
-            weights[112] = 0.082206352466167004;
-            weights[113] = 0.082206352466167004;
-            weights[114] = 0.082206352466167004;
-            weights[115] = 0.082206352466167004;
-            weights[116] = 0.082206352466167004;
-            weights[117] = 0.082206352466167004;
-            weights[118] = 0.082206352466167004;
-            weights[119] = 0.082206352466167004;
-            weights[120] = 0.082206352466167004;
-            weights[121] = 0.082206352466167004;
-            weights[122] = 0.082206352466167004;
-            weights[123] = 0.082206352466167004;
-            weights[124] = 0.082206352466167004;
-            weights[125] = 0.082206352466167004;
-            weights[126] = 0.082206352466167004;
-            weights[127] = 0.082206352466167004;
-            weights[128] = 0.082206352466167004;
-            weights[129] = 0.082206352466167004;
-            weights[130] = 0.082206352466167004;
-            weights[131] = 0.082206352466167004;
-            weights[132] = 0.082206352466167004;
-            weights[133] = 0.082206352466167004;
-            weights[134] = 0.082206352466167004;
-            weights[135] = 0.082206352466167004;
-            weights[136] = 0.082206352466167004;
-            weights[137] = 0.082206352466167004;
-            weights[138] = 0.082206352466167004;
-            weights[139] = 0.082206352466167004;
-            weights[140] = 0.082206352466167004;
-            weights[141] = 0.082206352466167004;
-            weights[142] = 0.082206352466167004;
-            weights[143] = 0.082206352466167004;
-            weights[144] = 0.082206352466167004;
-            weights[145] = 0.082206352466167004;
-            weights[146] = 0.082206352466167004;
-            weights[147] = 0.082206352466167004;
-            weights[148] = 0.082206352466167004;
-            weights[149] = 0.082206352466167004;
-            weights[150] = 0.082206352466167004;
-            weights[151] = 0.082206352466167004;
-            weights[152] = 0.082206352466167004;
-            weights[153] = 0.082206352466167004;
-            weights[154] = 0.082206352466167004;
-            weights[155] = 0.082206352466167004;
-            weights[156] = 0.082206352466167004;
-            weights[157] = 0.082206352466167004;
-            weights[158] = 0.082206352466167004;
-            weights[159] = 0.082206352466167004;
-            weights[160] = 0.082206352466167004;
-            weights[161] = 0.082206352466167004;
-            weights[162] = 0.082206352466167004;
-            weights[163] = 0.082206352466167004;
-            weights[164] = 0.082206352466167004;
-            weights[165] = -0.27419405539000002;
-            weights[166] = -0.27419405539000002;
-            weights[167] = -0.27419405539000002;
-            weights[168] = -0.27419405539000002;
-            weights[169] = -0.27419405539000002;
-            weights[170] = -0.27419405539000002;
-            weights[171] = -0.27419405539000002;
-            weights[172] = -0.27419405539000002;
-            weights[173] = -0.27419405539000002;
-            weights[174] = -0.27419405539000002;
-            weights[175] = -0.27419405539000002;
-            weights[176] = -0.27419405539000002;
-            weights[177] = -0.27419405539000002;
-            weights[178] = -0.27419405539000002;
-            weights[179] = -0.27419405539000002;
-            weights[180] = -0.27419405539000002;
-            weights[181] = -0.27419405539000002;
-            weights[182] = -0.27419405539000002;
-            weights[183] = -0.27419405539000002;
-            weights[184] = -0.27419405539000002;
-            weights[185] = -0.27419405539000002;
-            weights[186] = -0.27419405539000002;
-            weights[187] = -0.27419405539000002;
-            weights[188] = -0.27419405539000002;
-            weights[189] = -0.27419405539000002;
-            weights[190] = -0.27419405539000002;
-            weights[191] = -0.27419405539000002;
-            weights[192] = -0.27419405539000002;
-            weights[193] = -0.27419405539000002;
-            weights[194] = -0.27419405539000002;
-            weights[195] = -0.27419405539000002;
-            weights[196] = -0.27419405539000002;
-            weights[197] = -0.27419405539000002;
-            weights[198] = -0.27419405539000002;
-            weights[199] = -0.27419405539000002;
-            weights[200] = -0.27419405539000002;
-            weights[201] = -0.27419405539000002;
-            weights[202] = -0.27419405539000002;
-            weights[203] = -0.27419405539000002;
-            weights[204] = -0.27419405539000002;
-            weights[205] = -0.27419405539000002;
-            weights[206] = -0.27419405539000002;
-            weights[207] = -0.27419405539000002;
-            weights[208] = -0.27419405539000002;
-            weights[209] = -0.27419405539000002;
-            weights[210] = -0.27419405539000002;
-            weights[211] = -0.27419405539000002;
-            weights[212] = -0.27419405539000002;
-            weights[213] = -0.27419405539000002;
-            weights[214] = -0.27419405539000002;
-            weights[215] = -0.27419405539000002;
-            weights[216] = -0.27419405539000002;
-            weights[217] = -0.27419405539000002;
-            weights[218] = -0.27419405539000002;
-            weights[219] = -0.27419405539000002;
-            weights[220] = -0.27419405539000002;
-            weights[221] = -0.27419405539000002;
-            weights[222] = -0.27419405539000002;
-            weights[223] = -0.27419405539000002;
-            weights[224] = -0.27419405539000002;
-            weights[225] = -0.27419405539000002;
-            weights[226] = -0.27419405539000002;
-            weights[227] = -0.27419405539000002;
-            weights[228] = -0.27419405539000002;
-            weights[229] = -0.27419405539000002;
-            weights[230] = -0.27419405539000002;
-            weights[231] = -0.27419405539000002;
-            weights[232] = -0.27419405539000002;
-            weights[233] = -0.27419405539000002;
-            weights[234] = -0.27419405539000002;
-            weights[235] = -0.27419405539000002;
-            weights[236] = -0.27419405539000002;
-            weights[237] = -0.27419405539000002;
-            weights[238] = -0.27419405539000002;
-            weights[239] = -0.27419405539000002;
-            weights[240] = -0.27419405539000002;
-            weights[241] = -0.27419405539000002;
-            weights[242] = -0.27419405539000002;
-            weights[243] = -0.27419405539000002;
-            weights[244] = -0.27419405539000002;
-            weights[245] = -0.27419405539000002;
-            weights[246] = -0.27419405539000002;
-            weights[247] = -0.27419405539000002;
-            weights[248] = -0.27419405539000002;
-            weights[249] = -0.27419405539000002;
-            weights[250] = -0.27419405539000002;
-            weights[251] = -0.27419405539000002;
-            weights[252] = -0.27419405539000002;
-            weights[253] = -0.27419405539000002;
-            weights[254] = -0.27419405539000002;
-            weights[255] = -0.27419405539000002;
-            weights[256] = -0.27419405539000002;
-            weights[257] = -0.27419405539000002;
-            weights[258] = -0.27419405539000002;
-            weights[259] = -0.27419405539000002;
-            weights[260] = -0.27419405539000002;
-            weights[261] = -0.27419405539000002;
-            weights[262] = -0.27419405539000002;
-            weights[263] = -0.27419405539000002;
-            weights[264] = -0.27419405539000002;
-            weights[265] = -0.27419405539000002;
-            weights[266] = -0.27419405539000002;
-            weights[267] = -0.27419405539000002;
-            weights[268] = -0.27419405539000002;
-            weights[269] = -0.27419405539000002;
-            weights[270] = -0.27419405539000002;
-            weights[271] = -0.27419405539000002;
-            weights[272] = -0.27419405539000002;
-            weights[273] = -0.27419405539000002;
-            weights[274] = -0.27419405539000002;
-            weights[275] = -0.27419405539000002;
-            weights[276] = -0.27419405539000002;
-            weights[277] = -0.27419405539000002;
-            weights[278] = -0.27419405539000002;
-            weights[279] = -0.27419405539000002;
-            weights[280] = -0.27419405539000002;
-            weights[281] = -0.27419405539000002;
-            weights[282] = -0.27419405539000002;
-            weights[283] = -0.27419405539000002;
-            weights[284] = -0.27419405539000002;
-            weights[285] = 0.35171327341833297;
-            weights[286] = 0.35171327341833297;
-            weights[287] = 0.35171327341833297;
-            weights[288] = 0.35171327341833297;
-            weights[289] = 0.35171327341833297;
-            weights[290] = 0.35171327341833297;
-            weights[291] = 0.35171327341833297;
-            weights[292] = 0.35171327341833297;
-            weights[293] = 0.35171327341833297;
-            weights[294] = 0.35171327341833297;
-            weights[295] = 0.35171327341833297;
-            weights[296] = 0.35171327341833297;
-            weights[297] = 0.35171327341833297;
-            weights[298] = 0.35171327341833297;
-            weights[299] = 0.35171327341833297;
-            weights[300] = 0.35171327341833297;
-            weights[301] = 0.35171327341833297;
-            weights[302] = 0.35171327341833297;
-            weights[303] = 0.35171327341833297;
-            weights[304] = 0.35171327341833297;
-            weights[305] = 0.35171327341833297;
-            weights[306] = 0.35171327341833297;
-            weights[307] = 0.35171327341833297;
-            weights[308] = 0.35171327341833297;
-            weights[309] = 0.35171327341833297;
-            weights[310] = 0.35171327341833297;
-            weights[311] = 0.35171327341833297;
-            weights[312] = 0.35171327341833297;
-            weights[313] = 0.35171327341833297;
-            weights[314] = 0.35171327341833297;
-            weights[315] = 0.35171327341833297;
-            weights[316] = 0.35171327341833297;
-            weights[317] = 0.35171327341833297;
-            weights[318] = 0.35171327341833297;
-            weights[319] = 0.35171327341833297;
-            weights[320] = 0.35171327341833297;
-            weights[321] = 0.35171327341833297;
-            weights[322] = 0.35171327341833297;
-            weights[323] = 0.35171327341833297;
-            weights[324] = 0.35171327341833297;
-            weights[325] = 0.35171327341833297;
-            weights[326] = 0.35171327341833297;
-            weights[327] = 0.35171327341833297;
-            weights[328] = 0.35171327341833297;
-            weights[329] = 0.35171327341833297;
-            weights[330] = 0.35171327341833297;
-            weights[331] = 0.35171327341833297;
-            weights[332] = 0.35171327341833297;
-            weights[333] = 0.35171327341833297;
-            weights[334] = 0.35171327341833297;
-            weights[335] = 0.35171327341833297;
-            weights[336] = 0.35171327341833297;
-            weights[337] = 0.35171327341833297;
-            weights[338] = 0.35171327341833297;
-            weights[339] = 0.35171327341833297;
-            weights[340] = 0.35171327341833297;
-            weights[341] = 0.35171327341833297;
-            weights[342] = 0.35171327341833297;
-            weights[343] = 0.35171327341833297;
-            weights[344] = 0.35171327341833297;
-            weights[345] = 0.35171327341833297;
-            weights[346] = 0.35171327341833297;
-            weights[347] = 0.35171327341833297;
-            weights[348] = 0.35171327341833297;
-            weights[349] = 0.35171327341833297;
-            weights[350] = 0.35171327341833297;
-            weights[351] = 0.35171327341833297;
-            weights[352] = 0.35171327341833297;
-            weights[353] = 0.35171327341833297;
-            weights[354] = 0.35171327341833297;
-            weights[355] = 0.35171327341833297;
-            weights[356] = 0.35171327341833297;
-            weights[357] = 0.35171327341833297;
-            weights[358] = 0.35171327341833297;
-            weights[359] = 0.35171327341833297;
-            weights[360] = 0.35171327341833297;
-            weights[361] = 0.35171327341833297;
-            weights[362] = 0.35171327341833297;
-            weights[363] = 0.35171327341833297;
-            weights[364] = 0.35171327341833297;
-            weights[365] = 0.35171327341833297;
-            weights[366] = 0.35171327341833297;
-            weights[367] = 0.35171327341833297;
-            weights[368] = 0.35171327341833297;
-            weights[369] = -0.21801024870999999;
-            weights[370] = -0.21801024870999999;
-            weights[371] = -0.21801024870999999;
-            weights[372] = -0.21801024870999999;
-            weights[373] = -0.21801024870999999;
-            weights[374] = -0.21801024870999999;
-            weights[375] = -0.21801024870999999;
-            weights[376] = -0.21801024870999999;
-            weights[377] = -0.21801024870999999;
-            weights[378] = -0.21801024870999999;
-            weights[379] = -0.21801024870999999;
-            weights[380] = -0.21801024870999999;
-            weights[381] = -0.21801024870999999;
-            weights[382] = -0.21801024870999999;
-            weights[383] = -0.21801024870999999;
-            weights[384] = -0.21801024870999999;
-            weights[385] = -0.21801024870999999;
-            weights[386] = -0.21801024870999999;
-            weights[387] = -0.21801024870999999;
-            weights[388] = -0.21801024870999999;
-            weights[389] = -0.21801024870999999;
-            weights[390] = -0.21801024870999999;
-            weights[391] = -0.21801024870999999;
-            weights[392] = -0.21801024870999999;
-            weights[393] = -0.21801024870999999;
-            weights[394] = -0.21801024870999999;
-            weights[395] = -0.21801024870999999;
-            weights[396] = -0.21801024870999999;
-            weights[397] = -0.21801024870999999;
-            weights[398] = -0.21801024870999999;
-            weights[399] = -0.21801024870999999;
-            weights[400] = -0.21801024870999999;
-            weights[401] = -0.21801024870999999;
-            weights[402] = -0.21801024870999999;
-            weights[403] = -0.21801024870999999;
-            weights[404] = -0.21801024870999999;
-            weights[405] = -0.21801024870999999;
-            weights[406] = -0.21801024870999999;
-            weights[407] = -0.21801024870999999;
-            weights[408] = -0.21801024870999999;
-            weights[409] = -0.21801024870999999;
-            weights[410] = -0.21801024870999999;
-            weights[411] = -0.21801024870999999;
-            weights[412] = -0.21801024870999999;
-            weights[413] = -0.21801024870999999;
-            weights[414] = -0.21801024870999999;
-            weights[415] = -0.21801024870999999;
-            weights[416] = -0.21801024870999999;
-            weights[417] = -0.21801024870999999;
-            weights[418] = -0.21801024870999999;
-            weights[419] = -0.21801024870999999;
-            weights[420] = -0.21801024870999999;
-            weights[421] = -0.21801024870999999;
-            weights[422] = -0.21801024870999999;
-            weights[423] = -0.21801024870999999;
-            weights[424] = -0.21801024870999999;
-            weights[425] = 0.067417154274332994;
-            weights[426] = 0.067417154274332994;
-            weights[427] = 0.067417154274332994;
-            weights[428] = 0.067417154274332994;
-            weights[429] = 0.067417154274332994;
-            weights[430] = 0.067417154274332994;
-            weights[431] = 0.067417154274332994;
-            weights[432] = 0.067417154274332994;
-            weights[433] = 0.067417154274332994;
-            weights[434] = 0.067417154274332994;
-            weights[435] = 0.067417154274332994;
-            weights[436] = 0.067417154274332994;
-            weights[437] = 0.067417154274332994;
-            weights[438] = 0.067417154274332994;
-            weights[439] = 0.067417154274332994;
-            weights[440] = 0.067417154274332994;
-            weights[441] = 0.067417154274332994;
-            weights[442] = 0.067417154274332994;
-            weights[443] = 0.067417154274332994;
-            weights[444] = 0.067417154274332994;
-            weights[445] = 0.067417154274332994;
-            weights[446] = 0.067417154274332994;
-            weights[447] = 0.067417154274332994;
-            weights[448] = 0.067417154274332994;
-            weights[449] = 0.067417154274332994;
-            weights[450] = 0.067417154274332994;
-            weights[451] = 0.067417154274332994;
-            weights[452] = 0.067417154274332994;
-            weights[453] = 0.067417154274332994;
-            weights[454] = 0.067417154274332994;
-            weights[455] = 0.067417154274332994;
-            weights[456] = 0.067417154274332994;
-            weights[457] = 0.067417154274332994;
-            weights[458] = 0.067417154274332994;
-            weights[459] = 0.067417154274332994;
-            weights[460] = -0.0097238715258499992;
-            weights[461] = -0.0097238715258499992;
-            weights[462] = -0.0097238715258499992;
-            weights[463] = -0.0097238715258499992;
-            weights[464] = -0.0097238715258499992;
-            weights[465] = -0.0097238715258499992;
-            weights[466] = -0.0097238715258499992;
-            weights[467] = -0.0097238715258499992;
-            weights[468] = -0.0097238715258499992;
-            weights[469] = -0.0097238715258499992;
-            weights[470] = -0.0097238715258499992;
-            weights[471] = -0.0097238715258499992;
-            weights[472] = -0.0097238715258499992;
-            weights[473] = -0.0097238715258499992;
-            weights[474] = -0.0097238715258499992;
-            weights[475] = -0.0097238715258499992;
-            weights[476] = -0.0097238715258499992;
-            weights[477] = -0.0097238715258499992;
-            weights[478] = -0.0097238715258499992;
-            weights[479] = -0.0097238715258499992;
-            weights[480] = 0.00054740530225500005;
-            weights[481] = 0.00054740530225500005;
-            weights[482] = 0.00054740530225500005;
-            weights[483] = 0.00054740530225500005;
-            weights[484] = 0.00054740530225500005;
-            weights[485] = 0.00054740530225500005;
-            weights[486] = 0.00054740530225500005;
-            weights[487] = 0.00054740530225500005;
-            weights[488] = 0.00054740530225500005;
-            weights[489] = 0.00054740530225500005;
-            weights[490] = -8.2296330901299996e-06;
-            weights[491] = -8.2296330901299996e-06;
-            weights[492] = -8.2296330901299996e-06;
-            weights[493] = -8.2296330901299996e-06;
-            weights[494] = 1.3573205874999999e-08;
-
+            coordinates.assign(gpcoordinates16, gpcoordinates16+3*495);
+            weights.assign(gpweights16, gpweights16+495);
             break;
-
         case 18: case 19:
-    
-            coordinates.resize(715*3);
-            weights.resize(715);
-
-            coordinates[0] = 0.045454545454499999;
-            coordinates[1] = 0.045454545454499999;
-            coordinates[2] = 0.86363636363600005;
-            coordinates[3] = 0.045454545454499999;
-            coordinates[4] = 0.13636363636400001;
-            coordinates[5] = 0.77272727272700004;
-            coordinates[6] = 0.045454545454499999;
-            coordinates[7] = 0.22727272727299999;
-            coordinates[8] = 0.68181818181800002;
-            coordinates[9] = 0.045454545454499999;
-            coordinates[10] = 0.31818181818199998;
-            coordinates[11] = 0.59090909090900001;
-            coordinates[12] = 0.045454545454499999;
-            coordinates[13] = 0.40909090909099999;
-            coordinates[14] = 0.5;
-            coordinates[15] = 0.045454545454499999;
-            coordinates[16] = 0.5;
-            coordinates[17] = 0.40909090909099999;
-            coordinates[18] = 0.045454545454499999;
-            coordinates[19] = 0.59090909090900001;
-            coordinates[20] = 0.31818181818199998;
-            coordinates[21] = 0.045454545454499999;
-            coordinates[22] = 0.68181818181800002;
-            coordinates[23] = 0.22727272727299999;
-            coordinates[24] = 0.045454545454499999;
-            coordinates[25] = 0.77272727272700004;
-            coordinates[26] = 0.13636363636400001;
-            coordinates[27] = 0.045454545454499999;
-            coordinates[28] = 0.86363636363600005;
-            coordinates[29] = 0.045454545454499999;
-            coordinates[30] = 0.13636363636400001;
-            coordinates[31] = 0.045454545454499999;
-            coordinates[32] = 0.77272727272700004;
-            coordinates[33] = 0.13636363636400001;
-            coordinates[34] = 0.13636363636400001;
-            coordinates[35] = 0.68181818181800002;
-            coordinates[36] = 0.13636363636400001;
-            coordinates[37] = 0.22727272727299999;
-            coordinates[38] = 0.59090909090900001;
-            coordinates[39] = 0.13636363636400001;
-            coordinates[40] = 0.31818181818199998;
-            coordinates[41] = 0.5;
-            coordinates[42] = 0.13636363636400001;
-            coordinates[43] = 0.40909090909099999;
-            coordinates[44] = 0.40909090909099999;
-            coordinates[45] = 0.13636363636400001;
-            coordinates[46] = 0.5;
-            coordinates[47] = 0.31818181818199998;
-            coordinates[48] = 0.13636363636400001;
-            coordinates[49] = 0.59090909090900001;
-            coordinates[50] = 0.22727272727299999;
-            coordinates[51] = 0.13636363636400001;
-            coordinates[52] = 0.68181818181800002;
-            coordinates[53] = 0.13636363636400001;
-            coordinates[54] = 0.13636363636400001;
-            coordinates[55] = 0.77272727272700004;
-            coordinates[56] = 0.045454545454499999;
-            coordinates[57] = 0.22727272727299999;
-            coordinates[58] = 0.045454545454499999;
-            coordinates[59] = 0.68181818181800002;
-            coordinates[60] = 0.22727272727299999;
-            coordinates[61] = 0.13636363636400001;
-            coordinates[62] = 0.59090909090900001;
-            coordinates[63] = 0.22727272727299999;
-            coordinates[64] = 0.22727272727299999;
-            coordinates[65] = 0.5;
-            coordinates[66] = 0.22727272727299999;
-            coordinates[67] = 0.31818181818199998;
-            coordinates[68] = 0.40909090909099999;
-            coordinates[69] = 0.22727272727299999;
-            coordinates[70] = 0.40909090909099999;
-            coordinates[71] = 0.31818181818199998;
-            coordinates[72] = 0.22727272727299999;
-            coordinates[73] = 0.5;
-            coordinates[74] = 0.22727272727299999;
-            coordinates[75] = 0.22727272727299999;
-            coordinates[76] = 0.59090909090900001;
-            coordinates[77] = 0.13636363636400001;
-            coordinates[78] = 0.22727272727299999;
-            coordinates[79] = 0.68181818181800002;
-            coordinates[80] = 0.045454545454499999;
-            coordinates[81] = 0.31818181818199998;
-            coordinates[82] = 0.045454545454499999;
-            coordinates[83] = 0.59090909090900001;
-            coordinates[84] = 0.31818181818199998;
-            coordinates[85] = 0.13636363636400001;
-            coordinates[86] = 0.5;
-            coordinates[87] = 0.31818181818199998;
-            coordinates[88] = 0.22727272727299999;
-            coordinates[89] = 0.40909090909099999;
-            coordinates[90] = 0.31818181818199998;
-            coordinates[91] = 0.31818181818199998;
-            coordinates[92] = 0.31818181818199998;
-            coordinates[93] = 0.31818181818199998;
-            coordinates[94] = 0.40909090909099999;
-            coordinates[95] = 0.22727272727299999;
-            coordinates[96] = 0.31818181818199998;
-            coordinates[97] = 0.5;
-            coordinates[98] = 0.13636363636400001;
-            coordinates[99] = 0.31818181818199998;
-            coordinates[100] = 0.59090909090900001;
-            coordinates[101] = 0.045454545454499999;
-            coordinates[102] = 0.40909090909099999;
-            coordinates[103] = 0.045454545454499999;
-            coordinates[104] = 0.5;
-            coordinates[105] = 0.40909090909099999;
-            coordinates[106] = 0.13636363636400001;
-            coordinates[107] = 0.40909090909099999;
-            coordinates[108] = 0.40909090909099999;
-            coordinates[109] = 0.22727272727299999;
-            coordinates[110] = 0.31818181818199998;
-            coordinates[111] = 0.40909090909099999;
-            coordinates[112] = 0.31818181818199998;
-            coordinates[113] = 0.22727272727299999;
-            coordinates[114] = 0.40909090909099999;
-            coordinates[115] = 0.40909090909099999;
-            coordinates[116] = 0.13636363636400001;
-            coordinates[117] = 0.40909090909099999;
-            coordinates[118] = 0.5;
-            coordinates[119] = 0.045454545454499999;
-            coordinates[120] = 0.5;
-            coordinates[121] = 0.045454545454499999;
-            coordinates[122] = 0.40909090909099999;
-            coordinates[123] = 0.5;
-            coordinates[124] = 0.13636363636400001;
-            coordinates[125] = 0.31818181818199998;
-            coordinates[126] = 0.5;
-            coordinates[127] = 0.22727272727299999;
-            coordinates[128] = 0.22727272727299999;
-            coordinates[129] = 0.5;
-            coordinates[130] = 0.31818181818199998;
-            coordinates[131] = 0.13636363636400001;
-            coordinates[132] = 0.5;
-            coordinates[133] = 0.40909090909099999;
-            coordinates[134] = 0.045454545454499999;
-            coordinates[135] = 0.59090909090900001;
-            coordinates[136] = 0.045454545454499999;
-            coordinates[137] = 0.31818181818199998;
-            coordinates[138] = 0.59090909090900001;
-            coordinates[139] = 0.13636363636400001;
-            coordinates[140] = 0.22727272727299999;
-            coordinates[141] = 0.59090909090900001;
-            coordinates[142] = 0.22727272727299999;
-            coordinates[143] = 0.13636363636400001;
-            coordinates[144] = 0.59090909090900001;
-            coordinates[145] = 0.31818181818199998;
-            coordinates[146] = 0.045454545454499999;
-            coordinates[147] = 0.68181818181800002;
-            coordinates[148] = 0.045454545454499999;
-            coordinates[149] = 0.22727272727299999;
-            coordinates[150] = 0.68181818181800002;
-            coordinates[151] = 0.13636363636400001;
-            coordinates[152] = 0.13636363636400001;
-            coordinates[153] = 0.68181818181800002;
-            coordinates[154] = 0.22727272727299999;
-            coordinates[155] = 0.045454545454499999;
-            coordinates[156] = 0.77272727272700004;
-            coordinates[157] = 0.045454545454499999;
-            coordinates[158] = 0.13636363636400001;
-            coordinates[159] = 0.77272727272700004;
-            coordinates[160] = 0.13636363636400001;
-            coordinates[161] = 0.045454545454499999;
-            coordinates[162] = 0.86363636363600005;
-            coordinates[163] = 0.045454545454499999;
-            coordinates[164] = 0.045454545454499999;
-            coordinates[165] = 0.045454545454499999;
-            coordinates[166] = 0.045454545454499999;
-            coordinates[167] = 0.77272727272700004;
-            coordinates[168] = 0.045454545454499999;
-            coordinates[169] = 0.13636363636400001;
-            coordinates[170] = 0.68181818181800002;
-            coordinates[171] = 0.045454545454499999;
-            coordinates[172] = 0.22727272727299999;
-            coordinates[173] = 0.59090909090900001;
-            coordinates[174] = 0.045454545454499999;
-            coordinates[175] = 0.31818181818199998;
-            coordinates[176] = 0.5;
-            coordinates[177] = 0.045454545454499999;
-            coordinates[178] = 0.40909090909099999;
-            coordinates[179] = 0.40909090909099999;
-            coordinates[180] = 0.045454545454499999;
-            coordinates[181] = 0.5;
-            coordinates[182] = 0.31818181818199998;
-            coordinates[183] = 0.045454545454499999;
-            coordinates[184] = 0.59090909090900001;
-            coordinates[185] = 0.22727272727299999;
-            coordinates[186] = 0.045454545454499999;
-            coordinates[187] = 0.68181818181800002;
-            coordinates[188] = 0.13636363636400001;
-            coordinates[189] = 0.045454545454499999;
-            coordinates[190] = 0.77272727272700004;
-            coordinates[191] = 0.045454545454499999;
-            coordinates[192] = 0.13636363636400001;
-            coordinates[193] = 0.045454545454499999;
-            coordinates[194] = 0.68181818181800002;
-            coordinates[195] = 0.13636363636400001;
-            coordinates[196] = 0.13636363636400001;
-            coordinates[197] = 0.59090909090900001;
-            coordinates[198] = 0.13636363636400001;
-            coordinates[199] = 0.22727272727299999;
-            coordinates[200] = 0.5;
-            coordinates[201] = 0.13636363636400001;
-            coordinates[202] = 0.31818181818199998;
-            coordinates[203] = 0.40909090909099999;
-            coordinates[204] = 0.13636363636400001;
-            coordinates[205] = 0.40909090909099999;
-            coordinates[206] = 0.31818181818199998;
-            coordinates[207] = 0.13636363636400001;
-            coordinates[208] = 0.5;
-            coordinates[209] = 0.22727272727299999;
-            coordinates[210] = 0.13636363636400001;
-            coordinates[211] = 0.59090909090900001;
-            coordinates[212] = 0.13636363636400001;
-            coordinates[213] = 0.13636363636400001;
-            coordinates[214] = 0.68181818181800002;
-            coordinates[215] = 0.045454545454499999;
-            coordinates[216] = 0.22727272727299999;
-            coordinates[217] = 0.045454545454499999;
-            coordinates[218] = 0.59090909090900001;
-            coordinates[219] = 0.22727272727299999;
-            coordinates[220] = 0.13636363636400001;
-            coordinates[221] = 0.5;
-            coordinates[222] = 0.22727272727299999;
-            coordinates[223] = 0.22727272727299999;
-            coordinates[224] = 0.40909090909099999;
-            coordinates[225] = 0.22727272727299999;
-            coordinates[226] = 0.31818181818199998;
-            coordinates[227] = 0.31818181818199998;
-            coordinates[228] = 0.22727272727299999;
-            coordinates[229] = 0.40909090909099999;
-            coordinates[230] = 0.22727272727299999;
-            coordinates[231] = 0.22727272727299999;
-            coordinates[232] = 0.5;
-            coordinates[233] = 0.13636363636400001;
-            coordinates[234] = 0.22727272727299999;
-            coordinates[235] = 0.59090909090900001;
-            coordinates[236] = 0.045454545454499999;
-            coordinates[237] = 0.31818181818199998;
-            coordinates[238] = 0.045454545454499999;
-            coordinates[239] = 0.5;
-            coordinates[240] = 0.31818181818199998;
-            coordinates[241] = 0.13636363636400001;
-            coordinates[242] = 0.40909090909099999;
-            coordinates[243] = 0.31818181818199998;
-            coordinates[244] = 0.22727272727299999;
-            coordinates[245] = 0.31818181818199998;
-            coordinates[246] = 0.31818181818199998;
-            coordinates[247] = 0.31818181818199998;
-            coordinates[248] = 0.22727272727299999;
-            coordinates[249] = 0.31818181818199998;
-            coordinates[250] = 0.40909090909099999;
-            coordinates[251] = 0.13636363636400001;
-            coordinates[252] = 0.31818181818199998;
-            coordinates[253] = 0.5;
-            coordinates[254] = 0.045454545454499999;
-            coordinates[255] = 0.40909090909099999;
-            coordinates[256] = 0.045454545454499999;
-            coordinates[257] = 0.40909090909099999;
-            coordinates[258] = 0.40909090909099999;
-            coordinates[259] = 0.13636363636400001;
-            coordinates[260] = 0.31818181818199998;
-            coordinates[261] = 0.40909090909099999;
-            coordinates[262] = 0.22727272727299999;
-            coordinates[263] = 0.22727272727299999;
-            coordinates[264] = 0.40909090909099999;
-            coordinates[265] = 0.31818181818199998;
-            coordinates[266] = 0.13636363636400001;
-            coordinates[267] = 0.40909090909099999;
-            coordinates[268] = 0.40909090909099999;
-            coordinates[269] = 0.045454545454499999;
-            coordinates[270] = 0.5;
-            coordinates[271] = 0.045454545454499999;
-            coordinates[272] = 0.31818181818199998;
-            coordinates[273] = 0.5;
-            coordinates[274] = 0.13636363636400001;
-            coordinates[275] = 0.22727272727299999;
-            coordinates[276] = 0.5;
-            coordinates[277] = 0.22727272727299999;
-            coordinates[278] = 0.13636363636400001;
-            coordinates[279] = 0.5;
-            coordinates[280] = 0.31818181818199998;
-            coordinates[281] = 0.045454545454499999;
-            coordinates[282] = 0.59090909090900001;
-            coordinates[283] = 0.045454545454499999;
-            coordinates[284] = 0.22727272727299999;
-            coordinates[285] = 0.59090909090900001;
-            coordinates[286] = 0.13636363636400001;
-            coordinates[287] = 0.13636363636400001;
-            coordinates[288] = 0.59090909090900001;
-            coordinates[289] = 0.22727272727299999;
-            coordinates[290] = 0.045454545454499999;
-            coordinates[291] = 0.68181818181800002;
-            coordinates[292] = 0.045454545454499999;
-            coordinates[293] = 0.13636363636400001;
-            coordinates[294] = 0.68181818181800002;
-            coordinates[295] = 0.13636363636400001;
-            coordinates[296] = 0.045454545454499999;
-            coordinates[297] = 0.77272727272700004;
-            coordinates[298] = 0.045454545454499999;
-            coordinates[299] = 0.045454545454499999;
-            coordinates[300] = 0.045454545454499999;
-            coordinates[301] = 0.045454545454499999;
-            coordinates[302] = 0.68181818181800002;
-            coordinates[303] = 0.045454545454499999;
-            coordinates[304] = 0.13636363636400001;
-            coordinates[305] = 0.59090909090900001;
-            coordinates[306] = 0.045454545454499999;
-            coordinates[307] = 0.22727272727299999;
-            coordinates[308] = 0.5;
-            coordinates[309] = 0.045454545454499999;
-            coordinates[310] = 0.31818181818199998;
-            coordinates[311] = 0.40909090909099999;
-            coordinates[312] = 0.045454545454499999;
-            coordinates[313] = 0.40909090909099999;
-            coordinates[314] = 0.31818181818199998;
-            coordinates[315] = 0.045454545454499999;
-            coordinates[316] = 0.5;
-            coordinates[317] = 0.22727272727299999;
-            coordinates[318] = 0.045454545454499999;
-            coordinates[319] = 0.59090909090900001;
-            coordinates[320] = 0.13636363636400001;
-            coordinates[321] = 0.045454545454499999;
-            coordinates[322] = 0.68181818181800002;
-            coordinates[323] = 0.045454545454499999;
-            coordinates[324] = 0.13636363636400001;
-            coordinates[325] = 0.045454545454499999;
-            coordinates[326] = 0.59090909090900001;
-            coordinates[327] = 0.13636363636400001;
-            coordinates[328] = 0.13636363636400001;
-            coordinates[329] = 0.5;
-            coordinates[330] = 0.13636363636400001;
-            coordinates[331] = 0.22727272727299999;
-            coordinates[332] = 0.40909090909099999;
-            coordinates[333] = 0.13636363636400001;
-            coordinates[334] = 0.31818181818199998;
-            coordinates[335] = 0.31818181818199998;
-            coordinates[336] = 0.13636363636400001;
-            coordinates[337] = 0.40909090909099999;
-            coordinates[338] = 0.22727272727299999;
-            coordinates[339] = 0.13636363636400001;
-            coordinates[340] = 0.5;
-            coordinates[341] = 0.13636363636400001;
-            coordinates[342] = 0.13636363636400001;
-            coordinates[343] = 0.59090909090900001;
-            coordinates[344] = 0.045454545454499999;
-            coordinates[345] = 0.22727272727299999;
-            coordinates[346] = 0.045454545454499999;
-            coordinates[347] = 0.5;
-            coordinates[348] = 0.22727272727299999;
-            coordinates[349] = 0.13636363636400001;
-            coordinates[350] = 0.40909090909099999;
-            coordinates[351] = 0.22727272727299999;
-            coordinates[352] = 0.22727272727299999;
-            coordinates[353] = 0.31818181818199998;
-            coordinates[354] = 0.22727272727299999;
-            coordinates[355] = 0.31818181818199998;
-            coordinates[356] = 0.22727272727299999;
-            coordinates[357] = 0.22727272727299999;
-            coordinates[358] = 0.40909090909099999;
-            coordinates[359] = 0.13636363636400001;
-            coordinates[360] = 0.22727272727299999;
-            coordinates[361] = 0.5;
-            coordinates[362] = 0.045454545454499999;
-            coordinates[363] = 0.31818181818199998;
-            coordinates[364] = 0.045454545454499999;
-            coordinates[365] = 0.40909090909099999;
-            coordinates[366] = 0.31818181818199998;
-            coordinates[367] = 0.13636363636400001;
-            coordinates[368] = 0.31818181818199998;
-            coordinates[369] = 0.31818181818199998;
-            coordinates[370] = 0.22727272727299999;
-            coordinates[371] = 0.22727272727299999;
-            coordinates[372] = 0.31818181818199998;
-            coordinates[373] = 0.31818181818199998;
-            coordinates[374] = 0.13636363636400001;
-            coordinates[375] = 0.31818181818199998;
-            coordinates[376] = 0.40909090909099999;
-            coordinates[377] = 0.045454545454499999;
-            coordinates[378] = 0.40909090909099999;
-            coordinates[379] = 0.045454545454499999;
-            coordinates[380] = 0.31818181818199998;
-            coordinates[381] = 0.40909090909099999;
-            coordinates[382] = 0.13636363636400001;
-            coordinates[383] = 0.22727272727299999;
-            coordinates[384] = 0.40909090909099999;
-            coordinates[385] = 0.22727272727299999;
-            coordinates[386] = 0.13636363636400001;
-            coordinates[387] = 0.40909090909099999;
-            coordinates[388] = 0.31818181818199998;
-            coordinates[389] = 0.045454545454499999;
-            coordinates[390] = 0.5;
-            coordinates[391] = 0.045454545454499999;
-            coordinates[392] = 0.22727272727299999;
-            coordinates[393] = 0.5;
-            coordinates[394] = 0.13636363636400001;
-            coordinates[395] = 0.13636363636400001;
-            coordinates[396] = 0.5;
-            coordinates[397] = 0.22727272727299999;
-            coordinates[398] = 0.045454545454499999;
-            coordinates[399] = 0.59090909090900001;
-            coordinates[400] = 0.045454545454499999;
-            coordinates[401] = 0.13636363636400001;
-            coordinates[402] = 0.59090909090900001;
-            coordinates[403] = 0.13636363636400001;
-            coordinates[404] = 0.045454545454499999;
-            coordinates[405] = 0.68181818181800002;
-            coordinates[406] = 0.045454545454499999;
-            coordinates[407] = 0.045454545454499999;
-            coordinates[408] = 0.045454545454499999;
-            coordinates[409] = 0.045454545454499999;
-            coordinates[410] = 0.59090909090900001;
-            coordinates[411] = 0.045454545454499999;
-            coordinates[412] = 0.13636363636400001;
-            coordinates[413] = 0.5;
-            coordinates[414] = 0.045454545454499999;
-            coordinates[415] = 0.22727272727299999;
-            coordinates[416] = 0.40909090909099999;
-            coordinates[417] = 0.045454545454499999;
-            coordinates[418] = 0.31818181818199998;
-            coordinates[419] = 0.31818181818199998;
-            coordinates[420] = 0.045454545454499999;
-            coordinates[421] = 0.40909090909099999;
-            coordinates[422] = 0.22727272727299999;
-            coordinates[423] = 0.045454545454499999;
-            coordinates[424] = 0.5;
-            coordinates[425] = 0.13636363636400001;
-            coordinates[426] = 0.045454545454499999;
-            coordinates[427] = 0.59090909090900001;
-            coordinates[428] = 0.045454545454499999;
-            coordinates[429] = 0.13636363636400001;
-            coordinates[430] = 0.045454545454499999;
-            coordinates[431] = 0.5;
-            coordinates[432] = 0.13636363636400001;
-            coordinates[433] = 0.13636363636400001;
-            coordinates[434] = 0.40909090909099999;
-            coordinates[435] = 0.13636363636400001;
-            coordinates[436] = 0.22727272727299999;
-            coordinates[437] = 0.31818181818199998;
-            coordinates[438] = 0.13636363636400001;
-            coordinates[439] = 0.31818181818199998;
-            coordinates[440] = 0.22727272727299999;
-            coordinates[441] = 0.13636363636400001;
-            coordinates[442] = 0.40909090909099999;
-            coordinates[443] = 0.13636363636400001;
-            coordinates[444] = 0.13636363636400001;
-            coordinates[445] = 0.5;
-            coordinates[446] = 0.045454545454499999;
-            coordinates[447] = 0.22727272727299999;
-            coordinates[448] = 0.045454545454499999;
-            coordinates[449] = 0.40909090909099999;
-            coordinates[450] = 0.22727272727299999;
-            coordinates[451] = 0.13636363636400001;
-            coordinates[452] = 0.31818181818199998;
-            coordinates[453] = 0.22727272727299999;
-            coordinates[454] = 0.22727272727299999;
-            coordinates[455] = 0.22727272727299999;
-            coordinates[456] = 0.22727272727299999;
-            coordinates[457] = 0.31818181818199998;
-            coordinates[458] = 0.13636363636400001;
-            coordinates[459] = 0.22727272727299999;
-            coordinates[460] = 0.40909090909099999;
-            coordinates[461] = 0.045454545454499999;
-            coordinates[462] = 0.31818181818199998;
-            coordinates[463] = 0.045454545454499999;
-            coordinates[464] = 0.31818181818199998;
-            coordinates[465] = 0.31818181818199998;
-            coordinates[466] = 0.13636363636400001;
-            coordinates[467] = 0.22727272727299999;
-            coordinates[468] = 0.31818181818199998;
-            coordinates[469] = 0.22727272727299999;
-            coordinates[470] = 0.13636363636400001;
-            coordinates[471] = 0.31818181818199998;
-            coordinates[472] = 0.31818181818199998;
-            coordinates[473] = 0.045454545454499999;
-            coordinates[474] = 0.40909090909099999;
-            coordinates[475] = 0.045454545454499999;
-            coordinates[476] = 0.22727272727299999;
-            coordinates[477] = 0.40909090909099999;
-            coordinates[478] = 0.13636363636400001;
-            coordinates[479] = 0.13636363636400001;
-            coordinates[480] = 0.40909090909099999;
-            coordinates[481] = 0.22727272727299999;
-            coordinates[482] = 0.045454545454499999;
-            coordinates[483] = 0.5;
-            coordinates[484] = 0.045454545454499999;
-            coordinates[485] = 0.13636363636400001;
-            coordinates[486] = 0.5;
-            coordinates[487] = 0.13636363636400001;
-            coordinates[488] = 0.045454545454499999;
-            coordinates[489] = 0.59090909090900001;
-            coordinates[490] = 0.045454545454499999;
-            coordinates[491] = 0.045454545454499999;
-            coordinates[492] = 0.045454545454499999;
-            coordinates[493] = 0.045454545454499999;
-            coordinates[494] = 0.5;
-            coordinates[495] = 0.045454545454499999;
-            coordinates[496] = 0.13636363636400001;
-            coordinates[497] = 0.40909090909099999;
-            coordinates[498] = 0.045454545454499999;
-            coordinates[499] = 0.22727272727299999;
-            coordinates[500] = 0.31818181818199998;
-            coordinates[501] = 0.045454545454499999;
-            coordinates[502] = 0.31818181818199998;
-            coordinates[503] = 0.22727272727299999;
-            coordinates[504] = 0.045454545454499999;
-            coordinates[505] = 0.40909090909099999;
-            coordinates[506] = 0.13636363636400001;
-            coordinates[507] = 0.045454545454499999;
-            coordinates[508] = 0.5;
-            coordinates[509] = 0.045454545454499999;
-            coordinates[510] = 0.13636363636400001;
-            coordinates[511] = 0.045454545454499999;
-            coordinates[512] = 0.40909090909099999;
-            coordinates[513] = 0.13636363636400001;
-            coordinates[514] = 0.13636363636400001;
-            coordinates[515] = 0.31818181818199998;
-            coordinates[516] = 0.13636363636400001;
-            coordinates[517] = 0.22727272727299999;
-            coordinates[518] = 0.22727272727299999;
-            coordinates[519] = 0.13636363636400001;
-            coordinates[520] = 0.31818181818199998;
-            coordinates[521] = 0.13636363636400001;
-            coordinates[522] = 0.13636363636400001;
-            coordinates[523] = 0.40909090909099999;
-            coordinates[524] = 0.045454545454499999;
-            coordinates[525] = 0.22727272727299999;
-            coordinates[526] = 0.045454545454499999;
-            coordinates[527] = 0.31818181818199998;
-            coordinates[528] = 0.22727272727299999;
-            coordinates[529] = 0.13636363636400001;
-            coordinates[530] = 0.22727272727299999;
-            coordinates[531] = 0.22727272727299999;
-            coordinates[532] = 0.22727272727299999;
-            coordinates[533] = 0.13636363636400001;
-            coordinates[534] = 0.22727272727299999;
-            coordinates[535] = 0.31818181818199998;
-            coordinates[536] = 0.045454545454499999;
-            coordinates[537] = 0.31818181818199998;
-            coordinates[538] = 0.045454545454499999;
-            coordinates[539] = 0.22727272727299999;
-            coordinates[540] = 0.31818181818199998;
-            coordinates[541] = 0.13636363636400001;
-            coordinates[542] = 0.13636363636400001;
-            coordinates[543] = 0.31818181818199998;
-            coordinates[544] = 0.22727272727299999;
-            coordinates[545] = 0.045454545454499999;
-            coordinates[546] = 0.40909090909099999;
-            coordinates[547] = 0.045454545454499999;
-            coordinates[548] = 0.13636363636400001;
-            coordinates[549] = 0.40909090909099999;
-            coordinates[550] = 0.13636363636400001;
-            coordinates[551] = 0.045454545454499999;
-            coordinates[552] = 0.5;
-            coordinates[553] = 0.045454545454499999;
-            coordinates[554] = 0.045454545454499999;
-            coordinates[555] = 0.045454545454499999;
-            coordinates[556] = 0.045454545454499999;
-            coordinates[557] = 0.40909090909099999;
-            coordinates[558] = 0.045454545454499999;
-            coordinates[559] = 0.13636363636400001;
-            coordinates[560] = 0.31818181818199998;
-            coordinates[561] = 0.045454545454499999;
-            coordinates[562] = 0.22727272727299999;
-            coordinates[563] = 0.22727272727299999;
-            coordinates[564] = 0.045454545454499999;
-            coordinates[565] = 0.31818181818199998;
-            coordinates[566] = 0.13636363636400001;
-            coordinates[567] = 0.045454545454499999;
-            coordinates[568] = 0.40909090909099999;
-            coordinates[569] = 0.045454545454499999;
-            coordinates[570] = 0.13636363636400001;
-            coordinates[571] = 0.045454545454499999;
-            coordinates[572] = 0.31818181818199998;
-            coordinates[573] = 0.13636363636400001;
-            coordinates[574] = 0.13636363636400001;
-            coordinates[575] = 0.22727272727299999;
-            coordinates[576] = 0.13636363636400001;
-            coordinates[577] = 0.22727272727299999;
-            coordinates[578] = 0.13636363636400001;
-            coordinates[579] = 0.13636363636400001;
-            coordinates[580] = 0.31818181818199998;
-            coordinates[581] = 0.045454545454499999;
-            coordinates[582] = 0.22727272727299999;
-            coordinates[583] = 0.045454545454499999;
-            coordinates[584] = 0.22727272727299999;
-            coordinates[585] = 0.22727272727299999;
-            coordinates[586] = 0.13636363636400001;
-            coordinates[587] = 0.13636363636400001;
-            coordinates[588] = 0.22727272727299999;
-            coordinates[589] = 0.22727272727299999;
-            coordinates[590] = 0.045454545454499999;
-            coordinates[591] = 0.31818181818199998;
-            coordinates[592] = 0.045454545454499999;
-            coordinates[593] = 0.13636363636400001;
-            coordinates[594] = 0.31818181818199998;
-            coordinates[595] = 0.13636363636400001;
-            coordinates[596] = 0.045454545454499999;
-            coordinates[597] = 0.40909090909099999;
-            coordinates[598] = 0.045454545454499999;
-            coordinates[599] = 0.045454545454499999;
-            coordinates[600] = 0.045454545454499999;
-            coordinates[601] = 0.045454545454499999;
-            coordinates[602] = 0.31818181818199998;
-            coordinates[603] = 0.045454545454499999;
-            coordinates[604] = 0.13636363636400001;
-            coordinates[605] = 0.22727272727299999;
-            coordinates[606] = 0.045454545454499999;
-            coordinates[607] = 0.22727272727299999;
-            coordinates[608] = 0.13636363636400001;
-            coordinates[609] = 0.045454545454499999;
-            coordinates[610] = 0.31818181818199998;
-            coordinates[611] = 0.045454545454499999;
-            coordinates[612] = 0.13636363636400001;
-            coordinates[613] = 0.045454545454499999;
-            coordinates[614] = 0.22727272727299999;
-            coordinates[615] = 0.13636363636400001;
-            coordinates[616] = 0.13636363636400001;
-            coordinates[617] = 0.13636363636400001;
-            coordinates[618] = 0.13636363636400001;
-            coordinates[619] = 0.22727272727299999;
-            coordinates[620] = 0.045454545454499999;
-            coordinates[621] = 0.22727272727299999;
-            coordinates[622] = 0.045454545454499999;
-            coordinates[623] = 0.13636363636400001;
-            coordinates[624] = 0.22727272727299999;
-            coordinates[625] = 0.13636363636400001;
-            coordinates[626] = 0.045454545454499999;
-            coordinates[627] = 0.31818181818199998;
-            coordinates[628] = 0.045454545454499999;
-            coordinates[629] = 0.045454545454499999;
-            coordinates[630] = 0.045454545454499999;
-            coordinates[631] = 0.045454545454499999;
-            coordinates[632] = 0.22727272727299999;
-            coordinates[633] = 0.045454545454499999;
-            coordinates[634] = 0.13636363636400001;
-            coordinates[635] = 0.13636363636400001;
-            coordinates[636] = 0.045454545454499999;
-            coordinates[637] = 0.22727272727299999;
-            coordinates[638] = 0.045454545454499999;
-            coordinates[639] = 0.13636363636400001;
-            coordinates[640] = 0.045454545454499999;
-            coordinates[641] = 0.13636363636400001;
-            coordinates[642] = 0.13636363636400001;
-            coordinates[643] = 0.13636363636400001;
-            coordinates[644] = 0.045454545454499999;
-            coordinates[645] = 0.22727272727299999;
-            coordinates[646] = 0.045454545454499999;
-            coordinates[647] = 0.045454545454499999;
-            coordinates[648] = 0.045454545454499999;
-            coordinates[649] = 0.045454545454499999;
-            coordinates[650] = 0.13636363636400001;
-            coordinates[651] = 0.045454545454499999;
-            coordinates[652] = 0.13636363636400001;
-            coordinates[653] = 0.045454545454499999;
-            coordinates[654] = 0.13636363636400001;
-            coordinates[655] = 0.045454545454499999;
-            coordinates[656] = 0.045454545454499999;
-            coordinates[657] = 0.045454545454499999;
-            coordinates[658] = 0.045454545454499999;
-            coordinates[659] = 0.045454545454499999;
-            coordinates[660] = 0.050000000000000003;
-            coordinates[661] = 0.050000000000000003;
-            coordinates[662] = 0.84999999999999998;
-            coordinates[663] = 0.050000000000000003;
-            coordinates[664] = 0.14999999999999999;
-            coordinates[665] = 0.75;
-            coordinates[666] = 0.050000000000000003;
-            coordinates[667] = 0.25;
-            coordinates[668] = 0.65000000000000002;
-            coordinates[669] = 0.050000000000000003;
-            coordinates[670] = 0.34999999999999998;
-            coordinates[671] = 0.55000000000000004;
-            coordinates[672] = 0.050000000000000003;
-            coordinates[673] = 0.45000000000000001;
-            coordinates[674] = 0.45000000000000001;
-            coordinates[675] = 0.050000000000000003;
-            coordinates[676] = 0.55000000000000004;
-            coordinates[677] = 0.34999999999999998;
-            coordinates[678] = 0.050000000000000003;
-            coordinates[679] = 0.65000000000000002;
-            coordinates[680] = 0.25;
-            coordinates[681] = 0.050000000000000003;
-            coordinates[682] = 0.75;
-            coordinates[683] = 0.14999999999999999;
-            coordinates[684] = 0.050000000000000003;
-            coordinates[685] = 0.84999999999999998;
-            coordinates[686] = 0.050000000000000003;
-            coordinates[687] = 0.14999999999999999;
-            coordinates[688] = 0.050000000000000003;
-            coordinates[689] = 0.75;
-            coordinates[690] = 0.14999999999999999;
-            coordinates[691] = 0.14999999999999999;
-            coordinates[692] = 0.65000000000000002;
-            coordinates[693] = 0.14999999999999999;
-            coordinates[694] = 0.25;
-            coordinates[695] = 0.55000000000000004;
-            coordinates[696] = 0.14999999999999999;
-            coordinates[697] = 0.34999999999999998;
-            coordinates[698] = 0.45000000000000001;
-            coordinates[699] = 0.14999999999999999;
-            coordinates[700] = 0.45000000000000001;
-            coordinates[701] = 0.34999999999999998;
-            coordinates[702] = 0.14999999999999999;
-            coordinates[703] = 0.55000000000000004;
-            coordinates[704] = 0.25;
-            coordinates[705] = 0.14999999999999999;
-            coordinates[706] = 0.65000000000000002;
-            coordinates[707] = 0.14999999999999999;
-            coordinates[708] = 0.14999999999999999;
-            coordinates[709] = 0.75;
-            coordinates[710] = 0.050000000000000003;
-            coordinates[711] = 0.25;
-            coordinates[712] = 0.050000000000000003;
-            coordinates[713] = 0.65000000000000002;
-            coordinates[714] = 0.25;
-            coordinates[715] = 0.14999999999999999;
-            coordinates[716] = 0.55000000000000004;
-            coordinates[717] = 0.25;
-            coordinates[718] = 0.25;
-            coordinates[719] = 0.45000000000000001;
-            coordinates[720] = 0.25;
-            coordinates[721] = 0.34999999999999998;
-            coordinates[722] = 0.34999999999999998;
-            coordinates[723] = 0.25;
-            coordinates[724] = 0.45000000000000001;
-            coordinates[725] = 0.25;
-            coordinates[726] = 0.25;
-            coordinates[727] = 0.55000000000000004;
-            coordinates[728] = 0.14999999999999999;
-            coordinates[729] = 0.25;
-            coordinates[730] = 0.65000000000000002;
-            coordinates[731] = 0.050000000000000003;
-            coordinates[732] = 0.34999999999999998;
-            coordinates[733] = 0.050000000000000003;
-            coordinates[734] = 0.55000000000000004;
-            coordinates[735] = 0.34999999999999998;
-            coordinates[736] = 0.14999999999999999;
-            coordinates[737] = 0.45000000000000001;
-            coordinates[738] = 0.34999999999999998;
-            coordinates[739] = 0.25;
-            coordinates[740] = 0.34999999999999998;
-            coordinates[741] = 0.34999999999999998;
-            coordinates[742] = 0.34999999999999998;
-            coordinates[743] = 0.25;
-            coordinates[744] = 0.34999999999999998;
-            coordinates[745] = 0.45000000000000001;
-            coordinates[746] = 0.14999999999999999;
-            coordinates[747] = 0.34999999999999998;
-            coordinates[748] = 0.55000000000000004;
-            coordinates[749] = 0.050000000000000003;
-            coordinates[750] = 0.45000000000000001;
-            coordinates[751] = 0.050000000000000003;
-            coordinates[752] = 0.45000000000000001;
-            coordinates[753] = 0.45000000000000001;
-            coordinates[754] = 0.14999999999999999;
-            coordinates[755] = 0.34999999999999998;
-            coordinates[756] = 0.45000000000000001;
-            coordinates[757] = 0.25;
-            coordinates[758] = 0.25;
-            coordinates[759] = 0.45000000000000001;
-            coordinates[760] = 0.34999999999999998;
-            coordinates[761] = 0.14999999999999999;
-            coordinates[762] = 0.45000000000000001;
-            coordinates[763] = 0.45000000000000001;
-            coordinates[764] = 0.050000000000000003;
-            coordinates[765] = 0.55000000000000004;
-            coordinates[766] = 0.050000000000000003;
-            coordinates[767] = 0.34999999999999998;
-            coordinates[768] = 0.55000000000000004;
-            coordinates[769] = 0.14999999999999999;
-            coordinates[770] = 0.25;
-            coordinates[771] = 0.55000000000000004;
-            coordinates[772] = 0.25;
-            coordinates[773] = 0.14999999999999999;
-            coordinates[774] = 0.55000000000000004;
-            coordinates[775] = 0.34999999999999998;
-            coordinates[776] = 0.050000000000000003;
-            coordinates[777] = 0.65000000000000002;
-            coordinates[778] = 0.050000000000000003;
-            coordinates[779] = 0.25;
-            coordinates[780] = 0.65000000000000002;
-            coordinates[781] = 0.14999999999999999;
-            coordinates[782] = 0.14999999999999999;
-            coordinates[783] = 0.65000000000000002;
-            coordinates[784] = 0.25;
-            coordinates[785] = 0.050000000000000003;
-            coordinates[786] = 0.75;
-            coordinates[787] = 0.050000000000000003;
-            coordinates[788] = 0.14999999999999999;
-            coordinates[789] = 0.75;
-            coordinates[790] = 0.14999999999999999;
-            coordinates[791] = 0.050000000000000003;
-            coordinates[792] = 0.84999999999999998;
-            coordinates[793] = 0.050000000000000003;
-            coordinates[794] = 0.050000000000000003;
-            coordinates[795] = 0.050000000000000003;
-            coordinates[796] = 0.050000000000000003;
-            coordinates[797] = 0.75;
-            coordinates[798] = 0.050000000000000003;
-            coordinates[799] = 0.14999999999999999;
-            coordinates[800] = 0.65000000000000002;
-            coordinates[801] = 0.050000000000000003;
-            coordinates[802] = 0.25;
-            coordinates[803] = 0.55000000000000004;
-            coordinates[804] = 0.050000000000000003;
-            coordinates[805] = 0.34999999999999998;
-            coordinates[806] = 0.45000000000000001;
-            coordinates[807] = 0.050000000000000003;
-            coordinates[808] = 0.45000000000000001;
-            coordinates[809] = 0.34999999999999998;
-            coordinates[810] = 0.050000000000000003;
-            coordinates[811] = 0.55000000000000004;
-            coordinates[812] = 0.25;
-            coordinates[813] = 0.050000000000000003;
-            coordinates[814] = 0.65000000000000002;
-            coordinates[815] = 0.14999999999999999;
-            coordinates[816] = 0.050000000000000003;
-            coordinates[817] = 0.75;
-            coordinates[818] = 0.050000000000000003;
-            coordinates[819] = 0.14999999999999999;
-            coordinates[820] = 0.050000000000000003;
-            coordinates[821] = 0.65000000000000002;
-            coordinates[822] = 0.14999999999999999;
-            coordinates[823] = 0.14999999999999999;
-            coordinates[824] = 0.55000000000000004;
-            coordinates[825] = 0.14999999999999999;
-            coordinates[826] = 0.25;
-            coordinates[827] = 0.45000000000000001;
-            coordinates[828] = 0.14999999999999999;
-            coordinates[829] = 0.34999999999999998;
-            coordinates[830] = 0.34999999999999998;
-            coordinates[831] = 0.14999999999999999;
-            coordinates[832] = 0.45000000000000001;
-            coordinates[833] = 0.25;
-            coordinates[834] = 0.14999999999999999;
-            coordinates[835] = 0.55000000000000004;
-            coordinates[836] = 0.14999999999999999;
-            coordinates[837] = 0.14999999999999999;
-            coordinates[838] = 0.65000000000000002;
-            coordinates[839] = 0.050000000000000003;
-            coordinates[840] = 0.25;
-            coordinates[841] = 0.050000000000000003;
-            coordinates[842] = 0.55000000000000004;
-            coordinates[843] = 0.25;
-            coordinates[844] = 0.14999999999999999;
-            coordinates[845] = 0.45000000000000001;
-            coordinates[846] = 0.25;
-            coordinates[847] = 0.25;
-            coordinates[848] = 0.34999999999999998;
-            coordinates[849] = 0.25;
-            coordinates[850] = 0.34999999999999998;
-            coordinates[851] = 0.25;
-            coordinates[852] = 0.25;
-            coordinates[853] = 0.45000000000000001;
-            coordinates[854] = 0.14999999999999999;
-            coordinates[855] = 0.25;
-            coordinates[856] = 0.55000000000000004;
-            coordinates[857] = 0.050000000000000003;
-            coordinates[858] = 0.34999999999999998;
-            coordinates[859] = 0.050000000000000003;
-            coordinates[860] = 0.45000000000000001;
-            coordinates[861] = 0.34999999999999998;
-            coordinates[862] = 0.14999999999999999;
-            coordinates[863] = 0.34999999999999998;
-            coordinates[864] = 0.34999999999999998;
-            coordinates[865] = 0.25;
-            coordinates[866] = 0.25;
-            coordinates[867] = 0.34999999999999998;
-            coordinates[868] = 0.34999999999999998;
-            coordinates[869] = 0.14999999999999999;
-            coordinates[870] = 0.34999999999999998;
-            coordinates[871] = 0.45000000000000001;
-            coordinates[872] = 0.050000000000000003;
-            coordinates[873] = 0.45000000000000001;
-            coordinates[874] = 0.050000000000000003;
-            coordinates[875] = 0.34999999999999998;
-            coordinates[876] = 0.45000000000000001;
-            coordinates[877] = 0.14999999999999999;
-            coordinates[878] = 0.25;
-            coordinates[879] = 0.45000000000000001;
-            coordinates[880] = 0.25;
-            coordinates[881] = 0.14999999999999999;
-            coordinates[882] = 0.45000000000000001;
-            coordinates[883] = 0.34999999999999998;
-            coordinates[884] = 0.050000000000000003;
-            coordinates[885] = 0.55000000000000004;
-            coordinates[886] = 0.050000000000000003;
-            coordinates[887] = 0.25;
-            coordinates[888] = 0.55000000000000004;
-            coordinates[889] = 0.14999999999999999;
-            coordinates[890] = 0.14999999999999999;
-            coordinates[891] = 0.55000000000000004;
-            coordinates[892] = 0.25;
-            coordinates[893] = 0.050000000000000003;
-            coordinates[894] = 0.65000000000000002;
-            coordinates[895] = 0.050000000000000003;
-            coordinates[896] = 0.14999999999999999;
-            coordinates[897] = 0.65000000000000002;
-            coordinates[898] = 0.14999999999999999;
-            coordinates[899] = 0.050000000000000003;
-            coordinates[900] = 0.75;
-            coordinates[901] = 0.050000000000000003;
-            coordinates[902] = 0.050000000000000003;
-            coordinates[903] = 0.050000000000000003;
-            coordinates[904] = 0.050000000000000003;
-            coordinates[905] = 0.65000000000000002;
-            coordinates[906] = 0.050000000000000003;
-            coordinates[907] = 0.14999999999999999;
-            coordinates[908] = 0.55000000000000004;
-            coordinates[909] = 0.050000000000000003;
-            coordinates[910] = 0.25;
-            coordinates[911] = 0.45000000000000001;
-            coordinates[912] = 0.050000000000000003;
-            coordinates[913] = 0.34999999999999998;
-            coordinates[914] = 0.34999999999999998;
-            coordinates[915] = 0.050000000000000003;
-            coordinates[916] = 0.45000000000000001;
-            coordinates[917] = 0.25;
-            coordinates[918] = 0.050000000000000003;
-            coordinates[919] = 0.55000000000000004;
-            coordinates[920] = 0.14999999999999999;
-            coordinates[921] = 0.050000000000000003;
-            coordinates[922] = 0.65000000000000002;
-            coordinates[923] = 0.050000000000000003;
-            coordinates[924] = 0.14999999999999999;
-            coordinates[925] = 0.050000000000000003;
-            coordinates[926] = 0.55000000000000004;
-            coordinates[927] = 0.14999999999999999;
-            coordinates[928] = 0.14999999999999999;
-            coordinates[929] = 0.45000000000000001;
-            coordinates[930] = 0.14999999999999999;
-            coordinates[931] = 0.25;
-            coordinates[932] = 0.34999999999999998;
-            coordinates[933] = 0.14999999999999999;
-            coordinates[934] = 0.34999999999999998;
-            coordinates[935] = 0.25;
-            coordinates[936] = 0.14999999999999999;
-            coordinates[937] = 0.45000000000000001;
-            coordinates[938] = 0.14999999999999999;
-            coordinates[939] = 0.14999999999999999;
-            coordinates[940] = 0.55000000000000004;
-            coordinates[941] = 0.050000000000000003;
-            coordinates[942] = 0.25;
-            coordinates[943] = 0.050000000000000003;
-            coordinates[944] = 0.45000000000000001;
-            coordinates[945] = 0.25;
-            coordinates[946] = 0.14999999999999999;
-            coordinates[947] = 0.34999999999999998;
-            coordinates[948] = 0.25;
-            coordinates[949] = 0.25;
-            coordinates[950] = 0.25;
-            coordinates[951] = 0.25;
-            coordinates[952] = 0.34999999999999998;
-            coordinates[953] = 0.14999999999999999;
-            coordinates[954] = 0.25;
-            coordinates[955] = 0.45000000000000001;
-            coordinates[956] = 0.050000000000000003;
-            coordinates[957] = 0.34999999999999998;
-            coordinates[958] = 0.050000000000000003;
-            coordinates[959] = 0.34999999999999998;
-            coordinates[960] = 0.34999999999999998;
-            coordinates[961] = 0.14999999999999999;
-            coordinates[962] = 0.25;
-            coordinates[963] = 0.34999999999999998;
-            coordinates[964] = 0.25;
-            coordinates[965] = 0.14999999999999999;
-            coordinates[966] = 0.34999999999999998;
-            coordinates[967] = 0.34999999999999998;
-            coordinates[968] = 0.050000000000000003;
-            coordinates[969] = 0.45000000000000001;
-            coordinates[970] = 0.050000000000000003;
-            coordinates[971] = 0.25;
-            coordinates[972] = 0.45000000000000001;
-            coordinates[973] = 0.14999999999999999;
-            coordinates[974] = 0.14999999999999999;
-            coordinates[975] = 0.45000000000000001;
-            coordinates[976] = 0.25;
-            coordinates[977] = 0.050000000000000003;
-            coordinates[978] = 0.55000000000000004;
-            coordinates[979] = 0.050000000000000003;
-            coordinates[980] = 0.14999999999999999;
-            coordinates[981] = 0.55000000000000004;
-            coordinates[982] = 0.14999999999999999;
-            coordinates[983] = 0.050000000000000003;
-            coordinates[984] = 0.65000000000000002;
-            coordinates[985] = 0.050000000000000003;
-            coordinates[986] = 0.050000000000000003;
-            coordinates[987] = 0.050000000000000003;
-            coordinates[988] = 0.050000000000000003;
-            coordinates[989] = 0.55000000000000004;
-            coordinates[990] = 0.050000000000000003;
-            coordinates[991] = 0.14999999999999999;
-            coordinates[992] = 0.45000000000000001;
-            coordinates[993] = 0.050000000000000003;
-            coordinates[994] = 0.25;
-            coordinates[995] = 0.34999999999999998;
-            coordinates[996] = 0.050000000000000003;
-            coordinates[997] = 0.34999999999999998;
-            coordinates[998] = 0.25;
-            coordinates[999] = 0.050000000000000003;
-            coordinates[1000] = 0.45000000000000001;
-            coordinates[1001] = 0.14999999999999999;
-            coordinates[1002] = 0.050000000000000003;
-            coordinates[1003] = 0.55000000000000004;
-            coordinates[1004] = 0.050000000000000003;
-            coordinates[1005] = 0.14999999999999999;
-            coordinates[1006] = 0.050000000000000003;
-            coordinates[1007] = 0.45000000000000001;
-            coordinates[1008] = 0.14999999999999999;
-            coordinates[1009] = 0.14999999999999999;
-            coordinates[1010] = 0.34999999999999998;
-            coordinates[1011] = 0.14999999999999999;
-            coordinates[1012] = 0.25;
-            coordinates[1013] = 0.25;
-            coordinates[1014] = 0.14999999999999999;
-            coordinates[1015] = 0.34999999999999998;
-            coordinates[1016] = 0.14999999999999999;
-            coordinates[1017] = 0.14999999999999999;
-            coordinates[1018] = 0.45000000000000001;
-            coordinates[1019] = 0.050000000000000003;
-            coordinates[1020] = 0.25;
-            coordinates[1021] = 0.050000000000000003;
-            coordinates[1022] = 0.34999999999999998;
-            coordinates[1023] = 0.25;
-            coordinates[1024] = 0.14999999999999999;
-            coordinates[1025] = 0.25;
-            coordinates[1026] = 0.25;
-            coordinates[1027] = 0.25;
-            coordinates[1028] = 0.14999999999999999;
-            coordinates[1029] = 0.25;
-            coordinates[1030] = 0.34999999999999998;
-            coordinates[1031] = 0.050000000000000003;
-            coordinates[1032] = 0.34999999999999998;
-            coordinates[1033] = 0.050000000000000003;
-            coordinates[1034] = 0.25;
-            coordinates[1035] = 0.34999999999999998;
-            coordinates[1036] = 0.14999999999999999;
-            coordinates[1037] = 0.14999999999999999;
-            coordinates[1038] = 0.34999999999999998;
-            coordinates[1039] = 0.25;
-            coordinates[1040] = 0.050000000000000003;
-            coordinates[1041] = 0.45000000000000001;
-            coordinates[1042] = 0.050000000000000003;
-            coordinates[1043] = 0.14999999999999999;
-            coordinates[1044] = 0.45000000000000001;
-            coordinates[1045] = 0.14999999999999999;
-            coordinates[1046] = 0.050000000000000003;
-            coordinates[1047] = 0.55000000000000004;
-            coordinates[1048] = 0.050000000000000003;
-            coordinates[1049] = 0.050000000000000003;
-            coordinates[1050] = 0.050000000000000003;
-            coordinates[1051] = 0.050000000000000003;
-            coordinates[1052] = 0.45000000000000001;
-            coordinates[1053] = 0.050000000000000003;
-            coordinates[1054] = 0.14999999999999999;
-            coordinates[1055] = 0.34999999999999998;
-            coordinates[1056] = 0.050000000000000003;
-            coordinates[1057] = 0.25;
-            coordinates[1058] = 0.25;
-            coordinates[1059] = 0.050000000000000003;
-            coordinates[1060] = 0.34999999999999998;
-            coordinates[1061] = 0.14999999999999999;
-            coordinates[1062] = 0.050000000000000003;
-            coordinates[1063] = 0.45000000000000001;
-            coordinates[1064] = 0.050000000000000003;
-            coordinates[1065] = 0.14999999999999999;
-            coordinates[1066] = 0.050000000000000003;
-            coordinates[1067] = 0.34999999999999998;
-            coordinates[1068] = 0.14999999999999999;
-            coordinates[1069] = 0.14999999999999999;
-            coordinates[1070] = 0.25;
-            coordinates[1071] = 0.14999999999999999;
-            coordinates[1072] = 0.25;
-            coordinates[1073] = 0.14999999999999999;
-            coordinates[1074] = 0.14999999999999999;
-            coordinates[1075] = 0.34999999999999998;
-            coordinates[1076] = 0.050000000000000003;
-            coordinates[1077] = 0.25;
-            coordinates[1078] = 0.050000000000000003;
-            coordinates[1079] = 0.25;
-            coordinates[1080] = 0.25;
-            coordinates[1081] = 0.14999999999999999;
-            coordinates[1082] = 0.14999999999999999;
-            coordinates[1083] = 0.25;
-            coordinates[1084] = 0.25;
-            coordinates[1085] = 0.050000000000000003;
-            coordinates[1086] = 0.34999999999999998;
-            coordinates[1087] = 0.050000000000000003;
-            coordinates[1088] = 0.14999999999999999;
-            coordinates[1089] = 0.34999999999999998;
-            coordinates[1090] = 0.14999999999999999;
-            coordinates[1091] = 0.050000000000000003;
-            coordinates[1092] = 0.45000000000000001;
-            coordinates[1093] = 0.050000000000000003;
-            coordinates[1094] = 0.050000000000000003;
-            coordinates[1095] = 0.050000000000000003;
-            coordinates[1096] = 0.050000000000000003;
-            coordinates[1097] = 0.34999999999999998;
-            coordinates[1098] = 0.050000000000000003;
-            coordinates[1099] = 0.14999999999999999;
-            coordinates[1100] = 0.25;
-            coordinates[1101] = 0.050000000000000003;
-            coordinates[1102] = 0.25;
-            coordinates[1103] = 0.14999999999999999;
-            coordinates[1104] = 0.050000000000000003;
-            coordinates[1105] = 0.34999999999999998;
-            coordinates[1106] = 0.050000000000000003;
-            coordinates[1107] = 0.14999999999999999;
-            coordinates[1108] = 0.050000000000000003;
-            coordinates[1109] = 0.25;
-            coordinates[1110] = 0.14999999999999999;
-            coordinates[1111] = 0.14999999999999999;
-            coordinates[1112] = 0.14999999999999999;
-            coordinates[1113] = 0.14999999999999999;
-            coordinates[1114] = 0.25;
-            coordinates[1115] = 0.050000000000000003;
-            coordinates[1116] = 0.25;
-            coordinates[1117] = 0.050000000000000003;
-            coordinates[1118] = 0.14999999999999999;
-            coordinates[1119] = 0.25;
-            coordinates[1120] = 0.14999999999999999;
-            coordinates[1121] = 0.050000000000000003;
-            coordinates[1122] = 0.34999999999999998;
-            coordinates[1123] = 0.050000000000000003;
-            coordinates[1124] = 0.050000000000000003;
-            coordinates[1125] = 0.050000000000000003;
-            coordinates[1126] = 0.050000000000000003;
-            coordinates[1127] = 0.25;
-            coordinates[1128] = 0.050000000000000003;
-            coordinates[1129] = 0.14999999999999999;
-            coordinates[1130] = 0.14999999999999999;
-            coordinates[1131] = 0.050000000000000003;
-            coordinates[1132] = 0.25;
-            coordinates[1133] = 0.050000000000000003;
-            coordinates[1134] = 0.14999999999999999;
-            coordinates[1135] = 0.050000000000000003;
-            coordinates[1136] = 0.14999999999999999;
-            coordinates[1137] = 0.14999999999999999;
-            coordinates[1138] = 0.14999999999999999;
-            coordinates[1139] = 0.050000000000000003;
-            coordinates[1140] = 0.25;
-            coordinates[1141] = 0.050000000000000003;
-            coordinates[1142] = 0.050000000000000003;
-            coordinates[1143] = 0.050000000000000003;
-            coordinates[1144] = 0.050000000000000003;
-            coordinates[1145] = 0.14999999999999999;
-            coordinates[1146] = 0.050000000000000003;
-            coordinates[1147] = 0.14999999999999999;
-            coordinates[1148] = 0.050000000000000003;
-            coordinates[1149] = 0.14999999999999999;
-            coordinates[1150] = 0.050000000000000003;
-            coordinates[1151] = 0.050000000000000003;
-            coordinates[1152] = 0.050000000000000003;
-            coordinates[1153] = 0.050000000000000003;
-            coordinates[1154] = 0.050000000000000003;
-            coordinates[1155] = 0.055555555555600003;
-            coordinates[1156] = 0.055555555555600003;
-            coordinates[1157] = 0.83333333333299997;
-            coordinates[1158] = 0.055555555555600003;
-            coordinates[1159] = 0.166666666667;
-            coordinates[1160] = 0.72222222222200005;
-            coordinates[1161] = 0.055555555555600003;
-            coordinates[1162] = 0.277777777778;
-            coordinates[1163] = 0.61111111111100003;
-            coordinates[1164] = 0.055555555555600003;
-            coordinates[1165] = 0.38888888888899997;
-            coordinates[1166] = 0.5;
-            coordinates[1167] = 0.055555555555600003;
-            coordinates[1168] = 0.5;
-            coordinates[1169] = 0.38888888888899997;
-            coordinates[1170] = 0.055555555555600003;
-            coordinates[1171] = 0.61111111111100003;
-            coordinates[1172] = 0.277777777778;
-            coordinates[1173] = 0.055555555555600003;
-            coordinates[1174] = 0.72222222222200005;
-            coordinates[1175] = 0.166666666667;
-            coordinates[1176] = 0.055555555555600003;
-            coordinates[1177] = 0.83333333333299997;
-            coordinates[1178] = 0.055555555555600003;
-            coordinates[1179] = 0.166666666667;
-            coordinates[1180] = 0.055555555555600003;
-            coordinates[1181] = 0.72222222222200005;
-            coordinates[1182] = 0.166666666667;
-            coordinates[1183] = 0.166666666667;
-            coordinates[1184] = 0.61111111111100003;
-            coordinates[1185] = 0.166666666667;
-            coordinates[1186] = 0.277777777778;
-            coordinates[1187] = 0.5;
-            coordinates[1188] = 0.166666666667;
-            coordinates[1189] = 0.38888888888899997;
-            coordinates[1190] = 0.38888888888899997;
-            coordinates[1191] = 0.166666666667;
-            coordinates[1192] = 0.5;
-            coordinates[1193] = 0.277777777778;
-            coordinates[1194] = 0.166666666667;
-            coordinates[1195] = 0.61111111111100003;
-            coordinates[1196] = 0.166666666667;
-            coordinates[1197] = 0.166666666667;
-            coordinates[1198] = 0.72222222222200005;
-            coordinates[1199] = 0.055555555555600003;
-            coordinates[1200] = 0.277777777778;
-            coordinates[1201] = 0.055555555555600003;
-            coordinates[1202] = 0.61111111111100003;
-            coordinates[1203] = 0.277777777778;
-            coordinates[1204] = 0.166666666667;
-            coordinates[1205] = 0.5;
-            coordinates[1206] = 0.277777777778;
-            coordinates[1207] = 0.277777777778;
-            coordinates[1208] = 0.38888888888899997;
-            coordinates[1209] = 0.277777777778;
-            coordinates[1210] = 0.38888888888899997;
-            coordinates[1211] = 0.277777777778;
-            coordinates[1212] = 0.277777777778;
-            coordinates[1213] = 0.5;
-            coordinates[1214] = 0.166666666667;
-            coordinates[1215] = 0.277777777778;
-            coordinates[1216] = 0.61111111111100003;
-            coordinates[1217] = 0.055555555555600003;
-            coordinates[1218] = 0.38888888888899997;
-            coordinates[1219] = 0.055555555555600003;
-            coordinates[1220] = 0.5;
-            coordinates[1221] = 0.38888888888899997;
-            coordinates[1222] = 0.166666666667;
-            coordinates[1223] = 0.38888888888899997;
-            coordinates[1224] = 0.38888888888899997;
-            coordinates[1225] = 0.277777777778;
-            coordinates[1226] = 0.277777777778;
-            coordinates[1227] = 0.38888888888899997;
-            coordinates[1228] = 0.38888888888899997;
-            coordinates[1229] = 0.166666666667;
-            coordinates[1230] = 0.38888888888899997;
-            coordinates[1231] = 0.5;
-            coordinates[1232] = 0.055555555555600003;
-            coordinates[1233] = 0.5;
-            coordinates[1234] = 0.055555555555600003;
-            coordinates[1235] = 0.38888888888899997;
-            coordinates[1236] = 0.5;
-            coordinates[1237] = 0.166666666667;
-            coordinates[1238] = 0.277777777778;
-            coordinates[1239] = 0.5;
-            coordinates[1240] = 0.277777777778;
-            coordinates[1241] = 0.166666666667;
-            coordinates[1242] = 0.5;
-            coordinates[1243] = 0.38888888888899997;
-            coordinates[1244] = 0.055555555555600003;
-            coordinates[1245] = 0.61111111111100003;
-            coordinates[1246] = 0.055555555555600003;
-            coordinates[1247] = 0.277777777778;
-            coordinates[1248] = 0.61111111111100003;
-            coordinates[1249] = 0.166666666667;
-            coordinates[1250] = 0.166666666667;
-            coordinates[1251] = 0.61111111111100003;
-            coordinates[1252] = 0.277777777778;
-            coordinates[1253] = 0.055555555555600003;
-            coordinates[1254] = 0.72222222222200005;
-            coordinates[1255] = 0.055555555555600003;
-            coordinates[1256] = 0.166666666667;
-            coordinates[1257] = 0.72222222222200005;
-            coordinates[1258] = 0.166666666667;
-            coordinates[1259] = 0.055555555555600003;
-            coordinates[1260] = 0.83333333333299997;
-            coordinates[1261] = 0.055555555555600003;
-            coordinates[1262] = 0.055555555555600003;
-            coordinates[1263] = 0.055555555555600003;
-            coordinates[1264] = 0.055555555555600003;
-            coordinates[1265] = 0.72222222222200005;
-            coordinates[1266] = 0.055555555555600003;
-            coordinates[1267] = 0.166666666667;
-            coordinates[1268] = 0.61111111111100003;
-            coordinates[1269] = 0.055555555555600003;
-            coordinates[1270] = 0.277777777778;
-            coordinates[1271] = 0.5;
-            coordinates[1272] = 0.055555555555600003;
-            coordinates[1273] = 0.38888888888899997;
-            coordinates[1274] = 0.38888888888899997;
-            coordinates[1275] = 0.055555555555600003;
-            coordinates[1276] = 0.5;
-            coordinates[1277] = 0.277777777778;
-            coordinates[1278] = 0.055555555555600003;
-            coordinates[1279] = 0.61111111111100003;
-            coordinates[1280] = 0.166666666667;
-            coordinates[1281] = 0.055555555555600003;
-            coordinates[1282] = 0.72222222222200005;
-            coordinates[1283] = 0.055555555555600003;
-            coordinates[1284] = 0.166666666667;
-            coordinates[1285] = 0.055555555555600003;
-            coordinates[1286] = 0.61111111111100003;
-            coordinates[1287] = 0.166666666667;
-            coordinates[1288] = 0.166666666667;
-            coordinates[1289] = 0.5;
-            coordinates[1290] = 0.166666666667;
-            coordinates[1291] = 0.277777777778;
-            coordinates[1292] = 0.38888888888899997;
-            coordinates[1293] = 0.166666666667;
-            coordinates[1294] = 0.38888888888899997;
-            coordinates[1295] = 0.277777777778;
-            coordinates[1296] = 0.166666666667;
-            coordinates[1297] = 0.5;
-            coordinates[1298] = 0.166666666667;
-            coordinates[1299] = 0.166666666667;
-            coordinates[1300] = 0.61111111111100003;
-            coordinates[1301] = 0.055555555555600003;
-            coordinates[1302] = 0.277777777778;
-            coordinates[1303] = 0.055555555555600003;
-            coordinates[1304] = 0.5;
-            coordinates[1305] = 0.277777777778;
-            coordinates[1306] = 0.166666666667;
-            coordinates[1307] = 0.38888888888899997;
-            coordinates[1308] = 0.277777777778;
-            coordinates[1309] = 0.277777777778;
-            coordinates[1310] = 0.277777777778;
-            coordinates[1311] = 0.277777777778;
-            coordinates[1312] = 0.38888888888899997;
-            coordinates[1313] = 0.166666666667;
-            coordinates[1314] = 0.277777777778;
-            coordinates[1315] = 0.5;
-            coordinates[1316] = 0.055555555555600003;
-            coordinates[1317] = 0.38888888888899997;
-            coordinates[1318] = 0.055555555555600003;
-            coordinates[1319] = 0.38888888888899997;
-            coordinates[1320] = 0.38888888888899997;
-            coordinates[1321] = 0.166666666667;
-            coordinates[1322] = 0.277777777778;
-            coordinates[1323] = 0.38888888888899997;
-            coordinates[1324] = 0.277777777778;
-            coordinates[1325] = 0.166666666667;
-            coordinates[1326] = 0.38888888888899997;
-            coordinates[1327] = 0.38888888888899997;
-            coordinates[1328] = 0.055555555555600003;
-            coordinates[1329] = 0.5;
-            coordinates[1330] = 0.055555555555600003;
-            coordinates[1331] = 0.277777777778;
-            coordinates[1332] = 0.5;
-            coordinates[1333] = 0.166666666667;
-            coordinates[1334] = 0.166666666667;
-            coordinates[1335] = 0.5;
-            coordinates[1336] = 0.277777777778;
-            coordinates[1337] = 0.055555555555600003;
-            coordinates[1338] = 0.61111111111100003;
-            coordinates[1339] = 0.055555555555600003;
-            coordinates[1340] = 0.166666666667;
-            coordinates[1341] = 0.61111111111100003;
-            coordinates[1342] = 0.166666666667;
-            coordinates[1343] = 0.055555555555600003;
-            coordinates[1344] = 0.72222222222200005;
-            coordinates[1345] = 0.055555555555600003;
-            coordinates[1346] = 0.055555555555600003;
-            coordinates[1347] = 0.055555555555600003;
-            coordinates[1348] = 0.055555555555600003;
-            coordinates[1349] = 0.61111111111100003;
-            coordinates[1350] = 0.055555555555600003;
-            coordinates[1351] = 0.166666666667;
-            coordinates[1352] = 0.5;
-            coordinates[1353] = 0.055555555555600003;
-            coordinates[1354] = 0.277777777778;
-            coordinates[1355] = 0.38888888888899997;
-            coordinates[1356] = 0.055555555555600003;
-            coordinates[1357] = 0.38888888888899997;
-            coordinates[1358] = 0.277777777778;
-            coordinates[1359] = 0.055555555555600003;
-            coordinates[1360] = 0.5;
-            coordinates[1361] = 0.166666666667;
-            coordinates[1362] = 0.055555555555600003;
-            coordinates[1363] = 0.61111111111100003;
-            coordinates[1364] = 0.055555555555600003;
-            coordinates[1365] = 0.166666666667;
-            coordinates[1366] = 0.055555555555600003;
-            coordinates[1367] = 0.5;
-            coordinates[1368] = 0.166666666667;
-            coordinates[1369] = 0.166666666667;
-            coordinates[1370] = 0.38888888888899997;
-            coordinates[1371] = 0.166666666667;
-            coordinates[1372] = 0.277777777778;
-            coordinates[1373] = 0.277777777778;
-            coordinates[1374] = 0.166666666667;
-            coordinates[1375] = 0.38888888888899997;
-            coordinates[1376] = 0.166666666667;
-            coordinates[1377] = 0.166666666667;
-            coordinates[1378] = 0.5;
-            coordinates[1379] = 0.055555555555600003;
-            coordinates[1380] = 0.277777777778;
-            coordinates[1381] = 0.055555555555600003;
-            coordinates[1382] = 0.38888888888899997;
-            coordinates[1383] = 0.277777777778;
-            coordinates[1384] = 0.166666666667;
-            coordinates[1385] = 0.277777777778;
-            coordinates[1386] = 0.277777777778;
-            coordinates[1387] = 0.277777777778;
-            coordinates[1388] = 0.166666666667;
-            coordinates[1389] = 0.277777777778;
-            coordinates[1390] = 0.38888888888899997;
-            coordinates[1391] = 0.055555555555600003;
-            coordinates[1392] = 0.38888888888899997;
-            coordinates[1393] = 0.055555555555600003;
-            coordinates[1394] = 0.277777777778;
-            coordinates[1395] = 0.38888888888899997;
-            coordinates[1396] = 0.166666666667;
-            coordinates[1397] = 0.166666666667;
-            coordinates[1398] = 0.38888888888899997;
-            coordinates[1399] = 0.277777777778;
-            coordinates[1400] = 0.055555555555600003;
-            coordinates[1401] = 0.5;
-            coordinates[1402] = 0.055555555555600003;
-            coordinates[1403] = 0.166666666667;
-            coordinates[1404] = 0.5;
-            coordinates[1405] = 0.166666666667;
-            coordinates[1406] = 0.055555555555600003;
-            coordinates[1407] = 0.61111111111100003;
-            coordinates[1408] = 0.055555555555600003;
-            coordinates[1409] = 0.055555555555600003;
-            coordinates[1410] = 0.055555555555600003;
-            coordinates[1411] = 0.055555555555600003;
-            coordinates[1412] = 0.5;
-            coordinates[1413] = 0.055555555555600003;
-            coordinates[1414] = 0.166666666667;
-            coordinates[1415] = 0.38888888888899997;
-            coordinates[1416] = 0.055555555555600003;
-            coordinates[1417] = 0.277777777778;
-            coordinates[1418] = 0.277777777778;
-            coordinates[1419] = 0.055555555555600003;
-            coordinates[1420] = 0.38888888888899997;
-            coordinates[1421] = 0.166666666667;
-            coordinates[1422] = 0.055555555555600003;
-            coordinates[1423] = 0.5;
-            coordinates[1424] = 0.055555555555600003;
-            coordinates[1425] = 0.166666666667;
-            coordinates[1426] = 0.055555555555600003;
-            coordinates[1427] = 0.38888888888899997;
-            coordinates[1428] = 0.166666666667;
-            coordinates[1429] = 0.166666666667;
-            coordinates[1430] = 0.277777777778;
-            coordinates[1431] = 0.166666666667;
-            coordinates[1432] = 0.277777777778;
-            coordinates[1433] = 0.166666666667;
-            coordinates[1434] = 0.166666666667;
-            coordinates[1435] = 0.38888888888899997;
-            coordinates[1436] = 0.055555555555600003;
-            coordinates[1437] = 0.277777777778;
-            coordinates[1438] = 0.055555555555600003;
-            coordinates[1439] = 0.277777777778;
-            coordinates[1440] = 0.277777777778;
-            coordinates[1441] = 0.166666666667;
-            coordinates[1442] = 0.166666666667;
-            coordinates[1443] = 0.277777777778;
-            coordinates[1444] = 0.277777777778;
-            coordinates[1445] = 0.055555555555600003;
-            coordinates[1446] = 0.38888888888899997;
-            coordinates[1447] = 0.055555555555600003;
-            coordinates[1448] = 0.166666666667;
-            coordinates[1449] = 0.38888888888899997;
-            coordinates[1450] = 0.166666666667;
-            coordinates[1451] = 0.055555555555600003;
-            coordinates[1452] = 0.5;
-            coordinates[1453] = 0.055555555555600003;
-            coordinates[1454] = 0.055555555555600003;
-            coordinates[1455] = 0.055555555555600003;
-            coordinates[1456] = 0.055555555555600003;
-            coordinates[1457] = 0.38888888888899997;
-            coordinates[1458] = 0.055555555555600003;
-            coordinates[1459] = 0.166666666667;
-            coordinates[1460] = 0.277777777778;
-            coordinates[1461] = 0.055555555555600003;
-            coordinates[1462] = 0.277777777778;
-            coordinates[1463] = 0.166666666667;
-            coordinates[1464] = 0.055555555555600003;
-            coordinates[1465] = 0.38888888888899997;
-            coordinates[1466] = 0.055555555555600003;
-            coordinates[1467] = 0.166666666667;
-            coordinates[1468] = 0.055555555555600003;
-            coordinates[1469] = 0.277777777778;
-            coordinates[1470] = 0.166666666667;
-            coordinates[1471] = 0.166666666667;
-            coordinates[1472] = 0.166666666667;
-            coordinates[1473] = 0.166666666667;
-            coordinates[1474] = 0.277777777778;
-            coordinates[1475] = 0.055555555555600003;
-            coordinates[1476] = 0.277777777778;
-            coordinates[1477] = 0.055555555555600003;
-            coordinates[1478] = 0.166666666667;
-            coordinates[1479] = 0.277777777778;
-            coordinates[1480] = 0.166666666667;
-            coordinates[1481] = 0.055555555555600003;
-            coordinates[1482] = 0.38888888888899997;
-            coordinates[1483] = 0.055555555555600003;
-            coordinates[1484] = 0.055555555555600003;
-            coordinates[1485] = 0.055555555555600003;
-            coordinates[1486] = 0.055555555555600003;
-            coordinates[1487] = 0.277777777778;
-            coordinates[1488] = 0.055555555555600003;
-            coordinates[1489] = 0.166666666667;
-            coordinates[1490] = 0.166666666667;
-            coordinates[1491] = 0.055555555555600003;
-            coordinates[1492] = 0.277777777778;
-            coordinates[1493] = 0.055555555555600003;
-            coordinates[1494] = 0.166666666667;
-            coordinates[1495] = 0.055555555555600003;
-            coordinates[1496] = 0.166666666667;
-            coordinates[1497] = 0.166666666667;
-            coordinates[1498] = 0.166666666667;
-            coordinates[1499] = 0.055555555555600003;
-            coordinates[1500] = 0.277777777778;
-            coordinates[1501] = 0.055555555555600003;
-            coordinates[1502] = 0.055555555555600003;
-            coordinates[1503] = 0.055555555555600003;
-            coordinates[1504] = 0.055555555555600003;
-            coordinates[1505] = 0.166666666667;
-            coordinates[1506] = 0.055555555555600003;
-            coordinates[1507] = 0.166666666667;
-            coordinates[1508] = 0.055555555555600003;
-            coordinates[1509] = 0.166666666667;
-            coordinates[1510] = 0.055555555555600003;
-            coordinates[1511] = 0.055555555555600003;
-            coordinates[1512] = 0.055555555555600003;
-            coordinates[1513] = 0.055555555555600003;
-            coordinates[1514] = 0.055555555555600003;
-            coordinates[1515] = 0.0625;
-            coordinates[1516] = 0.0625;
-            coordinates[1517] = 0.8125;
-            coordinates[1518] = 0.0625;
-            coordinates[1519] = 0.1875;
-            coordinates[1520] = 0.6875;
-            coordinates[1521] = 0.0625;
-            coordinates[1522] = 0.3125;
-            coordinates[1523] = 0.5625;
-            coordinates[1524] = 0.0625;
-            coordinates[1525] = 0.4375;
-            coordinates[1526] = 0.4375;
-            coordinates[1527] = 0.0625;
-            coordinates[1528] = 0.5625;
-            coordinates[1529] = 0.3125;
-            coordinates[1530] = 0.0625;
-            coordinates[1531] = 0.6875;
-            coordinates[1532] = 0.1875;
-            coordinates[1533] = 0.0625;
-            coordinates[1534] = 0.8125;
-            coordinates[1535] = 0.0625;
-            coordinates[1536] = 0.1875;
-            coordinates[1537] = 0.0625;
-            coordinates[1538] = 0.6875;
-            coordinates[1539] = 0.1875;
-            coordinates[1540] = 0.1875;
-            coordinates[1541] = 0.5625;
-            coordinates[1542] = 0.1875;
-            coordinates[1543] = 0.3125;
-            coordinates[1544] = 0.4375;
-            coordinates[1545] = 0.1875;
-            coordinates[1546] = 0.4375;
-            coordinates[1547] = 0.3125;
-            coordinates[1548] = 0.1875;
-            coordinates[1549] = 0.5625;
-            coordinates[1550] = 0.1875;
-            coordinates[1551] = 0.1875;
-            coordinates[1552] = 0.6875;
-            coordinates[1553] = 0.0625;
-            coordinates[1554] = 0.3125;
-            coordinates[1555] = 0.0625;
-            coordinates[1556] = 0.5625;
-            coordinates[1557] = 0.3125;
-            coordinates[1558] = 0.1875;
-            coordinates[1559] = 0.4375;
-            coordinates[1560] = 0.3125;
-            coordinates[1561] = 0.3125;
-            coordinates[1562] = 0.3125;
-            coordinates[1563] = 0.3125;
-            coordinates[1564] = 0.4375;
-            coordinates[1565] = 0.1875;
-            coordinates[1566] = 0.3125;
-            coordinates[1567] = 0.5625;
-            coordinates[1568] = 0.0625;
-            coordinates[1569] = 0.4375;
-            coordinates[1570] = 0.0625;
-            coordinates[1571] = 0.4375;
-            coordinates[1572] = 0.4375;
-            coordinates[1573] = 0.1875;
-            coordinates[1574] = 0.3125;
-            coordinates[1575] = 0.4375;
-            coordinates[1576] = 0.3125;
-            coordinates[1577] = 0.1875;
-            coordinates[1578] = 0.4375;
-            coordinates[1579] = 0.4375;
-            coordinates[1580] = 0.0625;
-            coordinates[1581] = 0.5625;
-            coordinates[1582] = 0.0625;
-            coordinates[1583] = 0.3125;
-            coordinates[1584] = 0.5625;
-            coordinates[1585] = 0.1875;
-            coordinates[1586] = 0.1875;
-            coordinates[1587] = 0.5625;
-            coordinates[1588] = 0.3125;
-            coordinates[1589] = 0.0625;
-            coordinates[1590] = 0.6875;
-            coordinates[1591] = 0.0625;
-            coordinates[1592] = 0.1875;
-            coordinates[1593] = 0.6875;
-            coordinates[1594] = 0.1875;
-            coordinates[1595] = 0.0625;
-            coordinates[1596] = 0.8125;
-            coordinates[1597] = 0.0625;
-            coordinates[1598] = 0.0625;
-            coordinates[1599] = 0.0625;
-            coordinates[1600] = 0.0625;
-            coordinates[1601] = 0.6875;
-            coordinates[1602] = 0.0625;
-            coordinates[1603] = 0.1875;
-            coordinates[1604] = 0.5625;
-            coordinates[1605] = 0.0625;
-            coordinates[1606] = 0.3125;
-            coordinates[1607] = 0.4375;
-            coordinates[1608] = 0.0625;
-            coordinates[1609] = 0.4375;
-            coordinates[1610] = 0.3125;
-            coordinates[1611] = 0.0625;
-            coordinates[1612] = 0.5625;
-            coordinates[1613] = 0.1875;
-            coordinates[1614] = 0.0625;
-            coordinates[1615] = 0.6875;
-            coordinates[1616] = 0.0625;
-            coordinates[1617] = 0.1875;
-            coordinates[1618] = 0.0625;
-            coordinates[1619] = 0.5625;
-            coordinates[1620] = 0.1875;
-            coordinates[1621] = 0.1875;
-            coordinates[1622] = 0.4375;
-            coordinates[1623] = 0.1875;
-            coordinates[1624] = 0.3125;
-            coordinates[1625] = 0.3125;
-            coordinates[1626] = 0.1875;
-            coordinates[1627] = 0.4375;
-            coordinates[1628] = 0.1875;
-            coordinates[1629] = 0.1875;
-            coordinates[1630] = 0.5625;
-            coordinates[1631] = 0.0625;
-            coordinates[1632] = 0.3125;
-            coordinates[1633] = 0.0625;
-            coordinates[1634] = 0.4375;
-            coordinates[1635] = 0.3125;
-            coordinates[1636] = 0.1875;
-            coordinates[1637] = 0.3125;
-            coordinates[1638] = 0.3125;
-            coordinates[1639] = 0.3125;
-            coordinates[1640] = 0.1875;
-            coordinates[1641] = 0.3125;
-            coordinates[1642] = 0.4375;
-            coordinates[1643] = 0.0625;
-            coordinates[1644] = 0.4375;
-            coordinates[1645] = 0.0625;
-            coordinates[1646] = 0.3125;
-            coordinates[1647] = 0.4375;
-            coordinates[1648] = 0.1875;
-            coordinates[1649] = 0.1875;
-            coordinates[1650] = 0.4375;
-            coordinates[1651] = 0.3125;
-            coordinates[1652] = 0.0625;
-            coordinates[1653] = 0.5625;
-            coordinates[1654] = 0.0625;
-            coordinates[1655] = 0.1875;
-            coordinates[1656] = 0.5625;
-            coordinates[1657] = 0.1875;
-            coordinates[1658] = 0.0625;
-            coordinates[1659] = 0.6875;
-            coordinates[1660] = 0.0625;
-            coordinates[1661] = 0.0625;
-            coordinates[1662] = 0.0625;
-            coordinates[1663] = 0.0625;
-            coordinates[1664] = 0.5625;
-            coordinates[1665] = 0.0625;
-            coordinates[1666] = 0.1875;
-            coordinates[1667] = 0.4375;
-            coordinates[1668] = 0.0625;
-            coordinates[1669] = 0.3125;
-            coordinates[1670] = 0.3125;
-            coordinates[1671] = 0.0625;
-            coordinates[1672] = 0.4375;
-            coordinates[1673] = 0.1875;
-            coordinates[1674] = 0.0625;
-            coordinates[1675] = 0.5625;
-            coordinates[1676] = 0.0625;
-            coordinates[1677] = 0.1875;
-            coordinates[1678] = 0.0625;
-            coordinates[1679] = 0.4375;
-            coordinates[1680] = 0.1875;
-            coordinates[1681] = 0.1875;
-            coordinates[1682] = 0.3125;
-            coordinates[1683] = 0.1875;
-            coordinates[1684] = 0.3125;
-            coordinates[1685] = 0.1875;
-            coordinates[1686] = 0.1875;
-            coordinates[1687] = 0.4375;
-            coordinates[1688] = 0.0625;
-            coordinates[1689] = 0.3125;
-            coordinates[1690] = 0.0625;
-            coordinates[1691] = 0.3125;
-            coordinates[1692] = 0.3125;
-            coordinates[1693] = 0.1875;
-            coordinates[1694] = 0.1875;
-            coordinates[1695] = 0.3125;
-            coordinates[1696] = 0.3125;
-            coordinates[1697] = 0.0625;
-            coordinates[1698] = 0.4375;
-            coordinates[1699] = 0.0625;
-            coordinates[1700] = 0.1875;
-            coordinates[1701] = 0.4375;
-            coordinates[1702] = 0.1875;
-            coordinates[1703] = 0.0625;
-            coordinates[1704] = 0.5625;
-            coordinates[1705] = 0.0625;
-            coordinates[1706] = 0.0625;
-            coordinates[1707] = 0.0625;
-            coordinates[1708] = 0.0625;
-            coordinates[1709] = 0.4375;
-            coordinates[1710] = 0.0625;
-            coordinates[1711] = 0.1875;
-            coordinates[1712] = 0.3125;
-            coordinates[1713] = 0.0625;
-            coordinates[1714] = 0.3125;
-            coordinates[1715] = 0.1875;
-            coordinates[1716] = 0.0625;
-            coordinates[1717] = 0.4375;
-            coordinates[1718] = 0.0625;
-            coordinates[1719] = 0.1875;
-            coordinates[1720] = 0.0625;
-            coordinates[1721] = 0.3125;
-            coordinates[1722] = 0.1875;
-            coordinates[1723] = 0.1875;
-            coordinates[1724] = 0.1875;
-            coordinates[1725] = 0.1875;
-            coordinates[1726] = 0.3125;
-            coordinates[1727] = 0.0625;
-            coordinates[1728] = 0.3125;
-            coordinates[1729] = 0.0625;
-            coordinates[1730] = 0.1875;
-            coordinates[1731] = 0.3125;
-            coordinates[1732] = 0.1875;
-            coordinates[1733] = 0.0625;
-            coordinates[1734] = 0.4375;
-            coordinates[1735] = 0.0625;
-            coordinates[1736] = 0.0625;
-            coordinates[1737] = 0.0625;
-            coordinates[1738] = 0.0625;
-            coordinates[1739] = 0.3125;
-            coordinates[1740] = 0.0625;
-            coordinates[1741] = 0.1875;
-            coordinates[1742] = 0.1875;
-            coordinates[1743] = 0.0625;
-            coordinates[1744] = 0.3125;
-            coordinates[1745] = 0.0625;
-            coordinates[1746] = 0.1875;
-            coordinates[1747] = 0.0625;
-            coordinates[1748] = 0.1875;
-            coordinates[1749] = 0.1875;
-            coordinates[1750] = 0.1875;
-            coordinates[1751] = 0.0625;
-            coordinates[1752] = 0.3125;
-            coordinates[1753] = 0.0625;
-            coordinates[1754] = 0.0625;
-            coordinates[1755] = 0.0625;
-            coordinates[1756] = 0.0625;
-            coordinates[1757] = 0.1875;
-            coordinates[1758] = 0.0625;
-            coordinates[1759] = 0.1875;
-            coordinates[1760] = 0.0625;
-            coordinates[1761] = 0.1875;
-            coordinates[1762] = 0.0625;
-            coordinates[1763] = 0.0625;
-            coordinates[1764] = 0.0625;
-            coordinates[1765] = 0.0625;
-            coordinates[1766] = 0.0625;
-            coordinates[1767] = 0.071428571428599999;
-            coordinates[1768] = 0.071428571428599999;
-            coordinates[1769] = 0.78571428571400004;
-            coordinates[1770] = 0.071428571428599999;
-            coordinates[1771] = 0.21428571428599999;
-            coordinates[1772] = 0.64285714285700002;
-            coordinates[1773] = 0.071428571428599999;
-            coordinates[1774] = 0.35714285714299998;
-            coordinates[1775] = 0.5;
-            coordinates[1776] = 0.071428571428599999;
-            coordinates[1777] = 0.5;
-            coordinates[1778] = 0.35714285714299998;
-            coordinates[1779] = 0.071428571428599999;
-            coordinates[1780] = 0.64285714285700002;
-            coordinates[1781] = 0.21428571428599999;
-            coordinates[1782] = 0.071428571428599999;
-            coordinates[1783] = 0.78571428571400004;
-            coordinates[1784] = 0.071428571428599999;
-            coordinates[1785] = 0.21428571428599999;
-            coordinates[1786] = 0.071428571428599999;
-            coordinates[1787] = 0.64285714285700002;
-            coordinates[1788] = 0.21428571428599999;
-            coordinates[1789] = 0.21428571428599999;
-            coordinates[1790] = 0.5;
-            coordinates[1791] = 0.21428571428599999;
-            coordinates[1792] = 0.35714285714299998;
-            coordinates[1793] = 0.35714285714299998;
-            coordinates[1794] = 0.21428571428599999;
-            coordinates[1795] = 0.5;
-            coordinates[1796] = 0.21428571428599999;
-            coordinates[1797] = 0.21428571428599999;
-            coordinates[1798] = 0.64285714285700002;
-            coordinates[1799] = 0.071428571428599999;
-            coordinates[1800] = 0.35714285714299998;
-            coordinates[1801] = 0.071428571428599999;
-            coordinates[1802] = 0.5;
-            coordinates[1803] = 0.35714285714299998;
-            coordinates[1804] = 0.21428571428599999;
-            coordinates[1805] = 0.35714285714299998;
-            coordinates[1806] = 0.35714285714299998;
-            coordinates[1807] = 0.35714285714299998;
-            coordinates[1808] = 0.21428571428599999;
-            coordinates[1809] = 0.35714285714299998;
-            coordinates[1810] = 0.5;
-            coordinates[1811] = 0.071428571428599999;
-            coordinates[1812] = 0.5;
-            coordinates[1813] = 0.071428571428599999;
-            coordinates[1814] = 0.35714285714299998;
-            coordinates[1815] = 0.5;
-            coordinates[1816] = 0.21428571428599999;
-            coordinates[1817] = 0.21428571428599999;
-            coordinates[1818] = 0.5;
-            coordinates[1819] = 0.35714285714299998;
-            coordinates[1820] = 0.071428571428599999;
-            coordinates[1821] = 0.64285714285700002;
-            coordinates[1822] = 0.071428571428599999;
-            coordinates[1823] = 0.21428571428599999;
-            coordinates[1824] = 0.64285714285700002;
-            coordinates[1825] = 0.21428571428599999;
-            coordinates[1826] = 0.071428571428599999;
-            coordinates[1827] = 0.78571428571400004;
-            coordinates[1828] = 0.071428571428599999;
-            coordinates[1829] = 0.071428571428599999;
-            coordinates[1830] = 0.071428571428599999;
-            coordinates[1831] = 0.071428571428599999;
-            coordinates[1832] = 0.64285714285700002;
-            coordinates[1833] = 0.071428571428599999;
-            coordinates[1834] = 0.21428571428599999;
-            coordinates[1835] = 0.5;
-            coordinates[1836] = 0.071428571428599999;
-            coordinates[1837] = 0.35714285714299998;
-            coordinates[1838] = 0.35714285714299998;
-            coordinates[1839] = 0.071428571428599999;
-            coordinates[1840] = 0.5;
-            coordinates[1841] = 0.21428571428599999;
-            coordinates[1842] = 0.071428571428599999;
-            coordinates[1843] = 0.64285714285700002;
-            coordinates[1844] = 0.071428571428599999;
-            coordinates[1845] = 0.21428571428599999;
-            coordinates[1846] = 0.071428571428599999;
-            coordinates[1847] = 0.5;
-            coordinates[1848] = 0.21428571428599999;
-            coordinates[1849] = 0.21428571428599999;
-            coordinates[1850] = 0.35714285714299998;
-            coordinates[1851] = 0.21428571428599999;
-            coordinates[1852] = 0.35714285714299998;
-            coordinates[1853] = 0.21428571428599999;
-            coordinates[1854] = 0.21428571428599999;
-            coordinates[1855] = 0.5;
-            coordinates[1856] = 0.071428571428599999;
-            coordinates[1857] = 0.35714285714299998;
-            coordinates[1858] = 0.071428571428599999;
-            coordinates[1859] = 0.35714285714299998;
-            coordinates[1860] = 0.35714285714299998;
-            coordinates[1861] = 0.21428571428599999;
-            coordinates[1862] = 0.21428571428599999;
-            coordinates[1863] = 0.35714285714299998;
-            coordinates[1864] = 0.35714285714299998;
-            coordinates[1865] = 0.071428571428599999;
-            coordinates[1866] = 0.5;
-            coordinates[1867] = 0.071428571428599999;
-            coordinates[1868] = 0.21428571428599999;
-            coordinates[1869] = 0.5;
-            coordinates[1870] = 0.21428571428599999;
-            coordinates[1871] = 0.071428571428599999;
-            coordinates[1872] = 0.64285714285700002;
-            coordinates[1873] = 0.071428571428599999;
-            coordinates[1874] = 0.071428571428599999;
-            coordinates[1875] = 0.071428571428599999;
-            coordinates[1876] = 0.071428571428599999;
-            coordinates[1877] = 0.5;
-            coordinates[1878] = 0.071428571428599999;
-            coordinates[1879] = 0.21428571428599999;
-            coordinates[1880] = 0.35714285714299998;
-            coordinates[1881] = 0.071428571428599999;
-            coordinates[1882] = 0.35714285714299998;
-            coordinates[1883] = 0.21428571428599999;
-            coordinates[1884] = 0.071428571428599999;
-            coordinates[1885] = 0.5;
-            coordinates[1886] = 0.071428571428599999;
-            coordinates[1887] = 0.21428571428599999;
-            coordinates[1888] = 0.071428571428599999;
-            coordinates[1889] = 0.35714285714299998;
-            coordinates[1890] = 0.21428571428599999;
-            coordinates[1891] = 0.21428571428599999;
-            coordinates[1892] = 0.21428571428599999;
-            coordinates[1893] = 0.21428571428599999;
-            coordinates[1894] = 0.35714285714299998;
-            coordinates[1895] = 0.071428571428599999;
-            coordinates[1896] = 0.35714285714299998;
-            coordinates[1897] = 0.071428571428599999;
-            coordinates[1898] = 0.21428571428599999;
-            coordinates[1899] = 0.35714285714299998;
-            coordinates[1900] = 0.21428571428599999;
-            coordinates[1901] = 0.071428571428599999;
-            coordinates[1902] = 0.5;
-            coordinates[1903] = 0.071428571428599999;
-            coordinates[1904] = 0.071428571428599999;
-            coordinates[1905] = 0.071428571428599999;
-            coordinates[1906] = 0.071428571428599999;
-            coordinates[1907] = 0.35714285714299998;
-            coordinates[1908] = 0.071428571428599999;
-            coordinates[1909] = 0.21428571428599999;
-            coordinates[1910] = 0.21428571428599999;
-            coordinates[1911] = 0.071428571428599999;
-            coordinates[1912] = 0.35714285714299998;
-            coordinates[1913] = 0.071428571428599999;
-            coordinates[1914] = 0.21428571428599999;
-            coordinates[1915] = 0.071428571428599999;
-            coordinates[1916] = 0.21428571428599999;
-            coordinates[1917] = 0.21428571428599999;
-            coordinates[1918] = 0.21428571428599999;
-            coordinates[1919] = 0.071428571428599999;
-            coordinates[1920] = 0.35714285714299998;
-            coordinates[1921] = 0.071428571428599999;
-            coordinates[1922] = 0.071428571428599999;
-            coordinates[1923] = 0.071428571428599999;
-            coordinates[1924] = 0.071428571428599999;
-            coordinates[1925] = 0.21428571428599999;
-            coordinates[1926] = 0.071428571428599999;
-            coordinates[1927] = 0.21428571428599999;
-            coordinates[1928] = 0.071428571428599999;
-            coordinates[1929] = 0.21428571428599999;
-            coordinates[1930] = 0.071428571428599999;
-            coordinates[1931] = 0.071428571428599999;
-            coordinates[1932] = 0.071428571428599999;
-            coordinates[1933] = 0.071428571428599999;
-            coordinates[1934] = 0.071428571428599999;
-            coordinates[1935] = 0.083333333333299994;
-            coordinates[1936] = 0.083333333333299994;
-            coordinates[1937] = 0.75;
-            coordinates[1938] = 0.083333333333299994;
-            coordinates[1939] = 0.25;
-            coordinates[1940] = 0.58333333333299997;
-            coordinates[1941] = 0.083333333333299994;
-            coordinates[1942] = 0.41666666666699997;
-            coordinates[1943] = 0.41666666666699997;
-            coordinates[1944] = 0.083333333333299994;
-            coordinates[1945] = 0.58333333333299997;
-            coordinates[1946] = 0.25;
-            coordinates[1947] = 0.083333333333299994;
-            coordinates[1948] = 0.75;
-            coordinates[1949] = 0.083333333333299994;
-            coordinates[1950] = 0.25;
-            coordinates[1951] = 0.083333333333299994;
-            coordinates[1952] = 0.58333333333299997;
-            coordinates[1953] = 0.25;
-            coordinates[1954] = 0.25;
-            coordinates[1955] = 0.41666666666699997;
-            coordinates[1956] = 0.25;
-            coordinates[1957] = 0.41666666666699997;
-            coordinates[1958] = 0.25;
-            coordinates[1959] = 0.25;
-            coordinates[1960] = 0.58333333333299997;
-            coordinates[1961] = 0.083333333333299994;
-            coordinates[1962] = 0.41666666666699997;
-            coordinates[1963] = 0.083333333333299994;
-            coordinates[1964] = 0.41666666666699997;
-            coordinates[1965] = 0.41666666666699997;
-            coordinates[1966] = 0.25;
-            coordinates[1967] = 0.25;
-            coordinates[1968] = 0.41666666666699997;
-            coordinates[1969] = 0.41666666666699997;
-            coordinates[1970] = 0.083333333333299994;
-            coordinates[1971] = 0.58333333333299997;
-            coordinates[1972] = 0.083333333333299994;
-            coordinates[1973] = 0.25;
-            coordinates[1974] = 0.58333333333299997;
-            coordinates[1975] = 0.25;
-            coordinates[1976] = 0.083333333333299994;
-            coordinates[1977] = 0.75;
-            coordinates[1978] = 0.083333333333299994;
-            coordinates[1979] = 0.083333333333299994;
-            coordinates[1980] = 0.083333333333299994;
-            coordinates[1981] = 0.083333333333299994;
-            coordinates[1982] = 0.58333333333299997;
-            coordinates[1983] = 0.083333333333299994;
-            coordinates[1984] = 0.25;
-            coordinates[1985] = 0.41666666666699997;
-            coordinates[1986] = 0.083333333333299994;
-            coordinates[1987] = 0.41666666666699997;
-            coordinates[1988] = 0.25;
-            coordinates[1989] = 0.083333333333299994;
-            coordinates[1990] = 0.58333333333299997;
-            coordinates[1991] = 0.083333333333299994;
-            coordinates[1992] = 0.25;
-            coordinates[1993] = 0.083333333333299994;
-            coordinates[1994] = 0.41666666666699997;
-            coordinates[1995] = 0.25;
-            coordinates[1996] = 0.25;
-            coordinates[1997] = 0.25;
-            coordinates[1998] = 0.25;
-            coordinates[1999] = 0.41666666666699997;
-            coordinates[2000] = 0.083333333333299994;
-            coordinates[2001] = 0.41666666666699997;
-            coordinates[2002] = 0.083333333333299994;
-            coordinates[2003] = 0.25;
-            coordinates[2004] = 0.41666666666699997;
-            coordinates[2005] = 0.25;
-            coordinates[2006] = 0.083333333333299994;
-            coordinates[2007] = 0.58333333333299997;
-            coordinates[2008] = 0.083333333333299994;
-            coordinates[2009] = 0.083333333333299994;
-            coordinates[2010] = 0.083333333333299994;
-            coordinates[2011] = 0.083333333333299994;
-            coordinates[2012] = 0.41666666666699997;
-            coordinates[2013] = 0.083333333333299994;
-            coordinates[2014] = 0.25;
-            coordinates[2015] = 0.25;
-            coordinates[2016] = 0.083333333333299994;
-            coordinates[2017] = 0.41666666666699997;
-            coordinates[2018] = 0.083333333333299994;
-            coordinates[2019] = 0.25;
-            coordinates[2020] = 0.083333333333299994;
-            coordinates[2021] = 0.25;
-            coordinates[2022] = 0.25;
-            coordinates[2023] = 0.25;
-            coordinates[2024] = 0.083333333333299994;
-            coordinates[2025] = 0.41666666666699997;
-            coordinates[2026] = 0.083333333333299994;
-            coordinates[2027] = 0.083333333333299994;
-            coordinates[2028] = 0.083333333333299994;
-            coordinates[2029] = 0.083333333333299994;
-            coordinates[2030] = 0.25;
-            coordinates[2031] = 0.083333333333299994;
-            coordinates[2032] = 0.25;
-            coordinates[2033] = 0.083333333333299994;
-            coordinates[2034] = 0.25;
-            coordinates[2035] = 0.083333333333299994;
-            coordinates[2036] = 0.083333333333299994;
-            coordinates[2037] = 0.083333333333299994;
-            coordinates[2038] = 0.083333333333299994;
-            coordinates[2039] = 0.083333333333299994;
-            coordinates[2040] = 0.10000000000000001;
-            coordinates[2041] = 0.10000000000000001;
-            coordinates[2042] = 0.69999999999999996;
-            coordinates[2043] = 0.10000000000000001;
-            coordinates[2044] = 0.29999999999999999;
-            coordinates[2045] = 0.5;
-            coordinates[2046] = 0.10000000000000001;
-            coordinates[2047] = 0.5;
-            coordinates[2048] = 0.29999999999999999;
-            coordinates[2049] = 0.10000000000000001;
-            coordinates[2050] = 0.69999999999999996;
-            coordinates[2051] = 0.10000000000000001;
-            coordinates[2052] = 0.29999999999999999;
-            coordinates[2053] = 0.10000000000000001;
-            coordinates[2054] = 0.5;
-            coordinates[2055] = 0.29999999999999999;
-            coordinates[2056] = 0.29999999999999999;
-            coordinates[2057] = 0.29999999999999999;
-            coordinates[2058] = 0.29999999999999999;
-            coordinates[2059] = 0.5;
-            coordinates[2060] = 0.10000000000000001;
-            coordinates[2061] = 0.5;
-            coordinates[2062] = 0.10000000000000001;
-            coordinates[2063] = 0.29999999999999999;
-            coordinates[2064] = 0.5;
-            coordinates[2065] = 0.29999999999999999;
-            coordinates[2066] = 0.10000000000000001;
-            coordinates[2067] = 0.69999999999999996;
-            coordinates[2068] = 0.10000000000000001;
-            coordinates[2069] = 0.10000000000000001;
-            coordinates[2070] = 0.10000000000000001;
-            coordinates[2071] = 0.10000000000000001;
-            coordinates[2072] = 0.5;
-            coordinates[2073] = 0.10000000000000001;
-            coordinates[2074] = 0.29999999999999999;
-            coordinates[2075] = 0.29999999999999999;
-            coordinates[2076] = 0.10000000000000001;
-            coordinates[2077] = 0.5;
-            coordinates[2078] = 0.10000000000000001;
-            coordinates[2079] = 0.29999999999999999;
-            coordinates[2080] = 0.10000000000000001;
-            coordinates[2081] = 0.29999999999999999;
-            coordinates[2082] = 0.29999999999999999;
-            coordinates[2083] = 0.29999999999999999;
-            coordinates[2084] = 0.10000000000000001;
-            coordinates[2085] = 0.5;
-            coordinates[2086] = 0.10000000000000001;
-            coordinates[2087] = 0.10000000000000001;
-            coordinates[2088] = 0.10000000000000001;
-            coordinates[2089] = 0.10000000000000001;
-            coordinates[2090] = 0.29999999999999999;
-            coordinates[2091] = 0.10000000000000001;
-            coordinates[2092] = 0.29999999999999999;
-            coordinates[2093] = 0.10000000000000001;
-            coordinates[2094] = 0.29999999999999999;
-            coordinates[2095] = 0.10000000000000001;
-            coordinates[2096] = 0.10000000000000001;
-            coordinates[2097] = 0.10000000000000001;
-            coordinates[2098] = 0.10000000000000001;
-            coordinates[2099] = 0.10000000000000001;
-            coordinates[2100] = 0.125;
-            coordinates[2101] = 0.125;
-            coordinates[2102] = 0.625;
-            coordinates[2103] = 0.125;
-            coordinates[2104] = 0.375;
-            coordinates[2105] = 0.375;
-            coordinates[2106] = 0.125;
-            coordinates[2107] = 0.625;
-            coordinates[2108] = 0.125;
-            coordinates[2109] = 0.375;
-            coordinates[2110] = 0.125;
-            coordinates[2111] = 0.375;
-            coordinates[2112] = 0.375;
-            coordinates[2113] = 0.375;
-            coordinates[2114] = 0.125;
-            coordinates[2115] = 0.625;
-            coordinates[2116] = 0.125;
-            coordinates[2117] = 0.125;
-            coordinates[2118] = 0.125;
-            coordinates[2119] = 0.125;
-            coordinates[2120] = 0.375;
-            coordinates[2121] = 0.125;
-            coordinates[2122] = 0.375;
-            coordinates[2123] = 0.125;
-            coordinates[2124] = 0.375;
-            coordinates[2125] = 0.125;
-            coordinates[2126] = 0.125;
-            coordinates[2127] = 0.125;
-            coordinates[2128] = 0.125;
-            coordinates[2129] = 0.125;
-            coordinates[2130] = 0.166666666667;
-            coordinates[2131] = 0.166666666667;
-            coordinates[2132] = 0.5;
-            coordinates[2133] = 0.166666666667;
-            coordinates[2134] = 0.5;
-            coordinates[2135] = 0.166666666667;
-            coordinates[2136] = 0.5;
-            coordinates[2137] = 0.166666666667;
-            coordinates[2138] = 0.166666666667;
-            coordinates[2139] = 0.166666666667;
-            coordinates[2140] = 0.166666666667;
-            coordinates[2141] = 0.166666666667;
-            coordinates[2142] = 0.25;
-            coordinates[2143] = 0.25;
-            coordinates[2144] = 0.25;
-
-            weights[0] = 0.10882393389433299;
-            weights[1] = 0.10882393389433299;
-            weights[2] = 0.10882393389433299;
-            weights[3] = 0.10882393389433299;
-            weights[4] = 0.10882393389433299;
-            weights[5] = 0.10882393389433299;
-            weights[6] = 0.10882393389433299;
-            weights[7] = 0.10882393389433299;
-            weights[8] = 0.10882393389433299;
-            weights[9] = 0.10882393389433299;
-            weights[10] = 0.10882393389433299;
-            weights[11] = 0.10882393389433299;
-            weights[12] = 0.10882393389433299;
-            weights[13] = 0.10882393389433299;
-            weights[14] = 0.10882393389433299;
-            weights[15] = 0.10882393389433299;
-            weights[16] = 0.10882393389433299;
-            weights[17] = 0.10882393389433299;
-            weights[18] = 0.10882393389433299;
-            weights[19] = 0.10882393389433299;
-            weights[20] = 0.10882393389433299;
-            weights[21] = 0.10882393389433299;
-            weights[22] = 0.10882393389433299;
-            weights[23] = 0.10882393389433299;
-            weights[24] = 0.10882393389433299;
-            weights[25] = 0.10882393389433299;
-            weights[26] = 0.10882393389433299;
-            weights[27] = 0.10882393389433299;
-            weights[28] = 0.10882393389433299;
-            weights[29] = 0.10882393389433299;
-            weights[30] = 0.10882393389433299;
-            weights[31] = 0.10882393389433299;
-            weights[32] = 0.10882393389433299;
-            weights[33] = 0.10882393389433299;
-            weights[34] = 0.10882393389433299;
-            weights[35] = 0.10882393389433299;
-            weights[36] = 0.10882393389433299;
-            weights[37] = 0.10882393389433299;
-            weights[38] = 0.10882393389433299;
-            weights[39] = 0.10882393389433299;
-            weights[40] = 0.10882393389433299;
-            weights[41] = 0.10882393389433299;
-            weights[42] = 0.10882393389433299;
-            weights[43] = 0.10882393389433299;
-            weights[44] = 0.10882393389433299;
-            weights[45] = 0.10882393389433299;
-            weights[46] = 0.10882393389433299;
-            weights[47] = 0.10882393389433299;
-            weights[48] = 0.10882393389433299;
-            weights[49] = 0.10882393389433299;
-            weights[50] = 0.10882393389433299;
-            weights[51] = 0.10882393389433299;
-            weights[52] = 0.10882393389433299;
-            weights[53] = 0.10882393389433299;
-            weights[54] = 0.10882393389433299;
-            weights[55] = 0.10882393389433299;
-            weights[56] = 0.10882393389433299;
-            weights[57] = 0.10882393389433299;
-            weights[58] = 0.10882393389433299;
-            weights[59] = 0.10882393389433299;
-            weights[60] = 0.10882393389433299;
-            weights[61] = 0.10882393389433299;
-            weights[62] = 0.10882393389433299;
-            weights[63] = 0.10882393389433299;
-            weights[64] = 0.10882393389433299;
-            weights[65] = 0.10882393389433299;
-            weights[66] = 0.10882393389433299;
-            weights[67] = 0.10882393389433299;
-            weights[68] = 0.10882393389433299;
-            weights[69] = 0.10882393389433299;
-            weights[70] = 0.10882393389433299;
-            weights[71] = 0.10882393389433299;
-            weights[72] = 0.10882393389433299;
-            weights[73] = 0.10882393389433299;
-            weights[74] = 0.10882393389433299;
-            weights[75] = 0.10882393389433299;
-            weights[76] = 0.10882393389433299;
-            weights[77] = 0.10882393389433299;
-            weights[78] = 0.10882393389433299;
-            weights[79] = 0.10882393389433299;
-            weights[80] = 0.10882393389433299;
-            weights[81] = 0.10882393389433299;
-            weights[82] = 0.10882393389433299;
-            weights[83] = 0.10882393389433299;
-            weights[84] = 0.10882393389433299;
-            weights[85] = 0.10882393389433299;
-            weights[86] = 0.10882393389433299;
-            weights[87] = 0.10882393389433299;
-            weights[88] = 0.10882393389433299;
-            weights[89] = 0.10882393389433299;
-            weights[90] = 0.10882393389433299;
-            weights[91] = 0.10882393389433299;
-            weights[92] = 0.10882393389433299;
-            weights[93] = 0.10882393389433299;
-            weights[94] = 0.10882393389433299;
-            weights[95] = 0.10882393389433299;
-            weights[96] = 0.10882393389433299;
-            weights[97] = 0.10882393389433299;
-            weights[98] = 0.10882393389433299;
-            weights[99] = 0.10882393389433299;
-            weights[100] = 0.10882393389433299;
-            weights[101] = 0.10882393389433299;
-            weights[102] = 0.10882393389433299;
-            weights[103] = 0.10882393389433299;
-            weights[104] = 0.10882393389433299;
-            weights[105] = 0.10882393389433299;
-            weights[106] = 0.10882393389433299;
-            weights[107] = 0.10882393389433299;
-            weights[108] = 0.10882393389433299;
-            weights[109] = 0.10882393389433299;
-            weights[110] = 0.10882393389433299;
-            weights[111] = 0.10882393389433299;
-            weights[112] = 0.10882393389433299;
-            weights[113] = 0.10882393389433299;
-            weights[114] = 0.10882393389433299;
-            weights[115] = 0.10882393389433299;
-            weights[116] = 0.10882393389433299;
-            weights[117] = 0.10882393389433299;
-            weights[118] = 0.10882393389433299;
-            weights[119] = 0.10882393389433299;
-            weights[120] = 0.10882393389433299;
-            weights[121] = 0.10882393389433299;
-            weights[122] = 0.10882393389433299;
-            weights[123] = 0.10882393389433299;
-            weights[124] = 0.10882393389433299;
-            weights[125] = 0.10882393389433299;
-            weights[126] = 0.10882393389433299;
-            weights[127] = 0.10882393389433299;
-            weights[128] = 0.10882393389433299;
-            weights[129] = 0.10882393389433299;
-            weights[130] = 0.10882393389433299;
-            weights[131] = 0.10882393389433299;
-            weights[132] = 0.10882393389433299;
-            weights[133] = 0.10882393389433299;
-            weights[134] = 0.10882393389433299;
-            weights[135] = 0.10882393389433299;
-            weights[136] = 0.10882393389433299;
-            weights[137] = 0.10882393389433299;
-            weights[138] = 0.10882393389433299;
-            weights[139] = 0.10882393389433299;
-            weights[140] = 0.10882393389433299;
-            weights[141] = 0.10882393389433299;
-            weights[142] = 0.10882393389433299;
-            weights[143] = 0.10882393389433299;
-            weights[144] = 0.10882393389433299;
-            weights[145] = 0.10882393389433299;
-            weights[146] = 0.10882393389433299;
-            weights[147] = 0.10882393389433299;
-            weights[148] = 0.10882393389433299;
-            weights[149] = 0.10882393389433299;
-            weights[150] = 0.10882393389433299;
-            weights[151] = 0.10882393389433299;
-            weights[152] = 0.10882393389433299;
-            weights[153] = 0.10882393389433299;
-            weights[154] = 0.10882393389433299;
-            weights[155] = 0.10882393389433299;
-            weights[156] = 0.10882393389433299;
-            weights[157] = 0.10882393389433299;
-            weights[158] = 0.10882393389433299;
-            weights[159] = 0.10882393389433299;
-            weights[160] = 0.10882393389433299;
-            weights[161] = 0.10882393389433299;
-            weights[162] = 0.10882393389433299;
-            weights[163] = 0.10882393389433299;
-            weights[164] = 0.10882393389433299;
-            weights[165] = 0.10882393389433299;
-            weights[166] = 0.10882393389433299;
-            weights[167] = 0.10882393389433299;
-            weights[168] = 0.10882393389433299;
-            weights[169] = 0.10882393389433299;
-            weights[170] = 0.10882393389433299;
-            weights[171] = 0.10882393389433299;
-            weights[172] = 0.10882393389433299;
-            weights[173] = 0.10882393389433299;
-            weights[174] = 0.10882393389433299;
-            weights[175] = 0.10882393389433299;
-            weights[176] = 0.10882393389433299;
-            weights[177] = 0.10882393389433299;
-            weights[178] = 0.10882393389433299;
-            weights[179] = 0.10882393389433299;
-            weights[180] = 0.10882393389433299;
-            weights[181] = 0.10882393389433299;
-            weights[182] = 0.10882393389433299;
-            weights[183] = 0.10882393389433299;
-            weights[184] = 0.10882393389433299;
-            weights[185] = 0.10882393389433299;
-            weights[186] = 0.10882393389433299;
-            weights[187] = 0.10882393389433299;
-            weights[188] = 0.10882393389433299;
-            weights[189] = 0.10882393389433299;
-            weights[190] = 0.10882393389433299;
-            weights[191] = 0.10882393389433299;
-            weights[192] = 0.10882393389433299;
-            weights[193] = 0.10882393389433299;
-            weights[194] = 0.10882393389433299;
-            weights[195] = 0.10882393389433299;
-            weights[196] = 0.10882393389433299;
-            weights[197] = 0.10882393389433299;
-            weights[198] = 0.10882393389433299;
-            weights[199] = 0.10882393389433299;
-            weights[200] = 0.10882393389433299;
-            weights[201] = 0.10882393389433299;
-            weights[202] = 0.10882393389433299;
-            weights[203] = 0.10882393389433299;
-            weights[204] = 0.10882393389433299;
-            weights[205] = 0.10882393389433299;
-            weights[206] = 0.10882393389433299;
-            weights[207] = 0.10882393389433299;
-            weights[208] = 0.10882393389433299;
-            weights[209] = 0.10882393389433299;
-            weights[210] = 0.10882393389433299;
-            weights[211] = 0.10882393389433299;
-            weights[212] = 0.10882393389433299;
-            weights[213] = 0.10882393389433299;
-            weights[214] = 0.10882393389433299;
-            weights[215] = 0.10882393389433299;
-            weights[216] = 0.10882393389433299;
-            weights[217] = 0.10882393389433299;
-            weights[218] = 0.10882393389433299;
-            weights[219] = 0.10882393389433299;
-            weights[220] = -0.39145882126833298;
-            weights[221] = -0.39145882126833298;
-            weights[222] = -0.39145882126833298;
-            weights[223] = -0.39145882126833298;
-            weights[224] = -0.39145882126833298;
-            weights[225] = -0.39145882126833298;
-            weights[226] = -0.39145882126833298;
-            weights[227] = -0.39145882126833298;
-            weights[228] = -0.39145882126833298;
-            weights[229] = -0.39145882126833298;
-            weights[230] = -0.39145882126833298;
-            weights[231] = -0.39145882126833298;
-            weights[232] = -0.39145882126833298;
-            weights[233] = -0.39145882126833298;
-            weights[234] = -0.39145882126833298;
-            weights[235] = -0.39145882126833298;
-            weights[236] = -0.39145882126833298;
-            weights[237] = -0.39145882126833298;
-            weights[238] = -0.39145882126833298;
-            weights[239] = -0.39145882126833298;
-            weights[240] = -0.39145882126833298;
-            weights[241] = -0.39145882126833298;
-            weights[242] = -0.39145882126833298;
-            weights[243] = -0.39145882126833298;
-            weights[244] = -0.39145882126833298;
-            weights[245] = -0.39145882126833298;
-            weights[246] = -0.39145882126833298;
-            weights[247] = -0.39145882126833298;
-            weights[248] = -0.39145882126833298;
-            weights[249] = -0.39145882126833298;
-            weights[250] = -0.39145882126833298;
-            weights[251] = -0.39145882126833298;
-            weights[252] = -0.39145882126833298;
-            weights[253] = -0.39145882126833298;
-            weights[254] = -0.39145882126833298;
-            weights[255] = -0.39145882126833298;
-            weights[256] = -0.39145882126833298;
-            weights[257] = -0.39145882126833298;
-            weights[258] = -0.39145882126833298;
-            weights[259] = -0.39145882126833298;
-            weights[260] = -0.39145882126833298;
-            weights[261] = -0.39145882126833298;
-            weights[262] = -0.39145882126833298;
-            weights[263] = -0.39145882126833298;
-            weights[264] = -0.39145882126833298;
-            weights[265] = -0.39145882126833298;
-            weights[266] = -0.39145882126833298;
-            weights[267] = -0.39145882126833298;
-            weights[268] = -0.39145882126833298;
-            weights[269] = -0.39145882126833298;
-            weights[270] = -0.39145882126833298;
-            weights[271] = -0.39145882126833298;
-            weights[272] = -0.39145882126833298;
-            weights[273] = -0.39145882126833298;
-            weights[274] = -0.39145882126833298;
-            weights[275] = -0.39145882126833298;
-            weights[276] = -0.39145882126833298;
-            weights[277] = -0.39145882126833298;
-            weights[278] = -0.39145882126833298;
-            weights[279] = -0.39145882126833298;
-            weights[280] = -0.39145882126833298;
-            weights[281] = -0.39145882126833298;
-            weights[282] = -0.39145882126833298;
-            weights[283] = -0.39145882126833298;
-            weights[284] = -0.39145882126833298;
-            weights[285] = -0.39145882126833298;
-            weights[286] = -0.39145882126833298;
-            weights[287] = -0.39145882126833298;
-            weights[288] = -0.39145882126833298;
-            weights[289] = -0.39145882126833298;
-            weights[290] = -0.39145882126833298;
-            weights[291] = -0.39145882126833298;
-            weights[292] = -0.39145882126833298;
-            weights[293] = -0.39145882126833298;
-            weights[294] = -0.39145882126833298;
-            weights[295] = -0.39145882126833298;
-            weights[296] = -0.39145882126833298;
-            weights[297] = -0.39145882126833298;
-            weights[298] = -0.39145882126833298;
-            weights[299] = -0.39145882126833298;
-            weights[300] = -0.39145882126833298;
-            weights[301] = -0.39145882126833298;
-            weights[302] = -0.39145882126833298;
-            weights[303] = -0.39145882126833298;
-            weights[304] = -0.39145882126833298;
-            weights[305] = -0.39145882126833298;
-            weights[306] = -0.39145882126833298;
-            weights[307] = -0.39145882126833298;
-            weights[308] = -0.39145882126833298;
-            weights[309] = -0.39145882126833298;
-            weights[310] = -0.39145882126833298;
-            weights[311] = -0.39145882126833298;
-            weights[312] = -0.39145882126833298;
-            weights[313] = -0.39145882126833298;
-            weights[314] = -0.39145882126833298;
-            weights[315] = -0.39145882126833298;
-            weights[316] = -0.39145882126833298;
-            weights[317] = -0.39145882126833298;
-            weights[318] = -0.39145882126833298;
-            weights[319] = -0.39145882126833298;
-            weights[320] = -0.39145882126833298;
-            weights[321] = -0.39145882126833298;
-            weights[322] = -0.39145882126833298;
-            weights[323] = -0.39145882126833298;
-            weights[324] = -0.39145882126833298;
-            weights[325] = -0.39145882126833298;
-            weights[326] = -0.39145882126833298;
-            weights[327] = -0.39145882126833298;
-            weights[328] = -0.39145882126833298;
-            weights[329] = -0.39145882126833298;
-            weights[330] = -0.39145882126833298;
-            weights[331] = -0.39145882126833298;
-            weights[332] = -0.39145882126833298;
-            weights[333] = -0.39145882126833298;
-            weights[334] = -0.39145882126833298;
-            weights[335] = -0.39145882126833298;
-            weights[336] = -0.39145882126833298;
-            weights[337] = -0.39145882126833298;
-            weights[338] = -0.39145882126833298;
-            weights[339] = -0.39145882126833298;
-            weights[340] = -0.39145882126833298;
-            weights[341] = -0.39145882126833298;
-            weights[342] = -0.39145882126833298;
-            weights[343] = -0.39145882126833298;
-            weights[344] = -0.39145882126833298;
-            weights[345] = -0.39145882126833298;
-            weights[346] = -0.39145882126833298;
-            weights[347] = -0.39145882126833298;
-            weights[348] = -0.39145882126833298;
-            weights[349] = -0.39145882126833298;
-            weights[350] = -0.39145882126833298;
-            weights[351] = -0.39145882126833298;
-            weights[352] = -0.39145882126833298;
-            weights[353] = -0.39145882126833298;
-            weights[354] = -0.39145882126833298;
-            weights[355] = -0.39145882126833298;
-            weights[356] = -0.39145882126833298;
-            weights[357] = -0.39145882126833298;
-            weights[358] = -0.39145882126833298;
-            weights[359] = -0.39145882126833298;
-            weights[360] = -0.39145882126833298;
-            weights[361] = -0.39145882126833298;
-            weights[362] = -0.39145882126833298;
-            weights[363] = -0.39145882126833298;
-            weights[364] = -0.39145882126833298;
-            weights[365] = -0.39145882126833298;
-            weights[366] = -0.39145882126833298;
-            weights[367] = -0.39145882126833298;
-            weights[368] = -0.39145882126833298;
-            weights[369] = -0.39145882126833298;
-            weights[370] = -0.39145882126833298;
-            weights[371] = -0.39145882126833298;
-            weights[372] = -0.39145882126833298;
-            weights[373] = -0.39145882126833298;
-            weights[374] = -0.39145882126833298;
-            weights[375] = -0.39145882126833298;
-            weights[376] = -0.39145882126833298;
-            weights[377] = -0.39145882126833298;
-            weights[378] = -0.39145882126833298;
-            weights[379] = -0.39145882126833298;
-            weights[380] = -0.39145882126833298;
-            weights[381] = -0.39145882126833298;
-            weights[382] = -0.39145882126833298;
-            weights[383] = -0.39145882126833298;
-            weights[384] = -0.39145882126833298;
-            weights[385] = 0.55524296216333302;
-            weights[386] = 0.55524296216333302;
-            weights[387] = 0.55524296216333302;
-            weights[388] = 0.55524296216333302;
-            weights[389] = 0.55524296216333302;
-            weights[390] = 0.55524296216333302;
-            weights[391] = 0.55524296216333302;
-            weights[392] = 0.55524296216333302;
-            weights[393] = 0.55524296216333302;
-            weights[394] = 0.55524296216333302;
-            weights[395] = 0.55524296216333302;
-            weights[396] = 0.55524296216333302;
-            weights[397] = 0.55524296216333302;
-            weights[398] = 0.55524296216333302;
-            weights[399] = 0.55524296216333302;
-            weights[400] = 0.55524296216333302;
-            weights[401] = 0.55524296216333302;
-            weights[402] = 0.55524296216333302;
-            weights[403] = 0.55524296216333302;
-            weights[404] = 0.55524296216333302;
-            weights[405] = 0.55524296216333302;
-            weights[406] = 0.55524296216333302;
-            weights[407] = 0.55524296216333302;
-            weights[408] = 0.55524296216333302;
-            weights[409] = 0.55524296216333302;
-            weights[410] = 0.55524296216333302;
-            weights[411] = 0.55524296216333302;
-            weights[412] = 0.55524296216333302;
-            weights[413] = 0.55524296216333302;
-            weights[414] = 0.55524296216333302;
-            weights[415] = 0.55524296216333302;
-            weights[416] = 0.55524296216333302;
-            weights[417] = 0.55524296216333302;
-            weights[418] = 0.55524296216333302;
-            weights[419] = 0.55524296216333302;
-            weights[420] = 0.55524296216333302;
-            weights[421] = 0.55524296216333302;
-            weights[422] = 0.55524296216333302;
-            weights[423] = 0.55524296216333302;
-            weights[424] = 0.55524296216333302;
-            weights[425] = 0.55524296216333302;
-            weights[426] = 0.55524296216333302;
-            weights[427] = 0.55524296216333302;
-            weights[428] = 0.55524296216333302;
-            weights[429] = 0.55524296216333302;
-            weights[430] = 0.55524296216333302;
-            weights[431] = 0.55524296216333302;
-            weights[432] = 0.55524296216333302;
-            weights[433] = 0.55524296216333302;
-            weights[434] = 0.55524296216333302;
-            weights[435] = 0.55524296216333302;
-            weights[436] = 0.55524296216333302;
-            weights[437] = 0.55524296216333302;
-            weights[438] = 0.55524296216333302;
-            weights[439] = 0.55524296216333302;
-            weights[440] = 0.55524296216333302;
-            weights[441] = 0.55524296216333302;
-            weights[442] = 0.55524296216333302;
-            weights[443] = 0.55524296216333302;
-            weights[444] = 0.55524296216333302;
-            weights[445] = 0.55524296216333302;
-            weights[446] = 0.55524296216333302;
-            weights[447] = 0.55524296216333302;
-            weights[448] = 0.55524296216333302;
-            weights[449] = 0.55524296216333302;
-            weights[450] = 0.55524296216333302;
-            weights[451] = 0.55524296216333302;
-            weights[452] = 0.55524296216333302;
-            weights[453] = 0.55524296216333302;
-            weights[454] = 0.55524296216333302;
-            weights[455] = 0.55524296216333302;
-            weights[456] = 0.55524296216333302;
-            weights[457] = 0.55524296216333302;
-            weights[458] = 0.55524296216333302;
-            weights[459] = 0.55524296216333302;
-            weights[460] = 0.55524296216333302;
-            weights[461] = 0.55524296216333302;
-            weights[462] = 0.55524296216333302;
-            weights[463] = 0.55524296216333302;
-            weights[464] = 0.55524296216333302;
-            weights[465] = 0.55524296216333302;
-            weights[466] = 0.55524296216333302;
-            weights[467] = 0.55524296216333302;
-            weights[468] = 0.55524296216333302;
-            weights[469] = 0.55524296216333302;
-            weights[470] = 0.55524296216333302;
-            weights[471] = 0.55524296216333302;
-            weights[472] = 0.55524296216333302;
-            weights[473] = 0.55524296216333302;
-            weights[474] = 0.55524296216333302;
-            weights[475] = 0.55524296216333302;
-            weights[476] = 0.55524296216333302;
-            weights[477] = 0.55524296216333302;
-            weights[478] = 0.55524296216333302;
-            weights[479] = 0.55524296216333302;
-            weights[480] = 0.55524296216333302;
-            weights[481] = 0.55524296216333302;
-            weights[482] = 0.55524296216333302;
-            weights[483] = 0.55524296216333302;
-            weights[484] = 0.55524296216333302;
-            weights[485] = 0.55524296216333302;
-            weights[486] = 0.55524296216333302;
-            weights[487] = 0.55524296216333302;
-            weights[488] = 0.55524296216333302;
-            weights[489] = 0.55524296216333302;
-            weights[490] = 0.55524296216333302;
-            weights[491] = 0.55524296216333302;
-            weights[492] = 0.55524296216333302;
-            weights[493] = 0.55524296216333302;
-            weights[494] = 0.55524296216333302;
-            weights[495] = 0.55524296216333302;
-            weights[496] = 0.55524296216333302;
-            weights[497] = 0.55524296216333302;
-            weights[498] = 0.55524296216333302;
-            weights[499] = 0.55524296216333302;
-            weights[500] = 0.55524296216333302;
-            weights[501] = 0.55524296216333302;
-            weights[502] = 0.55524296216333302;
-            weights[503] = 0.55524296216333302;
-            weights[504] = 0.55524296216333302;
-            weights[505] = -0.39490613155666698;
-            weights[506] = -0.39490613155666698;
-            weights[507] = -0.39490613155666698;
-            weights[508] = -0.39490613155666698;
-            weights[509] = -0.39490613155666698;
-            weights[510] = -0.39490613155666698;
-            weights[511] = -0.39490613155666698;
-            weights[512] = -0.39490613155666698;
-            weights[513] = -0.39490613155666698;
-            weights[514] = -0.39490613155666698;
-            weights[515] = -0.39490613155666698;
-            weights[516] = -0.39490613155666698;
-            weights[517] = -0.39490613155666698;
-            weights[518] = -0.39490613155666698;
-            weights[519] = -0.39490613155666698;
-            weights[520] = -0.39490613155666698;
-            weights[521] = -0.39490613155666698;
-            weights[522] = -0.39490613155666698;
-            weights[523] = -0.39490613155666698;
-            weights[524] = -0.39490613155666698;
-            weights[525] = -0.39490613155666698;
-            weights[526] = -0.39490613155666698;
-            weights[527] = -0.39490613155666698;
-            weights[528] = -0.39490613155666698;
-            weights[529] = -0.39490613155666698;
-            weights[530] = -0.39490613155666698;
-            weights[531] = -0.39490613155666698;
-            weights[532] = -0.39490613155666698;
-            weights[533] = -0.39490613155666698;
-            weights[534] = -0.39490613155666698;
-            weights[535] = -0.39490613155666698;
-            weights[536] = -0.39490613155666698;
-            weights[537] = -0.39490613155666698;
-            weights[538] = -0.39490613155666698;
-            weights[539] = -0.39490613155666698;
-            weights[540] = -0.39490613155666698;
-            weights[541] = -0.39490613155666698;
-            weights[542] = -0.39490613155666698;
-            weights[543] = -0.39490613155666698;
-            weights[544] = -0.39490613155666698;
-            weights[545] = -0.39490613155666698;
-            weights[546] = -0.39490613155666698;
-            weights[547] = -0.39490613155666698;
-            weights[548] = -0.39490613155666698;
-            weights[549] = -0.39490613155666698;
-            weights[550] = -0.39490613155666698;
-            weights[551] = -0.39490613155666698;
-            weights[552] = -0.39490613155666698;
-            weights[553] = -0.39490613155666698;
-            weights[554] = -0.39490613155666698;
-            weights[555] = -0.39490613155666698;
-            weights[556] = -0.39490613155666698;
-            weights[557] = -0.39490613155666698;
-            weights[558] = -0.39490613155666698;
-            weights[559] = -0.39490613155666698;
-            weights[560] = -0.39490613155666698;
-            weights[561] = -0.39490613155666698;
-            weights[562] = -0.39490613155666698;
-            weights[563] = -0.39490613155666698;
-            weights[564] = -0.39490613155666698;
-            weights[565] = -0.39490613155666698;
-            weights[566] = -0.39490613155666698;
-            weights[567] = -0.39490613155666698;
-            weights[568] = -0.39490613155666698;
-            weights[569] = -0.39490613155666698;
-            weights[570] = -0.39490613155666698;
-            weights[571] = -0.39490613155666698;
-            weights[572] = -0.39490613155666698;
-            weights[573] = -0.39490613155666698;
-            weights[574] = -0.39490613155666698;
-            weights[575] = -0.39490613155666698;
-            weights[576] = -0.39490613155666698;
-            weights[577] = -0.39490613155666698;
-            weights[578] = -0.39490613155666698;
-            weights[579] = -0.39490613155666698;
-            weights[580] = -0.39490613155666698;
-            weights[581] = -0.39490613155666698;
-            weights[582] = -0.39490613155666698;
-            weights[583] = -0.39490613155666698;
-            weights[584] = -0.39490613155666698;
-            weights[585] = -0.39490613155666698;
-            weights[586] = -0.39490613155666698;
-            weights[587] = -0.39490613155666698;
-            weights[588] = -0.39490613155666698;
-            weights[589] = 0.14836808592799999;
-            weights[590] = 0.14836808592799999;
-            weights[591] = 0.14836808592799999;
-            weights[592] = 0.14836808592799999;
-            weights[593] = 0.14836808592799999;
-            weights[594] = 0.14836808592799999;
-            weights[595] = 0.14836808592799999;
-            weights[596] = 0.14836808592799999;
-            weights[597] = 0.14836808592799999;
-            weights[598] = 0.14836808592799999;
-            weights[599] = 0.14836808592799999;
-            weights[600] = 0.14836808592799999;
-            weights[601] = 0.14836808592799999;
-            weights[602] = 0.14836808592799999;
-            weights[603] = 0.14836808592799999;
-            weights[604] = 0.14836808592799999;
-            weights[605] = 0.14836808592799999;
-            weights[606] = 0.14836808592799999;
-            weights[607] = 0.14836808592799999;
-            weights[608] = 0.14836808592799999;
-            weights[609] = 0.14836808592799999;
-            weights[610] = 0.14836808592799999;
-            weights[611] = 0.14836808592799999;
-            weights[612] = 0.14836808592799999;
-            weights[613] = 0.14836808592799999;
-            weights[614] = 0.14836808592799999;
-            weights[615] = 0.14836808592799999;
-            weights[616] = 0.14836808592799999;
-            weights[617] = 0.14836808592799999;
-            weights[618] = 0.14836808592799999;
-            weights[619] = 0.14836808592799999;
-            weights[620] = 0.14836808592799999;
-            weights[621] = 0.14836808592799999;
-            weights[622] = 0.14836808592799999;
-            weights[623] = 0.14836808592799999;
-            weights[624] = 0.14836808592799999;
-            weights[625] = 0.14836808592799999;
-            weights[626] = 0.14836808592799999;
-            weights[627] = 0.14836808592799999;
-            weights[628] = 0.14836808592799999;
-            weights[629] = 0.14836808592799999;
-            weights[630] = 0.14836808592799999;
-            weights[631] = 0.14836808592799999;
-            weights[632] = 0.14836808592799999;
-            weights[633] = 0.14836808592799999;
-            weights[634] = 0.14836808592799999;
-            weights[635] = 0.14836808592799999;
-            weights[636] = 0.14836808592799999;
-            weights[637] = 0.14836808592799999;
-            weights[638] = 0.14836808592799999;
-            weights[639] = 0.14836808592799999;
-            weights[640] = 0.14836808592799999;
-            weights[641] = 0.14836808592799999;
-            weights[642] = 0.14836808592799999;
-            weights[643] = 0.14836808592799999;
-            weights[644] = 0.14836808592799999;
-            weights[645] = -0.028553147692667001;
-            weights[646] = -0.028553147692667001;
-            weights[647] = -0.028553147692667001;
-            weights[648] = -0.028553147692667001;
-            weights[649] = -0.028553147692667001;
-            weights[650] = -0.028553147692667001;
-            weights[651] = -0.028553147692667001;
-            weights[652] = -0.028553147692667001;
-            weights[653] = -0.028553147692667001;
-            weights[654] = -0.028553147692667001;
-            weights[655] = -0.028553147692667001;
-            weights[656] = -0.028553147692667001;
-            weights[657] = -0.028553147692667001;
-            weights[658] = -0.028553147692667001;
-            weights[659] = -0.028553147692667001;
-            weights[660] = -0.028553147692667001;
-            weights[661] = -0.028553147692667001;
-            weights[662] = -0.028553147692667001;
-            weights[663] = -0.028553147692667001;
-            weights[664] = -0.028553147692667001;
-            weights[665] = -0.028553147692667001;
-            weights[666] = -0.028553147692667001;
-            weights[667] = -0.028553147692667001;
-            weights[668] = -0.028553147692667001;
-            weights[669] = -0.028553147692667001;
-            weights[670] = -0.028553147692667001;
-            weights[671] = -0.028553147692667001;
-            weights[672] = -0.028553147692667001;
-            weights[673] = -0.028553147692667001;
-            weights[674] = -0.028553147692667001;
-            weights[675] = -0.028553147692667001;
-            weights[676] = -0.028553147692667001;
-            weights[677] = -0.028553147692667001;
-            weights[678] = -0.028553147692667001;
-            weights[679] = -0.028553147692667001;
-            weights[680] = 0.0025322582098500001;
-            weights[681] = 0.0025322582098500001;
-            weights[682] = 0.0025322582098500001;
-            weights[683] = 0.0025322582098500001;
-            weights[684] = 0.0025322582098500001;
-            weights[685] = 0.0025322582098500001;
-            weights[686] = 0.0025322582098500001;
-            weights[687] = 0.0025322582098500001;
-            weights[688] = 0.0025322582098500001;
-            weights[689] = 0.0025322582098500001;
-            weights[690] = 0.0025322582098500001;
-            weights[691] = 0.0025322582098500001;
-            weights[692] = 0.0025322582098500001;
-            weights[693] = 0.0025322582098500001;
-            weights[694] = 0.0025322582098500001;
-            weights[695] = 0.0025322582098500001;
-            weights[696] = 0.0025322582098500001;
-            weights[697] = 0.0025322582098500001;
-            weights[698] = 0.0025322582098500001;
-            weights[699] = 0.0025322582098500001;
-            weights[700] = -8.3414141296000004e-05;
-            weights[701] = -8.3414141296000004e-05;
-            weights[702] = -8.3414141296000004e-05;
-            weights[703] = -8.3414141296000004e-05;
-            weights[704] = -8.3414141296000004e-05;
-            weights[705] = -8.3414141296000004e-05;
-            weights[706] = -8.3414141296000004e-05;
-            weights[707] = -8.3414141296000004e-05;
-            weights[708] = -8.3414141296000004e-05;
-            weights[709] = -8.3414141296000004e-05;
-            weights[710] = 6.6130980188e-07;
-            weights[711] = 6.6130980188e-07;
-            weights[712] = 6.6130980188e-07;
-            weights[713] = 6.6130980188e-07;
-            weights[714] = -4.6404125000000002e-10;
-
+            coordinates.assign(gpcoordinates18, gpcoordinates18+3*715);
+            weights.assign(gpweights18, gpweights18+715);
             break;
-
         case 20: case 21:
-            
-            coordinates.resize(1001*3);
-            weights.resize(1001);
-
-            coordinates[0] = 0.041666666666699999;
-            coordinates[1] = 0.041666666666699999;
-            coordinates[2] = 0.875;
-            coordinates[3] = 0.041666666666699999;
-            coordinates[4] = 0.125;
-            coordinates[5] = 0.79166666666700003;
-            coordinates[6] = 0.041666666666699999;
-            coordinates[7] = 0.208333333333;
-            coordinates[8] = 0.70833333333299997;
-            coordinates[9] = 0.041666666666699999;
-            coordinates[10] = 0.29166666666699997;
-            coordinates[11] = 0.625;
-            coordinates[12] = 0.041666666666699999;
-            coordinates[13] = 0.375;
-            coordinates[14] = 0.54166666666700003;
-            coordinates[15] = 0.041666666666699999;
-            coordinates[16] = 0.45833333333300003;
-            coordinates[17] = 0.45833333333300003;
-            coordinates[18] = 0.041666666666699999;
-            coordinates[19] = 0.54166666666700003;
-            coordinates[20] = 0.375;
-            coordinates[21] = 0.041666666666699999;
-            coordinates[22] = 0.625;
-            coordinates[23] = 0.29166666666699997;
-            coordinates[24] = 0.041666666666699999;
-            coordinates[25] = 0.70833333333299997;
-            coordinates[26] = 0.208333333333;
-            coordinates[27] = 0.041666666666699999;
-            coordinates[28] = 0.79166666666700003;
-            coordinates[29] = 0.125;
-            coordinates[30] = 0.041666666666699999;
-            coordinates[31] = 0.875;
-            coordinates[32] = 0.041666666666699999;
-            coordinates[33] = 0.125;
-            coordinates[34] = 0.041666666666699999;
-            coordinates[35] = 0.79166666666700003;
-            coordinates[36] = 0.125;
-            coordinates[37] = 0.125;
-            coordinates[38] = 0.70833333333299997;
-            coordinates[39] = 0.125;
-            coordinates[40] = 0.208333333333;
-            coordinates[41] = 0.625;
-            coordinates[42] = 0.125;
-            coordinates[43] = 0.29166666666699997;
-            coordinates[44] = 0.54166666666700003;
-            coordinates[45] = 0.125;
-            coordinates[46] = 0.375;
-            coordinates[47] = 0.45833333333300003;
-            coordinates[48] = 0.125;
-            coordinates[49] = 0.45833333333300003;
-            coordinates[50] = 0.375;
-            coordinates[51] = 0.125;
-            coordinates[52] = 0.54166666666700003;
-            coordinates[53] = 0.29166666666699997;
-            coordinates[54] = 0.125;
-            coordinates[55] = 0.625;
-            coordinates[56] = 0.208333333333;
-            coordinates[57] = 0.125;
-            coordinates[58] = 0.70833333333299997;
-            coordinates[59] = 0.125;
-            coordinates[60] = 0.125;
-            coordinates[61] = 0.79166666666700003;
-            coordinates[62] = 0.041666666666699999;
-            coordinates[63] = 0.208333333333;
-            coordinates[64] = 0.041666666666699999;
-            coordinates[65] = 0.70833333333299997;
-            coordinates[66] = 0.208333333333;
-            coordinates[67] = 0.125;
-            coordinates[68] = 0.625;
-            coordinates[69] = 0.208333333333;
-            coordinates[70] = 0.208333333333;
-            coordinates[71] = 0.54166666666700003;
-            coordinates[72] = 0.208333333333;
-            coordinates[73] = 0.29166666666699997;
-            coordinates[74] = 0.45833333333300003;
-            coordinates[75] = 0.208333333333;
-            coordinates[76] = 0.375;
-            coordinates[77] = 0.375;
-            coordinates[78] = 0.208333333333;
-            coordinates[79] = 0.45833333333300003;
-            coordinates[80] = 0.29166666666699997;
-            coordinates[81] = 0.208333333333;
-            coordinates[82] = 0.54166666666700003;
-            coordinates[83] = 0.208333333333;
-            coordinates[84] = 0.208333333333;
-            coordinates[85] = 0.625;
-            coordinates[86] = 0.125;
-            coordinates[87] = 0.208333333333;
-            coordinates[88] = 0.70833333333299997;
-            coordinates[89] = 0.041666666666699999;
-            coordinates[90] = 0.29166666666699997;
-            coordinates[91] = 0.041666666666699999;
-            coordinates[92] = 0.625;
-            coordinates[93] = 0.29166666666699997;
-            coordinates[94] = 0.125;
-            coordinates[95] = 0.54166666666700003;
-            coordinates[96] = 0.29166666666699997;
-            coordinates[97] = 0.208333333333;
-            coordinates[98] = 0.45833333333300003;
-            coordinates[99] = 0.29166666666699997;
-            coordinates[100] = 0.29166666666699997;
-            coordinates[101] = 0.375;
-            coordinates[102] = 0.29166666666699997;
-            coordinates[103] = 0.375;
-            coordinates[104] = 0.29166666666699997;
-            coordinates[105] = 0.29166666666699997;
-            coordinates[106] = 0.45833333333300003;
-            coordinates[107] = 0.208333333333;
-            coordinates[108] = 0.29166666666699997;
-            coordinates[109] = 0.54166666666700003;
-            coordinates[110] = 0.125;
-            coordinates[111] = 0.29166666666699997;
-            coordinates[112] = 0.625;
-            coordinates[113] = 0.041666666666699999;
-            coordinates[114] = 0.375;
-            coordinates[115] = 0.041666666666699999;
-            coordinates[116] = 0.54166666666700003;
-            coordinates[117] = 0.375;
-            coordinates[118] = 0.125;
-            coordinates[119] = 0.45833333333300003;
-            coordinates[120] = 0.375;
-            coordinates[121] = 0.208333333333;
-            coordinates[122] = 0.375;
-            coordinates[123] = 0.375;
-            coordinates[124] = 0.29166666666699997;
-            coordinates[125] = 0.29166666666699997;
-            coordinates[126] = 0.375;
-            coordinates[127] = 0.375;
-            coordinates[128] = 0.208333333333;
-            coordinates[129] = 0.375;
-            coordinates[130] = 0.45833333333300003;
-            coordinates[131] = 0.125;
-            coordinates[132] = 0.375;
-            coordinates[133] = 0.54166666666700003;
-            coordinates[134] = 0.041666666666699999;
-            coordinates[135] = 0.45833333333300003;
-            coordinates[136] = 0.041666666666699999;
-            coordinates[137] = 0.45833333333300003;
-            coordinates[138] = 0.45833333333300003;
-            coordinates[139] = 0.125;
-            coordinates[140] = 0.375;
-            coordinates[141] = 0.45833333333300003;
-            coordinates[142] = 0.208333333333;
-            coordinates[143] = 0.29166666666699997;
-            coordinates[144] = 0.45833333333300003;
-            coordinates[145] = 0.29166666666699997;
-            coordinates[146] = 0.208333333333;
-            coordinates[147] = 0.45833333333300003;
-            coordinates[148] = 0.375;
-            coordinates[149] = 0.125;
-            coordinates[150] = 0.45833333333300003;
-            coordinates[151] = 0.45833333333300003;
-            coordinates[152] = 0.041666666666699999;
-            coordinates[153] = 0.54166666666700003;
-            coordinates[154] = 0.041666666666699999;
-            coordinates[155] = 0.375;
-            coordinates[156] = 0.54166666666700003;
-            coordinates[157] = 0.125;
-            coordinates[158] = 0.29166666666699997;
-            coordinates[159] = 0.54166666666700003;
-            coordinates[160] = 0.208333333333;
-            coordinates[161] = 0.208333333333;
-            coordinates[162] = 0.54166666666700003;
-            coordinates[163] = 0.29166666666699997;
-            coordinates[164] = 0.125;
-            coordinates[165] = 0.54166666666700003;
-            coordinates[166] = 0.375;
-            coordinates[167] = 0.041666666666699999;
-            coordinates[168] = 0.625;
-            coordinates[169] = 0.041666666666699999;
-            coordinates[170] = 0.29166666666699997;
-            coordinates[171] = 0.625;
-            coordinates[172] = 0.125;
-            coordinates[173] = 0.208333333333;
-            coordinates[174] = 0.625;
-            coordinates[175] = 0.208333333333;
-            coordinates[176] = 0.125;
-            coordinates[177] = 0.625;
-            coordinates[178] = 0.29166666666699997;
-            coordinates[179] = 0.041666666666699999;
-            coordinates[180] = 0.70833333333299997;
-            coordinates[181] = 0.041666666666699999;
-            coordinates[182] = 0.208333333333;
-            coordinates[183] = 0.70833333333299997;
-            coordinates[184] = 0.125;
-            coordinates[185] = 0.125;
-            coordinates[186] = 0.70833333333299997;
-            coordinates[187] = 0.208333333333;
-            coordinates[188] = 0.041666666666699999;
-            coordinates[189] = 0.79166666666700003;
-            coordinates[190] = 0.041666666666699999;
-            coordinates[191] = 0.125;
-            coordinates[192] = 0.79166666666700003;
-            coordinates[193] = 0.125;
-            coordinates[194] = 0.041666666666699999;
-            coordinates[195] = 0.875;
-            coordinates[196] = 0.041666666666699999;
-            coordinates[197] = 0.041666666666699999;
-            coordinates[198] = 0.041666666666699999;
-            coordinates[199] = 0.041666666666699999;
-            coordinates[200] = 0.79166666666700003;
-            coordinates[201] = 0.041666666666699999;
-            coordinates[202] = 0.125;
-            coordinates[203] = 0.70833333333299997;
-            coordinates[204] = 0.041666666666699999;
-            coordinates[205] = 0.208333333333;
-            coordinates[206] = 0.625;
-            coordinates[207] = 0.041666666666699999;
-            coordinates[208] = 0.29166666666699997;
-            coordinates[209] = 0.54166666666700003;
-            coordinates[210] = 0.041666666666699999;
-            coordinates[211] = 0.375;
-            coordinates[212] = 0.45833333333300003;
-            coordinates[213] = 0.041666666666699999;
-            coordinates[214] = 0.45833333333300003;
-            coordinates[215] = 0.375;
-            coordinates[216] = 0.041666666666699999;
-            coordinates[217] = 0.54166666666700003;
-            coordinates[218] = 0.29166666666699997;
-            coordinates[219] = 0.041666666666699999;
-            coordinates[220] = 0.625;
-            coordinates[221] = 0.208333333333;
-            coordinates[222] = 0.041666666666699999;
-            coordinates[223] = 0.70833333333299997;
-            coordinates[224] = 0.125;
-            coordinates[225] = 0.041666666666699999;
-            coordinates[226] = 0.79166666666700003;
-            coordinates[227] = 0.041666666666699999;
-            coordinates[228] = 0.125;
-            coordinates[229] = 0.041666666666699999;
-            coordinates[230] = 0.70833333333299997;
-            coordinates[231] = 0.125;
-            coordinates[232] = 0.125;
-            coordinates[233] = 0.625;
-            coordinates[234] = 0.125;
-            coordinates[235] = 0.208333333333;
-            coordinates[236] = 0.54166666666700003;
-            coordinates[237] = 0.125;
-            coordinates[238] = 0.29166666666699997;
-            coordinates[239] = 0.45833333333300003;
-            coordinates[240] = 0.125;
-            coordinates[241] = 0.375;
-            coordinates[242] = 0.375;
-            coordinates[243] = 0.125;
-            coordinates[244] = 0.45833333333300003;
-            coordinates[245] = 0.29166666666699997;
-            coordinates[246] = 0.125;
-            coordinates[247] = 0.54166666666700003;
-            coordinates[248] = 0.208333333333;
-            coordinates[249] = 0.125;
-            coordinates[250] = 0.625;
-            coordinates[251] = 0.125;
-            coordinates[252] = 0.125;
-            coordinates[253] = 0.70833333333299997;
-            coordinates[254] = 0.041666666666699999;
-            coordinates[255] = 0.208333333333;
-            coordinates[256] = 0.041666666666699999;
-            coordinates[257] = 0.625;
-            coordinates[258] = 0.208333333333;
-            coordinates[259] = 0.125;
-            coordinates[260] = 0.54166666666700003;
-            coordinates[261] = 0.208333333333;
-            coordinates[262] = 0.208333333333;
-            coordinates[263] = 0.45833333333300003;
-            coordinates[264] = 0.208333333333;
-            coordinates[265] = 0.29166666666699997;
-            coordinates[266] = 0.375;
-            coordinates[267] = 0.208333333333;
-            coordinates[268] = 0.375;
-            coordinates[269] = 0.29166666666699997;
-            coordinates[270] = 0.208333333333;
-            coordinates[271] = 0.45833333333300003;
-            coordinates[272] = 0.208333333333;
-            coordinates[273] = 0.208333333333;
-            coordinates[274] = 0.54166666666700003;
-            coordinates[275] = 0.125;
-            coordinates[276] = 0.208333333333;
-            coordinates[277] = 0.625;
-            coordinates[278] = 0.041666666666699999;
-            coordinates[279] = 0.29166666666699997;
-            coordinates[280] = 0.041666666666699999;
-            coordinates[281] = 0.54166666666700003;
-            coordinates[282] = 0.29166666666699997;
-            coordinates[283] = 0.125;
-            coordinates[284] = 0.45833333333300003;
-            coordinates[285] = 0.29166666666699997;
-            coordinates[286] = 0.208333333333;
-            coordinates[287] = 0.375;
-            coordinates[288] = 0.29166666666699997;
-            coordinates[289] = 0.29166666666699997;
-            coordinates[290] = 0.29166666666699997;
-            coordinates[291] = 0.29166666666699997;
-            coordinates[292] = 0.375;
-            coordinates[293] = 0.208333333333;
-            coordinates[294] = 0.29166666666699997;
-            coordinates[295] = 0.45833333333300003;
-            coordinates[296] = 0.125;
-            coordinates[297] = 0.29166666666699997;
-            coordinates[298] = 0.54166666666700003;
-            coordinates[299] = 0.041666666666699999;
-            coordinates[300] = 0.375;
-            coordinates[301] = 0.041666666666699999;
-            coordinates[302] = 0.45833333333300003;
-            coordinates[303] = 0.375;
-            coordinates[304] = 0.125;
-            coordinates[305] = 0.375;
-            coordinates[306] = 0.375;
-            coordinates[307] = 0.208333333333;
-            coordinates[308] = 0.29166666666699997;
-            coordinates[309] = 0.375;
-            coordinates[310] = 0.29166666666699997;
-            coordinates[311] = 0.208333333333;
-            coordinates[312] = 0.375;
-            coordinates[313] = 0.375;
-            coordinates[314] = 0.125;
-            coordinates[315] = 0.375;
-            coordinates[316] = 0.45833333333300003;
-            coordinates[317] = 0.041666666666699999;
-            coordinates[318] = 0.45833333333300003;
-            coordinates[319] = 0.041666666666699999;
-            coordinates[320] = 0.375;
-            coordinates[321] = 0.45833333333300003;
-            coordinates[322] = 0.125;
-            coordinates[323] = 0.29166666666699997;
-            coordinates[324] = 0.45833333333300003;
-            coordinates[325] = 0.208333333333;
-            coordinates[326] = 0.208333333333;
-            coordinates[327] = 0.45833333333300003;
-            coordinates[328] = 0.29166666666699997;
-            coordinates[329] = 0.125;
-            coordinates[330] = 0.45833333333300003;
-            coordinates[331] = 0.375;
-            coordinates[332] = 0.041666666666699999;
-            coordinates[333] = 0.54166666666700003;
-            coordinates[334] = 0.041666666666699999;
-            coordinates[335] = 0.29166666666699997;
-            coordinates[336] = 0.54166666666700003;
-            coordinates[337] = 0.125;
-            coordinates[338] = 0.208333333333;
-            coordinates[339] = 0.54166666666700003;
-            coordinates[340] = 0.208333333333;
-            coordinates[341] = 0.125;
-            coordinates[342] = 0.54166666666700003;
-            coordinates[343] = 0.29166666666699997;
-            coordinates[344] = 0.041666666666699999;
-            coordinates[345] = 0.625;
-            coordinates[346] = 0.041666666666699999;
-            coordinates[347] = 0.208333333333;
-            coordinates[348] = 0.625;
-            coordinates[349] = 0.125;
-            coordinates[350] = 0.125;
-            coordinates[351] = 0.625;
-            coordinates[352] = 0.208333333333;
-            coordinates[353] = 0.041666666666699999;
-            coordinates[354] = 0.70833333333299997;
-            coordinates[355] = 0.041666666666699999;
-            coordinates[356] = 0.125;
-            coordinates[357] = 0.70833333333299997;
-            coordinates[358] = 0.125;
-            coordinates[359] = 0.041666666666699999;
-            coordinates[360] = 0.79166666666700003;
-            coordinates[361] = 0.041666666666699999;
-            coordinates[362] = 0.041666666666699999;
-            coordinates[363] = 0.041666666666699999;
-            coordinates[364] = 0.041666666666699999;
-            coordinates[365] = 0.70833333333299997;
-            coordinates[366] = 0.041666666666699999;
-            coordinates[367] = 0.125;
-            coordinates[368] = 0.625;
-            coordinates[369] = 0.041666666666699999;
-            coordinates[370] = 0.208333333333;
-            coordinates[371] = 0.54166666666700003;
-            coordinates[372] = 0.041666666666699999;
-            coordinates[373] = 0.29166666666699997;
-            coordinates[374] = 0.45833333333300003;
-            coordinates[375] = 0.041666666666699999;
-            coordinates[376] = 0.375;
-            coordinates[377] = 0.375;
-            coordinates[378] = 0.041666666666699999;
-            coordinates[379] = 0.45833333333300003;
-            coordinates[380] = 0.29166666666699997;
-            coordinates[381] = 0.041666666666699999;
-            coordinates[382] = 0.54166666666700003;
-            coordinates[383] = 0.208333333333;
-            coordinates[384] = 0.041666666666699999;
-            coordinates[385] = 0.625;
-            coordinates[386] = 0.125;
-            coordinates[387] = 0.041666666666699999;
-            coordinates[388] = 0.70833333333299997;
-            coordinates[389] = 0.041666666666699999;
-            coordinates[390] = 0.125;
-            coordinates[391] = 0.041666666666699999;
-            coordinates[392] = 0.625;
-            coordinates[393] = 0.125;
-            coordinates[394] = 0.125;
-            coordinates[395] = 0.54166666666700003;
-            coordinates[396] = 0.125;
-            coordinates[397] = 0.208333333333;
-            coordinates[398] = 0.45833333333300003;
-            coordinates[399] = 0.125;
-            coordinates[400] = 0.29166666666699997;
-            coordinates[401] = 0.375;
-            coordinates[402] = 0.125;
-            coordinates[403] = 0.375;
-            coordinates[404] = 0.29166666666699997;
-            coordinates[405] = 0.125;
-            coordinates[406] = 0.45833333333300003;
-            coordinates[407] = 0.208333333333;
-            coordinates[408] = 0.125;
-            coordinates[409] = 0.54166666666700003;
-            coordinates[410] = 0.125;
-            coordinates[411] = 0.125;
-            coordinates[412] = 0.625;
-            coordinates[413] = 0.041666666666699999;
-            coordinates[414] = 0.208333333333;
-            coordinates[415] = 0.041666666666699999;
-            coordinates[416] = 0.54166666666700003;
-            coordinates[417] = 0.208333333333;
-            coordinates[418] = 0.125;
-            coordinates[419] = 0.45833333333300003;
-            coordinates[420] = 0.208333333333;
-            coordinates[421] = 0.208333333333;
-            coordinates[422] = 0.375;
-            coordinates[423] = 0.208333333333;
-            coordinates[424] = 0.29166666666699997;
-            coordinates[425] = 0.29166666666699997;
-            coordinates[426] = 0.208333333333;
-            coordinates[427] = 0.375;
-            coordinates[428] = 0.208333333333;
-            coordinates[429] = 0.208333333333;
-            coordinates[430] = 0.45833333333300003;
-            coordinates[431] = 0.125;
-            coordinates[432] = 0.208333333333;
-            coordinates[433] = 0.54166666666700003;
-            coordinates[434] = 0.041666666666699999;
-            coordinates[435] = 0.29166666666699997;
-            coordinates[436] = 0.041666666666699999;
-            coordinates[437] = 0.45833333333300003;
-            coordinates[438] = 0.29166666666699997;
-            coordinates[439] = 0.125;
-            coordinates[440] = 0.375;
-            coordinates[441] = 0.29166666666699997;
-            coordinates[442] = 0.208333333333;
-            coordinates[443] = 0.29166666666699997;
-            coordinates[444] = 0.29166666666699997;
-            coordinates[445] = 0.29166666666699997;
-            coordinates[446] = 0.208333333333;
-            coordinates[447] = 0.29166666666699997;
-            coordinates[448] = 0.375;
-            coordinates[449] = 0.125;
-            coordinates[450] = 0.29166666666699997;
-            coordinates[451] = 0.45833333333300003;
-            coordinates[452] = 0.041666666666699999;
-            coordinates[453] = 0.375;
-            coordinates[454] = 0.041666666666699999;
-            coordinates[455] = 0.375;
-            coordinates[456] = 0.375;
-            coordinates[457] = 0.125;
-            coordinates[458] = 0.29166666666699997;
-            coordinates[459] = 0.375;
-            coordinates[460] = 0.208333333333;
-            coordinates[461] = 0.208333333333;
-            coordinates[462] = 0.375;
-            coordinates[463] = 0.29166666666699997;
-            coordinates[464] = 0.125;
-            coordinates[465] = 0.375;
-            coordinates[466] = 0.375;
-            coordinates[467] = 0.041666666666699999;
-            coordinates[468] = 0.45833333333300003;
-            coordinates[469] = 0.041666666666699999;
-            coordinates[470] = 0.29166666666699997;
-            coordinates[471] = 0.45833333333300003;
-            coordinates[472] = 0.125;
-            coordinates[473] = 0.208333333333;
-            coordinates[474] = 0.45833333333300003;
-            coordinates[475] = 0.208333333333;
-            coordinates[476] = 0.125;
-            coordinates[477] = 0.45833333333300003;
-            coordinates[478] = 0.29166666666699997;
-            coordinates[479] = 0.041666666666699999;
-            coordinates[480] = 0.54166666666700003;
-            coordinates[481] = 0.041666666666699999;
-            coordinates[482] = 0.208333333333;
-            coordinates[483] = 0.54166666666700003;
-            coordinates[484] = 0.125;
-            coordinates[485] = 0.125;
-            coordinates[486] = 0.54166666666700003;
-            coordinates[487] = 0.208333333333;
-            coordinates[488] = 0.041666666666699999;
-            coordinates[489] = 0.625;
-            coordinates[490] = 0.041666666666699999;
-            coordinates[491] = 0.125;
-            coordinates[492] = 0.625;
-            coordinates[493] = 0.125;
-            coordinates[494] = 0.041666666666699999;
-            coordinates[495] = 0.70833333333299997;
-            coordinates[496] = 0.041666666666699999;
-            coordinates[497] = 0.041666666666699999;
-            coordinates[498] = 0.041666666666699999;
-            coordinates[499] = 0.041666666666699999;
-            coordinates[500] = 0.625;
-            coordinates[501] = 0.041666666666699999;
-            coordinates[502] = 0.125;
-            coordinates[503] = 0.54166666666700003;
-            coordinates[504] = 0.041666666666699999;
-            coordinates[505] = 0.208333333333;
-            coordinates[506] = 0.45833333333300003;
-            coordinates[507] = 0.041666666666699999;
-            coordinates[508] = 0.29166666666699997;
-            coordinates[509] = 0.375;
-            coordinates[510] = 0.041666666666699999;
-            coordinates[511] = 0.375;
-            coordinates[512] = 0.29166666666699997;
-            coordinates[513] = 0.041666666666699999;
-            coordinates[514] = 0.45833333333300003;
-            coordinates[515] = 0.208333333333;
-            coordinates[516] = 0.041666666666699999;
-            coordinates[517] = 0.54166666666700003;
-            coordinates[518] = 0.125;
-            coordinates[519] = 0.041666666666699999;
-            coordinates[520] = 0.625;
-            coordinates[521] = 0.041666666666699999;
-            coordinates[522] = 0.125;
-            coordinates[523] = 0.041666666666699999;
-            coordinates[524] = 0.54166666666700003;
-            coordinates[525] = 0.125;
-            coordinates[526] = 0.125;
-            coordinates[527] = 0.45833333333300003;
-            coordinates[528] = 0.125;
-            coordinates[529] = 0.208333333333;
-            coordinates[530] = 0.375;
-            coordinates[531] = 0.125;
-            coordinates[532] = 0.29166666666699997;
-            coordinates[533] = 0.29166666666699997;
-            coordinates[534] = 0.125;
-            coordinates[535] = 0.375;
-            coordinates[536] = 0.208333333333;
-            coordinates[537] = 0.125;
-            coordinates[538] = 0.45833333333300003;
-            coordinates[539] = 0.125;
-            coordinates[540] = 0.125;
-            coordinates[541] = 0.54166666666700003;
-            coordinates[542] = 0.041666666666699999;
-            coordinates[543] = 0.208333333333;
-            coordinates[544] = 0.041666666666699999;
-            coordinates[545] = 0.45833333333300003;
-            coordinates[546] = 0.208333333333;
-            coordinates[547] = 0.125;
-            coordinates[548] = 0.375;
-            coordinates[549] = 0.208333333333;
-            coordinates[550] = 0.208333333333;
-            coordinates[551] = 0.29166666666699997;
-            coordinates[552] = 0.208333333333;
-            coordinates[553] = 0.29166666666699997;
-            coordinates[554] = 0.208333333333;
-            coordinates[555] = 0.208333333333;
-            coordinates[556] = 0.375;
-            coordinates[557] = 0.125;
-            coordinates[558] = 0.208333333333;
-            coordinates[559] = 0.45833333333300003;
-            coordinates[560] = 0.041666666666699999;
-            coordinates[561] = 0.29166666666699997;
-            coordinates[562] = 0.041666666666699999;
-            coordinates[563] = 0.375;
-            coordinates[564] = 0.29166666666699997;
-            coordinates[565] = 0.125;
-            coordinates[566] = 0.29166666666699997;
-            coordinates[567] = 0.29166666666699997;
-            coordinates[568] = 0.208333333333;
-            coordinates[569] = 0.208333333333;
-            coordinates[570] = 0.29166666666699997;
-            coordinates[571] = 0.29166666666699997;
-            coordinates[572] = 0.125;
-            coordinates[573] = 0.29166666666699997;
-            coordinates[574] = 0.375;
-            coordinates[575] = 0.041666666666699999;
-            coordinates[576] = 0.375;
-            coordinates[577] = 0.041666666666699999;
-            coordinates[578] = 0.29166666666699997;
-            coordinates[579] = 0.375;
-            coordinates[580] = 0.125;
-            coordinates[581] = 0.208333333333;
-            coordinates[582] = 0.375;
-            coordinates[583] = 0.208333333333;
-            coordinates[584] = 0.125;
-            coordinates[585] = 0.375;
-            coordinates[586] = 0.29166666666699997;
-            coordinates[587] = 0.041666666666699999;
-            coordinates[588] = 0.45833333333300003;
-            coordinates[589] = 0.041666666666699999;
-            coordinates[590] = 0.208333333333;
-            coordinates[591] = 0.45833333333300003;
-            coordinates[592] = 0.125;
-            coordinates[593] = 0.125;
-            coordinates[594] = 0.45833333333300003;
-            coordinates[595] = 0.208333333333;
-            coordinates[596] = 0.041666666666699999;
-            coordinates[597] = 0.54166666666700003;
-            coordinates[598] = 0.041666666666699999;
-            coordinates[599] = 0.125;
-            coordinates[600] = 0.54166666666700003;
-            coordinates[601] = 0.125;
-            coordinates[602] = 0.041666666666699999;
-            coordinates[603] = 0.625;
-            coordinates[604] = 0.041666666666699999;
-            coordinates[605] = 0.041666666666699999;
-            coordinates[606] = 0.041666666666699999;
-            coordinates[607] = 0.041666666666699999;
-            coordinates[608] = 0.54166666666700003;
-            coordinates[609] = 0.041666666666699999;
-            coordinates[610] = 0.125;
-            coordinates[611] = 0.45833333333300003;
-            coordinates[612] = 0.041666666666699999;
-            coordinates[613] = 0.208333333333;
-            coordinates[614] = 0.375;
-            coordinates[615] = 0.041666666666699999;
-            coordinates[616] = 0.29166666666699997;
-            coordinates[617] = 0.29166666666699997;
-            coordinates[618] = 0.041666666666699999;
-            coordinates[619] = 0.375;
-            coordinates[620] = 0.208333333333;
-            coordinates[621] = 0.041666666666699999;
-            coordinates[622] = 0.45833333333300003;
-            coordinates[623] = 0.125;
-            coordinates[624] = 0.041666666666699999;
-            coordinates[625] = 0.54166666666700003;
-            coordinates[626] = 0.041666666666699999;
-            coordinates[627] = 0.125;
-            coordinates[628] = 0.041666666666699999;
-            coordinates[629] = 0.45833333333300003;
-            coordinates[630] = 0.125;
-            coordinates[631] = 0.125;
-            coordinates[632] = 0.375;
-            coordinates[633] = 0.125;
-            coordinates[634] = 0.208333333333;
-            coordinates[635] = 0.29166666666699997;
-            coordinates[636] = 0.125;
-            coordinates[637] = 0.29166666666699997;
-            coordinates[638] = 0.208333333333;
-            coordinates[639] = 0.125;
-            coordinates[640] = 0.375;
-            coordinates[641] = 0.125;
-            coordinates[642] = 0.125;
-            coordinates[643] = 0.45833333333300003;
-            coordinates[644] = 0.041666666666699999;
-            coordinates[645] = 0.208333333333;
-            coordinates[646] = 0.041666666666699999;
-            coordinates[647] = 0.375;
-            coordinates[648] = 0.208333333333;
-            coordinates[649] = 0.125;
-            coordinates[650] = 0.29166666666699997;
-            coordinates[651] = 0.208333333333;
-            coordinates[652] = 0.208333333333;
-            coordinates[653] = 0.208333333333;
-            coordinates[654] = 0.208333333333;
-            coordinates[655] = 0.29166666666699997;
-            coordinates[656] = 0.125;
-            coordinates[657] = 0.208333333333;
-            coordinates[658] = 0.375;
-            coordinates[659] = 0.041666666666699999;
-            coordinates[660] = 0.29166666666699997;
-            coordinates[661] = 0.041666666666699999;
-            coordinates[662] = 0.29166666666699997;
-            coordinates[663] = 0.29166666666699997;
-            coordinates[664] = 0.125;
-            coordinates[665] = 0.208333333333;
-            coordinates[666] = 0.29166666666699997;
-            coordinates[667] = 0.208333333333;
-            coordinates[668] = 0.125;
-            coordinates[669] = 0.29166666666699997;
-            coordinates[670] = 0.29166666666699997;
-            coordinates[671] = 0.041666666666699999;
-            coordinates[672] = 0.375;
-            coordinates[673] = 0.041666666666699999;
-            coordinates[674] = 0.208333333333;
-            coordinates[675] = 0.375;
-            coordinates[676] = 0.125;
-            coordinates[677] = 0.125;
-            coordinates[678] = 0.375;
-            coordinates[679] = 0.208333333333;
-            coordinates[680] = 0.041666666666699999;
-            coordinates[681] = 0.45833333333300003;
-            coordinates[682] = 0.041666666666699999;
-            coordinates[683] = 0.125;
-            coordinates[684] = 0.45833333333300003;
-            coordinates[685] = 0.125;
-            coordinates[686] = 0.041666666666699999;
-            coordinates[687] = 0.54166666666700003;
-            coordinates[688] = 0.041666666666699999;
-            coordinates[689] = 0.041666666666699999;
-            coordinates[690] = 0.041666666666699999;
-            coordinates[691] = 0.041666666666699999;
-            coordinates[692] = 0.45833333333300003;
-            coordinates[693] = 0.041666666666699999;
-            coordinates[694] = 0.125;
-            coordinates[695] = 0.375;
-            coordinates[696] = 0.041666666666699999;
-            coordinates[697] = 0.208333333333;
-            coordinates[698] = 0.29166666666699997;
-            coordinates[699] = 0.041666666666699999;
-            coordinates[700] = 0.29166666666699997;
-            coordinates[701] = 0.208333333333;
-            coordinates[702] = 0.041666666666699999;
-            coordinates[703] = 0.375;
-            coordinates[704] = 0.125;
-            coordinates[705] = 0.041666666666699999;
-            coordinates[706] = 0.45833333333300003;
-            coordinates[707] = 0.041666666666699999;
-            coordinates[708] = 0.125;
-            coordinates[709] = 0.041666666666699999;
-            coordinates[710] = 0.375;
-            coordinates[711] = 0.125;
-            coordinates[712] = 0.125;
-            coordinates[713] = 0.29166666666699997;
-            coordinates[714] = 0.125;
-            coordinates[715] = 0.208333333333;
-            coordinates[716] = 0.208333333333;
-            coordinates[717] = 0.125;
-            coordinates[718] = 0.29166666666699997;
-            coordinates[719] = 0.125;
-            coordinates[720] = 0.125;
-            coordinates[721] = 0.375;
-            coordinates[722] = 0.041666666666699999;
-            coordinates[723] = 0.208333333333;
-            coordinates[724] = 0.041666666666699999;
-            coordinates[725] = 0.29166666666699997;
-            coordinates[726] = 0.208333333333;
-            coordinates[727] = 0.125;
-            coordinates[728] = 0.208333333333;
-            coordinates[729] = 0.208333333333;
-            coordinates[730] = 0.208333333333;
-            coordinates[731] = 0.125;
-            coordinates[732] = 0.208333333333;
-            coordinates[733] = 0.29166666666699997;
-            coordinates[734] = 0.041666666666699999;
-            coordinates[735] = 0.29166666666699997;
-            coordinates[736] = 0.041666666666699999;
-            coordinates[737] = 0.208333333333;
-            coordinates[738] = 0.29166666666699997;
-            coordinates[739] = 0.125;
-            coordinates[740] = 0.125;
-            coordinates[741] = 0.29166666666699997;
-            coordinates[742] = 0.208333333333;
-            coordinates[743] = 0.041666666666699999;
-            coordinates[744] = 0.375;
-            coordinates[745] = 0.041666666666699999;
-            coordinates[746] = 0.125;
-            coordinates[747] = 0.375;
-            coordinates[748] = 0.125;
-            coordinates[749] = 0.041666666666699999;
-            coordinates[750] = 0.45833333333300003;
-            coordinates[751] = 0.041666666666699999;
-            coordinates[752] = 0.041666666666699999;
-            coordinates[753] = 0.041666666666699999;
-            coordinates[754] = 0.041666666666699999;
-            coordinates[755] = 0.375;
-            coordinates[756] = 0.041666666666699999;
-            coordinates[757] = 0.125;
-            coordinates[758] = 0.29166666666699997;
-            coordinates[759] = 0.041666666666699999;
-            coordinates[760] = 0.208333333333;
-            coordinates[761] = 0.208333333333;
-            coordinates[762] = 0.041666666666699999;
-            coordinates[763] = 0.29166666666699997;
-            coordinates[764] = 0.125;
-            coordinates[765] = 0.041666666666699999;
-            coordinates[766] = 0.375;
-            coordinates[767] = 0.041666666666699999;
-            coordinates[768] = 0.125;
-            coordinates[769] = 0.041666666666699999;
-            coordinates[770] = 0.29166666666699997;
-            coordinates[771] = 0.125;
-            coordinates[772] = 0.125;
-            coordinates[773] = 0.208333333333;
-            coordinates[774] = 0.125;
-            coordinates[775] = 0.208333333333;
-            coordinates[776] = 0.125;
-            coordinates[777] = 0.125;
-            coordinates[778] = 0.29166666666699997;
-            coordinates[779] = 0.041666666666699999;
-            coordinates[780] = 0.208333333333;
-            coordinates[781] = 0.041666666666699999;
-            coordinates[782] = 0.208333333333;
-            coordinates[783] = 0.208333333333;
-            coordinates[784] = 0.125;
-            coordinates[785] = 0.125;
-            coordinates[786] = 0.208333333333;
-            coordinates[787] = 0.208333333333;
-            coordinates[788] = 0.041666666666699999;
-            coordinates[789] = 0.29166666666699997;
-            coordinates[790] = 0.041666666666699999;
-            coordinates[791] = 0.125;
-            coordinates[792] = 0.29166666666699997;
-            coordinates[793] = 0.125;
-            coordinates[794] = 0.041666666666699999;
-            coordinates[795] = 0.375;
-            coordinates[796] = 0.041666666666699999;
-            coordinates[797] = 0.041666666666699999;
-            coordinates[798] = 0.041666666666699999;
-            coordinates[799] = 0.041666666666699999;
-            coordinates[800] = 0.29166666666699997;
-            coordinates[801] = 0.041666666666699999;
-            coordinates[802] = 0.125;
-            coordinates[803] = 0.208333333333;
-            coordinates[804] = 0.041666666666699999;
-            coordinates[805] = 0.208333333333;
-            coordinates[806] = 0.125;
-            coordinates[807] = 0.041666666666699999;
-            coordinates[808] = 0.29166666666699997;
-            coordinates[809] = 0.041666666666699999;
-            coordinates[810] = 0.125;
-            coordinates[811] = 0.041666666666699999;
-            coordinates[812] = 0.208333333333;
-            coordinates[813] = 0.125;
-            coordinates[814] = 0.125;
-            coordinates[815] = 0.125;
-            coordinates[816] = 0.125;
-            coordinates[817] = 0.208333333333;
-            coordinates[818] = 0.041666666666699999;
-            coordinates[819] = 0.208333333333;
-            coordinates[820] = 0.041666666666699999;
-            coordinates[821] = 0.125;
-            coordinates[822] = 0.208333333333;
-            coordinates[823] = 0.125;
-            coordinates[824] = 0.041666666666699999;
-            coordinates[825] = 0.29166666666699997;
-            coordinates[826] = 0.041666666666699999;
-            coordinates[827] = 0.041666666666699999;
-            coordinates[828] = 0.041666666666699999;
-            coordinates[829] = 0.041666666666699999;
-            coordinates[830] = 0.208333333333;
-            coordinates[831] = 0.041666666666699999;
-            coordinates[832] = 0.125;
-            coordinates[833] = 0.125;
-            coordinates[834] = 0.041666666666699999;
-            coordinates[835] = 0.208333333333;
-            coordinates[836] = 0.041666666666699999;
-            coordinates[837] = 0.125;
-            coordinates[838] = 0.041666666666699999;
-            coordinates[839] = 0.125;
-            coordinates[840] = 0.125;
-            coordinates[841] = 0.125;
-            coordinates[842] = 0.041666666666699999;
-            coordinates[843] = 0.208333333333;
-            coordinates[844] = 0.041666666666699999;
-            coordinates[845] = 0.041666666666699999;
-            coordinates[846] = 0.041666666666699999;
-            coordinates[847] = 0.041666666666699999;
-            coordinates[848] = 0.125;
-            coordinates[849] = 0.041666666666699999;
-            coordinates[850] = 0.125;
-            coordinates[851] = 0.041666666666699999;
-            coordinates[852] = 0.125;
-            coordinates[853] = 0.041666666666699999;
-            coordinates[854] = 0.041666666666699999;
-            coordinates[855] = 0.041666666666699999;
-            coordinates[856] = 0.041666666666699999;
-            coordinates[857] = 0.041666666666699999;
-            coordinates[858] = 0.045454545454499999;
-            coordinates[859] = 0.045454545454499999;
-            coordinates[860] = 0.86363636363600005;
-            coordinates[861] = 0.045454545454499999;
-            coordinates[862] = 0.13636363636400001;
-            coordinates[863] = 0.77272727272700004;
-            coordinates[864] = 0.045454545454499999;
-            coordinates[865] = 0.22727272727299999;
-            coordinates[866] = 0.68181818181800002;
-            coordinates[867] = 0.045454545454499999;
-            coordinates[868] = 0.31818181818199998;
-            coordinates[869] = 0.59090909090900001;
-            coordinates[870] = 0.045454545454499999;
-            coordinates[871] = 0.40909090909099999;
-            coordinates[872] = 0.5;
-            coordinates[873] = 0.045454545454499999;
-            coordinates[874] = 0.5;
-            coordinates[875] = 0.40909090909099999;
-            coordinates[876] = 0.045454545454499999;
-            coordinates[877] = 0.59090909090900001;
-            coordinates[878] = 0.31818181818199998;
-            coordinates[879] = 0.045454545454499999;
-            coordinates[880] = 0.68181818181800002;
-            coordinates[881] = 0.22727272727299999;
-            coordinates[882] = 0.045454545454499999;
-            coordinates[883] = 0.77272727272700004;
-            coordinates[884] = 0.13636363636400001;
-            coordinates[885] = 0.045454545454499999;
-            coordinates[886] = 0.86363636363600005;
-            coordinates[887] = 0.045454545454499999;
-            coordinates[888] = 0.13636363636400001;
-            coordinates[889] = 0.045454545454499999;
-            coordinates[890] = 0.77272727272700004;
-            coordinates[891] = 0.13636363636400001;
-            coordinates[892] = 0.13636363636400001;
-            coordinates[893] = 0.68181818181800002;
-            coordinates[894] = 0.13636363636400001;
-            coordinates[895] = 0.22727272727299999;
-            coordinates[896] = 0.59090909090900001;
-            coordinates[897] = 0.13636363636400001;
-            coordinates[898] = 0.31818181818199998;
-            coordinates[899] = 0.5;
-            coordinates[900] = 0.13636363636400001;
-            coordinates[901] = 0.40909090909099999;
-            coordinates[902] = 0.40909090909099999;
-            coordinates[903] = 0.13636363636400001;
-            coordinates[904] = 0.5;
-            coordinates[905] = 0.31818181818199998;
-            coordinates[906] = 0.13636363636400001;
-            coordinates[907] = 0.59090909090900001;
-            coordinates[908] = 0.22727272727299999;
-            coordinates[909] = 0.13636363636400001;
-            coordinates[910] = 0.68181818181800002;
-            coordinates[911] = 0.13636363636400001;
-            coordinates[912] = 0.13636363636400001;
-            coordinates[913] = 0.77272727272700004;
-            coordinates[914] = 0.045454545454499999;
-            coordinates[915] = 0.22727272727299999;
-            coordinates[916] = 0.045454545454499999;
-            coordinates[917] = 0.68181818181800002;
-            coordinates[918] = 0.22727272727299999;
-            coordinates[919] = 0.13636363636400001;
-            coordinates[920] = 0.59090909090900001;
-            coordinates[921] = 0.22727272727299999;
-            coordinates[922] = 0.22727272727299999;
-            coordinates[923] = 0.5;
-            coordinates[924] = 0.22727272727299999;
-            coordinates[925] = 0.31818181818199998;
-            coordinates[926] = 0.40909090909099999;
-            coordinates[927] = 0.22727272727299999;
-            coordinates[928] = 0.40909090909099999;
-            coordinates[929] = 0.31818181818199998;
-            coordinates[930] = 0.22727272727299999;
-            coordinates[931] = 0.5;
-            coordinates[932] = 0.22727272727299999;
-            coordinates[933] = 0.22727272727299999;
-            coordinates[934] = 0.59090909090900001;
-            coordinates[935] = 0.13636363636400001;
-            coordinates[936] = 0.22727272727299999;
-            coordinates[937] = 0.68181818181800002;
-            coordinates[938] = 0.045454545454499999;
-            coordinates[939] = 0.31818181818199998;
-            coordinates[940] = 0.045454545454499999;
-            coordinates[941] = 0.59090909090900001;
-            coordinates[942] = 0.31818181818199998;
-            coordinates[943] = 0.13636363636400001;
-            coordinates[944] = 0.5;
-            coordinates[945] = 0.31818181818199998;
-            coordinates[946] = 0.22727272727299999;
-            coordinates[947] = 0.40909090909099999;
-            coordinates[948] = 0.31818181818199998;
-            coordinates[949] = 0.31818181818199998;
-            coordinates[950] = 0.31818181818199998;
-            coordinates[951] = 0.31818181818199998;
-            coordinates[952] = 0.40909090909099999;
-            coordinates[953] = 0.22727272727299999;
-            coordinates[954] = 0.31818181818199998;
-            coordinates[955] = 0.5;
-            coordinates[956] = 0.13636363636400001;
-            coordinates[957] = 0.31818181818199998;
-            coordinates[958] = 0.59090909090900001;
-            coordinates[959] = 0.045454545454499999;
-            coordinates[960] = 0.40909090909099999;
-            coordinates[961] = 0.045454545454499999;
-            coordinates[962] = 0.5;
-            coordinates[963] = 0.40909090909099999;
-            coordinates[964] = 0.13636363636400001;
-            coordinates[965] = 0.40909090909099999;
-            coordinates[966] = 0.40909090909099999;
-            coordinates[967] = 0.22727272727299999;
-            coordinates[968] = 0.31818181818199998;
-            coordinates[969] = 0.40909090909099999;
-            coordinates[970] = 0.31818181818199998;
-            coordinates[971] = 0.22727272727299999;
-            coordinates[972] = 0.40909090909099999;
-            coordinates[973] = 0.40909090909099999;
-            coordinates[974] = 0.13636363636400001;
-            coordinates[975] = 0.40909090909099999;
-            coordinates[976] = 0.5;
-            coordinates[977] = 0.045454545454499999;
-            coordinates[978] = 0.5;
-            coordinates[979] = 0.045454545454499999;
-            coordinates[980] = 0.40909090909099999;
-            coordinates[981] = 0.5;
-            coordinates[982] = 0.13636363636400001;
-            coordinates[983] = 0.31818181818199998;
-            coordinates[984] = 0.5;
-            coordinates[985] = 0.22727272727299999;
-            coordinates[986] = 0.22727272727299999;
-            coordinates[987] = 0.5;
-            coordinates[988] = 0.31818181818199998;
-            coordinates[989] = 0.13636363636400001;
-            coordinates[990] = 0.5;
-            coordinates[991] = 0.40909090909099999;
-            coordinates[992] = 0.045454545454499999;
-            coordinates[993] = 0.59090909090900001;
-            coordinates[994] = 0.045454545454499999;
-            coordinates[995] = 0.31818181818199998;
-            coordinates[996] = 0.59090909090900001;
-            coordinates[997] = 0.13636363636400001;
-            coordinates[998] = 0.22727272727299999;
-            coordinates[999] = 0.59090909090900001;
-            coordinates[1000] = 0.22727272727299999;
-            coordinates[1001] = 0.13636363636400001;
-            coordinates[1002] = 0.59090909090900001;
-            coordinates[1003] = 0.31818181818199998;
-            coordinates[1004] = 0.045454545454499999;
-            coordinates[1005] = 0.68181818181800002;
-            coordinates[1006] = 0.045454545454499999;
-            coordinates[1007] = 0.22727272727299999;
-            coordinates[1008] = 0.68181818181800002;
-            coordinates[1009] = 0.13636363636400001;
-            coordinates[1010] = 0.13636363636400001;
-            coordinates[1011] = 0.68181818181800002;
-            coordinates[1012] = 0.22727272727299999;
-            coordinates[1013] = 0.045454545454499999;
-            coordinates[1014] = 0.77272727272700004;
-            coordinates[1015] = 0.045454545454499999;
-            coordinates[1016] = 0.13636363636400001;
-            coordinates[1017] = 0.77272727272700004;
-            coordinates[1018] = 0.13636363636400001;
-            coordinates[1019] = 0.045454545454499999;
-            coordinates[1020] = 0.86363636363600005;
-            coordinates[1021] = 0.045454545454499999;
-            coordinates[1022] = 0.045454545454499999;
-            coordinates[1023] = 0.045454545454499999;
-            coordinates[1024] = 0.045454545454499999;
-            coordinates[1025] = 0.77272727272700004;
-            coordinates[1026] = 0.045454545454499999;
-            coordinates[1027] = 0.13636363636400001;
-            coordinates[1028] = 0.68181818181800002;
-            coordinates[1029] = 0.045454545454499999;
-            coordinates[1030] = 0.22727272727299999;
-            coordinates[1031] = 0.59090909090900001;
-            coordinates[1032] = 0.045454545454499999;
-            coordinates[1033] = 0.31818181818199998;
-            coordinates[1034] = 0.5;
-            coordinates[1035] = 0.045454545454499999;
-            coordinates[1036] = 0.40909090909099999;
-            coordinates[1037] = 0.40909090909099999;
-            coordinates[1038] = 0.045454545454499999;
-            coordinates[1039] = 0.5;
-            coordinates[1040] = 0.31818181818199998;
-            coordinates[1041] = 0.045454545454499999;
-            coordinates[1042] = 0.59090909090900001;
-            coordinates[1043] = 0.22727272727299999;
-            coordinates[1044] = 0.045454545454499999;
-            coordinates[1045] = 0.68181818181800002;
-            coordinates[1046] = 0.13636363636400001;
-            coordinates[1047] = 0.045454545454499999;
-            coordinates[1048] = 0.77272727272700004;
-            coordinates[1049] = 0.045454545454499999;
-            coordinates[1050] = 0.13636363636400001;
-            coordinates[1051] = 0.045454545454499999;
-            coordinates[1052] = 0.68181818181800002;
-            coordinates[1053] = 0.13636363636400001;
-            coordinates[1054] = 0.13636363636400001;
-            coordinates[1055] = 0.59090909090900001;
-            coordinates[1056] = 0.13636363636400001;
-            coordinates[1057] = 0.22727272727299999;
-            coordinates[1058] = 0.5;
-            coordinates[1059] = 0.13636363636400001;
-            coordinates[1060] = 0.31818181818199998;
-            coordinates[1061] = 0.40909090909099999;
-            coordinates[1062] = 0.13636363636400001;
-            coordinates[1063] = 0.40909090909099999;
-            coordinates[1064] = 0.31818181818199998;
-            coordinates[1065] = 0.13636363636400001;
-            coordinates[1066] = 0.5;
-            coordinates[1067] = 0.22727272727299999;
-            coordinates[1068] = 0.13636363636400001;
-            coordinates[1069] = 0.59090909090900001;
-            coordinates[1070] = 0.13636363636400001;
-            coordinates[1071] = 0.13636363636400001;
-            coordinates[1072] = 0.68181818181800002;
-            coordinates[1073] = 0.045454545454499999;
-            coordinates[1074] = 0.22727272727299999;
-            coordinates[1075] = 0.045454545454499999;
-            coordinates[1076] = 0.59090909090900001;
-            coordinates[1077] = 0.22727272727299999;
-            coordinates[1078] = 0.13636363636400001;
-            coordinates[1079] = 0.5;
-            coordinates[1080] = 0.22727272727299999;
-            coordinates[1081] = 0.22727272727299999;
-            coordinates[1082] = 0.40909090909099999;
-            coordinates[1083] = 0.22727272727299999;
-            coordinates[1084] = 0.31818181818199998;
-            coordinates[1085] = 0.31818181818199998;
-            coordinates[1086] = 0.22727272727299999;
-            coordinates[1087] = 0.40909090909099999;
-            coordinates[1088] = 0.22727272727299999;
-            coordinates[1089] = 0.22727272727299999;
-            coordinates[1090] = 0.5;
-            coordinates[1091] = 0.13636363636400001;
-            coordinates[1092] = 0.22727272727299999;
-            coordinates[1093] = 0.59090909090900001;
-            coordinates[1094] = 0.045454545454499999;
-            coordinates[1095] = 0.31818181818199998;
-            coordinates[1096] = 0.045454545454499999;
-            coordinates[1097] = 0.5;
-            coordinates[1098] = 0.31818181818199998;
-            coordinates[1099] = 0.13636363636400001;
-            coordinates[1100] = 0.40909090909099999;
-            coordinates[1101] = 0.31818181818199998;
-            coordinates[1102] = 0.22727272727299999;
-            coordinates[1103] = 0.31818181818199998;
-            coordinates[1104] = 0.31818181818199998;
-            coordinates[1105] = 0.31818181818199998;
-            coordinates[1106] = 0.22727272727299999;
-            coordinates[1107] = 0.31818181818199998;
-            coordinates[1108] = 0.40909090909099999;
-            coordinates[1109] = 0.13636363636400001;
-            coordinates[1110] = 0.31818181818199998;
-            coordinates[1111] = 0.5;
-            coordinates[1112] = 0.045454545454499999;
-            coordinates[1113] = 0.40909090909099999;
-            coordinates[1114] = 0.045454545454499999;
-            coordinates[1115] = 0.40909090909099999;
-            coordinates[1116] = 0.40909090909099999;
-            coordinates[1117] = 0.13636363636400001;
-            coordinates[1118] = 0.31818181818199998;
-            coordinates[1119] = 0.40909090909099999;
-            coordinates[1120] = 0.22727272727299999;
-            coordinates[1121] = 0.22727272727299999;
-            coordinates[1122] = 0.40909090909099999;
-            coordinates[1123] = 0.31818181818199998;
-            coordinates[1124] = 0.13636363636400001;
-            coordinates[1125] = 0.40909090909099999;
-            coordinates[1126] = 0.40909090909099999;
-            coordinates[1127] = 0.045454545454499999;
-            coordinates[1128] = 0.5;
-            coordinates[1129] = 0.045454545454499999;
-            coordinates[1130] = 0.31818181818199998;
-            coordinates[1131] = 0.5;
-            coordinates[1132] = 0.13636363636400001;
-            coordinates[1133] = 0.22727272727299999;
-            coordinates[1134] = 0.5;
-            coordinates[1135] = 0.22727272727299999;
-            coordinates[1136] = 0.13636363636400001;
-            coordinates[1137] = 0.5;
-            coordinates[1138] = 0.31818181818199998;
-            coordinates[1139] = 0.045454545454499999;
-            coordinates[1140] = 0.59090909090900001;
-            coordinates[1141] = 0.045454545454499999;
-            coordinates[1142] = 0.22727272727299999;
-            coordinates[1143] = 0.59090909090900001;
-            coordinates[1144] = 0.13636363636400001;
-            coordinates[1145] = 0.13636363636400001;
-            coordinates[1146] = 0.59090909090900001;
-            coordinates[1147] = 0.22727272727299999;
-            coordinates[1148] = 0.045454545454499999;
-            coordinates[1149] = 0.68181818181800002;
-            coordinates[1150] = 0.045454545454499999;
-            coordinates[1151] = 0.13636363636400001;
-            coordinates[1152] = 0.68181818181800002;
-            coordinates[1153] = 0.13636363636400001;
-            coordinates[1154] = 0.045454545454499999;
-            coordinates[1155] = 0.77272727272700004;
-            coordinates[1156] = 0.045454545454499999;
-            coordinates[1157] = 0.045454545454499999;
-            coordinates[1158] = 0.045454545454499999;
-            coordinates[1159] = 0.045454545454499999;
-            coordinates[1160] = 0.68181818181800002;
-            coordinates[1161] = 0.045454545454499999;
-            coordinates[1162] = 0.13636363636400001;
-            coordinates[1163] = 0.59090909090900001;
-            coordinates[1164] = 0.045454545454499999;
-            coordinates[1165] = 0.22727272727299999;
-            coordinates[1166] = 0.5;
-            coordinates[1167] = 0.045454545454499999;
-            coordinates[1168] = 0.31818181818199998;
-            coordinates[1169] = 0.40909090909099999;
-            coordinates[1170] = 0.045454545454499999;
-            coordinates[1171] = 0.40909090909099999;
-            coordinates[1172] = 0.31818181818199998;
-            coordinates[1173] = 0.045454545454499999;
-            coordinates[1174] = 0.5;
-            coordinates[1175] = 0.22727272727299999;
-            coordinates[1176] = 0.045454545454499999;
-            coordinates[1177] = 0.59090909090900001;
-            coordinates[1178] = 0.13636363636400001;
-            coordinates[1179] = 0.045454545454499999;
-            coordinates[1180] = 0.68181818181800002;
-            coordinates[1181] = 0.045454545454499999;
-            coordinates[1182] = 0.13636363636400001;
-            coordinates[1183] = 0.045454545454499999;
-            coordinates[1184] = 0.59090909090900001;
-            coordinates[1185] = 0.13636363636400001;
-            coordinates[1186] = 0.13636363636400001;
-            coordinates[1187] = 0.5;
-            coordinates[1188] = 0.13636363636400001;
-            coordinates[1189] = 0.22727272727299999;
-            coordinates[1190] = 0.40909090909099999;
-            coordinates[1191] = 0.13636363636400001;
-            coordinates[1192] = 0.31818181818199998;
-            coordinates[1193] = 0.31818181818199998;
-            coordinates[1194] = 0.13636363636400001;
-            coordinates[1195] = 0.40909090909099999;
-            coordinates[1196] = 0.22727272727299999;
-            coordinates[1197] = 0.13636363636400001;
-            coordinates[1198] = 0.5;
-            coordinates[1199] = 0.13636363636400001;
-            coordinates[1200] = 0.13636363636400001;
-            coordinates[1201] = 0.59090909090900001;
-            coordinates[1202] = 0.045454545454499999;
-            coordinates[1203] = 0.22727272727299999;
-            coordinates[1204] = 0.045454545454499999;
-            coordinates[1205] = 0.5;
-            coordinates[1206] = 0.22727272727299999;
-            coordinates[1207] = 0.13636363636400001;
-            coordinates[1208] = 0.40909090909099999;
-            coordinates[1209] = 0.22727272727299999;
-            coordinates[1210] = 0.22727272727299999;
-            coordinates[1211] = 0.31818181818199998;
-            coordinates[1212] = 0.22727272727299999;
-            coordinates[1213] = 0.31818181818199998;
-            coordinates[1214] = 0.22727272727299999;
-            coordinates[1215] = 0.22727272727299999;
-            coordinates[1216] = 0.40909090909099999;
-            coordinates[1217] = 0.13636363636400001;
-            coordinates[1218] = 0.22727272727299999;
-            coordinates[1219] = 0.5;
-            coordinates[1220] = 0.045454545454499999;
-            coordinates[1221] = 0.31818181818199998;
-            coordinates[1222] = 0.045454545454499999;
-            coordinates[1223] = 0.40909090909099999;
-            coordinates[1224] = 0.31818181818199998;
-            coordinates[1225] = 0.13636363636400001;
-            coordinates[1226] = 0.31818181818199998;
-            coordinates[1227] = 0.31818181818199998;
-            coordinates[1228] = 0.22727272727299999;
-            coordinates[1229] = 0.22727272727299999;
-            coordinates[1230] = 0.31818181818199998;
-            coordinates[1231] = 0.31818181818199998;
-            coordinates[1232] = 0.13636363636400001;
-            coordinates[1233] = 0.31818181818199998;
-            coordinates[1234] = 0.40909090909099999;
-            coordinates[1235] = 0.045454545454499999;
-            coordinates[1236] = 0.40909090909099999;
-            coordinates[1237] = 0.045454545454499999;
-            coordinates[1238] = 0.31818181818199998;
-            coordinates[1239] = 0.40909090909099999;
-            coordinates[1240] = 0.13636363636400001;
-            coordinates[1241] = 0.22727272727299999;
-            coordinates[1242] = 0.40909090909099999;
-            coordinates[1243] = 0.22727272727299999;
-            coordinates[1244] = 0.13636363636400001;
-            coordinates[1245] = 0.40909090909099999;
-            coordinates[1246] = 0.31818181818199998;
-            coordinates[1247] = 0.045454545454499999;
-            coordinates[1248] = 0.5;
-            coordinates[1249] = 0.045454545454499999;
-            coordinates[1250] = 0.22727272727299999;
-            coordinates[1251] = 0.5;
-            coordinates[1252] = 0.13636363636400001;
-            coordinates[1253] = 0.13636363636400001;
-            coordinates[1254] = 0.5;
-            coordinates[1255] = 0.22727272727299999;
-            coordinates[1256] = 0.045454545454499999;
-            coordinates[1257] = 0.59090909090900001;
-            coordinates[1258] = 0.045454545454499999;
-            coordinates[1259] = 0.13636363636400001;
-            coordinates[1260] = 0.59090909090900001;
-            coordinates[1261] = 0.13636363636400001;
-            coordinates[1262] = 0.045454545454499999;
-            coordinates[1263] = 0.68181818181800002;
-            coordinates[1264] = 0.045454545454499999;
-            coordinates[1265] = 0.045454545454499999;
-            coordinates[1266] = 0.045454545454499999;
-            coordinates[1267] = 0.045454545454499999;
-            coordinates[1268] = 0.59090909090900001;
-            coordinates[1269] = 0.045454545454499999;
-            coordinates[1270] = 0.13636363636400001;
-            coordinates[1271] = 0.5;
-            coordinates[1272] = 0.045454545454499999;
-            coordinates[1273] = 0.22727272727299999;
-            coordinates[1274] = 0.40909090909099999;
-            coordinates[1275] = 0.045454545454499999;
-            coordinates[1276] = 0.31818181818199998;
-            coordinates[1277] = 0.31818181818199998;
-            coordinates[1278] = 0.045454545454499999;
-            coordinates[1279] = 0.40909090909099999;
-            coordinates[1280] = 0.22727272727299999;
-            coordinates[1281] = 0.045454545454499999;
-            coordinates[1282] = 0.5;
-            coordinates[1283] = 0.13636363636400001;
-            coordinates[1284] = 0.045454545454499999;
-            coordinates[1285] = 0.59090909090900001;
-            coordinates[1286] = 0.045454545454499999;
-            coordinates[1287] = 0.13636363636400001;
-            coordinates[1288] = 0.045454545454499999;
-            coordinates[1289] = 0.5;
-            coordinates[1290] = 0.13636363636400001;
-            coordinates[1291] = 0.13636363636400001;
-            coordinates[1292] = 0.40909090909099999;
-            coordinates[1293] = 0.13636363636400001;
-            coordinates[1294] = 0.22727272727299999;
-            coordinates[1295] = 0.31818181818199998;
-            coordinates[1296] = 0.13636363636400001;
-            coordinates[1297] = 0.31818181818199998;
-            coordinates[1298] = 0.22727272727299999;
-            coordinates[1299] = 0.13636363636400001;
-            coordinates[1300] = 0.40909090909099999;
-            coordinates[1301] = 0.13636363636400001;
-            coordinates[1302] = 0.13636363636400001;
-            coordinates[1303] = 0.5;
-            coordinates[1304] = 0.045454545454499999;
-            coordinates[1305] = 0.22727272727299999;
-            coordinates[1306] = 0.045454545454499999;
-            coordinates[1307] = 0.40909090909099999;
-            coordinates[1308] = 0.22727272727299999;
-            coordinates[1309] = 0.13636363636400001;
-            coordinates[1310] = 0.31818181818199998;
-            coordinates[1311] = 0.22727272727299999;
-            coordinates[1312] = 0.22727272727299999;
-            coordinates[1313] = 0.22727272727299999;
-            coordinates[1314] = 0.22727272727299999;
-            coordinates[1315] = 0.31818181818199998;
-            coordinates[1316] = 0.13636363636400001;
-            coordinates[1317] = 0.22727272727299999;
-            coordinates[1318] = 0.40909090909099999;
-            coordinates[1319] = 0.045454545454499999;
-            coordinates[1320] = 0.31818181818199998;
-            coordinates[1321] = 0.045454545454499999;
-            coordinates[1322] = 0.31818181818199998;
-            coordinates[1323] = 0.31818181818199998;
-            coordinates[1324] = 0.13636363636400001;
-            coordinates[1325] = 0.22727272727299999;
-            coordinates[1326] = 0.31818181818199998;
-            coordinates[1327] = 0.22727272727299999;
-            coordinates[1328] = 0.13636363636400001;
-            coordinates[1329] = 0.31818181818199998;
-            coordinates[1330] = 0.31818181818199998;
-            coordinates[1331] = 0.045454545454499999;
-            coordinates[1332] = 0.40909090909099999;
-            coordinates[1333] = 0.045454545454499999;
-            coordinates[1334] = 0.22727272727299999;
-            coordinates[1335] = 0.40909090909099999;
-            coordinates[1336] = 0.13636363636400001;
-            coordinates[1337] = 0.13636363636400001;
-            coordinates[1338] = 0.40909090909099999;
-            coordinates[1339] = 0.22727272727299999;
-            coordinates[1340] = 0.045454545454499999;
-            coordinates[1341] = 0.5;
-            coordinates[1342] = 0.045454545454499999;
-            coordinates[1343] = 0.13636363636400001;
-            coordinates[1344] = 0.5;
-            coordinates[1345] = 0.13636363636400001;
-            coordinates[1346] = 0.045454545454499999;
-            coordinates[1347] = 0.59090909090900001;
-            coordinates[1348] = 0.045454545454499999;
-            coordinates[1349] = 0.045454545454499999;
-            coordinates[1350] = 0.045454545454499999;
-            coordinates[1351] = 0.045454545454499999;
-            coordinates[1352] = 0.5;
-            coordinates[1353] = 0.045454545454499999;
-            coordinates[1354] = 0.13636363636400001;
-            coordinates[1355] = 0.40909090909099999;
-            coordinates[1356] = 0.045454545454499999;
-            coordinates[1357] = 0.22727272727299999;
-            coordinates[1358] = 0.31818181818199998;
-            coordinates[1359] = 0.045454545454499999;
-            coordinates[1360] = 0.31818181818199998;
-            coordinates[1361] = 0.22727272727299999;
-            coordinates[1362] = 0.045454545454499999;
-            coordinates[1363] = 0.40909090909099999;
-            coordinates[1364] = 0.13636363636400001;
-            coordinates[1365] = 0.045454545454499999;
-            coordinates[1366] = 0.5;
-            coordinates[1367] = 0.045454545454499999;
-            coordinates[1368] = 0.13636363636400001;
-            coordinates[1369] = 0.045454545454499999;
-            coordinates[1370] = 0.40909090909099999;
-            coordinates[1371] = 0.13636363636400001;
-            coordinates[1372] = 0.13636363636400001;
-            coordinates[1373] = 0.31818181818199998;
-            coordinates[1374] = 0.13636363636400001;
-            coordinates[1375] = 0.22727272727299999;
-            coordinates[1376] = 0.22727272727299999;
-            coordinates[1377] = 0.13636363636400001;
-            coordinates[1378] = 0.31818181818199998;
-            coordinates[1379] = 0.13636363636400001;
-            coordinates[1380] = 0.13636363636400001;
-            coordinates[1381] = 0.40909090909099999;
-            coordinates[1382] = 0.045454545454499999;
-            coordinates[1383] = 0.22727272727299999;
-            coordinates[1384] = 0.045454545454499999;
-            coordinates[1385] = 0.31818181818199998;
-            coordinates[1386] = 0.22727272727299999;
-            coordinates[1387] = 0.13636363636400001;
-            coordinates[1388] = 0.22727272727299999;
-            coordinates[1389] = 0.22727272727299999;
-            coordinates[1390] = 0.22727272727299999;
-            coordinates[1391] = 0.13636363636400001;
-            coordinates[1392] = 0.22727272727299999;
-            coordinates[1393] = 0.31818181818199998;
-            coordinates[1394] = 0.045454545454499999;
-            coordinates[1395] = 0.31818181818199998;
-            coordinates[1396] = 0.045454545454499999;
-            coordinates[1397] = 0.22727272727299999;
-            coordinates[1398] = 0.31818181818199998;
-            coordinates[1399] = 0.13636363636400001;
-            coordinates[1400] = 0.13636363636400001;
-            coordinates[1401] = 0.31818181818199998;
-            coordinates[1402] = 0.22727272727299999;
-            coordinates[1403] = 0.045454545454499999;
-            coordinates[1404] = 0.40909090909099999;
-            coordinates[1405] = 0.045454545454499999;
-            coordinates[1406] = 0.13636363636400001;
-            coordinates[1407] = 0.40909090909099999;
-            coordinates[1408] = 0.13636363636400001;
-            coordinates[1409] = 0.045454545454499999;
-            coordinates[1410] = 0.5;
-            coordinates[1411] = 0.045454545454499999;
-            coordinates[1412] = 0.045454545454499999;
-            coordinates[1413] = 0.045454545454499999;
-            coordinates[1414] = 0.045454545454499999;
-            coordinates[1415] = 0.40909090909099999;
-            coordinates[1416] = 0.045454545454499999;
-            coordinates[1417] = 0.13636363636400001;
-            coordinates[1418] = 0.31818181818199998;
-            coordinates[1419] = 0.045454545454499999;
-            coordinates[1420] = 0.22727272727299999;
-            coordinates[1421] = 0.22727272727299999;
-            coordinates[1422] = 0.045454545454499999;
-            coordinates[1423] = 0.31818181818199998;
-            coordinates[1424] = 0.13636363636400001;
-            coordinates[1425] = 0.045454545454499999;
-            coordinates[1426] = 0.40909090909099999;
-            coordinates[1427] = 0.045454545454499999;
-            coordinates[1428] = 0.13636363636400001;
-            coordinates[1429] = 0.045454545454499999;
-            coordinates[1430] = 0.31818181818199998;
-            coordinates[1431] = 0.13636363636400001;
-            coordinates[1432] = 0.13636363636400001;
-            coordinates[1433] = 0.22727272727299999;
-            coordinates[1434] = 0.13636363636400001;
-            coordinates[1435] = 0.22727272727299999;
-            coordinates[1436] = 0.13636363636400001;
-            coordinates[1437] = 0.13636363636400001;
-            coordinates[1438] = 0.31818181818199998;
-            coordinates[1439] = 0.045454545454499999;
-            coordinates[1440] = 0.22727272727299999;
-            coordinates[1441] = 0.045454545454499999;
-            coordinates[1442] = 0.22727272727299999;
-            coordinates[1443] = 0.22727272727299999;
-            coordinates[1444] = 0.13636363636400001;
-            coordinates[1445] = 0.13636363636400001;
-            coordinates[1446] = 0.22727272727299999;
-            coordinates[1447] = 0.22727272727299999;
-            coordinates[1448] = 0.045454545454499999;
-            coordinates[1449] = 0.31818181818199998;
-            coordinates[1450] = 0.045454545454499999;
-            coordinates[1451] = 0.13636363636400001;
-            coordinates[1452] = 0.31818181818199998;
-            coordinates[1453] = 0.13636363636400001;
-            coordinates[1454] = 0.045454545454499999;
-            coordinates[1455] = 0.40909090909099999;
-            coordinates[1456] = 0.045454545454499999;
-            coordinates[1457] = 0.045454545454499999;
-            coordinates[1458] = 0.045454545454499999;
-            coordinates[1459] = 0.045454545454499999;
-            coordinates[1460] = 0.31818181818199998;
-            coordinates[1461] = 0.045454545454499999;
-            coordinates[1462] = 0.13636363636400001;
-            coordinates[1463] = 0.22727272727299999;
-            coordinates[1464] = 0.045454545454499999;
-            coordinates[1465] = 0.22727272727299999;
-            coordinates[1466] = 0.13636363636400001;
-            coordinates[1467] = 0.045454545454499999;
-            coordinates[1468] = 0.31818181818199998;
-            coordinates[1469] = 0.045454545454499999;
-            coordinates[1470] = 0.13636363636400001;
-            coordinates[1471] = 0.045454545454499999;
-            coordinates[1472] = 0.22727272727299999;
-            coordinates[1473] = 0.13636363636400001;
-            coordinates[1474] = 0.13636363636400001;
-            coordinates[1475] = 0.13636363636400001;
-            coordinates[1476] = 0.13636363636400001;
-            coordinates[1477] = 0.22727272727299999;
-            coordinates[1478] = 0.045454545454499999;
-            coordinates[1479] = 0.22727272727299999;
-            coordinates[1480] = 0.045454545454499999;
-            coordinates[1481] = 0.13636363636400001;
-            coordinates[1482] = 0.22727272727299999;
-            coordinates[1483] = 0.13636363636400001;
-            coordinates[1484] = 0.045454545454499999;
-            coordinates[1485] = 0.31818181818199998;
-            coordinates[1486] = 0.045454545454499999;
-            coordinates[1487] = 0.045454545454499999;
-            coordinates[1488] = 0.045454545454499999;
-            coordinates[1489] = 0.045454545454499999;
-            coordinates[1490] = 0.22727272727299999;
-            coordinates[1491] = 0.045454545454499999;
-            coordinates[1492] = 0.13636363636400001;
-            coordinates[1493] = 0.13636363636400001;
-            coordinates[1494] = 0.045454545454499999;
-            coordinates[1495] = 0.22727272727299999;
-            coordinates[1496] = 0.045454545454499999;
-            coordinates[1497] = 0.13636363636400001;
-            coordinates[1498] = 0.045454545454499999;
-            coordinates[1499] = 0.13636363636400001;
-            coordinates[1500] = 0.13636363636400001;
-            coordinates[1501] = 0.13636363636400001;
-            coordinates[1502] = 0.045454545454499999;
-            coordinates[1503] = 0.22727272727299999;
-            coordinates[1504] = 0.045454545454499999;
-            coordinates[1505] = 0.045454545454499999;
-            coordinates[1506] = 0.045454545454499999;
-            coordinates[1507] = 0.045454545454499999;
-            coordinates[1508] = 0.13636363636400001;
-            coordinates[1509] = 0.045454545454499999;
-            coordinates[1510] = 0.13636363636400001;
-            coordinates[1511] = 0.045454545454499999;
-            coordinates[1512] = 0.13636363636400001;
-            coordinates[1513] = 0.045454545454499999;
-            coordinates[1514] = 0.045454545454499999;
-            coordinates[1515] = 0.045454545454499999;
-            coordinates[1516] = 0.045454545454499999;
-            coordinates[1517] = 0.045454545454499999;
-            coordinates[1518] = 0.050000000000000003;
-            coordinates[1519] = 0.050000000000000003;
-            coordinates[1520] = 0.84999999999999998;
-            coordinates[1521] = 0.050000000000000003;
-            coordinates[1522] = 0.14999999999999999;
-            coordinates[1523] = 0.75;
-            coordinates[1524] = 0.050000000000000003;
-            coordinates[1525] = 0.25;
-            coordinates[1526] = 0.65000000000000002;
-            coordinates[1527] = 0.050000000000000003;
-            coordinates[1528] = 0.34999999999999998;
-            coordinates[1529] = 0.55000000000000004;
-            coordinates[1530] = 0.050000000000000003;
-            coordinates[1531] = 0.45000000000000001;
-            coordinates[1532] = 0.45000000000000001;
-            coordinates[1533] = 0.050000000000000003;
-            coordinates[1534] = 0.55000000000000004;
-            coordinates[1535] = 0.34999999999999998;
-            coordinates[1536] = 0.050000000000000003;
-            coordinates[1537] = 0.65000000000000002;
-            coordinates[1538] = 0.25;
-            coordinates[1539] = 0.050000000000000003;
-            coordinates[1540] = 0.75;
-            coordinates[1541] = 0.14999999999999999;
-            coordinates[1542] = 0.050000000000000003;
-            coordinates[1543] = 0.84999999999999998;
-            coordinates[1544] = 0.050000000000000003;
-            coordinates[1545] = 0.14999999999999999;
-            coordinates[1546] = 0.050000000000000003;
-            coordinates[1547] = 0.75;
-            coordinates[1548] = 0.14999999999999999;
-            coordinates[1549] = 0.14999999999999999;
-            coordinates[1550] = 0.65000000000000002;
-            coordinates[1551] = 0.14999999999999999;
-            coordinates[1552] = 0.25;
-            coordinates[1553] = 0.55000000000000004;
-            coordinates[1554] = 0.14999999999999999;
-            coordinates[1555] = 0.34999999999999998;
-            coordinates[1556] = 0.45000000000000001;
-            coordinates[1557] = 0.14999999999999999;
-            coordinates[1558] = 0.45000000000000001;
-            coordinates[1559] = 0.34999999999999998;
-            coordinates[1560] = 0.14999999999999999;
-            coordinates[1561] = 0.55000000000000004;
-            coordinates[1562] = 0.25;
-            coordinates[1563] = 0.14999999999999999;
-            coordinates[1564] = 0.65000000000000002;
-            coordinates[1565] = 0.14999999999999999;
-            coordinates[1566] = 0.14999999999999999;
-            coordinates[1567] = 0.75;
-            coordinates[1568] = 0.050000000000000003;
-            coordinates[1569] = 0.25;
-            coordinates[1570] = 0.050000000000000003;
-            coordinates[1571] = 0.65000000000000002;
-            coordinates[1572] = 0.25;
-            coordinates[1573] = 0.14999999999999999;
-            coordinates[1574] = 0.55000000000000004;
-            coordinates[1575] = 0.25;
-            coordinates[1576] = 0.25;
-            coordinates[1577] = 0.45000000000000001;
-            coordinates[1578] = 0.25;
-            coordinates[1579] = 0.34999999999999998;
-            coordinates[1580] = 0.34999999999999998;
-            coordinates[1581] = 0.25;
-            coordinates[1582] = 0.45000000000000001;
-            coordinates[1583] = 0.25;
-            coordinates[1584] = 0.25;
-            coordinates[1585] = 0.55000000000000004;
-            coordinates[1586] = 0.14999999999999999;
-            coordinates[1587] = 0.25;
-            coordinates[1588] = 0.65000000000000002;
-            coordinates[1589] = 0.050000000000000003;
-            coordinates[1590] = 0.34999999999999998;
-            coordinates[1591] = 0.050000000000000003;
-            coordinates[1592] = 0.55000000000000004;
-            coordinates[1593] = 0.34999999999999998;
-            coordinates[1594] = 0.14999999999999999;
-            coordinates[1595] = 0.45000000000000001;
-            coordinates[1596] = 0.34999999999999998;
-            coordinates[1597] = 0.25;
-            coordinates[1598] = 0.34999999999999998;
-            coordinates[1599] = 0.34999999999999998;
-            coordinates[1600] = 0.34999999999999998;
-            coordinates[1601] = 0.25;
-            coordinates[1602] = 0.34999999999999998;
-            coordinates[1603] = 0.45000000000000001;
-            coordinates[1604] = 0.14999999999999999;
-            coordinates[1605] = 0.34999999999999998;
-            coordinates[1606] = 0.55000000000000004;
-            coordinates[1607] = 0.050000000000000003;
-            coordinates[1608] = 0.45000000000000001;
-            coordinates[1609] = 0.050000000000000003;
-            coordinates[1610] = 0.45000000000000001;
-            coordinates[1611] = 0.45000000000000001;
-            coordinates[1612] = 0.14999999999999999;
-            coordinates[1613] = 0.34999999999999998;
-            coordinates[1614] = 0.45000000000000001;
-            coordinates[1615] = 0.25;
-            coordinates[1616] = 0.25;
-            coordinates[1617] = 0.45000000000000001;
-            coordinates[1618] = 0.34999999999999998;
-            coordinates[1619] = 0.14999999999999999;
-            coordinates[1620] = 0.45000000000000001;
-            coordinates[1621] = 0.45000000000000001;
-            coordinates[1622] = 0.050000000000000003;
-            coordinates[1623] = 0.55000000000000004;
-            coordinates[1624] = 0.050000000000000003;
-            coordinates[1625] = 0.34999999999999998;
-            coordinates[1626] = 0.55000000000000004;
-            coordinates[1627] = 0.14999999999999999;
-            coordinates[1628] = 0.25;
-            coordinates[1629] = 0.55000000000000004;
-            coordinates[1630] = 0.25;
-            coordinates[1631] = 0.14999999999999999;
-            coordinates[1632] = 0.55000000000000004;
-            coordinates[1633] = 0.34999999999999998;
-            coordinates[1634] = 0.050000000000000003;
-            coordinates[1635] = 0.65000000000000002;
-            coordinates[1636] = 0.050000000000000003;
-            coordinates[1637] = 0.25;
-            coordinates[1638] = 0.65000000000000002;
-            coordinates[1639] = 0.14999999999999999;
-            coordinates[1640] = 0.14999999999999999;
-            coordinates[1641] = 0.65000000000000002;
-            coordinates[1642] = 0.25;
-            coordinates[1643] = 0.050000000000000003;
-            coordinates[1644] = 0.75;
-            coordinates[1645] = 0.050000000000000003;
-            coordinates[1646] = 0.14999999999999999;
-            coordinates[1647] = 0.75;
-            coordinates[1648] = 0.14999999999999999;
-            coordinates[1649] = 0.050000000000000003;
-            coordinates[1650] = 0.84999999999999998;
-            coordinates[1651] = 0.050000000000000003;
-            coordinates[1652] = 0.050000000000000003;
-            coordinates[1653] = 0.050000000000000003;
-            coordinates[1654] = 0.050000000000000003;
-            coordinates[1655] = 0.75;
-            coordinates[1656] = 0.050000000000000003;
-            coordinates[1657] = 0.14999999999999999;
-            coordinates[1658] = 0.65000000000000002;
-            coordinates[1659] = 0.050000000000000003;
-            coordinates[1660] = 0.25;
-            coordinates[1661] = 0.55000000000000004;
-            coordinates[1662] = 0.050000000000000003;
-            coordinates[1663] = 0.34999999999999998;
-            coordinates[1664] = 0.45000000000000001;
-            coordinates[1665] = 0.050000000000000003;
-            coordinates[1666] = 0.45000000000000001;
-            coordinates[1667] = 0.34999999999999998;
-            coordinates[1668] = 0.050000000000000003;
-            coordinates[1669] = 0.55000000000000004;
-            coordinates[1670] = 0.25;
-            coordinates[1671] = 0.050000000000000003;
-            coordinates[1672] = 0.65000000000000002;
-            coordinates[1673] = 0.14999999999999999;
-            coordinates[1674] = 0.050000000000000003;
-            coordinates[1675] = 0.75;
-            coordinates[1676] = 0.050000000000000003;
-            coordinates[1677] = 0.14999999999999999;
-            coordinates[1678] = 0.050000000000000003;
-            coordinates[1679] = 0.65000000000000002;
-            coordinates[1680] = 0.14999999999999999;
-            coordinates[1681] = 0.14999999999999999;
-            coordinates[1682] = 0.55000000000000004;
-            coordinates[1683] = 0.14999999999999999;
-            coordinates[1684] = 0.25;
-            coordinates[1685] = 0.45000000000000001;
-            coordinates[1686] = 0.14999999999999999;
-            coordinates[1687] = 0.34999999999999998;
-            coordinates[1688] = 0.34999999999999998;
-            coordinates[1689] = 0.14999999999999999;
-            coordinates[1690] = 0.45000000000000001;
-            coordinates[1691] = 0.25;
-            coordinates[1692] = 0.14999999999999999;
-            coordinates[1693] = 0.55000000000000004;
-            coordinates[1694] = 0.14999999999999999;
-            coordinates[1695] = 0.14999999999999999;
-            coordinates[1696] = 0.65000000000000002;
-            coordinates[1697] = 0.050000000000000003;
-            coordinates[1698] = 0.25;
-            coordinates[1699] = 0.050000000000000003;
-            coordinates[1700] = 0.55000000000000004;
-            coordinates[1701] = 0.25;
-            coordinates[1702] = 0.14999999999999999;
-            coordinates[1703] = 0.45000000000000001;
-            coordinates[1704] = 0.25;
-            coordinates[1705] = 0.25;
-            coordinates[1706] = 0.34999999999999998;
-            coordinates[1707] = 0.25;
-            coordinates[1708] = 0.34999999999999998;
-            coordinates[1709] = 0.25;
-            coordinates[1710] = 0.25;
-            coordinates[1711] = 0.45000000000000001;
-            coordinates[1712] = 0.14999999999999999;
-            coordinates[1713] = 0.25;
-            coordinates[1714] = 0.55000000000000004;
-            coordinates[1715] = 0.050000000000000003;
-            coordinates[1716] = 0.34999999999999998;
-            coordinates[1717] = 0.050000000000000003;
-            coordinates[1718] = 0.45000000000000001;
-            coordinates[1719] = 0.34999999999999998;
-            coordinates[1720] = 0.14999999999999999;
-            coordinates[1721] = 0.34999999999999998;
-            coordinates[1722] = 0.34999999999999998;
-            coordinates[1723] = 0.25;
-            coordinates[1724] = 0.25;
-            coordinates[1725] = 0.34999999999999998;
-            coordinates[1726] = 0.34999999999999998;
-            coordinates[1727] = 0.14999999999999999;
-            coordinates[1728] = 0.34999999999999998;
-            coordinates[1729] = 0.45000000000000001;
-            coordinates[1730] = 0.050000000000000003;
-            coordinates[1731] = 0.45000000000000001;
-            coordinates[1732] = 0.050000000000000003;
-            coordinates[1733] = 0.34999999999999998;
-            coordinates[1734] = 0.45000000000000001;
-            coordinates[1735] = 0.14999999999999999;
-            coordinates[1736] = 0.25;
-            coordinates[1737] = 0.45000000000000001;
-            coordinates[1738] = 0.25;
-            coordinates[1739] = 0.14999999999999999;
-            coordinates[1740] = 0.45000000000000001;
-            coordinates[1741] = 0.34999999999999998;
-            coordinates[1742] = 0.050000000000000003;
-            coordinates[1743] = 0.55000000000000004;
-            coordinates[1744] = 0.050000000000000003;
-            coordinates[1745] = 0.25;
-            coordinates[1746] = 0.55000000000000004;
-            coordinates[1747] = 0.14999999999999999;
-            coordinates[1748] = 0.14999999999999999;
-            coordinates[1749] = 0.55000000000000004;
-            coordinates[1750] = 0.25;
-            coordinates[1751] = 0.050000000000000003;
-            coordinates[1752] = 0.65000000000000002;
-            coordinates[1753] = 0.050000000000000003;
-            coordinates[1754] = 0.14999999999999999;
-            coordinates[1755] = 0.65000000000000002;
-            coordinates[1756] = 0.14999999999999999;
-            coordinates[1757] = 0.050000000000000003;
-            coordinates[1758] = 0.75;
-            coordinates[1759] = 0.050000000000000003;
-            coordinates[1760] = 0.050000000000000003;
-            coordinates[1761] = 0.050000000000000003;
-            coordinates[1762] = 0.050000000000000003;
-            coordinates[1763] = 0.65000000000000002;
-            coordinates[1764] = 0.050000000000000003;
-            coordinates[1765] = 0.14999999999999999;
-            coordinates[1766] = 0.55000000000000004;
-            coordinates[1767] = 0.050000000000000003;
-            coordinates[1768] = 0.25;
-            coordinates[1769] = 0.45000000000000001;
-            coordinates[1770] = 0.050000000000000003;
-            coordinates[1771] = 0.34999999999999998;
-            coordinates[1772] = 0.34999999999999998;
-            coordinates[1773] = 0.050000000000000003;
-            coordinates[1774] = 0.45000000000000001;
-            coordinates[1775] = 0.25;
-            coordinates[1776] = 0.050000000000000003;
-            coordinates[1777] = 0.55000000000000004;
-            coordinates[1778] = 0.14999999999999999;
-            coordinates[1779] = 0.050000000000000003;
-            coordinates[1780] = 0.65000000000000002;
-            coordinates[1781] = 0.050000000000000003;
-            coordinates[1782] = 0.14999999999999999;
-            coordinates[1783] = 0.050000000000000003;
-            coordinates[1784] = 0.55000000000000004;
-            coordinates[1785] = 0.14999999999999999;
-            coordinates[1786] = 0.14999999999999999;
-            coordinates[1787] = 0.45000000000000001;
-            coordinates[1788] = 0.14999999999999999;
-            coordinates[1789] = 0.25;
-            coordinates[1790] = 0.34999999999999998;
-            coordinates[1791] = 0.14999999999999999;
-            coordinates[1792] = 0.34999999999999998;
-            coordinates[1793] = 0.25;
-            coordinates[1794] = 0.14999999999999999;
-            coordinates[1795] = 0.45000000000000001;
-            coordinates[1796] = 0.14999999999999999;
-            coordinates[1797] = 0.14999999999999999;
-            coordinates[1798] = 0.55000000000000004;
-            coordinates[1799] = 0.050000000000000003;
-            coordinates[1800] = 0.25;
-            coordinates[1801] = 0.050000000000000003;
-            coordinates[1802] = 0.45000000000000001;
-            coordinates[1803] = 0.25;
-            coordinates[1804] = 0.14999999999999999;
-            coordinates[1805] = 0.34999999999999998;
-            coordinates[1806] = 0.25;
-            coordinates[1807] = 0.25;
-            coordinates[1808] = 0.25;
-            coordinates[1809] = 0.25;
-            coordinates[1810] = 0.34999999999999998;
-            coordinates[1811] = 0.14999999999999999;
-            coordinates[1812] = 0.25;
-            coordinates[1813] = 0.45000000000000001;
-            coordinates[1814] = 0.050000000000000003;
-            coordinates[1815] = 0.34999999999999998;
-            coordinates[1816] = 0.050000000000000003;
-            coordinates[1817] = 0.34999999999999998;
-            coordinates[1818] = 0.34999999999999998;
-            coordinates[1819] = 0.14999999999999999;
-            coordinates[1820] = 0.25;
-            coordinates[1821] = 0.34999999999999998;
-            coordinates[1822] = 0.25;
-            coordinates[1823] = 0.14999999999999999;
-            coordinates[1824] = 0.34999999999999998;
-            coordinates[1825] = 0.34999999999999998;
-            coordinates[1826] = 0.050000000000000003;
-            coordinates[1827] = 0.45000000000000001;
-            coordinates[1828] = 0.050000000000000003;
-            coordinates[1829] = 0.25;
-            coordinates[1830] = 0.45000000000000001;
-            coordinates[1831] = 0.14999999999999999;
-            coordinates[1832] = 0.14999999999999999;
-            coordinates[1833] = 0.45000000000000001;
-            coordinates[1834] = 0.25;
-            coordinates[1835] = 0.050000000000000003;
-            coordinates[1836] = 0.55000000000000004;
-            coordinates[1837] = 0.050000000000000003;
-            coordinates[1838] = 0.14999999999999999;
-            coordinates[1839] = 0.55000000000000004;
-            coordinates[1840] = 0.14999999999999999;
-            coordinates[1841] = 0.050000000000000003;
-            coordinates[1842] = 0.65000000000000002;
-            coordinates[1843] = 0.050000000000000003;
-            coordinates[1844] = 0.050000000000000003;
-            coordinates[1845] = 0.050000000000000003;
-            coordinates[1846] = 0.050000000000000003;
-            coordinates[1847] = 0.55000000000000004;
-            coordinates[1848] = 0.050000000000000003;
-            coordinates[1849] = 0.14999999999999999;
-            coordinates[1850] = 0.45000000000000001;
-            coordinates[1851] = 0.050000000000000003;
-            coordinates[1852] = 0.25;
-            coordinates[1853] = 0.34999999999999998;
-            coordinates[1854] = 0.050000000000000003;
-            coordinates[1855] = 0.34999999999999998;
-            coordinates[1856] = 0.25;
-            coordinates[1857] = 0.050000000000000003;
-            coordinates[1858] = 0.45000000000000001;
-            coordinates[1859] = 0.14999999999999999;
-            coordinates[1860] = 0.050000000000000003;
-            coordinates[1861] = 0.55000000000000004;
-            coordinates[1862] = 0.050000000000000003;
-            coordinates[1863] = 0.14999999999999999;
-            coordinates[1864] = 0.050000000000000003;
-            coordinates[1865] = 0.45000000000000001;
-            coordinates[1866] = 0.14999999999999999;
-            coordinates[1867] = 0.14999999999999999;
-            coordinates[1868] = 0.34999999999999998;
-            coordinates[1869] = 0.14999999999999999;
-            coordinates[1870] = 0.25;
-            coordinates[1871] = 0.25;
-            coordinates[1872] = 0.14999999999999999;
-            coordinates[1873] = 0.34999999999999998;
-            coordinates[1874] = 0.14999999999999999;
-            coordinates[1875] = 0.14999999999999999;
-            coordinates[1876] = 0.45000000000000001;
-            coordinates[1877] = 0.050000000000000003;
-            coordinates[1878] = 0.25;
-            coordinates[1879] = 0.050000000000000003;
-            coordinates[1880] = 0.34999999999999998;
-            coordinates[1881] = 0.25;
-            coordinates[1882] = 0.14999999999999999;
-            coordinates[1883] = 0.25;
-            coordinates[1884] = 0.25;
-            coordinates[1885] = 0.25;
-            coordinates[1886] = 0.14999999999999999;
-            coordinates[1887] = 0.25;
-            coordinates[1888] = 0.34999999999999998;
-            coordinates[1889] = 0.050000000000000003;
-            coordinates[1890] = 0.34999999999999998;
-            coordinates[1891] = 0.050000000000000003;
-            coordinates[1892] = 0.25;
-            coordinates[1893] = 0.34999999999999998;
-            coordinates[1894] = 0.14999999999999999;
-            coordinates[1895] = 0.14999999999999999;
-            coordinates[1896] = 0.34999999999999998;
-            coordinates[1897] = 0.25;
-            coordinates[1898] = 0.050000000000000003;
-            coordinates[1899] = 0.45000000000000001;
-            coordinates[1900] = 0.050000000000000003;
-            coordinates[1901] = 0.14999999999999999;
-            coordinates[1902] = 0.45000000000000001;
-            coordinates[1903] = 0.14999999999999999;
-            coordinates[1904] = 0.050000000000000003;
-            coordinates[1905] = 0.55000000000000004;
-            coordinates[1906] = 0.050000000000000003;
-            coordinates[1907] = 0.050000000000000003;
-            coordinates[1908] = 0.050000000000000003;
-            coordinates[1909] = 0.050000000000000003;
-            coordinates[1910] = 0.45000000000000001;
-            coordinates[1911] = 0.050000000000000003;
-            coordinates[1912] = 0.14999999999999999;
-            coordinates[1913] = 0.34999999999999998;
-            coordinates[1914] = 0.050000000000000003;
-            coordinates[1915] = 0.25;
-            coordinates[1916] = 0.25;
-            coordinates[1917] = 0.050000000000000003;
-            coordinates[1918] = 0.34999999999999998;
-            coordinates[1919] = 0.14999999999999999;
-            coordinates[1920] = 0.050000000000000003;
-            coordinates[1921] = 0.45000000000000001;
-            coordinates[1922] = 0.050000000000000003;
-            coordinates[1923] = 0.14999999999999999;
-            coordinates[1924] = 0.050000000000000003;
-            coordinates[1925] = 0.34999999999999998;
-            coordinates[1926] = 0.14999999999999999;
-            coordinates[1927] = 0.14999999999999999;
-            coordinates[1928] = 0.25;
-            coordinates[1929] = 0.14999999999999999;
-            coordinates[1930] = 0.25;
-            coordinates[1931] = 0.14999999999999999;
-            coordinates[1932] = 0.14999999999999999;
-            coordinates[1933] = 0.34999999999999998;
-            coordinates[1934] = 0.050000000000000003;
-            coordinates[1935] = 0.25;
-            coordinates[1936] = 0.050000000000000003;
-            coordinates[1937] = 0.25;
-            coordinates[1938] = 0.25;
-            coordinates[1939] = 0.14999999999999999;
-            coordinates[1940] = 0.14999999999999999;
-            coordinates[1941] = 0.25;
-            coordinates[1942] = 0.25;
-            coordinates[1943] = 0.050000000000000003;
-            coordinates[1944] = 0.34999999999999998;
-            coordinates[1945] = 0.050000000000000003;
-            coordinates[1946] = 0.14999999999999999;
-            coordinates[1947] = 0.34999999999999998;
-            coordinates[1948] = 0.14999999999999999;
-            coordinates[1949] = 0.050000000000000003;
-            coordinates[1950] = 0.45000000000000001;
-            coordinates[1951] = 0.050000000000000003;
-            coordinates[1952] = 0.050000000000000003;
-            coordinates[1953] = 0.050000000000000003;
-            coordinates[1954] = 0.050000000000000003;
-            coordinates[1955] = 0.34999999999999998;
-            coordinates[1956] = 0.050000000000000003;
-            coordinates[1957] = 0.14999999999999999;
-            coordinates[1958] = 0.25;
-            coordinates[1959] = 0.050000000000000003;
-            coordinates[1960] = 0.25;
-            coordinates[1961] = 0.14999999999999999;
-            coordinates[1962] = 0.050000000000000003;
-            coordinates[1963] = 0.34999999999999998;
-            coordinates[1964] = 0.050000000000000003;
-            coordinates[1965] = 0.14999999999999999;
-            coordinates[1966] = 0.050000000000000003;
-            coordinates[1967] = 0.25;
-            coordinates[1968] = 0.14999999999999999;
-            coordinates[1969] = 0.14999999999999999;
-            coordinates[1970] = 0.14999999999999999;
-            coordinates[1971] = 0.14999999999999999;
-            coordinates[1972] = 0.25;
-            coordinates[1973] = 0.050000000000000003;
-            coordinates[1974] = 0.25;
-            coordinates[1975] = 0.050000000000000003;
-            coordinates[1976] = 0.14999999999999999;
-            coordinates[1977] = 0.25;
-            coordinates[1978] = 0.14999999999999999;
-            coordinates[1979] = 0.050000000000000003;
-            coordinates[1980] = 0.34999999999999998;
-            coordinates[1981] = 0.050000000000000003;
-            coordinates[1982] = 0.050000000000000003;
-            coordinates[1983] = 0.050000000000000003;
-            coordinates[1984] = 0.050000000000000003;
-            coordinates[1985] = 0.25;
-            coordinates[1986] = 0.050000000000000003;
-            coordinates[1987] = 0.14999999999999999;
-            coordinates[1988] = 0.14999999999999999;
-            coordinates[1989] = 0.050000000000000003;
-            coordinates[1990] = 0.25;
-            coordinates[1991] = 0.050000000000000003;
-            coordinates[1992] = 0.14999999999999999;
-            coordinates[1993] = 0.050000000000000003;
-            coordinates[1994] = 0.14999999999999999;
-            coordinates[1995] = 0.14999999999999999;
-            coordinates[1996] = 0.14999999999999999;
-            coordinates[1997] = 0.050000000000000003;
-            coordinates[1998] = 0.25;
-            coordinates[1999] = 0.050000000000000003;
-            coordinates[2000] = 0.050000000000000003;
-            coordinates[2001] = 0.050000000000000003;
-            coordinates[2002] = 0.050000000000000003;
-            coordinates[2003] = 0.14999999999999999;
-            coordinates[2004] = 0.050000000000000003;
-            coordinates[2005] = 0.14999999999999999;
-            coordinates[2006] = 0.050000000000000003;
-            coordinates[2007] = 0.14999999999999999;
-            coordinates[2008] = 0.050000000000000003;
-            coordinates[2009] = 0.050000000000000003;
-            coordinates[2010] = 0.050000000000000003;
-            coordinates[2011] = 0.050000000000000003;
-            coordinates[2012] = 0.050000000000000003;
-            coordinates[2013] = 0.055555555555600003;
-            coordinates[2014] = 0.055555555555600003;
-            coordinates[2015] = 0.83333333333299997;
-            coordinates[2016] = 0.055555555555600003;
-            coordinates[2017] = 0.166666666667;
-            coordinates[2018] = 0.72222222222200005;
-            coordinates[2019] = 0.055555555555600003;
-            coordinates[2020] = 0.277777777778;
-            coordinates[2021] = 0.61111111111100003;
-            coordinates[2022] = 0.055555555555600003;
-            coordinates[2023] = 0.38888888888899997;
-            coordinates[2024] = 0.5;
-            coordinates[2025] = 0.055555555555600003;
-            coordinates[2026] = 0.5;
-            coordinates[2027] = 0.38888888888899997;
-            coordinates[2028] = 0.055555555555600003;
-            coordinates[2029] = 0.61111111111100003;
-            coordinates[2030] = 0.277777777778;
-            coordinates[2031] = 0.055555555555600003;
-            coordinates[2032] = 0.72222222222200005;
-            coordinates[2033] = 0.166666666667;
-            coordinates[2034] = 0.055555555555600003;
-            coordinates[2035] = 0.83333333333299997;
-            coordinates[2036] = 0.055555555555600003;
-            coordinates[2037] = 0.166666666667;
-            coordinates[2038] = 0.055555555555600003;
-            coordinates[2039] = 0.72222222222200005;
-            coordinates[2040] = 0.166666666667;
-            coordinates[2041] = 0.166666666667;
-            coordinates[2042] = 0.61111111111100003;
-            coordinates[2043] = 0.166666666667;
-            coordinates[2044] = 0.277777777778;
-            coordinates[2045] = 0.5;
-            coordinates[2046] = 0.166666666667;
-            coordinates[2047] = 0.38888888888899997;
-            coordinates[2048] = 0.38888888888899997;
-            coordinates[2049] = 0.166666666667;
-            coordinates[2050] = 0.5;
-            coordinates[2051] = 0.277777777778;
-            coordinates[2052] = 0.166666666667;
-            coordinates[2053] = 0.61111111111100003;
-            coordinates[2054] = 0.166666666667;
-            coordinates[2055] = 0.166666666667;
-            coordinates[2056] = 0.72222222222200005;
-            coordinates[2057] = 0.055555555555600003;
-            coordinates[2058] = 0.277777777778;
-            coordinates[2059] = 0.055555555555600003;
-            coordinates[2060] = 0.61111111111100003;
-            coordinates[2061] = 0.277777777778;
-            coordinates[2062] = 0.166666666667;
-            coordinates[2063] = 0.5;
-            coordinates[2064] = 0.277777777778;
-            coordinates[2065] = 0.277777777778;
-            coordinates[2066] = 0.38888888888899997;
-            coordinates[2067] = 0.277777777778;
-            coordinates[2068] = 0.38888888888899997;
-            coordinates[2069] = 0.277777777778;
-            coordinates[2070] = 0.277777777778;
-            coordinates[2071] = 0.5;
-            coordinates[2072] = 0.166666666667;
-            coordinates[2073] = 0.277777777778;
-            coordinates[2074] = 0.61111111111100003;
-            coordinates[2075] = 0.055555555555600003;
-            coordinates[2076] = 0.38888888888899997;
-            coordinates[2077] = 0.055555555555600003;
-            coordinates[2078] = 0.5;
-            coordinates[2079] = 0.38888888888899997;
-            coordinates[2080] = 0.166666666667;
-            coordinates[2081] = 0.38888888888899997;
-            coordinates[2082] = 0.38888888888899997;
-            coordinates[2083] = 0.277777777778;
-            coordinates[2084] = 0.277777777778;
-            coordinates[2085] = 0.38888888888899997;
-            coordinates[2086] = 0.38888888888899997;
-            coordinates[2087] = 0.166666666667;
-            coordinates[2088] = 0.38888888888899997;
-            coordinates[2089] = 0.5;
-            coordinates[2090] = 0.055555555555600003;
-            coordinates[2091] = 0.5;
-            coordinates[2092] = 0.055555555555600003;
-            coordinates[2093] = 0.38888888888899997;
-            coordinates[2094] = 0.5;
-            coordinates[2095] = 0.166666666667;
-            coordinates[2096] = 0.277777777778;
-            coordinates[2097] = 0.5;
-            coordinates[2098] = 0.277777777778;
-            coordinates[2099] = 0.166666666667;
-            coordinates[2100] = 0.5;
-            coordinates[2101] = 0.38888888888899997;
-            coordinates[2102] = 0.055555555555600003;
-            coordinates[2103] = 0.61111111111100003;
-            coordinates[2104] = 0.055555555555600003;
-            coordinates[2105] = 0.277777777778;
-            coordinates[2106] = 0.61111111111100003;
-            coordinates[2107] = 0.166666666667;
-            coordinates[2108] = 0.166666666667;
-            coordinates[2109] = 0.61111111111100003;
-            coordinates[2110] = 0.277777777778;
-            coordinates[2111] = 0.055555555555600003;
-            coordinates[2112] = 0.72222222222200005;
-            coordinates[2113] = 0.055555555555600003;
-            coordinates[2114] = 0.166666666667;
-            coordinates[2115] = 0.72222222222200005;
-            coordinates[2116] = 0.166666666667;
-            coordinates[2117] = 0.055555555555600003;
-            coordinates[2118] = 0.83333333333299997;
-            coordinates[2119] = 0.055555555555600003;
-            coordinates[2120] = 0.055555555555600003;
-            coordinates[2121] = 0.055555555555600003;
-            coordinates[2122] = 0.055555555555600003;
-            coordinates[2123] = 0.72222222222200005;
-            coordinates[2124] = 0.055555555555600003;
-            coordinates[2125] = 0.166666666667;
-            coordinates[2126] = 0.61111111111100003;
-            coordinates[2127] = 0.055555555555600003;
-            coordinates[2128] = 0.277777777778;
-            coordinates[2129] = 0.5;
-            coordinates[2130] = 0.055555555555600003;
-            coordinates[2131] = 0.38888888888899997;
-            coordinates[2132] = 0.38888888888899997;
-            coordinates[2133] = 0.055555555555600003;
-            coordinates[2134] = 0.5;
-            coordinates[2135] = 0.277777777778;
-            coordinates[2136] = 0.055555555555600003;
-            coordinates[2137] = 0.61111111111100003;
-            coordinates[2138] = 0.166666666667;
-            coordinates[2139] = 0.055555555555600003;
-            coordinates[2140] = 0.72222222222200005;
-            coordinates[2141] = 0.055555555555600003;
-            coordinates[2142] = 0.166666666667;
-            coordinates[2143] = 0.055555555555600003;
-            coordinates[2144] = 0.61111111111100003;
-            coordinates[2145] = 0.166666666667;
-            coordinates[2146] = 0.166666666667;
-            coordinates[2147] = 0.5;
-            coordinates[2148] = 0.166666666667;
-            coordinates[2149] = 0.277777777778;
-            coordinates[2150] = 0.38888888888899997;
-            coordinates[2151] = 0.166666666667;
-            coordinates[2152] = 0.38888888888899997;
-            coordinates[2153] = 0.277777777778;
-            coordinates[2154] = 0.166666666667;
-            coordinates[2155] = 0.5;
-            coordinates[2156] = 0.166666666667;
-            coordinates[2157] = 0.166666666667;
-            coordinates[2158] = 0.61111111111100003;
-            coordinates[2159] = 0.055555555555600003;
-            coordinates[2160] = 0.277777777778;
-            coordinates[2161] = 0.055555555555600003;
-            coordinates[2162] = 0.5;
-            coordinates[2163] = 0.277777777778;
-            coordinates[2164] = 0.166666666667;
-            coordinates[2165] = 0.38888888888899997;
-            coordinates[2166] = 0.277777777778;
-            coordinates[2167] = 0.277777777778;
-            coordinates[2168] = 0.277777777778;
-            coordinates[2169] = 0.277777777778;
-            coordinates[2170] = 0.38888888888899997;
-            coordinates[2171] = 0.166666666667;
-            coordinates[2172] = 0.277777777778;
-            coordinates[2173] = 0.5;
-            coordinates[2174] = 0.055555555555600003;
-            coordinates[2175] = 0.38888888888899997;
-            coordinates[2176] = 0.055555555555600003;
-            coordinates[2177] = 0.38888888888899997;
-            coordinates[2178] = 0.38888888888899997;
-            coordinates[2179] = 0.166666666667;
-            coordinates[2180] = 0.277777777778;
-            coordinates[2181] = 0.38888888888899997;
-            coordinates[2182] = 0.277777777778;
-            coordinates[2183] = 0.166666666667;
-            coordinates[2184] = 0.38888888888899997;
-            coordinates[2185] = 0.38888888888899997;
-            coordinates[2186] = 0.055555555555600003;
-            coordinates[2187] = 0.5;
-            coordinates[2188] = 0.055555555555600003;
-            coordinates[2189] = 0.277777777778;
-            coordinates[2190] = 0.5;
-            coordinates[2191] = 0.166666666667;
-            coordinates[2192] = 0.166666666667;
-            coordinates[2193] = 0.5;
-            coordinates[2194] = 0.277777777778;
-            coordinates[2195] = 0.055555555555600003;
-            coordinates[2196] = 0.61111111111100003;
-            coordinates[2197] = 0.055555555555600003;
-            coordinates[2198] = 0.166666666667;
-            coordinates[2199] = 0.61111111111100003;
-            coordinates[2200] = 0.166666666667;
-            coordinates[2201] = 0.055555555555600003;
-            coordinates[2202] = 0.72222222222200005;
-            coordinates[2203] = 0.055555555555600003;
-            coordinates[2204] = 0.055555555555600003;
-            coordinates[2205] = 0.055555555555600003;
-            coordinates[2206] = 0.055555555555600003;
-            coordinates[2207] = 0.61111111111100003;
-            coordinates[2208] = 0.055555555555600003;
-            coordinates[2209] = 0.166666666667;
-            coordinates[2210] = 0.5;
-            coordinates[2211] = 0.055555555555600003;
-            coordinates[2212] = 0.277777777778;
-            coordinates[2213] = 0.38888888888899997;
-            coordinates[2214] = 0.055555555555600003;
-            coordinates[2215] = 0.38888888888899997;
-            coordinates[2216] = 0.277777777778;
-            coordinates[2217] = 0.055555555555600003;
-            coordinates[2218] = 0.5;
-            coordinates[2219] = 0.166666666667;
-            coordinates[2220] = 0.055555555555600003;
-            coordinates[2221] = 0.61111111111100003;
-            coordinates[2222] = 0.055555555555600003;
-            coordinates[2223] = 0.166666666667;
-            coordinates[2224] = 0.055555555555600003;
-            coordinates[2225] = 0.5;
-            coordinates[2226] = 0.166666666667;
-            coordinates[2227] = 0.166666666667;
-            coordinates[2228] = 0.38888888888899997;
-            coordinates[2229] = 0.166666666667;
-            coordinates[2230] = 0.277777777778;
-            coordinates[2231] = 0.277777777778;
-            coordinates[2232] = 0.166666666667;
-            coordinates[2233] = 0.38888888888899997;
-            coordinates[2234] = 0.166666666667;
-            coordinates[2235] = 0.166666666667;
-            coordinates[2236] = 0.5;
-            coordinates[2237] = 0.055555555555600003;
-            coordinates[2238] = 0.277777777778;
-            coordinates[2239] = 0.055555555555600003;
-            coordinates[2240] = 0.38888888888899997;
-            coordinates[2241] = 0.277777777778;
-            coordinates[2242] = 0.166666666667;
-            coordinates[2243] = 0.277777777778;
-            coordinates[2244] = 0.277777777778;
-            coordinates[2245] = 0.277777777778;
-            coordinates[2246] = 0.166666666667;
-            coordinates[2247] = 0.277777777778;
-            coordinates[2248] = 0.38888888888899997;
-            coordinates[2249] = 0.055555555555600003;
-            coordinates[2250] = 0.38888888888899997;
-            coordinates[2251] = 0.055555555555600003;
-            coordinates[2252] = 0.277777777778;
-            coordinates[2253] = 0.38888888888899997;
-            coordinates[2254] = 0.166666666667;
-            coordinates[2255] = 0.166666666667;
-            coordinates[2256] = 0.38888888888899997;
-            coordinates[2257] = 0.277777777778;
-            coordinates[2258] = 0.055555555555600003;
-            coordinates[2259] = 0.5;
-            coordinates[2260] = 0.055555555555600003;
-            coordinates[2261] = 0.166666666667;
-            coordinates[2262] = 0.5;
-            coordinates[2263] = 0.166666666667;
-            coordinates[2264] = 0.055555555555600003;
-            coordinates[2265] = 0.61111111111100003;
-            coordinates[2266] = 0.055555555555600003;
-            coordinates[2267] = 0.055555555555600003;
-            coordinates[2268] = 0.055555555555600003;
-            coordinates[2269] = 0.055555555555600003;
-            coordinates[2270] = 0.5;
-            coordinates[2271] = 0.055555555555600003;
-            coordinates[2272] = 0.166666666667;
-            coordinates[2273] = 0.38888888888899997;
-            coordinates[2274] = 0.055555555555600003;
-            coordinates[2275] = 0.277777777778;
-            coordinates[2276] = 0.277777777778;
-            coordinates[2277] = 0.055555555555600003;
-            coordinates[2278] = 0.38888888888899997;
-            coordinates[2279] = 0.166666666667;
-            coordinates[2280] = 0.055555555555600003;
-            coordinates[2281] = 0.5;
-            coordinates[2282] = 0.055555555555600003;
-            coordinates[2283] = 0.166666666667;
-            coordinates[2284] = 0.055555555555600003;
-            coordinates[2285] = 0.38888888888899997;
-            coordinates[2286] = 0.166666666667;
-            coordinates[2287] = 0.166666666667;
-            coordinates[2288] = 0.277777777778;
-            coordinates[2289] = 0.166666666667;
-            coordinates[2290] = 0.277777777778;
-            coordinates[2291] = 0.166666666667;
-            coordinates[2292] = 0.166666666667;
-            coordinates[2293] = 0.38888888888899997;
-            coordinates[2294] = 0.055555555555600003;
-            coordinates[2295] = 0.277777777778;
-            coordinates[2296] = 0.055555555555600003;
-            coordinates[2297] = 0.277777777778;
-            coordinates[2298] = 0.277777777778;
-            coordinates[2299] = 0.166666666667;
-            coordinates[2300] = 0.166666666667;
-            coordinates[2301] = 0.277777777778;
-            coordinates[2302] = 0.277777777778;
-            coordinates[2303] = 0.055555555555600003;
-            coordinates[2304] = 0.38888888888899997;
-            coordinates[2305] = 0.055555555555600003;
-            coordinates[2306] = 0.166666666667;
-            coordinates[2307] = 0.38888888888899997;
-            coordinates[2308] = 0.166666666667;
-            coordinates[2309] = 0.055555555555600003;
-            coordinates[2310] = 0.5;
-            coordinates[2311] = 0.055555555555600003;
-            coordinates[2312] = 0.055555555555600003;
-            coordinates[2313] = 0.055555555555600003;
-            coordinates[2314] = 0.055555555555600003;
-            coordinates[2315] = 0.38888888888899997;
-            coordinates[2316] = 0.055555555555600003;
-            coordinates[2317] = 0.166666666667;
-            coordinates[2318] = 0.277777777778;
-            coordinates[2319] = 0.055555555555600003;
-            coordinates[2320] = 0.277777777778;
-            coordinates[2321] = 0.166666666667;
-            coordinates[2322] = 0.055555555555600003;
-            coordinates[2323] = 0.38888888888899997;
-            coordinates[2324] = 0.055555555555600003;
-            coordinates[2325] = 0.166666666667;
-            coordinates[2326] = 0.055555555555600003;
-            coordinates[2327] = 0.277777777778;
-            coordinates[2328] = 0.166666666667;
-            coordinates[2329] = 0.166666666667;
-            coordinates[2330] = 0.166666666667;
-            coordinates[2331] = 0.166666666667;
-            coordinates[2332] = 0.277777777778;
-            coordinates[2333] = 0.055555555555600003;
-            coordinates[2334] = 0.277777777778;
-            coordinates[2335] = 0.055555555555600003;
-            coordinates[2336] = 0.166666666667;
-            coordinates[2337] = 0.277777777778;
-            coordinates[2338] = 0.166666666667;
-            coordinates[2339] = 0.055555555555600003;
-            coordinates[2340] = 0.38888888888899997;
-            coordinates[2341] = 0.055555555555600003;
-            coordinates[2342] = 0.055555555555600003;
-            coordinates[2343] = 0.055555555555600003;
-            coordinates[2344] = 0.055555555555600003;
-            coordinates[2345] = 0.277777777778;
-            coordinates[2346] = 0.055555555555600003;
-            coordinates[2347] = 0.166666666667;
-            coordinates[2348] = 0.166666666667;
-            coordinates[2349] = 0.055555555555600003;
-            coordinates[2350] = 0.277777777778;
-            coordinates[2351] = 0.055555555555600003;
-            coordinates[2352] = 0.166666666667;
-            coordinates[2353] = 0.055555555555600003;
-            coordinates[2354] = 0.166666666667;
-            coordinates[2355] = 0.166666666667;
-            coordinates[2356] = 0.166666666667;
-            coordinates[2357] = 0.055555555555600003;
-            coordinates[2358] = 0.277777777778;
-            coordinates[2359] = 0.055555555555600003;
-            coordinates[2360] = 0.055555555555600003;
-            coordinates[2361] = 0.055555555555600003;
-            coordinates[2362] = 0.055555555555600003;
-            coordinates[2363] = 0.166666666667;
-            coordinates[2364] = 0.055555555555600003;
-            coordinates[2365] = 0.166666666667;
-            coordinates[2366] = 0.055555555555600003;
-            coordinates[2367] = 0.166666666667;
-            coordinates[2368] = 0.055555555555600003;
-            coordinates[2369] = 0.055555555555600003;
-            coordinates[2370] = 0.055555555555600003;
-            coordinates[2371] = 0.055555555555600003;
-            coordinates[2372] = 0.055555555555600003;
-            coordinates[2373] = 0.0625;
-            coordinates[2374] = 0.0625;
-            coordinates[2375] = 0.8125;
-            coordinates[2376] = 0.0625;
-            coordinates[2377] = 0.1875;
-            coordinates[2378] = 0.6875;
-            coordinates[2379] = 0.0625;
-            coordinates[2380] = 0.3125;
-            coordinates[2381] = 0.5625;
-            coordinates[2382] = 0.0625;
-            coordinates[2383] = 0.4375;
-            coordinates[2384] = 0.4375;
-            coordinates[2385] = 0.0625;
-            coordinates[2386] = 0.5625;
-            coordinates[2387] = 0.3125;
-            coordinates[2388] = 0.0625;
-            coordinates[2389] = 0.6875;
-            coordinates[2390] = 0.1875;
-            coordinates[2391] = 0.0625;
-            coordinates[2392] = 0.8125;
-            coordinates[2393] = 0.0625;
-            coordinates[2394] = 0.1875;
-            coordinates[2395] = 0.0625;
-            coordinates[2396] = 0.6875;
-            coordinates[2397] = 0.1875;
-            coordinates[2398] = 0.1875;
-            coordinates[2399] = 0.5625;
-            coordinates[2400] = 0.1875;
-            coordinates[2401] = 0.3125;
-            coordinates[2402] = 0.4375;
-            coordinates[2403] = 0.1875;
-            coordinates[2404] = 0.4375;
-            coordinates[2405] = 0.3125;
-            coordinates[2406] = 0.1875;
-            coordinates[2407] = 0.5625;
-            coordinates[2408] = 0.1875;
-            coordinates[2409] = 0.1875;
-            coordinates[2410] = 0.6875;
-            coordinates[2411] = 0.0625;
-            coordinates[2412] = 0.3125;
-            coordinates[2413] = 0.0625;
-            coordinates[2414] = 0.5625;
-            coordinates[2415] = 0.3125;
-            coordinates[2416] = 0.1875;
-            coordinates[2417] = 0.4375;
-            coordinates[2418] = 0.3125;
-            coordinates[2419] = 0.3125;
-            coordinates[2420] = 0.3125;
-            coordinates[2421] = 0.3125;
-            coordinates[2422] = 0.4375;
-            coordinates[2423] = 0.1875;
-            coordinates[2424] = 0.3125;
-            coordinates[2425] = 0.5625;
-            coordinates[2426] = 0.0625;
-            coordinates[2427] = 0.4375;
-            coordinates[2428] = 0.0625;
-            coordinates[2429] = 0.4375;
-            coordinates[2430] = 0.4375;
-            coordinates[2431] = 0.1875;
-            coordinates[2432] = 0.3125;
-            coordinates[2433] = 0.4375;
-            coordinates[2434] = 0.3125;
-            coordinates[2435] = 0.1875;
-            coordinates[2436] = 0.4375;
-            coordinates[2437] = 0.4375;
-            coordinates[2438] = 0.0625;
-            coordinates[2439] = 0.5625;
-            coordinates[2440] = 0.0625;
-            coordinates[2441] = 0.3125;
-            coordinates[2442] = 0.5625;
-            coordinates[2443] = 0.1875;
-            coordinates[2444] = 0.1875;
-            coordinates[2445] = 0.5625;
-            coordinates[2446] = 0.3125;
-            coordinates[2447] = 0.0625;
-            coordinates[2448] = 0.6875;
-            coordinates[2449] = 0.0625;
-            coordinates[2450] = 0.1875;
-            coordinates[2451] = 0.6875;
-            coordinates[2452] = 0.1875;
-            coordinates[2453] = 0.0625;
-            coordinates[2454] = 0.8125;
-            coordinates[2455] = 0.0625;
-            coordinates[2456] = 0.0625;
-            coordinates[2457] = 0.0625;
-            coordinates[2458] = 0.0625;
-            coordinates[2459] = 0.6875;
-            coordinates[2460] = 0.0625;
-            coordinates[2461] = 0.1875;
-            coordinates[2462] = 0.5625;
-            coordinates[2463] = 0.0625;
-            coordinates[2464] = 0.3125;
-            coordinates[2465] = 0.4375;
-            coordinates[2466] = 0.0625;
-            coordinates[2467] = 0.4375;
-            coordinates[2468] = 0.3125;
-            coordinates[2469] = 0.0625;
-            coordinates[2470] = 0.5625;
-            coordinates[2471] = 0.1875;
-            coordinates[2472] = 0.0625;
-            coordinates[2473] = 0.6875;
-            coordinates[2474] = 0.0625;
-            coordinates[2475] = 0.1875;
-            coordinates[2476] = 0.0625;
-            coordinates[2477] = 0.5625;
-            coordinates[2478] = 0.1875;
-            coordinates[2479] = 0.1875;
-            coordinates[2480] = 0.4375;
-            coordinates[2481] = 0.1875;
-            coordinates[2482] = 0.3125;
-            coordinates[2483] = 0.3125;
-            coordinates[2484] = 0.1875;
-            coordinates[2485] = 0.4375;
-            coordinates[2486] = 0.1875;
-            coordinates[2487] = 0.1875;
-            coordinates[2488] = 0.5625;
-            coordinates[2489] = 0.0625;
-            coordinates[2490] = 0.3125;
-            coordinates[2491] = 0.0625;
-            coordinates[2492] = 0.4375;
-            coordinates[2493] = 0.3125;
-            coordinates[2494] = 0.1875;
-            coordinates[2495] = 0.3125;
-            coordinates[2496] = 0.3125;
-            coordinates[2497] = 0.3125;
-            coordinates[2498] = 0.1875;
-            coordinates[2499] = 0.3125;
-            coordinates[2500] = 0.4375;
-            coordinates[2501] = 0.0625;
-            coordinates[2502] = 0.4375;
-            coordinates[2503] = 0.0625;
-            coordinates[2504] = 0.3125;
-            coordinates[2505] = 0.4375;
-            coordinates[2506] = 0.1875;
-            coordinates[2507] = 0.1875;
-            coordinates[2508] = 0.4375;
-            coordinates[2509] = 0.3125;
-            coordinates[2510] = 0.0625;
-            coordinates[2511] = 0.5625;
-            coordinates[2512] = 0.0625;
-            coordinates[2513] = 0.1875;
-            coordinates[2514] = 0.5625;
-            coordinates[2515] = 0.1875;
-            coordinates[2516] = 0.0625;
-            coordinates[2517] = 0.6875;
-            coordinates[2518] = 0.0625;
-            coordinates[2519] = 0.0625;
-            coordinates[2520] = 0.0625;
-            coordinates[2521] = 0.0625;
-            coordinates[2522] = 0.5625;
-            coordinates[2523] = 0.0625;
-            coordinates[2524] = 0.1875;
-            coordinates[2525] = 0.4375;
-            coordinates[2526] = 0.0625;
-            coordinates[2527] = 0.3125;
-            coordinates[2528] = 0.3125;
-            coordinates[2529] = 0.0625;
-            coordinates[2530] = 0.4375;
-            coordinates[2531] = 0.1875;
-            coordinates[2532] = 0.0625;
-            coordinates[2533] = 0.5625;
-            coordinates[2534] = 0.0625;
-            coordinates[2535] = 0.1875;
-            coordinates[2536] = 0.0625;
-            coordinates[2537] = 0.4375;
-            coordinates[2538] = 0.1875;
-            coordinates[2539] = 0.1875;
-            coordinates[2540] = 0.3125;
-            coordinates[2541] = 0.1875;
-            coordinates[2542] = 0.3125;
-            coordinates[2543] = 0.1875;
-            coordinates[2544] = 0.1875;
-            coordinates[2545] = 0.4375;
-            coordinates[2546] = 0.0625;
-            coordinates[2547] = 0.3125;
-            coordinates[2548] = 0.0625;
-            coordinates[2549] = 0.3125;
-            coordinates[2550] = 0.3125;
-            coordinates[2551] = 0.1875;
-            coordinates[2552] = 0.1875;
-            coordinates[2553] = 0.3125;
-            coordinates[2554] = 0.3125;
-            coordinates[2555] = 0.0625;
-            coordinates[2556] = 0.4375;
-            coordinates[2557] = 0.0625;
-            coordinates[2558] = 0.1875;
-            coordinates[2559] = 0.4375;
-            coordinates[2560] = 0.1875;
-            coordinates[2561] = 0.0625;
-            coordinates[2562] = 0.5625;
-            coordinates[2563] = 0.0625;
-            coordinates[2564] = 0.0625;
-            coordinates[2565] = 0.0625;
-            coordinates[2566] = 0.0625;
-            coordinates[2567] = 0.4375;
-            coordinates[2568] = 0.0625;
-            coordinates[2569] = 0.1875;
-            coordinates[2570] = 0.3125;
-            coordinates[2571] = 0.0625;
-            coordinates[2572] = 0.3125;
-            coordinates[2573] = 0.1875;
-            coordinates[2574] = 0.0625;
-            coordinates[2575] = 0.4375;
-            coordinates[2576] = 0.0625;
-            coordinates[2577] = 0.1875;
-            coordinates[2578] = 0.0625;
-            coordinates[2579] = 0.3125;
-            coordinates[2580] = 0.1875;
-            coordinates[2581] = 0.1875;
-            coordinates[2582] = 0.1875;
-            coordinates[2583] = 0.1875;
-            coordinates[2584] = 0.3125;
-            coordinates[2585] = 0.0625;
-            coordinates[2586] = 0.3125;
-            coordinates[2587] = 0.0625;
-            coordinates[2588] = 0.1875;
-            coordinates[2589] = 0.3125;
-            coordinates[2590] = 0.1875;
-            coordinates[2591] = 0.0625;
-            coordinates[2592] = 0.4375;
-            coordinates[2593] = 0.0625;
-            coordinates[2594] = 0.0625;
-            coordinates[2595] = 0.0625;
-            coordinates[2596] = 0.0625;
-            coordinates[2597] = 0.3125;
-            coordinates[2598] = 0.0625;
-            coordinates[2599] = 0.1875;
-            coordinates[2600] = 0.1875;
-            coordinates[2601] = 0.0625;
-            coordinates[2602] = 0.3125;
-            coordinates[2603] = 0.0625;
-            coordinates[2604] = 0.1875;
-            coordinates[2605] = 0.0625;
-            coordinates[2606] = 0.1875;
-            coordinates[2607] = 0.1875;
-            coordinates[2608] = 0.1875;
-            coordinates[2609] = 0.0625;
-            coordinates[2610] = 0.3125;
-            coordinates[2611] = 0.0625;
-            coordinates[2612] = 0.0625;
-            coordinates[2613] = 0.0625;
-            coordinates[2614] = 0.0625;
-            coordinates[2615] = 0.1875;
-            coordinates[2616] = 0.0625;
-            coordinates[2617] = 0.1875;
-            coordinates[2618] = 0.0625;
-            coordinates[2619] = 0.1875;
-            coordinates[2620] = 0.0625;
-            coordinates[2621] = 0.0625;
-            coordinates[2622] = 0.0625;
-            coordinates[2623] = 0.0625;
-            coordinates[2624] = 0.0625;
-            coordinates[2625] = 0.071428571428599999;
-            coordinates[2626] = 0.071428571428599999;
-            coordinates[2627] = 0.78571428571400004;
-            coordinates[2628] = 0.071428571428599999;
-            coordinates[2629] = 0.21428571428599999;
-            coordinates[2630] = 0.64285714285700002;
-            coordinates[2631] = 0.071428571428599999;
-            coordinates[2632] = 0.35714285714299998;
-            coordinates[2633] = 0.5;
-            coordinates[2634] = 0.071428571428599999;
-            coordinates[2635] = 0.5;
-            coordinates[2636] = 0.35714285714299998;
-            coordinates[2637] = 0.071428571428599999;
-            coordinates[2638] = 0.64285714285700002;
-            coordinates[2639] = 0.21428571428599999;
-            coordinates[2640] = 0.071428571428599999;
-            coordinates[2641] = 0.78571428571400004;
-            coordinates[2642] = 0.071428571428599999;
-            coordinates[2643] = 0.21428571428599999;
-            coordinates[2644] = 0.071428571428599999;
-            coordinates[2645] = 0.64285714285700002;
-            coordinates[2646] = 0.21428571428599999;
-            coordinates[2647] = 0.21428571428599999;
-            coordinates[2648] = 0.5;
-            coordinates[2649] = 0.21428571428599999;
-            coordinates[2650] = 0.35714285714299998;
-            coordinates[2651] = 0.35714285714299998;
-            coordinates[2652] = 0.21428571428599999;
-            coordinates[2653] = 0.5;
-            coordinates[2654] = 0.21428571428599999;
-            coordinates[2655] = 0.21428571428599999;
-            coordinates[2656] = 0.64285714285700002;
-            coordinates[2657] = 0.071428571428599999;
-            coordinates[2658] = 0.35714285714299998;
-            coordinates[2659] = 0.071428571428599999;
-            coordinates[2660] = 0.5;
-            coordinates[2661] = 0.35714285714299998;
-            coordinates[2662] = 0.21428571428599999;
-            coordinates[2663] = 0.35714285714299998;
-            coordinates[2664] = 0.35714285714299998;
-            coordinates[2665] = 0.35714285714299998;
-            coordinates[2666] = 0.21428571428599999;
-            coordinates[2667] = 0.35714285714299998;
-            coordinates[2668] = 0.5;
-            coordinates[2669] = 0.071428571428599999;
-            coordinates[2670] = 0.5;
-            coordinates[2671] = 0.071428571428599999;
-            coordinates[2672] = 0.35714285714299998;
-            coordinates[2673] = 0.5;
-            coordinates[2674] = 0.21428571428599999;
-            coordinates[2675] = 0.21428571428599999;
-            coordinates[2676] = 0.5;
-            coordinates[2677] = 0.35714285714299998;
-            coordinates[2678] = 0.071428571428599999;
-            coordinates[2679] = 0.64285714285700002;
-            coordinates[2680] = 0.071428571428599999;
-            coordinates[2681] = 0.21428571428599999;
-            coordinates[2682] = 0.64285714285700002;
-            coordinates[2683] = 0.21428571428599999;
-            coordinates[2684] = 0.071428571428599999;
-            coordinates[2685] = 0.78571428571400004;
-            coordinates[2686] = 0.071428571428599999;
-            coordinates[2687] = 0.071428571428599999;
-            coordinates[2688] = 0.071428571428599999;
-            coordinates[2689] = 0.071428571428599999;
-            coordinates[2690] = 0.64285714285700002;
-            coordinates[2691] = 0.071428571428599999;
-            coordinates[2692] = 0.21428571428599999;
-            coordinates[2693] = 0.5;
-            coordinates[2694] = 0.071428571428599999;
-            coordinates[2695] = 0.35714285714299998;
-            coordinates[2696] = 0.35714285714299998;
-            coordinates[2697] = 0.071428571428599999;
-            coordinates[2698] = 0.5;
-            coordinates[2699] = 0.21428571428599999;
-            coordinates[2700] = 0.071428571428599999;
-            coordinates[2701] = 0.64285714285700002;
-            coordinates[2702] = 0.071428571428599999;
-            coordinates[2703] = 0.21428571428599999;
-            coordinates[2704] = 0.071428571428599999;
-            coordinates[2705] = 0.5;
-            coordinates[2706] = 0.21428571428599999;
-            coordinates[2707] = 0.21428571428599999;
-            coordinates[2708] = 0.35714285714299998;
-            coordinates[2709] = 0.21428571428599999;
-            coordinates[2710] = 0.35714285714299998;
-            coordinates[2711] = 0.21428571428599999;
-            coordinates[2712] = 0.21428571428599999;
-            coordinates[2713] = 0.5;
-            coordinates[2714] = 0.071428571428599999;
-            coordinates[2715] = 0.35714285714299998;
-            coordinates[2716] = 0.071428571428599999;
-            coordinates[2717] = 0.35714285714299998;
-            coordinates[2718] = 0.35714285714299998;
-            coordinates[2719] = 0.21428571428599999;
-            coordinates[2720] = 0.21428571428599999;
-            coordinates[2721] = 0.35714285714299998;
-            coordinates[2722] = 0.35714285714299998;
-            coordinates[2723] = 0.071428571428599999;
-            coordinates[2724] = 0.5;
-            coordinates[2725] = 0.071428571428599999;
-            coordinates[2726] = 0.21428571428599999;
-            coordinates[2727] = 0.5;
-            coordinates[2728] = 0.21428571428599999;
-            coordinates[2729] = 0.071428571428599999;
-            coordinates[2730] = 0.64285714285700002;
-            coordinates[2731] = 0.071428571428599999;
-            coordinates[2732] = 0.071428571428599999;
-            coordinates[2733] = 0.071428571428599999;
-            coordinates[2734] = 0.071428571428599999;
-            coordinates[2735] = 0.5;
-            coordinates[2736] = 0.071428571428599999;
-            coordinates[2737] = 0.21428571428599999;
-            coordinates[2738] = 0.35714285714299998;
-            coordinates[2739] = 0.071428571428599999;
-            coordinates[2740] = 0.35714285714299998;
-            coordinates[2741] = 0.21428571428599999;
-            coordinates[2742] = 0.071428571428599999;
-            coordinates[2743] = 0.5;
-            coordinates[2744] = 0.071428571428599999;
-            coordinates[2745] = 0.21428571428599999;
-            coordinates[2746] = 0.071428571428599999;
-            coordinates[2747] = 0.35714285714299998;
-            coordinates[2748] = 0.21428571428599999;
-            coordinates[2749] = 0.21428571428599999;
-            coordinates[2750] = 0.21428571428599999;
-            coordinates[2751] = 0.21428571428599999;
-            coordinates[2752] = 0.35714285714299998;
-            coordinates[2753] = 0.071428571428599999;
-            coordinates[2754] = 0.35714285714299998;
-            coordinates[2755] = 0.071428571428599999;
-            coordinates[2756] = 0.21428571428599999;
-            coordinates[2757] = 0.35714285714299998;
-            coordinates[2758] = 0.21428571428599999;
-            coordinates[2759] = 0.071428571428599999;
-            coordinates[2760] = 0.5;
-            coordinates[2761] = 0.071428571428599999;
-            coordinates[2762] = 0.071428571428599999;
-            coordinates[2763] = 0.071428571428599999;
-            coordinates[2764] = 0.071428571428599999;
-            coordinates[2765] = 0.35714285714299998;
-            coordinates[2766] = 0.071428571428599999;
-            coordinates[2767] = 0.21428571428599999;
-            coordinates[2768] = 0.21428571428599999;
-            coordinates[2769] = 0.071428571428599999;
-            coordinates[2770] = 0.35714285714299998;
-            coordinates[2771] = 0.071428571428599999;
-            coordinates[2772] = 0.21428571428599999;
-            coordinates[2773] = 0.071428571428599999;
-            coordinates[2774] = 0.21428571428599999;
-            coordinates[2775] = 0.21428571428599999;
-            coordinates[2776] = 0.21428571428599999;
-            coordinates[2777] = 0.071428571428599999;
-            coordinates[2778] = 0.35714285714299998;
-            coordinates[2779] = 0.071428571428599999;
-            coordinates[2780] = 0.071428571428599999;
-            coordinates[2781] = 0.071428571428599999;
-            coordinates[2782] = 0.071428571428599999;
-            coordinates[2783] = 0.21428571428599999;
-            coordinates[2784] = 0.071428571428599999;
-            coordinates[2785] = 0.21428571428599999;
-            coordinates[2786] = 0.071428571428599999;
-            coordinates[2787] = 0.21428571428599999;
-            coordinates[2788] = 0.071428571428599999;
-            coordinates[2789] = 0.071428571428599999;
-            coordinates[2790] = 0.071428571428599999;
-            coordinates[2791] = 0.071428571428599999;
-            coordinates[2792] = 0.071428571428599999;
-            coordinates[2793] = 0.083333333333299994;
-            coordinates[2794] = 0.083333333333299994;
-            coordinates[2795] = 0.75;
-            coordinates[2796] = 0.083333333333299994;
-            coordinates[2797] = 0.25;
-            coordinates[2798] = 0.58333333333299997;
-            coordinates[2799] = 0.083333333333299994;
-            coordinates[2800] = 0.41666666666699997;
-            coordinates[2801] = 0.41666666666699997;
-            coordinates[2802] = 0.083333333333299994;
-            coordinates[2803] = 0.58333333333299997;
-            coordinates[2804] = 0.25;
-            coordinates[2805] = 0.083333333333299994;
-            coordinates[2806] = 0.75;
-            coordinates[2807] = 0.083333333333299994;
-            coordinates[2808] = 0.25;
-            coordinates[2809] = 0.083333333333299994;
-            coordinates[2810] = 0.58333333333299997;
-            coordinates[2811] = 0.25;
-            coordinates[2812] = 0.25;
-            coordinates[2813] = 0.41666666666699997;
-            coordinates[2814] = 0.25;
-            coordinates[2815] = 0.41666666666699997;
-            coordinates[2816] = 0.25;
-            coordinates[2817] = 0.25;
-            coordinates[2818] = 0.58333333333299997;
-            coordinates[2819] = 0.083333333333299994;
-            coordinates[2820] = 0.41666666666699997;
-            coordinates[2821] = 0.083333333333299994;
-            coordinates[2822] = 0.41666666666699997;
-            coordinates[2823] = 0.41666666666699997;
-            coordinates[2824] = 0.25;
-            coordinates[2825] = 0.25;
-            coordinates[2826] = 0.41666666666699997;
-            coordinates[2827] = 0.41666666666699997;
-            coordinates[2828] = 0.083333333333299994;
-            coordinates[2829] = 0.58333333333299997;
-            coordinates[2830] = 0.083333333333299994;
-            coordinates[2831] = 0.25;
-            coordinates[2832] = 0.58333333333299997;
-            coordinates[2833] = 0.25;
-            coordinates[2834] = 0.083333333333299994;
-            coordinates[2835] = 0.75;
-            coordinates[2836] = 0.083333333333299994;
-            coordinates[2837] = 0.083333333333299994;
-            coordinates[2838] = 0.083333333333299994;
-            coordinates[2839] = 0.083333333333299994;
-            coordinates[2840] = 0.58333333333299997;
-            coordinates[2841] = 0.083333333333299994;
-            coordinates[2842] = 0.25;
-            coordinates[2843] = 0.41666666666699997;
-            coordinates[2844] = 0.083333333333299994;
-            coordinates[2845] = 0.41666666666699997;
-            coordinates[2846] = 0.25;
-            coordinates[2847] = 0.083333333333299994;
-            coordinates[2848] = 0.58333333333299997;
-            coordinates[2849] = 0.083333333333299994;
-            coordinates[2850] = 0.25;
-            coordinates[2851] = 0.083333333333299994;
-            coordinates[2852] = 0.41666666666699997;
-            coordinates[2853] = 0.25;
-            coordinates[2854] = 0.25;
-            coordinates[2855] = 0.25;
-            coordinates[2856] = 0.25;
-            coordinates[2857] = 0.41666666666699997;
-            coordinates[2858] = 0.083333333333299994;
-            coordinates[2859] = 0.41666666666699997;
-            coordinates[2860] = 0.083333333333299994;
-            coordinates[2861] = 0.25;
-            coordinates[2862] = 0.41666666666699997;
-            coordinates[2863] = 0.25;
-            coordinates[2864] = 0.083333333333299994;
-            coordinates[2865] = 0.58333333333299997;
-            coordinates[2866] = 0.083333333333299994;
-            coordinates[2867] = 0.083333333333299994;
-            coordinates[2868] = 0.083333333333299994;
-            coordinates[2869] = 0.083333333333299994;
-            coordinates[2870] = 0.41666666666699997;
-            coordinates[2871] = 0.083333333333299994;
-            coordinates[2872] = 0.25;
-            coordinates[2873] = 0.25;
-            coordinates[2874] = 0.083333333333299994;
-            coordinates[2875] = 0.41666666666699997;
-            coordinates[2876] = 0.083333333333299994;
-            coordinates[2877] = 0.25;
-            coordinates[2878] = 0.083333333333299994;
-            coordinates[2879] = 0.25;
-            coordinates[2880] = 0.25;
-            coordinates[2881] = 0.25;
-            coordinates[2882] = 0.083333333333299994;
-            coordinates[2883] = 0.41666666666699997;
-            coordinates[2884] = 0.083333333333299994;
-            coordinates[2885] = 0.083333333333299994;
-            coordinates[2886] = 0.083333333333299994;
-            coordinates[2887] = 0.083333333333299994;
-            coordinates[2888] = 0.25;
-            coordinates[2889] = 0.083333333333299994;
-            coordinates[2890] = 0.25;
-            coordinates[2891] = 0.083333333333299994;
-            coordinates[2892] = 0.25;
-            coordinates[2893] = 0.083333333333299994;
-            coordinates[2894] = 0.083333333333299994;
-            coordinates[2895] = 0.083333333333299994;
-            coordinates[2896] = 0.083333333333299994;
-            coordinates[2897] = 0.083333333333299994;
-            coordinates[2898] = 0.10000000000000001;
-            coordinates[2899] = 0.10000000000000001;
-            coordinates[2900] = 0.69999999999999996;
-            coordinates[2901] = 0.10000000000000001;
-            coordinates[2902] = 0.29999999999999999;
-            coordinates[2903] = 0.5;
-            coordinates[2904] = 0.10000000000000001;
-            coordinates[2905] = 0.5;
-            coordinates[2906] = 0.29999999999999999;
-            coordinates[2907] = 0.10000000000000001;
-            coordinates[2908] = 0.69999999999999996;
-            coordinates[2909] = 0.10000000000000001;
-            coordinates[2910] = 0.29999999999999999;
-            coordinates[2911] = 0.10000000000000001;
-            coordinates[2912] = 0.5;
-            coordinates[2913] = 0.29999999999999999;
-            coordinates[2914] = 0.29999999999999999;
-            coordinates[2915] = 0.29999999999999999;
-            coordinates[2916] = 0.29999999999999999;
-            coordinates[2917] = 0.5;
-            coordinates[2918] = 0.10000000000000001;
-            coordinates[2919] = 0.5;
-            coordinates[2920] = 0.10000000000000001;
-            coordinates[2921] = 0.29999999999999999;
-            coordinates[2922] = 0.5;
-            coordinates[2923] = 0.29999999999999999;
-            coordinates[2924] = 0.10000000000000001;
-            coordinates[2925] = 0.69999999999999996;
-            coordinates[2926] = 0.10000000000000001;
-            coordinates[2927] = 0.10000000000000001;
-            coordinates[2928] = 0.10000000000000001;
-            coordinates[2929] = 0.10000000000000001;
-            coordinates[2930] = 0.5;
-            coordinates[2931] = 0.10000000000000001;
-            coordinates[2932] = 0.29999999999999999;
-            coordinates[2933] = 0.29999999999999999;
-            coordinates[2934] = 0.10000000000000001;
-            coordinates[2935] = 0.5;
-            coordinates[2936] = 0.10000000000000001;
-            coordinates[2937] = 0.29999999999999999;
-            coordinates[2938] = 0.10000000000000001;
-            coordinates[2939] = 0.29999999999999999;
-            coordinates[2940] = 0.29999999999999999;
-            coordinates[2941] = 0.29999999999999999;
-            coordinates[2942] = 0.10000000000000001;
-            coordinates[2943] = 0.5;
-            coordinates[2944] = 0.10000000000000001;
-            coordinates[2945] = 0.10000000000000001;
-            coordinates[2946] = 0.10000000000000001;
-            coordinates[2947] = 0.10000000000000001;
-            coordinates[2948] = 0.29999999999999999;
-            coordinates[2949] = 0.10000000000000001;
-            coordinates[2950] = 0.29999999999999999;
-            coordinates[2951] = 0.10000000000000001;
-            coordinates[2952] = 0.29999999999999999;
-            coordinates[2953] = 0.10000000000000001;
-            coordinates[2954] = 0.10000000000000001;
-            coordinates[2955] = 0.10000000000000001;
-            coordinates[2956] = 0.10000000000000001;
-            coordinates[2957] = 0.10000000000000001;
-            coordinates[2958] = 0.125;
-            coordinates[2959] = 0.125;
-            coordinates[2960] = 0.625;
-            coordinates[2961] = 0.125;
-            coordinates[2962] = 0.375;
-            coordinates[2963] = 0.375;
-            coordinates[2964] = 0.125;
-            coordinates[2965] = 0.625;
-            coordinates[2966] = 0.125;
-            coordinates[2967] = 0.375;
-            coordinates[2968] = 0.125;
-            coordinates[2969] = 0.375;
-            coordinates[2970] = 0.375;
-            coordinates[2971] = 0.375;
-            coordinates[2972] = 0.125;
-            coordinates[2973] = 0.625;
-            coordinates[2974] = 0.125;
-            coordinates[2975] = 0.125;
-            coordinates[2976] = 0.125;
-            coordinates[2977] = 0.125;
-            coordinates[2978] = 0.375;
-            coordinates[2979] = 0.125;
-            coordinates[2980] = 0.375;
-            coordinates[2981] = 0.125;
-            coordinates[2982] = 0.375;
-            coordinates[2983] = 0.125;
-            coordinates[2984] = 0.125;
-            coordinates[2985] = 0.125;
-            coordinates[2986] = 0.125;
-            coordinates[2987] = 0.125;
-            coordinates[2988] = 0.166666666667;
-            coordinates[2989] = 0.166666666667;
-            coordinates[2990] = 0.5;
-            coordinates[2991] = 0.166666666667;
-            coordinates[2992] = 0.5;
-            coordinates[2993] = 0.166666666667;
-            coordinates[2994] = 0.5;
-            coordinates[2995] = 0.166666666667;
-            coordinates[2996] = 0.166666666667;
-            coordinates[2997] = 0.166666666667;
-            coordinates[2998] = 0.166666666667;
-            coordinates[2999] = 0.166666666667;
-            coordinates[3000] = 0.25;
-            coordinates[3001] = 0.25;
-            coordinates[3002] = 0.25;
-
-            weights[0] = 0.14829636044149999;
-            weights[1] = 0.14829636044149999;
-            weights[2] = 0.14829636044149999;
-            weights[3] = 0.14829636044149999;
-            weights[4] = 0.14829636044149999;
-            weights[5] = 0.14829636044149999;
-            weights[6] = 0.14829636044149999;
-            weights[7] = 0.14829636044149999;
-            weights[8] = 0.14829636044149999;
-            weights[9] = 0.14829636044149999;
-            weights[10] = 0.14829636044149999;
-            weights[11] = 0.14829636044149999;
-            weights[12] = 0.14829636044149999;
-            weights[13] = 0.14829636044149999;
-            weights[14] = 0.14829636044149999;
-            weights[15] = 0.14829636044149999;
-            weights[16] = 0.14829636044149999;
-            weights[17] = 0.14829636044149999;
-            weights[18] = 0.14829636044149999;
-            weights[19] = 0.14829636044149999;
-            weights[20] = 0.14829636044149999;
-            weights[21] = 0.14829636044149999;
-            weights[22] = 0.14829636044149999;
-            weights[23] = 0.14829636044149999;
-            weights[24] = 0.14829636044149999;
-            weights[25] = 0.14829636044149999;
-            weights[26] = 0.14829636044149999;
-            weights[27] = 0.14829636044149999;
-            weights[28] = 0.14829636044149999;
-            weights[29] = 0.14829636044149999;
-            weights[30] = 0.14829636044149999;
-            weights[31] = 0.14829636044149999;
-            weights[32] = 0.14829636044149999;
-            weights[33] = 0.14829636044149999;
-            weights[34] = 0.14829636044149999;
-            weights[35] = 0.14829636044149999;
-            weights[36] = 0.14829636044149999;
-            weights[37] = 0.14829636044149999;
-            weights[38] = 0.14829636044149999;
-            weights[39] = 0.14829636044149999;
-            weights[40] = 0.14829636044149999;
-            weights[41] = 0.14829636044149999;
-            weights[42] = 0.14829636044149999;
-            weights[43] = 0.14829636044149999;
-            weights[44] = 0.14829636044149999;
-            weights[45] = 0.14829636044149999;
-            weights[46] = 0.14829636044149999;
-            weights[47] = 0.14829636044149999;
-            weights[48] = 0.14829636044149999;
-            weights[49] = 0.14829636044149999;
-            weights[50] = 0.14829636044149999;
-            weights[51] = 0.14829636044149999;
-            weights[52] = 0.14829636044149999;
-            weights[53] = 0.14829636044149999;
-            weights[54] = 0.14829636044149999;
-            weights[55] = 0.14829636044149999;
-            weights[56] = 0.14829636044149999;
-            weights[57] = 0.14829636044149999;
-            weights[58] = 0.14829636044149999;
-            weights[59] = 0.14829636044149999;
-            weights[60] = 0.14829636044149999;
-            weights[61] = 0.14829636044149999;
-            weights[62] = 0.14829636044149999;
-            weights[63] = 0.14829636044149999;
-            weights[64] = 0.14829636044149999;
-            weights[65] = 0.14829636044149999;
-            weights[66] = 0.14829636044149999;
-            weights[67] = 0.14829636044149999;
-            weights[68] = 0.14829636044149999;
-            weights[69] = 0.14829636044149999;
-            weights[70] = 0.14829636044149999;
-            weights[71] = 0.14829636044149999;
-            weights[72] = 0.14829636044149999;
-            weights[73] = 0.14829636044149999;
-            weights[74] = 0.14829636044149999;
-            weights[75] = 0.14829636044149999;
-            weights[76] = 0.14829636044149999;
-            weights[77] = 0.14829636044149999;
-            weights[78] = 0.14829636044149999;
-            weights[79] = 0.14829636044149999;
-            weights[80] = 0.14829636044149999;
-            weights[81] = 0.14829636044149999;
-            weights[82] = 0.14829636044149999;
-            weights[83] = 0.14829636044149999;
-            weights[84] = 0.14829636044149999;
-            weights[85] = 0.14829636044149999;
-            weights[86] = 0.14829636044149999;
-            weights[87] = 0.14829636044149999;
-            weights[88] = 0.14829636044149999;
-            weights[89] = 0.14829636044149999;
-            weights[90] = 0.14829636044149999;
-            weights[91] = 0.14829636044149999;
-            weights[92] = 0.14829636044149999;
-            weights[93] = 0.14829636044149999;
-            weights[94] = 0.14829636044149999;
-            weights[95] = 0.14829636044149999;
-            weights[96] = 0.14829636044149999;
-            weights[97] = 0.14829636044149999;
-            weights[98] = 0.14829636044149999;
-            weights[99] = 0.14829636044149999;
-            weights[100] = 0.14829636044149999;
-            weights[101] = 0.14829636044149999;
-            weights[102] = 0.14829636044149999;
-            weights[103] = 0.14829636044149999;
-            weights[104] = 0.14829636044149999;
-            weights[105] = 0.14829636044149999;
-            weights[106] = 0.14829636044149999;
-            weights[107] = 0.14829636044149999;
-            weights[108] = 0.14829636044149999;
-            weights[109] = 0.14829636044149999;
-            weights[110] = 0.14829636044149999;
-            weights[111] = 0.14829636044149999;
-            weights[112] = 0.14829636044149999;
-            weights[113] = 0.14829636044149999;
-            weights[114] = 0.14829636044149999;
-            weights[115] = 0.14829636044149999;
-            weights[116] = 0.14829636044149999;
-            weights[117] = 0.14829636044149999;
-            weights[118] = 0.14829636044149999;
-            weights[119] = 0.14829636044149999;
-            weights[120] = 0.14829636044149999;
-            weights[121] = 0.14829636044149999;
-            weights[122] = 0.14829636044149999;
-            weights[123] = 0.14829636044149999;
-            weights[124] = 0.14829636044149999;
-            weights[125] = 0.14829636044149999;
-            weights[126] = 0.14829636044149999;
-            weights[127] = 0.14829636044149999;
-            weights[128] = 0.14829636044149999;
-            weights[129] = 0.14829636044149999;
-            weights[130] = 0.14829636044149999;
-            weights[131] = 0.14829636044149999;
-            weights[132] = 0.14829636044149999;
-            weights[133] = 0.14829636044149999;
-            weights[134] = 0.14829636044149999;
-            weights[135] = 0.14829636044149999;
-            weights[136] = 0.14829636044149999;
-            weights[137] = 0.14829636044149999;
-            weights[138] = 0.14829636044149999;
-            weights[139] = 0.14829636044149999;
-            weights[140] = 0.14829636044149999;
-            weights[141] = 0.14829636044149999;
-            weights[142] = 0.14829636044149999;
-            weights[143] = 0.14829636044149999;
-            weights[144] = 0.14829636044149999;
-            weights[145] = 0.14829636044149999;
-            weights[146] = 0.14829636044149999;
-            weights[147] = 0.14829636044149999;
-            weights[148] = 0.14829636044149999;
-            weights[149] = 0.14829636044149999;
-            weights[150] = 0.14829636044149999;
-            weights[151] = 0.14829636044149999;
-            weights[152] = 0.14829636044149999;
-            weights[153] = 0.14829636044149999;
-            weights[154] = 0.14829636044149999;
-            weights[155] = 0.14829636044149999;
-            weights[156] = 0.14829636044149999;
-            weights[157] = 0.14829636044149999;
-            weights[158] = 0.14829636044149999;
-            weights[159] = 0.14829636044149999;
-            weights[160] = 0.14829636044149999;
-            weights[161] = 0.14829636044149999;
-            weights[162] = 0.14829636044149999;
-            weights[163] = 0.14829636044149999;
-            weights[164] = 0.14829636044149999;
-            weights[165] = 0.14829636044149999;
-            weights[166] = 0.14829636044149999;
-            weights[167] = 0.14829636044149999;
-            weights[168] = 0.14829636044149999;
-            weights[169] = 0.14829636044149999;
-            weights[170] = 0.14829636044149999;
-            weights[171] = 0.14829636044149999;
-            weights[172] = 0.14829636044149999;
-            weights[173] = 0.14829636044149999;
-            weights[174] = 0.14829636044149999;
-            weights[175] = 0.14829636044149999;
-            weights[176] = 0.14829636044149999;
-            weights[177] = 0.14829636044149999;
-            weights[178] = 0.14829636044149999;
-            weights[179] = 0.14829636044149999;
-            weights[180] = 0.14829636044149999;
-            weights[181] = 0.14829636044149999;
-            weights[182] = 0.14829636044149999;
-            weights[183] = 0.14829636044149999;
-            weights[184] = 0.14829636044149999;
-            weights[185] = 0.14829636044149999;
-            weights[186] = 0.14829636044149999;
-            weights[187] = 0.14829636044149999;
-            weights[188] = 0.14829636044149999;
-            weights[189] = 0.14829636044149999;
-            weights[190] = 0.14829636044149999;
-            weights[191] = 0.14829636044149999;
-            weights[192] = 0.14829636044149999;
-            weights[193] = 0.14829636044149999;
-            weights[194] = 0.14829636044149999;
-            weights[195] = 0.14829636044149999;
-            weights[196] = 0.14829636044149999;
-            weights[197] = 0.14829636044149999;
-            weights[198] = 0.14829636044149999;
-            weights[199] = 0.14829636044149999;
-            weights[200] = 0.14829636044149999;
-            weights[201] = 0.14829636044149999;
-            weights[202] = 0.14829636044149999;
-            weights[203] = 0.14829636044149999;
-            weights[204] = 0.14829636044149999;
-            weights[205] = 0.14829636044149999;
-            weights[206] = 0.14829636044149999;
-            weights[207] = 0.14829636044149999;
-            weights[208] = 0.14829636044149999;
-            weights[209] = 0.14829636044149999;
-            weights[210] = 0.14829636044149999;
-            weights[211] = 0.14829636044149999;
-            weights[212] = 0.14829636044149999;
-            weights[213] = 0.14829636044149999;
-            weights[214] = 0.14829636044149999;
-            weights[215] = 0.14829636044149999;
-            weights[216] = 0.14829636044149999;
-            weights[217] = 0.14829636044149999;
-            weights[218] = 0.14829636044149999;
-            weights[219] = 0.14829636044149999;
-            weights[220] = 0.14829636044149999;
-            weights[221] = 0.14829636044149999;
-            weights[222] = 0.14829636044149999;
-            weights[223] = 0.14829636044149999;
-            weights[224] = 0.14829636044149999;
-            weights[225] = 0.14829636044149999;
-            weights[226] = 0.14829636044149999;
-            weights[227] = 0.14829636044149999;
-            weights[228] = 0.14829636044149999;
-            weights[229] = 0.14829636044149999;
-            weights[230] = 0.14829636044149999;
-            weights[231] = 0.14829636044149999;
-            weights[232] = 0.14829636044149999;
-            weights[233] = 0.14829636044149999;
-            weights[234] = 0.14829636044149999;
-            weights[235] = 0.14829636044149999;
-            weights[236] = 0.14829636044149999;
-            weights[237] = 0.14829636044149999;
-            weights[238] = 0.14829636044149999;
-            weights[239] = 0.14829636044149999;
-            weights[240] = 0.14829636044149999;
-            weights[241] = 0.14829636044149999;
-            weights[242] = 0.14829636044149999;
-            weights[243] = 0.14829636044149999;
-            weights[244] = 0.14829636044149999;
-            weights[245] = 0.14829636044149999;
-            weights[246] = 0.14829636044149999;
-            weights[247] = 0.14829636044149999;
-            weights[248] = 0.14829636044149999;
-            weights[249] = 0.14829636044149999;
-            weights[250] = 0.14829636044149999;
-            weights[251] = 0.14829636044149999;
-            weights[252] = 0.14829636044149999;
-            weights[253] = 0.14829636044149999;
-            weights[254] = 0.14829636044149999;
-            weights[255] = 0.14829636044149999;
-            weights[256] = 0.14829636044149999;
-            weights[257] = 0.14829636044149999;
-            weights[258] = 0.14829636044149999;
-            weights[259] = 0.14829636044149999;
-            weights[260] = 0.14829636044149999;
-            weights[261] = 0.14829636044149999;
-            weights[262] = 0.14829636044149999;
-            weights[263] = 0.14829636044149999;
-            weights[264] = 0.14829636044149999;
-            weights[265] = 0.14829636044149999;
-            weights[266] = 0.14829636044149999;
-            weights[267] = 0.14829636044149999;
-            weights[268] = 0.14829636044149999;
-            weights[269] = 0.14829636044149999;
-            weights[270] = 0.14829636044149999;
-            weights[271] = 0.14829636044149999;
-            weights[272] = 0.14829636044149999;
-            weights[273] = 0.14829636044149999;
-            weights[274] = 0.14829636044149999;
-            weights[275] = 0.14829636044149999;
-            weights[276] = 0.14829636044149999;
-            weights[277] = 0.14829636044149999;
-            weights[278] = 0.14829636044149999;
-            weights[279] = 0.14829636044149999;
-            weights[280] = 0.14829636044149999;
-            weights[281] = 0.14829636044149999;
-            weights[282] = 0.14829636044149999;
-            weights[283] = 0.14829636044149999;
-            weights[284] = 0.14829636044149999;
-            weights[285] = 0.14829636044149999;
-            weights[286] = -0.572508521791667;
-            weights[287] = -0.572508521791667;
-            weights[288] = -0.572508521791667;
-            weights[289] = -0.572508521791667;
-            weights[290] = -0.572508521791667;
-            weights[291] = -0.572508521791667;
-            weights[292] = -0.572508521791667;
-            weights[293] = -0.572508521791667;
-            weights[294] = -0.572508521791667;
-            weights[295] = -0.572508521791667;
-            weights[296] = -0.572508521791667;
-            weights[297] = -0.572508521791667;
-            weights[298] = -0.572508521791667;
-            weights[299] = -0.572508521791667;
-            weights[300] = -0.572508521791667;
-            weights[301] = -0.572508521791667;
-            weights[302] = -0.572508521791667;
-            weights[303] = -0.572508521791667;
-            weights[304] = -0.572508521791667;
-            weights[305] = -0.572508521791667;
-            weights[306] = -0.572508521791667;
-            weights[307] = -0.572508521791667;
-            weights[308] = -0.572508521791667;
-            weights[309] = -0.572508521791667;
-            weights[310] = -0.572508521791667;
-            weights[311] = -0.572508521791667;
-            weights[312] = -0.572508521791667;
-            weights[313] = -0.572508521791667;
-            weights[314] = -0.572508521791667;
-            weights[315] = -0.572508521791667;
-            weights[316] = -0.572508521791667;
-            weights[317] = -0.572508521791667;
-            weights[318] = -0.572508521791667;
-            weights[319] = -0.572508521791667;
-            weights[320] = -0.572508521791667;
-            weights[321] = -0.572508521791667;
-            weights[322] = -0.572508521791667;
-            weights[323] = -0.572508521791667;
-            weights[324] = -0.572508521791667;
-            weights[325] = -0.572508521791667;
-            weights[326] = -0.572508521791667;
-            weights[327] = -0.572508521791667;
-            weights[328] = -0.572508521791667;
-            weights[329] = -0.572508521791667;
-            weights[330] = -0.572508521791667;
-            weights[331] = -0.572508521791667;
-            weights[332] = -0.572508521791667;
-            weights[333] = -0.572508521791667;
-            weights[334] = -0.572508521791667;
-            weights[335] = -0.572508521791667;
-            weights[336] = -0.572508521791667;
-            weights[337] = -0.572508521791667;
-            weights[338] = -0.572508521791667;
-            weights[339] = -0.572508521791667;
-            weights[340] = -0.572508521791667;
-            weights[341] = -0.572508521791667;
-            weights[342] = -0.572508521791667;
-            weights[343] = -0.572508521791667;
-            weights[344] = -0.572508521791667;
-            weights[345] = -0.572508521791667;
-            weights[346] = -0.572508521791667;
-            weights[347] = -0.572508521791667;
-            weights[348] = -0.572508521791667;
-            weights[349] = -0.572508521791667;
-            weights[350] = -0.572508521791667;
-            weights[351] = -0.572508521791667;
-            weights[352] = -0.572508521791667;
-            weights[353] = -0.572508521791667;
-            weights[354] = -0.572508521791667;
-            weights[355] = -0.572508521791667;
-            weights[356] = -0.572508521791667;
-            weights[357] = -0.572508521791667;
-            weights[358] = -0.572508521791667;
-            weights[359] = -0.572508521791667;
-            weights[360] = -0.572508521791667;
-            weights[361] = -0.572508521791667;
-            weights[362] = -0.572508521791667;
-            weights[363] = -0.572508521791667;
-            weights[364] = -0.572508521791667;
-            weights[365] = -0.572508521791667;
-            weights[366] = -0.572508521791667;
-            weights[367] = -0.572508521791667;
-            weights[368] = -0.572508521791667;
-            weights[369] = -0.572508521791667;
-            weights[370] = -0.572508521791667;
-            weights[371] = -0.572508521791667;
-            weights[372] = -0.572508521791667;
-            weights[373] = -0.572508521791667;
-            weights[374] = -0.572508521791667;
-            weights[375] = -0.572508521791667;
-            weights[376] = -0.572508521791667;
-            weights[377] = -0.572508521791667;
-            weights[378] = -0.572508521791667;
-            weights[379] = -0.572508521791667;
-            weights[380] = -0.572508521791667;
-            weights[381] = -0.572508521791667;
-            weights[382] = -0.572508521791667;
-            weights[383] = -0.572508521791667;
-            weights[384] = -0.572508521791667;
-            weights[385] = -0.572508521791667;
-            weights[386] = -0.572508521791667;
-            weights[387] = -0.572508521791667;
-            weights[388] = -0.572508521791667;
-            weights[389] = -0.572508521791667;
-            weights[390] = -0.572508521791667;
-            weights[391] = -0.572508521791667;
-            weights[392] = -0.572508521791667;
-            weights[393] = -0.572508521791667;
-            weights[394] = -0.572508521791667;
-            weights[395] = -0.572508521791667;
-            weights[396] = -0.572508521791667;
-            weights[397] = -0.572508521791667;
-            weights[398] = -0.572508521791667;
-            weights[399] = -0.572508521791667;
-            weights[400] = -0.572508521791667;
-            weights[401] = -0.572508521791667;
-            weights[402] = -0.572508521791667;
-            weights[403] = -0.572508521791667;
-            weights[404] = -0.572508521791667;
-            weights[405] = -0.572508521791667;
-            weights[406] = -0.572508521791667;
-            weights[407] = -0.572508521791667;
-            weights[408] = -0.572508521791667;
-            weights[409] = -0.572508521791667;
-            weights[410] = -0.572508521791667;
-            weights[411] = -0.572508521791667;
-            weights[412] = -0.572508521791667;
-            weights[413] = -0.572508521791667;
-            weights[414] = -0.572508521791667;
-            weights[415] = -0.572508521791667;
-            weights[416] = -0.572508521791667;
-            weights[417] = -0.572508521791667;
-            weights[418] = -0.572508521791667;
-            weights[419] = -0.572508521791667;
-            weights[420] = -0.572508521791667;
-            weights[421] = -0.572508521791667;
-            weights[422] = -0.572508521791667;
-            weights[423] = -0.572508521791667;
-            weights[424] = -0.572508521791667;
-            weights[425] = -0.572508521791667;
-            weights[426] = -0.572508521791667;
-            weights[427] = -0.572508521791667;
-            weights[428] = -0.572508521791667;
-            weights[429] = -0.572508521791667;
-            weights[430] = -0.572508521791667;
-            weights[431] = -0.572508521791667;
-            weights[432] = -0.572508521791667;
-            weights[433] = -0.572508521791667;
-            weights[434] = -0.572508521791667;
-            weights[435] = -0.572508521791667;
-            weights[436] = -0.572508521791667;
-            weights[437] = -0.572508521791667;
-            weights[438] = -0.572508521791667;
-            weights[439] = -0.572508521791667;
-            weights[440] = -0.572508521791667;
-            weights[441] = -0.572508521791667;
-            weights[442] = -0.572508521791667;
-            weights[443] = -0.572508521791667;
-            weights[444] = -0.572508521791667;
-            weights[445] = -0.572508521791667;
-            weights[446] = -0.572508521791667;
-            weights[447] = -0.572508521791667;
-            weights[448] = -0.572508521791667;
-            weights[449] = -0.572508521791667;
-            weights[450] = -0.572508521791667;
-            weights[451] = -0.572508521791667;
-            weights[452] = -0.572508521791667;
-            weights[453] = -0.572508521791667;
-            weights[454] = -0.572508521791667;
-            weights[455] = -0.572508521791667;
-            weights[456] = -0.572508521791667;
-            weights[457] = -0.572508521791667;
-            weights[458] = -0.572508521791667;
-            weights[459] = -0.572508521791667;
-            weights[460] = -0.572508521791667;
-            weights[461] = -0.572508521791667;
-            weights[462] = -0.572508521791667;
-            weights[463] = -0.572508521791667;
-            weights[464] = -0.572508521791667;
-            weights[465] = -0.572508521791667;
-            weights[466] = -0.572508521791667;
-            weights[467] = -0.572508521791667;
-            weights[468] = -0.572508521791667;
-            weights[469] = -0.572508521791667;
-            weights[470] = -0.572508521791667;
-            weights[471] = -0.572508521791667;
-            weights[472] = -0.572508521791667;
-            weights[473] = -0.572508521791667;
-            weights[474] = -0.572508521791667;
-            weights[475] = -0.572508521791667;
-            weights[476] = -0.572508521791667;
-            weights[477] = -0.572508521791667;
-            weights[478] = -0.572508521791667;
-            weights[479] = -0.572508521791667;
-            weights[480] = -0.572508521791667;
-            weights[481] = -0.572508521791667;
-            weights[482] = -0.572508521791667;
-            weights[483] = -0.572508521791667;
-            weights[484] = -0.572508521791667;
-            weights[485] = -0.572508521791667;
-            weights[486] = -0.572508521791667;
-            weights[487] = -0.572508521791667;
-            weights[488] = -0.572508521791667;
-            weights[489] = -0.572508521791667;
-            weights[490] = -0.572508521791667;
-            weights[491] = -0.572508521791667;
-            weights[492] = -0.572508521791667;
-            weights[493] = -0.572508521791667;
-            weights[494] = -0.572508521791667;
-            weights[495] = -0.572508521791667;
-            weights[496] = -0.572508521791667;
-            weights[497] = -0.572508521791667;
-            weights[498] = -0.572508521791667;
-            weights[499] = -0.572508521791667;
-            weights[500] = -0.572508521791667;
-            weights[501] = -0.572508521791667;
-            weights[502] = -0.572508521791667;
-            weights[503] = -0.572508521791667;
-            weights[504] = -0.572508521791667;
-            weights[505] = -0.572508521791667;
-            weights[506] = 0.88967913924499997;
-            weights[507] = 0.88967913924499997;
-            weights[508] = 0.88967913924499997;
-            weights[509] = 0.88967913924499997;
-            weights[510] = 0.88967913924499997;
-            weights[511] = 0.88967913924499997;
-            weights[512] = 0.88967913924499997;
-            weights[513] = 0.88967913924499997;
-            weights[514] = 0.88967913924499997;
-            weights[515] = 0.88967913924499997;
-            weights[516] = 0.88967913924499997;
-            weights[517] = 0.88967913924499997;
-            weights[518] = 0.88967913924499997;
-            weights[519] = 0.88967913924499997;
-            weights[520] = 0.88967913924499997;
-            weights[521] = 0.88967913924499997;
-            weights[522] = 0.88967913924499997;
-            weights[523] = 0.88967913924499997;
-            weights[524] = 0.88967913924499997;
-            weights[525] = 0.88967913924499997;
-            weights[526] = 0.88967913924499997;
-            weights[527] = 0.88967913924499997;
-            weights[528] = 0.88967913924499997;
-            weights[529] = 0.88967913924499997;
-            weights[530] = 0.88967913924499997;
-            weights[531] = 0.88967913924499997;
-            weights[532] = 0.88967913924499997;
-            weights[533] = 0.88967913924499997;
-            weights[534] = 0.88967913924499997;
-            weights[535] = 0.88967913924499997;
-            weights[536] = 0.88967913924499997;
-            weights[537] = 0.88967913924499997;
-            weights[538] = 0.88967913924499997;
-            weights[539] = 0.88967913924499997;
-            weights[540] = 0.88967913924499997;
-            weights[541] = 0.88967913924499997;
-            weights[542] = 0.88967913924499997;
-            weights[543] = 0.88967913924499997;
-            weights[544] = 0.88967913924499997;
-            weights[545] = 0.88967913924499997;
-            weights[546] = 0.88967913924499997;
-            weights[547] = 0.88967913924499997;
-            weights[548] = 0.88967913924499997;
-            weights[549] = 0.88967913924499997;
-            weights[550] = 0.88967913924499997;
-            weights[551] = 0.88967913924499997;
-            weights[552] = 0.88967913924499997;
-            weights[553] = 0.88967913924499997;
-            weights[554] = 0.88967913924499997;
-            weights[555] = 0.88967913924499997;
-            weights[556] = 0.88967913924499997;
-            weights[557] = 0.88967913924499997;
-            weights[558] = 0.88967913924499997;
-            weights[559] = 0.88967913924499997;
-            weights[560] = 0.88967913924499997;
-            weights[561] = 0.88967913924499997;
-            weights[562] = 0.88967913924499997;
-            weights[563] = 0.88967913924499997;
-            weights[564] = 0.88967913924499997;
-            weights[565] = 0.88967913924499997;
-            weights[566] = 0.88967913924499997;
-            weights[567] = 0.88967913924499997;
-            weights[568] = 0.88967913924499997;
-            weights[569] = 0.88967913924499997;
-            weights[570] = 0.88967913924499997;
-            weights[571] = 0.88967913924499997;
-            weights[572] = 0.88967913924499997;
-            weights[573] = 0.88967913924499997;
-            weights[574] = 0.88967913924499997;
-            weights[575] = 0.88967913924499997;
-            weights[576] = 0.88967913924499997;
-            weights[577] = 0.88967913924499997;
-            weights[578] = 0.88967913924499997;
-            weights[579] = 0.88967913924499997;
-            weights[580] = 0.88967913924499997;
-            weights[581] = 0.88967913924499997;
-            weights[582] = 0.88967913924499997;
-            weights[583] = 0.88967913924499997;
-            weights[584] = 0.88967913924499997;
-            weights[585] = 0.88967913924499997;
-            weights[586] = 0.88967913924499997;
-            weights[587] = 0.88967913924499997;
-            weights[588] = 0.88967913924499997;
-            weights[589] = 0.88967913924499997;
-            weights[590] = 0.88967913924499997;
-            weights[591] = 0.88967913924499997;
-            weights[592] = 0.88967913924499997;
-            weights[593] = 0.88967913924499997;
-            weights[594] = 0.88967913924499997;
-            weights[595] = 0.88967913924499997;
-            weights[596] = 0.88967913924499997;
-            weights[597] = 0.88967913924499997;
-            weights[598] = 0.88967913924499997;
-            weights[599] = 0.88967913924499997;
-            weights[600] = 0.88967913924499997;
-            weights[601] = 0.88967913924499997;
-            weights[602] = 0.88967913924499997;
-            weights[603] = 0.88967913924499997;
-            weights[604] = 0.88967913924499997;
-            weights[605] = 0.88967913924499997;
-            weights[606] = 0.88967913924499997;
-            weights[607] = 0.88967913924499997;
-            weights[608] = 0.88967913924499997;
-            weights[609] = 0.88967913924499997;
-            weights[610] = 0.88967913924499997;
-            weights[611] = 0.88967913924499997;
-            weights[612] = 0.88967913924499997;
-            weights[613] = 0.88967913924499997;
-            weights[614] = 0.88967913924499997;
-            weights[615] = 0.88967913924499997;
-            weights[616] = 0.88967913924499997;
-            weights[617] = 0.88967913924499997;
-            weights[618] = 0.88967913924499997;
-            weights[619] = 0.88967913924499997;
-            weights[620] = 0.88967913924499997;
-            weights[621] = 0.88967913924499997;
-            weights[622] = 0.88967913924499997;
-            weights[623] = 0.88967913924499997;
-            weights[624] = 0.88967913924499997;
-            weights[625] = 0.88967913924499997;
-            weights[626] = 0.88967913924499997;
-            weights[627] = 0.88967913924499997;
-            weights[628] = 0.88967913924499997;
-            weights[629] = 0.88967913924499997;
-            weights[630] = 0.88967913924499997;
-            weights[631] = 0.88967913924499997;
-            weights[632] = 0.88967913924499997;
-            weights[633] = 0.88967913924499997;
-            weights[634] = 0.88967913924499997;
-            weights[635] = 0.88967913924499997;
-            weights[636] = 0.88967913924499997;
-            weights[637] = 0.88967913924499997;
-            weights[638] = 0.88967913924499997;
-            weights[639] = 0.88967913924499997;
-            weights[640] = 0.88967913924499997;
-            weights[641] = 0.88967913924499997;
-            weights[642] = 0.88967913924499997;
-            weights[643] = 0.88967913924499997;
-            weights[644] = 0.88967913924499997;
-            weights[645] = 0.88967913924499997;
-            weights[646] = 0.88967913924499997;
-            weights[647] = 0.88967913924499997;
-            weights[648] = 0.88967913924499997;
-            weights[649] = 0.88967913924499997;
-            weights[650] = 0.88967913924499997;
-            weights[651] = 0.88967913924499997;
-            weights[652] = 0.88967913924499997;
-            weights[653] = 0.88967913924499997;
-            weights[654] = 0.88967913924499997;
-            weights[655] = 0.88967913924499997;
-            weights[656] = 0.88967913924499997;
-            weights[657] = 0.88967913924499997;
-            weights[658] = 0.88967913924499997;
-            weights[659] = 0.88967913924499997;
-            weights[660] = 0.88967913924499997;
-            weights[661] = 0.88967913924499997;
-            weights[662] = 0.88967913924499997;
-            weights[663] = 0.88967913924499997;
-            weights[664] = 0.88967913924499997;
-            weights[665] = 0.88967913924499997;
-            weights[666] = 0.88967913924499997;
-            weights[667] = 0.88967913924499997;
-            weights[668] = 0.88967913924499997;
-            weights[669] = 0.88967913924499997;
-            weights[670] = 0.88967913924499997;
-            weights[671] = -0.71388380849499999;
-            weights[672] = -0.71388380849499999;
-            weights[673] = -0.71388380849499999;
-            weights[674] = -0.71388380849499999;
-            weights[675] = -0.71388380849499999;
-            weights[676] = -0.71388380849499999;
-            weights[677] = -0.71388380849499999;
-            weights[678] = -0.71388380849499999;
-            weights[679] = -0.71388380849499999;
-            weights[680] = -0.71388380849499999;
-            weights[681] = -0.71388380849499999;
-            weights[682] = -0.71388380849499999;
-            weights[683] = -0.71388380849499999;
-            weights[684] = -0.71388380849499999;
-            weights[685] = -0.71388380849499999;
-            weights[686] = -0.71388380849499999;
-            weights[687] = -0.71388380849499999;
-            weights[688] = -0.71388380849499999;
-            weights[689] = -0.71388380849499999;
-            weights[690] = -0.71388380849499999;
-            weights[691] = -0.71388380849499999;
-            weights[692] = -0.71388380849499999;
-            weights[693] = -0.71388380849499999;
-            weights[694] = -0.71388380849499999;
-            weights[695] = -0.71388380849499999;
-            weights[696] = -0.71388380849499999;
-            weights[697] = -0.71388380849499999;
-            weights[698] = -0.71388380849499999;
-            weights[699] = -0.71388380849499999;
-            weights[700] = -0.71388380849499999;
-            weights[701] = -0.71388380849499999;
-            weights[702] = -0.71388380849499999;
-            weights[703] = -0.71388380849499999;
-            weights[704] = -0.71388380849499999;
-            weights[705] = -0.71388380849499999;
-            weights[706] = -0.71388380849499999;
-            weights[707] = -0.71388380849499999;
-            weights[708] = -0.71388380849499999;
-            weights[709] = -0.71388380849499999;
-            weights[710] = -0.71388380849499999;
-            weights[711] = -0.71388380849499999;
-            weights[712] = -0.71388380849499999;
-            weights[713] = -0.71388380849499999;
-            weights[714] = -0.71388380849499999;
-            weights[715] = -0.71388380849499999;
-            weights[716] = -0.71388380849499999;
-            weights[717] = -0.71388380849499999;
-            weights[718] = -0.71388380849499999;
-            weights[719] = -0.71388380849499999;
-            weights[720] = -0.71388380849499999;
-            weights[721] = -0.71388380849499999;
-            weights[722] = -0.71388380849499999;
-            weights[723] = -0.71388380849499999;
-            weights[724] = -0.71388380849499999;
-            weights[725] = -0.71388380849499999;
-            weights[726] = -0.71388380849499999;
-            weights[727] = -0.71388380849499999;
-            weights[728] = -0.71388380849499999;
-            weights[729] = -0.71388380849499999;
-            weights[730] = -0.71388380849499999;
-            weights[731] = -0.71388380849499999;
-            weights[732] = -0.71388380849499999;
-            weights[733] = -0.71388380849499999;
-            weights[734] = -0.71388380849499999;
-            weights[735] = -0.71388380849499999;
-            weights[736] = -0.71388380849499999;
-            weights[737] = -0.71388380849499999;
-            weights[738] = -0.71388380849499999;
-            weights[739] = -0.71388380849499999;
-            weights[740] = -0.71388380849499999;
-            weights[741] = -0.71388380849499999;
-            weights[742] = -0.71388380849499999;
-            weights[743] = -0.71388380849499999;
-            weights[744] = -0.71388380849499999;
-            weights[745] = -0.71388380849499999;
-            weights[746] = -0.71388380849499999;
-            weights[747] = -0.71388380849499999;
-            weights[748] = -0.71388380849499999;
-            weights[749] = -0.71388380849499999;
-            weights[750] = -0.71388380849499999;
-            weights[751] = -0.71388380849499999;
-            weights[752] = -0.71388380849499999;
-            weights[753] = -0.71388380849499999;
-            weights[754] = -0.71388380849499999;
-            weights[755] = -0.71388380849499999;
-            weights[756] = -0.71388380849499999;
-            weights[757] = -0.71388380849499999;
-            weights[758] = -0.71388380849499999;
-            weights[759] = -0.71388380849499999;
-            weights[760] = -0.71388380849499999;
-            weights[761] = -0.71388380849499999;
-            weights[762] = -0.71388380849499999;
-            weights[763] = -0.71388380849499999;
-            weights[764] = -0.71388380849499999;
-            weights[765] = -0.71388380849499999;
-            weights[766] = -0.71388380849499999;
-            weights[767] = -0.71388380849499999;
-            weights[768] = -0.71388380849499999;
-            weights[769] = -0.71388380849499999;
-            weights[770] = -0.71388380849499999;
-            weights[771] = -0.71388380849499999;
-            weights[772] = -0.71388380849499999;
-            weights[773] = -0.71388380849499999;
-            weights[774] = -0.71388380849499999;
-            weights[775] = -0.71388380849499999;
-            weights[776] = -0.71388380849499999;
-            weights[777] = -0.71388380849499999;
-            weights[778] = -0.71388380849499999;
-            weights[779] = -0.71388380849499999;
-            weights[780] = -0.71388380849499999;
-            weights[781] = -0.71388380849499999;
-            weights[782] = -0.71388380849499999;
-            weights[783] = -0.71388380849499999;
-            weights[784] = -0.71388380849499999;
-            weights[785] = -0.71388380849499999;
-            weights[786] = -0.71388380849499999;
-            weights[787] = -0.71388380849499999;
-            weights[788] = -0.71388380849499999;
-            weights[789] = -0.71388380849499999;
-            weights[790] = -0.71388380849499999;
-            weights[791] = 0.315924905245;
-            weights[792] = 0.315924905245;
-            weights[793] = 0.315924905245;
-            weights[794] = 0.315924905245;
-            weights[795] = 0.315924905245;
-            weights[796] = 0.315924905245;
-            weights[797] = 0.315924905245;
-            weights[798] = 0.315924905245;
-            weights[799] = 0.315924905245;
-            weights[800] = 0.315924905245;
-            weights[801] = 0.315924905245;
-            weights[802] = 0.315924905245;
-            weights[803] = 0.315924905245;
-            weights[804] = 0.315924905245;
-            weights[805] = 0.315924905245;
-            weights[806] = 0.315924905245;
-            weights[807] = 0.315924905245;
-            weights[808] = 0.315924905245;
-            weights[809] = 0.315924905245;
-            weights[810] = 0.315924905245;
-            weights[811] = 0.315924905245;
-            weights[812] = 0.315924905245;
-            weights[813] = 0.315924905245;
-            weights[814] = 0.315924905245;
-            weights[815] = 0.315924905245;
-            weights[816] = 0.315924905245;
-            weights[817] = 0.315924905245;
-            weights[818] = 0.315924905245;
-            weights[819] = 0.315924905245;
-            weights[820] = 0.315924905245;
-            weights[821] = 0.315924905245;
-            weights[822] = 0.315924905245;
-            weights[823] = 0.315924905245;
-            weights[824] = 0.315924905245;
-            weights[825] = 0.315924905245;
-            weights[826] = 0.315924905245;
-            weights[827] = 0.315924905245;
-            weights[828] = 0.315924905245;
-            weights[829] = 0.315924905245;
-            weights[830] = 0.315924905245;
-            weights[831] = 0.315924905245;
-            weights[832] = 0.315924905245;
-            weights[833] = 0.315924905245;
-            weights[834] = 0.315924905245;
-            weights[835] = 0.315924905245;
-            weights[836] = 0.315924905245;
-            weights[837] = 0.315924905245;
-            weights[838] = 0.315924905245;
-            weights[839] = 0.315924905245;
-            weights[840] = 0.315924905245;
-            weights[841] = 0.315924905245;
-            weights[842] = 0.315924905245;
-            weights[843] = 0.315924905245;
-            weights[844] = 0.315924905245;
-            weights[845] = 0.315924905245;
-            weights[846] = 0.315924905245;
-            weights[847] = 0.315924905245;
-            weights[848] = 0.315924905245;
-            weights[849] = 0.315924905245;
-            weights[850] = 0.315924905245;
-            weights[851] = 0.315924905245;
-            weights[852] = 0.315924905245;
-            weights[853] = 0.315924905245;
-            weights[854] = 0.315924905245;
-            weights[855] = 0.315924905245;
-            weights[856] = 0.315924905245;
-            weights[857] = 0.315924905245;
-            weights[858] = 0.315924905245;
-            weights[859] = 0.315924905245;
-            weights[860] = 0.315924905245;
-            weights[861] = 0.315924905245;
-            weights[862] = 0.315924905245;
-            weights[863] = 0.315924905245;
-            weights[864] = 0.315924905245;
-            weights[865] = 0.315924905245;
-            weights[866] = 0.315924905245;
-            weights[867] = 0.315924905245;
-            weights[868] = 0.315924905245;
-            weights[869] = 0.315924905245;
-            weights[870] = 0.315924905245;
-            weights[871] = 0.315924905245;
-            weights[872] = 0.315924905245;
-            weights[873] = 0.315924905245;
-            weights[874] = 0.315924905245;
-            weights[875] = -0.076526696952332995;
-            weights[876] = -0.076526696952332995;
-            weights[877] = -0.076526696952332995;
-            weights[878] = -0.076526696952332995;
-            weights[879] = -0.076526696952332995;
-            weights[880] = -0.076526696952332995;
-            weights[881] = -0.076526696952332995;
-            weights[882] = -0.076526696952332995;
-            weights[883] = -0.076526696952332995;
-            weights[884] = -0.076526696952332995;
-            weights[885] = -0.076526696952332995;
-            weights[886] = -0.076526696952332995;
-            weights[887] = -0.076526696952332995;
-            weights[888] = -0.076526696952332995;
-            weights[889] = -0.076526696952332995;
-            weights[890] = -0.076526696952332995;
-            weights[891] = -0.076526696952332995;
-            weights[892] = -0.076526696952332995;
-            weights[893] = -0.076526696952332995;
-            weights[894] = -0.076526696952332995;
-            weights[895] = -0.076526696952332995;
-            weights[896] = -0.076526696952332995;
-            weights[897] = -0.076526696952332995;
-            weights[898] = -0.076526696952332995;
-            weights[899] = -0.076526696952332995;
-            weights[900] = -0.076526696952332995;
-            weights[901] = -0.076526696952332995;
-            weights[902] = -0.076526696952332995;
-            weights[903] = -0.076526696952332995;
-            weights[904] = -0.076526696952332995;
-            weights[905] = -0.076526696952332995;
-            weights[906] = -0.076526696952332995;
-            weights[907] = -0.076526696952332995;
-            weights[908] = -0.076526696952332995;
-            weights[909] = -0.076526696952332995;
-            weights[910] = -0.076526696952332995;
-            weights[911] = -0.076526696952332995;
-            weights[912] = -0.076526696952332995;
-            weights[913] = -0.076526696952332995;
-            weights[914] = -0.076526696952332995;
-            weights[915] = -0.076526696952332995;
-            weights[916] = -0.076526696952332995;
-            weights[917] = -0.076526696952332995;
-            weights[918] = -0.076526696952332995;
-            weights[919] = -0.076526696952332995;
-            weights[920] = -0.076526696952332995;
-            weights[921] = -0.076526696952332995;
-            weights[922] = -0.076526696952332995;
-            weights[923] = -0.076526696952332995;
-            weights[924] = -0.076526696952332995;
-            weights[925] = -0.076526696952332995;
-            weights[926] = -0.076526696952332995;
-            weights[927] = -0.076526696952332995;
-            weights[928] = -0.076526696952332995;
-            weights[929] = -0.076526696952332995;
-            weights[930] = -0.076526696952332995;
-            weights[931] = 0.0095177158975500008;
-            weights[932] = 0.0095177158975500008;
-            weights[933] = 0.0095177158975500008;
-            weights[934] = 0.0095177158975500008;
-            weights[935] = 0.0095177158975500008;
-            weights[936] = 0.0095177158975500008;
-            weights[937] = 0.0095177158975500008;
-            weights[938] = 0.0095177158975500008;
-            weights[939] = 0.0095177158975500008;
-            weights[940] = 0.0095177158975500008;
-            weights[941] = 0.0095177158975500008;
-            weights[942] = 0.0095177158975500008;
-            weights[943] = 0.0095177158975500008;
-            weights[944] = 0.0095177158975500008;
-            weights[945] = 0.0095177158975500008;
-            weights[946] = 0.0095177158975500008;
-            weights[947] = 0.0095177158975500008;
-            weights[948] = 0.0095177158975500008;
-            weights[949] = 0.0095177158975500008;
-            weights[950] = 0.0095177158975500008;
-            weights[951] = 0.0095177158975500008;
-            weights[952] = 0.0095177158975500008;
-            weights[953] = 0.0095177158975500008;
-            weights[954] = 0.0095177158975500008;
-            weights[955] = 0.0095177158975500008;
-            weights[956] = 0.0095177158975500008;
-            weights[957] = 0.0095177158975500008;
-            weights[958] = 0.0095177158975500008;
-            weights[959] = 0.0095177158975500008;
-            weights[960] = 0.0095177158975500008;
-            weights[961] = 0.0095177158975500008;
-            weights[962] = 0.0095177158975500008;
-            weights[963] = 0.0095177158975500008;
-            weights[964] = 0.0095177158975500008;
-            weights[965] = 0.0095177158975500008;
-            weights[966] = -0.00053198701887800001;
-            weights[967] = -0.00053198701887800001;
-            weights[968] = -0.00053198701887800001;
-            weights[969] = -0.00053198701887800001;
-            weights[970] = -0.00053198701887800001;
-            weights[971] = -0.00053198701887800001;
-            weights[972] = -0.00053198701887800001;
-            weights[973] = -0.00053198701887800001;
-            weights[974] = -0.00053198701887800001;
-            weights[975] = -0.00053198701887800001;
-            weights[976] = -0.00053198701887800001;
-            weights[977] = -0.00053198701887800001;
-            weights[978] = -0.00053198701887800001;
-            weights[979] = -0.00053198701887800001;
-            weights[980] = -0.00053198701887800001;
-            weights[981] = -0.00053198701887800001;
-            weights[982] = -0.00053198701887800001;
-            weights[983] = -0.00053198701887800001;
-            weights[984] = -0.00053198701887800001;
-            weights[985] = -0.00053198701887800001;
-            weights[986] = 1.0426767662e-05;
-            weights[987] = 1.0426767662e-05;
-            weights[988] = 1.0426767662e-05;
-            weights[989] = 1.0426767662e-05;
-            weights[990] = 1.0426767662e-05;
-            weights[991] = 1.0426767662e-05;
-            weights[992] = 1.0426767662e-05;
-            weights[993] = 1.0426767662e-05;
-            weights[994] = 1.0426767662e-05;
-            weights[995] = 1.0426767662e-05;
-            weights[996] = -4.4087320125e-08;
-            weights[997] = -4.4087320125e-08;
-            weights[998] = -4.4087320125e-08;
-            weights[999] = -4.4087320125e-08;
-            weights[1000] = 1.3258375e-11;
-
+            coordinates.assign(gpcoordinates20, gpcoordinates20+3*1001);
+            weights.assign(gpweights20, gpweights20+1001);
             break;
-
+            
         default:
             
             std::cout << "Error in 'gptetrahedron' namespace: trying to get Gauss points to integrate order " << integrationorder << " which is undefined (too high)" << std::endl;
@@ -0,0 +1,134 @@
+#include "gpu.h"
+
+#ifdef HAVE_CUDA
+#include "cuda_runtime.h"
+#include "cublas_v2.h"
+#endif
+
+
+bool gpu::isitenabled = true;
+std::mutex gpu::mymutex;
+int gpu::numdevices = -1;
+long long int gpu::minnumproducts = 64*1024*1024;
+
+#ifdef HAVE_CUDA
+// A cuBLAS handle, a stream and a work buffer on a device. A context is used by one thread at a time:
+class gpucontext
+{
+    public:
+
+        int device = 0;
+        cublasHandle_t handle;
+        cudaStream_t stream;
+
+        double* buffer = NULL;
+        long long int capacity = 0;
+};
+
+// The contexts not in use:
+std::vector<gpucontext*> gpufreecontexts = {};
+// Number of contexts created (to spread the new ones over the devices):
+int gpunumcontexts = 0;
+
+void errorifcuda(cudaError_t err, std::string what)
+{
+    if (err != cudaSuccess)
+    {
+        std::cout << "Error in 'gpu' object: " << what << " failed (" << cudaGetErrorString(err) << ")" << std::endl;
+        abort();
+    }
+}
+#endif
+
+void gpu::enable(bool isenabled)
+{
+    isitenabled = isenabled;
+}
+
+int gpu::countdevices(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    if (numdevices >= 0)
+        return numdevices;
+
+    numdevices = 0;
+    #ifdef HAVE_CUDA
+    int count = 0;
+    if (cudaGetDeviceCount(&count) == cudaSuccess)
+        numdevices = count;
+    #endif
+
+    return numdevices;
+}
+
+bool gpu::multiply(bool transA, bool transB, long long int m, long long int n, long long int k, double* A, long long int lda, double* B, long long int ldb, double* C)
+{
+    if (isitenabled == false || m*n*k < minnumproducts || countdevices() == 0)
+        return false;
+
+    #ifndef HAVE_CUDA
+    return false;
+    #else
+    // Get a free context or create one on the next device:
+    gpucontext* ctx = NULL;
+    {
+        std::lock_guard<std::mutex> lock(mymutex);
+        if (gpufreecontexts.size() > 0)
+        {
+            ctx = gpufreecontexts.back();
+            gpufreecontexts.pop_back();
+        }
+        else
+        {
+            ctx = new gpucontext;
+            ctx->device = gpunumcontexts % numdevices;
+            gpunumcontexts++;
+
+            errorifcuda(cudaSetDevice(ctx->device), "cudaSetDevice");
+            errorifcuda(cudaStreamCreate(&(ctx->stream)), "cudaStreamCreate");
+            if (cublasCreate(&(ctx->handle)) != CUBLAS_STATUS_SUCCESS)
+            {
+                std::cout << "Error in 'gpu' object: cublasCreate failed" << std::endl;
+                abort();
+            }
+            cublasSetStream(ctx->handle, ctx->stream);
+        }
+    }
+
+    errorifcuda(cudaSetDevice(ctx->device), "cudaSetDevice");
+
+    long long int sizeA = m*k, sizeB = k*n, sizeC = m*n;
+    if (ctx->capacity < sizeA+sizeB+sizeC)
+    {
+        if (ctx->buffer != NULL)
+            errorifcuda(cudaFree(ctx->buffer), "cudaFree");
+        errorifcuda(cudaMalloc((void**)&(ctx->buffer), (sizeA+sizeB+sizeC)*sizeof(double)), "cudaMalloc");
+        ctx->capacity = sizeA+sizeB+sizeC;
+    }
+    double* dA = ctx->buffer;
+    double* dB = dA + sizeA;
+    double* dC = dB + sizeB;
+
+    errorifcuda(cudaMemcpyAsync(dA, A, sizeA*sizeof(double), cudaMemcpyHostToDevice, ctx->stream), "cudaMemcpyAsync");
+    errorifcuda(cudaMemcpyAsync(dB, B, sizeB*sizeof(double), cudaMemcpyHostToDevice, ctx->stream), "cudaMemcpyAsync");
+
+    // A row major matrix is its column major transpose. Thus C^T = B^T*A^T is computed:
+    double alpha = 1, beta = 0;
+    cublasOperation_t opA = transA ? CUBLAS_OP_T : CUBLAS_OP_N;
+    cublasOperation_t opB = transB ? CUBLAS_OP_T : CUBLAS_OP_N;
+    if (cublasDgemm(ctx->handle, opB, opA, n, m, k, &alpha, dB, ldb, dA, lda, &beta, dC, n) != CUBLAS_STATUS_SUCCESS)
+    {
+        std::cout << "Error in 'gpu' object: cublasDgemm failed" << std::endl;
+        abort();
+    }
+
+    errorifcuda(cudaMemcpyAsync(C, dC, sizeC*sizeof(double), cudaMemcpyDeviceToHost, ctx->stream), "cudaMemcpyAsync");
+    errorifcuda(cudaStreamSynchronize(ctx->stream), "cudaStreamSynchronize");
+
+    std::lock_guard<std::mutex> lock(mymutex);
+    gpufreecontexts.push_back(ctx);
+
+    return true;
+    #endif
+}
@@ -0,0 +1,53 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object offloads the large dense matrix products (among which the tf x coef x dof
+// contraction of the matrix generation) to the GPUs when sparselizard is compiled with CUDA.
+// Every call transfers its operands to a device, multiplies them with cuBLAS and transfers
+// the product back. The calls of the different threads are spread over all devices found.
+// Products with fewer than 'minnumproducts' scalar multiplications stay on the CPU since
+// the transfers would cost more than the product.
+
+#ifndef GPU_H
+#define GPU_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <mutex>
+
+class gpu
+{
+    private:
+
+        static bool isitenabled;
+
+        static std::mutex mymutex;
+
+        // Number of devices (-1 if not yet queried):
+        static int numdevices;
+
+    public:
+
+        // Minimum m*n*k value of an m x k by k x n product to use a GPU:
+        static long long int minnumproducts;
+
+        // The GPUs are used by default if any is available:
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+
+        // Number of devices available (always 0 without CUDA):
+        static int countdevices(void);
+
+        // Compute C = A*B on a GPU for row major matrices where A is m x k (k x m if 'transA') with
+        // row length 'lda', B is k x n (n x k if 'transB') with row length 'ldb' and C is m x n.
+        // Returns false (and leaves C unchanged) if the product should be computed on the CPU.
+        // This can be called by multiple threads at the same time.
+        static bool multiply(bool transA, bool transB, long long int m, long long int n, long long int k, double* A, long long int lda, double* B, long long int ldb, double* C);
+
+};
+
+#endif
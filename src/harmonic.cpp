@@ -1,4 +1,5 @@
 #include "harmonic.h"
+#include "operation.h"
 
 
 int harmonic::getfrequency(int harmonicnumber)
@@ -43,65 +44,76 @@ int harmonic::getharmonicnumber(std::string input)
 
 std::vector<std::pair<int,double>> harmonic::getproduct(int harm1, int harm2)
 {
-    // Special case if any of the two inputs is cos0:
-    if (harm1 == 1)
-        return {std::make_pair(harm2,1)};
-    if (harm2 == 1)
-        return {std::make_pair(harm1,1)};
-    
-    // The cos(a) x sin(b) case is treated in sin(b) x cos(a) case:
-    if (iscosine(harm1) && issine(harm2))
-        std::swap(harm1,harm2);
-        
-    // If none is the constant harmonic:
-    int freq1 = getfrequency(harm1);
-    int freq2 = getfrequency(harm2);
-    
-    // sin(a) x sin(b) case:
-    if (issine(harm1) && issine(harm2))
-        return {std::make_pair(getharmonicnumber(std::abs(freq1-freq2), false),0.5), std::make_pair(getharmonicnumber(freq1+freq2, false),-0.5)};
-    // cos(a) x cos(b) case:
-    if (iscosine(harm1) && iscosine(harm2))
-        return {std::make_pair(getharmonicnumber(std::abs(freq1-freq2), false),0.5), std::make_pair(getharmonicnumber(freq1+freq2, false),0.5)};
-    // sin(a) x cos(b) case:
-    if (issine(harm1) && iscosine(harm2))
-    {
-        if (freq1 != freq2)
-        {
-            if (freq1 > freq2)
-                return {std::make_pair(getharmonicnumber(freq1+freq2, true),0.5), std::make_pair(getharmonicnumber(freq1-freq2, true),0.5)};
-            else
-                return {std::make_pair(getharmonicnumber(freq1+freq2, true),0.5), std::make_pair(getharmonicnumber(freq2-freq1, true),-0.5)};
-        }
-        else
-            return {std::make_pair(getharmonicnumber(std::abs(freq1+freq2), true),0.5)};
-    }
-    
-    abort(); // fix return warning
+    std::vector<std::pair<int,double>> harmsofproduct;
+    getproduct(harm1, harm2, 0, harmsofproduct);
+    return harmsofproduct;
 }
 
 std::vector<std::pair<int,double>> harmonic::getproduct(int harm1, int harm2, int harm2timederivativeorder)
 {
-    if (harm2timederivativeorder == 0)
-        return getproduct(harm1, harm2);
+    std::vector<std::pair<int,double>> harmsofproduct;
+    getproduct(harm1, harm2, harm2timederivativeorder, harmsofproduct);
+    return harmsofproduct;
+}
+
+void harmonic::getproduct(int harm1, int harm2, int harm2timederivativeorder, std::vector<std::pair<int,double>>& harmsofproduct)
+{
+    harmsofproduct.clear();
     
     // Derivating harmonic 1 gives zero:
-    if (harm2 == 1)
-        return {};
-
-    // Call the classical 'getproduct' function but with modified harm 2.
+    if (harm2timederivativeorder > 0 && harm2 == 1)
+        return;
+    
     // For odd derivation orders if harm2 is on a sine it is put on a cosine and vice versa.
-    int newharm2 = harm2;
+    int origharm2 = harm2;
     if (harm2timederivativeorder%2 == 1)
-        newharm2 = newharm2 + 1 - 2*(newharm2%2);
-
-    std::vector<std::pair<int,double>> harmsofproduct = getproduct(harm1, newharm2);
-
+        harm2 = harm2 + 1 - 2*(harm2%2);
+    
+    // Special case if any of the two inputs is cos0:
+    if (harm1 == 1)
+        harmsofproduct.push_back(std::make_pair(harm2,1));
+    else if (harm2 == 1)
+        harmsofproduct.push_back(std::make_pair(harm1,1));
+    else
+    {
+        // The cos(a) x sin(b) case is treated in sin(b) x cos(a) case:
+        if (iscosine(harm1) && issine(harm2))
+            std::swap(harm1,harm2);
+            
+        // If none is the constant harmonic:
+        int freq1 = getfrequency(harm1);
+        int freq2 = getfrequency(harm2);
+        
+        // sin(a) x sin(b) case:
+        if (issine(harm1) && issine(harm2))
+        {
+            harmsofproduct.push_back(std::make_pair(getharmonicnumber(std::abs(freq1-freq2), false),0.5));
+            harmsofproduct.push_back(std::make_pair(getharmonicnumber(freq1+freq2, false),-0.5));
+        }
+        // cos(a) x cos(b) case:
+        if (iscosine(harm1) && iscosine(harm2))
+        {
+            harmsofproduct.push_back(std::make_pair(getharmonicnumber(std::abs(freq1-freq2), false),0.5));
+            harmsofproduct.push_back(std::make_pair(getharmonicnumber(freq1+freq2, false),0.5));
+        }
+        // sin(a) x cos(b) case:
+        if (issine(harm1) && iscosine(harm2))
+        {
+            harmsofproduct.push_back(std::make_pair(getharmonicnumber(freq1+freq2, true),0.5));
+            if (freq1 > freq2)
+                harmsofproduct.push_back(std::make_pair(getharmonicnumber(freq1-freq2, true),0.5));
+            if (freq1 < freq2)
+                harmsofproduct.push_back(std::make_pair(getharmonicnumber(freq2-freq1, true),-0.5));
+        }
+    }
+    
     // Multiply the coefficient by the extra 2*pi*fi like factor from the time derivation:
-    for (int p = 0; p < harmsofproduct.size(); p++)
-        harmsofproduct[p].second *= getderivationfactor(harm2timederivativeorder, harm2);
-
-    return harmsofproduct;
+    if (harm2timederivativeorder > 0)
+    {
+        double derivationfactor = getderivationfactor(harm2timederivativeorder, origharm2);
+        for (int p = 0; p < harmsofproduct.size(); p++)
+            harmsofproduct[p].second *= derivationfactor;
+    }
 }
 
 double harmonic::getderivationfactor(int timederivativeorder, int harm)
@@ -155,3 +167,79 @@ std::vector<std::vector<densemat>> harmonic::timederivative(int timederivativeor
     }
     return input;
 }
+
+int harmonic::getmaxfrequency(std::shared_ptr<operation> op, std::vector<int>& disjregs)
+{
+    if (op->isconstant() || op->isharmonicone(disjregs))
+        return 0;
+        
+    std::vector<int> harms = {};
+    if (op->isfield())
+        harms = op->getfieldpointer()->getharmonics();
+    if (op->isport())
+        harms = op->getportpointer()->getharmonics();
+    std::shared_ptr<opharmonic> harmop = std::dynamic_pointer_cast<opharmonic>(op);
+    if (harmop != NULL)
+        harms = harmop->getdestinationharmonics();
+    if (harms.size() > 0)
+    {
+        int maxfrequency = 0;
+        for (int i = 0; i < harms.size(); i++)
+            maxfrequency = std::max(maxfrequency, getfrequency(harms[i]));
+        return maxfrequency;
+    }
+    
+    if (op->isparameter())
+    {
+        std::shared_ptr<rawparameter> param = op->getparameterpointer();
+        int maxfrequency = 0;
+        for (int i = 0; i < disjregs.size(); i++)
+        {
+            std::vector<int> curdisjreg = {disjregs[i]};
+            int curfrequency = getmaxfrequency(param->get(disjregs[i], op->getselectedrow(), op->getselectedcol()), curdisjreg);
+            if (curfrequency < 0)
+                return -1;
+            maxfrequency = std::max(maxfrequency, curfrequency);
+        }
+        return maxfrequency;
+    }
+    
+    std::vector<std::shared_ptr<operation>> arguments = op->getarguments();
+    
+    if (std::dynamic_pointer_cast<oppower>(op) != NULL)
+    {
+        if (arguments[1]->isconstant() == false)
+            return -1;
+        double exponent = arguments[1]->getvalue();
+        if (exponent < 0 || exponent != std::floor(exponent))
+            return -1;
+        int basefrequency = getmaxfrequency(arguments[0], disjregs);
+        return (basefrequency < 0 ? -1 : basefrequency * ((int) exponent));
+    }
+    
+    if (op->issum() == false && op->isproduct() == false)
+        return -1;
+    
+    // The frequencies of a product of harmonics are the sums and differences of their frequencies:
+    int maxfrequency = 0;
+    for (int i = 0; i < arguments.size(); i++)
+    {
+        int argfrequency = getmaxfrequency(arguments[i], disjregs);
+        if (argfrequency < 0)
+            return -1;
+        maxfrequency = (op->issum() ? std::max(maxfrequency, argfrequency) : maxfrequency + argfrequency);
+    }
+    return maxfrequency;
+}
+
+int harmonic::getnumtimeevals(int maxfrequency, int maxrelevantfrequency)
+{
+    // The relevant frequencies must be resolved:
+    int minnumtimeevals = 2*maxrelevantfrequency+1;
+    
+    if (maxfrequency < 0)
+        return std::max(universe::maxautofftevals, minnumtimeevals);
+    
+    // With N time evaluations frequency f is aliased to N-f, which must be above the relevant frequencies:
+    return std::max(maxfrequency+maxrelevantfrequency+1, minnumtimeevals);
+}
@@ -11,9 +11,12 @@
 #include <utility>
 #include <vector>
 #include <string>
+#include <memory>
 #include "universe.h"
 #include "densemat.h"
 
+class operation;
+
 namespace harmonic
 {
     // Get the coefficient by which to multiply the fundamental frequency:
@@ -32,11 +35,22 @@ namespace harmonic
     // Get the same but when an order 'harm2timederivativeorder' 
     // time derivative is applied to harmonic 'harm2'. 
     std::vector<std::pair<int,double>> getproduct(int harm1, int harm2, int harm2timederivativeorder);
+    // Same but written to 'harmsofproduct' to reuse its storage in the loops on harmonics:
+    void getproduct(int harm1, int harm2, int harm2timederivativeorder, std::vector<std::pair<int,double>>& harmsofproduct);
     
     // Get the derivation factors (i.e. the wi and -wi^2) for the harmonic.
     double getderivationfactor(int timederivativeorder, int harm);
     // Apply the time derivative to 'input':
     std::vector<std::vector<densemat>> timederivative(int timederivativeorder, std::vector<std::vector<densemat>> input);
+    
+    // Highest frequency in the harmonic content of the operation on the disjoint regions, as obtained from
+    // the harmonics of its fields, ports and parameters through the sums, products and positive integer powers.
+    // Return -1 for operations that are not polynomial in multiharmonic arguments (the spectrum is unbounded).
+    int getmaxfrequency(std::shared_ptr<operation> op, std::vector<int>& disjregs);
+    // Minimal number of time evaluations for which the FFT of an operation of highest frequency 'maxfrequency'
+    // has no aliasing on the frequencies up to 'maxrelevantfrequency'. The user cap set with
+    // 'universe::setmaxautofftevals' is returned for non polynomial operations ('maxfrequency' negative).
+    int getnumtimeevals(int maxfrequency, int maxrelevantfrequency);
 };
 
 #endif
@@ -1,4 +1,5 @@
 #include "indexmat.h"
+#include "memorypool.h"
 #include "gentools.h"
 
 
@@ -15,19 +16,18 @@ indexmat::indexmat(long long int numberofrows, long long int numberofcolumns)
 {
     numrows = numberofrows;
     numcols = numberofcolumns;
-    myvalues = std::shared_ptr<int>(new int[numcols*numrows]);
+    myvalues = memorypool::getints(numcols*numrows);
 }
 
 indexmat::indexmat(long long int numberofrows, long long int numberofcolumns, int initvalue)
 {
     numrows = numberofrows;
     numcols = numberofcolumns;
-    int* myvaluesptr = new int[numcols*numrows];
+    myvalues = memorypool::getints(numcols*numrows);
+    int* myvaluesptr = myvalues.get();
     
     for (long long int i = 0; i < numcols*numrows; i++)
         myvaluesptr[i] = initvalue;
-    
-    myvalues = std::shared_ptr<int>(myvaluesptr);
 }
 
 indexmat::indexmat(long long int numberofrows, long long int numberofcolumns, std::vector<int> valvec)
@@ -40,24 +40,22 @@ indexmat::indexmat(long long int numberofrows, long long int numberofcolumns, st
     
     numrows = numberofrows;
     numcols = numberofcolumns;
-    int* myvaluesptr = new int[numcols*numrows];
+    myvalues = memorypool::getints(numcols*numrows);
+    int* myvaluesptr = myvalues.get();
     
     for (long long int i = 0; i < numcols*numrows; i++)
         myvaluesptr[i] = valvec[i];
-    
-    myvalues = std::shared_ptr<int>(myvaluesptr);
 }
 
 indexmat::indexmat(long long int numberofrows, long long int numberofcolumns, int init, int step)
 {
     numrows = numberofrows;
     numcols = numberofcolumns;
-    int* myvaluesptr = new int[numcols*numrows];
+    myvalues = memorypool::getints(numcols*numrows);
+    int* myvaluesptr = myvalues.get();
     
     for (long long int i = 0; i < numcols*numrows; i++)
         myvaluesptr[i] = init+i*step;
-    
-    myvalues = std::shared_ptr<int>(myvaluesptr);
 }
 
 indexmat::indexmat(std::vector<indexmat> input)
@@ -77,7 +75,8 @@ indexmat::indexmat(std::vector<indexmat> input)
             abort();
         }
     }
-    int* myvaluesptr = new int[numrows*numcols];
+    myvalues = memorypool::getints(numrows*numcols);
+    int* myvaluesptr = myvalues.get();
     
     long long int index = 0;
     for (long long int i = 0; i < input.size(); i++)
@@ -89,8 +88,6 @@ indexmat::indexmat(std::vector<indexmat> input)
             index++;
         }
     }
-    
-    myvalues = std::shared_ptr<int>(myvaluesptr);
 }
 
 indexmat indexmat::getresized(long long int m, long long int n)
@@ -257,7 +254,7 @@ indexmat indexmat::copy(void)
     // The pointed value has to be copied as well.
     if (indexmatcopy.myvalues != NULL)
     {
-        indexmatcopy.myvalues = std::shared_ptr<int>(new int[numcols*numrows]);
+        indexmatcopy.myvalues = memorypool::getints(numcols*numrows);
         int* copiedmyvaluesptr = indexmatcopy.myvalues.get();
         int* myvaluesptr = myvalues.get();
         for (long long int i = 0; i < numcols*numrows; i++)
@@ -0,0 +1,91 @@
+#include "asyncwriter.h"
+#include "universe.h"
+
+
+std::mutex asyncwriter::mymutex;
+std::condition_variable asyncwriter::myqueuechanged;
+
+std::deque<std::function<void(void)>> asyncwriter::myqueue = {};
+bool asyncwriter::isjobrunning = false;
+bool asyncwriter::isstopped = true;
+
+std::thread asyncwriter::mythread;
+
+int asyncwriter::maxnumqueued = 2;
+
+void asyncwriter::run(void)
+{
+    std::unique_lock<std::mutex> lock(mymutex);
+    while (true)
+    {
+        while (myqueue.size() == 0 && isstopped == false)
+            myqueuechanged.wait(lock);
+        if (myqueue.size() == 0)
+            return;
+
+        std::function<void(void)> job = myqueue.front();
+        myqueue.pop_front();
+        isjobrunning = true;
+        myqueuechanged.notify_all();
+
+        // The writing is done without the lock:
+        lock.unlock();
+        job();
+        lock.lock();
+
+        isjobrunning = false;
+        myqueuechanged.notify_all();
+    }
+}
+
+void asyncwriter::push(std::function<void(void)> job)
+{
+    std::unique_lock<std::mutex> lock(mymutex);
+
+    if (isstopped)
+    {
+        isstopped = false;
+        mythread = std::thread(run);
+    }
+
+    while (myqueue.size() >= (size_t)std::max(maxnumqueued, 1))
+        myqueuechanged.wait(lock);
+
+    // The background thread is shared by all sessions:
+    session* s = universe::getsession();
+    myqueue.push_back([s, job]
+    {
+        session* prev = universe::setsession(s);
+        job();
+        universe::setsession(prev);
+    });
+    myqueuechanged.notify_all();
+}
+
+void asyncwriter::flush(void)
+{
+    std::unique_lock<std::mutex> lock(mymutex);
+    while (myqueue.size() > 0 || isjobrunning)
+        myqueuechanged.wait(lock);
+}
+
+void asyncwriter::stop(void)
+{
+    {
+        std::unique_lock<std::mutex> lock(mymutex);
+        if (isstopped)
+            return;
+        isstopped = true;
+        myqueuechanged.notify_all();
+    }
+    // The remaining jobs are run before the thread returns:
+    mythread.join();
+}
+
+// Make sure all files are written at the end of the program:
+class asyncwriterstopper
+{
+    public:
+        ~asyncwriterstopper(void) { asyncwriter::stop(); };
+};
+static asyncwriterstopper stopatexit;
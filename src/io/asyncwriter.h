@@ -0,0 +1,52 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object runs the output jobs (file writes) in order on a background thread. At most
+// 'maxnumqueued' jobs wait in the queue: adding a job to a full queue blocks until a job is done.
+// The jobs must only use data they own since they run after the call that pushed them has returned.
+// Every job runs in the session of the thread that pushed it. That session must outlive the job.
+
+
+#ifndef ASYNCWRITER_H
+#define ASYNCWRITER_H
+
+#include <iostream>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <algorithm>
+
+class asyncwriter
+{
+    private:
+
+        static std::mutex mymutex;
+        // Notified when a job is pushed, taken or done:
+        static std::condition_variable myqueuechanged;
+
+        static std::deque<std::function<void(void)>> myqueue;
+        static bool isjobrunning;
+        static bool isstopped;
+
+        static std::thread mythread;
+
+        // Loop of the background thread:
+        static void run(void);
+
+    public:
+
+        static int maxnumqueued;
+
+        static void push(std::function<void(void)> job);
+        // Wait until all jobs pushed so far are done:
+        static void flush(void);
+        // Flush and stop the background thread:
+        static void stop(void);
+
+};
+
+#endif
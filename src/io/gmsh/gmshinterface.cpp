@@ -1,5 +1,6 @@
 #include "gmshinterface.h"
 #include "universe.h"
+#include "autotuning.h"
 
 
 #ifndef HAVE_GMSH
@@ -17,6 +18,25 @@ void gmshinterface::readwithapi(std::string name, nodes& mynodes, elements& myel
 #endif
 #ifdef HAVE_GMSH
 #include "gmsh.h"
+// Run 'func(first, last)' on 'num' items split in ranges over the threads:
+static void parallelfor(long long int num, std::function<void(long long int, long long int)> func)
+{
+    // Require a minimum number of items per thread:
+    int numthreadstouse = autotuning::getnumthreadsforvalues(num);
+    
+    if (numthreadstouse == 1)
+    {
+        func(0, num);
+        return;
+    }
+    
+    std::vector<std::thread> threadobjs(numthreadstouse);
+    for (int t = 0; t < numthreadstouse; t++)
+        threadobjs[t] = universe::newthread(func, t*num/numthreadstouse, (t+1)*num/numthreadstouse);
+    for (int t = 0; t < numthreadstouse; t++)
+        threadobjs[t].join();
+}
+
 void gmshinterface::readfromapi(nodes& mynodes, elements& myelements, physicalregions& myphysicalregions)
 {    
 
@@ -36,13 +56,19 @@ void gmshinterface::readfromapi(nodes& mynodes, elements& myelements, physicalre
     
     int numberofnodes = coords.size()/3;
     mynodes.setnumber(numberofnodes);
-    std::vector<double>* nodecoordinates = mynodes.getcoordinates();
+    double* nodecoordinates = mynodes.getcoordinates()->data();
     // Renumbering in case the numbers are not consecutive/not starting from 0:
     std::vector<int> noderenumbering(maxnodetag+1);
-    for (int i = 0; i < coords.size(); i++)
-        nodecoordinates->at(i) = coords[i];
-    for (int i = 0; i < numberofnodes; i++)
-        noderenumbering[nodeTags[i]] = i;
+    parallelfor(numberofnodes, [&](long long int first, long long int last)
+    {
+        for (long long int i = first; i < last; i++)
+        {
+            nodecoordinates[3*i+0] = coords[3*i+0];
+            nodecoordinates[3*i+1] = coords[3*i+1];
+            nodecoordinates[3*i+2] = coords[3*i+2];
+            noderenumbering[nodeTags[i]] = i;
+        }
+    });
         
         
     ///// Get all physical region numbers:
@@ -96,16 +122,28 @@ void gmshinterface::readfromapi(nodes& mynodes, elements& myelements, physicalre
                 int currentelementtype = elementobject.gettypenumber();
                 int curvatureorder = elementobject.getcurvatureorder();
                 int numcurvednodes = elementobject.countcurvednodes();
-                std::vector<int> nodesincurrentelement(numcurvednodes);
-                    
-                for (int e = 0; e < elementTags[t].size(); e++)
-                {
-                    for (int n = 0; n < numcurvednodes; n++)
-                        nodesincurrentelement[n] = noderenumbering[ elemnodeTags[t][e*numcurvednodes+n] ];
+                int numelems = elementTags[t].size();
                 
-                    int elementindexincurrenttype = myelements.add(currentelementtype, curvatureorder, nodesincurrentelement);
-                    currentphysicalregion->addelement(currentelementtype, elementindexincurrenttype);
+                // Point elements have a number equal to the node defining them:
+                if (currentelementtype == 0)
+                {
+                    for (int e = 0; e < numelems; e++)
+                        currentphysicalregion->addelement(0, noderenumbering[elemnodeTags[t][e]]);
+                    continue;
                 }
+                
+                // Fill all curved nodes of the element block at once:
+                int firstelement;
+                int* curvednodes = myelements.addblock(currentelementtype, curvatureorder, numelems, firstelement);
+                std::vector<std::size_t>& curnodetags = elemnodeTags[t];
+                
+                parallelfor((long long int)numelems*numcurvednodes, [&](long long int first, long long int last)
+                {
+                    for (long long int n = first; n < last; n++)
+                        curvednodes[n] = noderenumbering[curnodetags[n]];
+                });
+                
+                currentphysicalregion->addelements(currentelementtype, firstelement, numelems);
             }
         }
     }
@@ -146,12 +184,20 @@ void gmshinterface::readfromfile(std::string name, nodes& mynodes, elements& mye
             }
         }
         // Give an error if version is not supported:
-        if (formatversion >= 4)
+        if (formatversion >= 4 && formatversion < 4.1)
         {
             std::cout << "Error in 'gmshinterface': GMSH format " << formatversion << " is not supported in the native mesh reader." << std::endl;
-            std::cout << "Use the GMSH API, the petsc mesh reader or export as GMSH 2 format." << std::endl;
+            std::cout << "Use the GMSH API, the petsc mesh reader or export as GMSH 4.1 or 2 format." << std::endl;
             abort();
         }
+        // Format 4.1 (ASCII or binary) has its own reader:
+        if (formatversion >= 4)
+        {
+            meshfile.close();
+            mshreader reader(name);
+            reader.read(mynodes, myelements, myphysicalregions);
+            return;
+        }
 
         // Move to the node section and read the number of nodes:
         int numberofnodes;
@@ -265,90 +311,9 @@ void gmshinterface::readfromfile(std::string name, nodes& mynodes, elements& mye
 
 void gmshinterface::writetofile(std::string name, nodes& mynodes, elements& myelements, physicalregions& myphysicalregions, disjointregions& mydisjointregions)
 {    
-    // 'file' cannot take a std::string argument --> name.c_str():
-    std::ofstream meshfile (name.c_str());
-    if (meshfile.is_open())
-    {
-        // To write all doubles with enough digits to the file:
-        meshfile << std::setprecision(17);
-        
-        // Write the header:
-        meshfile << "$MeshFormat\n";
-        meshfile << "2.2 0 8\n";
-        meshfile << "$EndMeshFormat\n";
-        
-        // Write the node section:
-        meshfile << "$Nodes\n";
-        meshfile << mynodes.count() << "\n";
-        // Write the node coordinates:        
-        std::vector<double>* nodecoordinates = mynodes.getcoordinates();
-        
-        for (int i = 0; i < mynodes.count(); i++)
-            meshfile << i+1 << " " << nodecoordinates->at(3*i+0) << " " << nodecoordinates->at(3*i+1) << " " << nodecoordinates->at(3*i+2) << "\n";
-        meshfile << "$EndNodes\n";
-        
-        // Write the element section:
-        meshfile << "$Elements\n";
-        
-        // Write the number of elements.
-        // The number of elements is equal to the total number of elements in the physical regions.
-        // Elements that are in several physical regions at the same time are counted 
-        // multiple times, which is ok in the .msh format.
-        int numberofelements = myphysicalregions.countelements();
-        meshfile << numberofelements << "\n";
-        
-        // Write all element lines to the file.
-        int elementnumberinfile = 1;
-        // Iterate through all physical regions:
-        for (int i = 0; i < myphysicalregions.count(); i++)
-        {
-            // Get the physical region number corresponding to index i:
-            int physicalregionnumber = myphysicalregions.getnumber(i);
-            // Get the physical region object:
-            physicalregion* physicalregionobject = myphysicalregions.getatindex(i);
-            // Get all disjoint regions inside the physical region:
-            std::vector<int> alldisjointregions = physicalregionobject->getdisjointregions();
-
-            // Iterate on all disjoint regions in the physical region:
-            for (int h = 0; h < alldisjointregions.size(); h++)
-            {
-                // Get the unique element type in the disjoint region:
-                int typenumber = mydisjointregions.getelementtypenumber(alldisjointregions[h]);
-                // Get the corresponding high order element type number:
-                element myelement(typenumber, myelements.getcurvatureorder());
-                int curvedtypenumber = myelement.getcurvedtypenumber();
-                int numberofcurvednodes = myelement.countcurvednodes();
-                
-                // Get the range begin and end in the disjoint region:
-                int rangebegin = mydisjointregions.getrangebegin(alldisjointregions[h]);
-                int rangeend = mydisjointregions.getrangeend(alldisjointregions[h]);
-
-                // Iterate on all elements:
-                for (int i = rangebegin; i <= rangeend; i++)
-                {
-                    // Write [element number in file, type number, number of parameters (2 here), physical region number, physical region number]:
-                    // Note: physical region number appears twice. If a single parameter is provided the
-                    // physical regions will not be displayable separately when the .msh file is opened in GMSH.
-                    meshfile << elementnumberinfile << " " << converttogmshelementtypenumber(curvedtypenumber) << " 2 " << physicalregionnumber << " " << physicalregionnumber;
-                    // Write all nodes in the element.
-                    for (int nodeindex = 0; nodeindex < numberofcurvednodes; nodeindex++)
-                        meshfile << " " << myelements.getsubelement(0, typenumber, i, nodeindex) + 1; // +1 to start numbering nodes at 1
-                    
-                    elementnumberinfile = elementnumberinfile + 1;
-                    meshfile << "\n";
-                }
-            }
-        }
-            
-        meshfile << "$EndElements";
-        
-        meshfile.close();
-    }
-    else 
-    {
-        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
-        abort();
-    }
+    mshwriter writer(name);
+    writer.write(mynodes, myelements, myphysicalregions, mydisjointregions);
+    writer.close();
 }
 
 void gmshinterface::writetofile(std::string name, iodata datatowrite)
@@ -356,6 +321,15 @@ void gmshinterface::writetofile(std::string name, iodata datatowrite)
     // Get the file name without the path and the .pos extension:
     std::string viewname = gentools::getfilename(name);
     
+    // The file stays open while all views are written:
+    poswriter posfile(name, true);
+    
+    if (universe::posencoding == "binary")
+    {
+        posfile.writebinaryview(viewname, datatowrite);
+        return;
+    }
+    
     // Get the list of element types in the view:
     std::vector<int> activeelementtypes = datatowrite.getactiveelementtypes();
     
@@ -368,16 +342,13 @@ void gmshinterface::writetofile(std::string name, iodata datatowrite)
         std::vector<densemat> curcoords = datatowrite.getcoordinates(elemtypenum);
         std::vector<densemat> curdata = datatowrite.getdata(elemtypenum);
         
-        // Open the view (overwrite if first time):
+        // Open the view:
         if (activeelementtypes.size() == 1)
-            openview(name, viewname, 0, i == 0);
+            posfile.openview(viewname, datatowrite.gettimetags());
         else
-            openview(name, viewname + myelement.gettypename(), 0, i == 0);    
+            posfile.openview(viewname + myelement.gettypename(), datatowrite.gettimetags());
         // Append the data to the view:
-        if (datatowrite.isscalar())
-            appendtoview(name, elemtypenum, curcoords[0], curcoords[1], curcoords[2], curdata[0]);
-        else
-            appendtoview(name, elemtypenum, curcoords[0], curcoords[1], curcoords[2], curdata[0], curdata[1], curdata[2]);
+        posfile.appendtoview(elemtypenum, curcoords, curdata);
         
         // Write the shape function polynomials:
         lagrangeformfunction mylagrange(elemtypenum, datatowrite.getinterpolorder(), {});
@@ -392,218 +363,40 @@ void gmshinterface::writetofile(std::string name, iodata datatowrite)
             polygeo = mylagrangegeo.getformfunctionpolynomials();
         }
         
-        writeinterpolationscheme(name, {poly, polygeo});
+        posfile.writeinterpolationscheme({poly, polygeo});
         // Close the view:
-        closeview(name);
+        posfile.closeview();
     }
 }
 
 void gmshinterface::openview(std::string name, std::string viewname, double timetag, bool overwrite)
 {    
-    // 'file' cannot take a std::string argument --> name.c_str():
-    std::ofstream posfile;
-    if (overwrite)
-        posfile.open(name.c_str());
-    else
-        posfile.open(name.c_str(), std::ios::out | std::ios::app );
-        
-    if (posfile.is_open())
-    {
-        // To write all doubles with enough digits to the file:
-        posfile << std::setprecision(17);
-
-        // Write the header:
-        posfile << "View \"" << viewname << "\" {\n";
-        // Write the time tag:
-        posfile << "TIME{" << timetag << "};\n";
-        
-        posfile.close();
-    }
-    else 
-    {
-        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
-        abort();
-    }
+    poswriter posfile(name, overwrite);
+    posfile.openview(viewname, {timetag});
 }
 
 void gmshinterface::appendtoview(std::string name, int elementtypenumber, densemat coordx, densemat coordy, densemat coordz, densemat compxinterpolated)
 {    
-    // 'file' cannot take a std::string argument --> name.c_str():
-    std::ofstream posfile;
-    posfile.open(name.c_str(), std::ios::out | std::ios::app );
-    if (posfile.is_open())
-    {
-        // To write all doubles with enough digits to the file:
-        posfile << std::setprecision(17);
-        
-        // Get the character identifying the element:
-        char elementidentifier = getelementidentifierinposformat(elementtypenumber);
-        
-        // Write all elements:
-        for (int elem = 0; elem < compxinterpolated.countrows(); elem++)
-        {
-            posfile << 'S' << elementidentifier << "(";
-            // Write the coordinates of every evaluation point:
-            for (int i = 0; i < coordx.countcolumns(); i++)
-            {
-                posfile << coordx.getvalue(elem,i) << "," << coordy.getvalue(elem,i) << "," << coordz.getvalue(elem,i);
-                if (i < coordx.countcolumns()-1)
-                    posfile << ",";
-            }
-            // Write the field value at every evaluation point:
-            posfile << ")\n{";
-            for (int i = 0; i < compxinterpolated.countcolumns(); i++)
-            {
-                posfile << compxinterpolated.getvalue(elem,i);
-                if (i < compxinterpolated.countcolumns()-1)
-                    posfile << ",";
-            }
-            posfile << "};\n";
-        }
-        
-        posfile.close();
-    }
-    else 
-    {
-        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
-        abort();
-    }
+    poswriter posfile(name, false);
+    posfile.appendtoview(elementtypenumber, {coordx, coordy, coordz}, {compxinterpolated});
 }
 
 void gmshinterface::appendtoview(std::string name, int elementtypenumber, densemat coordx, densemat coordy, densemat coordz, densemat compxinterpolated, densemat compyinterpolated, densemat compzinterpolated)
 {    
-    // 'file' cannot take a std::string argument --> name.c_str():
-    std::ofstream posfile;
-    posfile.open(name.c_str(), std::ios::out | std::ios::app );
-    if (posfile.is_open())
-    {
-        // To write all doubles with enough digits to the file:
-        posfile << std::setprecision(17);
-        
-        // Get the character identifying the element:
-        char elementidentifier = getelementidentifierinposformat(elementtypenumber);
-        
-        // Write all elements:
-        for (int elem = 0; elem < compxinterpolated.countrows(); elem++)
-        {
-            posfile << 'V' << elementidentifier << "(";
-            // Write the coordinates of every evaluation point:
-            for (int i = 0; i < coordx.countcolumns(); i++)
-            {
-                posfile << coordx.getvalue(elem,i) << "," << coordy.getvalue(elem,i) << "," << coordz.getvalue(elem,i);
-                if (i < coordx.countcolumns()-1)
-                    posfile << ",";
-                
-            }
-            // Write the field value at every evaluation point:
-            posfile << ")\n{";
-            for (int i = 0; i < compxinterpolated.countcolumns(); i++)
-            {
-                posfile << compxinterpolated.getvalue(elem,i) << "," << compyinterpolated.getvalue(elem,i) << "," << compzinterpolated.getvalue(elem,i);
-                if (i < compxinterpolated.countcolumns()-1)
-                    posfile << ",";
-            }
-            posfile << "};\n";
-        }
-        
-        posfile.close();
-    }
-    else 
-    {
-        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
-        abort();
-    }
+    poswriter posfile(name, false);
+    posfile.appendtoview(elementtypenumber, {coordx, coordy, coordz}, {compxinterpolated, compyinterpolated, compzinterpolated});
 }
 
 void gmshinterface::writeinterpolationscheme(std::string name, std::vector<std::vector<polynomial>> poly)
 {    
-    // 'file' cannot take a std::string argument --> name.c_str():
-    std::ofstream posfile;
-    posfile.open(name.c_str(), std::ios::out | std::ios::app );
-    if (posfile.is_open())
-    {
-        posfile << "\nINTERPOLATION_SCHEME";
-        
-        for (int m = 0; m < poly.size(); m++)
-        {
-            posfile << "\n{\n";
-            
-            // Print the polynomial coefficients:
-            for (int p = 0; p < poly[m].size(); p++)
-            {
-                posfile << "  {";
-
-                std::vector<std::vector<std::vector<double>>> polyformfunctions = poly[m][p].get();
-
-                for (int i = 0; i < polyformfunctions.size(); i++)
-                {
-                    for (int j = 0; j < polyformfunctions[i].size(); j++)
-                    {
-                        for (int k = 0; k < polyformfunctions[i][j].size(); k++)
-                        {
-                            if (i == polyformfunctions.size() - 1 && j == polyformfunctions[i].size() - 1 && k == polyformfunctions[i][j].size() - 1)
-                                posfile << polyformfunctions[i][j][k];
-                            else
-                                posfile << polyformfunctions[i][j][k] << ",";
-                        }
-                    }
-                }
-
-                if (p == poly[m].size() - 1)
-                    posfile << "}\n";
-                else
-                    posfile << "},\n";
-            }
-
-            posfile << "}\n{\n";
-
-            // Print the list of monomials:
-            std::vector<std::vector<std::vector<double>>> polyformfunctions = poly[m][0].get();
-
-            for (int i = 0; i < polyformfunctions.size(); i++)
-            {
-                for (int j = 0; j < polyformfunctions[i].size(); j++)
-                {
-                    for (int k = 0; k < polyformfunctions[i][j].size(); k++)
-                    {
-                        posfile << "  {" << i << "," << j << "," << k << "}";
-                        if (i == polyformfunctions.size() - 1 && j == polyformfunctions[i].size() - 1 && k == polyformfunctions[i][j].size() - 1)
-                            posfile << "\n";
-                        else
-                            posfile << ",\n";
-                    }
-                }
-            }
-            posfile << "}";
-        }
-
-        posfile << ";\n\n";
-
-        posfile.close();
-    }
-    else 
-    {
-        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
-        abort();
-    }
+    poswriter posfile(name, false);
+    posfile.writeinterpolationscheme(poly);
 }
 
 void gmshinterface::closeview(std::string name)
 {    
-    // 'file' cannot take a std::string argument --> name.c_str():
-    std::ofstream posfile;
-    posfile.open(name.c_str(), std::ios::out | std::ios::app );
-    if (posfile.is_open())
-    {
-        posfile << "};\n\n";
-        
-        posfile.close();
-    }
-    else 
-    {
-        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
-        abort();
-    }
+    poswriter posfile(name, false);
+    posfile.closeview();
 }
 
 int gmshinterface::convertgmshelementtypenumber(int gmshtypenumber)
@@ -17,6 +17,8 @@
 #include <sstream>
 #include <vector>
 #include <list>   
+#include <thread>
+#include <functional>
 #include <iomanip>
 #include "wallclock.h"
 #include "physicalregion.h"
@@ -25,6 +27,9 @@
 #include "polynomial.h"
 #include "iodata.h"
 #include "lagrangeformfunction.h"
+#include "mshreader.h"
+#include "poswriter.h"
+#include "mshwriter.h"
 
 namespace gmshinterface
 {
@@ -32,14 +37,15 @@ namespace gmshinterface
     void readfromapi(nodes&, elements&, physicalregions&);
     void readwithapi(std::string name, nodes&, elements&, physicalregions&);
     
-    // Load the .msh mesh to the 'nodes', 'elements' and 'physicalregions' objects.
+    // Load the .msh mesh (format 2 or 4.1) to the 'nodes', 'elements' and 'physicalregions' objects.
     void readfromfile(std::string name, nodes&, elements&, physicalregions&);
-    // Write to .msh mesh format:
+    // Write to .msh mesh format (ascii 2.2 or binary 4.1, see 'universe::setmshoutput'):
     void writetofile(std::string name, nodes&, elements&, physicalregions&, disjointregions&);
     
-    // Write to .pos format:
+    // Write to .pos format (ascii or binary, see 'universe::setposoutput'):
     void writetofile(std::string name, iodata datatowrite);
 
+    // The functions below open and close the .pos file at every call, 'poswriter' keeps it open.
     // Write or append the header of a new view in the .pos file:
     void openview(std::string name, std::string viewname, double timetag, bool overwrite);
     // Write a scalar field to the current view in the .pos format:
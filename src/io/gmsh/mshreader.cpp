@@ -0,0 +1,514 @@
+#include "mshreader.h"
+#include "gmshinterface.h"
+#include "universe.h"
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <algorithm>
+
+
+mshreader::mshreader(std::string name)
+{
+    myname = name;
+
+    // 'file' cannot take a std::string argument --> name.c_str():
+    std::ifstream meshfile(name.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (not(meshfile.is_open()))
+    {
+        std::cout << "Unable to open file " << name << " or file not found" << std::endl;
+        abort();
+    }
+    long long int filesize = meshfile.tellg();
+    meshfile.seekg(0, std::ios::beg);
+
+    mybuffer.resize(filesize+1);
+    meshfile.read(mybuffer.data(), filesize);
+    meshfile.close();
+    mybuffer[filesize] = '\0';
+
+    mycursor = mybuffer.data();
+    myend = mybuffer.data()+filesize;
+}
+
+void mshreader::error(std::string message)
+{
+    std::cout << "Error in 'mshreader' object: " << message << " in file '" << myname << "'" << std::endl;
+    abort();
+}
+
+const char* mshreader::parsenumber(const char* pos, double& value)
+{
+    char* after;
+    value = std::strtod(pos, &after);
+    return after;
+}
+
+const char* mshreader::parsenumber(const char* pos, long long int& value)
+{
+    char* after;
+    value = std::strtoll(pos, &after, 10);
+    return after;
+}
+
+int mshreader::readint(void)
+{
+    if (myisbinary)
+    {
+        int value;
+        if (myend-mycursor < sizeof(int))
+            error("unexpected end of file");
+        std::memcpy(&value, mycursor, sizeof(int));
+        mycursor += sizeof(int);
+        return value;
+    }
+
+    skipwhitespace();
+    long long int value;
+    const char* after = parsenumber(mycursor, value);
+    if (after == mycursor)
+        error("could not read an integer");
+    mycursor = after;
+    return value;
+}
+
+long long int mshreader::readsize(void)
+{
+    if (myisbinary)
+    {
+        if (myend-mycursor < mydatasize)
+            error("unexpected end of file");
+        long long int value;
+        if (mydatasize == 8)
+        {
+            unsigned long long int curval;
+            std::memcpy(&curval, mycursor, 8);
+            value = curval;
+        }
+        else
+        {
+            unsigned int curval;
+            std::memcpy(&curval, mycursor, 4);
+            value = curval;
+        }
+        mycursor += mydatasize;
+        return value;
+    }
+
+    skipwhitespace();
+    long long int value;
+    const char* after = parsenumber(mycursor, value);
+    if (after == mycursor)
+        error("could not read an integer");
+    mycursor = after;
+    return value;
+}
+
+double mshreader::readdouble(void)
+{
+    if (myisbinary)
+    {
+        double value;
+        if (myend-mycursor < sizeof(double))
+            error("unexpected end of file");
+        std::memcpy(&value, mycursor, sizeof(double));
+        mycursor += sizeof(double);
+        return value;
+    }
+
+    skipwhitespace();
+    double value;
+    const char* after = parsenumber(mycursor, value);
+    if (after == mycursor)
+        error("could not read a real number");
+    mycursor = after;
+    return value;
+}
+
+void mshreader::skipwhitespace(void)
+{
+    while (mycursor < myend && std::isspace((unsigned char)*mycursor))
+        mycursor++;
+}
+
+void mshreader::skipline(void)
+{
+    const char* lineend = (const char*)std::memchr(mycursor, '\n', myend-mycursor);
+    mycursor = (lineend == NULL) ? myend : lineend+1;
+}
+
+std::string mshreader::readsectionheader(void)
+{
+    skipwhitespace();
+    if (mycursor >= myend || *mycursor != '$')
+        error("expected a section header");
+
+    const char* namebegin = mycursor+1;
+    while (mycursor < myend && not(std::isspace((unsigned char)*mycursor)))
+        mycursor++;
+    std::string sectionname(namebegin, mycursor);
+    skipline();
+
+    return sectionname;
+}
+
+void mshreader::readsectionend(std::string sectionname)
+{
+    skipwhitespace();
+    std::string sectionend = "$End"+sectionname;
+    if (myend-mycursor < sectionend.size() || std::strncmp(mycursor, sectionend.c_str(), sectionend.size()) != 0)
+        error("expected '"+sectionend+"'");
+    mycursor += sectionend.size();
+    skipline();
+}
+
+void mshreader::skipsection(std::string sectionname)
+{
+    std::string sectionend = "$End"+sectionname;
+    const char* found = std::search(mycursor, myend, sectionend.begin(), sectionend.end());
+    if (found == myend)
+        error("could not find '"+sectionend+"'");
+    mycursor = found+sectionend.size();
+    skipline();
+}
+
+template <typename T>
+void mshreader::parsenumbers(const char* begin, const char* end, std::vector<T>& values)
+{
+    long long int len = end-begin;
+    int numthreadstouse = std::min(len/1000000+1, (long long int)universe::getmaxnumthreads()); // require a min number of bytes per thread
+
+    // The chunk boundaries are moved forward to the next whitespace to never split a number:
+    std::vector<const char*> bounds(numthreadstouse+1);
+    bounds[0] = begin;
+    bounds[numthreadstouse] = end;
+    for (int t = 1; t < numthreadstouse; t++)
+    {
+        const char* curbound = std::max(begin+(long long int)t*len/numthreadstouse, bounds[t-1]);
+        while (curbound < end && not(std::isspace((unsigned char)*curbound)))
+            curbound++;
+        bounds[t] = curbound;
+    }
+
+    std::vector<std::vector<T>> chunkvalues(numthreadstouse);
+    std::vector<bool> isfailed(numthreadstouse, false);
+
+    auto parsechunk = [&](int t)
+    {
+        const char* pos = bounds[t];
+        const char* chunkend = bounds[t+1];
+
+        std::vector<T>& curvalues = chunkvalues[t];
+        curvalues.reserve((chunkend-pos)/4);
+
+        while (true)
+        {
+            while (pos < chunkend && std::isspace((unsigned char)*pos))
+                pos++;
+            if (pos >= chunkend)
+                break;
+
+            T value;
+            const char* after = parsenumber(pos, value);
+            if (after == pos)
+            {
+                isfailed[t] = true;
+                break;
+            }
+            curvalues.push_back(value);
+            pos = after;
+        }
+    };
+
+    if (numthreadstouse == 1)
+        parsechunk(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(parsechunk, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+
+    long long int numvalues = 0;
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        if (isfailed[t])
+            error("could not read a number");
+        numvalues += chunkvalues[t].size();
+    }
+
+    values.resize(numvalues);
+    long long int index = 0;
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        std::copy(chunkvalues[t].begin(), chunkvalues[t].end(), values.begin()+index);
+        index += chunkvalues[t].size();
+    }
+}
+
+void mshreader::readblock(long long int numlines, long long int numvalues, std::vector<double>& values)
+{
+    if (myisbinary)
+    {
+        if ((myend-mycursor)/sizeof(double) < numvalues)
+            error("unexpected end of file");
+        values.resize(numvalues);
+        std::memcpy(values.data(), mycursor, numvalues*sizeof(double));
+        mycursor += numvalues*sizeof(double);
+        return;
+    }
+
+    // Move to the beginning of the first line of the block:
+    while (mycursor < myend && *mycursor != '\n' && std::isspace((unsigned char)*mycursor))
+        mycursor++;
+    if (mycursor < myend && *mycursor == '\n')
+        mycursor++;
+
+    const char* begin = mycursor;
+    for (long long int i = 0; i < numlines; i++)
+        skipline();
+
+    parsenumbers(begin, mycursor, values);
+    if (values.size() != numvalues)
+        error("unexpected number of values in a block");
+}
+
+void mshreader::readblock(long long int numlines, long long int numvalues, std::vector<long long int>& values)
+{
+    if (myisbinary)
+    {
+        if ((myend-mycursor)/mydatasize < numvalues)
+            error("unexpected end of file");
+        values.resize(numvalues);
+        for (long long int i = 0; i < numvalues; i++)
+            values[i] = readsize();
+        return;
+    }
+
+    // Move to the beginning of the first line of the block:
+    while (mycursor < myend && *mycursor != '\n' && std::isspace((unsigned char)*mycursor))
+        mycursor++;
+    if (mycursor < myend && *mycursor == '\n')
+        mycursor++;
+
+    const char* begin = mycursor;
+    for (long long int i = 0; i < numlines; i++)
+        skipline();
+
+    parsenumbers(begin, mycursor, values);
+    if (values.size() != numvalues)
+        error("unexpected number of values in a block");
+}
+
+void mshreader::readformat(void)
+{
+    if (readsectionheader() != "MeshFormat")
+        error("expected '$MeshFormat' at the beginning of the file");
+
+    double formatversion = readdouble();
+    int filetype = readint();
+    mydatasize = readint();
+
+    if (formatversion < 4.1 || formatversion >= 5)
+        error("only GMSH format 4.1 can be read by this reader (format is "+std::to_string(formatversion)+")");
+    if (mydatasize != 4 && mydatasize != 8)
+        error("unsupported data size "+std::to_string(mydatasize));
+
+    if (filetype == 1)
+    {
+        // An integer 1 is written in binary to detect the endianness:
+        skipline();
+        myisbinary = true;
+        if (readint() != 1)
+            error("binary file was written with a different endianness");
+        myisbinary = false;
+    }
+    readsectionend("MeshFormat");
+
+    myisbinary = (filetype == 1);
+}
+
+void mshreader::readentities(void)
+{
+    std::vector<long long int> numentities(4);
+    for (int i = 0; i < 4; i++)
+        numentities[i] = readsize();
+
+    for (int dim = 0; dim < 4; dim++)
+    {
+        for (long long int i = 0; i < numentities[dim]; i++)
+        {
+            int entitytag = readint();
+            // Skip the point coordinates or the bounding box:
+            int numboxcoords = (dim == 0) ? 3 : 6;
+            for (int j = 0; j < numboxcoords; j++)
+                readdouble();
+
+            long long int numphysregs = readsize();
+            std::vector<int> physregs(numphysregs);
+            for (long long int j = 0; j < numphysregs; j++)
+                physregs[j] = readint();
+            if (numphysregs > 0)
+                isanyphysicalregiondefined = true;
+            myentityphysicalregions[dim][entitytag] = physregs;
+
+            // Skip the bounding entities:
+            if (dim > 0)
+            {
+                long long int numbounding = readsize();
+                for (long long int j = 0; j < numbounding; j++)
+                    readint();
+            }
+        }
+    }
+    readsectionend("Entities");
+}
+
+void mshreader::readnodes(nodes& mynodes)
+{
+    long long int numblocks = readsize();
+    long long int numberofnodes = readsize();
+    readsize(); // min node tag
+    long long int maxnodetag = readsize();
+
+    mynodes.setnumber(numberofnodes);
+    double* nodecoordinates = mynodes.getcoordinates()->data();
+
+    // Renumbering in case the numbers are not consecutive/not starting from 1:
+    mynodenumbers = std::vector<int>(maxnodetag+1, -1);
+
+    std::vector<long long int> tags;
+    std::vector<double> values;
+
+    long long int nodenumber = 0;
+    for (long long int b = 0; b < numblocks; b++)
+    {
+        int entitydim = readint();
+        readint(); // entity tag
+        int isparametric = readint();
+        long long int numnodesinblock = readsize();
+
+        // Parametric nodes also have their parametric coordinates (u, uv or uvw) after x, y and z:
+        int numvaluesperline = 3 + (isparametric ? entitydim : 0);
+
+        readblock(numnodesinblock, numnodesinblock, tags);
+        readblock(numnodesinblock, numnodesinblock*numvaluesperline, values);
+
+        if (nodenumber+numnodesinblock > numberofnodes)
+            error("more nodes than announced");
+
+        for (long long int i = 0; i < numnodesinblock; i++)
+        {
+            long long int curtag = tags[i];
+            if (curtag < 0 || curtag > maxnodetag)
+                error("invalid node tag "+std::to_string(curtag));
+            mynodenumbers[curtag] = nodenumber;
+
+            for (int c = 0; c < 3; c++)
+                nodecoordinates[3*nodenumber+c] = values[numvaluesperline*i+c];
+            nodenumber++;
+        }
+    }
+    if (nodenumber != numberofnodes)
+        error("less nodes than announced");
+
+    readsectionend("Nodes");
+}
+
+void mshreader::readelements(elements& myelements, physicalregions& myphysicalregions)
+{
+    long long int numblocks = readsize();
+    readsize(); // number of elements
+    readsize(); // min element tag
+    readsize(); // max element tag
+
+    std::vector<long long int> values;
+
+    for (long long int b = 0; b < numblocks; b++)
+    {
+        int entitydim = readint();
+        int entitytag = readint();
+        int gmshtypenumber = readint();
+        long long int numelementsinblock = readsize();
+
+        int currentcurvedelementtype = gmshinterface::convertgmshelementtypenumber(gmshtypenumber);
+        element elementobject(currentcurvedelementtype);
+        // Get the uncurved element type number:
+        int currentelementtype = elementobject.gettypenumber();
+        int curvatureorder = elementobject.getcurvatureorder();
+        int numcurvednodes = elementobject.countcurvednodes();
+
+        // Every element is given by its tag followed by its node tags:
+        readblock(numelementsinblock, numelementsinblock*(1+numcurvednodes), values);
+
+        // The elements of an entity in no physical region are skipped (all are in region 0 if there is no physical region at all):
+        std::vector<int> physregs = {0};
+        if (isanyphysicalregiondefined)
+        {
+            auto found = myentityphysicalregions[entitydim].find(entitytag);
+            physregs = (found == myentityphysicalregions[entitydim].end()) ? std::vector<int>{} : found->second;
+        }
+        if (physregs.size() == 0)
+            continue;
+
+        std::vector<physicalregion*> currentphysicalregions(physregs.size());
+        for (int j = 0; j < physregs.size(); j++)
+            currentphysicalregions[j] = myphysicalregions.get(universe::physregshift*(entitydim+1) + physregs[j]);
+
+        std::vector<int> nodesincurrentelement(numcurvednodes);
+        for (long long int e = 0; e < numelementsinblock; e++)
+        {
+            for (int n = 0; n < numcurvednodes; n++)
+            {
+                long long int curtag = values[e*(1+numcurvednodes)+1+n];
+                if (curtag < 0 || curtag >= mynodenumbers.size() || mynodenumbers[curtag] == -1)
+                    error("element with undefined node tag "+std::to_string(curtag));
+                nodesincurrentelement[n] = mynodenumbers[curtag];
+            }
+
+            int elementindexincurrenttype = myelements.add(currentelementtype, curvatureorder, nodesincurrentelement);
+            for (int j = 0; j < currentphysicalregions.size(); j++)
+                currentphysicalregions[j]->addelement(currentelementtype, elementindexincurrenttype);
+        }
+    }
+    readsectionend("Elements");
+}
+
+void mshreader::read(nodes& mynodes, elements& myelements, physicalregions& myphysicalregions)
+{
+    readformat();
+
+    bool isnodesectionread = false;
+    while (true)
+    {
+        skipwhitespace();
+        if (mycursor >= myend)
+            break;
+
+        std::string sectionname = readsectionheader();
+
+        if (sectionname == "Entities")
+            readentities();
+        else if (sectionname == "PartitionedEntities")
+            error("partitioned meshes are not supported (use 'mesh::allload' on the unpartitioned mesh instead)");
+        else if (sectionname == "Nodes")
+        {
+            readnodes(mynodes);
+            isnodesectionread = true;
+        }
+        else if (sectionname == "Elements")
+        {
+            if (not(isnodesectionread))
+                error("found '$Elements' before '$Nodes'");
+            readelements(myelements, myphysicalregions);
+            // The remaining sections are not needed:
+            return;
+        }
+        else
+            skipsection(sectionname);
+    }
+
+    error("no '$Elements' section found");
+}
@@ -0,0 +1,90 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object reads a GMSH .msh file in format 4.1 (ASCII or binary) without the GMSH API.
+// The whole file is read at once and parsed in place (no line by line string allocation).
+// The large node coordinate and element blocks of ASCII files are parsed by multiple threads.
+
+
+#ifndef MSHREADER_H
+#define MSHREADER_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "nodes.h"
+#include "elements.h"
+#include "physicalregions.h"
+#include "physicalregion.h"
+#include "element.h"
+
+class mshreader
+{
+
+    private:
+
+        std::string myname;
+
+        // Whole file content (followed by a terminating '\0'):
+        std::vector<char> mybuffer = {};
+        const char* mycursor = NULL;
+        const char* myend = NULL;
+
+        bool myisbinary = false;
+        // Size in bytes of the 'size_t' values in binary files:
+        int mydatasize = 8;
+
+        // Physical region numbers of every entity (without the dimension shift) for every entity dimension:
+        std::vector<std::unordered_map<int, std::vector<int>>> myentityphysicalregions = std::vector<std::unordered_map<int, std::vector<int>>>(4);
+        bool isanyphysicalregiondefined = false;
+
+        // Node number of every node tag (-1 if the tag is not used):
+        std::vector<int> mynodenumbers = {};
+
+        void error(std::string message);
+
+        // Read a single value at the cursor and move the cursor after it:
+        int readint(void);
+        long long int readsize(void);
+        double readdouble(void);
+
+        void skipwhitespace(void);
+        // Move the cursor to the beginning of the next line:
+        void skipline(void);
+        // Get the name of the section header at the cursor (e.g. 'Nodes' for '$Nodes') and move to the next line:
+        std::string readsectionheader(void);
+        // Check the section end at the cursor and move to the next line:
+        void readsectionend(std::string sectionname);
+        // Skip everything until after the end of the section:
+        void skipsection(std::string sectionname);
+
+        void readformat(void);
+        void readentities(void);
+        void readnodes(nodes&);
+        void readelements(elements&, physicalregions&);
+
+        // Read 'numvalues' values stored in binary or stored in ASCII on the next 'numlines' lines:
+        void readblock(long long int numlines, long long int numvalues, std::vector<double>& values);
+        void readblock(long long int numlines, long long int numvalues, std::vector<long long int>& values);
+
+        // Parse all whitespace separated numbers in the text range with multiple threads:
+        template <typename T>
+        void parsenumbers(const char* begin, const char* end, std::vector<T>& values);
+        // Parse a number at 'pos' and return the position after it (or 'pos' on failure):
+        static const char* parsenumber(const char* pos, double& value);
+        static const char* parsenumber(const char* pos, long long int& value);
+
+    public:
+
+        mshreader(std::string name);
+
+        // Load the mesh to the 'nodes', 'elements' and 'physicalregions' objects:
+        void read(nodes&, elements&, physicalregions&);
+
+};
+
+#endif
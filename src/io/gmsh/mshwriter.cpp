@@ -0,0 +1,327 @@
+#include "mshwriter.h"
+#include "gmshinterface.h"
+#include "universe.h"
+
+
+// Size of the blocks written to the file:
+static const long long int mshblocksize = 1048576;
+
+mshwriter::mshwriter(std::string filename)
+{
+    myname = filename;
+
+    myfile.open(filename.c_str(), std::ios::out | std::ios::binary);
+    if (not(myfile.is_open()))
+    {
+        std::cout << "Unable to write to file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+
+    mybuffer.reserve(mshblocksize + mshblocksize/4);
+}
+
+mshwriter::~mshwriter(void)
+{
+    close();
+}
+
+void mshwriter::append(long long int value)
+{
+    char str[32];
+    int len = std::snprintf(str, sizeof(str), "%lld", value);
+    mybuffer.append(str, len);
+}
+
+void mshwriter::append(double value)
+{
+    // To write all doubles with enough digits to the file:
+    char str[32];
+    int len = std::snprintf(str, sizeof(str), "%.17g", value);
+    mybuffer.append(str, len);
+}
+
+void mshwriter::appendbinary(const void* data, long long int numbytes)
+{
+    mybuffer.append((const char*)data, numbytes);
+}
+
+void mshwriter::flushifbig(void)
+{
+    if (mybuffer.size() < mshblocksize)
+        return;
+
+    myfile.write(mybuffer.data(), mybuffer.size());
+    mybuffer.clear();
+}
+
+void mshwriter::close(void)
+{
+    if (not(myfile.is_open()))
+        return;
+
+    myfile.write(mybuffer.data(), mybuffer.size());
+    mybuffer.clear();
+    myfile.close();
+
+    if (myfile.fail())
+    {
+        std::cout << "Unable to write to file " << myname << " or file not found" << std::endl;
+        abort();
+    }
+}
+
+void mshwriter::getelements(physicalregion* physreg, disjointregions& mydisjointregions, std::vector<std::vector<int>>& elementlist)
+{
+    elementlist = std::vector<std::vector<int>>(8, std::vector<int>(0));
+
+    std::vector<int> alldisjointregions = physreg->getdisjointregions();
+    for (int h = 0; h < alldisjointregions.size(); h++)
+    {
+        int typenumber = mydisjointregions.getelementtypenumber(alldisjointregions[h]);
+        int rangebegin = mydisjointregions.getrangebegin(alldisjointregions[h]);
+        int rangeend = mydisjointregions.getrangeend(alldisjointregions[h]);
+
+        for (int i = rangebegin; i <= rangeend; i++)
+            elementlist[typenumber].push_back(i);
+    }
+}
+
+void mshwriter::write(nodes& mynodes, elements& myelements, physicalregions& myphysicalregions, disjointregions& mydisjointregions)
+{
+    if (universe::mshencoding == "binary")
+        writebinary(mynodes, myelements, myphysicalregions, mydisjointregions);
+    else
+        writeascii(mynodes, myelements, myphysicalregions, mydisjointregions);
+}
+
+void mshwriter::writeascii(nodes& mynodes, elements& myelements, physicalregions& myphysicalregions, disjointregions& mydisjointregions)
+{
+    // Write the header:
+    append("$MeshFormat\n2.2 0 8\n$EndMeshFormat\n");
+
+    // Write the node section:
+    append("$Nodes\n");
+    append((long long int)mynodes.count()); append("\n");
+
+    const std::vector<double>* nodecoordinates = mynodes.readcoordinates();
+    for (int i = 0; i < mynodes.count(); i++)
+    {
+        append((long long int)i+1);
+        for (int c = 0; c < 3; c++)
+        {
+            append(" ");
+            append(nodecoordinates->at(3*i+c));
+        }
+        append("\n");
+        flushifbig();
+    }
+    append("$EndNodes\n");
+
+    // Write the element section. Elements that are in several physical regions at the
+    // same time are counted multiple times, which is ok in the .msh format:
+    append("$Elements\n");
+    append((long long int)myphysicalregions.countelements()); append("\n");
+
+    long long int elementnumberinfile = 1;
+    for (int p = 0; p < myphysicalregions.count(); p++)
+    {
+        std::string physicalregionnumber = std::to_string(myphysicalregions.getnumber(p));
+
+        std::vector<std::vector<int>> elementlist;
+        getelements(myphysicalregions.getatindex(p), mydisjointregions, elementlist);
+
+        for (int typenumber = 0; typenumber < 8; typenumber++)
+        {
+            element myelement(typenumber, myelements.getcurvatureorder());
+            int numberofcurvednodes = myelement.countcurvednodes();
+            // The physical region number appears twice. If a single parameter is provided the
+            // physical regions will not be displayable separately when the .msh file is opened in GMSH:
+            std::string elementprefix = " " + std::to_string(gmshinterface::converttogmshelementtypenumber(myelement.getcurvedtypenumber())) + " 2 " + physicalregionnumber + " " + physicalregionnumber;
+
+            for (int i = 0; i < elementlist[typenumber].size(); i++)
+            {
+                append(elementnumberinfile);
+                append(elementprefix);
+                for (int nodeindex = 0; nodeindex < numberofcurvednodes; nodeindex++)
+                {
+                    append(" ");
+                    append((long long int)myelements.getsubelement(0, typenumber, elementlist[typenumber][i], nodeindex) + 1); // +1 to start numbering nodes at 1
+                }
+                append("\n");
+                flushifbig();
+
+                elementnumberinfile++;
+            }
+        }
+    }
+    append("$EndElements");
+}
+
+void mshwriter::writebinary(nodes& mynodes, elements& myelements, physicalregions& myphysicalregions, disjointregions& mydisjointregions)
+{
+    int numphysregs = myphysicalregions.count();
+    long long int numberofnodes = mynodes.count();
+    const std::vector<double>* nodecoordinates = mynodes.readcoordinates();
+
+    // The header is followed by a binary integer 1 to detect the endianness:
+    append("$MeshFormat\n4.1 1 8\n");
+    int one = 1;
+    appendbinary(&one, sizeof(int));
+    append("\n$EndMeshFormat\n");
+
+    ///// Entities (one per physical region, tags are numbered per dimension):
+
+    std::vector<double> boundingbox = {0,0,0,0,0,0};
+    for (long long int i = 0; i < numberofnodes; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            double curcoord = nodecoordinates->at(3*i+c);
+            if (i == 0 || curcoord < boundingbox[c])
+                boundingbox[c] = curcoord;
+            if (i == 0 || curcoord > boundingbox[3+c])
+                boundingbox[3+c] = curcoord;
+        }
+    }
+
+    // Empty physical regions (dimension -1) have no entity:
+    std::vector<int> entitydims(numphysregs), entitytags(numphysregs, -1);
+    std::vector<unsigned long long int> numentities(4, 0);
+    for (int p = 0; p < numphysregs; p++)
+    {
+        entitydims[p] = myphysicalregions.getatindex(p)->getelementdimension();
+        if (entitydims[p] >= 0)
+            entitytags[p] = ++numentities[entitydims[p]];
+    }
+    // The nodes must be in an entity (an entity without physical region is added if there is none):
+    int nodeentitydim = -1, nodeentitytag = 1;
+    for (int p = 0; p < numphysregs; p++)
+    {
+        if (entitydims[p] > nodeentitydim)
+        {
+            nodeentitydim = entitydims[p];
+            nodeentitytag = entitytags[p];
+        }
+    }
+    bool isnodeentityadded = (nodeentitydim == -1);
+    if (isnodeentityadded)
+    {
+        nodeentitydim = 0;
+        numentities[0] = 1;
+    }
+
+    append("$Entities\n");
+    appendbinary(numentities.data(), 4*sizeof(unsigned long long int));
+    for (int dim = 0; dim < 4; dim++)
+    {
+        if (dim == 0 && isnodeentityadded)
+        {
+            int tag = 1;
+            unsigned long long int numphysicaltags = 0;
+            appendbinary(&tag, sizeof(int));
+            appendbinary(boundingbox.data(), 3*sizeof(double));
+            appendbinary(&numphysicaltags, sizeof(unsigned long long int));
+        }
+        for (int p = 0; p < numphysregs; p++)
+        {
+            if (entitydims[p] != dim)
+                continue;
+
+            int physregnumber = myphysicalregions.getnumber(p);
+            unsigned long long int numphysicaltags = 1, numbounding = 0;
+
+            appendbinary(&entitytags[p], sizeof(int));
+            // Points only have their coordinates, the other entities have their bounding box:
+            appendbinary(boundingbox.data(), (dim == 0 ? 3 : 6)*sizeof(double));
+            appendbinary(&numphysicaltags, sizeof(unsigned long long int));
+            appendbinary(&physregnumber, sizeof(int));
+            if (dim > 0)
+                appendbinary(&numbounding, sizeof(unsigned long long int));
+        }
+    }
+    append("\n$EndEntities\n");
+    flushifbig();
+
+    ///// Nodes (all in a single block):
+
+    append("$Nodes\n");
+    unsigned long long int nodeheader[4] = {(numberofnodes > 0) ? 1ULL : 0ULL, (unsigned long long int)numberofnodes, 1, (unsigned long long int)numberofnodes};
+    appendbinary(nodeheader, 4*sizeof(unsigned long long int));
+    if (numberofnodes > 0)
+    {
+        int blockheader[3] = {nodeentitydim, nodeentitytag, 0};
+        unsigned long long int numnodesinblock = numberofnodes;
+        appendbinary(blockheader, 3*sizeof(int));
+        appendbinary(&numnodesinblock, sizeof(unsigned long long int));
+
+        for (unsigned long long int i = 1; i <= numberofnodes; i++)
+        {
+            appendbinary(&i, sizeof(unsigned long long int));
+            flushifbig();
+        }
+        // Write the coordinates in blocks:
+        long long int numnodesperblock = mshblocksize/(3*sizeof(double)) + 1;
+        for (long long int i = 0; i < numberofnodes; i += numnodesperblock)
+        {
+            long long int curnum = std::min(numnodesperblock, numberofnodes-i);
+            appendbinary(nodecoordinates->data() + 3*i, 3*curnum*sizeof(double));
+            flushifbig();
+        }
+    }
+    append("\n$EndNodes\n");
+
+    ///// Elements (one block per physical region and element type):
+
+    std::vector<std::vector<std::vector<int>>> elementlists(numphysregs);
+    unsigned long long int numblocks = 0, numberofelements = 0;
+    for (int p = 0; p < numphysregs; p++)
+    {
+        getelements(myphysicalregions.getatindex(p), mydisjointregions, elementlists[p]);
+        for (int typenumber = 0; typenumber < 8; typenumber++)
+        {
+            if (elementlists[p][typenumber].size() > 0)
+            {
+                numblocks++;
+                numberofelements += elementlists[p][typenumber].size();
+            }
+        }
+    }
+
+    append("$Elements\n");
+    unsigned long long int elementheader[4] = {numblocks, numberofelements, 1, numberofelements};
+    appendbinary(elementheader, 4*sizeof(unsigned long long int));
+
+    unsigned long long int elementnumberinfile = 1;
+    std::vector<unsigned long long int> elementdata;
+    for (int p = 0; p < numphysregs; p++)
+    {
+        for (int typenumber = 0; typenumber < 8; typenumber++)
+        {
+            std::vector<int>& curelems = elementlists[p][typenumber];
+            if (curelems.size() == 0)
+                continue;
+
+            element myelement(typenumber, myelements.getcurvatureorder());
+            int numberofcurvednodes = myelement.countcurvednodes();
+
+            int blockheader[3] = {entitydims[p], entitytags[p], gmshinterface::converttogmshelementtypenumber(myelement.getcurvedtypenumber())};
+            unsigned long long int numelementsinblock = curelems.size();
+            appendbinary(blockheader, 3*sizeof(int));
+            appendbinary(&numelementsinblock, sizeof(unsigned long long int));
+
+            // Every element is given by its tag followed by its node tags:
+            elementdata.resize(1+numberofcurvednodes);
+            for (int i = 0; i < curelems.size(); i++)
+            {
+                elementdata[0] = elementnumberinfile;
+                for (int nodeindex = 0; nodeindex < numberofcurvednodes; nodeindex++)
+                    elementdata[1+nodeindex] = myelements.getsubelement(0, typenumber, curelems[i], nodeindex) + 1;
+                appendbinary(elementdata.data(), elementdata.size()*sizeof(unsigned long long int));
+                flushifbig();
+
+                elementnumberinfile++;
+            }
+        }
+    }
+    append("\n$EndElements\n");
+}
@@ -0,0 +1,70 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object writes a mesh to a GMSH .msh file, either in the ASCII format 2.2 or in the binary
+// format 4.1 (see 'universe::setmshoutput'). The output is buffered and written to the file in
+// large blocks. In format 4.1 every physical region is written as its own entity and its elements
+// are written in one block per element type. Elements that are in several physical regions are
+// written once per physical region in both formats.
+
+
+#ifndef MSHWRITER_H
+#define MSHWRITER_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include "nodes.h"
+#include "elements.h"
+#include "physicalregions.h"
+#include "physicalregion.h"
+#include "disjointregions.h"
+#include "element.h"
+
+class mshwriter
+{
+
+    private:
+
+        std::string myname;
+        std::ofstream myfile;
+
+        // Output not yet written to the file:
+        std::string mybuffer = "";
+
+        void append(const std::string& str) { mybuffer += str; };
+        void append(long long int value);
+        void append(double value);
+        void appendbinary(const void* data, long long int numbytes);
+
+        // Write the buffer to the file if it exceeds the block size:
+        void flushifbig(void);
+
+        // Elements of every element type in a physical region:
+        void getelements(physicalregion* physreg, disjointregions& mydisjointregions, std::vector<std::vector<int>>& elementlist);
+
+        void writeascii(nodes&, elements&, physicalregions&, disjointregions&);
+        void writebinary(nodes&, elements&, physicalregions&, disjointregions&);
+
+    public:
+
+        mshwriter(std::string filename);
+        ~mshwriter(void);
+
+        // The object owns the open file:
+        mshwriter(const mshwriter&) = delete;
+        mshwriter& operator=(const mshwriter&) = delete;
+
+        // Write the mesh in the format selected with 'universe::setmshoutput':
+        void write(nodes&, elements&, physicalregions&, disjointregions&);
+
+        // Write everything to the file and close it:
+        void close(void);
+
+};
+
+#endif
@@ -0,0 +1,294 @@
+#include "poswriter.h"
+#include "gmshinterface.h"
+#include "universe.h"
+
+
+// Size of the blocks written to the file:
+static const long long int posblocksize = 1048576;
+
+poswriter::poswriter(std::string filename, bool overwrite)
+{
+    myname = filename;
+    
+    if (overwrite)
+        myfile.open(filename.c_str(), std::ios::out | std::ios::binary);
+    else
+        myfile.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+        
+    if (not(myfile.is_open()))
+    {
+        std::cout << "Unable to write to file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+    
+    // To write all doubles (or floats) with enough digits to the file:
+    myprecision = universe::isoutputfloat32 ? 9 : 17;
+    
+    mybuffer.reserve(posblocksize + posblocksize/4);
+}
+
+poswriter::~poswriter(void)
+{
+    close();
+}
+
+void poswriter::append(double value)
+{
+    char str[32];
+    int len = std::snprintf(str, sizeof(str), "%.*g", myprecision, value);
+    mybuffer.append(str, len);
+}
+
+void poswriter::appendbinary(const void* data, long long int numbytes)
+{
+    mybuffer.append((const char*)data, numbytes);
+    flushifbig();
+}
+
+void poswriter::flushifbig(void)
+{
+    if (mybuffer.size() < posblocksize)
+        return;
+    
+    myfile.write(mybuffer.data(), mybuffer.size());
+    mybuffer.clear();
+}
+
+void poswriter::close(void)
+{
+    if (not(myfile.is_open()))
+        return;
+        
+    myfile.write(mybuffer.data(), mybuffer.size());
+    mybuffer.clear();
+    myfile.close();
+    
+    if (myfile.fail())
+    {
+        std::cout << "Unable to write to file " << myname << " or file not found" << std::endl;
+        abort();
+    }
+}
+
+void poswriter::openview(std::string viewname, std::vector<double> timetags)
+{
+    if (timetags.size() == 0)
+        timetags = {0.0};
+        
+    append("View \"" + viewname + "\" {\n");
+    // Write the time tags:
+    append("TIME{");
+    for (int i = 0; i < timetags.size(); i++)
+    {
+        append(timetags[i]);
+        if (i < timetags.size()-1)
+            append(',');
+    }
+    append("};\n");
+}
+
+void poswriter::appendtoview(int elementtypenumber, std::vector<densemat> coords, std::vector<densemat> data)
+{
+    bool isscalar = (data.size() == 1);
+
+    // Get the character identifying the element:
+    char elementidentifier = gmshinterface::getelementidentifierinposformat(elementtypenumber);
+    
+    int numelems = data[0].countrows();
+    int numcoordnodes = coords[0].countcolumns();
+    int numdatavals = data[0].countcolumns();
+    
+    double* xvals = coords[0].getvalues(); double* yvals = coords[1].getvalues(); double* zvals = coords[2].getvalues();
+    std::vector<double*> datavals(data.size());
+    for (int c = 0; c < data.size(); c++)
+        datavals[c] = data[c].getvalues();
+    
+    // Write all elements:
+    for (int elem = 0; elem < numelems; elem++)
+    {
+        append(isscalar ? 'S' : 'V'); append(elementidentifier); append('(');
+        // Write the coordinates of every evaluation point:
+        for (int i = 0; i < numcoordnodes; i++)
+        {
+            long long int index = (long long int)elem*numcoordnodes + i;
+            append(xvals[index]); append(','); append(yvals[index]); append(','); append(zvals[index]);
+            if (i < numcoordnodes-1)
+                append(',');
+        }
+        // Write the field value at every evaluation point:
+        append(")\n{");
+        for (int i = 0; i < numdatavals; i++)
+        {
+            long long int index = (long long int)elem*numdatavals + i;
+            for (int c = 0; c < datavals.size(); c++)
+            {
+                append(datavals[c][index]);
+                if (c < datavals.size()-1)
+                    append(',');
+            }
+            if (i < numdatavals-1)
+                append(',');
+        }
+        append("};\n");
+        
+        flushifbig();
+    }
+}
+
+void poswriter::writeinterpolationscheme(std::vector<std::vector<polynomial>> poly)
+{
+    append("\nINTERPOLATION_SCHEME");
+    
+    for (int m = 0; m < poly.size(); m++)
+    {
+        append("\n{\n");
+        
+        // Print the polynomial coefficients:
+        for (int p = 0; p < poly[m].size(); p++)
+        {
+            append("  {");
+
+            std::vector<std::vector<std::vector<double>>> polyformfunctions = poly[m][p].get();
+
+            for (int i = 0; i < polyformfunctions.size(); i++)
+            {
+                for (int j = 0; j < polyformfunctions[i].size(); j++)
+                {
+                    for (int k = 0; k < polyformfunctions[i][j].size(); k++)
+                    {
+                        append(polyformfunctions[i][j][k]);
+                        if (not(i == polyformfunctions.size() - 1 && j == polyformfunctions[i].size() - 1 && k == polyformfunctions[i][j].size() - 1))
+                            append(',');
+                    }
+                }
+            }
+
+            if (p == poly[m].size() - 1)
+                append("}\n");
+            else
+                append("},\n");
+        }
+
+        append("}\n{\n");
+
+        // Print the list of monomials:
+        std::vector<std::vector<std::vector<double>>> polyformfunctions = poly[m][0].get();
+
+        for (int i = 0; i < polyformfunctions.size(); i++)
+        {
+            for (int j = 0; j < polyformfunctions[i].size(); j++)
+            {
+                for (int k = 0; k < polyformfunctions[i][j].size(); k++)
+                {
+                    append("  {" + std::to_string(i) + "," + std::to_string(j) + "," + std::to_string(k) + "}");
+                    if (i == polyformfunctions.size() - 1 && j == polyformfunctions[i].size() - 1 && k == polyformfunctions[i][j].size() - 1)
+                        append('\n');
+                    else
+                        append(",\n");
+                }
+            }
+        }
+        append('}');
+    }
+
+    append(";\n\n");
+    flushifbig();
+}
+
+void poswriter::closeview(void)
+{
+    append("};\n\n");
+    flushifbig();
+}
+
+void poswriter::writebinaryview(std::string viewname, iodata& datatowrite)
+{
+    int order = datatowrite.getinterpolorder();
+    if (order > 2 || datatowrite.getgeointerpolorder() != order)
+    {
+        std::cout << "Error in 'poswriter' object: binary .pos output only supports isoparametric data of order 1 or 2 (use the ascii .pos output)" << std::endl;
+        abort();
+    }
+    
+    std::vector<double> timetags = datatowrite.gettimetags();
+    int numsteps = std::max((int)timetags.size(), 1);
+    if (timetags.size() == 0)
+        timetags = {0.0};
+    
+    // Index of the element type in the lists of the format (points, lines, ..., pyramids, then the second order lines, ..., pyramids):
+    std::vector<int> listindexes(8);
+    for (int tn = 0; tn < 8; tn++)
+        listindexes[tn] = (order == 1 || tn == 0) ? tn : 7+tn;
+    
+    // Number of scalar, vector and tensor elements in every of the 15 lists:
+    std::vector<int> counts(15*3, 0);
+    int compindex = datatowrite.isscalar() ? 0 : 1;
+    for (int tn = 0; tn < 8; tn++)
+        counts[3*listindexes[tn]+compindex] = datatowrite.countelements(tn);
+    
+    // The view name cannot contain spaces:
+    for (int i = 0; i < viewname.size(); i++)
+    {
+        if (viewname[i] == ' ')
+            viewname[i] = '^';
+    }
+    
+    append("$PostFormat\n1.4 1 " + std::to_string(sizeof(double)) + "\n$EndPostFormat\n");
+    append("$View\n" + viewname + " " + std::to_string(numsteps) + "\n");
+    for (int i = 0; i < counts.size(); i++)
+        append(std::to_string(counts[i]) + " ");
+    // No text:
+    append("0 0 0 0\n");
+    
+    // To detect the endianness:
+    int one = 1;
+    appendbinary(&one, sizeof(int));
+    appendbinary(timetags.data(), numsteps*sizeof(double));
+    
+    // The list index increases with the element type number, this is the format order:
+    std::vector<double> elemvals;
+    for (int tn = 0; tn < 8; tn++)
+    {
+        if (datatowrite.ispopulated(tn) == false)
+            continue;
+            
+        std::vector<densemat> curcoords = datatowrite.getcoordinates(tn, 0);
+        std::vector<densemat> curdata = datatowrite.getdata(tn);
+        
+        int numelems = curcoords[0].countrows();
+        int numnodes = curcoords[0].countcolumns();
+        int numcomps = curdata.size();
+        int numdatavals = curdata[0].countcolumns();
+        
+        std::vector<double*> coordvals = {curcoords[0].getvalues(), curcoords[1].getvalues(), curcoords[2].getvalues()};
+        std::vector<double*> datavals(numcomps);
+        for (int c = 0; c < numcomps; c++)
+            datavals[c] = curdata[c].getvalues();
+        
+        // Every element holds the x coordinates of all nodes, then y, then z, then the values per time step and node:
+        elemvals.resize(3*numnodes + numcomps*numdatavals);
+        for (int e = 0; e < numelems; e++)
+        {
+            int index = 0;
+            for (int s = 0; s < 3; s++)
+            {
+                for (int n = 0; n < numnodes; n++)
+                {
+                    elemvals[index] = coordvals[s][(long long int)e*numnodes+n];
+                    index++;
+                }
+            }
+            for (int v = 0; v < numdatavals; v++)
+            {
+                for (int c = 0; c < numcomps; c++)
+                {
+                    elemvals[index] = datavals[c][(long long int)e*numdatavals+v];
+                    index++;
+                }
+            }
+            appendbinary(elemvals.data(), elemvals.size()*sizeof(double));
+        }
+    }
+    
+    append("\n$EndView\n");
+}
@@ -0,0 +1,80 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object keeps a .pos file open while views are written to it. The output is buffered
+// and written to the file in large blocks. The file is closed when the object is destroyed.
+//
+// Views are either written in the GMSH parsed (ascii) format, with their interpolation scheme,
+// or in the legacy binary post-processing format (version 1.4). The binary format has no
+// interpolation scheme: it only supports isoparametric data of order 1 or 2. All time steps of
+// a view are written at once in both formats (the interpolation scheme is written once per view).
+
+
+#ifndef POSWRITER_H
+#define POSWRITER_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include "densemat.h"
+#include "polynomial.h"
+#include "iodata.h"
+#include "element.h"
+
+class poswriter
+{
+
+    private:
+
+        std::string myname;
+        std::ofstream myfile;
+
+        // Output not yet written to the file:
+        std::string mybuffer = "";
+
+        // Number of significant digits for the ascii values:
+        int myprecision = 17;
+
+        void append(double value);
+        void append(const std::string& str) { mybuffer += str; };
+        void append(char c) { mybuffer.push_back(c); };
+        void appendbinary(const void* data, long long int numbytes);
+        
+        // Write the buffer to the file if it exceeds the block size:
+        void flushifbig(void);
+
+    public:
+
+        // Open the file (overwrite or append):
+        poswriter(std::string filename, bool overwrite = true);
+        ~poswriter(void);
+
+        // The object owns the open file:
+        poswriter(const poswriter&) = delete;
+        poswriter& operator=(const poswriter&) = delete;
+
+        ///// Parsed format:
+
+        // Write the header of a new view with one time tag per time step:
+        void openview(std::string viewname, std::vector<double> timetags);
+        // Write the elements with their node coordinates and their scalar (1 component) or vector (3 components) data:
+        void appendtoview(int elementtypenumber, std::vector<densemat> coords, std::vector<densemat> data);
+        // Write poly.size() interpolation schemes in the current view:
+        void writeinterpolationscheme(std::vector<std::vector<polynomial>> poly);
+        void closeview(void);
+
+        ///// Legacy binary format:
+
+        // Write a whole view (a file can hold several views):
+        void writebinaryview(std::string viewname, iodata& datatowrite);
+
+        // Write everything to the file and close it:
+        void close(void);
+
+};
+
+#endif
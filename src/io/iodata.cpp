@@ -165,3 +165,27 @@ std::vector<densemat> iodata::getdata(int elemtypenum, int timestepindex)
     }
 }
 
+
+void iodata::decimate(int elementstride)
+{
+    if (elementstride <= 1)
+        return;
+
+    combine();
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (ispopulated(i) == false)
+            continue;
+
+        int numelems = mycoords[0][i][0].countrows();
+        std::vector<int> selected((numelems+elementstride-1)/elementstride);
+        for (int e = 0; e < selected.size(); e++)
+            selected[e] = e*elementstride;
+
+        for (int s = 0; s < 3; s++)
+            mycoords[s][i][0] = mycoords[s][i][0].extractrows(selected);
+        for (int comp = 0; comp < mydata.size(); comp++)
+            mydata[comp][i][0] = mydata[comp][i][0].extractrows(selected);
+    }
+}
@@ -78,6 +78,9 @@ class iodata
         // Get all components of the data at the nodes in all elements of a given type:
         std::vector<densemat> getdata(int elemtypenum, int timestepindex = -1);
         
+        // Only keep every 'elementstride'-th element of every element type:
+        void decimate(int elementstride);
+        
 };
 
 #endif
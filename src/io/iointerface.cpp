@@ -3,6 +3,39 @@
 
 void iointerface::writetofile(std::string filename, iodata datatowrite, std::string appendtofilename)
 {
+    // The time is read now since the file might be written later:
+    double timeval = universe::getsession()->currenttimestep;
+
+    if (universe::isoutputasynchronous)
+    {
+        // Unsupported formats are reported right away:
+        isonlyisoparametric(filename);
+
+        // 'iodata' holds its own copy of the coordinates and values:
+        asyncwriter::push([=](){ writetofilenow(filename, datatowrite, appendtofilename, timeval); });
+        return;
+    }
+
+    writetofilenow(filename, datatowrite, appendtofilename, timeval);
+}
+
+void iointerface::writetofilenow(std::string filename, iodata datatowrite, std::string appendtofilename, double timeval)
+{
+    profilescope scope("output");
+    
+    // Parallel ParaView output:
+    if (filename.size() >= 6 && filename.substr(filename.size()-5,5) == ".pvtu")
+    {
+        std::string requestedfilename = filename.substr(0, filename.size()-5) + appendtofilename + ".pvtu";
+        pvinterface::writetopvtufile(requestedfilename, datatowrite);
+        return;
+    }
+    if (filename.size() >= 6 && filename.substr(filename.size()-5,5) == ".xdmf")
+    {
+        std::string requestedfilename = filename.substr(0, filename.size()-5) + appendtofilename + ".xdmf";
+        xdmfinterface::writetofile(requestedfilename, datatowrite, timeval);
+        return;
+    }
     if (filename.size() >= 5)
     {
         // Get the extension:
@@ -30,19 +63,25 @@ void iointerface::writetofile(std::string filename, iodata datatowrite, std::str
     }
     
     std::cout << "Error in 'iointerface' namespace: cannot write to file '" << filename << "'." << std::endl;
-    std::cout << "Supported output formats are .vtk (ParaView), .vtu (ParaView) and .pos (GMSH)." << std::endl;
+    std::cout << "Supported output formats are .vtk (ParaView), .vtu (ParaView), .pvtu (parallel ParaView), .xdmf (XDMF) and .pos (GMSH)." << std::endl;
     abort();
 }
 
 bool iointerface::isonlyisoparametric(std::string filename)
 {
+    if (filename.size() >= 6 && filename.substr(filename.size()-5,5) == ".pvtu")
+        return true;
+    if (filename.size() >= 6 && filename.substr(filename.size()-5,5) == ".xdmf")
+        return true;
+        
     if (filename.size() >= 5)
     {
         // Get the extension:
         std::string fileext = filename.substr(filename.size()-4,4);
         
+        // The binary .pos format does not have interpolation schemes:
         if (fileext == ".pos")
-            return false;
+            return (universe::posencoding == "binary");
         if (fileext == ".vtk")
             return true;
         if (fileext == ".vtu")
@@ -50,7 +89,7 @@ bool iointerface::isonlyisoparametric(std::string filename)
     }
         
     std::cout << "Error in 'iointerface' namespace: cannot handle file '" << filename << "'." << std::endl;
-    std::cout << "Supported output formats are .vtk (ParaView), .vtu (ParaView) and .pos (GMSH)." << std::endl;
+    std::cout << "Supported output formats are .vtk (ParaView), .vtu (ParaView), .pvtu (parallel ParaView), .xdmf (XDMF) and .pos (GMSH)." << std::endl;
     abort();
 }
 
@@ -70,17 +109,27 @@ void iointerface::grouptimesteps(std::string filename, std::vector<std::string>
         abort();
     }
         
-    // Check that all file names end with .vtu:
+    // The files to group must have been written:
+    asyncwriter::flush();
+
+    // Check that all file names end with .vtu or .pvtu:
+    bool isparallel = false;
     for (int i = 0; i < numsteps; i++)
     {
         std::string curfile = filestogroup[i];
-        if (curfile.size() < 5 || curfile.substr(curfile.size()-4,4) != ".vtu")
+        bool ispvtu = (curfile.size() >= 6 && curfile.substr(curfile.size()-5,5) == ".pvtu");
+        if (ispvtu == false && (curfile.size() < 5 || curfile.substr(curfile.size()-4,4) != ".vtu"))
         {
-            std::cout << "Error in 'iointerface': can only group .vtu files into the .pvd file" << std::endl;
+            std::cout << "Error in 'iointerface': can only group .vtu and .pvtu files into the .pvd file" << std::endl;
             abort();
         }
+        isparallel = isparallel || ispvtu;
     }
     
+    // The .pvtu files are written by rank 0 only and so is the .pvd file:
+    if (isparallel && slmpi::getrank() != 0)
+        return;
+    
     pvinterface::grouptopvdfile(filename, filestogroup, timevals);
 }
 
@@ -136,12 +185,13 @@ void iointerface::write(std::string filename, std::vector<int>& intdata, std::ve
             datavals[2+intdata.size() + i] = doubledata[i];
             
         // Let petsc write the binary file for us:
+        universe::initializepetsc();
         Vec datvec;
         VecCreate(PETSC_COMM_SELF, &datvec);
         VecSetSizes(datvec, PETSC_DECIDE, totalsize);
         VecSetFromOptions(datvec);
 
-        VecSetValues(datvec, totalsize, addsvals, datavals, INSERT_VALUES);
+        VecSetValues(datvec, totalsize, petscindexes(addsvals, totalsize).getvalues(), datavals, INSERT_VALUES);
         VecAssemblyBegin(datvec);
         VecAssemblyEnd(datvec);
 
@@ -200,6 +250,7 @@ void iointerface::load(std::string filename, std::vector<int>& intdata, std::vec
     else
     {
         // Let petsc read the binary file for us:
+        universe::initializepetsc();
         Vec datvec;
         VecCreate(PETSC_COMM_SELF, &datvec);
         
@@ -208,7 +259,7 @@ void iointerface::load(std::string filename, std::vector<int>& intdata, std::vec
         VecLoad(datvec, v);
         PetscViewerDestroy(&v);
         
-        int veclen;
+        PetscInt veclen;
         VecGetSize(datvec, &veclen);
         
         densemat doublestoget(1, veclen);
@@ -217,7 +268,7 @@ void iointerface::load(std::string filename, std::vector<int>& intdata, std::vec
         double* vals = doublestoget.getvalues();
         int* ads = addressestoget.getvalues();
         
-        VecGetValues(datvec, veclen, ads, vals);
+        VecGetValues(datvec, veclen, petscindexes(ads, veclen).getvalues(), vals);
         
         int numints = vals[0];
         int numdoubles = vals[1];
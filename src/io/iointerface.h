@@ -8,7 +8,9 @@
 // - GMSH .pos
 // - ParaView .vtk
 // - ParaView .vtu
+// - ParaView .pvtu (one .vtu piece per rank)
 // - ParaView .pvd
+// - XDMF .xdmf (time series with HDF5 heavy data)
 
 #ifndef IOINTERFACE_H
 #define IOINTERFACE_H
@@ -17,17 +19,24 @@
 #include "iodata.h"
 #include "petsc.h"
 #include "petscvec.h"
+#include "petscindexes.h"
 
 #include "gmshinterface.h"
 #include "pvinterface.h"
+#include "xdmfinterface.h"
+#include "asyncwriter.h"
+#include "profiler.h"
 
 namespace iointerface
 {
+    // The file is written on a background thread if the output is asynchronous (see 'universe::setasynchronousoutput'):
     void writetofile(std::string filename, iodata datatowrite, std::string appendtofilename = "");
+    // Write the file now. The time value is used by the time series formats:
+    void writetofilenow(std::string filename, iodata datatowrite, std::string appendtofilename, double timeval);
     // The file format might allow only isoparametric elements:
     bool isonlyisoparametric(std::string filename);
     
-    // Group .vtu timestep files in a .pvd file:
+    // Group .vtu or .pvtu timestep files in a .pvd file:
     void grouptimesteps(std::string filename, std::vector<std::string> filestogroup, std::vector<double> timevals);
     
     // Write first an int vector then a double vector to ASCII or binary format:
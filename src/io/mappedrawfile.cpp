@@ -0,0 +1,126 @@
+#include "mappedrawfile.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// Class id written by PETSc at the beginning of a binary vector:
+static const int petscvecfileclassid = 1211214;
+
+// PETSc binary files are always big endian:
+static void frombigendian(const char* source, char* target, int numbytes)
+{
+    int one = 1;
+    bool islittleendian = (*((char*)&one) == 1);
+
+    if (islittleendian)
+    {
+        for (int i = 0; i < numbytes; i++)
+            target[i] = source[numbytes-1-i];
+    }
+    else
+        std::memcpy(target, source, numbytes);
+}
+
+void mappedrawfile::error(std::string message)
+{
+    std::cout << "Error in 'mappedrawfile' object: " << message << " in binary file '" << myname << "'" << std::endl;
+    abort();
+}
+
+mappedrawfile::mappedrawfile(std::string filename)
+{
+    myname = filename;
+
+    #if defined(__linux__)
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat filestat;
+    if (fd == -1 || fstat(fd, &filestat) == -1)
+    {
+        std::cout << "Unable to read data from file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+    mysize = filestat.st_size;
+    if (mysize > 0)
+    {
+        void* mapped = mmap(NULL, mysize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+            error("could not memory map the file");
+        mydata = (const char*)mapped;
+    }
+    close(fd);
+    #else
+    std::ifstream infile(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (not(infile.is_open()))
+    {
+        std::cout << "Unable to read data from file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+    mysize = infile.tellg();
+    mybuffer.resize(mysize);
+    infile.seekg(0, std::ios::beg);
+    infile.read(mybuffer.data(), mysize);
+    infile.close();
+    mydata = mybuffer.data();
+    #endif
+
+    ///// Check the header:
+
+    // Class id (32 bit integer) followed by the vector length (PetscInt):
+    int headersize = sizeof(int) + sizeof(PetscInt);
+    if (mysize < headersize)
+        error("unexpected end of file");
+
+    int classid;
+    frombigendian(mydata, (char*)&classid, sizeof(int));
+    if (classid != petscvecfileclassid)
+        error("unexpected header (not a vector)");
+
+    PetscInt veclen;
+    frombigendian(mydata + sizeof(int), (char*)&veclen, sizeof(PetscInt));
+    myvaluesbegin = headersize;
+
+    if (veclen < 2 || mysize < myvaluesbegin + veclen*sizeof(double))
+        error("unexpected end of file");
+
+    mynumints = getvalue(0);
+    mynumdoubles = getvalue(1);
+    if (mynumints < 0 || mynumdoubles < 0 || 2 + mynumints + mynumdoubles != veclen)
+        error("inconsistent data lengths");
+}
+
+mappedrawfile::~mappedrawfile(void)
+{
+    #if defined(__linux__)
+    if (mysize > 0)
+        munmap((void*)mydata, mysize);
+    #endif
+}
+
+double mappedrawfile::getvalue(long long int index)
+{
+    double output;
+    frombigendian(mydata + myvaluesbegin + index*sizeof(double), (char*)&output, sizeof(double));
+    return output;
+}
+
+void mappedrawfile::getintdata(std::vector<int>& intdata)
+{
+    intdata.resize(mynumints);
+    for (long long int i = 0; i < mynumints; i++)
+        intdata[i] = getvalue(2 + i);
+}
+
+void mappedrawfile::getdoubledata(long long int first, long long int numdoubles, double* target)
+{
+    if (first < 0 || first + numdoubles > mynumdoubles)
+        error("out of range double data request");
+
+    long long int offset = 2 + mynumints + first;
+    for (long long int i = 0; i < numdoubles; i++)
+        target[i] = getvalue(offset + i);
+}
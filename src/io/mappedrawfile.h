@@ -0,0 +1,63 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object gives access to a binary file written by 'iointerface::write' (PETSc binary vector
+// holding the int data length, the double data length, the int data then the double data) without
+// loading it at once. On linux the file is memory mapped and only the parts requested are read.
+// The header and the file size are checked at construction.
+
+
+#ifndef MAPPEDRAWFILE_H
+#define MAPPEDRAWFILE_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include "petsc.h"
+
+class mappedrawfile
+{
+
+    private:
+
+        std::string myname;
+
+        const char* mydata = NULL;
+        long long int mysize = 0;
+        // Used instead of the memory map if not on linux:
+        std::vector<char> mybuffer = {};
+
+        // Position of the first vector value in the file:
+        long long int myvaluesbegin = 0;
+
+        long long int mynumints = 0;
+        long long int mynumdoubles = 0;
+
+        // Get the vector value at 'index' (stored in big endian):
+        double getvalue(long long int index);
+
+        void error(std::string message);
+
+    public:
+
+        mappedrawfile(std::string filename);
+        ~mappedrawfile(void);
+
+        // The object owns the memory map:
+        mappedrawfile(const mappedrawfile&) = delete;
+        mappedrawfile& operator=(const mappedrawfile&) = delete;
+
+        long long int countints(void) { return mynumints; };
+        long long int countdoubles(void) { return mynumdoubles; };
+
+        void getintdata(std::vector<int>& intdata);
+        // Get 'numdoubles' values of the double data starting at index 'first':
+        void getdoubledata(long long int first, long long int numdoubles, double* target);
+
+};
+
+#endif
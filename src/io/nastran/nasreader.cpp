@@ -0,0 +1,461 @@
+#include "nasreader.h"
+#include "universe.h"
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+nasreader::nasreader(std::string name)
+{
+    myname = name;
+
+    #if defined(__linux__)
+    int fd = open(name.c_str(), O_RDONLY);
+    struct stat filestat;
+    if (fd == -1 || fstat(fd, &filestat) == -1)
+    {
+        std::cout << "Unable to open file " << name << " or file not found" << std::endl;
+        abort();
+    }
+    mysize = filestat.st_size;
+    if (mysize > 0)
+    {
+        void* mapped = mmap(NULL, mysize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+            error("could not memory map the file");
+        mydata = (const char*)mapped;
+    }
+    close(fd);
+    #else
+    // 'file' cannot take a std::string argument --> name.c_str():
+    std::ifstream meshfile(name.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (not(meshfile.is_open()))
+    {
+        std::cout << "Unable to open file " << name << " or file not found" << std::endl;
+        abort();
+    }
+    mysize = meshfile.tellg();
+    mybuffer.resize(mysize);
+    meshfile.seekg(0, std::ios::beg);
+    meshfile.read(mybuffer.data(), mysize);
+    meshfile.close();
+    mydata = mybuffer.data();
+    #endif
+}
+
+nasreader::~nasreader(void)
+{
+    #if defined(__linux__)
+    if (mysize > 0)
+        munmap((void*)mydata, mysize);
+    #endif
+}
+
+void nasreader::error(std::string message)
+{
+    std::cout << "Error in 'nasreader' object: " << message << " in file '" << myname << "'" << std::endl;
+    abort();
+}
+
+int nasreader::getlineformat(const char* linebegin, const char* lineend)
+{
+    long long int len = lineend-linebegin;
+
+    if (len >= 5 && std::strncmp(linebegin, "GRID", 4) == 0)
+    {
+        if (linebegin[4] == ' ')
+            return 1;
+        if (linebegin[4] == '*')
+            return 2;
+        if (linebegin[4] == ',')
+            return 3;
+        return 0;
+    }
+
+    if (len >= 2 && linebegin[0] == 'C')
+    {
+        // The format follows the card name:
+        const char* pos = linebegin;
+        while (pos < lineend && *pos != ' ' && *pos != '*' && *pos != ',')
+            pos++;
+        if (pos < lineend && *pos == '*')
+            return 2;
+        if (pos < lineend && *pos == ',')
+            return 3;
+        return 1;
+    }
+
+    return 0;
+}
+
+bool nasreader::getfield(const char* linebegin, const char* lineend, int format, int index, const char*& fieldbegin, const char*& fieldend)
+{
+    long long int len = lineend-linebegin;
+
+    if (format == 1 || format == 2)
+    {
+        // Small fields are 8 characters wide. Large fields are 16 characters wide except the first and last ones:
+        long long int first = 8*index, last = 8*index+8;
+        if (format == 2 && index > 0)
+        {
+            first = (index == 5) ? 72 : 8+16*(index-1);
+            last = (index == 5) ? 80 : first+16;
+        }
+        if (first >= len)
+            return false;
+
+        fieldbegin = linebegin+first;
+        fieldend = linebegin+std::min(last, len);
+        return true;
+    }
+
+    // Free fields are separated by commas:
+    const char* pos = linebegin;
+    for (int i = 0; i < index; i++)
+    {
+        pos = (const char*)std::memchr(pos, ',', lineend-pos);
+        if (pos == NULL)
+            return false;
+        pos++;
+    }
+    const char* nextcomma = (const char*)std::memchr(pos, ',', lineend-pos);
+
+    fieldbegin = pos;
+    fieldend = (nextcomma == NULL) ? lineend : nextcomma;
+    return true;
+}
+
+int nasreader::countdatafields(int format)
+{
+    if (format == 1)
+        return 8;
+    if (format == 2)
+        return 4;
+    // No limit for the free format:
+    return 1000000;
+}
+
+bool nasreader::parseint(const char* begin, const char* end, int& value)
+{
+    while (begin < end && *begin == ' ')
+        begin++;
+    while (end > begin && *(end-1) == ' ')
+        end--;
+
+    bool isnegative = false;
+    if (begin < end && (*begin == '-' || *begin == '+'))
+    {
+        isnegative = (*begin == '-');
+        begin++;
+    }
+    if (begin == end)
+        return false;
+
+    long long int val = 0;
+    for (const char* pos = begin; pos < end; pos++)
+    {
+        if (*pos < '0' || *pos > '9')
+            return false;
+        val = 10*val + (*pos-'0');
+    }
+    value = isnegative ? -val : val;
+
+    return true;
+}
+
+bool nasreader::parsereal(const char* begin, const char* end, double& value)
+{
+    // Copy the characters to a null terminated buffer with an explicit exponent character:
+    char buf[64];
+    int len = 0;
+    for (const char* pos = begin; pos < end; pos++)
+    {
+        char c = *pos;
+        if (c == ' ')
+            continue;
+        if (len >= 62)
+            return false;
+        if (c == 'D' || c == 'd')
+            c = 'E';
+        if ((c == '+' || c == '-') && len > 0 && buf[len-1] != 'E' && buf[len-1] != 'e')
+            buf[len++] = 'E';
+        buf[len++] = c;
+    }
+    if (len == 0)
+        return false;
+    buf[len] = '\0';
+
+    char* after;
+    value = std::strtod(buf, &after);
+
+    return (after == buf+len);
+}
+
+bool nasreader::translateelementname(const char* begin, const char* end, int& typenumber, int& numvertices)
+{
+    while (end > begin && (*(end-1) == ' ' || *(end-1) == '*'))
+        end--;
+    std::string elemname(begin, end);
+
+    if (elemname == "CBAR" || elemname == "CROD" || elemname == "CBEAM")
+        { typenumber = 1; numvertices = 2; return true; }
+    if (elemname == "CTRIA3")
+        { typenumber = 2; numvertices = 3; return true; }
+    if (elemname == "CQUAD4")
+        { typenumber = 3; numvertices = 4; return true; }
+    if (elemname == "CTETRA")
+        { typenumber = 4; numvertices = 4; return true; }
+    if (elemname == "CHEXA")
+        { typenumber = 5; numvertices = 8; return true; }
+    if (elemname == "CPENTA")
+        { typenumber = 6; numvertices = 6; return true; }
+
+    return false;
+}
+
+void nasreader::parsechunk(const char* begin, const char* end, nasdata& output)
+{
+    // Counting pass to preallocate:
+    long long int numgrids = 0, numelems = 0;
+    const char* pos = begin;
+    while (pos < end)
+    {
+        if (*pos == 'G')
+            numgrids++;
+        if (*pos == 'C')
+            numelems++;
+        const char* nextline = (const char*)std::memchr(pos, '\n', end-pos);
+        pos = (nextline == NULL) ? end : nextline+1;
+    }
+    output.coords.reserve(3*numgrids);
+    output.elems.reserve(11*numelems);
+
+    // Card waiting for continuation lines (1 for a GRID without its z coordinate, 2 for an element with missing vertices):
+    int pendingcard = 0;
+    // Number of vertices still missing for a pending element card:
+    int numvertsmissing = 0;
+
+    const char *fb, *fe;
+
+    pos = begin;
+    while (pos < end)
+    {
+        const char* nextline = (const char*)std::memchr(pos, '\n', end-pos);
+        const char* linebegin = pos;
+        const char* lineend = (nextline == NULL) ? end : nextline;
+        pos = (nextline == NULL) ? end : nextline+1;
+
+        if (lineend > linebegin && *(lineend-1) == '\r')
+            lineend--;
+        if (lineend == linebegin)
+            continue;
+
+        // Continuation line:
+        if (*linebegin == '+' || *linebegin == '*')
+        {
+            int contformat = 1;
+            if (std::memchr(linebegin, ',', lineend-linebegin) != NULL)
+                contformat = 3;
+            else if (*linebegin == '*')
+                contformat = 2;
+
+            if (pendingcard == 1)
+            {
+                double z;
+                if (not(getfield(linebegin, lineend, contformat, 1, fb, fe)) || not(parsereal(fb, fe, z)))
+                {
+                    output.errormessage = "could not read the z coordinate of a GRID card";
+                    return;
+                }
+                output.coords.push_back(z);
+                pendingcard = 0;
+            }
+            if (pendingcard == 2)
+            {
+                for (int i = 1; i <= countdatafields(contformat) && numvertsmissing > 0; i++)
+                {
+                    int vertex;
+                    if (not(getfield(linebegin, lineend, contformat, i, fb, fe)) || not(parseint(fb, fe, vertex)))
+                        break;
+                    output.elems.push_back(vertex-1);
+                    numvertsmissing--;
+                }
+                if (numvertsmissing == 0)
+                    pendingcard = 0;
+            }
+            continue;
+        }
+
+        if (pendingcard != 0)
+        {
+            output.errormessage = "incomplete card before line '"+std::string(linebegin, lineend)+"'";
+            return;
+        }
+
+        int format = getlineformat(linebegin, lineend);
+        if (format == 0)
+            continue;
+
+        // GRID card:
+        if (*linebegin == 'G')
+        {
+            // The z coordinate of large field cards is on the continuation line:
+            int numcoordsonline = (format == 2) ? 2 : 3;
+            for (int i = 0; i < numcoordsonline; i++)
+            {
+                double coord;
+                if (not(getfield(linebegin, lineend, format, 3+i, fb, fe)) || not(parsereal(fb, fe, coord)))
+                {
+                    output.errormessage = "could not read the coordinates of GRID card '"+std::string(linebegin, lineend)+"'";
+                    return;
+                }
+                output.coords.push_back(coord);
+            }
+            if (format == 2)
+                pendingcard = 1;
+            continue;
+        }
+
+        // Element card:
+        int typenumber, numvertices, groupnumber;
+        getfield(linebegin, lineend, format, 0, fb, fe);
+        if (not(translateelementname(fb, fe, typenumber, numvertices)))
+        {
+            output.errormessage = "unknown or unsupported Nastran element type '"+std::string(fb, fe)+"' (curved elements are not supported in .nas files, use the GMSH .msh format for curved elements)";
+            return;
+        }
+        if (not(getfield(linebegin, lineend, format, 2, fb, fe)) || not(parseint(fb, fe, groupnumber)))
+        {
+            output.errormessage = "could not read the property number of element card '"+std::string(linebegin, lineend)+"'";
+            return;
+        }
+        output.elems.push_back(typenumber);
+        output.elems.push_back(groupnumber);
+        output.elems.push_back(numvertices);
+
+        numvertsmissing = numvertices;
+        for (int i = 3; i <= countdatafields(format) && numvertsmissing > 0; i++)
+        {
+            int vertex;
+            if (not(getfield(linebegin, lineend, format, i, fb, fe)) || not(parseint(fb, fe, vertex)))
+                break;
+            output.elems.push_back(vertex-1);
+            numvertsmissing--;
+        }
+        if (numvertsmissing > 0)
+            pendingcard = 2;
+    }
+
+    if (pendingcard != 0)
+        output.errormessage = "incomplete card at the end of the file";
+}
+
+void nasreader::read(nodes& mynodes, elements& myelements, physicalregions& myphysicalregions)
+{
+    int numthreadstouse = std::min(mysize/1000000+1, (long long int)universe::getmaxnumthreads()); // require a min number of bytes per thread
+
+    // The chunk boundaries are moved forward to the beginning of the next card (continuation lines stay with their card):
+    const char* begin = mydata;
+    const char* end = mydata+mysize;
+
+    std::vector<const char*> bounds(numthreadstouse+1);
+    bounds[0] = begin;
+    bounds[numthreadstouse] = end;
+    for (int t = 1; t < numthreadstouse; t++)
+    {
+        const char* curbound = std::max(begin+(long long int)t*mysize/numthreadstouse, bounds[t-1]);
+        while (curbound < end)
+        {
+            const char* nextline = (const char*)std::memchr(curbound, '\n', end-curbound);
+            curbound = (nextline == NULL) ? end : nextline+1;
+            if (curbound < end && *curbound != '+' && *curbound != '*')
+                break;
+        }
+        bounds[t] = curbound;
+    }
+
+    std::vector<nasdata> chunkdata(numthreadstouse);
+
+    if (numthreadstouse == 1)
+        parsechunk(bounds[0], bounds[1], chunkdata[0]);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread([&](int tn){ parsechunk(bounds[tn], bounds[tn+1], chunkdata[tn]); }, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+
+    long long int numberofnodes = 0;
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        if (chunkdata[t].errormessage.size() > 0)
+            error(chunkdata[t].errormessage);
+        numberofnodes += chunkdata[t].coords.size()/3;
+    }
+
+
+    // Populate the nodes object:
+    mynodes.setnumber(numberofnodes);
+    std::vector<double>* nodecoordinates = mynodes.getcoordinates();
+
+    long long int ci = 0;
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        std::copy(chunkdata[t].coords.begin(), chunkdata[t].coords.end(), nodecoordinates->begin()+ci);
+        ci += chunkdata[t].coords.size();
+        chunkdata[t].coords = {};
+    }
+
+    // Add the elements in the order of the file:
+    std::vector<int> elementdimensions(8, -1);
+    std::vector<int> nodesincurrentelement;
+
+    int prevtypenumber = -1, prevgroupnumber = -1;
+    physicalregion* currentphysicalregion = NULL;
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        std::vector<int>& elems = chunkdata[t].elems;
+
+        long long int ei = 0;
+        while (ei < elems.size())
+        {
+            int curelemtypenum = elems[ei];
+            int curphysregnum = elems[ei+1];
+            int numvertices = elems[ei+2];
+
+            nodesincurrentelement.assign(elems.begin()+ei+3, elems.begin()+ei+3+numvertices);
+            for (int i = 0; i < numvertices; i++)
+            {
+                if (nodesincurrentelement[i] < 0 || nodesincurrentelement[i] >= numberofnodes)
+                    error("element with undefined node number "+std::to_string(nodesincurrentelement[i]+1));
+            }
+            ei += 3+numvertices;
+
+            if (curelemtypenum != prevtypenumber || curphysregnum != prevgroupnumber)
+            {
+                if (elementdimensions[curelemtypenum] == -1)
+                {
+                    element myelem(curelemtypenum);
+                    elementdimensions[curelemtypenum] = myelem.getelementdimension();
+                }
+                currentphysicalregion = myphysicalregions.get(universe::physregshift*(elementdimensions[curelemtypenum]+1) + curphysregnum);
+                prevtypenumber = curelemtypenum; prevgroupnumber = curphysregnum;
+            }
+
+            // Add the element and its physical region:
+            int elementindexincurrenttype = myelements.add(curelemtypenum, 1, nodesincurrentelement);
+            currentphysicalregion->addelement(curelemtypenum, elementindexincurrenttype);
+        }
+        elems = {};
+    }
+}
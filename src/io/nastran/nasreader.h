@@ -0,0 +1,81 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object reads the GRID and element cards of a Nastran .nas file in small field, large field
+// or free field format. On linux the file is memory mapped. It is split into chunks at the card
+// boundaries and every chunk is parsed in place (no line by line string allocation) by its own
+// thread. A first counting pass over each chunk preallocates the node and element arrays.
+
+
+#ifndef NASREADER_H
+#define NASREADER_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "nodes.h"
+#include "elements.h"
+#include "physicalregions.h"
+#include "physicalregion.h"
+#include "element.h"
+
+class nasreader
+{
+
+    private:
+
+        std::string myname;
+
+        const char* mydata = NULL;
+        long long int mysize = 0;
+        // Used instead of the memory map if not on linux:
+        std::vector<char> mybuffer = {};
+
+        // Nodes and elements found in a chunk of the file:
+        struct nasdata
+        {
+            // x, y and z coordinate of every GRID card:
+            std::vector<double> coords = {};
+            // Element type number, group number and vertices (zero based) of every element card:
+            std::vector<int> elems = {};
+            // Description of the first error found (empty if none):
+            std::string errormessage = "";
+        };
+
+        void error(std::string message);
+
+        // Parse all cards in the range (starts at a card and ends at a card or at the end of the file):
+        void parsechunk(const char* begin, const char* end, nasdata& output);
+
+        // Format of a card line: 1 for 'small', 2 for 'large' and 3 for 'free' (0 for any other line):
+        static int getlineformat(const char* linebegin, const char* lineend);
+        // Get the range of field 'index' of a line (false if the field is not on the line):
+        static bool getfield(const char* linebegin, const char* lineend, int format, int index, const char*& fieldbegin, const char*& fieldend);
+        // Number of data fields on a line (after the card name or continuation marker):
+        static int countdatafields(int format);
+
+        // Parse a value in the field range (false if empty or invalid). Nastran reals such as '1.5-3' are accepted:
+        static bool parseint(const char* begin, const char* end, int& value);
+        static bool parsereal(const char* begin, const char* end, double& value);
+
+        // Get the type number and number of vertices of an element card name (false if it is not supported):
+        static bool translateelementname(const char* begin, const char* end, int& typenumber, int& numvertices);
+
+    public:
+
+        nasreader(std::string name);
+        ~nasreader(void);
+
+        // The object owns the memory map:
+        nasreader(const nasreader&) = delete;
+        nasreader& operator=(const nasreader&) = delete;
+
+        // Load the mesh to the 'nodes', 'elements' and 'physicalregions' objects:
+        void read(nodes&, elements&, physicalregions&);
+
+};
+
+#endif
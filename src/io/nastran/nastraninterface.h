@@ -16,7 +16,7 @@
 #include <vector>
 #include "physicalregion.h"
 #include "element.h"
-#include "nasdataline.h"
+#include "nasreader.h"
 
 namespace nastraninterface
 {
@@ -1,4 +1,88 @@
 #include "pvinterface.h"
+#include "metrics.h"
+#include <thread>
+#include <cstdint>
+#include <cstring>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+
+// Append an array to the appended data section of a binary .vtu file and return its offset in the section.
+// Compressed arrays are split in blocks that are compressed independently (by multiple threads):
+static long long int appendtovtu(std::vector<char>& appended, const char* data, long long int numbytes, bool compress)
+{
+    long long int offset = appended.size();
+
+    if (compress == false)
+    {
+        uint64_t numbytesheader = numbytes;
+        appended.insert(appended.end(), (char*)&numbytesheader, (char*)&numbytesheader + sizeof(uint64_t));
+        appended.insert(appended.end(), data, data + numbytes);
+        return offset;
+    }
+
+    #ifdef HAVE_ZLIB
+    long long int blocksize = 1 << 20;
+    long long int numblocks = (numbytes + blocksize - 1) / blocksize;
+    long long int lastblocksize = numbytes - (numblocks - 1) * blocksize;
+    if (numblocks == 0)
+        lastblocksize = 0;
+
+    std::vector<std::vector<char>> compressedblocks(numblocks);
+
+    int numthreadstouse = std::min(numblocks/4 + 1, (long long int)universe::getmaxnumthreads());
+
+    auto compressblocks = [&](int t)
+    {
+        for (long long int b = t*numblocks/numthreadstouse; b < (t+1)*numblocks/numthreadstouse; b++)
+        {
+            uLong curblocksize = (b == numblocks-1) ? lastblocksize : blocksize;
+            uLongf compressedsize = compressBound(curblocksize);
+            compressedblocks[b].resize(compressedsize);
+            // The fastest compression level is used since the output is written once:
+            compress2((Bytef*)compressedblocks[b].data(), &compressedsize, (const Bytef*)(data + b*blocksize), curblocksize, Z_BEST_SPEED);
+            compressedblocks[b].resize(compressedsize);
+        }
+    };
+
+    if (numthreadstouse == 1)
+        compressblocks(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(compressblocks, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+
+    // Header is [number of blocks, block size, last block size, compressed size of every block]:
+    std::vector<uint64_t> header = {(uint64_t)numblocks, (uint64_t)blocksize, (uint64_t)lastblocksize};
+    for (long long int b = 0; b < numblocks; b++)
+        header.push_back(compressedblocks[b].size());
+
+    appended.insert(appended.end(), (char*)header.data(), (char*)(header.data() + header.size()));
+    for (long long int b = 0; b < numblocks; b++)
+        appended.insert(appended.end(), compressedblocks[b].begin(), compressedblocks[b].end());
+    #else
+    std::cout << "Error in 'pvinterface' namespace: zlib compressed .vtu output requires sparselizard to be compiled with zlib" << std::endl;
+    abort();
+    #endif
+
+    return offset;
+}
+
+// Append the values in double or single precision:
+static long long int appendtovtu(std::vector<char>& appended, std::vector<double>& values, bool isfloat32, bool compress)
+{
+    if (isfloat32 == false)
+        return appendtovtu(appended, (char*)values.data(), values.size()*sizeof(double), compress);
+
+    std::vector<float> floatvalues(values.begin(), values.end());
+    return appendtovtu(appended, (char*)floatvalues.data(), floatvalues.size()*sizeof(float), compress);
+}
 
 
 void pvinterface::writetovtkfile(std::string name, iodata datatowrite)
@@ -49,8 +133,8 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
     std::ofstream outfile (name.c_str());
     if (outfile.is_open())
     {
-        // To write all doubles with enough digits to the file:
-        outfile << std::setprecision(17);
+        // To write all doubles (or floats) with enough digits to the file:
+        outfile << std::setprecision(universe::isoutputfloat32 ? 9 : 17);
 
         // Write the header:
         outfile << "# vtk DataFile Version 4.2\n";
@@ -60,7 +144,7 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
 
         // Write the points section.
         int numnodes = datatowrite.countcoordnodes();
-        outfile << "POINTS " << numnodes << " double\n";
+        outfile << "POINTS " << numnodes << (universe::isoutputfloat32 ? " float\n" : " double\n");
         for (int tn = 0; tn < 8; tn++)
         {
             if (datatowrite.ispopulated(tn) == false)
@@ -76,7 +160,7 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
             {
                 for (int node = 0; node < curcoords[0].countcolumns(); node++)
                 {
-                    if (universe::isaxisymmetric)
+                    if (universe::getsession()->isaxisymmetric)
                         outfile << xvals[index] << " " << -zvals[index] << " " << yvals[index] << " ";
                     else
                         outfile << xvals[index] << " " << yvals[index] << " " << zvals[index] << " ";
@@ -138,7 +222,7 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
         // Write the scalar data section (if any):
         if (datatowrite.isscalar() == true)
         {
-            outfile << "SCALARS " << viewname << " double\n";
+            outfile << "SCALARS " << viewname << (universe::isoutputfloat32 ? " float\n" : " double\n");
             outfile << "LOOKUP_TABLE default" << "\n";
             for (int tn = 0; tn < 8; tn++)
             {
@@ -157,7 +241,7 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
         // Write the vector data section (if any):
         if (datatowrite.isscalar() == false)
         {
-            outfile << "VECTORS " << viewname << " double\n";
+            outfile << "VECTORS " << viewname << (universe::isoutputfloat32 ? " float\n" : " double\n");
             for (int tn = 0; tn < 8; tn++)
             {
                 if (datatowrite.ispopulated(tn) == false)
@@ -170,7 +254,7 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
 
                 for (int i = 0; i < vecdat[0].count(); i++)
                 {
-                    if (universe::isaxisymmetric)
+                    if (universe::getsession()->isaxisymmetric)
                         outfile << compxvals[i] << " " << -compzvals[i]  << " " << compyvals[i] << "\n";
                     else
                         outfile << compxvals[i] << " " << compyvals[i] << " " << compzvals[i] << "\n";
@@ -179,6 +263,8 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
             outfile << "\n";
         }
 
+        if (metrics::isenabled())
+            metrics::add("io_written_bytes_total", outfile.tellp());
         outfile.close();
     }
     else 
@@ -190,6 +276,12 @@ void pvinterface::writetovtkfile(std::string name, iodata datatowrite, int times
 
 void pvinterface::writetovtufile(std::string name, iodata datatowrite, int timestepindex)
 {
+    if (universe::vtuencoding != "ascii")
+    {
+        writetobinaryvtufile(name, datatowrite, timestepindex);
+        return;
+    }
+
     // Get the file name without the path and the .vtu extension:
     std::string viewname = gentools::getfilename(name);
 
@@ -200,8 +292,8 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
     std::ofstream outfile (name.c_str());
     if (outfile.is_open())
     {
-        // To write all doubles with enough digits to the file:
-        outfile << std::setprecision(17);
+        // To write all doubles (or floats) with enough digits to the file:
+        outfile << std::setprecision(universe::isoutputfloat32 ? 9 : 17);
         
         // Write the header:
         outfile << "<?xml version=\"1.0\"?>\n";
@@ -215,7 +307,7 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
             
         // Write the points section.
         outfile << "<Points>\n";
-        outfile << "<DataArray type=\"Float64\" Name=\"points\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+        outfile << "<DataArray type=\"" << (universe::isoutputfloat32 ? "Float32" : "Float64") << "\" Name=\"points\" NumberOfComponents=\"3\" format=\"ascii\">\n";
         
         for (int tn = 0; tn < 8; tn++)
         {
@@ -232,7 +324,7 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
             {
                 for (int node = 0; node < curcoords[0].countcolumns(); node++)
                 {
-                    if (universe::isaxisymmetric)
+                    if (universe::getsession()->isaxisymmetric)
                         outfile << xvals[index] << " " << -zvals[index] << " " << yvals[index] << "\n";
                     else
                         outfile << xvals[index] << " " << yvals[index] << " " << zvals[index] << "\n";
@@ -313,7 +405,7 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
         if (datatowrite.isscalar() == true)
         {
             outfile << "<PointData Scalars=\"" << viewname << "\">\n";
-            outfile << "<DataArray type=\"Float64\" Name=\"" << viewname << "\" format=\"ascii\">\n";
+            outfile << "<DataArray type=\"" << (universe::isoutputfloat32 ? "Float32" : "Float64") << "\" Name=\"" << viewname << "\" format=\"ascii\">\n";
             for (int tn = 0; tn < 8; tn++)
             {
                 if (datatowrite.ispopulated(tn) == false)
@@ -333,7 +425,7 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
         if (datatowrite.isscalar() == false)
         {
             outfile << "<PointData Vectors=\"" << viewname << "\">\n";
-            outfile << "<DataArray type=\"Float64\" Name=\"" << viewname << "\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+            outfile << "<DataArray type=\"" << (universe::isoutputfloat32 ? "Float32" : "Float64") << "\" Name=\"" << viewname << "\" NumberOfComponents=\"3\" format=\"ascii\">\n";
             for (int tn = 0; tn < 8; tn++)
             {
                 if (datatowrite.ispopulated(tn) == false)
@@ -346,7 +438,7 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
 
                 for (int i = 0; i < vecdat[0].count(); i++)
                 {
-                    if (universe::isaxisymmetric)
+                    if (universe::getsession()->isaxisymmetric)
                         outfile << compxvals[i] << " " << -compzvals[i]  << " " << compyvals[i] << "\n";
                     else
                         outfile << compxvals[i] << " " << compyvals[i] << " " << compzvals[i] << "\n";
@@ -360,6 +452,254 @@ void pvinterface::writetovtufile(std::string name, iodata datatowrite, int times
         outfile << "</UnstructuredGrid>\n";
         outfile << "</VTKFile>\n";
             
+        if (metrics::isenabled())
+            metrics::add("io_written_bytes_total", outfile.tellp());
+        outfile.close();
+    }
+    else 
+    {
+        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
+        abort();
+    }
+}
+
+void pvinterface::writetobinaryvtufile(std::string name, iodata datatowrite, int timestepindex)
+{
+    // Get the file name without the path and the .vtu extension:
+    std::string viewname = gentools::getfilename(name);
+
+    mystring myname(viewname);
+    viewname = myname.getstringwhileletter();
+
+    bool compress = (universe::vtuencoding == "zlib");
+    bool isfloat32 = universe::isoutputfloat32;
+    std::string realtype = isfloat32 ? "Float32" : "Float64";
+
+    int numnodes = datatowrite.countcoordnodes();
+    int numelems = datatowrite.countelements();
+    int numcomps = datatowrite.isscalar() ? 1 : 3;
+
+    // Gather all arrays to write:
+    std::vector<double> coords(3*numnodes);
+    std::vector<double> values(numcomps*numnodes);
+    std::vector<long long int> connectivity(numnodes);
+    std::vector<long long int> offsets(numelems);
+    std::vector<unsigned char> types(numelems);
+
+    int nodenum = 0, elemnum = 0;
+    for (int tn = 0; tn < 8; tn++)
+    {
+        if (datatowrite.ispopulated(tn) == false)
+            continue;
+
+        // Move from our node ordering to the one of ParaView:
+        element myelem(tn, datatowrite.getinterpolorder());
+        std::vector<int> reordering = getnodereordering(myelem.getcurvedtypenumber());
+        int pvtypenumber = converttoparaviewelementtypenumber(myelem.getcurvedtypenumber());
+
+        std::vector<densemat> curcoords = datatowrite.getcoordinates(tn,timestepindex);
+        std::vector<densemat> curdata = datatowrite.getdata(tn,timestepindex);
+
+        double* xvals = curcoords[0].getvalues();
+        double* yvals = curcoords[1].getvalues();
+        double* zvals = curcoords[2].getvalues();
+        std::vector<double*> datavals(numcomps);
+        for (int c = 0; c < numcomps; c++)
+            datavals[c] = curdata[c].getvalues();
+
+        int numelemsoftype = curcoords[0].countrows();
+        int numnodesperelem = curcoords[0].countcolumns();
+
+        int index = 0;
+        for (int elem = 0; elem < numelemsoftype; elem++)
+        {
+            for (int node = 0; node < numnodesperelem; node++)
+            {
+                int curnode = nodenum + node;
+
+                coords[3*curnode+0] = xvals[index];
+                if (universe::getsession()->isaxisymmetric)
+                {
+                    coords[3*curnode+1] = -zvals[index];
+                    coords[3*curnode+2] = yvals[index];
+                }
+                else
+                {
+                    coords[3*curnode+1] = yvals[index];
+                    coords[3*curnode+2] = zvals[index];
+                }
+
+                if (numcomps == 1)
+                    values[curnode] = datavals[0][index];
+                else
+                {
+                    values[3*curnode+0] = datavals[0][index];
+                    if (universe::getsession()->isaxisymmetric)
+                    {
+                        values[3*curnode+1] = -datavals[2][index];
+                        values[3*curnode+2] = datavals[1][index];
+                    }
+                    else
+                    {
+                        values[3*curnode+1] = datavals[1][index];
+                        values[3*curnode+2] = datavals[2][index];
+                    }
+                }
+
+                connectivity[curnode] = nodenum + reordering[node];
+
+                index++;
+            }
+            nodenum += numnodesperelem;
+
+            offsets[elemnum] = nodenum;
+            types[elemnum] = pvtypenumber;
+            elemnum++;
+        }
+    }
+
+    std::vector<char> appended;
+    long long int pointsoffset = appendtovtu(appended, coords, isfloat32, compress);
+    long long int connectivityoffset = appendtovtu(appended, (char*)connectivity.data(), connectivity.size()*sizeof(long long int), compress);
+    long long int offsetsoffset = appendtovtu(appended, (char*)offsets.data(), offsets.size()*sizeof(long long int), compress);
+    long long int typesoffset = appendtovtu(appended, (char*)types.data(), types.size(), compress);
+    long long int valuesoffset = appendtovtu(appended, values, isfloat32, compress);
+
+    // The raw data is written in the byte order of this machine:
+    int one = 1;
+    std::string byteorder = (*((char*)&one) == 1) ? "LittleEndian" : "BigEndian";
+
+    // 'file' cannot take a std::string argument --> name.c_str():
+    std::ofstream outfile (name.c_str(), std::ios::out | std::ios::binary);
+    if (outfile.is_open())
+    {
+        // Write the header:
+        outfile << "<?xml version=\"1.0\"?>\n";
+        outfile << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << byteorder << "\" header_type=\"UInt64\"";
+        if (compress)
+            outfile << " compressor=\"vtkZLibDataCompressor\"";
+        outfile << ">\n";
+        outfile << "<UnstructuredGrid>\n";
+        outfile << "<Piece NumberOfPoints=\"" << numnodes << "\" NumberOfCells=\"" << numelems << "\">\n";
+
+        outfile << "<Points>\n";
+        outfile << "<DataArray type=\"" << realtype << "\" Name=\"points\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << pointsoffset << "\"/>\n";
+        outfile << "</Points>\n";
+
+        outfile << "<Cells>\n";
+        outfile << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\"" << connectivityoffset << "\"/>\n";
+        outfile << "<DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\"" << offsetsoffset << "\"/>\n";
+        outfile << "<DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << typesoffset << "\"/>\n";
+        outfile << "</Cells>\n";
+
+        if (numcomps == 1)
+        {
+            outfile << "<PointData Scalars=\"" << viewname << "\">\n";
+            outfile << "<DataArray type=\"" << realtype << "\" Name=\"" << viewname << "\" format=\"appended\" offset=\"" << valuesoffset << "\"/>\n";
+        }
+        else
+        {
+            outfile << "<PointData Vectors=\"" << viewname << "\">\n";
+            outfile << "<DataArray type=\"" << realtype << "\" Name=\"" << viewname << "\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << valuesoffset << "\"/>\n";
+        }
+        outfile << "</PointData>\n";
+
+        outfile << "</Piece>\n";
+        outfile << "</UnstructuredGrid>\n";
+
+        // The raw data starts after the '_' character:
+        outfile << "<AppendedData encoding=\"raw\">\n_";
+        outfile.write(appended.data(), appended.size());
+        outfile << "\n</AppendedData>\n";
+        outfile << "</VTKFile>\n";
+
+        if (metrics::isenabled())
+            metrics::add("io_written_bytes_total", outfile.tellp());
+        outfile.close();
+    }
+    else 
+    {
+        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
+        abort();
+    }
+}
+
+void pvinterface::writetopvtufile(std::string name, iodata datatowrite)
+{
+    // Get the file name without the .pvtu extension:
+    std::string namenoext = name.substr(0, name.size()-5);
+
+    // Get all timesteps in 'datatowrite':
+    std::vector<double> timetags = datatowrite.gettimetags();
+
+    if (timetags.size() == 0)
+        writetopvtufile(name, datatowrite, -1);
+
+    for (int i = 0; i < timetags.size(); i++)
+    {
+        std::string curname = namenoext + "_" + std::to_string(i) + ".pvtu";
+        writetopvtufile(curname, datatowrite, i);
+    }
+}
+
+void pvinterface::writetopvtufile(std::string name, iodata datatowrite, int timestepindex)
+{
+    int rank = slmpi::getrank();
+    int numranks = slmpi::count();
+
+    // Get the file name without the .pvtu extension:
+    std::string namenoext = name.substr(0, name.size()-5);
+
+    // All ranks write their piece at the same time:
+    writetovtufile(namenoext + "_" + std::to_string(rank) + ".vtu", datatowrite, timestepindex);
+
+    if (rank != 0)
+        return;
+
+    // Same view name as in the pieces:
+    std::string viewname = gentools::getfilename(name);
+    mystring myname(viewname);
+    viewname = myname.getstringwhileletter();
+
+    // The pieces are referenced relative to the .pvtu file:
+    std::string piecenoext = namenoext.substr(namenoext.find_last_of('/')+1);
+
+    // 'file' cannot take a std::string argument --> name.c_str():
+    std::ofstream outfile (name.c_str());
+    // Same value type as in the pieces:
+    std::string realtype = universe::isoutputfloat32 ? "Float32" : "Float64";
+
+    if (outfile.is_open())
+    {
+        // Write the header:
+        outfile << "<?xml version=\"1.0\"?>\n";
+        outfile << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+        outfile << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+
+        outfile << "<PPoints>\n";
+        outfile << "<PDataArray type=\"" << realtype << "\" Name=\"points\" NumberOfComponents=\"3\"/>\n";
+        outfile << "</PPoints>\n";
+
+        if (datatowrite.isscalar() == true)
+        {
+            outfile << "<PPointData Scalars=\"" << viewname << "\">\n";
+            outfile << "<PDataArray type=\"" << realtype << "\" Name=\"" << viewname << "\"/>\n";
+        }
+        else
+        {
+            outfile << "<PPointData Vectors=\"" << viewname << "\">\n";
+            outfile << "<PDataArray type=\"" << realtype << "\" Name=\"" << viewname << "\" NumberOfComponents=\"3\"/>\n";
+        }
+        outfile << "</PPointData>\n";
+
+        for (int r = 0; r < numranks; r++)
+            outfile << "<Piece Source=\"" << piecenoext << "_" << r << ".vtu\"/>\n";
+
+        outfile << "</PUnstructuredGrid>\n";
+        outfile << "</VTKFile>\n";
+
+        if (metrics::isenabled())
+            metrics::add("io_written_bytes_total", outfile.tellp());
         outfile.close();
     }
     else 
@@ -403,6 +743,8 @@ void pvinterface::grouptopvdfile(std::string filename, std::vector<std::string>
         outfile << "</Collection>\n";
         outfile << "</VTKFile>\n";
     
+        if (metrics::isenabled())
+            metrics::add("io_written_bytes_total", outfile.tellp());
         outfile.close();
     }
     else 
@@ -20,6 +20,7 @@
 #include "element.h"
 #include "mystring.h"
 #include "universe.h"
+#include "slmpi.h"
 
 namespace pvinterface
 {
@@ -27,6 +28,11 @@ namespace pvinterface
     void writetovtufile(std::string name, iodata datatowrite);
     void writetovtkfile(std::string name, iodata datatowrite, int timestepindex);
     void writetovtufile(std::string name, iodata datatowrite, int timestepindex);
+    // Binary appended data .vtu file (optionally zlib compressed and in single precision, see 'universe::setvtuoutput'):
+    void writetobinaryvtufile(std::string name, iodata datatowrite, int timestepindex);
+    // Every rank writes its piece (.vtu file with the rank number appended) and rank 0 writes the .pvtu file referencing all pieces:
+    void writetopvtufile(std::string name, iodata datatowrite);
+    void writetopvtufile(std::string name, iodata datatowrite, int timestepindex);
     
     void grouptopvdfile(std::string filename, std::vector<std::string> filestogroup, std::vector<double> timevals);
     
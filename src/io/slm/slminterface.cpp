@@ -0,0 +1,252 @@
+#include "slminterface.h"
+#include "metrics.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// Increase the version number when the layout changes:
+static const char slmmagic[8] = {'S','L','M','E','S','H','\0','\0'};
+static const int slmversion = 1;
+
+template <typename T>
+void slminterface::writevector(std::ofstream& outfile, std::vector<T>& values)
+{
+    long long int len = values.size();
+    outfile.write((char*)&len, sizeof(long long int));
+    if (len > 0)
+        outfile.write((char*)values.data(), len*sizeof(T));
+}
+
+template <typename T>
+void slminterface::readvector(const char*& cursor, const char* end, std::vector<T>& values, std::string name, long long int expectedlength)
+{
+    long long int len = -1;
+    if (end-cursor >= sizeof(long long int))
+        std::memcpy(&len, cursor, sizeof(long long int));
+    if (len < 0 || (expectedlength >= 0 && len != expectedlength) || (end-cursor-sizeof(long long int))/sizeof(T) < len)
+    {
+        std::cout << "Error in 'slminterface' object: .slm file '" << name << "' is truncated or corrupted" << std::endl;
+        abort();
+    }
+    cursor += sizeof(long long int);
+
+    values.resize(len);
+    if (len > 0)
+        std::memcpy(values.data(), cursor, len*sizeof(T));
+    cursor += len*sizeof(T);
+}
+
+std::vector<int> slminterface::tointvector(std::vector<bool>& values)
+{
+    std::vector<int> output(values.size());
+    for (int i = 0; i < values.size(); i++)
+        output[i] = values[i];
+    return output;
+}
+
+std::vector<bool> slminterface::toboolvector(std::vector<int>& values)
+{
+    std::vector<bool> output(values.size());
+    for (int i = 0; i < values.size(); i++)
+        output[i] = (values[i] != 0);
+    return output;
+}
+
+void slminterface::writetofile(std::string name, nodes& mynodes, elements& myelements, disjointregions& mydisjointregions, physicalregions& myphysicalregions)
+{
+    std::ofstream outfile(name.c_str(), std::ios::out | std::ios::binary);
+    if (not(outfile.is_open()))
+    {
+        std::cout << "Unable to write mesh to file '" << name << "' or file not found" << std::endl;
+        abort();
+    }
+
+    outfile.write(slmmagic, 8);
+    // The sizes of the types are written to reject a file written on an incompatible platform:
+    std::vector<int> header = {slmversion, (int)sizeof(int), (int)sizeof(double), 1};
+    writevector(outfile, header);
+
+    ///// Nodes:
+    writevector(outfile, *mynodes.mycoordinates);
+
+    ///// Elements:
+    std::vector<int> curvatureorder = {myelements.mycurvatureorder};
+    writevector(outfile, curvatureorder);
+    std::vector<int> numsubelems(8*4);
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            writevector(outfile, (*myelements.mysubelementsinelements)[i][j]);
+            numsubelems[4*i+j] = myelements.numberofsubelementsineveryelement[i][j];
+        }
+    }
+    writevector(outfile, numsubelems);
+    for (int i = 0; i < 8; i++)
+    {
+        writevector(outfile, myelements.indisjointregion[i]);
+        writevector(outfile, myelements.totalorientations[i]);
+    }
+
+    ///// Disjoint regions:
+    writevector(outfile, mydisjointregions.rangebegin);
+    writevector(outfile, mydisjointregions.rangeend);
+    writevector(outfile, mydisjointregions.elementtypenumbers);
+    for (int i = 0; i < mydisjointregions.disjointregionsdefinition.size(); i++)
+    {
+        std::vector<int> curdef = tointvector(mydisjointregions.disjointregionsdefinition[i]);
+        writevector(outfile, curdef);
+    }
+
+    ///// Physical regions:
+    writevector(outfile, myphysicalregions.myphysicalregionnumbers);
+    for (int p = 0; p < myphysicalregions.myphysicalregions.size(); p++)
+    {
+        physicalregion* curpr = myphysicalregions.myphysicalregions[p].get();
+
+        std::vector<int> elemdim = {curpr->myelementdimension};
+        writevector(outfile, elemdim);
+        std::vector<int> includes = tointvector(curpr->includesdisjointregion);
+        writevector(outfile, includes);
+        for (int i = 0; i < 8; i++)
+            writevector(outfile, curpr->elementlist[i]);
+    }
+
+    if (metrics::isenabled())
+        metrics::add("io_written_bytes_total", outfile.tellp());
+    outfile.close();
+}
+
+void slminterface::readfromfile(std::string name, nodes& mynodes, elements& myelements, disjointregions& mydisjointregions, physicalregions& myphysicalregions)
+{
+    const char* filedata = NULL;
+    long long int filesize = 0;
+
+    #if defined(__linux__)
+    int fd = open(name.c_str(), O_RDONLY);
+    struct stat filestat;
+    if (fd == -1 || fstat(fd, &filestat) == -1)
+    {
+        std::cout << "Unable to read mesh file '" << name << "' or file not found" << std::endl;
+        abort();
+    }
+    filesize = filestat.st_size;
+    void* mapped = NULL;
+    if (filesize > 0)
+    {
+        mapped = mmap(NULL, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            std::cout << "Error in 'slminterface' object: could not memory map file '" << name << "'" << std::endl;
+            abort();
+        }
+        // The file is read once from beginning to end:
+        madvise(mapped, filesize, MADV_SEQUENTIAL);
+    }
+    close(fd);
+    filedata = (const char*)mapped;
+    #else
+    std::vector<char> buffer;
+    std::ifstream infile(name.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (not(infile.is_open()))
+    {
+        std::cout << "Unable to read mesh file '" << name << "' or file not found" << std::endl;
+        abort();
+    }
+    filesize = infile.tellg();
+    buffer.resize(filesize);
+    infile.seekg(0, std::ios::beg);
+    infile.read(buffer.data(), filesize);
+    infile.close();
+    filedata = buffer.data();
+    #endif
+
+    if (metrics::isenabled())
+        metrics::add("io_read_bytes_total", filesize);
+
+    const char* cursor = filedata;
+    const char* end = filedata+filesize;
+
+    std::vector<int> header;
+    if (filesize < 8 || std::memcmp(cursor, slmmagic, 8) != 0)
+    {
+        std::cout << "Error in 'slminterface' object: file '" << name << "' is not a .slm mesh file" << std::endl;
+        abort();
+    }
+    cursor += 8;
+    readvector(cursor, end, header, name, 4);
+    if (header[0] != slmversion || header[1] != sizeof(int) || header[2] != sizeof(double) || header[3] != 1)
+    {
+        std::cout << "Error in 'slminterface' object: .slm file '" << name << "' was written by an incompatible version or platform" << std::endl;
+        abort();
+    }
+
+    ///// Nodes:
+    readvector(cursor, end, *mynodes.getcoordinates(), name);
+
+    ///// Elements:
+    std::vector<int> curvatureorder;
+    readvector(cursor, end, curvatureorder, name, 1);
+    myelements.mycurvatureorder = curvatureorder[0];
+    myelements.makesubelementsunique();
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            readvector(cursor, end, (*myelements.mysubelementsinelements)[i][j], name);
+    }
+    std::vector<int> numsubelems;
+    readvector(cursor, end, numsubelems, name, 8*4);
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            myelements.numberofsubelementsineveryelement[i][j] = numsubelems[4*i+j];
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        readvector(cursor, end, myelements.indisjointregion[i], name);
+        readvector(cursor, end, myelements.totalorientations[i], name);
+    }
+
+    ///// Disjoint regions:
+    readvector(cursor, end, mydisjointregions.rangebegin, name);
+    readvector(cursor, end, mydisjointregions.rangeend, name, mydisjointregions.rangebegin.size());
+    readvector(cursor, end, mydisjointregions.elementtypenumbers, name, mydisjointregions.rangebegin.size());
+    int numdisjregs = mydisjointregions.elementtypenumbers.size();
+    mydisjointregions.disjointregionsdefinition = std::vector<std::vector<bool>>(numdisjregs);
+    for (int i = 0; i < numdisjregs; i++)
+    {
+        std::vector<int> curdef;
+        readvector(cursor, end, curdef, name);
+        mydisjointregions.disjointregionsdefinition[i] = toboolvector(curdef);
+    }
+
+    ///// Physical regions:
+    readvector(cursor, end, myphysicalregions.myphysicalregionnumbers, name);
+    int numphysregs = myphysicalregions.myphysicalregionnumbers.size();
+    myphysicalregions.myphysicalregions = std::vector<std::shared_ptr<physicalregion>>(numphysregs);
+    for (int p = 0; p < numphysregs; p++)
+    {
+        std::shared_ptr<physicalregion> curpr(new physicalregion(mydisjointregions, myphysicalregions, myphysicalregions.myphysicalregionnumbers[p]));
+
+        std::vector<int> elemdim, includes;
+        readvector(cursor, end, elemdim, name, 1);
+        curpr->myelementdimension = elemdim[0];
+        readvector(cursor, end, includes, name);
+        curpr->includesdisjointregion = toboolvector(includes);
+        curpr->updatedefinitionbits();
+        for (int i = 0; i < 8; i++)
+            readvector(cursor, end, curpr->elementlist[i], name);
+
+        myphysicalregions.myphysicalregions[p] = curpr;
+    }
+
+    #if defined(__linux__)
+    if (filesize > 0)
+        munmap((void*)filedata, filesize);
+    #endif
+}
@@ -0,0 +1,50 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object writes and reads the native binary .slm mesh format. The file holds the fully processed
+// mesh (exploded subelements, disjoint regions, orientations and physical regions) so that it can be
+// loaded without any further processing. On linux the file is memory mapped for reading.
+
+
+#ifndef SLMINTERFACE_H
+#define SLMINTERFACE_H
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include "nodes.h"
+#include "elements.h"
+#include "disjointregions.h"
+#include "physicalregion.h"
+#include "physicalregions.h"
+
+class slminterface
+{
+
+    private:
+
+        // Append the length (as a 64 bit integer) then the values to the file:
+        template <typename T>
+        static void writevector(std::ofstream& outfile, std::vector<T>& values);
+        // Read the length then the values at the cursor position and move the cursor right after.
+        // The length is checked if an expected length is provided.
+        template <typename T>
+        static void readvector(const char*& cursor, const char* end, std::vector<T>& values, std::string name, long long int expectedlength = -1);
+
+        static std::vector<int> tointvector(std::vector<bool>& values);
+        static std::vector<bool> toboolvector(std::vector<int>& values);
+
+    public:
+
+        // Write the fully processed mesh objects:
+        static void writetofile(std::string name, nodes&, elements&, disjointregions&, physicalregions&);
+        // Replace the content of the mesh objects by the processed mesh in the file:
+        static void readfromfile(std::string name, nodes&, elements&, disjointregions&, physicalregions&);
+
+};
+
+#endif
@@ -0,0 +1,296 @@
+#include "vectorstream.h"
+#include "metrics.h"
+
+
+// Size of the blocks written to the file:
+static const long long int vectorstreamblocksize = 1048576;
+// Total size of the .npy headers written (multiple of 64 as recommended by the format):
+static const int npyheadersize = 128;
+
+static bool islittleendian(void)
+{
+    int one = 1;
+    return (*((char*)&one) == 1);
+}
+
+bool vectorstream::isnpyfile(std::string filename)
+{
+    return (filename.size() >= 5 && filename.substr(filename.size()-4,4) == ".npy");
+}
+
+std::string vectorstream::getnpyheader(std::vector<long long int> shape)
+{
+    std::string dict = "{'descr': '" + std::string(islittleendian() ? "<f8" : ">f8") + "', 'fortran_order': False, 'shape': (";
+    for (int i = 0; i < shape.size(); i++)
+        dict += std::to_string(shape[i]) + ",";
+    if (shape.size() > 1)
+        dict.pop_back();
+    dict += "), }";
+
+    // Magic string, version 1.0 and the header length (little endian) come first:
+    int headerlen = npyheadersize - 10;
+    if (dict.size()+1 > headerlen)
+    {
+        std::cout << "Error in 'vectorstream' object: array too large for the .npy header" << std::endl;
+        abort();
+    }
+    dict.resize(headerlen-1, ' ');
+    dict += '\n';
+
+    std::string output = "\x93NUMPY";
+    output.push_back(1); output.push_back(0);
+    output.push_back(headerlen % 256); output.push_back(headerlen / 256);
+    
+    return output + dict;
+}
+
+vectorstream::vectorstream(std::string filename, char delimiter)
+{
+    myname = filename;
+    mydelimiter = delimiter;
+    isnpy = isnpyfile(filename);
+    
+    myfile.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (not(myfile.is_open()))
+    {
+        std::cout << "Unable to write vector to file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+    
+    mybuffer.reserve(vectorstreamblocksize + vectorstreamblocksize/4);
+    
+    // The header is rewritten with the right number of rows at the end:
+    if (isnpy)
+        mybuffer = getnpyheader({0,0});
+}
+
+vectorstream::~vectorstream(void)
+{
+    close();
+}
+
+void vectorstream::append(std::string& str, double value)
+{
+    char valstr[32];
+    int len = std::snprintf(valstr, sizeof(valstr), "%.17g", value);
+    str.append(valstr, len);
+}
+
+void vectorstream::flushifbig(void)
+{
+    if (mybuffer.size() < vectorstreamblocksize)
+        return;
+        
+    myfile.write(mybuffer.data(), mybuffer.size());
+    mybuffer.clear();
+}
+
+void vectorstream::write(const std::vector<double>& row)
+{
+    if (not(myfile.is_open()))
+    {
+        std::cout << "Error in 'vectorstream' object: cannot write to closed file " << myname << std::endl;
+        abort();
+    }
+    if (isnpy && mynumcols != -1 && row.size() != mynumcols)
+    {
+        std::cout << "Error in 'vectorstream' object: all rows written to .npy file " << myname << " must have the same length (expected " << mynumcols << " but got " << row.size() << ")" << std::endl;
+        abort();
+    }
+    mynumcols = row.size();
+    mynumrows++;
+    
+    if (isnpy)
+        mybuffer.append((const char*)row.data(), row.size()*sizeof(double));
+    else
+    {
+        for (int i = 0; i < row.size(); i++)
+        {
+            append(mybuffer, row[i]);
+            if (i < row.size()-1)
+                mybuffer.push_back(mydelimiter);
+        }
+        mybuffer.push_back('\n');
+    }
+    
+    flushifbig();
+}
+
+void vectorstream::write(const std::vector<std::vector<double>>& columns)
+{
+    if (columns.size() == 0)
+        return;
+        
+    long long int numrows = columns[0].size();
+    for (int c = 1; c < columns.size(); c++)
+    {
+        if (columns[c].size() != numrows)
+        {
+            std::cout << "Error in 'vectorstream' object: all columns to write must have the same size" << std::endl;
+            abort();
+        }
+    }
+    
+    std::vector<double> row(columns.size());
+    for (long long int r = 0; r < numrows; r++)
+    {
+        for (int c = 0; c < columns.size(); c++)
+            row[c] = columns[c][r];
+        write(row);
+    }
+}
+
+void vectorstream::close(void)
+{
+    if (not(myfile.is_open()))
+        return;
+        
+    myfile.write(mybuffer.data(), mybuffer.size());
+    mybuffer.clear();
+    
+    if (isnpy)
+    {
+        myfile.seekp(0);
+        std::string header = getnpyheader({mynumrows, std::max(mynumcols, 0LL)});
+        myfile.write(header.data(), header.size());
+    }
+    
+    myfile.close();
+    
+    if (myfile.fail())
+    {
+        std::cout << "Unable to write vector to file " << myname << " or file not found" << std::endl;
+        abort();
+    }
+}
+
+void vectorstream::writevector(std::string filename, const std::vector<double>& towrite, char delimiter, bool writesize)
+{
+    if (towrite.size() == 0)
+        return;
+        
+    std::ofstream outfile(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (not(outfile.is_open()))
+    {
+        std::cout << "Unable to write vector to file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+    
+    if (isnpyfile(filename))
+    {
+        std::string header = getnpyheader({(long long int)towrite.size()});
+        outfile.write(header.data(), header.size());
+        outfile.write((const char*)towrite.data(), towrite.size()*sizeof(double));
+        if (metrics::isenabled())
+            metrics::add("io_written_bytes_total", outfile.tellp());
+        outfile.close();
+        return;
+    }
+    
+    // Format block by block:
+    std::string buffer;
+    buffer.reserve(vectorstreamblocksize + 64);
+    
+    if (writesize)
+        buffer += std::to_string(towrite.size()) + delimiter;
+        
+    for (long long int i = 0; i < towrite.size(); i++)
+    {
+        append(buffer, towrite[i]);
+        if (i < towrite.size()-1)
+            buffer.push_back(delimiter);
+            
+        if (buffer.size() >= vectorstreamblocksize)
+        {
+            outfile.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    outfile.write(buffer.data(), buffer.size());
+    
+    if (metrics::isenabled())
+        metrics::add("io_written_bytes_total", outfile.tellp());
+    outfile.close();
+}
+
+std::vector<double> vectorstream::loadvector(std::string filename, char delimiter, bool sizeincluded)
+{
+    std::ifstream infile(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (not(infile.is_open()))
+    {
+        std::cout << "Unable to load vector from file " << filename << " or file not found" << std::endl;
+        abort();
+    }
+    long long int filesize = infile.tellg();
+    std::string content(filesize, '\0');
+    infile.seekg(0, std::ios::beg);
+    infile.read(&content[0], filesize);
+    infile.close();
+    
+    if (metrics::isenabled())
+        metrics::add("io_read_bytes_total", filesize);
+    
+    if (isnpyfile(filename))
+    {
+        // Only arrays of doubles in the native byte order are supported:
+        std::string descr = (islittleendian() ? "<f8" : ">f8");
+        if (filesize < 10 || content.compare(0, 6, "\x93NUMPY") != 0)
+        {
+            std::cout << "Error in 'vectorstream' object: file " << filename << " is not a .npy file" << std::endl;
+            abort();
+        }
+        long long int headerlen, datastart;
+        if (content[6] == 1)
+        {
+            headerlen = (unsigned char)content[8] + 256*(unsigned char)content[9];
+            datastart = 10 + headerlen;
+        }
+        else
+        {
+            headerlen = 0;
+            for (int i = 3; i >= 0; i--)
+                headerlen = 256*headerlen + (unsigned char)content[8+i];
+            datastart = 12 + headerlen;
+        }
+        std::string header = content.substr(0, std::min(datastart, filesize));
+        if (datastart > filesize || header.find(descr) == std::string::npos || header.find("'fortran_order': False") == std::string::npos)
+        {
+            std::cout << "Error in 'vectorstream' object: only C ordered .npy arrays of " << descr << " doubles can be loaded (file " << filename << ")" << std::endl;
+            abort();
+        }
+        
+        std::vector<double> output((filesize-datastart)/sizeof(double));
+        if (output.size() > 0)
+            std::memcpy(output.data(), content.data()+datastart, output.size()*sizeof(double));
+        return output;
+    }
+    
+    std::vector<double> output = {};
+    
+    const char* cur = content.c_str();
+    const char* end = cur + content.size();
+    
+    if (sizeincluded)
+    {
+        output.reserve(std::strtol(cur, NULL, 10));
+        cur = (const char*)std::memchr(cur, delimiter, end-cur);
+        cur = (cur == NULL) ? end : cur+1;
+    }
+    
+    while (cur < end)
+    {
+        const char* next = (const char*)std::memchr(cur, delimiter, end-cur);
+        if (next == NULL)
+            next = end;
+            
+        // Skip empty entries (e.g. a final newline):
+        char* parsedend;
+        double val = std::strtod(cur, &parsedend);
+        if (parsedend != cur && parsedend <= next)
+            output.push_back(val);
+            
+        cur = next+1;
+    }
+    
+    return output;
+}
@@ -0,0 +1,80 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object keeps a file open to write rows of values to it (e.g. the probe values at every
+// time step). The output is buffered and written to the file in large blocks.
+//
+// The file is a 2D NumPy array of doubles if the file name ends with .npy and a delimited text
+// file (one line per row) otherwise. All rows of a .npy file must have the same length. The
+// .npy header is updated when the file is closed (it is closed when the object is destroyed).
+//
+// The static functions write and load a whole vector at once in the same formats.
+
+
+#ifndef VECTORSTREAM_H
+#define VECTORSTREAM_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+class vectorstream
+{
+
+    private:
+
+        std::string myname;
+        std::ofstream myfile;
+        
+        char mydelimiter = ',';
+        bool isnpy = false;
+        
+        long long int mynumrows = 0;
+        long long int mynumcols = -1;
+
+        // Output not yet written to the file:
+        std::string mybuffer = "";
+        
+        void flushifbig(void);
+        
+        // The header is padded to a fixed size so that it can be rewritten when the number of rows changes:
+        static std::string getnpyheader(std::vector<long long int> shape);
+        static bool isnpyfile(std::string filename);
+
+    public:
+
+        // Create the file (an existing file is overwritten):
+        vectorstream(std::string filename, char delimiter = ',');
+        ~vectorstream(void);
+
+        // The object owns the open file:
+        vectorstream(const vectorstream&) = delete;
+        vectorstream& operator=(const vectorstream&) = delete;
+
+        // Append a row:
+        void write(const std::vector<double>& row);
+        // Append a row per entry in the columns (all columns must have the same size):
+        void write(const std::vector<std::vector<double>>& columns);
+        
+        long long int countrows(void) { return mynumrows; };
+
+        // Write everything to the file and close it:
+        void close(void);
+        
+        // Append 'value' in text with all significant digits:
+        static void append(std::string& str, double value);
+
+        // Write/load the whole vector (in text the size can be written first):
+        static void writevector(std::string filename, const std::vector<double>& towrite, char delimiter = ',', bool writesize = false);
+        static std::vector<double> loadvector(std::string filename, char delimiter = ',', bool sizeincluded = false);
+
+};
+
+#endif
@@ -0,0 +1,337 @@
+#include "xdmfinterface.h"
+
+#ifdef HAVE_HDF5
+#include "hdf5.h"
+#endif
+
+
+// Everything needed to rewrite the .xdmf file of a time series written during the run:
+class xdmftimeseries
+{
+    public:
+
+        bool isscalar = true;
+
+        std::vector<double> timevals = {};
+        // Mesh used at every time step:
+        std::vector<int> meshindexes = {};
+
+        // Number of nodes, elements and topology length of every mesh written:
+        std::vector<long long int> numnodes = {};
+        std::vector<long long int> numelems = {};
+        std::vector<long long int> topologylengths = {};
+        // Precision (4 or 8 bytes) of the coordinates of every mesh and of the values of every time step:
+        std::vector<int> meshprecisions = {};
+        std::vector<int> stepprecisions = {};
+
+        // Last mesh written (to detect a change):
+        std::vector<double> lastcoords = {};
+        std::vector<long long int> lasttopology = {};
+};
+
+static std::map<std::string, xdmftimeseries> xdmfwrittenseries;
+
+
+#ifndef HAVE_HDF5
+void xdmfinterface::writetofile(std::string name, iodata datatowrite, double timeval)
+{
+    std::cout << "Error in 'xdmfinterface' namespace: .xdmf output requires sparselizard to be compiled with HDF5" << std::endl;
+    abort();
+}
+#endif
+#ifdef HAVE_HDF5
+// Write a 'numrows' x 'numcols' dataset (the intermediate groups are created):
+static void writehdf5dataset(hid_t file, std::string path, hid_t type, const void* data, long long int numrows, long long int numcols)
+{
+    hsize_t dims[2] = {(hsize_t)numrows, (hsize_t)numcols};
+    hid_t space = H5Screate_simple(2, dims, NULL);
+    hid_t linkprops = H5Pcreate(H5P_LINK_CREATE);
+    H5Pset_create_intermediate_group(linkprops, 1);
+
+    hid_t dataset = H5Dcreate2(file, path.c_str(), type, space, linkprops, H5P_DEFAULT, H5P_DEFAULT);
+    if (dataset < 0)
+    {
+        std::cout << "Error in 'xdmfinterface' namespace: could not create HDF5 dataset '" << path << "'" << std::endl;
+        abort();
+    }
+    if (numrows*numcols > 0)
+        H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+
+    H5Dclose(dataset);
+    H5Pclose(linkprops);
+    H5Sclose(space);
+}
+
+// Write the values in double or in single precision:
+static void writehdf5dataset(hid_t file, std::string path, std::vector<double>& values, long long int numrows, long long int numcols, bool isfloat32)
+{
+    if (isfloat32 == false)
+    {
+        writehdf5dataset(file, path, H5T_NATIVE_DOUBLE, values.data(), numrows, numcols);
+        return;
+    }
+    std::vector<float> floatvalues(values.begin(), values.end());
+    writehdf5dataset(file, path, H5T_NATIVE_FLOAT, floatvalues.data(), numrows, numcols);
+}
+
+void xdmfinterface::writetofile(std::string name, iodata datatowrite, double timeval)
+{
+    // Get the file name without the .xdmf extension:
+    std::string namenoext = name.substr(0, name.size()-5);
+    std::string h5name = namenoext + ".h5";
+    // The HDF5 file is referenced relative to the .xdmf file:
+    std::string h5relativename = h5name.substr(h5name.find_last_of('/')+1);
+
+    // Get the file name without the path and the .xdmf extension:
+    std::string viewname = gentools::getfilename(name);
+    mystring myname(viewname);
+    viewname = myname.getstringwhileletter();
+
+    // The first write of the run overwrites the files:
+    bool isnewseries = (xdmfwrittenseries.count(name) == 0);
+    xdmftimeseries& series = xdmfwrittenseries[name];
+
+    if (not(isnewseries) && series.isscalar != datatowrite.isscalar())
+    {
+        std::cout << "Error in 'xdmfinterface' namespace: cannot append " << (datatowrite.isscalar() ? "scalar" : "vector") << " data to the time series in '" << name << "'" << std::endl;
+        abort();
+    }
+    series.isscalar = datatowrite.isscalar();
+
+    hid_t h5file;
+    if (isnewseries)
+        h5file = H5Fcreate(h5name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    else
+        h5file = H5Fopen(h5name.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    if (h5file < 0)
+    {
+        std::cout << "Unable to write to file " << h5name << " or file not found" << std::endl;
+        abort();
+    }
+
+    std::vector<double> timetags = datatowrite.gettimetags();
+    int numsteps = std::max((int)timetags.size(), 1);
+
+    long long int numnodes = datatowrite.countcoordnodes();
+    long long int numelems = datatowrite.countelements();
+    int numcomps = datatowrite.isscalar() ? 1 : 3;
+    bool isfloat32 = universe::isoutputfloat32;
+
+    for (int ts = 0; ts < numsteps; ts++)
+    {
+        int timestepindex = (timetags.size() == 0) ? -1 : ts;
+
+        std::vector<double> coords(3*numnodes);
+        std::vector<double> values(numcomps*numnodes);
+        std::vector<long long int> topology;
+        topology.reserve(numnodes+2*numelems);
+
+        long long int nodenum = 0;
+        for (int tn = 0; tn < 8; tn++)
+        {
+            if (datatowrite.ispopulated(tn) == false)
+                continue;
+
+            // XDMF uses the same node ordering as ParaView for these elements:
+            element myelem(tn, datatowrite.getinterpolorder());
+            std::vector<int> reordering = pvinterface::getnodereordering(myelem.getcurvedtypenumber());
+            int xdmftypenumber = converttoxdmfelementtypenumber(myelem.getcurvedtypenumber());
+
+            std::vector<densemat> curcoords = datatowrite.getcoordinates(tn,timestepindex);
+            std::vector<densemat> curdata = datatowrite.getdata(tn,timestepindex);
+
+            double* xvals = curcoords[0].getvalues();
+            double* yvals = curcoords[1].getvalues();
+            double* zvals = curcoords[2].getvalues();
+            std::vector<double*> datavals(numcomps);
+            for (int c = 0; c < numcomps; c++)
+                datavals[c] = curdata[c].getvalues();
+
+            int numelemsoftype = curcoords[0].countrows();
+            int numnodesperelem = curcoords[0].countcolumns();
+
+            int index = 0;
+            for (int elem = 0; elem < numelemsoftype; elem++)
+            {
+                topology.push_back(xdmftypenumber);
+                // Polyvertices and polylines are followed by their number of nodes:
+                if (xdmftypenumber == 1 || xdmftypenumber == 2)
+                    topology.push_back(numnodesperelem);
+
+                for (int node = 0; node < numnodesperelem; node++)
+                {
+                    long long int curnode = nodenum + node;
+
+                    coords[3*curnode+0] = xvals[index];
+                    if (universe::getsession()->isaxisymmetric)
+                    {
+                        coords[3*curnode+1] = -zvals[index];
+                        coords[3*curnode+2] = yvals[index];
+                    }
+                    else
+                    {
+                        coords[3*curnode+1] = yvals[index];
+                        coords[3*curnode+2] = zvals[index];
+                    }
+
+                    if (numcomps == 1)
+                        values[curnode] = datavals[0][index];
+                    else
+                    {
+                        values[3*curnode+0] = datavals[0][index];
+                        if (universe::getsession()->isaxisymmetric)
+                        {
+                            values[3*curnode+1] = -datavals[2][index];
+                            values[3*curnode+2] = datavals[1][index];
+                        }
+                        else
+                        {
+                            values[3*curnode+1] = datavals[1][index];
+                            values[3*curnode+2] = datavals[2][index];
+                        }
+                    }
+
+                    topology.push_back(nodenum + reordering[node]);
+
+                    index++;
+                }
+                nodenum += numnodesperelem;
+            }
+        }
+
+        // Write the mesh only if it has changed:
+        if (series.meshindexes.size() == 0 || coords != series.lastcoords || topology != series.lasttopology)
+        {
+            int meshindex = series.numnodes.size();
+            std::string meshpath = "/mesh" + std::to_string(meshindex);
+
+            writehdf5dataset(h5file, meshpath + "/coordinates", coords, numnodes, 3, isfloat32);
+            writehdf5dataset(h5file, meshpath + "/topology", H5T_NATIVE_LLONG, topology.data(), topology.size(), 1);
+
+            series.numnodes.push_back(numnodes);
+            series.numelems.push_back(numelems);
+            series.topologylengths.push_back(topology.size());
+            series.meshprecisions.push_back(isfloat32 ? 4 : 8);
+
+            series.lastcoords = coords;
+            series.lasttopology = topology;
+        }
+
+        int stepindex = series.timevals.size();
+        writehdf5dataset(h5file, "/data/step" + std::to_string(stepindex), values, numnodes, numcomps, isfloat32);
+        series.stepprecisions.push_back(isfloat32 ? 4 : 8);
+
+        series.meshindexes.push_back(series.numnodes.size()-1);
+        series.timevals.push_back(timetags.size() == 0 ? timeval : ts);
+    }
+
+    H5Fclose(h5file);
+
+    // Rewrite the whole (small) .xdmf file so that it is valid after every write:
+    std::ofstream outfile (name.c_str());
+    if (outfile.is_open())
+    {
+        // To write all doubles with enough digits to the file:
+        outfile << std::setprecision(17);
+
+        outfile << "<?xml version=\"1.0\"?>\n";
+        outfile << "<Xdmf Version=\"3.0\">\n";
+        outfile << "<Domain>\n";
+        outfile << "<Grid Name=\"" << viewname << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+        for (int s = 0; s < series.timevals.size(); s++)
+        {
+            int m = series.meshindexes[s];
+            std::string meshpath = h5relativename + ":/mesh" + std::to_string(m);
+
+            outfile << "<Grid Name=\"step" << s << "\" GridType=\"Uniform\">\n";
+            outfile << "<Time Value=\"" << series.timevals[s] << "\"/>\n";
+
+            outfile << "<Topology TopologyType=\"Mixed\" NumberOfElements=\"" << series.numelems[m] << "\">\n";
+            outfile << "<DataItem Dimensions=\"" << series.topologylengths[m] << "\" NumberType=\"Int\" Precision=\"8\" Format=\"HDF\">" << meshpath << "/topology</DataItem>\n";
+            outfile << "</Topology>\n";
+
+            outfile << "<Geometry GeometryType=\"XYZ\">\n";
+            outfile << "<DataItem Dimensions=\"" << series.numnodes[m] << " 3\" NumberType=\"Float\" Precision=\"" << series.meshprecisions[m] << "\" Format=\"HDF\">" << meshpath << "/coordinates</DataItem>\n";
+            outfile << "</Geometry>\n";
+
+            outfile << "<Attribute Name=\"" << viewname << "\" AttributeType=\"" << (series.isscalar ? "Scalar" : "Vector") << "\" Center=\"Node\">\n";
+            outfile << "<DataItem Dimensions=\"" << series.numnodes[m] << " " << (series.isscalar ? 1 : 3) << "\" NumberType=\"Float\" Precision=\"" << series.stepprecisions[s] << "\" Format=\"HDF\">" << h5relativename << ":/data/step" << s << "</DataItem>\n";
+            outfile << "</Attribute>\n";
+
+            outfile << "</Grid>\n";
+        }
+
+        outfile << "</Grid>\n";
+        outfile << "</Domain>\n";
+        outfile << "</Xdmf>\n";
+
+        outfile.close();
+    }
+    else
+    {
+        std::cout << "Unable to write to file " << name << " or file not found" << std::endl;
+        abort();
+    }
+}
+#endif
+
+int xdmfinterface::converttoxdmfelementtypenumber(int ourtypenumber)
+{
+    element myelement(ourtypenumber);
+
+    int order = myelement.getcurvatureorder();
+    int elemtypenumber = myelement.gettypenumber();
+
+    if (order == 1 || elemtypenumber == 0)
+    {
+        switch (elemtypenumber)
+        {
+            // Polyvertex:
+            case 0:
+                return 1;
+            // Polyline:
+            case 1:
+                return 2;
+            // Triangle:
+            case 2:
+                return 4;
+            // Quadrilateral:
+            case 3:
+                return 5;
+            // Tetrahedron:
+            case 4:
+                return 6;
+            // Hexahedron:
+            case 5:
+                return 9;
+            // Wedge:
+            case 6:
+                return 8;
+            // Pyramid:
+            case 7:
+                return 7;
+        }
+    }
+    if (order == 2)
+    {
+        switch (elemtypenumber)
+        {
+            // Edge_3:
+            case 1:
+                return 34;
+            // Tri_6:
+            case 2:
+                return 36;
+            // Quad_9:
+            case 3:
+                return 35;
+            // Tet_10:
+            case 4:
+                return 38;
+        }
+    }
+
+    std::cout << "Error in 'xdmfinterface' namespace: XDMF output is not available for " << myelement.gettypename() << " elements of order " << order << " (use the .vtu format)" << std::endl;
+    abort();
+}
@@ -0,0 +1,44 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This namespace writes time series to the XDMF format. The heavy data is written to an HDF5 file
+// next to the .xdmf file ('name.xdmf' --> 'name.h5'). The mesh topology and coordinates are only
+// written again when they have changed since the previous time step: a time step usually only
+// appends its data arrays to the HDF5 file.
+//
+// Every write to an .xdmf file that was already written during the run appends a time step.
+// The first write of a run overwrites the file. When the 'iodata' holds
+// several time steps they are all appended with their time step index as time value.
+//
+// XDMF only has element types up to order 2 and not for all element shapes: the supported elements
+// are all first order elements and the second order lines, triangles, quadrangles and tetrahedra.
+
+
+#ifndef XDMFINTERFACE_H
+#define XDMFINTERFACE_H
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <map>
+#include <iomanip>
+#include "densemat.h"
+#include "iodata.h"
+#include "element.h"
+#include "mystring.h"
+#include "universe.h"
+#include "pvinterface.h"
+
+namespace xdmfinterface
+{
+    // The time step is added at time 'timeval' (if the 'iodata' holds a single time step):
+    void writetofile(std::string name, iodata datatowrite, double timeval);
+
+    // XDMF comes with its own element type numbering for the 'Mixed' topology:
+    int converttoxdmfelementtypenumber(int ourtypenumber);
+};
+
+#endif
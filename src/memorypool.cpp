@@ -0,0 +1,135 @@
+#include "memorypool.h"
+
+
+std::atomic<int> memorypool::numactivepasses(0);
+std::atomic<long long int> memorypool::numrequests(0);
+std::atomic<long long int> memorypool::numsystemallocations(0);
+thread_local long long int memorypool::numbytesrequested = 0;
+int memorypool::maxbuffersperclass = 8;
+
+// Buffers in size class c can hold (1 + (c%4)/4) * 2^(c/4) values (at most 25% unused):
+long long int getclasscapacity(int sizeclass)
+{
+    return ((4LL + sizeclass%4) << (sizeclass/4)) / 4;
+}
+
+// Released buffers of a thread in each size class:
+template <typename T>
+class memorypoolbuffers
+{
+    public:
+        
+        std::vector<std::vector<T*>> buffers = std::vector<std::vector<T*>>(240);
+        
+        void clear(void)
+        {
+            for (int c = 0; c < buffers.size(); c++)
+            {
+                for (int i = 0; i < buffers[c].size(); i++)
+                    delete[] buffers[c][i];
+                buffers[c] = {};
+            }
+        };
+        
+        ~memorypoolbuffers(void) { clear(); };
+};
+
+thread_local memorypoolbuffers<double> doublebuffers;
+thread_local memorypoolbuffers<int> intbuffers;
+
+memorypoolbuffers<double>& getthreadbuffers(double* type) { return doublebuffers; }
+memorypoolbuffers<int>& getthreadbuffers(int* type) { return intbuffers; }
+
+template <typename T>
+std::shared_ptr<T> getbuffer(long long int size, std::atomic<long long int>& numsystemallocations)
+{
+    // Exact size buffers are not recycled (size class -1):
+    if (memorypool::isactive() == false)
+    {
+        numsystemallocations++;
+        return std::shared_ptr<T>(new T[size], [](T* ptr){ delete[] ptr; });
+    }
+    
+    int sizeclass = 0;
+    while (getclasscapacity(sizeclass) < size)
+        sizeclass++;
+    
+    T* ptr;
+    std::vector<T*>& available = getthreadbuffers((T*)NULL).buffers[sizeclass];
+    if (available.size() > 0)
+    {
+        ptr = available.back();
+        available.pop_back();
+    }
+    else
+    {
+        numsystemallocations++;
+        ptr = new T[getclasscapacity(sizeclass)];
+    }
+    
+    // The buffer is handed to the releasing thread if a pass is still active:
+    return std::shared_ptr<T>(ptr, [sizeclass](T* releasedptr)
+    {
+        if (memorypool::isactive())
+        {
+            std::vector<T*>& released = getthreadbuffers((T*)NULL).buffers[sizeclass];
+            if (released.size() < memorypool::maxbuffersperclass)
+            {
+                released.push_back(releasedptr);
+                return;
+            }
+        }
+        delete[] releasedptr;
+    });
+}
+
+void memorypool::startpass(void)
+{
+    numactivepasses++;
+}
+
+void memorypool::endpass(void)
+{
+    if (numactivepasses <= 0)
+    {
+        std::cout << "Error in 'memorypool' object: cannot end a pass that was not started" << std::endl;
+        abort();
+    }
+    numactivepasses--;
+    
+    if (numactivepasses == 0)
+        clear();
+}
+
+std::shared_ptr<double> memorypool::getdoubles(long long int size)
+{
+    numrequests++;
+    numbytesrequested += size*sizeof(double);
+    return getbuffer<double>(size, numsystemallocations);
+}
+
+std::shared_ptr<int> memorypool::getints(long long int size)
+{
+    numrequests++;
+    numbytesrequested += size*sizeof(int);
+    return getbuffer<int>(size, numsystemallocations);
+}
+
+void memorypool::clear(void)
+{
+    doublebuffers.clear();
+    intbuffers.clear();
+}
+
+void memorypool::resetcounters(void)
+{
+    numrequests = 0;
+    numsystemallocations = 0;
+}
+
+void memorypool::print(void)
+{
+    long long int numrecycled = numrequests - numsystemallocations;
+    
+    std::cout << "Memory pool: " << numrequests << " buffer requests, " << numsystemallocations << " system allocations, " << numrecycled << " recycled" << std::endl;
+}
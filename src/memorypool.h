@@ -0,0 +1,83 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object provides the value buffers of the 'densemat' and 'indexmat' objects.
+// While a pass (typically a matrix assembly) is active the released buffers are
+// kept in per-thread size classes (four per power of two) and recycled by later requests
+// instead of being returned to the system allocator.
+
+
+#ifndef MEMORYPOOL_H
+#define MEMORYPOOL_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+class memorypool
+{
+    private:
+        
+        // Number of passes currently active:
+        static std::atomic<int> numactivepasses;
+        
+        // Allocation counters:
+        static std::atomic<long long int> numrequests;
+        static std::atomic<long long int> numsystemallocations;
+        
+        // Number of bytes requested by the calling thread:
+        static thread_local long long int numbytesrequested;
+        
+    public:
+        
+        // Maximum number of buffers kept in each size class of each thread:
+        static int maxbuffersperclass;
+        
+        // Start and end a pass (passes can be nested). All kept buffers of the calling thread are freed when the last pass ends:
+        static void startpass(void);
+        static void endpass(void);
+        static bool isactive(void) { return (numactivepasses > 0); };
+        
+        // Get a buffer of at least 'size' values:
+        static std::shared_ptr<double> getdoubles(long long int size);
+        static std::shared_ptr<int> getints(long long int size);
+        
+        // Free all buffers kept by the calling thread:
+        static void clear(void);
+        
+        // Number of buffers requested and number of them that required a system allocation:
+        static long long int countrequests(void) { return numrequests; };
+        static long long int countsystemallocations(void) { return numsystemallocations; };
+        static void resetcounters(void);
+        // Number of bytes requested by the calling thread since it started (never reset):
+        static long long int countthreadbytes(void) { return numbytesrequested; };
+        // Print the counters:
+        static void print(void);
+        
+};
+
+// Allocator of the large vectors filled by multiple threads (csr arrays, field coefficients). A resize only
+// default-initializes the values instead of zeroing them. The memory pages are thus first written (and placed
+// on the numa node of the writing thread) by the threads that later use them rather than by the allocating thread.
+template <typename T>
+class uninitializedallocator : public std::allocator<T>
+{
+    public:
+        
+        template <typename U>
+        struct rebind { typedef uninitializedallocator<U> other; };
+        
+        uninitializedallocator(void) {};
+        template <typename U>
+        uninitializedallocator(const uninitializedallocator<U>& other) {};
+        
+        template <typename U>
+        void construct(U* ptr) { ::new((void*)ptr) U; };
+        template <typename U, typename... Args>
+        void construct(U* ptr, Args&&... args) { ::new((void*)ptr) U(std::forward<Args>(args)...); };
+};
+
+#endif
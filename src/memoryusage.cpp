@@ -0,0 +1,62 @@
+#include "memoryusage.h"
+#include <sstream>
+#include <iomanip>
+
+
+void memoryusage::add(std::string name, long long int numbytes)
+{
+    for (int i = 0; i < mynames.size(); i++)
+    {
+        if (mynames[i] == name)
+        {
+            mybytes[i] += numbytes;
+            return;
+        }
+    }
+    mynames.push_back(name);
+    mybytes.push_back(numbytes);
+}
+
+void memoryusage::add(std::string prefix, memoryusage other)
+{
+    for (int i = 0; i < other.count(); i++)
+        add(prefix + other.mynames[i], other.mybytes[i]);
+}
+
+long long int memoryusage::total(void)
+{
+    long long int output = 0;
+    for (int i = 0; i < mybytes.size(); i++)
+        output += mybytes[i];
+    return output;
+}
+
+void memoryusage::print(std::string title)
+{
+    std::cout << title << " (" << tostring(total()) << "):" << std::endl;
+    for (int i = 0; i < mynames.size(); i++)
+    {
+        if (mybytes[i] > 0)
+            std::cout << "  " << std::left << std::setw(48) << mynames[i] << " " << tostring(mybytes[i]) << std::endl;
+    }
+}
+
+std::string memoryusage::tostring(long long int numbytes)
+{
+    std::vector<std::string> units = {"B", "KB", "MB", "GB", "TB"};
+
+    double val = numbytes;
+    int u = 0;
+    while (val >= 1024 && u < units.size()-1)
+    {
+        val /= 1024;
+        u++;
+    }
+
+    std::stringstream ss;
+    if (u == 0)
+        ss << numbytes << " B";
+    else
+        ss << std::fixed << std::setprecision(1) << val << " " << units[u];
+    return ss.str();
+}
@@ -0,0 +1,64 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object holds the number of bytes used by the containers of a data structure.
+// The bytes of a vector are counted from its capacity. Containers shared with
+// copies (e.g. between the original and h-adapted meshes) are counted in every copy.
+
+
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+
+class memoryusage
+{
+    private:
+
+        std::vector<std::string> mynames = {};
+        std::vector<long long int> mybytes = {};
+
+    public:
+
+        memoryusage(void) {};
+
+        // Add an entry. Entries with the same name are summed:
+        void add(std::string name, long long int numbytes);
+        // Add all entries of another object with their name prefixed:
+        void add(std::string prefix, memoryusage other);
+
+        int count(void) { return mynames.size(); };
+        std::string getname(int index) { return mynames[index]; };
+        long long int getbytes(int index) { return mybytes[index]; };
+
+        long long int total(void);
+
+        // Print every entry and the total:
+        void print(std::string title);
+
+        // Human readable size (e.g. '12.3 MB'):
+        static std::string tostring(long long int numbytes);
+
+        // Number of bytes allocated by a vector (nested vectors are counted recursively):
+        template <typename T, typename A>
+        static long long int countbytes(const std::vector<T, A>& vec) { return vec.capacity()*sizeof(T); };
+        template <typename T, typename A>
+        static long long int countbytes(const std::vector<std::vector<T, A>>& vec);
+        static long long int countbytes(const std::vector<bool>& vec) { return vec.capacity()/8; };
+
+};
+
+template <typename T, typename A>
+long long int memoryusage::countbytes(const std::vector<std::vector<T, A>>& vec)
+{
+    long long int output = vec.capacity()*sizeof(std::vector<T, A>);
+    for (int i = 0; i < vec.size(); i++)
+        output += countbytes(vec[i]);
+    return output;
+}
+
+#endif
@@ -14,6 +14,9 @@
 class disjointregions
 {
 
+    // For the native .slm mesh format:
+    friend class slminterface;
+
     private:
         
         std::vector<int> rangebegin;
@@ -2,6 +2,9 @@
 #include "nodes.h"
 #include "elements.h"
 #include "physicalregions.h"
+#include <limits>
+#include <cmath>
+#include <algorithm>
 
 
 bool dtracker::isdefined(void)
@@ -186,6 +189,133 @@ std::vector<int> dtracker::discoversomeneighbours(int numtrialelements, std::vec
     return allnumelementsininterface;
 }
 
+std::vector<int> dtracker::discoverneighboursbyhashing(std::vector<double>& interfaceelembarys)
+{
+    int numranks = slmpi::count();
+    
+    int numelementsininterface = interfaceelembarys.size()/3;
+    
+    // Barycenters closer than this to a bucket boundary are also sent to the neighbour bucket (to be robust to round-off noise):
+    std::vector<double> eps = getrawmesh()->getnodes()->getnoisethreshold();
+    for (int c = 0; c < 3; c++)
+        eps[c] *= 10;
+    
+    // Global bounding box of the interface barycenters (mins are negated to only use a max reduction):
+    std::vector<double> bounds(6, -std::numeric_limits<double>::max());
+    for (int i = 0; i < numelementsininterface; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            bounds[c] = std::max(bounds[c], -interfaceelembarys[3*i+c]);
+            bounds[3+c] = std::max(bounds[3+c], interfaceelembarys[3*i+c]);
+        }
+    }
+    slmpi::max(bounds);
+    
+    // No rank has interface elements:
+    if (bounds[3] < -bounds[0])
+        return {};
+    
+    // Regular bucket grid with about one bucket per rank (only along the directions with a nonzero extent):
+    std::vector<double> mins = {-bounds[0], -bounds[1], -bounds[2]};
+    std::vector<double> extents = {bounds[3]-mins[0], bounds[4]-mins[1], bounds[5]-mins[2]};
+    int numactivedims = 0;
+    for (int c = 0; c < 3; c++)
+    {
+        if (extents[c] > eps[c])
+            numactivedims++;
+    }
+    int numbucketsperdim = (numactivedims == 0) ? 1 : std::max(1, (int)std::ceil(std::pow(numranks, 1.0/numactivedims)-1e-10));
+    std::vector<int> numbuckets(3, 1);
+    std::vector<double> bucketsizes = extents;
+    for (int c = 0; c < 3; c++)
+    {
+        if (extents[c] > eps[c])
+        {
+            numbuckets[c] = numbucketsperdim;
+            bucketsizes[c] = extents[c]/numbucketsperdim;
+        }
+    }
+    
+    // Send every barycenter to the owners of its buckets (once per owner):
+    std::vector<std::vector<double>> sends(numranks, std::vector<double>(0)), receives;
+    std::vector<int> lastsent(numranks, -1);
+    for (int i = 0; i < numelementsininterface; i++)
+    {
+        std::vector<int> lo(3, 0), hi(3, 0);
+        for (int c = 0; c < 3; c++)
+        {
+            if (numbuckets[c] == 1)
+                continue;
+            double relpos = interfaceelembarys[3*i+c]-mins[c];
+            lo[c] = std::min(std::max((int)std::floor((relpos-eps[c])/bucketsizes[c]), 0), numbuckets[c]-1);
+            hi[c] = std::min(std::max((int)std::floor((relpos+eps[c])/bucketsizes[c]), 0), numbuckets[c]-1);
+        }
+        
+        for (int bx = lo[0]; bx <= hi[0]; bx++)
+        {
+            for (int by = lo[1]; by <= hi[1]; by++)
+            {
+                for (int bz = lo[2]; bz <= hi[2]; bz++)
+                {
+                    int owner = ((bx*numbuckets[1]+by)*numbuckets[2]+bz) % numranks;
+                    if (lastsent[owner] == i)
+                        continue;
+                    lastsent[owner] = i;
+                    sends[owner].insert(sends[owner].end(), interfaceelembarys.begin()+3*i, interfaceelembarys.begin()+3*i+3);
+                }
+            }
+        }
+    }
+    slmpi::alltoall(sends, receives);
+    
+    // Match the barycenters received from different ranks:
+    std::vector<double> allbarys = {};
+    std::vector<int> sources = {};
+    for (int r = 0; r < numranks; r++)
+    {
+        allbarys.insert(allbarys.end(), receives[r].begin(), receives[r].end());
+        sources.insert(sources.end(), receives[r].size()/3, r);
+    }
+    std::vector<int> renumberingvector;
+    int numunique = gentools::removeduplicates(allbarys, renumberingvector);
+    
+    std::vector<std::vector<int>> sourcesinunique(numunique, std::vector<int>(0));
+    for (int i = 0; i < sources.size(); i++)
+    {
+        std::vector<int>* cur = &sourcesinunique[renumberingvector[i]];
+        if (std::find(cur->begin(), cur->end(), sources[i]) == cur->end())
+            cur->push_back(sources[i]);
+    }
+    
+    std::vector<std::vector<int>> neighboursofranks(numranks, std::vector<int>(0)), neighboursreceived;
+    for (int u = 0; u < numunique; u++)
+    {
+        for (int a = 0; a < sourcesinunique[u].size(); a++)
+        {
+            for (int b = 0; b < sourcesinunique[u].size(); b++)
+            {
+                if (a != b)
+                    neighboursofranks[sourcesinunique[u][a]].push_back(sourcesinunique[u][b]);
+            }
+        }
+    }
+    for (int r = 0; r < numranks; r++)
+    {
+        std::sort(neighboursofranks[r].begin(), neighboursofranks[r].end());
+        neighboursofranks[r].erase(std::unique(neighboursofranks[r].begin(), neighboursofranks[r].end()), neighboursofranks[r].end());
+    }
+    slmpi::alltoall(neighboursofranks, neighboursreceived);
+    
+    std::vector<int> neighboursfound = {};
+    for (int r = 0; r < numranks; r++)
+        neighboursfound.insert(neighboursfound.end(), neighboursreceived[r].begin(), neighboursreceived[r].end());
+    std::sort(neighboursfound.begin(), neighboursfound.end());
+    neighboursfound.erase(std::unique(neighboursfound.begin(), neighboursfound.end()), neighboursfound.end());
+    
+    return neighboursfound;
+}
+
 void dtracker::discoverinterfaces(std::vector<int> neighbours, std::vector<double>& interfaceelembarys, std::vector<int>& allnumelementsininterface, std::vector<int>& inneighbour)
 {
     int rank = slmpi::getrank();
@@ -311,7 +441,7 @@ bool dtracker::discovercrossinterfaces(std::vector<int>& interfacenodelist, std:
     }
     int numneighbours = neighbours.size();
     
-    std::vector<double>* ncs = nds->getcoordinates();
+    const std::vector<double>* ncs = nds->readcoordinates();
     std::vector<double>* edgebarys = els->getbarycenters(1);
     
     // For each neighbour pair make a container that stores all nodes/edges in the interface intersection.
@@ -519,7 +649,7 @@ void dtracker::exchangeoverlaps(void)
 
     int numranks = slmpi::count();
     
-    double* ncs = nds->getcoordinates()->data();
+    const double* ncs = nds->readcoordinates()->data();
     int curvatureorder = els->getcurvatureorder();
 
     int numneighbours = myneighbours.size();
@@ -788,7 +918,58 @@ void dtracker::exchangephysicalregions(void)
         }
         physreglistsforeachneighbour[n].resize(pi);
         
+        // Alternatively send, for each physical region found above, a packed bitset with one bit per element.
+        // This is much more compact when a few physical regions cover many elements and is used when smaller:
+        std::vector<int> regsinoverlap = {};
+        std::vector<int> regindex(isddmpr.size(), -1);
+        int numelemsinoverlap = 0;
+        for (int i = 0; i < 8; i++)
+            numelemsinoverlap += elemsininneroverlaps[n][i].size();
+        pi = 0;
+        for (int e = 0; e < numelemsinoverlap; e++)
+        {
+            for (int l = 0; l < physreglistsforeachneighbour[n][pi]; l++)
+            {
+                int cpr = physreglistsforeachneighbour[n][pi+1+l];
+                if (regindex[cpr] == -1)
+                {
+                    regindex[cpr] = regsinoverlap.size();
+                    regsinoverlap.push_back(cpr);
+                }
+            }
+            pi += 1+physreglistsforeachneighbour[n][pi];
+        }
+        int numregsinoverlap = regsinoverlap.size();
+        int packedsize = gentools::getpackedsize(numelemsinoverlap);
+        
+        bool usebitsets = (1 + numregsinoverlap + numregsinoverlap*packedsize < pi);
+        if (usebitsets)
+        {
+            std::vector<std::vector<bool>> isinreg(numregsinoverlap, std::vector<bool>(numelemsinoverlap, false));
+            pi = 0;
+            for (int e = 0; e < numelemsinoverlap; e++)
+            {
+                for (int l = 0; l < physreglistsforeachneighbour[n][pi]; l++)
+                    isinreg[regindex[physreglistsforeachneighbour[n][pi+1+l]]][e] = true;
+                pi += 1+physreglistsforeachneighbour[n][pi];
+            }
+            // Format is {numregs, reg0, reg1, ..., packed bits of reg0, packed bits of reg1, ...}:
+            physreglistsforeachneighbour[n] = std::vector<int>(1 + numregsinoverlap + numregsinoverlap*packedsize);
+            physreglistsforeachneighbour[n][0] = numregsinoverlap;
+            for (int r = 0; r < numregsinoverlap; r++)
+            {
+                physreglistsforeachneighbour[n][1+r] = regsinoverlap[r];
+                
+                std::vector<int> packed;
+                gentools::pack(isinreg[r], packed);
+                for (int k = 0; k < packedsize; k++)
+                    physreglistsforeachneighbour[n][1+numregsinoverlap+r*packedsize+k] = packed[k];
+            }
+        }
+        
         gentools::compresszeros(physreglistsforeachneighbour[n]);
+        // The first entry tells which format is sent:
+        physreglistsforeachneighbour[n].insert(physreglistsforeachneighbour[n].begin(), usebitsets ? 1 : 0);
         
         sendlens[n] = physreglistsforeachneighbour[n].size();
     }
@@ -805,8 +986,50 @@ void dtracker::exchangephysicalregions(void)
     std::vector<physicalregion*> allprs(prs->getmaxphysicalregionnumber()+1, NULL);
     for (int n = 0; n < numneighbours; n++)
     {
+        bool isbitset = (physreglistsfromeachneighbour[n][0] == 1);
+        physreglistsfromeachneighbour[n].erase(physreglistsfromeachneighbour[n].begin());
         gentools::decompresszeros(physreglistsfromeachneighbour[n]);
         
+        // Convert the packed bitsets back to the per element list format:
+        if (isbitset)
+        {
+            int numelemsinoverlap = 0;
+            for (int i = 0; i < 8; i++)
+                numelemsinoverlap += elemsinouteroverlaps[n][i].size();
+            int packedsize = gentools::getpackedsize(numelemsinoverlap);
+            
+            std::vector<int>* recdata = &(physreglistsfromeachneighbour[n]);
+            int numregsinoverlap = recdata->at(0);
+            
+            std::vector<std::vector<bool>> isinreg(numregsinoverlap);
+            int numentries = numelemsinoverlap;
+            for (int r = 0; r < numregsinoverlap; r++)
+            {
+                std::vector<int> packed(recdata->begin()+1+numregsinoverlap+r*packedsize, recdata->begin()+1+numregsinoverlap+(r+1)*packedsize);
+                gentools::unpack(numelemsinoverlap, packed, isinreg[r]);
+                for (int e = 0; e < numelemsinoverlap; e++)
+                    numentries += isinreg[r][e];
+            }
+            
+            std::vector<int> listformat(numentries);
+            int li = 0;
+            for (int e = 0; e < numelemsinoverlap; e++)
+            {
+                int numphysregsincurelem = 0;
+                for (int r = 0; r < numregsinoverlap; r++)
+                {
+                    if (isinreg[r][e])
+                    {
+                        listformat[li+1+numphysregsincurelem] = recdata->at(1+r);
+                        numphysregsincurelem++;
+                    }
+                }
+                listformat[li] = numphysregsincurelem;
+                li += 1+numphysregsincurelem;
+            }
+            physreglistsfromeachneighbour[n] = listformat;
+        }
+        
         int pi = 0;
         for (int i = 0; i < 8; i++)
         {
@@ -1725,32 +1948,9 @@ void dtracker::discoverconnectivity(int numtrialelements, int verbosity)
 
     std::vector<physicalregion*> physregsvec(3*numranks, NULL);
 
-    std::vector<int> allnei = {};
-
-    int numits = 0;
-    while (true)
-    {   
-        std::vector<double> elembarys;
-        els->getbarycenters(&interfaceelems, elembarys);
-        
-        std::vector<int> neighboursfound;
-        std::vector<int> allnumelementsininterface = discoversomeneighbours(numtrialelements, elembarys, neighboursfound);
-
-        if (allnumelementsininterface.size() == 0)
-            break;
-            
-        if (allnumelementsininterface == allnei)
-        {
-            std::cout << "Error in 'dtracker' object: connectivity discovery algorithm failed because some interface elements could not be found on any other domain" << std::endl;
-            abort();
-        }
-        allnei = allnumelementsininterface;
-        
-        // Discover the cell-1 dimension interfaces:
-        std::vector<int> inneighbour;
-        discoverinterfaces(neighboursfound, elembarys, allnumelementsininterface, inneighbour);
-        
-        // Add the matched elements to their physical region and remove them from the list:
+    // Add the matched elements to their physical region and remove them from the list:
+    auto addmatched = [&](std::vector<int>& inneighbour)
+    {
         int index = 0;
         for (int i = 0; i < 8; i++)
         {
@@ -1779,6 +1979,52 @@ void dtracker::discoverconnectivity(int numtrialelements, int verbosity)
             }
             interfaceelems[i].resize(numelemstokeep);
         }
+    };
+    
+    // Discover the cell-1 dimension interfaces with all neighbours at once:
+    std::vector<double> elembarys;
+    els->getbarycenters(&interfaceelems, elembarys);
+    
+    std::vector<int> neighboursfound = discoverneighboursbyhashing(elembarys);
+    
+    // Only the neighbours need the interface element count:
+    std::vector<int> allnumelementsininterface(numranks, 0);
+    std::vector<int> numforneighbours(neighboursfound.size(), elembarys.size()/3), numfromneighbours;
+    slmpi::exchange(neighboursfound, numforneighbours, numfromneighbours);
+    for (int n = 0; n < neighboursfound.size(); n++)
+        allnumelementsininterface[neighboursfound[n]] = numfromneighbours[n];
+    
+    std::vector<int> inneighbour;
+    discoverinterfaces(neighboursfound, elembarys, allnumelementsininterface, inneighbour);
+    addmatched(inneighbour);
+    
+    // Fall back to the trial element discovery for the interface elements left (if any):
+    std::vector<int> numleft = {0};
+    for (int i = 0; i < 8; i++)
+        numleft[0] += interfaceelems[i].size();
+    slmpi::max(numleft);
+    
+    std::vector<int> allnei = {};
+
+    int numits = 0;
+    while (numleft[0] > 0)
+    {   
+        els->getbarycenters(&interfaceelems, elembarys);
+        
+        allnumelementsininterface = discoversomeneighbours(numtrialelements, elembarys, neighboursfound);
+
+        if (allnumelementsininterface.size() == 0)
+            break;
+            
+        if (allnumelementsininterface == allnei)
+        {
+            std::cout << "Error in 'dtracker' object: connectivity discovery algorithm failed because some interface elements could not be found on any other domain" << std::endl;
+            abort();
+        }
+        allnei = allnumelementsininterface;
+        
+        discoverinterfaces(neighboursfound, elembarys, allnumelementsininterface, inneighbour);
+        addmatched(inneighbour);
 
         numits++;
     }
@@ -1875,7 +2121,7 @@ void dtracker::discoverconnectivity(int numtrialelements, int verbosity)
     }
     
     if (verbosity > 0)
-        std::cout << "Found all neighbours with " << numits << " set" << gentools::getplurals(numits) << " of " << numtrialelements << " trial element" << gentools::getplurals(numtrialelements) << " and " << numcrossits << " propagation step" << gentools::getplurals(numcrossits) << std::endl;
+        std::cout << "Found all neighbours with spatial hashing, " << numits << " additional set" << gentools::getplurals(numits) << " of " << numtrialelements << " trial element" << gentools::getplurals(numtrialelements) << " and " << numcrossits << " propagation step" << gentools::getplurals(numcrossits) << std::endl;
 }
 
 void dtracker::overlap(void)
@@ -61,6 +61,11 @@ class dtracker
         // The number of barycenters provided on all ranks is returned (if all zero an empty vector is returned).
         std::vector<int> discoversomeneighbours(int numtrialelements, std::vector<double>& interfaceelembarys, std::vector<int>& neighboursfound);
 
+        // Discover all neighbours sharing cell-1 dimension elements with this rank by a spatial hash rendezvous. The barycenters provided
+        // are only sent to the ranks owning their bucket in a regular grid over the global interface bounding box (about one bucket per rank).
+        // The bucket owners match the barycenters received from different ranks and return to every rank its neighbours.
+        std::vector<int> discoverneighboursbyhashing(std::vector<double>& interfaceelembarys);
+
         // Upon return 'inneighbours[i]' is the number of the neighbour touching the ith interface element (-1 if no neighbour touching).
         // The neighbours provided must be unique and sorted ascendingly. The number of interface elements for each rank must be provided in 'allnumelementsininterface'.
         void discoverinterfaces(std::vector<int> neighbours, std::vector<double>& interfaceelembarys, std::vector<int>& allnumelementsininterface, std::vector<int>& inneighbour);
@@ -1,5 +1,11 @@
 #include "elements.h"
 #include "geotools.h"
+#include "universe.h"
+#include "autotuning.h"
+#include <thread>
+#include <unordered_map>
+#include <cstdint>
+#include <algorithm>
 
 
 elements::elements(nodes& inputnodes, physicalregions& inputphysicalregions, disjointregions& inputdisjointregions)
@@ -15,11 +21,44 @@ disjointregions* elements::getdisjointregions(void) {return mydisjointregions;}
 
 int elements::add(int elementtypenumber, int curvatureorder, std::vector<int>& nodelist)
 {
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     // Point elements have a number equal to the node defining them
     // and should not be added to 'subelementsinelements'.
     if (elementtypenumber == 0)
         return nodelist[0];
 
+    setcurvatureorder(curvatureorder);
+        
+    subelementsinelements[elementtypenumber][0].insert(subelementsinelements[elementtypenumber][0].end(), nodelist.begin(), nodelist.end());
+    return subelementsinelements[elementtypenumber][0].size()/nodelist.size() - 1;
+}
+
+int* elements::addblock(int elementtypenumber, int curvatureorder, int numelems, int& firstelement)
+{
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    
+    if (elementtypenumber == 0)
+    {
+        std::cout << "Error in 'elements' object: cannot add a block of point elements" << std::endl;
+        abort();
+    }
+    
+    setcurvatureorder(curvatureorder);
+    
+    int numcurvednodes = numberofsubelementsineveryelement[elementtypenumber][0];
+    std::vector<int>& curvednodes = subelementsinelements[elementtypenumber][0];
+    
+    long long int previoussize = curvednodes.size();
+    firstelement = previoussize/numcurvednodes;
+    curvednodes.resize(previoussize + (long long int)numelems*numcurvednodes);
+    
+    return curvednodes.data() + previoussize;
+}
+
+void elements::setcurvatureorder(int curvatureorder)
+{
     // Define the curvature order for the first time:
     if (mycurvatureorder == -1)
     {
@@ -40,9 +79,12 @@ int elements::add(int elementtypenumber, int curvatureorder, std::vector<int>& n
         std::cout << "Error in 'elements' object: the mesh can contain only a single curvature order." << std::endl;
         abort();
     }
-        
-    subelementsinelements[elementtypenumber][0].insert(subelementsinelements[elementtypenumber][0].end(), nodelist.begin(), nodelist.end());
-    return subelementsinelements[elementtypenumber][0].size()/nodelist.size() - 1;
+}
+
+void elements::makesubelementsunique(void)
+{
+    if (mysubelementsinelements.use_count() > 1)
+        mysubelementsinelements = std::shared_ptr<std::vector<std::vector<std::vector<int>>>>(new std::vector<std::vector<std::vector<int>>>(*mysubelementsinelements));
 }
 
 void elements::cleancoordinatedependentcontainers(void)
@@ -50,10 +92,84 @@ void elements::cleancoordinatedependentcontainers(void)
     barycenters = std::vector<std::vector<double>>(8, std::vector<double>(0));
     sphereradius = std::vector<std::vector<double>>(8, std::vector<double>(0));
     boxdimensions = std::vector<std::vector<double>>(8, std::vector<double>(0));
+    trees = std::vector<std::shared_ptr<elementtree>>(8, NULL);
+}
+
+void elements::cleancoordinatedependentcontainers(std::vector<bool>& ismovednode)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        // Nothing to update if the containers are not populated (the trees require the barycenters):
+        if (barycenters[i].size() == 0)
+            continue;
+        
+        element myelement(i, mycurvatureorder);
+        int nn = myelement.countnodes();
+        int ncn = myelement.countcurvednodes();
+        double invnn = 1.0/nn;
+        
+        bool isanymoved = false;
+        for (int e = 0; e < count(i); e++)
+        {
+            bool ismoved = false;
+            for (int n = 0; n < ncn; n++)
+            {
+                if (ismovednode[getsubelement(0, i, e, n)])
+                {
+                    ismoved = true;
+                    break;
+                }
+            }
+            if (not(ismoved))
+                continue;
+            isanymoved = true;
+            
+            std::vector<double> nodecoords = getnodecoordinates(i, e);
+            
+            double bary[3] = {0.0, 0.0, 0.0};
+            for (int n = 0; n < nn; n++)
+            {
+                for (int c = 0; c < 3; c++)
+                    bary[c] += nodecoords[3*n+c];
+            }
+            for (int c = 0; c < 3; c++)
+                barycenters[i][3*e+c] = invnn*bary[c];
+            
+            if (sphereradius[i].size() > 0)
+            {
+                double maxdist = 0;
+                for (int n = 0; n < ncn; n++)
+                {
+                    double curdist = std::sqrt( std::pow(barycenters[i][3*e+0]-nodecoords[3*n+0], 2) + std::pow(barycenters[i][3*e+1]-nodecoords[3*n+1], 2) + std::pow(barycenters[i][3*e+2]-nodecoords[3*n+2], 2) );
+                    if (curdist > maxdist)
+                        maxdist = curdist;
+                }
+                sphereradius[i][e] = maxdist;
+            }
+            if (boxdimensions[i].size() > 0)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    double maxdist = 0;
+                    for (int n = 0; n < ncn; n++)
+                    {
+                        double curdist = std::abs(barycenters[i][3*e+c]-nodecoords[3*n+c]);
+                        if (curdist > maxdist)
+                            maxdist = curdist;
+                    }
+                    boxdimensions[i][3*e+c] = maxdist;
+                }
+            }
+        }
+        
+        if (isanymoved)
+            trees[i] = NULL;
+    }
 }
 
 int elements::getsubelement(int subelementtypenumber, int elementtypenumber, int elementnumber, int subelementindex)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     if (elementtypenumber == subelementtypenumber)
         return elementnumber;
     else
@@ -83,6 +199,7 @@ int elements::gettotalorientation(int elementtypenumber, int elementnumber)
 
 std::vector<bool> elements::isflipped(int subelementtypenumber, std::vector<int>& subelementnumbers, int elementtypenumber, std::vector<int>& elementnumbers)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     int numelems = elementnumbers.size();
     std::vector<bool> output(numelems, false);
 
@@ -191,6 +308,7 @@ int elements::istypeinelementlists(int elementtypenumber, std::vector<std::vecto
 
 int elements::count(int elementtypenumber)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     if (elementtypenumber == 0)
         return mynodes->count();
     
@@ -238,6 +356,7 @@ int elements::getcurvatureorder(void)
 
 void elements::populateedgesatnodes(void)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     // Get the number of nodes:
     int numnodes = count(0);
     // Get the number of edges:
@@ -386,9 +505,70 @@ std::vector<int> elements::getcellsontype(int subtype, int subnumber)
     return output;
 }
 
+regionbits* elements::getsubelementbits(int subtype, int disjreg)
+{
+    int numdisjregs = mydisjointregions->count();
+    
+    if (subelementbits[subtype].size() != numdisjregs)
+    {
+        const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    
+        subelementbits[subtype] = std::vector<regionbits>(numdisjregs);
+        int numsubs = count(subtype);
+        
+        // Every thread processes a block of disjoint regions:
+        int numthreadstouse = std::min(numdisjregs, universe::getmaxnumthreads());
+        
+        auto computebits = [&](int t)
+        {
+            int firstdr = (long long int)t*numdisjregs/numthreadstouse;
+            int lastdr = (long long int)(t+1)*numdisjregs/numthreadstouse;
+            
+            for (int d = firstdr; d < lastdr; d++)
+            {
+                regionbits& curbits = subelementbits[subtype][d];
+                curbits = regionbits(numsubs, false);
+            
+                int typenum = mydisjointregions->getelementtypenumber(d);
+                int rb = mydisjointregions->getrangebegin(d);
+                int numelems = mydisjointregions->countelements(d);
+                
+                if (typenum == subtype)
+                {
+                    for (int e = 0; e < numelems; e++)
+                        curbits.set(rb+e);
+                    continue;
+                }
+                
+                int ns = numberofsubelementsineveryelement[typenum][subtype];
+                if (typenum < subtype || ns == 0)
+                    continue;
+                    
+                const std::vector<int>& subs = subelementsinelements[typenum][subtype];
+                for (long long int i = (long long int)rb*ns; i < (long long int)(rb+numelems)*ns; i++)
+                    curbits.set(subs[i]);
+            }
+        };
+        
+        if (numthreadstouse <= 1)
+            computebits(0);
+        else
+        {
+            std::vector<std::thread> threadobjs(numthreadstouse);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t] = universe::newthread(computebits, t);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t].join();
+        }
+    }
+    
+    return &(subelementbits[subtype][disjreg]);
+}
+
 std::vector<double> elements::getnodecoordinates(int elementtypenumber, int elementnumber, int xyz)
 {
-    std::vector<double>* nodecoordinates = mynodes->getcoordinates();
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    const std::vector<double>* nodecoordinates = mynodes->readcoordinates();
     
     if (elementtypenumber == 0)
         return {nodecoordinates->at(3*elementnumber+xyz)};
@@ -406,7 +586,8 @@ std::vector<double> elements::getnodecoordinates(int elementtypenumber, int elem
 
 std::vector<double> elements::getnodecoordinates(int elementtypenumber, int elementnumber)
 {
-    std::vector<double>* nodecoordinates = mynodes->getcoordinates();
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    const std::vector<double>* nodecoordinates = mynodes->readcoordinates();
     
     if (elementtypenumber == 0)
         return {nodecoordinates->at(3*elementnumber+0), nodecoordinates->at(3*elementnumber+1), nodecoordinates->at(3*elementnumber+2)};
@@ -427,6 +608,45 @@ std::vector<double> elements::getnodecoordinates(int elementtypenumber, int elem
     return nodecoords;
 }
 
+void elements::getnodecoordinates(int elementtypenumber, std::vector<int>& elementnumbers, std::vector<double>& coords)
+{
+    const std::vector<double>* nodecoordinates = mynodes->readcoordinates();
+    const double* nodecoordsptr = nodecoordinates->data();
+    
+    int numelems = elementnumbers.size();
+    
+    if (elementtypenumber == 0)
+    {
+        coords.resize(3*numelems);
+        for (int e = 0; e < numelems; e++)
+        {
+            for (int c = 0; c < 3; c++)
+                coords[3*e+c] = nodecoordsptr[3*elementnumbers[e]+c];
+        }
+        return;
+    }
+    
+    element myelement(elementtypenumber, mycurvatureorder);
+    int curvednumberofnodes = myelement.countcurvednodes();
+    
+    const int* elemnodes = (*mysubelementsinelements)[elementtypenumber][0].data();
+    
+    coords.resize(3*(long long int)numelems*curvednumberofnodes);
+    double* coordsptr = coords.data();
+    for (int e = 0; e < numelems; e++)
+    {
+        const int* curnodes = elemnodes + (long long int)elementnumbers[e]*curvednumberofnodes;
+        for (int node = 0; node < curvednumberofnodes; node++)
+        {
+            const double* curcoords = nodecoordsptr + 3*(long long int)curnodes[node];
+            coordsptr[0] = curcoords[0];
+            coordsptr[1] = curcoords[1];
+            coordsptr[2] = curcoords[2];
+            coordsptr += 3;
+        }
+    }
+}
+
 void elements::getrefcoordsondisjregs(int origintype, std::vector<int>& elems, std::vector<double>& refcoords, std::vector<int> targetdisjregs, std::vector<int>& targetelems, std::vector<double>& targetrefcoords)
 {
     std::vector<int> renumtoelems(count(origintype), -1);
@@ -517,24 +737,43 @@ std::vector<double>* elements::getsphereradius(int elementtypenumber)
     // If not yet populated for the element type:
     if (sphereradius[elementtypenumber].size() == 0)
     {
-        sphereradius[elementtypenumber].resize(count(elementtypenumber));
+        int numel = count(elementtypenumber);
+        sphereradius[elementtypenumber].resize(numel);
+        
+        // Every thread processes a block of elements:
+        int numthreadstouse = autotuning::getnumthreadsforitems(numel); // require a min num elements per thread
     
-        for (int i = 0; i < count(elementtypenumber); i++)
+        auto computeradius = [&](int t)
         {
-            double maxdist = 0;
-        
-            std::vector<double> xnodes = getnodecoordinates(elementtypenumber, i, 0);
-            std::vector<double> ynodes = getnodecoordinates(elementtypenumber, i, 1);
-            std::vector<double> znodes = getnodecoordinates(elementtypenumber, i, 2);
+            int firstel = (long long int)t*numel/numthreadstouse;
+            int lastel = (long long int)(t+1)*numel/numthreadstouse;
             
-            for (int j = 0; j < xnodes.size(); j++)
+            for (int i = firstel; i < lastel; i++)
             {
-                double curdist = std::sqrt( std::pow(mybarys->at(3*i+0)-xnodes[j], 2) + std::pow(mybarys->at(3*i+1)-ynodes[j], 2) + std::pow(mybarys->at(3*i+2)-znodes[j], 2) );
-                if (curdist > maxdist)
-                    maxdist = curdist;
-            }
+                double maxdist = 0;
             
-            sphereradius[elementtypenumber][i] = maxdist;
+                std::vector<double> nodecoords = getnodecoordinates(elementtypenumber, i);
+                
+                for (int j = 0; j < nodecoords.size()/3; j++)
+                {
+                    double curdist = std::sqrt( std::pow(mybarys->at(3*i+0)-nodecoords[3*j+0], 2) + std::pow(mybarys->at(3*i+1)-nodecoords[3*j+1], 2) + std::pow(mybarys->at(3*i+2)-nodecoords[3*j+2], 2) );
+                    if (curdist > maxdist)
+                        maxdist = curdist;
+                }
+                
+                sphereradius[elementtypenumber][i] = maxdist;
+            }
+        };
+        
+        if (numthreadstouse == 1)
+            computeradius(0);
+        else
+        {
+            std::vector<std::thread> threadobjs(numthreadstouse);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t] = universe::newthread(computeradius, t);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t].join();
         }
     }
     
@@ -548,29 +787,78 @@ std::vector<double>* elements::getboxdimensions(int elementtypenumber)
     // If not yet populated for the element type:
     if (boxdimensions[elementtypenumber].size() == 0)
     {
-        boxdimensions[elementtypenumber].resize(3*count(elementtypenumber));
+        int numel = count(elementtypenumber);
+        boxdimensions[elementtypenumber].resize(3*numel);
+        
+        // Every thread processes a block of elements:
+        int numthreadstouse = autotuning::getnumthreadsforitems(numel); // require a min num elements per thread
     
-        for (int i = 0; i < count(elementtypenumber); i++)
+        auto computebox = [&](int t)
         {
-            for (int c = 0; c < 3; c++)
+            int firstel = (long long int)t*numel/numthreadstouse;
+            int lastel = (long long int)(t+1)*numel/numthreadstouse;
+            
+            for (int i = firstel; i < lastel; i++)
             {
-                std::vector<double> curnodescoords = getnodecoordinates(elementtypenumber, i, c);
+                std::vector<double> nodecoords = getnodecoordinates(elementtypenumber, i);
                 
-                double maxdist = 0;
-                for (int j = 0; j < curnodescoords.size(); j++)
+                for (int c = 0; c < 3; c++)
                 {
-                    double curdist = std::abs(mybarys->at(3*i+c)-curnodescoords[j]);
-                    if (curdist > maxdist)
-                        maxdist = curdist;
+                    double maxdist = 0;
+                    for (int j = 0; j < nodecoords.size()/3; j++)
+                    {
+                        double curdist = std::abs(mybarys->at(3*i+c)-nodecoords[3*j+c]);
+                        if (curdist > maxdist)
+                            maxdist = curdist;
+                    }
+                    boxdimensions[elementtypenumber][3*i+c] = maxdist;
                 }
-                boxdimensions[elementtypenumber][3*i+c] = maxdist;
             }
+        };
+        
+        if (numthreadstouse == 1)
+            computebox(0);
+        else
+        {
+            std::vector<std::thread> threadobjs(numthreadstouse);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t] = universe::newthread(computebox, t);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t].join();
         }
     }
     
     return &(boxdimensions[elementtypenumber]);
 }
 
+elementtree* elements::gettree(int elementtypenumber)
+{
+    // If not yet built for the element type:
+    if (trees[elementtypenumber] == NULL)
+    {
+        std::vector<double>* mybarys = getbarycenters(elementtypenumber);
+        std::vector<double>* myboxdims = getboxdimensions(elementtypenumber);
+        
+        // Curved elements can bulge out of the box of their nodes:
+        double alpha = 1.0+1.0e-8;
+        if (mycurvatureorder > 1)
+            alpha = 1.1;
+        
+        std::vector<double> halfsizes(myboxdims->size());
+        for (int i = 0; i < count(elementtypenumber); i++)
+        {
+            double curx = alpha*myboxdims->at(3*i+0), cury = alpha*myboxdims->at(3*i+1), curz = alpha*myboxdims->at(3*i+2);
+            // To avoid noise related issues and to work with rotating interfaces:
+            double noisedist = 0.1*(curx+cury+curz);
+            halfsizes[3*i+0] = curx+noisedist; halfsizes[3*i+1] = cury+noisedist; halfsizes[3*i+2] = curz+noisedist;
+        }
+        
+        trees[elementtypenumber] = std::shared_ptr<elementtree>(new elementtree(*mybarys, halfsizes));
+    }
+    
+    return trees[elementtypenumber].get();
+}
+
 void elements::getbarycenters(std::vector<std::vector<int>>* elementlist, std::vector<double>& barys)
 {
     int numelems = 0;
@@ -626,7 +914,8 @@ void elements::getbarycenters(int elementtypenumber, std::vector<int>& elementli
 
 std::vector<double> elements::getnormal(int elementtypenumber, int elementnumber)
 {
-    std::vector<double>* nodecoordinates = mynodes->getcoordinates();
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    const std::vector<double>* nodecoordinates = mynodes->readcoordinates();
     
     element myelement(elementtypenumber, mycurvatureorder);
     int curvednumberofnodes = myelement.countcurvednodes();
@@ -678,6 +967,7 @@ void elements::printnumber(void)
 
 void elements::printsubelements(void)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     for (int elementtypenumber = 0; elementtypenumber <= 7; elementtypenumber++)
     {
         element myelement(elementtypenumber, mycurvatureorder);
@@ -770,17 +1060,16 @@ void elements::write(std::string filename, int elementtypenumber, std::vector<in
     double* zptr = zcoords.getvalues();
     double* vptr = vals.getvalues();
     
+    std::vector<double> nodecoords;
+    getnodecoordinates(elementtypenumber, elementnumbers, nodecoords);
+    
     for (int e = 0; e < numelems; e++)
     {
-        std::vector<double> xc = getnodecoordinates(elementtypenumber, elementnumbers[e], 0);
-        std::vector<double> yc = getnodecoordinates(elementtypenumber, elementnumbers[e], 1);
-        std::vector<double> zc = getnodecoordinates(elementtypenumber, elementnumbers[e], 2);
-        
         for (int n = 0; n < ncn; n++)
         {
-            xptr[e*ncn+n] = xc[n];
-            yptr[e*ncn+n] = yc[n];
-            zptr[e*ncn+n] = zc[n];
+            xptr[e*ncn+n] = nodecoords[3*(e*ncn+n)+0];
+            yptr[e*ncn+n] = nodecoords[3*(e*ncn+n)+1];
+            zptr[e*ncn+n] = nodecoords[3*(e*ncn+n)+2];
             vptr[e*ncn+n] = elementvalues[e];
         }
     }
@@ -817,7 +1106,7 @@ void elements::writeedgedirection(int physreg, std::string filename)
     double* vyptr = yvals.getvalues();
     double* vzptr = zvals.getvalues();
     
-    double* nodecoords = mynodes->getcoordinates()->data();
+    const double* nodecoords = mynodes->readcoordinates()->data();
     
     int index = 0;
     for (int i = 0; i < ders.size(); i++)
@@ -867,7 +1156,8 @@ void elements::writeedgedirection(int physreg, std::string filename)
 
 std::vector<double> elements::computebarycenters(int elementtypenumber)
 {
-    std::vector<double>* nodecoordinates = mynodes->getcoordinates();
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    const std::vector<double>* nodecoordinates = mynodes->readcoordinates();
 
     // The barycenter of point elements is the nodes coordinates:
     if (elementtypenumber == 0)
@@ -881,19 +1171,38 @@ std::vector<double> elements::computebarycenters(int elementtypenumber)
     
     // Preallocate the barycenter coordinates vector:
     std::vector<double> barycentercoordinates(3 * count(elementtypenumber),0);
-    // Compute the barycenters on the straight element:
+    // Compute the barycenters on the straight element (every thread processes a block of elements):
     int numel = count(elementtypenumber);
-    for (int elem = 0; elem < numel; elem++)
+    int numthreadstouse = autotuning::getnumthreadsforitems(numel); // require a min num elements per thread
+    
+    auto computeblock = [&](int t)
     {
-        for (int node = 0; node < nn; node++)
+        int firstel = (long long int)t*numel/numthreadstouse;
+        int lastel = (long long int)(t+1)*numel/numthreadstouse;
+        
+        for (int elem = firstel; elem < lastel; elem++)
         {
-            barycentercoordinates[3*elem+0] += nodecoordinates->at(3*subelementsinelements[elementtypenumber][0][elem*ncn+node]+0);
-            barycentercoordinates[3*elem+1] += nodecoordinates->at(3*subelementsinelements[elementtypenumber][0][elem*ncn+node]+1);
-            barycentercoordinates[3*elem+2] += nodecoordinates->at(3*subelementsinelements[elementtypenumber][0][elem*ncn+node]+2);
+            for (int node = 0; node < nn; node++)
+            {
+                barycentercoordinates[3*elem+0] += nodecoordinates->at(3*subelementsinelements[elementtypenumber][0][elem*ncn+node]+0);
+                barycentercoordinates[3*elem+1] += nodecoordinates->at(3*subelementsinelements[elementtypenumber][0][elem*ncn+node]+1);
+                barycentercoordinates[3*elem+2] += nodecoordinates->at(3*subelementsinelements[elementtypenumber][0][elem*ncn+node]+2);
+            }
+            barycentercoordinates[3*elem+0] *= invnn;
+            barycentercoordinates[3*elem+1] *= invnn;
+            barycentercoordinates[3*elem+2] *= invnn;
         }
-        barycentercoordinates[3*elem+0] *= invnn;
-        barycentercoordinates[3*elem+1] *= invnn;
-        barycentercoordinates[3*elem+2] *= invnn;
+    };
+    
+    if (numthreadstouse == 1)
+        computeblock(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(computeblock, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
     }
     
     return barycentercoordinates;
@@ -901,6 +1210,8 @@ std::vector<double> elements::computebarycenters(int elementtypenumber)
 
 std::vector<int> elements::removeduplicates(int elementtypenumber)
 {
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     // For point elements (i.e. to remove node duplicates):
     if (elementtypenumber == 0)
     {
@@ -952,6 +1263,9 @@ std::vector<int> elements::removeduplicates(int elementtypenumber)
         subelementsinelements[elementtypenumber][2].resize(numberofnonduplicates*numberoftriangles);
     if (subelementsinelements[elementtypenumber][3].size() != 0)
         subelementsinelements[elementtypenumber][3].resize(numberofnonduplicates*numberofquadrangles);
+    // Release the memory used by the duplicates (most edges and faces are duplicated after 'explode'):
+    for (int i = 0; i < 4; i++)
+        subelementsinelements[elementtypenumber][i].shrink_to_fit();
 
     renumber(elementtypenumber, elementrenumbering);
     
@@ -960,6 +1274,8 @@ std::vector<int> elements::removeduplicates(int elementtypenumber)
 
 void elements::renumber(int elementtypenumber, std::vector<int>& renumberingvector)
 {   
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     for (int typenum = 0; typenum <= 7; typenum++)
     {
         switch (elementtypenumber)
@@ -990,6 +1306,8 @@ void elements::renumber(int elementtypenumber, std::vector<int>& renumberingvect
 
 void elements::reorder(int elementtypenumber, std::vector<int> &elementreordering)
 {
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     // For point elements (i.e. nodes):
     if (elementtypenumber == 0)
         mynodes->reorder(elementreordering);
@@ -1061,6 +1379,9 @@ void elements::reorder(int elementtypenumber, std::vector<int> &elementreorderin
         boxdimensions[elementtypenumber][3*i+2] = boxdimensionspart[3*elementreordering[i]+2];
     }
     
+    // The tree holds element numbers and is rebuilt on demand:
+    trees[elementtypenumber] = NULL;
+    
     adressedgesatnodes = {};
     edgesatnodes = {};
     
@@ -1069,7 +1390,34 @@ void elements::reorder(int elementtypenumber, std::vector<int> &elementreorderin
 }
 
 void elements::explode(void)
-{                            
+{
+    profilescope scope("mesh explode");
+    
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
+    
+    // Reserve the exact final size of all containers filled below to avoid any reallocation:
+    std::vector<long long int> numnew = {0, count(1), count(2), count(3)};
+    for (int elementtypenumber = 2; elementtypenumber <= 7; elementtypenumber++)
+    {
+        element myelement(elementtypenumber);
+        long long int numelems = count(elementtypenumber);
+        
+        numnew[1] += numelems*myelement.countedges();
+        subelementsinelements[elementtypenumber][1].reserve(subelementsinelements[elementtypenumber][1].size() + numelems*myelement.countedges());
+        if (myelement.getelementdimension() == 3)
+        {
+            numnew[2] += numelems*myelement.counttriangularfaces();
+            numnew[3] += numelems*myelement.countquadrangularfaces();
+            subelementsinelements[elementtypenumber][2].reserve(subelementsinelements[elementtypenumber][2].size() + numelems*myelement.counttriangularfaces());
+            subelementsinelements[elementtypenumber][3].reserve(subelementsinelements[elementtypenumber][3].size() + numelems*myelement.countquadrangularfaces());
+        }
+    }
+    for (int i = 1; i <= 3; i++)
+        subelementsinelements[i][0].reserve(numnew[i]*numberofsubelementsineveryelement[i][0]);
+    subelementsinelements[2][1].reserve(subelementsinelements[2][1].size() + 3*(numnew[2]-count(2)));
+    subelementsinelements[3][1].reserve(subelementsinelements[3][1].size() + 4*(numnew[3]-count(3)));
+    
     // Add all new elements. Loop on all elements with increasing dimension 
     // to avoid defining too many duplicates.
     // Skip lines (type 1) since there is nothing to add for lines.
@@ -1212,15 +1560,17 @@ void elements::follow(std::vector<std::vector<int>>* elementlist, int subtype, s
 
 void elements::definedisjointregions(void)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     
     int numberofphysicalregions = myphysicalregions->count();
+    // Number of 64 bit words in the physical region signature of an element:
+    int numwords = (numberofphysicalregions+63)/64;
     
-    // Define 'isinphysicalregion[elementtypenumber]' to hold a vector
-    // whose (elem*numphysreg+i)th entry is true if the element 'elem' 
-    // is included in the ith physical region.
-    std::vector<std::vector<bool>> isinphysicalregion(8);
+    // Define 'isinphysicalregion[elementtypenumber]' to hold the bitset signature of every element. 
+    // Bit i of word (elem*numwords+i/64) is set if the element 'elem' is included in the ith physical region.
+    std::vector<std::vector<uint64_t>> isinphysicalregion(8);
     for (int typenum = 0; typenum <= 7; typenum++)
-        isinphysicalregion[typenum] = std::vector<bool>(count(typenum)*numberofphysicalregions);
+        isinphysicalregion[typenum] = std::vector<uint64_t>((long long int)count(typenum)*numwords, 0);
     
     // Write the physical regions to the elements. 
     for (int physregindex = 0; physregindex < numberofphysicalregions; physregindex++)
@@ -1228,81 +1578,53 @@ void elements::definedisjointregions(void)
         physicalregion* currentphysicalregion = myphysicalregions->getatindex(physregindex);
         std::vector<std::vector<int>>* elementsinphysicalregion = currentphysicalregion->getelementlist();
         
+        uint64_t bit = (uint64_t)1 << (physregindex%64);
+        int word = physregindex/64;
+        
         for (int typenum = 0; typenum <= 7; typenum++)
         {
             // Iterate on all elements of the given type:
             for (int i = 0; i < (*elementsinphysicalregion)[typenum].size(); i++)
-                isinphysicalregion[typenum][(*elementsinphysicalregion)[typenum][i] * numberofphysicalregions + physregindex] = true;
+                isinphysicalregion[typenum][(long long int)(*elementsinphysicalregion)[typenum][i] * numwords + word] |= bit;
         }
     }
-        
+    
     
     // Propagate the physical region memberships from elements to the subelements.
-    for (int typenum = 1; typenum <= 7; typenum++)
+    // Only the memberships written above are propagated (lines, triangles and quadrangles
+    // receive them from their parent elements as well) thus a copy is read for these types.
+    // Every thread writes the memberships of a subelement type.
+    std::vector<std::vector<uint64_t>> direct = {{}, isinphysicalregion[1], isinphysicalregion[2], isinphysicalregion[3]};
+    
+    auto propagate = [&](int subtype)
     {
-        int numberofcurvednodes = numberofsubelementsineveryelement[typenum][0];
-        int numberoflines = numberofsubelementsineveryelement[typenum][1];
-        int numberoftriangles = numberofsubelementsineveryelement[typenum][2];
-        int numberofquadrangles = numberofsubelementsineveryelement[typenum][3];
-
-        for (int elem = 0; elem < subelementsinelements[typenum][0].size()/numberofcurvednodes; elem++)
+        for (int typenum = std::max(subtype,1); typenum <= 7; typenum++)
         {
-            for (int i = 0; i < numberofcurvednodes; i++)
-            {
-                int subelem = subelementsinelements[typenum][0][elem*numberofcurvednodes+i];
-                for (int physregindex = 0; physregindex < numberofphysicalregions; physregindex++)
-                {
-                    if (isinphysicalregion[typenum][elem*numberofphysicalregions+physregindex])
-                        isinphysicalregion[0][subelem*numberofphysicalregions+physregindex] = true;
-                }
-            }
-        }
-        
-        for (int elem = 0; elem < subelementsinelements[typenum][1].size()/numberoflines; elem++)
-        {
-            for (int i = 0; i < numberoflines; i++)
-            {
-                int subelem = subelementsinelements[typenum][1][elem*numberoflines+i];
-                for (int physregindex = 0; physregindex < numberofphysicalregions; physregindex++)
-                {
-                    if (isinphysicalregion[typenum][elem*numberofphysicalregions+physregindex])
-                        isinphysicalregion[1][subelem*numberofphysicalregions+physregindex] = true;
-                }
-            }
-        }
-
-        if (numberoftriangles != 0)
-        {
-            for (int elem = 0; elem < subelementsinelements[typenum][2].size()/numberoftriangles; elem++)
-            {
-                for (int i = 0; i < numberoftriangles; i++)
-                {
-                    int subelem = subelementsinelements[typenum][2][elem*numberoftriangles+i];
-                    for (int physregindex = 0; physregindex < numberofphysicalregions; physregindex++)
-                    {
-                        if (isinphysicalregion[typenum][elem*numberofphysicalregions+physregindex])
-                            isinphysicalregion[2][subelem*numberofphysicalregions+physregindex] = true;
-                    }
-                }
-            }
-        }
-        
-        if (numberofquadrangles != 0)
-        {
-            for (int elem = 0; elem < subelementsinelements[typenum][3].size()/numberofquadrangles; elem++)
+            int numberofsubelements = numberofsubelementsineveryelement[typenum][subtype];
+            if (numberofsubelements == 0 || typenum == subtype)
+                continue;
+            
+            std::vector<uint64_t>& source = (typenum <= 3) ? direct[typenum] : isinphysicalregion[typenum];
+            const std::vector<int>& subs = subelementsinelements[typenum][subtype];
+            
+            for (int elem = 0; elem < subs.size()/numberofsubelements; elem++)
             {
-                for (int i = 0; i < numberofquadrangles; i++)
+                for (int i = 0; i < numberofsubelements; i++)
                 {
-                    int subelem = subelementsinelements[typenum][3][elem*numberofquadrangles+i];
-                    for (int physregindex = 0; physregindex < numberofphysicalregions; physregindex++)
-                    {
-                        if (isinphysicalregion[typenum][elem*numberofphysicalregions+physregindex])
-                            isinphysicalregion[3][subelem*numberofphysicalregions+physregindex] = true;
-                    }
+                    long long int subelem = subs[elem*numberofsubelements+i];
+                    for (int w = 0; w < numwords; w++)
+                        isinphysicalregion[subtype][subelem*numwords+w] |= source[(long long int)elem*numwords+w];
                 }
             }
         }
-    }
+    };
+    
+    std::vector<std::thread> propagationthreads(4);
+    for (int subtype = 0; subtype <= 3; subtype++)
+        propagationthreads[subtype] = universe::newthread(propagate, subtype);
+    for (int subtype = 0; subtype <= 3; subtype++)
+        propagationthreads[subtype].join();
+    direct = {};
         
 
     // Now define the disjoint regions based on 'isinphysicalregion':
@@ -1314,20 +1636,76 @@ void elements::definedisjointregions(void)
     // Define the disjoint regions and fill in 'indisjointregion':
     for (int typenum = 0; typenum <= 7; typenum++)
     {
-        if (count(typenum) == 0)
+        int numel = count(typenum);
+        if (numel == 0)
             continue;
-
-        std::vector<bool> temp(numberofphysicalregions);    
-
-        for (int elem = 0; elem < count(typenum); elem++)
+            
+        std::vector<uint64_t>& signatures = isinphysicalregion[typenum];
+        
+        // Hash the signature of every element (every thread processes a block of elements):
+        std::vector<uint64_t> hashes(numel);
+        int numthreadstouse = autotuning::getnumthreadsforitems(numel);
+        
+        auto hashsignatures = [&](int t)
+        {
+            int firstel = (long long int)t*numel/numthreadstouse;
+            int lastel = (long long int)(t+1)*numel/numthreadstouse;
+            
+            for (int elem = firstel; elem < lastel; elem++)
+            {
+                // FNV-1a on the signature words:
+                uint64_t hash = 14695981039346656037ULL;
+                for (int w = 0; w < numwords; w++)
+                {
+                    hash ^= signatures[(long long int)elem*numwords+w];
+                    hash *= 1099511628211ULL;
+                }
+                hashes[elem] = hash;
+            }
+        };
+        
+        if (numthreadstouse == 1)
+            hashsignatures(0);
+        else
+        {
+            std::vector<std::thread> threadobjs(numthreadstouse);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t] = universe::newthread(hashsignatures, t);
+            for (int t = 0; t < numthreadstouse; t++)
+                threadobjs[t].join();
+        }
+        
+        // The disjoint regions are created in element order. Every hash gives 
+        // the first element of each disjoint region having that hash:
+        std::unordered_map<uint64_t, std::vector<int>> firstelements;
+        std::vector<bool> temp(numberofphysicalregions);
+        
+        for (int elem = 0; elem < numel; elem++)
         {   
             // Only corner nodes matter for the disjoint regions 
             // (no dof will ever be associated to curvature nodes).
             if (typenum != 0 || isnodeacornernode[elem])
             {
-                for (int i = 0; i < numberofphysicalregions; i++)
-                    temp[i] = isinphysicalregion[typenum][elem*numberofphysicalregions+i];
-                indisjointregion[typenum][elem] = mydisjointregions->add(typenum, temp);
+                uint64_t* cursignature = &signatures[(long long int)elem*numwords];
+                std::vector<int>& candidates = firstelements[hashes[elem]];
+                
+                int disjreg = -1;
+                for (int c = 0; c < candidates.size(); c++)
+                {
+                    if (std::equal(cursignature, cursignature+numwords, &signatures[(long long int)candidates[c]*numwords]))
+                    {
+                        disjreg = indisjointregion[typenum][candidates[c]];
+                        break;
+                    }
+                }
+                if (disjreg == -1)
+                {
+                    for (int i = 0; i < numberofphysicalregions; i++)
+                        temp[i] = ((cursignature[i/64] >> (i%64)) & 1);
+                    disjreg = mydisjointregions->add(typenum, temp);
+                    candidates.push_back(elem);
+                }
+                indisjointregion[typenum][elem] = disjreg;
             }
             else
                 indisjointregion[typenum][elem] = -1;
@@ -1348,7 +1726,7 @@ void elements::reorderbydisjointregions(std::vector<std::vector<int>>& elementre
     for (int typenum = 0; typenum <= 7; typenum++)
     {
         std::vector<int> elementreordering;
-        gentools::stablesort(indisjointregion[typenum], elementreordering);
+        gentools::stablecountingsort(indisjointregion[typenum], elementreordering, mydisjointregions->count());
         
         elementrenumbering[typenum] = std::vector<int>(count(typenum));
         for (int i = 0; i < count(typenum); i++)
@@ -1365,8 +1743,78 @@ void elements::reorderbydisjointregions(std::vector<std::vector<int>>& elementre
     }
 }
 
+void elements::reorderbytotalorientation(void)
+{
+    for (int typenum = 1; typenum <= 7; typenum++)
+    {
+        int numelems = count(typenum);
+        if (numelems == 0 || totalorientations[typenum].size() == 0)
+            continue;
+        
+        // Sort the orientations of each run of elements in a same disjoint region:
+        std::vector<int> elementreordering(numelems);
+        int rangebegin = 0;
+        while (rangebegin < numelems)
+        {
+            int rangeend = rangebegin;
+            while (rangeend+1 < numelems && indisjointregion[typenum][rangeend+1] == indisjointregion[typenum][rangebegin])
+                rangeend++;
+            
+            std::vector<int> rangeorientations(totalorientations[typenum].begin()+rangebegin, totalorientations[typenum].begin()+rangeend+1);
+            std::vector<int> rangereordering;
+            gentools::stablesort(rangeorientations, rangereordering);
+            for (int i = 0; i < rangereordering.size(); i++)
+                elementreordering[rangebegin+i] = rangebegin+rangereordering[i];
+            
+            rangebegin = rangeend+1;
+        }
+        
+        std::vector<int> elementrenumbering(numelems);
+        for (int i = 0; i < numelems; i++)
+            elementrenumbering[elementreordering[i]] = i;
+        
+        reorder(typenum, elementreordering);
+        renumber(typenum, elementrenumbering);
+
+        for (int physregindex = 0; physregindex < myphysicalregions->count(); physregindex++)
+        {
+            physicalregion* currentphysicalregion = myphysicalregions->getatindex(physregindex);
+            currentphysicalregion->renumberelements(typenum, elementrenumbering);
+        }
+    }
+}
+
+void elements::reorderalonghilbertcurve(void)
+{
+    for (int typenum = 0; typenum <= 7; typenum++)
+    {
+        if (count(typenum) == 0)
+            continue;
+            
+        std::vector<double> barys = computebarycenters(typenum);
+        
+        std::vector<int> elementreordering;
+        gentools::hilbertsort(barys, elementreordering);
+        
+        std::vector<int> elementrenumbering(count(typenum));
+        for (int i = 0; i < count(typenum); i++)
+            elementrenumbering[elementreordering[i]] = i;
+        
+        reorder(typenum, elementreordering);
+        renumber(typenum, elementrenumbering);
+
+        for (int physregindex = 0; physregindex < myphysicalregions->count(); physregindex++)
+        {
+            physicalregion* currentphysicalregion = myphysicalregions->getatindex(physregindex);
+            currentphysicalregion->renumberelements(typenum, elementrenumbering);
+        }
+    }
+}
+
 void elements::definedisjointregionsranges(void)
 {
+    subelementbits = std::vector<std::vector<regionbits>>(4, std::vector<regionbits>(0));
+    
     for (int typenum = 0; typenum <= 7; typenum++)
     {
         for (int i = 0; i < indisjointregion[typenum].size(); i++)
@@ -1386,6 +1834,7 @@ void elements::definedisjointregionsranges(void)
 
 std::vector<bool> elements::iscornernode(void)
 {
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     std::vector<bool> output(count(0), true);
     for (int typenum = 1; typenum <= 7; typenum++)
     {
@@ -1405,6 +1854,9 @@ std::vector<bool> elements::iscornernode(void)
 
 void elements::orient(long long int* noderenumbering)
 {
+    profilescope scope("mesh orient");
+    
+    const std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     // Loop on all element types except the point element (type 0):
     for (int elementtypenumber = 1; elementtypenumber <= 7; elementtypenumber++)
     {    
@@ -1469,6 +1921,8 @@ void elements::toptracker(std::shared_ptr<ptracker> originpt, std::shared_ptr<pt
 
 void elements::merge(elements* elstomerge, std::vector<std::vector<int>>& renumbering, std::vector<int>& numduplicates)
 {
+    makesubelementsunique();
+    std::vector<std::vector<std::vector<int>>>& subelementsinelements = *mysubelementsinelements;
     std::vector<int> numineachtype = count(); // curvature nodes are included
     
     // Merge the nodes:
@@ -1476,7 +1930,7 @@ void elements::merge(elements* elstomerge, std::vector<std::vector<int>>& renumb
     mynodes->setnumber(numineachtype[0] + numnodestomerge - numduplicates[0]);
     
     double* ncs = mynodes->getcoordinates()->data();
-    double* ncstomerge = elstomerge->mynodes->getcoordinates()->data();
+    const double* ncstomerge = elstomerge->mynodes->readcoordinates()->data();
 
     for (int i = 0; i < numnodestomerge; i++)
     {
@@ -1516,7 +1970,7 @@ void elements::merge(elements* elstomerge, std::vector<std::vector<int>>& renumb
                     continue;
                     
                 for (int s = 0; s < ns; s++)
-                    subelementsinelements[i][j][renum*ns+s] = renumbering[j][elstomerge->subelementsinelements[i][j][k*ns+s]];
+                    subelementsinelements[i][j][renum*ns+s] = renumbering[j][(*elstomerge->mysubelementsinelements)[i][j][k*ns+s]];
             }
         }
     }
@@ -1597,3 +2051,26 @@ void elements::merge(std::vector<int> intersectionphysregs, elements* elstomerge
     merge(elstomerge, renumberings, numduplicates);
 }
 
+
+memoryusage elements::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    output.add("subelements in elements", memoryusage::countbytes(*mysubelementsinelements));
+    output.add("disjoint region of elements", memoryusage::countbytes(indisjointregion));
+    output.add("total orientations", memoryusage::countbytes(totalorientations));
+    output.add("barycenters", memoryusage::countbytes(barycenters));
+    output.add("sphere radius", memoryusage::countbytes(sphereradius));
+    output.add("box dimensions", memoryusage::countbytes(boxdimensions));
+    output.add("edges at nodes", memoryusage::countbytes(adressedgesatnodes) + memoryusage::countbytes(edgesatnodes));
+    output.add("cells at subelements", memoryusage::countbytes(adresscellsattype) + memoryusage::countbytes(cellsattype));
+    long long int numbitsbytes = 0;
+    for (int s = 0; s < 4; s++)
+    {
+        for (int d = 0; d < subelementbits[s].size(); d++)
+            numbitsbytes += subelementbits[s][d].getmemoryusage();
+    }
+    output.add("subelements in disjoint regions", numbitsbytes);
+    
+    return output;
+}
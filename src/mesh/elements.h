@@ -13,18 +13,26 @@
 #include "nodes.h"
 #include "physicalregions.h"
 #include "disjointregions.h"
+#include "regionbits.h"
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
 #include "orientation.h"
 #include "gentools.h"
 #include "ptracker.h"
+#include "elementtree.h"
+#include "memoryusage.h"
+#include "profiler.h"
+#include <memory>
 
 class nodes;
 
 class elements
 {
 
+    // For the native .slm mesh format:
+    friend class slminterface;
+
     private:
         
         nodes* mynodes;
@@ -43,7 +51,12 @@ class elements
         // the triangle list and [typenum][3] the quadrangle list.
         // The element itself is not included, e.g. [0][0] is empty.
         // For nodes all curved nodes are provided. 
-        std::vector<std::vector<std::vector<int>>> subelementsinelements = std::vector<std::vector<std::vector<int>>>(8, std::vector<std::vector<int>>(4,std::vector<int>(0)));
+        // Copies of this object share these lists until one of them modifies them.
+        std::shared_ptr<std::vector<std::vector<std::vector<int>>>> mysubelementsinelements = std::shared_ptr<std::vector<std::vector<std::vector<int>>>>(new std::vector<std::vector<std::vector<int>>>(8, std::vector<std::vector<int>>(4,std::vector<int>(0))));
+        // Make sure the subelement lists are not shared with any copy before modifying them:
+        void makesubelementsunique(void);
+        // Set the curvature order of the mesh when the first element is added (it must be the same for all elements):
+        void setcurvatureorder(int curvatureorder);
         
         // For speedup: number of subelements (nodes, lines, triangles 
         // and quadrangles) in every element.
@@ -71,6 +84,8 @@ class elements
         // smallest box (centered on the barycenter) that surrounds all nodes of the ith element of type 'typenum'.
         // All nodes of the curved element are considered (but the barycenter is the one of the straight element).
         std::vector<std::vector<double>> boxdimensions = std::vector<std::vector<double>>(8, std::vector<double>(0));
+        // trees[typenum] is the bounding volume hierarchy over the boxes of all elements of type 'typenum' (NULL if not yet built).
+        std::vector<std::shared_ptr<elementtree>> trees = std::vector<std::shared_ptr<elementtree>>(8, NULL);
         
         // Entries in 'edgesatnodes' from index 'adressedgesatnodes[i]' to 'adressedgesatnodes[i+1]-1' are all 
         // edges touching node i. Only the edge corner nodes (not the curvature nodes) have touching edges.
@@ -83,6 +98,9 @@ class elements
         // (highest dimension elements) touching node/edge/tri/quad i and their type number in format {type0,cell0,type1,...}.
         std::vector<std::vector<int>> adresscellsattype = std::vector<std::vector<int>>(4, std::vector<int>(0));
         std::vector<std::vector<int>> cellsattype = std::vector<std::vector<int>>(4, std::vector<int>(0));
+        
+        // 'subelementbits[subtype][d]' holds the nodes/edges/triangles/quadrangles (subtype 0/1/2/3) of the elements in disjoint region d.
+        std::vector<std::vector<regionbits>> subelementbits = std::vector<std::vector<regionbits>>(4, std::vector<regionbits>(0));
         // Create the two vectors above:
         void populatecellsattype(int subtype, std::vector<int>& act, std::vector<int>& ct);
 
@@ -99,8 +117,17 @@ class elements
         // curved nodes. Return the created element number. Only 'pointsinelements' 
         // is changed. 'elementtypenumber' is the UNCURVED element type number.
         int add(int elementtypenumber, int curvatureorder, std::vector<int>& nodelist);
+        // Add 'numelems' elements at once without filling their curved nodes. Return a pointer to the curved nodes to fill
+        // ('countcurvednodes' per element) and the number of the first element added. Not for point elements.
+        int* addblock(int elementtypenumber, int curvatureorder, int numelems, int& firstelement);
         
         void cleancoordinatedependentcontainers(void);
+        // Only update the containers of the elements having a node for which 'ismovednode' is true.
+        // The element trees are only reset for the element types that have moved elements.
+        void cleancoordinatedependentcontainers(std::vector<bool>& ismovednode);
+        
+        // Bytes used by every container (the subelement lists are counted even if shared with a copy):
+        memoryusage getmemoryusage(void);
         
         // 'getsubelement' returns the number of the 'subelementindex'th 
         // subelement of type 'subelementtypenumber' in element number 
@@ -137,12 +164,18 @@ class elements
         // touching node/edge/tri/quad 'subnumber'. Format is {type0,cell0,type1,...}.
         int countcellsontype(int subtype, int subnumber);
         std::vector<int> getcellsontype(int subtype, int subnumber);
+        // Get the nodes/edges/triangles/quadrangles (subtype 0/1/2/3) of the elements in a disjoint region as a bitset.
+        // Curvature nodes are included. The bitsets of a subtype are built for all disjoint regions at the first call.
+        regionbits* getsubelementbits(int subtype, int disjreg);
         
         // Get the x, y or z coordinate of all nodes in the element 
         // (for xyz respectively set to 0, 1 or 2).
         std::vector<double> getnodecoordinates(int elementtypenumber, int elementnumber, int xyz);
         // Get all coordinates at once:
         std::vector<double> getnodecoordinates(int elementtypenumber, int elementnumber);
+        // Get all coordinates of a block of elements of same type at once. 'coords' is resized and holds
+        // the x, y and z coordinate of every curved node of every element (element x node x xyz):
+        void getnodecoordinates(int elementtypenumber, std::vector<int>& elementnumbers, std::vector<double>& coords);
         
         // Get the elements in format {type0,elemnum0,type1,...} and reference coordinates at the target disjoint regions.
         // All elements have same reference coordinates at the origin. One reference coordinate per element at target.
@@ -158,6 +191,10 @@ class elements
         // Get a pointer to the boxdimensions[elementtypenumber] vector.
         // The 'boxdimensions' container is populated for the element type if empty. 
         std::vector<double>* getboxdimensions(int elementtypenumber);
+        // Get a pointer to the tree of the element boxes used to locate points in the elements of a type.
+        // The boxes are the 'boxdimensions' slightly enlarged to be robust to noise and curvature.
+        // The tree is built for the element type if not yet available. 
+        elementtree* gettree(int elementtypenumber);
         
         // Get the barycenter of all elements in the flattened element list:
         void getbarycenters(std::vector<std::vector<int>>* elementlist, std::vector<double>& barycenters);
@@ -221,6 +258,12 @@ class elements
         // Same but here the renumbering used is provided in 'elementrenumbering' upon return.
         void reorderbydisjointregions(std::vector<std::vector<int>>& elementrenumbering);
         void definedisjointregionsranges(void);
+        // Stable reordering and renumbering of the elements inside every disjoint region by total orientation.
+        // The disjoint region ranges are unchanged. To call after 'orient':
+        void reorderbytotalorientation(void);
+        // Reorder and renumber the nodes and the elements of every type along a Hilbert curve through their barycenters.
+        // Elements close in space then have close numbers (better memory locality and smaller matrix bandwidth).
+        void reorderalonghilbertcurve(void);
         
         // Get a vector whose index i is true if node i is a corner node:
         std::vector<bool> iscornernode(void);
@@ -1,13 +1,14 @@
 #include "elementselector.h"
+#include "meshcache.h"
 
 
-void elementselector::prepare(bool isorientationdependent)
+void elementselector::prepare(bool isorientationdependent, bool issorted)
 {
     // Sort the elements according to their total orientation.
     // Do it only if orientation dependent otherwise the disjoint
     // regions will not be sorted according to the order defined in
     // 'disjointregionnumbers'.
-    if (isorientationdependent == true)
+    if (isorientationdependent == true && issorted == false)
     {
         std::vector<int> renumberingvector;
         gentools::stablesort(totalorientations, renumberingvector);
@@ -46,6 +47,13 @@ elementselector::elementselector(std::vector<int> disjointregionnumbers, bool is
     std::sort(disjointregionnumbers.begin(), disjointregionnumbers.end());
     
     mydisjointregionnumbers = disjointregionnumbers;
+    
+    // Reuse the grouping computed on the same mesh:
+    if (meshcache::getgrouping(mydisjointregionnumbers, isorientationdependent, elems, totalorientations, disjointregions, originalindexes))
+    {
+        prepare(isorientationdependent, true);
+        return;
+    }
 
     // Get the total number of elements in all disjoint regions for preallocation.
     int totalnumberofelements = 0;
@@ -76,6 +84,8 @@ elementselector::elementselector(std::vector<int> disjointregionnumbers, bool is
     }
     
     prepare(isorientationdependent);
+    
+    meshcache::setgrouping(mydisjointregionnumbers, isorientationdependent, elems, totalorientations, disjointregions, originalindexes);
 }    
 
 elementselector::elementselector(std::vector<int> disjointregionnumbers, std::vector<int>& elemnums, bool isorientationdependent)
@@ -47,8 +47,8 @@ class elementselector
         std::vector<int> originalindexes;
         
         
-        // Prepare the containers:
-        void prepare(bool isorientationdependent);
+        // Prepare the containers (they are not sorted again if 'issorted' is true):
+        void prepare(bool isorientationdependent, bool issorted = false);
         
     public:
     
@@ -0,0 +1,185 @@
+#include "elementtree.h"
+
+
+elementtree::elementtree(std::vector<double>& centers, std::vector<double>& halfsizes)
+{
+    int numelems = centers.size()/3;
+    if (numelems == 0)
+        return;
+
+    myelements = std::vector<int>(numelems);
+    for (int i = 0; i < numelems; i++)
+        myelements[i] = i;
+
+    // A binary tree with leaves of at least half the leaf size has at most that many nodes:
+    int maxnumnodes = 2*(2*numelems/myleafsize+1);
+    mynodeboxes.reserve(6*maxnumnodes);
+    myrangebegin.reserve(maxnumnodes);
+    myrangeend.reserve(maxnumnodes);
+    mychildren.reserve(2*maxnumnodes);
+
+    build(0, numelems, centers);
+
+    myelementboxes = std::vector<double>(6*numelems);
+    for (int i = 0; i < numelems; i++)
+    {
+        int e = myelements[i];
+        for (int c = 0; c < 3; c++)
+        {
+            myelementboxes[6*i+2*c+0] = centers[3*e+c]-halfsizes[3*e+c];
+            myelementboxes[6*i+2*c+1] = centers[3*e+c]+halfsizes[3*e+c];
+        }
+    }
+
+    // The node boxes are obtained from the leaves up (children always have a higher node number):
+    for (int n = myrangebegin.size()-1; n >= 0; n--)
+    {
+        double* nodebox = &mynodeboxes[6*n];
+        if (mychildren[2*n+0] == -1)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                nodebox[2*c+0] = myelementboxes[6*myrangebegin[n]+2*c+0];
+                nodebox[2*c+1] = myelementboxes[6*myrangebegin[n]+2*c+1];
+            }
+            for (int i = myrangebegin[n]+1; i < myrangeend[n]; i++)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    nodebox[2*c+0] = std::min(nodebox[2*c+0], myelementboxes[6*i+2*c+0]);
+                    nodebox[2*c+1] = std::max(nodebox[2*c+1], myelementboxes[6*i+2*c+1]);
+                }
+            }
+        }
+        else
+        {
+            double* box0 = &mynodeboxes[6*mychildren[2*n+0]];
+            double* box1 = &mynodeboxes[6*mychildren[2*n+1]];
+            for (int c = 0; c < 3; c++)
+            {
+                nodebox[2*c+0] = std::min(box0[2*c+0], box1[2*c+0]);
+                nodebox[2*c+1] = std::max(box0[2*c+1], box1[2*c+1]);
+            }
+        }
+    }
+}
+
+int elementtree::build(int rangebegin, int rangeend, std::vector<double>& centers)
+{
+    int curnode = myrangebegin.size();
+
+    myrangebegin.push_back(rangebegin);
+    myrangeend.push_back(rangeend);
+    mychildren.push_back(-1);
+    mychildren.push_back(-1);
+    mynodeboxes.resize(mynodeboxes.size()+6);
+
+    if (rangeend-rangebegin <= myleafsize)
+        return curnode;
+
+    // Split at the median along the direction in which the box centers are the most spread:
+    std::vector<double> bounds = {centers[3*myelements[rangebegin]+0], centers[3*myelements[rangebegin]+0], centers[3*myelements[rangebegin]+1], centers[3*myelements[rangebegin]+1], centers[3*myelements[rangebegin]+2], centers[3*myelements[rangebegin]+2]};
+    for (int i = rangebegin+1; i < rangeend; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            bounds[2*c+0] = std::min(bounds[2*c+0], centers[3*myelements[i]+c]);
+            bounds[2*c+1] = std::max(bounds[2*c+1], centers[3*myelements[i]+c]);
+        }
+    }
+    int splitdir = 0;
+    for (int c = 1; c < 3; c++)
+    {
+        if (bounds[2*c+1]-bounds[2*c+0] > bounds[2*splitdir+1]-bounds[2*splitdir+0])
+            splitdir = c;
+    }
+
+    int middle = rangebegin+(rangeend-rangebegin)/2;
+    std::nth_element(myelements.begin()+rangebegin, myelements.begin()+middle, myelements.begin()+rangeend, [&](int a, int b) { return centers[3*a+splitdir] < centers[3*b+splitdir]; });
+
+    int child0 = build(rangebegin, middle, centers);
+    int child1 = build(middle, rangeend, centers);
+
+    mychildren[2*curnode+0] = child0;
+    mychildren[2*curnode+1] = child1;
+
+    return curnode;
+}
+
+void elementtree::find(double x, double y, double z, std::vector<int>& candidates, int rangebegin, int rangeend)
+{
+    candidates.clear();
+
+    if (myelements.size() == 0)
+        return;
+
+    bool isrange = (rangebegin >= 0);
+
+    std::vector<int> tovisit = {0};
+    while (tovisit.size() > 0)
+    {
+        int n = tovisit.back();
+        tovisit.pop_back();
+
+        double* nodebox = &mynodeboxes[6*n];
+        if (x < nodebox[0] || x > nodebox[1] || y < nodebox[2] || y > nodebox[3] || z < nodebox[4] || z > nodebox[5])
+            continue;
+
+        if (mychildren[2*n+0] != -1)
+        {
+            tovisit.push_back(mychildren[2*n+1]);
+            tovisit.push_back(mychildren[2*n+0]);
+            continue;
+        }
+
+        for (int i = myrangebegin[n]; i < myrangeend[n]; i++)
+        {
+            int e = myelements[i];
+            if (isrange && (e < rangebegin || e > rangeend))
+                continue;
+
+            double* elembox = &myelementboxes[6*i];
+            if (x < elembox[0] || x > elembox[1] || y < elembox[2] || y > elembox[3] || z < elembox[4] || z > elembox[5]) {}
+            else
+                candidates.push_back(e);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+}
+
+void elementtree::findinbox(std::vector<double>& box, std::vector<int>& candidates)
+{
+    candidates.clear();
+
+    if (myelements.size() == 0)
+        return;
+
+    std::vector<int> tovisit = {0};
+    while (tovisit.size() > 0)
+    {
+        int n = tovisit.back();
+        tovisit.pop_back();
+
+        double* nodebox = &mynodeboxes[6*n];
+        if (box[1] < nodebox[0] || box[0] > nodebox[1] || box[3] < nodebox[2] || box[2] > nodebox[3] || box[5] < nodebox[4] || box[4] > nodebox[5])
+            continue;
+
+        if (mychildren[2*n+0] != -1)
+        {
+            tovisit.push_back(mychildren[2*n+1]);
+            tovisit.push_back(mychildren[2*n+0]);
+            continue;
+        }
+
+        for (int i = myrangebegin[n]; i < myrangeend[n]; i++)
+        {
+            double* elembox = &myelementboxes[6*i];
+            if (box[1] < elembox[0] || box[0] > elembox[1] || box[3] < elembox[2] || box[2] > elembox[3] || box[5] < elembox[4] || box[4] > elembox[5]) {}
+            else
+                candidates.push_back(myelements[i]);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+}
@@ -0,0 +1,58 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object is a bounding volume hierarchy over the boxes surrounding the elements of a given type.
+// It gives the candidate elements that can hold a (x,y,z) point in logarithmic time. The tree is
+// built once and can then be queried simultaneously by multiple threads.
+
+
+#ifndef ELEMENTTREE_H
+#define ELEMENTTREE_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+class elementtree
+{
+
+    private:
+
+        // Maximum number of elements in a leaf:
+        int myleafsize = 8;
+
+        // Element numbers (reordered so that every tree node holds a contiguous range):
+        std::vector<int> myelements = {};
+        // Box {xmin,xmax,ymin,ymax,zmin,zmax} of every reordered element:
+        std::vector<double> myelementboxes = {};
+
+        // Box of every tree node:
+        std::vector<double> mynodeboxes = {};
+        // Tree node i holds the elements at positions 'myrangebegin[i]' to 'myrangeend[i]'-1.
+        // Its children are 'mychildren[2*i+0]' and 'mychildren[2*i+1]' (-1 for a leaf).
+        std::vector<int> myrangebegin = {};
+        std::vector<int> myrangeend = {};
+        std::vector<int> mychildren = {};
+
+        // Build the subtree for the reordered elements in the range and return its node number:
+        int build(int rangebegin, int rangeend, std::vector<double>& centers);
+
+    public:
+
+        elementtree(void) {};
+        // The box of element i is centered at 'centers[3*i+0,1,2]' with half sizes 'halfsizes[3*i+0,1,2]':
+        elementtree(std::vector<double>& centers, std::vector<double>& halfsizes);
+
+        int countelements(void) { return myelements.size(); };
+
+        // Get the numbers (sorted ascendingly) of all elements whose box contains the point.
+        // Only the element numbers from 'rangebegin' to 'rangeend' (included) are considered if provided.
+        void find(double x, double y, double z, std::vector<int>& candidates, int rangebegin = -1, int rangeend = -1);
+        // Get the numbers (sorted ascendingly) of all elements whose box intersects the box {xmin,xmax,ymin,ymax,zmin,zmax}:
+        void findinbox(std::vector<double>& box, std::vector<int>& candidates);
+
+};
+
+#endif
@@ -1,13 +1,130 @@
 #include "gentools.h"
 #include "sl.h"
 #include "universe.h"
+#include "autotuning.h"
 #include "disjointregions.h"
 #include "lagrangeformfunction.h"
 #include "slmpi.h"
+#include "elementtree.h"
+#include <thread>
+#include <functional>
 
-#if defined(__linux__)
-#include <parallel/algorithm>
-#endif
+
+// Run 'func(t)' for all t in [0, numthreads), each on its own thread:
+static void runinthreads(int numthreads, std::function<void(int)> func)
+{
+    if (numthreads == 1)
+    {
+        func(0);
+        return;
+    }
+    std::vector<std::thread> threadobjs(numthreads);
+    for (int t = 0; t < numthreads; t++)
+        threadobjs[t] = universe::newthread(func, t);
+    for (int t = 0; t < numthreads; t++)
+        threadobjs[t].join();
+}
+
+// Parallel merge sort. Every thread sorts a block then the sorted blocks are merged pairwise, with one thread per merge.
+// The comparison must be a strict ordering (ties broken by index) so that the result is the same for any number of threads.
+template <typename T, typename Compare>
+static void parallelsort(std::vector<T>& tosort, Compare comp)
+{
+    int numvals = tosort.size();
+    int numthreadstouse = autotuning::getnumthreadsforvalues(numvals);
+
+    if (numthreadstouse == 1)
+    {
+        std::sort(tosort.begin(), tosort.end(), comp);
+        return;
+    }
+
+    std::vector<int> bounds(numthreadstouse+1);
+    for (int t = 0; t <= numthreadstouse; t++)
+        bounds[t] = (long long int)t*numvals/numthreadstouse;
+
+    runinthreads(numthreadstouse, [&](int t){ std::sort(tosort.begin()+bounds[t], tosort.begin()+bounds[t+1], comp); });
+
+    std::vector<T> buffer(numvals);
+    for (int width = 1; width < numthreadstouse; width *= 2)
+    {
+        int nummerges = (numthreadstouse + 2*width-1)/(2*width);
+        runinthreads(nummerges, [&](int m)
+        {
+            int first = bounds[2*m*width];
+            int middle = bounds[std::min(2*m*width+width, numthreadstouse)];
+            int last = bounds[std::min(2*m*width+2*width, numthreadstouse)];
+            std::merge(tosort.begin()+first, tosort.begin()+middle, tosort.begin()+middle, tosort.begin()+last, buffer.begin()+first, comp);
+        });
+        tosort.swap(buffer);
+    }
+}
+
+// Stable parallel LSD radix sort of the indexes in 'order' according to the unsigned key 'getkey(index)'.
+// The keys are processed by digits of 8 bits with per-thread counts (as in 'stablecountingsort').
+// Digits that are the same for all keys are skipped.
+template <typename Key>
+static void stableradixsort(Key getkey, std::vector<int>& order)
+{
+    int numvals = order.size();
+    int numthreadstouse = autotuning::getnumthreadsforvalues(numvals);
+
+    unsigned int orkeys = 0, andkeys = 0xFFFFFFFF;
+    for (int i = 0; i < numvals; i++)
+    {
+        unsigned int curkey = getkey(i);
+        orkeys |= curkey;
+        andkeys &= curkey;
+    }
+
+    std::vector<int> buffer(numvals);
+    std::vector<std::vector<int>> counts(numthreadstouse, std::vector<int>(256));
+
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        if ((((orkeys ^ andkeys) >> shift) & 255) == 0)
+            continue;
+
+        runinthreads(numthreadstouse, [&](int t)
+        {
+            int first = (long long int)t*numvals/numthreadstouse;
+            int last = (long long int)(t+1)*numvals/numthreadstouse;
+
+            std::fill(counts[t].begin(), counts[t].end(), 0);
+            for (int i = first; i < last; i++)
+                counts[t][(getkey(order[i]) >> shift) & 255]++;
+        });
+
+        // Digit by digit then thread by thread for a stable sorting:
+        int offset = 0;
+        for (int d = 0; d < 256; d++)
+        {
+            for (int t = 0; t < numthreadstouse; t++)
+            {
+                int curcount = counts[t][d];
+                counts[t][d] = offset;
+                offset += curcount;
+            }
+        }
+
+        runinthreads(numthreadstouse, [&](int t)
+        {
+            int first = (long long int)t*numvals/numthreadstouse;
+            int last = (long long int)(t+1)*numvals/numthreadstouse;
+
+            for (int i = first; i < last; i++)
+                buffer[counts[t][(getkey(order[i]) >> shift) & 255]++] = order[i];
+        });
+
+        order.swap(buffer);
+    }
+}
+
+// Map an int to an unsigned int with the same ordering:
+static inline unsigned int tounsignedkey(int val)
+{
+    return ((unsigned int)val) ^ 0x80000000u;
+}
 
 void gentools::stablecoordinatesort(std::vector<double> noisethreshold, std::vector<double>& coordinates, std::vector<int>& reorderingvector)
 {
@@ -21,11 +138,7 @@ void gentools::stablecoordinatesort(std::vector<double> noisethreshold, std::vec
     std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
     // Sort 'reorderingvector' according to 'coordinates' with x > y > z priority order:
     // The < operator is overloaded by a lambda function.
-    #if defined(__linux__)
-    __gnu_parallel::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
-    #else
-    std::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
-    #endif
+    parallelsort(reorderingvector, [&](int elem1, int elem2)
         { 
             // First sort according to the x coordinate:
             if (coordinates[elem1*3+0] < coordinates[elem2*3+0] - noisethreshold[0])
@@ -58,7 +171,7 @@ void gentools::stablecoordinatesort(std::vector<double> noisethreshold, std::vec
     std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
     // Sort 'reorderingvector' according to 'coordinates' with x > y > z priority order:
     // The < operator is overloaded by a lambda function.
-    std::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
+    parallelsort(reorderingvector, [&](int elem1, int elem2)
         { 
             // First sort according to the integer vector:
             if (elems[elem1] < elems[elem2])
@@ -86,6 +199,83 @@ void gentools::stablecoordinatesort(std::vector<double> noisethreshold, std::vec
         });
 }
 
+void gentools::hilbertsort(std::vector<double>& coordinates, std::vector<int>& reorderingvector)
+{
+    int numcoords = coordinates.size()/3;
+    
+    reorderingvector.resize(numcoords);
+    std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
+    if (numcoords == 0)
+        return;
+    
+    // Bounding box of all coordinates:
+    std::vector<double> bounds = {coordinates[0], coordinates[0], coordinates[1], coordinates[1], coordinates[2], coordinates[2]};
+    for (int i = 1; i < numcoords; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            bounds[2*c+0] = std::min(bounds[2*c+0], coordinates[3*i+c]);
+            bounds[2*c+1] = std::max(bounds[2*c+1], coordinates[3*i+c]);
+        }
+    }
+    
+    // Number of bits per direction (the key of all 3 directions fits in 63 bits):
+    int numbits = 21;
+    unsigned int maxint = (1u << numbits) - 1;
+    
+    // The same scaling is used in all directions to keep the curve isotropic:
+    double maxextent = std::max(bounds[1]-bounds[0], std::max(bounds[3]-bounds[2], bounds[5]-bounds[4]));
+    double scaling = (maxextent > 0) ? maxint/maxextent : 0.0;
+    
+    std::vector<unsigned long long int> keys(numcoords);
+    for (int i = 0; i < numcoords; i++)
+    {
+        unsigned int X[3];
+        for (int c = 0; c < 3; c++)
+        {
+            double scaled = (coordinates[3*i+c]-bounds[2*c+0])*scaling;
+            X[c] = std::min(maxint, (unsigned int)std::max(0.0, scaled));
+        }
+        
+        // Convert the integer coordinates to the transposed Hilbert index (J. Skilling, AIP Conf. Proc. 707, 2004):
+        unsigned int M = 1u << (numbits-1);
+        for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+            unsigned int P = Q-1;
+            for (int c = 0; c < 3; c++)
+            {
+                if (X[c] & Q)
+                    X[0] ^= P;
+                else
+                {
+                    unsigned int t = (X[0]^X[c]) & P;
+                    X[0] ^= t; X[c] ^= t;
+                }
+            }
+        }
+        // Gray encode:
+        X[1] ^= X[0]; X[2] ^= X[1];
+        unsigned int t = 0;
+        for (unsigned int Q = M; Q > 1; Q >>= 1)
+        {
+            if (X[2] & Q)
+                t ^= Q-1;
+        }
+        X[0] ^= t; X[1] ^= t; X[2] ^= t;
+        
+        // Interleave the bits of the transposed index:
+        unsigned long long int key = 0;
+        for (int b = numbits-1; b >= 0; b--)
+        {
+            for (int c = 0; c < 3; c++)
+                key = (key << 1) | ((X[c] >> b) & 1);
+        }
+        keys[i] = key;
+    }
+    
+    std::stable_sort(reorderingvector.begin(), reorderingvector.end(), [&](int a, int b) { return keys[a] < keys[b]; });
+}
+
 int gentools::removeduplicates(std::vector<double>& coordinates, std::vector<int>& renumberingvector)
 {
     int numpts = coordinates.size()/3;
@@ -95,39 +285,140 @@ int gentools::removeduplicates(std::vector<double>& coordinates, std::vector<int
         return 0;
  
     std::vector<double> noisethreshold = universe::getrawmesh()->getnodes()->getnoisethreshold();
-    double ntx = noisethreshold[0], nty = noisethreshold[1], ntz = noisethreshold[2];
-
-    coordinategroup coordgroup(coordinates);
-
-    int numnonduplicates = 0;
+    
+    ///// Hash the points on a grid of cells twice as large as the noise threshold.
+    // Two points closer than the noise threshold are thus in the same or in neighbouring cells.
+    std::vector<double> bounds = getcoordbounds(coordinates);
+    std::vector<double> cellsize(3);
+    for (int c = 0; c < 3; c++)
+        cellsize[c] = (noisethreshold[c] > 0) ? 2.0*noisethreshold[c] : 1.0;
+    
+    std::vector<long long int> cells(3*numpts);
     for (int i = 0; i < numpts; i++)
     {
-        // If already merged there is nothing to do:
-        if (renumberingvector[i] != -1)
-            continue;
-        renumberingvector[i] = numnonduplicates;
+        for (int c = 0; c < 3; c++)
+            cells[3*i+c] = (long long int)std::floor((coordinates[3*i+c]-bounds[2*c+0])/cellsize[c]);
+    }
+    
+    // Sort the points by cell:
+    std::vector<int> sorted(numpts);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    auto celllessthan = [&](int p1, int p2)
+    {
+        if (cells[3*p1+0] != cells[3*p2+0])
+            return (cells[3*p1+0] < cells[3*p2+0]);
+        if (cells[3*p1+1] != cells[3*p2+1])
+            return (cells[3*p1+1] < cells[3*p2+1]);
+        return (cells[3*p1+2] < cells[3*p2+2]);
+    };
+    parallelsort(sorted, celllessthan);
+    
+    ///// Find for every point all points with a lower index that are identical up to the noise threshold.
+    // Every thread processes a block of points and outputs the {point, lower index identical point} pairs:
+    int numthreadstouse = autotuning::getnumthreadsforvalues(numpts);
+    std::vector<std::vector<int>> identicalpairs(numthreadstouse);
     
-        double curx = coordinates[3*i+0], cury = coordinates[3*i+1], curz = coordinates[3*i+2];
+    auto findidentical = [&](int t)
+    {
+        int firstpt = (long long int)t*numpts/numthreadstouse;
+        int lastpt = (long long int)(t+1)*numpts/numthreadstouse;
+        
+        long long int curcell[3];
+        int offsets[3][3], numoffsets[3];
         
-        coordgroup.select(curx,cury,curz, 0);
-        do
+        for (int i = firstpt; i < lastpt; i++)
         {
-            int numcoordsingroup = coordgroup.countgroupcoordinates();
-            int* curgroupindexes = coordgroup.getgroupindexes();
-            double* curgroupcoords = coordgroup.getgroupcoordinates();
-    
-            // Loop on each point in the group:
-            for (int p = 0; p < numcoordsingroup; p++)
+            double curx = coordinates[3*i+0], cury = coordinates[3*i+1], curz = coordinates[3*i+2];
+            
+            // Only the neighbouring cells closer than the noise threshold are visited:
+            for (int c = 0; c < 3; c++)
             {
-                int curindex = curgroupindexes[p];
-                // If close enough to be considered identical:
-                if (renumberingvector[curindex] == -1 && std::abs(curx-curgroupcoords[3*p+0]) <= ntx && std::abs(cury-curgroupcoords[3*p+1]) <= nty && std::abs(curz-curgroupcoords[3*p+2]) <= ntz)
-                    renumberingvector[curindex] = numnonduplicates;
+                double posincell = coordinates[3*i+c]-bounds[2*c+0]-cells[3*i+c]*cellsize[c];
+                offsets[c][0] = 0; numoffsets[c] = 1;
+                if (posincell <= noisethreshold[c])
+                {
+                    offsets[c][numoffsets[c]] = -1; numoffsets[c]++;
+                }
+                if (cellsize[c]-posincell <= noisethreshold[c])
+                {
+                    offsets[c][numoffsets[c]] = 1; numoffsets[c]++;
+                }
+            }
+            
+            for (int ox = 0; ox < numoffsets[0]; ox++)
+            {
+                for (int oy = 0; oy < numoffsets[1]; oy++)
+                {
+                    for (int oz = 0; oz < numoffsets[2]; oz++)
+                    {
+                        curcell[0] = cells[3*i+0]+offsets[0][ox]; curcell[1] = cells[3*i+1]+offsets[1][oy]; curcell[2] = cells[3*i+2]+offsets[2][oz];
+                        
+                        // First point in the sorted list whose cell is not lower than the current cell:
+                        auto it = std::lower_bound(sorted.begin(), sorted.end(), 0, [&](int p, int dummy)
+                        {
+                            if (cells[3*p+0] != curcell[0])
+                                return (cells[3*p+0] < curcell[0]);
+                            if (cells[3*p+1] != curcell[1])
+                                return (cells[3*p+1] < curcell[1]);
+                            return (cells[3*p+2] < curcell[2]);
+                        });
+                        
+                        for (; it != sorted.end(); ++it)
+                        {
+                            int p = *it;
+                            if (cells[3*p+0] != curcell[0] || cells[3*p+1] != curcell[1] || cells[3*p+2] != curcell[2])
+                                break;
+                            
+                            // If close enough to be considered identical:
+                            if (p < i && std::abs(curx-coordinates[3*p+0]) <= noisethreshold[0] && std::abs(cury-coordinates[3*p+1]) <= noisethreshold[1] && std::abs(curz-coordinates[3*p+2]) <= noisethreshold[2])
+                            {
+                                identicalpairs[t].push_back(i);
+                                identicalpairs[t].push_back(p);
+                            }
+                        }
+                    }
+                }
             }
         }
-        while (coordgroup.next());
-        
-        numnonduplicates++;
+    };
+    
+    if (numthreadstouse == 1)
+        findidentical(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(findidentical, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+    
+    ///// Merge the identical points.
+    // All pairs are ordered by point since every thread processes an ascending block of points.
+    // A point is merged with the lowest index non-merged point identical to it (if any):
+    std::vector<int> lowerpoints(numpts, -1);
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        for (int j = 0; j < identicalpairs[t].size()/2; j++)
+        {
+            int i = identicalpairs[t][2*j+0], p = identicalpairs[t][2*j+1];
+            // Only a non-merged point is kept (all lower points are already processed):
+            if (lowerpoints[p] == -1 && (lowerpoints[i] == -1 || p < lowerpoints[i]))
+                lowerpoints[i] = p;
+        }
+        identicalpairs[t] = {};
+    }
+    
+    int numnonduplicates = 0;
+    for (int i = 0; i < numpts; i++)
+    {
+        if (lowerpoints[i] == -1)
+        {
+            renumberingvector[i] = numnonduplicates;
+            numnonduplicates++;
+        }
+        else
+            renumberingvector[i] = renumberingvector[lowerpoints[i]];
     }
     
     return numnonduplicates;
@@ -159,13 +450,17 @@ void gentools::stablesort(std::vector<int>& tosort, std::vector<int>& reordering
     
     // Set 'reorderingvector' to [0 1 2 ...]:
     std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
+    
+    // Radix sort for large vectors:
+    if (tosort.size() >= 100000)
+    {
+        stableradixsort([&](int i){ return tounsignedkey(tosort[i]); }, reorderingvector);
+        return;
+    }
+    
     // Sort 'reorderingvector' according to 'tosort':
     // The < operator is overloaded by a lambda function.
-    #if defined(__linux__)
-    __gnu_parallel::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
-    #else
     std::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
-    #endif
         { 
             if (tosort[elem1] < tosort[elem2])
                 return true;
@@ -176,6 +471,75 @@ void gentools::stablesort(std::vector<int>& tosort, std::vector<int>& reordering
         });
 }
 
+void gentools::stablecountingsort(std::vector<int>& tosort, std::vector<int>& reorderingvector, int maxval)
+{
+    int numvals = tosort.size();
+    int numbins = maxval+2;
+    
+    if (reorderingvector.size() != numvals)
+        reorderingvector.resize(numvals);
+    
+    // Every thread counts the values in its block (value -1 is in bin 0):
+    int numthreadstouse = autotuning::getnumthreadsforvalues(numvals);
+    std::vector<std::vector<int>> counts(numthreadstouse, std::vector<int>(numbins, 0));
+    
+    auto countvalues = [&](int t)
+    {
+        int first = (long long int)t*numvals/numthreadstouse;
+        int last = (long long int)(t+1)*numvals/numthreadstouse;
+        
+        for (int i = first; i < last; i++)
+            counts[t][tosort[i]+1]++;
+    };
+    
+    // Each thread then places its values starting at its offset in each bin:
+    auto placevalues = [&](int t)
+    {
+        int first = (long long int)t*numvals/numthreadstouse;
+        int last = (long long int)(t+1)*numvals/numthreadstouse;
+        
+        for (int i = first; i < last; i++)
+        {
+            reorderingvector[counts[t][tosort[i]+1]] = i;
+            counts[t][tosort[i]+1]++;
+        }
+    };
+    
+    if (numthreadstouse == 1)
+        countvalues(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(countvalues, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+    
+    // Turn the counts into offsets (bin by bin then thread by thread for a stable sorting):
+    int offset = 0;
+    for (int b = 0; b < numbins; b++)
+    {
+        for (int t = 0; t < numthreadstouse; t++)
+        {
+            int curcount = counts[t][b];
+            counts[t][b] = offset;
+            offset += curcount;
+        }
+    }
+    
+    if (numthreadstouse == 1)
+        placevalues(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(placevalues, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+}
+
 void gentools::stablesort(double noisethreshold, std::vector<double>& tosort, std::vector<int>& reorderingvector)
 {
     if (reorderingvector.size() != tosort.size())
@@ -185,7 +549,7 @@ void gentools::stablesort(double noisethreshold, std::vector<double>& tosort, st
     std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
     // Sort 'reorderingvector' according to 'tosort':
     // The < operator is overloaded by a lambda function.
-    std::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
+    parallelsort(reorderingvector, [&](int elem1, int elem2)
         { 
             if (tosort[elem1] < tosort[elem2] - noisethreshold)
                 return true;
@@ -205,7 +569,7 @@ void gentools::stablesort(double noisethreshold, std::vector<double>& tosort, st
     std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
     // Sort 'reorderingvector' according to 'tosort':
     // The < operator is overloaded by a lambda function.
-    std::sort(reorderingvector.begin(), reorderingvector.end(), [&](int elem1, int elem2)
+    parallelsort(reorderingvector, [&](int elem1, int elem2)
         { 
             for (int i = 0; i < blocklen; i++)
             {
@@ -236,12 +600,30 @@ bool sortfun(const std::tuple<int,int,double>& elem1, const std::tuple<int,int,d
     
 void gentools::tuple3sort(std::vector<std::tuple<int,int,double>>& tosort)
 {
-    // Parallel sort on Linux only for now:
-    #if defined(__linux__)
-    __gnu_parallel::sort(tosort.begin(), tosort.end(), sortfun);
-    #else
-    std::sort(tosort.begin(), tosort.end(), sortfun);
-    #endif
+    int numtuples = tosort.size();
+    
+    if (numtuples < 100000)
+    {
+        std::sort(tosort.begin(), tosort.end(), sortfun);
+        return;
+    }
+    
+    // Radix sort according to the second then (stably) the first int:
+    std::vector<int> reorderingvector(numtuples);
+    std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
+    stableradixsort([&](int i){ return tounsignedkey(std::get<1>(tosort[i])); }, reorderingvector);
+    stableradixsort([&](int i){ return tounsignedkey(std::get<0>(tosort[i])); }, reorderingvector);
+    
+    int numthreadstouse = autotuning::getnumthreadsforvalues(numtuples);
+    std::vector<std::tuple<int,int,double>> sorted(numtuples);
+    runinthreads(numthreadstouse, [&](int t)
+    {
+        int first = (long long int)t*numtuples/numthreadstouse;
+        int last = (long long int)(t+1)*numtuples/numthreadstouse;
+        for (int i = first; i < last; i++)
+            sorted[i] = tosort[reorderingvector[i]];
+    });
+    tosort.swap(sorted);
 }
 
 void gentools::slicecoordinates(std::vector<double>& toslice, double minx, double miny, double minz, double dx, double dy, double dz, int nsx, int nsy, int nsz, std::vector<int>& ga, int* pn, double* pc)
@@ -489,7 +871,163 @@ int gentools::getroot(polynomials& polys, std::vector<double>& rhs, std::vector<
     return 1;
 }
 
-void gentools::getreferencecoordinates(coordinategroup& coordgroup, int disjreg, std::vector<int>& elems, std::vector<double>& kietaphis)
+void gentools::getroots(polynomials& polys, int elemdim, std::vector<double>& nodecoords, std::vector<int>& rankings, std::vector<double>& rhs, std::vector<double>& guesses, std::vector<int>& status, bool isaffine, double boxsize, double tol, int maxit)
+{
+    int numnodes = polys.count();
+    int numpairs = rankings.size()/3;
+    int numderivs = elemdim+1;
+    
+    // Limit the jumps to a fraction of the box size:
+    double maxjump = 0.45;
+    
+    status = std::vector<int>(numpairs, -1);
+    
+    // Pairs still iterated:
+    std::vector<int> active(numpairs);
+    std::iota(active.begin(), active.end(), 0);
+    
+    std::vector<double> points, rankedcoords, mapped;
+    std::vector<densemat> ffvals(numderivs);
+    
+    for (int it = 0; it < maxit && active.size() > 0; it++)
+    {
+        int numactive = active.size();
+        
+        // The derivatives of an affine mapping are constant. Its form functions are evaluated at the origin only:
+        int numevals = (isaffine ? 1 : numactive);
+        points = std::vector<double>(3*numevals, 0.0);
+        if (not(isaffine))
+        {
+            for (int a = 0; a < numactive; a++)
+            {
+                for (int j = 0; j < 3; j++)
+                    points[3*a+j] = guesses[3*active[a]+j];
+            }
+        }
+        for (int d = 0; d < numderivs; d++)
+            ffvals[d] = polys.evalat(points, d);
+        
+        // Node coordinates of the active pairs in the ranked directions (direction x node x pair):
+        rankedcoords.resize((long long int)elemdim*numnodes*numactive);
+        for (int i = 0; i < elemdim; i++)
+        {
+            for (int n = 0; n < numnodes; n++)
+            {
+                double* rcptr = &rankedcoords[((long long int)i*numnodes+n)*numactive];
+                for (int a = 0; a < numactive; a++)
+                    rcptr[a] = nodecoords[((long long int)active[a]*numnodes+n)*3 + rankings[3*active[a]+i]];
+            }
+        }
+        
+        // Mapping value and derivatives in every ranked direction (direction x derivative x pair):
+        mapped = std::vector<double>((long long int)elemdim*numderivs*numactive, 0.0);
+        for (int i = 0; i < elemdim; i++)
+        {
+            for (int d = 0; d < numderivs; d++)
+            {
+                double* mptr = &mapped[((long long int)i*numderivs+d)*numactive];
+                for (int n = 0; n < numnodes; n++)
+                {
+                    double* ffptr = ffvals[d].getvalues() + (long long int)n*numevals;
+                    double* rcptr = &rankedcoords[((long long int)i*numnodes+n)*numactive];
+                    if (isaffine)
+                    {
+                        double ffval = ffptr[0];
+                        #pragma omp simd
+                        for (int a = 0; a < numactive; a++)
+                            mptr[a] += ffval * rcptr[a];
+                    }
+                    else
+                    {
+                        #pragma omp simd
+                        for (int a = 0; a < numactive; a++)
+                            mptr[a] += ffptr[a] * rcptr[a];
+                    }
+                }
+            }
+        }
+        
+        // Newton update of every pair. The converged pairs and the ones out of the box leave the iterations:
+        int numremaining = 0;
+        for (int a = 0; a < numactive; a++)
+        {
+            int p = active[a];
+            double* guess = &guesses[3*p];
+            
+            // Residual and Jacobian (jac[i*3+j] is the derivative of direction i in reference direction j):
+            double res[3] = {0,0,0}, jac[9] = {0,0,0,0,0,0,0,0,0};
+            for (int i = 0; i < elemdim; i++)
+            {
+                res[i] = mapped[((long long int)i*numderivs+0)*numactive+a] - rhs[3*p+i];
+                for (int j = 0; j < elemdim; j++)
+                {
+                    jac[i*3+j] = mapped[((long long int)i*numderivs+1+j)*numactive+a];
+                    // The affine mapping was evaluated at the origin:
+                    if (isaffine)
+                        res[i] += jac[i*3+j]*guess[j];
+                }
+            }
+            
+            double delta[3] = {0,0,0};
+            switch (elemdim)
+            {
+                case 1:
+                {
+                    delta[0] = -1.0/jac[0] * res[0];
+                    break;
+                }
+                case 2:
+                {
+                    double invdet = 1.0/(jac[0]*jac[4] - jac[1]*jac[3]);
+                    delta[0] = -invdet * (jac[4]*res[0] - jac[1]*res[1]);
+                    delta[1] = -invdet * (-jac[3]*res[0] + jac[0]*res[1]);
+                    break;
+                }
+                case 3:
+                {
+                    double jac11 = jac[0], jac12 = jac[1], jac13 = jac[2], jac21 = jac[3], jac22 = jac[4], jac23 = jac[5], jac31 = jac[6], jac32 = jac[7], jac33 = jac[8];
+                    double f = res[0], g = res[1], h = res[2];
+                    
+                    double invdet = 1.0/(jac11*jac22*jac33 - jac11*jac23*jac32 - jac12*jac21*jac33 + jac12*jac23*jac31 + jac13*jac21*jac32 - jac13*jac22*jac31);
+                    
+                    delta[0] = -invdet * ((jac22*jac33 - jac23*jac32)*f - (jac12*jac33 - jac13*jac32)*g + (jac12*jac23 - jac13*jac22)*h);
+                    delta[1] = -invdet * (-(jac21*jac33 - jac23*jac31)*f + (jac11*jac33 - jac13*jac31)*g - (jac11*jac23 - jac13*jac21)*h);
+                    delta[2] = -invdet * ((jac21*jac32 - jac22*jac31)*f - (jac11*jac32 - jac12*jac31)*g + (jac11*jac22 - jac12*jac21)*h);
+                    break;
+                }
+            }
+            
+            // The affine solution is exact. It is in the box if the scaled Newton steps toward it stay in the box:
+            if (not(isaffine))
+            {
+                double scaling = maxjump*boxsize / ( std::abs(delta[0])+std::abs(delta[1])+std::abs(delta[2]) );
+                if (scaling < 1.0)
+                {
+                    for (int j = 0; j < elemdim; j++)
+                        delta[j] *= scaling;
+                }
+            }
+            
+            bool isinbox = true, isconverged = true;
+            for (int j = 0; j < elemdim; j++)
+            {
+                guess[j] += delta[j];
+                isinbox = (isinbox && not(std::abs(guess[j]) > boxsize));
+                isconverged = (isconverged && not(std::abs(delta[j]) > tol));
+            }
+            
+            if (not(isinbox))
+                status[p] = 0;
+            else if (isconverged || isaffine)
+                status[p] = 1;
+            else
+                active[numremaining++] = p;
+        }
+        active.resize(numremaining);
+    }
+}
+
+void gentools::getreferencecoordinates(std::vector<double>& coords, int disjreg, std::vector<int>& elems, std::vector<double>& kietaphis)
 {
     int problemdimension = universe::getrawmesh()->getmeshdimension();
     
@@ -502,98 +1040,128 @@ void gentools::getreferencecoordinates(coordinategroup& coordgroup, int disjreg,
     int elemorder = myelems->getcurvatureorder();
     
     int rangebegin = mydisjregs->getrangebegin(disjreg), rangeend = mydisjregs->getrangeend(disjreg);
-    int numelems = rangeend-rangebegin+1;
+    int numcoords = coords.size()/3;
 
     polynomials polys(lagrangeformfunction(elemtypenum,elemorder,{}).getformfunctionpolynomials());
-    element myel(elemtypenum, elemorder);
-    
-    double alpha = 1.0+1.0e-8;
-    if (elemorder > 1)
-        alpha = 1.1;
     
-    // Get the element barycenter coordinates:
-    std::vector<double>* barycenters = myelems->getbarycenters(elemtypenum);
-    // Get the dimensions of the box centered at the barycenter and surrounding all nodes in an element:
+    // Get the dimensions of the box centered at the barycenter and surrounding all nodes in an element.
+    // This and the tree are populated here since it cannot be done concurrently by the threads:
     std::vector<double>* boxdimensions = myelems->getboxdimensions(elemtypenum);
+    elementtree* mytree = myelems->gettree(elemtypenum);
+
+    // Only straight simplices have an affine mapping:
+    bool isaffine = (elemorder == 1 && (elemtypenum == 1 || elemtypenum == 2 || elemtypenum == 4));
+    
+    // Maximum number of (coordinate, candidate element) pairs inverted together:
+    int maxnumpairs = 4096;
 
-    // Loop on all elements in the disjoint region:
-    for (int e = 0; e < numelems; e++)
+    // Locate the coordinates from 'firstcoord' to 'lastcoord'-1:
+    auto locate = [&](int firstcoord, int lastcoord)
     {
-        double curelem = rangebegin+e;
+        element myel(elemtypenum, elemorder);
+        std::vector<int> candidates;
         
-        polynomials syspolys;
-        std::vector<int> coordranking = {};
+        // Candidate elements of every coordinate not yet found (in CSR format):
+        std::vector<int> candidateadresses(lastcoord-firstcoord+1, 0);
+        std::vector<int> allcandidates = {};
+        for (int c = firstcoord; c < lastcoord; c++)
+        {
+            if (elems[c] == -1)
+            {
+                mytree->find(coords[3*c+0], coords[3*c+1], coords[3*c+2], candidates, rangebegin, rangeend);
+                allcandidates.insert(allcandidates.end(), candidates.begin(), candidates.end());
+            }
+            candidateadresses[c-firstcoord+1] = allcandidates.size();
+        }
         
-        double xbary = barycenters->at(3*curelem+0); double ybary = barycenters->at(3*curelem+1); double zbary = barycenters->at(3*curelem+2);
-        std::vector<double> elemdist = {alpha*boxdimensions->at(3*curelem+0), alpha*boxdimensions->at(3*curelem+1), alpha*boxdimensions->at(3*curelem+2)};
-        // To avoid noise related issues and to work with rotating interfaces:
-        double noisedist = 0.1*(elemdist[0]+elemdist[1]+elemdist[2]);
-        elemdist[0] += noisedist; elemdist[1] += noisedist; elemdist[2] += noisedist;
+        std::vector<int> paircoords, pairelems, rankings, status;
+        std::vector<double> rhs, guesses, nodecoords;
+        std::vector<int> coordranking = {};
         
-        // Loop on all candidate groups:
-        coordgroup.select(xbary,ybary,zbary, *std::max_element(elemdist.begin(),elemdist.end()));
-        do
+        // The k-th candidates of all coordinates not yet found are inverted together:
+        for (int k = 0; ; k++)
         {
-            int numcoordsingroup = coordgroup.countgroupcoordinates();
-            int* curgroupindexes = coordgroup.getgroupindexes();
-            double* curgroupcoords = coordgroup.getgroupcoordinates();
+            paircoords = {};
+            for (int c = firstcoord; c < lastcoord; c++)
+            {
+                if (elems[c] == -1 && candidateadresses[c-firstcoord+1]-candidateadresses[c-firstcoord] > k)
+                    paircoords.push_back(c);
+            }
+            if (paircoords.size() == 0)
+                break;
             
-            // Loop on all coordinates in the current group:
-            for (int c = 0; c < numcoordsingroup; c++)
+            for (int pb = 0; pb < paircoords.size(); pb += maxnumpairs)
             {
-                int curindex = curgroupindexes[c];
-                double curx = curgroupcoords[3*c+0], cury = curgroupcoords[3*c+1], curz = curgroupcoords[3*c+2];
-
-                // Only process when not yet found and when the coordinate is close enough to the element barycenter.
-                if (elems[curindex] != -1 || std::abs(curx-xbary) > elemdist[0] || std::abs(cury-ybary) > elemdist[1] || std::abs(curz-zbary) > elemdist[2]) {}
-                else
+                int numpairs = std::min(maxnumpairs, (int)paircoords.size()-pb);
+                
+                pairelems.resize(numpairs);
+                rankings.resize(3*numpairs);
+                rhs.resize(3*numpairs);
+                guesses = std::vector<double>(3*numpairs, 0.0);
+                
+                for (int p = 0; p < numpairs; p++)
                 {
-                    // Reset initial guess:
-                    std::vector<double> kietaphi = {0.0,0.0,0.0};
-                    std::vector<double> rhs = {curx, cury, curz};
-
-                    // Only create once for all coordinates the polynomials and only for the required elements:
-                    if (syspolys.count() == 0)
-                    {
-                        // The coordinate polynomial used to calculate the reference coordinate must be carefully selected:
-                        if (problemdimension == 3 && elemdim == 2)
-                        {
-                            std::vector<double> curnormal = myelems->getnormal(elemtypenum, curelem);
-                            curnormal = {std::abs(curnormal[0]), std::abs(curnormal[1]), std::abs(curnormal[2])};
-                            stablesort(0, curnormal, coordranking);
-                        }
-                        else
-                        {
-                            stablesort(0, elemdist, coordranking);
-                            coordranking = {coordranking[2],coordranking[1],coordranking[0]};
-                        }
-                        
-                        std::vector<int> trimmedcr = coordranking;
-                        trimmedcr.resize(elemdim);
+                    int c = paircoords[pb+p];
+                    int curelem = allcandidates[candidateadresses[c-firstcoord]+k];
+                    pairelems[p] = curelem;
                     
-                        std::vector<double> curcoords = myelems->getnodecoordinates(elemtypenum, curelem);
-                        
-                        std::vector<double> xyz = gentools::separate(curcoords, 3, trimmedcr);
-                        syspolys = polys.sum(xyz);
+                    // The coordinate polynomial used to calculate the reference coordinate must be carefully selected:
+                    if (problemdimension == 3 && elemdim == 2)
+                    {
+                        std::vector<double> curnormal = myelems->getnormal(elemtypenum, curelem);
+                        curnormal = {std::abs(curnormal[0]), std::abs(curnormal[1]), std::abs(curnormal[2])};
+                        stablesort(0, curnormal, coordranking);
+                    }
+                    else
+                    {
+                        std::vector<double> elemdist = {boxdimensions->at(3*curelem+0), boxdimensions->at(3*curelem+1), boxdimensions->at(3*curelem+2)};
+                        stablesort(0, elemdist, coordranking);
+                        coordranking = {coordranking[2],coordranking[1],coordranking[0]};
                     }
-                    rhs = {rhs[coordranking[0]],rhs[coordranking[1]],rhs[coordranking[2]]};
                     
-                    if (getroot(syspolys, rhs, kietaphi) == 1)
+                    for (int i = 0; i < 3; i++)
                     {
-                        // Check if the (ki,eta,phi) coordinates are inside the element:
-                        if (myel.isinsideelement(kietaphi[0], kietaphi[1], kietaphi[2]))
-                        {
-                            kietaphis[3*curindex+0] = kietaphi[0]; 
-                            kietaphis[3*curindex+1] = kietaphi[1]; 
-                            kietaphis[3*curindex+2] = kietaphi[2];
-                            elems[curindex] = curelem;
-                        }
+                        rankings[3*p+i] = coordranking[i];
+                        rhs[3*p+i] = coords[3*c+coordranking[i]];
+                    }
+                }
+                
+                myelems->getnodecoordinates(elemtypenum, pairelems, nodecoords);
+                getroots(polys, elemdim, nodecoords, rankings, rhs, guesses, status, isaffine);
+                
+                for (int p = 0; p < numpairs; p++)
+                {
+                    // Check if the (ki,eta,phi) coordinates are inside the element:
+                    if (status[p] == 1 && myel.isinsideelement(guesses[3*p+0], guesses[3*p+1], guesses[3*p+2]))
+                    {
+                        int c = paircoords[pb+p];
+                        kietaphis[3*c+0] = guesses[3*p+0]; 
+                        kietaphis[3*c+1] = guesses[3*p+1]; 
+                        kietaphis[3*c+2] = guesses[3*p+2];
+                        elems[c] = pairelems[p];
                     }
                 }
             }
         }
-        while (coordgroup.next());
+    };
+    
+    // Every thread locates a contiguous block of coordinates (require a min number of coordinates per thread):
+    int numthreadstouse = std::min(numcoords/1000+1, universe::getmaxnumthreads());
+    if (numthreadstouse <= 1)
+    {
+        locate(0, numcoords);
+        return;
     }
+    
+    std::vector<std::thread> threadobjs(numthreadstouse);
+    for (int t = 0; t < numthreadstouse; t++)
+    {
+        int firstcoord = (long long int)t*numcoords/numthreadstouse;
+        int lastcoord = (long long int)(t+1)*numcoords/numthreadstouse;
+        threadobjs[t] = universe::newthread(locate, firstcoord, lastcoord);
+    }
+    for (int t = 0; t < numthreadstouse; t++)
+        threadobjs[t].join();
 }
 
 std::vector<std::vector<double>> gentools::splitvector(std::vector<double>& tosplit, int blocklen)
@@ -685,6 +1253,22 @@ bool gentools::isflipped(std::vector<int>& a, std::vector<int>& b)
         return true;
 }
 
+double gentools::compensatedsum(const double* values, long long int numvalues, long long int stride)
+{
+    double sum = 0.0, compensation = 0.0;
+    for (long long int i = 0; i < numvalues; i++)
+    {
+        double val = values[i*stride];
+        double t = sum + val;
+        if (std::abs(sum) >= std::abs(val))
+            compensation += (sum - t) + val;
+        else
+            compensation += (val - t) + sum;
+        sum = t;
+    }
+    return sum + compensation;
+}
+
 std::vector<double> gentools::normblocks(std::vector<double>& tonorm, int blocklen)
 {
     int numblocks = tonorm.size()/blocklen;
@@ -1436,7 +2020,7 @@ int gentools::findcoordinates(std::vector<double>& targetcoords, std::vector<dou
     return numfound;
 }
 
-void gentools::selectcoordinates(std::vector<bool>& selection, std::vector<double>& coords, double* selectedcoords)
+void gentools::selectcoordinates(std::vector<bool>& selection, const std::vector<double>& coords, double* selectedcoords)
 {
     int index = 0;
     for (int i = 0; i < selection.size(); i++)
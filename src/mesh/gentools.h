@@ -31,6 +31,9 @@ namespace gentools
     void stablecoordinatesort(std::vector<double> noisethreshold, std::vector<double>& coordinates, std::vector<int>& reorderingvector);
     // Same as above but first sort according to a vector of integers:
     void stablecoordinatesort(std::vector<double> noisethreshold, std::vector<int>& elems, std::vector<double>& coordinates, std::vector<int>& reorderingvector);
+    // Provide a vector to reorder the coordinates [coord1x coord1y coord1z coord2x ...] along a 3D Hilbert space-filling curve.
+    // Coordinates close to each other along the curve are close in space: sortedcoordinates = coordinates(reorderingvector,:).
+    void hilbertsort(std::vector<double>& coordinates, std::vector<int>& reorderingvector);
     
     // 'removeduplicates' outputs a vector that can be used to 
     // renumber the nodes so that all duplicates are removed:
@@ -41,9 +44,11 @@ namespace gentools
     // Remove duplicated coordinates:
     void removeduplicates(std::vector<double>& coordinates);
     
-    // This is for a vector of ints:
+    // This is for a vector of ints (parallel radix sort for large vectors):
     void stablesort(std::vector<int>& tosort, std::vector<int>& reorderingvector);
-    // This is for a vector of doubles:
+    // Same for a vector of ints in range [-1, maxval] where 'maxval' is small (parallel counting sort):
+    void stablecountingsort(std::vector<int>& tosort, std::vector<int>& reorderingvector, int maxval);
+    // This is for a vector of doubles (parallel merge sort, as for the coordinate sorts):
     void stablesort(double noisethreshold, std::vector<double>& tosort, std::vector<int>& reorderingvector);
     // Same but sort by blocks of size 'blocklen':
     void stablesort(double noisethreshold, std::vector<double>& tosort, std::vector<int>& reorderingvector, int blocklen);
@@ -73,12 +78,20 @@ namespace gentools
     // is farther away than 'boxsize' from the origin then the function stops and returns 0. Value -1 is returned in any other case.
     // The initial guess is supposed to be inside the box.
     int getroot(polynomials& polys, std::vector<double>& rhs, std::vector<double>& initialguess, double boxsize = 2, double tol = 1e-10, int maxit = 20);
+    // Batched version of 'getroot' for the mappings of many elements of a same type. Pair p solves sum_n polys[n]*x(p,n,ranking(p,i)) = rhs(p,i)
+    // for i < 'elemdim', with x(p,n,:) the coordinates of node n of its element ('nodecoords' holds numnodes x 3 values per pair, see
+    // 'elements::getnodecoordinates') and ranking(p,:) the 3 values per pair in 'rankings'. All active pairs are iterated together and
+    // leave the iterations once converged or out of the box. Affine mappings ('isaffine' true) are inverted in closed form instead.
+    // The solutions are placed in 'guesses' (initial guesses, 3 values per pair) and the 'getroot' return values in 'status'.
+    void getroots(polynomials& polys, int elemdim, std::vector<double>& nodecoords, std::vector<int>& rankings, std::vector<double>& rhs, std::vector<double>& guesses, std::vector<int>& status, bool isaffine = false, double boxsize = 2, double tol = 1e-10, int maxit = 20);
 
     // Get the reference coordinates and the element numbers corresponding to each (x,y,z) coordinate provided as argument. 
     // If the ith coordinate (xi,yi,zi) cannot be found in any element of the disjoint region then elems[i] is unchanged.
     // Any coordinate for which elems[i] is not -1 is ignored. 'elems' and 'kietaphis' must be preallocated to size numcoords and 3*numcoords.
     // This function is designed to be called in a for loop on multiple disjoint regions of same element type.
-    void getreferencecoordinates(coordinategroup& coordgroup, int disjreg, std::vector<int>& elems, std::vector<double>& kietaphis);
+    // The candidate elements of every coordinate are obtained from the element box tree and the coordinates are processed in parallel.
+    // The k-th candidates of all coordinates not yet found are inverted together with 'getroots'.
+    void getreferencecoordinates(std::vector<double>& coords, int disjreg, std::vector<int>& elems, std::vector<double>& kietaphis);
  
     // Split the 'tosplit' vector into 'blocklen' vectors of length tosplit.size()/blocklen.
     std::vector<std::vector<double>> splitvector(std::vector<double>& tosplit, int blocklen);
@@ -94,6 +107,9 @@ namespace gentools
     // Length 1 is considered not flipped. Length 2 is considered flipped if not identical.
     bool isflipped(std::vector<int>& a, std::vector<int>& b);
     
+    // Compensated (Neumaier) sum of 'numvalues' values separated by 'stride'. The round-off error does not grow with the number of values:
+    double compensatedsum(const double* values, long long int numvalues, long long int stride = 1);
+    
     // Norm each block in the vector:
     std::vector<double> normblocks(std::vector<double>& tonorm, int blocklen);
     
@@ -194,7 +210,7 @@ namespace gentools
     int findcoordinates(std::vector<double>& targetcoords, std::vector<double>& tofindintarget, std::vector<int>& posfound);
     
     // Write to 'selectedcoords' the coordinates in 'coords' that have a true selection value: 
-    void selectcoordinates(std::vector<bool>& selection, std::vector<double>& coords, double* selectedcoords);
+    void selectcoordinates(std::vector<bool>& selection, const std::vector<double>& coords, double* selectedcoords);
     
     // From the candidates vector pick a set of coordinates that have rather equally spaced (possibly NOT UNIQUE) indexes:
     void pickcandidates(int numbertopick, std::vector<double>& candidatecoordinates, std::vector<double>& picked);
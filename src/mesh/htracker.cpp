@@ -1,6 +1,8 @@
 #include "htracker.h"
 #include "gentools.h"
 #include "lagrangeformfunction.h"
+#include "universe.h"
+#include <thread>
 
 
 htracker::htracker(std::shared_ptr<rawmesh> origmesh, int curvatureorder, std::vector<int> numelemspertype)
@@ -97,6 +99,18 @@ int htracker::getmaxdepth(void)
     return maxdepth;
 }
 
+void htracker::settree(std::vector<bool> tree, int depth, int leaves)
+{
+    splitdata = tree;
+    maxdepth = depth;
+    numleaves = leaves;
+    
+    // The cursor refers to the old tree:
+    cursorposition = -1;
+    currentdepth = -1;
+    origindexintype = -1;
+}
+
 void htracker::resetcursor(bool calcrefcoords)
 {
     isrefcalc = calcrefcoords;
@@ -114,6 +128,100 @@ void htracker::resetcursor(bool calcrefcoords)
         parentrefcoords[0] = {straightrefcoords[parenttypes[0]]};
 }
 
+void htracker::setcursor(int position, int origtype, int origindex, bool calcrefcoords)
+{
+    resetcursor(calcrefcoords);
+    
+    cursorposition = position;
+    origindexintype = origindex;
+    parenttypes[0] = origtype;
+    if (isrefcalc)
+        parentrefcoords[0] = {straightrefcoords[origtype]};
+}
+
+int htracker::countoriginals(void)
+{
+    int numorig = 0;
+    for (int i = 0; i < 8; i++)
+        numorig += originalcount[i];
+    return numorig;
+}
+
+void htracker::getblocks(int numblocks, std::vector<int>& positions, std::vector<int>& origtypes, std::vector<int>& origindexes, std::vector<int>& firstleaves, std::vector<std::vector<int>>& leavesbefore)
+{
+    long long int numorig = countoriginals();
+
+    positions = std::vector<int>(numblocks+1);
+    origtypes = std::vector<int>(numblocks+1, -1);
+    origindexes = std::vector<int>(numblocks+1, -1);
+    firstleaves = std::vector<int>(numblocks+1);
+    leavesbefore = std::vector<std::vector<int>>(numblocks+1);
+    
+    std::vector<int> curleavesbefore(8,0);
+    
+    resetcursor();
+    
+    int ln = -1; // leaf number
+    int oi = -1; // original element index in tree order
+    int b = 0;
+    while (true)
+    {
+        if (currentdepth == 0)
+        {
+            oi++;
+            // Multiple blocks are empty and start at the same place if there are more blocks than original elements: 
+            while (b < numblocks && oi == b*numorig/numblocks)
+            {
+                positions[b] = cursorposition;
+                origtypes[b] = parenttypes[0];
+                origindexes[b] = origindexintype;
+                firstleaves[b] = ln+1;
+                leavesbefore[b] = curleavesbefore;
+                b++;
+            }
+        }
+        
+        if (isatleaf())
+        {
+            ln++;
+            curleavesbefore[parenttypes[currentdepth]]++;
+        }
+        
+        if (ln == numleaves-1)
+            break;
+        
+        next();
+    }
+    
+    for (; b <= numblocks; b++)
+    {
+        positions[b] = splitdata.size();
+        firstleaves[b] = numleaves;
+        leavesbefore[b] = curleavesbefore;
+    }
+}
+
+htracker htracker::getcursorcopy(void)
+{
+    htracker output;
+    
+    output.myoriginalmesh = myoriginalmesh;
+    output.splitdata = splitdata;
+    output.maxdepth = maxdepth;
+    output.numleaves = numleaves;
+    output.originalcurvatureorder = originalcurvatureorder;
+    output.originalcount = originalcount;
+    output.numsubelems = numsubelems;
+    output.nn = nn;
+    output.ncn = ncn;
+    output.straightrefcoords = straightrefcoords;
+    output.curvedrefcoords = curvedrefcoords;
+    output.myelems = myelems;
+    output.mycurvedelems = mycurvedelems;
+    
+    return output;
+}
+
 int htracker::next(void)
 {
     elements* myelements = getoriginalmesh()->getelements();
@@ -569,43 +677,83 @@ void htracker::atleaves(std::vector<std::vector<double>>& arc, std::vector<std::
     if (withphysicals)
         apc = arc;
 
-    resetcursor(true);
+    // The subtrees of blocks of original elements are independent and are processed in parallel:
+    int numthreadstouse = std::min(countoriginals()/1000+1, universe::getmaxnumthreads()); // require a min num original elements per thread
     
-    std::vector<double> oc;
+    std::vector<int> bpos, btype, bindex, bleaf;
+    std::vector<std::vector<int>> bbefore;
+    getblocks(numthreadstouse, bpos, btype, bindex, bleaf, bbefore);
     
-    int ln = -1; // leaf number
-    std::vector<int> iarc(8,0); // indexes in arc
-    while (true)
-    {
-        int t = parenttypes[currentdepth];
-        int ns = currentdepth;
+    // Each thread moves its own cursor (the undefined through-edge numbers are defined in its own tree copy):
+    std::vector<htracker> cursors(numthreadstouse);
     
-        if (withphysicals && ns == 0)
-            oc = myelements->getnodecoordinates(t, origindexintype);
+    auto processblock = [&](int b)
+    {
+        if (bleaf[b] == bleaf[b+1])
+            return;
     
-        if (isatleaf())
+        htracker& cur = cursors[b];
+        cur = getcursorcopy();
+        cur.setcursor(bpos[b], btype[b], bindex[b], true);
+        
+        std::vector<double> oc;
+        
+        int ln = bleaf[b]-1; // leaf number
+        std::vector<int> iarc(8); // indexes in arc
+        for (int i = 0; i < 8; i++)
+            iarc[i] = 3*nn[i]*bbefore[b][i];
+        while (true)
         {
-            ln++;
-            
-            std::vector<double> refcoords = getreferencecoordinates();
-            std::vector<double> physcoords;
-            if (withphysicals)
-                physcoords = myelems[parenttypes[0]].calculatecoordinates(refcoords, oc, 0, ns == 0);
-            
-            for (int i = 0; i < refcoords.size(); i++)
+            int t = cur.parenttypes[cur.currentdepth];
+            int ns = cur.currentdepth;
+        
+            if (withphysicals && ns == 0)
+                oc = myelements->getnodecoordinates(t, cur.origindexintype);
+        
+            if (cur.isatleaf())
             {
-                arc[t][iarc[t]+i] = refcoords[i];
+                ln++;
+                
+                std::vector<double> refcoords = cur.getreferencecoordinates();
+                std::vector<double> physcoords;
                 if (withphysicals)
-                    apc[t][iarc[t]+i] = physcoords[i];
+                    physcoords = cur.myelems[cur.parenttypes[0]].calculatecoordinates(refcoords, oc, 0, ns == 0);
+                
+                for (int i = 0; i < refcoords.size(); i++)
+                {
+                    arc[t][iarc[t]+i] = refcoords[i];
+                    if (withphysicals)
+                        apc[t][iarc[t]+i] = physcoords[i];
+                }
+                
+                iarc[t] += refcoords.size();
             }
             
-            iarc[t] += refcoords.size();
+            if (ln == bleaf[b+1]-1)
+                break;
+                
+            cur.next();
         }
-        
-        if (ln == numleaves-1)
-            break;
-            
-        next();
+    };
+    
+    if (numthreadstouse == 1)
+        processblock(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(processblock, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+    
+    // Bring back the through-edge numbers defined in every block:
+    for (int b = 0; b < numthreadstouse; b++)
+    {
+        if (bleaf[b] == bleaf[b+1])
+            continue;
+        for (int i = bpos[b]; i < bpos[b+1]; i++)
+            splitdata[i] = cursors[b].splitdata[i];
     }
 }
 
@@ -631,116 +779,135 @@ void htracker::getadaptedcoordinates(std::vector<std::vector<double>>& ac)
     std::vector<bool> isedgesplit;
     gentools::assignedgenumbers(iol, cornerapc, edgenumbers, isedgesplit);
     
-
-    // Preallocate output containers to upper bound size:
-    ac = std::vector<std::vector<double>>(8, std::vector<double>(0));
-    transitionsrefcoords = std::vector<std::vector<double>>(8, std::vector<double>(0));
-    leavesoftransitions = std::vector<std::vector<int>>(8, std::vector<int>(0));
-    originalsoftransitions = std::vector<std::vector<int>>(8, std::vector<int>(0));
-
-    std::vector<int> ub = countupperbound();
-    for (int i = 0; i < 8; i++)
-    {
-        ac[i] = std::vector<double>(3*ncn[i]*ub[i]);
-        leavesoftransitions[i] = std::vector<int>(ub[i]);
-        originalsoftransitions[i] = std::vector<int>(2*ub[i]);
-        transitionsrefcoords[i] = std::vector<double>(3*nn[i]*ub[i]);
-    }
     
-    resetcursor();
+    // The subtrees of blocks of original elements are independent and are processed in parallel:
+    int numthreadstouse = std::min(countoriginals()/1000+1, universe::getmaxnumthreads()); // require a min num original elements per thread
     
-    std::vector<double> oc;
+    std::vector<int> bpos, btype, bindex, bleaf;
+    std::vector<std::vector<int>> bbefore;
+    getblocks(numthreadstouse, bpos, btype, bindex, bleaf, bbefore);
     
-    int ln = -1; // leaf number
-    std::vector<int> iarc(8,0); // indexes in arc
-    std::vector<int> firstedge(8,0); // first edge in working element
+    std::vector<int> firstedgeintype(8,0); // first edge in each element type
     for (int i = 0; i < 7; i++)
-        firstedge[i+1] = firstedge[i] + ne[i] * cornerarc[i].size()/nn[i]/3;
-    std::vector<int> ite(8,0); // index of trans. elem.
-    while (true)
-    {
-        int t = parenttypes[currentdepth];
-
-        if (currentdepth == 0)
-            oc = myelements->getnodecoordinates(t, origindexintype);
+        firstedgeintype[i+1] = firstedgeintype[i] + ne[i] * cornerarc[i].size()/nn[i]/3;
     
-        while (not(isatleaf()))
-            next();
+    // Output of each block for every transition element type: 
+    std::vector<std::vector<std::vector<double>>> bac(8, std::vector<std::vector<double>>(numthreadstouse)), btrc = bac;
+    std::vector<std::vector<std::vector<int>>> blot(8, std::vector<std::vector<int>>(numthreadstouse)), boot = blot;
+    
+    auto processblock = [&](int b)
+    {
+        if (bleaf[b] == bleaf[b+1])
+            return;
     
-        ln++;
+        htracker cur = getcursorcopy();
+        cur.setcursor(bpos[b], btype[b], bindex[b], false);
         
-        // Get the edge numbers and edge splits for the current subelement:
-        std::vector<int> curedgenums(ne[t]);
-        std::vector<bool> curisedgesplit(ne[t]);
-        for (int i = 0; i < ne[t]; i++)
+        std::vector<double> oc;
+        
+        int ln = bleaf[b]-1; // leaf number
+        std::vector<int> iarc(8), firstedge(8); // indexes in arc and first edge in working element
+        for (int i = 0; i < 8; i++)
         {
-            curedgenums[i] = edgenumbers[firstedge[t]+i];
-            curisedgesplit[i] = isedgesplit[firstedge[t]+i];
+            iarc[i] = 3*nn[i]*bbefore[b][i];
+            firstedge[i] = firstedgeintype[i] + ne[i]*bbefore[b][i];
         }
-        
-        int splitnum = gentools::binarytoint(curisedgesplit);
-        std::vector<std::vector<int>> splitrefnums = myelems[t].split(splitnum, curedgenums);
-      
-        // Loop on all transition elements:
-        for (int si = 0; si < 8; si++)
+        while (true)
         {
-            if (splitrefnums[si].size() == 0)
-                continue;
+            int t = cur.parenttypes[cur.currentdepth];
+
+            if (cur.currentdepth == 0)
+                oc = myelements->getnodecoordinates(t, cur.origindexintype);
         
-            std::vector<double> splitrefcoords;
-            myelems[t].numstorefcoords(splitrefnums[si], splitrefcoords);
+            while (not(cur.isatleaf()))
+                cur.next();
         
-            for (int se = 0; se < splitrefcoords.size()/nn[si]/3; se++)
+            ln++;
+            
+            // Get the edge numbers and edge splits for the current subelement:
+            std::vector<int> curedgenums(ne[t]);
+            std::vector<bool> curisedgesplit(ne[t]);
+            for (int i = 0; i < ne[t]; i++)
             {
-                // Get the ref. coords. of the current transition element:
-                std::vector<double> curcoords(3*nn[si]);
-                for (int i = 0; i < 3*nn[si]; i++)
-                    curcoords[i] = splitrefcoords[se*nn[si]*3+i];
-        
-                // Bring inside the untransitioned element (if split at all):
-                curcoords = myelems[t].calculatecoordinates(curcoords, cornerarc[t], iarc[t], splitnum == 0);
-                
-                for (int i = 0; i < curcoords.size(); i++)
-                    transitionsrefcoords[si][3*nn[si]*ite[si]+i] = curcoords[i];
-                
-                // Make curved:
-                if (originalcurvatureorder > 1)
-                    curcoords = myelems[si].calculatecoordinates(curvedrefcoords[si], curcoords);
+                curedgenums[i] = edgenumbers[firstedge[t]+i];
+                curisedgesplit[i] = isedgesplit[firstedge[t]+i];
+            }
+            
+            int splitnum = gentools::binarytoint(curisedgesplit);
+            std::vector<std::vector<int>> splitrefnums = cur.myelems[t].split(splitnum, curedgenums);
+          
+            // Loop on all transition elements:
+            for (int si = 0; si < 8; si++)
+            {
+                if (splitrefnums[si].size() == 0)
+                    continue;
+            
+                std::vector<double> splitrefcoords;
+                cur.myelems[t].numstorefcoords(splitrefnums[si], splitrefcoords);
+            
+                for (int se = 0; se < splitrefcoords.size()/nn[si]/3; se++)
+                {
+                    // Get the ref. coords. of the current transition element:
+                    std::vector<double> curcoords(3*nn[si]);
+                    for (int i = 0; i < 3*nn[si]; i++)
+                        curcoords[i] = splitrefcoords[se*nn[si]*3+i];
+            
+                    // Bring inside the untransitioned element (if split at all):
+                    curcoords = cur.myelems[t].calculatecoordinates(curcoords, cornerarc[t], iarc[t], splitnum == 0);
+                    
+                    btrc[si][b].insert(btrc[si][b].end(), curcoords.begin(), curcoords.end());
                     
-                // Calculate actual coordinates: 
-                curcoords = mycurvedelems[parenttypes[0]].calculatecoordinates(curcoords, oc, 0);
+                    // Make curved:
+                    if (originalcurvatureorder > 1)
+                        curcoords = cur.myelems[si].calculatecoordinates(curvedrefcoords[si], curcoords);
+                        
+                    // Calculate actual coordinates: 
+                    curcoords = cur.mycurvedelems[cur.parenttypes[0]].calculatecoordinates(curcoords, oc, 0);
 
-                for (int i = 0; i < curcoords.size(); i++)
-                    ac[si][3*ncn[si]*ite[si]+i] = curcoords[i];
+                    bac[si][b].insert(bac[si][b].end(), curcoords.begin(), curcoords.end());
                     
-                leavesoftransitions[si][ite[si]] = ln;
-                originalsoftransitions[si][2*ite[si]+0] = parenttypes[0];
-                originalsoftransitions[si][2*ite[si]+1] = origindexintype;
-                
-                ite[si]++;
-                
+                    blot[si][b].push_back(ln);
+                    boot[si][b].push_back(cur.parenttypes[0]);
+                    boot[si][b].push_back(cur.origindexintype);
+                }
             }
-        }
+            
+            firstedge[t] += ne[t];
+            iarc[t] += 3*nn[t];
         
-        firstedge[t] += ne[t];
-        iarc[t] += 3*nn[t];
+            if (ln == bleaf[b+1]-1)
+                break;
+            
+            cur.next();
+        }
+    };
     
-        if (ln == numleaves-1)
-            break;
-        
-        next();
+    if (numthreadstouse == 1)
+        processblock(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(processblock, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
     }
     
-    // Fit to size:
+    // Merge the blocks:
+    ac = std::vector<std::vector<double>>(8, std::vector<double>(0));
+    transitionsrefcoords = std::vector<std::vector<double>>(8, std::vector<double>(0));
+    leavesoftransitions = std::vector<std::vector<int>>(8, std::vector<int>(0));
+    originalsoftransitions = std::vector<std::vector<int>>(8, std::vector<int>(0));
     for (int i = 0; i < 8; i++)
     {
-        ac[i].resize(3*ncn[i]*ite[i]);
-        transitionsrefcoords[i].resize(3*nn[i]*ite[i]);
-        leavesoftransitions[i].resize(ite[i]);
-        originalsoftransitions[i].resize(2*ite[i]);
+        gentools::concatenate(bac[i], ac[i]);
+        gentools::concatenate(btrc[i], transitionsrefcoords[i]);
+        leavesoftransitions[i] = gentools::concatenate(blot[i]);
+        originalsoftransitions[i] = gentools::concatenate(boot[i]);
         
-        touser[i] = gentools::getequallyspaced(0, 1, ite[i]);
-        toht[i] = gentools::getequallyspaced(0, 1, ite[i]);
+        int numtrans = leavesoftransitions[i].size();
+        touser[i] = gentools::getequallyspaced(0, 1, numtrans);
+        toht[i] = gentools::getequallyspaced(0, 1, numtrans);
     }
 }
 
@@ -874,145 +1041,198 @@ void htracker::fromoriginal(std::vector<int>& oad, std::vector<double>& orc, std
     {
         int curnumtran = leavesoftransitions[i].size();
         if (curnumtran > 0)
-        {
             ad[i] = std::vector<int>(curnumtran+1,0);
-            // Max bound (size is unknown for now):
-            rc[i] = std::vector<double>(orc.size());
-        }
     }    
     maporctorc = std::vector<int>(2*orc.size()/3, -1);
     
-    // Indexes of the 'orc' points that are in the current tree position:
-    std::vector<std::vector<int>> actives(maxdepth+1, std::vector<int>(0));
-    
     // Needed for the root finding:
     std::vector<polynomials> polys(8);
     for (int i = 0; i < 8; i++)
         polys[i] = polynomials(lagrangeformfunction(i,1,{}).getformfunctionpolynomials());
     
-    resetcursor(true);
+    // The subtrees of blocks of original elements are independent and are processed in parallel:
+    long long int numorig = countoriginals();
+    int numthreadstouse = std::min(numorig/1000+1, (long long int)universe::getmaxnumthreads()); // require a min num original elements per thread
     
-    int origelem = -1;
-    int ln = -1; // leaf number
-    std::vector<int> ti(8,0); // transition element index
+    std::vector<int> bpos, btype, bindex, bleaf;
+    std::vector<std::vector<int>> bbefore;
+    getblocks(numthreadstouse, bpos, btype, bindex, bleaf, bbefore);
     
-    while (true)
+    // Each thread moves its own cursor (the undefined through-edge numbers are defined in its own tree copy):
+    std::vector<htracker> cursors(numthreadstouse);
+    
+    // Reference coordinates found in each block for every transition element type. The
+    // second entry of 'maporctorc' is first the index in the block and then made global:
+    std::vector<std::vector<std::vector<double>>> brc(8, std::vector<std::vector<double>>(numthreadstouse));
+    
+    auto processblock = [&](int b)
     {
-        int t = parenttypes[currentdepth];
-        int ns = currentdepth;
+        if (bleaf[b] == bleaf[b+1])
+            return;
     
-        // Update 'actives':
-        if (ns == 0)
-        {
-            origelem++;
-            // Set all to active:
-            int numrefsinorig = (oad[origelem+1]-oad[origelem])/3;
-            actives[0] = gentools::getequallyspaced(oad[origelem]/3, 1, numrefsinorig);
-        }
-        else
+        htracker& cur = cursors[b];
+        cur = getcursorcopy();
+        cur.setcursor(bpos[b], btype[b], bindex[b], true);
+        
+        // Indexes of the 'orc' points that are in the current tree position:
+        std::vector<std::vector<int>> actives(maxdepth+1, std::vector<int>(0));
+    
+        int origelem = b*numorig/numthreadstouse-1;
+        int ln = bleaf[b]-1; // leaf number
+        // Transition element index (the transition elements are ordered like their leaves):
+        std::vector<int> ti(8,0);
+        for (int i = 0; i < 8; i++)
+            ti[i] = std::lower_bound(leavesoftransitions[i].begin(), leavesoftransitions[i].end(), bleaf[b]) - leavesoftransitions[i].begin();
+        
+        while (true)
         {
-            std::vector<double> refcoords = getreferencecoordinates();
+            int t = cur.parenttypes[cur.currentdepth];
+            int ns = cur.currentdepth;
         
-            // Actives in parent:
-            std::vector<int> par = actives[ns-1];
-            int numactivesinparent = par.size();
-            
-            std::vector<double> parcoords(3*numactivesinparent);
-            for (int i = 0; i < numactivesinparent; i++)
+            // Update 'actives':
+            if (ns == 0)
             {
-                parcoords[3*i+0] = orc[3*par[i]+0];
-                parcoords[3*i+1] = orc[3*par[i]+1];
-                parcoords[3*i+2] = orc[3*par[i]+2];
+                origelem++;
+                // Set all to active:
+                int numrefsinorig = (oad[origelem+1]-oad[origelem])/3;
+                actives[0] = gentools::getequallyspaced(oad[origelem]/3, 1, numrefsinorig);
             }
+            else
+            {
+                std::vector<double> refcoords = cur.getreferencecoordinates();
             
-            // Redirect the reference coordinates to the current element if inside it:
-            std::vector<bool> isinside;
-            myelems[t].isinsideelement(parcoords, refcoords, isinside, 1e-10);
-            
-            gentools::splitvector(par, isinside, actives[ns-1], actives[ns]);
-        }
-    
-        if (isatleaf())
-        {
-            ln++;
-            
-            // Loop on all transition elements of this leaf:
-            for (int i = 0; i < 8; i++)
+                // Actives in parent:
+                std::vector<int> par = actives[ns-1];
+                int numactivesinparent = par.size();
+                
+                std::vector<double> parcoords(3*numactivesinparent);
+                for (int i = 0; i < numactivesinparent; i++)
+                {
+                    parcoords[3*i+0] = orc[3*par[i]+0];
+                    parcoords[3*i+1] = orc[3*par[i]+1];
+                    parcoords[3*i+2] = orc[3*par[i]+2];
+                }
+                
+                // Redirect the reference coordinates to the current element if inside it:
+                std::vector<bool> isinside;
+                cur.myelems[t].isinsideelement(parcoords, refcoords, isinside, 1e-10);
+                
+                gentools::splitvector(par, isinside, actives[ns-1], actives[ns]);
+            }
+        
+            if (cur.isatleaf())
             {
-                while (ti[i] < leavesoftransitions[i].size() && leavesoftransitions[i][ti[i]] == ln)
+                ln++;
+                
+                // Loop on all transition elements of this leaf:
+                for (int i = 0; i < 8; i++)
                 {
-                    // Get the reference coordinates of the current transition element:
-                    std::vector<double> currefcoords(3*nn[i]);
-                    for (int j = 0; j < 3*nn[i]; j++)
-                        currefcoords[j] = transitionsrefcoords[i][3*nn[i]*ti[i]+j];
-                        
-                    // Actives in the current leaf:
-                    std::vector<int> activesinleaf = actives[ns];
-                    int numactivesinleaf = activesinleaf.size();
-                    
-                    std::vector<double> activecoords(3*numactivesinleaf);
-                    for (int j = 0; j < numactivesinleaf; j++)
+                    while (ti[i] < leavesoftransitions[i].size() && leavesoftransitions[i][ti[i]] == ln)
                     {
-                        activecoords[3*j+0] = orc[3*activesinleaf[j]+0];
-                        activecoords[3*j+1] = orc[3*activesinleaf[j]+1];
-                        activecoords[3*j+2] = orc[3*activesinleaf[j]+2];
-                    }
-                    
-                    std::vector<bool> isintrans;
-                    myelems[i].isinsideelement(activecoords, currefcoords, isintrans, 1e-10);
-                    // Actives in the current transition element:
-                    std::vector<int> activesintrans;
-                    gentools::splitvector(activesinleaf, isintrans, actives[ns], activesintrans);
-            
-                    // Populate 'ad':
-                    ad[i][ti[i]+1] = ad[i][ti[i]]+3*activesintrans.size();
-            
-                    if (activesintrans.size() > 0)
-                    {
-                        // Find the corresponding reference coordinate in the transition element's own reference.
-                        // First create the polynomials for the system to solve.
-                        std::vector<double> xyz = gentools::separate(currefcoords, 3, gentools::getequallyspaced(0,1,elemdim));
-                        polynomials syspolys = polys[i].sum(xyz);
-                
-                        // Loop on all actives:
-                        for (int j = 0; j < activesintrans.size(); j++)
-                        {                        
-                            std::vector<double> kietaphi = {0.0,0.0,0.0};
-                            std::vector<double> rhs = {orc[3*activesintrans[j]+0], orc[3*activesintrans[j]+1], orc[3*activesintrans[j]+2]};
+                        // Get the reference coordinates of the current transition element:
+                        std::vector<double> currefcoords(3*nn[i]);
+                        for (int j = 0; j < 3*nn[i]; j++)
+                            currefcoords[j] = transitionsrefcoords[i][3*nn[i]*ti[i]+j];
                             
-                            if (gentools::getroot(syspolys, rhs, kietaphi) == 1 && myelems[i].isinsideelement(kietaphi[0], kietaphi[1], kietaphi[2]))
-                            {
-                                rc[i][ad[i][ti[i]]+3*j+0] = kietaphi[0];
-                                rc[i][ad[i][ti[i]]+3*j+1] = kietaphi[1];
-                                rc[i][ad[i][ti[i]]+3*j+2] = kietaphi[2];
+                        // Actives in the current leaf:
+                        std::vector<int> activesinleaf = actives[ns];
+                        int numactivesinleaf = activesinleaf.size();
+                        
+                        std::vector<double> activecoords(3*numactivesinleaf);
+                        for (int j = 0; j < numactivesinleaf; j++)
+                        {
+                            activecoords[3*j+0] = orc[3*activesinleaf[j]+0];
+                            activecoords[3*j+1] = orc[3*activesinleaf[j]+1];
+                            activecoords[3*j+2] = orc[3*activesinleaf[j]+2];
+                        }
+                        
+                        std::vector<bool> isintrans;
+                        cur.myelems[i].isinsideelement(activecoords, currefcoords, isintrans, 1e-10);
+                        // Actives in the current transition element:
+                        std::vector<int> activesintrans;
+                        gentools::splitvector(activesinleaf, isintrans, actives[ns], activesintrans);
+                
+                        // Number of coordinates in the transition element ('ad' is made cumulative afterwards):
+                        ad[i][ti[i]+1] = 3*activesintrans.size();
+                
+                        if (activesintrans.size() > 0)
+                        {
+                            // Find the corresponding reference coordinate in the transition element's own reference.
+                            // First create the polynomials for the system to solve.
+                            std::vector<double> xyz = gentools::separate(currefcoords, 3, gentools::getequallyspaced(0,1,elemdim));
+                            polynomials syspolys = polys[i].sum(xyz);
+                    
+                            // Loop on all actives:
+                            for (int j = 0; j < activesintrans.size(); j++)
+                            {                        
+                                std::vector<double> kietaphi = {0.0,0.0,0.0};
+                                std::vector<double> rhs = {orc[3*activesintrans[j]+0], orc[3*activesintrans[j]+1], orc[3*activesintrans[j]+2]};
                                 
-                                maporctorc[2*activesintrans[j]+0] = i;
-                                maporctorc[2*activesintrans[j]+1] = ad[i][ti[i]]/3+j;
-                            }
-                            else
-                            {
-                                std::cout << "Error in 'htracker' object: root finding algorithm for mesh adaptivity failed to converge for a " << myelems[i].gettypename() << " element" << std::endl;
-                                abort();
+                                if (gentools::getroot(syspolys, rhs, kietaphi) == 1 && cur.myelems[i].isinsideelement(kietaphi[0], kietaphi[1], kietaphi[2]))
+                                {
+                                    maporctorc[2*activesintrans[j]+0] = i;
+                                    maporctorc[2*activesintrans[j]+1] = brc[i][b].size()/3;
+                                    
+                                    brc[i][b].insert(brc[i][b].end(), kietaphi.begin(), kietaphi.end());
+                                }
+                                else
+                                {
+                                    std::cout << "Error in 'htracker' object: root finding algorithm for mesh adaptivity failed to converge for a " << cur.myelems[i].gettypename() << " element" << std::endl;
+                                    abort();
+                                }
                             }
                         }
+                        
+                        ti[i]++;
                     }
-                    
-                    ti[i]++;
                 }
             }
-        }
-        
-        if (ln == numleaves-1)
-            break;
             
-        next();
+            if (ln == bleaf[b+1]-1)
+                break;
+                
+            cur.next();
+        }
+    };
+    
+    if (numthreadstouse == 1)
+        processblock(0);
+    else
+    {
+        std::vector<std::thread> threadobjs(numthreadstouse);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t] = universe::newthread(processblock, t);
+        for (int t = 0; t < numthreadstouse; t++)
+            threadobjs[t].join();
+    }
+    
+    // Bring back the through-edge numbers defined in every block:
+    for (int b = 0; b < numthreadstouse; b++)
+    {
+        if (bleaf[b] == bleaf[b+1])
+            continue;
+        for (int i = bpos[b]; i < bpos[b+1]; i++)
+            splitdata[i] = cursors[b].splitdata[i];
     }
     
-    // Fit to actual size:
+    // Merge the blocks:
+    std::vector<std::vector<int>> blockoffsets(8, std::vector<int>(numthreadstouse+1, 0));
     for (int i = 0; i < 8; i++)
     {
-        if (ad[i].size() > 0)
-            rc[i].resize(ad[i][ad[i].size()-1]);
+        for (int j = 1; j < ad[i].size(); j++)
+            ad[i][j] += ad[i][j-1];
+        for (int b = 0; b < numthreadstouse; b++)
+            blockoffsets[i][b+1] = blockoffsets[i][b] + brc[i][b].size()/3;
+        gentools::concatenate(brc[i], rc[i]);
+    }
+    for (int b = 0; b < numthreadstouse; b++)
+    {
+        int firstorig = b*numorig/numthreadstouse, lastorig = (b+1)*numorig/numthreadstouse;
+        for (int p = oad[firstorig]/3; p < oad[lastorig]/3; p++)
+        {
+            if (maporctorc[2*p+0] >= 0)
+                maporctorc[2*p+1] += blockoffsets[maporctorc[2*p+0]][b];
+        }
     }
     
     // Sanity check:
@@ -1215,3 +1435,13 @@ int htracker::countbits(void)
     return splitdata.size();
 }
 
+
+memoryusage htracker::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    output.add("split tree", memoryusage::countbytes(splitdata));
+    output.add("transition elements", memoryusage::countbytes(transitionsrefcoords) + memoryusage::countbytes(leavesoftransitions) + memoryusage::countbytes(originalsoftransitions) + memoryusage::countbytes(touser) + memoryusage::countbytes(toht));
+    
+    return output;
+}
@@ -15,6 +15,7 @@
 #include <memory>
 #include "element.h"
 #include "rawmesh.h"
+#include "memoryusage.h"
 
 class rawmesh;
 
@@ -80,6 +81,19 @@ class htracker
         // Transition elements renumbering:
         std::vector<std::vector<int>> touser = {};
         std::vector<std::vector<int>> toht = {};
+        
+        // Place the cursor at the first node of an original element (its data starts at bit 'position'):
+        void setcursor(int position, int origtype, int origindex, bool calcrefcoords);
+        
+        int countoriginals(void);
+        
+        // Split the original elements (in the tree order) into blocks of consecutive elements whose subtrees can be processed
+        // independently. For every block this gives the bit position, type and index of its first original element, its first leaf
+        // number and the number of leaves of each type before it. The last entry (at index 'numblocks') is for the end of the tree.
+        void getblocks(int numblocks, std::vector<int>& positions, std::vector<int>& origtypes, std::vector<int>& origindexes, std::vector<int>& firstleaves, std::vector<std::vector<int>>& leavesbefore);
+        
+        // Get a copy with all that is needed to move a cursor in the tree (the transition element data is not copied):
+        htracker getcursorcopy(void);
 
     public:
 
@@ -92,6 +106,10 @@ class htracker
         int countleaves(void);
         int getmaxdepth(void);
         
+        // Get and set the refinement tree (to save and restore an adaptation state):
+        std::vector<bool> gettree(void) { return splitdata; };
+        void settree(std::vector<bool> tree, int depth, int leaves);
+        
         // Place cursor at beginning of tree. Request reference coordinate calculations or not.
         void resetcursor(bool calcrefcoords = false);
         // Move cursor to next node (crashes when exceeding number of leaves). Position might not be at a leaf.
@@ -184,6 +202,9 @@ class htracker
         
         // Length of 'splitdata':
         int countbits(void);
+        
+        // Bytes used by the tree and the transition element containers:
+        memoryusage getmemoryusage(void);
 };
 
 #endif
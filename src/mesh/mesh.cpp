@@ -22,51 +22,51 @@ void mesh::errorifnotloaded(void)
 mesh::mesh(void)
 {
     rawmeshptr = std::shared_ptr<rawmesh>(new rawmesh());
-    universe::myrawmesh = rawmeshptr;
+    universe::getsession()->myrawmesh = rawmeshptr;
 }
 
 mesh::mesh(std::string filename, int verbosity)
 {
     rawmeshptr = std::shared_ptr<rawmesh>(new rawmesh());
-    universe::myrawmesh = rawmeshptr;
+    universe::getsession()->myrawmesh = rawmeshptr;
     rawmeshptr->load(filename, -1, -1, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
 mesh::mesh(std::string filename, int globalgeometryskin, int numoverlaplayers, int verbosity)
 {
     rawmeshptr = std::shared_ptr<rawmesh>(new rawmesh());
-    universe::myrawmesh = rawmeshptr;
+    universe::getsession()->myrawmesh = rawmeshptr;
     rawmeshptr->load(filename, globalgeometryskin, numoverlaplayers, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
 mesh::mesh(bool mergeduplicates, std::vector<std::string> meshfiles, int verbosity)
 {
     rawmeshptr = std::shared_ptr<rawmesh>(new rawmesh());
-    universe::myrawmesh = rawmeshptr;
+    universe::getsession()->myrawmesh = rawmeshptr;
     rawmeshptr->load(mergeduplicates, meshfiles, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
 mesh::mesh(std::vector<shape> inputshapes, int verbosity)
 {
     rawmeshptr = std::shared_ptr<rawmesh>(new rawmesh());
-    universe::myrawmesh = rawmeshptr;
+    universe::getsession()->myrawmesh = rawmeshptr;
     rawmeshptr->load(inputshapes, -1, -1, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
 mesh::mesh(std::vector<shape> inputshapes, int globalgeometryskin, int numoverlaplayers, int verbosity)
 {
     rawmeshptr = std::shared_ptr<rawmesh>(new rawmesh());
-    universe::myrawmesh = rawmeshptr;
+    universe::getsession()->myrawmesh = rawmeshptr;
     rawmeshptr->load(inputshapes, globalgeometryskin, numoverlaplayers, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
@@ -79,7 +79,20 @@ void mesh::load(std::string name, int globalgeometryskin, int numoverlaplayers,
 {
     errorifloaded();
     rawmeshptr->load(name, globalgeometryskin, numoverlaplayers, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
+    isloaded = true;
+}
+
+void mesh::allload(std::string name, int globalgeometryskin, int numoverlaplayers, int verbosity)
+{
+    allload(name, globalgeometryskin, numoverlaplayers, {}, {}, verbosity);
+}
+
+void mesh::allload(std::string name, int globalgeometryskin, int numoverlaplayers, std::vector<int> weightedregions, std::vector<double> regionweights, int verbosity)
+{
+    errorifloaded();
+    rawmeshptr->allload(name, globalgeometryskin, numoverlaplayers, weightedregions, regionweights, verbosity);
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
@@ -87,7 +100,7 @@ void mesh::load(bool mergeduplicates, std::vector<std::string> meshfiles, int ve
 {
     errorifloaded();
     rawmeshptr->load(mergeduplicates, meshfiles, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
@@ -100,7 +113,7 @@ void mesh::load(std::vector<shape> inputshapes, int globalgeometryskin, int numo
 {
     errorifloaded();
     rawmeshptr->load(inputshapes, globalgeometryskin, numoverlaplayers, verbosity);
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
     isloaded = true;
 }
 
@@ -110,6 +123,23 @@ void mesh::write(std::string name, int verbosity)
     rawmeshptr->gethadaptedpointer()->write(name, verbosity);
 }
 
+void mesh::allwrite(std::string name, int verbosity)
+{
+    errorifnotloaded();
+    
+    if (slmpi::count() > 1)
+    {
+        std::string rankstr = "_" + std::to_string(slmpi::getrank());
+        size_t dotpos = name.find_last_of('.');
+        if (dotpos == std::string::npos)
+            name = name + rankstr;
+        else
+            name = name.substr(0, dotpos) + rankstr + name.substr(dotpos);
+    }
+    
+    rawmeshptr->gethadaptedpointer()->write(name, verbosity*(slmpi::getrank() == 0));
+}
+
 void mesh::setadaptivity(expression criterion, int lownumsplits, int highnumsplits)
 {
     errorifnotloaded();
@@ -341,6 +371,17 @@ void mesh::selectanynode(int newphysreg)
 void mesh::use(void)
 {
     errorifnotloaded();
-    universe::myrawmesh = rawmeshptr->gethadaptedpointer();
+    universe::getsession()->myrawmesh = rawmeshptr->gethadaptedpointer();
+}
+
+memoryusage mesh::getmemoryusage(void)
+{
+    errorifnotloaded();
+    return rawmeshptr->getmemoryusage();
+}
+
+void mesh::printmemory(void)
+{
+    getmemoryusage().print("Mesh memory");
 }
 
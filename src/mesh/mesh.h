@@ -23,6 +23,7 @@
 #include "rawmesh.h"
 #include "field.h"
 #include "expression.h"
+#include "memoryusage.h"
 
 class field;
 class expression;
@@ -52,14 +53,24 @@ class mesh
         // Load from file name:
         void load(std::string name, int verbosity = 1);   
         void load(std::string name, int globalgeometryskin, int numoverlaplayers, int verbosity = 1);   
+        // Read the mesh on rank 0 only, partition it and send each rank its part (no pre-partitioned mesh files needed):
+        void allload(std::string name, int globalgeometryskin, int numoverlaplayers, int verbosity = 1);
+        // Same as above with the cells in the weighted physical regions counting with their weight when balancing the parts
+        // (e.g. when the cost per cell measured with 'formulation::allmeasureload' differs between regions).
+        // The mesh is partitioned from scratch: an adapted mesh, field orders and field values are not carried over:
+        void allload(std::string name, int globalgeometryskin, int numoverlaplayers, std::vector<int> weightedregions, std::vector<double> regionweights, int verbosity = 1);
         // Load from multiple files:
         void load(bool mergeduplicates, std::vector<std::string> meshfiles, int verbosity = 1);
         // Load from shape vector:
         void load(std::vector<shape> inputshapes, int verbosity = 1);
         void load(std::vector<shape> inputshapes, int globalgeometryskin, int numoverlaplayers, int verbosity = 1);
 
-        // Write to file name:
+        // Write to file name. The native .slm format stores the fully processed mesh so that
+        // loading it back requires no processing (splits and region definitions included):
         void write(std::string name, int verbosity = 1);     
+        // Every rank writes its part of a DDM mesh to file name with '_<rank>' before the extension (the file name is
+        // unchanged on a single rank). Use the binary .msh output (see 'universe::setmshoutput') or .slm for large meshes:
+        void allwrite(std::string name, int verbosity = 1);
         
         // H-adaptivity:
         void setadaptivity(expression criterion, int lownumsplits, int highnumsplits);
@@ -103,6 +114,10 @@ class mesh
         // Set this mesh as the one to use:
         void use(void);
         
+        // Get/print the number of bytes used by the mesh containers:
+        memoryusage getmemoryusage(void);
+        void printmemory(void);
+        
         std::shared_ptr<rawmesh> getpointer(void) { return rawmeshptr; };
         
 };
@@ -0,0 +1,174 @@
+#include "meshcache.h"
+#include "universe.h"
+#include "rawmesh.h"
+
+
+bool meshcache::isitenabled = true;
+std::mutex meshcache::mymutex;
+long long int meshcache::numhits = 0;
+long long int meshcache::nummisses = 0;
+int meshcache::maxnumentries = 64;
+
+// The element selector containers of a set of disjoint regions:
+class meshcachegrouping
+{
+    public:
+
+        rawmesh* meshptr = NULL;
+        int meshnumber = -1;
+        bool isorientationdependent = true;
+        std::vector<int> disjregs = {};
+
+        std::vector<int> elems = {};
+        std::vector<int> totalorientations = {};
+        std::vector<int> disjointregions = {};
+        std::vector<int> originalindexes = {};
+};
+
+// The sizes of a set of elements:
+class meshcachesizes
+{
+    public:
+
+        rawmesh* meshptr = NULL;
+        int meshnumber = -1;
+        long long int meshstate = -1;
+        bool isaxisymmetric = false;
+        int elementtypenumber = -1;
+        int integrationorder = -1;
+        std::vector<int> elementnumbers = {};
+
+        std::vector<double> sizes = {};
+};
+
+std::vector<meshcachegrouping> meshcachegroupings = {};
+std::vector<meshcachesizes> meshcachesizevectors = {};
+
+void meshcache::enable(bool isenabled)
+{
+    isitenabled = isenabled;
+    if (isenabled == false)
+        clear();
+}
+
+void meshcache::clear(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    meshcachegroupings = {};
+    meshcachesizevectors = {};
+}
+
+bool meshcache::getgrouping(std::vector<int>& disjregs, bool isorientationdependent, std::vector<int>& elems, std::vector<int>& totalorientations, std::vector<int>& disjointregions, std::vector<int>& originalindexes)
+{
+    if (isitenabled == false)
+        return false;
+
+    rawmesh* rm = universe::getrawmesh().get();
+    int meshnumber = rm->getmeshnumber();
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    for (int i = 0; i < meshcachegroupings.size(); i++)
+    {
+        meshcachegrouping& cur = meshcachegroupings[i];
+
+        if (cur.meshptr == rm && cur.meshnumber == meshnumber && cur.isorientationdependent == isorientationdependent && cur.disjregs == disjregs)
+        {
+            numhits++;
+            elems = cur.elems;
+            totalorientations = cur.totalorientations;
+            disjointregions = cur.disjointregions;
+            originalindexes = cur.originalindexes;
+            return true;
+        }
+    }
+    nummisses++;
+
+    return false;
+}
+
+void meshcache::setgrouping(std::vector<int>& disjregs, bool isorientationdependent, std::vector<int>& elems, std::vector<int>& totalorientations, std::vector<int>& disjointregions, std::vector<int>& originalindexes)
+{
+    if (isitenabled == false || maxnumentries <= 0)
+        return;
+
+    meshcachegrouping entry;
+    entry.meshptr = universe::getrawmesh().get();
+    entry.meshnumber = entry.meshptr->getmeshnumber();
+    entry.isorientationdependent = isorientationdependent;
+    entry.disjregs = disjregs;
+    entry.elems = elems;
+    entry.totalorientations = totalorientations;
+    entry.disjointregions = disjointregions;
+    entry.originalindexes = originalindexes;
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    // Remove the entries from other mesh numbers:
+    for (int i = meshcachegroupings.size()-1; i >= 0; i--)
+    {
+        if (meshcachegroupings[i].meshptr == entry.meshptr && meshcachegroupings[i].meshnumber != entry.meshnumber)
+            meshcachegroupings.erase(meshcachegroupings.begin()+i);
+    }
+    if (meshcachegroupings.size() >= maxnumentries)
+        meshcachegroupings.erase(meshcachegroupings.begin());
+
+    meshcachegroupings.push_back(entry);
+}
+
+bool meshcache::getsizes(int elementtypenumber, int integrationorder, std::vector<int>& elementnumbers, std::vector<double>& sizes)
+{
+    if (isitenabled == false)
+        return false;
+
+    rawmesh* rm = universe::getrawmesh().get();
+    int meshnumber = rm->getmeshnumber();
+    long long int meshstate = rm->getstate();
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    for (int i = 0; i < meshcachesizevectors.size(); i++)
+    {
+        meshcachesizes& cur = meshcachesizevectors[i];
+
+        if (cur.meshptr == rm && cur.meshnumber == meshnumber && cur.meshstate == meshstate && cur.isaxisymmetric == universe::getsession()->isaxisymmetric && cur.elementtypenumber == elementtypenumber && cur.integrationorder == integrationorder && cur.elementnumbers == elementnumbers)
+        {
+            numhits++;
+            sizes = cur.sizes;
+            return true;
+        }
+    }
+    nummisses++;
+
+    return false;
+}
+
+void meshcache::setsizes(int elementtypenumber, int integrationorder, std::vector<int>& elementnumbers, std::vector<double>& sizes)
+{
+    if (isitenabled == false || maxnumentries <= 0)
+        return;
+
+    meshcachesizes entry;
+    entry.meshptr = universe::getrawmesh().get();
+    entry.meshnumber = entry.meshptr->getmeshnumber();
+    entry.meshstate = entry.meshptr->getstate();
+    entry.isaxisymmetric = universe::getsession()->isaxisymmetric;
+    entry.elementtypenumber = elementtypenumber;
+    entry.integrationorder = integrationorder;
+    entry.elementnumbers = elementnumbers;
+    entry.sizes = sizes;
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    // Remove the entries from other mesh numbers or states:
+    for (int i = meshcachesizevectors.size()-1; i >= 0; i--)
+    {
+        if (meshcachesizevectors[i].meshptr == entry.meshptr && (meshcachesizevectors[i].meshnumber != entry.meshnumber || meshcachesizevectors[i].meshstate != entry.meshstate))
+            meshcachesizevectors.erase(meshcachesizevectors.begin()+i);
+    }
+    if (meshcachesizevectors.size() >= maxnumentries)
+        meshcachesizevectors.erase(meshcachesizevectors.begin());
+
+    meshcachesizevectors.push_back(entry);
+}
@@ -0,0 +1,61 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object keeps geometric data that only depends on the mesh so that repeated
+// generates, integrations and interpolations on an unchanged mesh do not recompute it:
+//
+// - the orientation grouping of the element selectors built on whole disjoint regions
+// - the element sizes of the 'meshsize' operation (without mesh deformation)
+//
+// The groupings are removed when the mesh number changes (h-adaptivity) while the sizes
+// are also removed when the mesh state changes (mesh move). The cache is cleared when a
+// new mesh is loaded since the mesh numbers restart from zero.
+
+#ifndef MESHCACHE_H
+#define MESHCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <mutex>
+
+class meshcache
+{
+    private:
+
+        static bool isitenabled;
+
+        static std::mutex mymutex;
+
+        static long long int numhits;
+        static long long int nummisses;
+
+    public:
+
+        // Maximum number of groupings and of size vectors kept (the oldest ones are removed first):
+        static int maxnumentries;
+
+        // The cache is enabled by default. Disabling it also clears it:
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+
+        static void clear(void);
+
+        // Get the sorted element selector containers of the (sorted) disjoint regions on the current mesh.
+        // Returns false if they are not available. This can be called by multiple threads at the same time.
+        static bool getgrouping(std::vector<int>& disjregs, bool isorientationdependent, std::vector<int>& elems, std::vector<int>& totalorientations, std::vector<int>& disjointregions, std::vector<int>& originalindexes);
+        static void setgrouping(std::vector<int>& disjregs, bool isorientationdependent, std::vector<int>& elems, std::vector<int>& totalorientations, std::vector<int>& disjointregions, std::vector<int>& originalindexes);
+
+        // Get the size of every element in 'elementnumbers' computed with the given integration order.
+        // Returns false if it is not available. This can be called by multiple threads at the same time.
+        static bool getsizes(int elementtypenumber, int integrationorder, std::vector<int>& elementnumbers, std::vector<double>& sizes);
+        static void setsizes(int elementtypenumber, int integrationorder, std::vector<int>& elementnumbers, std::vector<double>& sizes);
+
+        static long long int counthits(void) { return numhits; };
+        static long long int countmisses(void) { return nummisses; };
+
+};
+
+#endif
@@ -0,0 +1,712 @@
+#include "meshpartitioner.h"
+
+#ifdef HAVE_METIS
+#include "metis.h"
+#endif
+
+
+int meshpartitioner::getkeywidth(int dim)
+{
+    switch (dim)
+    {
+        case 0:
+            return 1;
+        case 1:
+            return 2;
+        case 2:
+            return 4;
+    }
+
+    abort(); // fix return warning
+}
+
+void meshpartitioner::getcorners(int elementtypenumber, int elementnumber, std::vector<int>& corners)
+{
+    element myelement(elementtypenumber);
+    int numcorners = myelement.countnodes();
+
+    corners.resize(numcorners);
+    for (int i = 0; i < numcorners; i++)
+        corners[i] = myelements->getsubelement(0, elementtypenumber, elementnumber, i);
+}
+
+std::vector<int> meshpartitioner::getentitycorners(int dim, int entry)
+{
+    int cell = myentitycells[dim][entry];
+    int sub = myentitysubs[dim][entry];
+
+    int celltype = mycelltypes[cell];
+    element myelement(celltype);
+
+    std::vector<int> cellcorners;
+    getcorners(celltype, mycellnumbers[cell], cellcorners);
+
+    if (dim == 0)
+        return {cellcorners[sub]};
+    if (dim == 1)
+    {
+        std::vector<int> edgedefs = myelement.getedgesdefinitionsbasedonnodes();
+        return {cellcorners[edgedefs[2*sub+0]], cellcorners[edgedefs[2*sub+1]]};
+    }
+
+    // Faces are listed triangles first:
+    std::vector<int> facedefs = myelement.getfacesdefinitionsbasedonnodes();
+    int numtriangles = myelement.counttriangularfaces();
+    int first = (sub < numtriangles) ? 3*sub : 3*numtriangles+4*(sub-numtriangles);
+    int numfacecorners = (sub < numtriangles) ? 3 : 4;
+
+    std::vector<int> output(numfacecorners);
+    for (int i = 0; i < numfacecorners; i++)
+        output[i] = cellcorners[facedefs[first+i]];
+
+    return output;
+}
+
+std::vector<int> meshpartitioner::getentitynodes(int dim, int entry, int& entitytype)
+{
+    int cell = myentitycells[dim][entry];
+    int sub = myentitysubs[dim][entry];
+
+    int celltype = mycelltypes[cell];
+    element myelement(celltype, mycurvatureorder);
+
+    int numcurvednodes = myelement.countcurvednodes();
+    std::vector<int> curvednodes(numcurvednodes);
+    for (int i = 0; i < numcurvednodes; i++)
+        curvednodes[i] = myelements->getsubelement(0, celltype, mycellnumbers[cell], i);
+    myelement.setnodes(curvednodes);
+
+    if (dim == 0)
+    {
+        entitytype = 0;
+        return {curvednodes[sub]};
+    }
+    if (dim == 1)
+    {
+        entitytype = 1;
+        return myelement.getnodesinline(sub);
+    }
+
+    int numtriangles = myelement.counttriangularfaces();
+    if (sub < numtriangles)
+    {
+        entitytype = 2;
+        return myelement.getnodesintriangle(sub);
+    }
+    entitytype = 3;
+    return myelement.getnodesinquadrangle(sub-numtriangles);
+}
+
+void meshpartitioner::bisect(std::vector<int>& cells, std::vector<double>& barycenters, std::vector<double>& weights, int firstcell, int lastcell, int firstpart, int numparts)
+{
+    if (numparts == 1 || lastcell-firstcell <= 1)
+    {
+        for (int i = firstcell; i < lastcell; i++)
+            mycellparts[cells[i]] = firstpart;
+        return;
+    }
+
+    // Split along the direction of largest extent:
+    std::vector<double> mins = {barycenters[3*cells[firstcell]+0], barycenters[3*cells[firstcell]+1], barycenters[3*cells[firstcell]+2]};
+    std::vector<double> maxs = mins;
+    double totalweight = 0.0;
+    for (int i = firstcell; i < lastcell; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            mins[c] = std::min(mins[c], barycenters[3*cells[i]+c]);
+            maxs[c] = std::max(maxs[c], barycenters[3*cells[i]+c]);
+        }
+        totalweight += weights[cells[i]];
+    }
+    int dir = 0;
+    for (int c = 1; c < 3; c++)
+    {
+        if (maxs[c]-mins[c] > maxs[dir]-mins[dir])
+            dir = c;
+    }
+
+    std::sort(cells.begin()+firstcell, cells.begin()+lastcell, [&](int a, int b)
+    {
+        return (barycenters[3*a+dir] < barycenters[3*b+dir]);
+    });
+
+    // Weight proportional to the number of parts on each side:
+    int numleftparts = numparts/2;
+    double leftweight = totalweight*numleftparts/numparts;
+
+    int middle = firstcell;
+    double cumulatedweight = 0.0;
+    while (middle < lastcell-1 && cumulatedweight+weights[cells[middle]]/2 < leftweight)
+    {
+        cumulatedweight += weights[cells[middle]];
+        middle++;
+    }
+    middle = std::max(middle, firstcell+1);
+
+    bisect(cells, barycenters, weights, firstcell, middle, firstpart, numleftparts);
+    bisect(cells, barycenters, weights, middle, lastcell, firstpart+numleftparts, numparts-numleftparts);
+}
+
+void meshpartitioner::definetables(void)
+{
+    int numcells = mycelltypes.size();
+
+    for (int d = 0; d < mymeshdim; d++)
+    {
+        int w = getkeywidth(d);
+
+        mykeys[d] = {}; myentityparts[d] = {}; myentitycells[d] = {}; myentitysubs[d] = {};
+
+        for (int c = 0; c < numcells; c++)
+        {
+            element myelement(mycelltypes[c]);
+            int numsubs = myelement.countdim(d);
+
+            myentitycells[d].insert(myentitycells[d].end(), numsubs, c);
+            myentityparts[d].insert(myentityparts[d].end(), numsubs, mycellparts[c]);
+            for (int s = 0; s < numsubs; s++)
+                myentitysubs[d].push_back(s);
+        }
+
+        int numentries = myentitycells[d].size();
+        mykeys[d] = std::vector<int>(w*numentries, -1);
+        for (int i = 0; i < numentries; i++)
+        {
+            std::vector<int> corners = getentitycorners(d, i);
+            std::sort(corners.begin(), corners.end());
+            for (int j = 0; j < corners.size(); j++)
+                mykeys[d][w*i+j] = corners[j];
+        }
+
+        int* keys = mykeys[d].data();
+        int* parts = myentityparts[d].data();
+
+        myentityorder[d] = std::vector<int>(numentries);
+        for (int i = 0; i < numentries; i++)
+            myentityorder[d][i] = i;
+        std::sort(myentityorder[d].begin(), myentityorder[d].end(), [&](int a, int b)
+        {
+            for (int j = 0; j < w; j++)
+            {
+                if (keys[w*a+j] != keys[w*b+j])
+                    return (keys[w*a+j] < keys[w*b+j]);
+            }
+            return (parts[a] < parts[b]);
+        });
+    }
+}
+
+std::vector<int> meshpartitioner::findparts(int dim, std::vector<int>& key)
+{
+    int w = getkeywidth(dim);
+    int* keys = mykeys[dim].data();
+
+    std::vector<int> paddedkey(w, -1);
+    for (int j = 0; j < key.size(); j++)
+        paddedkey[j] = key[j];
+
+    // Compare entry a with the key:
+    auto compare = [&](int a, const std::vector<int>& k)
+    {
+        for (int j = 0; j < w; j++)
+        {
+            if (keys[w*a+j] != k[j])
+                return (keys[w*a+j] < k[j]);
+        }
+        return false;
+    };
+
+    std::vector<int>::iterator it = std::lower_bound(myentityorder[dim].begin(), myentityorder[dim].end(), paddedkey, compare);
+
+    std::vector<int> output = {};
+    for (; it != myentityorder[dim].end(); ++it)
+    {
+        bool issame = true;
+        for (int j = 0; j < w; j++)
+            issame = issame && (keys[w*(*it)+j] == paddedkey[j]);
+        if (not(issame))
+            break;
+
+        int part = myentityparts[dim][*it];
+        if (output.size() == 0 || output.back() != part)
+            output.push_back(part);
+    }
+
+    return output;
+}
+
+meshpartitioner::meshpartitioner(nodes* nds, elements* els, physicalregions* prs)
+{
+    mynodes = nds;
+    myelements = els;
+    myphysicalregions = prs;
+
+    mycurvatureorder = myelements->getcurvatureorder();
+
+    for (int i = 1; i < 8; i++)
+    {
+        element myelement(i);
+        if (myelements->count(i) > 0)
+            mymeshdim = std::max(mymeshdim, myelement.getelementdimension());
+    }
+    if (mymeshdim < 1)
+    {
+        std::cout << "Error in 'meshpartitioner' object: the mesh to partition has no line, surface or volume element" << std::endl;
+        abort();
+    }
+
+    for (int i = 1; i < 8; i++)
+    {
+        element myelement(i);
+        if (myelement.getelementdimension() != mymeshdim)
+            continue;
+
+        int numelems = myelements->count(i);
+        mycelltypes.insert(mycelltypes.end(), numelems, i);
+        for (int e = 0; e < numelems; e++)
+            mycellnumbers.push_back(e);
+    }
+}
+
+void meshpartitioner::partition(int numparts, std::vector<int> weightedregions, std::vector<double> regionweights)
+{
+    mynumparts = numparts;
+
+    int numcells = mycelltypes.size();
+    mycellparts = std::vector<int>(numcells, 0);
+
+    if (weightedregions.size() != regionweights.size())
+    {
+        std::cout << "Error in 'meshpartitioner' object: expected one weight per weighted physical region" << std::endl;
+        abort();
+    }
+
+    ///// Cell weights:
+    // Index of the first cell of each type:
+    std::vector<int> firstcell(8, -1);
+    for (int c = numcells-1; c >= 0; c--)
+        firstcell[mycelltypes[c]] = c;
+
+    std::vector<double> weights(numcells, 1.0);
+    std::vector<bool> isweighted(numcells, false);
+    for (int p = 0; p < weightedregions.size(); p++)
+    {
+        if (regionweights[p] <= 0)
+        {
+            std::cout << "Error in 'meshpartitioner' object: the physical region weights must be positive" << std::endl;
+            abort();
+        }
+        myphysicalregions->errorundefined({weightedregions[p]});
+        std::vector<std::vector<int>>* curelemlist = myphysicalregions->get(weightedregions[p])->getelementlist();
+
+        for (int i = 0; i < 8; i++)
+        {
+            if (firstcell[i] == -1)
+                continue;
+            for (int e = 0; e < curelemlist->at(i).size(); e++)
+            {
+                int c = firstcell[i] + curelemlist->at(i)[e];
+                weights[c] = isweighted[c] ? std::max(weights[c], regionweights[p]) : regionweights[p];
+                isweighted[c] = true;
+            }
+        }
+    }
+
+    if (numparts > 1)
+    {
+        #ifdef HAVE_METIS
+        // Cells are connected in the dual graph when they share a face (volumes), an edge (surfaces) or a node (lines):
+        std::vector<idx_t> eptr(numcells+1, 0), eind = {};
+        std::vector<int> corners;
+        for (int c = 0; c < numcells; c++)
+        {
+            getcorners(mycelltypes[c], mycellnumbers[c], corners);
+            eind.insert(eind.end(), corners.begin(), corners.end());
+            eptr[c+1] = eind.size();
+        }
+
+        // METIS requires integer weights:
+        double maxweight = *std::max_element(weights.begin(), weights.end());
+        std::vector<idx_t> vwgt(numcells);
+        for (int c = 0; c < numcells; c++)
+            vwgt[c] = std::max(1, (int)std::round(100.0*weights[c]/maxweight));
+
+        idx_t ne = numcells, nn = mynodes->count(), ncommon = mymeshdim, nparts = numparts, objval;
+        std::vector<idx_t> epart(numcells), npart(nn);
+
+        int status = METIS_PartMeshDual(&ne, &nn, eptr.data(), eind.data(), vwgt.data(), NULL, &ncommon, &nparts, NULL, NULL, &objval, epart.data(), npart.data());
+        if (status != METIS_OK)
+        {
+            std::cout << "Error in 'meshpartitioner' object: METIS failed to partition the mesh" << std::endl;
+            abort();
+        }
+        for (int c = 0; c < numcells; c++)
+            mycellparts[c] = epart[c];
+        #else
+        // Recursive coordinate bisection of the cell barycenters:
+        const std::vector<double>* nodecoords = mynodes->readcoordinates();
+        std::vector<double> barycenters(3*numcells, 0.0);
+        std::vector<int> corners;
+        for (int c = 0; c < numcells; c++)
+        {
+            getcorners(mycelltypes[c], mycellnumbers[c], corners);
+            for (int i = 0; i < corners.size(); i++)
+            {
+                for (int j = 0; j < 3; j++)
+                    barycenters[3*c+j] += nodecoords->at(3*corners[i]+j)/corners.size();
+            }
+        }
+
+        std::vector<int> cells(numcells);
+        for (int c = 0; c < numcells; c++)
+            cells[c] = c;
+        bisect(cells, barycenters, weights, 0, numcells, 0, numparts);
+        #endif
+    }
+
+    definetables();
+}
+
+void meshpartitioner::pack(std::vector<int>& ints, std::vector<int>& intsizes, std::vector<double>& doubles, std::vector<int>& doublesizes)
+{
+    const std::vector<double>* nodecoords = mynodes->readcoordinates();
+
+    int numcells = mycelltypes.size();
+    int numnodes = mynodes->count();
+
+    std::vector<int> ncn(8);
+    for (int i = 0; i < 8; i++)
+    {
+        element myelement(i, mycurvatureorder);
+        ncn[i] = myelement.countcurvednodes();
+    }
+
+    ///// Parts having each cell subelement in the mesh (cells and points excluded):
+    std::vector<std::vector<std::vector<int>>> elementparts(8, std::vector<std::vector<int>>(0));
+    for (int i = 1; i < 8; i++)
+    {
+        element myelement(i);
+        int elemdim = myelement.getelementdimension();
+        if (elemdim >= mymeshdim)
+            continue;
+
+        elementparts[i] = std::vector<std::vector<int>>(myelements->count(i));
+        std::vector<int> corners;
+        for (int e = 0; e < myelements->count(i); e++)
+        {
+            getcorners(i, e, corners);
+            std::sort(corners.begin(), corners.end());
+            elementparts[i][e] = findparts(elemdim, corners);
+
+            if (elementparts[i][e].size() == 0)
+            {
+                std::cout << "Error in 'meshpartitioner' object: found a " << myelement.gettypename() << " that is not on any " << mymeshdim << "D element (cannot partition)" << std::endl;
+                abort();
+            }
+        }
+    }
+
+    ///// Define the no-overlap interfaces (highest dimension first):
+    // 'interfaces[r]' lists {neighbour part, dimension, entry} for every interface element of part r:
+    std::vector<std::vector<int>> interfaces(mynumparts, std::vector<int>(0));
+    // Corner nodes of all subelements of the shared elements in the dimension above (format {r,q,sorted corners}):
+    std::set<std::vector<int>> covered, nextcovered;
+    for (int d = mymeshdim-1; d >= 0; d--)
+    {
+        int w = getkeywidth(d);
+        int* keys = mykeys[d].data();
+        int numentries = myentityorder[d].size();
+
+        nextcovered.clear();
+
+        int groupbegin = 0;
+        while (groupbegin < numentries)
+        {
+            int first = myentityorder[d][groupbegin];
+            int groupend = groupbegin+1;
+            while (groupend < numentries && std::equal(keys+w*first, keys+w*first+w, keys+w*myentityorder[d][groupend]))
+                groupend++;
+
+            // First entry of every part in the group:
+            std::vector<int> partentries = {};
+            for (int i = groupbegin; i < groupend; i++)
+            {
+                int entry = myentityorder[d][i];
+                if (i == groupbegin || myentityparts[d][entry] != myentityparts[d][myentityorder[d][i-1]])
+                    partentries.push_back(entry);
+            }
+
+            for (int a = 0; a < partentries.size(); a++)
+            {
+                for (int b = 0; b < partentries.size(); b++)
+                {
+                    if (a == b)
+                        continue;
+                    int r = myentityparts[d][partentries[a]];
+                    int q = myentityparts[d][partentries[b]];
+
+                    std::vector<int> sharedkey = {r,q};
+                    sharedkey.insert(sharedkey.end(), keys+w*first, keys+w*first+w);
+                    if (d == mymeshdim-1 || covered.count(sharedkey) == 0)
+                        interfaces[r].insert(interfaces[r].end(), {q, d, partentries[a]});
+
+                    if (d == 0)
+                        continue;
+
+                    // Subelements of dimension d-1 (nodes of edges, edges of faces):
+                    std::vector<int> corners = getentitycorners(d, partentries[a]);
+                    int numcorners = corners.size();
+                    int wsub = getkeywidth(d-1);
+                    for (int i = 0; i < numcorners; i++)
+                    {
+                        std::vector<int> subcorners = {corners[i]};
+                        if (d == 2)
+                            subcorners.push_back(corners[(i+1)%numcorners]);
+                        std::sort(subcorners.begin(), subcorners.end());
+                        subcorners.resize(wsub, -1);
+
+                        std::vector<int> subkey = {r,q};
+                        subkey.insert(subkey.end(), subcorners.begin(), subcorners.end());
+                        nextcovered.insert(subkey);
+                    }
+                }
+            }
+
+            groupbegin = groupend;
+        }
+
+        covered.swap(nextcovered);
+    }
+
+    int firstnewpr = myphysicalregions->getmaxphysicalregionnumber()+1;
+
+    ///// Pack every part:
+    ints = {}; doubles = {};
+    intsizes = std::vector<int>(mynumparts, 0);
+    doublesizes = std::vector<int>(mynumparts, 0);
+
+    std::vector<int> localnode(numnodes, -1);
+    std::vector<std::vector<int>> localelement(8, std::vector<int>(0));
+    for (int i = 0; i < 8; i++)
+        localelement[i] = std::vector<int>(myelements->count(i), -1);
+
+    for (int r = 0; r < mynumparts; r++)
+    {
+        int intstart = ints.size();
+        int doublestart = doubles.size();
+
+        // Local nodes and elements:
+        std::vector<int> nodelist = {};
+        std::vector<std::vector<int>> elementlists(8, std::vector<int>(0));
+
+        for (int c = 0; c < numcells; c++)
+        {
+            if (mycellparts[c] != r)
+                continue;
+            int ct = mycelltypes[c];
+            localelement[ct][mycellnumbers[c]] = elementlists[ct].size();
+            elementlists[ct].push_back(mycellnumbers[c]);
+
+            for (int i = 0; i < ncn[ct]; i++)
+            {
+                int node = myelements->getsubelement(0, ct, mycellnumbers[c], i);
+                if (localnode[node] == -1)
+                {
+                    localnode[node] = nodelist.size();
+                    nodelist.push_back(node);
+                }
+            }
+        }
+        for (int i = 1; i < 8; i++)
+        {
+            for (int e = 0; e < elementparts[i].size(); e++)
+            {
+                if (std::binary_search(elementparts[i][e].begin(), elementparts[i][e].end(), r))
+                {
+                    localelement[i][e] = elementlists[i].size();
+                    elementlists[i].push_back(e);
+                }
+            }
+        }
+
+        // Interface elements (grouped by neighbour then dimension):
+        std::vector<int> ifneighbours = {};
+        std::vector<std::vector<int>> ifelements(8, std::vector<int>(0)), ifnodes(8, std::vector<int>(0));
+        // Type and local number of every interface element:
+        std::vector<int> iftypes = {}, ifnumbers = {};
+        for (int i = 0; i < interfaces[r].size()/3; i++)
+        {
+            int q = interfaces[r][3*i+0];
+            if (std::find(ifneighbours.begin(), ifneighbours.end(), q) == ifneighbours.end())
+                ifneighbours.push_back(q);
+
+            int entitytype;
+            std::vector<int> entitynodes = getentitynodes(interfaces[r][3*i+1], interfaces[r][3*i+2], entitytype);
+
+            iftypes.push_back(entitytype);
+            if (entitytype == 0)
+                ifnumbers.push_back(localnode[entitynodes[0]]);
+            else
+            {
+                ifnumbers.push_back(elementlists[entitytype].size()+ifelements[entitytype].size());
+                ifelements[entitytype].push_back(i);
+                for (int j = 0; j < entitynodes.size(); j++)
+                    ifnodes[entitytype].push_back(localnode[entitynodes[j]]);
+            }
+        }
+        std::sort(ifneighbours.begin(), ifneighbours.end());
+
+        ints.push_back(nodelist.size());
+        ints.push_back(mycurvatureorder);
+        // Element types 1 to 7 (points are nodes):
+        for (int i = 1; i < 8; i++)
+        {
+            ints.push_back(elementlists[i].size()+ifelements[i].size());
+            for (int e = 0; e < elementlists[i].size(); e++)
+            {
+                for (int j = 0; j < ncn[i]; j++)
+                    ints.push_back(localnode[myelements->getsubelement(0, i, elementlists[i][e], j)]);
+            }
+            ints.insert(ints.end(), ifnodes[i].begin(), ifnodes[i].end());
+        }
+
+        // Physical regions from the mesh:
+        ints.push_back(myphysicalregions->count());
+        for (int p = 0; p < myphysicalregions->count(); p++)
+        {
+            physicalregion* curpr = myphysicalregions->getatindex(p);
+            std::vector<std::vector<int>>* curelemlist = curpr->getelementlist();
+
+            ints.push_back(curpr->getnumber());
+            for (int i = 0; i < 8; i++)
+            {
+                int countpos = ints.size();
+                ints.push_back(0);
+                for (int e = 0; e < curelemlist->at(i).size(); e++)
+                {
+                    int localnum = (i == 0) ? localnode[curelemlist->at(i)[e]] : localelement[i][curelemlist->at(i)[e]];
+                    if (localnum >= 0)
+                    {
+                        ints.push_back(localnum);
+                        ints[countpos]++;
+                    }
+                }
+            }
+        }
+
+        // Interface regions and neighbours:
+        int curpr = firstnewpr;
+        std::vector<int> neighbourdata = {};
+        std::vector<int> regiondata = {};
+        int numifregions = 0;
+        for (int n = 0; n < ifneighbours.size(); n++)
+        {
+            neighbourdata.push_back(ifneighbours[n]);
+            for (int d = 0; d < 3; d++)
+            {
+                std::vector<std::vector<int>> ifregion(8, std::vector<int>(0));
+                for (int i = 0; i < interfaces[r].size()/3; i++)
+                {
+                    if (interfaces[r][3*i+0] == ifneighbours[n] && interfaces[r][3*i+1] == d)
+                        ifregion[iftypes[i]].push_back(ifnumbers[i]);
+                }
+                if (ifregion[0].size()+ifregion[1].size()+ifregion[2].size()+ifregion[3].size() == 0)
+                {
+                    neighbourdata.push_back(-1);
+                    continue;
+                }
+
+                neighbourdata.push_back(curpr);
+                regiondata.push_back(curpr);
+                for (int i = 0; i < 8; i++)
+                {
+                    regiondata.push_back(ifregion[i].size());
+                    regiondata.insert(regiondata.end(), ifregion[i].begin(), ifregion[i].end());
+                }
+                numifregions++;
+                curpr++;
+            }
+        }
+        ints.push_back(numifregions);
+        ints.insert(ints.end(), regiondata.begin(), regiondata.end());
+        ints.push_back(ifneighbours.size());
+        ints.insert(ints.end(), neighbourdata.begin(), neighbourdata.end());
+
+        for (int i = 0; i < nodelist.size(); i++)
+        {
+            for (int j = 0; j < 3; j++)
+                doubles.push_back(nodecoords->at(3*nodelist[i]+j));
+        }
+
+        intsizes[r] = ints.size()-intstart;
+        doublesizes[r] = doubles.size()-doublestart;
+
+        // Reset the local numbering for the next part:
+        for (int i = 0; i < nodelist.size(); i++)
+            localnode[nodelist[i]] = -1;
+        for (int i = 1; i < 8; i++)
+        {
+            for (int e = 0; e < elementlists[i].size(); e++)
+                localelement[i][elementlists[i][e]] = -1;
+        }
+    }
+}
+
+void meshpartitioner::unpack(std::vector<int>& ints, std::vector<double>& doubles, nodes& nds, elements& els, physicalregions& prs, std::vector<int>& neighbours, std::vector<int>& nooverlapinterfaces)
+{
+    int index = 0;
+
+    int numnodes = ints[index]; index++;
+    int curvatureorder = ints[index]; index++;
+
+    nds.setnumber(numnodes);
+    std::vector<double>* nodecoords = nds.getcoordinates();
+    for (int i = 0; i < 3*numnodes; i++)
+        nodecoords->at(i) = doubles[i];
+
+    for (int i = 1; i < 8; i++)
+    {
+        element myelement(i, curvatureorder);
+        int ncn = myelement.countcurvednodes();
+
+        int numelems = ints[index]; index++;
+        std::vector<int> nodelist(ncn);
+        for (int e = 0; e < numelems; e++)
+        {
+            for (int j = 0; j < ncn; j++)
+                nodelist[j] = ints[index+j];
+            index += ncn;
+            els.add(i, curvatureorder, nodelist);
+        }
+    }
+
+    // Mesh regions then interface regions:
+    for (int k = 0; k < 2; k++)
+    {
+        int numregions = ints[index]; index++;
+        for (int p = 0; p < numregions; p++)
+        {
+            physicalregion* curpr = prs.get(ints[index]); index++;
+            for (int i = 0; i < 8; i++)
+            {
+                int numelems = ints[index]; index++;
+                for (int e = 0; e < numelems; e++)
+                    curpr->addelement(i, ints[index+e]);
+                index += numelems;
+            }
+        }
+    }
+
+    int numneighbours = ints[index]; index++;
+    neighbours = std::vector<int>(numneighbours);
+    nooverlapinterfaces = std::vector<int>(3*numneighbours);
+    for (int n = 0; n < numneighbours; n++)
+    {
+        neighbours[n] = ints[index]; index++;
+        for (int d = 0; d < 3; d++)
+        {
+            nooverlapinterfaces[3*n+d] = ints[index]; index++;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object partitions a whole mesh (read on a single rank) into one part per rank. The cells
+// (highest dimension elements) are split with METIS when available and by recursive coordinate
+// bisection otherwise. The nodes, elements and physical regions of every part are packed together
+// with the no-overlap interfaces to each neighbour part (one new physical region per neighbour
+// and interface dimension) so that the ranks do not have to discover their connectivity.
+//
+// The interface of element dimension meshdim-1 holds all faces/edges/nodes shared by two parts.
+// The lower dimension interfaces only hold the shared edges/nodes that are not part of a
+// shared element of the dimension above (same layout as in 'dtracker::discoverconnectivity').
+
+
+#ifndef MESHPARTITIONER_H
+#define MESHPARTITIONER_H
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "element.h"
+#include "nodes.h"
+#include "elements.h"
+#include "physicalregions.h"
+
+class meshpartitioner
+{
+    private:
+
+        nodes* mynodes;
+        elements* myelements;
+        physicalregions* myphysicalregions;
+
+        int mymeshdim = -1;
+        int mycurvatureorder = -1;
+        int mynumparts = 0;
+
+        // Type, number and part of every cell:
+        std::vector<int> mycelltypes = {};
+        std::vector<int> mycellnumbers = {};
+        std::vector<int> mycellparts = {};
+
+        // For every subelement dimension d below the mesh dimension all subelements of all cells are listed.
+        // Entry i has the sorted corner nodes 'mykeys[d][w*i+j]' (padded with -1 to width w), the part of
+        // its cell 'myentityparts[d][i]', its cell 'myentitycells[d][i]' and its index in the cell 'myentitysubs[d][i]'.
+        // 'myentityorder[d]' sorts all entries by corner nodes then by part.
+        std::vector<std::vector<int>> mykeys = std::vector<std::vector<int>>(3, std::vector<int>(0));
+        std::vector<std::vector<int>> myentityparts = std::vector<std::vector<int>>(3, std::vector<int>(0));
+        std::vector<std::vector<int>> myentitycells = std::vector<std::vector<int>>(3, std::vector<int>(0));
+        std::vector<std::vector<int>> myentitysubs = std::vector<std::vector<int>>(3, std::vector<int>(0));
+        std::vector<std::vector<int>> myentityorder = std::vector<std::vector<int>>(3, std::vector<int>(0));
+
+        // Width of the corner node keys in each dimension:
+        int getkeywidth(int dim);
+
+        void getcorners(int elementtypenumber, int elementnumber, std::vector<int>& corners);
+        // Corner nodes (in the element ordering) of entry 'entry' of dimension 'dim':
+        std::vector<int> getentitycorners(int dim, int entry);
+        // Curved nodes and uncurved type number of entry 'entry' of dimension 'dim':
+        std::vector<int> getentitynodes(int dim, int entry, int& entitytype);
+
+        // Split the cells at positions 'firstcell' to 'lastcell'-1 in 'cells' into 'numparts' parts of equal total weight:
+        void bisect(std::vector<int>& cells, std::vector<double>& barycenters, std::vector<double>& weights, int firstcell, int lastcell, int firstpart, int numparts);
+
+        void definetables(void);
+        // Ranks (sorted, unique) having the subelement with sorted corner nodes 'key':
+        std::vector<int> findparts(int dim, std::vector<int>& key);
+
+    public:
+
+        meshpartitioner(nodes* nds, elements* els, physicalregions* prs);
+
+        // Define the part of every cell. The cells in the weighted physical regions have the largest weight
+        // of all weighted regions they are in (weight 1 otherwise). The parts have a balanced total weight.
+        void partition(int numparts, std::vector<int> weightedregions = {}, std::vector<double> regionweights = {});
+
+        // Pack the data of all parts (fragment of part r is at the rth position in 'intsizes' and 'doublesizes'):
+        void pack(std::vector<int>& ints, std::vector<int>& intsizes, std::vector<double>& doubles, std::vector<int>& doublesizes);
+
+        // Fill the empty nodes, elements and physical regions with the data packed for a part. The neighbour
+        // parts and their no-overlap interface regions (format of 'dtracker::setconnectivity') are returned.
+        static void unpack(std::vector<int>& ints, std::vector<double>& doubles, nodes& nds, elements& els, physicalregions& prs, std::vector<int>& neighbours, std::vector<int>& nooverlapinterfaces);
+
+};
+
+#endif
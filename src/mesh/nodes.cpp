@@ -5,19 +5,32 @@
 
 nodes::nodes(void) {}
 
+void nodes::makeunique(void)
+{
+    if (mycoordinates.use_count() > 1)
+        mycoordinates = std::shared_ptr<std::vector<double>>(new std::vector<double>(*mycoordinates));
+}
+
 void nodes::setnumber(int numberofnodes)
 {
-    mycoordinates.resize(3*numberofnodes);
+    makeunique();
+    mycoordinates->resize(3*numberofnodes);
 }
 
 int nodes::count(void)
 {
-    return mycoordinates.size()/3;
+    return mycoordinates->size()/3;
 }
 
 std::vector<double>* nodes::getcoordinates(void)
 {
-    return &mycoordinates;
+    makeunique();
+    return mycoordinates.get();
+}
+
+const std::vector<double>* nodes::readcoordinates(void)
+{
+    return mycoordinates.get();
 }
 
 void nodes::print(void)
@@ -28,30 +41,41 @@ void nodes::print(void)
     int oldprecision = std::cout.precision();
     std::cout.precision(17);
     
+    std::vector<double>& coords = *mycoordinates;
     for (int i = 0; i < count(); i++)
-        std::cout << std::setw(10) << std::left << i << std::setw(26) << std::left << mycoordinates[3*i+0] << std::setw(26) << std::left << mycoordinates[3*i+1] << std::setw(26) << std::left << mycoordinates[3*i+2] << std::endl;
+        std::cout << std::setw(10) << std::left << i << std::setw(26) << std::left << coords[3*i+0] << std::setw(26) << std::left << coords[3*i+1] << std::setw(26) << std::left << coords[3*i+2] << std::endl;
     std::cout << std::endl;
     
     std::cout.precision(oldprecision);
 }
 
+memoryusage nodes::getmemoryusage(void)
+{
+    memoryusage output;
+    output.add("node coordinates", memoryusage::countbytes(*mycoordinates));
+    return output;
+}
+
 std::vector<int> nodes::removeduplicates(void)
 {
+    makeunique();
+    std::vector<double>& coords = *mycoordinates;
+
     // 'noderenumbering' will give the renumbering corresponding to removed duplicates:
     std::vector<int> noderenumbering;
-    int numberofnonduplicates = gentools::removeduplicates(mycoordinates, noderenumbering);
+    int numberofnonduplicates = gentools::removeduplicates(coords, noderenumbering);
 
     for (int i = 0; i < noderenumbering.size(); i++)
     {
         if (noderenumbering[i] != i)
         {
-            mycoordinates[3*noderenumbering[i]+0] = mycoordinates[3*i+0];
-            mycoordinates[3*noderenumbering[i]+1] = mycoordinates[3*i+1];
-            mycoordinates[3*noderenumbering[i]+2] = mycoordinates[3*i+2];
+            coords[3*noderenumbering[i]+0] = coords[3*i+0];
+            coords[3*noderenumbering[i]+1] = coords[3*i+1];
+            coords[3*noderenumbering[i]+2] = coords[3*i+2];
         }
     }
     // Remove unused space:
-    mycoordinates.resize(numberofnonduplicates*3);
+    coords.resize(numberofnonduplicates*3);
     
     return noderenumbering;
 }
@@ -60,19 +84,21 @@ void nodes::reorder(std::vector<int>& nodereordering)
 {
     int numberofnodes = count();
     
-    // Update 'mycoordinates':
-    std::vector<double> nodecoordinatescopy = mycoordinates;
+    // Update 'mycoordinates' (a shared storage is left untouched):
+    std::shared_ptr<std::vector<double>> nodecoordinatescopy = mycoordinates;
+    mycoordinates = std::shared_ptr<std::vector<double>>(new std::vector<double>(3*numberofnodes));
+    std::vector<double>& coords = *mycoordinates;
     for (int i = 0; i < numberofnodes; i++)
     {
-        mycoordinates[3*i+0] = nodecoordinatescopy[3*nodereordering[i]+0]; 
-        mycoordinates[3*i+1] = nodecoordinatescopy[3*nodereordering[i]+1]; 
-        mycoordinates[3*i+2] = nodecoordinatescopy[3*nodereordering[i]+2]; 
+        coords[3*i+0] = nodecoordinatescopy->at(3*nodereordering[i]+0); 
+        coords[3*i+1] = nodecoordinatescopy->at(3*nodereordering[i]+1); 
+        coords[3*i+2] = nodecoordinatescopy->at(3*nodereordering[i]+2); 
     }
 }
 
 std::vector<double> nodes::getgeometrydimension(void)
 {
-    std::vector<double> bnds = gentools::getcoordbounds(mycoordinates);
+    std::vector<double> bnds = gentools::getcoordbounds(*mycoordinates);
 
     return {std::abs(bnds[0]-bnds[1]), std::abs(bnds[2]-bnds[3]), std::abs(bnds[4]-bnds[5])};
 }
@@ -88,7 +114,7 @@ std::vector<double> nodes::getnoisethreshold(void)
 
 void nodes::fixifaxisymmetric(void)
 {
-    if (universe::isaxisymmetric == false)
+    if (universe::getsession()->isaxisymmetric == false)
         return;
 
     double xnoiselevel = getnoisethreshold()[0];
@@ -96,11 +122,14 @@ void nodes::fixifaxisymmetric(void)
     int numberofnodes = count();
     for (int i = 0; i < numberofnodes; i++)
     {
-        double curx = mycoordinates[3*i+0];
+        double curx = mycoordinates->at(3*i+0);
         if (curx < 0)
         {
             if (std::abs(curx) < xnoiselevel)
-                mycoordinates[3*i+0] = 0.0;
+            {
+                makeunique();
+                mycoordinates->at(3*i+0) = 0.0;
+            }
             else
             {
                 std::cout << "Error in 'nodes' object: expected only positive x node coordinates with axisymmetry (found a node at x = " << curx << " which is out of noise range)" << std::endl;
@@ -11,14 +11,23 @@
 #include <vector>
 #include <cmath>
 #include <iomanip>
+#include <memory>
+#include "memoryusage.h"
 
 class nodes
 {
 
+    // For the native .slm mesh format:
+    friend class slminterface;
+
     private:
         
         // Coordinates of every node. Format is [x1 y1 z1 x2 y2 z2 ... ].
-        std::vector<double> mycoordinates = {};
+        // Copies of this object share the coordinates until one of them modifies them.
+        std::shared_ptr<std::vector<double>> mycoordinates = std::shared_ptr<std::vector<double>>(new std::vector<double>(0));
+        
+        // Make sure the coordinates are not shared with any copy before modifying them:
+        void makeunique(void);
         
     public:
         
@@ -28,12 +37,17 @@ class nodes
         void setnumber(int numberofnodes);
         // Get the number of nodes:
         int count(void);
-        // Get the coordinates:
+        // Get the coordinates to modify them (they are first copied if shared with another 'nodes' object):
         std::vector<double>* getcoordinates(void);
+        // Get the coordinates for reading only (this never copies them):
+        const std::vector<double>* readcoordinates(void);
         
         // Print node coordinates for debugging:
         void print(void);
         
+        // Bytes used by the node coordinates:
+        memoryusage getmemoryusage(void);
+        
         // 'removeduplicates' removes the duplicated nodes in 'mycoordinates'.
         std::vector<int> removeduplicates(void);    
         
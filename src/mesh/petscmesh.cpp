@@ -37,6 +37,7 @@ petscmesh::petscmesh(std::string filename)
     
     if (isvalidext)
     {
+        universe::initializepetsc();
         DMPlexCreateFromFile(PETSC_COMM_SELF, filename.c_str(), PETSC_TRUE, &mypetscmesh);
         DMGetDimension(mypetscmesh, &meshdim);
         return;
@@ -31,6 +31,20 @@ void physicalregion::addelement(int elementtypenumber, int elementnumber)
     elementlist[elementtypenumber].push_back(elementnumber);
 }
 
+void physicalregion::addelements(int elementtypenumber, int firstelement, int numelems)
+{
+    if (numelems == 0)
+        return;
+    // Check the dimension once:
+    addelement(elementtypenumber, firstelement);
+    
+    std::vector<int>& curlist = elementlist[elementtypenumber];
+    int previoussize = curlist.size();
+    curlist.resize(previoussize + numelems-1);
+    for (int i = 1; i < numelems; i++)
+        curlist[previoussize-1+i] = firstelement+i;
+}
+
 int physicalregion::countelements(void)
 {
     int numelems = 0;
@@ -61,6 +75,13 @@ void physicalregion::definewithdisjointregions(void)
     
     for (int i = 0; i < mydisjointregions->count(); i++)
         includesdisjointregion[i] = mydisjointregions->isinphysicalregion(i, prindex);
+        
+    updatedefinitionbits();
+}
+
+void physicalregion::updatedefinitionbits(void)
+{
+    mydefinitionbits = regionbits(includesdisjointregion);
 }
 
 void physicalregion::setdisjointregions(std::vector<int> disjointregionlist)
@@ -74,6 +95,8 @@ void physicalregion::setdisjointregions(std::vector<int> disjointregionlist)
         if (myelementdimension < mydisjointregions->getelementdimension(disjointregionlist[i]))
             myelementdimension = mydisjointregions->getelementdimension(disjointregionlist[i]);
     }
+    
+    updatedefinitionbits();
 }
 
 std::vector<bool> physicalregion::getdefinition(void)
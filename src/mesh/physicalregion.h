@@ -13,12 +13,16 @@
 #include <vector>
 #include <algorithm>
 #include "element.h"
+#include "regionbits.h"
 
 class physicalregions;
 
 class physicalregion
 {
 
+    // For the native .slm mesh format:
+    friend class slminterface;
+
     private:
 
         // The physical region can only hold elements of a single dimension (0D, 1D, 2D or 3D).
@@ -31,6 +35,10 @@ class physicalregion
 
         // 'includesdisjointregion[i]' is true if disjoint region i is in the physical region.
         std::vector<bool> includesdisjointregion = {};
+        // Same as above packed in words (for fast region algebra):
+        regionbits mydefinitionbits;
+        // Update 'mydefinitionbits' after 'includesdisjointregion' has changed:
+        void updatedefinitionbits(void);
         // List of all element numbers in the physical region.
         std::vector<std::vector<int>> elementlist = std::vector<std::vector<int>>(8, std::vector<int>(0));
         
@@ -42,6 +50,8 @@ class physicalregion
         int getnumber(void);
         // Add an element of uncurved type 'elementtypenumber' to the physical region:
         void addelement(int elementtypenumber, int elementnumber);
+        // Add the 'numelems' elements numbered from 'firstelement':
+        void addelements(int elementtypenumber, int firstelement, int numelems);
         
         int countelements(void);
         int getelementdimension(void);
@@ -54,6 +64,8 @@ class physicalregion
 
         // Get the definition of this physical region based on the disjoint regions it contains:
         std::vector<bool> getdefinition(void);
+        // Same as a bitset (the pointer stays valid until the definition changes):
+        regionbits* getdefinitionbits(void) { return &mydefinitionbits; };
 
         // Get all disjoint regions of the max dimension:
         std::vector<int> getdisjointregions(void);
@@ -180,13 +180,13 @@ int physicalregions::getindex(int physicalregionnumber)
 
 int physicalregions::find(std::vector<int>& disjregsinphysreg)
 {
-    std::vector<bool> argdef(mydisjointregions->count(), false);
+    regionbits argdef(mydisjointregions->count(), false);
     for (int i = 0; i < disjregsinphysreg.size(); i++)
-        argdef[disjregsinphysreg[i]] = true;
+        argdef.set(disjregsinphysreg[i]);
 
     for (int i = 0; i < myphysicalregionnumbers.size(); i++)
     {
-        if (myphysicalregions[i]->getdefinition() == argdef)
+        if (*(myphysicalregions[i]->getdefinitionbits()) == argdef)
             return myphysicalregionnumbers[i];
     }
     return -1;
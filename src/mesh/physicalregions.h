@@ -20,6 +20,9 @@ class physicalregion;
 class physicalregions
 {
 
+    // For the native .slm mesh format:
+    friend class slminterface;
+
     private:
 
         std::vector<std::shared_ptr<physicalregion>> myphysicalregions;
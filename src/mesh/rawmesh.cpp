@@ -1,7 +1,47 @@
 #include "rawmesh.h"
 #include "geotools.h"
+#include "jacobiancache.h"
+#include "meshcache.h"
+#include <thread>
 
 
+// The shapes of a mesh loaded from shapes and the processed mesh obtained:
+class rawmeshshapecacheentry
+{
+    public:
+        
+        bool isaxisymmetric = false;
+        bool isrenumberingallowed = false;
+        std::vector<int> physregs = {};
+        std::vector<std::vector<double>> coords = {};
+        std::vector<std::vector<std::vector<int>>> elems = {};
+        
+        std::shared_ptr<rawmesh> processed = NULL;
+        
+        rawmeshshapecacheentry(void) {};
+        rawmeshshapecacheentry(std::vector<shape>& inputshapes)
+        {
+            isaxisymmetric = universe::getsession()->isaxisymmetric;
+            isrenumberingallowed = universe::ismeshrenumberingallowed;
+            for (int i = 0; i < inputshapes.size(); i++)
+            {
+                std::shared_ptr<rawshape> rs = inputshapes[i].getpointer();
+                physregs.push_back(rs->getphysicalregion());
+                coords.push_back(*(rs->getcoords()));
+                elems.push_back(*(rs->getelems()));
+            }
+        };
+        
+        bool ismatch(rawmeshshapecacheentry& other)
+        {
+            return (isaxisymmetric == other.isaxisymmetric && isrenumberingallowed == other.isrenumberingallowed && physregs == other.physregs && coords == other.coords && elems == other.elems);
+        };
+};
+
+std::vector<rawmeshshapecacheentry> rawmeshshapecache = {};
+
+int rawmesh::maxnumcachedshapemeshes = 2;
+
 void rawmesh::splitmesh(void)
 {
     if (mynumsplitrequested == 0)
@@ -52,24 +92,56 @@ void rawmesh::splitmesh(void)
             int ne = curelemlist->at(i).size();
             if (ne == 0)
                 continue;
-            std::vector<double> coords(3*ncn[i]*ne);
-            for (int e = 0; e < ne; e++)
+            
+            // The elements are split by blocks in parallel. The block size does not depend on
+            // the number of threads so that the split elements are always in the same order.
+            int blocksize = 1000;
+            int numblocks = (ne+blocksize-1)/blocksize;
+            std::vector<std::vector<std::vector<double>>> tempsplit(numblocks);
+            
+            int numthreadstouse = std::min(numblocks, universe::getmaxnumthreads());
+            
+            auto splitblocks = [&](int t)
             {
-                int el = curelemlist->at(i)[e];
-                std::vector<double> curcoords = myelements.getnodecoordinates(i,el);
-                for (int j = 0; j < curcoords.size(); j++)
-                    coords[3*ncn[i]*e+j] = curcoords[j];
+                element myelem(i,co);
+                for (int b = t; b < numblocks; b += numthreadstouse)
+                {
+                    int firstelem = b*blocksize;
+                    int lastelem = std::min(ne, (b+1)*blocksize);
+                
+                    std::vector<double> coords(3*ncn[i]*(lastelem-firstelem));
+                    for (int e = firstelem; e < lastelem; e++)
+                    {
+                        int el = curelemlist->at(i)[e];
+                        std::vector<double> curcoords = myelements.getnodecoordinates(i,el);
+                        for (int j = 0; j < curcoords.size(); j++)
+                            coords[3*ncn[i]*(e-firstelem)+j] = curcoords[j];
+                    }
+                    myelem.fullsplit(mynumsplitrequested, tempsplit[b], coords);
+                }
+            };
+            
+            if (numthreadstouse == 1)
+                splitblocks(0);
+            else
+            {
+                std::vector<std::thread> threadobjs(numthreadstouse);
+                for (int t = 0; t < numthreadstouse; t++)
+                    threadobjs[t] = universe::newthread(splitblocks, t);
+                for (int t = 0; t < numthreadstouse; t++)
+                    threadobjs[t].join();
             }
-            element myelem(i,co);
-            std::vector<std::vector<double>> tempsplit;
-            myelem.fullsplit(mynumsplitrequested, tempsplit, coords);
             
             // Group with the existing splitcoords[p]:
-            for (int j = 0; j < 8; j++)
+            for (int b = 0; b < numblocks; b++)
             {
-                for (int k = 0; k < tempsplit[j].size(); k++)
-                    splitcoords[p][j][indexes[j]+k] = tempsplit[j][k];
-                indexes[j] += tempsplit[j].size();
+                for (int j = 0; j < 8; j++)
+                {
+                    for (int k = 0; k < tempsplit[b][j].size(); k++)
+                        splitcoords[p][j][indexes[j]+k] = tempsplit[b][j][k];
+                    indexes[j] += tempsplit[b][j].size();
+                }
+                tempsplit[b] = {};
             }
         }
     }
@@ -133,6 +205,12 @@ void rawmesh::readfromfile(std::string tool, std::string source)
             nastraninterface::readfromfile(source, mynodes, myelements, myphysicalregions);
             return;    
         }
+        if (source.length() >= 5 && source.compare(source.size()-4,4,".slm") == 0)
+        {
+            std::cout << "Error: the processed .slm mesh file '" << source << "' can only be loaded on its own with 'mesh::load'" << std::endl;
+            abort();
+        }
+        
         
         std::cout << "Error: file '" << source << "' cannot be read by the native mesh reader." << std::endl;
         std::cout << "Use the GMSH or the petsc mesh reader instead or use the GMSH .msh or Nastran .nas format." << std::endl;
@@ -147,9 +225,11 @@ void rawmesh::writetofile(std::string name)
 {
     if (name.length() >= 5 && name.compare(name.size()-4,4,".msh") == 0)
         gmshinterface::writetofile(name, mynodes, myelements, myphysicalregions, mydisjointregions);
+    else if (name.length() >= 5 && name.compare(name.size()-4,4,".slm") == 0)
+        slminterface::writetofile(name, mynodes, myelements, mydisjointregions, myphysicalregions);
     else
     {
-        std::cout << "Error: file '" << name << "' has either no extension or it is not supported." << std::endl << "Currently supported: GMSH .msh" << std::endl;
+        std::cout << "Error: file '" << name << "' has either no extension or it is not supported." << std::endl << "Currently supported: GMSH .msh and native .slm" << std::endl;
         abort();
     }
 }
@@ -250,6 +330,8 @@ std::shared_ptr<rawmesh> rawmesh::getattarget(std::shared_ptr<ptracker> targetpt
 
 void rawmesh::load(std::string name, int globalgeometryskin, int numoverlaplayers, int verbosity)
 {
+    profilescope scope("mesh load");
+    
     // Do not call this when the mesh is already loaded!
 
     std::string tool, source;
@@ -262,26 +344,113 @@ void rawmesh::load(std::string name, int globalgeometryskin, int numoverlaplayer
     
     wallclock loadtime;
     
+    // The native .slm format holds an already processed mesh:
+    if (tool == "native" && source.length() >= 5 && source.compare(source.size()-4,4,".slm") == 0)
+    {
+        loadprocessed(source, globalgeometryskin, numoverlaplayers, verbosity);
+        if (verbosity > 0)
+            loadtime.print("Time to load the mesh: ");
+        return;
+    }
+    
     readfromfile(tool, source);
     
+    process(globalgeometryskin, numoverlaplayers, false, {}, {}, verbosity);
+    
+    if (verbosity > 0)
+        loadtime.print("Time to load the mesh: ");
+}
+
+void rawmesh::allload(std::string name, int globalgeometryskin, int numoverlaplayers, std::vector<int> weightedregions, std::vector<double> regionweights, int verbosity)
+{
+    profilescope scope("mesh load");
+    
+    // Do not call this when the mesh is already loaded!
+    
+    int rank = slmpi::getrank();
+    int numranks = slmpi::count();
+    
+    if (numranks == 1 || numoverlaplayers < 0)
+    {
+        load(name, globalgeometryskin, numoverlaplayers, verbosity);
+        return;
+    }
+
+    std::string tool, source;
+    gentools::splitatcolon(name, tool, source);
+    if (tool.size() == 0)
+        tool = "native";
+
+    if (verbosity > 0 && rank == 0)
+        std::cout << "Loading mesh from '" << source << "' with the " << tool << " mesh reader and partitioning it in " << numranks << " parts" << std::endl;
+    
+    wallclock loadtime;
+    
+    // Only rank 0 reads the whole mesh:
+    std::vector<int> ints = {}, intsizes = {};
+    std::vector<double> doubles = {};
+    std::vector<int> doublesizes = {};
+    if (rank == 0)
+    {
+        std::shared_ptr<rawmesh> wholemesh(new rawmesh);
+        wholemesh->readfromfile(tool, source);
+        
+        meshpartitioner mp(wholemesh->getnodes(), wholemesh->getelements(), wholemesh->getphysicalregions());
+        mp.partition(numranks, weightedregions, regionweights);
+        mp.pack(ints, intsizes, doubles, doublesizes);
+    }
+    
+    std::vector<int> allsizes = {}, sizes(2);
+    if (rank == 0)
+    {
+        allsizes = std::vector<int>(2*numranks);
+        for (int r = 0; r < numranks; r++)
+        {
+            allsizes[2*r+0] = intsizes[r];
+            allsizes[2*r+1] = doublesizes[r];
+        }
+    }
+    slmpi::scatter(0, allsizes, sizes);
+    
+    std::vector<int> myints(sizes[0]);
+    std::vector<double> mydoubles(sizes[1]);
+    slmpi::scatter(0, ints, myints, intsizes);
+    slmpi::scatter(0, doubles, mydoubles, doublesizes);
+    
+    std::vector<int> neighbours, nooverlapinterfaces;
+    meshpartitioner::unpack(myints, mydoubles, mynodes, myelements, myphysicalregions, neighbours, nooverlapinterfaces);
+    
+    process(globalgeometryskin, numoverlaplayers, true, neighbours, nooverlapinterfaces, verbosity);
+    
+    if (verbosity > 0)
+        loadtime.print("Time to load the mesh: ");
+}
+
+void rawmesh::process(int globalgeometryskin, int numoverlaplayers, bool isconnectivityprovided, std::vector<int> neighbours, std::vector<int> nooverlapinterfaces, int verbosity)
+{
     splitmesh();
     mynodes.fixifaxisymmetric();
     
     myelements.explode();
     removeduplicates();
+    if (universe::ismeshrenumberingallowed)
+        myelements.reorderalonghilbertcurve();
     myregiondefiner.defineregions();
     
     // For DDM:
     mydtracker = std::shared_ptr<dtracker>(new dtracker(shared_from_this(), globalgeometryskin, numoverlaplayers));
     if (mydtracker->isdefined())
     {
-        mydtracker->discoverconnectivity(10, verbosity);
+        if (isconnectivityprovided)
+            mydtracker->setconnectivity(neighbours, nooverlapinterfaces);
+        else
+            mydtracker->discoverconnectivity(10, verbosity);
         mydtracker->overlap();
     }
     
     myelements.definedisjointregions();
-    // The reordering is stable and the elements are thus still ordered 
-    // by barycenter coordinates in every disjoint region!
+    // The reordering is stable and the elements are thus still ordered by barycenter 
+    // coordinates (or along the Hilbert curve) in every disjoint region!
     myelements.reorderbydisjointregions();
     myelements.definedisjointregionsranges();
     
@@ -302,23 +471,66 @@ void rawmesh::load(std::string name, int globalgeometryskin, int numoverlaplayer
     }
     
     myelements.orient(orientrenum);
+    if (universe::iselementgroupingbyorientation && mydtracker->isdefined() == false)
+        myelements.reorderbytotalorientation();
     errorondisconnecteddisjointregion();
     
     if (verbosity > 0)
         printcount();
     if (verbosity > 1)
         printelementsinphysicalregions();
+
+    // Make sure axisymmetry is valid for this mesh:    
+    if (universe::getsession()->isaxisymmetric && getmeshdimension() != 2)
+    {
+        std::cout << "Error in 'mesh' object: axisymmetry is only allowed for 2D problems" << std::endl;
+        abort();
+    }
+    
+    mynumber = 0;
+    // The mesh numbers restart from zero:
+    meshcache::clear();
+    
+    myptracker = std::shared_ptr<ptracker>(new ptracker(myelements.count()));
+    myptracker->updatedisjointregions(&mydisjointregions);
+    
+    myhtracker = std::shared_ptr<htracker>(new htracker(shared_from_this()));
+    myhadaptedmesh = copy();
+}
+
+void rawmesh::loadprocessed(std::string source, int globalgeometryskin, int numoverlaplayers, int verbosity)
+{
+    if (mynumsplitrequested > 0 || myregiondefiner.isanyregiondefined())
+    {
+        std::cout << "Error in 'mesh' object: cannot split or define regions on a mesh loaded from a processed .slm file (do it before writing the .slm file)" << std::endl;
+        abort();
+    }
+    
+    slminterface::readfromfile(source, mynodes, myelements, mydisjointregions, myphysicalregions);
+    
+    // For DDM:
+    mydtracker = std::shared_ptr<dtracker>(new dtracker(shared_from_this(), globalgeometryskin, numoverlaplayers));
+    if (mydtracker->isdefined())
+    {
+        std::cout << "Error in 'mesh' object: a processed .slm file cannot be used for DDM (load the original mesh file instead)" << std::endl;
+        abort();
+    }
+    
     if (verbosity > 0)
-        loadtime.print("Time to load the mesh: ");
+        printcount();
+    if (verbosity > 1)
+        printelementsinphysicalregions();
 
     // Make sure axisymmetry is valid for this mesh:    
-    if (universe::isaxisymmetric && getmeshdimension() != 2)
+    if (universe::getsession()->isaxisymmetric && getmeshdimension() != 2)
     {
         std::cout << "Error in 'mesh' object: axisymmetry is only allowed for 2D problems" << std::endl;
         abort();
     }
     
     mynumber = 0;
+    // The mesh numbers restart from zero:
+    meshcache::clear();
     
     myptracker = std::shared_ptr<ptracker>(new ptracker(myelements.count()));
     myptracker->updatedisjointregions(&mydisjointregions);
@@ -451,90 +663,133 @@ void rawmesh::load(std::vector<shape> inputshapes, int globalgeometryskin, int n
         }
     }
 
-    // Get the number of nodes for preallocation:
-    int numberofnodes = 0;
-    for (int i = 0; i < inputshapes.size(); i++)
-        numberofnodes += ( inputshapes[i].getpointer()->getcoords() )->size()/3;
-    mynodes.setnumber(numberofnodes);
-    std::vector<double>* nodecoordinates = mynodes.getcoordinates();
-
-
-    // The node numbers must be shifted from a shape to the other to avoid same numbers:
-    int offset = 0;
-    // Loop on every input shape:
-    for (int i = 0; i < inputshapes.size(); i++)
+    // Reuse the processed mesh of identical shapes:
+    std::shared_ptr<rawmesh> processed = NULL;
+    rawmeshshapecacheentry key;
+    bool iscachable = (maxnumcachedshapemeshes > 0 && slmpi::count() == 1 && mynumsplitrequested == 0 && myregiondefiner.isanyregiondefined() == false);
+    if (iscachable)
     {
-        // Append the nodes:
-        std::vector<double>* nodecoords = inputshapes[i].getpointer()->getcoords();
-        for (int j = 0; j < nodecoords->size(); j++)
-            nodecoordinates->at(3*offset+j) = nodecoords->at(j);
-
-        // Append the elements:
-        int physreg = inputshapes[i].getpointer()->getphysicalregion();
-        physicalregion* currentphysicalregion = myphysicalregions.get(physreg);
-        std::vector<std::vector<int>>* elems = inputshapes[i].getpointer()->getelems();
-        // Loop on all element types:
-        for (int typenum = 0; typenum < elems->size(); typenum++)
+        key = rawmeshshapecacheentry(inputshapes);
+        for (int i = 0; i < rawmeshshapecache.size(); i++)
         {
-            element currentelem(typenum, curvatureorder);
-            // Number of nodes in every element of current type number:
-            int numnodesinelem = currentelem.countcurvednodes();
+            if (rawmeshshapecache[i].ismatch(key))
+            {
+                processed = rawmeshshapecache[i].processed;
+                break;
+            }
+        }
+    }
+    
+    if (processed != NULL)
+    {
+        mynodes = processed->mynodes;
+        mydisjointregions = processed->mydisjointregions;
+        processed->myphysicalregions.copy(&mydisjointregions, &myphysicalregions);
+        myelements = processed->myelements.copy(&mynodes, &myphysicalregions, &mydisjointregions);
+        
+        mydtracker = std::shared_ptr<dtracker>(new dtracker(shared_from_this(), globalgeometryskin, numoverlaplayers));
+    }
+    else
+    {
+        // Get the number of nodes for preallocation:
+        int numberofnodes = 0;
+        for (int i = 0; i < inputshapes.size(); i++)
+            numberofnodes += ( inputshapes[i].getpointer()->getcoords() )->size()/3;
+        mynodes.setnumber(numberofnodes);
+        std::vector<double>* nodecoordinates = mynodes.getcoordinates();
 
-            std::vector<int> nodesincurrentelement(numnodesinelem);
 
-            for (int e = 0; e < (elems->at(typenum)).size()/numnodesinelem; e++)
+        // The node numbers must be shifted from a shape to the other to avoid same numbers:
+        int offset = 0;
+        // Loop on every input shape:
+        for (int i = 0; i < inputshapes.size(); i++)
+        {
+            // Append the nodes:
+            std::vector<double>* nodecoords = inputshapes[i].getpointer()->getcoords();
+            for (int j = 0; j < nodecoords->size(); j++)
+                nodecoordinates->at(3*offset+j) = nodecoords->at(j);
+
+            // Append the elements:
+            int physreg = inputshapes[i].getpointer()->getphysicalregion();
+            physicalregion* currentphysicalregion = myphysicalregions.get(physreg);
+            std::vector<std::vector<int>>* elems = inputshapes[i].getpointer()->getelems();
+            // Loop on all element types:
+            for (int typenum = 0; typenum < elems->size(); typenum++)
             {
-                for (int m = 0; m < numnodesinelem; m++)
-                    nodesincurrentelement[m] = (elems->at(typenum))[e*numnodesinelem+m] + offset;
+                element currentelem(typenum, curvatureorder);
+                // Number of nodes in every element of current type number:
+                int numnodesinelem = currentelem.countcurvednodes();
 
-                int elementindexincurrenttype = myelements.add(typenum, curvatureorder, nodesincurrentelement);
-                currentphysicalregion->addelement(typenum, elementindexincurrenttype);
+                std::vector<int> nodesincurrentelement(numnodesinelem);
+
+                for (int e = 0; e < (elems->at(typenum)).size()/numnodesinelem; e++)
+                {
+                    for (int m = 0; m < numnodesinelem; m++)
+                        nodesincurrentelement[m] = (elems->at(typenum))[e*numnodesinelem+m] + offset;
+
+                    int elementindexincurrenttype = myelements.add(typenum, curvatureorder, nodesincurrentelement);
+                    currentphysicalregion->addelement(typenum, elementindexincurrenttype);
+                }
             }
-        }
 
-        offset += nodecoords->size()/3;
-    }
-    ///// Mesh is transferred
+            offset += nodecoords->size()/3;
+        }
+        ///// Mesh is transferred
 
-    splitmesh();
-    mynodes.fixifaxisymmetric();
+        splitmesh();
+        mynodes.fixifaxisymmetric();
 
-    myelements.explode();
-    removeduplicates();
-    myregiondefiner.defineregions();
+        myelements.explode();
+        removeduplicates();
+        if (universe::ismeshrenumberingallowed)
+            myelements.reorderalonghilbertcurve();
+        myregiondefiner.defineregions();
     
-    // For DDM:
-    mydtracker = std::shared_ptr<dtracker>(new dtracker(shared_from_this(), globalgeometryskin, numoverlaplayers));
-    if (mydtracker->isdefined())
-    {
-        mydtracker->discoverconnectivity(10, verbosity);
-        mydtracker->overlap();
-    }
+        // For DDM:
+        mydtracker = std::shared_ptr<dtracker>(new dtracker(shared_from_this(), globalgeometryskin, numoverlaplayers));
+        if (mydtracker->isdefined())
+        {
+            mydtracker->discoverconnectivity(10, verbosity);
+            mydtracker->overlap();
+        }
     
-    myelements.definedisjointregions();
-    // The reordering is stable and the elements are thus still ordered 
-    // by barycenter coordinates in every disjoint region!
-    myelements.reorderbydisjointregions();
-    myelements.definedisjointregionsranges();
+        myelements.definedisjointregions();
+        // The reordering is stable and the elements are thus still ordered by barycenter 
+        // coordinates (or along the Hilbert curve) in every disjoint region!
+        myelements.reorderbydisjointregions();
+        myelements.definedisjointregionsranges();
     
-    // For DDM:
-    long long int* orientrenum = NULL;
-    if (mydtracker->isdefined())
-    {
-        mydtracker->mapinterfaces();
-        mydtracker->createglobalnodenumbers();
-        orientrenum = mydtracker->getglobalnodenumbers();
-    }
+        // For DDM:
+        long long int* orientrenum = NULL;
+        if (mydtracker->isdefined())
+        {
+            mydtracker->mapinterfaces();
+            mydtracker->createglobalnodenumbers();
+            orientrenum = mydtracker->getglobalnodenumbers();
+        }
     
-    // Define the physical regions based on the disjoint regions they contain:
-    for (int physregindex = 0; physregindex < myphysicalregions.count(); physregindex++)
-    {
-        physicalregion* currentphysicalregion = myphysicalregions.getatindex(physregindex);
-        currentphysicalregion->definewithdisjointregions();
-    }
+        // Define the physical regions based on the disjoint regions they contain:
+        for (int physregindex = 0; physregindex < myphysicalregions.count(); physregindex++)
+        {
+            physicalregion* currentphysicalregion = myphysicalregions.getatindex(physregindex);
+            currentphysicalregion->definewithdisjointregions();
+        }
     
-    myelements.orient(orientrenum);
-    errorondisconnecteddisjointregion();
+        myelements.orient(orientrenum);
+        if (universe::iselementgroupingbyorientation && mydtracker->isdefined() == false)
+            myelements.reorderbytotalorientation();
+        errorondisconnecteddisjointregion();
+    
+    
+        if (iscachable)
+        {
+            key.processed = copy();
+            key.processed->mydtracker = NULL;
+            if (rawmeshshapecache.size() >= maxnumcachedshapemeshes)
+                rawmeshshapecache.erase(rawmeshshapecache.begin());
+            rawmeshshapecache.push_back(key);
+        }
+    }
     
     if (verbosity > 0)
         printcount();
@@ -544,13 +799,15 @@ void rawmesh::load(std::vector<shape> inputshapes, int globalgeometryskin, int n
         loadtime.print("Time to load the mesh: ");
 
     // Make sure axisymmetry is valid for this mesh:    
-    if (universe::isaxisymmetric && getmeshdimension() != 2)
+    if (universe::getsession()->isaxisymmetric && getmeshdimension() != 2)
     {
         std::cout << "Error in 'mesh' object: axisymmetry is only allowed for 2D problems" << std::endl;
         abort();
     }
     
     mynumber = 0;
+    // The mesh numbers restart from zero:
+    meshcache::clear();
     
     myptracker = std::shared_ptr<ptracker>(new ptracker(myelements.count()));
     myptracker->updatedisjointregions(&mydisjointregions);
@@ -592,35 +849,29 @@ std::vector<bool> rawmesh::isnodeinphysicalregion(int physreg)
     if (physreg < 0)
         output = std::vector<bool>(numberofnodes, true);
     else
-    {
-        output = std::vector<bool>(numberofnodes, false);
-    
-        // Get only the disjoint regions with highest dimension elements:
-        std::vector<int> selecteddisjregs = myphysicalregions.get(physreg)->getdisjointregions();
+        output = getnodebits(physreg).tovector();
     
-        for (int i = 0; i < selecteddisjregs.size(); i++)
-        {
-            int disjreg = selecteddisjregs[i];
-            int numelems = mydisjointregions.countelements(disjreg);
-            int elemtypenum = mydisjointregions.getelementtypenumber(disjreg);
-            int rangebegin = mydisjointregions.getrangebegin(disjreg);
-            int curvatureorder = myelements.getcurvatureorder();
-            
-            element myelem(elemtypenum, curvatureorder);
+    return output;
+}
 
-            for (int e = 0; e < numelems; e++)
-            {
-                for (int n = 0; n < myelem.countcurvednodes(); n++)
-                    output[myelements.getsubelement(0, elemtypenum, rangebegin+e, n)] = true;
-            }
-        }
-    }
+regionbits rawmesh::getnodebits(int physreg)
+{
+    regionbits output(mynodes.count(), false);
+
+    // Get only the disjoint regions with highest dimension elements:
+    std::vector<int> selecteddisjregs = myphysicalregions.get(physreg)->getdisjointregions();
+
+    for (int i = 0; i < selecteddisjregs.size(); i++)
+        output.unite(*(myelements.getsubelementbits(0, selecteddisjregs[i])));
     
     return output;
 }
 
 void rawmesh::move(int physreg, expression u)
 {
+    long long int oldstate = mystate;
+    mystate = universe::getnewstate();
+
     int meshdim = getmeshdimension();
     if (u.countcolumns() != 1 || u.countrows() < meshdim || u.countrows() > 3)
     {
@@ -700,13 +951,48 @@ void rawmesh::move(int physreg, expression u)
         while (myselector.next());
     }
     
-    myelements.cleancoordinatedependentcontainers();
-    
     mynodes.fixifaxisymmetric();
+    
+    // Only the elements touching a moved node need their containers updated:
+    myelements.cleancoordinatedependentcontainers(isnodemoved);
+    jacobiancache::keepunmoved(mynumber, oldstate, mystate, &myelements, isnodemoved);
+}
+
+void rawmesh::setcoordinates(std::vector<double>& coords)
+{
+    if (coords.size() != 3*mynodes.count())
+    {
+        std::cout << "Error in 'rawmesh' object: expected " << 3*mynodes.count() << " node coordinates but got " << coords.size() << std::endl;
+        abort();
+    }
+
+    long long int oldstate = mystate;
+    mystate = universe::getnewstate();
+
+    std::vector<double>* curcoords = mynodes.getcoordinates();
+
+    std::vector<bool> isnodemoved(mynodes.count(), false);
+    for (int n = 0; n < mynodes.count(); n++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            if (curcoords->at(3*n+c) != coords[3*n+c])
+            {
+                curcoords->at(3*n+c) = coords[3*n+c];
+                isnodemoved[n] = true;
+            }
+        }
+    }
+
+    myelements.cleancoordinatedependentcontainers(isnodemoved);
+    jacobiancache::keepunmoved(mynumber, oldstate, mystate, &myelements, isnodemoved);
 }
 
 void rawmesh::shift(int physreg, double x, double y, double z)
 {
+    long long int oldstate = mystate;
+    mystate = universe::getnewstate();
+
     std::vector<double>* coords = mynodes.getcoordinates();
 
     std::vector<bool> isinsidereg = isnodeinphysicalregion(physreg);
@@ -721,13 +1007,18 @@ void rawmesh::shift(int physreg, double x, double y, double z)
         }
     }
 
-    myelements.cleancoordinatedependentcontainers();
-    
     mynodes.fixifaxisymmetric();
+    
+    myelements.cleancoordinatedependentcontainers(isinsidereg);
+    jacobiancache::keepunmoved(mynumber, oldstate, mystate, &myelements, isinsidereg);
+    addrigidmotion(oldstate, isinsidereg, false);
 }
 
 void rawmesh::rotate(int physreg, double ax, double ay, double az)
 {
+    long long int oldstate = mystate;
+    mystate = universe::getnewstate();
+
     std::vector<double>* coords = mynodes.getcoordinates();
     
     std::vector<bool> isinsidereg = isnodeinphysicalregion(physreg);
@@ -745,13 +1036,73 @@ void rawmesh::rotate(int physreg, double ax, double ay, double az)
         }
     }
     
-    myelements.cleancoordinatedependentcontainers();
-    
     mynodes.fixifaxisymmetric();
+    
+    myelements.cleancoordinatedependentcontainers(isinsidereg);
+    jacobiancache::keepunmoved(mynumber, oldstate, mystate, &myelements, isinsidereg);
+    addrigidmotion(oldstate, isinsidereg, true);
+}
+
+void rawmesh::addrigidmotion(long long int oldstate, std::vector<bool>& isnodemoved, bool isrotation)
+{
+    // Any other coordinate modification since the last rigid motion breaks the chain:
+    if (myrigidstates.size() == 0 || myrigidstates.back() != oldstate)
+    {
+        myrigidstates = {oldstate};
+        myrigidmovednodes = {};
+        myrigidisrotation = {};
+    }
+    
+    myrigidstates.push_back(mystate);
+    myrigidmovednodes.push_back(regionbits(isnodemoved));
+    myrigidisrotation.push_back(isrotation);
+    
+    if (myrigidmovednodes.size() > maxnumrigidmotions)
+    {
+        myrigidstates.erase(myrigidstates.begin());
+        myrigidmovednodes.erase(myrigidmovednodes.begin());
+        myrigidisrotation.erase(myrigidisrotation.begin());
+    }
+}
+
+int rawmesh::getrigidmotion(long long int fromstate, int physreg)
+{
+    if (fromstate == mystate)
+        return 0;
+    if (myrigidstates.size() == 0 || myrigidstates.back() != mystate)
+        return -1;
+    
+    int first = -1;
+    for (int i = 0; i < myrigidstates.size()-1; i++)
+    {
+        if (myrigidstates[i] == fromstate)
+        {
+            first = i;
+            break;
+        }
+    }
+    if (first == -1)
+        return -1;
+    
+    regionbits regnodes = getnodebits(physreg);
+    
+    int output = 0;
+    for (int i = first; i < myrigidmovednodes.size(); i++)
+    {
+        if (regnodes.isinside(myrigidmovednodes[i]))
+            output = std::max(output, myrigidisrotation[i] ? 2 : 1);
+        else if (regnodes.istouching(myrigidmovednodes[i]))
+            return -1;
+    }
+    
+    return output;
 }
 
 void rawmesh::scale(int physreg, double x, double y, double z)
 {
+    long long int oldstate = mystate;
+    mystate = universe::getnewstate();
+
     std::vector<double>* coords = mynodes.getcoordinates();
 
     std::vector<bool> isinsidereg = isnodeinphysicalregion(physreg);
@@ -766,9 +1117,10 @@ void rawmesh::scale(int physreg, double x, double y, double z)
         }
     }
 
-    myelements.cleancoordinatedependentcontainers();
-    
     mynodes.fixifaxisymmetric();
+    
+    myelements.cleancoordinatedependentcontainers(isinsidereg);
+    jacobiancache::keepunmoved(mynumber, oldstate, mystate, &myelements, isinsidereg);
 }
 
 int rawmesh::getmeshdimension(void)
@@ -1287,10 +1639,8 @@ bool rawmesh::adapth(std::vector<std::vector<int>>& groupkeepsplit, int verbosit
         return false;
         
     wallclock clk;
-
-    int meshdim = getmeshdimension();
     
-    universe::myrawmesh = myhadaptedmesh;
+    universe::getsession()->myrawmesh = myhadaptedmesh;
         
     elements* elptr = universe::getrawmesh()->getelements();
     std::shared_ptr<dtracker> dtptr = universe::getrawmesh()->getdtracker();
@@ -1457,6 +1807,30 @@ bool rawmesh::adapth(std::vector<std::vector<int>>& groupkeepsplit, int verbosit
         
     newhtracker->adapt(vadapt);
     
+    makehadaptedmesh(newhtracker, clk, verbosity);
+    
+    return true;
+}
+
+void rawmesh::restorehadaptation(std::vector<bool> tree, int maxdepth, int numleaves, int verbosity)
+{
+    wallclock clk;
+    
+    universe::getsession()->myrawmesh = myhadaptedmesh;
+
+    std::shared_ptr<htracker> newhtracker(new htracker);
+    *newhtracker = *(myhadaptedmesh->myhtracker);
+    newhtracker->settree(tree, maxdepth, numleaves);
+    
+    makehadaptedmesh(newhtracker, clk, verbosity);
+}
+
+void rawmesh::makehadaptedmesh(std::shared_ptr<htracker> newhtracker, wallclock& clk, int verbosity)
+{
+    int meshdim = getmeshdimension();
+    
+    std::shared_ptr<dtracker> dtptr = universe::getrawmesh()->getdtracker();
+    
     
     ///// Get the adapted element coordinates 'ac' and add to the mesh containers:
     
@@ -1675,10 +2049,7 @@ bool rawmesh::adapth(std::vector<std::vector<int>>& groupkeepsplit, int verbosit
     
     
     ///// Send mesh to universe:
-    universe::myrawmesh = myhadaptedmesh;
-    
-    
-    return true;
+    universe::getsession()->myrawmesh = myhadaptedmesh;
 }
 
 void rawmesh::setadaptivity(expression criterion, int lownumsplits, int highnumsplits, double critrange)
@@ -1874,3 +2245,24 @@ std::shared_ptr<rawmesh> rawmesh::getoriginalmeshpointer(void)
     return myhtracker->getoriginalmesh();
 }
 
+
+memoryusage rawmesh::getmemoryusage(void)
+{
+    memoryusage output;
+    
+    output.add("nodes: ", mynodes.getmemoryusage());
+    output.add("elements: ", myelements.getmemoryusage());
+    
+    long long int physregbytes = 0;
+    for (int i = 0; i < myphysicalregions.count(); i++)
+        physregbytes += memoryusage::countbytes(*(myphysicalregions.getatindex(i)->getelementlist()));
+    output.add("physical regions: element lists", physregbytes);
+    
+    // The tracker can be shared with the h-adapted mesh:
+    if (myhtracker != NULL && (myhadaptedmesh == NULL || myhadaptedmesh->myhtracker != myhtracker))
+        output.add("h-adaptivity: ", myhtracker->getmemoryusage());
+    if (myhadaptedmesh != NULL)
+        output.add("h-adapted mesh: ", myhadaptedmesh->getmemoryusage());
+    
+    return output;
+}
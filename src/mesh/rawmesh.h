@@ -30,6 +30,11 @@
 #include "htracker.h"
 #include "rawfield.h"
 #include "dtracker.h"
+#include "meshpartitioner.h"
+#include "slmpi.h"
+#include "slminterface.h"
+#include "memoryusage.h"
+#include "profiler.h"
 
 class dtracker;
 class htracker;
@@ -52,6 +57,19 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         
         int mynumber = 0;
         
+        // State of the last modification of the node coordinates:
+        long long int mystate = 0;
+        
+        // The last rigid motions (shift or rotate) without any other coordinate modification in between.
+        // Motion i moved the nodes in 'myrigidmovednodes[i]' from state 'myrigidstates[i]' to 'myrigidstates[i+1]':
+        std::vector<long long int> myrigidstates = {};
+        std::vector<regionbits> myrigidmovednodes = {};
+        std::vector<bool> myrigidisrotation = {};
+        // Maximum number of rigid motions kept:
+        int maxnumrigidmotions = 16;
+        
+        void addrigidmotion(long long int oldstate, std::vector<bool>& isnodemoved, bool isrotation);
+        
         // For domain decomposition:
         std::shared_ptr<dtracker> mydtracker = NULL;
         
@@ -65,8 +83,20 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         // For the h-adapted mesh:
         std::shared_ptr<htracker> myhtracker = NULL;
         
+        // Build the adapted mesh of the (already adapted) htracker and send it to the universe:
+        void makehadaptedmesh(std::shared_ptr<htracker> newhtracker, wallclock& clk, int verbosity);
+        
+        // Process the raw mesh read. The DDM connectivity is discovered if not provided:
+        void process(int globalgeometryskin, int numoverlaplayers, bool isconnectivityprovided, std::vector<int> neighbours, std::vector<int> nooverlapinterfaces, int verbosity);
+        // Load a mesh already processed from a native .slm file (no processing is needed):
+        void loadprocessed(std::string source, int globalgeometryskin, int numoverlaplayers, int verbosity);
+        
     public:
         
+        // Number of meshes loaded from shapes that are kept so that loading identical shapes again (e.g. in a
+        // parametric loop) reuses their processed mesh. Meshes with splits, region definitions or DDM are not kept:
+        static int maxnumcachedshapemeshes;
+        
         // 'readfromfile' hands over to the function reading the format of the mesh file.
         void readfromfile(std::string tool, std::string source);
         // 'writetofile' hands over to the function writing the format of the mesh file.
@@ -89,6 +119,8 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         std::shared_ptr<ptracker> getptracker(void);
         std::shared_ptr<htracker> gethtracker(void);
         int getmeshnumber(void) { return mynumber; };
+        // State of the last modification of the node coordinates:
+        long long int getstate(void) { return mystate; };
         
         // Get a full copy of this rawmesh:
         std::shared_ptr<rawmesh> copy(void);
@@ -99,6 +131,9 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
 
         // Load from file name:
         void load(std::string name, int globalgeometryskin, int numoverlaplayers, int verbosity);   
+        // Load from file name on rank 0 only and send to every rank its part of the partitioned mesh.
+        // The cells in the weighted physical regions count with their weight in the partition balance:
+        void allload(std::string name, int globalgeometryskin, int numoverlaplayers, std::vector<int> weightedregions, std::vector<double> regionweights, int verbosity);
         // Load from multiple files:
         void load(bool mergeduplicates, std::vector<std::string> meshfiles, int verbosity);
         // Load from shape vector:
@@ -112,9 +147,13 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         
         // Get a bool vector telling if the nodes are in a physical region:
         std::vector<bool> isnodeinphysicalregion(int physreg);
+        // Same as a bitset (curvature nodes included):
+        regionbits getnodebits(int physreg);
         
         // Move the mesh in the x, y and z direction by a value given in the expression.
         void move(int physreg, expression u);
+        // Replace all node coordinates (the geometric caches of unmoved elements are kept):
+        void setcoordinates(std::vector<double>& coords);
         // 'shift' translates the mesh in the 'x', 'y' and 'z' direction.
         void shift(int physreg, double x, double y, double z);
         // 'rotate' rotates the mesh by ax, ay and az degrees around the x, y and z axis respectively.
@@ -122,6 +161,11 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         // 'scale' scales the mesh in the 'x', 'y' and 'z' direction.
         void scale(int physreg, double x, double y, double z);
         
+        // Tell how the nodes of a physical region were moved since mesh state 'fromstate': -1 if the mesh was not only
+        // moved by shifts and rotations or if the region was split by a motion, 0 if the region was not moved, 1 if it
+        // was only shifted as a whole and 2 if it was also rotated as a whole.
+        int getrigidmotion(long long int fromstate, int physreg);
+        
         // 'getmeshdimension' gives n for a mesh whose highest element dimension is n.
         int getmeshdimension(void);
         
@@ -149,6 +193,8 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         
         // For h-adaptivity:
         bool adapth(std::vector<std::vector<int>>& groupkeepsplit, int verbosity);
+        // Rebuild the h-adapted mesh from a refinement tree of this original mesh (to restore a saved adaptation state):
+        void restorehadaptation(std::vector<bool> tree, int maxdepth, int numleaves, int verbosity);
         void setadaptivity(expression criterion, int lownumsplits, int highnumsplits, double critrange); // critrange -1 for automatic choice
 
         // Guarantee same cell ordering between inner overlap and neighbour outer overlap:
@@ -168,6 +214,9 @@ class rawmesh : public std::enable_shared_from_this<rawmesh>
         
         std::shared_ptr<rawmesh> gethadaptedpointer(void);
         std::shared_ptr<rawmesh> getoriginalmeshpointer(void);
+        
+        // Bytes used by the mesh containers (including the h-adapted mesh if any):
+        memoryusage getmemoryusage(void);
 };
 
 
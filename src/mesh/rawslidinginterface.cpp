@@ -0,0 +1,171 @@
+#include "rawslidinginterface.h"
+#include "universe.h"
+#include "disjointregionselector.h"
+
+
+rawslidinginterface::rawslidinginterface(int physreg, std::vector<double> rotcent)
+{
+    std::shared_ptr<rawmesh> rm = universe::getrawmesh();
+
+    if (rotcent.size() != 3)
+    {
+        std::cout << "Error in 'slidinginterface' object: expected a vector of length 3 for the rotation center" << std::endl;
+        abort();
+    }
+    if (rm->getmeshdimension() != 2 || rm->getphysicalregions()->get(physreg)->getelementdimension() != 1)
+    {
+        std::cout << "Error in 'slidinginterface' object: expected a line region in a 2D mesh" << std::endl;
+        abort();
+    }
+    if (rm->getelements()->getcurvatureorder() != 1)
+    {
+        std::cout << "Error in 'slidinginterface' object: expected a mesh with straight elements (curvature order 1)" << std::endl;
+        abort();
+    }
+
+    myphysreg = physreg;
+    myrotcent = rotcent;
+
+    disjointregions* mydisjointregions = rm->getdisjointregions();
+    elements* myelements = rm->getelements();
+    std::vector<double>* nodecoords = rm->getnodes()->getcoordinates();
+
+    std::vector<int> disjregs = rm->getphysicalregions()->get(physreg)->getdisjointregions();
+
+    std::vector<double> startangles, endangles, coords;
+    std::vector<int> dregs, elems;
+    for (int d = 0; d < disjregs.size(); d++)
+    {
+        if (mydisjointregions->getelementtypenumber(disjregs[d]) != 1)
+            continue;
+
+        for (int e = mydisjointregions->getrangebegin(disjregs[d]); e <= mydisjointregions->getrangeend(disjregs[d]); e++)
+        {
+            int na = myelements->getsubelement(0, 1, e, 0), nb = myelements->getsubelement(0, 1, e, 1);
+            double ax = nodecoords->at(3*na+0)-rotcent[0], ay = nodecoords->at(3*na+1)-rotcent[1];
+            double bx = nodecoords->at(3*nb+0)-rotcent[0], by = nodecoords->at(3*nb+1)-rotcent[1];
+
+            double anga = std::atan2(ay, ax), angb = std::atan2(by, bx);
+            if (anga < 0) anga += 2.0*M_PI;
+            if (angb < 0) angb += 2.0*M_PI;
+
+            double angmin = std::min(anga, angb), angmax = std::max(anga, angb);
+
+            // An element spanning angle 0 is split in two:
+            if (angmax-angmin > M_PI)
+            {
+                startangles.insert(startangles.end(), {angmax, 0.0});
+                endangles.insert(endangles.end(), {2.0*M_PI, angmin});
+                dregs.insert(dregs.end(), {disjregs[d], disjregs[d]});
+                elems.insert(elems.end(), {e, e});
+                coords.insert(coords.end(), {ax,ay,bx,by, ax,ay,bx,by});
+            }
+            else
+            {
+                startangles.push_back(angmin);
+                endangles.push_back(angmax);
+                dregs.push_back(disjregs[d]);
+                elems.push_back(e);
+                coords.insert(coords.end(), {ax,ay,bx,by});
+            }
+        }
+    }
+
+    // Sort the spans by start angle:
+    std::vector<int> reorderingvector(startangles.size());
+    std::iota(reorderingvector.begin(), reorderingvector.end(), 0);
+    std::sort(reorderingvector.begin(), reorderingvector.end(), [&](int a, int b){ return startangles[a] < startangles[b]; });
+
+    int numspans = reorderingvector.size();
+    mystartangles.resize(numspans); myendangles.resize(numspans); mydisjregs.resize(numspans); myelems.resize(numspans); mynodecoords.resize(4*numspans);
+    for (int i = 0; i < numspans; i++)
+    {
+        int r = reorderingvector[i];
+
+        mystartangles[i] = startangles[r];
+        myendangles[i] = endangles[r];
+        mydisjregs[i] = dregs[r];
+        myelems[i] = elems[r];
+        for (int j = 0; j < 4; j++)
+            mynodecoords[4*i+j] = coords[4*r+j];
+    }
+}
+
+void rawslidinginterface::setrotation(double angz)
+{
+    myangle = angz*M_PI/180.0;
+}
+
+double rawslidinginterface::getrotation(void)
+{
+    return myangle*180.0/M_PI;
+}
+
+int rawslidinginterface::findspan(double angle)
+{
+    int pos = std::upper_bound(mystartangles.begin(), mystartangles.end(), angle) - mystartangles.begin() - 1;
+
+    // The neighbours are checked to be robust to round-off at the element boundaries:
+    for (int i = pos; i <= pos+1; i++)
+    {
+        if (i >= 0 && i < mystartangles.size() && angle >= mystartangles[i]-angletolerance && angle <= myendangles[i]+angletolerance)
+            return i;
+    }
+    if (pos-1 >= 0 && angle >= mystartangles[pos-1]-angletolerance && angle <= myendangles[pos-1]+angletolerance)
+        return pos-1;
+
+    return -1;
+}
+
+void rawslidinginterface::search(std::vector<double>& coords, std::vector<int> inputdisjregs, std::vector<int>& elems, std::vector<double>& kietaphis)
+{
+    int numcoords = coords.size()/3;
+
+    elems = std::vector<int>(numcoords, -1);
+    kietaphis = std::vector<double>(3*numcoords, 0.0);
+
+    std::vector<bool> isindisjregs(universe::getrawmesh()->getdisjointregions()->count(), false);
+    for (int i = 0; i < inputdisjregs.size(); i++)
+        isindisjregs[inputdisjregs[i]] = true;
+
+    for (int c = 0; c < numcoords; c++)
+    {
+        double x = coords[3*c+0]-myrotcent[0], y = coords[3*c+1]-myrotcent[1];
+
+        // Angle in the unrotated region:
+        double angle = std::fmod(std::atan2(y, x) - myangle, 2.0*M_PI);
+        if (angle < 0)
+            angle += 2.0*M_PI;
+
+        int span = findspan(angle);
+        if (span == -1 || not(isindisjregs[mydisjregs[span]]))
+            continue;
+
+        // Intersect the line from the center at that angle with the element:
+        double dx = std::cos(angle), dy = std::sin(angle);
+        double ax = mynodecoords[4*span+0], ay = mynodecoords[4*span+1], bx = mynodecoords[4*span+2], by = mynodecoords[4*span+3];
+
+        double denom = (bx-ax)*dy - (by-ay)*dx;
+        double t = 0.0;
+        if (std::abs(denom) > 0)
+            t = -(ax*dy - ay*dx)/denom;
+        t = std::min(1.0, std::max(0.0, t));
+
+        elems[c] = myelems[span];
+        kietaphis[3*c+0] = 2.0*t-1.0;
+    }
+}
+
+void rawslidinginterface::search(std::vector<double>& coords, std::vector<std::vector<int>>& foundelems, std::vector<std::vector<double>>& foundkietaphis)
+{
+    std::vector<int> disjregs = ((universe::getrawmesh()->getphysicalregions())->get(myphysreg))->getdisjointregions();
+
+    // Same grouping as in 'expression::interpolate':
+    disjointregionselector mydisjregselector(disjregs, {});
+
+    foundelems = std::vector<std::vector<int>>(mydisjregselector.countgroups());
+    foundkietaphis = std::vector<std::vector<double>>(mydisjregselector.countgroups());
+
+    for (int i = 0; i < mydisjregselector.countgroups(); i++)
+        search(coords, mydisjregselector.getgroup(i), foundelems[i], foundkietaphis[i]);
+}
@@ -0,0 +1,63 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object replaces the point search on a 2D line region that only rotates rigidly around the z axis
+// (e.g. the airgap boundary of a rotor). The angular span of every element around the rotation center
+// is computed once at creation and sorted so that a coordinate is located in O(log n) by its angle.
+// Since the rotation is rigid the reference coordinate in the element is obtained analytically from the
+// unrotated element, whatever the rotation angle. The coordinates are radially projected on the region.
+
+
+#ifndef RAWSLIDINGINTERFACE_H
+#define RAWSLIDINGINTERFACE_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+class rawslidinginterface
+{
+    private:
+
+        int myphysreg = -1;
+        std::vector<double> myrotcent = {0,0,0};
+
+        // Rotation of the region (in radians) since the object creation:
+        double myangle = 0.0;
+
+        // One entry per angular span, sorted by increasing start angle (in [0,2pi]). Elements spanning
+        // angle 0 appear twice. The node coordinates {ax,ay,bx,by} are relative to the rotation center:
+        std::vector<double> mystartangles = {};
+        std::vector<double> myendangles = {};
+        std::vector<int> mydisjregs = {};
+        std::vector<int> myelems = {};
+        std::vector<double> mynodecoords = {};
+
+        // Angular tolerance at the element boundaries:
+        double angletolerance = 1e-10;
+
+        // Return the span holding the unrotated angle (-1 if none):
+        int findspan(double angle);
+
+    public:
+
+        rawslidinginterface(int physreg, std::vector<double> rotcent);
+
+        int getphysicalregion(void) { return myphysreg; };
+
+        // Rotation angle in degrees around the z axis:
+        void setrotation(double angz);
+        double getrotation(void);
+
+        // Same output as 'referencecoordinategroup::search' for the coordinates in the disjoint regions:
+        void search(std::vector<double>& coords, std::vector<int> inputdisjregs, std::vector<int>& elems, std::vector<double>& kietaphis);
+        // Same output as the point search in 'expression::interpolate' on the whole physical region:
+        void search(std::vector<double>& coords, std::vector<std::vector<int>>& foundelems, std::vector<std::vector<double>>& foundkietaphis);
+
+};
+
+#endif
@@ -34,32 +34,39 @@ void rawspanningtree::growsubtree(int nodenumber, int subtreenumber)
 {
     isnodeintree[nodenumber] = true;
 
-    // Get the list of edges touching the node 'nodenumber':
-    std::vector<int> edgecandidates = myelements->getedgesonnode(nodenumber);    
-
-    // Loop on all edge candidates:
-    for (int i = 0; i < edgecandidates.size(); i++)
+    // Breadth-first growth (the nodes to process are in a queue):
+    std::vector<int> toprocess = {nodenumber};
+    for (int n = 0; n < toprocess.size(); n++)
     {
-        int currentedge = edgecandidates[i];
+        int curnode = toprocess[n];
+        
+        // Get the list of edges touching the current node:
+        std::vector<int> edgecandidates = myelements->getedgesonnode(curnode);
 
-        // Get the disjoint edge region number of the current candidate:
-        int currentder = myelements->getdisjointregion(1, currentedge);
+        // Loop on all edge candidates:
+        for (int i = 0; i < edgecandidates.size(); i++)
+        {
+            int currentedge = edgecandidates[i];
 
-        // Skip edge if not in the priority disjoint edge regions:
-        if (isprioritydisjointregion[currentder] == false)
-            continue;
+            // Get the disjoint edge region number of the current candidate:
+            int currentder = myelements->getdisjointregion(1, currentedge);
 
-        // Get the other node in the current edge:
-        int nextnode = myelements->getsubelement(0, 1, currentedge, 0);
-        if (nodenumber == nextnode)
-            nextnode = myelements->getsubelement(0, 1, currentedge, 1);
+            // Skip edge if not in the priority disjoint edge regions:
+            if (isprioritydisjointregion[currentder] == false)
+                continue;
 
-        // Add the edge to the tree if it does not create a loop:
-        if (isnodeintree[nextnode] == false)
-        {
-            isnodeintree[nextnode] = true;
-            insubtree[currentedge] = subtreenumber;
-            growsubtree(nextnode, subtreenumber);
+            // Get the other node in the current edge:
+            int nextnode = myelements->getsubelement(0, 1, currentedge, 0);
+            if (curnode == nextnode)
+                nextnode = myelements->getsubelement(0, 1, currentedge, 1);
+
+            // Add the edge to the tree if it does not create a loop:
+            if (isnodeintree[nextnode] == false)
+            {
+                isnodeintree[nextnode] = true;
+                insubtree[currentedge] = subtreenumber;
+                toprocess.push_back(nextnode);
+            }
         }
     }
 }
@@ -96,6 +103,18 @@ void rawspanningtree::connectsubtrees(void)
     }
 
 
+    // Subtree of every node (subtrees share no node):
+    subtreeofnode = std::vector<int>(myelements->count(0), -1);
+    for (int i = 0; i < insubtree.size(); i++)
+    {
+        if (insubtree[i] != -1)
+        {
+            subtreeofnode[myelements->getsubelement(0, 1, i, 0)] = insubtree[i];
+            subtreeofnode[myelements->getsubelement(0, 1, i, 1)] = insubtree[i];
+        }
+    }
+
+
     ///// Create the overall tree by connecting the subtrees:
 
     issubtreeintree = std::vector<bool>(numberofsubtrees,false);
@@ -113,72 +132,77 @@ void rawspanningtree::connectsubtrees(void)
     edgesinsubtree = {};
     issubtreeintree = {};
     isnodeintree = {};
+    subtreeofnode = {};
 
 }
 
 
-void rawspanningtree::growtree(int nodenumber)
+void rawspanningtree::addtotree(int nodenumber, std::vector<int>& toprocess)
 {
     isnodeintree[nodenumber] = true;
-
-    // Get the list of edges touching the node 'nodenumber':
-    std::vector<int> edgecandidates = myelements->getedgesonnode(nodenumber);    
-
-    // Add to the tree all not yet added subtrees on the edges candidates:
-    for (int i = 0; i < edgecandidates.size(); i++)
+    toprocess.push_back(nodenumber);
+    
+    // A subtree is added as a whole as soon as one of its nodes is reached (this cannot create a loop
+    // since none of its other nodes can already be in the tree):
+    int currentsubtree = subtreeofnode[nodenumber];
+    if (currentsubtree == -1 || issubtreeintree[currentsubtree])
+        return;
+    
+    issubtreeintree[currentsubtree] = true;
+    
+    for (int i = 0; i < edgesinsubtree[currentsubtree].size(); i++)
     {
-        int currentsubtree = insubtree[edgecandidates[i]];
-
-        // Add the subtree to the tree if not already added:
-        if (currentsubtree != -1 && issubtreeintree[currentsubtree] == false)
+        int currentedge = edgesinsubtree[currentsubtree][i];
+        
+        isedgeintree[currentedge] = true;
+        numberofedgesintree++;
+        
+        for (int j = 0; j < 2; j++)
         {
-            for (int i = 0; i < edgesinsubtree[currentsubtree].size(); i++)
+            int curnode = myelements->getsubelement(0, 1, currentedge, j);
+            if (isnodeintree[curnode] == false)
             {
-                int node1 = myelements->getsubelement(0, 1, edgesinsubtree[currentsubtree][i], 0);
-                int node2 = myelements->getsubelement(0, 1, edgesinsubtree[currentsubtree][i], 1);
-
-                isnodeintree[node1] = true;
-                isnodeintree[node2] = true;
-
-                isedgeintree[edgesinsubtree[currentsubtree][i]] = true;
-                numberofedgesintree++;
-            }
-
-            issubtreeintree[currentsubtree] = true;
-
-            // Grow tree from every added edge:
-            for (int i = 0; i < edgesinsubtree[currentsubtree].size(); i++)
-            {
-                int node1 = myelements->getsubelement(0, 1, edgesinsubtree[currentsubtree][i], 0);
-                int node2 = myelements->getsubelement(0, 1, edgesinsubtree[currentsubtree][i], 1);
-
-                growtree(node1);
-                growtree(node2);
+                isnodeintree[curnode] = true;
+                toprocess.push_back(curnode);
             }
         }
     }
+}
 
-    // Add to the tree all edges that do not create a loop:
-    for (int i = 0; i < edgecandidates.size(); i++)
+void rawspanningtree::growtree(int nodenumber)
+{
+    // Breadth-first growth (the nodes to process are in a queue):
+    std::vector<int> toprocess = {};
+    addtotree(nodenumber, toprocess);
+    
+    for (int n = 0; n < toprocess.size(); n++)
     {
-        int currentedge = edgecandidates[i];
+        int curnode = toprocess[n];
+        
+        // Get the list of edges touching the current node:
+        std::vector<int> edgecandidates = myelements->getedgesonnode(curnode);
 
-        if (isedgeintree[currentedge])
-            continue;
+        // Add to the tree all edges that do not create a loop:
+        for (int i = 0; i < edgecandidates.size(); i++)
+        {
+            int currentedge = edgecandidates[i];
 
-        // Get the other node in the current edge:
-        int nextnode = myelements->getsubelement(0, 1, currentedge, 0);
-        if (nodenumber == nextnode)
-            nextnode = myelements->getsubelement(0, 1, currentedge, 1);
+            if (isedgeintree[currentedge])
+                continue;
 
-        // Add the edge to the tree if it does not create a loop:
-        if (isnodeintree[nextnode] == false)
-        {
-            isnodeintree[nextnode] = true;
-            isedgeintree[currentedge] = true;
-            numberofedgesintree++;
-            
-            growtree(nextnode);
+            // Get the other node in the current edge:
+            int nextnode = myelements->getsubelement(0, 1, currentedge, 0);
+            if (curnode == nextnode)
+                nextnode = myelements->getsubelement(0, 1, currentedge, 1);
+
+            // Add the edge to the tree if it does not create a loop:
+            if (isnodeintree[nextnode] == false)
+            {
+                isedgeintree[currentedge] = true;
+                numberofedgesintree++;
+                
+                addtotree(nextnode, toprocess);
+            }
         }
     }
 }
@@ -222,6 +246,7 @@ void rawspanningtree::synchronize(void)
     edgesinsubtree = {};
     issubtreeintree = {};
     isnodeintree = {};
+    subtreeofnode = {};
     
     grow();
     
@@ -304,7 +329,7 @@ void rawspanningtree::write(std::string filename)
     synchronize();
     
     nodes* mynodes = universe::getrawmesh()->getnodes();
-    std::vector<double>* nodecoords = mynodes->getcoordinates();
+    const std::vector<double>* nodecoords = mynodes->readcoordinates();
     
     densemat xcoords(numberofedgesintree,2), ycoords(numberofedgesintree,2), zcoords(numberofedgesintree,2);
 
@@ -41,6 +41,8 @@ class rawspanningtree
         std::vector<bool> issubtreeintree;
         // Entry i is true if node i is in tree:
         std::vector<bool> isnodeintree;
+        // Subtree number of every node (-1 if none):
+        std::vector<int> subtreeofnode;
         
         
         
@@ -51,13 +53,17 @@ class rawspanningtree
         // Grow the subtree that has edges only on the priority edge disjoint regions and 
         // starting at node 'nodenumber'. Give it subtree number 'subtreenumber'. 
         // This can only be called if at least one edge can be added to the subtree.
+        // The growth is breadth-first and non recursive.
         void growsubtree(int nodenumber, int subtreenumber);
         
         // Create the final tree by connecting all subtrees together:
         void connectsubtrees(void);
-        // Grow the tree starting at a given node.
+        // Grow the tree starting at a given node (breadth-first and non recursive).
         // The subtrees must have been defined before the call.
         void growtree(int nodenumber);
+        // Add a node reached by the tree and the whole subtree it belongs to (if not already added).
+        // The added nodes are appended to the nodes to process:
+        void addtotree(int nodenumber, std::vector<int>& toprocess);
         
         void grow(void);
         
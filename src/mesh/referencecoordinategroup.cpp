@@ -3,7 +3,7 @@
 
 referencecoordinategroup::referencecoordinategroup(std::vector<double>& coords)
 {
-    mycoordgroup = coordinategroup(coords);
+    mycoords = coords;
 }
 
 referencecoordinategroup::referencecoordinategroup(std::vector<int>& elems, std::vector<double>& refcoords)
@@ -14,17 +14,31 @@ referencecoordinategroup::referencecoordinategroup(std::vector<int>& elems, std:
 
 void referencecoordinategroup::evalat(std::vector<int> inputdisjregs)
 {
-    int numcoords = mycoordgroup.countcoordinates();
+    std::vector<int> elems;
+    std::vector<double> kietaphis;
     
-    std::vector<int> elems(numcoords,-1);
-    std::vector<int> coordnums(numcoords);
-    std::iota(coordnums.begin(), coordnums.end(), 0);
-    std::vector<double> kietaphis(3*numcoords,0.0);
+    search(inputdisjregs, elems, kietaphis);
+        
+    evalatfound(elems, kietaphis);  
+}
+
+void referencecoordinategroup::search(std::vector<int> inputdisjregs, std::vector<int>& elems, std::vector<double>& kietaphis)
+{
+    int numcoords = mycoords.size()/3;
+    
+    elems = std::vector<int>(numcoords,-1);
+    kietaphis = std::vector<double>(3*numcoords,0.0);
     
     for (int d = 0; d < inputdisjregs.size(); d++)
-        gentools::getreferencecoordinates(mycoordgroup, inputdisjregs[d], elems, kietaphis);
-        
-    evalat(elems, kietaphis, coordnums);  
+        gentools::getreferencecoordinates(mycoords, inputdisjregs[d], elems, kietaphis);
+}
+
+void referencecoordinategroup::evalatfound(std::vector<int> elems, std::vector<double> kietaphis)
+{
+    std::vector<int> coordnums(elems.size());
+    std::iota(coordnums.begin(), coordnums.end(), 0);
+    
+    evalat(elems, kietaphis, coordnums);
 }
 
 void referencecoordinategroup::evalat(int elemtypenum)
@@ -10,7 +10,6 @@
 #include <iostream>
 #include <vector>
 #include "gentools.h"
-#include "coordinategroup.h"
 
 class referencecoordinategroup
 {
@@ -19,7 +18,7 @@ class referencecoordinategroup
 
         double noisethreshold = 1e-10;
         
-        coordinategroup mycoordgroup;
+        std::vector<double> mycoords = {};
         std::vector<int> myinputelems = {};
         std::vector<double> myinputrefcoords = {};
         
@@ -45,6 +44,10 @@ class referencecoordinategroup
         
         // All disjoint regions should hold the same element type number:
         void evalat(std::vector<int> inputdisjregs);
+        // Find the element (-1 if not found) and the reference coordinates of every coordinate in the disjoint regions:
+        void search(std::vector<int> inputdisjregs, std::vector<int>& elems, std::vector<double>& kietaphis);
+        // Same as 'evalat(inputdisjregs)' but with the 'search' output provided:
+        void evalatfound(std::vector<int> elems, std::vector<double> kietaphis);
         void evalat(int elemtypenum);
         
         void evalat(std::vector<int>& elems, std::vector<double>& kietaphis, std::vector<int>& coordnums);
@@ -0,0 +1,127 @@
+#include "regionbits.h"
+#include <algorithm>
+
+
+regionbits::regionbits(int numbits, bool value)
+{
+    mynumbits = numbits;
+    mywords = std::vector<uint64_t>((numbits+63)/64, value ? ~(uint64_t)0 : 0);
+    
+    // Clear the unused bits of the last word:
+    if (value && numbits%64 != 0)
+        mywords.back() = ((uint64_t)1 << (numbits%64)) - 1;
+}
+
+regionbits::regionbits(const std::vector<bool>& values)
+{
+    mynumbits = values.size();
+    mywords = std::vector<uint64_t>((mynumbits+63)/64, 0);
+    
+    for (int i = 0; i < mynumbits; i++)
+    {
+        if (values[i])
+            set(i);
+    }
+}
+
+void regionbits::errorifsizemismatch(const regionbits& other) const
+{
+    if (mynumbits != other.mynumbits)
+    {
+        std::cout << "Error in 'regionbits' object: sizes do not match (" << mynumbits << " and " << other.mynumbits << ")" << std::endl;
+        abort();
+    }
+}
+
+int regionbits::count(void) const
+{
+    int num = 0;
+    for (int w = 0; w < mywords.size(); w++)
+        num += __builtin_popcountll(mywords[w]);
+    return num;
+}
+
+bool regionbits::isempty(void) const
+{
+    for (int w = 0; w < mywords.size(); w++)
+    {
+        if (mywords[w] != 0)
+            return false;
+    }
+    return true;
+}
+
+void regionbits::unite(const regionbits& other)
+{
+    errorifsizemismatch(other);
+    
+    for (int w = 0; w < mywords.size(); w++)
+        mywords[w] |= other.mywords[w];
+}
+
+void regionbits::intersect(const regionbits& other)
+{
+    errorifsizemismatch(other);
+    
+    for (int w = 0; w < mywords.size(); w++)
+        mywords[w] &= other.mywords[w];
+}
+
+void regionbits::subtract(const regionbits& other)
+{
+    errorifsizemismatch(other);
+    
+    for (int w = 0; w < mywords.size(); w++)
+        mywords[w] &= ~other.mywords[w];
+}
+
+bool regionbits::isinside(const regionbits& other) const
+{
+    for (int w = 0; w < mywords.size(); w++)
+    {
+        uint64_t otherword = (w < other.mywords.size()) ? other.mywords[w] : 0;
+        if ((mywords[w] & ~otherword) != 0)
+            return false;
+    }
+    return true;
+}
+
+bool regionbits::istouching(const regionbits& other) const
+{
+    int numwords = std::min(mywords.size(), other.mywords.size());
+    
+    for (int w = 0; w < numwords; w++)
+    {
+        if ((mywords[w] & other.mywords[w]) != 0)
+            return true;
+    }
+    return false;
+}
+
+std::vector<int> regionbits::getindexes(void) const
+{
+    std::vector<int> indexes(count());
+    
+    int index = 0;
+    for (int w = 0; w < mywords.size(); w++)
+    {
+        // Skip the empty words and jump from one set bit to the next:
+        uint64_t curword = mywords[w];
+        while (curword != 0)
+        {
+            indexes[index] = 64*w + __builtin_ctzll(curword);
+            curword &= curword-1;
+            index++;
+        }
+    }
+    
+    return indexes;
+}
+
+std::vector<bool> regionbits::tovector(void) const
+{
+    std::vector<bool> output(mynumbits);
+    for (int i = 0; i < mynumbits; i++)
+        output[i] = get(i);
+    return output;
+}
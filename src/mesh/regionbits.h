@@ -0,0 +1,68 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object is a set of indexes (e.g. nodes, edges or disjoint regions) stored as a bitset
+// packed in 64 bit words. Unions, intersections and inclusion tests process 64 indexes at once.
+
+#ifndef REGIONBITS_H
+#define REGIONBITS_H
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+class regionbits
+{
+
+    private:
+
+        int mynumbits = 0;
+        
+        // Bit i is bit i%64 of word i/64. The unused bits of the last word are always zero:
+        std::vector<uint64_t> mywords = {};
+        
+        void errorifsizemismatch(const regionbits& other) const;
+
+    public:
+        
+        regionbits(void) {};
+        regionbits(int numbits, bool value = false);
+        regionbits(const std::vector<bool>& values);
+        
+        int size(void) const { return mynumbits; };
+        
+        bool get(int index) const { return ((mywords[index/64] >> (index%64)) & 1); };
+        void set(int index) { mywords[index/64] |= ((uint64_t)1 << (index%64)); };
+        void reset(int index) { mywords[index/64] &= ~((uint64_t)1 << (index%64)); };
+        
+        // Number of indexes in the set:
+        int count(void) const;
+        bool isempty(void) const;
+        
+        // Add the indexes of 'other' (same size required):
+        void unite(const regionbits& other);
+        // Keep only the indexes also in 'other':
+        void intersect(const regionbits& other);
+        // Remove the indexes in 'other':
+        void subtract(const regionbits& other);
+        
+        // True if all indexes in this set are also in 'other' (sizes can differ for these two):
+        bool isinside(const regionbits& other) const;
+        // True if at least one index is in both sets:
+        bool istouching(const regionbits& other) const;
+        
+        bool operator==(const regionbits& other) const { return (mynumbits == other.mynumbits && mywords == other.mywords); };
+        
+        // All indexes in the set in increasing order:
+        std::vector<int> getindexes(void) const;
+        std::vector<bool> tovector(void) const;
+        
+        // Bytes used:
+        long long int getmemoryusage(void) const { return mywords.capacity()*sizeof(uint64_t); };
+
+};
+
+#endif
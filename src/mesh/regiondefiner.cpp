@@ -1,4 +1,6 @@
 #include "regiondefiner.h"
+#include "taskscheduler.h"
+#include "autotuning.h"
 
 
 void regiondefiner::defineskinregion(int regnum)
@@ -84,29 +86,17 @@ void regiondefiner::defineskinregion(int regnum)
     newphysreg->removeduplicatedelements();
 }
 
-void regiondefiner::defineboxregion(int regnum)
+void regiondefiner::selectinside(int newphysreg, int sourcephysreg, int selecteddim, std::vector<double> box, std::function<bool(double,double,double)> isinside)
 {
-    bool isnotall = (tobox[regnum] != -1);
-    
-    if (isnotall)
-        myphysicalregions->errorundefined({tobox[regnum]});
+    bool isnotall = (sourcephysreg != -1);
 
-    std::vector<double>* nodecoords = mynodes->getcoordinates();
-
-    std::vector<double> boxlimit = boxlimits[regnum];
-    
-    // Make the box limit slightly larger to remove the roundoff noise issues:
-    boxlimit[0] -= noisethreshold; boxlimit[2] -= noisethreshold; boxlimit[4] -= noisethreshold;
-    boxlimit[1] += noisethreshold; boxlimit[3] += noisethreshold; boxlimit[5] += noisethreshold;
+    const std::vector<double>* nodecoords = mynodes->readcoordinates();
 
-    physicalregion* newphysreg = myphysicalregions->get(boxed[regnum]);
-    physicalregion* curphysreg;
-    if (isnotall)
-        curphysreg = myphysicalregions->get(tobox[regnum]);
+    physicalregion* newpr = myphysicalregions->get(newphysreg);
 
     std::vector<std::vector<int>>* curelems;
     if (isnotall)
-        curelems = curphysreg->getelementlist();
+        curelems = myphysicalregions->get(sourcephysreg)->getelementlist();
 
     // Loop on all element types:
     for (int elemtype = 0; elemtype <= 7; elemtype++)
@@ -122,53 +112,107 @@ void regiondefiner::defineboxregion(int regnum)
 
         element myelement(elemtype);
 
-        // Loop on all subelement types:
+        // Get the subelement types of the requested dimension:
+        std::vector<int> subelemtypes = {}, numnodes = {}, numsubtypeelems = {};
         for (int subelemtype = 0; subelemtype <= 7; subelemtype++)
         {
-            // Skip all subelements that are not of the requested dimension:
             element mysubelement(subelemtype);
-            int numnodes = mysubelement.countcurvednodes();
-            int numsubtypeelems = myelement.counttype(subelemtype);
-
-            if (mysubelement.getelementdimension() != boxelemdims[regnum] || numsubtypeelems == 0)
-                continue;
-
-            // Loop on all elements:
-            for (int elem = 0; elem < numelems; elem++)
+            if (mysubelement.getelementdimension() == selecteddim && myelement.counttype(subelemtype) > 0)
             {
-                int curelem;
-                if (isnotall)
-                    curelem = curelems->at(elemtype)[elem];
-                else
-                    curelem = elem;
+                subelemtypes.push_back(subelemtype);
+                numnodes.push_back(mysubelement.countcurvednodes());
+                numsubtypeelems.push_back(myelement.counttype(subelemtype));
+            }
+        }
+        if (subelemtypes.size() == 0)
+            continue;
 
-                for (int subelem = 0; subelem < numsubtypeelems; subelem++)
+        // Only the elements whose box intersects the selection box can have a subelement with all nodes inside:
+        std::vector<int> candidates;
+        myelements->gettree(elemtype)->findinbox(box, candidates);
+        if (isnotall)
+        {
+            // The element list is sorted:
+            std::vector<int>& sourceelems = curelems->at(elemtype);
+            int index = 0;
+            for (int i = 0; i < candidates.size(); i++)
+            {
+                if (std::binary_search(sourceelems.begin(), sourceelems.end(), candidates[i]))
                 {
-                    int cursubelem = myelements->getsubelement(subelemtype, elemtype, curelem, subelem);
+                    candidates[index] = candidates[i];
+                    index++;
+                }
+            }
+            candidates.resize(index);
+        }
+        int numcandidates = candidates.size();
+        if (numcandidates == 0)
+            continue;
 
-                    // Check if the coordinates of all nodes in the subelement are within the box limits:
-                    bool isinlimits = true;
-                    for (int node = 0; node < numnodes; node++)
-                    {
-                        int curnode = myelements->getsubelement(0, subelemtype, cursubelem, node);
+        // Every thread checks a block of candidate elements:
+        int numthreadstouse = autotuning::getnumthreadsforitems(numcandidates);
+        std::vector<std::vector<std::vector<int>>> selected(numthreadstouse, std::vector<std::vector<int>>(subelemtypes.size()));
 
-                        double curnodex = nodecoords->at(3*curnode+0);
-                        double curnodey = nodecoords->at(3*curnode+1);
-                        double curnodez = nodecoords->at(3*curnode+2);
+        taskscheduler::runperthread(numthreadstouse, [&](int t)
+        {
+            int first = (long long int)t*numcandidates/numthreadstouse;
+            int last = (long long int)(t+1)*numcandidates/numthreadstouse;
+
+            for (int i = first; i < last; i++)
+            {
+                for (int s = 0; s < subelemtypes.size(); s++)
+                {
+                    for (int subelem = 0; subelem < numsubtypeelems[s]; subelem++)
+                    {
+                        int cursubelem = myelements->getsubelement(subelemtypes[s], elemtype, candidates[i], subelem);
 
-                        if (curnodex < boxlimit[0] || curnodex > boxlimit[1] || curnodey < boxlimit[2] || curnodey > boxlimit[3] || curnodez < boxlimit[4] || curnodez > boxlimit[5])
+                        // Check if the coordinates of all nodes in the subelement are inside:
+                        bool isinlimits = true;
+                        for (int node = 0; node < numnodes[s]; node++)
                         {
-                            isinlimits = false;
-                            break;
+                            int curnode = myelements->getsubelement(0, subelemtypes[s], cursubelem, node);
+                            if (not(isinside(nodecoords->at(3*curnode+0), nodecoords->at(3*curnode+1), nodecoords->at(3*curnode+2))))
+                            {
+                                isinlimits = false;
+                                break;
+                            }
                         }
+                        if (isinlimits)
+                            selected[t][s].push_back(cursubelem);
                     }
-                    if (isinlimits)
-                        newphysreg->addelement(subelemtype, cursubelem);
                 }
             }
+        });
+
+        for (int t = 0; t < numthreadstouse; t++)
+        {
+            for (int s = 0; s < subelemtypes.size(); s++)
+            {
+                for (int e = 0; e < selected[t][s].size(); e++)
+                    newpr->addelement(subelemtypes[s], selected[t][s][e]);
+            }
         }
     }
-    newphysreg->removeduplicatedelements();
+    newpr->removeduplicatedelements();
+}
+
+void regiondefiner::defineboxregion(int regnum)
+{
+    bool isnotall = (tobox[regnum] != -1);
+    
+    if (isnotall)
+        myphysicalregions->errorundefined({tobox[regnum]});
+
+    std::vector<double> boxlimit = boxlimits[regnum];
+    
+    // Make the box limit slightly larger to remove the roundoff noise issues:
+    boxlimit[0] -= noisethreshold; boxlimit[2] -= noisethreshold; boxlimit[4] -= noisethreshold;
+    boxlimit[1] += noisethreshold; boxlimit[3] += noisethreshold; boxlimit[5] += noisethreshold;
+
+    selectinside(boxed[regnum], tobox[regnum], boxelemdims[regnum], boxlimit, [&](double x, double y, double z)
+    {
+        return (x >= boxlimit[0] && x <= boxlimit[1] && y >= boxlimit[2] && y <= boxlimit[3] && z >= boxlimit[4] && z <= boxlimit[5]);
+    });
 }
 
 void regiondefiner::definesphereregion(int regnum)
@@ -178,84 +222,18 @@ void regiondefiner::definesphereregion(int regnum)
     if (isnotall)
         myphysicalregions->errorundefined({tosphere[regnum]});
 
-    std::vector<double>* nodecoords = mynodes->getcoordinates();
-
     std::vector<double> spherecenter = spherecenters[regnum];
     double sphereradius = sphereradii[regnum];
     
     // Make the sphere radius slightly larger to remove the roundoff noise issues:
     sphereradius += noisethreshold;
 
-    physicalregion* newphysreg = myphysicalregions->get(sphered[regnum]);
-    physicalregion* curphysreg;
-    if (isnotall)
-        curphysreg = myphysicalregions->get(tosphere[regnum]);
+    std::vector<double> boundingbox = {spherecenter[0]-sphereradius, spherecenter[0]+sphereradius, spherecenter[1]-sphereradius, spherecenter[1]+sphereradius, spherecenter[2]-sphereradius, spherecenter[2]+sphereradius};
 
-    std::vector<std::vector<int>>* curelems;
-    if (isnotall)
-        curelems = curphysreg->getelementlist();
-
-    // Loop on all element types:
-    for (int elemtype = 0; elemtype <= 7; elemtype++)
+    selectinside(sphered[regnum], tosphere[regnum], sphereelemdims[regnum], boundingbox, [&](double x, double y, double z)
     {
-        int numelems;
-        if (isnotall)
-            numelems = curelems->at(elemtype).size();
-        else
-            numelems = myelements->countcells(elemtype);
-        
-        if (numelems == 0)
-            continue;
-
-        element myelement(elemtype);
-
-        // Loop on all subelement types:
-        for (int subelemtype = 0; subelemtype <= 7; subelemtype++)
-        {
-            // Skip all subelements that are not of the requested dimension:
-            element mysubelement(subelemtype);
-            int numnodes = mysubelement.countcurvednodes();
-            int numsubtypeelems = myelement.counttype(subelemtype);
-
-            if (mysubelement.getelementdimension() != sphereelemdims[regnum] || numsubtypeelems == 0)
-                continue;
-
-            // Loop on all elements:
-            for (int elem = 0; elem < numelems; elem++)
-            {
-                int curelem;
-                if (isnotall)
-                    curelem = curelems->at(elemtype)[elem];
-                else
-                    curelem = elem;
-
-                for (int subelem = 0; subelem < numsubtypeelems; subelem++)
-                {
-                    int cursubelem = myelements->getsubelement(subelemtype, elemtype, curelem, subelem);
-
-                    // Check if the coordinates of all nodes in the subelement are within the sphere limits:
-                    bool isinlimits = true;
-                    for (int node = 0; node < numnodes; node++)
-                    {
-                        int curnode = myelements->getsubelement(0, subelemtype, cursubelem, node);
-
-                        double curnodex = nodecoords->at(3*curnode+0);
-                        double curnodey = nodecoords->at(3*curnode+1);
-                        double curnodez = nodecoords->at(3*curnode+2);
-
-                        if (std::sqrt(std::pow(spherecenter[0]-curnodex,2) + std::pow(spherecenter[1]-curnodey,2) + std::pow(spherecenter[2]-curnodez,2)) > sphereradius)
-                        {
-                            isinlimits = false;
-                            break;
-                        }
-                    }
-                    if (isinlimits)
-                        newphysreg->addelement(subelemtype, cursubelem);
-                }
-            }
-        }
-    }
-    newphysreg->removeduplicatedelements();
+        return (std::sqrt(std::pow(spherecenter[0]-x,2) + std::pow(spherecenter[1]-y,2) + std::pow(spherecenter[2]-z,2)) <= sphereradius);
+    });
 }
 
 void regiondefiner::defineexclusionregion(int regnum)
@@ -305,14 +283,14 @@ void regiondefiner::defineexclusionregion(int regnum)
             continue;
 
         int numelemsintype = myelements->count(i);
-        std::vector<bool> inexcluded(numelemsintype, false);
+        regionbits inexcluded(numelemsintype, false);
         // First add all elements from which to exclude:
         for (int e = 0; e < numelems; e++)
         {
             if (isnotall)
-                inexcluded[curelems->at(i)[e]] = true;
+                inexcluded.set(curelems->at(i)[e]);
             else
-                inexcluded[e] = true;
+                inexcluded.set(e);
         }
 
         // Now remove the elements to exclude:
@@ -322,15 +300,13 @@ void regiondefiner::defineexclusionregion(int regnum)
             std::vector<int>* curelemtypetoexclude = &(curtoexclude->getelementlist()->at(i));
 
             for (int e = 0; e < curelemtypetoexclude->size(); e++)
-                inexcluded[curelemtypetoexclude->at(e)] = false;
+                inexcluded.reset(curelemtypetoexclude->at(e));
         }
 
-        // All trues must be added:
-        for (int j = 0; j < inexcluded.size(); j++)
-        {
-            if (inexcluded[j])
-                newphysreg->addelement(i, j);
-        }
+        // All remaining elements must be added:
+        std::vector<int> remaining = inexcluded.getindexes();
+        for (int j = 0; j < remaining.size(); j++)
+            newphysreg->addelement(i, remaining[j]);
     }
     newphysreg->removeduplicatedelements();
 }
@@ -353,6 +329,7 @@ void regiondefiner::definelayerregion(int regnum)
     
     // Tag the nodes that are in the growth region:
     std::vector<bool> isnodeingrowthregion(mynodes->count(), false);
+    std::vector<int> growthnodes = {};
     std::vector<std::vector<int>>* elemsingr = growthphysreg->getelementlist();
     // Loop on all element types:
     for (int i = 0; i <= 7; i++)
@@ -369,18 +346,71 @@ void regiondefiner::definelayerregion(int regnum)
         {
             int curelem = elemsingr->at(i)[j];
             for (int n = 0; n < nn; n++)
-                isnodeingrowthregion[myelements->getsubelement(0, i, curelem, n)] = true;
+            {
+                int curnode = myelements->getsubelement(0, i, curelem, n);
+                if (not(isnodeingrowthregion[curnode]))
+                    growthnodes.push_back(curnode);
+                isnodeingrowthregion[curnode] = true;
+            }
         }
     }
     
-    std::vector<std::vector<bool>> inlayer(8, std::vector<bool>(0)); // avoid duplicates
-    for (int i = 0; i <= 7; i++)
-        inlayer[i] = std::vector<bool>(myelements->count(i), false);
-
     std::vector<std::vector<int>>* curelems;
     if (isnotall)
         curelems = origphysreg->getelementlist();
     
+    // When selecting cells the layers are grown from the last added nodes with the node-to-cell adjacency:
+    int physregdim = myelements->getdimension();
+    if (isnotall)
+        physregdim = origphysreg->getelementdimension();
+    if (physregdim == myelements->getdimension())
+    {
+        std::vector<std::vector<bool>> inlayer(8, std::vector<bool>(0));
+        for (int i = 0; i <= 7; i++)
+            inlayer[i] = std::vector<bool>(myelements->countcells(i), false);
+        
+        for (int l = 0; l < nl; l++)
+        {
+            std::vector<int> newgrowthnodes = {};
+            
+            for (int j = 0; j < growthnodes.size(); j++)
+            {
+                std::vector<int> cellsonnode = myelements->getcellsontype(0, growthnodes[j]);
+                for (int c = 0; c < cellsonnode.size()/2; c++)
+                {
+                    int curtype = cellsonnode[2*c+0], curelem = cellsonnode[2*c+1];
+                    
+                    if (inlayer[curtype][curelem])
+                        continue;
+                    // The element list is sorted:
+                    if (isnotall && not(std::binary_search(curelems->at(curtype).begin(), curelems->at(curtype).end(), curelem)))
+                        continue;
+                    
+                    inlayer[curtype][curelem] = true;
+                    newphysreg->addelement(curtype, curelem);
+                    
+                    element el(curtype);
+                    for (int n = 0; n < el.countnodes(); n++)
+                    {
+                        int curnode = myelements->getsubelement(0, curtype, curelem, n);
+                        if (not(isnodeingrowthregion[curnode]))
+                        {
+                            isnodeingrowthregion[curnode] = true;
+                            newgrowthnodes.push_back(curnode);
+                        }
+                    }
+                }
+            }
+            growthnodes = newgrowthnodes;
+        }
+        newphysreg->removeduplicatedelements();
+        return;
+    }
+    
+    std::vector<std::vector<bool>> inlayer(8, std::vector<bool>(0)); // avoid duplicates
+    for (int i = 0; i <= 7; i++)
+        inlayer[i] = std::vector<bool>(myelements->count(i), false);
+    
     for (int l = 0; l < nl; l++)
     {
         // 'isnodeingr' is fixed:
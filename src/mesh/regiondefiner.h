@@ -9,6 +9,7 @@
 
 #include <iostream>
 #include <vector>
+#include <functional>
 #include "element.h"
 #include "elements.h"
 #include "nodes.h"
@@ -87,6 +88,10 @@ class regiondefiner
         std::vector<int> toanynode = {};
         
 
+        // Add to 'newphysreg' the subelements of dimension 'selecteddim' of the elements in 'sourcephysreg' (all cells if -1)
+        // whose nodes are all inside. The elements are looked up in the spatial index with the box surrounding the inside.
+        void selectinside(int newphysreg, int sourcephysreg, int selecteddim, std::vector<double> box, std::function<bool(double,double,double)> isinside);
+
         void defineskinregion(int regnum);
         void defineboxregion(int regnum);
         void definesphereregion(int regnum);
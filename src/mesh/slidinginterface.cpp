@@ -0,0 +1,37 @@
+#include "slidinginterface.h"
+#include "universe.h"
+
+
+slidinginterface::slidinginterface(int physreg, std::vector<double> rotcent)
+{
+    if (universe::getsession()->myrawmesh == NULL)
+    {
+        std::cout << "Error in 'slidinginterface' object: cannot define a sliding interface before the mesh is loaded" << std::endl;
+        abort();
+    }
+    
+    universe::getrawmesh()->getphysicalregions()->errorundefined({physreg});
+    
+    myrawslidinginterface = std::shared_ptr<rawslidinginterface>(new rawslidinginterface(physreg, rotcent));
+}
+
+int slidinginterface::getphysicalregion(void)
+{
+    return myrawslidinginterface->getphysicalregion();
+}
+
+void slidinginterface::setrotation(double angz)
+{
+    myrawslidinginterface->setrotation(angz);
+}
+
+double slidinginterface::getrotation(void)
+{
+    return myrawslidinginterface->getrotation();
+}
+
+std::shared_ptr<rawslidinginterface> slidinginterface::getpointer(void)
+{
+    return myrawslidinginterface;
+}
+
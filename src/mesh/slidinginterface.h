@@ -0,0 +1,43 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// A sliding interface is a 2D line region that rotates rigidly around the z axis. Interpolating
+// on it with 'sl::on' uses an angular lookup precomputed at creation instead of a point search.
+// The rotation angle of the region since the object creation must be provided with 'setrotation'
+// (e.g. after each 'mesh::rotate' call on the rotor). Coordinates are radially projected on it.
+
+
+#ifndef SLIDINGINTERFACE_H
+#define SLIDINGINTERFACE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "rawslidinginterface.h"
+
+class rawslidinginterface;
+
+class slidinginterface
+{
+    private:
+        
+        std::shared_ptr<rawslidinginterface> myrawslidinginterface = NULL;
+
+    public:
+
+        // Line region 'physreg' rotating around the z axis through 'rotcent':
+        slidinginterface(int physreg, std::vector<double> rotcent = {0,0,0});
+        
+        int getphysicalregion(void);
+        
+        // Set the rotation angle (in degrees) around the z axis since the object creation:
+        void setrotation(double angz);
+        double getrotation(void);
+        
+        // Get the raw sliding interface pointer:
+        std::shared_ptr<rawslidinginterface> getpointer(void);
+};
+
+#endif
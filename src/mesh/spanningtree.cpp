@@ -4,7 +4,7 @@
 
 spanningtree::spanningtree(std::vector<int> physregs)
 {
-    if (universe::myrawmesh == NULL)
+    if (universe::getsession()->myrawmesh == NULL)
     {
         std::cout << "Error in 'spanningtree' object: cannot define a spanning tree before the mesh is loaded" << std::endl;
         abort();
@@ -0,0 +1,226 @@
+#include "metrics.h"
+#include "slmpi.h"
+#include <cctype>
+
+
+bool metrics::isitenabled = false;
+std::mutex metrics::mymutex;
+std::map<std::string, double> metrics::mycounters = {};
+std::map<std::string, double> metrics::mygauges = {};
+std::string metrics::myformat = "json";
+std::string metrics::myfilename = "";
+std::function<void(std::string)> metrics::mysink = NULL;
+double metrics::myperiod = 60;
+std::chrono::steady_clock::time_point metrics::mylastexport = std::chrono::steady_clock::now();
+std::chrono::steady_clock::time_point metrics::myorigin = std::chrono::steady_clock::now();
+
+void metrics::errorifundefinedformat(std::string format)
+{
+    if (format != "json" && format != "prometheus")
+    {
+        std::cout << "Error in 'metrics' object: unknown format '" << format << "' (use 'json' or 'prometheus')" << std::endl;
+        abort();
+    }
+}
+
+std::string metrics::getname(std::string name)
+{
+    for (int i = 0; i < name.size(); i++)
+    {
+        char c = std::tolower(name[i]);
+        if ((c < 'a' || c > 'z') && (c < '0' || c > '9'))
+            c = '_';
+        name[i] = c;
+    }
+    return name;
+}
+
+void metrics::updatememory(void)
+{
+    std::ifstream statusfile("/proc/self/status");
+    std::string line;
+    while (std::getline(statusfile, line))
+    {
+        if (line.compare(0, 6, "VmRSS:") == 0 || line.compare(0, 6, "VmHWM:") == 0)
+        {
+            std::stringstream ss(line.substr(6));
+            long long int kb = 0;
+            ss >> kb;
+            mygauges[line[2] == 'R' ? "resident_memory_bytes" : "peak_resident_memory_bytes"] = 1024.0*kb;
+        }
+    }
+}
+
+std::string metrics::tostring(std::string format)
+{
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - myorigin).count();
+
+    std::stringstream out;
+    out.precision(15);
+
+    if (format == "json")
+    {
+        out << "{\"time\":" << time << ",\"rank\":" << slmpi::getrank();
+        for (auto it = mycounters.begin(); it != mycounters.end(); it++)
+            out << ",\"" << it->first << "\":" << it->second;
+        for (auto it = mygauges.begin(); it != mygauges.end(); it++)
+            out << ",\"" << it->first << "\":" << it->second;
+        out << "}" << std::endl;
+    }
+    else
+    {
+        std::string rank = "{rank=\"" + std::to_string(slmpi::getrank()) + "\"}";
+        for (auto it = mycounters.begin(); it != mycounters.end(); it++)
+            out << "# TYPE sparselizard_" << it->first << " counter" << std::endl << "sparselizard_" << it->first << rank << " " << it->second << std::endl;
+        for (auto it = mygauges.begin(); it != mygauges.end(); it++)
+            out << "# TYPE sparselizard_" << it->first << " gauge" << std::endl << "sparselizard_" << it->first << rank << " " << it->second << std::endl;
+    }
+
+    return out.str();
+}
+
+void metrics::exportmetrics(void)
+{
+    updatememory();
+    mylastexport = std::chrono::steady_clock::now();
+
+    std::string text = tostring(myformat);
+
+    if (mysink)
+    {
+        mysink(text);
+        return;
+    }
+
+    // The JSON lines are appended while the Prometheus file only holds the latest values:
+    std::ofstream outfile;
+    if (myformat == "json")
+        outfile.open(myfilename, std::ios::out | std::ios::app);
+    else
+        outfile.open(myfilename, std::ios::out | std::ios::trunc);
+    if (outfile.is_open() == false)
+    {
+        std::cout << "Error in 'metrics' object: unable to write to file '" << myfilename << "'" << std::endl;
+        abort();
+    }
+    outfile << text;
+    outfile.close();
+}
+
+void metrics::enable(std::string filename, std::string format, double period)
+{
+    errorifundefinedformat(format);
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    if (slmpi::count() > 1)
+    {
+        int rank = slmpi::getrank();
+        size_t dotpos = filename.find_last_of('.');
+        if (dotpos == std::string::npos)
+            filename = filename + "_" + std::to_string(rank);
+        else
+            filename = filename.substr(0, dotpos) + "_" + std::to_string(rank) + filename.substr(dotpos);
+    }
+
+    myfilename = filename;
+    mysink = NULL;
+    myformat = format;
+    myperiod = period;
+    mylastexport = std::chrono::steady_clock::now();
+    isitenabled = true;
+}
+
+void metrics::enable(std::function<void(std::string)> sink, std::string format, double period)
+{
+    errorifundefinedformat(format);
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    myfilename = "";
+    mysink = sink;
+    myformat = format;
+    myperiod = period;
+    mylastexport = std::chrono::steady_clock::now();
+    isitenabled = true;
+}
+
+void metrics::disable(void)
+{
+    isitenabled = false;
+}
+
+void metrics::add(std::string name, double value)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    mycounters[getname(name)] += value;
+}
+
+void metrics::set(std::string name, double value)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    mygauges[getname(name)] = value;
+}
+
+void metrics::setmax(std::string name, double value)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    name = getname(name);
+    auto it = mygauges.find(name);
+    if (it == mygauges.end() || it->second < value)
+        mygauges[name] = value;
+}
+
+double metrics::get(std::string name)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    name = getname(name);
+    if (mycounters.count(name) > 0)
+        return mycounters[name];
+    if (mygauges.count(name) > 0)
+        return mygauges[name];
+    return 0;
+}
+
+void metrics::clear(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    mycounters = {};
+    mygauges = {};
+}
+
+void metrics::update(void)
+{
+    if (isitenabled == false)
+        return;
+
+    std::lock_guard<std::mutex> lock(mymutex);
+
+    if (std::chrono::duration<double>(std::chrono::steady_clock::now() - mylastexport).count() >= myperiod)
+        exportmetrics();
+}
+
+void metrics::write(void)
+{
+    if (isitenabled == false)
+        return;
+
+    std::lock_guard<std::mutex> lock(mymutex);
+    exportmetrics();
+}
+
+std::string metrics::getjson(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    updatememory();
+    return tostring("json");
+}
+
+std::string metrics::getprometheus(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    updatememory();
+    return tostring("prometheus");
+}
@@ -0,0 +1,100 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object holds counters and gauges to monitor long running jobs from the outside. They are
+// exported periodically either in the JSON lines format (one object per export appended to the
+// file) or in the Prometheus text format (the file is overwritten at every export, e.g. for the
+// textfile collector of the node exporter). A custom sink can receive the formatted text instead.
+//
+// The library updates the following metrics when enabled:
+//
+// - the time and number of calls of every phase timed by a 'profilephase' object (generation,
+//   solves, eigenvalue computations, ...) as 'phase_<name>_seconds_total' and 'phase_<name>_calls_total'
+// - the number of dofs of the last generated formulation ('dofs') and the number of nonzeros of
+//   the last assembled matrix ('matrix_nonzeros')
+// - the number of solves, factorizations and iterations of 'solverstats'
+// - the resident memory and its high-water mark read at every export
+// - the bytes written and read in the field, vector, checkpoint and ParaView files
+//
+// The exports are triggered at the end of the phases (and by 'update'). When disabled every hook
+// costs a single test. With several ranks the rank number is added before the file extension.
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <functional>
+
+class metrics
+{
+    private:
+
+        static bool isitenabled;
+
+        static std::mutex mymutex;
+
+        static std::map<std::string, double> mycounters;
+        static std::map<std::string, double> mygauges;
+
+        static std::string myformat;
+        static std::string myfilename;
+        static std::function<void(std::string)> mysink;
+
+        // Export period in seconds:
+        static double myperiod;
+        static std::chrono::steady_clock::time_point mylastexport;
+        static std::chrono::steady_clock::time_point myorigin;
+
+        static void errorifundefinedformat(std::string format);
+
+        // Lowercase name with every character not allowed by Prometheus replaced by '_':
+        static std::string getname(std::string name);
+
+        // Read the resident memory and its high-water mark:
+        static void updatememory(void);
+
+        // Format and export without locking:
+        static std::string tostring(std::string format);
+        static void exportmetrics(void);
+
+    public:
+
+        // Export every 'period' seconds to a file in the "json" or "prometheus" format:
+        static void enable(std::string filename, std::string format = "json", double period = 60);
+        // Export every 'period' seconds to a custom sink receiving the formatted text:
+        static void enable(std::function<void(std::string)> sink, std::string format = "json", double period = 60);
+        static void disable(void);
+        static bool isenabled(void) { return isitenabled; };
+
+        // Increase a counter:
+        static void add(std::string name, double value = 1);
+        // Set a gauge:
+        static void set(std::string name, double value);
+        // Set a gauge to the max of its value and 'value':
+        static void setmax(std::string name, double value);
+
+        // Value of a counter or gauge (0 if undefined):
+        static double get(std::string name);
+
+        static void clear(void);
+
+        // Export if the period has elapsed since the last export:
+        static void update(void);
+        // Export now:
+        static void write(void);
+
+        // All counters and gauges in the export formats:
+        static std::string getjson(void);
+        static std::string getprometheus(void);
+
+};
+
+#endif
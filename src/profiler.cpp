@@ -0,0 +1,366 @@
+#include "profiler.h"
+#include "slmpi.h"
+#include "metrics.h"
+#include "petsc.h"
+
+
+bool profiler::isitenabled = false;
+bool profiler::istracing = false;
+std::mutex profiler::mymutex;
+std::vector<profilenode> profiler::mynodes = {profilenode()};
+thread_local int profiler::mycurrentnode = 0;
+std::vector<profileevent> profiler::myevents = {};
+long long int profiler::mymaxnumevents = 1000000;
+std::map<std::string, int> profiler::mypetscstages = {};
+std::map<std::string, int> profiler::mypetscevents = {};
+std::chrono::steady_clock::time_point profiler::myorigin = std::chrono::steady_clock::now();
+
+// Human readable time for a time in nanoseconds:
+std::string profiletimetostring(double time)
+{
+    std::vector<std::string> units = {"ns", "us", "ms", "s"};
+    int unit = 0;
+    while (unit < 3 && time >= 1000)
+    {
+        time = time/1000;
+        unit++;
+    }
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.3g %s", time, units[unit].c_str());
+    return buf;
+}
+
+std::string profiler::getpath(int node)
+{
+    std::string path = "";
+    while (node > 0)
+    {
+        path = "/" + mynodes[node].name + path;
+        node = mynodes[node].parent;
+    }
+    return path;
+}
+
+void profiler::enable(bool isenabled)
+{
+    isitenabled = isenabled;
+}
+
+void profiler::trace(bool istraced, long long int maxnumevents)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    istracing = istraced;
+    mymaxnumevents = maxnumevents;
+}
+
+void profiler::clear(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    mynodes = {profilenode()};
+    myevents = {};
+    mycurrentnode = 0;
+}
+
+int profiler::enter(std::string name)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    // The node might have been removed by a 'clear' call:
+    int parent = mycurrentnode;
+    if (parent >= mynodes.size())
+        parent = 0;
+    
+    for (int i = 0; i < mynodes[parent].children.size(); i++)
+    {
+        int child = mynodes[parent].children[i];
+        if (mynodes[child].name == name)
+        {
+            mycurrentnode = child;
+            return child;
+        }
+    }
+    
+    profilenode newnode;
+    newnode.name = name;
+    newnode.parent = parent;
+    mynodes.push_back(newnode);
+    mynodes[parent].children.push_back(mynodes.size()-1);
+    
+    mycurrentnode = mynodes.size()-1;
+    
+    return mycurrentnode;
+}
+
+void profiler::leave(int node, double start, double time)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    if (node >= mynodes.size())
+    {
+        mycurrentnode = 0;
+        return;
+    }
+    
+    mynodes[node].numcalls++;
+    mynodes[node].time += time;
+    mycurrentnode = mynodes[node].parent;
+    
+    if (istracing && myevents.size() < mymaxnumevents)
+    {
+        profileevent ev;
+        ev.name = mynodes[node].name;
+        ev.thread = std::hash<std::thread::id>()(std::this_thread::get_id()) % 100000;
+        ev.start = start;
+        ev.duration = time;
+        myevents.push_back(ev);
+    }
+}
+
+double profiler::now(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - myorigin).count();
+}
+
+void profiler::print(int node, int depth)
+{
+    profilenode& cur = mynodes[node];
+    
+    double selftime = cur.time;
+    for (int i = 0; i < cur.children.size(); i++)
+        selftime -= mynodes[cur.children[i]].time;
+        
+    std::cout << std::string(4*depth, ' ') << cur.name << ": " << profiletimetostring(cur.time) << " (self " << profiletimetostring(std::max(0.0, selftime)) << "), " << cur.numcalls << " calls" << std::endl;
+    
+    for (int i = 0; i < cur.children.size(); i++)
+        print(cur.children[i], depth+1);
+}
+
+void profiler::print(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    std::cout << "Profile of rank " << slmpi::getrank() << " (time, time excluding the subregions, number of calls):" << std::endl;
+    for (int i = 0; i < mynodes[0].children.size(); i++)
+        print(mynodes[0].children[i], 0);
+}
+
+void profiler::allprint(void)
+{
+    int numranks = slmpi::count();
+    if (numranks == 1)
+    {
+        print();
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    // Send every node path (as characters) with its time and number of calls to rank 0:
+    std::vector<int> chars = {}, numchars = {};
+    std::vector<double> values = {};
+    for (int i = 1; i < mynodes.size(); i++)
+    {
+        std::string path = getpath(i);
+        for (int c = 0; c < path.size(); c++)
+            chars.push_back(path[c]);
+        numchars.push_back(path.size());
+        values.push_back(mynodes[i].time);
+        values.push_back(mynodes[i].numcalls);
+    }
+    
+    std::vector<int> fragsizes = {(int)chars.size(), (int)numchars.size(), (int)values.size()}, allfragsizes(3*numranks);
+    slmpi::gather(0, fragsizes, allfragsizes);
+    
+    std::vector<int> charsizes(numranks), numcharsizes(numranks), valuesizes(numranks);
+    int totalchars = 0, totalnumchars = 0, totalvalues = 0;
+    for (int r = 0; r < numranks; r++)
+    {
+        charsizes[r] = allfragsizes[3*r+0];
+        numcharsizes[r] = allfragsizes[3*r+1];
+        valuesizes[r] = allfragsizes[3*r+2];
+        totalchars += charsizes[r];
+        totalnumchars += numcharsizes[r];
+        totalvalues += valuesizes[r];
+    }
+    std::vector<int> allchars(totalchars), allnumchars(totalnumchars);
+    std::vector<double> allvalues(totalvalues);
+    slmpi::gather(0, chars, allchars, charsizes);
+    slmpi::gather(0, numchars, allnumchars, numcharsizes);
+    slmpi::gather(0, values, allvalues, valuesizes);
+    
+    if (slmpi::getrank() != 0)
+        return;
+    
+    // Minimum, sum and maximum time and total number of calls for every path (the map sorts the paths so that
+    // the children directly follow their parent) as well as the number of ranks that entered the path:
+    std::map<std::string, std::vector<double>> aggregated;
+    int charindex = 0, pathindex = 0;
+    for (int r = 0; r < numranks; r++)
+    {
+        for (int i = 0; i < numcharsizes[r]; i++)
+        {
+            std::string path(allnumchars[pathindex], ' ');
+            for (int c = 0; c < path.size(); c++)
+                path[c] = allchars[charindex+c];
+            charindex += path.size();
+            
+            double time = allvalues[2*pathindex+0], calls = allvalues[2*pathindex+1];
+            
+            std::map<std::string, std::vector<double>>::iterator it = aggregated.find(path);
+            if (it == aggregated.end())
+                aggregated[path] = {time, time, time, calls, 1};
+            else
+            {
+                it->second[0] = std::min(it->second[0], time);
+                it->second[1] += time;
+                it->second[2] = std::max(it->second[2], time);
+                it->second[3] += calls;
+                it->second[4] += 1;
+            }
+            pathindex++;
+        }
+    }
+    
+    std::cout << "Profile aggregated over " << numranks << " ranks (minimum, average and maximum time over the ranks, total number of calls, number of ranks):" << std::endl;
+    for (std::map<std::string, std::vector<double>>::iterator it = aggregated.begin(); it != aggregated.end(); ++it)
+    {
+        std::string path = it->first;
+        int depth = std::count(path.begin(), path.end(), '/') - 1;
+        std::string name = path.substr(path.find_last_of('/')+1);
+        std::vector<double>& v = it->second;
+        
+        std::cout << std::string(4*depth, ' ') << name << ": " << profiletimetostring(v[0]) << " / " << profiletimetostring(v[1]/numranks) << " / " << profiletimetostring(v[2]) << ", " << (long long int)v[3] << " calls, " << (int)v[4] << " ranks" << std::endl;
+    }
+}
+
+void profiler::writetrace(std::string filename)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    int rank = slmpi::getrank();
+    
+    if (slmpi::count() > 1)
+    {
+        size_t dotpos = filename.find_last_of('.');
+        if (dotpos == std::string::npos)
+            filename = filename + "_" + std::to_string(rank);
+        else
+            filename = filename.substr(0, dotpos) + "_" + std::to_string(rank) + filename.substr(dotpos);
+    }
+    
+    std::ofstream outfile(filename);
+    if (outfile.is_open() == false)
+    {
+        std::cout << "Error in 'profiler' object: unable to write to file '" << filename << "'" << std::endl;
+        abort();
+    }
+    
+    // The times are in microseconds:
+    outfile << std::setprecision(15) << "{\"traceEvents\":[" << std::endl;
+    for (long long int i = 0; i < myevents.size(); i++)
+    {
+        std::string name = myevents[i].name;
+        std::string escaped = "";
+        for (int c = 0; c < name.size(); c++)
+        {
+            if (name[c] == '"' || name[c] == '\\')
+                escaped += '\\';
+            escaped += name[c];
+        }
+        
+        outfile << "{\"name\":\"" << escaped << "\",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":" << myevents[i].thread << ",\"ts\":" << myevents[i].start/1000.0 << ",\"dur\":" << myevents[i].duration/1000.0 << "}";
+        if (i < myevents.size()-1)
+            outfile << ",";
+        outfile << std::endl;
+    }
+    outfile << "]}" << std::endl;
+    
+    outfile.close();
+}
+
+int profiler::getpetscstage(std::string name)
+{
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+    if (ispetscinitialized == PETSC_FALSE)
+        return -1;
+        
+    std::map<std::string, int>::iterator it = mypetscstages.find(name);
+    if (it != mypetscstages.end())
+        return it->second;
+    
+    PetscLogStage stage;
+    PetscLogStageRegister(("sl " + name).c_str(), &stage);
+    mypetscstages[name] = stage;
+    
+    return stage;
+}
+
+int profiler::getpetscevent(std::string name)
+{
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+    if (ispetscinitialized == PETSC_FALSE)
+        return -1;
+    
+    std::map<std::string, int>::iterator it = mypetscevents.find(name);
+    if (it != mypetscevents.end())
+        return it->second;
+    
+    // All events are registered under a 'sparselizard' class:
+    static PetscClassId classid = -1;
+    if (classid == -1)
+        PetscClassIdRegister("sparselizard", &classid);
+    
+    PetscLogEvent event;
+    PetscLogEventRegister(("sl " + name).c_str(), classid, &event);
+    mypetscevents[name] = event;
+    
+    return event;
+}
+
+
+profilephase::profilephase(std::string name, bool isstage) : myscope(name)
+{
+    if (metrics::isenabled())
+    {
+        myname = name;
+        mymetricsstart = profiler::now();
+    }
+    
+    if (isstage)
+    {
+        mystage = profiler::getpetscstage(name);
+        if (mystage >= 0)
+            PetscLogStagePush(mystage);
+    }
+    else
+    {
+        myevent = profiler::getpetscevent(name);
+        if (myevent >= 0)
+            PetscLogEventBegin(myevent, 0, 0, 0, 0);
+    }
+}
+
+profilephase::~profilephase(void)
+{
+    if (mymetricsstart >= 0)
+    {
+        metrics::add("phase_" + myname + "_seconds_total", 1e-9*(profiler::now()-mymetricsstart));
+        metrics::add("phase_" + myname + "_calls_total");
+        metrics::update();
+    }
+    
+    // PETSc might have been finalized in the phase:
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+    if (ispetscinitialized == PETSC_FALSE)
+        return;
+    
+    if (mystage >= 0)
+        PetscLogStagePop();
+    if (myevent >= 0)
+        PetscLogEventEnd(myevent, 0, 0, 0, 0);
+}
@@ -0,0 +1,173 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object measures the time spent in named regions of the code. A region is timed by
+// a 'profilescope' object from its creation to its destruction. The scopes can be nested
+// and the measurements are accumulated in a call tree (one per thread since every thread
+// nests its own scopes). The profiler is disabled by default and a scope costs a single
+// test when disabled.
+//
+// The call tree can be printed on every rank or aggregated over all ranks (minimum, average
+// and maximum time over the ranks). When tracing is enabled every scope call is also recorded
+// to be exported in the Chrome trace format (open with chrome://tracing or Perfetto).
+//
+// The main phases (generation, assembly, elimination, solves, eigenvalue computations and DDM
+// iterations) are timed by 'profilephase' objects. They are also registered as PETSc log stages
+// or events so that the PETSc work is attributed to the phase that triggered it in the summary
+// printed by the '-log_view' option. The PETSc logging is independent of 'enable'.
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <thread>
+#include <functional>
+#include <cstdio>
+
+class profilenode
+{
+    public:
+        
+        std::string name = "";
+        int parent = -1;
+        std::vector<int> children = {};
+        
+        long long int numcalls = 0;
+        // Total time in nanoseconds:
+        double time = 0;
+};
+
+class profileevent
+{
+    public:
+        
+        std::string name = "";
+        int thread = 0;
+        // Start time and duration in nanoseconds:
+        double start = 0, duration = 0;
+};
+
+class profiler
+{
+    private:
+        
+        static bool isitenabled;
+        static bool istracing;
+        
+        static std::mutex mymutex;
+        
+        // Node 0 is the root:
+        static std::vector<profilenode> mynodes;
+        
+        // Current node of every thread:
+        static thread_local int mycurrentnode;
+        
+        static std::vector<profileevent> myevents;
+        // Stop recording events above this number:
+        static long long int mymaxnumevents;
+        
+        static std::chrono::steady_clock::time_point myorigin;
+        
+        // Full name of a node (the names from the root separated by '/'):
+        static std::string getpath(int node);
+        
+        static void print(int node, int depth);
+        
+        // PETSc log stage and event numbers of every phase name:
+        static std::map<std::string, int> mypetscstages;
+        static std::map<std::string, int> mypetscevents;
+        
+    public:
+        
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+        
+        // Record every scope call (at most 'maxnumevents') for the Chrome trace export:
+        static void trace(bool istraced = true, long long int maxnumevents = 1000000);
+        
+        static void clear(void);
+        
+        // Enter a child region of the current region of this thread and return the node entered:
+        static int enter(std::string name);
+        // Leave the node entered with 'enter' after 'time' nanoseconds (started at 'start' since the origin):
+        static void leave(int node, double start, double time);
+        
+        // Nanoseconds since the profiler origin:
+        static double now(void);
+        
+        // Print the call tree of this rank:
+        static void print(void);
+        // Print the call tree aggregated over all ranks (on rank 0). This must be called by all ranks:
+        static void allprint(void);
+        
+        // Write the recorded events of this rank in Chrome trace (json) format. When there are several
+        // ranks the rank number is added before the extension (e.g. 'trace_3.json'):
+        static void writetrace(std::string filename);
+        
+        // Get the PETSc log stage/event registered for a phase name (it is registered if needed).
+        // Return -1 if PETSc is not initialized:
+        static int getpetscstage(std::string name);
+        static int getpetscevent(std::string name);
+        
+};
+
+class profilescope
+{
+    private:
+        
+        int mynode = -1;
+        double mystart = 0;
+        
+    public:
+        
+        profilescope(std::string name)
+        {
+            if (profiler::isenabled())
+            {
+                mynode = profiler::enter(name);
+                mystart = profiler::now();
+            }
+        };
+        
+        ~profilescope(void)
+        {
+            if (mynode >= 0)
+                profiler::leave(mynode, mystart, profiler::now()-mystart);
+        };
+};
+
+// A phase is a PETSc log stage if 'isstage' is true and a PETSc log event otherwise. Stages are
+// nested while events are only timed. Phases must be created by the main thread:
+class profilephase
+{
+    private:
+        
+        profilescope myscope;
+        
+        int mystage = -1;
+        int myevent = -1;
+        
+        // Name and start time for the metrics (negative if disabled):
+        std::string myname = "";
+        double mymetricsstart = -1;
+        
+    public:
+        
+        profilephase(std::string name, bool isstage = true);
+        ~profilephase(void);
+        
+        profilephase(const profilephase&) = delete;
+        profilephase& operator=(const profilephase&) = delete;
+};
+
+#endif
@@ -0,0 +1,120 @@
+#include "anderson.h"
+
+
+anderson::anderson(int depth)
+{
+    if (depth < 0)
+    {
+        std::cout << "Error in 'anderson' object: expected a positive depth" << std::endl;
+        abort();
+    }
+    mydepth = depth;
+}
+
+void anderson::clear(void)
+{
+    pastg = {};
+    pastf = {};
+}
+
+vec anderson::next(vec x, vec gx)
+{
+    if (mydepth == 0)
+        return gx;
+    
+    densemat g = gx.getallvalues();
+    densemat f = g.copy();
+    f.subtract(x.getallvalues());
+    
+    pastg.push_back(g);
+    pastf.push_back(f);
+    if (pastg.size() > mydepth+1)
+    {
+        pastg.erase(pastg.begin());
+        pastf.erase(pastf.begin());
+    }
+    
+    int m = pastg.size()-1;
+    if (m == 0)
+        return gx;
+    
+    long long int n = f.count();
+    
+    // Differences of consecutive residuals:
+    std::vector<densemat> df(m);
+    for (int i = 0; i < m; i++)
+    {
+        df[i] = pastf[i+1].copy();
+        df[i].subtract(pastf[i]);
+    }
+    
+    // Normal equations (df^T*df)*gamma = df^T*f of the least squares problem:
+    std::vector<double> A(m*m, 0.0), b(m, 0.0);
+    double* fvals = f.getvalues();
+    for (int i = 0; i < m; i++)
+    {
+        double* dfi = df[i].getvalues();
+        for (int j = i; j < m; j++)
+        {
+            double* dfj = df[j].getvalues();
+            double dot = 0;
+            for (long long int k = 0; k < n; k++)
+                dot += dfi[k]*dfj[k];
+            A[i*m+j] = dot; A[j*m+i] = dot;
+        }
+        for (long long int k = 0; k < n; k++)
+            b[i] += dfi[k]*fvals[k];
+    }
+    // Small regularization for nearly collinear differences:
+    for (int i = 0; i < m; i++)
+        A[i*m+i] *= (1.0+1e-10);
+    
+    // Gaussian elimination with partial pivoting:
+    for (int c = 0; c < m; c++)
+    {
+        int piv = c;
+        for (int r = c+1; r < m; r++)
+        {
+            if (std::abs(A[r*m+c]) > std::abs(A[piv*m+c]))
+                piv = r;
+        }
+        // Singular system, no acceleration:
+        if (A[piv*m+c] == 0)
+            return gx;
+        for (int k = 0; k < m; k++)
+            std::swap(A[c*m+k], A[piv*m+k]);
+        std::swap(b[c], b[piv]);
+        
+        for (int r = c+1; r < m; r++)
+        {
+            double fact = A[r*m+c]/A[c*m+c];
+            for (int k = c; k < m; k++)
+                A[r*m+k] -= fact*A[c*m+k];
+            b[r] -= fact*b[c];
+        }
+    }
+    std::vector<double> gamma(m);
+    for (int c = m-1; c >= 0; c--)
+    {
+        double val = b[c];
+        for (int k = c+1; k < m; k++)
+            val -= A[c*m+k]*gamma[k];
+        gamma[c] = val/A[c*m+c];
+    }
+    
+    // The next iterate is g - sum_i gamma_i*(g_{i+1}-g_i):
+    densemat output = g.copy();
+    double* outvals = output.getvalues();
+    for (int i = 0; i < m; i++)
+    {
+        double* gi = pastg[i].getvalues();
+        double* gip1 = pastg[i+1].getvalues();
+        for (long long int k = 0; k < n; k++)
+            outvals[k] -= gamma[i]*(gip1[k]-gi[k]);
+    }
+    
+    vec accelerated = gx.copy();
+    accelerated.setallvalues(output);
+    
+    return accelerated;
+}
@@ -0,0 +1,43 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object implements the Anderson acceleration of a fixed-point iteration x = g(x). The next
+// iterate is the combination of the last 'depth' values of g that minimizes the linearized residual
+// g(x)-x in the least squares sense. A zero depth gives the unaccelerated iteration.
+
+#ifndef ANDERSON_H
+#define ANDERSON_H
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "vec.h"
+#include "densemat.h"
+
+class anderson
+{
+    private:
+        
+        int mydepth = 0;
+        
+        // Values of g and of the residual g(x)-x at the last iterations (oldest first):
+        std::vector<densemat> pastg = {};
+        std::vector<densemat> pastf = {};
+        
+    public:
+        
+        anderson(int depth = 0);
+        
+        int getdepth(void) { return mydepth; };
+        
+        // Clear the iteration history (call it before a new fixed-point iteration):
+        void clear(void);
+        
+        // Get the next iterate from the current iterate 'x' and 'gx' = g(x):
+        vec next(vec x, vec gx);
+        
+};
+
+#endif
@@ -0,0 +1,341 @@
+#include "bdf.h"
+
+bdf::bdf(formulation formul, vec dtxinit, int order, int verbosity, std::vector<bool> isrhskcconstant)
+{
+    myverbosity = verbosity;
+    
+    if (order < 1 || order > 5)
+    {
+        std::cout << "Error in 'bdf' object: order must be between 1 and 5 (" << order << " requested)" << std::endl;
+        abort();  
+    }
+    myorder = order;
+
+    myformulation = formul;
+    if (myformulation.ismassmatrixdefined())
+    {
+        std::cout << "Error in 'bdf' object: formulation provided cannot have a mass matrix (use another time resolution algorithm)" << std::endl;
+        abort();  
+    }
+    
+    dtx = dtxinit;
+    isconstant = isrhskcconstant;
+    
+    if (isconstant.size() != 3)
+    {
+        std::cout << "Error in 'bdf' object: expected a length 3 vector as fifth argument" << std::endl;
+        abort();  
+    }
+}
+
+void bdf::settimederivative(vec sol)
+{
+    dtx = sol;
+    pastx = {};
+    pasttimes = {};
+}
+
+void bdf::setadaptivity(double tol, double mints, double maxts, double reffact, double coarfact, double coarthres)
+{
+    if (tol < 0 || mints < 0 || maxts < 0 || reffact < 0 || coarfact < 0 || coarthres < 0)
+    {
+        std::cout << "Error in 'bdf' object: expected positive arguments for adaptivity" << std::endl;
+        abort();  
+    }
+    if (mints > maxts)
+    {
+        std::cout << "Error in 'bdf' object: min timestep cannot be larger than max for adaptivity" << std::endl;
+        abort();      
+    }
+    if (reffact > 1)
+    {
+        std::cout << "Error in 'bdf' object: expected a refinement factor lower than one for adaptivity" << std::endl;
+        abort();      
+    }
+    if (coarfact < 1)
+    {
+        std::cout << "Error in 'bdf' object: expected a coarsening factor larger than one for adaptivity" << std::endl;
+        abort();        
+    }
+    if (coarthres > 1)
+    {
+        std::cout << "Error in 'bdf' object: expected a coarsening threshold lower than one for adaptivity" << std::endl;
+        abort();        
+    }
+
+    mindt = mints; maxdt = maxts; tatol = tol; rfact = reffact; cfact = coarfact; cthres = coarthres;
+}
+
+void bdf::presolve(std::vector<formulation> formuls) { tosolvebefore = formuls; }
+void bdf::postsolve(std::vector<formulation> formuls) { tosolveafter = formuls; }
+
+void bdf::next(double timestep)
+{
+    run(true, timestep, -1);
+}
+
+int bdf::next(double timestep, int maxnumnlit)
+{
+    return run(false, timestep, maxnumnlit);
+}
+
+std::vector<double> bdf::getderivativeweights(std::vector<double> times)
+{
+    int n = times.size();
+    std::vector<double> weights(n, 0.0);
+    
+    for (int j = 1; j < n; j++)
+        weights[0] += 1.0/(times[0]-times[j]);
+    
+    for (int j = 1; j < n; j++)
+    {
+        double w = 1.0/(times[j]-times[0]);
+        for (int m = 1; m < n; m++)
+        {
+            if (m != j)
+                w *= (times[0]-times[m])/(times[j]-times[m]);
+        }
+        weights[j] = w;
+    }
+    
+    return weights;
+}
+
+std::vector<double> bdf::getinterpolationweights(std::vector<double> times, double t)
+{
+    int n = times.size();
+    std::vector<double> weights(n, 1.0);
+    
+    for (int j = 0; j < n; j++)
+    {
+        for (int m = 0; m < n; m++)
+        {
+            if (m != j)
+                weights[j] *= (t-times[m])/(times[j]-times[m]);
+        }
+    }
+    
+    return weights;
+}
+
+int bdf::run(bool islinear, double timestep, int maxnumnlit)
+{
+    if (timestep < 0 && mindt == -1)
+    {
+        std::cout << "Error in 'bdf' object: requested an adaptive timestep but adaptivity settings have not been defined" << std::endl;
+        abort();
+    }
+
+    double inittime = universe::getsession()->currenttimestep;
+
+    // Adaptive timestep:
+    bool istadapt = false;
+    if (timestep < 0)
+    {
+        istadapt = true;
+        if (dt < 0)
+            dt = mindt;
+    }
+    else
+        dt = timestep;
+
+    // Get the data from all fields to create the x vector:
+    vec x(myformulation);
+    x.setdata();
+    
+    // The history is restarted if the time was changed outside of this object:
+    if (pasttimes.size() == 0 || pasttimes[0] != inittime)
+    {
+        pastx = {x};
+        pasttimes = {inittime};
+    }
+    else
+        pastx[0] = x;
+    
+    // Get the initial value of the fields in all other formulations to solve:
+    std::vector<vec> presols(tosolvebefore.size()), postsols(tosolveafter.size());
+    if (istadapt)
+    {
+        for (int i = 0; i < presols.size(); i++)
+        {
+            presols[i] = vec(tosolvebefore[i]);
+            presols[i].setdata();
+        }
+        for (int i = 0; i < postsols.size(); i++)
+        {
+            postsols[i] = vec(tosolveafter[i]);
+            postsols[i].setdata();
+        }
+    }
+
+    // Time-adaptivity loop:
+    int nlit;
+    vec xnext, dtxnext;
+    while (true)
+    {
+        // Update and print the time:
+        universe::getsession()->currenttimestep = inittime+dt;
+
+        if (myverbosity > 1 && istadapt)
+            std::cout << "@" << inittime << "+" << dt << "s " << std::flush;
+        if (myverbosity > 1 && not(istadapt))
+            std::cout << "@" << inittime+dt << "s " << std::flush;
+        
+        // Order for this step (lower during the first steps):
+        int order = std::min(myorder, (int) pastx.size());
+        
+        // dtxnext = alpha[0]*xnext + sum_j alpha[j]*pastx[j-1]:
+        std::vector<double> bdftimes = {inittime+dt};
+        for (int j = 0; j < order; j++)
+            bdftimes.push_back(pasttimes[j]);
+        std::vector<double> alpha = getderivativeweights(bdftimes);
+        
+        vec history = alpha[1]*pastx[0];
+        for (int j = 2; j <= order; j++)
+            history = history + alpha[j]*pastx[j-1];
+        
+        // Make all time derivatives available in the universe:
+        universe::getsession()->xdtxdtdtx = {{},{dtx},{}};
+            
+        // Nonlinear loop:
+        double relchange = 1; nlit = 0;
+        xnext = x; dtxnext = dtx;
+        while (relchange > nltol && (maxnumnlit <= 0 || nlit < maxnumnlit))
+        {
+            // Solve all formulations that must be solved at the beginning of the nonlinear loop:
+            for (int i = 0; i < tosolvebefore.size(); i++)
+                tosolvebefore[i].solve();
+            
+            vec xtolcalc = xnext;
+            
+            // Reassemble only the non-constant matrices:
+            bool isfirstcall = not(K.isdefined());
+            if (isconstant[0] == false || isfirstcall)
+            {
+                myformulation.generaterhs();
+                rhs = myformulation.rhs();
+            }
+            else
+                rhs.updateconstraints();
+            if (isconstant[1] == false || isfirstcall)
+            {
+                myformulation.generatestiffnessmatrix();
+                K = myformulation.K(false);
+            }
+            if (isconstant[2] == false || isfirstcall)
+            {
+                myformulation.generatedampingmatrix();
+                C = myformulation.C(false);
+            }
+            
+            // Reuse matrices when possible (including the factorization):
+            if (isconstant[1] == false || isconstant[2] == false || isfirstcall || defalpha != alpha[0])
+            {
+                leftmat = alpha[0]*C + K;
+                leftmat.reusefactorization();
+                
+                defalpha = alpha[0];
+            }
+            
+            // Here are the constrained values of the next solution:
+            indexmat constraintindexes = myformulation.getdofmanager()->getconstrainedindexes();
+            densemat xnextdirichletval = rhs.getpointer()->getvalues(constraintindexes);
+            vec rightvec = rhs - C*history;
+            // Force the solution on the constrained dofs:
+            rightvec.getpointer()->setvalues(constraintindexes, xnextdirichletval);
+            
+            // Update the solution xnext.
+            xnext = relaxationfactor * sl::solve(leftmat, rightvec) + (1.0-relaxationfactor)*xnext;
+            
+            dtxnext = alpha[0]*xnext + history;
+            
+            // Update all fields in the formulation:
+            sl::setdata(xnext);
+            
+            relchange = (xnext-xtolcalc).norm()/xnext.norm();
+            
+            if (islinear == false && myverbosity > 2)
+                std::cout << relchange << " " << std::flush;
+
+            nlit++; 
+            
+            // Solve all formulations that must be solved at the end of the nonlinear loop:
+            for (int i = 0; i < tosolveafter.size(); i++)
+                tosolveafter[i].solve();
+            
+            // Make all time derivatives available in the universe:
+            universe::getsession()->xdtxdtdtx = {{},{dtxnext},{}};
+            
+            if (islinear)
+                break;
+        }
+        
+        if (myverbosity > 1 && islinear == false)
+            std::cout << "(" << nlit << "NL it) " << std::flush;
+        
+        if (istadapt == false)
+            break;
+        else
+        {
+            // Difference between the solution and its extrapolation from the previous steps to measure the error:
+            double errormeasure;
+            int numpred = std::min(order+1, (int) pastx.size());
+            if (numpred > 1)
+            {
+                std::vector<double> predtimes(pasttimes.begin(), pasttimes.begin()+numpred);
+                std::vector<double> predweights = getinterpolationweights(predtimes, inittime+dt);
+                vec xpred = predweights[0]*pastx[0];
+                for (int j = 1; j < numpred; j++)
+                    xpred = xpred + predweights[j]*pastx[j];
+                errormeasure = (xnext - xpred).norm()/xnext.norm()/(order+1);
+            }
+            else
+                errormeasure = dt*(dtxnext - dtx).norm()/xnext.norm();
+
+            bool breakit = false;
+            if (dt <= mindt || errormeasure <= tatol && (islinear || maxnumnlit <= 0 || nlit < maxnumnlit))
+            {
+                // If the error is low enough to coarsen the timestep:
+                if (errormeasure <= cthres*tatol && (islinear || maxnumnlit <= 0 || nlit < maxnumnlit))
+                    dt *= cfact;
+                breakit = true;
+            }
+            else
+            {
+                dt *= rfact;
+                // Reset fields for a new resolution:
+                sl::setdata(x);
+                for (int i = 0; i < presols.size(); i++)
+                    sl::setdata(presols[i]);
+                for (int i = 0; i < postsols.size(); i++)
+                    sl::setdata(postsols[i]);
+            }
+                
+            dt = std::min(dt, maxdt);
+            dt = std::max(dt, mindt);
+
+            if (myverbosity > 2)
+                std::cout << "(" << errormeasure << ") " << std::flush;
+            
+            if (breakit)
+                break;
+        }
+    }
+    
+    if (myverbosity == 1)
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
+    
+    dtx = dtxnext;
+    mytimes.push_back(universe::getsession()->currenttimestep);
+    
+    // Keep the solutions needed for the derivative and the predictor:
+    pastx.insert(pastx.begin(), xnext);
+    pasttimes.insert(pasttimes.begin(), universe::getsession()->currenttimestep);
+    if (pastx.size() > myorder+1)
+    {
+        pastx.resize(myorder+1);
+        pasttimes.resize(myorder+1);
+    }
+    
+    return nlit;
+}
@@ -0,0 +1,297 @@
+#include "checkpoint.h"
+#include "metrics.h"
+
+
+// Increase the version number when the layout changes:
+static const char checkpointmagic[8] = {'S','L','C','H','K','P','T','\0'};
+static const int checkpointversion = 1;
+
+template <typename T>
+void checkpoint::writevector(std::ofstream& outfile, const std::vector<T>& values)
+{
+    long long int len = values.size();
+    outfile.write((char*)&len, sizeof(long long int));
+    if (len > 0)
+        outfile.write((char*)values.data(), len*sizeof(T));
+}
+
+template <typename T>
+void checkpoint::readvector(const char*& cursor, const char* end, std::vector<T>& values, std::string name, long long int expectedlength)
+{
+    long long int len = -1;
+    if (end-cursor >= sizeof(long long int))
+        std::memcpy(&len, cursor, sizeof(long long int));
+    if (len < 0 || (end-cursor-sizeof(long long int))/sizeof(T) < len)
+    {
+        std::cout << "Error in 'checkpoint' object: checkpoint file '" << name << "' is truncated or corrupted" << std::endl;
+        abort();
+    }
+    if (expectedlength >= 0 && len != expectedlength)
+    {
+        std::cout << "Error in 'checkpoint' object: checkpoint file '" << name << "' does not match the current simulation (expected " << expectedlength << " values but found " << len << ")" << std::endl;
+        abort();
+    }
+    cursor += sizeof(long long int);
+
+    values.resize(len);
+    if (len > 0)
+        std::memcpy(values.data(), cursor, len*sizeof(T));
+    cursor += len*sizeof(T);
+}
+
+void checkpoint::writevec(std::ofstream& outfile, vec v)
+{
+    std::vector<double> values(v.size());
+    if (values.size() > 0)
+    {
+        densemat vals = v.getallvalues();
+        double* valsptr = vals.getvalues();
+        for (int i = 0; i < values.size(); i++)
+            values[i] = valsptr[i];
+    }
+    writevector(outfile, values);
+}
+
+void checkpoint::readvec(const char*& cursor, const char* end, vec v, std::string name)
+{
+    std::vector<double> values;
+    readvector(cursor, end, values, name, v.size());
+    if (values.size() > 0)
+        v.setallvalues(densemat(values.size(), 1, values));
+}
+
+void checkpoint::add(field input) { myfields.push_back(input); }
+void checkpoint::add(vec input) { myvecs.push_back(input); }
+void checkpoint::add(genalpha& input) { mygenalphas.push_back(&input); }
+void checkpoint::add(impliciteuler& input) { myimpliciteulers.push_back(&input); }
+
+void checkpoint::write(std::string filename)
+{
+    std::ofstream outfile(filename.c_str(), std::ios::out | std::ios::binary);
+    if (not(outfile.is_open()))
+    {
+        std::cout << "Unable to write checkpoint to file '" << filename << "' or file not found" << std::endl;
+        abort();
+    }
+
+    outfile.write(checkpointmagic, 8);
+    // The sizes of the types are written to reject a file written on an incompatible platform:
+    std::vector<int> header = {checkpointversion, (int)sizeof(int), (int)sizeof(double)};
+    writevector(outfile, header);
+
+    std::vector<double> timeval = {universe::getsession()->currenttimestep};
+    writevector(outfile, timeval);
+
+    ///// Mesh:
+    std::shared_ptr<rawmesh> curmesh = universe::getrawmesh();
+    std::shared_ptr<rawmesh> origmesh = curmesh->getoriginalmeshpointer();
+    std::shared_ptr<htracker> ht = curmesh->gethtracker();
+
+    writevector(outfile, *(origmesh->getnodes()->readcoordinates()));
+
+    std::vector<bool> tree = ht->gettree();
+    std::vector<int> inttree(tree.begin(), tree.end());
+    writevector(outfile, inttree);
+    std::vector<int> treeinfo = {ht->getmaxdepth(), ht->countleaves()};
+    writevector(outfile, treeinfo);
+
+    writevector(outfile, *(curmesh->getnodes()->readcoordinates()));
+
+    ///// Fields:
+    physicalregions* prptr = curmesh->getphysicalregions();
+    int wholedomain = prptr->createunionofall();
+
+    std::vector<int> numfields = {(int)myfields.size()};
+    writevector(outfile, numfields);
+    for (int i = 0; i < myfields.size(); i++)
+    {
+        std::vector<int> intdata;
+        std::vector<double> doubledata;
+        myfields[i].getpointer()->getraw(wholedomain, intdata, doubledata, {});
+
+        writevector(outfile, intdata);
+        writevector(outfile, doubledata);
+    }
+
+    prptr->remove({wholedomain}, false);
+
+    ///// Vectors:
+    std::vector<int> numvecs = {(int)myvecs.size()};
+    writevector(outfile, numvecs);
+    for (int i = 0; i < myvecs.size(); i++)
+        writevec(outfile, myvecs[i]);
+
+    ///// Time derivatives in the universe:
+    std::vector<int> numxdt(3);
+    for (int i = 0; i < 3; i++)
+        numxdt[i] = (i < universe::getsession()->xdtxdtdtx.size()) ? universe::getsession()->xdtxdtdtx[i].size() : 0;
+    writevector(outfile, numxdt);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < numxdt[i]; j++)
+            writevec(outfile, universe::getsession()->xdtxdtdtx[i][j]);
+    }
+
+    ///// Time integrators:
+    std::vector<int> numintegrators = {(int)mygenalphas.size(), (int)myimpliciteulers.size()};
+    writevector(outfile, numintegrators);
+    for (int i = 0; i < mygenalphas.size(); i++)
+    {
+        std::vector<vec> dtxs = mygenalphas[i]->gettimederivative();
+        writevec(outfile, dtxs[0]);
+        writevec(outfile, dtxs[1]);
+        std::vector<double> dt = {mygenalphas[i]->gettimestep()};
+        writevector(outfile, dt);
+        std::vector<double> times = mygenalphas[i]->gettimes();
+        writevector(outfile, times);
+    }
+    for (int i = 0; i < myimpliciteulers.size(); i++)
+    {
+        writevec(outfile, myimpliciteulers[i]->gettimederivative());
+        std::vector<double> dt = {myimpliciteulers[i]->gettimestep()};
+        writevector(outfile, dt);
+        std::vector<double> times = myimpliciteulers[i]->gettimes();
+        writevector(outfile, times);
+    }
+
+    if (metrics::isenabled())
+        metrics::add("io_written_bytes_total", outfile.tellp());
+    outfile.close();
+}
+
+void checkpoint::load(std::string filename)
+{
+    std::vector<char> buffer;
+    std::ifstream infile(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (not(infile.is_open()))
+    {
+        std::cout << "Unable to read checkpoint file '" << filename << "' or file not found" << std::endl;
+        abort();
+    }
+    long long int filesize = infile.tellg();
+    buffer.resize(filesize);
+    infile.seekg(0, std::ios::beg);
+    infile.read(buffer.data(), filesize);
+    infile.close();
+
+    if (metrics::isenabled())
+        metrics::add("io_read_bytes_total", filesize);
+
+    const char* cursor = buffer.data();
+    const char* end = buffer.data()+filesize;
+
+    if (filesize < 8 || std::memcmp(cursor, checkpointmagic, 8) != 0)
+    {
+        std::cout << "Error in 'checkpoint' object: file '" << filename << "' is not a checkpoint file" << std::endl;
+        abort();
+    }
+    cursor += 8;
+    std::vector<int> header;
+    readvector(cursor, end, header, filename, 3);
+    if (header[0] != checkpointversion || header[1] != sizeof(int) || header[2] != sizeof(double))
+    {
+        std::cout << "Error in 'checkpoint' object: checkpoint file '" << filename << "' was written by an incompatible version or platform" << std::endl;
+        abort();
+    }
+
+    std::vector<double> timeval;
+    readvector(cursor, end, timeval, filename, 1);
+    universe::getsession()->currenttimestep = timeval[0];
+
+    ///// Mesh:
+    std::shared_ptr<rawmesh> origmesh = universe::getrawmesh()->getoriginalmeshpointer();
+
+    std::vector<double> origcoords;
+    readvector(cursor, end, origcoords, filename, 3*origmesh->getnodes()->count());
+    origmesh->setcoordinates(origcoords);
+
+    // Rebuild the h-adapted mesh if the current tree differs:
+    std::vector<int> inttree, treeinfo;
+    readvector(cursor, end, inttree, filename);
+    readvector(cursor, end, treeinfo, filename, 2);
+    std::vector<bool> tree(inttree.begin(), inttree.end());
+    if (tree != universe::getrawmesh()->gethtracker()->gettree())
+        origmesh->restorehadaptation(tree, treeinfo[0], treeinfo[1], 0);
+
+    std::shared_ptr<rawmesh> curmesh = universe::getrawmesh();
+    std::vector<double> curcoords;
+    readvector(cursor, end, curcoords, filename, 3*curmesh->getnodes()->count());
+    if (curmesh != origmesh)
+        curmesh->setcoordinates(curcoords);
+
+    ///// Fields:
+    std::vector<int> numfields;
+    readvector(cursor, end, numfields, filename, 1);
+    if (numfields[0] != myfields.size())
+    {
+        std::cout << "Error in 'checkpoint' object: checkpoint file '" << filename << "' holds " << numfields[0] << " fields but " << myfields.size() << " were added" << std::endl;
+        abort();
+    }
+    for (int i = 0; i < myfields.size(); i++)
+    {
+        std::vector<int> intdata;
+        std::vector<double> doubledata;
+        readvector(cursor, end, intdata, filename);
+        readvector(cursor, end, doubledata, filename);
+
+        myfields[i].getpointer()->setraw(intdata, doubledata, "checkpoint file '" + filename + "'");
+    }
+
+    ///// Vectors:
+    std::vector<int> numvecs;
+    readvector(cursor, end, numvecs, filename, 1);
+    if (numvecs[0] != myvecs.size())
+    {
+        std::cout << "Error in 'checkpoint' object: checkpoint file '" << filename << "' holds " << numvecs[0] << " vectors but " << myvecs.size() << " were added" << std::endl;
+        abort();
+    }
+    for (int i = 0; i < myvecs.size(); i++)
+        readvec(cursor, end, myvecs[i], filename);
+
+    ///// Time derivatives in the universe (only those currently defined are restored, the time integrators set them anyway):
+    std::vector<int> numxdt;
+    readvector(cursor, end, numxdt, filename, 3);
+    for (int i = 0; i < 3; i++)
+    {
+        int numdefined = (i < universe::getsession()->xdtxdtdtx.size()) ? universe::getsession()->xdtxdtdtx[i].size() : 0;
+        for (int j = 0; j < numxdt[i]; j++)
+        {
+            if (j < numdefined)
+                readvec(cursor, end, universe::getsession()->xdtxdtdtx[i][j], filename);
+            else
+            {
+                std::vector<double> skipped;
+                readvector(cursor, end, skipped, filename);
+            }
+        }
+    }
+
+    ///// Time integrators:
+    std::vector<int> numintegrators;
+    readvector(cursor, end, numintegrators, filename, 2);
+    if (numintegrators[0] != mygenalphas.size() || numintegrators[1] != myimpliciteulers.size())
+    {
+        std::cout << "Error in 'checkpoint' object: checkpoint file '" << filename << "' holds " << numintegrators[0] << " genalpha and " << numintegrators[1] << " impliciteuler objects but " << mygenalphas.size() << " and " << myimpliciteulers.size() << " were added" << std::endl;
+        abort();
+    }
+    for (int i = 0; i < mygenalphas.size(); i++)
+    {
+        std::vector<vec> dtxs = mygenalphas[i]->gettimederivative();
+        readvec(cursor, end, dtxs[0], filename);
+        readvec(cursor, end, dtxs[1], filename);
+        std::vector<double> dt, times;
+        readvector(cursor, end, dt, filename, 1);
+        readvector(cursor, end, times, filename);
+        mygenalphas[i]->settimestep(dt[0]);
+        mygenalphas[i]->settimes(times);
+    }
+    for (int i = 0; i < myimpliciteulers.size(); i++)
+    {
+        readvec(cursor, end, myimpliciteulers[i]->gettimederivative(), filename);
+        std::vector<double> dt, times;
+        readvector(cursor, end, dt, filename, 1);
+        readvector(cursor, end, times, filename);
+        myimpliciteulers[i]->settimestep(dt[0]);
+        myimpliciteulers[i]->settimes(times);
+    }
+}
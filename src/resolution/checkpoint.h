@@ -0,0 +1,65 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object writes the state of a simulation to a binary checkpoint file and restores it.
+// The checkpoint includes the current time, the node coordinates (i.e. the mesh deformation),
+// the h-adaptation tree, the time derivatives in the universe and all fields, vectors and time
+// integrators added to the object.
+//
+// To restart, the same mesh, fields, formulations and time integrators are defined as in the
+// original run and added in the same order to a checkpoint object before calling 'load'.
+// The time integrators are held by pointer: they must exist as long as the checkpoint object.
+
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include "field.h"
+#include "vec.h"
+#include "genalpha.h"
+#include "impliciteuler.h"
+#include "universe.h"
+
+class checkpoint
+{
+
+    private:
+
+        std::vector<field> myfields = {};
+        std::vector<vec> myvecs = {};
+        std::vector<genalpha*> mygenalphas = {};
+        std::vector<impliciteuler*> myimpliciteulers = {};
+
+        // Append the length (as a 64 bit integer) then the values to the file:
+        template <typename T>
+        static void writevector(std::ofstream& outfile, const std::vector<T>& values);
+        // Read a vector written by 'writevector' at the cursor and move the cursor after it:
+        template <typename T>
+        static void readvector(const char*& cursor, const char* end, std::vector<T>& values, std::string name, long long int expectedlength = -1);
+
+        static void writevec(std::ofstream& outfile, vec v);
+        static void readvec(const char*& cursor, const char* end, vec v, std::string name);
+
+    public:
+
+        checkpoint(void) {};
+
+        void add(field input);
+        // Vectors are restored in place (the vectors of a time integrator for example):
+        void add(vec input);
+        void add(genalpha& input);
+        void add(impliciteuler& input);
+
+        void write(std::string filename);
+        void load(std::string filename);
+
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include "eigenvalue.h"
 #include <slepceps.h>
 #include <slepcpep.h>
+#include <algorithm>
 
 
 eigenvalue::eigenvalue(mat A)
@@ -30,81 +31,266 @@ eigenvalue::eigenvalue(std::vector<mat> inmats)
     mymats = inmats;
 }
 
-void eigenvalue::compute(int numeigenvaluestocompute, double targeteigenvaluemagnitude)
+// Defined in 'sl.cpp':
+void setpreconditioner(PC pc, mat A, std::string precondtype);
+
+void eigenvalue::setsolver(std::string solvertype, std::string precondtype)
 {
-    if (mymats.size() == 0)
+    if (solvertype != "krylovschur" && solvertype != "lobpcg" && solvertype != "jd")
     {
-        // Define the slepc eigensolver context:
-        EPS eps;
-        
-        EPSCreate( PETSC_COMM_SELF, &eps );
+        std::cout << "Error in 'eigenvalue' object: unknown eigensolver '" << solvertype << "' (use 'krylovschur', 'lobpcg' or 'jd')" << std::endl;
+        abort();
+    }
+    if (precondtype != "gamg" && precondtype != "hypre" && precondtype != "pmultigrid" && precondtype != "hmultigrid" && precondtype != "ilu" && precondtype != "sor" && precondtype != "none")
+    {
+        std::cout << "Error in 'eigenvalue' object: unknown preconditioner type '" << precondtype << "' (use 'gamg', 'hypre', 'pmultigrid', 'hmultigrid', 'ilu', 'sor' or 'none')" << std::endl;
+        abort();
+    }
+    
+    // The kept context was created for the previous solver:
+    if (solvertype != mysolver || precondtype != myprecond)
+        myeps = NULL;
+    
+    mysolver = solvertype;
+    myprecond = precondtype;
+}
+
+// Avoid crashes when destroy is called after PetscFinalize (not allowed):
+void destroyeps(EPS eps)
+{
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+
+    if (ispetscinitialized == PETSC_TRUE)
+        EPSDestroy(&eps);
+}
+
+std::shared_ptr<_p_EPS> eigenvalue::createeps(int numeigs, double target, std::vector<double> interval)
+{
+    bool isslicing = (interval.size() == 2);
+    
+    // Define the slepc eigensolver context:
+    EPS eps;
+    
+    EPSCreate( PETSC_COMM_SELF, &eps );
+    
+    if (isslicing == false && mysolver != "krylovschur")
+    {
+        bool issymmetric = (mysolver == "lobpcg");
         
-        // To be general we assume a non-hermitian problem:
         if (myB.getpointer() == NULL)
         {
             EPSSetOperators( eps, myA.getapetsc(), NULL );
-            EPSSetProblemType(eps, EPS_NHEP);    
+            EPSSetProblemType(eps, issymmetric ? EPS_HEP : EPS_NHEP);
         }
         else
         {
             EPSSetOperators( eps, myA.getapetsc(), myB.getapetsc() );
-            EPSSetProblemType(eps, EPS_GNHEP);
+            EPSSetProblemType(eps, issymmetric ? EPS_GHEP : EPS_GNHEP);
         }
         
-        // Tell slepc how many eigs we want:
-        EPSSetDimensions(eps, numeigenvaluestocompute, PETSC_DECIDE, PETSC_DECIDE);
-        // Set tolerance and max num of iterations allowed:
-        EPSSetTolerances(eps, 1e-6, 100);
-        // Set the eigenvalue solver:
-        EPSSetType(eps, EPSKRYLOVSCHUR);
+        EPSSetDimensions(eps, numeigs, PETSC_DECIDE, PETSC_DECIDE);
+        // More iterations are needed without the shift-invert transform:
+        EPSSetTolerances(eps, 1e-6, 10000);
+        
+        if (mysolver == "lobpcg")
+        {
+            EPSSetType(eps, EPSLOBPCG);
+            EPSSetWhichEigenpairs(eps, EPS_SMALLEST_REAL);
+        }
+        else
+        {
+            EPSSetType(eps, EPSJD);
+            EPSSetTarget(eps, target);
+            EPSSetWhichEigenpairs(eps, EPS_TARGET_MAGNITUDE);
+        }
         
         EPSSetFromOptions(eps);
         
-        // We use a shift and invert transform:
+        // Only the preconditioner of A is applied (no factorization):
         ST st;
         EPSGetST(eps, &st);
-        STSetType(st, STSINVERT);
+        STSetType(st, STPRECOND);
+        STSetPreconditionerMat(st, myA.getapetsc());
         
-        // We target the eigenvalues with a given magnitude:
-        EPSSetTarget(eps, targeteigenvaluemagnitude);
-        EPSSetWhichEigenpairs(eps, EPS_TARGET_MAGNITUDE);
-        
-        // MUMPS petsc solver context:
         KSP ksp;
         STGetKSP(st, &ksp);
-        KSPSetType(ksp, "preonly");
+        if (mysolver == "lobpcg")
+            KSPSetType(ksp, KSPPREONLY);
+        KSPSetOperators(ksp, myA.getapetsc(), myA.getapetsc());
         PC pc;
         KSPGetPC(ksp, &pc);
+        setpreconditioner(pc, myA, myprecond);
+        
+        return std::shared_ptr<_p_EPS>(eps, destroyeps);
+    }
+    
+    // To be general we assume a non-hermitian problem (spectrum slicing requires a hermitian one):
+    if (myB.getpointer() == NULL)
+    {
+        EPSSetOperators( eps, myA.getapetsc(), NULL );
+        EPSSetProblemType(eps, isslicing ? EPS_HEP : EPS_NHEP);    
+    }
+    else
+    {
+        EPSSetOperators( eps, myA.getapetsc(), myB.getapetsc() );
+        EPSSetProblemType(eps, isslicing ? EPS_GHEP : EPS_GNHEP);
+    }
+    
+    // Tell slepc how many eigs we want:
+    if (isslicing == false)
+        EPSSetDimensions(eps, numeigs, PETSC_DECIDE, PETSC_DECIDE);
+    // Set tolerance and max num of iterations allowed:
+    EPSSetTolerances(eps, 1e-6, 100);
+    // Set the eigenvalue solver:
+    EPSSetType(eps, EPSKRYLOVSCHUR);
+    
+    EPSSetFromOptions(eps);
+    
+    // We use a shift and invert transform:
+    ST st;
+    EPSGetST(eps, &st);
+    STSetType(st, STSINVERT);
+    
+    if (isslicing)
+    {
+        // All eigenvalues in the interval are found using the inertia of the shifted matrices:
+        EPSSetInterval(eps, interval[0], interval[1]);
+        EPSSetWhichEigenpairs(eps, EPS_ALL);
+    }
+    else
+    {
+        // We target the eigenvalues with a given magnitude:
+        EPSSetTarget(eps, target);
+        EPSSetWhichEigenpairs(eps, EPS_TARGET_MAGNITUDE);
+    }
+    
+    // MUMPS petsc solver context:
+    KSP ksp;
+    STGetKSP(st, &ksp);
+    KSPSetType(ksp, "preonly");
+    PC pc;
+    KSPGetPC(ksp, &pc);
+    // Matrices in symmetric storage can only be factorized with a Cholesky.
+    // The inertia needed for spectrum slicing is only given by a Cholesky.
+    if (isslicing || (myA.getpointer()->issymmetric() && (myB.getpointer() == NULL || myB.getpointer()->issymmetric())))
+        PCSetType(pc, PCCHOLESKY);
+    else
         PCSetType(pc, PCLU);
-        PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+    PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+    
+    return std::shared_ptr<_p_EPS>(eps, destroyeps);
+}
+
+void eigenvalue::getsolution(std::shared_ptr<_p_EPS> eps, std::vector<double>& vals, std::vector<double>& valsimag, std::vector<double>& vecs, std::vector<double>& vecsimag)
+{
+    int numdofs = myA.getainds().count();
+    
+    // Get the number of eigs found:
+    PetscInt numeigsfound;
+    EPSGetConverged( eps.get(), &numeigsfound );
+    
+    vals.resize(numeigsfound);
+    valsimag.resize(numeigsfound);
+    vecs.resize(numeigsfound*numdofs);
+    vecsimag.resize(numeigsfound*numdofs);
+    
+    for (int i = 0; i < numeigsfound; i++)
+    {
+        // Create the 'eigvecr' and 'eigveci' vectors:
+        std::shared_ptr<rawvec> rawr(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+        std::shared_ptr<rawvec> rawi(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+        vec eigvecr(rawr); vec eigveci(rawi);
+        
+        EPSGetEigenpair( eps.get(), i, &vals[i], &valsimag[i], eigvecr.getpetsc(), eigveci.getpetsc() );
+        
+        densemat vr = eigvecr.getallvalues();
+        densemat vi = eigveci.getallvalues();
+        double* vrptr = vr.getvalues();
+        double* viptr = vi.getvalues();
+        for (int j = 0; j < numdofs; j++)
+        {
+            vecs[i*numdofs+j] = vrptr[j];
+            vecsimag[i*numdofs+j] = viptr[j];
+        }
+    }
+}
+
+void eigenvalue::writesolution(std::shared_ptr<_p_EPS> eps)
+{
+    int numdofs = myA.getainds().count();
+    
+    PetscInt numeigsfound;
+    EPSGetConverged( eps.get(), &numeigsfound );
+    
+    eigenvaluereal.resize(numeigsfound);
+    eigenvalueimaginary.resize(numeigsfound);
+    eigenvectorreal = {};
+    eigenvectorimaginary = {};
+    
+    // Only one eigenvector is in memory at a time:
+    std::shared_ptr<rawvec> rawr(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+    std::shared_ptr<rawvec> rawi(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+    vec eigvecr(rawr); vec eigveci(rawi);
+    
+    for (int i = 0; i < numeigsfound; i++)
+    {
+        EPSGetEigenpair( eps.get(), i, &eigenvaluereal[i], &eigenvalueimaginary[i], eigvecr.getpetsc(), eigveci.getpetsc() );
+        
+        myA.x0merge(eigvecr).write(mystreamprefix + std::to_string(i) + "real.bin");
+        if (eigenvalueimaginary[i] != 0)
+            myA.x0merge(eigveci).write(mystreamprefix + std::to_string(i) + "imag.bin");
+    }
+}
+
+void eigenvalue::compute(int numeigenvaluestocompute, double targeteigenvaluemagnitude)
+{
+    if (mymats.size() == 0)
+    {
+        // Reuse the context and its shift-invert factorization if allowed:
+        if (isfactorizationreused == false || myeps == NULL || mynumeigs != numeigenvaluestocompute || mytarget != targeteigenvaluemagnitude)
+        {
+            myeps = createeps(numeigenvaluestocompute, targeteigenvaluemagnitude);
+            mynumeigs = numeigenvaluestocompute;
+            mytarget = targeteigenvaluemagnitude;
+        }
         
         // DO THE ACTUAL RESOLUTION:
-        EPSSolve( eps );
+        {
+            profilephase phase("eigen");
+            EPSSolve( myeps.get() );
+        }
         
-        // Get the number of eigs found:
-        int numeigsfound;
-        EPSGetConverged( eps, &numeigsfound );
+        if (mystreamprefix.size() > 0)
+        {
+            writesolution(myeps);
+            if (isfactorizationreused == false)
+                myeps = NULL;
+            return;
+        }
+        
+        std::vector<double> vals, valsimag, vecs, vecsimag;
+        getsolution(myeps, vals, valsimag, vecs, vecsimag);
         
+        if (isfactorizationreused == false)
+            myeps = NULL;
         
         // Get all eigs:
-        eigenvaluereal.resize(numeigsfound);
-        eigenvalueimaginary.resize(numeigsfound);
+        int numeigsfound = vals.size();
+        int numdofs = myA.getainds().count();
+        
+        eigenvaluereal = vals;
+        eigenvalueimaginary = valsimag;
         eigenvectorreal.resize(numeigsfound);
         eigenvectorimaginary.resize(numeigsfound);
         
         for (int i = 0; i < numeigsfound; i++)
         {
-            double eigvalr, eigvali;
-            
-            // Create the 'eigvecr' and 'eigveci' vectors:
-            std::shared_ptr<rawvec> rawr(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(myA.getainds().count())))); 
-            std::shared_ptr<rawvec> rawi(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(myA.getainds().count())))); 
+            std::shared_ptr<rawvec> rawr(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+            std::shared_ptr<rawvec> rawi(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
             vec eigvecr(rawr); vec eigveci(rawi);
-            
-            EPSGetEigenpair( eps, i, &eigvalr, &eigvali, eigvecr.getpetsc(), eigveci.getpetsc() );
-                    
-            eigenvaluereal[i] = eigvalr;
-            eigenvalueimaginary[i] = eigvali;
+            eigvecr.setallvalues(densemat(numdofs, 1, std::vector<double>(vecs.begin()+i*numdofs, vecs.begin()+(i+1)*numdofs)));
+            eigveci.setallvalues(densemat(numdofs, 1, std::vector<double>(vecsimag.begin()+i*numdofs, vecsimag.begin()+(i+1)*numdofs)));
             
             eigenvectorreal[i] = myA.x0merge(eigvecr);
             eigenvectorimaginary[i] = myA.x0merge(eigveci);
@@ -146,7 +332,14 @@ void eigenvalue::compute(int numeigenvaluestocompute, double targeteigenvaluemag
         KSPSetType(ksp, "preonly");
         PC pc;
         KSPGetPC(ksp, &pc);
-        PCSetType(pc, PCLU);
+        // Matrices in symmetric storage can only be factorized with a Cholesky:
+        bool areallsymmetric = true;
+        for (int i = 0; i < mymats.size(); i++)
+            areallsymmetric = (areallsymmetric && mymats[i].getpointer()->issymmetric());
+        if (areallsymmetric)
+            PCSetType(pc, PCCHOLESKY);
+        else
+            PCSetType(pc, PCLU);
 
         PEPSTOARSetDetectZeros(pep,PETSC_TRUE);
         PEPSetScale(pep, PEP_SCALE_SCALAR, PETSC_DECIDE, PETSC_NULL, PETSC_NULL, PETSC_DECIDE, PETSC_DECIDE);
@@ -158,7 +351,7 @@ void eigenvalue::compute(int numeigenvaluestocompute, double targeteigenvaluemag
         // DO THE ACTUAL RESOLUTION:
         PEPSolve( pep );
         // Get the number of eigs found:
-        int numeigsfound;
+        PetscInt numeigsfound;
         PEPGetConverged( pep, &numeigsfound );
 
 
@@ -190,6 +383,119 @@ void eigenvalue::compute(int numeigenvaluestocompute, double targeteigenvaluemag
     }
 }
 
+void eigenvalue::computeinterval(double lambdamin, double lambdamax, int numslices)
+{
+    if (mymats.size() != 0)
+    {
+        std::cout << "Error in 'eigenvalue' object: spectrum slicing is only available for standard and generalized eigenvalue problems" << std::endl;
+        abort();
+    }
+    if (lambdamax <= lambdamin)
+    {
+        std::cout << "Error in 'eigenvalue' object: expected a nonempty eigenvalue interval" << std::endl;
+        abort();
+    }
+    
+    int numranks = slmpi::count();
+    int rank = slmpi::getrank();
+    
+    if (numslices <= 0)
+        numslices = numranks;
+    
+    // Slice 's' is handled by rank 's % numranks':
+    std::vector<std::vector<double>> slices = {};
+    double slicelength = (lambdamax-lambdamin)/numslices;
+    for (int s = rank; s < numslices; s += numranks)
+        slices.push_back({lambdamin + s*slicelength, (s == numslices-1) ? lambdamax : lambdamin + (s+1)*slicelength});
+    
+    if (isfactorizationreused == false || slices != myslices)
+    {
+        myslicecontexts.resize(slices.size());
+        for (int i = 0; i < slices.size(); i++)
+            myslicecontexts[i] = createeps(0, 0, slices[i]);
+        myslices = slices;
+    }
+    
+    int numdofs = myA.getainds().count();
+    
+    std::vector<double> myvals = {}, myvecs = {};
+    for (int i = 0; i < slices.size(); i++)
+    {
+        {
+            profilephase phase("eigen");
+            EPSSolve( myslicecontexts[i].get() );
+        }
+        
+        std::vector<double> vals, valsimag, vecs, vecsimag;
+        getsolution(myslicecontexts[i], vals, valsimag, vecs, vecsimag);
+        
+        // The eigenvalues on a slice end are only kept by the slice on their right:
+        bool islastslice = (i == slices.size()-1 && rank == (numslices-1) % numranks);
+        for (int j = 0; j < vals.size(); j++)
+        {
+            if (vals[j] < slices[i][0] || vals[j] > slices[i][1] || (vals[j] == slices[i][1] && islastslice == false))
+                continue;
+            myvals.push_back(vals[j]);
+            myvecs.insert(myvecs.end(), vecs.begin()+j*numdofs, vecs.begin()+(j+1)*numdofs);
+        }
+    }
+    
+    if (isfactorizationreused == false)
+    {
+        myslicecontexts = {};
+        myslices = {};
+    }
+    
+    // Share the eigenpairs with all ranks:
+    std::vector<double> allvals = myvals, allvecs = myvecs;
+    if (numranks > 1)
+    {
+        std::vector<int> numvals = {(int)myvals.size()}, allnumvals(numranks);
+        slmpi::allgather(numvals, allnumvals);
+        
+        std::vector<int> vecsizes(numranks);
+        int totalnumvals = 0;
+        for (int r = 0; r < numranks; r++)
+        {
+            vecsizes[r] = allnumvals[r]*numdofs;
+            totalnumvals += allnumvals[r];
+        }
+        allvals.resize(totalnumvals);
+        allvecs.resize((long long int)totalnumvals*numdofs);
+        
+        slmpi::allgather(myvals, allvals, allnumvals);
+        slmpi::allgather(myvecs, allvecs, vecsizes);
+    }
+    
+    // Sort the eigenvalues in increasing order:
+    std::vector<int> order(allvals.size());
+    for (int i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return allvals[a] < allvals[b]; });
+    
+    int numeigsfound = allvals.size();
+    
+    eigenvaluereal.resize(numeigsfound);
+    eigenvalueimaginary = std::vector<double>(numeigsfound, 0.0);
+    eigenvectorreal.resize(numeigsfound);
+    eigenvectorimaginary.resize(numeigsfound);
+    
+    for (int i = 0; i < numeigsfound; i++)
+    {
+        int cur = order[i];
+        
+        eigenvaluereal[i] = allvals[cur];
+        
+        std::shared_ptr<rawvec> rawr(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+        std::shared_ptr<rawvec> rawi(new rawvec(std::shared_ptr<dofmanager>(new dofmanager(numdofs)))); 
+        vec eigvecr(rawr); vec eigveci(rawi);
+        eigvecr.setallvalues(densemat(numdofs, 1, std::vector<double>(allvecs.begin()+(long long int)cur*numdofs, allvecs.begin()+(long long int)(cur+1)*numdofs)));
+        
+        eigenvectorreal[i] = myA.x0merge(eigvecr);
+        eigenvectorimaginary[i] = myA.x0merge(eigveci);
+    }
+}
+
 int eigenvalue::count(void) { return eigenvaluereal.size(); }
 
 std::vector<double> eigenvalue::geteigenvaluerealpart(void) { return eigenvaluereal; }
@@ -7,6 +7,13 @@
 
 // This object uses the SLEPc library to get the eigenvalues and eigenvectors.
 // More information on SLEPc can be found at http://slepc.upv.es
+//
+// The eigenvalues of a problem A*x = lambda*B*x with symmetric A and B can be computed in an interval.
+// The interval is divided in slices that are distributed over the MPI ranks. Every slice uses its own
+// shift-invert factorizations and the matrix inertia to find all eigenvalues it holds (spectrum slicing).
+// The factorizations can be kept and reused by later calls as long as the matrices are not changed.
+// For very large problems the factorization-free solvers (LOBPCG and Jacobi-Davidson) only apply a
+// preconditioner of A and the eigenvectors can be written to disk as soon as they are obtained.
 
 #ifndef EIGENVALUE_H
 #define EIGENVALUE_H
@@ -18,6 +25,9 @@
 #include "mat.h"
 #include "rawvec.h"
 #include "memory"
+#include "slmpi.h"
+
+struct _p_EPS;
 
 class eigenvalue
 {
@@ -34,6 +44,32 @@ class eigenvalue
         std::vector<vec> eigenvectorreal = {};
         std::vector<vec> eigenvectorimaginary = {};
         
+        // Eigensolver of 'compute' ("krylovschur", "lobpcg" or "jd") and preconditioner of the last two:
+        std::string mysolver = "krylovschur";
+        std::string myprecond = "gamg";
+        
+        // Write the eigenvectors to files starting with this prefix instead of keeping them (if not empty):
+        std::string mystreamprefix = "";
+        
+        // Keep the slepc contexts (and their factorizations) between the calls if true:
+        bool isfactorizationreused = false;
+        // Context of the last 'compute' call and its number of eigenvalues and target:
+        std::shared_ptr<_p_EPS> myeps = NULL;
+        int mynumeigs = -1;
+        double mytarget = 0;
+        // Contexts and intervals of the spectrum slices of this rank:
+        std::vector<std::shared_ptr<_p_EPS>> myslicecontexts = {};
+        std::vector<std::vector<double>> myslices = {};
+        
+        // Create the eigensolver context for the 'numeigs' eigenvalues closest to 'target'
+        // or for all eigenvalues in the interval if 'interval' is not empty:
+        std::shared_ptr<_p_EPS> createeps(int numeigs, double target, std::vector<double> interval = {});
+        
+        // Get the values and eigenvectors (without the Dirichlet constraints) found in a solved context:
+        void getsolution(std::shared_ptr<_p_EPS> eps, std::vector<double>& vals, std::vector<double>& valsimag, std::vector<double>& vecs, std::vector<double>& vecsimag);
+        // Get the values found in a solved context and write the eigenvectors to the files of 'streameigenvectors':
+        void writesolution(std::shared_ptr<_p_EPS> eps);
+        
     public:
 
         // Define a standard eigenvalue problem A*x = lambda*x:
@@ -47,8 +83,33 @@ class eigenvalue
         // inmats[0] + inmats[1]*lambda + inmats[2]*lambda^2 + ...
         eigenvalue(std::vector<mat> inmats);
         
+        // Select the eigensolver used by 'compute' for a standard or generalized problem:
+        //
+        // - "krylovschur" (default) uses a shift-invert transform with a direct factorization
+        // - "lobpcg" finds the smallest eigenvalues of a problem with symmetric A and B (B positive definite), the target is ignored
+        // - "jd" (Jacobi-Davidson) finds the eigenvalues closest to the target
+        //
+        // The last two do not factorize any matrix. They only apply the preconditioner 'precondtype' built on A ("gamg", "hypre",
+        // "pmultigrid", "hmultigrid", "ilu", "sor" or "none", see the iterative 'sl::solve') so that they fit in much less memory.
+        void setsolver(std::string solvertype, std::string precondtype = "gamg");
+        
+        // Write every eigenvector found by 'compute' to disk instead of keeping it in memory ('geteigenvectorrealpart' and
+        // 'geteigenvectorimaginarypart' are then empty). The real part of eigenvector i is written to 'fileprefix' + i + "real.bin"
+        // and its imaginary part (for complex eigenvalues) to 'fileprefix' + i + "imag.bin". They can be read back with 'vec::load'
+        // on a vec of the formulation. An empty prefix keeps the eigenvectors in memory.
+        void streameigenvectors(std::string fileprefix) { mystreamprefix = fileprefix; };
+        
         void compute(int numeigenvaluestocompute, double targeteigenvaluemagnitude = 0.0);
         
+        // Compute all eigenvalues in [lambdamin, lambdamax] for a standard or generalized problem with
+        // symmetric matrices. The interval is split in 'numslices' slices of equal length (one per rank
+        // by default). All ranks get all eigenvalues sorted in increasing order.
+        void computeinterval(double lambdamin, double lambdamax, int numslices = -1);
+        
+        // Keep the factorizations for the next calls with the same number of eigenvalues and target
+        // (or the same interval and slices). The matrices must not be changed in between.
+        void reusefactorization(void) { isfactorizationreused = true; };
+        
         // Get the number of eigs found:
         int count(void);
         
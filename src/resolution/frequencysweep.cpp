@@ -0,0 +1,286 @@
+#include "frequencysweep.h"
+
+
+frequencysweep::frequencysweep(formulation formul, int verbosity)
+{
+    myverbosity = verbosity;
+    myformulation = formul;
+    
+    if (myformulation.isstiffnessmatrixdefined() == false)
+    {
+        std::cout << "Error in 'frequencysweep' object: the formulation has no stiffness matrix" << std::endl;
+        abort();
+    }
+    
+    // The matrices are generated once for all frequencies:
+    myformulation.generate();
+    
+    myK = myformulation.K();
+    if (myformulation.isdampingmatrixdefined())
+        myC = myformulation.C();
+    if (myformulation.ismassmatrixdefined())
+        myM = myformulation.M();
+        
+    std::vector<mat> mats = {myK, myC, myM};
+    for (int i = 0; i < 3; i++)
+    {
+        if (mats[i].isdefined() && mats[i].getpointer()->issymmetric())
+        {
+            std::cout << "Error in 'frequencysweep' object: the block system is not symmetric (matrices in symmetric storage are not allowed)" << std::endl;
+            abort();
+        }
+    }
+    
+    myainds = myK.getainds();
+    mydinds = myK.getdinds();
+    mynumadofs = myainds.count();
+    
+    definestructure();
+    
+    MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, 2*mynumadofs, 2*mynumadofs, myrows.data(), mycols.data(), myblockvals.data(), &myblockmat);
+    
+    PC pc;
+    KSPCreate(PETSC_COMM_SELF, &myksp);
+    KSPSetOperators(myksp, myblockmat, myblockmat);
+    KSPSetFromOptions(myksp);
+    KSPGetPC(myksp, &pc);
+    PCSetType(pc, PCLU);
+    PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+    
+    if (myverbosity > 0)
+        std::cout << "Frequency sweep block system has " << 2*mynumadofs << " unknowns and " << mycols.size() << " nonzeros" << std::endl;
+}
+
+frequencysweep::~frequencysweep(void)
+{
+    // Avoid crashes when destroy is called after PetscFinalize (not allowed).
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+
+    if (ispetscinitialized == PETSC_TRUE)
+    {
+        if (myksp != PETSC_NULL)
+            KSPDestroy(&myksp);
+        if (myblockmat != PETSC_NULL)
+            MatDestroy(&myblockmat);
+    }
+}
+
+void frequencysweep::definestructure(void)
+{
+    int n = mynumadofs;
+    
+    std::vector<mat> mats = {myK, myC, myM};
+    
+    // Columns of every row of K and M (their union) and of C:
+    std::vector<std::vector<PetscInt>> kmcols(n), ccols(n);
+    for (int i = 0; i < 3; i++)
+    {
+        if (mats[i].isdefined() == false)
+            continue;
+            
+        Mat A = mats[i].getapetsc();
+        for (int r = 0; r < n; r++)
+        {
+            PetscInt ncols;
+            const PetscInt* cols;
+            const PetscScalar* vals;
+            MatGetRow(A, r, &ncols, &cols, &vals);
+            
+            std::vector<PetscInt>& rowcols = (i == 1 ? ccols[r] : kmcols[r]);
+            rowcols.insert(rowcols.end(), cols, cols+ncols);
+            for (int c = 0; c < ncols; c++)
+                myvals[i].push_back(vals[c]);
+            
+            MatRestoreRow(A, r, &ncols, &cols, &vals);
+        }
+    }
+    for (int r = 0; r < n; r++)
+    {
+        std::sort(kmcols[r].begin(), kmcols[r].end());
+        kmcols[r].erase(std::unique(kmcols[r].begin(), kmcols[r].end()), kmcols[r].end());
+    }
+    
+    // Upper block row r has the K and M columns then the shifted C columns.
+    // Lower block row r has the C columns then the shifted K and M columns.
+    myrows = std::vector<PetscInt>(2*n+1, 0);
+    for (int r = 0; r < n; r++)
+        myrows[r+1] = myrows[r] + kmcols[r].size() + ccols[r].size();
+    for (int r = 0; r < n; r++)
+        myrows[n+r+1] = myrows[n+r] + kmcols[r].size() + ccols[r].size();
+    
+    mycols = std::vector<PetscInt>(myrows[2*n]);
+    myblockvals = std::vector<double>(myrows[2*n], 0.0);
+    for (int r = 0; r < n; r++)
+    {
+        PetscInt top = myrows[r], bottom = myrows[n+r];
+        for (int c = 0; c < kmcols[r].size(); c++)
+        {
+            mycols[top+c] = kmcols[r][c];
+            mycols[bottom+ccols[r].size()+c] = n+kmcols[r][c];
+        }
+        for (int c = 0; c < ccols[r].size(); c++)
+        {
+            mycols[top+kmcols[r].size()+c] = n+ccols[r][c];
+            mycols[bottom+c] = ccols[r][c];
+        }
+    }
+    
+    // Position of every matrix value in the block values:
+    for (int i = 0; i < 3; i++)
+    {
+        if (mats[i].isdefined() == false)
+            continue;
+            
+        mytopslots[i].resize(myvals[i].size());
+        mybottomslots[i].resize(myvals[i].size());
+            
+        Mat A = mats[i].getapetsc();
+        long long int index = 0;
+        for (int r = 0; r < n; r++)
+        {
+            PetscInt ncols;
+            const PetscInt* cols;
+            MatGetRow(A, r, &ncols, &cols, NULL);
+            
+            for (int c = 0; c < ncols; c++)
+            {
+                if (i == 1)
+                {
+                    PetscInt pos = std::lower_bound(ccols[r].begin(), ccols[r].end(), cols[c]) - ccols[r].begin();
+                    mytopslots[i][index] = myrows[r] + kmcols[r].size() + pos;
+                    mybottomslots[i][index] = myrows[n+r] + pos;
+                }
+                else
+                {
+                    PetscInt pos = std::lower_bound(kmcols[r].begin(), kmcols[r].end(), cols[c]) - kmcols[r].begin();
+                    mytopslots[i][index] = myrows[r] + pos;
+                    mybottomslots[i][index] = myrows[n+r] + ccols[r].size() + pos;
+                }
+                index++;
+            }
+            
+            MatRestoreRow(A, r, &ncols, &cols, NULL);
+        }
+    }
+}
+
+densemat frequencysweep::eliminated(mat& A, vec& b)
+{
+    if (A.isdefined() == false || mydinds.count() == 0)
+        return densemat(mynumadofs, 1, 0.0);
+    
+    densemat output = A.eliminate(b).getallvalues();
+    output.subtract(b.getvalues(myainds));
+    
+    return output;
+}
+
+std::vector<vec> frequencysweep::solve(double frequency, vec bsin, vec bcos)
+{
+    if (bsin.size() != myformulation.countdofs() || bcos.size() != myformulation.countdofs())
+    {
+        std::cout << "Error in 'frequencysweep' object: the rhs vectors do not match the formulation" << std::endl;
+        abort();
+    }
+    
+    int n = mynumadofs;
+    double w = 2.0*3.1415926535897932384*frequency;
+    
+    // Factors of K, C and M in the upper and lower block rows:
+    std::vector<double> topfactors = {1.0, -w, -w*w}, bottomfactors = {1.0, w, -w*w};
+    
+    // Fill the block matrix in place. The state change of the operator triggers a numeric factorization only:
+    PetscScalar* blockvals;
+    MatSeqAIJGetArray(myblockmat, &blockvals);
+    for (long long int i = 0; i < myblockvals.size(); i++)
+        blockvals[i] = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+        double* vals = myvals[i].data();
+        PetscInt* topslots = mytopslots[i].data();
+        PetscInt* bottomslots = mybottomslots[i].data();
+        for (long long int j = 0; j < myvals[i].size(); j++)
+        {
+            blockvals[topslots[j]] += topfactors[i]*vals[j];
+            blockvals[bottomslots[j]] += bottomfactors[i]*vals[j];
+        }
+    }
+    MatSeqAIJRestoreArray(myblockmat, &blockvals);
+    
+    // Move the Dirichlet values to the right handside:
+    densemat rsin = bsin.getvalues(myainds);
+    densemat rcos = bcos.getvalues(myainds);
+    
+    std::vector<densemat> eks = {eliminated(myK, bsin), eliminated(myC, bsin), eliminated(myM, bsin)};
+    std::vector<densemat> ekc = {eliminated(myK, bcos), eliminated(myC, bcos), eliminated(myM, bcos)};
+    
+    double* rsinptr = rsin.getvalues();
+    double* rcosptr = rcos.getvalues();
+    for (int i = 0; i < 3; i++)
+    {
+        double* eksptr = eks[i].getvalues();
+        double* ekcptr = ekc[i].getvalues();
+        for (int j = 0; j < n; j++)
+        {
+            rsinptr[j] += topfactors[i] * (i == 1 ? ekcptr[j] : eksptr[j]);
+            rcosptr[j] += bottomfactors[i] * (i == 1 ? eksptr[j] : ekcptr[j]);
+        }
+    }
+    
+    Vec b, sol;
+    VecCreateSeq(PETSC_COMM_SELF, 2*n, &b);
+    VecDuplicate(b, &sol);
+    
+    PetscScalar* bvals;
+    VecGetArray(b, &bvals);
+    for (int j = 0; j < n; j++)
+    {
+        bvals[j] = rsinptr[j];
+        bvals[n+j] = rcosptr[j];
+    }
+    VecRestoreArray(b, &bvals);
+    
+    KSPSolve(myksp, b, sol);
+    
+    densemat xsinvals(n, 1), xcosvals(n, 1);
+    double* xsinptr = xsinvals.getvalues();
+    double* xcosptr = xcosvals.getvalues();
+    
+    PetscScalar* solvals;
+    VecGetArray(sol, &solvals);
+    for (int j = 0; j < n; j++)
+    {
+        xsinptr[j] = solvals[j];
+        xcosptr[j] = solvals[n+j];
+    }
+    VecRestoreArray(sol, &solvals);
+    
+    VecDestroy(&b);
+    VecDestroy(&sol);
+    
+    // Add the Dirichlet values:
+    vec xsin(myformulation), xcos(myformulation);
+    xsin.setvalues(myainds, xsinvals);
+    xcos.setvalues(myainds, xcosvals);
+    if (mydinds.count() > 0)
+    {
+        xsin.setvalues(mydinds, bsin.getvalues(mydinds));
+        xcos.setvalues(mydinds, bcos.getvalues(mydinds));
+    }
+    
+    return {xsin, xcos};
+}
+
+std::vector<std::vector<vec>> frequencysweep::solve(std::vector<double> frequencies, vec bsin, vec bcos)
+{
+    std::vector<std::vector<vec>> output(frequencies.size());
+    for (int i = 0; i < frequencies.size(); i++)
+    {
+        if (myverbosity > 0)
+            std::cout << "Solving at " << frequencies[i] << " Hz" << std::endl;
+        output[i] = solve(frequencies[i], bsin, bcos);
+    }
+    
+    return output;
+}
@@ -0,0 +1,84 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object solves the harmonic response (K - w^2*M + j*w*C)*x = b of a formulation whose
+// matrices K, C and M are defined with the usual 'dt' and 'dtdt' time derivatives. The response
+// x = xsin*sin(wt) + xcos*cos(wt) is obtained from the real block system
+//
+// [K - w^2*M     -w*C    ] [xsin]   [bsin]
+// [   w*C     K - w^2*M  ] [xcos] = [bcos]
+//
+// The matrices are generated once. The block matrix has a single csr structure filled in place
+// for every frequency and its LU factorization keeps the MUMPS ordering and symbolic analysis:
+// only the numeric factorization is redone at every new frequency.
+// The values of the constrained dofs of 'bsin' and 'bcos' give the sin and cos Dirichlet values.
+
+#ifndef FREQUENCYSWEEP_H
+#define FREQUENCYSWEEP_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "vec.h"
+#include "mat.h"
+#include "formulation.h"
+#include "indexmat.h"
+#include "densemat.h"
+#include "petsc.h"
+#include "petscmat.h"
+#include "petscksp.h"
+
+class frequencysweep
+{
+    private:
+        
+        int myverbosity = 1;
+        
+        formulation myformulation;
+        
+        // The matrices (C and M might be undefined):
+        mat myK, myC, myM;
+        
+        indexmat myainds, mydinds;
+        int mynumadofs = 0;
+        
+        // Values of the unconstrained part of K, C and M in their petsc csr order and position
+        // of each value in the values of the block matrix (in its upper and lower block rows):
+        std::vector<std::vector<double>> myvals = {{}, {}, {}};
+        std::vector<std::vector<PetscInt>> mytopslots = {{}, {}, {}}, mybottomslots = {{}, {}, {}};
+        
+        // Csr structure of the block matrix (the petsc matrix uses these arrays):
+        std::vector<PetscInt> myrows = {}, mycols = {};
+        std::vector<double> myblockvals = {};
+        
+        Mat myblockmat = PETSC_NULL;
+        KSP myksp = PETSC_NULL;
+        
+        // Build the block matrix structure and the slots of every matrix value:
+        void definestructure(void);
+        
+        // Return -D*bd for the constrained values 'bd' of a matrix:
+        densemat eliminated(mat& A, vec& b);
+        
+    public:
+        
+        frequencysweep(formulation formul, int verbosity = 1);
+        ~frequencysweep(void);
+        
+        // The petsc objects cannot be shared:
+        frequencysweep(const frequencysweep&) = delete;
+        frequencysweep& operator=(const frequencysweep&) = delete;
+        
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+        
+        // Get {xsin, xcos} at a given frequency [Hz]:
+        std::vector<vec> solve(double frequency, vec bsin, vec bcos);
+        // Solve at every frequency and return {xsin, xcos} for each:
+        std::vector<std::vector<vec>> solve(std::vector<double> frequencies, vec bsin, vec bcos);
+        
+};
+
+#endif
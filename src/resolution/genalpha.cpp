@@ -98,7 +98,10 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
         abort();
     }
 
-    double inittime = universe::currenttimestep;
+    // The solver statistics of this step are the ones accumulated from here:
+    solverstats statsbefore = solverstats::gettotal();
+
+    double inittime = universe::getsession()->currenttimestep;
 
     // Adaptive timestep:
     bool istadapt = false;
@@ -130,13 +133,18 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
         }
     }
 
+    // Matrices generated in the first nonlinear iteration of the current attempt. After a rejected adaptive timestep the fields
+    // are reset to the same values so the retry reuses them if their state is tracked (only the left matrix is then recombined):
+    mat firstK, firstC, firstM;
+    bool isKreused = false, isCreused = false, isMreused = false;
+    
     // Time-adaptivity loop:
     int nlit;
     vec unext, vnext, anext;
     while (true)
     {
         // Update and print the time:
-        universe::currenttimestep = inittime+dt;
+        universe::getsession()->currenttimestep = inittime+dt;
 
         if (myverbosity > 1 && istadapt)
             std::cout << "@" << inittime << "+" << dt << "s " << std::flush;
@@ -144,11 +152,12 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
             std::cout << "@" << inittime+dt << "s " << std::flush;
     
         // Make all time derivatives available in the universe:
-        universe::xdtxdtdtx = {{},{v},{a}};
+        universe::getsession()->xdtxdtdtx = {{},{v},{a}};
         
         // Nonlinear loop:
         double relchange = 1; nlit = 0;
         unext = u; vnext = v; anext = a;
+        myanderson.clear();
         while (relchange > nltol && (maxnumnlit <= 0 || nlit < maxnumnlit))
         {
             // Solve all formulations that must be solved at the beginning of the nonlinear loop:
@@ -168,25 +177,46 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
                 rhs.updateconstraints();
             if (isconstant[1] == false || isfirstcall)
             {
-                myformulation.generatestiffnessmatrix();
-                K = myformulation.K(false);
+                if (nlit == 0 && isKreused)
+                    K = firstK;
+                else
+                {
+                    myformulation.generatestiffnessmatrix();
+                    K = myformulation.K(false);
+                }
             }
             if (isconstant[2] == false || isfirstcall)
             {
-                myformulation.generatedampingmatrix();
-                C = myformulation.C(false);
+                if (nlit == 0 && isCreused)
+                    C = firstC;
+                else
+                {
+                    myformulation.generatedampingmatrix();
+                    C = myformulation.C(false);
+                }
             }
             if (isconstant[3] == false || isfirstcall)
             {
-                myformulation.generatemassmatrix();
-                M = myformulation.M(false);
+                if (nlit == 0 && isMreused)
+                    M = firstM;
+                else
+                {
+                    myformulation.generatemassmatrix();
+                    M = myformulation.M(false);
+                }
+            }
+            if (nlit == 0)
+            {
+                firstK = K; firstC = C; firstM = M;
             }
             
             // Reuse matrices when possible (including the factorization):
+            bool ismatrixchanged = false;
             if (isconstant[1] == false || isconstant[2] == false || isconstant[3] == false || isfirstcall || defdt != dt || defbeta != beta || defgamma != gamma || defalphaf != alphaf || defalpham != alpham)
             {
                 leftmat = (1.0-alpham)*M + ((1.0-alphaf)*gamma*dt)*C + ((1.0-alphaf)*beta*dt*dt)*K;
                 leftmat.reusefactorization();
+                ismatrixchanged = true;
                 
                 matu = -K;
                 matv = ((alphaf-1.0)*dt)*K-C;
@@ -206,7 +236,37 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
             // Force the acceleration on the constrained dofs:
             rightvec.getpointer()->setvalues(constraintindexes, anextdirichletval);
             
-            anext = sl::solve(leftmat, rightvec);
+            // Prefetch the fully described rhs contributions of the next step (assumed to have the same timestep) during the first solve:
+            std::thread prefetchthread;
+            double curtime = universe::getsession()->currenttimestep;
+            bool isprefetching = (ispipelined && nlit == 0 && not(istadapt) && isconstant[0] == false && myformulation.isrhsprefetchable());
+            if (isprefetching)
+            {
+                // The solve does not use the time:
+                universe::getsession()->currenttimestep = curtime + dt;
+                prefetchthread = universe::newthread([&](){ myformulation.prefetchrhs(); });
+            }
+            
+            // With Jacobian lagging the lagged factorization is used on the residual of the new matrix:
+            vec anextiterate = anext;
+            if (ismatrixchanged && islinear == false && lagthreshold >= 0 && laggedmat.isdefined() && lastrate <= lagthreshold)
+                anext = anext + sl::solve(laggedmat, rightvec - leftmat*anext);
+            else
+            {
+                anext = sl::solve(leftmat, rightvec);
+                if (ismatrixchanged)
+                    lastrate = 0;
+                laggedmat = leftmat;
+            }
+            
+            if (isprefetching)
+            {
+                prefetchthread.join();
+                universe::getsession()->currenttimestep = curtime;
+            }
+            
+            if (islinear == false)
+                anext = myanderson.next(anextiterate, anext);
 
             // Update unext and vnext:
             unext = u + dt*v + ((0.5-beta)*dt*dt)*a + (beta*dt*dt)*anext;
@@ -215,7 +275,10 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
             // Update all fields in the formulation:
             sl::setdata(unext);
             
+            double prevrelchange = relchange;
             relchange = (unext-utolcalc).norm()/unext.norm();
+            if (nlit > 0)
+                lastrate = relchange/prevrelchange;
             
             if (islinear == false && myverbosity > 2)
                 std::cout << relchange << " " << std::flush;
@@ -227,7 +290,7 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
                 tosolveafter[i].solve();
             
             // Make all time derivatives available in the universe:
-            universe::xdtxdtdtx = {{},{vnext},{anext}};
+            universe::getsession()->xdtxdtdtx = {{},{vnext},{anext}};
             
             if (islinear)
                 break;
@@ -254,6 +317,10 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
             else
             {
                 dt *= rfact;
+                // The presolved formulations are solved at the new time before the matrices are generated:
+                isKreused = (tosolvebefore.size() == 0 && myformulation.ismatrixstatetracked(0));
+                isCreused = (tosolvebefore.size() == 0 && myformulation.ismatrixstatetracked(1));
+                isMreused = (tosolvebefore.size() == 0 && myformulation.ismatrixstatetracked(2));
                 // Reset fields for a new resolution:
                 sl::setdata(u);
                 for (int i = 0; i < presols.size(); i++)
@@ -274,10 +341,11 @@ int genalpha::run(bool islinear, double timestep, int maxnumnlit)
     }
     
     if (myverbosity == 1)
-        std::cout << "@" << universe::currenttimestep << "s " << std::flush;
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
     
     v = vnext; a = anext;
-    mytimes.push_back(universe::currenttimestep);
+    mytimes.push_back(universe::getsession()->currenttimestep);
+    mysolverstats.push_back(solverstats::gettotal().since(statsbefore));
     
     return nlit;
 }
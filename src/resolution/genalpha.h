@@ -16,10 +16,12 @@
 
 #include <iostream>
 #include <vector>
+#include <thread>
 #include "vec.h"
 #include "universe.h"
 #include "sl.h"
 #include "formulation.h"
+#include "anderson.h"
 
 class genalpha
 {
@@ -56,6 +58,8 @@ class genalpha
         double dt = -1;
         // All time values stepped-through:
         std::vector<double> mytimes = {};
+        // Solver statistics of every time step:
+        std::vector<solverstats> mysolverstats = {};
         
         // Time-adaptivity settings:
         double mindt = -1, maxdt = -1, tatol = -1, rfact = -1, cfact = -1, cthres = -1;
@@ -68,6 +72,19 @@ class genalpha
         // Parameters for which these objects are defined:
         double defbeta = -1, defgamma = -1, defalphaf = -1, defalpham = -1, defdt = -1;
         
+        // Jacobian lagging: the factorized left matrix is kept across the nonlinear iterations and the time steps
+        // and only refactorized when the convergence rate (ratio of consecutive relative changes) is above the
+        // threshold. A negative threshold refactorizes every time the matrix changes:
+        double lagthreshold = -1;
+        mat laggedmat;
+        double lastrate = 0;
+        
+        // Acceleration of the nonlinear iteration:
+        anderson myanderson;
+        
+        // Generate the fully described rhs contributions of the next step while the current step is solved:
+        bool ispipelined = false;
+        
         int run(bool islinear, double timestep, int maxnumnlit);
         
     public:
@@ -84,6 +101,19 @@ class genalpha
         // Set the tolerance for the inner nonlinear fixed-point iteration:
         void settolerance(double tol) { nltol = tol; };
         
+        // Reuse the factorized left matrix in the nonlinear iterations (modified Newton) until the
+        // convergence rate goes above 'convratethreshold'. This is only used for nonlinear problems:
+        void setjacobianlagging(double convratethreshold = 0.5) { lagthreshold = convratethreshold; };
+        
+        // Use an Anderson acceleration of depth 'depth' in the nonlinear iterations (0 to disable):
+        void setandersonacceleration(int depth) { myanderson = anderson(depth); };
+        
+        // Pipelined time stepping: while the first solve of a time step runs, the rhs contributions fully defined by their
+        // description (no field, port or time dependency) are generated on another thread for the next step, assuming it
+        // has the same timestep (see 'formulation::prefetchrhs'). This is not used with an adaptive timestep or a constant
+        // rhs. The output files can be written in the background with 'universe::setasynchronousoutput'.
+        void setpipelining(bool ispipelinedstepping = true) { ispipelined = ispipelinedstepping; };
+        
         std::vector<vec> gettimederivative(void) { return {v, a}; };
         void settimederivative(std::vector<vec> sol);
         
@@ -93,6 +123,10 @@ class genalpha
         // Count the number of timesteps computed:
         int count(void) { return mytimes.size(); };
         std::vector<double> gettimes(void) { return mytimes; };
+        // Set the times of the timesteps computed (to restore a checkpoint):
+        void settimes(std::vector<double> times) { mytimes = times; };
+        // Get the cost of the linear solves of every timestep computed:
+        std::vector<solverstats> getsolverstats(void) { return mysolverstats; };
         
         // Set the time-adaptivity settings:
         void setadaptivity(double tol, double mints, double maxts, double reffact = 0.5, double coarfact = 2.0, double coarthres = 0.5);
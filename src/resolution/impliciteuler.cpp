@@ -78,7 +78,10 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
         abort();
     }
 
-    double inittime = universe::currenttimestep;
+    // The solver statistics of this step are the ones accumulated from here:
+    solverstats statsbefore = solverstats::gettotal();
+
+    double inittime = universe::getsession()->currenttimestep;
 
     // Adaptive timestep:
     bool istadapt = false;
@@ -110,13 +113,18 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
         }
     }
 
+    // Matrices generated in the first nonlinear iteration of the current attempt. After a rejected adaptive timestep the fields
+    // are reset to the same values so the retry reuses them if their state is tracked (only the left matrix is then recombined):
+    mat firstK, firstC;
+    bool isKreused = false, isCreused = false;
+    
     // Time-adaptivity loop:
     int nlit;
     vec xnext, dtxnext;
     while (true)
     {
         // Update and print the time:
-        universe::currenttimestep = inittime+dt;
+        universe::getsession()->currenttimestep = inittime+dt;
 
         if (myverbosity > 1 && istadapt)
             std::cout << "@" << inittime << "+" << dt << "s " << std::flush;
@@ -124,11 +132,12 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
             std::cout << "@" << inittime+dt << "s " << std::flush;
         
         // Make all time derivatives available in the universe:
-        universe::xdtxdtdtx = {{},{dtx},{}};
+        universe::getsession()->xdtxdtdtx = {{},{dtx},{}};
             
         // Nonlinear loop:
         double relchange = 1; nlit = 0;
         xnext = x; dtxnext = dtx;
+        myanderson.clear();
         while (relchange > nltol && (maxnumnlit <= 0 || nlit < maxnumnlit))
         {
             // Solve all formulations that must be solved at the beginning of the nonlinear loop:
@@ -148,22 +157,38 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
                 rhs.updateconstraints();
             if (isconstant[1] == false || isfirstcall)
             {
-                myformulation.generatestiffnessmatrix();
-                K = myformulation.K(false);
+                if (nlit == 0 && isKreused)
+                    K = firstK;
+                else
+                {
+                    myformulation.generatestiffnessmatrix();
+                    K = myformulation.K(false);
+                }
             }
             if (isconstant[2] == false || isfirstcall)
             {
-                myformulation.generatedampingmatrix();
-                C = myformulation.C(false);
+                if (nlit == 0 && isCreused)
+                    C = firstC;
+                else
+                {
+                    myformulation.generatedampingmatrix();
+                    C = myformulation.C(false);
+                }
+            }
+            if (nlit == 0)
+            {
+                firstK = K; firstC = C;
             }
             
             // Reuse matrices when possible (including the factorization):
+            bool ismatrixchanged = false;
             if (isconstant[1] == false || isconstant[2] == false || isfirstcall || defdt != dt)
             {
                 leftmat = C + dt*K;
                 leftmat.reusefactorization();
                 
                 defdt = dt;
+                ismatrixchanged = true;
             }
             
             // Here are the constrained values of the next solution:
@@ -173,15 +198,49 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
             // Force the solution on the constrained dofs:
             rightvec.getpointer()->setvalues(constraintindexes, xnextdirichletval);
             
+            // Prefetch the fully described rhs contributions of the next step (assumed to have the same timestep) during the first solve:
+            std::thread prefetchthread;
+            double curtime = universe::getsession()->currenttimestep;
+            bool isprefetching = (ispipelined && nlit == 0 && not(istadapt) && isconstant[0] == false && myformulation.isrhsprefetchable());
+            if (isprefetching)
+            {
+                // The solve does not use the time:
+                universe::getsession()->currenttimestep = curtime + dt;
+                prefetchthread = universe::newthread([&](){ myformulation.prefetchrhs(); });
+            }
+            
+            // With Jacobian lagging the lagged factorization is used on the residual of the new matrix:
+            vec solution;
+            if (ismatrixchanged && islinear == false && lagthreshold >= 0 && laggedmat.isdefined() && lastrate <= lagthreshold)
+                solution = xnext + sl::solve(laggedmat, rightvec - leftmat*xnext);
+            else
+            {
+                solution = sl::solve(leftmat, rightvec);
+                if (ismatrixchanged)
+                    lastrate = 0;
+                laggedmat = leftmat;
+            }
+            
+            if (isprefetching)
+            {
+                prefetchthread.join();
+                universe::getsession()->currenttimestep = curtime;
+            }
+            
             // Update the solution xnext.
-            xnext = relaxationfactor * sl::solve(leftmat, rightvec) + (1.0-relaxationfactor)*xnext;
+            xnext = relaxationfactor * solution + (1.0-relaxationfactor)*xnext;
+            if (islinear == false)
+                xnext = myanderson.next(xtolcalc, xnext);
             
             dtxnext = 1.0/dt*(xnext-x);
             
             // Update all fields in the formulation:
             sl::setdata(xnext);
             
+            double prevrelchange = relchange;
             relchange = (xnext-xtolcalc).norm()/xnext.norm();
+            if (nlit > 0)
+                lastrate = relchange/prevrelchange;
             
             if (islinear == false && myverbosity > 2)
                 std::cout << relchange << " " << std::flush;
@@ -193,7 +252,7 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
                 tosolveafter[i].solve();
             
             // Make all time derivatives available in the universe:
-            universe::xdtxdtdtx = {{},{dtxnext},{}};
+            universe::getsession()->xdtxdtdtx = {{},{dtxnext},{}};
             
             if (islinear)
                 break;
@@ -220,6 +279,9 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
             else
             {
                 dt *= rfact;
+                // The presolved formulations are solved at the new time before the matrices are generated:
+                isKreused = (tosolvebefore.size() == 0 && myformulation.ismatrixstatetracked(0));
+                isCreused = (tosolvebefore.size() == 0 && myformulation.ismatrixstatetracked(1));
                 // Reset fields for a new resolution:
                 sl::setdata(x);
                 for (int i = 0; i < presols.size(); i++)
@@ -240,10 +302,11 @@ int impliciteuler::run(bool islinear, double timestep, int maxnumnlit)
     }
     
     if (myverbosity == 1)
-        std::cout << "@" << universe::currenttimestep << "s " << std::flush;
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
     
     dtx = dtxnext;
-    mytimes.push_back(universe::currenttimestep);
+    mytimes.push_back(universe::getsession()->currenttimestep);
+    mysolverstats.push_back(solverstats::gettotal().since(statsbefore));
     
     return nlit;
 }
@@ -0,0 +1,304 @@
+#include "leapfrog.h"
+
+leapfrog::leapfrog(formulation formul, vec initspeed, int verbosity, std::vector<bool> isrhskcmconstant)
+{
+    myverbosity = verbosity;
+    
+    myformulation = formul;
+    if (myformulation.ismassmatrixdefined() == false && myformulation.isdampingmatrixdefined() == false)
+    {
+        std::cout << "Error in 'leapfrog' object: formulation provided must have a mass or a damping matrix" << std::endl;
+        abort();  
+    }
+    
+    v = initspeed;
+    isconstant = isrhskcmconstant;
+    
+    if (isconstant.size() != 4)
+    {
+        std::cout << "Error in 'leapfrog' object: expected a length 4 vector as third argument" << std::endl;
+        abort();  
+    }
+}
+
+void leapfrog::settimederivative(std::vector<vec> sol)
+{
+    if (sol.size() == 0 || sol.size() > 2)
+    {
+        std::cout << "Error in 'leapfrog' object: expected a vector of length 1 or 2 to set the time derivatives" << std::endl;
+        abort();  
+    }
+    
+    v = sol[0];
+    if (sol.size() == 2)
+        a = sol[1];
+    // The previous solution must be recomputed:
+    defdt = -1;
+}
+
+densemat leapfrog::multiply(int KCM, densemat x)
+{
+    if ((KCM == 0 && myformulation.isstiffnessmatrixdefined() == false) || (KCM == 1 && myformulation.isdampingmatrixdefined() == false))
+        return densemat(x.countrows(), 1, 0.0);
+        
+    // Matrix-free product:
+    if (isconstant[KCM+1] == false)
+        return myformulation.multiply(KCM, x);
+    
+    mat& constmat = (KCM == 0 ? K : C);
+    if (constmat.isdefined() == false)
+    {
+        if (KCM == 0)
+        {
+            myformulation.generatestiffnessmatrix();
+            K = myformulation.K(false);
+        }
+        else
+        {
+            myformulation.generatedampingmatrix();
+            C = myformulation.C(false);
+        }
+    }
+    
+    vec xvec(myformulation);
+    xvec.setallvalues(x);
+    
+    return (constmat*xvec).getallvalues();
+}
+
+densemat leapfrog::lump(int KCM)
+{
+    densemat lumped = myformulation.multiply(KCM, densemat(myformulation.countdofs(), 1, 1.0));
+    
+    double* lumpedvals = lumped.getvalues();
+    for (int i = 0; i < lumped.count(); i++)
+    {
+        if (isconstrained[i] == false && lumpedvals[i] <= 0)
+        {
+            std::cout << "Error in 'leapfrog' object: the row sum of the " << (KCM == 1 ? "damping" : "mass") << " matrix is not positive on dof " << i << " and cannot be used as lumped matrix (use lower order form functions)" << std::endl;
+            abort();
+        }
+    }
+    
+    return lumped;
+}
+
+void leapfrog::update(void)
+{
+    bool isfirstcall = (rhs.getpointer() == NULL);
+    
+    if (isfirstcall)
+        isconstrained = myformulation.getdofmanager()->isconstrained();
+    
+    if (isconstant[0] == false || isfirstcall)
+    {
+        myformulation.generaterhs();
+        rhs = myformulation.rhs();
+    }
+    else
+        rhs.updateconstraints();
+    
+    if (myformulation.isdampingmatrixdefined() && (isconstant[2] == false || isfirstcall))
+        clumped = lump(1);
+    if (myformulation.ismassmatrixdefined() && (isconstant[3] == false || isfirstcall))
+        mlumped = lump(2);
+}
+
+void leapfrog::constrain(densemat x)
+{
+    indexmat constraintindexes = myformulation.getdofmanager()->getconstrainedindexes();
+    densemat dirichletvals = rhs.getpointer()->getvalues(constraintindexes);
+    
+    double* xvals = x.getvalues();
+    int* constrvals = constraintindexes.getvalues();
+    double* dirvals = dirichletvals.getvalues();
+    for (int i = 0; i < constraintindexes.count(); i++)
+        xvals[constrvals[i]] = dirvals[i];
+}
+
+densemat leapfrog::getrate(densemat x, densemat v, bool isfirstorder)
+{
+    densemat kx = multiply(0, x);
+    densemat cv;
+    if (isfirstorder == false && myformulation.isdampingmatrixdefined())
+        cv = multiply(1, v);
+    densemat b = rhs.getallvalues();
+    
+    densemat output(x.countrows(), 1, 0.0);
+    
+    double* outvals = output.getvalues();
+    double* kxvals = kx.getvalues();
+    double* bvals = b.getvalues();
+    double* cvvals = (cv.isdefined() ? cv.getvalues() : NULL);
+    double* lumpedvals = (isfirstorder ? clumped.getvalues() : mlumped.getvalues());
+    for (int i = 0; i < output.count(); i++)
+    {
+        if (isconstrained[i])
+            continue;
+        double val = bvals[i] - kxvals[i];
+        if (cvvals != NULL)
+            val -= cvvals[i];
+        outvals[i] = val/lumpedvals[i];
+    }
+    
+    return output;
+}
+
+void leapfrog::next(double timestep)
+{
+    if (timestep <= 0)
+    {
+        std::cout << "Error in 'leapfrog' object: expected a positive timestep" << std::endl;
+        abort();
+    }
+    dt = timestep;
+    
+    if (myverbosity > 1)
+        std::cout << "@" << universe::getsession()->currenttimestep+dt << "s " << std::flush;
+    
+    if (myformulation.ismassmatrixdefined())
+        runsecondorder();
+    else
+        runfirstorder();
+    
+    if (myverbosity == 1)
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
+    
+    mytimes.push_back(universe::getsession()->currenttimestep);
+}
+
+void leapfrog::runsecondorder(void)
+{
+    double inittime = universe::getsession()->currenttimestep;
+    
+    vec x(myformulation);
+    x.setdata();
+    densemat xvals = x.getallvalues();
+    densemat vvals = v.getallvalues();
+    
+    // Make all time derivatives available in the universe:
+    if (a.getpointer() == NULL)
+        a = vec(myformulation);
+    universe::getsession()->xdtxdtdtx = {{},{v},{a}};
+    
+    update();
+    
+    int numdofs = xvals.count();
+    
+    // Initial (or new timestep) start: x(-dt) = x - dt*v + dt^2/2*a.
+    if (defdt != dt)
+    {
+        densemat avals = getrate(xvals, vvals, false);
+        xprev = densemat(numdofs, 1);
+        double* xp = xprev.getvalues(); double* xv = xvals.getvalues(); double* vv = vvals.getvalues(); double* av = avals.getvalues();
+        for (int i = 0; i < numdofs; i++)
+            xp[i] = xv[i] - dt*vv[i] + 0.5*dt*dt*av[i];
+        defdt = dt;
+    }
+    
+    // Central difference (the lumped damping term uses the centered speed):
+    //
+    // (M/dt^2 + C/(2*dt)) * xnext = b - K*x + M/dt^2 * (2*x - xprev) + C/(2*dt) * xprev
+    //
+    densemat kx = multiply(0, xvals);
+    densemat b = rhs.getallvalues();
+    
+    densemat xnext(numdofs, 1, 0.0);
+    double* xn = xnext.getvalues(); double* xv = xvals.getvalues(); double* xp = xprev.getvalues();
+    double* kxv = kx.getvalues(); double* bv = b.getvalues(); double* mv = mlumped.getvalues();
+    double* cv = (clumped.isdefined() ? clumped.getvalues() : NULL);
+    for (int i = 0; i < numdofs; i++)
+    {
+        if (isconstrained[i])
+            continue;
+        double cfact = (cv == NULL ? 0.0 : cv[i]/(2.0*dt));
+        xn[i] = (bv[i] - kxv[i] + mv[i]/(dt*dt)*(2.0*xv[i] - xp[i]) + cfact*xp[i]) / (mv[i]/(dt*dt) + cfact);
+    }
+    
+    // Dirichlet constraints at the next time:
+    universe::getsession()->currenttimestep = inittime+dt;
+    rhs.updateconstraints();
+    constrain(xnext);
+    
+    // Speed and acceleration at the next time (second order accurate):
+    densemat anext(numdofs, 1), vnext(numdofs, 1);
+    double* an = anext.getvalues(); double* vn = vnext.getvalues();
+    for (int i = 0; i < numdofs; i++)
+    {
+        an[i] = (xn[i] - 2.0*xv[i] + xp[i])/(dt*dt);
+        vn[i] = (xn[i] - xv[i])/dt + 0.5*dt*an[i];
+    }
+    
+    xprev = xvals;
+    
+    x.setallvalues(xnext);
+    v = vec(myformulation); v.setallvalues(vnext);
+    a = vec(myformulation); a.setallvalues(anext);
+    
+    sl::setdata(x);
+    universe::getsession()->xdtxdtdtx = {{},{v},{a}};
+}
+
+void leapfrog::runfirstorder(void)
+{
+    double inittime = universe::getsession()->currenttimestep;
+    
+    vec x(myformulation);
+    x.setdata();
+    densemat x0 = x.getallvalues();
+    int numdofs = x0.count();
+    
+    // Strong stability preserving Runge-Kutta 3 (Shu-Osher form) with stages at t, t+dt and t+dt/2:
+    std::vector<double> stagetimes = {inittime, inittime+dt, inittime+0.5*dt};
+    std::vector<double> prevweights = {0.0, 0.75, 1.0/3.0};
+    
+    densemat xstage = x0;
+    vec stagevec(myformulation);
+    for (int s = 0; s < 3; s++)
+    {
+        universe::getsession()->currenttimestep = stagetimes[s];
+        
+        update();
+        constrain(xstage);
+        stagevec.setallvalues(xstage);
+        sl::setdata(stagevec);
+        
+        densemat rate = getrate(xstage, densemat(), true);
+        
+        // Speed at the beginning of the step:
+        if (s == 0)
+        {
+            v = vec(myformulation);
+            v.setallvalues(rate);
+            universe::getsession()->xdtxdtdtx = {{},{v},{}};
+        }
+        
+        densemat xnew(numdofs, 1);
+        double* xnv = xnew.getvalues(); double* x0v = x0.getvalues(); double* xsv = xstage.getvalues(); double* rv = rate.getvalues();
+        for (int i = 0; i < numdofs; i++)
+            xnv[i] = prevweights[s]*x0v[i] + (1.0-prevweights[s])*(xsv[i] + dt*rv[i]);
+        xstage = xnew;
+    }
+    
+    universe::getsession()->currenttimestep = inittime+dt;
+    rhs.updateconstraints();
+    constrain(xstage);
+    
+    x.setallvalues(xstage);
+    sl::setdata(x);
+}
+
+double leapfrog::getstabletimestep(int physreg, expression wavespeed, int interpolationorder, double cfl)
+{
+    int elementdimension = universe::getrawmesh()->getphysicalregions()->get(physreg)->getelementdimension();
+    if (elementdimension <= 0 || interpolationorder <= 0)
+    {
+        std::cout << "Error in 'leapfrog' object: cannot compute a stable timestep on a region of dimension " << elementdimension << " for interpolation order " << interpolationorder << std::endl;
+        abort();
+    }
+    
+    expression elementsize = sl::meshsize(2).pow(1.0/elementdimension);
+    double minratio = (elementsize/wavespeed).min(physreg, 1)[0];
+    
+    return cfl * minratio / (interpolationorder*interpolationorder);
+}
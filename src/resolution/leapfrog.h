@@ -0,0 +1,112 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object implements explicit time stepping with lumped matrices for the problem
+//
+// M*dtdtx + C*dtx + K*x = b 
+//
+// with the central difference (leapfrog) scheme. When the formulation has no mass matrix the
+// problem C*dtx + K*x = b is solved with the three stage strong stability preserving Runge-Kutta
+// scheme. The M and C matrices are replaced by their row sums (they must be positive on all
+// unconstrained dofs) so that no linear system is solved. The K and C products are computed
+// matrix-free unless the matrix is declared constant, in which case it is assembled only once.
+// The timestep must satisfy the stability (CFL) condition, see 'getstabletimestep'.
+
+#ifndef LEAPFROG_H
+#define LEAPFROG_H
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "vec.h"
+#include "universe.h"
+#include "sl.h"
+#include "formulation.h"
+
+class leapfrog
+{
+    private:
+        
+        int myverbosity = 1;
+        
+        formulation myformulation;
+        
+        // Set 'isconstant[i]' to true and the corresponding matrix/vector is 
+        // supposed constant in time and will only be generated once then reused.
+        //
+        // - i = 0 corresponds to the rhs vector
+        // - i = 1 corresponds to the K matrix
+        // - i = 2 corresponds to the C matrix
+        // - i = 3 corresponds to the M matrix
+        //
+        // Note: even if the rhs vector can be reused the Dirichlet
+        // constraints will nevertheless be recomputed at each time step.
+        //
+        std::vector<bool> isconstant = {false, false, false, false};
+        
+        // Current timestep:
+        double dt = -1;
+        // All time values stepped-through:
+        std::vector<double> mytimes = {};
+        
+        // The speed v and acceleration a at the current time step (only v for first order problems):
+        vec v, a;
+        
+        // Solution at the previous time step and the timestep for which it is defined:
+        densemat xprev;
+        double defdt = -1;
+        
+        // Objects required at every timestep (possibly reused):
+        vec rhs; mat K, C;
+        // Lumped C and M matrices (empty if not defined):
+        densemat clumped, mlumped;
+        
+        // Flag the constrained dofs:
+        std::vector<bool> isconstrained = {};
+        
+        // Product of K (KCM = 0) or C (KCM = 1) with the values 'x' of all dofs:
+        densemat multiply(int KCM, densemat x);
+        // Row sums of C (KCM = 1) or M (KCM = 2):
+        densemat lump(int KCM);
+        
+        // Generate the rhs and the lumped matrices at the current time (if not constant):
+        void update(void);
+        // Force the Dirichlet constraints at the current time on 'x':
+        void constrain(densemat x);
+        
+        // Get (b - K*x - C*v) divided by the lumped M (or C if 'isfirstorder') on the unconstrained dofs (0 on the others):
+        densemat getrate(densemat x, densemat v, bool isfirstorder);
+        
+        void runsecondorder(void);
+        void runfirstorder(void);
+        
+    public:
+    
+        leapfrog(formulation formul, vec initspeed, int verbosity = 3, std::vector<bool> isrhskcmconstant = {false, false, false, false});
+    
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+        
+        std::vector<vec> gettimederivative(void) { return {v, a}; };
+        void settimederivative(std::vector<vec> sol);
+        
+        void settimestep(double timestep) { dt = timestep; };
+        double gettimestep(void) { return dt; };
+        
+        // Count the number of timesteps computed:
+        int count(void) { return mytimes.size(); };
+        std::vector<double> gettimes(void) { return mytimes; };
+        // Set the times of the timesteps computed (to restore a checkpoint):
+        void settimes(std::vector<double> times) { mytimes = times; };
+        
+        // Advance the solution by the provided timestep:
+        void next(double timestep);
+        
+        // Stable timestep estimate 'cfl * min(h/c) / p^2' for a wave speed 'c' and an interpolation order 'p'
+        // on the elements of 'physreg'. The element size 'h' is computed from the element measure.
+        static double getstabletimestep(int physreg, expression wavespeed, int interpolationorder, double cfl = 0.5);
+        
+};
+
+#endif
@@ -0,0 +1,122 @@
+#include "multigenalpha.h"
+
+multigenalpha::multigenalpha(formulation formul, std::vector<vec> initsols, std::vector<vec> initspeeds, std::vector<vec> initaccelerations, std::function<void(int)> setloadcase, int verbosity)
+{
+    if (initsols.size() == 0 || initspeeds.size() != initsols.size() || initaccelerations.size() != initsols.size())
+    {
+        std::cout << "Error in 'multigenalpha' object: expected the same nonzero number of initial solutions, speeds and accelerations" << std::endl;
+        abort();
+    }
+
+    myverbosity = verbosity;
+
+    myformulation = formul;
+    mysetloadcase = setloadcase;
+
+    u = initsols;
+    v = initspeeds;
+    a = initaccelerations;
+}
+
+void multigenalpha::setparameter(double rinf)
+{
+    if (rinf < -1e-8)
+    {
+        std::cout << "Error in 'multigenalpha' object: high-frequency dissipation value provided to .setparameter cannot be negative" << std::endl;
+        abort();
+    }
+    if (rinf > 1+1e-8)
+    {
+        std::cout << "Error in 'multigenalpha' object: high-frequency dissipation value provided to .setparameter cannot be larger than one" << std::endl;
+        abort();
+    }
+
+    alphaf = rinf/(rinf+1.0);
+    alpham = (2.0*rinf-1.0)/(rinf+1.0);
+    beta = 0.25*(1.0-alpham+alphaf)*(1.0-alpham+alphaf);
+    gamma = 0.5-alpham+alphaf;
+}
+
+void multigenalpha::next(double timestep)
+{
+    if (timestep <= 0)
+    {
+        std::cout << "Error in 'multigenalpha' object: expected a positive timestep" << std::endl;
+        abort();
+    }
+
+    // The solver statistics of this step are the ones accumulated from here:
+    solverstats statsbefore = solverstats::gettotal();
+
+    double dt = timestep;
+    int numcases = u.size();
+
+    // Update and print the time:
+    universe::getsession()->currenttimestep += dt;
+    if (myverbosity > 0)
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
+
+    // The constant matrices are generated once with the fields of the first load case:
+    if (not(K.isdefined()))
+    {
+        mysetloadcase(0);
+        sl::setdata(u[0]);
+        universe::getsession()->xdtxdtdtx = {{},{v[0]},{a[0]}};
+
+        myformulation.generatestiffnessmatrix();
+        myformulation.generatedampingmatrix();
+        myformulation.generatemassmatrix();
+        K = myformulation.K(false); C = myformulation.C(false); M = myformulation.M(false);
+    }
+
+    // The left matrix and its factorization are only recomputed when the parameters change:
+    if (defdt != dt || defbeta != beta || defgamma != gamma || defalphaf != alphaf || defalpham != alpham)
+    {
+        leftmat = (1.0-alpham)*M + ((1.0-alphaf)*gamma*dt)*C + ((1.0-alphaf)*beta*dt*dt)*K;
+        leftmat.reusefactorization();
+
+        matu = -K;
+        matv = ((alphaf-1.0)*dt)*K-C;
+        mata = ((1.0-alphaf)*(gamma-1.0)*dt)*C+((1.0-alphaf)*(beta-0.5)*dt*dt)*K - alpham*M;
+
+        defdt = dt; defbeta = beta; defgamma = gamma; defalphaf = alphaf; defalpham = alpham;
+    }
+
+    indexmat constraintindexes = myformulation.getdofmanager()->getconstrainedindexes();
+
+    // Right handside of every load case:
+    std::vector<vec> rightvecs(numcases);
+    for (int i = 0; i < numcases; i++)
+    {
+        mysetloadcase(i);
+        sl::setdata(u[i]);
+        universe::getsession()->xdtxdtdtx = {{},{v[i]},{a[i]}};
+
+        myformulation.generaterhs();
+        vec rhs = myformulation.rhs();
+
+        // The acceleration on the Dirichlet constrained dofs leads to the exact constrained displacement (see 'genalpha'):
+        vec anextdirichlet = 1.0/(beta*dt*dt)*( rhs-u[i] - dt*v[i] - dt*dt*(0.5-beta)*a[i] );
+        densemat anextdirichletval = anextdirichlet.getpointer()->getvalues(constraintindexes);
+
+        rightvecs[i] = matu*u[i] + matv*v[i] + mata*a[i] + rhs;
+        rightvecs[i].getpointer()->setvalues(constraintindexes, anextdirichletval);
+    }
+
+    // Single factorization and multi-rhs solve for all load cases:
+    std::vector<vec> anext = sl::solve(leftmat, rightvecs);
+
+    for (int i = 0; i < numcases; i++)
+    {
+        u[i] = u[i] + dt*v[i] + ((0.5-beta)*dt*dt)*a[i] + (beta*dt*dt)*anext[i];
+        v[i] = v[i] + (dt*(1-gamma))*a[i] + (gamma*dt)*anext[i];
+        a[i] = anext[i];
+    }
+
+    // The fields hold the solution of the last load case:
+    sl::setdata(u[numcases-1]);
+    universe::getsession()->xdtxdtdtx = {{},{v[numcases-1]},{a[numcases-1]}};
+
+    mytimes.push_back(universe::getsession()->currenttimestep);
+    mysolverstats.push_back(solverstats::gettotal().since(statsbefore));
+}
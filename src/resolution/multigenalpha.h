@@ -0,0 +1,82 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object implements the generalized alpha method (see 'genalpha') to solve in time the linear problem
+//
+// M*dtdtx + C*dtx + K*x = b_i
+//
+// simultaneously for multiple load cases i with the same constant M, C and K matrices. The matrices are
+// generated once, the left matrix is factorized once (and again only when the timestep changes) and at
+// every timestep all load cases are solved with a single multi-rhs solve.
+//
+// The 'setloadcase' function is called with the load case number before the rhs of that load case is
+// generated (e.g. to set a parameter or a field defining the load). The rhs is generated with the fields
+// holding the solution of the load case. After a timestep the fields hold the solution of the last case.
+
+#ifndef MULTIGENALPHA_H
+#define MULTIGENALPHA_H
+
+#include <iostream>
+#include <vector>
+#include <functional>
+#include "vec.h"
+#include "universe.h"
+#include "sl.h"
+#include "formulation.h"
+
+class multigenalpha
+{
+    private:
+
+        int myverbosity = 1;
+
+        formulation myformulation;
+
+        std::function<void(int)> mysetloadcase;
+
+        // The four parameters for generalized alpha (set to unconditionally stable Newmark by default):
+        double beta = 0.25, gamma = 0.5, alphaf = 0.0, alpham = 0.0;
+
+        // All time values stepped-through:
+        std::vector<double> mytimes = {};
+        // Solver statistics of every time step:
+        std::vector<solverstats> mysolverstats = {};
+
+        // The solution u, speed v and acceleration a of every load case at the current time step:
+        std::vector<vec> u, v, a;
+
+        // Objects reused at every timestep:
+        mat K, C, M, leftmat, matu, matv, mata;
+        // Parameters for which these objects are defined:
+        double defbeta = -1, defgamma = -1, defalphaf = -1, defalpham = -1, defdt = -1;
+
+    public:
+
+        multigenalpha(formulation formul, std::vector<vec> initsols, std::vector<vec> initspeeds, std::vector<vec> initaccelerations, std::function<void(int)> setloadcase, int verbosity = 3);
+
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+
+        // Manually specify all four parameters:
+        void setparameter(double b, double g, double af, double am) { beta = b; gamma = g; alphaf = af; alpham = am; };
+        // Specify a high-frequency dissipation and let the four parameters be optimally deduced:
+        void setparameter(double rinf);
+
+        int countloadcases(void) { return u.size(); };
+
+        std::vector<vec> getsolutions(void) { return u; };
+        std::vector<vec> gettimederivative(int loadcase) { return {v[loadcase], a[loadcase]}; };
+
+        // Count the number of timesteps computed:
+        int count(void) { return mytimes.size(); };
+        std::vector<double> gettimes(void) { return mytimes; };
+        // Get the cost of the linear solves of every timestep computed:
+        std::vector<solverstats> getsolverstats(void) { return mysolverstats; };
+
+        // Advance the solution of all load cases by the provided timestep:
+        void next(double timestep);
+
+};
+
+#endif
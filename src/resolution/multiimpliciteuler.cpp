@@ -0,0 +1,99 @@
+#include "multiimpliciteuler.h"
+
+multiimpliciteuler::multiimpliciteuler(formulation formul, std::vector<vec> initsols, std::vector<vec> initdtxs, std::function<void(int)> setloadcase, int verbosity)
+{
+    if (initsols.size() == 0 || initdtxs.size() != initsols.size())
+    {
+        std::cout << "Error in 'multiimpliciteuler' object: expected the same nonzero number of initial solutions and time derivatives" << std::endl;
+        abort();
+    }
+
+    myverbosity = verbosity;
+
+    myformulation = formul;
+    if (myformulation.ismassmatrixdefined())
+    {
+        std::cout << "Error in 'multiimpliciteuler' object: formulation provided cannot have a mass matrix (use another time resolution algorithm)" << std::endl;
+        abort();
+    }
+    mysetloadcase = setloadcase;
+
+    x = initsols;
+    dtx = initdtxs;
+}
+
+void multiimpliciteuler::next(double timestep)
+{
+    if (timestep <= 0)
+    {
+        std::cout << "Error in 'multiimpliciteuler' object: expected a positive timestep" << std::endl;
+        abort();
+    }
+
+    // The solver statistics of this step are the ones accumulated from here:
+    solverstats statsbefore = solverstats::gettotal();
+
+    double dt = timestep;
+    int numcases = x.size();
+
+    // Update and print the time:
+    universe::getsession()->currenttimestep += dt;
+    if (myverbosity > 0)
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
+
+    // The constant matrices are generated once with the fields of the first load case:
+    if (not(K.isdefined()))
+    {
+        mysetloadcase(0);
+        sl::setdata(x[0]);
+        universe::getsession()->xdtxdtdtx = {{},{dtx[0]},{}};
+
+        myformulation.generatestiffnessmatrix();
+        myformulation.generatedampingmatrix();
+        K = myformulation.K(false); C = myformulation.C(false);
+    }
+
+    // The left matrix and its factorization are only recomputed when the timestep changes:
+    if (defdt != dt)
+    {
+        leftmat = C + dt*K;
+        leftmat.reusefactorization();
+
+        defdt = dt;
+    }
+
+    indexmat constraintindexes = myformulation.getdofmanager()->getconstrainedindexes();
+
+    // Right handside of every load case:
+    std::vector<vec> rightvecs(numcases);
+    for (int i = 0; i < numcases; i++)
+    {
+        mysetloadcase(i);
+        sl::setdata(x[i]);
+        universe::getsession()->xdtxdtdtx = {{},{dtx[i]},{}};
+
+        myformulation.generaterhs();
+        vec rhs = myformulation.rhs();
+
+        // Force the solution on the constrained dofs:
+        densemat xnextdirichletval = rhs.getpointer()->getvalues(constraintindexes);
+        rightvecs[i] = C*x[i]+dt*rhs;
+        rightvecs[i].getpointer()->setvalues(constraintindexes, xnextdirichletval);
+    }
+
+    // Single factorization and multi-rhs solve for all load cases:
+    std::vector<vec> xnext = sl::solve(leftmat, rightvecs);
+
+    for (int i = 0; i < numcases; i++)
+    {
+        dtx[i] = 1.0/dt*(xnext[i]-x[i]);
+        x[i] = xnext[i];
+    }
+
+    // The fields hold the solution of the last load case:
+    sl::setdata(x[numcases-1]);
+    universe::getsession()->xdtxdtdtx = {{},{dtx[numcases-1]},{}};
+
+    mytimes.push_back(universe::getsession()->currenttimestep);
+    mysolverstats.push_back(solverstats::gettotal().since(statsbefore));
+}
@@ -0,0 +1,74 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object implements the implicit Euler method (see 'impliciteuler') to solve in time the linear problem
+//
+// C*dtx + K*x = b_i
+//
+// simultaneously for multiple load cases i with the same constant C and K matrices. The matrices are
+// generated once, the left matrix is factorized once (and again only when the timestep changes) and at
+// every timestep all load cases are solved with a single multi-rhs solve.
+//
+// The 'setloadcase' function is called with the load case number before the rhs of that load case is
+// generated (e.g. to set a parameter or a field defining the load). The rhs is generated with the fields
+// holding the solution of the load case. After a timestep the fields hold the solution of the last case.
+
+#ifndef MULTIIMPLICITEULER_H
+#define MULTIIMPLICITEULER_H
+
+#include <iostream>
+#include <vector>
+#include <functional>
+#include "vec.h"
+#include "universe.h"
+#include "sl.h"
+#include "formulation.h"
+
+class multiimpliciteuler
+{
+    private:
+
+        int myverbosity = 1;
+
+        formulation myformulation;
+
+        std::function<void(int)> mysetloadcase;
+
+        // All time values stepped-through:
+        std::vector<double> mytimes = {};
+        // Solver statistics of every time step:
+        std::vector<solverstats> mysolverstats = {};
+
+        // The solution x and its time derivative dtx of every load case at the current time step:
+        std::vector<vec> x, dtx;
+
+        // Objects reused at every timestep:
+        mat K, C, leftmat;
+        // Timestep for which the left matrix is defined:
+        double defdt = -1;
+
+    public:
+
+        multiimpliciteuler(formulation formul, std::vector<vec> initsols, std::vector<vec> initdtxs, std::function<void(int)> setloadcase, int verbosity = 3);
+
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+
+        int countloadcases(void) { return x.size(); };
+
+        std::vector<vec> getsolutions(void) { return x; };
+        vec gettimederivative(int loadcase) { return dtx[loadcase]; };
+
+        // Count the number of timesteps computed:
+        int count(void) { return mytimes.size(); };
+        std::vector<double> gettimes(void) { return mytimes; };
+        // Get the cost of the linear solves of every timestep computed:
+        std::vector<solverstats> getsolverstats(void) { return mysolverstats; };
+
+        // Advance the solution of all load cases by the provided timestep:
+        void next(double timestep);
+
+};
+
+#endif
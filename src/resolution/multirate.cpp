@@ -0,0 +1,155 @@
+#include "multirate.h"
+
+
+multirate::multirate(std::vector<formulation> formuls, std::vector<std::vector<vec>> inittimederivatives, std::vector<int> numsubsteps, int verbosity)
+{
+    myverbosity = verbosity;
+    myformulations = formuls;
+    mynumsubsteps = numsubsteps;
+
+    int numformuls = myformulations.size();
+
+    if (numformuls == 0)
+    {
+        std::cout << "Error in 'multirate' object: expected at least one formulation" << std::endl;
+        abort();
+    }
+    if (inittimederivatives.size() != numformuls || numsubsteps.size() != numformuls)
+    {
+        std::cout << "Error in 'multirate' object: expected one initial time derivative list and one number of substeps per formulation" << std::endl;
+        abort();
+    }
+
+    myies = std::vector<std::shared_ptr<impliciteuler>>(numformuls, NULL);
+    mygas = std::vector<std::shared_ptr<genalpha>>(numformuls, NULL);
+    for (int i = 0; i < numformuls; i++)
+    {
+        setnumsubsteps(i, numsubsteps[i]);
+
+        bool issecondorder = myformulations[i].ismassmatrixdefined();
+        if (inittimederivatives[i].size() != (issecondorder ? 2 : 1))
+        {
+            std::cout << "Error in 'multirate' object: expected " << (issecondorder ? 2 : 1) << " initial time derivative vector(s) for formulation " << i << std::endl;
+            abort();
+        }
+
+        // The substeps are not printed:
+        if (issecondorder)
+            mygas[i] = std::shared_ptr<genalpha>(new genalpha(myformulations[i], inittimederivatives[i][0], inittimederivatives[i][1], 0));
+        else
+            myies[i] = std::shared_ptr<impliciteuler>(new impliciteuler(myformulations[i], inittimederivatives[i][0], 0));
+    }
+
+    mystartstates = std::vector<vec>(numformuls);
+    myendstates = std::vector<vec>(numformuls);
+    myprevstates = std::vector<vec>(numformuls);
+}
+
+void multirate::setcoupling(std::string coupling)
+{
+    if (coupling != "constant" && coupling != "linear")
+    {
+        std::cout << "Error in 'multirate' object: unknown coupling '" << coupling << "' (use 'constant' or 'linear')" << std::endl;
+        abort();
+    }
+    mycoupling = coupling;
+}
+
+void multirate::setnumsubsteps(int i, int numsubsteps)
+{
+    if (i < 0 || i >= myformulations.size())
+    {
+        std::cout << "Error in 'multirate' object: formulation " << i << " does not exist" << std::endl;
+        abort();
+    }
+    if (numsubsteps < 1)
+    {
+        std::cout << "Error in 'multirate' object: expected at least one substep per macro step" << std::endl;
+        abort();
+    }
+    mynumsubsteps[i] = numsubsteps;
+}
+
+void multirate::setcoupledfields(int j, int current, double theta, double dt)
+{
+    vec value = mystartstates[j];
+
+    // The formulation was already advanced over the macro step:
+    if (j < current)
+    {
+        if (mycoupling == "linear")
+            value = (1.0-theta)*mystartstates[j] + theta*myendstates[j];
+        else
+            value = myendstates[j];
+    }
+    // Extrapolate from the previous macro step (if any):
+    if (j > current && mycoupling == "linear" && myprevdt > 0)
+        value = mystartstates[j] + (theta*dt/myprevdt)*(mystartstates[j] - myprevstates[j]);
+
+    sl::setdata(value);
+}
+
+void multirate::next(double timestep, int maxnumnlit)
+{
+    int numformuls = myformulations.size();
+    double starttime = universe::getsession()->currenttimestep;
+
+    for (int i = 0; i < numformuls; i++)
+    {
+        mystartstates[i] = vec(myformulations[i]);
+        mystartstates[i].setdata();
+    }
+
+    for (int i = 0; i < numformuls; i++)
+    {
+        int numsubsteps = mynumsubsteps[i];
+        double dt = timestep/numsubsteps;
+
+        universe::getsession()->currenttimestep = starttime;
+        for (int k = 0; k < numsubsteps; k++)
+        {
+            // The other fields are set at the time of the end of the substep:
+            double theta = (k+1.0)/numsubsteps;
+            for (int j = 0; j < numformuls; j++)
+            {
+                if (j != i && numformuls > 1)
+                    setcoupledfields(j, i, theta, timestep);
+            }
+
+            if (myies[i] != NULL)
+            {
+                if (maxnumnlit < 0)
+                    myies[i]->next(dt);
+                else
+                    myies[i]->next(dt, maxnumnlit);
+            }
+            else
+            {
+                if (maxnumnlit < 0)
+                    mygas[i]->next(dt);
+                else
+                    mygas[i]->next(dt, maxnumnlit);
+            }
+        }
+
+        myendstates[i] = vec(myformulations[i]);
+        myendstates[i].setdata();
+    }
+
+    // All fields hold their value at the end of the macro step:
+    for (int i = 0; i < numformuls; i++)
+        sl::setdata(myendstates[i]);
+    // Avoid accumulating the round-off on the time:
+    universe::getsession()->currenttimestep = starttime + timestep;
+
+    myprevstates = mystartstates;
+    myprevdt = timestep;
+
+    if (myverbosity > 0)
+    {
+        std::cout << "@" << universe::getsession()->currenttimestep << "s multirate step with substeps";
+        for (int i = 0; i < numformuls; i++)
+            std::cout << " " << mynumsubsteps[i];
+        std::cout << std::endl;
+    }
+}
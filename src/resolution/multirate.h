@@ -0,0 +1,84 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object advances coupled formulations in time with a different time step for each of them.
+// Every macro time step is split in 'numsubsteps[i]' equal substeps for formulation i, which is
+// solved with 'impliciteuler' (C*dtx + K*x = b) or 'genalpha' (M*dtdtx + C*dtx + K*x = b). The
+// formulations are advanced one after the other over the whole macro step, in the order provided.
+// Every formulation must have its own fields (a field cannot have dofs in several formulations).
+//
+// While a formulation is advanced the fields of the other formulations are set at the time of
+// the current substep according to the coupling mode:
+//
+// - "constant": the fields keep their latest values (at the end of the macro step for the
+//   formulations already advanced and at its beginning for the others)
+// - "linear": the fields of the formulations already advanced are linearly interpolated between
+//   the beginning and the end of the macro step. The fields of the other formulations are linearly
+//   extrapolated from the previous macro step.
+//
+// Put the slow physics first with the "linear" coupling so that the fast physics sees an
+// interpolated slow solution on its substeps.
+
+#ifndef MULTIRATE_H
+#define MULTIRATE_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "vec.h"
+#include "universe.h"
+#include "sl.h"
+#include "formulation.h"
+#include "impliciteuler.h"
+#include "genalpha.h"
+
+class multirate
+{
+    private:
+
+        int myverbosity = 1;
+
+        std::vector<formulation> myformulations = {};
+        std::vector<int> mynumsubsteps = {};
+
+        std::string mycoupling = "linear";
+
+        // One time stepper per formulation (the other one is NULL):
+        std::vector<std::shared_ptr<impliciteuler>> myies = {};
+        std::vector<std::shared_ptr<genalpha>> mygas = {};
+
+        // Solution of every formulation at the beginning and end of the current macro step and at the beginning
+        // of the previous one (for the extrapolation). The previous macro step length is negative if there is none:
+        std::vector<vec> mystartstates = {}, myendstates = {}, myprevstates = {};
+        double myprevdt = -1;
+
+        // Set the fields of formulation 'j' to their value at 'theta' (in [0,1]) of the macro step of length 'dt'
+        // while formulation 'current' is advanced:
+        void setcoupledfields(int j, int current, double theta, double dt);
+
+    public:
+
+        // The initial time derivatives of formulation i are {dtx} for a first order problem and {v, a} otherwise:
+        multirate(std::vector<formulation> formuls, std::vector<std::vector<vec>> inittimederivatives, std::vector<int> numsubsteps, int verbosity = 1);
+
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+
+        // Set the coupling mode between the formulations ("constant" or "linear"):
+        void setcoupling(std::string coupling);
+
+        // Change the number of substeps per macro step of formulation 'i':
+        void setnumsubsteps(int i, int numsubsteps);
+
+        // Access the time stepper of formulation 'i' to change its settings (NULL if it is not that type of stepper):
+        std::shared_ptr<impliciteuler> getimpliciteuler(int i) { return myies[i]; };
+        std::shared_ptr<genalpha> getgenalpha(int i) { return mygas[i]; };
+
+        // Advance all formulations by the macro time step. Set 'maxnumnlit' to -1 for linear problems
+        // and to the maximum number of nonlinear iterations per substep otherwise (0 for no limit).
+        void next(double timestep, int maxnumnlit = -1);
+
+};
+
+#endif
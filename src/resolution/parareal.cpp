@@ -0,0 +1,195 @@
+#include "parareal.h"
+
+
+parareal::parareal(formulation formul, std::vector<vec> inittimederivatives, int numcoarsesteps, int numfinesteps, int verbosity, std::vector<bool> isrhskcmconstant)
+{
+    myverbosity = verbosity;
+    myformulation = formul;
+    issecondorder = myformulation.ismassmatrixdefined();
+    mytimederivatives = inittimederivatives;
+    
+    if (numcoarsesteps < 1 || numfinesteps < 1)
+    {
+        std::cout << "Error in 'parareal' object: expected at least one coarse and one fine time step per slice" << std::endl;
+        abort();
+    }
+    mynumcoarsesteps = numcoarsesteps;
+    mynumfinesteps = numfinesteps;
+    
+    if (isrhskcmconstant.size() != 4)
+    {
+        std::cout << "Error in 'parareal' object: expected a length 4 vector as last argument" << std::endl;
+        abort();  
+    }
+    if (inittimederivatives.size() != (issecondorder ? 2 : 1))
+    {
+        std::cout << "Error in 'parareal' object: expected " << (issecondorder ? 2 : 1) << " initial time derivative vector(s)" << std::endl;
+        abort();  
+    }
+    
+    if (issecondorder)
+    {
+        mycoarsega = std::shared_ptr<genalpha>(new genalpha(myformulation, inittimederivatives[0], inittimederivatives[1], 0, isrhskcmconstant));
+        myfinega = std::shared_ptr<genalpha>(new genalpha(myformulation, inittimederivatives[0], inittimederivatives[1], 0, isrhskcmconstant));
+        mycoarsega->setparameter(0.0);
+    }
+    else
+    {
+        std::vector<bool> isrhskcconstant = {isrhskcmconstant[0], isrhskcmconstant[1], isrhskcmconstant[2]};
+        mycoarseie = std::shared_ptr<impliciteuler>(new impliciteuler(myformulation, inittimederivatives[0], 0, isrhskcconstant));
+        myfineie = std::shared_ptr<impliciteuler>(new impliciteuler(myformulation, inittimederivatives[0], 0, isrhskcconstant));
+    }
+}
+
+std::vector<double> parareal::getstate(void)
+{
+    int numdofs = countdofs();
+    
+    vec x(myformulation);
+    x.setdata();
+    
+    std::vector<vec> vecs = {x};
+    for (int i = 0; i < mytimederivatives.size(); i++)
+        vecs.push_back(mytimederivatives[i]);
+    
+    std::vector<double> state(vecs.size()*numdofs);
+    for (int i = 0; i < vecs.size(); i++)
+    {
+        densemat vals = vecs[i].getallvalues();
+        double* valsptr = vals.getvalues();
+        for (int j = 0; j < numdofs; j++)
+            state[i*numdofs+j] = valsptr[j];
+    }
+    
+    return state;
+}
+
+void parareal::setstate(std::vector<double>& state)
+{
+    int numdofs = countdofs();
+    
+    std::vector<vec> vecs(state.size()/numdofs);
+    for (int i = 0; i < vecs.size(); i++)
+    {
+        vecs[i] = vec(myformulation);
+        vecs[i].setallvalues(densemat(numdofs, 1, std::vector<double>(state.begin()+i*numdofs, state.begin()+(i+1)*numdofs)));
+    }
+    
+    sl::setdata(vecs[0]);
+    mytimederivatives = std::vector<vec>(vecs.begin()+1, vecs.end());
+}
+
+std::vector<double> parareal::propagate(std::vector<double> state, double t0, double t1, bool isfine, int maxnumnlit)
+{
+    universe::getsession()->currenttimestep = t0;
+    setstate(state);
+    
+    int numsteps = (isfine ? mynumfinesteps : mynumcoarsesteps);
+    double dt = (t1-t0)/numsteps;
+    
+    if (issecondorder)
+    {
+        std::shared_ptr<genalpha> ga = (isfine ? myfinega : mycoarsega);
+        ga->settimederivative(mytimederivatives);
+        for (int i = 0; i < numsteps; i++)
+        {
+            if (maxnumnlit < 0)
+                ga->next(dt);
+            else
+                ga->next(dt, maxnumnlit);
+        }
+        mytimederivatives = ga->gettimederivative();
+    }
+    else
+    {
+        std::shared_ptr<impliciteuler> ie = (isfine ? myfineie : mycoarseie);
+        ie->settimederivative(mytimederivatives[0]);
+        for (int i = 0; i < numsteps; i++)
+        {
+            if (maxnumnlit < 0)
+                ie->next(dt);
+            else
+                ie->next(dt, maxnumnlit);
+        }
+        mytimederivatives = {ie->gettimederivative()};
+    }
+    // Avoid accumulating the round-off on the time:
+    universe::getsession()->currenttimestep = t1;
+    
+    return getstate();
+}
+
+int parareal::run(double endtime, int maxnumit, int maxnumnlit)
+{
+    int numranks = slmpi::count();
+    int rank = slmpi::getrank();
+    
+    double starttime = universe::getsession()->currenttimestep;
+    if (endtime <= starttime)
+    {
+        std::cout << "Error in 'parareal' object: the end time must be larger than the current time" << std::endl;
+        abort();
+    }
+    
+    double slicelength = (endtime-starttime)/numranks;
+    double slicestart = starttime + rank*slicelength;
+    double sliceend = (rank == numranks-1 ? endtime : slicestart + slicelength);
+    
+    std::vector<double> initstate = getstate();
+    int statesize = initstate.size();
+    
+    // Initial guess with a (redundant) coarse propagation up to the beginning of the slice:
+    std::vector<double> startstate = initstate;
+    for (int r = 0; r < rank; r++)
+        startstate = propagate(startstate, starttime + r*slicelength, starttime + (r+1)*slicelength, false, maxnumnlit);
+    std::vector<double> coarseend = propagate(startstate, slicestart, sliceend, false, maxnumnlit);
+    std::vector<double> endstate = coarseend;
+    
+    int numit = 0;
+    while (true)
+    {
+        // Fine propagation on all slices in parallel:
+        std::vector<double> fineend = propagate(startstate, slicestart, sliceend, true, maxnumnlit);
+        
+        // Coarse correction passed from rank to rank (the first slice start never changes):
+        if (rank > 0)
+            slmpi::receive(rank-1, numit, startstate);
+        
+        std::vector<double> newcoarseend = propagate(startstate, slicestart, sliceend, false, maxnumnlit);
+        std::vector<double> newendstate(statesize);
+        for (int i = 0; i < statesize; i++)
+            newendstate[i] = newcoarseend[i] + fineend[i] - coarseend[i];
+        
+        if (rank < numranks-1)
+            slmpi::send(rank+1, numit, newendstate);
+            
+        // Relative change of the slice end state:
+        double diffnorm = 0, norm = 0;
+        for (int i = 0; i < statesize; i++)
+        {
+            diffnorm += std::pow(newendstate[i]-endstate[i], 2);
+            norm += newendstate[i]*newendstate[i];
+        }
+        std::vector<double> relchange = {std::sqrt(diffnorm/std::max(norm, 1e-300))};
+        slmpi::max(relchange);
+        
+        coarseend = newcoarseend;
+        endstate = newendstate;
+        numit++;
+        
+        if (myverbosity > 0 && rank == 0)
+            std::cout << "Parareal iteration " << numit << ": relative change " << relchange[0] << std::endl;
+        
+        // After 'numranks' iterations the solution is the sequential fine one:
+        if (relchange[0] <= mytol || numit >= numranks || (maxnumit > 0 && numit >= maxnumit))
+            break;
+    }
+    
+    // All ranks get the solution at the end time:
+    if (numranks > 1)
+        slmpi::broadcast(numranks-1, endstate);
+    universe::getsession()->currenttimestep = endtime;
+    setstate(endstate);
+    
+    return numit;
+}
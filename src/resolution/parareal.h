@@ -0,0 +1,84 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object implements the parareal algorithm to solve a transient problem in parallel in time.
+// The time interval is split in one slice per MPI rank. At every parareal iteration each rank
+// propagates the state at the beginning of its slice with the accurate (fine) propagator while
+// the coarse propagator corrections are passed from rank to rank:
+//
+// U[n+1](k+1) = G(U[n](k+1)) + F(U[n](k)) - G(U[n](k))
+//
+// The problem C*dtx + K*x = b is propagated with 'impliciteuler' and M*dtdtx + C*dtx + K*x = b with
+// 'genalpha' (with maximum high frequency dissipation for the coarse propagator). The coarse and fine
+// propagators use respectively 'numcoarsesteps' and 'numfinesteps' equal time steps per slice.
+// The state propagated includes the time derivatives. Every rank must hold the whole problem.
+
+#ifndef PARAREAL_H
+#define PARAREAL_H
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include "vec.h"
+#include "universe.h"
+#include "sl.h"
+#include "slmpi.h"
+#include "formulation.h"
+#include "impliciteuler.h"
+#include "genalpha.h"
+
+class parareal
+{
+    private:
+        
+        int myverbosity = 1;
+        
+        formulation myformulation;
+        
+        // True for M*dtdtx + C*dtx + K*x = b:
+        bool issecondorder = false;
+        
+        int mynumcoarsesteps = 1, mynumfinesteps = 10;
+        
+        // Convergence tolerance on the relative change of the slice end states:
+        double mytol = 1e-6;
+        
+        // Time derivatives at the current time ({dtx} or {v, a}):
+        std::vector<vec> mytimederivatives = {};
+        
+        // The coarse and fine propagators (their factorizations are reused across the slices):
+        std::shared_ptr<impliciteuler> mycoarseie = NULL, myfineie = NULL;
+        std::shared_ptr<genalpha> mycoarsega = NULL, myfinega = NULL;
+        
+        int countdofs(void) { return myformulation.countdofs(); };
+        
+        // The state is the concatenation of the dof values and of their time derivatives:
+        std::vector<double> getstate(void);
+        void setstate(std::vector<double>& state);
+        
+        // Propagate the state from time 't0' to 't1':
+        std::vector<double> propagate(std::vector<double> state, double t0, double t1, bool isfine, int maxnumnlit);
+        
+    public:
+        
+        // The time derivatives at the initial time are {dtx} for first order problems and {v, a} otherwise:
+        parareal(formulation formul, std::vector<vec> inittimederivatives, int numcoarsesteps, int numfinesteps, int verbosity = 1, std::vector<bool> isrhskcmconstant = {false, false, false, false});
+        
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+        
+        void settolerance(double tol) { mytol = tol; };
+        
+        std::vector<vec> gettimederivative(void) { return mytimederivatives; };
+        
+        // Solve from the current time 'universe::getsession()->currenttimestep' to 'endtime'. At most 'maxnumit' parareal iterations
+        // are performed (no limit if negative). Set 'maxnumnlit' to -1 for a linear problem and to the maximum number
+        // of nonlinear iterations otherwise (0 for no limit). On all ranks the fields hold the solution at 'endtime'
+        // at the end. The number of parareal iterations is returned.
+        int run(double endtime, int maxnumit = -1, int maxnumnlit = -1);
+        
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include "portschur.h"
+#include "wallclock.h"
+#include "universe.h"
+
+
+portschur::portschur(mat A, int verbosity)
+{
+    myverbosity = verbosity;
+    myA = A;
+
+    if (myA.getpointer() == NULL || myA.getpointer()->ismatrixfree())
+    {
+        std::cout << "Error in 'portschur' object: expected an assembled matrix" << std::endl;
+        abort();
+    }
+
+    wallclock clk;
+
+    // Reduced index of every unconstrained dof:
+    std::shared_ptr<dofmanager> dm = myA.getpointer()->getdofmanager();
+    indexmat ainds = myA.getainds();
+    int* aindsptr = ainds.getvalues();
+    std::vector<int> reducedindex(dm->countdofs(), -1);
+    for (int i = 0; i < ainds.count(); i++)
+        reducedindex[aindsptr[i]] = i;
+
+    std::vector<rawport*> rps;
+    indexmat portinds;
+    dm->getportsinds(rps, portinds);
+    int* portindsptr = portinds.getvalues();
+
+    std::vector<bool> isport(ainds.count(), false);
+    for (int i = 0; i < portinds.count(); i++)
+    {
+        if (reducedindex[portindsptr[i]] >= 0)
+            isport[reducedindex[portindsptr[i]]] = true;
+    }
+    for (int i = 0; i < ainds.count(); i++)
+    {
+        if (isport[i])
+            mypinds.push_back(i);
+        else
+            myfinds.push_back(i);
+    }
+
+    if (mypinds.size() == 0)
+    {
+        std::cout << "Error in 'portschur' object: the matrix has no unconstrained port dof" << std::endl;
+        abort();
+    }
+
+    ISCreateGeneral(PETSC_COMM_SELF, myfinds.size(), myfinds.data(), PETSC_USE_POINTER, &myfis);
+    ISCreateGeneral(PETSC_COMM_SELF, mypinds.size(), mypinds.data(), PETSC_USE_POINTER, &mypis);
+
+    // The symmetric and block storages do not allow to extract off-diagonal blocks:
+    Mat Aaij;
+    MatConvert(myA.getapetsc(), MATSEQAIJ, MAT_INITIAL_MATRIX, &Aaij);
+
+    MatCreateSubMatrix(Aaij, myfis, myfis, MAT_INITIAL_MATRIX, &myAff);
+
+    PC pc;
+    KSPCreate(PETSC_COMM_SELF, &myksp);
+    KSPSetOperators(myksp, myAff, myAff);
+    KSPSetFromOptions(myksp);
+    KSPGetPC(myksp, &pc);
+    if (myA.getpointer()->issymmetric())
+        PCSetType(pc, PCCHOLESKY);
+    else
+        PCSetType(pc, PCLU);
+    PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+    universe::configuremumps(pc);
+    PCSetUp(pc);
+
+    // Y = inv(Aff)*Afp with one solve per port:
+    Mat Afp, factoredAff;
+    MatCreateSubMatrix(Aaij, myfis, mypis, MAT_INITIAL_MATRIX, &Afp);
+    MatConvert(Afp, MATSEQDENSE, MAT_INPLACE_MATRIX, &Afp);
+    MatCreateSeqDense(PETSC_COMM_SELF, myfinds.size(), mypinds.size(), NULL, &myY);
+    PCFactorGetMatrix(pc, &factoredAff);
+    MatMatSolve(factoredAff, Afp, myY);
+    MatDestroy(&Afp);
+
+    factorizeschur(Aaij);
+    MatDestroy(&Aaij);
+
+    if (myverbosity > 0)
+        clk.print("Eliminated " + std::to_string(mypinds.size()) + " port dofs from " + std::to_string(ainds.count()) + " unknowns in");
+}
+
+portschur::~portschur(void)
+{
+    destroy();
+}
+
+void portschur::destroy(void)
+{
+    // Avoid crashes when destroy is called after PetscFinalize (not allowed).
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+
+    if (ispetscinitialized == PETSC_TRUE)
+    {
+        if (myksp != PETSC_NULL)
+            KSPDestroy(&myksp);
+        if (myAff != PETSC_NULL)
+            MatDestroy(&myAff);
+        if (myY != PETSC_NULL)
+            MatDestroy(&myY);
+        if (myApf != PETSC_NULL)
+            MatDestroy(&myApf);
+        if (myS != PETSC_NULL)
+            MatDestroy(&myS);
+        if (myfis != PETSC_NULL)
+            ISDestroy(&myfis);
+        if (mypis != PETSC_NULL)
+            ISDestroy(&mypis);
+    }
+}
+
+void portschur::factorizeschur(Mat Aaij)
+{
+    if (myApf != PETSC_NULL)
+        MatDestroy(&myApf);
+    if (myS != PETSC_NULL)
+        MatDestroy(&myS);
+
+    MatCreateSubMatrix(Aaij, mypis, myfis, MAT_INITIAL_MATRIX, &myApf);
+
+    // S = App - Apf*Y:
+    Mat ApfY;
+    MatCreateSubMatrix(Aaij, mypis, mypis, MAT_INITIAL_MATRIX, &myS);
+    MatConvert(myS, MATSEQDENSE, MAT_INPLACE_MATRIX, &myS);
+    MatMatMult(myApf, myY, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &ApfY);
+    MatAXPY(myS, -1.0, ApfY, SAME_NONZERO_PATTERN);
+    MatDestroy(&ApfY);
+
+    MatFactorInfo info;
+    MatFactorInfoInitialize(&info);
+    MatLUFactor(myS, NULL, NULL, &info);
+}
+
+void portschur::updateports(mat A)
+{
+    if (A.getpointer() == NULL || A.countrows() != myA.countrows() || A.getainds().count() != myfinds.size()+mypinds.size())
+    {
+        std::cout << "Error in 'portschur' object: in 'updateports' the matrix does not match the initial one" << std::endl;
+        abort();
+    }
+    myA = A;
+
+    Mat Aaij;
+    MatConvert(myA.getapetsc(), MATSEQAIJ, MAT_INITIAL_MATRIX, &Aaij);
+    factorizeschur(Aaij);
+    MatDestroy(&Aaij);
+}
+
+vec portschur::solve(vec b)
+{
+    if (b.getpointer() == NULL || myA.countrows() != b.size())
+    {
+        std::cout << "Error in 'portschur' object: size of A and b do not match" << std::endl;
+        abort();
+    }
+
+    int numf = myfinds.size(), nump = mypinds.size();
+
+    vec breduced = myA.eliminate(b);
+    densemat bvals = breduced.getallvalues();
+    double* bvalsptr = bvals.getvalues();
+
+    densemat bf(numf, 1), bp(nump, 1), xf(numf, 1), xp(nump, 1), tmpp(nump, 1), tmpf(numf, 1);
+    double* bfptr = bf.getvalues();
+    double* bpptr = bp.getvalues();
+    for (int i = 0; i < numf; i++)
+        bfptr[i] = bvalsptr[myfinds[i]];
+    for (int i = 0; i < nump; i++)
+        bpptr[i] = bvalsptr[mypinds[i]];
+
+    Vec bfvec, bpvec, xfvec, xpvec, tmppvec, tmpfvec;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numf, bfptr, &bfvec);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, nump, bpptr, &bpvec);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numf, xf.getvalues(), &xfvec);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, nump, xp.getvalues(), &xpvec);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, nump, tmpp.getvalues(), &tmppvec);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numf, tmpf.getvalues(), &tmpfvec);
+
+    // xf = inv(Aff)*bf then xp = inv(S)*(bp - Apf*xf):
+    KSPSolve(myksp, bfvec, xfvec);
+    MatMult(myApf, xfvec, tmppvec);
+    VecAYPX(tmppvec, -1.0, bpvec);
+    MatSolve(myS, tmppvec, xpvec);
+    // xf = xf - Y*xp:
+    MatMult(myY, xpvec, tmpfvec);
+    VecAXPY(xfvec, -1.0, tmpfvec);
+
+    VecDestroy(&bfvec); VecDestroy(&bpvec); VecDestroy(&xfvec); VecDestroy(&xpvec); VecDestroy(&tmppvec); VecDestroy(&tmpfvec);
+
+    densemat solvals(numf+nump, 1);
+    double* solvalsptr = solvals.getvalues();
+    double* xfptr = xf.getvalues();
+    double* xpptr = xp.getvalues();
+    for (int i = 0; i < numf; i++)
+        solvalsptr[myfinds[i]] = xfptr[i];
+    for (int i = 0; i < nump; i++)
+        solvalsptr[mypinds[i]] = xpptr[i];
+
+    vec sol(std::shared_ptr<rawvec>(new rawvec(breduced.getpointer()->getdofmanager())));
+    sol.setallvalues(solvals);
+
+    return myA.xbmerge(sol, b);
+}
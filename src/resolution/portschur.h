@@ -0,0 +1,80 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object solves A*x = b for a matrix A with port dofs (e.g. lumped circuit unknowns) by
+// eliminating the port dofs through their Schur complement. With f the field dofs and p the
+// unconstrained port dofs the system is split as
+//
+// [Aff Afp] [xf]   [bf]
+// [Apf App] [xp] = [bp]
+//
+// The field block Aff is factorized once and Y = inv(Aff)*Afp is computed with one solve per port.
+// The small dense Schur complement S = App - Apf*Y is then factorized so that every solve costs
+// two solves with the factorized Aff and a dense solve on the ports:
+//
+// xp = inv(S)*(bp - Apf*inv(Aff)*bf) and xf = inv(Aff)*bf - Y*xp
+//
+// This avoids the fill-in of the dense port rows and columns in the factorization of the whole
+// matrix. When only the port rows change (e.g. after a circuit parameter change) 'updateports'
+// recomputes the Schur complement without factorizing Aff again.
+
+#ifndef PORTSCHUR_H
+#define PORTSCHUR_H
+
+#include <iostream>
+#include <vector>
+#include "vec.h"
+#include "mat.h"
+#include "indexmat.h"
+#include "densemat.h"
+#include "petsc.h"
+#include "petscmat.h"
+#include "petscksp.h"
+
+class portschur
+{
+    private:
+
+        int myverbosity = 1;
+
+        mat myA;
+
+        // Reduced indexes (in the unconstrained dofs of A) of the field and port dofs:
+        std::vector<PetscInt> myfinds = {}, mypinds = {};
+        IS myfis = PETSC_NULL, mypis = PETSC_NULL;
+
+        // Factorization of Aff:
+        Mat myAff = PETSC_NULL;
+        KSP myksp = PETSC_NULL;
+
+        // Dense Y = inv(Aff)*Afp, sparse Apf and factorized dense Schur complement:
+        Mat myY = PETSC_NULL, myApf = PETSC_NULL, myS = PETSC_NULL;
+
+        // Extract Apf and App from A and factorize the Schur complement:
+        void factorizeschur(Mat Aaij);
+
+        void destroy(void);
+
+    public:
+
+        // The matrix must have at least one unconstrained port dof:
+        portschur(mat A, int verbosity = 1);
+        ~portschur(void);
+
+        // The petsc objects cannot be shared:
+        portschur(const portschur&) = delete;
+        portschur& operator=(const portschur&) = delete;
+
+        // Use the port rows of A (same dofs as the initial matrix). The Aff and Afp blocks must be unchanged:
+        void updateports(mat A);
+
+        int countports(void) { return mypinds.size(); };
+
+        // Solve A*x = b:
+        vec solve(vec b);
+
+};
+
+#endif
@@ -0,0 +1,326 @@
+#include "reducedmodel.h"
+
+
+reducedmodel::reducedmodel(formulation formul, int verbosity)
+{
+    myverbosity = verbosity;
+    myformulation = formul;
+    
+    if (myformulation.isstiffnessmatrixdefined() == false)
+    {
+        std::cout << "Error in 'reducedmodel' object: the formulation has no stiffness matrix" << std::endl;
+        abort();
+    }
+    
+    myformulation.generate();
+    
+    myb = myformulation.b();
+    myK = myformulation.K();
+    if (myformulation.isdampingmatrixdefined())
+        myC = myformulation.C();
+    if (myformulation.ismassmatrixdefined())
+        myM = myformulation.M();
+        
+    mydinds = myK.getdinds();
+}
+
+std::vector<double> reducedmodel::getfreevalues(vec v)
+{
+    densemat vals = v.getallvalues();
+    std::vector<double> output;
+    vals.getvalues(output);
+    
+    int* dindsptr = mydinds.getvalues();
+    for (int i = 0; i < mydinds.count(); i++)
+        output[dindsptr[i]] = 0.0;
+        
+    return output;
+}
+
+bool reducedmodel::addtobasis(std::vector<double> v, double tol)
+{
+    int numdofs = v.size();
+    int numbasis = mybasis.countrows();
+    double* basisptr = mybasis.getvalues();
+    
+    double initnorm = 0;
+    for (int j = 0; j < numdofs; j++)
+        initnorm += v[j]*v[j];
+    initnorm = std::sqrt(initnorm);
+    if (initnorm == 0)
+        return false;
+    
+    // Modified Gram-Schmidt done twice for stability:
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int i = 0; i < numbasis; i++)
+        {
+            double proj = 0;
+            for (int j = 0; j < numdofs; j++)
+                proj += basisptr[i*numdofs+j]*v[j];
+            for (int j = 0; j < numdofs; j++)
+                v[j] -= proj*basisptr[i*numdofs+j];
+        }
+    }
+    
+    double norm = 0;
+    for (int j = 0; j < numdofs; j++)
+        norm += v[j]*v[j];
+    norm = std::sqrt(norm);
+    
+    // Linearly dependent vectors are skipped:
+    if (norm <= tol*initnorm)
+        return false;
+        
+    for (int j = 0; j < numdofs; j++)
+        v[j] /= norm;
+    
+    if (numbasis == 0)
+        mybasis = densemat(1, numdofs, v);
+    else
+        mybasis = densemat({mybasis, densemat(1, numdofs, v)});
+    
+    return true;
+}
+
+void reducedmodel::project(void)
+{
+    int numbasis = mybasis.countrows();
+    int numdofs = countdofs();
+    
+    std::vector<mat> mats = {myK, myC, myM};
+    std::vector<densemat> reduced(3);
+    for (int m = 0; m < 3; m++)
+    {
+        if (mats[m].isdefined() == false)
+            continue;
+        
+        // Product of the matrix with every basis vector (the constrained rows are zero since the basis is zero there):
+        densemat prods(numbasis, numdofs);
+        double* prodsptr = prods.getvalues();
+        for (int i = 0; i < numbasis; i++)
+        {
+            vec v(myformulation);
+            v.setallvalues(mybasis.extractrows(i, i));
+            densemat prodvals = (mats[m]*v).getallvalues();
+            double* prodvalsptr = prodvals.getvalues();
+            for (int j = 0; j < numdofs; j++)
+                prodsptr[i*numdofs+j] = prodvalsptr[j];
+        }
+        
+        reduced[m] = mybasis.multiply(prods.gettranspose());
+    }
+    
+    myKr = reduced[0];
+    myCr = reduced[1];
+    myMr = reduced[2];
+    
+    if (myverbosity > 0)
+        std::cout << "Reduced model has " << numbasis << " basis vectors" << std::endl;
+}
+
+void reducedmodel::addkrylov(double frequency, int numvectors)
+{
+    double w = 2.0*3.1415926535897932384*frequency;
+    
+    mat A = myK;
+    if (myM.isdefined() && w != 0)
+        A = myK - w*w*myM;
+    A.reusefactorization();
+    
+    // The constrained entries of the rhs are zero:
+    vec b(myformulation);
+    b.setallvalues(densemat(countdofs(), 1, getfreevalues(myb)));
+    
+    std::vector<vec> tovisit = {sl::solve(A, b)};
+    
+    int numadded = 0;
+    while (numadded < numvectors && tovisit.size() > 0)
+    {
+        vec cur = tovisit[0];
+        tovisit.erase(tovisit.begin());
+        
+        std::vector<double> vals = getfreevalues(cur);
+        if (addtobasis(vals, 1e-10) == false)
+            continue;
+        numadded++;
+        
+        // Next moments:
+        vec v(myformulation);
+        v.setallvalues(mybasis.extractrows(mybasis.countrows()-1, mybasis.countrows()-1));
+        if (myM.isdefined())
+            tovisit.push_back(sl::solve(A, myM*v));
+        if (myC.isdefined())
+            tovisit.push_back(sl::solve(A, myC*v));
+    }
+    
+    if (myverbosity > 0 && numadded < numvectors)
+        std::cout << "Warning in 'reducedmodel' object: only " << numadded << " independent Krylov vectors were found" << std::endl;
+    
+    project();
+}
+
+void reducedmodel::addpod(std::vector<vec> snapshots, double tol)
+{
+    int numsnaps = snapshots.size();
+    int numdofs = countdofs();
+    
+    if (numsnaps == 0)
+        return;
+    
+    std::vector<std::vector<double>> snaps(numsnaps);
+    for (int i = 0; i < numsnaps; i++)
+        snaps[i] = getfreevalues(snapshots[i]);
+    
+    // Correlation matrix of the snapshots:
+    std::vector<double> R(numsnaps*numsnaps, 0.0);
+    for (int i = 0; i < numsnaps; i++)
+    {
+        for (int j = i; j < numsnaps; j++)
+        {
+            for (int k = 0; k < numdofs; k++)
+                R[i*numsnaps+j] += snaps[i][k]*snaps[j][k];
+            R[j*numsnaps+i] = R[i*numsnaps+j];
+        }
+    }
+    
+    // Cyclic Jacobi eigenvalue algorithm (the eigenvectors are the columns of E):
+    std::vector<double> E(numsnaps*numsnaps, 0.0);
+    for (int i = 0; i < numsnaps; i++)
+        E[i*numsnaps+i] = 1.0;
+    for (int sweep = 0; sweep < 100; sweep++)
+    {
+        double offdiag = 0, diag = 0;
+        for (int i = 0; i < numsnaps; i++)
+        {
+            diag += R[i*numsnaps+i]*R[i*numsnaps+i];
+            for (int j = i+1; j < numsnaps; j++)
+                offdiag += R[i*numsnaps+j]*R[i*numsnaps+j];
+        }
+        if (offdiag <= 1e-30*diag)
+            break;
+        
+        for (int p = 0; p < numsnaps; p++)
+        {
+            for (int q = p+1; q < numsnaps; q++)
+            {
+                double rpq = R[p*numsnaps+q];
+                if (rpq == 0)
+                    continue;
+                double theta = (R[q*numsnaps+q]-R[p*numsnaps+p])/(2.0*rpq);
+                double t = (theta >= 0 ? 1.0 : -1.0)/(std::abs(theta)+std::sqrt(theta*theta+1.0));
+                double c = 1.0/std::sqrt(t*t+1.0), s = t*c;
+                
+                for (int k = 0; k < numsnaps; k++)
+                {
+                    double rkp = R[k*numsnaps+p], rkq = R[k*numsnaps+q];
+                    R[k*numsnaps+p] = c*rkp - s*rkq;
+                    R[k*numsnaps+q] = s*rkp + c*rkq;
+                }
+                for (int k = 0; k < numsnaps; k++)
+                {
+                    double rpk = R[p*numsnaps+k], rqk = R[q*numsnaps+k];
+                    R[p*numsnaps+k] = c*rpk - s*rqk;
+                    R[q*numsnaps+k] = s*rpk + c*rqk;
+                }
+                for (int k = 0; k < numsnaps; k++)
+                {
+                    double ekp = E[k*numsnaps+p], ekq = E[k*numsnaps+q];
+                    E[k*numsnaps+p] = c*ekp - s*ekq;
+                    E[k*numsnaps+q] = s*ekp + c*ekq;
+                }
+            }
+        }
+    }
+    
+    // Sort the modes by decreasing energy:
+    std::vector<int> order(numsnaps);
+    double totalenergy = 0;
+    for (int i = 0; i < numsnaps; i++)
+    {
+        order[i] = i;
+        totalenergy += std::max(0.0, R[i*numsnaps+i]);
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return R[a*numsnaps+a] > R[b*numsnaps+b]; });
+    
+    double energy = 0;
+    for (int m = 0; m < numsnaps; m++)
+    {
+        int cur = order[m];
+        double lambda = R[cur*numsnaps+cur];
+        if (lambda <= 0 || energy >= (1.0-tol)*totalenergy)
+            break;
+        energy += lambda;
+        
+        std::vector<double> mode(numdofs, 0.0);
+        for (int i = 0; i < numsnaps; i++)
+        {
+            double coef = E[i*numsnaps+cur]/std::sqrt(lambda);
+            for (int k = 0; k < numdofs; k++)
+                mode[k] += coef*snaps[i][k];
+        }
+        addtobasis(mode, 1e-10);
+    }
+    
+    project();
+}
+
+densemat reducedmodel::project(vec b)
+{
+    if (mybasis.countrows() == 0)
+    {
+        std::cout << "Error in 'reducedmodel' object: the basis is empty" << std::endl;
+        abort();
+    }
+    
+    densemat bvals(countdofs(), 1, getfreevalues(b));
+    
+    return mybasis.multiply(bvals);
+}
+
+densemat reducedmodel::solve(densemat br)
+{
+    return myKr.getinverse().multiply(br);
+}
+
+std::vector<densemat> reducedmodel::solve(double frequency, densemat brsin, densemat brcos)
+{
+    int n = myKr.countrows();
+    double w = 2.0*3.1415926535897932384*frequency;
+    
+    // Real block system [Kr - w^2*Mr, -w*Cr; w*Cr, Kr - w^2*Mr]:
+    densemat A = myKr.copy();
+    if (myMr.isdefined())
+        A.addproduct(-w*w, myMr);
+    densemat wC(n, n, 0.0);
+    if (myCr.isdefined())
+        wC = myCr.getproduct(w);
+    
+    densemat block(2*n, 2*n);
+    block.insert(0, 0, A);
+    block.insert(n, n, A);
+    block.insert(0, n, wC.getproduct(-1.0));
+    block.insert(n, 0, wC);
+    
+    densemat rhs(2*n, 1);
+    rhs.insert(0, 0, brsin);
+    rhs.insert(n, 0, brcos);
+    
+    densemat sol = block.getinverse().multiply(rhs);
+    
+    return {sol.extractrows(0, n-1), sol.extractrows(n, 2*n-1)};
+}
+
+vec reducedmodel::expand(densemat q)
+{
+    if (q.count() != mybasis.countrows())
+    {
+        std::cout << "Error in 'reducedmodel' object: expected " << mybasis.countrows() << " reduced coefficients" << std::endl;
+        abort();
+    }
+    
+    vec output(myformulation);
+    output.setallvalues(mybasis.gettranspose().multiply(q.getresized(q.count(), 1)));
+    
+    return output;
+}
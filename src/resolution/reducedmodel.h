@@ -0,0 +1,92 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object builds a projection-based reduced model of the linear system (K + C*dt + M*dtdt)*x = b
+// of a formulation. The basis V (one orthonormal vector per row of 'getbasis') is obtained with
+// moment matching (Krylov vectors around an expansion frequency) and/or a proper orthogonal
+// decomposition of snapshots. The reduced matrices V'*K*V, V'*C*V and V'*M*V are small dense
+// matrices and solving the reduced model costs nothing compared to the full system.
+//
+// The Dirichlet constraints must be homogeneous: the basis vectors are zero on the constrained dofs.
+
+#ifndef REDUCEDMODEL_H
+#define REDUCEDMODEL_H
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "vec.h"
+#include "mat.h"
+#include "sl.h"
+#include "formulation.h"
+#include "densemat.h"
+#include "indexmat.h"
+
+class reducedmodel
+{
+    private:
+        
+        int myverbosity = 1;
+        
+        formulation myformulation;
+        
+        mat myK, myC, myM;
+        vec myb;
+        
+        indexmat mydinds;
+        
+        // Basis vectors (one per row) and reduced matrices (empty if not defined):
+        densemat mybasis;
+        densemat myKr, myCr, myMr;
+        
+        int countdofs(void) { return myformulation.countdofs(); };
+        
+        // Values of a vec with zero constrained entries:
+        std::vector<double> getfreevalues(vec v);
+        
+        // Orthonormalize 'v' against the basis and add it if its relative norm is above 'tol'.
+        // True is returned if it was added.
+        bool addtobasis(std::vector<double> v, double tol);
+        
+        // Project the matrices on the basis:
+        void project(void);
+        
+    public:
+        
+        // The matrices and rhs are generated once:
+        reducedmodel(formulation formul, int verbosity = 1);
+        
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+        
+        // Add 'numvectors' moment matching vectors around a frequency [Hz]. The Krylov subspace
+        // of (K - w0^2*M)^-1 applied to M and C starting from (K - w0^2*M)^-1 * b is used. 
+        void addkrylov(double frequency, int numvectors);
+        // Add the proper orthogonal decomposition modes of the snapshots holding
+        // the fraction '1-tol' of the snapshot energy:
+        void addpod(std::vector<vec> snapshots, double tol = 1e-8);
+        
+        int countbasisvectors(void) { return mybasis.countrows(); };
+        densemat getbasis(void) { return mybasis; };
+        
+        densemat getK(void) { return myKr; };
+        densemat getC(void) { return myCr; };
+        densemat getM(void) { return myMr; };
+        
+        // Reduced rhs V'*b for the rhs 'b' (the formulation rhs by default):
+        densemat project(vec b);
+        densemat getrhs(void) { return project(myb); };
+        
+        // Solve the static reduced system Kr*q = br:
+        densemat solve(densemat br);
+        // Solve the harmonic reduced system at a frequency [Hz] and return {qsin, qcos}:
+        std::vector<densemat> solve(double frequency, densemat brsin, densemat brcos);
+        
+        // Get the full vector combining the basis vectors with coefficients 'q' (use 'setdata' to transfer it to the fields):
+        vec expand(densemat q);
+        
+};
+
+#endif
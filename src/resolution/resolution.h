@@ -9,6 +9,17 @@
 #include "eigenvalue.h"
 #include "genalpha.h"
 #include "impliciteuler.h"
+#include "multigenalpha.h"
+#include "multiimpliciteuler.h"
+#include "anderson.h"
+#include "leapfrog.h"
+#include "bdf.h"
+#include "rosenbrock.h"
+#include "parareal.h"
+#include "multirate.h"
+#include "frequencysweep.h"
+#include "reducedmodel.h"
+#include "portschur.h"
 
 class resolution
 {
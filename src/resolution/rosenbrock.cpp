@@ -0,0 +1,239 @@
+#include "rosenbrock.h"
+
+rosenbrock::rosenbrock(formulation formul, vec dtxinit, int verbosity, std::vector<bool> isrhskcconstant)
+{
+    myverbosity = verbosity;
+
+    myformulation = formul;
+    if (myformulation.ismassmatrixdefined())
+    {
+        std::cout << "Error in 'rosenbrock' object: formulation provided cannot have a mass matrix (use another time resolution algorithm)" << std::endl;
+        abort();  
+    }
+    
+    dtx = dtxinit;
+    isconstant = isrhskcconstant;
+    
+    if (isconstant.size() != 3)
+    {
+        std::cout << "Error in 'rosenbrock' object: expected a length 3 vector as fourth argument" << std::endl;
+        abort();  
+    }
+}
+
+void rosenbrock::settimederivative(vec sol)
+{
+    dtx = sol;
+}
+
+void rosenbrock::setadaptivity(double tol, double mints, double maxts, double reffact, double coarfact, double coarthres)
+{
+    if (tol < 0 || mints < 0 || maxts < 0 || reffact < 0 || coarfact < 0 || coarthres < 0)
+    {
+        std::cout << "Error in 'rosenbrock' object: expected positive arguments for adaptivity" << std::endl;
+        abort();  
+    }
+    if (mints > maxts)
+    {
+        std::cout << "Error in 'rosenbrock' object: min timestep cannot be larger than max for adaptivity" << std::endl;
+        abort();      
+    }
+    if (reffact > 1)
+    {
+        std::cout << "Error in 'rosenbrock' object: expected a refinement factor lower than one for adaptivity" << std::endl;
+        abort();      
+    }
+    if (coarfact < 1)
+    {
+        std::cout << "Error in 'rosenbrock' object: expected a coarsening factor larger than one for adaptivity" << std::endl;
+        abort();        
+    }
+    if (coarthres > 1)
+    {
+        std::cout << "Error in 'rosenbrock' object: expected a coarsening threshold lower than one for adaptivity" << std::endl;
+        abort();        
+    }
+
+    mindt = mints; maxdt = maxts; tatol = tol; rfact = reffact; cfact = coarfact; cthres = coarthres;
+}
+
+void rosenbrock::presolve(std::vector<formulation> formuls) { tosolvebefore = formuls; }
+void rosenbrock::postsolve(std::vector<formulation> formuls) { tosolveafter = formuls; }
+
+void rosenbrock::next(double timestep)
+{
+    run(timestep);
+}
+
+int rosenbrock::next(double timestep, int maxnumnlit)
+{
+    run(timestep);
+    return 1;
+}
+
+void rosenbrock::run(double timestep)
+{
+    if (timestep < 0 && mindt == -1)
+    {
+        std::cout << "Error in 'rosenbrock' object: requested an adaptive timestep but adaptivity settings have not been defined" << std::endl;
+        abort();
+    }
+
+    double inittime = universe::getsession()->currenttimestep;
+
+    // Adaptive timestep:
+    bool istadapt = false;
+    if (timestep < 0)
+    {
+        istadapt = true;
+        if (dt < 0)
+            dt = mindt;
+    }
+    else
+        dt = timestep;
+    
+    // Solve all formulations that must be solved at the beginning of the time step:
+    for (int i = 0; i < tosolvebefore.size(); i++)
+        tosolvebefore[i].solve();
+
+    // Get the data from all fields to create the x vector:
+    vec x(myformulation);
+    x.setdata();
+    
+    // Make all time derivatives available in the universe:
+    universe::getsession()->xdtxdtdtx = {{},{dtx},{}};
+    
+    // The matrices and the rhs at the beginning of the time step:
+    bool isfirstcall = not(K.isdefined());
+    if (isconstant[0] == false || isfirstcall)
+    {
+        myformulation.generaterhs();
+        rhs = myformulation.rhs();
+    }
+    else
+        rhs.updateconstraints();
+    if (isconstant[1] == false || isfirstcall)
+    {
+        myformulation.generatestiffnessmatrix();
+        K = myformulation.K(false);
+    }
+    if (isconstant[2] == false || isfirstcall)
+    {
+        myformulation.generatedampingmatrix();
+        C = myformulation.C(false);
+    }
+    
+    indexmat constraintindexes = myformulation.getdofmanager()->getconstrainedindexes();
+    densemat xdirichletval = rhs.getpointer()->getvalues(constraintindexes);
+    
+    vec Kx = K*x;
+
+    // Time-adaptivity loop:
+    vec xnext, dtxnext;
+    while (true)
+    {
+        // Update and print the time:
+        universe::getsession()->currenttimestep = inittime+dt;
+
+        if (myverbosity > 1 && istadapt)
+            std::cout << "@" << inittime << "+" << dt << "s " << std::flush;
+        if (myverbosity > 1 && not(istadapt))
+            std::cout << "@" << inittime+dt << "s " << std::flush;
+            
+        // The rhs at the end of the time step:
+        if (isconstant[0] == false)
+        {
+            myformulation.generaterhs();
+            nextrhs = myformulation.rhs();
+        }
+        else
+        {
+            nextrhs = rhs.copy();
+            nextrhs.updateconstraints();
+        }
+        densemat xnextdirichletval = nextrhs.getpointer()->getvalues(constraintindexes);
+        // The constrained values go from the current to the next time step with k1 = rate and k2 = -rate (ROS2 weights 1.5 and 0.5):
+        densemat dirichletrate = xnextdirichletval.copy();
+        dirichletrate.subtract(xdirichletval);
+        dirichletrate.multiplyelementwise(1.0/dt);
+        
+        // Reuse matrices when possible (including the factorization):
+        if (isconstant[1] == false || isconstant[2] == false || isfirstcall || defdt != dt)
+        {
+            leftmat = C + gamma*dt*K;
+            leftmat.reusefactorization();
+            
+            defdt = dt;
+            isfirstcall = false;
+        }
+        
+        // The finite difference approximation of the time derivative of the rhs (times dt):
+        vec rhsrate = nextrhs - rhs;
+        
+        // First stage:
+        vec rightvec = rhs - Kx + gamma*rhsrate;
+        rightvec.getpointer()->setvalues(constraintindexes, dirichletrate);
+        vec k1 = sl::solve(leftmat, rightvec);
+        
+        // Second stage:
+        rightvec = nextrhs - K*(x+dt*k1) - 2.0*(C*k1) - gamma*rhsrate;
+        densemat minusdirichletrate = dirichletrate.copy();
+        minusdirichletrate.minus();
+        rightvec.getpointer()->setvalues(constraintindexes, minusdirichletrate);
+        vec k2 = sl::solve(leftmat, rightvec);
+        
+        xnext = x + 1.5*dt*k1 + 0.5*dt*k2;
+        xnext.getpointer()->setvalues(constraintindexes, xnextdirichletval);
+        dtxnext = 1.0/dt*(xnext-x);
+        
+        // Update all fields in the formulation:
+        sl::setdata(xnext);
+        
+        // Make all time derivatives available in the universe:
+        universe::getsession()->xdtxdtdtx = {{},{dtxnext},{}};
+        
+        if (istadapt == false)
+            break;
+        else
+        {
+            // Difference with the embedded first order solution x + dt*k1 to measure the error (the constrained dofs are exact):
+            vec errorvec = k1+k2;
+            errorvec.getpointer()->setvalues(constraintindexes, densemat(constraintindexes.count(), 1, 0.0));
+            double errormeasure = 0.5*dt*errorvec.norm()/xnext.norm();
+
+            bool breakit = false;
+            if (dt <= mindt || errormeasure <= tatol)
+            {
+                // If the error is low enough to coarsen the timestep:
+                if (errormeasure <= cthres*tatol)
+                    dt *= cfact;
+                breakit = true;
+            }
+            else
+            {
+                dt *= rfact;
+                // Reset fields for a new resolution:
+                sl::setdata(x);
+            }
+                
+            dt = std::min(dt, maxdt);
+            dt = std::max(dt, mindt);
+
+            if (myverbosity > 2)
+                std::cout << "(" << errormeasure << ") " << std::flush;
+            
+            if (breakit)
+                break;
+        }
+    }
+    
+    // Solve all formulations that must be solved at the end of the time step:
+    for (int i = 0; i < tosolveafter.size(); i++)
+        tosolveafter[i].solve();
+    
+    if (myverbosity == 1)
+        std::cout << "@" << universe::getsession()->currenttimestep << "s " << std::flush;
+    
+    dtx = dtxnext;
+    mytimes.push_back(universe::getsession()->currenttimestep);
+}
@@ -0,0 +1,104 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object implements the two stage, second order, linearly implicit Rosenbrock method ROS2 (gamma = 1+1/sqrt(2)) to solve in time the problem
+//
+// C*dtx + K*x = b 
+//
+// be it linear or nonlinear. The K and C matrices and the rhs are generated once at the beginning of each time step (no
+// nonlinear iteration) and both stages solve with the same matrix C + gamma*dt*K. Since ROS2 keeps its order for any
+// approximation of the Jacobian, using K instead of the exact Jacobian of a nonlinear K*x still gives a second order method.
+// The time derivative of the rhs is approximated by a finite difference over the time step.
+//
+// With adaptivity the local error is the difference with the embedded first order solution.
+
+#ifndef ROSENBROCK_H
+#define ROSENBROCK_H
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "vec.h"
+#include "universe.h"
+#include "sl.h"
+#include "formulation.h"
+
+class rosenbrock
+{
+    private:
+        
+        int myverbosity = 1;
+        
+        formulation myformulation;
+        
+        double gamma = 1.0+1.0/std::sqrt(2.0);
+        
+        // Set 'isconstant[i]' to true and the corresponding matrix/vector is 
+        // supposed constant in time and will only be generated once then reused.
+        //
+        // - i = 0 corresponds to the rhs vector
+        // - i = 1 corresponds to the K matrix
+        // - i = 2 corresponds to the C matrix
+        //
+        // Note: even if the rhs vector can be reused the Dirichlet
+        // constraints will nevertheless be recomputed at each time step.
+        //
+        std::vector<bool> isconstant = {false, false, false};
+        
+        // Formulations to solve before/after each time step:
+        std::vector<formulation> tosolvebefore = {};
+        std::vector<formulation> tosolveafter = {};
+        
+        // Current timestep:
+        double dt = -1;
+        // All time values stepped-through:
+        std::vector<double> mytimes = {};
+        
+        // Time-adaptivity settings:
+        double mindt = -1, maxdt = -1, tatol = -1, rfact = -1, cfact = -1, cthres = -1;
+        
+        // Vector dt(x) at the current time step:
+        vec dtx;
+        
+        // Objects required at every timestep (possibly reused):
+        vec rhs, nextrhs; mat K, C, leftmat;
+        // Parameters for which these objects are defined:
+        double defdt = -1;
+        
+        void run(double timestep);
+        
+    public:
+
+        rosenbrock(formulation formul, vec dtxinit, int verbosity = 3, std::vector<bool> isrhskcconstant = {false, false, false});
+        
+        void setverbosity(int verbosity) { myverbosity = verbosity; };
+        
+        vec gettimederivative(void) { return dtx; };
+        void settimederivative(vec sol);
+        
+        void settimestep(double timestep) { dt = timestep; };
+        double gettimestep(void) { return dt; };
+        
+        // Count the number of timesteps computed:
+        int count(void) { return mytimes.size(); };
+        std::vector<double> gettimes(void) { return mytimes; };
+        // Set the times of the timesteps computed (to restore a checkpoint):
+        void settimes(std::vector<double> times) { mytimes = times; };
+
+        // Set the time-adaptivity settings:
+        void setadaptivity(double tol, double mints, double maxts, double reffact = 0.5, double coarfact = 2.0, double coarthres = 0.5);
+        
+        // Define a list of formulations to solve at the beginning/end of each time step:
+        void presolve(std::vector<formulation> formuls);
+        void postsolve(std::vector<formulation> formuls);
+        
+        // Advance the solution by the provided timestep for a linear/nonlinear problem.
+        // The method is linearly implicit: 'maxnumnlit' is only kept for the interface and 1 is returned.
+        void next(double timestep);
+        int next(double timestep, int maxnumnlit);
+        
+};
+
+#endif
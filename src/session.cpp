@@ -0,0 +1,17 @@
+#include "session.h"
+#include "rawmesh.h"
+#include "vec.h"
+#include "mat.h"
+#include "formulation.h"
+#include "indexmat.h"
+#include "densemat.h"
+
+
+session::session(void)
+{
+    xdtxdtdtx = {{},{},{}};
+}
+
+session::~session(void)
+{
+}
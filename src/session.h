@@ -0,0 +1,85 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object holds the state of a simulation: the mesh in use, the problem settings (axisymmetry, current time,
+// fundamental frequency), the time derivatives of the solution, the rhs assembly tracking and the DDM containers.
+// Every thread works on a session, the default session unless another one was set with 'universe::setsession'.
+// Independent simulations each have their own session and share no mesh, field, parameter or formulation. The
+// read-only data (form function polynomials, Gauss points, split definitions, mesh cache) and the library settings
+// (e.g. the number of threads) are shared. Sessions do not serialize the petsc and MPI calls (matrix and vector
+// creation, solves, DDM communications). Simulations in different threads can only run them concurrently with a
+// thread-safe petsc build and MPI providing MPI_THREAD_MULTIPLE, otherwise one thread at a time must make them.
+//
+// Example: 
+//
+// session s;
+// universe::setsession(&s);
+// mesh mymesh("disk.msh"); // Loaded in session 's' only
+// ...
+// universe::setsession(NULL);
+
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+
+class rawmesh;
+class vec;
+class mat;
+class formulation;
+class indexmat;
+class densemat;
+
+class session
+{
+    public:
+    
+        session(void);
+        ~session(void);
+        
+        // The state of a simulation cannot be duplicated:
+        session(const session&) = delete;
+        session& operator=(const session&) = delete;
+    
+        std::shared_ptr<rawmesh> myrawmesh = NULL;
+        
+        bool isaxisymmetric = false;
+        
+        double currenttimestep = 0;
+        
+        double fundamentalfrequency = -1;
+        
+        // Temporary containers for DDM:
+        std::vector<std::vector<int>> ddmints = {};
+        std::vector<vec> ddmvecs = {};
+        std::vector<mat> ddmmats = {};
+        std::vector<formulation> ddmformuls = {};
+        std::vector<indexmat> ddmsendinds = {};
+        std::vector<indexmat> ddmrecvinds = {};
+        // Preconditioner type of the iterative subdomain solves ("" for direct solves), their tolerance and maximum iteration count:
+        std::string ddmsubdomainprecond = "";
+        double ddmsubdomainrelrestol = 1e-8;
+        int ddmsubdomainmaxnumit = 1000;
+        
+        // Error estimators will be updated if 'numallowedtimes' > 0 and their state number is different than 'estimatorcalcstate':
+        long long int estimatorcalcstate = 0;
+        int numallowedtimes = 0;
+        
+        // If set to true the individual right handside contribution addresses and values are stored in 'rhsterms' when generating a formulation:
+        bool keeptrackofrhsassembly = false;
+        // Every row in a given (int)densemat corresponds to a shape function and every column to a given mesh element.
+        // Do not forget to clear 'rhsterms' when you don't want to keep track anymore!
+        std::vector<std::pair<indexmat, densemat>> rhsterms;
+        
+        // This stores the vec containing a solution x, its time derivative dtx and its second time derivative dtdtx
+        // respectively at index 0, 1 and 2. If xdtxdtdtx[i] is an empty vector then that solution is not available.
+        std::vector<std::vector<vec>> xdtxdtdtx;
+};
+
+#endif
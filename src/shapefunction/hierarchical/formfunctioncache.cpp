@@ -0,0 +1,200 @@
+#include "formfunctioncache.h"
+#include "universe.h"
+#include "element.h"
+#include "selector.h"
+
+
+bool formfunctioncache::isitenabled = true;
+std::mutex formfunctioncache::mymutex;
+long long int formfunctioncache::numhits = 0;
+long long int formfunctioncache::nummisses = 0;
+long long int formfunctioncache::numbytes = 0;
+long long int formfunctioncache::lastuse = 0;
+long long int formfunctioncache::maxnumbytes = 64*1024*1024;
+
+// The form function values of all derivatives and components for a given orientation:
+class formfunctioncacheentry
+{
+    public:
+        
+        std::string fftypename = "";
+        int elementtypenumber = -1;
+        int order = -1;
+        int totalorientation = -1;
+        std::vector<double> evaluationcoordinates = {};
+        
+        int numformfunctions = 0;
+        int numevaluationpoints = 0;
+        int numderivatives = 0;
+        int numcomponents = 0;
+        // Matrix of derivative m and component n starts at index (m*numcomponents+n)*numformfunctions*numevaluationpoints:
+        std::vector<double> values = {};
+        
+        long long int lastuse = 0;
+        
+        bool ismatch(std::string& ffname, int elemtype, int ord, int totorient, std::vector<double>& evalcoords)
+        {
+            return (totalorientation == totorient && elementtypenumber == elemtype && order == ord && fftypename == ffname && evaluationcoordinates == evalcoords);
+        }
+        
+        long long int countbytes(void) { return values.size()*sizeof(double) + evaluationcoordinates.size()*sizeof(double); };
+        
+        densemat getmatrix(int whichderivative, int component)
+        {
+            int numvals = numformfunctions*numevaluationpoints;
+            densemat output(numformfunctions, numevaluationpoints);
+            double* outvals = output.getvalues();
+            double* vals = &values[(whichderivative*numcomponents+component)*numvals];
+            for (int i = 0; i < numvals; i++)
+                outvals[i] = vals[i];
+            return output;
+        }
+};
+
+// Entries are indexed by a hash of their key:
+std::unordered_multimap<size_t, std::shared_ptr<formfunctioncacheentry>> formfunctioncacheentries = {};
+
+size_t hashformfunctions(std::string& fftypename, int elementtypenumber, int order, int totalorientation, std::vector<double>& evaluationcoordinates)
+{
+    size_t hashval = std::hash<std::string>()(fftypename);
+    hashval ^= std::hash<int>()(elementtypenumber) + 0x9e3779b9 + (hashval << 6) + (hashval >> 2);
+    hashval ^= std::hash<int>()(order) + 0x9e3779b9 + (hashval << 6) + (hashval >> 2);
+    hashval ^= std::hash<int>()(totalorientation) + 0x9e3779b9 + (hashval << 6) + (hashval >> 2);
+    for (int i = 0; i < evaluationcoordinates.size(); i++)
+        hashval ^= std::hash<double>()(evaluationcoordinates[i]) + 0x9e3779b9 + (hashval << 6) + (hashval >> 2);
+    return hashval;
+}
+
+void formfunctioncache::enable(bool isenabled)
+{
+    isitenabled = isenabled;
+    if (isenabled == false)
+        clear();
+}
+
+void formfunctioncache::clear(void)
+{
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    formfunctioncacheentries = {};
+    numbytes = 0;
+}
+
+densemat formfunctioncache::get(hierarchicalformfunctioncontainer& hfc, int totalorientation, int order, int whichderivative, int component)
+{
+    if (isitenabled == false)
+        return hfc.tomatrix(totalorientation, order, whichderivative, component);
+    
+    std::string fftypename = hfc.gettypename();
+    std::vector<double>& evaluationcoordinates = hfc.getevaluationpoints();
+    
+    return get(fftypename, hfc.getelementtypenumber(), order, evaluationcoordinates, totalorientation, whichderivative, component, &hfc);
+}
+
+densemat formfunctioncache::get(std::string fftypename, int elementtypenumber, int order, std::vector<double>& evaluationcoordinates, int totalorientation, int whichderivative, int component)
+{
+    if (isitenabled == false)
+        return universe::gethff(fftypename, elementtypenumber, order, evaluationcoordinates)->tomatrix(totalorientation, order, whichderivative, component);
+    
+    return get(fftypename, elementtypenumber, order, evaluationcoordinates, totalorientation, whichderivative, component, NULL);
+}
+
+densemat formfunctioncache::get(std::string& fftypename, int elementtypenumber, int order, std::vector<double>& evaluationcoordinates, int totalorientation, int whichderivative, int component, hierarchicalformfunctioncontainer* hfc)
+{
+    size_t hashval = hashformfunctions(fftypename, elementtypenumber, order, totalorientation, evaluationcoordinates);
+    
+    {
+        std::lock_guard<std::mutex> lock(mymutex);
+        
+        auto range = formfunctioncacheentries.equal_range(hashval);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            std::shared_ptr<formfunctioncacheentry> cur = it->second;
+            if (cur->ismatch(fftypename, elementtypenumber, order, totalorientation, evaluationcoordinates))
+            {
+                numhits++;
+                lastuse++;
+                cur->lastuse = lastuse;
+                // The values are never modified once in the cache:
+                return cur->getmatrix(whichderivative, component);
+            }
+        }
+    }
+    
+    // The table is computed outside of the lock:
+    std::shared_ptr<hierarchicalformfunctioncontainer> computedhfc;
+    if (hfc == NULL)
+    {
+        computedhfc = universe::gethff(fftypename, elementtypenumber, order, evaluationcoordinates);
+        hfc = computedhfc.get();
+    }
+    
+    std::shared_ptr<formfunctioncacheentry> entry(new formfunctioncacheentry);
+    entry->fftypename = fftypename;
+    entry->elementtypenumber = elementtypenumber;
+    entry->order = order;
+    entry->totalorientation = totalorientation;
+    entry->evaluationcoordinates = evaluationcoordinates;
+    // Derivatives in directions above the element dimension are not requested:
+    entry->numderivatives = element(elementtypenumber).getelementdimension()+1;
+    entry->numcomponents = selector::select(elementtypenumber, fftypename)->countcomponents();
+    entry->numevaluationpoints = evaluationcoordinates.size()/3;
+    
+    if (whichderivative >= entry->numderivatives || component >= entry->numcomponents)
+        return hfc->tomatrix(totalorientation, order, whichderivative, component);
+    
+    for (int m = 0; m < entry->numderivatives; m++)
+    {
+        for (int n = 0; n < entry->numcomponents; n++)
+        {
+            densemat cur = hfc->tomatrix(totalorientation, order, m, n);
+            if (m == 0 && n == 0)
+            {
+                entry->numformfunctions = cur.countrows();
+                entry->values.resize(entry->numderivatives*entry->numcomponents*cur.count());
+            }
+            double* curvals = cur.getvalues();
+            double* vals = &(entry->values[(m*entry->numcomponents+n)*cur.count()]);
+            for (int i = 0; i < cur.count(); i++)
+                vals[i] = curvals[i];
+        }
+    }
+    
+    densemat output = entry->getmatrix(whichderivative, component);
+    
+    std::lock_guard<std::mutex> lock(mymutex);
+    
+    nummisses++;
+    
+    // Another thread might have added the same table in the meantime:
+    auto range = formfunctioncacheentries.equal_range(hashval);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second->ismatch(fftypename, elementtypenumber, order, totalorientation, evaluationcoordinates))
+            return output;
+    }
+    
+    long long int entrybytes = entry->countbytes();
+    if (entrybytes > maxnumbytes)
+        return output;
+    
+    // Remove the least recently used tables until the new one fits:
+    while (numbytes + entrybytes > maxnumbytes && formfunctioncacheentries.size() > 0)
+    {
+        auto oldest = formfunctioncacheentries.begin();
+        for (auto it = formfunctioncacheentries.begin(); it != formfunctioncacheentries.end(); ++it)
+        {
+            if (it->second->lastuse < oldest->second->lastuse)
+                oldest = it;
+        }
+        numbytes -= oldest->second->countbytes();
+        formfunctioncacheentries.erase(oldest);
+    }
+    
+    lastuse++;
+    entry->lastuse = lastuse;
+    numbytes += entrybytes;
+    formfunctioncacheentries.insert(std::make_pair(hashval, entry));
+    
+    return output;
+}
@@ -0,0 +1,68 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object keeps the form function matrices of 'hierarchicalformfunctioncontainer::tomatrix'
+// so that the matrix generation and the field interpolation do not rebuild them for every
+// orientation block. For a given form function type, element type, order, evaluation points
+// and total orientation the matrices of all derivatives and components are tabulated at once
+// and stored contiguously. The tables are shared by all threads and are never modified.
+// When their total size exceeds 'maxnumbytes' the least recently used tables are removed.
+
+#ifndef FORMFUNCTIONCACHE_H
+#define FORMFUNCTIONCACHE_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "densemat.h"
+#include "hierarchicalformfunctioncontainer.h"
+
+class formfunctioncache
+{
+    private:
+        
+        static bool isitenabled;
+        
+        static std::mutex mymutex;
+        
+        static long long int numhits;
+        static long long int nummisses;
+        
+        // Current size of all tables and use counter for the eviction:
+        static long long int numbytes;
+        static long long int lastuse;
+        
+        // The container is taken from 'universe::gethff' if 'hfc' is NULL:
+        static densemat get(std::string& fftypename, int elementtypenumber, int order, std::vector<double>& evaluationcoordinates, int totalorientation, int whichderivative, int component, hierarchicalformfunctioncontainer* hfc);
+        
+    public:
+        
+        // Maximum size of all tables in bytes:
+        static long long int maxnumbytes;
+        
+        // The cache is enabled by default. Disabling it also clears it:
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+        
+        static void clear(void);
+        
+        // Same as 'hfc.tomatrix(totalorientation, order, whichderivative, component)'. The container must
+        // have been evaluated. The output is a copy that can be modified. This can be called by multiple
+        // threads at the same time.
+        static densemat get(hierarchicalformfunctioncontainer& hfc, int totalorientation, int order, int whichderivative, int component);
+        // Same with the container of 'universe::gethff' (only evaluated when the table is not available):
+        static densemat get(std::string fftypename, int elementtypenumber, int order, std::vector<double>& evaluationcoordinates, int totalorientation, int whichderivative, int component);
+        
+        static long long int counthits(void) { return numhits; };
+        static long long int countmisses(void) { return nummisses; };
+        static long long int countbytes(void) { return numbytes; };
+        
+};
+
+#endif
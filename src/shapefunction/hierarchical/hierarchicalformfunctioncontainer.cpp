@@ -49,21 +49,70 @@ void hierarchicalformfunctioncontainer::set(int h, int i, int j, int k, int l, i
 void hierarchicalformfunctioncontainer::evaluate(std::vector<double> evaluationpoints)
 {
     myevaluationpoints = evaluationpoints;
+    evaluate(evaluationpoints, val);
+}
 
-    for (int h = 0; h < val.size(); h++)
+hierarchicalformfunctioncontainer hierarchicalformfunctioncontainer::getvalues(std::vector<double> evaluationpoints) const
+{
+    hierarchicalformfunctioncontainer output(myformfunctiontypename, myelementtypenumber);
+    output.myevaluationpoints = evaluationpoints;
+    output.val = val;
+    
+    evaluate(evaluationpoints, output.val);
+    output.myisvalueready = true;
+    
+    return output;
+}
+
+void hierarchicalformfunctioncontainer::evaluate(std::vector<double>& evaluationpoints, vector<vector<vector<vector<vector<vector<vector<vector<double>>>>>>>>& targetval) const
+{
+    int numevalpts = evaluationpoints.size()/3;
+
+    // All polynomials are evaluated together. Get them in the order of the loops below:
+    std::vector<polynomial> allpolys = {};
+    for (int h = 0; h < ffpoly.size(); h++)
     {
-        for (int i = 0; i < val[h].size(); i++)
+        for (int i = 0; i < ffpoly[h].size(); i++)
         {
-            for (int j = 0; j < val[h][i].size(); j++)
+            for (int j = 0; j < ffpoly[h][i].size(); j++)
             {
-                for (int k = 0; k < val[h][i][j].size(); k++)
+                for (int k = 0; k < ffpoly[h][i][j].size(); k++)
                 {
-                    for (int l = 0; l < val[h][i][j][k].size(); l++)
+                    for (int l = 0; l < ffpoly[h][i][j][k].size(); l++)
                     {
-                        for (int m = 0; m < val[h][i][j][k][l].size(); m++)
+                        for (int n = 0; n < ffpoly[h][i][j][k][l].size(); n++)
+                            allpolys.push_back(ffpoly[h][i][j][k][l][n]);
+                    }
+                }
+            }
+        }
+    }
+    if (allpolys.size() == 0)
+        return;
+    
+    polynomials polys(allpolys);
+    
+    for (int m = 0; m < 4; m++)
+    {
+        densemat evaled = polys.evalat(evaluationpoints, m);
+        double* evaledvals = evaled.getvalues();
+        
+        int index = 0;
+        for (int h = 0; h < targetval.size(); h++)
+        {
+            for (int i = 0; i < targetval[h].size(); i++)
+            {
+                for (int j = 0; j < targetval[h][i].size(); j++)
+                {
+                    for (int k = 0; k < targetval[h][i][j].size(); k++)
+                    {
+                        for (int l = 0; l < targetval[h][i][j][k].size(); l++)
                         {
-                            for (int n = 0; n < val[h][i][j][k][l][m].size(); n++)
-                                val[h][i][j][k][l][m][n] = ffpoly[h][i][j][k][l][n].evalat(evaluationpoints, m);
+                            for (int n = 0; n < targetval[h][i][j][k][l][m].size(); n++)
+                            {
+                                targetval[h][i][j][k][l][m][n] = std::vector<double>(evaledvals + index*numevalpts, evaledvals + (index+1)*numevalpts);
+                                index++;
+                            }
                         }
                     }
                 }
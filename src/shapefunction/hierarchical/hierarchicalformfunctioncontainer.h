@@ -45,6 +45,9 @@ class hierarchicalformfunctioncontainer
         
         // The form function polynomials are stored in the same format but without [m] and [o]:
         vector<vector<vector<vector<vector<vector<polynomial>>>>>> ffpoly = {};
+        
+        // Evaluate all form function polynomials at the evaluation points into 'targetval' (preallocated like 'val'):
+        void evaluate(std::vector<double>& evaluationpoints, vector<vector<vector<vector<vector<vector<vector<vector<double>>>>>>>>& targetval) const;
 
     public:
 
@@ -54,6 +57,10 @@ class hierarchicalformfunctioncontainer
         bool isvalueready(void) { return myisvalueready; };
         void setvaluestatus(bool valstatus) { myisvalueready = valstatus; };
         
+        std::string gettypename(void) { return myformfunctiontypename; };
+        int getelementtypenumber(void) { return myelementtypenumber; };
+        std::vector<double>& getevaluationpoints(void) { return myevaluationpoints; };
+        
         // Know the highest order available in the container.
         int gethighestorder(void) { return val.size()-1; };
 
@@ -64,6 +71,8 @@ class hierarchicalformfunctioncontainer
         
         // Evaluate all form function polynomials at the evaluation points provided:
         void evaluate(std::vector<double> evaluationpoints);
+        // Get a container holding only the values at the evaluation points provided (this container is not modified):
+        hierarchicalformfunctioncontainer getvalues(std::vector<double> evaluationpoints) const;
 
         // 'tomatrix' puts all form function values corresponding to the 
         // input arguments into a 'densemat' object. The columns of the 
@@ -0,0 +1,251 @@
+#include "sumfactorization.h"
+
+
+bool sumfactorization::isitenabled = true;
+int sumfactorization::minimumorder = 4;
+
+std::vector<double> sumfactorization::contract(std::vector<double>& in, std::vector<int>& sizes, int numelems, int axis, std::vector<double>& table, int newsize)
+{
+    int oldsize = sizes[axis];
+
+    long long int outer = 1, inner = numelems;
+    for (int a = 0; a < axis; a++)
+        outer *= sizes[a];
+    for (int a = axis+1; a < sizes.size(); a++)
+        inner *= sizes[a];
+
+    std::vector<double> out(outer*newsize*inner, 0.0);
+
+    for (long long int o = 0; o < outer; o++)
+    {
+        for (int g = 0; g < newsize; g++)
+        {
+            double* outrow = &out[(o*newsize+g)*inner];
+            for (int d = 0; d < oldsize; d++)
+            {
+                double t = table[g*oldsize+d];
+                if (t == 0)
+                    continue;
+                double* inrow = &in[(o*oldsize+d)*inner];
+                #pragma omp simd
+                for (long long int i = 0; i < inner; i++)
+                    outrow[i] += t*inrow[i];
+            }
+        }
+    }
+    sizes[axis] = newsize;
+
+    return out;
+}
+
+bool sumfactorization::isapplicable(std::string fftypename, int elementtypenumber, int order, int formfunctioncomponent)
+{
+    // Only quadrangles (3) and hexahedra (5) have tensor product interior form functions:
+    return (isitenabled && fftypename == "h1" && (elementtypenumber == 3 || elementtypenumber == 5) && order >= 2 && order >= minimumorder && formfunctioncomponent == 0);
+}
+
+sumfactorization::sumfactorization(int elementtypenumber, int totalorientation, int order, std::vector<double>& evaluationcoordinates)
+{
+    mydim = (elementtypenumber == 3) ? 2 : 3;
+    myorder = order;
+
+    ///// Check that the evaluation points are a tensor product grid with
+    // the first reference direction varying the slowest (as for the Gauss points):
+    int numpoints = evaluationcoordinates.size()/3;
+    mynumpoints1d = std::round(std::pow(numpoints, 1.0/mydim));
+    if (mynumpoints1d <= 0 || std::pow(mynumpoints1d, mydim) != numpoints)
+        return;
+
+    std::vector<int> strides(mydim, 1);
+    for (int a = mydim-2; a >= 0; a--)
+        strides[a] = strides[a+1]*mynumpoints1d;
+
+    mypoints1d = std::vector<std::vector<double>>(mydim, std::vector<double>(mynumpoints1d));
+    for (int a = 0; a < mydim; a++)
+    {
+        for (int i = 0; i < mynumpoints1d; i++)
+            mypoints1d[a][i] = evaluationcoordinates[3*i*strides[a]+a];
+    }
+    for (int gp = 0; gp < numpoints; gp++)
+    {
+        for (int a = 0; a < mydim; a++)
+        {
+            if (std::abs(evaluationcoordinates[3*gp+a] - mypoints1d[a][(gp/strides[a])%mynumpoints1d]) > 1e-12)
+                return;
+        }
+    }
+
+    ///// Get the reference direction and sign of every Legendre index:
+    if (mydim == 3)
+    {
+        myaxis = {0,1,2};
+        mysign = {1.0,1.0,1.0};
+    }
+    else
+    {
+        // Follow the definition of 'xiF' and 'etaF' in 'h1quadrangle'. In the reference
+        // coordinates xiF = sigma[f1]-sigma[f2] and etaF = sigma[f1]-sigma[f4] are +/- ki or eta.
+        element quadrangle("quadrangle");
+        std::vector<int> nodesinfaces = quadrangle.getfacesdefinitionsbasedonnodes();
+        std::vector<std::vector<int>> reordering = orientation::getreorderingtoreferencequadrangularfaceorientation();
+        int faceorientation = orientation::getfacesorientationsfromtotalorientation(totalorientation, elementtypenumber)[0];
+
+        int f1 = nodesinfaces[reordering[faceorientation][0]];
+        int f2 = nodesinfaces[reordering[faceorientation][1]];
+        int f4 = nodesinfaces[reordering[faceorientation][3]];
+
+        // Gradient of the sigma polynomials in the shifted coordinates:
+        double sigmagrad[4][2] = {{-1.0,-1.0},{1.0,-1.0},{1.0,1.0},{-1.0,1.0}};
+
+        myaxis = std::vector<int>(2);
+        mysign = std::vector<double>(2);
+        int secondnodes[2] = {f2, f4};
+        for (int c = 0; c < 2; c++)
+        {
+            double cki = 0.5*(sigmagrad[f1][0]-sigmagrad[secondnodes[c]][0]);
+            double ceta = 0.5*(sigmagrad[f1][1]-sigmagrad[secondnodes[c]][1]);
+            myaxis[c] = (cki != 0) ? 0 : 1;
+            mysign[c] = (cki != 0) ? cki : ceta;
+        }
+    }
+
+    ///// Get the tensor position of every interior form function:
+    int n = order-1;
+    for (int o = 2; o <= order; o++)
+    {
+        // Same loops as in 'h1quadrangle' and 'h1hexahedron':
+        int klast = (mydim == 3) ? o-2 : 0;
+        for (int i = 0; i <= o-2; i++)
+        {
+            for (int j = 0; j <= o-2; j++)
+            {
+                for (int k = 0; k <= klast; k++)
+                {
+                    // Skip the part corresponding to a lower order:
+                    if (i != o-2 && j != o-2 && (mydim == 2 || k != o-2))
+                        continue;
+
+                    int indexes[3] = {i,j,k};
+                    std::vector<int> position(mydim);
+                    for (int c = 0; c < mydim; c++)
+                        position[myaxis[c]] = indexes[c];
+
+                    int pos = 0;
+                    for (int a = 0; a < mydim; a++)
+                        pos = pos*n + position[a];
+                    mytensorposition.push_back(pos);
+                }
+            }
+        }
+    }
+
+    ///// Evaluate the 1D factors:
+    polynomial ki;
+    ki.set({{{}},{{{1.0}}}});
+
+    myfactors = std::vector<std::vector<std::vector<double>>>(mydim, std::vector<std::vector<double>>(2, std::vector<double>(n*mynumpoints1d)));
+    for (int c = 0; c < mydim; c++)
+    {
+        int a = myaxis[c];
+
+        std::vector<double> points(3*mynumpoints1d, 0.0);
+        for (int i = 0; i < mynumpoints1d; i++)
+            points[3*i+0] = mypoints1d[a][i];
+
+        std::vector<polynomial> Lsigned = legendre::L(order, mysign[c]*ki);
+
+        for (int d = 0; d < 2; d++)
+        {
+            for (int deg = 0; deg < n; deg++)
+            {
+                std::vector<double> vals = Lsigned[deg+2].evalat(points, d);
+                for (int i = 0; i < mynumpoints1d; i++)
+                    myfactors[a][d][deg*mynumpoints1d+i] = vals[i];
+            }
+        }
+    }
+
+    myisvalid = true;
+}
+
+densemat sumfactorization::interpolate(densemat interiorcoefs, int whichderivative)
+{
+    int n = myorder-1;
+    int numelems = interiorcoefs.countcolumns();
+    int numpoints = std::pow(mynumpoints1d, mydim);
+
+    if (whichderivative > mydim)
+        return densemat(numelems, numpoints, 0.0);
+
+    // Tensor of the coefficients with the element index contiguous:
+    std::vector<int> sizes(mydim, n);
+    std::vector<double> tensor(std::pow(n, mydim)*numelems, 0.0);
+
+    double* coefvals = interiorcoefs.getvalues();
+    for (int ff = 0; ff < mytensorposition.size(); ff++)
+    {
+        double* target = &tensor[mytensorposition[ff]*numelems];
+        for (int e = 0; e < numelems; e++)
+            target[e] = coefvals[ff*numelems+e];
+    }
+
+    for (int a = 0; a < mydim; a++)
+    {
+        std::vector<double>& factors = myfactors[a][whichderivative == a+1];
+
+        // Transposed table (numpoints1d x n):
+        std::vector<double> table(mynumpoints1d*n);
+        for (int deg = 0; deg < n; deg++)
+        {
+            for (int i = 0; i < mynumpoints1d; i++)
+                table[i*n+deg] = factors[deg*mynumpoints1d+i];
+        }
+
+        tensor = contract(tensor, sizes, numelems, a, table, mynumpoints1d);
+    }
+
+    densemat output(numelems, numpoints);
+    double* outvals = output.getvalues();
+    for (int gp = 0; gp < numpoints; gp++)
+    {
+        for (int e = 0; e < numelems; e++)
+            outvals[e*numpoints+gp] = tensor[gp*numelems+e];
+    }
+
+    return output;
+}
+
+densemat sumfactorization::integrate(densemat values, std::vector<double>& weights, int whichderivative)
+{
+    int n = myorder-1;
+    int numelems = values.countrows();
+    int numinterior = mytensorposition.size();
+    int numpoints = weights.size();
+
+    if (whichderivative > mydim)
+        return densemat(numinterior, numelems, 0.0);
+
+    // Tensor of the weighted values with the element index contiguous:
+    std::vector<int> sizes(mydim, mynumpoints1d);
+    double* vals = values.getvalues();
+    std::vector<double> tensor(values.count());
+    for (int gp = 0; gp < numpoints; gp++)
+    {
+        for (int e = 0; e < numelems; e++)
+            tensor[gp*numelems+e] = weights[gp]*vals[e*numpoints+gp];
+    }
+
+    for (int a = 0; a < mydim; a++)
+        tensor = contract(tensor, sizes, numelems, a, myfactors[a][whichderivative == a+1], n);
+
+    densemat output(numinterior, numelems);
+    double* outvals = output.getvalues();
+    for (int ff = 0; ff < numinterior; ff++)
+    {
+        double* source = &tensor[mytensorposition[ff]*numelems];
+        for (int e = 0; e < numelems; e++)
+            outvals[ff*numelems+e] = source[e];
+    }
+
+    return output;
+}
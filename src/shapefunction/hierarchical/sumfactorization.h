@@ -0,0 +1,95 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// The interior (face based for quadrangles, volume based for hexahedra) 'h1'
+// form functions are products of 1D integrated Legendre polynomials, one per
+// reference direction. On a tensor product grid of evaluation points (e.g. the
+// Gauss points) the interpolation and integration of these form functions can
+// be performed one direction at a time. This reduces the cost per element from
+// O(p^6) to O(p^4) on hexahedra and from O(p^4) to O(p^3) on quadrangles.
+//
+// It is used for the field interpolation and for the test function integrals of
+// the terms without dof (rhs). The dof x tf stiffness blocks, the non-interior
+// form functions and the hcurl form functions still use the dense form function
+// matrices: the matrix assembly is not accelerated.
+
+#ifndef SUMFACTORIZATION_H
+#define SUMFACTORIZATION_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include "densemat.h"
+#include "polynomial.h"
+#include "legendre.h"
+#include "orientation.h"
+#include "element.h"
+
+class sumfactorization
+{
+    private:
+
+        static bool isitenabled;
+        // Minimum interpolation order for which the sum factorization is used:
+        static int minimumorder;
+
+        // True if the evaluation coordinates are a tensor product grid:
+        bool myisvalid = false;
+
+        int mydim = 0;
+        int myorder = 0;
+
+        // Number of 1D evaluation points and 1D points in every reference direction:
+        int mynumpoints1d = 0;
+        std::vector<std::vector<double>> mypoints1d = {};
+
+        // The 'c'th Legendre index of the interior form functions acts on reference
+        // direction 'myaxis[c]' with a sign 'mysign[c]' (depends on the orientation):
+        std::vector<int> myaxis = {};
+        std::vector<double> mysign = {};
+
+        // Position in the (order-1)^dim tensor of every interior form function.
+        // The form functions are ordered as in 'hierarchicalformfunctioniterator'.
+        std::vector<int> mytensorposition = {};
+
+        // 'myfactors[a][d]' is the (order-1) x numpoints1d table of the 1D factors
+        // in reference direction 'a' without (d = 0) or with (d = 1) derivative:
+        std::vector<std::vector<std::vector<double>>> myfactors = {};
+
+        // Replace reference direction 'axis' of the el-contiguous tensor 'in' of sizes
+        // 'sizes' by its product with the 'newsize' x sizes[axis] row major 'table':
+        std::vector<double> contract(std::vector<double>& in, std::vector<int>& sizes, int numelems, int axis, std::vector<double>& table, int newsize);
+
+    public:
+
+        // The sum factorization is enabled by default:
+        static void enable(bool isenabled = true) { isitenabled = isenabled; };
+        static bool isenabled(void) { return isitenabled; };
+        static void setminimumorder(int minorder) { minimumorder = minorder; };
+
+        // Check if the sum factorization can be used for the arguments provided.
+        // The tensor grid check is performed when constructing the object.
+        static bool isapplicable(std::string fftypename, int elementtypenumber, int order, int formfunctioncomponent);
+
+        sumfactorization(int elementtypenumber, int totalorientation, int order, std::vector<double>& evaluationcoordinates);
+
+        bool isvalid(void) { return myisvalid; };
+
+        // Number of interior form functions (they are the last ones in the form function ordering):
+        int countinterior(void) { return mytensorposition.size(); };
+
+        // Interpolate the 'numinterior x numelements' interior coefficients at the
+        // evaluation points. The output has size numelements x numevaluationpoints.
+        // Argument 'whichderivative' is 0 for no derivative, 1, 2, 3 for ki, eta, phi.
+        densemat interpolate(densemat interiorcoefs, int whichderivative);
+        // Integrate the 'numelements x numevaluationpoints' values times the weights
+        // against all interior form functions. The output has size numinterior x numelements.
+        densemat integrate(densemat values, std::vector<double>& weights, int whichderivative);
+
+};
+
+#endif
@@ -68,7 +68,7 @@ void lagrangeformfunction::preparecoords(void)
     }
     
     // To avoid problems at the y axis in axisymmetric simulations the nodes are brought slightly closer to the barycenter:
-    if (universe::isaxisymmetric)
+    if (universe::getsession()->isaxisymmetric)
     {
         int numnodes = mynodecoordinates.size()/3;
     
@@ -105,15 +105,9 @@ densemat lagrangeformfunction::getderivative(int whichderivative)
     if (evaluated[whichderivative].isdefined())
         return evaluated[whichderivative].copy();
     
-    element myelement(myelementtypenumber, myorder);
-    int numberofformfunctions = myelement.countcurvednodes();
-    int numberofevaluationpoints = myevaluationpoints.size()/3;
-    
-    evaluated[whichderivative] = densemat(numberofformfunctions, numberofevaluationpoints);
-    
-    // Fill the dense matrices with the polynomial value:
-    for (int i = 0; i < numberofformfunctions; i++)
-        evaluated[whichderivative].setrow(i, myformfunctionpolynomials[i].evalat(myevaluationpoints, whichderivative));
+    // All form functions are evaluated at once:
+    polynomials polys(myformfunctionpolynomials);
+    evaluated[whichderivative] = polys.evalat(myevaluationpoints, whichderivative);
 
     // Return a copy to make sure it is not changed.
     return evaluated[whichderivative].copy();
@@ -131,6 +125,41 @@ std::vector<polynomial> lagrangeformfunction::getformfunctionpolynomials(void)
     return myformfunctionpolynomials;
 }
 
+// The node coordinates depend on whether the simulation is axisymmetric:
+static std::map<std::tuple<int,int,bool>, std::vector<double>> cachednodecoordinates;
+static std::map<std::tuple<int,int,int,std::vector<double>>, densemat> cachedderivatives;
+static std::mutex lagrangecachemutex;
+
+std::vector<double> lagrangeformfunction::getcachednodecoordinates(int elementtypenumber, int order)
+{
+    std::lock_guard<std::mutex> lock(lagrangecachemutex);
+    
+    std::tuple<int,int,bool> key = std::make_tuple(elementtypenumber, order, universe::getsession()->isaxisymmetric);
+    
+    auto it = cachednodecoordinates.find(key);
+    if (it != cachednodecoordinates.end())
+        return it->second;
+    
+    std::vector<double> coords = lagrangeformfunction(elementtypenumber, order, {}).getnodecoordinates();
+    cachednodecoordinates[key] = coords;
+    return coords;
+}
+
+densemat lagrangeformfunction::getcachedderivative(int elementtypenumber, int order, const std::vector<double>& evaluationpoints, int whichderivative)
+{
+    std::lock_guard<std::mutex> lock(lagrangecachemutex);
+    
+    std::tuple<int,int,int,std::vector<double>> key = std::make_tuple(elementtypenumber, order, whichderivative, evaluationpoints);
+    
+    auto it = cachedderivatives.find(key);
+    if (it != cachedderivatives.end())
+        return it->second.copy();
+    
+    densemat values = lagrangeformfunction(elementtypenumber, order, evaluationpoints).getderivative(whichderivative);
+    cachedderivatives[key] = values;
+    return values.copy();
+}
+
 void lagrangeformfunction::print(void)
 {
     preparepoly();
@@ -13,6 +13,9 @@
 #include "polynomial.h"
 #include "element.h"
 #include <iomanip>
+#include <map>
+#include <tuple>
+#include <mutex>
 #include "universe.h"
 
 #include "lagrangepoint.h"
@@ -71,6 +74,10 @@ class lagrangeformfunction
         std::vector<double> getnodecoordinates(void);
         std::vector<polynomial> getformfunctionpolynomials(void);
         
+        // Same as above but kept for all later calls with the same arguments (e.g. for every output write). Thread safe.
+        static std::vector<double> getcachednodecoordinates(int elementtypenumber, int order);
+        static densemat getcachedderivative(int elementtypenumber, int order, const std::vector<double>& evaluationpoints, int whichderivative);
+        
         void print(void);
 };
 
@@ -134,6 +134,87 @@ void polynomials::evalatsingle(const std::vector<double>& evaluationpoint, int n
     }
 }
 
+template <int whichderivative>
+void polynomials::getmonomials(const std::vector<double>& evaluationpoints, double* monomialvals)
+{
+    int numpoints = evaluationpoints.size()/3;
+    
+    std::vector<double> kipowers(mykilen), etapowers(myetalen), phipowers(myphilen);
+    
+    for (int pt = 0; pt < numpoints; pt++)
+    {
+        double ki = evaluationpoints[3*pt+0], eta = evaluationpoints[3*pt+1], phi = evaluationpoints[3*pt+2];
+        
+        // The power is replaced by its derivative in the derivative direction ('da' is the derivative of 'a'):
+        double a = 1, da = 0;
+        for (int k = 0; k < mykilen; k++)
+        {
+            kipowers[k] = (whichderivative == 1) ? da : a;
+            da = (k+1)*a;
+            a *= ki;
+        }
+        double b = 1, db = 0;
+        for (int e = 0; e < myetalen; e++)
+        {
+            etapowers[e] = (whichderivative == 2) ? db : b;
+            db = (e+1)*b;
+            b *= eta;
+        }
+        double c = 1, dc = 0;
+        for (int p = 0; p < myphilen; p++)
+        {
+            phipowers[p] = (whichderivative == 3) ? dc : c;
+            dc = (p+1)*c;
+            c *= phi;
+        }
+        
+        int index = 0;
+        for (int k = 0; k < mykilen; k++)
+        {
+            for (int e = 0; e < myetalen; e++)
+            {
+                double ke = kipowers[k]*etapowers[e];
+                for (int p = 0; p < myphilen; p++)
+                {
+                    monomialvals[index*numpoints+pt] = ke*phipowers[p];
+                    index++;
+                }
+            }
+        }
+    }
+}
+
+densemat polynomials::evalat(const std::vector<double>& evaluationpoints, int whichderivative)
+{
+    int numpoints = evaluationpoints.size()/3;
+    
+    if (mynummonomials == 0 || numpoints == 0)
+        return densemat(mynumpolys, numpoints, 0.0);
+    
+    densemat monomialvals(mynummonomials, numpoints);
+    double* monvals = monomialvals.getvalues();
+    
+    switch (whichderivative)
+    {
+        case 0:
+            getmonomials<0>(evaluationpoints, monvals);
+            break;
+        case 1:
+            getmonomials<1>(evaluationpoints, monvals);
+            break;
+        case 2:
+            getmonomials<2>(evaluationpoints, monvals);
+            break;
+        case 3:
+            getmonomials<3>(evaluationpoints, monvals);
+            break;
+    }
+    
+    densemat coeffs(mynumpolys, mynummonomials, mycoeffs);
+    
+    return coeffs.multiply(monomialvals);
+}
+
 polynomials polynomials::sum(std::vector<double>& weights)
 {
     int num = weights.size()/mynumpolys;
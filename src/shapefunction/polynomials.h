@@ -10,6 +10,7 @@
 #include <iostream>
 #include <vector>
 #include "polynomial.h"
+#include "densemat.h"
 
 class polynomial;
 
@@ -22,6 +23,11 @@ class polynomials
         // Size in the ki, eta and phi direction:
         int mykilen = 0, myetalen = 0, myphilen = 0, mynummonomials = 0;
         std::vector<double> mycoeffs = {};
+        
+        // Fill the 'mynummonomials' x 'numpoints' matrix of the monomial values (or of their
+        // derivative in direction 'whichderivative') at the evaluation points provided:
+        template <int whichderivative>
+        void getmonomials(const std::vector<double>& evaluationpoints, double* monomialvals);
 
     public:
     
@@ -36,6 +42,11 @@ class polynomials
         // 'num' equal to 0/1/2/3 returns respectively poly/poly+dki/poly+dki+deta/poly+dki+deta+dphi. 
         void evalatsingle(const std::vector<double>& evaluationpoint, int num, std::vector<double>& evaled);
         
+        // Evaluate all polynomials at all points [ki1 eta1 phi1 ki2 eta2 phi2 ...] in a single matrix product.
+        // Set the int to 0 to get the no derivative value, 1 for dki, 2 for deta and 3 for dphi.
+        // The output has one row per polynomial and one column per evaluation point.
+        densemat evalat(const std::vector<double>& evaluationpoints, int whichderivative);
+        
         // Return the weighted sum of the original polynomials.
         // Output holds {p1,p2,...} where pi = sum_k( weights[ i * mynumpolys + k ] * originalpoly[k] ).
         polynomials sum(std::vector<double>& weights);
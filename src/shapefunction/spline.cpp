@@ -127,15 +127,75 @@ void spline::set(std::vector<double>& xin, std::vector<double>& yin)
         aparamvals[i] = kvals[i-1]*(xvals[i]-xvals[i-1])-(yvals[i]-yvals[i-1]);
         bparamvals[i] = -kvals[i]*(xvals[i]-xvals[i-1])+(yvals[i]-yvals[i-1]);
     }
+    
+    myderivative = NULL;
+    computecoefficients();
+    createbuckets();
 }
 
-spline spline::getderivative(void)
+void spline::computecoefficients(void)
 {
-    spline spl;
-    spl = *this;
-    spl.derivativeorder++;
+    int len = myx.count();
+    double* xvals = myx.getvalues(); double* yvals = myy.getvalues();
+    double* avals = mya.getvalues(); double* bvals = myb.getvalues();
+    
+    mycoefs = densemat(len,4, 0.0);
+    double* coefvals = mycoefs.getvalues();
+    
+    // On interval i the spline is y[i-1] + (y[i]-y[i-1]+a)*tx + (b-2a)*tx^2 + (a-b)*tx^3 with tx = (x-x[i-1])/dx:
+    for (int i = 1; i < len; i++)
+    {
+        double invdx = 1.0/(xvals[i]-xvals[i-1]);
+        coefvals[4*i+0] = yvals[i-1];
+        coefvals[4*i+1] = (yvals[i]-yvals[i-1]+avals[i])*invdx;
+        coefvals[4*i+2] = (bvals[i]-2.0*avals[i])*invdx*invdx;
+        coefvals[4*i+3] = (avals[i]-bvals[i])*invdx*invdx*invdx;
+    }
+}
+
+void spline::createbuckets(void)
+{
+    int len = myx.count();
+    double* xvals = myx.getvalues();
+    
+    // A few buckets per interval keeps the search short for unevenly spaced data:
+    int numbuckets = 4*(len-1);
+    mybucketinvsize = numbuckets/(xmax-xmin);
+    mybuckets.resize(numbuckets);
+    
+    int curinterval = 1;
+    for (int b = 0; b < numbuckets; b++)
+    {
+        double bucketstart = xmin + b/mybucketinvsize;
+        while (curinterval < len-1 && xvals[curinterval] <= bucketstart)
+            curinterval++;
+        mybuckets[b] = curinterval;
+    }
+}
 
-    return spl;
+spline spline::getderivative(void)
+{
+    if (myderivative == NULL)
+    {
+        myderivative = std::shared_ptr<spline>(new spline);
+        *myderivative = *this;
+        myderivative->myderivative = NULL;
+        myderivative->derivativeorder++;
+        
+        // Differentiate the polynomial on every interval:
+        int len = myx.count();
+        myderivative->mycoefs = densemat(len,4, 0.0);
+        double* coefvals = mycoefs.getvalues();
+        double* dercoefvals = myderivative->mycoefs.getvalues();
+        for (int i = 1; i < len; i++)
+        {
+            dercoefvals[4*i+0] = coefvals[4*i+1];
+            dercoefvals[4*i+1] = 2.0*coefvals[4*i+2];
+            dercoefvals[4*i+2] = 3.0*coefvals[4*i+3];
+        }
+    }
+    
+    return *myderivative;
 }
 
 double spline::evalat(double input)
@@ -156,67 +216,68 @@ std::vector<double> spline::evalat(std::vector<double> input)
 
 densemat spline::evalat(densemat input)
 {
-    int numin = input.count();
+    long long int numin = input.count();
     double* inputvals = input.getvalues();
-
-    std::vector<double> invals;
-    input.getvalues(invals);
-    
-    // Sort the input data ascendingly:
-    std::vector<int> reorderingvector;
-    gentools::stablesort(0, invals, reorderingvector);
-    for (int i = 0; i < numin; i++)
-        inputvals[i] = invals[reorderingvector[i]];
-    double inmin = inputvals[0]; double inmax = inputvals[numin-1];
     
     // Error if request is out of range:
-    double absnoise = noisethreshold*std::abs(xmax-xmin);
-    if (inmin < xmin-absnoise || inmax > xmax+absnoise)
+    if (numin > 0)
     {
-        std::cout << "Error in 'spline' object: data requested in interval (" << inmin << "," << inmax << ") is out of the provided data range (" << xmin << "," << xmax << ")" << std::endl;
-        abort();
+        double inmin = inputvals[0]; double inmax = inputvals[0];
+        for (long long int i = 1; i < numin; i++)
+        {
+            inmin = std::min(inmin, inputvals[i]);
+            inmax = std::max(inmax, inputvals[i]);
+        }
+        double absnoise = noisethreshold*std::abs(xmax-xmin);
+        if (inmin < xmin-absnoise || inmax > xmax+absnoise)
+        {
+            std::cout << "Error in 'spline' object: data requested in interval (" << inmin << "," << inmax << ") is out of the provided data range (" << xmin << "," << xmax << ")" << std::endl;
+            abort();
+        }
     }
     
+    densemat output(input.countrows(),input.countcolumns());
+    double* outputvals = output.getvalues();
     
-    std::vector<double> outvec(numin);
-    
-    // Get the corresponding data via spline interpolation.
-    double* xvals = myx.getvalues(); double* yvals = myy.getvalues();
-    double* avals = mya.getvalues(); double* bvals = myb.getvalues();
+    int len = myx.count();
+    int numbuckets = mybuckets.size();
+    double* xvals = myx.getvalues();
+    double* coefvals = mycoefs.getvalues();
     
-    // First find the corresponding spline:
-    int curspline = 1;
-    for (int i = 0; i < numin; i++)
+    // The intervals are found for a block of values then the cubic polynomials are evaluated at once:
+    const int blocksize = 256;
+    int intervals[blocksize];
+    for (long long int start = 0; start < numin; start += blocksize)
     {
-        double cur = inputvals[i];
-        // Find the spline:
-        while (xvals[curspline] < cur-absnoise)
-            curspline++;
-        // Interpolate on the spline:
-        double dx = xvals[curspline]-xvals[curspline-1];
-        double tx = (cur-xvals[curspline-1])/dx;
-        double a = avals[curspline];
-        double b = bvals[curspline];
+        int curlen = std::min((long long int)blocksize, numin-start);
+        double* curin = inputvals+start;
+        double* curout = outputvals+start;
+        
+        for (int i = 0; i < curlen; i++)
+        {
+            double cur = curin[i];
+            // Values slightly out of range (within the noise) are in the first or last bucket:
+            double bucket = (cur-xmin)*mybucketinvsize;
+            if (not(bucket >= 0.0))
+                bucket = 0.0;
+            if (bucket > numbuckets-1)
+                bucket = numbuckets-1;
+            int curinterval = mybuckets[(int)bucket];
+            while (curinterval < len-1 && xvals[curinterval] < cur)
+                curinterval++;
+            intervals[i] = curinterval;
+        }
         
-        if (derivativeorder == 0)
-            outvec[i] = (1.0-tx)*yvals[curspline-1] + tx*yvals[curspline] + tx*(1.0-tx)*((1.0-tx)*a+tx*b);
-        if (derivativeorder == 1)
-            outvec[i] = 1.0/dx * (yvals[curspline]-yvals[curspline-1] + (1.0-2.0*tx)*(a*(1.0-tx)+b*tx) + tx*(1.0-tx)*(b-a));
-        if (derivativeorder == 2)
-            outvec[i] = 2.0/(dx*dx) * (b-2.0*a + (a-b)*3.0*tx);
-        if (derivativeorder == 3)
-            outvec[i] = 6.0/(dx*dx*dx) * (a-b);
-        if (derivativeorder > 3)
-            outvec[i] = 0.0;
+        #pragma omp simd
+        for (int i = 0; i < curlen; i++)
+        {
+            int curinterval = intervals[i];
+            double t = curin[i]-xvals[curinterval-1];
+            double* c = coefvals+4*curinterval;
+            curout[i] = c[0] + t*(c[1] + t*(c[2] + t*c[3]));
+        }
     }
     
-    // Unsort the data:
-    densemat output(input.countrows(),input.countcolumns());
-    double* outputvals = output.getvalues();
-    
-    for (int i = 0; i < numin; i++)
-        outputvals[reorderingvector[i]] = outvec[i];
-    
     return output;
 }
 
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <memory>
 #include "densemat.h"
 
 class spline
@@ -28,6 +29,20 @@ class spline
         densemat mya, myb;
         
         int derivativeorder = 0;
+        
+        // Coefficients c0 to c3 of the cubic polynomial (in x-x[i-1]) on every interval i,
+        // for the current derivative order:
+        densemat mycoefs;
+        // Uniform bucket index over [xmin,xmax] giving the first interval overlapping every bucket:
+        std::vector<int> mybuckets = {};
+        double mybucketinvsize = 0.0;
+        // The derivative spline is computed on the first call to 'getderivative':
+        std::shared_ptr<spline> myderivative = NULL;
+        
+        // Compute the polynomial coefficients from the spline parameters:
+        void computecoefficients(void);
+        // Create the bucket index:
+        void createbuckets(void);
     
     public:
     
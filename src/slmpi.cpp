@@ -1,5 +1,12 @@
 #include "slmpi.h"
 #include "wallclock.h"
+#include <thread>
+#include <cstdlib>
+#include <algorithm>
+#include "omp.h"
+#include "asyncwriter.h"
+#include "universe.h"
+#include "gentools.h"
 
 
 void slmpi::errornompi(void)
@@ -15,6 +22,8 @@ void slmpi::initialize(void) {}
 void slmpi::finalize(void) {}
 int slmpi::getrank(void) { return 0; }
 int slmpi::count(void) { return 1; }
+int slmpi::countonnode(void) { return 1; }
+bool slmpi::isthreadmultiple(void) { return false; }
 void slmpi::barrier(void) {}
 void slmpi::send(int destination, int tag, std::vector<int>& data) { errornompi(); }
 void slmpi::send(int destination, int tag, std::vector<double>& data) { errornompi(); }
@@ -43,12 +52,17 @@ void slmpi::scatter(int scatterer, std::vector<int>& toscatter, std::vector<int>
 void slmpi::scatter(int scatterer, std::vector<double>& toscatter, std::vector<double>& fragment) { errornompi(); }
 void slmpi::scatter(int scatterer, std::vector<int>& toscatter, std::vector<int>& fragment, std::vector<int>& fragsizes) { errornompi(); }
 void slmpi::scatter(int scatterer, std::vector<double>& toscatter, std::vector<double>& fragment, std::vector<int>& fragsizes) { errornompi(); }
+void slmpi::alltoall(std::vector<std::vector<int>>& sends, std::vector<std::vector<int>>& receives) { errornompi(); }
+void slmpi::alltoall(std::vector<std::vector<double>>& sends, std::vector<std::vector<double>>& receives) { errornompi(); }
 void slmpi::exchange(std::vector<int> targetranks, std::vector<int>& sendvalues, std::vector<int>& receivevalues) { errornompi(); }
 void slmpi::exchange(std::vector<int> targetranks, std::vector<double>& sendvalues, std::vector<double>& receivevalues) { errornompi(); }
 void slmpi::exchange(std::vector<int> targetranks, std::vector<std::vector<int>>& sends, std::vector<std::vector<int>>& receives) { errornompi(); }
 void slmpi::exchange(std::vector<int> targetranks, std::vector<std::vector<double>>& sends, std::vector<std::vector<double>>& receives) { errornompi(); }
 void slmpi::exchange(std::vector<int> targetranks, std::vector<int> sendlens, std::vector<int*> sendbuffers, std::vector<int> receivelens, std::vector<int*> receivebuffers) { errornompi(); }
 void slmpi::exchange(std::vector<int> targetranks, std::vector<int> sendlens, std::vector<double*> sendbuffers, std::vector<int> receivelens, std::vector<double*> receivebuffers) { errornompi(); }
+int slmpi::isend(int destination, int tag, int len, double* data) { errornompi(); abort(); }
+int slmpi::ireceive(int source, int tag, int len, double* data) { errornompi(); abort(); }
+void slmpi::wait(std::vector<int> handles) { errornompi(); }
 std::vector<double> slmpi::ping(int messagesize, int verbosity) { errornompi(); abort(); }
 #endif
 
@@ -56,16 +70,42 @@ std::vector<double> slmpi::ping(int messagesize, int verbosity) { errornompi();
 #ifdef HAVE_MPI
 
 #include "mpi.h"
+#include <unordered_map>
+
+// Pending requests of the split-phase communications:
+std::unordered_map<int, MPI_Request> slmpipendingrequests;
+int slmpinexthandle = 0;
+
+// Number of ranks on this node:
+int slmpinumonnode = 1;
 
 bool slmpi::isavailable(void) { return true; }
 
 void slmpi::initialize(void)
 {
-    MPI_Init(NULL, NULL);
+    int provided;
+    MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &provided);
+    
+    if (provided < MPI_THREAD_FUNNELED && getrank() == 0)
+        std::cout << "Warning in 'slmpi' namespace: the MPI library does not support MPI_THREAD_FUNNELED (run with a single thread per rank)" << std::endl;
+
+    MPI_Comm nodecomm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodecomm);
+    MPI_Comm_size(nodecomm, &slmpinumonnode);
+    MPI_Comm_free(&nodecomm);
+    
+    // Share the cores of the node between its ranks (unless requested otherwise):
+    if (std::getenv("OMP_NUM_THREADS") == NULL)
+    {
+        int numcores = std::max((int)std::thread::hardware_concurrency(), 1);
+        omp_set_num_threads(std::max(numcores/slmpinumonnode, 1));
+    }
 }
 
 void slmpi::finalize(void)
 {
+    // The queued output files are written first:
+    asyncwriter::flush();
     MPI_Finalize();
 }
 
@@ -83,6 +123,18 @@ int slmpi::count(void)
     return world_size;
 }
 
+int slmpi::countonnode(void)
+{
+    return slmpinumonnode;
+}
+
+bool slmpi::isthreadmultiple(void)
+{
+    int provided;
+    MPI_Query_thread(&provided);
+    return (provided == MPI_THREAD_MULTIPLE);
+}
+
 void slmpi::barrier(void)
 {
     MPI_Barrier(MPI_COMM_WORLD);
@@ -123,6 +175,18 @@ void slmpi::sum(int len, long long int* data)
 
 void slmpi::sum(int len, double* data)
 {
+    if (universe::isreductionreproducible)
+    {
+        // Every rank sums all contributions in the rank order instead of relying on the MPI reduction tree:
+        int numranks = count();
+        std::vector<double> allcontribs(numranks*len);
+        MPI_Allgather(data, len, MPI_DOUBLE, allcontribs.data(), len, MPI_DOUBLE, MPI_COMM_WORLD);
+        
+        for (int i = 0; i < len; i++)
+            data[i] = gentools::compensatedsum(allcontribs.data()+i, numranks, len);
+        return;
+    }
+    
     MPI_Allreduce(MPI_IN_PLACE, data, len, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 }
 
@@ -133,7 +197,7 @@ void slmpi::sum(std::vector<int>& data)
 
 void slmpi::sum(std::vector<double>& data)
 {
-    MPI_Allreduce(MPI_IN_PLACE, data.data(), data.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    sum(data.size(), data.data());
 }
 
 
@@ -293,6 +357,62 @@ void slmpi::scatter(int scatterer, std::vector<double>& toscatter, std::vector<d
 }
 
 
+void slmpi::alltoall(std::vector<std::vector<int>>& sends, std::vector<std::vector<int>>& receives)
+{
+    int numranks = count();
+
+    std::vector<int> sendlens(numranks), receivelens(numranks);
+    for (int r = 0; r < numranks; r++)
+        sendlens[r] = sends[r].size();
+    MPI_Alltoall(sendlens.data(), 1, MPI_INT, receivelens.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    std::vector<int> sendshifts(numranks, 0), receiveshifts(numranks, 0);
+    for (int r = 1; r < numranks; r++)
+    {
+        sendshifts[r] = sendshifts[r-1]+sendlens[r-1];
+        receiveshifts[r] = receiveshifts[r-1]+receivelens[r-1];
+    }
+
+    std::vector<int> senddata(sendshifts[numranks-1]+sendlens[numranks-1]);
+    std::vector<int> receivedata(receiveshifts[numranks-1]+receivelens[numranks-1]);
+    for (int r = 0; r < numranks; r++)
+        std::copy(sends[r].begin(), sends[r].end(), senddata.begin()+sendshifts[r]);
+
+    MPI_Alltoallv(senddata.data(), sendlens.data(), sendshifts.data(), MPI_INT, receivedata.data(), receivelens.data(), receiveshifts.data(), MPI_INT, MPI_COMM_WORLD);
+
+    receives = std::vector<std::vector<int>>(numranks);
+    for (int r = 0; r < numranks; r++)
+        receives[r] = std::vector<int>(receivedata.begin()+receiveshifts[r], receivedata.begin()+receiveshifts[r]+receivelens[r]);
+}
+
+void slmpi::alltoall(std::vector<std::vector<double>>& sends, std::vector<std::vector<double>>& receives)
+{
+    int numranks = count();
+
+    std::vector<int> sendlens(numranks), receivelens(numranks);
+    for (int r = 0; r < numranks; r++)
+        sendlens[r] = sends[r].size();
+    MPI_Alltoall(sendlens.data(), 1, MPI_INT, receivelens.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    std::vector<int> sendshifts(numranks, 0), receiveshifts(numranks, 0);
+    for (int r = 1; r < numranks; r++)
+    {
+        sendshifts[r] = sendshifts[r-1]+sendlens[r-1];
+        receiveshifts[r] = receiveshifts[r-1]+receivelens[r-1];
+    }
+
+    std::vector<double> senddata(sendshifts[numranks-1]+sendlens[numranks-1]);
+    std::vector<double> receivedata(receiveshifts[numranks-1]+receivelens[numranks-1]);
+    for (int r = 0; r < numranks; r++)
+        std::copy(sends[r].begin(), sends[r].end(), senddata.begin()+sendshifts[r]);
+
+    MPI_Alltoallv(senddata.data(), sendlens.data(), sendshifts.data(), MPI_DOUBLE, receivedata.data(), receivelens.data(), receiveshifts.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+    receives = std::vector<std::vector<double>>(numranks);
+    for (int r = 0; r < numranks; r++)
+        receives[r] = std::vector<double>(receivedata.begin()+receiveshifts[r], receivedata.begin()+receiveshifts[r]+receivelens[r]);
+}
+
 void slmpi::exchange(std::vector<int> targetranks, std::vector<int>& sendvalues, std::vector<int>& receivevalues)
 {
     int numtargets = targetranks.size();
@@ -424,6 +544,46 @@ void slmpi::exchange(std::vector<int> targetranks, std::vector<int> sendlens, st
     MPI_Waitall(numtargets, &sendrequests[0], MPI_STATUSES_IGNORE);
     MPI_Waitall(numtargets, &receiverequests[0], MPI_STATUSES_IGNORE);
 }
+
+
+int slmpi::isend(int destination, int tag, int len, double* data)
+{
+    int handle = slmpinexthandle;
+    slmpinexthandle++;
+    
+    MPI_Isend(data, len, MPI_DOUBLE, destination, tag, MPI_COMM_WORLD, &slmpipendingrequests[handle]);
+    
+    return handle;
+}
+
+int slmpi::ireceive(int source, int tag, int len, double* data)
+{
+    int handle = slmpinexthandle;
+    slmpinexthandle++;
+    
+    MPI_Irecv(data, len, MPI_DOUBLE, source, tag, MPI_COMM_WORLD, &slmpipendingrequests[handle]);
+    
+    return handle;
+}
+
+void slmpi::wait(std::vector<int> handles)
+{
+    std::vector<MPI_Request> requests(handles.size());
+    for (int i = 0; i < handles.size(); i++)
+    {
+        auto it = slmpipendingrequests.find(handles[i]);
+        if (it == slmpipendingrequests.end())
+        {
+            std::cout << "Error in 'slmpi' namespace: cannot wait for unknown communication handle " << handles[i] << std::endl;
+            abort();
+        }
+        requests[i] = it->second;
+        slmpipendingrequests.erase(it);
+    }
+    
+    if (requests.size() > 0)
+        MPI_Waitall(requests.size(), &requests[0], MPI_STATUSES_IGNORE);
+}
     
 
 std::vector<double> slmpi::ping(int messagesize, int verbosity)
@@ -15,11 +15,17 @@ namespace slmpi
     
     void errornompi(void);
 
+    // MPI is initialized with MPI_THREAD_FUNNELED support: threads can be used for the computations between
+    // the MPI calls (all from the main thread). The OpenMP threads (BLAS, MUMPS) are set to the cores per rank.
     void initialize(void);
     void finalize(void);
 
     int getrank(void);
     int count(void);
+    // Number of ranks on the same node as this rank (all sharing its cores):
+    int countonnode(void);
+    // True if MPI calls can be made from any thread (MPI_THREAD_MULTIPLE):
+    bool isthreadmultiple(void);
     
     void barrier(void);
 
@@ -29,7 +35,8 @@ namespace slmpi
     void receive(int source, int tag, std::vector<int>& data);
     void receive(int source, int tag, std::vector<double>& data);
     
-    // Sum values from all ranks and distribute the result back to all ranks:
+    // Sum values from all ranks and distribute the result back to all ranks (the double sums are
+    // computed in the rank order when 'universe::isreductionreproducible' is true):
     void sum(int len, int* data);
     void sum(int len, long long int* data);
     void sum(int len, double* data);
@@ -70,6 +77,10 @@ namespace slmpi
     void scatter(int scatterer, std::vector<int>& toscatter, std::vector<int>& fragment, std::vector<int>& fragsizes);
     void scatter(int scatterer, std::vector<double>& toscatter, std::vector<double>& fragment, std::vector<int>& fragsizes);
     
+    // Send 'sends[r]' to every rank r and receive from rank r in 'receives[r]' (only the message sizes are sent to all ranks):
+    void alltoall(std::vector<std::vector<int>>& sends, std::vector<std::vector<int>>& receives);
+    void alltoall(std::vector<std::vector<double>>& sends, std::vector<std::vector<double>>& receives);
+    
     // Exchange a fixed number of values with each unique target:
     void exchange(std::vector<int> targetranks, std::vector<int>& sendvalues, std::vector<int>& receivevalues);
     void exchange(std::vector<int> targetranks, std::vector<double>& sendvalues, std::vector<double>& receivevalues);
@@ -79,6 +90,13 @@ namespace slmpi
     void exchange(std::vector<int> targetranks, std::vector<int> sendlens, std::vector<int*> sendbuffers, std::vector<int> receivelens, std::vector<int*> receivebuffers);
     void exchange(std::vector<int> targetranks, std::vector<int> sendlens, std::vector<double*> sendbuffers, std::vector<int> receivelens, std::vector<double*> receivebuffers);
     
+    // Split-phase (non-blocking) sends and receives. The returned handle must be passed to 'wait' and the data buffer must stay
+    // untouched until then. This allows to overlap the communication with local computations:
+    int isend(int destination, int tag, int len, double* data);
+    int ireceive(int source, int tag, int len, double* data);
+    // Wait until the communications of all handles have completed:
+    void wait(std::vector<int> handles);
+    
     // Send + receive time for 'messagesize' doubles. Timings in ns are returned on rank 0:
     std::vector<double> ping(int messagesize, int verbosity = 1);
 };
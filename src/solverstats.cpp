@@ -0,0 +1,101 @@
+#include "solverstats.h"
+#include "metrics.h"
+
+
+solverstats solverstats::mylast;
+solverstats solverstats::mytotal;
+
+void solverstats::add(solverstats other)
+{
+    numsolves += other.numsolves;
+    numfactorizations += other.numfactorizations;
+    numreuses += other.numreuses;
+    numsymbolicreuses += other.numsymbolicreuses;
+    factorizationtime += other.factorizationtime;
+    solvetime += other.solvetime;
+    numiterations += other.numiterations;
+    
+    factorizationflops = std::max(factorizationflops, other.factorizationflops);
+    numfactorentries = std::max(numfactorentries, other.numfactorentries);
+    factorizationmemory = std::max(factorizationmemory, other.factorizationmemory);
+    
+    if (other.residualhistory.size() > 0)
+        residualhistory = other.residualhistory;
+}
+
+solverstats solverstats::since(solverstats before)
+{
+    solverstats output = *this;
+    
+    output.numsolves -= before.numsolves;
+    output.numfactorizations -= before.numfactorizations;
+    output.numreuses -= before.numreuses;
+    output.numsymbolicreuses -= before.numsymbolicreuses;
+    output.factorizationtime -= before.factorizationtime;
+    output.solvetime -= before.solvetime;
+    output.numiterations -= before.numiterations;
+    
+    // There was no new residual history:
+    if (output.numiterations == 0)
+        output.residualhistory = {};
+    
+    return output;
+}
+
+void solverstats::print(void)
+{
+    std::cout << "Solves: " << numsolves << " (" << numfactorizations << " factorizations, " << numreuses << " reuses, " << numsymbolicreuses << " symbolic reuses)" << std::endl;
+    std::cout << "Factorization time: " << factorizationtime << " s, solve time: " << solvetime << " s" << std::endl;
+    if (numfactorizations > 0)
+        std::cout << "Factorization: " << factorizationflops << " flops, " << numfactorentries << " entries, " << factorizationmemory << " MB" << std::endl;
+    if (numiterations > 0)
+        std::cout << "Iterations: " << numiterations << " (last residual " << (residualhistory.size() > 0 ? residualhistory.back() : 0) << ")" << std::endl;
+}
+
+void solverstats::setfactorizationinfo(KSP ksp)
+{
+    PC pc;
+    KSPGetPC(ksp, &pc);
+    
+    Mat F;
+    PCFactorGetMatrix(pc, &F);
+    
+    setfactorizationinfo(F);
+}
+
+void solverstats::setfactorizationinfo(Mat F)
+{
+    PetscInt infog22, infog29;
+    PetscReal rinfog3;
+    MatMumpsGetInfog(F, 22, &infog22);
+    MatMumpsGetInfog(F, 29, &infog29);
+    MatMumpsGetRinfog(F, 3, &rinfog3);
+    
+    factorizationmemory = infog22;
+    numfactorentries = infog29;
+    // A negative INFOG(29) is the number of entries in millions:
+    if (infog29 < 0)
+        numfactorentries = -1000000LL*infog29;
+    factorizationflops = rinfog3;
+}
+
+void solverstats::record(solverstats solvestats)
+{
+    mylast = solvestats;
+    mytotal.add(solvestats);
+    
+    if (metrics::isenabled())
+    {
+        metrics::add("solves_total", solvestats.numsolves);
+        metrics::add("factorizations_total", solvestats.numfactorizations);
+        metrics::add("iterations_total", solvestats.numiterations);
+        metrics::set("last_solve_iterations", solvestats.numiterations);
+        metrics::setmax("factorization_memory_megabytes", solvestats.factorizationmemory);
+    }
+}
+
+void solverstats::clear(void)
+{
+    mylast = solverstats();
+    mytotal = solverstats();
+}
@@ -0,0 +1,80 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object holds the cost of the linear solves. Every direct or iterative solve performed
+// by 'sl::solve' (and therefore by 'formulation::solve' and the time integrators) is recorded.
+// The statistics of the last solve and the statistics accumulated over all solves since the
+// last 'clear' call can be queried at any time.
+//
+// For direct solves the MUMPS statistics of the last factorization are given (INFOG and RINFOG
+// values, see the MUMPS user guide) together with the time spent in the factorization and in the
+// triangular solves. A solve that reuses an existing factorization counts as a reuse. For
+// iterative solves the residual history of the last solve is given.
+
+#ifndef SOLVERSTATS_H
+#define SOLVERSTATS_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "petsc.h"
+#include "petscksp.h"
+
+class solverstats
+{
+    private:
+
+        static solverstats mylast;
+        static solverstats mytotal;
+
+    public:
+
+        long long int numsolves = 0;
+        // Numeric factorizations and the solves that reused an existing factorization:
+        long long int numfactorizations = 0;
+        long long int numreuses = 0;
+        // Numeric factorizations that reused the symbolic factorization of the sparsity pattern:
+        long long int numsymbolicreuses = 0;
+
+        // Times in seconds:
+        double factorizationtime = 0;
+        double solvetime = 0;
+
+        // MUMPS statistics of the last factorization: flops of the elimination (RINFOG(3)),
+        // number of entries in the factors (INFOG(29)) and total memory in MB (INFOG(22)):
+        double factorizationflops = 0;
+        long long int numfactorentries = 0;
+        long long int factorizationmemory = 0;
+
+        // Iterative solves:
+        long long int numiterations = 0;
+        // Residual norm at every iteration of the last iterative solve:
+        std::vector<double> residualhistory = {};
+
+        // Add the counts and times of another object. The MUMPS statistics are replaced by the
+        // maximum and the residual history by that of 'other' if it is not empty:
+        void add(solverstats other);
+
+        // Counts and times accumulated since 'before' (a previous copy of this object):
+        solverstats since(solverstats before);
+
+        void print(void);
+
+        // Get the MUMPS statistics of the factorization held by a factored KSP or of a MUMPS factor matrix:
+        void setfactorizationinfo(KSP ksp);
+        void setfactorizationinfo(Mat F);
+
+        // Record a solve:
+        static void record(solverstats solvestats);
+
+        static solverstats getlast(void) { return mylast; };
+        static solverstats gettotal(void) { return mytotal; };
+
+        static void clear(void);
+
+};
+
+#endif
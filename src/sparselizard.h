@@ -11,16 +11,34 @@
 #include "expression.h"
 #include "formulation.h"
 #include "parameter.h"
+#include "gausspointdata.h"
 #include "vec.h"
 #include "petsc.h"
 #include "wallclock.h"
+#include "session.h"
+#include "profiler.h"
+#include "metrics.h"
+#include "autotuning.h"
+#include "solverstats.h"
+#include "memorypool.h"
+#include "memoryusage.h"
+#include "jacobiancache.h"
+#include "formfunctioncache.h"
+#include "exprprofiler.h"
+#include "symbolicderivative.h"
+#include "sumfactorization.h"
 #include "mat.h"
 #include "sl.h"
 #include "resolution.h"
+#include "checkpoint.h"
+#include "transferoperator.h"
 #include "densemat.h"
 #include "indexmat.h"
 #include "spline.h"
 #include "port.h"
+#include "probe.h"
+#include "integrationplan.h"
+#include "vectorstream.h"
 #include "slmpi.h"
 
 class sparselizard
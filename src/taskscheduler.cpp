@@ -0,0 +1,287 @@
+#include "taskscheduler.h"
+#include "universe.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <string>
+#include <algorithm>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+std::atomic<long long int> taskscheduler::numsteals(0);
+
+// The pool threads and the loop they currently run:
+class taskpool
+{
+    public:
+
+        // Only one loop at a time runs on the pool:
+        std::mutex runmutex;
+
+        // Guards all members below except the queues:
+        std::mutex mymutex;
+        std::condition_variable jobready, jobdone;
+        std::vector<std::thread> workers = {};
+        bool isstopping = false;
+
+        long long int jobnumber = 0;
+        std::function<void(int)>* task = NULL;
+        int numparticipants = 0;
+        // Session of the thread that launched the loop:
+        session* jobsession = NULL;
+        // Number of pool threads still working on the current loop:
+        int numactive = 0;
+
+        // False if every participant only runs its own tasks:
+        bool isstealing = true;
+        // Pinning of the pool threads:
+        std::string pinning = "none";
+
+        // Remaining tasks of each participant (the calling thread is participant 0):
+        std::vector<std::deque<int>> queues = {};
+        std::vector<std::unique_ptr<std::mutex>> queuemutexes = {};
+
+        ~taskpool(void) { stop(); };
+
+        void start(int numworkers);
+        void stop(void);
+
+        // Run tasks [first, numtasks) on 'numthreads' threads of the pool:
+        void launch(int first, int numtasks, int numthreads, std::function<void(int)>* looptask, bool isstealingallowed);
+
+        // Pin the calling thread to the cpu of a participant:
+        void pin(int participant, int numthreads);
+
+        // Get the next task of a participant (stolen from another participant if its own queue is empty):
+        bool next(int participant, int& tasknum);
+        void work(int participant);
+        // Wait for the loops after 'lastjob':
+        void workerloop(int workerindex, long long int lastjob);
+};
+
+taskpool mytaskpool;
+
+void taskpool::start(int numworkers)
+{
+    queuemutexes.clear();
+    for (int i = 0; i < numworkers+1; i++)
+        queuemutexes.push_back(std::unique_ptr<std::mutex>(new std::mutex));
+    queues = std::vector<std::deque<int>>(numworkers+1);
+
+    for (int w = 0; w < numworkers; w++)
+        workers.push_back(std::thread(&taskpool::workerloop, this, w, jobnumber));
+
+    // The calling thread is pinned as participant 0:
+    pinning = universe::threadpinning;
+    pin(0, numworkers+1);
+}
+
+void taskpool::pin(int participant, int numthreads)
+{
+    if (pinning == "none")
+        return;
+
+    #ifdef __linux__
+    // Only the cpus allowed to this process are used (e.g. when the ranks are bound by the mpi launcher):
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0)
+        return;
+    std::vector<int> cpus = {};
+    for (int c = 0; c < CPU_SETSIZE; c++)
+    {
+        if (CPU_ISSET(c, &allowed))
+            cpus.push_back(c);
+    }
+    if (cpus.size() == 0)
+        return;
+
+    // Consecutive threads on consecutive cpus ("compact") or spread over all cpus and thus all sockets ("scatter"):
+    int index = participant % cpus.size();
+    if (pinning == "scatter")
+        index = ((long long int)participant*cpus.size()/std::max(numthreads, 1)) % cpus.size();
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpus[index], &cpuset);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    #endif
+}
+
+void taskpool::stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mymutex);
+        isstopping = true;
+    }
+    jobready.notify_all();
+    for (int w = 0; w < workers.size(); w++)
+        workers[w].join();
+
+    std::lock_guard<std::mutex> lock(mymutex);
+    workers.clear();
+    isstopping = false;
+}
+
+bool taskpool::next(int participant, int& tasknum)
+{
+    {
+        std::lock_guard<std::mutex> lock(*queuemutexes[participant]);
+        if (queues[participant].size() > 0)
+        {
+            tasknum = queues[participant].front();
+            queues[participant].pop_front();
+            return true;
+        }
+    }
+    // Steal the last task of the next participant with remaining tasks:
+    for (int i = 1; i < numparticipants && isstealing; i++)
+    {
+        int victim = (participant+i) % numparticipants;
+        std::lock_guard<std::mutex> lock(*queuemutexes[victim]);
+        if (queues[victim].size() > 0)
+        {
+            tasknum = queues[victim].back();
+            queues[victim].pop_back();
+            taskscheduler::numsteals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void taskpool::work(int participant)
+{
+    bool wasinthreadedloop = universe::isinthreadedloop;
+    universe::isinthreadedloop = true;
+    session* prevsession = universe::setsession(jobsession);
+
+    int tasknum;
+    while (next(participant, tasknum))
+        (*task)(tasknum);
+
+    universe::setsession(prevsession);
+    universe::isinthreadedloop = wasinthreadedloop;
+}
+
+void taskpool::workerloop(int workerindex, long long int lastjob)
+{
+    pin(workerindex+1, universe::getmaxnumthreads());
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mymutex);
+            jobready.wait(lock, [&]{ return (isstopping || jobnumber != lastjob); });
+            if (isstopping)
+                return;
+            lastjob = jobnumber;
+            if (workerindex+1 >= numparticipants)
+                continue;
+        }
+
+        work(workerindex+1);
+
+        {
+            std::lock_guard<std::mutex> lock(mymutex);
+            numactive--;
+        }
+        jobdone.notify_all();
+    }
+}
+
+void taskpool::launch(int first, int numtasks, int numthreads, std::function<void(int)>* looptask, bool isstealingallowed)
+{
+    // The pool follows the maximum number of threads and the pinning:
+    if (workers.size() != universe::getmaxnumthreads()-1 || pinning != universe::threadpinning)
+    {
+        stop();
+        start(universe::getmaxnumthreads()-1);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mymutex);
+
+        task = looptask;
+        jobsession = universe::getsession();
+        numparticipants = numthreads;
+        numactive = numthreads-1;
+        isstealing = isstealingallowed;
+        // Contiguous ranges keep the locality of consecutive tasks:
+        for (int p = 0; p < numthreads; p++)
+        {
+            int rangebegin = first + (long long int)p*(numtasks-first)/numthreads;
+            int rangeend = first + (long long int)(p+1)*(numtasks-first)/numthreads;
+            for (int i = rangebegin; i < rangeend; i++)
+                queues[p].push_back(i);
+        }
+        jobnumber++;
+    }
+    jobready.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(mymutex);
+    jobdone.wait(lock, [&]{ return (numactive == 0); });
+    task = NULL;
+}
+
+void taskscheduler::run(int numtasks, std::function<void(int)> task, bool isfirstalone, int maxnumthreads)
+{
+    int numthreads = universe::getmaxnumthreads();
+    if (maxnumthreads >= 0)
+        numthreads = std::min(numthreads, maxnumthreads);
+
+    std::unique_lock<std::mutex> runlock(mytaskpool.runmutex, std::defer_lock);
+    if (numthreads <= 1 || numtasks <= 1 || universe::isinthreadedloop || runlock.try_lock() == false)
+    {
+        for (int i = 0; i < numtasks; i++)
+            task(i);
+        return;
+    }
+
+    int first = 0;
+    if (isfirstalone)
+    {
+        bool wasinthreadedloop = universe::isinthreadedloop;
+        universe::isinthreadedloop = true;
+        task(0);
+        universe::isinthreadedloop = wasinthreadedloop;
+        first = 1;
+    }
+    numthreads = std::min(numthreads, numtasks-first);
+    if (numthreads <= 1)
+    {
+        for (int i = first; i < numtasks; i++)
+            task(i);
+        return;
+    }
+
+    mytaskpool.launch(first, numtasks, numthreads, &task, true);
+}
+
+void taskscheduler::runperthread(int numthreads, std::function<void(int)> task)
+{
+    numthreads = std::min(numthreads, universe::getmaxnumthreads());
+
+    std::unique_lock<std::mutex> runlock(mytaskpool.runmutex, std::defer_lock);
+    if (numthreads <= 1 || universe::isinthreadedloop || runlock.try_lock() == false)
+    {
+        for (int t = 0; t < numthreads; t++)
+            task(t);
+        return;
+    }
+
+    mytaskpool.launch(0, numthreads, numthreads, &task, false);
+}
+
+void taskscheduler::stop(void)
+{
+    std::lock_guard<std::mutex> runlock(mytaskpool.runmutex);
+    mytaskpool.stop();
+}
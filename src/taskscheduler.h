@@ -0,0 +1,50 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+
+// This object runs the independent tasks of a parallel loop (e.g. the element tiles of an assembly,
+// an output interpolation or an estimator) on a pool of 'universe::getmaxnumthreads()' threads, the
+// calling thread included. The tasks are split in contiguous ranges, one per thread, and a thread that
+// has finished its range steals the last tasks of another range. This balances blocks of very different
+// costs (element types, orders, orientations or coefficients). The pool threads are kept between loops.
+// A loop started from within a task, or while the pool runs another loop, runs on the calling thread.
+
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <atomic>
+
+class taskscheduler
+{
+    friend class taskpool;
+
+    private:
+
+        static std::atomic<long long int> numsteals;
+
+    public:
+
+        // Run 'task(i)' for all i in [0, numtasks) and return once all are done. With 'isfirstalone' task 0 is
+        // run on the calling thread before the other threads start (for the lazy synchronizations it triggers).
+        // At most 'maxnumthreads' threads are used (all threads of the pool if negative).
+        static void run(int numtasks, std::function<void(int)> task, bool isfirstalone = true, int maxnumthreads = -1);
+
+        // Run 'task(t)' for all t in [0, numthreads) with one task per thread and no stealing. Task t always runs on the same
+        // pool thread (task 0 on the calling thread). The memory pages first written by task t are thus placed on the numa node
+        // of that thread (first-touch), in particular when the threads are pinned (see 'universe::setthreadpinning').
+        static void runperthread(int numthreads, std::function<void(int)> task);
+
+        // Number of tasks run by another thread than the one they were given to:
+        static long long int countsteals(void) { return numsteals; };
+
+        // Stop the pool threads (they are started again by the next loop):
+        static void stop(void);
+
+};
+
+#endif
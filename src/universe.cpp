@@ -1,6 +1,9 @@
 #include "universe.h"
 #include "slepc.h"
 #include <thread>
+#include "omp.h"
+#include "slmpi.h"
+#include "asyncwriter.h"
 
 
 int universe::mynumrawmeshes = 0;
@@ -16,14 +19,25 @@ void universe::addtorawmeshcounter(int val)
     PetscBool ispetscinitialized;
     PetscInitialized(&ispetscinitialized);
     
-    if (mynumrawmeshes == 0 && val > 0 && ispetscinitialized == PETSC_FALSE)
-        SlepcInitialize(0,{},0,0);
     if (mynumrawmeshes > 0 && mynumrawmeshes+val == 0 && ispetscinitialized == PETSC_TRUE)
         SlepcFinalize();
 
     mynumrawmeshes += val;
 }
 
+std::mutex universe::petscinitmutex;
+
+void universe::initializepetsc(void)
+{
+    std::lock_guard<std::mutex> lock(petscinitmutex);
+    
+    PetscBool ispetscinitialized;
+    PetscInitialized(&ispetscinitialized);
+    
+    if (ispetscinitialized == PETSC_FALSE)
+        SlepcInitialize(0,{},0,0);
+}
+
 int universe::maxnumthreads = -1;
 int universe::getmaxnumthreads(void)
 {
@@ -32,6 +46,8 @@ int universe::getmaxnumthreads(void)
     else
     {
         int maxnumthreadstouse = std::thread::hardware_concurrency(); // might return 0
+        // The cores are shared by all ranks on the node:
+        maxnumthreadstouse /= slmpi::countonnode();
         maxnumthreadstouse = std::max(maxnumthreadstouse, 1);
         return maxnumthreadstouse;
     }
@@ -40,333 +56,404 @@ int universe::getmaxnumthreads(void)
 void universe::setmaxnumthreads(int mnt)
 {
     maxnumthreads = mnt;
+    // Also for the OpenMP regions (BLAS, MUMPS):
+    if (mnt > 0)
+        omp_set_num_threads(mnt);
 }
 
-double universe::roundoffnoiselevel = 1e-10;
+bool universe::ismultithreadedassemblyallowed = false;
 
-std::shared_ptr<rawmesh> universe::myrawmesh = NULL;
+void universe::allowmultithreadedassembly(bool isallowed)
+{
+    ismultithreadedassemblyallowed = isallowed;
+}
 
-std::shared_ptr<rawmesh> universe::getrawmesh(void)
+bool universe::isreductionreproducible = false;
+
+void universe::setreproduciblereductions(bool isreproducible)
 {
-    if (myrawmesh != NULL)
-        return myrawmesh;
-    else
+    isreductionreproducible = isreproducible;
+}
+
+long long int universe::maxassemblytilememory = 1024*1024*1024;
+
+void universe::setassemblytilememory(long long int numbytes)
+{
+    if (numbytes < 0)
     {
-        std::cout << "Error in 'universe' namespace: an operation tried to access the mesh object but it is not available" << std::endl;
+        std::cout << "Error in 'universe' namespace: the assembly tile memory cannot be negative" << std::endl;
         abort();
     }
+    maxassemblytilememory = numbytes;
 }
 
-bool universe::isaxisymmetric = false;
+std::string universe::threadpinning = "none";
 
-double universe::currenttimestep = 0;
-
-double universe::fundamentalfrequency = -1;
-double universe::getfundamentalfrequency(void)
+void universe::setthreadpinning(std::string pinning)
 {
-    if (fundamentalfrequency > 0)
-        return fundamentalfrequency;
-    else
+    if (pinning != "none" && pinning != "compact" && pinning != "scatter")
     {
-        std::cout << "Error in 'universe' namespace: the fundamental frequency cannot be negative or 0 (make sure it was set)" << std::endl;
+        std::cout << "Error in 'universe' namespace: unknown thread pinning '" << pinning << "' (use 'none', 'compact' or 'scatter')" << std::endl;
         abort();
     }
+    threadpinning = pinning;
 }
 
-int universe::physregshift = 0;
+thread_local bool universe::isinthreadedloop = false;
 
-std::vector<std::vector<int>> universe::ddmints = {};
-std::vector<vec> universe::ddmvecs = {};
-std::vector<mat> universe::ddmmats = {};
-std::vector<formulation> universe::ddmformuls = {};
-std::vector<indexmat> universe::ddmsendinds = {};
-std::vector<indexmat> universe::ddmrecvinds = {};
+bool universe::ismeshrenumberingallowed = false;
 
-void universe::clearddmcontainers(void)
+void universe::allowmeshrenumbering(bool isallowed)
 {
-    ddmints = {};
-    ddmvecs = {};
-    ddmmats = {};
-    ddmformuls = {};
-    ddmsendinds = {};
-    ddmrecvinds = {};
+    ismeshrenumberingallowed = isallowed;
 }
 
-void universe::allowestimatorupdate(bool allowitonce)
+bool universe::iselementgroupingbyorientation = false;
+
+void universe::groupelementsbyorientation(bool isgrouped)
 {
-    if (allowitonce)
+    iselementgroupingbyorientation = isgrouped;
+}
+
+std::string universe::vtuencoding = "ascii";
+bool universe::isoutputfloat32 = false;
+
+void universe::setvtuoutput(std::string encoding, bool usefloat32)
+{
+    if (encoding != "ascii" && encoding != "binary" && encoding != "zlib")
     {
-        numallowedtimes++;
-        if (numallowedtimes == 1)
-            estimatorcalcstate++;
+        std::cout << "Error in 'universe' object: unknown .vtu encoding '" << encoding << "' (use 'ascii', 'binary' or 'zlib')" << std::endl;
+        abort();
     }
-    else
-        numallowedtimes--;
+    #ifndef HAVE_ZLIB
+    if (encoding == "zlib")
+    {
+        std::cout << "Error in 'universe' object: zlib compressed .vtu output requires sparselizard to be compiled with zlib" << std::endl;
+        abort();
+    }
+    #endif
+
+    vtuencoding = encoding;
+    isoutputfloat32 = usefloat32;
 }
 
-bool universe::isestimatorupdateallowed(long long int statenumber)
+std::string universe::posencoding = "ascii";
+
+void universe::setposoutput(std::string encoding)
 {
-    return (numallowedtimes > 0 && statenumber != estimatorcalcstate);
+    if (encoding != "ascii" && encoding != "binary")
+    {
+        std::cout << "Error in 'universe' object: unknown .pos encoding '" << encoding << "' (use 'ascii' or 'binary')" << std::endl;
+        abort();
+    }
+    posencoding = encoding;
 }
 
-long long int universe::estimatorcalcstate = 0;
+std::string universe::mshencoding = "ascii";
 
-int universe::numallowedtimes = 0;
-        
-bool universe::isreuseallowed = false;
+void universe::setmshoutput(std::string encoding)
+{
+    if (encoding != "ascii" && encoding != "binary")
+    {
+        std::cout << "Error in 'universe' object: unknown .msh encoding '" << encoding << "' (use 'ascii' or 'binary')" << std::endl;
+        abort();
+    }
+    mshencoding = encoding;
+}
 
-void universe::allowreuse(void)
+std::string universe::solvermatrixtype = "";
+
+void universe::setsolvermatrixtype(std::string mattype)
 {
-    isreuseallowed = true;
+    solvermatrixtype = mattype;
 }
 
-void universe::forbidreuse(void)
+bool universe::isoutofcore = false;
+std::string universe::outofcoredirectory = "";
+
+void universe::setoutofcore(bool isooc, std::string directory)
 {
-    isreuseallowed = false;
-    
-    resethff();
-    
-    computedjacobian = NULL;
+    isoutofcore = isooc;
+    outofcoredirectory = directory;
     
-    oppointers = {};
-    oppointersfft = {};
-    opcomputed = {};
-    opcomputedfft = {};
+    // MUMPS reads the out-of-core directory from the environment:
+    if (directory != "")
+        setenv("MUMPS_OOC_TMPDIR", directory.c_str(), 1);
 }
 
-std::tuple<std::shared_ptr<jacobian>, std::vector<std::shared_ptr<operation>>,std::vector<std::shared_ptr<operation>>, std::vector< std::vector<std::vector<densemat>> >,std::vector< densemat >> universe::selectsubset(int numevalpts, std::vector<int>& selectedelementindexes)
+void universe::configuremumps(PC pc)
 {
-    int numselected = selectedelementindexes.size();
-
-    auto output = std::make_tuple(computedjacobian, oppointers, oppointersfft, opcomputed, opcomputedfft);
-    
-    // Replace the jacobian with a subset of it:
-    if (computedjacobian != NULL)
-    {
-        std::shared_ptr<jacobian> newjac(new jacobian);
-        *newjac = computedjacobian->extractsubset(selectedelementindexes);
-        computedjacobian = newjac;
-    }
+    if (isoutofcore == false)
+        return;
         
-    // Replace the computed ops by their subset:
-    for (int i = 0; i < opcomputed.size(); i++)
-    {
-        for (int h = 0; h < opcomputed[i].size(); h++)
-        {
-            if (opcomputed[i][h].size() > 0)
-                opcomputed[i][h][0] = opcomputed[i][h][0].extractrows(selectedelementindexes);
-        }
-    }
-    
-    // In the multiharmonic case columns must be selected:
-    std::vector<int> mhcols;
-    if (opcomputedfft.size() > 0)
-    {
-        mhcols = std::vector<int>(numselected*numevalpts);
-        for (int i = 0; i < numselected; i++)
-        {
-            for (int j = 0; j < numevalpts; j++)
-                mhcols[i*numevalpts+j] = selectedelementindexes[i]*numevalpts+j;
-        }
-    }
-    for (int i = 0; i < opcomputedfft.size(); i++)
-        opcomputedfft[i] = opcomputedfft[i].extractcols(mhcols);
-    
-    return output;
+    Mat F;
+    PCFactorSetUpMatSolverType(pc);
+    PCFactorGetMatrix(pc, &F);
+    MatMumpsSetIcntl(F, 22, 1);
 }
 
-std::tuple<std::shared_ptr<jacobian>, std::vector<std::shared_ptr<operation>>,std::vector<std::shared_ptr<operation>>, std::vector< std::vector<std::vector<densemat>> >,std::vector< densemat >> universe::backup(void)
+double universe::factorizationprecision = 0;
+double universe::refinementtolerance = 1e-12;
+
+void universe::setmixedprecision(double precision, double reltol)
 {
-    auto output = std::make_tuple(computedjacobian, oppointers, oppointersfft, opcomputed, opcomputedfft);
-    
-    return output;
+    if (precision < 0 || reltol <= 0)
+    {
+        std::cout << "Error in 'universe' object: in 'setmixedprecision' the precision cannot be negative and the tolerance must be positive" << std::endl;
+        abort();
+    }
+    factorizationprecision = precision;
+    refinementtolerance = reltol;
 }
 
-void universe::restore(std::tuple<std::shared_ptr<jacobian>, std::vector<std::shared_ptr<operation>>,std::vector<std::shared_ptr<operation>>, std::vector< std::vector<std::vector<densemat>> >,std::vector< densemat >> input)
+void universe::setoutputfloat32(bool usefloat32)
 {
-    computedjacobian = std::get<0>(input);
-    
-    oppointers = std::get<1>(input);
-    oppointersfft = std::get<2>(input);
-    opcomputed = std::get<3>(input);
-    opcomputedfft = std::get<4>(input);
+    isoutputfloat32 = usefloat32;
 }
 
+int universe::outputelementstride = 1;
 
-std::shared_ptr<jacobian> universe::computedjacobian = NULL;
-
-
-std::vector<std::shared_ptr<operation>> universe::oppointers = {};
-std::vector<std::shared_ptr<operation>> universe::oppointersfft = {};
-std::vector< std::vector<std::vector<densemat>> > universe::opcomputed = {};
-std::vector< densemat > universe::opcomputedfft = {};
-
-int universe::getindexofprecomputedvalue(std::shared_ptr<operation> op)
+void universe::setoutputdecimation(int elementstride)
 {
-    for (int i = 0; i < oppointers.size(); i++)
+    if (elementstride < 1)
     {
-        if (oppointers[i].get() == op.get())
-            return i;
+        std::cout << "Error in 'universe' object: the output element stride must be at least 1" << std::endl;
+        abort();
     }
-    return -1;
+    outputelementstride = elementstride;
 }
 
-int universe::getindexofprecomputedvaluefft(std::shared_ptr<operation> op)
+std::vector<std::pair<int,int>> universe::outputlagrangeorders = {};
+
+void universe::setoutputlagrangeorder(int physreg, int lagrangeorder)
 {
-    for (int i = 0; i < oppointersfft.size(); i++)
+    if (physreg == -1)
+    {
+        outputlagrangeorders = {};
+        return;
+    }
+    if (lagrangeorder < 1)
     {
-        if (oppointersfft[i].get() == op.get())
-            return i;
+        std::cout << "Error in 'universe' object: the output Lagrange order must be at least 1" << std::endl;
+        abort();
     }
-    return -1;
+    outputlagrangeorders.push_back(std::make_pair(physreg, lagrangeorder));
 }
 
-int universe::getindexofprecomputedvalue(std::shared_ptr<rawparameter> param, int row, int col)
+bool universe::isoutputasynchronous = false;
+
+void universe::setasynchronousoutput(bool isasync, int maxnumqueued)
 {
-    for (int i = 0; i < oppointers.size(); i++)
+    if (maxnumqueued < 1)
     {
-        if (oppointers[i]->isparameter() && (oppointers[i]->getparameterpointer()).get() == param.get() && oppointers[i]->getselectedrow() == row && oppointers[i]->getselectedcol() == col)
-            return i;
+        std::cout << "Error in 'universe' object: the maximum number of queued output writes must be at least 1" << std::endl;
+        abort();
     }
-    return -1;
+    // Writes already queued are done before the setting changes:
+    asyncwriter::flush();
+
+    isoutputasynchronous = isasync;
+    asyncwriter::maxnumqueued = maxnumqueued;
 }
 
-int universe::getindexofprecomputedvaluefft(std::shared_ptr<rawparameter> param, int row, int col)
+int universe::maxautofftevals = 32;
+
+void universe::setmaxautofftevals(int numtimeevals)
 {
-    for (int i = 0; i < oppointersfft.size(); i++)
+    if (numtimeevals <= 0)
     {
-        if (oppointersfft[i]->isparameter() && (oppointersfft[i]->getparameterpointer()).get() == param.get() && oppointersfft[i]->getselectedrow() == row && oppointersfft[i]->getselectedcol() == col)
-            return i;
+        std::cout << "Error in 'universe' object: the number of automatic FFT time evaluations must be positive" << std::endl;
+        abort();
     }
-    return -1;
+    maxautofftevals = numtimeevals;
 }
 
-int universe::getindexofprecomputedvalue(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc)
+double universe::roundoffnoiselevel = 1e-10;
+
+session universe::defaultsession;
+thread_local session* universe::currentsession = NULL;
+
+session* universe::getsession(void)
 {
-    for (int i = 0; i < oppointers.size(); i++)
-    {
-        if (oppointers[i]->isfield() && (oppointers[i]->getfieldpointer()).get() == rf.get() && oppointers[i]->getformfunctioncomponent() == ffc && oppointers[i]->getspacederivative() == sd && oppointers[i]->getkietaphiderivative() == kepd && oppointers[i]->gettimederivative() == td)
-            return i;
-    }
-    return -1;
+    if (currentsession != NULL)
+        return currentsession;
+    return &defaultsession;
 }
 
-int universe::getindexofprecomputedvaluefft(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc)
+session* universe::setsession(session* s)
+{
+    session* prev = getsession();
+    currentsession = s;
+    return prev;
+}
+
+std::shared_ptr<rawmesh> universe::getrawmesh(void)
 {
-    for (int i = 0; i < oppointersfft.size(); i++)
+    std::shared_ptr<rawmesh>& myrawmesh = getsession()->myrawmesh;
+    if (myrawmesh != NULL)
+        return myrawmesh;
+    else
     {
-        if (oppointersfft[i]->isfield() && (oppointersfft[i]->getfieldpointer()).get() == rf.get() && oppointersfft[i]->getformfunctioncomponent() == ffc && oppointersfft[i]->getspacederivative() == sd && oppointersfft[i]->getkietaphiderivative() == kepd && oppointersfft[i]->gettimederivative() == td)
-            return i;
+        std::cout << "Error in 'universe' namespace: an operation tried to access the mesh object but it is not available" << std::endl;
+        abort();
     }
-    return -1;
 }
 
-std::vector<std::vector<densemat>> universe::getprecomputed(int index)
+std::atomic<long long int> universe::laststate(0);
+
+double universe::getfundamentalfrequency(void)
 {
-    std::vector<std::vector<densemat>> output = opcomputed[index];
-    for (int h = 0; h < output.size(); h++)
+    double fundamentalfrequency = getsession()->fundamentalfrequency;
+    if (fundamentalfrequency > 0)
+        return fundamentalfrequency;
+    else
     {
-        if (output[h].size() == 1)
-            output[h][0] = output[h][0].copy();
+        std::cout << "Error in 'universe' namespace: the fundamental frequency cannot be negative or 0 (make sure it was set)" << std::endl;
+        abort();
     }
-    return output;
 }
 
-densemat universe::getprecomputedfft(int index)
+int universe::physregshift = 0;
+
+void universe::clearddmcontainers(void)
 {
-    return (opcomputedfft[index]).copy();
+    session* s = getsession();
+    
+    s->ddmints = {};
+    s->ddmvecs = {};
+    s->ddmmats = {};
+    s->ddmformuls = {};
+    s->ddmsendinds = {};
+    s->ddmrecvinds = {};
+    s->ddmsubdomainprecond = "";
 }
 
-void universe::setprecomputed(std::shared_ptr<operation> op, std::vector<std::vector<densemat>> val)
+void universe::allowestimatorupdate(bool allowitonce)
 {
-    oppointers.push_back(op);
-    opcomputed.push_back(val);
-    for (int h = 0; h < val.size(); h++)
+    session* s = getsession();
+    
+    if (allowitonce)
     {
-        if (val[h].size() == 1)
-            opcomputed[opcomputed.size()-1][h][0] = val[h][0].copy();
+        s->numallowedtimes++;
+        if (s->numallowedtimes == 1)
+            s->estimatorcalcstate++;
     }
+    else
+        s->numallowedtimes--;
 }
 
-void universe::setprecomputedfft(std::shared_ptr<operation> op, densemat val)
+bool universe::isestimatorupdateallowed(long long int statenumber)
 {
-    oppointersfft.push_back(op);
-    opcomputedfft.push_back(val.copy());
+    session* s = getsession();
+    
+    return (s->numallowedtimes > 0 && statenumber != s->estimatorcalcstate);
 }
-
-bool universe::keeptrackofrhsassembly = false;
-std::vector<std::pair<indexmat, densemat>> universe::rhsterms = {}; 
         
-std::vector<std::vector<vec>> universe::xdtxdtdtx = {{},{},{}};        
+thread_local evaluationcontext universe::defaultcontext;
+thread_local evaluationcontext* universe::currentcontext = NULL;
 
+evaluationcontext* universe::getcontext(void)
+{
+    if (currentcontext != NULL)
+        return currentcontext;
+    else
+        return &defaultcontext;
+}
 
+evaluationcontext* universe::setcontext(evaluationcontext* ctx)
+{
+    evaluationcontext* previous = currentcontext;
+    currentcontext = ctx;
+    return previous;
+}
 
-std::vector<std::pair< std::string, std::vector<std::vector< std::vector<hierarchicalformfunctioncontainer> >> >> universe::formfuncpolys = {};     
+void universe::allowreuse(void)
+{
+    getcontext()->allowreuse();
+}
 
-hierarchicalformfunctioncontainer* universe::gethff(std::string fftypename, int elementtypenumber, int interpolorder, std::vector<double> evaluationcoordinates)
+void universe::forbidreuse(void)
 {
-    // Find the type name in the container:
-    int typenameindex = -1;
-    for (int i = 0; i < formfuncpolys.size(); i++)
-    {
-        if (formfuncpolys[i].first == fftypename)
-        {
-            typenameindex = i;
-            break;
-        }
-    }
+    resethff();
+    
+    getcontext()->forbidreuse();
+}
+
+int universe::getindexofprecomputedvalue(std::shared_ptr<operation> op) { return getcontext()->getindexofprecomputedvalue(op); }
+int universe::getindexofprecomputedvaluefft(std::shared_ptr<operation> op) { return getcontext()->getindexofprecomputedvaluefft(op); }
+int universe::getindexofprecomputedvalue(std::shared_ptr<rawparameter> param, int row, int col) { return getcontext()->getindexofprecomputedvalue(param, row, col); }
+int universe::getindexofprecomputedvaluefft(std::shared_ptr<rawparameter> param, int row, int col) { return getcontext()->getindexofprecomputedvaluefft(param, row, col); }
+int universe::getindexofprecomputedvalue(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc) { return getcontext()->getindexofprecomputedvalue(rf, td, sd, kepd, ffc); }
+int universe::getindexofprecomputedvaluefft(std::shared_ptr<rawfield> rf, int td, int sd, int kepd, int ffc) { return getcontext()->getindexofprecomputedvaluefft(rf, td, sd, kepd, ffc); }
+
+std::vector<std::vector<densemat>> universe::getprecomputed(int index) { return getcontext()->getprecomputed(index); }
+densemat universe::getprecomputedfft(int index) { return getcontext()->getprecomputedfft(index); }
+
+void universe::setprecomputed(std::shared_ptr<operation> op, std::vector<std::vector<densemat>> val) { getcontext()->setprecomputed(op, val); }
+void universe::setprecomputedfft(std::shared_ptr<operation> op, densemat val) { getcontext()->setprecomputedfft(op, val); }
 
-    // In case the form function polynomials are available:
-    if (typenameindex != -1 && formfuncpolys[typenameindex].second[elementtypenumber].size() > interpolorder && formfuncpolys[typenameindex].second[elementtypenumber][interpolorder].size() > 0)
+
+
+
+std::unordered_map<std::string, std::vector<std::vector<std::shared_ptr<hierarchicalformfunctioncontainer>>>> universe::formfuncpolys = {};
+std::mutex universe::formfuncpolysmutex;
+std::atomic<long long int> universe::numhffhits(0);
+std::atomic<long long int> universe::numhffmisses(0);
+
+std::shared_ptr<hierarchicalformfunctioncontainer> universe::getformfuncpolys(std::string fftypename, int elementtypenumber, int interpolorder)
+{
     {
-        if (isreuseallowed && formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0].isvalueready())
-            return &(formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0]);
-        else
-        {
-            formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0].evaluate(evaluationcoordinates);
-            if (isreuseallowed)
-                formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0].setvaluestatus(true);
-            return &(formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0]);
-        }
+        std::lock_guard<std::mutex> lock(formfuncpolysmutex);
+        
+        std::unordered_map<std::string, std::vector<std::vector<std::shared_ptr<hierarchicalformfunctioncontainer>>>>::iterator it = formfuncpolys.find(fftypename);
+        if (it != formfuncpolys.end() && it->second[elementtypenumber].size() > interpolorder && it->second[elementtypenumber][interpolorder] != NULL)
+            return it->second[elementtypenumber][interpolorder];
     }
     
-    // Otherwise compute the form function polynomials and store them:
-    if (typenameindex == -1)
-    {
-        formfuncpolys.push_back( std::make_pair(fftypename, std::vector<std::vector< std::vector<hierarchicalformfunctioncontainer> >>(8,std::vector< std::vector<hierarchicalformfunctioncontainer> >(0))) );
-        typenameindex = formfuncpolys.size() - 1;
-    }
-    if (formfuncpolys[typenameindex].second[elementtypenumber].size() <= interpolorder)
-        formfuncpolys[typenameindex].second[elementtypenumber].resize(interpolorder+1);
-
+    // Build the polynomials without holding the lock (other threads can keep reading):
     std::shared_ptr<hierarchicalformfunction> myformfunction = selector::select(elementtypenumber, fftypename);
+    std::shared_ptr<hierarchicalformfunctioncontainer> polys(new hierarchicalformfunctioncontainer(myformfunction->evalat(interpolorder)));
     
-    formfuncpolys[typenameindex].second[elementtypenumber][interpolorder] = {myformfunction->evalat(interpolorder)};
-    formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0].evaluate(evaluationcoordinates);
+    std::lock_guard<std::mutex> lock(formfuncpolysmutex);
     
-    if (isreuseallowed)
-        formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0].setvaluestatus(true);
+    std::vector<std::vector<std::shared_ptr<hierarchicalformfunctioncontainer>>>& curpolys = formfuncpolys[fftypename];
+    if (curpolys.size() == 0)
+        curpolys.resize(8);
+    if (curpolys[elementtypenumber].size() <= interpolorder)
+        curpolys[elementtypenumber].resize(interpolorder+1, NULL);
+    // Keep the first polynomials stored if another thread built them meanwhile:
+    if (curpolys[elementtypenumber][interpolorder] == NULL)
+        curpolys[elementtypenumber][interpolorder] = polys;
     
-    return &(formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0]);
+    return curpolys[elementtypenumber][interpolorder];
 }
 
-void universe::resethff(void)
+std::shared_ptr<hierarchicalformfunctioncontainer> universe::gethff(std::string fftypename, int elementtypenumber, int interpolorder, std::vector<double>& evaluationcoordinates)
 {
-    for (int typenameindex = 0; typenameindex < formfuncpolys.size(); typenameindex++)
+    evaluationcontext* ctx = getcontext();
+    
+    std::shared_ptr<hierarchicalformfunctioncontainer> values = ctx->gethff(fftypename, elementtypenumber, interpolorder, evaluationcoordinates);
+    if (values != NULL)
     {
-        for (int elementtypenumber = 0; elementtypenumber < (formfuncpolys[typenameindex].second).size(); elementtypenumber++)
-        {
-            for (int interpolorder = 0; interpolorder < formfuncpolys[typenameindex].second[elementtypenumber].size(); interpolorder++)
-            {
-                if (formfuncpolys[typenameindex].second[elementtypenumber][interpolorder].size() > 0)
-                    formfuncpolys[typenameindex].second[elementtypenumber][interpolorder][0].setvaluestatus(false);
-            }
-        }
+        numhffhits++;
+        return values;
     }
+    numhffmisses++;
+    
+    values = std::shared_ptr<hierarchicalformfunctioncontainer>(new hierarchicalformfunctioncontainer(getformfuncpolys(fftypename, elementtypenumber, interpolorder)->getvalues(evaluationcoordinates)));
+    ctx->sethff(fftypename, elementtypenumber, interpolorder, evaluationcoordinates, values);
+    
+    return values;
+}
+
+void universe::resethff(void)
+{
+    getcontext()->clearhff();
 }
 
 
 std::vector<std::vector<std::vector<std::vector<int>>>> universe::splitdefinition = std::vector<std::vector<std::vector<std::vector<int>>>>(8, std::vector<std::vector<std::vector<int>>>(0));
+std::mutex universe::splitdefinitionmutex;
 
 bool universe::getsplitdefinition(std::vector<std::vector<int>>& splitdef, int elementtypenumber, int splitnum, std::vector<int>& edgenumbers)
 {
@@ -374,6 +461,8 @@ bool universe::getsplitdefinition(std::vector<std::vector<int>>& splitdef, int e
     int numrel = gentools::factorial(ne);
     int rel = gentools::identifyrelations(edgenumbers);
     
+    std::lock_guard<std::mutex> lock(splitdefinitionmutex);
+    
     if (splitdefinition[elementtypenumber].size() == 0 || splitdefinition[elementtypenumber][splitnum*numrel+rel].size() == 0)
         return false;
         
@@ -387,6 +476,8 @@ void universe::setsplitdefinition(std::vector<std::vector<int>>& splitdef, int e
     int numrel = gentools::factorial(ne);
     int rel = gentools::identifyrelations(edgenumbers);
     
+    std::lock_guard<std::mutex> lock(splitdefinitionmutex);
+    
     if (splitdefinition[elementtypenumber].size() == 0)
         splitdefinition[elementtypenumber] = std::vector<std::vector<std::vector<int>>>(std::pow(2,ne)*numrel, std::vector<std::vector<int>>(0));
     
@@ -10,6 +10,10 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
 #include "rawmesh.h"
 #include "field.h"
 #include "jacobian.h"
@@ -20,80 +24,176 @@
 #include "hierarchicalformfunction.h"
 #include "hierarchicalformfunctioncontainer.h"
 #include "vec.h"
+#include "evaluationcontext.h"
+#include "session.h"
 
 class mesh;
 class jacobian;
+class session;
 
 class universe 
 {
     private:
     
+        // Evaluation context of each thread:
+        static thread_local evaluationcontext defaultcontext;
+        static thread_local evaluationcontext* currentcontext;
+        
+        // Session of each thread (NULL for the default session):
+        static session defaultsession;
+        static thread_local session* currentsession;
+    
     public:
 
         static int mynumrawmeshes;
         static void addtorawmeshcounter(int val);
         
+        // PETSc and SLEPc are initialized on the first creation of a PETSc object (mat, vec, eigenvalue, ...) so that
+        // runs without any solve do not pay their startup cost. They are finalized when the last mesh is destroyed:
+        static std::mutex petscinitmutex;
+        static void initializepetsc(void);
+        
         static int maxnumthreads;
         static int getmaxnumthreads(void);
         static void setmaxnumthreads(int mnt);
         
+        // Allow the element blocks of a contribution to be computed by multiple threads (at most 'getmaxnumthreads()'):
+        static bool ismultithreadedassemblyallowed;
+        static void allowmultithreadedassembly(bool isallowed);
+        
+        // Sum the floating-point reductions (integrals, vector norms and sums, MPI sums) in a fixed order with a compensated
+        // summation. The results are then bitwise identical from run to run for a given number of ranks (default false):
+        static bool isreductionreproducible;
+        static void setreproduciblereductions(bool isreproducible);
+        
+        // Maximum memory (in bytes) of the element blocks of a contribution computed at the same time. Larger
+        // element blocks are split in tiles that are computed and assembled one after the other (0 for no limit):
+        static long long int maxassemblytilememory;
+        static void setassemblytilememory(long long int numbytes);
+        
+        // Pinning of the threads of the task scheduler to the cpus (linux only): "none" (default), "compact" (consecutive
+        // threads on consecutive cpus) or "scatter" (threads spread over all cpus allowed and thus over all numa nodes):
+        static std::string threadpinning;
+        static void setthreadpinning(std::string pinning);
+        
+        // True while the calling thread computes a chunk of a multithreaded loop. The loops
+        // nested in it then run on the calling thread only to avoid oversubscribing the cores:
+        static thread_local bool isinthreadedloop;
+        
+        // Reorder the nodes and elements along a Hilbert curve when loading a mesh. The dofs are numbered
+        // by following the element order and thus also get a better locality and a smaller matrix bandwidth:
+        static bool ismeshrenumberingallowed;
+        static void allowmeshrenumbering(bool isallowed);
+        // Reorder the elements of every disjoint region by total orientation when loading a mesh. The element blocks
+        // of the assembly are then contiguous ranges and the coordinates and coefficients are read in memory order.
+        // The element order is otherwise kept (e.g. along the Hilbert curve). This is not applied to DDM meshes:
+        static bool iselementgroupingbyorientation;
+        static void groupelementsbyorientation(bool isgrouped);
+        
+        // Encoding of the .vtu and .pvtu output files: "ascii" (default), "binary" (raw appended data)
+        // or "zlib" (zlib compressed appended data). Point coordinates and values are written in single
+        // precision if 'usefloat32' is true (same as 'setoutputfloat32'):
+        static std::string vtuencoding;
+        static void setvtuoutput(std::string encoding, bool usefloat32 = false);
+        
+        // Encoding of the .pos output files: "ascii" (default, GMSH parsed format) or "binary" (legacy 
+        // binary post-processing format, only for Lagrange orders 1 and 2):
+        static std::string posencoding;
+        static void setposoutput(std::string encoding);
+        
+        // Encoding of the .msh mesh output files: "ascii" (default, GMSH format 2.2) or "binary" (GMSH format 4.1):
+        static std::string mshencoding;
+        static void setmshoutput(std::string encoding);
+        
+        // Reduce the size of the field and expression output files:
+        //
+        // - write the coordinates and values in single precision (.vtk, .vtu, .pos and .xdmf formats)
+        // - only write every 'elementstride'-th element of every element type (1 writes all elements)
+        // - compute the values at Lagrange order 'lagrangeorder' on physical region 'physreg' instead of the
+        //   order requested for the write (the values are then interpolated to the requested order). The
+        //   smallest order is used on the elements in several such regions. 'setoutputlagrangeorder(-1)' removes them all.
+        static bool isoutputfloat32;
+        static void setoutputfloat32(bool usefloat32);
+        static int outputelementstride;
+        static void setoutputdecimation(int elementstride);
+        static std::vector<std::pair<int,int>> outputlagrangeorders;
+        static void setoutputlagrangeorder(int physreg, int lagrangeorder = -1);
+        
+        // Write the output files on a background thread (at most 'maxnumqueued' writes waiting).
+        // Call 'sl::flushoutput' to wait until all files are written:
+        static bool isoutputasynchronous;
+        static void setasynchronousoutput(bool isasync, int maxnumqueued = 2);
+        
+        // PETSc matrix type on which the iterative solves run (e.g. "aijcusparse", "aijhipsparse" or "aijkokkos"
+        // to solve on a GPU with a PETSc configured accordingly). The matrix and vectors are copied to that type
+        // for every iterative solve. The default "" solves on the host matrix:
+        static std::string solvermatrixtype;
+        static void setsolvermatrixtype(std::string mattype);
+        
+        // Mixed precision direct solves: when 'factorizationprecision' is positive the MUMPS factors are only computed
+        // and stored to that relative accuracy (block low-rank compression, e.g. 1e-7 for single precision accuracy).
+        // The double precision accuracy is recovered with GMRES iterations on the double precision matrix preconditioned
+        // by that factorization until the relative residual is below 'refinementtolerance'. The default 0 factorizes exactly:
+        static double factorizationprecision;
+        static double refinementtolerance;
+        static void setmixedprecision(double precision, double reltol = 1e-12);
+        
+        // Out-of-core direct solves: the MUMPS factors are written to disk in 'outofcoredirectory' (the system
+        // temporary directory if empty) during the factorization. The memory then mostly holds the active fronts.
+        static bool isoutofcore;
+        static std::string outofcoredirectory;
+        static void setoutofcore(bool isooc, std::string directory = "");
+        // Apply the out-of-core setting to a MUMPS factorization preconditioner (the solver type must be set):
+        static void configuremumps(PC pc);
+        
+        // Number of time evaluations used by the automatic multiharmonic FFTs ('numcoefharms' or 'numfftharms' set to 0)
+        // when the harmonic content of the operation is unbounded (e.g. 'sin', 'abs' or a division of multiharmonic fields):
+        static int maxautofftevals;
+        static void setmaxautofftevals(int numtimeevals);
+        
         // Round-off noise level on the node coordinates:
         static double roundoffnoiselevel;
         
-        static std::shared_ptr<rawmesh> myrawmesh;
+        // The state of the simulation (mesh in use, time, DDM containers, ...) is in the session of the calling thread.
+        // It is the default session unless another one was set with 'setsession' (see 'session' for independent simulations):
+        static session* getsession(void);
+        // Set the session used by the calling thread and return the previous one. Setting NULL restores the default session.
+        // The session must outlive its use. The threads started by the library for the calling thread use the same session.
+        static session* setsession(session* s);
+        // Start a thread running 'f(args...)' in the session of the calling thread:
+        template <typename F, typename... Args>
+        static std::thread newthread(F&& f, Args&&... args);
+        
         static std::shared_ptr<rawmesh> getrawmesh(void);
 
-        static bool isaxisymmetric;
-        
-        static double currenttimestep;
-        
-        static double fundamentalfrequency;
         static double getfundamentalfrequency(void);
         
+        // Counter increased at every modification of the field values, parameters and mesh geometry.
+        // Comparing states allows to know if data computed from them is still valid.
+        static std::atomic<long long int> laststate;
+        static long long int getnewstate(void) { return ++laststate; };
+        
         // Shift the physical region numbers by (physregdim+1) x physregshift when loading a mesh:
         static int physregshift;
         
-        // Temporary containers for DDM:
-        static std::vector<std::vector<int>> ddmints;
-        static std::vector<vec> ddmvecs;
-        static std::vector<mat> ddmmats;
-        static std::vector<formulation> ddmformuls;
-        static std::vector<indexmat> ddmsendinds;
-        static std::vector<indexmat> ddmrecvinds;
-        
         static void clearddmcontainers(void);
         
         // Error estimators need evaluations across elements and can therefore not be efficiently evaluated in the usual way.
-        // Error estimators will be updated if 'numallowedtimes' > 0 and their state number is different than the one here.
+        // Error estimators will be updated if 'numallowedtimes' > 0 and their state number is different than the one of the session.
         static void allowestimatorupdate(bool allowitonce);
         static bool isestimatorupdateallowed(long long int statenumber);
-        static long long int estimatorcalcstate;
-        static int numallowedtimes;
         
-        // To allow reusing computed things:
-        static bool isreuseallowed;
+        // The evaluation context used by the calling thread (a thread default context if none was set):
+        static evaluationcontext* getcontext(void);
+        // Set the evaluation context used by the calling thread and return the previous one. 
+        // Setting NULL restores the thread default context. The context must outlive its use.
+        static evaluationcontext* setcontext(evaluationcontext* ctx);
+        
+        // Calls on the current evaluation context:
         static void allowreuse(void);
         // CLEANS::
         static void forbidreuse(void);
         
-        // Select an element subset of the available storage and return the unselected storage:
-        static std::tuple<std::shared_ptr<jacobian>, std::vector<std::shared_ptr<operation>>,std::vector<std::shared_ptr<operation>>, std::vector< std::vector<std::vector<densemat>> >,std::vector< densemat >> selectsubset(int numevalpts, std::vector<int>& selectedelementindexes);
-        
-        // Backup the storage (not the form funcs):
-        static std::tuple<std::shared_ptr<jacobian>, std::vector<std::shared_ptr<operation>>,std::vector<std::shared_ptr<operation>>, std::vector< std::vector<std::vector<densemat>> >,std::vector< densemat >> backup(void);
-        // Restore the storage (not the form funcs):
-        static void restore(std::tuple<std::shared_ptr<jacobian>, std::vector<std::shared_ptr<operation>>,std::vector<std::shared_ptr<operation>>, std::vector< std::vector<std::vector<densemat>> >,std::vector< densemat >>);
-        
-        
-        static std::shared_ptr<jacobian> computedjacobian;
-        
-        // Store all operations that must be reused:
-        static std::vector<std::shared_ptr<operation>> oppointers;
-        static std::vector<std::shared_ptr<operation>> oppointersfft;
-        // Store all computed values:
-        static std::vector< std::vector<std::vector<densemat>> > opcomputed;
-        static std::vector< densemat > opcomputedfft;
-        
         // Returns -1 if not yet precomputed.
         static int getindexofprecomputedvalue(std::shared_ptr<operation> op);
         static int getindexofprecomputedvaluefft(std::shared_ptr<operation> op);
@@ -108,38 +208,45 @@ class universe
         static void setprecomputed(std::shared_ptr<operation> op, std::vector<std::vector<densemat>> val);
         static void setprecomputedfft(std::shared_ptr<operation> op, densemat val);
         
-        // If set to true the individual right handside contribution addresses and values are stored in 'rhsterms' when generating a formulation:
-        static bool keeptrackofrhsassembly;
-        // Every row in a given (int)densemat corresponds to a shape function and every column to a given mesh element.
-        // Do not forget to clear 'rhsterms' when you don't want to keep track anymore!
-        static std::vector<std::pair<indexmat, densemat>> rhsterms;
-        
-        // This stores the vec containing a solution x, its time derivative dtx and its second time derivative dtdtx
-        // respectively at index 0, 1 and 2. If xdtxdtdtx[i] is an empty vector then that solution is not available.
-        static std::vector<std::vector<vec>> xdtxdtdtx;
-        
-        
-        
-        // Store all !HIERARCHICAL! form function polynomials (can always be reused) and evaluated values.
-        // 'formfuncpolys[i].first' gives the ith form function type name.
-        // 'formfuncpolys[i].second' gives a vector detailed below.
-        // 'formfuncpolys[i].second[elemtypenum][interpolorder][0]' gives the polynomials.
-        static std::vector<std::pair< std::string, std::vector<std::vector< std::vector<hierarchicalformfunctioncontainer> >> >> formfuncpolys;
+        // Store all !HIERARCHICAL! form function polynomials. They never change once built and are shared by all threads and meshes.
+        // 'formfuncpolys[fftypename][elemtypenum][interpolorder]' gives the polynomials (NULL if not yet built).
+        static std::unordered_map<std::string, std::vector<std::vector<std::shared_ptr<hierarchicalformfunctioncontainer>>>> formfuncpolys;
+        static std::mutex formfuncpolysmutex;
+        // Get the polynomials, build them if not yet available. This can be called by multiple threads at the same time:
+        static std::shared_ptr<hierarchicalformfunctioncontainer> getformfuncpolys(std::string fftypename, int elementtypenumber, int interpolorder);
+        // Number of 'gethff' calls that could reuse the evaluated values (hits) and that had to evaluate them (misses):
+        static std::atomic<long long int> numhffhits;
+        static std::atomic<long long int> numhffmisses;
 
-        // This function returns the requested form function values and reuses any already computed value if 'isreuseallowed' is true.
-        // In case 'isreuseallowed' is false a pointer to the evaluated form function polynomial storage is returned for speed reasons.
-        // When multiple calls follow each other and 'isreuseallowed' is false the latter storage might be modified!
-        static hierarchicalformfunctioncontainer* gethff(std::string fftypename, int elementtypenumber, int interpolorder, std::vector<double> evaluationcoordinates);
-        // Keep the polynomials but reset the values:
+        // This function returns the requested form function values. The values are stored in the current evaluation context
+        // for every form function type, element type, order and evaluation points and reused by the next calls for the same.
+        // The returned values are never modified afterwards.
+        static std::shared_ptr<hierarchicalformfunctioncontainer> gethff(std::string fftypename, int elementtypenumber, int interpolorder, std::vector<double>& evaluationcoordinates);
+        // Keep the polynomials but clear the values stored in the current context:
         static void resethff(void);
+        static long long int counthffhits(void) { return numhffhits; };
+        static long long int counthffmisses(void) { return numhffmisses; };
         
         
         // Store element split definitions. splitdefinition[elementtypenumber][splitidentifier].
         static std::vector< std::vector< std::vector<std::vector<int>> > > splitdefinition;
+        // The split definitions can be accessed by multiple threads during mesh adaptation:
+        static std::mutex splitdefinitionmutex;
         // Return true if available and false otherwise.
         static bool getsplitdefinition(std::vector<std::vector<int>>& splitdef, int elementtypenumber, int splitnum, std::vector<int>& edgenumbers);
         static void setsplitdefinition(std::vector<std::vector<int>>& splitdef, int elementtypenumber, int splitnum, std::vector<int>& edgenumbers);
         
 };
 
+template <typename F, typename... Args>
+std::thread universe::newthread(F&& f, Args&&... args)
+{
+    session* s = getsession();
+    return std::thread([s](typename std::decay<F>::type fn, typename std::decay<Args>::type... fnargs)
+    {
+        setsession(s);
+        fn(fnargs...);
+    }, std::forward<F>(f), std::forward<Args>(args)...);
+}
+
 #endif
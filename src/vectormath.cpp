@@ -0,0 +1,365 @@
+#include "vectormath.h"
+
+
+bool vectormath::isitenabled = true;
+
+void vectormath::enable(bool isenabled) { isitenabled = isenabled; }
+
+// Compile the kernels for several instruction sets (best one selected at runtime).
+// The kernels must be inlined in every clone. This file is compiled without 'errno'
+// and trapping math so that the square roots and roundings are vectorized.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define VECTORMATH_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#define VECTORMATH_INLINE __attribute__((always_inline)) inline
+#else
+#define VECTORMATH_CLONES
+#define VECTORMATH_INLINE inline
+#endif
+
+// The values are processed by blocks so that the out of range values can be fixed afterwards:
+static const int vectormathblocksize = 256;
+
+static const double PIO2 = 1.57079632679489661923;
+static const double PIO4 = 7.85398163397448309616E-1;
+static const double SQRTH = 7.07106781186547524401E-1;
+
+// Sine and cosine (Cephes 'sin.c'). The argument reduction is accurate up to 2^30:
+static const double SINCOSMAX = 1.073741824e9;
+static const double DP1 = 7.85398125648498535156E-1;
+static const double DP2 = 3.77489470793079817668E-8;
+static const double DP3 = 2.69515142907905952645E-15;
+
+static VECTORMATH_INLINE void sincoskernel(double x, double& sinval, double& cosval)
+{
+    double ax = std::fabs(x);
+    double y = std::floor(ax/PIO4);
+    // Octant number (made even):
+    double j = y - 8.0*std::floor(y*0.125);
+    double isodd = j - 2.0*std::floor(j*0.5);
+    y += isodd;
+    j += isodd;
+    j = (j > 7.0) ? j - 8.0 : j;
+
+    double sinsign = std::copysign(1.0, x);
+    double cossign = 1.0;
+    bool isgt3 = (j > 3.0);
+    sinsign = isgt3 ? -sinsign : sinsign;
+    cossign = isgt3 ? -cossign : cossign;
+    j = isgt3 ? j - 4.0 : j;
+    bool isj2 = (j > 1.0);
+    cossign = isj2 ? -cossign : cossign;
+
+    double z = ((ax - y*DP1) - y*DP2) - y*DP3;
+    double zz = z*z;
+
+    double s = z + z*zz*(((((1.58962301576546568060E-10*zz - 2.50507477628578072866E-8)*zz + 2.75573136213857245213E-6)*zz - 1.98412698295895385996E-4)*zz + 8.33333333332211858878E-3)*zz - 1.66666666666666307295E-1);
+    double c = 1.0 - 0.5*zz + zz*zz*(((((-1.13585365213876817300E-11*zz + 2.08757008419747316778E-9)*zz - 2.75573141792967388112E-7)*zz + 2.48015872888517045348E-5)*zz - 1.38888888888730564116E-3)*zz + 4.16666666666665929218E-2);
+
+    sinval = sinsign * (isj2 ? c : s);
+    cosval = cossign * (isj2 ? s : c);
+}
+
+// Arctangent (Cephes 'atan.c'):
+static const double T3P8 = 2.41421356237309504880;
+static const double MOREBITS = 6.123233995736765886130E-17;
+
+static VECTORMATH_INLINE double atankernel(double x)
+{
+    double ax = std::fabs(x);
+
+    bool isbig = (ax > T3P8);
+    bool ismid = (not(isbig) && ax > 0.66);
+
+    double t = isbig ? -1.0/ax : (ismid ? (ax-1.0)/(ax+1.0) : ax);
+    double y = isbig ? PIO2 : (ismid ? PIO4 : 0.0);
+    double more = isbig ? MOREBITS : (ismid ? 0.5*MOREBITS : 0.0);
+
+    double z = t*t;
+    double p = (((-8.750608600031904122785E-1*z - 1.615753718733365076637E1)*z - 7.500855792314704667340E1)*z - 1.228866684490136173410E2)*z - 6.485021904942025371773E1;
+    double q = ((((z + 2.485846490142306297962E1)*z + 1.650270098316988542046E2)*z + 4.328810604912902668951E2)*z + 4.853903996359136964868E2)*z + 1.945506571482613964425E2;
+    z = z*p/q;
+    z = t*z + t + more;
+
+    return std::copysign(y + z, x);
+}
+
+// Base 10 logarithm (Cephes 'log10.c'):
+static const double L102A = 3.0078125E-1;
+static const double L102B = 2.48745663981195213739E-4;
+static const double L10EA = 4.3359375E-1;
+static const double L10EB = 7.00731903251827651129E-4;
+
+static VECTORMATH_INLINE double log10kernel(double x)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(double));
+
+    // Get the exponent as a double without integer to double conversion:
+    std::uint64_t ebits = (bits >> 52) | 0x4330000000000000ULL;
+    double e;
+    std::memcpy(&e, &ebits, sizeof(double));
+    e = e - 4503599627370496.0 - 1022.0;
+
+    // Mantissa in [0.5,1):
+    std::uint64_t mbits = (bits & 0x000fffffffffffffULL) | 0x3fe0000000000000ULL;
+    double m;
+    std::memcpy(&m, &mbits, sizeof(double));
+
+    bool islow = (m < SQRTH);
+    e = islow ? e - 1.0 : e;
+    double t = islow ? 2.0*m - 1.0 : m - 1.0;
+
+    double z = t*t;
+    double p = (((((4.58482948458143443514E-5*t + 4.98531067254050724270E-1)*t + 6.56312093769992875930E0)*t + 2.97877425097986925891E1)*t + 6.06127134467767258030E1)*t + 5.67349287391754285487E1)*t + 1.98892446572874072159E1;
+    double q = (((((t + 1.50314182634250003249E1)*t + 8.27410449222435217021E1)*t + 2.20664384982121929218E2)*t + 3.07254189979530058263E2)*t + 2.14955586696422947765E2)*t + 5.96677339718622216300E1;
+    double y = t*(z*p/q);
+    y = y - 0.5*z;
+
+    double r = (t + y)*L10EB;
+    r += y*L10EA;
+    r += t*L10EA;
+    r += e*L102B;
+    r += e*L102A;
+
+    return r;
+}
+
+VECTORMATH_CLONES
+static void sincosblocks(double* values, long long int num, int which)
+{
+    double orig[vectormathblocksize];
+    for (long long int start = 0; start < num; start += vectormathblocksize)
+    {
+        int len = std::min((long long int)vectormathblocksize, num-start);
+        double* vals = values+start;
+
+        for (int i = 0; i < len; i++)
+            orig[i] = vals[i];
+
+        double s, c;
+        if (which == 0)
+        {
+            #pragma omp simd private(s, c)
+            for (int i = 0; i < len; i++)
+            {
+                sincoskernel(vals[i], s, c);
+                vals[i] = s;
+            }
+        }
+        if (which == 1)
+        {
+            #pragma omp simd private(s, c)
+            for (int i = 0; i < len; i++)
+            {
+                sincoskernel(vals[i], s, c);
+                vals[i] = c;
+            }
+        }
+        if (which == 2)
+        {
+            #pragma omp simd private(s, c)
+            for (int i = 0; i < len; i++)
+            {
+                sincoskernel(vals[i], s, c);
+                vals[i] = s/c;
+            }
+        }
+
+        for (int i = 0; i < len; i++)
+        {
+            if (not(std::fabs(orig[i]) <= SINCOSMAX))
+                vals[i] = (which == 0) ? std::sin(orig[i]) : ((which == 1) ? std::cos(orig[i]) : std::tan(orig[i]));
+        }
+    }
+}
+
+VECTORMATH_CLONES
+static void atanblocks(double* values, long long int num, int which)
+{
+    if (which == 0)
+    {
+        #pragma omp simd
+        for (long long int i = 0; i < num; i++)
+            values[i] = atankernel(values[i]);
+    }
+    // asin(x) = atan(x/sqrt(1-x^2)), the (1-x)*(1+x) product is accurate close to 1 and -1:
+    if (which == 1)
+    {
+        #pragma omp simd
+        for (long long int i = 0; i < num; i++)
+            values[i] = atankernel(values[i]/std::sqrt((1.0-values[i])*(1.0+values[i])));
+    }
+    // acos(x) = 2*atan(sqrt((1-x)/(1+x))) has no cancellation close to 1:
+    if (which == 2)
+    {
+        #pragma omp simd
+        for (long long int i = 0; i < num; i++)
+            values[i] = 2.0*atankernel(std::sqrt((1.0-values[i])/(1.0+values[i])));
+    }
+}
+
+VECTORMATH_CLONES
+static void log10blocks(double* values, long long int num)
+{
+    double orig[vectormathblocksize];
+    for (long long int start = 0; start < num; start += vectormathblocksize)
+    {
+        int len = std::min((long long int)vectormathblocksize, num-start);
+        double* vals = values+start;
+
+        for (int i = 0; i < len; i++)
+            orig[i] = vals[i];
+
+        #pragma omp simd
+        for (int i = 0; i < len; i++)
+            vals[i] = log10kernel(vals[i]);
+
+        // Zero, negative, subnormal, infinite and NaN values:
+        for (int i = 0; i < len; i++)
+        {
+            if (not(orig[i] >= DBL_MIN && orig[i] <= DBL_MAX))
+                vals[i] = std::log10(orig[i]);
+        }
+    }
+}
+
+VECTORMATH_CLONES
+static void integerpowerblocks(double* values, long long int num, int exponent)
+{
+    int absexponent = std::abs(exponent);
+
+    double base[vectormathblocksize];
+    for (long long int start = 0; start < num; start += vectormathblocksize)
+    {
+        int len = std::min((long long int)vectormathblocksize, num-start);
+        double* vals = values+start;
+
+        #pragma omp simd
+        for (int i = 0; i < len; i++)
+        {
+            base[i] = vals[i];
+            vals[i] = 1.0;
+        }
+
+        // Binary exponentiation:
+        for (int bit = 1; bit <= absexponent; bit *= 2)
+        {
+            if (absexponent & bit)
+            {
+                #pragma omp simd
+                for (int i = 0; i < len; i++)
+                    vals[i] *= base[i];
+            }
+            if (2*bit <= absexponent)
+            {
+                #pragma omp simd
+                for (int i = 0; i < len; i++)
+                    base[i] *= base[i];
+            }
+        }
+
+        if (exponent < 0)
+        {
+            #pragma omp simd
+            for (int i = 0; i < len; i++)
+                vals[i] = 1.0/vals[i];
+        }
+    }
+}
+
+void vectormath::sin(double* values, long long int num)
+{
+    if (isitenabled)
+        sincosblocks(values, num, 0);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::sin(values[i]);
+    }
+}
+
+void vectormath::cos(double* values, long long int num)
+{
+    if (isitenabled)
+        sincosblocks(values, num, 1);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::cos(values[i]);
+    }
+}
+
+void vectormath::tan(double* values, long long int num)
+{
+    if (isitenabled)
+        sincosblocks(values, num, 2);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::tan(values[i]);
+    }
+}
+
+void vectormath::asin(double* values, long long int num)
+{
+    if (isitenabled)
+        atanblocks(values, num, 1);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::asin(values[i]);
+    }
+}
+
+void vectormath::acos(double* values, long long int num)
+{
+    if (isitenabled)
+        atanblocks(values, num, 2);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::acos(values[i]);
+    }
+}
+
+void vectormath::atan(double* values, long long int num)
+{
+    if (isitenabled)
+        atanblocks(values, num, 0);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::atan(values[i]);
+    }
+}
+
+void vectormath::log10(double* values, long long int num)
+{
+    if (isitenabled)
+        log10blocks(values, num);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::log10(values[i]);
+    }
+}
+
+void vectormath::power(double* values, double* exponents, long long int num)
+{
+    if (num == 0)
+        return;
+
+    // Check if the exponent is an integer identical for all values:
+    double exponent = exponents[0];
+    bool isintegerpower = (isitenabled && std::fabs(exponent) <= 64 && exponent == std::floor(exponent));
+    for (long long int i = 1; i < num && isintegerpower; i++)
+        isintegerpower = (exponents[i] == exponent);
+
+    if (isintegerpower)
+        integerpowerblocks(values, num, (int)exponent);
+    else
+    {
+        for (long long int i = 0; i < num; i++)
+            values[i] = std::pow(values[i], exponents[i]);
+    }
+}
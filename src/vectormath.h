@@ -0,0 +1,54 @@
+// sparselizard - Copyright (C) see copyright file.
+//
+// See the LICENSE file for license information. Please report all
+// bugs and problems to <alexandre.halbach at gmail.com>.
+
+// This object evaluates the elementwise transcendental functions on arrays of values. The functions
+// are branch free polynomial and rational approximations (as in the Cephes library) written so that
+// the loops are vectorized by the compiler. On x86-64 with GCC every function is compiled for AVX-512,
+// AVX2 (with FMA) and the baseline instruction set and the best version is selected at runtime from
+// the CPU features.
+//
+// The results are within a few units in the last place of the standard library functions. The values
+// out of the range of the approximations (very large sine arguments, subnormals, ...) are evaluated with
+// the standard library. Disabling the object makes all functions call the standard library.
+
+
+#ifndef VECTORMATH_H
+#define VECTORMATH_H
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <cfloat>
+#include <algorithm>
+
+class vectormath
+{
+    private:
+
+        static bool isitenabled;
+
+    public:
+
+        // The object is enabled by default:
+        static void enable(bool isenabled = true);
+        static bool isenabled(void) { return isitenabled; };
+
+        // Replace the 'num' values by their image:
+        static void sin(double* values, long long int num);
+        static void cos(double* values, long long int num);
+        static void tan(double* values, long long int num);
+        static void asin(double* values, long long int num);
+        static void acos(double* values, long long int num);
+        static void atan(double* values, long long int num);
+        static void log10(double* values, long long int num);
+
+        // Replace the values by their power. Integer exponents in [-64,64] identical
+        // for all values are computed with multiplications only:
+        static void power(double* values, double* exponents, long long int num);
+
+};
+
+#endif